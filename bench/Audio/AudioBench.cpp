@@ -0,0 +1,9 @@
+#include <AudioBench.hpp>
+
+namespace bench
+{
+std::filesystem::path audioFile(const char* name)
+{
+    return std::filesystem::path(BENCH_AUDIO_PATH) / name;
+}
+} // namespace bench
@@ -0,0 +1,14 @@
+// Helpers shared by the audio benchmarks
+
+#pragma once
+
+#include <filesystem>
+
+namespace bench
+{
+// Sound files decoded by the benchmarks, one per supported format
+inline constexpr const char* audioFiles[] = {"ding.flac", "ding.mp3", "doodle_pop.ogg", "killdeer.wav"};
+
+// Full path of one of the audio files
+[[nodiscard]] std::filesystem::path audioFile(const char* name);
+} // namespace bench
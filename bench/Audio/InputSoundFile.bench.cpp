@@ -0,0 +1,46 @@
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <AudioBench.hpp>
+#include <BenchUtil.hpp>
+#include <array>
+#include <optional>
+#include <string>
+
+#include <cstdint>
+
+namespace
+{
+// Decode a whole file over and over, as a music player would
+bench::Result decode(const char* name)
+{
+    auto file = sf::InputSoundFile::openFromFile(bench::audioFile(name));
+    if (!file)
+        return {};
+
+    std::array<std::int16_t, 4096> samples{};
+    bench::Result                 result;
+    const sf::Clock               clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        file->seek(std::uint64_t{0});
+        while (const std::uint64_t count = file->read(samples.data(), samples.size()))
+        {
+            result.operations += count;
+            result.bytes += count * sizeof(std::int16_t);
+        }
+    }
+    result.elapsed = clock.getElapsedTime();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchInputSoundFile(Runner& runner)
+{
+    for (const char* name : audioFiles)
+        runner.run(std::string("InputSoundFile decode ") + name, [name] { return decode(name); });
+}
+} // namespace bench
@@ -0,0 +1,15 @@
+#include <BenchUtil.hpp>
+
+#include <cstdlib>
+
+int main(int argc, char* argv[])
+{
+    bench::Runner runner(argc > 1 ? argv[1] : "");
+
+    bench::benchInputSoundFile(runner);
+    bench::benchSoundBuffer(runner);
+    bench::benchSound(runner);
+    bench::benchSoundStream(runner);
+
+    return runner.hasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
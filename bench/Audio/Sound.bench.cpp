@@ -0,0 +1,61 @@
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <AudioBench.hpp>
+#include <BenchUtil.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <ctime>
+
+namespace
+{
+// Play many looping sounds at once and measure the CPU time the mixer uses meanwhile;
+// std::clock measures the CPU time of the whole process on POSIX systems (the audio
+// device thread included), but only elapsed time on Windows
+bench::Result mix(std::size_t count, bool spatialized)
+{
+    const auto buffer = sf::SoundBuffer::loadFromFile(bench::audioFile("killdeer.wav"));
+    if (!buffer)
+        return {};
+
+    std::vector<sf::Sound> sounds;
+    sounds.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        sf::Sound& sound = sounds.emplace_back(*buffer);
+        sound.setLoop(true);
+        sound.setSpatializationEnabled(spatialized);
+        sound.setPosition({static_cast<float>(i % 16) - 8.f, 0.f, static_cast<float>(i / 16)});
+        sound.play();
+    }
+
+    const std::clock_t start = std::clock();
+    const sf::Clock    clock;
+    sf::sleep(bench::duration);
+    const float cpuSeconds = static_cast<float>(std::clock() - start) / CLOCKS_PER_SEC;
+
+    bench::Result result;
+    result.elapsed    = clock.getElapsedTime();
+    result.operations = count;
+    result.metrics.emplace_back("cpu %", 100.f * cpuSeconds / result.elapsed.asSeconds());
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchSound(Runner& runner)
+{
+    for (const std::size_t count : {std::size_t{1}, std::size_t{16}, std::size_t{64}, std::size_t{256}})
+    {
+        runner.run("Sound mix " + std::to_string(count), [count] { return mix(count, false); });
+        runner.run("Sound mix " + std::to_string(count) + " spatialized", [count] { return mix(count, true); });
+    }
+}
+} // namespace bench
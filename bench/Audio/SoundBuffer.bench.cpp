@@ -0,0 +1,39 @@
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <AudioBench.hpp>
+#include <BenchUtil.hpp>
+#include <optional>
+#include <string>
+
+namespace
+{
+// Open, decode and upload a file, as a game does when loading a level
+bench::Result load(const char* name)
+{
+    bench::Result   result;
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        const sf::Clock loadClock;
+        const auto      buffer = sf::SoundBuffer::loadFromFile(bench::audioFile(name));
+        if (!buffer)
+            return {};
+
+        result.latencies.push_back(loadClock.getElapsedTime().asSeconds() * 1'000'000.f);
+        ++result.operations;
+    }
+    result.elapsed = clock.getElapsedTime();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchSoundBuffer(Runner& runner)
+{
+    for (const char* name : audioFiles)
+        runner.run(std::string("SoundBuffer loadFromFile ") + name, [name] { return load(name); });
+}
+} // namespace bench
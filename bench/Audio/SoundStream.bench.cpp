@@ -0,0 +1,118 @@
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <AudioBench.hpp>
+#include <BenchUtil.hpp>
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Chunks hold 10 ms of audio, about the period of an audio device; since the device
+// thread also has to mix all the other sources, decoding one must take at most half of it
+constexpr unsigned int chunksPerSecond = 100;
+constexpr float        budget          = 5'000.f; // In microseconds
+
+// Stream decoding a file like sf::Music does, timing every request of the audio device
+class TimedStream : public sf::SoundStream
+{
+public:
+    explicit TimedStream(sf::InputSoundFile&& file) :
+    m_file(std::move(file)),
+    m_samples(m_file.getSampleRate() * m_file.getChannelCount() / chunksPerSecond)
+    {
+        initialize(m_file.getChannelCount(), m_file.getSampleRate(), m_file.getChannelMap());
+        setLoop(true);
+    }
+
+    ~TimedStream() override
+    {
+        stop();
+    }
+
+    TimedStream(const TimedStream&)            = delete;
+    TimedStream& operator=(const TimedStream&) = delete;
+
+    // Called on the main thread while the stream is stopped
+    [[nodiscard]] std::vector<float> getLatencies() const
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_latencies;
+    }
+
+private:
+    [[nodiscard]] bool onGetData(Chunk& data) override
+    {
+        const sf::Clock clock;
+
+        data.samples     = m_samples.data();
+        data.sampleCount = static_cast<std::size_t>(m_file.read(m_samples.data(), m_samples.size()));
+
+        const std::lock_guard lock(m_mutex);
+        m_latencies.push_back(clock.getElapsedTime().asSeconds() * 1'000'000.f);
+        return data.sampleCount > 0;
+    }
+
+    void onSeek(sf::Time timeOffset) override
+    {
+        m_file.seek(timeOffset);
+    }
+
+    sf::InputSoundFile        m_file;
+    std::vector<std::int16_t> m_samples;
+    mutable std::mutex        m_mutex;
+    std::vector<float>        m_latencies;
+};
+
+bench::Result stream(const char* name, sf::Time decodeAhead)
+{
+    auto file = sf::InputSoundFile::openFromFile(bench::audioFile(name));
+    if (!file)
+        return {};
+
+    TimedStream timedStream(std::move(*file));
+    timedStream.setDecodeAheadDuration(decodeAhead);
+
+    const sf::Clock clock;
+    timedStream.play();
+    sf::sleep(bench::duration);
+    timedStream.stop();
+
+    bench::Result result;
+    result.elapsed   = clock.getElapsedTime();
+    result.latencies = timedStream.getLatencies();
+    if (result.latencies.empty())
+        return {};
+
+    result.operations = result.latencies.size();
+    result.metrics.emplace_back("underruns", static_cast<float>(timedStream.getUnderrunCount()));
+
+    const float slowest = *std::max_element(result.latencies.begin(), result.latencies.end());
+    if (slowest > budget)
+        result.failure = "a callback took " + std::to_string(slowest) + " us, the budget is " +
+                         std::to_string(budget) + " us";
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchSoundStream(Runner& runner)
+{
+    for (const char* name : audioFiles)
+    {
+        runner.run(std::string("SoundStream callback ") + name, [name] { return stream(name, sf::Time::Zero); });
+        runner.run(std::string("SoundStream callback ") + name + " decode ahead",
+                   [name] { return stream(name, sf::milliseconds(200)); });
+    }
+}
+} // namespace bench
@@ -0,0 +1,67 @@
+#include <BenchUtil.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+float percentile(const std::vector<float>& sorted, float ratio)
+{
+    const auto index = static_cast<std::size_t>(ratio * static_cast<float>(sorted.size() - 1));
+    return sorted[index];
+}
+} // namespace
+
+namespace bench
+{
+Runner::Runner(std::string filter) : m_filter(std::move(filter))
+{
+}
+
+void Runner::run(const std::string& name, const std::function<Result()>& benchmark)
+{
+    if (name.find(m_filter) == std::string::npos)
+        return;
+
+    Result            result = benchmark();
+    const std::string padded = name + std::string(name.size() < 40 ? 40 - name.size() : 1, ' ');
+    if (result.operations == 0)
+    {
+        std::cout << padded << "skipped: could not set up the benchmark" << std::endl;
+        return;
+    }
+
+    const float seconds = std::max(result.elapsed.asSeconds(), 1e-9f);
+
+    std::cout << padded << std::fixed << std::setprecision(0) << std::setw(12)
+              << static_cast<float>(result.operations) / seconds << " op/s";
+    if (result.bytes > 0)
+        std::cout << std::setprecision(1) << std::setw(10)
+                  << static_cast<float>(result.bytes) / seconds / (1024.f * 1024.f) << " MiB/s";
+
+    if (!result.latencies.empty())
+    {
+        std::sort(result.latencies.begin(), result.latencies.end());
+        std::cout << std::setprecision(1) << "  p50 " << percentile(result.latencies, 0.5f) << " us  p99 "
+                  << percentile(result.latencies, 0.99f) << " us  max " << result.latencies.back() << " us";
+    }
+
+    for (const auto& [metric, value] : result.metrics)
+        std::cout << std::setprecision(1) << "  " << metric << " " << value;
+
+    std::cout << std::endl;
+
+    if (!result.failure.empty())
+    {
+        std::cout << "    FAILED: " << result.failure << std::endl;
+        m_failed = true;
+    }
+}
+
+bool Runner::hasFailed() const
+{
+    return m_failed;
+}
+} // namespace bench
@@ -0,0 +1,63 @@
+// Minimal benchmark harness: benchmarks repeat an operation for a fixed
+// time and report their rate, throughput and latency percentiles.
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bench
+{
+// Result of a benchmark
+struct Result
+{
+    std::uint64_t      operations{}; // Number of operations performed
+    std::uint64_t      bytes{};      // Number of bytes processed, 0 if irrelevant
+    sf::Time           elapsed;      // Time taken by all the operations
+    std::vector<float> latencies;    // Optional per-operation latencies, in microseconds
+
+    std::vector<std::pair<std::string, float>> metrics; // Additional values to report, per operation
+
+    std::string failure; // Reason why the benchmark exceeded its budget, empty if it didn't
+};
+
+class Runner
+{
+public:
+    // Only the benchmarks whose name contains the filter are run
+    explicit Runner(std::string filter);
+
+    // Run a benchmark if it matches the filter, and print its result;
+    // benchmarks that can't run in this environment return no operation
+    void run(const std::string& name, const std::function<Result()>& benchmark);
+
+    // Tell whether a benchmark exceeded its budget
+    [[nodiscard]] bool hasFailed() const;
+
+private:
+    std::string m_filter;
+    bool        m_failed{};
+};
+
+// Duration of each benchmark
+inline const sf::Time duration = sf::milliseconds(500);
+
+// Register the benchmarks of each component
+void benchPacket(Runner& runner);
+void benchSocketSelector(Runner& runner);
+void benchTcpSocket(Runner& runner);
+void benchUdpSocket(Runner& runner);
+void benchRenderTarget(Runner& runner);
+void benchTexture(Runner& runner);
+void benchInputSoundFile(Runner& runner);
+void benchSound(Runner& runner);
+void benchSoundBuffer(Runner& runner);
+void benchSoundStream(Runner& runner);
+} // namespace bench
@@ -0,0 +1,50 @@
+#include <SFML/Graphics/GpuProfiler.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <GraphicsBench.hpp>
+
+namespace bench
+{
+Result renderFrames(sf::RenderTexture& target, const std::function<void()>& draw)
+{
+    sf::GpuProfiler                    profiler(target);
+    const sf::RenderTarget::Statistics before = target.getStatistics();
+    sf::Time                           gpuTime;
+    std::size_t                        gpuSamples = 0;
+    Result                             result;
+
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < duration)
+    {
+        const sf::Clock frame;
+        {
+            const sf::GpuProfiler::Scope scope(profiler, "Frame");
+            target.clear();
+            draw();
+        }
+        target.display();
+        profiler.endFrame();
+        result.latencies.push_back(static_cast<float>(frame.getElapsedTime().asMicroseconds()));
+        ++result.operations;
+
+        // The GPU time is sampled from the last frame that the profiler collected
+        if (!profiler.getResults().empty())
+        {
+            gpuTime += profiler.getResults().front().gpuTime;
+            ++gpuSamples;
+        }
+    }
+    result.elapsed = clock.getElapsedTime();
+
+    const sf::RenderTarget::Statistics& after  = target.getStatistics();
+    const auto                          frames = static_cast<float>(result.operations);
+    result.metrics.emplace_back("draws/frame", static_cast<float>(after.drawCalls - before.drawCalls) / frames);
+    result.metrics.emplace_back("states/frame", static_cast<float>(after.stateChanges - before.stateChanges) / frames);
+    if (sf::GpuProfiler::isAvailable() && (gpuSamples > 0))
+        result.metrics.emplace_back("gpu us/frame",
+                                    static_cast<float>(gpuTime.asMicroseconds()) / static_cast<float>(gpuSamples));
+
+    return result;
+}
+} // namespace bench
@@ -0,0 +1,18 @@
+// Rendering of benchmark frames into an offscreen target
+
+#pragma once
+
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <BenchUtil.hpp>
+#include <functional>
+
+namespace bench
+{
+// Size of the offscreen targets
+inline constexpr sf::Vector2u targetSize{1280, 720};
+
+// Render frames for the duration of a benchmark, and measure their CPU time,
+// GPU time and number of draw calls
+Result renderFrames(sf::RenderTexture& target, const std::function<void()>& draw);
+} // namespace bench
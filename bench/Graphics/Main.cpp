@@ -0,0 +1,13 @@
+#include <BenchUtil.hpp>
+
+#include <cstdlib>
+
+int main(int argc, char* argv[])
+{
+    bench::Runner runner(argc > 1 ? argv[1] : "");
+
+    bench::benchRenderTarget(runner);
+    bench::benchTexture(runner);
+
+    return runner.hasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,201 @@
+#include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Glsl.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <BenchUtil.hpp>
+#include <GraphicsBench.hpp>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+constexpr std::size_t spriteCount = 10'000;
+constexpr std::size_t textCount   = 500;
+constexpr std::size_t circleCount = 1'000;
+constexpr std::size_t vertexCount = 60'000;
+constexpr std::size_t quadCount   = 1'000;
+
+// Random positions inside the target, the same for every run
+std::vector<sf::Vector2f> makePositions(std::size_t count)
+{
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> x(0.f, static_cast<float>(bench::targetSize.x));
+    std::uniform_real_distribution<float> y(0.f, static_cast<float>(bench::targetSize.y));
+
+    std::vector<sf::Vector2f> positions(count);
+    for (sf::Vector2f& position : positions)
+        position = {x(generator), y(generator)};
+    return positions;
+}
+
+// Small textures of different colors
+std::vector<sf::Texture> makeTextures(std::size_t count)
+{
+    std::vector<sf::Texture> textures;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto      shade = static_cast<std::uint8_t>(255 * i / count);
+        const sf::Image image({32, 32}, sf::Color(shade, static_cast<std::uint8_t>(255 - shade), 128));
+        if (std::optional<sf::Texture> texture = sf::Texture::loadFromImage(image))
+            textures.push_back(std::move(*texture));
+    }
+    return textures;
+}
+
+bench::Result sprites(std::size_t textureCount)
+{
+    auto                           target   = sf::RenderTexture::create(bench::targetSize);
+    const std::vector<sf::Texture> textures = makeTextures(textureCount);
+    if (!target || (textures.size() != textureCount))
+        return {};
+
+    std::vector<sf::Sprite> sprites;
+    sprites.reserve(spriteCount);
+    for (const sf::Vector2f& position : makePositions(spriteCount))
+    {
+        sprites.emplace_back(textures[sprites.size() % textures.size()]);
+        sprites.back().setPosition(position);
+    }
+
+    return bench::renderFrames(*target,
+                               [&]
+                               {
+                                   for (const sf::Sprite& sprite : sprites)
+                                       target->draw(sprite);
+                               });
+}
+
+bench::Result texts()
+{
+    auto       target = sf::RenderTexture::create(bench::targetSize);
+    const auto font   = sf::Font::loadFromFile(BENCH_FONT_PATH);
+    if (!target || !font)
+        return {};
+
+    std::vector<sf::Text> texts;
+    texts.reserve(textCount);
+    for (const sf::Vector2f& position : makePositions(textCount))
+    {
+        texts.emplace_back(*font, "The quick brown fox jumps over the lazy dog", 16);
+        texts.back().setPosition(position);
+    }
+
+    return bench::renderFrames(*target,
+                               [&]
+                               {
+                                   for (const sf::Text& text : texts)
+                                       target->draw(text);
+                               });
+}
+
+bench::Result circles()
+{
+    auto target = sf::RenderTexture::create(bench::targetSize);
+    if (!target)
+        return {};
+
+    std::vector<sf::CircleShape>    shapes(circleCount, sf::CircleShape(10.f, 100));
+    const std::vector<sf::Vector2f> positions = makePositions(circleCount);
+    for (std::size_t i = 0; i < circleCount; ++i)
+        shapes[i].setPosition(positions[i]);
+
+    // Changing the radius every frame tessellates the circles again
+    float radius = 10.f;
+    return bench::renderFrames(*target,
+                               [&]
+                               {
+                                   radius = (radius < 20.f) ? radius + 0.5f : 10.f;
+                                   for (sf::CircleShape& shape : shapes)
+                                   {
+                                       shape.setRadius(radius);
+                                       target->draw(shape);
+                                   }
+                               });
+}
+
+bench::Result vertexBuffer()
+{
+    auto target = sf::RenderTexture::create(bench::targetSize);
+    if (!target || !sf::VertexBuffer::isAvailable())
+        return {};
+
+    sf::VertexBuffer buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Stream);
+    if (!buffer.create(vertexCount))
+        return {};
+
+    std::vector<sf::Vertex>         vertices(vertexCount);
+    const std::vector<sf::Vector2f> positions = makePositions(vertexCount);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+        vertices[i].position = positions[i];
+
+    // Refill the whole buffer every frame, as particle systems do
+    return bench::renderFrames(*target,
+                               [&]
+                               {
+                                   for (sf::Vertex& vertex : vertices)
+                                       vertex.position.x = static_cast<float>(bench::targetSize.x) - vertex.position.x;
+                                   if (buffer.update(vertices.data()))
+                                       target->draw(buffer);
+                               });
+}
+
+bench::Result uniforms()
+{
+    auto target = sf::RenderTexture::create(bench::targetSize);
+    if (!target || !sf::Shader::isAvailable())
+        return {};
+
+    auto shader = sf::Shader::loadFromMemory("uniform vec4 color;"
+                                             "void main() { gl_FragColor = color; }",
+                                             sf::Shader::Type::Fragment);
+    if (!shader)
+        return {};
+
+    std::vector<sf::RectangleShape> quads(quadCount, sf::RectangleShape({8.f, 8.f}));
+    const std::vector<sf::Vector2f> positions = makePositions(quadCount);
+    for (std::size_t i = 0; i < quadCount; ++i)
+        quads[i].setPosition(positions[i]);
+
+    // A different uniform value before every draw
+    return bench::renderFrames(*target,
+                               [&]
+                               {
+                                   for (std::size_t i = 0; i < quads.size(); ++i)
+                                   {
+                                       const float shade = static_cast<float>(i) / static_cast<float>(quads.size());
+                                       shader->setUniform("color", sf::Glsl::Vec4(shade, 1.f - shade, 0.5f, 1.f));
+                                       target->draw(quads[i], &*shader);
+                                   }
+                               });
+}
+} // namespace
+
+namespace bench
+{
+void benchRenderTarget(Runner& runner)
+{
+    runner.run("Sprite x " + std::to_string(spriteCount) + ", 1 texture", [] { return sprites(1); });
+    runner.run("Sprite x " + std::to_string(spriteCount) + ", 64 textures", [] { return sprites(64); });
+    runner.run("Text x " + std::to_string(textCount), texts);
+    runner.run("CircleShape x " + std::to_string(circleCount) + ", 100 points", circles);
+    runner.run("VertexBuffer stream " + std::to_string(vertexCount) + " vertices", vertexBuffer);
+    runner.run("Shader uniform per draw x " + std::to_string(quadCount), uniforms);
+}
+} // namespace bench
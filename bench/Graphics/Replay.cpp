@@ -0,0 +1,83 @@
+// Replay of draw captures saved with sf::CommandList::saveToFile, to reproduce the
+// rendering workload of an application and gate releases on its frame time:
+//   sfml-replay [--budget <microseconds>] <capture>...
+
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <BenchUtil.hpp>
+#include <GraphicsBench.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdlib>
+
+namespace
+{
+// Replay a capture onto an offscreen target of its size, every frame
+bench::Result replay(const std::filesystem::path& filename, std::optional<float> budget)
+{
+    auto commandList = sf::CommandList::loadFromFile(filename);
+    if (!commandList)
+        return {};
+
+    auto target = sf::RenderTexture::create(commandList->getSize());
+    if (!target)
+        return {};
+
+    bench::Result result = bench::renderFrames(*target, [&] { commandList->replay(*target); });
+    result.metrics.emplace_back("commands", static_cast<float>(commandList->getCommandCount()));
+
+    // The median is compared to the budget, so that a single hiccup doesn't fail the run
+    std::vector<float> latencies = result.latencies;
+    const auto         middle    = latencies.begin() + static_cast<std::ptrdiff_t>(latencies.size() / 2);
+    std::nth_element(latencies.begin(), middle, latencies.end());
+    const float median = latencies.empty() ? 0.f : *middle;
+    if (budget && (median > *budget))
+        result.failure = "a frame took " + std::to_string(median) + " us, the budget is " + std::to_string(*budget) +
+                         " us";
+    return result;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::optional<float>               budget;
+    std::vector<std::filesystem::path> captures;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if ((argument == "--budget") && (i + 1 < argc))
+            budget = std::stof(argv[++i]);
+        else
+            captures.emplace_back(argument);
+    }
+
+    if (captures.empty())
+    {
+        std::cerr << "Usage: sfml-replay [--budget <microseconds>] <capture>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    bench::Runner runner("");
+    bool          loaded = true;
+
+    for (const std::filesystem::path& capture : captures)
+    {
+        runner.run(capture.filename().string(),
+                   [&]
+                   {
+                       bench::Result result = replay(capture, budget);
+                       loaded               = loaded && (result.operations > 0);
+                       return result;
+                   });
+    }
+
+    return (runner.hasFailed() || !loaded) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
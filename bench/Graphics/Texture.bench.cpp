@@ -0,0 +1,50 @@
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <BenchUtil.hpp>
+#include <GraphicsBench.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+// Upload a whole texture every frame, as video players and software renderers do
+bench::Result upload(unsigned int size)
+{
+    auto target  = sf::RenderTexture::create(bench::targetSize);
+    auto texture = sf::Texture::create({size, size});
+    if (!target || !texture)
+        return {};
+
+    std::vector<std::uint8_t> pixels(std::size_t{size} * size * 4);
+    const sf::Sprite          sprite(*texture);
+    std::uint8_t              value = 0;
+
+    bench::Result result = bench::renderFrames(*target,
+                                               [&]
+                                               {
+                                                   pixels[0] = ++value;
+                                                   texture->update(pixels.data());
+                                                   target->draw(sprite);
+                                               });
+    result.bytes = result.operations * pixels.size();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchTexture(Runner& runner)
+{
+    for (const unsigned int size : {256u, 1024u, 2048u})
+    {
+        runner.run("Texture update " + std::to_string(size) + "x" + std::to_string(size),
+                   [size] { return upload(size); });
+    }
+}
+} // namespace bench
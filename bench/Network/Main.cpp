@@ -0,0 +1,15 @@
+#include <BenchUtil.hpp>
+
+#include <cstdlib>
+
+int main(int argc, char* argv[])
+{
+    bench::Runner runner(argc > 1 ? argv[1] : "");
+
+    bench::benchPacket(runner);
+    bench::benchTcpSocket(runner);
+    bench::benchUdpSocket(runner);
+    bench::benchSocketSelector(runner);
+
+    return runner.hasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#include <SFML/Network/Packet.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <BenchUtil.hpp>
+#include <string>
+
+#include <cstdint>
+
+namespace
+{
+constexpr int recordsPerPacket = 1000;
+
+// A record mixing all the kinds of values a packet can hold
+void write(sf::Packet& packet, int i, const std::string& text)
+{
+    packet << static_cast<std::int8_t>(i) << static_cast<std::int16_t>(i) << static_cast<std::int32_t>(i)
+           << static_cast<std::int64_t>(i) << static_cast<float>(i) << static_cast<double>(i) << (i % 2 == 0) << text;
+}
+
+bench::Result serialize()
+{
+    const std::string text = "sixteen chars...";
+    bench::Result     result;
+    sf::Packet        packet;
+    const sf::Clock   clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        packet.clear();
+        for (int i = 0; i < recordsPerPacket; ++i)
+            write(packet, i, text);
+
+        result.operations += recordsPerPacket;
+        result.bytes += packet.getDataSize();
+    }
+    result.elapsed = clock.getElapsedTime();
+    return result;
+}
+
+bench::Result deserialize()
+{
+    sf::Packet packet;
+    for (int i = 0; i < recordsPerPacket; ++i)
+        write(packet, i, "sixteen chars...");
+
+    bench::Result   result;
+    std::string     text;
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        sf::Packet copy = packet;
+        for (int i = 0; i < recordsPerPacket; ++i)
+        {
+            std::int8_t  int8  = 0;
+            std::int16_t int16 = 0;
+            std::int32_t int32 = 0;
+            std::int64_t int64 = 0;
+            float        real  = 0;
+            double       dbl   = 0;
+            bool         flag  = false;
+            copy >> int8 >> int16 >> int32 >> int64 >> real >> dbl >> flag >> text;
+        }
+
+        result.operations += recordsPerPacket;
+        result.bytes += packet.getDataSize();
+    }
+    result.elapsed = clock.getElapsedTime();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchPacket(Runner& runner)
+{
+    runner.run("Packet serialize mixed record", serialize);
+    runner.run("Packet deserialize mixed record", deserialize);
+}
+} // namespace bench
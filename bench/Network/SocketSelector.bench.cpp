@@ -0,0 +1,70 @@
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <BenchUtil.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+// Wake up one socket among many: cost of a wait and of finding the ready socket
+bench::Result wakeUp(std::size_t socketCount)
+{
+    sf::UdpSocket sender;
+    if (sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+        return {};
+
+    std::vector<std::unique_ptr<sf::UdpSocket>> sockets;
+    sf::SocketSelector                          selector;
+    for (std::size_t i = 0; i < socketCount; ++i)
+    {
+        auto socket = std::make_unique<sf::UdpSocket>();
+        if (socket->bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+            return {};
+
+        selector.add(*socket);
+        sockets.push_back(std::move(socket));
+    }
+
+    char                         byte     = 0;
+    std::size_t                  received = 0;
+    std::optional<sf::IpAddress> address;
+    unsigned short               port = 0;
+
+    bench::Result   result;
+    const sf::Clock clock;
+    for (std::size_t i = 0; clock.getElapsedTime() < bench::duration; i = (i + 1) % socketCount)
+    {
+        const sf::Clock wake;
+        if ((sender.send(&byte, 1, sf::IpAddress::LocalHost, sockets[i]->getLocalPort()) != sf::Socket::Status::Done) ||
+            !selector.wait(sf::seconds(1)))
+            return {};
+
+        for (sf::Socket* socket : selector.getReadySockets())
+            (void)static_cast<sf::UdpSocket*>(socket)->receive(&byte, 1, received, address, port);
+
+        result.latencies.push_back(static_cast<float>(wake.getElapsedTime().asMicroseconds()));
+        ++result.operations;
+    }
+    result.elapsed = clock.getElapsedTime();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchSocketSelector(Runner& runner)
+{
+    for (const std::size_t count : {std::size_t{10}, std::size_t{100}, std::size_t{1000}, std::size_t{10000}})
+    {
+        runner.run("SocketSelector wake 1 of " + std::to_string(count), [count] { return wakeUp(count); });
+    }
+}
+} // namespace bench
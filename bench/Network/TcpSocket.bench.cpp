@@ -0,0 +1,132 @@
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <BenchUtil.hpp>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+// A connected pair of sockets
+struct Connection
+{
+    sf::TcpSocket client;
+    sf::TcpSocket server;
+};
+
+std::optional<Connection> connect()
+{
+    sf::TcpListener listener;
+    if (listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+        return std::nullopt;
+
+    Connection connection;
+    if ((connection.client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) != sf::Socket::Status::Done) ||
+        (listener.accept(connection.server) != sf::Socket::Status::Done))
+        return std::nullopt;
+
+    return connection;
+}
+
+// One-way stream of packets, received by another thread
+bench::Result throughput(std::size_t packetSize)
+{
+    std::optional<Connection> connection = connect();
+    if (!connection)
+        return {};
+
+    std::thread receiver(
+        [&]
+        {
+            sf::Packet packet;
+            while (connection->server.receive(packet) == sf::Socket::Status::Done)
+            {
+                if (packet.getDataSize() == 0)
+                    break;
+            }
+        });
+
+    const std::vector<std::byte> data(packetSize, std::byte{0x5A});
+    sf::Packet                   packet;
+    packet.append(data.data(), data.size());
+
+    bench::Result   result;
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        if (connection->client.send(packet) != sf::Socket::Status::Done)
+            break;
+
+        ++result.operations;
+        result.bytes += packetSize;
+    }
+
+    // An empty packet tells the receiver to stop, once it has received everything
+    sf::Packet end;
+    (void)connection->client.send(end);
+    receiver.join();
+    result.elapsed = clock.getElapsedTime();
+    return result;
+}
+
+// Round trips of a small packet
+bench::Result latency()
+{
+    std::optional<Connection> connection = connect();
+    if (!connection)
+        return {};
+
+    std::thread echo(
+        [&]
+        {
+            sf::Packet packet;
+            while ((connection->server.receive(packet) == sf::Socket::Status::Done) && (packet.getDataSize() > 0))
+            {
+                if (connection->server.send(packet) != sf::Socket::Status::Done)
+                    break;
+            }
+        });
+
+    sf::Packet ping;
+    ping << std::string(32, 'p');
+    sf::Packet pong;
+
+    bench::Result   result;
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        const sf::Clock roundTrip;
+        if ((connection->client.send(ping) != sf::Socket::Status::Done) ||
+            (connection->client.receive(pong) != sf::Socket::Status::Done))
+            break;
+
+        result.latencies.push_back(static_cast<float>(roundTrip.getElapsedTime().asMicroseconds()));
+        ++result.operations;
+    }
+    result.elapsed = clock.getElapsedTime();
+
+    sf::Packet end;
+    (void)connection->client.send(end);
+    echo.join();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchTcpSocket(Runner& runner)
+{
+    for (const std::size_t size : {std::size_t{64}, std::size_t{1024}, std::size_t{64 * 1024}})
+        runner.run("TcpSocket packet stream " + std::to_string(size) + " B", [size] { return throughput(size); });
+
+    runner.run("TcpSocket packet round trip", latency);
+}
+} // namespace bench
@@ -0,0 +1,178 @@
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <BenchUtil.hpp>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t datagramSize = 64;
+constexpr std::size_t batchSize    = 32;
+
+// Receive and discard datagrams until told to stop
+class Drain
+{
+public:
+    explicit Drain(sf::UdpSocket& socket) :
+    m_thread(
+        [this, &socket]
+        {
+            std::array<char, sf::UdpSocket::MaxDatagramSize> buffer{};
+            std::size_t                                       received = 0;
+            std::optional<sf::IpAddress>                      sender;
+            unsigned short                                    port = 0;
+            while (!m_stop)
+            {
+                if (socket.receive(buffer.data(), buffer.size(), received, sender, port) == sf::Socket::Status::Done)
+                    ++m_received;
+                else
+                    std::this_thread::yield();
+            }
+        })
+    {
+    }
+
+    std::size_t stop()
+    {
+        m_stop = true;
+        m_thread.join();
+        return m_received;
+    }
+
+private:
+    std::atomic<bool> m_stop{false};
+    std::size_t       m_received{};
+    std::thread       m_thread;
+};
+
+bool bindPair(sf::UdpSocket& sender, sf::UdpSocket& receiver)
+{
+    receiver.setBlocking(false);
+    return (sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done) &&
+           (receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+}
+
+// One datagram per call
+bench::Result send()
+{
+    sf::UdpSocket sender;
+    sf::UdpSocket receiver;
+    if (!bindPair(sender, receiver))
+        return {};
+
+    Drain                          drain(receiver);
+    std::array<char, datagramSize> data{};
+    bench::Result                  result;
+    const sf::Clock                clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        if (sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, receiver.getLocalPort()) ==
+            sf::Socket::Status::Done)
+        {
+            ++result.operations;
+            result.bytes += data.size();
+        }
+    }
+    result.elapsed = clock.getElapsedTime();
+    drain.stop();
+    return result;
+}
+
+// Several datagrams per call
+bench::Result sendBatch()
+{
+    sf::UdpSocket sender;
+    sf::UdpSocket receiver;
+    if (!bindPair(sender, receiver))
+        return {};
+
+    Drain                                drain(receiver);
+    std::array<char, datagramSize>       data{};
+    std::vector<sf::UdpSocket::Datagram> datagrams(batchSize);
+    for (sf::UdpSocket::Datagram& datagram : datagrams)
+    {
+        datagram.data          = data.data();
+        datagram.size          = data.size();
+        datagram.remoteAddress = sf::IpAddress::LocalHost;
+        datagram.remotePort    = receiver.getLocalPort();
+    }
+
+    bench::Result   result;
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        std::size_t sent = 0;
+        (void)sender.sendBatch(datagrams.data(), datagrams.size(), sent);
+        result.operations += sent;
+        result.bytes += sent * data.size();
+    }
+    result.elapsed = clock.getElapsedTime();
+    drain.stop();
+    return result;
+}
+
+// Round trips of a single datagram
+bench::Result latency()
+{
+    sf::UdpSocket client;
+    sf::UdpSocket server;
+    if ((client.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done) ||
+        (server.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done))
+        return {};
+
+    std::thread echo(
+        [&]
+        {
+            std::array<char, datagramSize> buffer{};
+            std::size_t                    received = 0;
+            std::optional<sf::IpAddress>   sender;
+            unsigned short                 port = 0;
+            while ((server.receive(buffer.data(), buffer.size(), received, sender, port) == sf::Socket::Status::Done) &&
+                   (received > 1))
+                (void)server.send(buffer.data(), received, *sender, port);
+        });
+
+    std::array<char, datagramSize> data{};
+    std::size_t                    received = 0;
+    std::optional<sf::IpAddress>   sender;
+    unsigned short                 port = 0;
+
+    bench::Result   result;
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < bench::duration)
+    {
+        const sf::Clock roundTrip;
+        if ((client.send(data.data(), data.size(), sf::IpAddress::LocalHost, server.getLocalPort()) !=
+             sf::Socket::Status::Done) ||
+            (client.receive(data.data(), data.size(), received, sender, port) != sf::Socket::Status::Done))
+            break;
+
+        result.latencies.push_back(static_cast<float>(roundTrip.getElapsedTime().asMicroseconds()));
+        ++result.operations;
+    }
+    result.elapsed = clock.getElapsedTime();
+
+    // A 1-byte datagram stops the echo thread
+    (void)client.send(data.data(), 1, sf::IpAddress::LocalHost, server.getLocalPort());
+    echo.join();
+    return result;
+}
+} // namespace
+
+namespace bench
+{
+void benchUdpSocket(Runner& runner)
+{
+    runner.run("UdpSocket send 64 B", send);
+    runner.run("UdpSocket sendBatch 64 B x 32", sendBatch);
+    runner.run("UdpSocket round trip", latency);
+}
+} // namespace bench
@@ -82,6 +82,11 @@ macro(sfml_add_library module)
         target_link_options(${target} PUBLIC $<$<CONFIG:DEBUG>:--coverage>)
     endif()
 
+    # compile the profiling zones
+    if(SFML_ENABLE_PROFILING)
+        target_compile_definitions(${target} PRIVATE SFML_ENABLE_PROFILING)
+    endif()
+
     set_target_warnings(${target})
     set_public_symbols_hidden(${target})
 
@@ -0,0 +1,48 @@
+#
+# Try to find Opus/Opusfile libraries and include paths.
+# FindVorbis must have been run before, it provides the Ogg::ogg target.
+# Once done this will define
+#
+# OPUS_FOUND
+# Opus::opus
+# Opus::opusfile
+#
+
+find_path(OPUS_INCLUDE_DIR opus.h PATH_SUFFIXES opus)
+find_path(OPUSFILE_INCLUDE_DIR opusfile.h PATH_SUFFIXES opus)
+
+find_library(OPUS_LIBRARY NAMES opus)
+find_library(OPUSFILE_LIBRARY NAMES opusfile)
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(Opus DEFAULT_MSG
+    OPUS_INCLUDE_DIR
+    OPUS_LIBRARY
+    OPUSFILE_INCLUDE_DIR
+    OPUSFILE_LIBRARY)
+mark_as_advanced(
+    OPUS_INCLUDE_DIR
+    OPUS_LIBRARY
+    OPUSFILE_INCLUDE_DIR
+    OPUSFILE_LIBRARY)
+
+if(OPUS_FOUND)
+    add_library(Opus::opus IMPORTED UNKNOWN)
+    set_target_properties(Opus::opus PROPERTIES INTERFACE_INCLUDE_DIRECTORIES ${OPUS_INCLUDE_DIR})
+    if(OPUS_LIBRARY MATCHES "/([^/]+)\\.framework$")
+        set_target_properties(Opus::opus PROPERTIES IMPORTED_LOCATION ${OPUS_LIBRARY}/${CMAKE_MATCH_1})
+    else()
+        set_target_properties(Opus::opus PROPERTIES IMPORTED_LOCATION ${OPUS_LIBRARY})
+    endif()
+
+    add_library(Opus::opusfile IMPORTED UNKNOWN)
+    set_target_properties(Opus::opusfile PROPERTIES
+        INTERFACE_INCLUDE_DIRECTORIES ${OPUSFILE_INCLUDE_DIR}
+        INTERFACE_LINK_LIBRARIES "Opus::opus;Ogg::ogg")
+    if(OPUSFILE_LIBRARY MATCHES "/([^/]+)\\.framework$")
+        set_target_properties(Opus::opusfile PROPERTIES IMPORTED_LOCATION ${OPUSFILE_LIBRARY}/${CMAKE_MATCH_1})
+    else()
+        set_target_properties(Opus::opusfile PROPERTIES IMPORTED_LOCATION ${OPUSFILE_LIBRARY})
+    endif()
+endif()
@@ -0,0 +1,50 @@
+#
+# Try to find the Wayland client libraries, include path and protocol tools.
+# Once done this will define
+#
+# WAYLAND_FOUND
+# WAYLAND_INCLUDE_DIR
+# WAYLAND_CLIENT_LIBRARY
+# WAYLAND_EGL_LIBRARY
+# WAYLAND_CURSOR_LIBRARY
+# WAYLAND_SCANNER (only needed to build SFML)
+# WAYLAND_PROTOCOLS_DIR (only needed to build SFML)
+#
+
+find_package(PkgConfig QUIET)
+if(PKG_CONFIG_FOUND)
+    pkg_check_modules(PC_WAYLAND wayland-client QUIET)
+    pkg_get_variable(PC_WAYLAND_SCANNER wayland-scanner wayland_scanner)
+    pkg_get_variable(PC_WAYLAND_PROTOCOLS_DIR wayland-protocols pkgdatadir)
+endif()
+
+find_path(WAYLAND_INCLUDE_DIR NAMES wayland-client.h HINTS ${PC_WAYLAND_INCLUDE_DIRS})
+find_library(WAYLAND_CLIENT_LIBRARY NAMES wayland-client HINTS ${PC_WAYLAND_LIBRARY_DIRS})
+find_library(WAYLAND_EGL_LIBRARY NAMES wayland-egl HINTS ${PC_WAYLAND_LIBRARY_DIRS})
+find_library(WAYLAND_CURSOR_LIBRARY NAMES wayland-cursor HINTS ${PC_WAYLAND_LIBRARY_DIRS})
+find_program(WAYLAND_SCANNER NAMES wayland-scanner HINTS ${PC_WAYLAND_SCANNER})
+find_path(WAYLAND_PROTOCOLS_DIR NAMES stable/xdg-shell/xdg-shell.xml
+          HINTS ${PC_WAYLAND_PROTOCOLS_DIR}
+          PATHS /usr/share/wayland-protocols /usr/local/share/wayland-protocols)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Wayland DEFAULT_MSG WAYLAND_CLIENT_LIBRARY WAYLAND_EGL_LIBRARY WAYLAND_CURSOR_LIBRARY
+                                  WAYLAND_INCLUDE_DIR)
+
+mark_as_advanced(WAYLAND_INCLUDE_DIR WAYLAND_CLIENT_LIBRARY WAYLAND_EGL_LIBRARY WAYLAND_CURSOR_LIBRARY WAYLAND_SCANNER
+                 WAYLAND_PROTOCOLS_DIR)
+
+add_library(Wayland::Client IMPORTED UNKNOWN)
+set_target_properties(Wayland::Client PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES ${WAYLAND_INCLUDE_DIR}
+    IMPORTED_LOCATION ${WAYLAND_CLIENT_LIBRARY})
+
+add_library(Wayland::EGL IMPORTED UNKNOWN)
+set_target_properties(Wayland::EGL PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES ${WAYLAND_INCLUDE_DIR}
+    IMPORTED_LOCATION ${WAYLAND_EGL_LIBRARY})
+
+add_library(Wayland::Cursor IMPORTED UNKNOWN)
+set_target_properties(Wayland::Cursor PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES ${WAYLAND_INCLUDE_DIR}
+    IMPORTED_LOCATION ${WAYLAND_CURSOR_LIBRARY})
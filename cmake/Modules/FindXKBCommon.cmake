@@ -0,0 +1,23 @@
+#
+# Try to find xkbcommon library and include path.
+# Once done this will define
+#
+# XKBCOMMON_FOUND
+# XKBCOMMON_INCLUDE_DIR
+# XKBCOMMON_LIBRARY
+#
+
+if(PKG_CONFIG_FOUND)
+    pkg_check_modules(PC_XKBCOMMON xkbcommon QUIET)
+endif()
+
+find_path(XKBCOMMON_INCLUDE_DIR NAMES xkbcommon/xkbcommon.h HINTS ${PC_XKBCOMMON_INCLUDE_DIRS})
+find_library(XKBCOMMON_LIBRARY NAMES xkbcommon HINTS ${PC_XKBCOMMON_LIBRARY_DIRS})
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(XKBCommon DEFAULT_MSG XKBCOMMON_LIBRARY XKBCOMMON_INCLUDE_DIR)
+
+add_library(XKBCommon::XKBCommon IMPORTED UNKNOWN)
+set_target_properties(XKBCommon::XKBCommon PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES ${XKBCOMMON_INCLUDE_DIR}
+    IMPORTED_LOCATION ${XKBCOMMON_LIBRARY})
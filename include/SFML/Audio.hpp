@@ -28,17 +28,25 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include <SFML/Audio/AudioBus.hpp>
+#include <SFML/Audio/AudioGenerator.hpp>
+#include <SFML/Audio/CompressedSoundBuffer.hpp>
+#include <SFML/Audio/EffectChain.hpp>
 #include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/Listener.hpp>
 #include <SFML/Audio/Music.hpp>
+#include <SFML/Audio/OpusDecoder.hpp>
+#include <SFML/Audio/OpusEncoder.hpp>
 #include <SFML/Audio/OutputSoundFile.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/RingBufferRecorder.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Audio/SoundBufferRecorder.hpp>
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include <SFML/Audio/SoundFileReader.hpp>
 #include <SFML/Audio/SoundFileWriter.hpp>
+#include <SFML/Audio/SoundPool.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 #include <SFML/Audio/SoundStream.hpp>
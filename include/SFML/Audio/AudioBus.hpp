@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioResource.hpp>
+#include <SFML/Audio/SoundSource.hpp>
+
+#include <memory>
+
+
+namespace sf
+{
+namespace priv::MiniaudioUtils
+{
+struct SoundBase;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Submix bus grouping sound sources
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioBus : protected AudioResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The bus outputs to the audio device until a parent
+    /// bus is set.
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The sound sources and buses that output to this bus
+    /// are rerouted to the audio device.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AudioBus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBus(const AudioBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBus& operator=(const AudioBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the volume of the bus
+    ///
+    /// The volume is combined with the volume of every sound
+    /// source and bus that outputs to this bus.
+    /// The default value for the volume is 100 (maximum).
+    ///
+    /// \param volume Volume of the bus, in the range [0, 100]
+    ///
+    /// \see getVolume
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVolume(float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the volume of the bus
+    ///
+    /// \return Volume of the bus, in the range [0, 100]
+    ///
+    /// \see setVolume
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getVolume() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the bus this bus outputs to
+    ///
+    /// Buses can be nested to build a mixer graph, as long
+    /// as a bus doesn't end up being its own parent. The
+    /// parent can be changed while sounds are playing.
+    ///
+    /// \param parent Bus to output to, or nullptr to output to the audio device
+    ///
+    /// \see getParent
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParent(AudioBus* parent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus this bus outputs to
+    ///
+    /// \return Parent bus, or nullptr if the bus outputs to the audio device
+    ///
+    /// \see setParent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus* getParent() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the effect processor to be applied to the bus
+    ///
+    /// The effect processor runs once on the mix of all the
+    /// sound sources and buses that output to this bus. It
+    /// follows the same rules as the effect processor of
+    /// sf::SoundSource.
+    ///
+    /// \param effectProcessor The effect processor to attach to this bus, attach an empty processor to disable processing
+    ///
+    /// \see SoundSource::EffectProcessor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEffectProcessor(SoundSource::EffectProcessor effectProcessor);
+
+private:
+    friend struct priv::MiniaudioUtils::SoundBase;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sound to the list of sounds that output to this bus
+    ///
+    /// \param sound Sound instance to attach
+    ///
+    ////////////////////////////////////////////////////////////
+    void attachSound(priv::MiniaudioUtils::SoundBase* sound);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a sound from the list of sounds that output to this bus
+    ///
+    /// \param sound Sound instance to detach
+    ///
+    ////////////////////////////////////////////////////////////
+    void detachSound(priv::MiniaudioUtils::SoundBase* sound);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the node that sounds of this bus connect to
+    ///
+    /// \return The input node (a ma_node*)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* getInputNode() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioBus
+/// \ingroup audio
+///
+/// sf::AudioBus mixes the sound sources that output to it
+/// before sending the result to a parent bus or to the audio
+/// device. It lets a volume or an effect processor apply to a
+/// whole group of sounds at the cost of a single processing
+/// pass, instead of one per sound.
+///
+/// A typical mixer graph separates music, sound effects,
+/// voices and user interface sounds, each with its own
+/// volume and effects:
+/// \code
+/// sf::AudioBus sfx;
+/// sf::AudioBus ui;
+///
+/// sf::EffectChain reverb(2, 48000);
+/// reverb.addReverbSend(0.4f);
+/// sfx.setEffectProcessor(reverb.getProcessor());
+///
+/// sf::Sound explosion(explosionBuffer);
+/// explosion.setBus(&sfx);
+/// explosion.play();
+///
+/// // Later, in the options menu
+/// sfx.setVolume(50.f);
+/// \endcode
+///
+/// Sound sources and buses can be moved to another bus at any
+/// time, even while they are playing.
+///
+/// \see sf::SoundSource, sf::EffectChain
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundChannel.hpp>
+#include <SFML/Audio/SoundSource.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Abstract base class for audio sources rendered on the fly
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioGenerator : public SoundSource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AudioGenerator() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start or resume playing the generator
+    ///
+    /// This function starts the generator if it was stopped,
+    /// resumes it if it was paused, and has no effect if it
+    /// is already playing.
+    ///
+    /// \see pause, stop
+    ///
+    ////////////////////////////////////////////////////////////
+    void play() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pause the generator
+    ///
+    /// This function pauses the generator if it was playing,
+    /// otherwise (generator already paused or stopped) it has no effect.
+    ///
+    /// \see play, stop
+    ///
+    ////////////////////////////////////////////////////////////
+    void pause() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop playing the generator
+    ///
+    /// This function stops the generator if it was playing or
+    /// paused, and does nothing if it was already stopped.
+    /// It also resets the playing position (unlike pause()).
+    ///
+    /// \see play, pause
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of channels of the generator
+    ///
+    /// 1 channel means a mono sound, 2 means stereo, etc.
+    ///
+    /// \return Number of channels
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the generator
+    ///
+    /// \return Sample rate, in number of samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the map of position in sample frame to sound channel
+    ///
+    /// \return Map of position in sample frame to sound channel
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<SoundChannel> getChannelMap() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current status of the generator (stopped, paused, playing)
+    ///
+    /// \return Current status
+    ///
+    ////////////////////////////////////////////////////////////
+    Status getStatus() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current playing position of the generator
+    ///
+    /// \return Time elapsed since the generator was last started from the beginning
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getPlayingOffset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the arena available to onGenerate
+    ///
+    /// The arena is allocated once, here, so that onGenerate can
+    /// get scratch memory from allocate without ever calling the
+    /// system allocator on the audio thread. The default size
+    /// is 0, i.e. no arena.
+    ///
+    /// The size can only be changed while the generator is stopped.
+    ///
+    /// \param size Size of the arena, in bytes
+    ///
+    /// \see getArenaSize, allocate
+    ///
+    ////////////////////////////////////////////////////////////
+    void setArenaSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the arena available to onGenerate
+    ///
+    /// \return Size of the arena, in bytes
+    ///
+    /// \see setArenaSize
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getArenaSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of real-time violations detected in onGenerate
+    ///
+    /// A violation is recorded when allocate runs out of arena
+    /// memory and, in debug builds, when onGenerate calls a
+    /// function of the generator that allocates memory or locks
+    /// a mutex, such as play, stop or initialize. Debug builds
+    /// also print a message to sf::err() for the latter.
+    ///
+    /// \return Number of violations since the generator was created
+    ///
+    /// \see isRealTimeContext
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getRealTimeViolationCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the calling thread is running onGenerate
+    ///
+    /// This can be used by custom allocators, locks or asserts
+    /// to catch code that isn't real-time safe being called
+    /// from a generator.
+    ///
+    /// \return True if called from within onGenerate
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isRealTimeContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the effect processor to be applied to the generator
+    ///
+    /// \param effectProcessor The effect processor to attach to this generator, attach an empty processor to disable processing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEffectProcessor(EffectProcessor effectProcessor) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the bus the generator outputs to
+    ///
+    /// \param bus Bus to output to, or nullptr to output to the audio device
+    ///
+    /// \see getBus
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBus(AudioBus* bus) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the generator outputs to
+    ///
+    /// \return Bus the generator outputs to, or nullptr if it outputs to the audio device
+    ///
+    /// \see setBus
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus* getBus() const override;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// This constructor is only meant to be called by derived classes.
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioGenerator();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Define the parameters of the generated audio
+    ///
+    /// This function must be called by derived classes before
+    /// the generator is played. It can be called again to
+    /// change the settings, but only when the generator is stopped.
+    ///
+    /// \param channelCount Number of channels of the generated audio
+    /// \param sampleRate   Sample rate, in samples per second
+    /// \param channelMap   Map of position in sample frame to sound channel
+    ///
+    ////////////////////////////////////////////////////////////
+    void initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get scratch memory from the arena
+    ///
+    /// This function may only be called from onGenerate. The
+    /// memory is valid until onGenerate returns; the whole arena
+    /// is made available again before the next call.
+    ///
+    /// \param size      Number of bytes to allocate
+    /// \param alignment Alignment of the memory, must be a power of 2
+    ///
+    /// \return Pointer to the memory, or nullptr if the arena is exhausted
+    ///
+    /// \see setArenaSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the next frames of audio
+    ///
+    /// This function must be overridden by derived classes. It
+    /// is called from the audio device thread, and writes the
+    /// samples straight into the buffer that is mixed by the
+    /// audio device: \a frames holds \a frameCount frames of
+    /// interleaved 32-bit float samples, getChannelCount()
+    /// samples per frame, which must all be written.
+    ///
+    /// Since it runs on the audio thread, this function must
+    /// not block: it should neither allocate memory (use
+    /// allocate instead) nor lock mutexes, nor call functions
+    /// that do, such as play or stop.
+    ///
+    /// \param frames     Buffer to write the samples to
+    /// \param frameCount Number of frames to write
+    ///
+    /// \return True to continue playback, false to stop after these frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool onGenerate(float* frames, std::size_t frameCount) = 0;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sound object
+    ///
+    /// \return The sound object
+    ///
+    ////////////////////////////////////////////////////////////
+    void* getSound() const override;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioGenerator
+/// \ingroup audio
+///
+/// sf::AudioGenerator is the base class for sounds that are
+/// computed while they play, such as synthesizers or engine
+/// sounds. Unlike sf::SoundStream, which asks its source for
+/// chunks of samples and copies them, a generator renders its
+/// samples directly into the buffer of the audio device.
+///
+/// A derived class has to call initialize once it knows the
+/// format of the audio it generates, and override onGenerate,
+/// which is called from the audio device thread whenever more
+/// frames are needed. The samples are always 32-bit floats,
+/// interleaved.
+///
+/// onGenerate must be real-time safe: anything that may block,
+/// like allocating memory or locking a mutex, can make the
+/// audio device miss its deadline and glitch. Scratch memory
+/// can instead be taken from an arena, reserved up front with
+/// setArenaSize and handed out by allocate. Debug builds of
+/// SFML report the generator functions that aren't real-time
+/// safe when they are called from onGenerate, and
+/// isRealTimeContext lets custom code perform the same check.
+///
+/// Usage example:
+/// \code
+/// class SineWave : public sf::AudioGenerator
+/// {
+/// public:
+///     SineWave()
+///     {
+///         initialize(1, 44100, {sf::SoundChannel::Mono});
+///     }
+///
+/// private:
+///     bool onGenerate(float* frames, std::size_t frameCount) override
+///     {
+///         for (std::size_t i = 0; i < frameCount; ++i)
+///         {
+///             frames[i] = std::sin(m_phase);
+///             m_phase += 2.f * 3.14159265f * 440.f / 44100.f;
+///         }
+///
+///         return true;
+///     }
+///
+///     float m_phase{};
+/// };
+///
+/// SineWave sine;
+/// sine.play();
+/// \endcode
+///
+/// \see sf::SoundStream
+///
+////////////////////////////////////////////////////////////
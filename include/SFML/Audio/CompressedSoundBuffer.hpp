@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundChannel.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Sound;
+class InputSoundFile;
+class InputStream;
+
+////////////////////////////////////////////////////////////
+/// \brief Storage for an encoded sound, decoded while it is played
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API CompressedSoundBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy Instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    CompressedSoundBuffer(const CompressedSoundBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CompressedSoundBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the compressed sound buffer from a file
+    ///
+    /// The contents of the file are copied in memory as they
+    /// are, and checked by opening them with sf::InputSoundFile.
+    /// See its documentation for the list of supported formats.
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadFromMemory, loadFromStream
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<CompressedSoundBuffer> loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the compressed sound buffer from a file in memory
+    ///
+    /// The data is copied, so it doesn't have to remain alive
+    /// after the function returns.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to load, in bytes
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadFromFile, loadFromStream
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<CompressedSoundBuffer> loadFromMemory(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the compressed sound buffer from a custom stream
+    ///
+    /// The whole stream is read and copied in memory.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadFromFile, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<CompressedSoundBuffer> loadFromStream(InputStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the encoded contents of the sound file
+    ///
+    /// \return Read-only pointer to the encoded data
+    ///
+    /// \see getDataSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the encoded contents of the sound file
+    ///
+    /// This is the amount of memory used by the buffer to store
+    /// the sound.
+    ///
+    /// \return Size of the encoded data, in bytes
+    ///
+    /// \see getData
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples of the decoded sound
+    ///
+    /// \return Number of samples
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the sound
+    ///
+    /// \return Sample rate (number of samples per second)
+    ///
+    /// \see getChannelCount, getChannelMap, getDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels used by the sound
+    ///
+    /// \return Number of channels
+    ///
+    /// \see getSampleRate, getChannelMap, getDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the map of position in sample frame to sound channel
+    ///
+    /// \return Map of position in sample frame to sound channel
+    ///
+    /// \see getSampleRate, getChannelCount, getDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<SoundChannel> getChannelMap() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total duration of the sound
+    ///
+    /// \return Sound duration
+    ///
+    /// \see getSampleRate, getChannelCount, getChannelMap
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getDuration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    CompressedSoundBuffer& operator=(const CompressedSoundBuffer& right);
+
+private:
+    friend class Sound;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from encoded data
+    ///
+    /// \param data Encoded contents of the sound file
+    /// \param file Sound file opened from the data, providing the properties of the sound
+    ///
+    ////////////////////////////////////////////////////////////
+    CompressedSoundBuffer(std::vector<std::byte>&& data, const InputSoundFile& file);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check and wrap encoded data
+    ///
+    /// \param data Encoded contents of the sound file
+    ///
+    /// \return Sound buffer if the data could be opened, `std::nullopt` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<CompressedSoundBuffer> initialize(std::vector<std::byte>&& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sound to the list of sounds that use this buffer
+    ///
+    /// \param sound Sound instance to attach
+    ///
+    ////////////////////////////////////////////////////////////
+    void attachSound(Sound* sound) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a sound from the list of sounds that use this buffer
+    ///
+    /// \param sound Sound instance to detach
+    ///
+    ////////////////////////////////////////////////////////////
+    void detachSound(Sound* sound) const;
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using SoundList = std::vector<Sound*>; //!< Unique sound instances
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::byte>    m_data;                           //!< Encoded contents of the sound file
+    std::uint64_t             m_sampleCount{};                  //!< Number of samples of the decoded sound
+    unsigned int              m_sampleRate{44100};              //!< Number of samples per second
+    std::vector<SoundChannel> m_channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
+    Time                      m_duration;                       //!< Sound duration
+    mutable SoundList         m_sounds;                         //!< List of sounds that are using this buffer
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CompressedSoundBuffer
+/// \ingroup audio
+///
+/// sf::CompressedSoundBuffer sits between sf::SoundBuffer and
+/// sf::Music. Like a sound buffer, it holds a whole sound in
+/// memory and can be played by any number of sf::Sound instances
+/// at once; but like a music, it keeps the file in its encoded
+/// form (Ogg, FLAC, MP3, ...) and decodes it while it plays.
+///
+/// An Ogg file typically takes a tenth of the memory needed by
+/// its decoded 16-bit samples, which makes compressed buffers a
+/// good fit for large banks of long sound effects or voice lines
+/// on platforms with a tight memory budget. The price is the CPU
+/// time spent decoding: each playing sound owns a decoder and a
+/// small cache of decoded samples, refilled from the encoded data
+/// as the sound plays. Short sounds that are played very often
+/// are better stored in a regular sf::SoundBuffer.
+///
+/// The samples are always decoded as 16 bits signed integers.
+///
+/// As with sf::SoundBuffer, the sf::Sound instances only keep a
+/// reference to the buffer, which must remain alive as long as
+/// it is used.
+///
+/// Usage example:
+/// \code
+/// // Load the encoded file in memory
+/// const auto buffer = sf::CompressedSoundBuffer::loadFromFile("voice.ogg").value();
+///
+/// // Create a sound source bound to the buffer and play it
+/// sf::Sound sound(buffer);
+/// sound.play();
+/// \endcode
+///
+/// \see sf::Sound, sf::SoundBuffer, sf::Music
+///
+////////////////////////////////////////////////////////////
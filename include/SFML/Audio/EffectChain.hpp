@@ -0,0 +1,337 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundSource.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Chain of built-in audio effects usable as an effect processor
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API EffectChain
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of biquad filters
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class FilterType
+    {
+        LowPass,  //!< Attenuates the frequencies above the cutoff frequency
+        HighPass, //!< Attenuates the frequencies below the cutoff frequency
+        BandPass, //!< Attenuates the frequencies away from the center frequency
+        Notch,    //!< Attenuates the frequencies close to the center frequency
+        Peak,     //!< Boosts or cuts the frequencies close to the center frequency
+        LowShelf, //!< Boosts or cuts the frequencies below the cutoff frequency
+        HighShelf //!< Boosts or cuts the frequencies above the cutoff frequency
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty chain
+    ///
+    /// All the memory used by the effects is allocated when
+    /// they are added, based on these parameters. Channels
+    /// beyond \a channelCount are passed through unprocessed.
+    ///
+    /// \param channelCount Number of channels of the sound the chain is attached to
+    /// \param sampleRate   Sample rate of the sound the chain is attached to
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectChain(unsigned int channelCount, unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~EffectChain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectChain(const EffectChain&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectChain& operator=(const EffectChain&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectChain(EffectChain&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    EffectChain& operator=(EffectChain&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a biquad filter to the chain
+    ///
+    /// \param type      Type of the filter
+    /// \param frequency Cutoff or center frequency, in Hz
+    /// \param q         Quality factor, 0.7071 gives a flat response for low and high-pass filters
+    /// \param gain      Gain of peak and shelf filters, in dB
+    ///
+    /// \return Index of the new node
+    ///
+    /// \see setFilter
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addFilter(FilterType type, float frequency, float q = 0.7071f, float gain = 0.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a reverb send to the chain
+    ///
+    /// The reverberated signal is mixed with the dry signal.
+    ///
+    /// \param send     Level of the reverberated signal, in the range [0, 1]
+    /// \param roomSize Size of the simulated room, in the range [0, 1]
+    /// \param damping  Absorption of the high frequencies, in the range [0, 1]
+    ///
+    /// \return Index of the new node
+    ///
+    /// \see setReverbSend
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addReverbSend(float send = 0.3f, float roomSize = 0.5f, float damping = 0.5f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a compressor to the chain
+    ///
+    /// The level is measured on all channels at once, so the
+    /// stereo image is preserved.
+    ///
+    /// \param threshold Level above which the signal is compressed, in dB
+    /// \param ratio     Compression ratio, 4 means that 4 dB above the threshold give 1 dB
+    /// \param attack    Time taken to reach the target gain reduction
+    /// \param release   Time taken to recover from the gain reduction
+    ///
+    /// \return Index of the new node
+    ///
+    /// \see setCompressor
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addCompressor(float threshold = -20.f,
+                              float ratio     = 4.f,
+                              Time  attack    = milliseconds(5),
+                              Time  release   = milliseconds(100));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a limiter to the chain
+    ///
+    /// Peaks above the ceiling are reduced instantly, the gain
+    /// then recovers smoothly.
+    ///
+    /// \param ceiling Maximum output level, in dB
+    /// \param release Time taken to recover from the gain reduction
+    ///
+    /// \return Index of the new node
+    ///
+    /// \see setLimiter
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addLimiter(float ceiling = -1.f, Time release = milliseconds(50));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the parameters of a filter
+    ///
+    /// This function is lock-free and can be called while
+    /// the chain is processing audio.
+    ///
+    /// \param node      Index of the filter node
+    /// \param frequency Cutoff or center frequency, in Hz
+    /// \param q         Quality factor
+    /// \param gain      Gain of peak and shelf filters, in dB
+    ///
+    /// \see addFilter
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFilter(std::size_t node, float frequency, float q = 0.7071f, float gain = 0.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the parameters of a reverb send
+    ///
+    /// This function is lock-free and can be called while
+    /// the chain is processing audio.
+    ///
+    /// \param node     Index of the reverb node
+    /// \param send     Level of the reverberated signal, in the range [0, 1]
+    /// \param roomSize Size of the simulated room, in the range [0, 1]
+    /// \param damping  Absorption of the high frequencies, in the range [0, 1]
+    ///
+    /// \see addReverbSend
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReverbSend(std::size_t node, float send, float roomSize = 0.5f, float damping = 0.5f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the parameters of a compressor
+    ///
+    /// This function is lock-free and can be called while
+    /// the chain is processing audio.
+    ///
+    /// \param node      Index of the compressor node
+    /// \param threshold Level above which the signal is compressed, in dB
+    /// \param ratio     Compression ratio
+    /// \param attack    Time taken to reach the target gain reduction
+    /// \param release   Time taken to recover from the gain reduction
+    ///
+    /// \see addCompressor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCompressor(std::size_t node, float threshold, float ratio, Time attack, Time release);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the parameters of a limiter
+    ///
+    /// This function is lock-free and can be called while
+    /// the chain is processing audio.
+    ///
+    /// \param node    Index of the limiter node
+    /// \param ceiling Maximum output level, in dB
+    /// \param release Time taken to recover from the gain reduction
+    ///
+    /// \see addLimiter
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLimiter(std::size_t node, float ceiling, Time release);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable a node
+    ///
+    /// A bypassed node lets the signal through unchanged.
+    /// This function is lock-free and can be called while
+    /// the chain is processing audio.
+    ///
+    /// \param node     Index of the node
+    /// \param bypassed True to bypass the node, false to process the signal
+    ///
+    /// \see isBypassed
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBypassed(std::size_t node, bool bypassed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a node is bypassed
+    ///
+    /// \param node Index of the node
+    ///
+    /// \return True if the node is bypassed
+    ///
+    /// \see setBypassed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBypassed(std::size_t node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of nodes of the chain
+    ///
+    /// \return Number of nodes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getNodeCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an effect processor running the chain
+    ///
+    /// The processor shares the state of the chain, it stays
+    /// usable even if the chain is destroyed first. Nodes
+    /// can't be added once a processor was created, since the
+    /// audio thread may already be running it.
+    ///
+    /// A chain keeps the state of its filters between calls,
+    /// so give its processor to a single sound source.
+    ///
+    /// \return Effect processor to pass to SoundSource::setEffectProcessor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundSource::EffectProcessor getProcessor() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::shared_ptr<Impl> m_impl; //!< Implementation details, shared with the processors
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::EffectChain
+/// \ingroup audio
+///
+/// sf::EffectChain is a ready-made effect processor for
+/// sound sources. It runs a sequence of built-in nodes:
+/// \li biquad filters (low-pass, high-pass, band-pass, notch, peak and shelves)
+/// \li reverb sends
+/// \li compressors and limiters
+///
+/// The nodes are processed in the order they were added.
+/// They never allocate memory nor lock a mutex on the audio
+/// thread, and process all the channels of a frame at once
+/// with SIMD instructions when available.
+///
+/// Their parameters are changed through atomic variables,
+/// so the setters can be called from any thread at any time
+/// without disturbing the audio thread.
+///
+/// Usage example:
+/// \code
+/// sf::Music music("music.ogg");
+///
+/// sf::EffectChain chain(music.getChannelCount(), music.getSampleRate());
+/// const std::size_t filter = chain.addFilter(sf::EffectChain::FilterType::LowPass, 20000.f);
+/// chain.addLimiter();
+/// music.setEffectProcessor(chain.getProcessor());
+/// music.play();
+///
+/// // Later, muffle the music while the game is paused
+/// chain.setFilter(filter, 500.f);
+/// \endcode
+///
+/// \see sf::SoundSource
+///
+////////////////////////////////////////////////////////////
@@ -55,7 +55,8 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file from the disk for reading
     ///
-    /// The supported audio formats are: WAV (PCM only), OGG/Vorbis, FLAC, MP3.
+    /// The supported audio formats are: WAV (PCM only), OGG/Vorbis, FLAC, MP3,
+    /// and OGG/Opus if SFML was built with SFML_USE_OPUS.
     /// The supported sample sizes for FLAC and WAV are 8, 16, 24 and 32 bit.
     ///
     /// Because of minimp3_ex limitation, for MP3 files with big (>16kb) APEv2 tag,
@@ -205,6 +206,84 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as floating point values
+    ///
+    /// The samples are normalized to the [-1, 1] range. Formats
+    /// decoded at a higher precision than 16 bits (Vorbis, FLAC
+    /// and WAV files with more than 16 bits per sample) keep it.
+    ///
+    /// This function is not an overload of read, so that calls
+    /// passing a null pointer remain unambiguous.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read floating point samples without copying them, if the file allows it
+    ///
+    /// Files storing 32-bit floating point samples, opened from
+    /// memory or from the disk (which maps them in memory), can
+    /// be read in place: \a samples is set to point to the
+    /// samples inside the file, which remain valid as long as
+    /// this object. For any other file, \a samples is set to a
+    /// null pointer and nothing is read; use readFloat instead.
+    ///
+    /// \param samples  Pointer to set to the first sample read, or to a null pointer
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    /// \see readFloat
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readInPlace(const float*& samples, std::uint64_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file using several threads
+    ///
+    /// The samples to read are split into one segment per thread,
+    /// each segment being decoded by its own reader after seeking
+    /// to its beginning. The segments are decoded concurrently on
+    /// the global thread pool, or by the job scheduler if one is
+    /// set. This speeds up the decoding of long compressed files,
+    /// when transcoding them for example.
+    ///
+    /// Only files opened from a path or from memory can be split
+    /// this way; files opened from a stream, and reads that are
+    /// too short to be worth splitting, are read by the calling
+    /// thread as with read().
+    ///
+    /// \param samples     Pointer to the sample array to fill
+    /// \param maxCount    Maximum number of samples to read
+    /// \param threadCount Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readParallel(std::int16_t*  samples,
+                                             std::uint64_t maxCount,
+                                             unsigned int  threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples as floating point values using several threads
+    ///
+    /// \param samples     Pointer to the sample array to fill
+    /// \param maxCount    Maximum number of samples to read
+    /// \param threadCount Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    /// \see readParallel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readParallelFloat(float* samples, std::uint64_t maxCount, unsigned int threadCount = 0);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -247,6 +326,27 @@ private:
                    unsigned int                                  sampleRate,
                    std::vector<SoundChannel>&&                   channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the source of this file again, with a reader of its own
+    ///
+    /// \return Input sound file if the source could be opened again, otherwise `std::nullopt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<InputSoundFile> reopen() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples in segments decoded by several threads
+    ///
+    /// \param samples     Pointer to the sample array to fill
+    /// \param maxCount    Maximum number of samples to read
+    /// \param threadCount Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard]] std::uint64_t readSegments(T* samples, std::uint64_t maxCount, unsigned int threadCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -256,6 +356,9 @@ private:
     std::uint64_t                               m_sampleCount{};          //!< Total number of samples in the file
     unsigned int                                m_sampleRate{};           //!< Number of samples per second
     std::vector<SoundChannel>                   m_channelMap; //!< The map of position in sample frame to sound channel
+    std::filesystem::path                       m_filename;   //!< Path of the file, if opened from the disk
+    const void*                                 m_data{};     //!< Data of the file, if opened from memory
+    std::size_t                                 m_dataSize{}; //!< Size of the data of the file, in bytes
 };
 
 } // namespace sf
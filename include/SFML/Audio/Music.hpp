@@ -32,7 +32,9 @@
 #include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <mutex>
 #include <vector>
 
@@ -99,7 +101,9 @@ public:
     /// This function doesn't start playing the music (call play()
     /// to do so).
     /// See the documentation of sf::InputSoundFile for the list
-    /// of supported formats.
+    /// of supported formats. WAV files storing 32-bit floating
+    /// point samples are played straight from \a data, without
+    /// copying or decoding them.
     ///
     /// \warning Since the music is not loaded at once but rather streamed
     /// continuously, the \a data buffer must remain accessible until
@@ -184,6 +188,72 @@ public:
     ////////////////////////////////////////////////////////////
     void setLoopPoints(TimeSpan timePoints);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an audio file to play after the current music
+    ///
+    /// The file is opened, and its first second decoded, by a
+    /// worker thread as soon as this function is called. When
+    /// the current track ends, the queued one continues it
+    /// without any gap, and becomes the current music: its
+    /// duration, loop points and playing offset are the ones
+    /// reported by the music from then on. If looping is
+    /// enabled, the queued track starts instead of the next
+    /// iteration of the loop.
+    ///
+    /// The queued file must have the same sample rate, channel
+    /// count and channel map as the current music; otherwise,
+    /// or if it can't be opened, an error is printed and it is
+    /// skipped. A track queued just before the current one ends
+    /// may make the audio stream wait for it to be opened.
+    ///
+    /// Opening a new music with openFromFile, openFromMemory or
+    /// openFromStream clears the queue.
+    ///
+    /// \param filename Path of the audio file to queue
+    ///
+    /// \see queueFromMemory, clearQueue, getQueueSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void queueFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an audio file in memory to play after the current music
+    ///
+    /// See queueFromFile; the \a data buffer must remain
+    /// accessible for as long as the track is queued or played.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to queue, in bytes
+    ///
+    /// \see queueFromFile, clearQueue, getQueueSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void queueFromMemory(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the queued tracks
+    ///
+    /// The current music is not affected. This function waits
+    /// for the tracks still being opened.
+    ///
+    /// \see queueFromFile, queueFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of tracks waiting to be played
+    ///
+    /// The count decreases when a queued track becomes the
+    /// current music, which lets the caller detect track changes.
+    ///
+    /// \return Number of queued tracks
+    ///
+    /// \see queueFromFile, queueFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getQueueSize() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
@@ -218,13 +288,49 @@ protected:
     ////////////////////////////////////////////////////////////
     std::optional<std::uint64_t> onLoop() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Continue with the next queued track, if any
+    ///
+    /// \return 0 if a queued track was started, std::nullopt otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::uint64_t> onEnd() override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Track opened ahead of time by queueFromFile or queueFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    struct QueuedTrack
+    {
+        InputSoundFile     file;          //!< The opened audio file
+        std::vector<float> samples;       //!< First samples of the file, decoded ahead of time
+        std::size_t        sampleCount{}; //!< Number of valid samples in the buffer
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new music
     ///
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a track and decode its first samples, on a worker thread
+    ///
+    /// \param open Function opening the audio file
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename OpenFunction>
+    void queue(OpenFunction open);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the current file by the next usable queued track
+    ///
+    /// \return 0 if a queued track was started, std::nullopt if the queue is exhausted
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::uint64_t> startQueuedTrack();
+
     ////////////////////////////////////////////////////////////
     /// \brief Helper to convert an sf::Time to a sample position
     ///
@@ -248,10 +354,12 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::optional<InputSoundFile> m_file;     //!< The streamed music file
-    std::vector<std::int16_t>     m_samples;  //!< Temporary buffer of samples
-    std::recursive_mutex          m_mutex;    //!< Mutex protecting the data
-    Span<std::uint64_t>           m_loopSpan; //!< Loop Range Specifier
+    std::optional<InputSoundFile>                       m_file;         //!< The streamed music file
+    std::vector<float>                                  m_samples;      //!< Temporary buffer of samples
+    std::size_t                                         m_prefetched{}; //!< Samples of the buffer decoded ahead
+    Span<std::uint64_t>                                 m_loopSpan;     //!< Loop Range Specifier
+    std::deque<std::future<std::optional<QueuedTrack>>> m_queue;        //!< Tracks to play next, in order
+    mutable std::mutex                                  m_queueMutex;   //!< Protects the queue and the file swap
 };
 
 } // namespace sf
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Decoder of Opus packets to audio samples
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API OpusDecoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether SFML was built with Opus support
+    ///
+    /// Without Opus support, create always fails.
+    ///
+    /// \return True if Opus packets can be decoded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a decoder
+    ///
+    /// The packets can be decoded at any sample rate supported
+    /// by Opus (8000, 12000, 16000, 24000 or 48000) and with any
+    /// channel count (one or two), regardless of the settings of
+    /// the encoder that produced them.
+    ///
+    /// \param sampleRate   Sample rate of the decoded samples
+    /// \param channelCount Number of channels of the decoded samples
+    ///
+    /// \return Decoder if creation succeeded, `std::nullopt` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<OpusDecoder> create(unsigned int sampleRate, unsigned int channelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~OpusDecoder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    OpusDecoder(OpusDecoder&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    OpusDecoder& operator=(OpusDecoder&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the decoded samples
+    ///
+    /// \return Sample rate, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels of the decoded samples
+    ///
+    /// \return Number of channels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode a packet
+    ///
+    /// The decoded samples are appended to \a samples.
+    ///
+    /// \param data        Pointer to the packet data
+    /// \param sizeInBytes Size of the packet, in bytes
+    /// \param samples     Array to append the interleaved samples to
+    ///
+    /// \return True if the packet was decoded, false if it is invalid
+    ///
+    /// \see decodeLost
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool decode(const void* data, std::size_t sizeInBytes, std::vector<std::int16_t>& samples);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Conceal a lost packet
+    ///
+    /// Call this function in place of decode when a packet
+    /// didn't arrive in time: the decoder extrapolates the
+    /// previous packets to fill the gap, which sounds much
+    /// smoother than silence. The concealed samples, as many as
+    /// in the last decoded packet, are appended to \a samples.
+    ///
+    /// \param samples Array to append the interleaved samples to
+    ///
+    /// \see decode
+    ///
+    ////////////////////////////////////////////////////////////
+    void decodeLost(std::vector<std::int16_t>& samples);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the state of the decoder
+    ///
+    /// Call this function when starting to decode a new
+    /// stream of packets, unrelated to the previous ones.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from an implementation
+    ///
+    /// \param impl Implementation holding the Opus decoder
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit OpusDecoder(std::unique_ptr<Impl> impl);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::OpusDecoder
+/// \ingroup audio
+///
+/// sf::OpusDecoder decompresses the Opus packets produced by
+/// sf::OpusEncoder, typically received from the network. The
+/// decoded samples can be played by a sf::SoundStream.
+///
+/// Packets must be decoded in order. When a packet is lost or
+/// late, decodeLost fills the gap; a late packet is then
+/// dropped rather than decoded.
+///
+/// Opus is provided by libopus, enabled with the SFML_USE_OPUS
+/// CMake option. Use isAvailable to check whether it is supported.
+///
+/// Usage example:
+/// \code
+/// auto decoder = sf::OpusDecoder::create(48000, 1).value();
+/// std::vector<std::int16_t> samples;
+///
+/// sf::Packet packet;
+/// if (socket.receive(packet, sender, port) == sf::Socket::Status::Done)
+/// {
+///     std::uint16_t size = 0;
+///     if ((packet >> size) && (packet.getDataSize() - packet.getReadPosition() >= size))
+///     {
+///         const auto* data = static_cast<const std::byte*>(packet.getData()) + packet.getReadPosition();
+///         if (!decoder.decode(data, size, samples))
+///             decoder.decodeLost(samples);
+///     }
+/// }
+///
+/// // Give the samples to the sound stream playing the voice
+/// ...
+/// \endcode
+///
+/// \see sf::OpusEncoder, sf::SoundStream
+///
+////////////////////////////////////////////////////////////
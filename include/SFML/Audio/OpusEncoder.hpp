@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Encoder of audio samples to Opus packets
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API OpusEncoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Kind of signal the encoder is tuned for
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Application
+    {
+        Voip,    //!< Speech, favors intelligibility
+        Audio,   //!< Music and other signals, favors fidelity
+        LowDelay //!< Lowest possible latency, disables the speech modes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether SFML was built with Opus support
+    ///
+    /// Without Opus support, create always fails.
+    ///
+    /// \return True if Opus packets can be encoded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an encoder
+    ///
+    /// Opus only supports the sample rates 8000, 12000, 16000,
+    /// 24000 and 48000, and one or two channels.
+    ///
+    /// \param sampleRate   Sample rate of the samples to encode
+    /// \param channelCount Number of channels of the samples to encode
+    /// \param application  Kind of signal to encode
+    ///
+    /// \return Encoder if creation succeeded, `std::nullopt` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<OpusEncoder> create(unsigned int sampleRate,
+                                                           unsigned int channelCount,
+                                                           Application  application = Application::Voip);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~OpusEncoder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    OpusEncoder(OpusEncoder&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    OpusEncoder& operator=(OpusEncoder&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the target bitrate of the encoded packets
+    ///
+    /// By default, the bitrate is chosen from the sample rate
+    /// and the channel count. Speech is usually intelligible
+    /// from 12000 bits per second, 24000 give a good quality.
+    ///
+    /// \param bitrate Target bitrate, in bits per second
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBitrate(unsigned int bitrate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the encoded samples
+    ///
+    /// \return Sample rate, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels of the encoded samples
+    ///
+    /// \return Number of channels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples encoded in each packet
+    ///
+    /// Each packet holds 20 milliseconds of sound. The count
+    /// takes the channels into account.
+    ///
+    /// \return Number of samples per packet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPacketSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add samples to encode
+    ///
+    /// The samples are buffered until there are enough of them
+    /// to fill a packet, so any number of samples can be pushed,
+    /// like the chunks given to sf::SoundRecorder::onProcessSamples.
+    ///
+    /// \param samples     Pointer to the array of interleaved samples
+    /// \param sampleCount Number of samples in the array
+    ///
+    /// \see popPacket
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushSamples(const std::int16_t* samples, std::size_t sampleCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode the next packet
+    ///
+    /// \param packet Filled with the encoded packet
+    ///
+    /// \return True if a packet was encoded, false if not enough samples were pushed
+    ///
+    /// \see pushSamples, flush
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool popPacket(std::vector<std::byte>& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pad the buffered samples with silence to fill a packet
+    ///
+    /// Call this function when the capture ends, so that the
+    /// last samples can be retrieved with popPacket.
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from an implementation
+    ///
+    /// \param impl Implementation holding the Opus encoder
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit OpusEncoder(std::unique_ptr<Impl> impl);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::OpusEncoder
+/// \ingroup audio
+///
+/// sf::OpusEncoder compresses audio samples to Opus packets,
+/// to send them over the network: Opus is the codec of choice
+/// for voice chat, packets of 20 milliseconds of speech take
+/// 30 to 60 bytes. The packets are decoded by sf::OpusDecoder.
+///
+/// Opus packets carry no framing: their size must be sent
+/// along with them, for example by putting them in sf::Packet
+/// instances. Packets may be sent over UDP; a lost packet is
+/// concealed by the decoder.
+///
+/// Opus is provided by libopus, enabled with the SFML_USE_OPUS
+/// CMake option. Use isAvailable to check whether it is supported.
+///
+/// Usage example:
+/// \code
+/// class VoiceRecorder : public sf::SoundRecorder
+/// {
+///     bool onStart() override
+///     {
+///         return (encoder = sf::OpusEncoder::create(getSampleRate(), getChannelCount())).has_value();
+///     }
+///
+///     [[nodiscard]] bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) override
+///     {
+///         encoder->pushSamples(samples, sampleCount);
+///         while (encoder->popPacket(opusPacket))
+///         {
+///             sf::Packet packet;
+///             packet << static_cast<std::uint16_t>(opusPacket.size());
+///             packet.append(opusPacket.data(), opusPacket.size());
+///             (void)socket.send(packet, recipient, port);
+///         }
+///         return true;
+///     }
+///
+///     std::optional<sf::OpusEncoder> encoder;
+///     std::vector<std::byte>         opusPacket;
+///     ...
+/// };
+///
+/// VoiceRecorder recorder;
+/// (void)recorder.start(48000);
+/// \endcode
+///
+/// \see sf::OpusDecoder, sf::SoundRecorder
+///
+////////////////////////////////////////////////////////////
@@ -33,10 +33,12 @@
 #include <SFML/Audio/SoundFileWriter.hpp>
 
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <optional>
 #include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -49,10 +51,34 @@ namespace sf
 class SFML_AUDIO_API OutputSoundFile
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Behavior of write when the queue of an asynchronous file is full
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class OverflowPolicy
+    {
+        Wait, //!< Wait for the encoder thread to make room, no sample is lost
+        Drop  //!< Drop the samples that don't fit, write never waits
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of the queue of an asynchronous file
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AsyncStatistics
+    {
+        std::size_t   queuedSampleCount{};     //!< Number of samples waiting to be encoded
+        std::size_t   peakQueuedSampleCount{}; //!< Highest number of samples that waited to be encoded
+        std::uint64_t encodedSampleCount{};    //!< Number of samples encoded by the encoder thread
+        std::uint64_t stallCount{};            //!< Number of calls to write that waited for room in the queue
+        std::uint64_t droppedSampleCount{};    //!< Number of samples dropped because the queue was full
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Open the sound file from the disk for writing
     ///
-    /// The supported audio formats are: WAV, OGG/Vorbis, FLAC.
+    /// The supported audio formats are: WAV, OGG/Vorbis, FLAC,
+    /// and OGG/Opus if SFML was built with SFML_USE_OPUS.
     ///
     /// \param filename     Path of the sound file to write
     /// \param sampleRate   Sample rate of the sound
@@ -68,22 +94,112 @@ public:
         unsigned int                     channelCount,
         const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The samples still queued by an asynchronous file are
+    /// encoded before the file is closed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~OutputSoundFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    OutputSoundFile(OutputSoundFile&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    OutputSoundFile& operator=(OutputSoundFile&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode the samples on a dedicated thread
+    ///
+    /// Once this function is called, write only copies the
+    /// samples into a lock-free queue, and an encoder thread
+    /// feeds them to the writer of the file format. This keeps
+    /// the expensive encoders (Vorbis, FLAC) off the thread
+    /// that produces the samples, like the audio capture thread.
+    ///
+    /// The capacity of the queue is rounded up to a power of two.
+    /// It must hold the samples produced while the encoder
+    /// thread is busy; a second of sound is a safe choice.
+    ///
+    /// Calling this function again has no effect.
+    ///
+    /// \param queueCapacity  Number of samples that the queue can hold
+    /// \param overflowPolicy What write does when the queue is full
+    ///
+    /// \see isAsync, flush, getAsyncStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void startAsyncWriting(std::size_t queueCapacity = 131072, OverflowPolicy overflowPolicy = OverflowPolicy::Wait);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the samples are encoded on a dedicated thread
+    ///
+    /// \return True if startAsyncWriting was called
+    ///
+    /// \see startAsyncWriting
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Write audio samples to the file
     ///
+    /// If the file is asynchronous, the samples are queued and
+    /// encoded later. Only one thread may write to the file.
+    ///
     /// \param samples     Pointer to the sample array to write
     /// \param count       Number of samples to write
     ///
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for the queued samples to be encoded
+    ///
+    /// The returned future becomes ready once all the samples
+    /// written before the call have been given to the encoder.
+    /// For a synchronous file, it is ready immediately.
+    ///
+    /// \return Future signaling the end of the encoding
+    ///
+    /// \see startAsyncWriting
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<void> flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the queue of an asynchronous file
+    ///
+    /// The stall and drop counts reveal a queue that is too
+    /// small for the time the encoder takes. All the statistics
+    /// are zero for a synchronous file.
+    ///
+    /// \return Statistics of the queue
+    ///
+    /// \see startAsyncWriting
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AsyncStatistics getAsyncStatistics() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
+    /// The samples still queued by an asynchronous file are
+    /// encoded before the file is closed.
+    ///
     ////////////////////////////////////////////////////////////
     void close();
 
 private:
+    struct AsyncWriter;
+
     ////////////////////////////////////////////////////////////
     /// \brief Constructor from writer
     ///
@@ -94,6 +210,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     std::unique_ptr<SoundFileWriter> m_writer; //!< Writer that handles I/O on the file's format
+    std::unique_ptr<AsyncWriter>     m_async;  //!< Queue and encoder thread of an asynchronous file, owning the writer
 };
 
 } // namespace sf
@@ -123,6 +240,25 @@ private:
 /// }
 /// \endcode
 ///
+/// Encoding can be moved to a dedicated thread with
+/// startAsyncWriting: write then only queues the samples,
+/// which makes it cheap enough to be called from an audio
+/// thread. sf::SoundRecorder::setOutputFile writes the
+/// captured samples to such a file.
+/// \code
+/// auto file = sf::OutputSoundFile::openFromFile("capture.ogg", 48000, 1, {sf::SoundChannel::Mono}).value();
+/// file.startAsyncWriting(65536, sf::OutputSoundFile::OverflowPolicy::Drop);
+///
+/// recorder.setOutputFile(&file);
+/// if (!recorder.start(48000))
+/// {
+///     // Handle error...
+/// }
+/// ...
+/// recorder.stop();
+/// file.close();
+/// \endcode
+///
 /// \see sf::SoundFileWriter, sf::InputSoundFile
 ///
 ////////////////////////////////////////////////////////////
@@ -29,13 +29,65 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/System/Time.hpp>
+
+#include <array>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include <cstdint>
+
 
 namespace sf::PlaybackDevice
 {
+////////////////////////////////////////////////////////////
+/// \brief Configuration of the audio playback device
+///
+/// A value of 0 leaves the choice to the audio backend. The
+/// backend may not be able to honor every request: use
+/// getActiveSettings and getLatency to find out what was
+/// actually obtained.
+///
+////////////////////////////////////////////////////////////
+struct Settings
+{
+    unsigned int periodSizeInFrames{}; //!< Number of frames processed by each audio callback (0 for the default)
+    unsigned int periodCount{};        //!< Number of periods in the device buffer (0 for the default)
+    unsigned int sampleRate{};         //!< Sample rate of the device (0 for its native rate)
+    bool         exclusiveMode{};      //!< Request exclusive access to the device (WASAPI exclusive, ALSA hw)
+    bool         lowLatency{};         //!< Optimize the backend configuration for latency rather than for stability
+    bool         binaural{};           //!< Render the sounds for headphones with a head related transfer function
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Performance counters of the audio engine
+///
+/// The load of a callback is the time spent mixing a period,
+/// relative to the duration of the period. A callback whose
+/// load reaches 100% misses its deadline, and the device
+/// plays a glitch.
+///
+////////////////////////////////////////////////////////////
+struct Statistics
+{
+    static constexpr std::size_t LoadBucketCount = 10; //!< Number of buckets of the load histogram
+    using LoadHistogram                          = std::array<std::uint64_t, LoadBucketCount>;
+
+    LoadHistogram loadHistogram{};         //!< Number of callbacks per load, by steps of 10%
+    std::uint64_t callbackCount{};         //!< Number of periods mixed
+    std::uint64_t lateCallbackCount{};     //!< Number of periods that took longer to mix than their duration
+    Time          lastCallbackDuration;    //!< Time spent mixing the last period
+    Time          maxCallbackDuration;     //!< Longest time spent mixing a period
+    unsigned int  periodSizeInFrames{};    //!< Number of frames of the last period
+    Time          periodDuration;          //!< Duration of the last period
+    unsigned int  activeVoiceCount{};      //!< Number of sounds and streams mixed in the last period
+    unsigned int  streamingVoiceCount{};   //!< Number of streams mixed in the last period
+    unsigned int  virtualVoiceCount{};     //!< Number of virtual sounds of all the sound pools
+    std::uint64_t underrunCount{};         //!< Number of times a stream ran out of decoded samples
+    float         minDecodeAheadFill{1.f}; //!< Lowest fill ratio of the decode-ahead buffers in the last period
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief Get a list of the names of all available audio playback devices
 ///
@@ -107,4 +159,122 @@ namespace sf::PlaybackDevice
 ////////////////////////////////////////////////////////////
 [[nodiscard]] SFML_AUDIO_API std::optional<std::string> getDevice();
 
+////////////////////////////////////////////////////////////
+/// \brief Set the configuration of the audio playback device
+///
+/// This function can be called on the fly: the device is
+/// reinitialized with the new settings, and the sounds that
+/// are playing continue uninterrupted, like when switching
+/// devices with setDevice. If no audio resource exists yet,
+/// the settings are applied when the device is created.
+///
+/// If exclusive mode is requested but the device cannot be
+/// opened exclusively, it is opened in shared mode instead.
+///
+/// In binaural mode, the device is opened in stereo and the
+/// sounds are spatialized to virtual surround speakers, which
+/// are then rendered as heard by the two ears of the listener.
+/// This gives a much better sense of direction, including
+/// front and back, to headphone users, for a fixed cost that
+/// doesn't depend on the number of sounds. It should not be
+/// used with loudspeakers. Only the horizontal direction of
+/// the sounds is rendered.
+///
+/// \param settings The settings to apply
+///
+/// \return True, if the device could be reinitialized with the new settings
+///
+/// \see getSettings, getActiveSettings, getLatency
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API bool setSettings(const Settings& settings);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the requested configuration of the audio playback device
+///
+/// \return The settings last passed to setSettings
+///
+/// \see setSettings, getActiveSettings
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API Settings getSettings();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the configuration actually used by the audio playback device
+///
+/// The values are the ones negotiated with the backend, which
+/// may differ from the requested ones.
+///
+/// \return The settings of the current device or std::nullopt if there is none
+///
+/// \see setSettings, getLatency
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API std::optional<Settings> getActiveSettings();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the output latency of the audio playback device
+///
+/// The latency is the duration of the buffer of the device,
+/// i.e. the delay between the moment a sample is mixed and
+/// the moment it is sent to the hardware. It doesn't include
+/// the latency of the hardware itself.
+///
+/// \return The latency of the current device, or Time::Zero if there is none
+///
+/// \see setSettings, getActiveSettings
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API Time getLatency();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the current time of the audio clock
+///
+/// The audio clock counts the frames mixed by the audio engine
+/// since the playback device was opened, at the sample rate
+/// of the device (see getActiveSettings). Unlike sf::Clock, it
+/// runs in lockstep with the samples that are played, so it is
+/// the time base to use to schedule sounds with sample accuracy
+/// (see sf::Sound::playAt).
+///
+/// Since the engine mixes a whole period in advance, the clock
+/// is ahead of what is heard by roughly getLatency(). It starts
+/// over from 0 when the device is reopened, for example after
+/// a call to setDevice or setSettings.
+///
+/// \return Number of frames mixed since the device was opened, or 0 if there is no device
+///
+/// \see sf::Sound::playAt, sf::Sound::stopAt
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API std::uint64_t getClock();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the performance counters of the audio engine
+///
+/// The counters are updated by the audio thread at the end
+/// of each period, and can be read from any thread without
+/// ever blocking it, for example to display them every
+/// frame. Each counter is read atomically, but the counters
+/// may be updated while they are read one after the other.
+///
+/// \return The counters accumulated since the last reset
+///
+/// \see resetStatistics
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API Statistics getStatistics();
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the accumulated performance counters
+///
+/// The histogram, the callback and underrun counts and the
+/// longest callback duration are reset to 0. The counters
+/// describing the last period are kept.
+///
+/// \see getStatistics
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void resetStatistics();
+
 } // namespace sf::PlaybackDevice
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundRecorder.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Specialized SoundRecorder which stores the captured
+///        audio data into a lock-free ring buffer
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API RingBufferRecorder : public SoundRecorder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the recorder
+    ///
+    /// The capacity is rounded up so that the ring buffer holds
+    /// a power of two number of samples.
+    ///
+    /// \param capacity Duration of audio that the ring buffer can hold
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit RingBufferRecorder(Time capacity = seconds(1));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RingBufferRecorder() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read captured 16-bit samples out of the ring buffer
+    ///
+    /// This function never blocks: it returns the samples that
+    /// are available, up to \a maxCount. Only one thread may
+    /// read from the recorder at a time.
+    /// The recorder must capture SampleFormat::Int16 samples.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t read(std::int16_t* samples, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read captured floating point samples out of the ring buffer
+    ///
+    /// This function never blocks: it returns the samples that
+    /// are available, up to \a maxCount. Only one thread may
+    /// read from the recorder at a time.
+    /// The recorder must capture SampleFormat::Float32 samples.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t read(float* samples, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples waiting to be read
+    ///
+    /// \return Number of samples that can be read
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getAvailableSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times captured samples were dropped
+    ///
+    /// Samples are dropped when the ring buffer is full, because
+    /// the reader doesn't keep up with the capture.
+    ///
+    /// \return Number of overruns since the capture started
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getOverrunCount() const;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start capturing audio data
+    ///
+    /// \return True to start the capture, or false to abort it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onStart() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a new chunk of recorded samples
+    ///
+    /// \param samples     Pointer to the new chunk of recorded samples
+    /// \param sampleCount Number of samples pointed by \a samples
+    ///
+    /// \return True to continue the capture, or false to stop it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a new chunk of recorded floating point samples
+    ///
+    /// \param samples     Pointer to the new chunk of recorded samples
+    /// \param sampleCount Number of samples pointed by \a samples
+    ///
+    /// \return True to continue the capture, or false to stop it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onProcessFloatSamples(const float* samples, std::size_t sampleCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time                       m_capacity;        //!< Duration of audio that the ring buffer can hold
+    std::vector<std::int16_t>  m_samples;         //!< Ring buffer of 16-bit samples
+    std::vector<float>         m_floatSamples;    //!< Ring buffer of floating point samples
+    std::atomic<std::size_t>   m_readIndex{};     //!< Total number of samples read, wraps around
+    std::atomic<std::size_t>   m_writeIndex{};    //!< Total number of samples written, wraps around
+    std::atomic<std::uint64_t> m_overrunCount{};  //!< Number of times samples were dropped
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RingBufferRecorder
+/// \ingroup audio
+///
+/// sf::RingBufferRecorder makes the captured audio available
+/// to another thread, typically an encoder or a network
+/// sender, through a single producer / single consumer
+/// ring buffer. The capture callback writes into the ring
+/// without locking or allocating, and the reader pulls the
+/// samples whenever it wants with read().
+///
+/// If the reader doesn't keep up, the newest samples are
+/// dropped and getOverrunCount() is incremented, so that the
+/// capture never waits for the reader.
+///
+/// The recorder works with both sample formats: call
+/// setSampleFormat(sf::SampleFormat::Float32) before start()
+/// to receive floating point samples, and read them with the
+/// matching overload of read().
+///
+/// Usage example:
+/// \code
+/// sf::RingBufferRecorder recorder(sf::milliseconds(500));
+/// recorder.setSampleFormat(sf::SampleFormat::Float32);
+/// if (!recorder.start(48000))
+/// {
+///     // Handle error...
+/// }
+///
+/// std::vector<float> samples(960);
+/// while (encoding)
+/// {
+///     if (recorder.getAvailableSampleCount() >= samples.size())
+///     {
+///         recorder.read(samples.data(), samples.size());
+///         encoder.encode(samples);
+///     }
+///     ...
+/// }
+///
+/// recorder.stop();
+/// \endcode
+///
+/// \see sf::SoundRecorder, sf::SoundBufferRecorder
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup audio
+/// \brief Formats in which audio samples can be stored
+///
+/// 16-bit integer samples take half the memory, while
+/// 32-bit floating point samples keep the full precision of
+/// the decoded file and are mixed by the audio engine
+/// without any conversion. Floating point samples are
+/// normalized to the [-1, 1] range.
+///
+////////////////////////////////////////////////////////////
+enum class SampleFormat
+{
+    Int16,  //!< 16-bit signed integer samples
+    Float32 //!< 32-bit floating point samples
+};
+
+} // namespace sf
@@ -33,12 +33,14 @@
 
 #include <memory>
 
+#include <cstdint>
 #include <cstdlib>
 
 namespace sf
 {
 class Time;
 class SoundBuffer;
+class CompressedSoundBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Regular sound that can be played in the audio environment
@@ -61,6 +63,20 @@ public:
     ////////////////////////////////////////////////////////////
     explicit Sound(SoundBuffer&& buffer) = delete;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the sound with a compressed buffer
+    ///
+    /// \param buffer Compressed sound buffer containing the audio data to play with the sound
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Sound(const CompressedSoundBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary compressed sound buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Sound(CompressedSoundBuffer&& buffer) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
@@ -83,12 +99,47 @@ public:
     /// was it already playing.
     /// This function uses its own thread so that it doesn't block
     /// the rest of the program while the sound is played.
+    /// A stop scheduled with stopAt is canceled.
     ///
-    /// \see pause, stop
+    /// \see pause, stop, playAt
     ///
     ////////////////////////////////////////////////////////////
     void play() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start or resume playing the sound at a given time of the audio clock
+    ///
+    /// The sound behaves as with play(), except that its first
+    /// sample is mixed exactly when the audio clock reaches
+    /// \a clockTime rather than at the start of the next period
+    /// of the engine, so that sounds scheduled this way are kept
+    /// in time with each other to the sample. A time that has
+    /// already passed starts the sound right away. Until then,
+    /// the sound is reported as playing, at offset 0.
+    ///
+    /// \param clockTime Time of the audio clock at which the sound starts, in frames
+    ///
+    /// \see play, stopAt, PlaybackDevice::getClock
+    ///
+    ////////////////////////////////////////////////////////////
+    void playAt(std::uint64_t clockTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop playing the sound at a given time of the audio clock
+    ///
+    /// The last sample of the sound is mixed exactly before the
+    /// audio clock reaches \a clockTime. Once it has, the sound
+    /// is reported as stopped, and is rewound the next time it
+    /// is played. Calling play, playAt, pause or stop cancels
+    /// the scheduled stop.
+    ///
+    /// \param clockTime Time of the audio clock at which the sound stops, in frames
+    ///
+    /// \see playAt, PlaybackDevice::getClock
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopAt(std::uint64_t clockTime);
+
     ////////////////////////////////////////////////////////////
     /// \brief Pause the sound
     ///
@@ -132,6 +183,29 @@ public:
     ////////////////////////////////////////////////////////////
     void setBuffer(SoundBuffer&& buffer) = delete;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the source compressed buffer containing the audio data to play
+    ///
+    /// The sound decodes the buffer by itself while it plays, into
+    /// a small cache of its own, so that any number of sounds can
+    /// play the same compressed buffer at different positions.
+    /// The buffer is not copied, thus the sf::CompressedSoundBuffer
+    /// instance must remain alive as long as it is attached to the
+    /// sound.
+    ///
+    /// \param buffer Compressed sound buffer to attach to the sound
+    ///
+    /// \see getCompressedBuffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBuffer(const CompressedSoundBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary compressed sound buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBuffer(CompressedSoundBuffer&& buffer) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Set whether or not the sound should loop after reaching the end
     ///
@@ -173,6 +247,26 @@ public:
     ////////////////////////////////////////////////////////////
     void setEffectProcessor(EffectProcessor effectProcessor) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the bus the sound outputs to
+    ///
+    /// \param bus Bus to output to, or nullptr to output to the audio device
+    ///
+    /// \see getBus
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBus(AudioBus* bus) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the sound outputs to
+    ///
+    /// \return Bus the sound outputs to, or nullptr if it outputs to the audio device
+    ///
+    /// \see setBus
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus* getBus() const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the audio buffer attached to the sound
     ///
@@ -181,6 +275,15 @@ public:
     ////////////////////////////////////////////////////////////
     const SoundBuffer& getBuffer() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compressed audio buffer attached to the sound
+    ///
+    /// \return Compressed sound buffer attached to the sound,
+    ///         or a null pointer if the sound plays a regular sf::SoundBuffer
+    ///
+    ////////////////////////////////////////////////////////////
+    const CompressedSoundBuffer* getCompressedBuffer() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Tell whether or not the sound is in loop mode
     ///
@@ -221,6 +324,7 @@ public:
 
 private:
     friend class SoundBuffer;
+    friend class CompressedSoundBuffer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Detach sound from its internal buffer
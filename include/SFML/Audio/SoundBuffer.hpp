@@ -29,13 +29,16 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
+#include <SFML/System/Allocator.hpp>
+#include <SFML/System/MemoryStats.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <filesystem>
+#include <memory>
 #include <optional>
-#include <unordered_set>
 #include <vector>
 
 #include <cstddef>
@@ -47,6 +50,7 @@ namespace sf
 class Sound;
 class InputSoundFile;
 class InputStream;
+class MappedFileInputStream;
 
 ////////////////////////////////////////////////////////////
 /// \brief Storage for audio samples defining a sound
@@ -55,6 +59,16 @@ class InputStream;
 class SFML_AUDIO_API SoundBuffer
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Format to which the samples are converted when loading
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Conversion
+    {
+        unsigned int              sampleRate{}; //!< Sample rate to convert to, 0 for the rate of the playback device
+        std::vector<SoundChannel> channelMap;   //!< Channels to convert to, empty to keep the channels of the file
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
@@ -76,13 +90,87 @@ public:
     /// of supported formats.
     ///
     /// \param filename Path of the sound file to load
+    /// \param format   Format in which the samples are stored in the buffer
     ///
     /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
     ///
     /// \see loadFromMemory, loadFromStream, loadFromSamples, saveToFile
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> loadFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromFile(
+        const std::filesystem::path& filename,
+        SampleFormat                 format = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from a file and convert it to another format
+    ///
+    /// When the sample rate or the channels of a sound differ
+    /// from those of the playback device, they are converted in
+    /// real time every time the sound is played. Converting the
+    /// samples once when loading them lets the sounds skip this
+    /// conversion, which saves a lot of mixing time when many
+    /// sounds are played at the same time.
+    ///
+    /// See convert for details about the conversion.
+    ///
+    /// \param filename   Path of the sound file to load
+    /// \param conversion Sample rate and channels to convert the sound to
+    /// \param format     Format in which the samples are stored in the buffer
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see convert, loadFromFiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromFile(const std::filesystem::path& filename,
+                                                                 const Conversion&            conversion,
+                                                                 SampleFormat format = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from a file mapped in memory
+    ///
+    /// The file is mapped read-only in the address space of the
+    /// process. If it is a wav file storing 16-bit PCM samples,
+    /// the buffer refers to the samples directly inside the
+    /// mapping: nothing is decoded nor copied, and the pages are
+    /// loaded by the operating system when they are first played.
+    /// Any other file is decoded like with loadFromFile.
+    ///
+    /// The mapping is shared by all the copies of the buffer and
+    /// released when the last of them is destroyed.
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadFromFile, loadFromFiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromMappedFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a bank of sound buffers from files in parallel
+    ///
+    /// The files are decoded concurrently on the global thread
+    /// pool, or by the job scheduler if one is set, which is much
+    /// faster than loading them one after the other when the
+    /// bank contains many sounds. With SampleFormat::Int16,
+    /// each file is loaded with loadFromMappedFile, so that PCM
+    /// wav files are not decoded at all.
+    ///
+    /// \param filenames   Paths of the sound files to load
+    /// \param format      Format in which the samples are stored in the buffers
+    /// \param threadCount Maximum number of files loaded at the same time, 0 to use one per hardware thread
+    ///
+    /// \return One entry per file, in the same order, which is `std::nullopt` if the file failed to load
+    ///
+    /// \see loadFromFile, loadFromMappedFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::vector<std::optional<SoundBuffer>> loadFromFiles(
+        const std::vector<std::filesystem::path>& filenames,
+        SampleFormat                              format      = SampleFormat::Int16,
+        unsigned int                              threadCount = 0);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a file in memory
@@ -92,13 +180,16 @@ public:
     ///
     /// \param data        Pointer to the file data in memory
     /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param format      Format in which the samples are stored in the buffer
     ///
     /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
     ///
     /// \see loadFromFile, loadFromStream, loadFromSamples
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> loadFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromMemory(const void*  data,
+                                                                   std::size_t  sizeInBytes,
+                                                                   SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a custom stream
@@ -107,13 +198,15 @@ public:
     /// of supported formats.
     ///
     /// \param stream Source stream to read from
+    /// \param format Format in which the samples are stored in the buffer
     ///
     /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
     ///
     /// \see loadFromFile, loadFromMemory, loadFromSamples
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> loadFromStream(InputStream& stream);
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromStream(InputStream& stream,
+                                                                   SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from an array of audio samples
@@ -138,6 +231,31 @@ public:
         unsigned int                     sampleRate,
         const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from an array of floating point audio samples
+    ///
+    /// The samples are expected to be normalized to the [-1, 1]
+    /// range. They are stored as they are, so the buffer has
+    /// the SampleFormat::Float32 format.
+    ///
+    /// \param samples      Pointer to the array of samples in memory
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels (1 = mono, 2 = stereo, ...)
+    /// \param sampleRate   Sample rate (number of samples to play per second)
+    /// \param channelMap   Map of position in sample frame to sound channel
+    ///
+    /// \return Sound buffer if loading succeeded, `std::nullopt` if it failed
+    ///
+    /// \see loadFromFile, loadFromMemory, saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<SoundBuffer> loadFromSamples(
+        const float*                     samples,
+        std::uint64_t                    sampleCount,
+        unsigned int                     channelCount,
+        unsigned int                     sampleRate,
+        const std::vector<SoundChannel>& channelMap);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the sound buffer to an audio file
     ///
@@ -153,6 +271,33 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool saveToFile(const std::filesystem::path& filename) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a copy of the sound buffer converted to another format
+    ///
+    /// The samples are resampled with a windowed sinc filter,
+    /// which is much more accurate than the linear interpolation
+    /// used for real time playback, on all the hardware threads.
+    /// The channels are mixed like they are during playback.
+    ///
+    /// If the sample rate of the conversion is 0, the sample
+    /// rate of the playback device is used; the device is opened
+    /// if it is not already. The samples are stored in the same
+    /// format as in this buffer.
+    ///
+    /// Beware that, like any sound with more than one channel,
+    /// a mono sound converted to stereo is not spatialized
+    /// anymore; the channels of sounds that are meant to be
+    /// positioned in the scene should be kept as they are.
+    ///
+    /// \param conversion Sample rate and channels to convert the sound to
+    ///
+    /// \return Converted sound buffer, `std::nullopt` if the conversion failed
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<SoundBuffer> convert(const Conversion& conversion) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the array of audio samples stored in the buffer
     ///
@@ -160,13 +305,39 @@ public:
     /// The total number of samples in this array is given by the
     /// getSampleCount() function.
     ///
-    /// \return Read-only pointer to the array of sound samples
+    /// \return Read-only pointer to the array of sound samples,
+    ///         or a null pointer if the buffer stores floating point samples
     ///
-    /// \see getSampleCount
+    /// \see getSampleCount, getFloatSamples, getSampleFormat
     ///
     ////////////////////////////////////////////////////////////
     const std::int16_t* getSamples() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the array of floating point audio samples stored in the buffer
+    ///
+    /// The samples are normalized to the [-1, 1] range.
+    /// The total number of samples in this array is given by the
+    /// getSampleCount() function.
+    ///
+    /// \return Read-only pointer to the array of sound samples,
+    ///         or a null pointer if the buffer stores 16-bit samples
+    ///
+    /// \see getSampleCount, getSamples, getSampleFormat
+    ///
+    ////////////////////////////////////////////////////////////
+    const float* getFloatSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples stored in the buffer
+    ///
+    /// \return Format of the samples
+    ///
+    /// \see getSamples, getFloatSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    SampleFormat getSampleFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the number of samples stored in the buffer
     ///
@@ -243,21 +414,47 @@ public:
 private:
     friend class Sound;
 
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using Samples    = priv::Vector<std::int16_t, MemoryModule::Audio>; //!< 16-bit samples
+    using SoundList  = std::vector<Sound*>;                             //!< Unique sound instances
+    using MappingPtr = std::shared_ptr<const MappedFileInputStream>;    //!< File mapping shared by copies of a buffer
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct from vector of samples
     ///
     ////////////////////////////////////////////////////////////
-    explicit SoundBuffer(std::vector<std::int16_t>&& samples);
+    explicit SoundBuffer(Samples&& samples);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from vector of floating point samples
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundBuffer(std::vector<float>&& floatSamples);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from samples stored in a file mapping
+    ///
+    /// \param mapping     Mapping of the file that contains the samples
+    /// \param samples     Pointer to the first sample inside the mapping
+    /// \param sampleCount Number of samples
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBuffer(std::shared_ptr<const MappedFileInputStream> mapping,
+                const std::int16_t*                          samples,
+                std::uint64_t                                sampleCount);
 
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
     ///
-    /// \param file Sound file providing access to the new loaded sound
+    /// \param file   Sound file providing access to the new loaded sound
+    /// \param format Format in which the samples are stored
     ///
     /// \return True on successful initialization, false on failure
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::optional<SoundBuffer> initialize(InputSoundFile& file);
+    [[nodiscard]] static std::optional<SoundBuffer> initialize(InputSoundFile& file, SampleFormat format);
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the internal buffer with the cached audio samples
@@ -287,19 +484,20 @@ private:
     ////////////////////////////////////////////////////////////
     void detachSound(Sound* sound) const;
 
-    ////////////////////////////////////////////////////////////
-    // Types
-    ////////////////////////////////////////////////////////////
-    using SoundList = std::unordered_set<Sound*>; //!< Set of unique sound instances
-
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::int16_t> m_samples;                        //!< Samples buffer
+    Samples                   m_samples;                        //!< Samples buffer
+    std::vector<float>        m_floatSamples;                   //!< Floating point samples buffer
+    MappingPtr                m_mapping;                        //!< File mapping holding the samples, if any
+    const std::int16_t*       m_mappedSamples{};                //!< Samples inside the file mapping
+    std::uint64_t             m_mappedSampleCount{};            //!< Number of samples inside the file mapping
     unsigned int              m_sampleRate{44100};              //!< Number of samples per second
     std::vector<SoundChannel> m_channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
     Time                      m_duration;                       //!< Sound duration
     mutable SoundList         m_sounds;                         //!< List of sounds that are using this buffer
+
+    priv::MemoryCounter<MemoryStats::Category::SoundBuffer> m_memoryCounter; //!< Counts the buffer and its samples
 };
 
 } // namespace sf
@@ -311,7 +509,8 @@ private:
 ///
 /// A sound buffer holds the data of a sound, which is
 /// an array of audio samples. A sample is a 16 bits signed integer
-/// that defines the amplitude of the sound at a given time.
+/// (or a floating point value, see sf::SampleFormat) that defines
+/// the amplitude of the sound at a given time.
 /// The sound is then reconstituted by playing these samples at
 /// a high rate (for example, 44100 samples per second is the
 /// standard rate used for playing CDs). In short, audio samples
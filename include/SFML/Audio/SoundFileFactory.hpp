@@ -102,6 +102,12 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Instantiate the right reader for the given file on disk
     ///
+    /// The reader of a built-in format is chosen from the
+    /// extension of \a filename if it designates one, without
+    /// reading the file. Otherwise the format is detected from
+    /// the first bytes of the file, and as a last resort by
+    /// asking each registered reader whether it can read it.
+    ///
     /// \param filename Path of the sound file
     ///
     /// \return A new sound file reader that can read the given file, or null if no reader can handle it
@@ -136,6 +142,26 @@ public:
     ////////////////////////////////////////////////////////////
     static std::unique_ptr<SoundFileReader> createReaderFromStream(InputStream& stream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Instantiate the right codec for the given file in stream, trusting the extension of its name
+    ///
+    /// If the extension of \a formatHint designates a built-in
+    /// format (wav, flac, mp3, ogg or opus), the reader of this
+    /// format is returned right away, without reading the
+    /// stream. Otherwise this function behaves like the
+    /// overload without a hint.
+    ///
+    /// \param stream     Source stream to read from
+    /// \param formatHint Name of the file the stream reads
+    ///
+    /// \return A new sound file codec that can read the given file, or null if no codec can handle it
+    ///
+    /// \see createReaderFromFilename, createReaderFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::unique_ptr<SoundFileReader> createReaderFromStream(InputStream&                 stream,
+                                                                   const std::filesystem::path& formatHint);
+
     ////////////////////////////////////////////////////////////
     /// \brief Instantiate the right writer for the given file on disk
     ///
@@ -164,6 +190,21 @@ private:
     ////////////////////////////////////////////////////////////
     static ReaderFactoryMap& getReaderFactoryMap();
     static WriterFactoryMap& getWriterFactoryMap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the reader of a stream positioned at its beginning
+    ///
+    /// The extension of the hint is looked up first, then the
+    /// magic bytes of the built-in formats, read all at once,
+    /// and finally the check functions of the registered readers.
+    ///
+    /// \param stream     Source stream to read from
+    /// \param formatHint Name of the file the stream reads, may be empty
+    ///
+    /// \return A new sound file reader that can read the stream, or null if no reader can handle it
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::unique_ptr<SoundFileReader> createReader(InputStream& stream, const std::filesystem::path& formatHint);
 };
 
 } // namespace sf
@@ -105,6 +105,42 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as floating point values
+    ///
+    /// The samples are normalized to the [-1, 1] range. The default
+    /// implementation calls read() and converts the 16-bit integer
+    /// samples; readers that decode to a higher precision should
+    /// override it to avoid losing it.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next floating point samples of the file without copying them
+    ///
+    /// Readers of uncompressed formats can return a pointer to
+    /// the samples stored in the stream given to open, when its
+    /// contents are in memory (see InputStream::getData) and in
+    /// the format returned by readFloat. The read position is
+    /// advanced as with readFloat, and the samples remain valid
+    /// as long as the stream. The default implementation sets
+    /// \a samples to a null pointer, telling the caller to use
+    /// readFloat instead.
+    ///
+    /// \param samples  Pointer to set to the first sample, or to a null pointer if the samples can't be read in place
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::uint64_t readFloatInPlace(const float*& samples, std::uint64_t maxCount);
 };
 
 } // namespace sf
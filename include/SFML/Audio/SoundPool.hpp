@@ -0,0 +1,321 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/Sound.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector3.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Plays many one-shot sounds through a fixed number of voices
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool
+    ///
+    /// \param voiceCount Maximum number of sounds that are actually mixed at the same time
+    /// \param capacity   Maximum number of sounds that are tracked at the same time, real and virtual
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundPool(std::size_t voiceCount, std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Stops all the sounds of the pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundPool(const SoundPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundPool& operator=(const SoundPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Play a sound
+    ///
+    /// The sound is given a real voice right away if it is
+    /// audible and a voice is free, or if it is more important
+    /// than one of the sounds currently mixed. Otherwise it is
+    /// tracked as a virtual sound: its playing offset keeps
+    /// advancing and it gets a voice back as soon as it becomes
+    /// important enough.
+    ///
+    /// Sounds are first ranked by priority, then by their
+    /// estimated audibility (volume and distance to the listener).
+    ///
+    /// This function doesn't allocate memory, except when a
+    /// voice is used for the first time.
+    ///
+    /// \param buffer   Sound buffer to play, must stay alive while the sound plays
+    /// \param position Position of the sound in the scene
+    /// \param volume   Volume of the sound, in the range [0, 100]
+    /// \param priority Priority of the sound, higher priorities are mixed first
+    ///
+    /// \return True if the sound was accepted, false if the pool is full of more important sounds
+    ///
+    ////////////////////////////////////////////////////////////
+    bool play(const SoundBuffer& buffer, const Vector3f& position = {}, float volume = 100.f, int priority = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow playing a temporary sound buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool play(SoundBuffer&& buffer, const Vector3f& position = {}, float volume = 100.f, int priority = 0) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the pool
+    ///
+    /// Releases the sounds that have finished, advances the
+    /// virtual sounds and redistributes the voices to the most
+    /// important sounds. Call this function once per frame,
+    /// after updating the listener.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop all the sounds of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the minimum distance of the sounds of the pool
+    ///
+    /// \param distance New minimum distance
+    ///
+    /// \see SoundSource::setMinDistance
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMinDistance(float distance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the attenuation factor of the sounds of the pool
+    ///
+    /// \param attenuation New attenuation factor
+    ///
+    /// \see SoundSource::setAttenuation
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAttenuation(float attenuation);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain below which sounds are considered inaudible
+    ///
+    /// Inaudible sounds are tracked but never mixed, whatever
+    /// their priority. The default threshold is 0.001 (-60 dB).
+    ///
+    /// \param threshold Gain threshold, in the range [0, 1]
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAudibilityThreshold(float threshold);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of voices of the pool
+    ///
+    /// \return Maximum number of sounds mixed at the same time
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVoiceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the capacity of the pool
+    ///
+    /// \return Maximum number of sounds tracked at the same time
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sounds currently playing
+    ///
+    /// \return Number of real and virtual sounds
+    ///
+    /// \see getVirtualCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPlayingCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sounds currently playing without a voice
+    ///
+    /// \return Number of virtual sounds
+    ///
+    /// \see getPlayingCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVirtualCount() const;
+
+private:
+    static constexpr std::size_t noVoice = static_cast<std::size_t>(-1); //!< Invalid voice index
+
+    ////////////////////////////////////////////////////////////
+    /// \brief A sound tracked by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instance
+    {
+        const SoundBuffer* buffer{};       //!< Buffer played, nullptr if the slot is free
+        Vector3f           position;       //!< Position of the sound in the scene
+        float              volume{100.f};  //!< Volume of the sound
+        int                priority{};     //!< Priority of the sound
+        float              gain{};         //!< Estimated gain, updated by update()
+        Time               offset;         //!< Current playing offset
+        std::size_t        voice{noVoice}; //!< Index of the voice playing the sound, noVoice if virtual
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Estimate the gain of an instance as heard by the listener
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float computeGain(const Instance& instance, const Vector3f& listenerPosition) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an instance is more important than another one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isMoreImportant(const Instance& left, const Instance& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the least important real instance
+    ///
+    /// \return Index of the instance, or capacity if no instance is real
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findLeastImportantReal() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a voice that no instance owns
+    ///
+    /// \return Index of the voice, or the voice count if all voices are busy
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findFreeVoice() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start mixing an instance with a voice
+    ///
+    ////////////////////////////////////////////////////////////
+    void makeReal(std::size_t index, std::size_t voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop mixing an instance but keep tracking it
+    ///
+    ////////////////////////////////////////////////////////////
+    void makeVirtual(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop tracking an instance
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::optional<Sound>> m_voices;                     //!< Real voices, created on first use
+    std::vector<bool>                 m_busyVoices;                 //!< Whether each voice is owned by an instance
+    std::vector<Instance>             m_instances;                  //!< Tracked sounds
+    std::vector<std::size_t>          m_order;                      //!< Preallocated storage for ranking instances
+    std::size_t                       m_playingCount{};             //!< Number of tracked instances
+    std::size_t                       m_realCount{};                //!< Number of instances that own a voice
+    float                             m_minDistance{1.f};           //!< Minimum distance of the sounds
+    float                             m_attenuation{1.f};           //!< Attenuation factor of the sounds
+    float                             m_audibilityThreshold{1e-3f}; //!< Gain below which sounds aren't mixed
+    Clock                             m_clock;                      //!< Measures the time between two updates
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundPool
+/// \ingroup audio
+///
+/// sf::SoundPool plays large numbers of short sounds, like
+/// foot steps, impacts or gun shots. Only a fixed number of
+/// them are actually mixed: the others become "virtual",
+/// their playing offset is tracked but they cost nothing to
+/// the audio thread. Whenever the scene changes, update()
+/// hands the voices over to the most important sounds.
+///
+/// The importance of a sound is given by its priority first,
+/// then by an estimation of how loud it is for the listener,
+/// based on its volume and on the inverse distance model of
+/// sf::SoundSource. Sounds quieter than the audibility
+/// threshold are never mixed.
+///
+/// Once the pool has played as many sounds as it has voices,
+/// play() and update() no longer allocate memory.
+///
+/// The sound buffers passed to play() must remain alive as
+/// long as the sounds that use them are playing.
+///
+/// Usage example:
+/// \code
+/// const auto buffer = sf::SoundBuffer::loadFromFile("impact.wav").value();
+/// sf::SoundPool pool(32, 256);
+///
+/// pool.play(buffer, {10.f, 0.f, -5.f});
+///
+/// while (running)
+/// {
+///     sf::Listener::setPosition(playerPosition);
+///     pool.update();
+/// }
+/// \endcode
+///
+/// \see sf::Sound, sf::SoundBuffer
+///
+////////////////////////////////////////////////////////////
@@ -29,8 +29,11 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -41,6 +44,8 @@
 
 namespace sf
 {
+class OutputSoundFile;
+
 ////////////////////////////////////////////////////////////
 /// \brief Abstract base class for capturing sound data
 ///
@@ -185,6 +190,52 @@ public:
     ////////////////////////////////////////////////////////////
     const std::vector<SoundChannel>& getChannelMap() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the format of the captured samples
+    ///
+    /// With SampleFormat::Float32, the samples are delivered to
+    /// onProcessFloatSamples, normalized to the [-1, 1] range,
+    /// which suits encoders working in floating point (Opus, ...)
+    /// and avoids a conversion. The format must be chosen before
+    /// starting the recording.
+    ///
+    /// \param format Format of the captured samples
+    ///
+    /// \see getSampleFormat
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSampleFormat(SampleFormat format);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the captured samples
+    ///
+    /// \return Format of the captured samples
+    ///
+    /// \see setSampleFormat
+    ///
+    ////////////////////////////////////////////////////////////
+    SampleFormat getSampleFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the captured samples to a sound file
+    ///
+    /// The captured samples are written to \a file, as well as
+    /// given to onProcessSamples. Floating point samples are
+    /// converted to 16 bits. The file is written from the capture
+    /// thread: it should be asynchronous (see
+    /// sf::OutputSoundFile::startAsyncWriting) so that the capture
+    /// doesn't wait for the encoder, and it must be opened with
+    /// the sample rate and channel count of the recorder.
+    ///
+    /// The file is not owned by the recorder, it must remain
+    /// alive until the capture stops. Like the channel count,
+    /// the file must be set before starting the recording.
+    ///
+    /// \param file Sound file to write to, or nullptr to stop writing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutputFile(OutputSoundFile* file);
+
     ////////////////////////////////////////////////////////////
     /// \brief Check if the system supports audio capture
     ///
@@ -236,6 +287,24 @@ protected:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a new chunk of recorded floating point samples
+    ///
+    /// This virtual function is called instead of onProcessSamples
+    /// when the recorder captures SampleFormat::Float32 samples.
+    /// The default implementation converts the samples to 16 bits
+    /// and forwards them to onProcessSamples.
+    ///
+    /// \param samples     Pointer to the new chunk of recorded samples
+    /// \param sampleCount Number of samples pointed by \a samples
+    ///
+    /// \return True to continue the capture, or false to stop it
+    ///
+    /// \see setSampleFormat
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool onProcessFloatSamples(const float* samples, std::size_t sampleCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Stop capturing audio data
     ///
@@ -247,6 +316,23 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void onStop();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the processing interval
+    ///
+    /// The processing interval is the duration of the chunks of
+    /// samples given to onProcessSamples: shorter intervals lower
+    /// the latency of the capture, at the expense of more frequent
+    /// calls. A zero interval lets the audio backend choose.
+    /// The interval is a request, as the backend may round it.
+    ///
+    /// Like the channel count, the interval must be set before
+    /// starting the recording.
+    ///
+    /// \param interval Processing interval
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProcessingInterval(Time interval);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -284,6 +370,12 @@ private:
 /// CPU, but it can be changed to a smaller value if you need to process
 /// the recorded data in real time, for example.
 ///
+/// The samples given to onProcessSamples point straight into the
+/// buffer of the capture device, they are not copied beforehand.
+/// They can also be captured as floating point values (see
+/// setSampleFormat), in which case onProcessFloatSamples is
+/// called instead.
+///
 /// The audio capture feature may not be supported or activated
 /// on every platform, thus it is recommended to check its
 /// availability with the isAvailable() function. If it returns
@@ -35,10 +35,15 @@
 #include <SFML/System/Vector3.hpp>
 
 #include <functional>
+#include <optional>
+
+#include <cstddef>
 
 
 namespace sf
 {
+class AudioBus;
+
 // NOLINTBEGIN(readability-make-member-function-const)
 ////////////////////////////////////////////////////////////
 /// \brief Base class defining a sound's properties
@@ -76,6 +81,22 @@ public:
         float outerGain{}; //!< Outer gain
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief New spatial properties of a sound source
+    ///
+    /// Properties that are not set keep their current value.
+    ///
+    /// \see updateSpatial
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SpatialUpdate
+    {
+        SoundSource*            source{};  //!< Sound source to update
+        std::optional<Vector3f> position;  //!< New position of the sound in the scene
+        std::optional<Vector3f> velocity;  //!< New velocity of the sound in the scene
+        std::optional<Vector3f> direction; //!< New direction of the sound in the scene
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Callable that is provided with sound data for processing
     ///
@@ -276,6 +297,30 @@ public:
     ////////////////////////////////////////////////////////////
     void setVelocity(const Vector3f& velocity);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the spatial properties of many sounds at once
+    ///
+    /// When sounds are moved one after the other with
+    /// setPosition and setVelocity, the audio engine may mix a
+    /// period in the middle of the updates, with some sounds
+    /// already moved and others not. This function applies all
+    /// the updates between two periods, so that the scene stays
+    /// consistent, and is cheaper than the individual calls.
+    ///
+    /// The updates are queued and the audio engine applies them
+    /// at the start of the next period it mixes, so this function
+    /// never waits for the engine and the engine never waits for
+    /// it. Until then, getPosition, getVelocity and getDirection
+    /// keep returning the previous values.
+    ///
+    /// \param updates Pointer to the array of updates to apply
+    /// \param count   Number of updates in the array
+    ///
+    /// \see setPosition, setVelocity, setDirection
+    ///
+    ////////////////////////////////////////////////////////////
+    static void updateSpatial(const SpatialUpdate* updates, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the doppler factor of the sound
     ///
@@ -414,6 +459,20 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void setEffectProcessor(EffectProcessor effectProcessor);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the bus the sound outputs to
+    ///
+    /// The bus must remain alive as long as the sound outputs
+    /// to it, or be destroyed first: its sounds then output
+    /// to the audio device again.
+    ///
+    /// \param bus Bus to output to, or nullptr to output to the audio device
+    ///
+    /// \see getBus
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setBus(AudioBus* bus);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the pitch of the sound
     ///
@@ -575,6 +634,16 @@ public:
     ////////////////////////////////////////////////////////////
     float getAttenuation() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the sound outputs to
+    ///
+    /// \return Bus the sound outputs to, or nullptr if it outputs to the audio device
+    ///
+    /// \see setBus
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual AudioBus* getBus() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
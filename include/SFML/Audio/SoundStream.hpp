@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
@@ -57,8 +58,9 @@ public:
     ////////////////////////////////////////////////////////////
     struct Chunk
     {
-        const std::int16_t* samples{};     //!< Pointer to the audio samples
-        std::size_t         sampleCount{}; //!< Number of samples pointed by Samples
+        const std::int16_t* samples{};      //!< Pointer to the audio samples
+        const float*        floatSamples{}; //!< Pointer to the audio samples, for streams using SampleFormat::Float32
+        std::size_t         sampleCount{};  //!< Number of samples pointed by Samples
     };
 
     ////////////////////////////////////////////////////////////
@@ -205,6 +207,72 @@ public:
     ////////////////////////////////////////////////////////////
     void setEffectProcessor(EffectProcessor effectProcessor) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the bus the stream outputs to
+    ///
+    /// \param bus Bus to output to, or nullptr to output to the audio device
+    ///
+    /// \see getBus
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBus(AudioBus* bus) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the stream outputs to
+    ///
+    /// \return Bus the stream outputs to, or nullptr if it outputs to the audio device
+    ///
+    /// \see setBus
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus* getBus() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how much audio is decoded ahead of playback
+    ///
+    /// By default (Time::Zero), onGetData is called from the
+    /// audio device thread whenever it runs out of samples.
+    /// A non-zero duration makes the stream decode into a buffer
+    /// of that length from its own thread instead, so that a slow
+    /// onGetData doesn't starve the audio device, which then only
+    /// copies samples out of the buffer.
+    ///
+    /// The new duration is used the next time the stream is
+    /// played after being stopped. When the buffer is used,
+    /// derived classes must call stop() in their destructor,
+    /// like sf::Music does.
+    ///
+    /// \param duration Length of the buffer, Time::Zero to decode on the audio device thread
+    ///
+    /// \see getDecodeAheadDuration, getUnderrunCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDecodeAheadDuration(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how much audio is decoded ahead of playback
+    ///
+    /// \return Length of the buffer, Time::Zero if decoding happens on the audio device thread
+    ///
+    /// \see setDecodeAheadDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getDecodeAheadDuration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the decode-ahead buffer ran dry
+    ///
+    /// Every time the audio device needs samples that haven't
+    /// been decoded yet, silence is played instead and this
+    /// counter is incremented.
+    ///
+    /// \return Number of underruns since the stream was created
+    ///
+    /// \see setDecodeAheadDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getUnderrunCount() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
@@ -224,12 +292,19 @@ protected:
     /// It can be called multiple times if the settings of the
     /// audio stream change, but only when the stream is stopped.
     ///
+    /// Streams using SampleFormat::Float32 must provide their
+    /// samples through Chunk::floatSamples instead of Chunk::samples.
+    ///
     /// \param channelCount Number of channels of the stream
     /// \param sampleRate   Sample rate, in samples per second
     /// \param channelMap   Map of position in sample frame to sound channel
+    /// \param sampleFormat Format of the samples provided by onGetData
     ///
     ////////////////////////////////////////////////////////////
-    void initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap);
+    void initialize(unsigned int                     channelCount,
+                    unsigned int                     sampleRate,
+                    const std::vector<SoundChannel>& channelMap,
+                    SampleFormat                     sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
@@ -243,6 +318,10 @@ protected:
     /// the returned array of samples is not empty; this would stop the stream
     /// due to an internal limitation.
     ///
+    /// The samples are read in place, without being copied: they
+    /// must remain valid and unchanged until the next call to
+    /// onGetData or onSeek.
+    ///
     /// \param data Chunk of data to fill
     ///
     /// \return True to continue playback, false to stop
@@ -273,6 +352,20 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual std::optional<std::uint64_t> onLoop();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Continue the stream once its source is exhausted
+    ///
+    /// This function is called instead of onLoop when looping is
+    /// disabled. It can be overridden by derived classes to
+    /// chain another source, such as the next track of a
+    /// playlist, without any gap. Otherwise, it returns
+    /// std::nullopt and the stream stops.
+    ///
+    /// \return The playing position to continue from (or std::nullopt to stop)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual std::optional<std::uint64_t> onEnd();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Get the sound object
@@ -319,8 +412,13 @@ private:
 ///
 /// It is important to note that each SoundStream is played in its
 /// own separate thread, so that the streaming loop doesn't block the
-/// rest of the program. In particular, the OnGetData and OnSeek
-/// virtual functions may sometimes be called from this separate thread.
+/// rest of the program. In particular, the OnGetData, OnSeek and
+/// OnLoop virtual functions are usually called from this separate thread,
+/// which is either the audio device thread or, when a decode-ahead
+/// buffer is set with setDecodeAheadDuration, a decoding thread.
+/// They are never called concurrently: seeks requested with
+/// setPlayingOffset are applied by that thread before it asks for
+/// more data, so the stream source itself needs no synchronization.
 /// It is important to keep this in mind, because you may have to take
 /// care of synchronization issues if you share data between threads.
 ///
@@ -28,33 +28,65 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include <SFML/Graphics/AnimatedImage.hpp>
 #include <SFML/Graphics/BlendMode.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/CommandList.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
+#include <SFML/Graphics/DepthMode.hpp>
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/DynamicResolution.hpp>
+#include <SFML/Graphics/ExecutionPolicy.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/FrameCapture.hpp>
+#include <SFML/Graphics/GlDiagnostics.hpp>
 #include <SFML/Graphics/Glyph.hpp>
+#include <SFML/Graphics/GlyphAtlas.hpp>
+#include <SFML/Graphics/GpuMemory.hpp>
+#include <SFML/Graphics/GpuProfiler.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageSaveOptions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/LineBatch.hpp>
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/PolygonShape.hpp>
+#include <SFML/Graphics/PostProcessChain.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/ResourceLoader.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/SpatialGrid.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/StreamingTexture.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/TextLayoutCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
+#include <SFML/Graphics/TextureStreamer.hpp>
+#include <SFML/Graphics/TileMap.hpp>
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/TransformHierarchy.hpp>
+#include <SFML/Graphics/TransformPool.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 #include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/VirtualTexture.hpp>
 
 #include <SFML/Window.hpp>
 
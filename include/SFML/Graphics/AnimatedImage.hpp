@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <filesystem>
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class InputStream;
+class TextureArray;
+
+////////////////////////////////////////////////////////////
+/// \brief Animated image decoded frame by frame into a texture array
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API AnimatedImage
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Construct an empty animated image, with no frames.
+    ///
+    ////////////////////////////////////////////////////////////
+    AnimatedImage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AnimatedImage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AnimatedImage(const AnimatedImage&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AnimatedImage& operator=(const AnimatedImage&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open an animated image from a file
+    ///
+    /// The supported format is gif. Only the information about
+    /// the frames is read here, the frames are decoded as they
+    /// are displayed. The frame 0 is made current.
+    ///
+    /// \param filename Path of the image file to open
+    ///
+    /// \return True if opening succeeded, false if it failed
+    ///
+    /// \see openFromMemory, openFromStream
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open an animated image from a file in memory
+    ///
+    /// \warning Since the frames are not decoded at once, the
+    /// \a data buffer must remain accessible until the animated
+    /// image opens another file or is destroyed.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to load, in bytes
+    ///
+    /// \return True if opening succeeded, false if it failed
+    ///
+    /// \see openFromFile, openFromStream
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromMemory(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open an animated image from a custom stream
+    ///
+    /// The contents of the stream are copied in memory.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return True if opening succeeded, false if it failed
+    ///
+    /// \see openFromFile, openFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromStream(InputStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the frames
+    ///
+    /// \return Size in pixels, or (0, 0) if no image is open
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames of the animation
+    ///
+    /// \return Number of frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time a frame is displayed
+    ///
+    /// Delays shorter than 20 milliseconds are replaced by 100
+    /// milliseconds, which is what web browsers do.
+    ///
+    /// \param frame Index of the frame, in [0, getFrameCount())
+    ///
+    /// \return Delay of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getFrameDelay(std::size_t frame) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of a whole loop of the animation
+    ///
+    /// \return Sum of the delays of all frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getDuration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frame displayed at a given time
+    ///
+    /// The animation loops: times greater than the duration
+    /// wrap around.
+    ///
+    /// \param time Time elapsed since the animation started
+    ///
+    /// \return Index of the frame displayed at \a time
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFrameAt(Time time) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of frames kept in video memory
+    ///
+    /// Each cached frame takes a layer of the texture array,
+    /// so the memory used by the animation doesn't depend on
+    /// its length. The capacity is limited by the number of
+    /// frames and by sf::TextureArray::getMaximumLayerCount.
+    /// Changing it empties the cache. The default is 8.
+    ///
+    /// \param frameCount Maximum number of frames in the cache, at least 1
+    ///
+    /// \see getCacheCapacity
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCacheCapacity(std::size_t frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames kept in video memory
+    ///
+    /// \return Maximum number of frames in the cache
+    ///
+    /// \see setCacheCapacity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCacheCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of frames decoded ahead on a background thread
+    ///
+    /// After a frame is made current, the following ones are
+    /// decoded in the background so that they are ready when
+    /// they are displayed. With 0, frames are only decoded on
+    /// demand, by setFrame, and no thread is started. The default
+    /// is 2.
+    ///
+    /// \param frameCount Number of frames to decode ahead
+    ///
+    /// \see getPrefetchCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPrefetchCount(std::size_t frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames decoded ahead on a background thread
+    ///
+    /// \return Number of frames decoded ahead
+    ///
+    /// \see setPrefetchCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPrefetchCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// The smooth filter is disabled by default.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make a frame current
+    ///
+    /// The frame is uploaded to a layer of the texture array if
+    /// it isn't there yet, replacing the least recently used
+    /// frame; if the background thread hasn't decoded it, it
+    /// is decoded right away. Frames decoded in the background
+    /// are also uploaded by this function.
+    ///
+    /// \param frame Index of the frame, in [0, getFrameCount())
+    ///
+    /// \return True if the frame is in the texture array, false if it couldn't be decoded
+    ///
+    /// \see getFrame, getLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setFrame(std::size_t frame);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current frame
+    ///
+    /// \return Index of the current frame
+    ///
+    /// \see setFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFrame() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture array holding the cached frames
+    ///
+    /// \return Texture array, or a null pointer if no image is open
+    ///
+    /// \see getLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const TextureArray* getTextureArray() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the texture array holding the current frame
+    ///
+    /// \return Index of the layer
+    ///
+    /// \see getTextureArray, setFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLayer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames currently in video memory
+    ///
+    /// \return Number of cached frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCachedFrameCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AnimatedImage
+/// \ingroup graphics
+///
+/// sf::AnimatedImage plays animated gif files, such as
+/// stickers or emotes, without decoding all their frames into
+/// separate textures. The file stays encoded in memory and
+/// its frames are decoded as they are needed, into a
+/// sf::TextureArray holding a bounded number of them: the
+/// memory it uses doesn't grow with the length of the
+/// animation, and drawing any frame only needs one texture.
+///
+/// Frames are decoded sequentially, since each one is drawn
+/// on top of the previous ones. A background thread decodes
+/// the frames following the current one (see
+/// setPrefetchCount), and setFrame uploads them; frames which
+/// aren't ready yet are decoded on the spot.
+///
+/// The current frame is the layer getLayer of the array
+/// returned by getTextureArray, which can be drawn with
+/// sf::SpriteBatch or any shader sampling a texture array.
+///
+/// Usage example:
+/// \code
+/// sf::AnimatedImage emote;
+/// if (!emote.openFromFile("emote.gif"))
+///     return -1;
+///
+/// sf::Clock clock;
+/// sf::SpriteBatch batch;
+/// ...
+/// if (emote.setFrame(emote.getFrameAt(clock.getElapsedTime())))
+/// {
+///     batch.clear();
+///     batch.add(*emote.getTextureArray(), emote.getLayer());
+///     window.draw(batch);
+/// }
+/// \endcode
+///
+/// \see sf::TextureArray, sf::SpriteBatch, sf::Image
+///
+////////////////////////////////////////////////////////////
@@ -152,12 +152,13 @@ SFML_GRAPHICS_API bool operator!=(const BlendMode& left, const BlendMode& right)
 // Commonly used blending modes
 ////////////////////////////////////////////////////////////
 // NOLINTBEGIN(readability-identifier-naming)
-SFML_GRAPHICS_API extern const BlendMode BlendAlpha;    //!< Blend source and dest according to dest alpha
-SFML_GRAPHICS_API extern const BlendMode BlendAdd;      //!< Add source to dest
-SFML_GRAPHICS_API extern const BlendMode BlendMultiply; //!< Multiply source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendMin;      //!< Take minimum between source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendMax;      //!< Take maximum between source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendNone;     //!< Overwrite dest with source
+SFML_GRAPHICS_API extern const BlendMode BlendAlpha;              //!< Blend source and dest according to dest alpha
+SFML_GRAPHICS_API extern const BlendMode BlendPremultipliedAlpha; //!< Blend a source with premultiplied alpha
+SFML_GRAPHICS_API extern const BlendMode BlendAdd;                //!< Add source to dest
+SFML_GRAPHICS_API extern const BlendMode BlendMultiply;           //!< Multiply source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendMin;                //!< Take minimum between source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendMax;                //!< Take maximum between source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendNone;               //!< Overwrite dest with source
 // NOLINTEND(readability-identifier-naming)
 
 } // namespace sf
@@ -211,6 +212,15 @@ SFML_GRAPHICS_API extern const BlendMode BlendNone;     //!< Overwrite dest with
 /// sf::BlendMode noBlending             = sf::BlendNone;
 /// \endcode
 ///
+/// sf::BlendAlpha expects the color of the source to be straight,
+/// and produces premultiplied colors in the destination: what is
+/// drawn into a transparent sf::RenderTexture ends up premultiplied.
+/// sf::BlendPremultipliedAlpha expects a premultiplied source, such
+/// as a texture marked with sf::Texture::setPremultipliedAlpha, and
+/// composites it with a single draw. sf::Sprite and sf::Text switch
+/// between both modes according to their texture, so either can be
+/// used for a whole scene.
+///
 /// In SFML, a blend mode can be specified every time you draw a sf::Drawable
 /// object to a render target. It is part of the sf::RenderStates compound
 /// that is passed to the member function sf::RenderTarget::draw().
@@ -33,6 +33,9 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <memory>
+#include <vector>
+
 #include <cstddef>
 
 
@@ -109,6 +112,14 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f getPoint(std::size_t index) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the circle
+    ///
+    /// \param points Array receiving the getPointCount() points, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void getPoints(Vector2f* points) const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the geometric center of the circle
     ///
@@ -125,8 +136,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     //!< Radius of the circle
-    std::size_t m_pointCount; //!< Number of points composing the circle
+    float                                        m_radius;     //!< Radius of the circle
+    std::size_t                                  m_pointCount; //!< Number of points composing the circle
+    std::shared_ptr<const std::vector<Vector2f>> m_unitCircle; //!< Points of the unit circle with the same point count
 };
 
 } // namespace sf
@@ -0,0 +1,455 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target recording draws to replay them later
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CommandList : public RenderTarget
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty command list
+    ///
+    /// The size is the one of the target the list is meant
+    /// to be replayed onto. It defines the default view and
+    /// the mapping between pixels and coordinates while
+    /// recording.
+    ///
+    /// \param size Size of the target the list will be replayed onto, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit CommandList(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the target the list is recorded for
+    ///
+    /// \return Size of the target, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate or deactivate the command list
+    ///
+    /// A command list has no OpenGL context, so it can
+    /// never be activated.
+    ///
+    /// \param active True to activate, false to deactivate
+    ///
+    /// \return False when activation is requested, true otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setActive(bool active = true) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replay the recorded commands onto a render target
+    ///
+    /// The clears, views and draws are submitted to \a target
+    /// in the order they were recorded. Draws recorded before
+    /// the first call to setView use the current view of the
+    /// target, and the view of the target is restored once
+    /// all the commands have been replayed.
+    ///
+    /// Draws still pending in the batch of the list are
+    /// recorded first. This function must be called from the
+    /// thread where \a target can be drawn to. The recorded
+    /// commands are kept and can be replayed any number of times.
+    ///
+    /// \param target Render target to replay the commands onto
+    ///
+    ////////////////////////////////////////////////////////////
+    void replay(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the recorded commands
+    ///
+    /// The storage is kept so that recording the next frame
+    /// doesn't have to allocate it again.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of recorded commands
+    ///
+    /// \return Number of clears, views and draws recorded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCommandCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable sorting of the draws when replaying
+    ///
+    /// When sorting is enabled, replay() reorders the recorded
+    /// draws by layer first, then by shader, texture and blend
+    /// mode, so that draws sharing the same states are submitted
+    /// one after the other. Combined with batching on the target
+    /// the list is replayed onto, this lets them be merged into
+    /// fewer draw calls. Draws which only differ by their depth
+    /// (see sf::DepthMode) are then sorted front to back.
+    ///
+    /// Draws are only reordered within their layer and between
+    /// two clears or view changes, and draws sharing all their
+    /// states keep their order. Draws using a stencil mode are
+    /// never reordered, since stencil tests depend on what was
+    /// drawn before them. The draws of a layer that overlap each
+    /// other must be put in separate layers if their order matters,
+    /// unless they are opaque and resolved by depth testing.
+    ///
+    /// Sorting is disabled by default.
+    ///
+    /// \param enabled True to sort the draws, false to replay them in submission order
+    ///
+    /// \see isSortingEnabled, setLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSortingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the draws are sorted when replaying
+    ///
+    /// \return True if sorting is enabled, false otherwise
+    ///
+    /// \see setSortingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSortingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layer of the draws recorded from now on
+    ///
+    /// When sorting is enabled, draws of lower layers are
+    /// replayed before draws of higher layers. Layers have no
+    /// effect when sorting is disabled.
+    ///
+    /// The default layer is 0.
+    ///
+    /// \param layer Layer of the next recorded draws
+    ///
+    /// \see getLayer, setSortingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayer(int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the draws recorded from now on
+    ///
+    /// \return Current layer
+    ///
+    /// \see setLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getLayer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the recorded commands to a file
+    ///
+    /// The capture contains the clears, views and draws of the
+    /// list, with the vertices and all the render states. The
+    /// contents of textures, shaders, vertex buffers and index
+    /// buffers are not saved: they are only identified, along
+    /// with their size and settings, so that the same sequence
+    /// of state changes can be reproduced by loadFromFile.
+    ///
+    /// Draws still pending in the batch of the list are
+    /// recorded first.
+    ///
+    /// \param filename Path of the file to save
+    ///
+    /// \return True if saving was successful
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveToFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load commands saved with saveToFile
+    ///
+    /// The list owns placeholders for the resources referenced
+    /// by the capture: white textures of the original size and
+    /// settings, buffers of the original size, and one shader
+    /// writing the vertex color per original shader (no shader
+    /// if shaders aren't available). Replaying the list thus
+    /// submits the same draws and state changes as the original
+    /// application, although the rendered image differs.
+    ///
+    /// Creating the placeholders requires an OpenGL context
+    /// when the capture references textures or buffers.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return Command list if loading was successful, otherwise `std::nullopt`
+    ///
+    /// \see saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<CommandList> loadFromFile(const std::filesystem::path& filename);
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Refuse to activate the command list for drawing
+    ///
+    /// \return Always false
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool activateForDrawing() override;
+
+private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a clear of the color, stencil and/or depth buffer
+    ///
+    /// \param color        Clear color, if the color buffer is cleared
+    /// \param stencilValue Clear value, if the stencil buffer is cleared
+    /// \param depth        Clear depth, if the depth buffer is cleared
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordClear(const std::optional<Color>&        color,
+                     const std::optional<StencilValue>& stencilValue,
+                     const std::optional<float>&        depth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a view change
+    ///
+    /// \param view New view
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordView(const View& view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw of primitives defined by an array of vertices
+    ///
+    /// The vertices are copied into the list.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordVertices(const Vertex*       vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw of a vertex buffer, optionally through an index buffer
+    ///
+    /// The buffers are referenced, they must outlive the
+    /// last replay of the list.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, or null for non-indexed drawing
+    /// \param first        Index of the first vertex (or index) to render
+    /// \param count        Number of vertices (or indices) to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordBuffers(const VertexBuffer& vertexBuffer,
+                       const IndexBuffer*  indexBuffer,
+                       std::size_t         first,
+                       std::size_t         count,
+                       const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded clear
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ClearCommand
+    {
+        std::optional<Color>        color;        //!< Clear color, if the color buffer is cleared
+        std::optional<StencilValue> stencilValue; //!< Clear value, if the stencil buffer is cleared
+        std::optional<float>        depth;        //!< Clear depth, if the depth buffer is cleared
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded view change
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ViewCommand
+    {
+        View view; //!< New view
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw of vertices stored in the list
+    ///
+    ////////////////////////////////////////////////////////////
+    struct VerticesCommand
+    {
+        std::size_t   firstVertex{}; //!< Index of the first vertex in the vertex storage
+        std::size_t   vertexCount{}; //!< Number of vertices to draw
+        PrimitiveType type{};        //!< Type of primitives to draw
+        RenderStates  states;        //!< Render states to use for drawing
+        int           layer{};       //!< Layer the draw was recorded in
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw of a vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BuffersCommand
+    {
+        const VertexBuffer* vertexBuffer{}; //!< Vertex buffer to draw
+        const IndexBuffer*  indexBuffer{};  //!< Index buffer to draw through, if any
+        std::size_t         first{};        //!< Index of the first vertex (or index) to render
+        std::size_t         count{};        //!< Number of vertices (or indices) to render
+        RenderStates        states;         //!< Render states to use for drawing
+        int                 layer{};        //!< Layer the draw was recorded in
+    };
+
+    using Command = std::variant<ClearCommand, ViewCommand, VerticesCommand, BuffersCommand>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort the draws of the replay order by states
+    ///
+    ////////////////////////////////////////////////////////////
+    void sortDraws();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u                 m_size;             //!< Size of the target the list is recorded for
+    std::vector<Command>     m_commands;         //!< Recorded commands, in submission order
+    std::vector<Vertex>      m_vertices;         //!< Storage of the vertices of all the recorded draws
+    std::vector<std::size_t> m_order;            //!< Indices of the commands in replay order
+    int                      m_layer{};          //!< Layer of the next recorded draws
+    bool                     m_sortingEnabled{}; //!< Are the draws sorted when replaying?
+
+    std::vector<std::unique_ptr<Texture>>      m_placeholderTextures;      //!< Textures owned by a loaded list
+    std::vector<std::unique_ptr<Shader>>       m_placeholderShaders;       //!< Shaders owned by a loaded list
+    std::vector<std::unique_ptr<VertexBuffer>> m_placeholderVertexBuffers; //!< Vertex buffers owned by a loaded list
+    std::vector<std::unique_ptr<IndexBuffer>>  m_placeholderIndexBuffers;  //!< Index buffers owned by a loaded list
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CommandList
+/// \ingroup graphics
+///
+/// Drawing to a sf::RenderWindow or sf::RenderTexture has
+/// to happen on the thread where their OpenGL context can
+/// be activated. sf::CommandList is a render target without
+/// any context: clearing it, setting its view and drawing to
+/// it only records what is requested, so it can be done
+/// from any thread. The owning thread then replays the
+/// recorded commands onto the real target with a single
+/// call to replay().
+///
+/// This makes it possible to traverse a scene in parallel,
+/// with one command list per worker thread, while all the
+/// OpenGL work stays on the rendering thread. A single
+/// command list must not be used by several threads at the
+/// same time.
+///
+/// Vertices drawn to a command list are copied, with their
+/// render states. Textures, shaders, vertex buffers and
+/// index buffers are only referenced and must live until the
+/// list has been replayed for the last time. Drawables that
+/// lazily create their resources, like sf::Text loading new
+/// glyphs, still do it while being recorded. Batching can be
+/// enabled on the command list to merge the recorded draws
+/// before they are replayed.
+///
+/// A command list can also act as a render queue: with
+/// setSortingEnabled, the draws are grouped by shader,
+/// texture and blend mode when they are replayed, layers
+/// set with setLayer keeping the order between groups of
+/// draws that must not be mixed.
+///
+/// Finally, a command list can capture the draws of an
+/// application to reproduce its rendering workload elsewhere:
+/// record a frame into a list, replay it onto the window and
+/// save it with saveToFile. The capture can be loaded back
+/// with loadFromFile, and the sfml-replay benchmark tool
+/// times the replay of captures onto an offscreen target.
+///
+/// The functions which directly deal with OpenGL states,
+/// like pushGLStates or pushDebugGroup, have no effect on a
+/// command list.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::CommandList> lists;
+/// for (std::size_t i = 0; i < workerCount; ++i)
+///     lists.emplace_back(window.getSize());
+///
+/// // Record on the worker threads
+/// parallelFor(workerCount, [&](std::size_t worker)
+/// {
+///     lists[worker].reset();
+///     lists[worker].setView(camera);
+///
+///     for (const auto& entity : scene.getPart(worker))
+///         lists[worker].draw(entity);
+/// });
+///
+/// // Replay on the rendering thread
+/// window.clear();
+/// for (auto& list : lists)
+///     list.replay(window);
+/// window.display();
+/// \endcode
+///
+/// \see sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -113,6 +113,14 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f getPoint(std::size_t index) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the polygon
+    ///
+    /// \param points Array receiving the getPointCount() points, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void getPoints(Vector2f* points) const override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////
+/// \brief Enumeration of the depth test comparisons that can be performed
+///
+/// The comparisons are mapped directly to their OpenGL equivalents,
+/// specified by glDepthFunc().
+////////////////////////////////////////////////////////
+enum class DepthComparison
+{
+    Never,        //!< The depth test never passes
+    Less,         //!< The depth test passes if the new depth is less than the depth in the depth buffer
+    LessEqual,    //!< The depth test passes if the new depth is less than or equal to the depth in the depth buffer
+    Greater,      //!< The depth test passes if the new depth is greater than the depth in the depth buffer
+    GreaterEqual, //!< The depth test passes if the new depth is greater than or equal to the depth in the depth buffer
+    Equal,        //!< The depth test passes if the new depth is strictly equal to the depth in the depth buffer
+    NotEqual,     //!< The depth test passes if the new depth is strictly inequal to the depth in the depth buffer
+    Always        //!< The depth test always passes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Depth modes for drawing
+///
+////////////////////////////////////////////////////////////
+struct SFML_GRAPHICS_API DepthMode
+{
+    DepthComparison depthComparison{DepthComparison::Always}; //!< The comparison we're performing the depth test with
+    bool            depthWrite{}; //!< Whether the depth of the drawn pixels is written to the depth buffer
+    float           depth{};      //!< Depth of the drawn vertices, from -1 (near) to 1 (far)
+};
+
+////////////////////////////////////////////////////////////
+/// \relates DepthMode
+/// \brief Overload of the == operator
+///
+/// \param left  Left operand
+/// \param right Right operand
+///
+/// \return True if depth modes are equal, false if they are different
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API bool operator==(const DepthMode& left, const DepthMode& right);
+
+////////////////////////////////////////////////////////////
+/// \relates DepthMode
+/// \brief Overload of the != operator
+///
+/// \param left  Left operand
+/// \param right Right operand
+///
+/// \return True if depth modes are different, false if they are equal
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API bool operator!=(const DepthMode& left, const DepthMode& right);
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DepthMode
+/// \ingroup graphics
+///
+/// sf::DepthMode controls depth testing, which lets the GPU
+/// decide which of the pixels drawn at the same place is
+/// visible instead of relying on the order of the draws.
+///
+/// Every pixel drawn gets the depth of its draw (\ref depth),
+/// which ranges from -1 to 1. The depth test
+/// compares the depth of each new pixel with the one stored
+/// in the depth buffer (\ref depthComparison): the pixel is
+/// only drawn if the comparison passes, and if \ref depthWrite
+/// is set its depth replaces the stored one.
+///
+/// The depth buffer must be requested when creating the
+/// render target, with the depthBits member of the
+/// sf::ContextSettings, and reset at the beginning of each
+/// frame with sf::RenderTarget::clearDepth. The default mode
+/// disables depth testing altogether, so draws are layered
+/// in submission order like without a depth buffer.
+///
+/// Depth testing makes the order of opaque draws irrelevant:
+/// they can be grouped by texture, which lets them be batched,
+/// and drawn front to back so that the GPU skips the hidden
+/// pixels before shading them. Translucent draws still have
+/// to be drawn back to front, after the opaque ones, testing
+/// the depth without writing it.
+///
+/// Usage example:
+/// \code
+/// auto target = sf::RenderTexture::create({1280, 720}, sf::ContextSettings{24 /* depthBits */}).value();
+///
+/// sf::RenderStates opaque;
+/// opaque.depthMode = sf::DepthMode{sf::DepthComparison::Less, true, 0.f};
+///
+/// target.clear();
+/// target.clearDepth();
+///
+/// // Opaque tiles in any order, the nearest ones hide the others
+/// for (const Tile& tile : tiles)
+/// {
+///     opaque.depthMode.depth = tile.depth;
+///     target.draw(tile.sprite, opaque);
+/// }
+/// \endcode
+///
+/// \see sf::RenderStates, sf::RenderTarget, sf::StencilMode
+///
+////////////////////////////////////////////////////////////
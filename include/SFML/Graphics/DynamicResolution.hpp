@@ -0,0 +1,282 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/GpuProfiler.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+
+
+namespace sf
+{
+class RenderTarget;
+class RenderTexture;
+class RenderWindow;
+
+////////////////////////////////////////////////////////////
+/// \brief Render a scene at a variable fraction of the size of a window
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API DynamicResolution
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the dynamic resolution of a window
+    ///
+    /// The window must outlive this object.
+    ///
+    /// \param window Window the scene is displayed in
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit DynamicResolution(RenderWindow& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DynamicResolution(const DynamicResolution&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Begin the rendering of the scene
+    ///
+    /// The returned target has the current view of the window,
+    /// and its contents are undefined: clear it before drawing
+    /// to it. When the scale is 1, the window itself is returned
+    /// and nothing has to be upscaled.
+    ///
+    /// \return Target to render the scene to, valid until endFrame
+    ///
+    /// \see endFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTarget& beginFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the rendering of the scene
+    ///
+    /// The scene is upscaled to the whole window, which can then
+    /// be drawn on at its native resolution (for example for the
+    /// interface) before being displayed. If adaptive scaling is
+    /// enabled, the scale of the next frames is adjusted from the
+    /// GPU time of the frames.
+    ///
+    /// \see beginFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale of the scene
+    ///
+    /// The scale is clamped to the scale range.
+    ///
+    /// \param scale Size of the scene relative to the size of the window
+    ///
+    /// \see getScale, setScaleRange
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(float scale);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale of the scene
+    ///
+    /// \return Size of the scene relative to the size of the window
+    ///
+    /// \see setScale
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getScale() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the range of scales used by adaptive scaling
+    ///
+    /// The default range is [0.5, 1].
+    ///
+    /// \param minimum Smallest scale, greater than 0
+    /// \param maximum Largest scale, at most 1
+    ///
+    /// \see setAdaptiveScalingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScaleRange(float minimum, float maximum);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the GPU time that adaptive scaling aims for
+    ///
+    /// The default is the duration of a frame at 60 Hz.
+    ///
+    /// \param time GPU time of a frame to stay under
+    ///
+    /// \see setAdaptiveScalingEnabled, getLastGpuTime
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTargetGpuTime(Time time);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable adaptive scaling
+    ///
+    /// When enabled, the scale is lowered when the GPU takes
+    /// longer than the target time to render the frames, and
+    /// raised again when there is enough headroom. Adaptive
+    /// scaling requires GPU timer queries (see
+    /// sf::GpuProfiler::isAvailable), and is enabled by default
+    /// when they are supported.
+    ///
+    /// \param enabled True to enable adaptive scaling, false to keep the scale fixed
+    ///
+    /// \see isAdaptiveScalingEnabled, setTargetGpuTime
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAdaptiveScalingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether adaptive scaling is enabled
+    ///
+    /// \return True if adaptive scaling is enabled, false otherwise
+    ///
+    /// \see setAdaptiveScalingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAdaptiveScalingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the strength of the sharpening applied when upscaling
+    ///
+    /// Sharpening restores the details blurred by the bilinear
+    /// filtering of the upscale. It requires shaders. The default
+    /// sharpness is 0.5.
+    ///
+    /// \param sharpness Strength of the sharpening, between 0 and 1
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSharpness(float sharpness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the last measured GPU time of a frame
+    ///
+    /// The GPU time is measured asynchronously, so it lags a few
+    /// frames behind.
+    ///
+    /// \return GPU time between beginFrame and endFrame, or zero if it is unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getLastGpuTime() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the scene to the whole window
+    ///
+    ////////////////////////////////////////////////////////////
+    void upscale();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adjust the scale from the last GPU time
+    ///
+    ////////////////////////////////////////////////////////////
+    void adaptScale();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    RenderWindow&         m_window;                             //!< Window the scene is displayed in
+    GpuProfiler           m_profiler;                           //!< Profiler measuring the GPU time of the frames
+    RenderTexturePool     m_pool;                               //!< Render textures of the scaled scene
+    std::optional<Shader> m_upscaleShader;                      //!< Shader sharpening the upscaled scene
+    RenderTexture*        m_scene{};                            //!< Render texture of the current frame, if scaled
+    float                 m_scale{1.f};                         //!< Size of the scene relative to the window
+    float                 m_minScale{0.5f};                     //!< Smallest scale used by adaptive scaling
+    float                 m_maxScale{1.f};                      //!< Largest scale used by adaptive scaling
+    float                 m_sharpness{0.5f};                    //!< Strength of the sharpening
+    Time                  m_targetGpuTime{microseconds(16667)}; //!< GPU time that adaptive scaling aims for
+    Time                  m_lastGpuTime;                        //!< Last measured GPU time of a frame
+    unsigned int          m_framesSinceChange{};                //!< Number of frames rendered since the scale changed
+    bool                  m_adaptive{};                         //!< Is adaptive scaling enabled?
+    bool                  m_inFrame{};                          //!< Is a frame being rendered?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DynamicResolution
+/// \ingroup graphics
+///
+/// sf::DynamicResolution keeps the frame rate of GPU-bound
+/// applications stable by rendering the scene into an internal
+/// render texture smaller than the window, and upscaling it
+/// to the window at the end of the frame. The scale is adapted
+/// automatically from the GPU time of the frames, measured
+/// with a sf::GpuProfiler, so that it stays under a target.
+///
+/// The upscale uses bilinear filtering followed by a contrast
+/// adaptive sharpening, which preserves the edges better than
+/// plain filtering.
+///
+/// The scene target receives the current view of the window at
+/// the beginning of each frame. Since views are expressed
+/// relatively to the size of their target, the mapping
+/// functions of the window, such as
+/// sf::RenderTarget::mapPixelToCoords, keep giving the correct
+/// coordinates whatever the scale.
+///
+/// Usage example:
+/// \code
+/// sf::RenderWindow      window(sf::VideoMode({1920, 1080}), "SFML window");
+/// sf::DynamicResolution resolution(window);
+///
+/// while (window.isOpen())
+/// {
+///     // Render the expensive scene at a lower resolution if needed
+///     sf::RenderTarget& scene = resolution.beginFrame();
+///     scene.clear();
+///     scene.draw(world);
+///     resolution.endFrame();
+///
+///     // Draw the interface at the native resolution
+///     window.draw(hud);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::GpuProfiler, sf::RenderTexturePool
+///
+////////////////////////////////////////////////////////////
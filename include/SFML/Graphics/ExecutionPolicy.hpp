@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/ThreadPool.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief How bulk operations spread their work
+///
+////////////////////////////////////////////////////////////
+enum class ExecutionPolicy
+{
+    Sequential, //!< Do all the work on the calling thread
+    Parallel    //!< Split large amounts of work in ranges processed concurrently
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \enum sf::ExecutionPolicy
+/// \ingroup graphics
+///
+/// Some operations processing a lot of data, like the pixel
+/// operations of sf::Image or the vertex generation of
+/// sf::SpriteBatch and sf::VertexArray, can spread their work
+/// across several threads. They do so only when asked to with
+/// ExecutionPolicy::Parallel, and only when there is enough
+/// work for the gain to outweigh the cost of synchronization.
+///
+/// The results are identical with both policies.
+///
+/// Usage example:
+/// \code
+/// // The work is spread over sf::ThreadPool::getGlobal(), unless a job scheduler is set
+/// image.flipVertically(sf::ExecutionPolicy::Parallel);
+/// \endcode
+///
+/// \see sf::setJobScheduler, sf::ThreadPool
+///
+////////////////////////////////////////////////////////////
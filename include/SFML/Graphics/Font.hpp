@@ -29,16 +29,21 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 
+#include <SFML/Graphics/GlyphAtlas.hpp>
 #include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/TextLayoutCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <SFML/System/Allocator.hpp>
+#include <SFML/System/MemoryStats.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -56,6 +61,8 @@ class ResourceStream;
 namespace sf
 {
 class InputStream;
+class RenderTarget;
+class Shader;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -82,9 +89,13 @@ public:
     /// fonts installed on the user's system, thus you can't
     /// load them directly.
     ///
+    /// The file is mapped in memory rather than read, so that
+    /// the glyphs are rasterized straight from the operating
+    /// system's file cache.
+    ///
     /// \warning SFML cannot preload all the font data in this
-    /// function, so the file has to remain accessible until
-    /// the sf::Font object loads a new font or is destroyed.
+    /// function, so the file must not be modified until the
+    /// sf::Font object loads a new font or is destroyed.
     ///
     /// \param filename Path of the font file to load
     ///
@@ -170,6 +181,35 @@ public:
     ////////////////////////////////////////////////////////////
     const Glyph& getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a set of glyphs ahead of time
+    ///
+    /// Glyphs are normally loaded the first time they are
+    /// requested, which can cause a noticeable hitch when a lot
+    /// of new characters are displayed at once (e.g. when
+    /// switching the language of a user interface).
+    ///
+    /// This function loads all the glyphs of \a characters that
+    /// are not loaded yet at once. They are rasterized in parallel
+    /// on worker threads when the font was loaded from a file or
+    /// from memory, and written to the texture with a single update.
+    /// Each worker thread rasterizes with its own clone of the
+    /// FreeType face, without any locking; the clones are kept
+    /// by the font and reused by the next calls.
+    ///
+    /// \param characters       Characters whose glyphs to load, duplicates are allowed
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold versions or the regular ones?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see getGlyph
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(std::u32string_view characters,
+                       unsigned int        characterSize,
+                       bool                bold             = false,
+                       float               outlineThickness = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -288,26 +328,141 @@ public:
     ////////////////////////////////////////////////////////////
     bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum size of the glyph textures
+    ///
+    /// The texture holding the glyphs of a character size starts
+    /// small and doubles whenever it is full. Once doubling it
+    /// would exceed \a size, the least recently used glyphs are
+    /// evicted from it instead, which keeps the memory used by a
+    /// font bounded when rendering large sets of characters.
+    ///
+    /// Glyph textures that are already larger are not shrunk.
+    ///
+    /// By default, the size is only limited by the maximum
+    /// texture size supported by the graphics driver. This
+    /// setting is ignored while the font uses a shared glyph
+    /// atlas, whose own maximum size applies instead.
+    ///
+    /// \param size Maximum width and height of a glyph texture, in pixels, or 0 for no limit
+    ///
+    /// \see getMaximumTextureSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaximumTextureSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum size of the glyph textures
+    ///
+    /// \return Maximum width and height of a glyph texture, in pixels, or 0 for no limit
+    ///
+    /// \see setMaximumTextureSize
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getMaximumTextureSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the glyphs of the font in a shared glyph atlas
+    ///
+    /// By default, the glyphs of every character size are stored
+    /// in a texture owned by the font. With a glyph atlas, the
+    /// glyphs of all the character sizes, and of all the fonts
+    /// using the same atlas, are stored in its single texture.
+    ///
+    /// Changing the atlas discards all the glyphs loaded so far.
+    ///
+    /// \param atlas Glyph atlas to use, or a null pointer to go back to textures owned by the font
+    ///
+    /// \see getGlyphAtlas
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shared glyph atlas storing the glyphs of the font
+    ///
+    /// \return Glyph atlas of the font, or a null pointer if the font owns its textures
+    ///
+    /// \see setGlyphAtlas
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::shared_ptr<GlyphAtlas>& getGlyphAtlas() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the signed distance field mode
+    ///
+    /// In this mode, glyphs are not rasterized as coverage masks
+    /// for every character size, but as signed distance fields
+    /// at a single reference size. The same texture then serves
+    /// all the character sizes: only the metrics of the glyphs
+    /// are scaled, and a shader reconstructs sharp edges at any
+    /// scale (see getDistanceFieldShader). This drastically
+    /// reduces the memory used by text displayed at many sizes,
+    /// at the cost of slightly rounder corners.
+    ///
+    /// sf::Text automatically renders distance field glyphs with
+    /// the built-in shader, unless a shader is given in the
+    /// render states. The shader also draws the outlines of the
+    /// text from the fill glyphs, by moving their edges outwards:
+    /// outlines of any thickness are then free, no glyph is
+    /// stroked or added to the texture for them. Such outlines
+    /// can be up to 7/64th of the character size thick.
+    ///
+    /// Changing the mode discards all the glyphs loaded so far.
+    /// The distance field mode is disabled by default.
+    ///
+    /// \param enabled True to enable the distance field mode, false to disable it
+    ///
+    /// \see isDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the signed distance field mode is enabled or not
+    ///
+    /// \return True if the distance field mode is enabled, false if it is disabled
+    ///
+    /// \see setDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isDistanceFieldEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader rendering distance field glyphs
+    ///
+    /// The shader reads the distance from the alpha channel
+    /// of the current texture and outputs the color of the
+    /// vertices, with an alpha computed from the distance to
+    /// the edge of the glyph. The shader is created the first
+    /// time it is requested.
+    ///
+    /// \return Pointer to the shader, or a null pointer if shaders are not available
+    ///
+    /// \see setDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getDistanceFieldShader() const;
+
 private:
+    friend class Text;
+    friend class TextLayoutCache;
+
     ////////////////////////////////////////////////////////////
-    /// \brief Structure defining a row of glyphs
+    /// \brief Structure defining a glyph stored in a page
     ///
     ////////////////////////////////////////////////////////////
-    struct Row
+    struct CachedGlyph
     {
-        Row(unsigned int rowTop, unsigned int rowHeight) : top(rowTop), height(rowHeight)
-        {
-        }
-
-        unsigned int width{}; //!< Current width of the row
-        unsigned int top;     //!< Y position of the row into the texture
-        unsigned int height;  //!< Height of the row
+        Glyph         glyph;     //!< The glyph itself
+        std::uint64_t lastUse{}; //!< Value of the page use counter when the glyph was last requested
     };
 
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    using GlyphTable   = priv::UnorderedMap<std::uint64_t, CachedGlyph, MemoryModule::Graphics>; //!< Codepoint to glyph
+    using KerningTable = priv::UnorderedMap<std::uint64_t, float, MemoryModule::Graphics>;       //!< Pair to kerning
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -315,13 +470,9 @@ private:
     ////////////////////////////////////////////////////////////
     struct Page
     {
-        [[nodiscard]] static std::optional<Page> make(bool smooth);
-        explicit Page(Texture&& texture);
-
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        GlyphTable                glyphs;     //!< Table mapping code points to their corresponding glyph
+        std::optional<GlyphAtlas> atlas;      //!< Texture of the glyphs, unless the font uses a shared atlas
+        std::uint64_t             useCount{}; //!< Number of glyph requests made to the page, to order glyphs by last use
     };
 
     ////////////////////////////////////////////////////////////
@@ -334,18 +485,115 @@ private:
     ////////////////////////////////////////////////////////////
     Page& loadPage(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the atlas storing the glyphs of a page
+    ///
+    /// \param page Page of glyphs
+    ///
+    /// \return The shared atlas of the font, or the own atlas of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    GlyphAtlas& getPageAtlas(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the glyphs loaded so far if the shared atlas was cleared
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGlyphAtlas() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph of the font from its index in the font
+    ///
+    /// \param glyphIndex       Index of the glyph in the font
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    ///
+    /// \return The glyph corresponding to \a glyphIndex and \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getGlyphFromIndex(std::uint32_t glyphIndex,
+                                   unsigned int  characterSize,
+                                   bool          bold,
+                                   float         outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the distance field shader, set up to draw outlines of a given thickness
+    ///
+    /// If the shader was set up for another thickness, \a target
+    /// is flushed first, so that the glyphs it batched are drawn
+    /// with the previous one.
+    ///
+    /// \param target           Render target the glyphs are drawn to
+    /// \param outlineThickness Thickness of the outline, 0 to draw the glyphs themselves
+    /// \param characterSize    Character size of the glyphs
+    ///
+    /// \return Pointer to the shader, or a null pointer if shaders are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getDistanceFieldShader(RenderTarget& target,
+                                         float         outlineThickness,
+                                         unsigned int  characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find or load a glyph in the page of a character size
+    ///
+    /// \param glyphIndex       Index of the glyph in the font
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    ///
+    /// \return The glyph corresponding to \a glyphIndex and \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getPageGlyph(std::uint32_t glyphIndex,
+                              unsigned int  characterSize,
+                              bool          bold,
+                              float         outlineThickness) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
     ///
-    /// \param codePoint        Unicode code point of the character to load
+    /// \param glyphIndex       Index of the glyph in the font
     /// \param characterSize    Reference character size
     /// \param bold             Retrieve the bold version or the regular one?
     /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
     ///
-    /// \return The glyph corresponding to \a codePoint and \a characterSize
+    /// \return The glyph corresponding to \a glyphIndex and \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph loadGlyph(std::uint32_t glyphIndex, unsigned int characterSize, bool bold, float outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the glyphs and positions of a run of characters
+    ///
+    /// With HarfBuzz, the run is shaped according to the rules
+    /// of its script. Otherwise, every character gets its own
+    /// glyph, spaced by its advance and the kerning.
+    ///
+    /// \param text          Characters of the run, without new lines
+    /// \param characterSize Reference character size
+    /// \param bold          Shape the bold version or the regular one?
+    /// \param glyphs        Filled with the shaped glyphs, in visual order
     ///
     ////////////////////////////////////////////////////////////
-    Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
+    void shape(std::u32string_view                       text,
+               unsigned int                              characterSize,
+               bool                                      bold,
+               std::vector<TextLayoutCache::ShapedGlyph>& glyphs) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the kerning offset of a pair of characters
+    ///
+    /// \param first         Unicode code point of the first character
+    /// \param second        Unicode code point of the second character
+    /// \param characterSize Reference character size
+    /// \param bold          Retrieve the bold version or the regular one?
+    ///
+    /// \return Kerning offset, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    float loadKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
@@ -353,10 +601,29 @@ private:
     /// \param page Page of glyphs to search in
     /// \param size Width and height of the rectangle
     ///
-    /// \return Found rectangle within the texture
+    /// \return Found rectangle within the texture, or an empty optional if the texture is full
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<IntRect> findGlyphRect(Page& page, const Vector2u& size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the least recently used glyphs of a page
+    ///
+    /// The most recently used glyphs are kept and repacked at the
+    /// start of the texture, up to half of its area. A shared
+    /// atlas is cleared instead, since it holds the glyphs of
+    /// other fonts too.
+    ///
+    /// \param page Page of glyphs to evict glyphs from
+    ///
+    ////////////////////////////////////////////////////////////
+    void evictGlyphs(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the memory used by the glyph tables to sf::MemoryStats
     ///
     ////////////////////////////////////////////////////////////
-    IntRect findGlyphRect(Page& page, const Vector2u& size) const;
+    void updateMemoryUsage() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
@@ -372,7 +639,8 @@ private:
     // Types
     ////////////////////////////////////////////////////////////
     struct FontHandles;
-    using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
+    struct DistanceFieldShader;
+    using PageTable = priv::UnorderedMap<unsigned int, Page, MemoryModule::Graphics>; //!< Page of each character size
 
     ////////////////////////////////////////////////////////////
     /// \brief Create a font from font handles and a family name
@@ -383,11 +651,21 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::shared_ptr<FontHandles> m_fontHandles;    //!< Shared information about the internal font instance
-    bool                         m_isSmooth{true}; //!< Status of the smooth filter
-    Info                         m_info;           //!< Information about the font
-    mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
+    std::shared_ptr<FontHandles> m_fontHandles;          //!< Shared information about the internal font instance
+    bool                         m_isSmooth{true};       //!< Status of the smooth filter
+    bool                         m_isDistanceField{};    //!< Status of the distance field mode
+    unsigned int                 m_maximumTextureSize{}; //!< Maximum size of the glyph textures, 0 for no limit
+    std::shared_ptr<GlyphAtlas>  m_glyphAtlas;           //!< Shared atlas storing the glyphs, if any
+    mutable std::uint64_t        m_atlasGeneration{};    //!< Generation of the shared atlas the glyphs were loaded in
+    Info                         m_info;                 //!< Information about the font
+    mutable PageTable            m_pages;                //!< Table containing the glyphs pages by character size
+    mutable std::unordered_map<unsigned int, GlyphTable> m_distanceFieldGlyphs; //!< Scaled glyphs by size
+    mutable std::unordered_map<std::uint64_t, KerningTable> m_kerningTables; //!< Kerning by character size and style
+    std::uint64_t m_id{}; //!< Unique identifier of the glyphs and metrics of the font, used by sf::TextLayoutCache
+    mutable std::shared_ptr<DistanceFieldShader> m_distanceFieldShader; //!< Shader rendering distance field glyphs
+    mutable bool m_distanceFieldShaderLoaded{}; //!< Was the creation of the shader attempted?
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    mutable priv::MemoryCounter<MemoryStats::Category::Font> m_memoryCounter; //!< Counts the font and its glyph tables
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
 #endif
@@ -0,0 +1,335 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous capture of the frames of a render target
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API FrameCapture : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function receiving the captured frames on the encoder thread
+    ///
+    /// The second argument is the index of the frame, counting
+    /// the captures made since the construction of the object.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Encoder = std::function<void(const Image&, std::uint64_t)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the capture with a given number of pixel buffers
+    ///
+    /// Each pending frame occupies one pixel buffer; frames are
+    /// dropped when all of them are still waiting for the GPU.
+    /// 3 buffers are enough to capture every frame when frames
+    /// are retrieved 2 frames after they were captured.
+    ///
+    /// \param bufferCount Number of pixel buffers, at least one is used
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit FrameCapture(std::size_t bufferCount = 3);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the pending frames and hands them to the
+    /// encoder, if any, before stopping the encoder thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FrameCapture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameCapture(const FrameCapture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the current contents of a render target
+    ///
+    /// The pixels are copied to a pixel buffer by the GPU while
+    /// the application goes on; this function doesn't wait for
+    /// the copy. Frames whose copy is complete are collected
+    /// first, so calling this function once per frame is enough
+    /// to keep the frames flowing.
+    ///
+    /// For a render window, call it after drawing and before
+    /// display(), since the contents of the back buffer are
+    /// undefined once it has been displayed.
+    /// Multisampled render textures can't be read directly;
+    /// use sf::Texture::copyToImageAsync on their texture.
+    ///
+    /// If pixel buffers are not supported, the pixels are copied
+    /// synchronously.
+    ///
+    /// \param target Render target to capture
+    ///
+    /// \return True if the capture was started, false if the frame was dropped
+    ///
+    /// \see retrieveFrame, getDroppedFrameCount
+    ///
+    ////////////////////////////////////////////////////////////
+    bool capture(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the oldest captured frame
+    ///
+    /// This function never blocks: it returns `std::nullopt` if
+    /// no frame has reached system memory yet. Frames handed to
+    /// an encoder are not returned by this function.
+    ///
+    /// \return Oldest frame which wasn't retrieved yet, or `std::nullopt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> retrieveFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function encoding the captured frames
+    ///
+    /// The encoder is called on a background thread, in the
+    /// order the frames were captured, so that slow encoders
+    /// don't delay the rendering. The frames which were already
+    /// given to the previous encoder are encoded before it is
+    /// replaced. Pass an empty function to retrieve the frames
+    /// with retrieveFrame again.
+    ///
+    /// \param encoder Function receiving the captured frames
+    ///
+    /// \see createImageSequenceEncoder, createRawEncoder
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEncoder(Encoder encoder);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the captured frames are available
+    ///
+    /// Waits for the GPU to complete the pending copies, then
+    /// for the encoder, if any, to process all the frames.
+    ///
+    ////////////////////////////////////////////////////////////
+    void finish();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames captured so far
+    ///
+    /// \return Number of successful calls to capture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getCapturedFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames dropped so far
+    ///
+    /// A frame is dropped when all the pixel buffers are still
+    /// waiting for the GPU.
+    ///
+    /// \return Number of calls to capture which returned false
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getDroppedFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an encoder saving each frame to its own image file
+    ///
+    /// Frame number N is saved to `directory/frame_N.extension`,
+    /// N being padded to 6 digits. QOI is much faster to encode
+    /// than PNG, which makes it the best choice for recording.
+    ///
+    /// \param directory Existing directory receiving the files
+    /// \param extension Extension of the files, determining their format
+    ///
+    /// \return Encoder saving the frames to files
+    ///
+    /// \see sf::Image::saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Encoder createImageSequenceEncoder(const std::filesystem::path& directory,
+                                                            const std::string&           extension = "qoi");
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an encoder writing the raw pixels of the frames to a stream
+    ///
+    /// The RGBA pixels of each frame are written one after the
+    /// other, top row first; this is what video encoders
+    /// reading raw frames from a pipe expect. The stream must
+    /// stay alive as long as the encoder is used.
+    ///
+    /// \param stream Stream receiving the pixels
+    ///
+    /// \return Encoder writing the frames to the stream
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Encoder createRawEncoder(std::ostream& stream);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixel buffer receiving a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        unsigned int  buffer{};   //!< OpenGL identifier of the pixel buffer
+        std::size_t   capacity{}; //!< Size of the storage of the pixel buffer, in bytes
+        void*         fence{};    //!< Fence signaled when the pixel buffer is filled, can be null
+        Vector2u      size;       //!< Size of the frame being copied
+        std::uint64_t index{};    //!< Index of the frame being copied
+        bool          pending{};  //!< Is the pixel buffer waiting for the GPU?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Collect the frames whose copy is complete
+    ///
+    /// \param wait True to wait for all the pending frames
+    ///
+    ////////////////////////////////////////////////////////////
+    void collect(bool wait);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Hand a frame to the encoder, or keep it for retrieveFrame
+    ///
+    /// \param frame Captured frame
+    /// \param index Index of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void deliver(Image&& frame, std::uint64_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the encoder thread has processed all the frames
+    ///
+    /// \param lock Lock owning m_mutex
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForEncoder(std::unique_lock<std::mutex>& lock);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Main function of the encoder thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Slot>                           m_slots;      //!< Ring of pixel buffers
+    std::size_t                                 m_next{};     //!< Slot receiving the next capture
+    std::size_t                                 m_oldest{};   //!< Slot holding the oldest pending capture
+    std::uint64_t                               m_captured{}; //!< Number of frames captured
+    std::uint64_t                               m_dropped{};  //!< Number of frames dropped
+    std::deque<Image>                           m_frames;     //!< Frames waiting to be retrieved
+    Encoder                                     m_encoder;    //!< Function encoding the frames
+    std::mutex                                  m_mutex;      //!< Mutex protecting the encoder and its queue
+    std::condition_variable                     m_condition;  //!< Condition signaled when the queue changes
+    std::deque<std::pair<Image, std::uint64_t>> m_queue;      //!< Frames waiting for the encoder
+    bool                                        m_encoding{}; //!< Is the encoder thread processing a frame?
+    bool                                        m_stopping{}; //!< Is the encoder thread asked to stop?
+    std::thread                                 m_thread;     //!< Encoder thread
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FrameCapture
+/// \ingroup graphics
+///
+/// Reading the pixels of a render target with
+/// sf::Texture::update and copyToImage stalls the CPU until
+/// the GPU has rendered the whole frame. sf::FrameCapture
+/// instead asks the GPU to copy the frame to one of a ring of
+/// pixel buffers and collects it a few frames later, when the
+/// copy is complete, so that capturing every frame doesn't
+/// slow the application down.
+///
+/// Captured frames are either retrieved with retrieveFrame, or
+/// handed to an encoder running on a background thread. Two
+/// encoders are provided: one saving each frame to an image
+/// file, and one writing the raw pixels to a stream, for
+/// example the pipe of an external video encoder.
+///
+/// Usage example:
+/// \code
+/// sf::RenderWindow window(sf::VideoMode({1280, 720}), "Recording");
+/// sf::FrameCapture capture;
+/// capture.setEncoder(sf::FrameCapture::createImageSequenceEncoder("recording"));
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     window.clear();
+///     window.draw(scene);
+///
+///     if (recording)
+///         capture.capture(window);
+///
+///     window.display();
+/// }
+///
+/// // Make sure every frame is saved
+/// capture.finish();
+/// \endcode
+///
+/// \see sf::TextureReadback, sf::Image
+///
+////////////////////////////////////////////////////////////
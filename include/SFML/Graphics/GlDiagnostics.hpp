@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Control how OpenGL errors are detected and reported
+///
+////////////////////////////////////////////////////////////
+namespace sf::GlDiagnostics
+{
+////////////////////////////////////////////////////////////
+/// \brief Ways of detecting OpenGL errors
+///
+////////////////////////////////////////////////////////////
+enum class Mode
+{
+    None,        //!< Don't look for errors, no overhead at all
+    CheckErrors, //!< Call glGetError after every OpenGL call made by SFML (slow)
+    DebugOutput  //!< Let the driver report errors with a KHR_debug callback (fast)
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Change the way OpenGL errors are detected
+///
+/// The default mode is Mode::CheckErrors in debug builds of
+/// SFML and Mode::None in release builds, but any mode can be
+/// used with any build.
+///
+/// Mode::CheckErrors takes effect immediately. Mode::DebugOutput
+/// is installed in the context active on the calling thread,
+/// if any, and in other contexts the next time a render target
+/// is activated in them. If an OpenGL context doesn't support
+/// KHR_debug, no error is reported for the calls made with it.
+///
+/// \param mode New mode
+///
+/// \see getMode
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void setMode(Mode mode);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the way OpenGL errors are detected
+///
+/// \return Current mode
+///
+/// \see setMode
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API Mode getMode();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of OpenGL errors reported so far
+///
+/// Both Mode::CheckErrors and Mode::DebugOutput count the
+/// errors they report to sf::err(). Debug output messages
+/// which are not errors, like performance warnings, are
+/// reported but not counted.
+///
+/// \return Number of errors since the start of the program
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API std::uint64_t getErrorCount();
+
+} // namespace sf::GlDiagnostics
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::GlDiagnostics
+/// \ingroup graphics
+///
+/// By default, debug builds of SFML check for an OpenGL error
+/// after every OpenGL call they make, by calling glGetError.
+/// This finds the exact call that failed, but glGetError
+/// waits for the driver to catch up with the application. It
+/// makes debug builds too slow to measure performance, while
+/// release builds report no error at all.
+///
+/// sf::GlDiagnostics lets the application choose at runtime.
+/// Mode::DebugOutput installs a callback with the KHR_debug
+/// extension (core since OpenGL 4.3): the driver reports
+/// errors and warnings on its own, asynchronously, without
+/// synchronizing on every call. The messages are sent to
+/// sf::err() with the matching sf::LogSeverity, and thus to
+/// the log sink if one is set. Drivers generally report the
+/// most details in contexts created with the
+/// sf::ContextSettings::Attribute::Debug attribute.
+///
+/// Since the messages are asynchronous, they can't tell which
+/// call failed. Mode::CheckErrors can be enabled temporarily
+/// to locate it.
+///
+/// Usage example:
+/// \code
+/// // Release build running in the field, with diagnostics
+/// sf::GlDiagnostics::setMode(sf::GlDiagnostics::Mode::DebugOutput);
+///
+/// // ...
+///
+/// if (sf::GlDiagnostics::getErrorCount() > 0)
+///     uploadLog();
+/// \endcode
+///
+/// \see sf::setLogSink
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Texture holding the glyphs of one or more fonts
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API GlyphAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty glyph atlas
+    ///
+    /// The texture of the atlas starts small and doubles whenever
+    /// it is full, until doubling it would exceed \a maximumSize.
+    ///
+    /// \param maximumSize Maximum width and height of the texture, in pixels, or 0 for no limit
+    ///
+    /// \return Glyph atlas if it could be created, otherwise `std::nullopt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<GlyphAtlas> create(unsigned int maximumSize = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture containing the glyphs
+    ///
+    /// The texture is replaced when the atlas grows or is
+    /// cleared, and its contents change as glyphs are loaded.
+    ///
+    /// \return Texture of the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter of the texture
+    ///
+    /// Distance field fonts must use a smooth atlas. The smooth
+    /// filter is enabled by default.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter of the texture is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum size of the texture
+    ///
+    /// Once the texture can't grow anymore, all the glyphs are
+    /// removed from the atlas to make room for the new ones.
+    /// A texture that is already larger is not shrunk.
+    ///
+    /// \param size Maximum width and height of the texture, in pixels, or 0 for no limit
+    ///
+    /// \see getMaximumSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaximumSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum size of the texture
+    ///
+    /// \return Maximum width and height of the texture, in pixels, or 0 for no limit
+    ///
+    /// \see setMaximumSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getMaximumSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the glyphs from the atlas
+    ///
+    /// The fonts using the atlas load their glyphs again when
+    /// they are requested.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+    friend class Font;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an atlas from its initial texture
+    ///
+    ////////////////////////////////////////////////////////////
+    GlyphAtlas(Texture&& texture, unsigned int maximumSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the contents of an empty atlas texture
+    ///
+    /// A 2x2 white square is reserved for texturing underlines.
+    ///
+    /// \param size Size of the texture
+    ///
+    /// \return Image of the empty texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Image makeImage(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve a rectangle of the texture, growing it if needed
+    ///
+    /// \param size        Size of the rectangle
+    /// \param maximumSize Maximum width and height the texture may grow to
+    ///
+    /// \return Reserved rectangle, or an empty optional if the texture is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<IntRect> allocate(const Vector2u& size, unsigned int maximumSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release all the rectangles, keeping the white square
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetPacker();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Texture             m_texture;       //!< Texture containing the pixels of the glyphs
+    priv::SkylinePacker m_packer;        //!< Packer keeping track of the free space of the texture
+    unsigned int        m_maximumSize{}; //!< Maximum size of the texture, 0 for no limit
+    std::uint64_t       m_generation{};  //!< Number of times the atlas was cleared, for the fonts to notice it
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::GlyphAtlas
+/// \ingroup graphics
+///
+/// By default, every sf::Font stores the glyphs of every
+/// character size in its own texture. An application using
+/// several fonts at several sizes thus ends up with many
+/// small textures, which texts have to switch between and
+/// which all keep some free space.
+///
+/// A glyph atlas given to fonts with sf::Font::setGlyphAtlas
+/// stores the glyphs of all these fonts and sizes in a single
+/// texture instead. Texts drawn consecutively with any of
+/// these fonts then use the same texture, so the render target
+/// doesn't need to bind another one in between, and the memory
+/// used by all the glyphs is bounded by the maximum size of
+/// the atlas.
+///
+/// When the atlas is full and can't grow anymore, all its
+/// glyphs are removed and loaded again on demand.
+///
+/// Usage example:
+/// \code
+/// const auto atlas = std::make_shared<sf::GlyphAtlas>(sf::GlyphAtlas::create(2048).value());
+///
+/// sf::Font regular = sf::Font::loadFromFile("regular.ttf").value();
+/// sf::Font bold = sf::Font::loadFromFile("bold.ttf").value();
+/// regular.setGlyphAtlas(atlas);
+/// bold.setGlyphAtlas(atlas);
+/// \endcode
+///
+/// \see sf::Font, sf::Text
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Keep track of the video memory used by the graphics resources
+///
+////////////////////////////////////////////////////////////
+namespace sf::GpuMemory
+{
+////////////////////////////////////////////////////////////
+/// \brief Kinds of resources whose memory is tracked
+///
+////////////////////////////////////////////////////////////
+enum class Category
+{
+    Texture,       //!< Pixels of sf::Texture and sf::TextureArray, including their mipmaps
+    RenderTexture, //!< Target texture and attachments of sf::RenderTexture
+    VertexBuffer,  //!< Vertices of sf::VertexBuffer
+    IndexBuffer    //!< Indices of sf::IndexBuffer
+};
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+static constexpr unsigned int CategoryCount{4}; //!< The total number of memory categories
+
+////////////////////////////////////////////////////////////
+/// \brief Memory used by a category of resources
+///
+////////////////////////////////////////////////////////////
+struct Statistics
+{
+    std::uint64_t bytes{};         //!< Memory currently used, in bytes
+    std::uint64_t peakBytes{};     //!< Highest memory used since the start of the program, in bytes
+    std::size_t   resourceCount{}; //!< Number of resources currently holding memory
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the memory used by a category of resources
+///
+/// \param category Category of resources
+///
+/// \return Memory statistics of the category
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API Statistics getStatistics(Category category);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the memory used by all the tracked resources
+///
+/// \return Sum of the memory used by all the categories, in bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API std::uint64_t getTotalUsage();
+
+} // namespace sf::GpuMemory
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::GpuMemory
+/// \ingroup graphics
+///
+/// OpenGL doesn't tell how much video memory is used, let
+/// alone by which objects. sf::GpuMemory keeps its own
+/// accounts instead: every texture, render texture and
+/// vertex or index buffer reports the size of the storage
+/// it allocates and releases. The figures are computed from
+/// the sizes and formats of the resources, so they don't
+/// include the padding and alignment added by the driver,
+/// nor the memory used by the driver itself or by resources
+/// created directly with OpenGL.
+///
+/// This is enough to find which kind of resource uses too
+/// much memory, and to keep the whole application within a
+/// budget, for example with sf::TextureStreamer.
+///
+/// Usage example:
+/// \code
+/// const auto textures = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture);
+/// std::cout << textures.resourceCount << " textures use " << textures.bytes / 1024 / 1024 << " MiB\n";
+///
+/// if (sf::GpuMemory::getTotalUsage() > 1'500'000'000)
+///     streamer.setBudget(streamer.getBudget() / 2);
+/// \endcode
+///
+/// \see sf::TextureStreamer
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,314 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Measure the GPU and CPU time spent in sections of the rendering
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API GpuProfiler : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Measurements of a profiled scope
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Timings
+    {
+        std::string  name;           //!< Name given to the scope
+        unsigned int depth{};        //!< Number of scopes that enclose this one
+        Time         gpuTime;        //!< Time taken by the GPU to execute the commands of the scope
+        Time         cpuTime;        //!< Time spent on the CPU between the beginning and the end of the scope
+        std::size_t  drawCalls{};    //!< Number of draw calls issued in the scope
+        std::size_t  vertices{};     //!< Number of vertices submitted in the scope
+        std::size_t  stateChanges{}; //!< Number of render state changes in the scope
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Utility class that profiles a scope during its lifetime
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Scope
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Begin a scope
+        ///
+        /// \param profiler Profiler to record the scope with
+        /// \param name     Name of the scope
+        ///
+        ////////////////////////////////////////////////////////////
+        Scope(GpuProfiler& profiler, std::string name);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief End the scope
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Scope();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Scope(const Scope&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        GpuProfiler& m_profiler; //!< Profiler the scope is recorded with
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a profiler for a render target
+    ///
+    /// The render target must outlive the profiler.
+    ///
+    /// \param target Render target whose commands are measured
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit GpuProfiler(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~GpuProfiler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuProfiler(const GpuProfiler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports GPU timings
+    ///
+    /// Without support for timer queries (ARB_timer_query),
+    /// the GPU times are always zero but the CPU times and the
+    /// counters are still measured.
+    ///
+    /// \return True if GPU timings are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Begin a scope
+    ///
+    /// Scopes can be nested, and every scope must be ended
+    /// by a call to endScope before the end of the frame.
+    /// The scope is also visible as a debug group in tools
+    /// such as RenderDoc, see RenderTarget::pushDebugGroup.
+    ///
+    /// \param name Name of the scope
+    ///
+    /// \see endScope, Scope
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginScope(std::string name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the scope opened by the last call to beginScope
+    ///
+    /// \see beginScope
+    ///
+    ////////////////////////////////////////////////////////////
+    void endScope();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the end of a frame
+    ///
+    /// The measurements of the frame are collected once the
+    /// GPU has executed its commands, usually a few frames
+    /// later. This function never waits for the GPU: frames
+    /// whose results still aren't available after
+    /// getMaxPendingFrames() frames are dropped.
+    ///
+    /// \see getResults
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the measurements of the last collected frame
+    ///
+    /// The scopes are listed in the order they were begun,
+    /// the depth of each one tells how they are nested.
+    ///
+    /// \return Timings of the scopes, empty if no frame was collected yet
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<Timings>& getResults() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames after which uncollected results are dropped
+    ///
+    /// \return Maximum number of frames waiting for their results
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t getMaxPendingFrames()
+    {
+        return 4;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Scope waiting for its results
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Record
+    {
+        Timings                  timings;      //!< Measurements, completed when the results are collected
+        unsigned int             beginQuery{}; //!< Timestamp query issued at the beginning of the scope
+        unsigned int             endQuery{};   //!< Timestamp query issued at the end of the scope
+        Time                     cpuBegin;     //!< CPU time at the beginning of the scope
+        RenderTarget::Statistics statistics;   //!< Counters of the target at the beginning of the scope
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Issue a timestamp query
+    ///
+    /// \return Query object, 0 if timer queries are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int queryTimestamp();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Collect the results of the oldest pending frames that are complete
+    ///
+    ////////////////////////////////////////////////////////////
+    void collectResults();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give back the query objects of a frame
+    ///
+    /// \param records Scopes of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void recycleQueries(const std::vector<Record>& records);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    RenderTarget&                   m_target;         //!< Render target whose commands are measured
+    Clock                           m_clock;          //!< Clock measuring the CPU times
+    std::vector<Record>             m_frame;          //!< Scopes of the current frame
+    std::vector<std::size_t>        m_openScopes;     //!< Indices of the scopes that have not ended yet
+    std::deque<std::vector<Record>> m_pending;        //!< Frames waiting for their results, oldest first
+    std::vector<unsigned int>       m_freeQueries;    //!< Query objects ready to be reused
+    std::vector<Timings>            m_results;        //!< Measurements of the last collected frame
+    bool                            m_timerQueries{}; //!< Are timer queries supported?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::GpuProfiler
+/// \ingroup graphics
+///
+/// sf::GpuProfiler measures how long named sections of the
+/// rendering of a sf::RenderTarget take. For each scope,
+/// it reports the time the GPU spent executing its commands,
+/// the time spent on the CPU submitting them, and the number
+/// of draw calls, vertices and render state changes.
+///
+/// The GPU executes commands long after they are submitted,
+/// so the GPU timings are read back asynchronously from
+/// OpenGL timestamp queries: the results returned by
+/// getResults() lag a few frames behind. Profiling never
+/// stalls the rendering.
+///
+/// Scopes are also exposed as debug groups, which makes
+/// captures in debugging tools such as RenderDoc easier
+/// to read.
+///
+/// The profiler issues OpenGL commands in the context of its
+/// render target, it must be used from the thread that
+/// renders to the target.
+///
+/// Usage example:
+/// \code
+/// sf::GpuProfiler profiler(window);
+///
+/// while (window.isOpen())
+/// {
+///     {
+///         sf::GpuProfiler::Scope scope(profiler, "Scene");
+///         window.clear();
+///         window.draw(background);
+///         window.draw(sprites);
+///     }
+///
+///     {
+///         sf::GpuProfiler::Scope scope(profiler, "Interface");
+///         window.draw(hud);
+///     }
+///
+///     window.display();
+///     profiler.endFrame();
+///
+///     for (const auto& timings : profiler.getResults())
+///         std::cout << std::string(timings.depth * 2, ' ') << timings.name << ": "
+///                   << timings.gpuTime.asMicroseconds() << " us, "
+///                   << timings.drawCalls << " draw calls" << std::endl;
+/// }
+/// \endcode
+///
+/// \see sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -30,11 +30,14 @@
 #include <SFML/Graphics/Export.hpp>
 
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/ExecutionPolicy.hpp>
+#include <SFML/Graphics/ImageSaveOptions.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
 #include <SFML/System/Vector2.hpp>
 
 #include <filesystem>
+#include <future>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -54,6 +57,17 @@ class InputStream;
 class SFML_GRAPHICS_API Image
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Filters used to compute resized images
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class ResamplingFilter
+    {
+        Box,      //!< Average of the covered pixels, best suited to halving an image
+        Bilinear, //!< Linear interpolation (tent filter when shrinking)
+        Lanczos3  //!< Windowed sinc with 3 lobes, sharpest but slowest
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the image and fill it with a unique color
     ///
@@ -81,8 +95,10 @@ public:
     /// \brief Load the image from a file on disk
     ///
     /// The supported image formats are bmp, png, tga, jpg, gif,
-    /// psd, hdr, pic and pnm. Some format options are not supported,
+    /// psd, hdr, pic, pnm and qoi. Some format options are not supported,
     /// like jpeg with arithmetic coding or ASCII pnm.
+    /// The file is mapped in memory and decoded in place,
+    /// see sf::MappedFileInputStream.
     /// If this function fails, the image is left unchanged.
     ///
     /// \param filename Path of the image file to load
@@ -98,7 +114,7 @@ public:
     /// \brief Load the image from a file in memory
     ///
     /// The supported image formats are bmp, png, tga, jpg, gif,
-    /// psd, hdr, pic and pnm. Some format options are not supported,
+    /// psd, hdr, pic, pnm and qoi. Some format options are not supported,
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
@@ -116,7 +132,7 @@ public:
     /// \brief Load the image from a custom stream
     ///
     /// The supported image formats are bmp, png, tga, jpg, gif,
-    /// psd, hdr, pic and pnm. Some format options are not supported,
+    /// psd, hdr, pic, pnm and qoi. Some format options are not supported,
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
@@ -129,40 +145,129 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<Image> loadFromStream(InputStream& stream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the size of an image file in memory without decoding it
+    ///
+    /// Only the header of the file is parsed. This is typically
+    /// used to allocate the buffer passed to decodeFromMemory.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return Size of the image in pixels, or `std::nullopt` if the file is not a supported image
+    ///
+    /// \see decodeFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Vector2u> getSizeFromMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode an image file in memory into a buffer provided by the caller
+    ///
+    /// The pixels are written in the same layout as the ones
+    /// returned by getPixelsPtr: 32-bit RGBA, row by row from the
+    /// top-left corner, without padding. This lets applications
+    /// decode straight into storage they already own, such as a
+    /// reused staging buffer, instead of allocating a new
+    /// sf::Image for every file.
+    ///
+    /// The supported image formats are the same as loadFromMemory.
+    /// If this function fails, the buffer is left unchanged.
+    ///
+    /// \param data     Pointer to the file data in memory
+    /// \param size     Size of the data to decode, in bytes
+    /// \param pixels   Buffer receiving the pixels
+    /// \param capacity Size of the buffer, in bytes, must be at least 4 * width * height
+    ///
+    /// \return Size of the decoded image in pixels, or `std::nullopt` on error
+    ///
+    /// \see getSizeFromMemory, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Vector2u> decodeFromMemory(const void*   data,
+                                                                  std::size_t   size,
+                                                                  std::uint8_t* pixels,
+                                                                  std::size_t   capacity);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the image to a file on disk
     ///
     /// The format of the image is automatically deduced from
     /// the extension. The supported image formats are bmp, png,
-    /// tga and jpg. The destination file is overwritten
+    /// tga, jpg and qoi. The destination file is overwritten
     /// if it already exists. This function fails if the image is empty.
     ///
+    /// Qoi is lossless like png, and much faster to encode,
+    /// at the cost of larger files.
+    ///
     /// \param filename Path of the file to save
+    /// \param options  Encoding settings of the chosen format
     ///
     /// \return True if saving was successful
     ///
-    /// \see create, loadFromFile, loadFromMemory
+    /// \see create, loadFromFile, loadFromMemory, saveToFileAsync
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool saveToFile(const std::filesystem::path& filename) const;
+    [[nodiscard]] bool saveToFile(const std::filesystem::path& filename, const ImageSaveOptions& options = {}) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Save the image to a buffer in memory
     ///
     /// The format of the image must be specified.
-    /// The supported image formats are bmp, png, tga and jpg.
+    /// The supported image formats are bmp, png, tga, jpg and qoi.
     /// This function fails if the image is empty, or if
     /// the format was invalid.
     ///
-    /// \param format Encoding format to use
+    /// \param format  Encoding format to use
+    /// \param options Encoding settings of the chosen format
     ///
     /// \return Buffer with encoded data if saving was successful,
     ///     otherwise std::nullopt
     ///
-    /// \see create, loadFromFile, loadFromMemory, saveToFile
+    /// \see create, loadFromFile, loadFromMemory, saveToFile, saveToMemoryAsync
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> saveToMemory(std::string_view        format,
+                                                                        const ImageSaveOptions& options = {}) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a file on disk from a worker thread
+    ///
+    /// The pixels are copied before this function returns, so the
+    /// image can be modified or destroyed while it is being saved.
+    /// The encoding and the writing then happen on another thread,
+    /// see saveToFile for the supported formats.
+    ///
+    /// \param filename Path of the file to save
+    /// \param options  Encoding settings of the chosen format
+    ///
+    /// \return Future holding true once saving succeeded, or false on failure
+    ///
+    /// \see saveToFile, saveToMemoryAsync
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] std::optional<std::vector<std::uint8_t>> saveToMemory(std::string_view format) const;
+    [[nodiscard]] std::future<bool> saveToFileAsync(const std::filesystem::path& filename,
+                                                    const ImageSaveOptions&      options = {}) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a buffer in memory from a worker thread
+    ///
+    /// The pixels are copied before this function returns, so the
+    /// image can be modified or destroyed while it is being encoded.
+    /// The encoding then happens on another thread, see
+    /// saveToMemory for the supported formats.
+    ///
+    /// \param format  Encoding format to use
+    /// \param options Encoding settings of the chosen format
+    ///
+    /// \return Future holding the encoded data, or std::nullopt on failure
+    ///
+    /// \see saveToMemory, saveToFileAsync
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<std::vector<std::uint8_t>>> saveToMemoryAsync(
+        std::string_view        format,
+        const ImageSaveOptions& options = {}) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the size (width and height) of the image
@@ -179,11 +284,14 @@ public:
     /// the given color to \a alpha (0 by default), so that they
     /// become transparent.
     ///
-    /// \param color Color to make transparent
-    /// \param alpha Alpha value to assign to transparent pixels
+    /// \param color  Color to make transparent
+    /// \param alpha  Alpha value to assign to transparent pixels
+    /// \param policy Whether the work may be split among several threads
     ///
     ////////////////////////////////////////////////////////////
-    void createMaskFromColor(const Color& color, std::uint8_t alpha = 0);
+    void createMaskFromColor(const Color&    color,
+                             std::uint8_t    alpha  = 0,
+                             ExecutionPolicy policy = ExecutionPolicy::Sequential);
 
     ////////////////////////////////////////////////////////////
     /// \brief Copy pixels from another image onto this one
@@ -213,11 +321,16 @@ public:
     /// \param dest       Coordinates of the destination position
     /// \param sourceRect Sub-rectangle of the source image to copy
     /// \param applyAlpha Should the copy take into account the source transparency?
+    /// \param policy     Whether the work may be split among several threads
     ///
     /// \return True if the operation was successful, false otherwise
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool copy(const Image& source, const Vector2u& dest, const IntRect& sourceRect = {}, bool applyAlpha = false);
+    [[nodiscard]] bool copy(const Image&    source,
+                            const Vector2u& dest,
+                            const IntRect&  sourceRect = {},
+                            bool            applyAlpha = false,
+                            ExecutionPolicy policy     = ExecutionPolicy::Sequential);
 
     ////////////////////////////////////////////////////////////
     /// \brief Change the color of a pixel
@@ -268,14 +381,74 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Flip the image horizontally (left <-> right)
     ///
+    /// \param policy Whether the work may be split among several threads
+    ///
     ////////////////////////////////////////////////////////////
-    void flipHorizontally();
+    void flipHorizontally(ExecutionPolicy policy = ExecutionPolicy::Sequential);
 
     ////////////////////////////////////////////////////////////
     /// \brief Flip the image vertically (top <-> bottom)
     ///
+    /// \param policy Whether the work may be split among several threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void flipVertically(ExecutionPolicy policy = ExecutionPolicy::Sequential);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color of each pixel by its alpha
+    ///
+    /// Premultiplied colors are not affected by the color of
+    /// transparent pixels when they are filtered, which removes
+    /// the dark or colored fringes around transparent areas of
+    /// smooth textures. Once loaded into a texture, they must
+    /// be drawn with sf::BlendPremultipliedAlpha.
+    ///
+    /// \param policy Whether the work may be split among several threads
+    ///
+    /// \see sf::Texture::setPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    void premultiplyAlpha(ExecutionPolicy policy = ExecutionPolicy::Sequential);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the image, resampling its pixels
+    ///
+    /// The image is filtered separately along each axis, with
+    /// the filter widened when shrinking so that every source
+    /// pixel contributes to the result. Colors are weighted by
+    /// their alpha, so that transparent pixels don't bleed
+    /// their color into their neighbors.
+    /// If the image is empty, the new image is transparent.
+    ///
+    /// \param size   New width and height of the image
+    /// \param filter Filter used to compute the new pixels
+    /// \param policy Whether the work may be split among several threads
+    ///
+    /// \see generateMipChain
+    ///
+    ////////////////////////////////////////////////////////////
+    void resize(const Vector2u&  size,
+                ResamplingFilter filter = ResamplingFilter::Bilinear,
+                ExecutionPolicy  policy = ExecutionPolicy::Sequential);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the successive mipmap levels of the image
+    ///
+    /// Each level is half the size of the previous one (rounded
+    /// down, but at least 1), down to a 1x1 image; the image
+    /// itself, the level 0, is not included. The result can be
+    /// given to sf::Texture::setMipmap.
+    ///
+    /// \param filter Filter used to compute each level from the previous one
+    /// \param policy Whether the work may be split among several threads
+    ///
+    /// \return Levels 1 to N of the mipmap, empty if the image is empty
+    ///
+    /// \see resize
+    ///
     ////////////////////////////////////////////////////////////
-    void flipVertically();
+    [[nodiscard]] std::vector<Image> generateMipChain(ResamplingFilter filter = ResamplingFilter::Box,
+                                                      ExecutionPolicy  policy = ExecutionPolicy::Sequential) const;
 
 private:
     ////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Encoding settings used when saving an sf::Image
+///
+////////////////////////////////////////////////////////////
+struct ImageSaveOptions
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Filter applied to the rows of png files before compression
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class PngFilter
+    {
+        Adaptive, //!< Try every filter on each row and keep the one that compresses best (slowest)
+        None,     //!< Store the rows unfiltered (fastest)
+        Sub,      //!< Predict each byte from the pixel on its left
+        Up,       //!< Predict each byte from the pixel above
+        Average,  //!< Predict each byte from the average of the left and above pixels
+        Paeth     //!< Predict each byte from the left, above or upper-left pixel
+    };
+
+    int       pngCompressionLevel{8};         //!< Effort of the png compressor, 5 is the fastest, higher is smaller
+    PngFilter pngFilter{PngFilter::Adaptive}; //!< Row filter of png files
+    int       jpgQuality{90};                 //!< Quality of jpg files, from 1 (smallest) to 100 (best)
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageSaveOptions
+/// \ingroup graphics
+///
+/// sf::ImageSaveOptions tunes the encoders used by
+/// sf::Image::saveToFile and sf::Image::saveToMemory.
+/// Options that don't apply to the chosen format are ignored.
+///
+/// The defaults produce the same files as saving without options.
+/// When encoding speed matters more than size, for example when
+/// capturing frames continuously, lower the png effort and disable
+/// the adaptive filter, or save to the qoi format which is lossless
+/// and much faster to encode than png.
+///
+/// Usage example:
+/// \code
+/// sf::ImageSaveOptions options;
+/// options.pngCompressionLevel = 5;
+/// options.pngFilter           = sf::ImageSaveOptions::PngFilter::None;
+///
+/// if (!image.saveToFile("capture.png", options))
+///     return -1;
+/// \endcode
+///
+/// \see sf::Image
+///
+////////////////////////////////////////////////////////////
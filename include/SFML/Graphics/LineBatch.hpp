@@ -0,0 +1,305 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+class Shader;
+
+////////////////////////////////////////////////////////////
+/// \brief Container drawing many thick lines efficiently
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API LineBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty batch, with a thickness of 1 and
+    /// smooth lines.
+    ///
+    ////////////////////////////////////////////////////////////
+    LineBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a line segment
+    ///
+    /// The ends of the segment are cut square, without caps.
+    ///
+    /// \param start Position of the start of the segment, in local coordinates
+    /// \param end   Position of the end of the segment, in local coordinates
+    /// \param color Color of the segment
+    ///
+    ////////////////////////////////////////////////////////////
+    void addLine(Vector2f start, Vector2f end, const Color& color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a line going through a series of points
+    ///
+    /// Consecutive segments of the polyline are joined by a
+    /// miter. Sharp corners would need very long miters, these
+    /// are shortened, which rounds the corner off.
+    ///
+    /// \param points     Pointer to the points, in local coordinates
+    /// \param pointCount Number of points, a polyline needs at least 2
+    /// \param color      Color of the polyline
+    /// \param closed     True to join the last point to the first one
+    ///
+    ////////////////////////////////////////////////////////////
+    void addPolyline(const Vector2f* points,
+                     std::size_t     pointCount,
+                     const Color&    color  = Color::White,
+                     bool            closed = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the lines
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for a number of segments
+    ///
+    /// \param segmentCount Number of segments to reserve memory for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t segmentCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of segments in the batch
+    ///
+    /// A polyline of n points has n - 1 segments, n if it is closed.
+    ///
+    /// \return Number of segments
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSegmentCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the lines
+    ///
+    /// The thickness is in local units, like the positions of
+    /// the points: it is scaled by the transform of the batch
+    /// and by the view. The default thickness is 1.
+    ///
+    /// \param thickness New thickness of the lines
+    ///
+    /// \see getThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThickness(float thickness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the thickness of the lines
+    ///
+    /// \return Thickness of the lines
+    ///
+    /// \see setThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getThickness() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the antialiasing of the lines
+    ///
+    /// The edges of smooth lines fade out over one pixel, which
+    /// hides their stair steps and lets lines thinner than a
+    /// pixel be drawn with a lighter color instead of gaps.
+    /// Lines are smooth by default.
+    ///
+    /// \param smooth True to enable antialiasing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the lines are antialiased
+    ///
+    /// \return True if antialiasing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the expansion of the lines on the graphics card
+    ///
+    /// When enabled and available (see isGpuExpansionAvailable),
+    /// only the ends of the segments are uploaded, and a geometry
+    /// shader turns them into quads. Otherwise the quads are
+    /// computed on the CPU. Since sf::Shader can't be used with
+    /// core profile contexts, the expansion must be disabled to
+    /// draw to them. It is enabled by default.
+    ///
+    /// \param enabled True to expand the lines on the graphics card
+    ///
+    /// \see isGpuExpansionEnabled, isGpuExpansionAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGpuExpansionEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the lines are expanded on the graphics card when possible
+    ///
+    /// \return True if the expansion on the graphics card is enabled
+    ///
+    /// \see setGpuExpansionEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isGpuExpansionEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the system can expand the lines on the graphics card
+    ///
+    /// This requires geometry shaders and vertex buffers.
+    ///
+    /// \return True if the lines can be expanded on the graphics card
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isGpuExpansionAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the lines to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the shader expanding the lines
+    ///
+    /// \param feather Width of the antialiased edges, in local units
+    ///
+    /// \return Shader to draw the segments with, or a null pointer if it can't be used
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getExpansionShader(float feather) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the triangles of the lines on the CPU
+    ///
+    /// \param feather Width of the antialiased edges, in local units
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTriangles(float feather) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the endpoints to the vertex buffer
+    ///
+    /// \return True if the vertex buffer is up to date
+    ///
+    ////////////////////////////////////////////////////////////
+    bool updateBuffer() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vertex>             m_endpoints;                 //!< Ends of the segments, with their neighbor point
+    float                           m_thickness{1.f};            //!< Thickness of the lines, in local units
+    bool                            m_smooth{true};              //!< Are the lines antialiased?
+    bool                            m_gpuExpansionEnabled{true}; //!< Are the lines expanded on the graphics card?
+    mutable std::vector<Vertex>     m_triangles;                 //!< Triangles computed when expanding on the CPU
+    mutable float                   m_trianglesFeather{-1.f};    //!< Feather of the triangles, negative if outdated
+    mutable VertexBuffer            m_vertexBuffer;              //!< GPU copy of the endpoints
+    mutable bool                    m_bufferNeedUpdate{};        //!< Does the vertex buffer need to be updated?
+    mutable std::shared_ptr<Shader> m_shader;                    //!< Built-in shader expanding the segments
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::LineBatch
+/// \ingroup graphics
+///
+/// sf::PrimitiveType::Lines always draws lines one pixel wide.
+/// sf::LineBatch draws lines of any thickness, with smooth
+/// edges, and lets large numbers of them be drawn at once:
+/// plots, debug drawings, wireframes or graph edges.
+///
+/// Lines are added as independent segments (addLine) or as
+/// polylines (addPolyline), whose segments are joined by
+/// miters. All the lines of a batch share the same thickness,
+/// and each can have its own color. The batch itself is a
+/// sf::Transformable, its transform applies to all the lines.
+///
+/// Only the two ends of each segment are stored and uploaded
+/// to the graphics card, which expands them into quads with a
+/// geometry shader: this takes 3 to 9 times less memory and
+/// bandwidth than drawing the quads themselves. When geometry
+/// shaders are not available, the quads are computed on the
+/// CPU, with the same result.
+///
+/// The lines are drawn with their own shader, and without a
+/// texture: the shader and texture of the render states are
+/// ignored.
+///
+/// Usage example:
+/// \code
+/// sf::LineBatch plot;
+/// plot.setThickness(2);
+///
+/// std::vector<sf::Vector2f> points;
+/// for (float x = 0; x < 800; x += 4)
+///     points.emplace_back(x, 300 + 100 * std::sin(x / 50));
+/// plot.addPolyline(points.data(), points.size(), sf::Color::Green);
+///
+/// // Axes
+/// plot.addLine({0, 300}, {800, 300}, sf::Color(128, 128, 128));
+/// plot.addLine({0, 0}, {0, 600}, sf::Color(128, 128, 128));
+///
+/// window.draw(plot);
+/// \endcode
+///
+/// \see sf::SpriteBatch, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,505 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Large set of particles simulated on the graphics card
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Drawable, public Transformable, GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Area spawning particles
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Emitter
+    {
+        Vector2f position;                   //!< Center of the area, in local coordinates
+        Vector2f size;                       //!< Size of the area, particles spawn anywhere inside it
+        Angle    direction;                  //!< Mean direction of the initial velocity
+        Angle    spread{degrees(360)};       //!< Range of directions around the mean direction
+        float    minSpeed{};                 //!< Minimum initial speed, in units per second
+        float    maxSpeed{100.f};            //!< Maximum initial speed, in units per second
+        Time     minLifetime{seconds(1)};    //!< Minimum lifetime of the particles
+        Time     maxLifetime{seconds(1)};    //!< Maximum lifetime of the particles
+        Color    startColor{Color::White};   //!< Color of the particles when they spawn
+        Color    endColor{255, 255, 255, 0}; //!< Color of the particles when they die
+        float    startSize{4.f};             //!< Size of the particles when they spawn
+        float    endSize{4.f};               //!< Size of the particles when they die
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point pulling the particles towards it
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Attractor
+    {
+        Vector2f position;   //!< Position of the attractor, in local coordinates
+        float    strength{}; //!< Acceleration towards the attractor, negative to push particles away
+    };
+
+    static constexpr std::size_t MaxEmitters{4};   //!< Maximum number of emitters
+    static constexpr std::size_t MaxAttractors{4}; //!< Maximum number of attractors
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ParticleSystem() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem(const ParticleSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem(ParticleSystem&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem& operator=(ParticleSystem&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a particle system
+    ///
+    /// The system starts with one default emitter, which spawns
+    /// the particles progressively so that they are evenly
+    /// spread over their lifetime.
+    ///
+    /// \param particleCount Number of particles
+    ///
+    /// \return Particle system if creation was successful, otherwise `std::nullopt`
+    ///
+    /// \see isAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<ParticleSystem> create(std::size_t particleCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of particles
+    ///
+    /// This includes the particles that are not alive.
+    ///
+    /// \return Number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance the simulation
+    ///
+    /// The particles are moved, aged and respawned entirely on
+    /// the graphics card: the cost on the CPU doesn't depend on
+    /// the number of particles.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Kill all the particles and spawn them again progressively
+    ///
+    /// Like after creation, the particles are spawned so that
+    /// they are evenly spread over the lifetime given by the
+    /// current emitters.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the spawning of particles
+    ///
+    /// When emission is disabled, the particles that die are
+    /// not spawned again, so the system empties itself. When it
+    /// is enabled again, all the dead particles spawn at once.
+    /// Emission is enabled by default.
+    ///
+    /// \param emitting True to spawn particles, false to stop
+    ///
+    /// \see isEmitting
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEmitting(bool emitting);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether particles are spawned
+    ///
+    /// \return True if particles are spawned, false otherwise
+    ///
+    /// \see setEmitting
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmitting() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of emitters
+    ///
+    /// The particles are shared equally between the emitters.
+    /// New emitters have default values.
+    ///
+    /// \param count Number of emitters, from 1 to MaxEmitters
+    ///
+    /// \see getEmitterCount, setEmitter
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEmitterCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of emitters
+    ///
+    /// \return Number of emitters
+    ///
+    /// \see setEmitterCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getEmitterCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change an emitter
+    ///
+    /// The changes apply to the particles spawned from now on,
+    /// except for the colors and sizes, which also apply to the
+    /// particles that are alive.
+    ///
+    /// \param index   Index of the emitter, lower than getEmitterCount()
+    /// \param emitter New properties of the emitter
+    ///
+    /// \see getEmitter
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEmitter(std::size_t index, const Emitter& emitter);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an emitter
+    ///
+    /// \param index Index of the emitter, lower than getEmitterCount()
+    ///
+    /// \return Properties of the emitter
+    ///
+    /// \see setEmitter
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Emitter& getEmitter(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of attractors
+    ///
+    /// New attractors have a strength of 0. There are no
+    /// attractors by default.
+    ///
+    /// \param count Number of attractors, up to MaxAttractors
+    ///
+    /// \see getAttractorCount, setAttractor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAttractorCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of attractors
+    ///
+    /// \return Number of attractors
+    ///
+    /// \see setAttractorCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getAttractorCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change an attractor
+    ///
+    /// \param index     Index of the attractor, lower than getAttractorCount()
+    /// \param attractor New properties of the attractor
+    ///
+    /// \see getAttractor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAttractor(std::size_t index, const Attractor& attractor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an attractor
+    ///
+    /// \param index Index of the attractor, lower than getAttractorCount()
+    ///
+    /// \return Properties of the attractor
+    ///
+    /// \see setAttractor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Attractor& getAttractor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to all the particles
+    ///
+    /// The default gravity is (0, 0).
+    ///
+    /// \param gravity Acceleration, in units per second squared
+    ///
+    /// \see getGravity
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGravity(Vector2f gravity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to all the particles
+    ///
+    /// \return Acceleration, in units per second squared
+    ///
+    /// \see setGravity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getGravity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the drag slowing down the particles
+    ///
+    /// Every second, the velocity of the particles is divided
+    /// by e to the power of \a drag. The default drag is 0.
+    ///
+    /// \param drag Drag coefficient
+    ///
+    /// \see getDrag
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDrag(float drag);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the drag slowing down the particles
+    ///
+    /// \return Drag coefficient
+    ///
+    /// \see setDrag
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDrag() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture of the particles
+    ///
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the particle system uses it. If
+    /// \a resetRect is true, or if no texture was set before,
+    /// the texture rect is reset to cover the whole texture.
+    /// Without a texture, the particles are plain squares.
+    ///
+    /// \param texture   New texture, or `nullptr` for none
+    /// \param resetRect Should the texture rect be reset to the size of the new texture?
+    ///
+    /// \see getTexture, setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture, bool resetRect = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of the particles
+    ///
+    /// \return Pointer to the texture, or `nullptr` if there is none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the part of the texture displayed by every particle
+    ///
+    /// \param rect Rectangle defining the region of the texture to display
+    ///
+    /// \see getTextureRect, setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the part of the texture displayed by every particle
+    ///
+    /// \return Texture rectangle of the particles
+    ///
+    /// \see setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the system can simulate particles
+    ///
+    /// Particle systems require OpenGL 3.2 with the
+    /// compatibility profile: transform feedback to simulate
+    /// the particles and geometry shaders to draw them.
+    ///
+    /// \return True if particle systems are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from the created simulation program
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem(unsigned int program, Shader&& renderShader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particle system to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give the texture and its rectangle to the render shader
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTextureUniforms();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::array<VertexBuffer, 2>          m_buffers;                //!< Current and next state of the particles
+    std::size_t                          m_current{};              //!< Index of the buffer holding the current state
+    std::size_t                          m_particleCount{};        //!< Number of particles
+    unsigned int                         m_program{};              //!< OpenGL program simulating the particles
+    int                                  m_parametersLocation{-1}; //!< Location of the parameters of the simulation
+    Shader                               m_renderShader;           //!< Shader expanding the particles into quads
+    std::array<Emitter, MaxEmitters>     m_emitters{};             //!< Areas spawning particles
+    std::size_t                          m_emitterCount{1};        //!< Number of emitters in use
+    std::array<Attractor, MaxAttractors> m_attractors{};           //!< Points pulling the particles
+    std::size_t                          m_attractorCount{};       //!< Number of attractors in use
+    Vector2f                             m_gravity;                //!< Acceleration applied to all particles
+    float                                m_drag{};                 //!< Drag coefficient
+    bool                                 m_emitting{true};         //!< Are dead particles spawned again?
+    std::uint32_t                        m_step{};                 //!< Number of updates, seeds the random numbers
+    const Texture*                       m_texture{};              //!< Texture of the particles
+    IntRect                              m_textureRect;            //!< Part of the texture displayed by the particles
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// sf::ParticleSystem animates up to millions of particles,
+/// such as sparks, smoke or rain, without touching them on the
+/// CPU: each update runs a vertex shader over all the particles
+/// and captures the result with transform feedback, then
+/// drawing expands every particle into a textured quad with a
+/// geometry shader.
+///
+/// Particles are spawned by emitters: every emitter gives its
+/// particles a random position in an area, a random velocity
+/// and a random lifetime, and the colors and sizes that they
+/// go through during their life. They are then moved by the
+/// forces of the system: gravity, drag and attractors.
+///
+/// Since only a handful of parameters are uploaded at each
+/// update, they can be changed freely every frame, for
+/// example to move an emitter along with a character.
+///
+/// The particles live in the local coordinate system of the
+/// particle system, which is an sf::Transformable; the blend
+/// mode can be chosen when drawing, additive blending is often
+/// a good fit.
+///
+/// OpenGL 3.2 is required, see isAvailable. Since sf::Shader is
+/// used to draw the particles, particle systems can't be drawn
+/// to core profile contexts.
+///
+/// Usage example:
+/// \code
+/// auto sparks = sf::ParticleSystem::create(100'000).value();
+///
+/// sf::ParticleSystem::Emitter emitter;
+/// emitter.direction  = sf::degrees(-90);
+/// emitter.spread     = sf::degrees(30);
+/// emitter.minSpeed   = 200;
+/// emitter.maxSpeed   = 400;
+/// emitter.startColor = sf::Color::Yellow;
+/// emitter.endColor   = sf::Color(255, 0, 0, 0);
+/// sparks.setEmitter(0, emitter);
+/// sparks.setGravity({0, 300});
+/// sparks.setPosition({400, 500});
+///
+/// sf::Clock clock;
+/// while (window.isOpen())
+/// {
+///     sparks.update(clock.restart());
+///
+///     window.clear();
+///     window.draw(sparks, sf::BlendAdd);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::SpriteBatch, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
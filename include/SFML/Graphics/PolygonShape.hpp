@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Filled polygon which may be concave and have holes
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PolygonShape : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// \param pointCount Number of points of the outline of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PolygonShape(std::size_t pointCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of points of the outline of the polygon
+    ///
+    /// For the polygon to be drawn, \a count must be greater
+    /// or equal to 3.
+    ///
+    /// \param count New number of points of the polygon
+    ///
+    /// \see getPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPointCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of points of the outline of the polygon
+    ///
+    /// \return Number of points of the polygon
+    ///
+    /// \see setPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPointCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a point of the outline
+    ///
+    /// The points must be defined in order, clockwise or
+    /// counterclockwise, and the outline should not cross
+    /// itself. The behavior is undefined if \a index is greater
+    /// than or equal to getPointCount.
+    ///
+    /// \param index Index of the point to change, in range [0 .. getPointCount() - 1]
+    /// \param point New position of the point, in local coordinates
+    ///
+    /// \see getPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPoint(std::size_t index, const Vector2f& point);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a point of the outline
+    ///
+    /// \param index Index of the point to get, in range [0 .. getPointCount() - 1]
+    ///
+    /// \return Position of the index-th point of the polygon, in local coordinates
+    ///
+    /// \see setPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getPoint(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a hole to the polygon
+    ///
+    /// Like the outline, the points of a hole must be defined
+    /// in order, in either direction. Holes must lie inside
+    /// the outline and must not overlap each other. Holes with
+    /// less than 3 points are ignored.
+    ///
+    /// \param points Points of the hole, in local coordinates
+    ///
+    /// \return Index of the new hole
+    ///
+    /// \see getHole, clearHoles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addHole(std::vector<Vector2f> points);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the holes of the polygon
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearHoles();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of holes of the polygon
+    ///
+    /// \return Number of holes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getHoleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the points of a hole
+    ///
+    /// \param index Index of the hole, in range [0 .. getHoleCount() - 1]
+    ///
+    /// \return Points of the hole, in local coordinates
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Vector2f>& getHole(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the polygon
+    ///
+    /// The texture is mapped onto the bounding rectangle of
+    /// the polygon, like for sf::Shape. The texture must
+    /// exist as long as the polygon uses it.
+    ///
+    /// \param texture   New texture, or a null pointer to disable texturing
+    /// \param resetRect Should the texture rect be reset to the size of the new texture?
+    ///
+    /// \see getTexture, setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture, bool resetRect = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the polygon
+    ///
+    /// \return Pointer to the texture of the polygon, or a null pointer if it has none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture that the polygon will display
+    ///
+    /// \param rect Rectangle defining the region of the texture to display
+    ///
+    /// \see getTextureRect, setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by the polygon
+    ///
+    /// \return Texture rectangle of the polygon
+    ///
+    /// \see setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of the polygon
+    ///
+    /// The default color is opaque white. The color is
+    /// modulated (multiplied) with the texture, if any.
+    ///
+    /// \param color New color of the polygon
+    ///
+    /// \see getFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFillColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of the polygon
+    ///
+    /// \return Fill color of the polygon
+    ///
+    /// \see setFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Color& getFillColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the triangles filling the polygon
+    ///
+    /// Every three indices make a triangle. The indices refer
+    /// to the points of the outline, followed by the points of
+    /// each hole in order: they can fill an sf::IndexBuffer to
+    /// draw the polygon from a vertex buffer of the same points.
+    ///
+    /// The triangulation is only computed again after the
+    /// points of the outline or of the holes have changed.
+    ///
+    /// \return Indices of the triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<std::uint32_t>& getTriangleIndices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the polygon
+    ///
+    /// \return Local bounding rectangle of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the polygon
+    ///
+    /// \return Global bounding rectangle of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the polygon to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Triangulate the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTriangulation() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the vertices of the points
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the vertices for drawing
+    ///
+    /// \return True if the GPU buffers can be drawn, false to draw the client-side triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    bool updateBuffers() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>              m_points;                    //!< Points of the outline
+    std::vector<std::vector<Vector2f>> m_holes;                     //!< Points of each hole
+    const Texture*                     m_texture{};                 //!< Texture of the polygon
+    IntRect                            m_textureRect;               //!< Area of the texture to display
+    Color                              m_fillColor{Color::White};   //!< Fill color
+    mutable std::vector<std::uint32_t> m_indices;                   //!< Indices of the triangles
+    mutable std::vector<Vertex>        m_vertices;                  //!< Vertices of the points of the outline and holes
+    mutable std::vector<Vertex>        m_triangles;                 //!< Triangles drawn without buffer objects
+    mutable FloatRect                  m_bounds;                    //!< Bounding rectangle of the outline
+    mutable VertexBuffer               m_vertexBuffer;              //!< GPU copy of the vertices
+    mutable IndexBuffer                m_indexBuffer;               //!< GPU copy of the indices
+    mutable bool                       m_triangulationNeedUpdate{}; //!< Do the points need to be triangulated again?
+    mutable bool                       m_verticesNeedUpdate{};      //!< Do the vertices need to be recomputed?
+    mutable bool                       m_buffersNeedUpdate{};       //!< Do the GPU buffers need to be updated?
+    mutable bool                       m_indexBufferNeedUpdate{};   //!< Do the indices need to be uploaded again?
+    mutable bool                       m_useBuffers{};              //!< Are the GPU buffers drawn?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PolygonShape
+/// \ingroup graphics
+///
+/// The shapes derived from sf::Shape are filled with a fan of
+/// triangles, which requires them to be convex. sf::PolygonShape
+/// fills any simple polygon, concave or not, optionally with
+/// holes, such as the areas of a map or the levels of a
+/// platformer.
+///
+/// The polygon is triangulated by ear clipping, holes being
+/// first connected to the outline. The triangulation is cached:
+/// it is only computed again when points change, not when the
+/// polygon is transformed, colored or textured. The triangles
+/// are drawn from a vertex buffer and an index buffer when the
+/// system supports them, so that an unchanged polygon is not
+/// uploaded again, and getTriangleIndices gives them to
+/// applications managing their own buffers.
+///
+/// Unlike sf::Shape, sf::PolygonShape has no outline; the
+/// edges can be drawn with a sf::LineBatch.
+///
+/// Usage example:
+/// \code
+/// sf::PolygonShape lake(5);
+/// lake.setPoint(0, {0, 0});
+/// lake.setPoint(1, {100, 20});
+/// lake.setPoint(2, {40, 50});
+/// lake.setPoint(3, {100, 80});
+/// lake.setPoint(4, {0, 100});
+/// lake.addHole({{10, 40}, {25, 40}, {25, 60}, {10, 60}}); // an island
+/// lake.setFillColor(sf::Color::Blue);
+/// lake.setPosition({200, 100});
+///
+/// window.draw(lake);
+/// \endcode
+///
+/// \see sf::ConvexShape, sf::LineBatch
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,397 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <optional>
+
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class RenderTexture;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Chain of full-screen effects applied to a rendered scene
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PostProcessChain
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Gaussian blur of the whole scene
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Blur
+    {
+        bool         enabled{};     //!< Is the stage enabled?
+        float        radius{8.f};   //!< Radius of the blur, in pixels of the scene
+        unsigned int downsample{2}; //!< Factor by which the size of the scene is divided before blurring
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Glow added around the bright areas of the scene
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Bloom
+    {
+        bool         enabled{};       //!< Is the stage enabled?
+        float        threshold{0.8f}; //!< Luminance above which pixels glow
+        float        intensity{1.f};  //!< Strength of the glow, 0 disables the stage
+        float        radius{16.f};    //!< Radius of the glow, in pixels of the scene
+        unsigned int downsample{4};   //!< Factor by which the size of the scene is divided before blurring
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mapping of high dynamic range colors to the displayable range
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Tonemapping
+    {
+        bool  enabled{};     //!< Is the stage enabled?
+        float exposure{1.f}; //!< Factor applied to the colors before they are mapped
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adjustment of the colors of the scene
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ColorGrading
+    {
+        bool  enabled{};          //!< Is the stage enabled?
+        float brightness{};       //!< Offset added to the colors
+        float contrast{1.f};      //!< Factor scaling the colors around the middle gray
+        float saturation{1.f};    //!< 0 for grayscale, 1 for the original colors, more to saturate
+        Color tint{Color::White}; //!< Color the result is multiplied with
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Darkening of the borders of the scene
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Vignette
+    {
+        bool  enabled{};       //!< Is the stage enabled?
+        float intensity{0.5f}; //!< Darkness of the corners, 0 disables the stage
+        float radius{1.f};     //!< Distance from the center where the border is fully dark, 1 being a corner
+        float softness{0.6f};  //!< Width of the transition from the center to the dark border
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// All the stages are disabled.
+    ///
+    ////////////////////////////////////////////////////////////
+    PostProcessChain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PostProcessChain(const PostProcessChain&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PostProcessChain& operator=(const PostProcessChain&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the parameters of the blur stage
+    ///
+    /// \param blur New parameters of the stage
+    ///
+    /// \see getBlur
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBlur(const Blur& blur);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parameters of the blur stage
+    ///
+    /// \return Parameters of the stage
+    ///
+    /// \see setBlur
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Blur& getBlur() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the parameters of the bloom stage
+    ///
+    /// \param bloom New parameters of the stage
+    ///
+    /// \see getBloom
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBloom(const Bloom& bloom);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parameters of the bloom stage
+    ///
+    /// \return Parameters of the stage
+    ///
+    /// \see setBloom
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Bloom& getBloom() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the parameters of the tonemapping stage
+    ///
+    /// \param tonemapping New parameters of the stage
+    ///
+    /// \see getTonemapping
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTonemapping(const Tonemapping& tonemapping);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parameters of the tonemapping stage
+    ///
+    /// \return Parameters of the stage
+    ///
+    /// \see setTonemapping
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Tonemapping& getTonemapping() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the parameters of the color grading stage
+    ///
+    /// \param colorGrading New parameters of the stage
+    ///
+    /// \see getColorGrading
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColorGrading(const ColorGrading& colorGrading);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parameters of the color grading stage
+    ///
+    /// \return Parameters of the stage
+    ///
+    /// \see setColorGrading
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const ColorGrading& getColorGrading() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the parameters of the vignette stage
+    ///
+    /// \param vignette New parameters of the stage
+    ///
+    /// \see getVignette
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVignette(const Vignette& vignette);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parameters of the vignette stage
+    ///
+    /// \return Parameters of the stage
+    ///
+    /// \see setVignette
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Vignette& getVignette() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Begin the rendering of the scene
+    ///
+    /// The returned render texture comes from the pool of the
+    /// chain and has its default view. Its contents are
+    /// undefined: clear it before drawing to it.
+    ///
+    /// \param size     Size of the scene, usually the size of the final target
+    /// \param settings Settings of the render texture, see sf::RenderTexture::create
+    ///
+    /// \return Render texture to draw the scene to, or a null pointer if it could not be created
+    ///
+    /// \see endFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* beginFrame(const Vector2u& size, const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the rendering of the scene and apply the effects
+    ///
+    /// The processed scene is drawn over the whole \a target,
+    /// whatever its current view.
+    ///
+    /// \param target Target to draw the processed scene to
+    ///
+    /// \see beginFrame, apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the effects to a texture
+    ///
+    /// The processed texture is drawn over the whole \a target,
+    /// whatever its current view. \a target must not be a
+    /// render texture using \a source.
+    ///
+    /// \param source Texture to process
+    /// \param target Target to draw the processed texture to
+    ///
+    ////////////////////////////////////////////////////////////
+    void apply(const Texture& source, RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of full-screen passes drawn by the last call to apply or endFrame
+    ///
+    /// \return Number of passes, at least 1
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getPassCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Blur a texture into a smaller render texture
+    ///
+    /// \param source     Texture to blur
+    /// \param radius     Radius of the blur, in pixels of \a source
+    /// \param downsample Factor by which the size of \a source is divided
+    /// \param threshold  Luminance under which the pixels of \a source are discarded
+    ///
+    /// \return Acquired render texture containing the blurred texture, or a null pointer on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture* blur(const Texture& source, float radius, unsigned int downsample, float threshold);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a texture over a whole target
+    ///
+    /// \param source      Texture to draw
+    /// \param destination Target to draw to
+    /// \param shader      Shader of the pass, or a null pointer to copy the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawPass(const Texture& source, RenderTarget& destination, const Shader* shader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader fusing the per-pixel stages of the final pass
+    ///
+    /// \param stages Bit mask of the active per-pixel stages
+    ///
+    /// \return The shader, or a null pointer if there are no stages or it could not be created
+    ///
+    ////////////////////////////////////////////////////////////
+    Shader* getFusedShader(unsigned int stages);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Blur                                  m_blur;               //!< Parameters of the blur stage
+    Bloom                                 m_bloom;              //!< Parameters of the bloom stage
+    Tonemapping                           m_tonemapping;        //!< Parameters of the tonemapping stage
+    ColorGrading                          m_colorGrading;       //!< Parameters of the color grading stage
+    Vignette                              m_vignette;           //!< Parameters of the vignette stage
+    RenderTexturePool                     m_pool;               //!< Render textures of the scene and of the passes
+    std::optional<Shader>                 m_blurShader;         //!< Shader of the separable blur passes
+    std::array<std::optional<Shader>, 16> m_fusedShaders;       //!< Shaders of the final pass, by active stages
+    std::uint32_t                         m_failedShaders{};    //!< Fused shaders that could not be created
+    RenderTexture*                        m_scene{};            //!< Render texture of the current frame
+    unsigned int                          m_passCount{};        //!< Number of passes drawn by the last apply
+    bool                                  m_blurShaderFailed{}; //!< Could the blur shader not be created?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PostProcessChain
+/// \ingroup graphics
+///
+/// sf::PostProcessChain applies a fixed sequence of common
+/// full-screen effects to a scene: blur, bloom, tonemapping,
+/// color grading and vignette, in this order. Each stage is
+/// configured by its own structure, and the stages that are
+/// disabled, or whose parameters have no visible effect, are
+/// skipped entirely.
+///
+/// Every full-screen pass reads and writes all the pixels of
+/// the screen, which is expensive on mobile GPUs, so the chain
+/// draws as few passes as possible:
+/// \li the per-pixel stages (tonemapping, color grading and
+///     vignette) and the composition of the bloom are fused
+///     into a single shader, generated for the combination of
+///     active stages and cached, which draws directly to the
+///     final target;
+/// \li the blur and the bloom are computed on downsampled
+///     render textures, with two separable passes each.
+///
+/// The chain thus draws from 1 pass, when only per-pixel
+/// stages or no stages at all are active, to 5 passes when
+/// everything is; getPassCount tells how many were drawn.
+/// The intermediate render textures are taken from an
+/// internal sf::RenderTexturePool, and given back as soon as
+/// the next pass has consumed them.
+///
+/// The effects require shaders (see sf::Shader::isAvailable);
+/// without them, the scene is drawn as is.
+///
+/// Usage example:
+/// \code
+/// sf::PostProcessChain chain;
+/// chain.setBloom({true, 0.7f, 1.5f});
+/// chain.setVignette({true});
+///
+/// while (window.isOpen())
+/// {
+///     if (sf::RenderTexture* scene = chain.beginFrame(window.getSize()))
+///     {
+///         scene->clear();
+///         scene->draw(world);
+///         chain.endFrame(window);
+///     }
+///
+///     window.draw(hud);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::RenderTexturePool, sf::Shader
+///
+////////////////////////////////////////////////////////////
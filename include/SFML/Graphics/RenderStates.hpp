@@ -31,6 +31,8 @@
 
 #include <SFML/Graphics/BlendMode.hpp>
 #include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/DepthMode.hpp>
+#include <SFML/Graphics/Glsl.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
 #include <SFML/Graphics/Transform.hpp>
 
@@ -54,6 +56,7 @@ struct SFML_GRAPHICS_API RenderStates
     /// The default set defines:
     /// \li the BlendAlpha blend mode
     /// \li the default StencilMode (no stencil)
+    /// \li the default DepthMode (no depth test)
     /// \li the identity transform
     /// \li a null texture
     /// \li a null shader
@@ -77,6 +80,14 @@ struct SFML_GRAPHICS_API RenderStates
     ////////////////////////////////////////////////////////////
     RenderStates(const StencilMode& theStencilMode);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a default set of render states with a custom depth mode
+    ///
+    /// \param theDepthMode Depth mode to use
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderStates(const DepthMode& theDepthMode);
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct a default set of render states with a custom transform
     ///
@@ -130,10 +141,12 @@ struct SFML_GRAPHICS_API RenderStates
     ////////////////////////////////////////////////////////////
     BlendMode      blendMode{BlendAlpha};                  //!< Blending mode
     StencilMode    stencilMode;                            //!< Stencil mode
+    DepthMode      depthMode;                              //!< Depth mode
     Transform      transform;                              //!< Transform
     CoordinateType coordinateType{CoordinateType::Pixels}; //!< Texture coordinate type
     const Texture* texture{};                              //!< Texture
     const Shader*  shader{};                               //!< Shader
+    Glsl::Vec4     shaderParameters;                       //!< Parameters of the shader for this draw
 };
 
 } // namespace sf
@@ -152,6 +165,22 @@ struct SFML_GRAPHICS_API RenderStates
 /// \li the texture: what image is mapped to the object
 /// \li the shader: what custom effect is applied to the object
 ///
+/// The shader parameters come along with the shader: they are
+/// four floats that the vertex shader reads from its
+/// \p sf_parameters attribute, declared as
+/// \code
+/// attribute vec4 sf_parameters;
+/// \endcode
+/// Unlike uniforms, which are shared by all the draws of a
+/// shader, they can be different for every draw, and don't
+/// prevent sf::RenderTarget from batching draws that only
+/// differ by their parameters (see
+/// sf::RenderTarget::setBatchingEnabled). This suits effects
+/// driven by a few values per object, such as a tint or the
+/// progress of a dissolve. Shaders that don't declare the
+/// attribute ignore the parameters. Core profile contexts
+/// don't support them.
+///
 /// High-level objects such as sprites or text force some of
 /// these states when they are drawn. For example, a sprite
 /// will set its own texture, so that you don't have to care
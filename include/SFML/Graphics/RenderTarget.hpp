@@ -32,6 +32,8 @@
 #include <SFML/Graphics/BlendMode.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/DepthMode.hpp>
+#include <SFML/Graphics/Glsl.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -42,6 +44,9 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,10 +55,17 @@
 namespace sf
 {
 class Drawable;
+class IndexBuffer;
 class Shader;
 class Texture;
 class Transform;
 class VertexBuffer;
+class VertexLayout;
+
+namespace priv
+{
+class CoreProfilePipeline;
+}
 
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
@@ -126,6 +138,21 @@ public:
     ////////////////////////////////////////////////////////////
     void clear(const Color& color, StencilValue stencilValue);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the depth buffer to a specific value
+    ///
+    /// The depth buffer is only there if it was requested when
+    /// creating the target, with the depthBits member of its
+    /// sf::ContextSettings. It should be cleared at the
+    /// beginning of each frame drawn with depth testing.
+    ///
+    /// \param depth Depth to clear to, from -1 (near) to 1 (far)
+    ///
+    /// \see sf::DepthMode
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearDepth(float depth = 1.f);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the current active view
     ///
@@ -344,6 +371,385 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer
+    ///
+    /// The primitives are assembled from the vertices referenced
+    /// by the indices of \a indexBuffer, following the primitive
+    /// type of \a vertexBuffer. This allows vertices shared by
+    /// several primitives to be stored only once.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer referencing vertices of \a vertexBuffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer referencing vertices of \a vertexBuffer
+    /// \param firstIndex   Position of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of vertices of a vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct VertexRange
+    {
+        std::size_t first{}; //!< Index of the first vertex of the range
+        std::size_t count{}; //!< Number of vertices of the range
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw several ranges of a vertex buffer at once
+    ///
+    /// The result is the same as drawing each range with
+    /// draw(vertexBuffer, range.first, range.count, states), but
+    /// all the ranges are submitted with a single draw call when
+    /// the OpenGL implementation supports it (glMultiDrawArrays,
+    /// core since OpenGL 1.4). This allows, for example, drawing
+    /// the visible chunks of a tile map stored in one buffer with
+    /// a single call. Each range is assembled separately: strips
+    /// and fans of different ranges are never connected.
+    ///
+    /// Ranges are clamped to the vertex buffer, and empty ranges
+    /// are skipped.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param ranges       Pointer to the ranges of vertices to render
+    /// \param rangeCount   Number of ranges
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawMulti(const VertexBuffer& vertexBuffer,
+                   const VertexRange*  ranges,
+                   std::size_t         rangeCount,
+                   const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw several instances of the same primitives
+    ///
+    /// Every instance is drawn with its own transform, combined
+    /// with the transform of \a states, and optionally its own
+    /// color, which modulates the color of the vertices.
+    ///
+    /// If batching is enabled, the instances are appended to the
+    /// pending batch. Otherwise, if hardware instancing is available
+    /// (see isInstancingAvailable()) and no shader is used, the
+    /// vertices are uploaded once along with the transform and color
+    /// of every instance and drawn with a single instanced draw call.
+    /// In the other cases, the instances are expanded on the CPU
+    /// and submitted with a single draw call. Either way, this is
+    /// much cheaper than drawing each instance separately.
+    ///
+    /// \code
+    /// std::vector<sf::Transform> transforms;
+    /// for (const auto& bullet : bullets)
+    ///     transforms.push_back(bullet.getTransform());
+    ///
+    /// window.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip,
+    ///             transforms.data(), nullptr, transforms.size(), &texture);
+    /// \endcode
+    ///
+    /// \param vertices      Pointer to the vertices of a single instance
+    /// \param vertexCount   Number of vertices of a single instance
+    /// \param type          Type of primitives to draw
+    /// \param transforms    Pointer to the transforms of the instances
+    /// \param colors        Pointer to the colors of the instances, or a null pointer to keep the vertex colors
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*       vertices,
+              std::size_t         vertexCount,
+              PrimitiveType       type,
+              const Transform*    transforms,
+              const Color*        colors,
+              std::size_t         instanceCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw several instances of the contents of a vertex buffer
+    ///
+    /// Every instance is drawn with its own transform, combined
+    /// with the transform of \a states, and optionally its own
+    /// color, which modulates the color of the vertices.
+    ///
+    /// If hardware instancing is available (see isInstancingAvailable())
+    /// and no shader is used, the transforms and colors are uploaded
+    /// to a buffer and all the instances are drawn with a single
+    /// instanced draw call, without the vertices ever leaving the GPU.
+    ///
+    /// Otherwise, the vertices are read back and the instances are
+    /// expanded on the CPU, like with the overload taking an array
+    /// of vertices. Buffers with a custom layout (see sf::VertexLayout)
+    /// and buffers drawn while recording a sf::CommandList can't be
+    /// expanded and are drawn once per instance instead, their
+    /// vertices keeping their own colors.
+    ///
+    /// \code
+    /// sf::VertexBuffer quad(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+    /// quad.update(vertices.data(), vertices.size(), 0);
+    ///
+    /// window.draw(quad, transforms.data(), colors.data(), transforms.size(), &texture);
+    /// \endcode
+    ///
+    /// \param vertexBuffer  Vertex buffer holding the vertices of a single instance
+    /// \param transforms    Pointer to the transforms of the instances
+    /// \param colors        Pointer to the colors of the instances, or a null pointer to keep the vertex colors
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const Transform*    transforms,
+              const Color*        colors,
+              std::size_t         instanceCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports hardware instancing
+    ///
+    /// Hardware instancing requires OpenGL 3.3. When it isn't
+    /// supported, instanced draws still work but their instances
+    /// are expanded on the CPU.
+    ///
+    /// \return True if hardware instancing is supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isInstancingAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of vertex draws
+    ///
+    /// When batching is enabled, consecutive calls to
+    /// draw(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    /// (and thus drawing sprites, shapes, texts and vertex arrays)
+    /// whose render states only differ by their transform are
+    /// pre-transformed on the CPU and merged into a single draw call.
+    /// Draws that also differ by their shader parameters are
+    /// merged too, the parameters of each draw being passed along
+    /// with its vertices (see sf::RenderStates::shaderParameters),
+    /// except while recording a sf::CommandList.
+    ///
+    /// The pending batch is submitted when incompatible render
+    /// states are used, when the view or the clipping area
+    /// changes, when the target is cleared, when a vertex buffer
+    /// is drawn, when the target is displayed or when flush() is
+    /// called explicitly.
+    ///
+    /// Since the geometry is only submitted later, the textures
+    /// and shaders used by batched draws must stay alive and
+    /// unchanged until the batch is flushed. Call flush() before
+    /// updating them or before issuing your own OpenGL calls.
+    ///
+    /// Batching is disabled by default.
+    ///
+    /// \param enabled True to enable batching, false to disable it
+    ///
+    /// \see isBatchingEnabled, flush
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of vertex draws is enabled
+    ///
+    /// \return True if batching is enabled, false otherwise
+    ///
+    /// \see setBatchingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the pending batched geometry, if any
+    ///
+    /// This function does nothing if batching is disabled
+    /// or if no geometry is waiting to be drawn.
+    ///
+    /// \see setBatchingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restrict drawing to a rectangle, in addition to the current clipping area
+    ///
+    /// \a rect is expressed in the coordinates of the current
+    /// view, after \a transform is applied to it; the clipping
+    /// area is then fixed in pixels, later view changes don't
+    /// move it. Clip rectangles are nested: drawing is limited
+    /// to the intersection of all the rectangles pushed and not
+    /// popped yet. They affect draws and clears.
+    ///
+    /// When the rectangle stays aligned with the axes of the
+    /// target (no rotation other than quarter turns, no shear),
+    /// it is handled by GL scissor testing, which is almost free.
+    /// Otherwise, its shape is drawn to the stencil buffer and
+    /// the draws are stencil-tested against it; this requires a
+    /// stencil buffer (see sf::ContextSettings::stencilBits)
+    /// cleared to 0 beforehand, and the stencil mode of the
+    /// render states is ignored until the rectangle is popped.
+    ///
+    /// The pending batch is only submitted if the clipping area
+    /// actually changes. Clipping is not recorded by command lists.
+    ///
+    /// \code
+    /// window.pushClipRect(panel.getGlobalBounds());
+    /// window.draw(panelContents);
+    /// window.popClipRect();
+    /// \endcode
+    ///
+    /// \param rect      Clip rectangle, in local coordinates
+    /// \param transform Transform applied to the rectangle
+    ///
+    /// \see popClipRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushClipRect(const FloatRect& rect, const Transform& transform = Transform::Identity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the clip rectangle added by the last call to pushClipRect
+    ///
+    /// \see pushClipRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void popClipRect();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable view frustum culling of drawables
+    ///
+    /// When culling is enabled, sprites, shapes and texts whose
+    /// global bounds don't intersect the visible area of the
+    /// current view are skipped on the CPU: neither their
+    /// vertices nor a draw call are submitted for them, and
+    /// only the visible chunks of vertex arrays split with
+    /// sf::VertexArray::setChunkSize are drawn. Custom
+    /// drawables can take part in culling by calling cull() in
+    /// their draw function.
+    ///
+    /// Culling works on bounding rectangles, it is meant to
+    /// discard what is obviously off-screen; drawables that
+    /// are partially visible are still drawn entirely. Custom
+    /// vertex projections done in shaders are not taken into
+    /// account, disable culling if your shaders move vertices
+    /// around.
+    ///
+    /// Culling is disabled by default.
+    ///
+    /// \param enabled True to enable culling, false to disable it
+    ///
+    /// \see isCullingEnabled, cull
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether view frustum culling of drawables is enabled
+    ///
+    /// \return True if culling is enabled, false otherwise
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether some geometry can be skipped because it is outside the view
+    ///
+    /// This function is meant to be called by drawables before
+    /// they submit their vertices:
+    /// \code
+    /// void MyDrawable::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    /// {
+    ///     states.transform *= getTransform();
+    ///     if (target.cull(m_bounds, states.transform))
+    ///         return;
+    ///
+    ///     target.draw(m_vertices, states);
+    /// }
+    /// \endcode
+    ///
+    /// Culled geometry is counted in Statistics::culledDraws.
+    /// This function always returns false if culling is disabled.
+    ///
+    /// \param bounds    Local bounding rectangle of the geometry
+    /// \param transform Transform that will be applied to the geometry
+    ///
+    /// \return True if the geometry is entirely outside the visible area of the view
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool cull(const FloatRect& bounds, const Transform& transform = Transform::Identity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters of the work submitted to the target
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t drawCalls{};             //!< Number of OpenGL draw calls issued
+        std::size_t vertices{};              //!< Number of vertices (or indices) submitted by the draw calls
+        std::size_t stateChanges{};          //!< Number of view, transform and render state changes
+        std::size_t redundantStateChanges{}; //!< Number of state changes skipped because the state was already set
+        std::size_t culledDraws{};           //!< Number of drawables skipped because they were outside the view
+        std::size_t targetSwitches{};        //!< Number of activations after another target was active in the context
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the work submitted to the target
+    ///
+    /// The counters accumulate from the creation of the target.
+    /// To measure a section of your rendering, compare the
+    /// values before and after it (sf::GpuProfiler does that
+    /// for each of its scopes).
+    ///
+    /// \return Statistics accumulated since the target was created
+    ///
+    ////////////////////////////////////////////////////////////
+    const Statistics& getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a named group of OpenGL commands
+    ///
+    /// Debugging tools such as RenderDoc show the commands
+    /// issued until the matching popDebugGroup() under this
+    /// label. Groups can be nested.
+    ///
+    /// This function does nothing if the system doesn't
+    /// support the KHR_debug extension.
+    ///
+    /// \param name Label of the group
+    ///
+    /// \see popDebugGroup
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushDebugGroup(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the group opened by the last call to pushDebugGroup
+    ///
+    /// \see pushDebugGroup
+    ///
+    ////////////////////////////////////////////////////////////
+    void popDebugGroup();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -466,13 +872,53 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the render target for drawing with SFML
+    ///
+    /// This function is called instead of setActive by the
+    /// drawing functions when the target is not active yet.
+    /// Contrary to setActive, which may be followed by any
+    /// direct OpenGL rendering, everything drawn after this
+    /// call is reported with onDraw.
+    ///
+    /// The default implementation calls setActive(true).
+    ///
+    /// \return True if operation was successful, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool activateForDrawing();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the derived class that pixels of the target were modified
+    ///
+    /// This function is called after every clear and draw call
+    /// with the area of the target that it may have touched.
+    /// The region is expressed in OpenGL window coordinates,
+    /// with the origin at the bottom-left corner of the target.
+    ///
+    /// The default implementation does nothing.
+    ///
+    /// \param region Area of the target that may have been modified
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDraw(const IntRect& region);
+
 private:
+    friend class CommandList;
+    friend class GpuProfiler;
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
     ////////////////////////////////////////////////////////////
     void applyCurrentView();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the scissor rectangle of the current view and clip rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyScissor();
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply a new blending mode
     ///
@@ -489,13 +935,24 @@ private:
     ////////////////////////////////////////////////////////////
     void applyStencilMode(const StencilMode& mode);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply a new depth mode
+    ///
+    /// The depth of the mode is ignored, see applyTransform.
+    ///
+    /// \param mode Depth mode to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyDepthMode(const DepthMode& mode);
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply a new transform
     ///
     /// \param transform Transform to apply
+    /// \param depth     Depth of the drawn vertices
     ///
     ////////////////////////////////////////////////////////////
-    void applyTransform(const Transform& transform);
+    void applyTransform(const Transform& transform, float depth);
 
     ////////////////////////////////////////////////////////////
     /// \brief Apply a new texture
@@ -514,6 +971,99 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices, bypassing the batch
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param parameters  Shader parameters of each vertex, or a null pointer to use the ones of \a states
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex*       vertices,
+                      std::size_t         vertexCount,
+                      PrimitiveType       type,
+                      const RenderStates& states,
+                      const Glsl::Vec4*   parameters = nullptr);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw instances with a single instanced draw call
+    ///
+    /// The vertices are either taken from \a vertexBuffer or, if
+    /// it is null, streamed from \a vertices.
+    ///
+    /// \param vertexBuffer  Vertex buffer holding the vertices of a single instance, or null
+    /// \param vertices      Pointer to the vertices of a single instance, used if \a vertexBuffer is null
+    /// \param vertexCount   Number of vertices of a single instance
+    /// \param type          Type of primitives to draw
+    /// \param transforms    Pointer to the transforms of the instances
+    /// \param colors        Pointer to the colors of the instances, or a null pointer to keep the vertex colors
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    /// \return False if hardware instancing can't be used, in which case nothing is drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    bool drawInstances(const VertexBuffer* vertexBuffer,
+                       const Vertex*       vertices,
+                       std::size_t         vertexCount,
+                       PrimitiveType       type,
+                       const Transform*    transforms,
+                       const Color*        colors,
+                       std::size_t         instanceCount,
+                       const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the built-in shader drawing instances in contexts with a fixed-function pipeline
+    ///
+    /// \return Pointer to the shader, or null if it failed to compile
+    ///
+    ////////////////////////////////////////////////////////////
+    Shader* getInstancingShader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the vertex arrays to the bound array buffer
+    ///
+    /// \param layout Layout of the vertices within the buffer
+    /// \param offset Offset of the first vertex within the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexPointers(const VertexLayout& layout, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append primitives to the pending batch
+    ///
+    /// Strips and fans are converted to their list equivalent
+    /// so that they can be merged with other draws.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param color       Color modulating the color of the vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void batchVertices(const Vertex*       vertices,
+                       std::size_t         vertexCount,
+                       PrimitiveType       type,
+                       const RenderStates& states,
+                       const Color&        color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the stencil buffer within the shape of a clip rectangle
+    ///
+    /// \param vertices  Corners of the shape, as a triangle strip
+    /// \param view      View the shape was defined with
+    /// \param reference Stencil value of the pixels to update
+    /// \param operation Update of the stencil values
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawClipShape(const std::array<Vertex, 4>& vertices,
+                       const View&                  view,
+                       StencilValue                 reference,
+                       StencilUpdateOperation       operation);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -533,6 +1083,24 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the contents of a vertex buffer, optionally through an index buffer
+    ///
+    /// Indexed draws take a single range, of indices.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, or null for non-indexed drawing
+    /// \param ranges       Pointer to the non-empty ranges of vertices (or indices) to render
+    /// \param rangeCount   Number of ranges
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawBuffers(const VertexBuffer& vertexBuffer,
+                     const IndexBuffer*  indexBuffer,
+                     const VertexRange*  ranges,
+                     std::size_t         rangeCount,
+                     const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -547,27 +1115,76 @@ private:
     ////////////////////////////////////////////////////////////
     struct StatesCache
     {
-        bool                  enable{};                //!< Is the cache enabled?
-        bool                  glStatesSet{};           //!< Are our internal GL states set yet?
-        bool                  viewChanged{};           //!< Has the current view changed since last draw?
-        bool                  scissorEnabled{};        //!< Is scissor testing enabled?
-        bool                  stencilEnabled{};        //!< Is stencil testing enabled?
-        BlendMode             lastBlendMode;           //!< Cached blending mode
-        StencilMode           lastStencilMode;         //!< Cached stencil
-        std::uint64_t         lastTextureId{};         //!< Cached texture
-        CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
-        bool                  texCoordsArrayEnabled{}; //!< Is GL_TEXTURE_COORD_ARRAY client state enabled?
-        bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
-        std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
+        bool                       enable{};                //!< Is the cache enabled?
+        bool                       glStatesSet{};           //!< Are our internal GL states set yet?
+        bool                       viewChanged{};           //!< Has the current view changed since last draw?
+        bool                       clipChanged{};           //!< Has the clip rectangle changed since last draw?
+        bool                       scissorEnabled{};        //!< Is scissor testing enabled?
+        bool                       stencilEnabled{};        //!< Is stencil testing enabled?
+        bool                       depthEnabled{};          //!< Is depth testing enabled?
+        Transform                  lastTransform;           //!< Cached model-view transform
+        float                      lastDepth{};             //!< Cached depth, part of the model-view matrix
+        BlendMode                  lastBlendMode;           //!< Cached blending mode
+        StencilMode                lastStencilMode;         //!< Cached stencil
+        DepthMode                  lastDepthMode;           //!< Cached depth mode
+        std::uint64_t              lastTextureId{};         //!< Cached texture
+        CoordinateType             lastCoordinateType{};    //!< Texture coordinate type
+        bool                       shaderBound{};           //!< Is a shader left bound by the last draw?
+        bool                       texCoordsArrayEnabled{}; //!< Is GL_TEXTURE_COORD_ARRAY client state enabled?
+        bool                       useVertexCache{};        //!< Did we previously use the vertex cache?
+        std::array<Vertex, 4>      vertexCache{};           //!< Pre-transformed vertices cache
+        IntRect                    drawRegion;              //!< Area reachable by draw calls with the current view
+        IntRect                    clearRegion;             //!< Area affected by clear calls with the current view
+        priv::CoreProfilePipeline* corePipeline{};          //!< Programmable pipeline of a core profile context, if any
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry waiting to be submitted as a single draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                    enabled{};    //!< Is automatic batching enabled?
+        PrimitiveType           type{};       //!< Primitive type of the pending vertices (Points, Lines or Triangles)
+        RenderStates            states;       //!< Render states shared by the pending vertices (identity transform)
+        std::vector<Vertex>     vertices{};   //!< Pending pre-transformed vertices
+        std::vector<Glsl::Vec4> parameters{}; //!< Shader parameters of every pending vertex, if they differ
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry of the clip rectangle stack
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ClipRect
+    {
+        IntRect               scissor;        //!< Scissor rectangle in pixels, intersected with the enclosing ones
+        unsigned int          stencilDepth{}; //!< Number of stencil clips up to this one, its stencil value
+        bool                  stencil{};      //!< Is this clip drawn to the stencil buffer?
+        std::array<Vertex, 4> vertices{};     //!< Corners of the stencil shape, as a triangle strip
+        View                  view;           //!< View the stencil shape was defined with
     };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                     m_defaultView;        //!< Default view
+    View                     m_view;               //!< Current view
+    FloatRect                m_visibleArea;        //!< Area of the scene seen through the current view
+    StatesCache              m_cache{};            //!< Render states cache
+    Batch                    m_batch{};            //!< Pending batched geometry
+    std::vector<Vertex>      m_instanceVertices{}; //!< Scratch storage for expanded instances
+    std::vector<Vertex>      m_instanceSource{};   //!< Scratch storage for the vertices read back from a buffer
+    std::shared_ptr<Shader>  m_instancingShader{}; //!< Built-in shader drawing instances, compiled on first use
+    std::vector<std::byte>   m_streamScratch{};    //!< Scratch storage for vertices streamed with their parameters
+    std::vector<VertexRange> m_multiDrawRanges{};  //!< Scratch storage for the clamped ranges of drawMulti
+    std::vector<int>         m_multiDrawFirsts{};  //!< First vertices passed to glMultiDrawArrays
+    std::vector<int>         m_multiDrawCounts{};  //!< Vertex counts passed to glMultiDrawArrays
+    std::vector<ClipRect>    m_clipStack{};        //!< Clip rectangles pushed and not popped yet
+    bool                     m_drawingClip{};      //!< Is a clip shape being drawn to the stencil buffer?
+    std::uint64_t            m_id{};               //!< Unique number that identifies the RenderTarget
+    Statistics               m_statistics{};       //!< Counters of the submitted work
+    bool                     m_cullingEnabled{};   //!< Are drawables outside the view skipped?
+    bool                     m_recording{};        //!< Are draws recorded by a sf::CommandList, not submitted?
 };
 
 } // namespace sf
@@ -595,6 +1212,12 @@ private:
 /// OpenGL states are not messed up by calling the
 /// pushGLStates/popGLStates functions.
 ///
+/// Draws are layered in the order they are submitted, unless
+/// they use depth testing (see sf::DepthMode): targets created
+/// with a depth buffer (sf::ContextSettings::depthBits) then
+/// let the GPU sort overlapping opaque draws, which can thus be
+/// grouped by texture and batched together.
+///
 /// While render targets are moveable, it is not valid to move them
 /// between threads. This will cause your program to crash. The
 /// problem boils down to OpenGL being limited with regard to how it
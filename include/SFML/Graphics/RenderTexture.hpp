@@ -34,6 +34,7 @@
 
 #include <SFML/Window/ContextSettings.hpp>
 
+#include <SFML/System/MemoryStats.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <memory>
@@ -157,6 +158,33 @@ public:
     ////////////////////////////////////////////////////////////
     bool isRepeated() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare whether the colors of the texture are premultiplied by their alpha
+    ///
+    /// This function is similar to Texture::setPremultipliedAlpha.
+    /// Whatever is drawn with sf::BlendAlpha into a render texture
+    /// cleared with a transparent color is premultiplied; enabling
+    /// this lets the render texture be composited as a layer with
+    /// a single draw of a sprite.
+    /// This parameter is disabled by default.
+    ///
+    /// \param premultiplied True if the colors are premultiplied by their alpha
+    ///
+    /// \see isPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPremultipliedAlpha(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the colors of the texture are premultiplied by their alpha
+    ///
+    /// \return True if the colors are premultiplied, false if they are straight
+    ///
+    /// \see setPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPremultipliedAlpha() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Generate a mipmap using the current texture data
     ///
@@ -183,6 +211,11 @@ public:
     /// want to draw OpenGL geometry to another render target
     /// (like a RenderWindow) don't forget to activate it again.
     ///
+    /// Since direct OpenGL rendering may draw anywhere, activating
+    /// the render-texture with this function makes the next call
+    /// to display update the whole texture. Drawing with SFML only
+    /// updates the area that was actually drawn to.
+    ///
     /// \param active True to activate, false to deactivate
     ///
     /// \return True if operation was successful, false otherwise
@@ -201,6 +234,23 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the contents of the depth and stencil buffers
+    ///
+    /// Call this function once the depth and stencil values of
+    /// the current frame are no longer needed, typically right
+    /// before display. It allows the driver to skip writing them
+    /// back to video memory, which saves a lot of bandwidth on
+    /// tiled GPUs. The depth and stencil contents are undefined
+    /// afterwards until they are cleared again.
+    ///
+    /// This function does nothing if the render-texture has
+    /// no depth or stencil buffer, or if the system doesn't
+    /// support invalidating framebuffer attachments.
+    ///
+    ////////////////////////////////////////////////////////////
+    void discardDepthStencil();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the texture
     ///
@@ -240,6 +290,22 @@ public:
     const Texture& getTexture() const;
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the render-texture for drawing with SFML
+    ///
+    /// \return True if operation was successful, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool activateForDrawing() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Track the area that display has to update
+    ///
+    /// \param region Area of the target that may have been modified
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDraw(const IntRect& region) override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct from texture
     ///
@@ -251,6 +317,8 @@ private:
     ////////////////////////////////////////////////////////////
     std::unique_ptr<priv::RenderTextureImpl> m_impl;    //!< Platform/hardware specific implementation
     Texture                                  m_texture; //!< Target texture to draw on
+
+    priv::MemoryCounter<MemoryStats::Category::RenderTexture> m_memoryCounter; //!< Counts the render texture
 };
 
 } // namespace sf
@@ -272,6 +340,25 @@ private:
 /// \li creating a sprite from a 3D object rendered with OpenGL
 /// \li etc.
 ///
+/// Render textures can be drawn to from several threads at
+/// the same time, each thread using its own render textures.
+/// A render texture drawn to from a thread without an active
+/// context creates a context of its own, and SFML tracks the
+/// state of each context without any global lock once it's
+/// active, so offscreen rendering scales with the number of
+/// threads.
+/// Switching between render textures, or between threads,
+/// still synchronizes the threads, so each worker should keep
+/// drawing to the same render texture as long as possible.
+///
+/// On Linux, SFML builds that use OpenGL ES (SFML_OPENGL_ES)
+/// can render to textures without a display server: set the
+/// SFML_EGL_PLATFORM environment variable to "surfaceless" or
+/// "device" before the first context is created, and with
+/// "device", SFML_EGL_DEVICE to the index of the GPU to use.
+/// The default desktop OpenGL build (GLX) and the DRM build
+/// ignore these variables.
+///
 /// Usage example:
 ///
 /// \code
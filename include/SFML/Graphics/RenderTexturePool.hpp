@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Recycler of transient render textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys all the render textures of the pool, including
+    /// the ones that are still acquired.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(RenderTexturePool&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(RenderTexturePool&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Acquire a render texture for the current frame
+    ///
+    /// A free render texture with the same size and the same
+    /// depth, stencil, antialiasing and sRGB settings is reused
+    /// if there is one, otherwise a new one is created.
+    ///
+    /// The returned render texture has its default view and
+    /// is neither smooth nor repeated, but its contents are
+    /// undefined: clear it before drawing to it.
+    ///
+    /// It stays acquired until it is given back with release,
+    /// or until the next call to endFrame, and remains owned
+    /// by the pool.
+    ///
+    /// \param size     Width and height of the render texture
+    /// \param settings Settings of the render texture, see sf::RenderTexture::create
+    ///
+    /// \return Pointer to the render texture, or a null pointer if it could not be created
+    ///
+    /// \see release, endFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(const Vector2u& size, const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give back a render texture before the end of the frame
+    ///
+    /// This lets the following calls to acquire reuse the render
+    /// texture within the same frame, for example to ping-pong
+    /// between two targets in a chain of effects. The render
+    /// texture must not be used after being released.
+    ///
+    /// \param renderTexture Render texture previously returned by acquire
+    ///
+    /// \see acquire
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(const RenderTexture& renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the end of a frame
+    ///
+    /// All the render textures that are still acquired are
+    /// released, and the ones that were not acquired during
+    /// the last getMaxUnusedFrames() frames are destroyed.
+    ///
+    /// \see acquire, setMaxUnusedFrames
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how many frames an unused render texture is kept
+    ///
+    /// Keeping render textures around for a few frames avoids
+    /// recreating them when an effect is disabled briefly.
+    /// The default is 2 frames, 0 destroys the render textures
+    /// that were not acquired during the frame that just ended.
+    ///
+    /// \param frames Number of frames without being acquired after which a render texture is destroyed
+    ///
+    /// \see getMaxUnusedFrames, endFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxUnusedFrames(unsigned int frames);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how many frames an unused render texture is kept
+    ///
+    /// \return Number of frames without being acquired after which a render texture is destroyed
+    ///
+    /// \see setMaxUnusedFrames
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getMaxUnusedFrames() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the render textures that are not acquired
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures owned by the pool
+    ///
+    /// \return Number of render textures, acquired or not
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getTextureCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures currently acquired
+    ///
+    /// \return Number of acquired render textures
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getAcquiredCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Render texture owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::unique_ptr<RenderTexture> renderTexture; //!< Render texture, on the heap so that its address is stable
+        ContextSettings                settings;      //!< Settings the render texture was created with
+        std::uint64_t                  lastFrame{};   //!< Last frame during which the render texture was acquired
+        bool                           acquired{};    //!< Is the render texture currently handed out?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry> m_entries;            //!< Render textures of the pool
+    std::uint64_t      m_frame{};            //!< Index of the current frame
+    unsigned int       m_maxUnusedFrames{2}; //!< Number of frames an unused render texture is kept
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Post-processing effects usually need a few intermediate
+/// render textures each frame. Creating them on the fly is
+/// expensive: each sf::RenderTexture allocates a texture,
+/// depth/stencil buffers and a frame buffer object per context.
+///
+/// sf::RenderTexturePool keeps the render textures alive between
+/// frames and hands them out again to requests with the same size
+/// and settings. Render textures are acquired during a frame,
+/// optionally released early so that a chain of effects can
+/// reuse them, and all returned to the pool by endFrame. Render
+/// textures that are no longer requested are destroyed after
+/// a few frames.
+///
+/// The pool is not thread-safe; it is meant to be used by the
+/// thread that renders the frames.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// while (window.isOpen())
+/// {
+///     // Draw the scene in a first render texture
+///     sf::RenderTexture* scene = pool.acquire(window.getSize());
+///     scene->clear();
+///     scene->draw(background);
+///     scene->display();
+///
+///     // Blur it into a second one
+///     sf::RenderTexture* blurred = pool.acquire(window.getSize());
+///     blurred->clear();
+///     blurred->draw(sf::Sprite(scene->getTexture()), &blurShader);
+///     blurred->display();
+///     pool.release(*scene);
+///
+///     window.clear();
+///     window.draw(sf::Sprite(blurred->getTexture()));
+///     window.display();
+///
+///     // Give everything back to the pool
+///     pool.endFrame();
+/// }
+/// \endcode
+///
+/// \see sf::RenderTexture
+///
+////////////////////////////////////////////////////////////
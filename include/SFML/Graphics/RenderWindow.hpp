@@ -39,6 +39,8 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <vector>
+
 #include <cstdint>
 
 
@@ -178,6 +180,52 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setActive(bool active = true) override;
 
+    using Window::display;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Display on screen the regions of the window that changed
+    ///
+    /// Only the given regions, and those marked with addDamage
+    /// or found by damage tracking, are sent to the window system.
+    /// The rest of the window must be unchanged since the previous
+    /// frame (see getBufferAge). If no region is given, the whole
+    /// window is displayed.
+    ///
+    /// \param damage Modified regions, in pixels
+    ///
+    /// \see setDamageTrackingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void display(const std::vector<IntRect>& damage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the tracking of the modified regions
+    ///
+    /// When enabled, the area that each clear and draw call can
+    /// reach (the viewport of the current view, limited by its
+    /// scissor rectangle) is marked as damaged, and display only
+    /// presents these regions. Redrawing only a dirty rectangle
+    /// then boils down to setting a view whose scissor covers it.
+    ///
+    /// Damage tracking is disabled by default.
+    ///
+    /// \param enabled True to enable damage tracking, false to disable it
+    ///
+    /// \see isDamageTrackingEnabled, display
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDamageTrackingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the modified regions are tracked
+    ///
+    /// \return True if damage tracking is enabled, false otherwise
+    ///
+    /// \see setDamageTrackingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDamageTrackingEnabled() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Function called after the window has been created
@@ -198,11 +246,29 @@ protected:
     ////////////////////////////////////////////////////////////
     void onResize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the pending batched geometry before the window is displayed
+    ///
+    /// This is done even when display() is called through a
+    /// sf::Window reference.
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDisplay() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the modified region as damaged if damage tracking is enabled
+    ///
+    /// \param region Area of the window that may have been modified, in OpenGL coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDraw(const IntRect& region) override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     unsigned int m_defaultFrameBuffer{}; //!< Framebuffer to bind when targeting this window
+    bool         m_damageTracking{};     //!< Are the regions modified by draw calls marked as damaged?
 };
 
 } // namespace sf
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of worker threads loading graphics resources in the background
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ResourceLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Starts one worker thread per hardware thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the loader with a given number of worker threads
+    ///
+    /// \param threadCount Number of worker threads, at least one is started
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ResourceLoader(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Completes the jobs that are still queued, then stops
+    /// the worker threads.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ResourceLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceLoader(const ResourceLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an image from a file in the background
+    ///
+    /// \param filename Path of the image file to load
+    ///
+    /// \return Future receiving the image, or `std::nullopt` if loading failed
+    ///
+    /// \see sf::Image::loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<Image>> loadImage(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a texture from a file in the background
+    ///
+    /// The image is decoded and uploaded on a worker thread.
+    /// The texture is ready to be drawn in any context when
+    /// the future receives it.
+    ///
+    /// \param filename Path of the image file to load
+    /// \param sRgb     True to enable sRGB conversion, false to disable it
+    ///
+    /// \return Future receiving the texture, or `std::nullopt` if loading failed
+    ///
+    /// \see sf::Texture::loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<Texture>> loadTexture(const std::filesystem::path& filename,
+                                                                  bool                         sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a font from a file in the background
+    ///
+    /// \param filename Path of the font file to load
+    ///
+    /// \return Future receiving the font, or `std::nullopt` if loading failed
+    ///
+    /// \see sf::Font::loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<Font>> loadFont(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load both the vertex and fragment shaders from files in the background
+    ///
+    /// \param vertexShaderFilename   Path of the vertex shader file to load
+    /// \param fragmentShaderFilename Path of the fragment shader file to load
+    ///
+    /// \return Future receiving the shader, or `std::nullopt` if loading failed
+    ///
+    /// \see sf::Shader::loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<Shader>> loadShader(const std::filesystem::path& vertexShaderFilename,
+                                                                const std::filesystem::path& fragmentShaderFilename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run an arbitrary job on a worker thread
+    ///
+    /// A context is active while the job runs, so it can create
+    /// and update any graphics resource. Results can be handed
+    /// back by capturing the destination, or through the
+    /// returned future, which also receives any exception thrown
+    /// by the job.
+    ///
+    /// \param job Function to call on a worker thread
+    ///
+    /// \return Future signaled when the job is complete
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<void> enqueue(std::function<void()> job);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads of the loader
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getThreadCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a job whose result is handed back through a future
+    ///
+    /// \param job Function to call on a worker thread
+    ///
+    /// \return Future receiving the result of the job
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    std::future<T> submit(std::function<T()> job);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Main function of the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex                        m_mutex;      //!< Mutex protecting the job queue
+    std::condition_variable           m_condition;  //!< Condition signaled when a job is queued or the loader stops
+    std::deque<std::function<void()>> m_jobs;       //!< Jobs waiting for a worker thread
+    bool                              m_stopping{}; //!< Are the worker threads asked to stop?
+    std::vector<std::thread>          m_threads;    //!< Worker threads
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ResourceLoader
+/// \ingroup graphics
+///
+/// sf::ResourceLoader loads images, textures, fonts and shaders
+/// on a pool of worker threads, so that the application keeps
+/// rendering while a level is loading.
+///
+/// Each worker thread owns an OpenGL context, shared with all
+/// the other contexts of the application, which stays active
+/// for the whole life of the thread. Resources created by the
+/// workers are thus decoded and uploaded in parallel, without
+/// waiting for each other or for the rendering thread.
+///
+/// Every load function returns a std::future which receives
+/// the resource once it is ready. Polling the future once per
+/// frame lets the application pick up resources as they arrive
+/// without ever blocking.
+///
+/// Example:
+/// \code
+/// sf::ResourceLoader loader;
+///
+/// auto futureTexture = loader.loadTexture("background.png");
+/// auto futureFont    = loader.loadFont("arial.ttf");
+///
+/// // Do other things while the resources are loading...
+///
+/// std::optional<sf::Texture> texture = futureTexture.get();
+/// std::optional<sf::Font>    font    = futureFont.get();
+/// if (!texture || !font)
+///     return -1;
+/// \endcode
+///
+/// Jobs that are still queued when the loader is destroyed
+/// are completed before its destructor returns.
+///
+/// \see sf::Texture, sf::Font, sf::Shader, sf::Image
+///
+////////////////////////////////////////////////////////////
@@ -33,11 +33,15 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <SFML/System/Allocator.hpp>
+#include <SFML/System/MemoryStats.hpp>
+
+#include <array>
 #include <filesystem>
 #include <optional>
 #include <string>
 #include <string_view>
-#include <unordered_map>
+#include <vector>
 
 #include <cstddef>
 
@@ -46,6 +50,8 @@ namespace sf
 {
 class InputStream;
 class Texture;
+class TextureArray;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -85,6 +91,56 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle to a uniform variable of a shader
+    ///
+    /// A handle is obtained once with getUniformHandle() and
+    /// allows setting the uniform afterwards without looking
+    /// up its name again. A handle is only meaningful for the
+    /// shader that created it.
+    ///
+    /// \see getUniformHandle
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API UniformHandle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid handle, setting a uniform
+        /// through it has no effect.
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to a uniform
+        ///
+        /// \return True if the uniform was found in the shader
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isValid() const;
+
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the handle from a slot index
+        ///
+        /// \param slot Index of the uniform slot in the shader
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit UniformHandle(std::size_t slot);
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        static constexpr std::size_t invalidSlot{static_cast<std::size_t>(-1)}; //!< Slot of invalid handles
+
+        std::size_t m_slot{invalidSlot}; //!< Index of the uniform slot in the shader
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -314,6 +370,60 @@ public:
                                                               InputStream& geometryShaderStream,
                                                               InputStream& fragmentShaderStream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start compiling the vertex, geometry or fragment shader from source code in memory
+    ///
+    /// This function works like loadFromMemory, except that it
+    /// doesn't wait for the driver to compile and link the
+    /// shader: it only fails if shaders are not supported. Start
+    /// all the shaders that you need first, then poll isReady
+    /// every frame; when the driver supports parallel compilation
+    /// (see isParallelCompilationAvailable), the shaders are
+    /// compiled by the threads of the driver in the meantime.
+    ///
+    /// Using the shader before it is ready waits for the end of
+    /// its compilation.
+    ///
+    /// \param shader String containing the source code of the shader
+    /// \param type   Type of shader (vertex, geometry or fragment)
+    ///
+    /// \return Shader being compiled, `std::nullopt` if shaders are not supported
+    ///
+    /// \see isReady, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Shader> loadFromMemoryAsync(std::string_view shader, Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start compiling both the vertex and fragment shaders from source codes in memory
+    ///
+    /// \param vertexShader   String containing the source code of the vertex shader
+    /// \param fragmentShader String containing the source code of the fragment shader
+    ///
+    /// \return Shader being compiled, `std::nullopt` if shaders are not supported
+    ///
+    /// \see isReady, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Shader> loadFromMemoryAsync(std::string_view vertexShader,
+                                                                   std::string_view fragmentShader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start compiling the vertex, geometry and fragment shaders from source codes in memory
+    ///
+    /// \param vertexShader   String containing the source code of the vertex shader
+    /// \param geometryShader String containing the source code of the geometry shader
+    /// \param fragmentShader String containing the source code of the fragment shader
+    ///
+    /// \return Shader being compiled, `std::nullopt` if shaders are not supported
+    ///
+    /// \see isReady, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Shader> loadFromMemoryAsync(std::string_view vertexShader,
+                                                                   std::string_view geometryShader,
+                                                                   std::string_view fragmentShader);
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
@@ -495,6 +605,35 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniform(const std::string& name, Texture&& texture) = delete;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a texture array as \p sampler2DArray uniform
+    ///
+    /// The corresponding parameter in the shader must be a 2D
+    /// texture array (\p sampler2DArray GLSL type, which requires
+    /// GLSL 1.30 or the GL_EXT_texture_array extension).
+    ///
+    /// Example:
+    /// \code
+    /// uniform sampler2DArray the_layers; // this is the variable in the shader
+    /// \endcode
+    /// \code
+    /// shader.setUniform("the_layers", textureArray);
+    /// \endcode
+    /// It is important to note that \a textureArray must remain
+    /// alive as long as the shader uses it, no copy is made internally.
+    ///
+    /// \param name         Name of the texture array in the shader
+    /// \param textureArray Texture array to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(const std::string& name, const TextureArray& textureArray);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(const std::string& name, TextureArray&& textureArray) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify current texture as \p sampler2D uniform
     ///
@@ -578,6 +717,173 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform variable
+    ///
+    /// The location of the uniform is looked up once, the
+    /// returned handle can then be passed to the setUniform()
+    /// overloads taking a handle, which neither hash the name
+    /// nor touch the OpenGL state.
+    ///
+    /// Values set through a handle are stored in the shader
+    /// and uploaded all at once the next time the shader is
+    /// bound. They take precedence over values set by name for
+    /// the same uniform since the last bind.
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle to the uniform, invalid if the uniform doesn't exist
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle getUniformHandle(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param x      Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec2& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param x      Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec2& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param x      Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec2& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 matrix, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param matrix Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 matrix, deferred until the shader is bound
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param matrix Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a uniform buffer to a uniform block
+    ///
+    /// The uniform block \p name of the shader sources its
+    /// values from \p buffer whenever the shader is bound.
+    /// Updating the buffer changes the values of all its
+    /// uniforms at once, in every shader it is attached to.
+    ///
+    /// It is important to note that \p buffer must remain alive
+    /// as long as the shader uses it, no copy is made internally.
+    ///
+    /// \param name   Name of the uniform block in GLSL
+    /// \param buffer Uniform buffer holding the values of the block
+    ///
+    /// \return True if the block was found and the buffer attached
+    ///
+    /// \see sf::UniformBuffer::isAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -590,6 +896,25 @@ public:
     ////////////////////////////////////////////////////////////
     unsigned int getNativeHandle() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the compilation of the shader is over
+    ///
+    /// Shaders loaded with loadFromMemoryAsync are compiled in
+    /// the background; this function tells whether the driver is
+    /// done with them, without waiting when parallel compilation
+    /// is available. Once it returns true, errors have been
+    /// written to sf::err() and getNativeHandle returns 0 if the
+    /// shader failed to compile or link.
+    ///
+    /// Shaders loaded synchronously are always ready.
+    ///
+    /// \return True if the shader can be used without waiting
+    ///
+    /// \see loadFromMemoryAsync, isParallelCompilationAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind a shader for rendering
     ///
@@ -644,7 +969,54 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the driver compiles shaders in parallel
+    ///
+    /// This requires the KHR_parallel_shader_compile or
+    /// ARB_parallel_shader_compile extension. Without it,
+    /// isReady waits for the end of the compilation.
+    ///
+    /// \return True if shaders are compiled in the background
+    ///
+    /// \see loadFromMemoryAsync, isReady
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isParallelCompilationAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the directory where linked shader programs are cached
+    ///
+    /// When a cache directory is set, the binary of every program
+    /// successfully linked is saved there, and loading the same
+    /// sources again on the same driver reuses it instead of
+    /// compiling them. The cache is keyed by the sources and by
+    /// the vendor, renderer and version of the OpenGL driver; a
+    /// binary rejected by the driver is silently replaced by a
+    /// fresh compilation.
+    ///
+    /// The cache requires program binaries (OpenGL 4.1 or
+    /// ARB_get_program_binary); it is ignored otherwise.
+    ///
+    /// \param directory Cache directory, or an empty path to disable the cache (the default)
+    ///
+    /// \see getBinaryCacheDirectory
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBinaryCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory where linked shader programs are cached
+    ///
+    /// \return Cache directory, empty if the cache is disabled
+    ///
+    /// \see setBinaryCacheDirectory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::filesystem::path getBinaryCacheDirectory();
+
 private:
+    friend class RenderTarget;
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct from shader program
     ///
@@ -668,6 +1040,28 @@ private:
                                                        std::string_view geometryShaderCode,
                                                        std::string_view fragmentShaderCode);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Issue the compilation of the shader(s) without waiting for the result
+    ///
+    /// \param vertexShaderCode   Source code of the vertex shader
+    /// \param geometryShaderCode Source code of the geometry shader
+    /// \param fragmentShaderCode Source code of the fragment shader
+    ///
+    /// \return Shader being compiled, `std::nullopt` if shaders are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Shader> compileAsync(std::string_view vertexShaderCode,
+                                                            std::string_view geometryShaderCode,
+                                                            std::string_view fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for the end of a pending compilation and check its result
+    ///
+    /// On failure, the program is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void finishCompilation() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind all the textures used by the shader
     ///
@@ -687,6 +1081,52 @@ private:
     ////////////////////////////////////////////////////////////
     int getUniformLocation(const std::string& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the location of a vertex attribute of the shader
+    ///
+    /// \param name Name of the attribute variable to search
+    ///
+    /// \return Location of the attribute, or -1 if not found
+    ///
+    ////////////////////////////////////////////////////////////
+    int getAttributeLocation(const std::string& name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Value set through a uniform handle
+    ///
+    /// Definition is in the member data section below.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DeferredUniform;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the slot of a uniform handle and schedule its upload
+    ///
+    /// \param handle Handle to the uniform variable
+    ///
+    /// \return Slot to store the value in, or null if the handle is invalid
+    ///
+    ////////////////////////////////////////////////////////////
+    DeferredUniform* getPendingUniform(UniformHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values set through handles since the last bind
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadDeferredUniforms() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the uniform buffers attached to the uniform blocks
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the memory used by the caches to sf::MemoryStats
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateMemoryUsage() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief RAII object to save and restore the program
     ///        binding while uniforms are being set
@@ -699,16 +1139,77 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int>;
+    using TextureTable      = priv::UnorderedMap<int, const Texture*, MemoryModule::Graphics>;
+    using TextureArrayTable = priv::UnorderedMap<int, const TextureArray*, MemoryModule::Graphics>;
+    using UniformTable      = priv::UnorderedMap<std::string, int, MemoryModule::Graphics>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Kinds of values that can be set through a uniform handle
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class DeferredType
+    {
+        Float,
+        Vec2,
+        Vec3,
+        Vec4,
+        Int,
+        Ivec2,
+        Ivec3,
+        Ivec4,
+        Mat3,
+        Mat4
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Value set through a uniform handle
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DeferredUniform
+    {
+        int                   location{-1};              //!< Location of the uniform in the shader
+        DeferredType          type{DeferredType::Float}; //!< Kind of value to upload
+        bool                  pending{};                 //!< Has the value changed since the last bind?
+        std::array<float, 16> floats{};                  //!< Components of floating-point values and matrices
+        std::array<int, 4>    ints{};                    //!< Components of integer and boolean values
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform buffer attached to a uniform block
+    ///
+    ////////////////////////////////////////////////////////////
+    struct UniformBlock
+    {
+        unsigned int         index{};  //!< Index of the uniform block in the shader
+        const UniformBuffer* buffer{}; //!< Buffer holding the values of the block
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compilation issued to the driver but not checked yet
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PendingCompilation
+    {
+        std::array<unsigned int, 3> shaders{};     //!< Vertex, geometry and fragment shader objects, 0 if unused
+        std::filesystem::path       cacheFilename; //!< Where to save the binary of the program, empty if not cached
+    };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    mutable unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
+    int                  m_currentTexture{-1}; //!< Location of the current texture in the shader
+    TextureTable         m_textures;           //!< Texture variables in the shader, mapped to their location
+    TextureArrayTable    m_textureArrays;      //!< Texture array variables in the shader, mapped to their location
+    UniformTable         m_uniforms;           //!< Parameters location cache
+    mutable UniformTable m_attributes;         //!< Vertex attributes location cache
+
+    mutable std::vector<DeferredUniform>      m_deferredUniforms;   //!< Values set through uniform handles
+    mutable std::vector<std::size_t>          m_pendingUniforms;    //!< Slots of the values to upload at the next bind
+    std::vector<UniformBlock>                 m_uniformBlocks;      //!< Uniform blocks, indexed by binding point
+    mutable std::optional<PendingCompilation> m_pendingCompilation; //!< Compilation running in the background
+
+    mutable priv::MemoryCounter<MemoryStats::Category::Shader> m_memoryCounter; //!< Counts the shader and its caches
 };
 
 } // namespace sf
@@ -775,6 +1276,21 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Setting a uniform by name looks its location up every
+/// time. When many uniforms change every frame, get a handle
+/// to each of them once, and set them through the handle:
+/// values set this way are stored in the shader and uploaded
+/// together the next time it is bound.
+/// \code
+/// const sf::Shader::UniformHandle offset = shader.getUniformHandle("offset");
+/// ...
+/// shader.setUniform(offset, 2.f);
+/// \endcode
+///
+/// Uniforms grouped in a GLSL uniform block can also be stored
+/// in a sf::UniformBuffer attached with setUniformBlock(), and
+/// updated all at once.
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the \ref RenderWindow::draw function:
 /// \code
@@ -39,6 +39,8 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <vector>
+
 #include <cstddef>
 
 
@@ -215,6 +217,26 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Vector2f getPoint(std::size_t index) const = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the shape
+    ///
+    /// This function writes the result of getPoint for every
+    /// index in range [0 .. getPointCount() - 1] to \a points,
+    /// which must have room for getPointCount() elements.
+    ///
+    /// It is used to build the geometry of the shape, which
+    /// costs a single virtual call instead of one per point.
+    /// The default implementation calls getPoint for each point;
+    /// derived classes can override it when they can produce
+    /// all their points faster.
+    ///
+    /// \param points Array receiving the points, in local coordinates
+    ///
+    /// \see getPoint, getPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void getPoints(Vector2f* points) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the geometric center of the shape
     ///
@@ -270,6 +292,10 @@ protected:
     /// the shape's points change (i.e. the result of either
     /// getPointCount or getPoint is different).
     ///
+    /// The geometry is not recomputed immediately but the next
+    /// time it is needed, so calling this function several times
+    /// in a row is cheap.
+    ///
     ////////////////////////////////////////////////////////////
     void update();
 
@@ -283,42 +309,60 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the geometry is updated
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' position and the inside bounds
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateFill() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateFillColors();
+    void updateFillColors() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' texture coordinates
     ///
     ////////////////////////////////////////////////////////////
-    void updateTexCoords();
+    void updateTexCoords() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' position
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutline();
+    void updateOutline() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineColors();
+    void updateOutlineColors() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture{};                  //!< Texture of the shape
-    IntRect        m_textureRect;                //!< Rectangle defining the area of the source texture to display
-    Color          m_fillColor{Color::White};    //!< Fill color
-    Color          m_outlineColor{Color::White}; //!< Outline color
-    float          m_outlineThickness{};         //!< Thickness of the shape's outline
-    VertexArray    m_vertices{PrimitiveType::TriangleFan};          //!< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices{PrimitiveType::TriangleStrip}; //!< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;                                  //!< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds; //!< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*                m_texture{};                                     //!< Texture of the shape
+    IntRect                       m_textureRect;                                   //!< Displayed area of the texture
+    Color                         m_fillColor{Color::White};                       //!< Fill color
+    Color                         m_outlineColor{Color::White};                    //!< Outline color
+    float                         m_outlineThickness{};                            //!< Thickness of the shape's outline
+    mutable VertexArray           m_vertices{PrimitiveType::TriangleFan};          //!< Fill geometry
+    mutable VertexArray           m_outlineVertices{PrimitiveType::TriangleStrip}; //!< Outline geometry
+    mutable std::vector<Vector2f> m_points;                                        //!< Points fetched with getPoints
+    mutable FloatRect             m_insideBounds;                                  //!< Bounds of the fill
+    mutable FloatRect             m_bounds;                                        //!< Bounds of the fill and outline
+    mutable bool                  m_fillNeedUpdate{};                              //!< Must the fill be recomputed?
+    mutable bool                  m_fillColorsNeedUpdate{};                        //!< Must the fill colors be set?
+    mutable bool                  m_texCoordsNeedUpdate{};                         //!< Must texCoords be recomputed?
+    mutable bool                  m_outlineNeedUpdate{};                           //!< Must the outline be recomputed?
+    mutable bool                  m_outlineColorsNeedUpdate{};                     //!< Must the outline colors be set?
 };
 
 } // namespace sf
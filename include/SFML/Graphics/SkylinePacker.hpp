@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Rectangle packer based on the skyline bottom-left heuristic
+///
+/// The packer keeps track of the top edge (the "skyline") of
+/// the rectangles already placed in an area, and places every
+/// new rectangle at the position where its top edge ends up
+/// the lowest. This packs rectangles of varying heights much
+/// more tightly than fixed-height shelves while staying cheap
+/// enough to be used at runtime.
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SkylinePacker
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packer
+    ///
+    /// \param size Size of the area to pack rectangles into
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SkylinePacker(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a place for a rectangle and reserve it
+    ///
+    /// \param size Size of the rectangle to place
+    ///
+    /// \return Area reserved for the rectangle, or an empty
+    ///         optional if there is not enough space left
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Rect<unsigned int>> insert(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enlarge the area rectangles are packed into
+    ///
+    /// Rectangles already placed keep their position. Sizes
+    /// smaller than the current size are ignored.
+    ///
+    /// \param size New size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release all the rectangles placed so far
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the area rectangles are packed into
+    ///
+    /// \return Size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total area of the rectangles placed so far
+    ///
+    /// \return Used area, in square pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getUsedArea() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal segment of the skyline
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        unsigned int x{};     //!< Left edge of the segment
+        unsigned int y{};     //!< Height of the skyline over the segment
+        unsigned int width{}; //!< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find where a rectangle would land if placed at the left edge of a segment
+    ///
+    /// \param index Index of the segment
+    /// \param size  Size of the rectangle
+    ///
+    /// \return Top of the rectangle, or an empty optional if it doesn't fit there
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<unsigned int> fit(std::size_t index, const Vector2u& size) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;       //!< Size of the area rectangles are packed into
+    std::vector<Segment> m_skyline;    //!< Segments of the skyline, sorted from left to right
+    std::uint64_t        m_usedArea{}; //!< Total area of the rectangles placed so far
+};
+
+} // namespace sf::priv
@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Uniform grid indexing rectangles for fast area queries
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpatialGrid
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an item stored in the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty grid
+    ///
+    /// The cell size should be in the order of the size of the
+    /// indexed items: an item covers every cell its bounds
+    /// overlap, and a query visits every cell the queried area
+    /// overlaps.
+    ///
+    /// \param cellSize Width and height of a cell, in scene coordinates (must be positive)
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialGrid(float cellSize = 256.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an item to the grid
+    ///
+    /// The handle of a removed item may be returned again for
+    /// an item inserted later.
+    ///
+    /// \param bounds Bounding rectangle of the item, in scene coordinates
+    ///
+    /// \return Handle identifying the new item
+    ///
+    /// \see update, remove
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle insert(const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounding rectangle of an item
+    ///
+    /// Call this function when an indexed item moves or
+    /// changes size. Only the cells that the item enters or
+    /// leaves are updated.
+    ///
+    /// \param handle Handle of the item, as returned by insert
+    /// \param bounds New bounding rectangle of the item, in scene coordinates
+    ///
+    /// \see insert, getBounds
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Handle handle, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an item from the grid
+    ///
+    /// \param handle Handle of the item, as returned by insert
+    ///
+    /// \see insert, clear
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the items from the grid
+    ///
+    /// \see remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounding rectangle of an item
+    ///
+    /// \param handle Handle of the item, as returned by insert
+    ///
+    /// \return Bounding rectangle of the item, in scene coordinates
+    ///
+    /// \see update
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FloatRect& getBounds(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of items stored in the grid
+    ///
+    /// \return Number of items
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getItemCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the cells of the grid
+    ///
+    /// \return Width and height of a cell, in scene coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getCellSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the items overlapping an area
+    ///
+    /// The handles of the items whose bounds overlap \a area
+    /// are appended to \a result, each one once, in no
+    /// particular order. Items whose bounds only touch the
+    /// area are included.
+    ///
+    /// Queries are not thread-safe: a grid must not be queried
+    /// from several threads at the same time.
+    ///
+    /// \param area   Area to search, in scene coordinates
+    /// \param result Vector the handles of the found items are appended to
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const FloatRect& area, std::vector<Handle>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the items visible through a view
+    ///
+    /// This is equivalent to calling query(view.getVisibleArea(), result).
+    ///
+    /// \param view   View to search through
+    /// \param result Vector the handles of the found items are appended to
+    ///
+    /// \see View::getVisibleArea
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const View& view, std::vector<Handle>& result) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Item stored in the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Item
+    {
+        FloatRect             bounds;       //!< Bounding rectangle of the item
+        Vector2i              firstCell;    //!< Top-left cell covered by the item
+        Vector2i              lastCell;     //!< Bottom-right cell covered by the item
+        bool                  alive{};      //!< Is the item in the grid (false for free handles)?
+        bool                  large{};      //!< Does the item cover too many cells to be stored in them?
+        mutable std::uint64_t queryStamp{}; //!< Last query that reported the item
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handles of the items overlapping each cell, indexed by the packed cell coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    using CellMap = std::unordered_map<std::uint64_t, std::vector<Handle>>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cell containing a point
+    ///
+    /// \param point Point, in scene coordinates
+    ///
+    /// \return Coordinates of the cell
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2i getCell(const Vector2f& point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an item to the cells it covers
+    ///
+    /// \param handle Handle of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an item from the cells it covers
+    ///
+    /// \param handle Handle of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add or remove an item to the cells of a range
+    ///
+    /// \param handle    Handle of the item
+    /// \param firstCell Top-left cell of the range
+    /// \param lastCell  Bottom-right cell of the range
+    /// \param add       True to add the item to the cells, false to remove it
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateCells(Handle handle, const Vector2i& firstCell, const Vector2i& lastCell, bool add);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    float                 m_cellSize;     //!< Width and height of a cell
+    std::vector<Item>     m_items;        //!< Items, indexed by their handle
+    std::vector<Handle>   m_freeHandles;  //!< Handles of the removed items
+    std::vector<Handle>   m_largeItems;   //!< Handles of the items covering too many cells to be stored in them
+    CellMap               m_cells;        //!< Handles of the items overlapping each non-empty cell
+    mutable std::uint64_t m_queryStamp{}; //!< Identifier of the last query
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialGrid
+/// \ingroup graphics
+///
+/// Drawing a large world usually means drawing only the few
+/// entities that are visible through the current view.
+/// Testing all of them every frame is linear in the size of
+/// the world; sf::SpatialGrid splits the scene into square
+/// cells and remembers which items overlap each cell, so
+/// that finding the items in an area only looks at the cells
+/// it overlaps.
+///
+/// The grid doesn't store the items themselves, only their
+/// bounding rectangles: each item is identified by the handle
+/// returned when it is inserted, which can for example be an
+/// index into your own container. Only non-empty cells take
+/// memory, so the scene doesn't need to have known limits.
+///
+/// The grid works best for static scenery or items moving at
+/// a moderate pace, with items that are not much larger than
+/// a cell. Items covering a very large number of cells are
+/// kept aside and tested by every query instead.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::Sprite> trees = ...;
+///
+/// sf::SpatialGrid grid(128);
+/// for (const auto& tree : trees)
+///     grid.insert(tree.getGlobalBounds()); // handles are 0, 1, 2...
+///
+/// std::vector<sf::SpatialGrid::Handle> visible;
+///
+/// // In the main loop
+/// visible.clear();
+/// grid.query(window.getView(), visible);
+/// for (const auto handle : visible)
+///     window.draw(trees[handle]);
+/// \endcode
+///
+/// \see sf::View, sf::RenderTarget::setCullingEnabled
+///
+////////////////////////////////////////////////////////////
@@ -262,6 +262,11 @@ private:
 /// used by a sf::Sprite (i.e. never write a function that
 /// uses a local sf::Texture instance for creating a sprite).
 ///
+/// When its texture has premultiplied alpha (see
+/// sf::Texture::setPremultipliedAlpha), the sprite is drawn with
+/// sf::BlendPremultipliedAlpha instead of sf::BlendAlpha, and its
+/// color is premultiplied as well.
+///
 /// See also the note on coordinates and undistorted rendering in sf::Transformable.
 ///
 /// Usage example:
@@ -0,0 +1,569 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/ExecutionPolicy.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class Shader;
+class Sprite;
+class Texture;
+class TextureArray;
+
+////////////////////////////////////////////////////////////
+/// \brief Container drawing many textured quads efficiently
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty batch.
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite displaying a whole texture
+    ///
+    /// The new sprite is at position (0, 0), with origin (0, 0),
+    /// scale (1, 1), no rotation and a white color.
+    ///
+    /// \param texture Texture of the sprite, it must outlive the batch
+    ///
+    /// \return Index of the new sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite displaying a part of a texture
+    ///
+    /// The new sprite is at position (0, 0), with origin (0, 0),
+    /// scale (1, 1), no rotation and a white color.
+    ///
+    /// \param texture     Texture of the sprite, it must outlive the batch
+    /// \param textureRect Sub-rectangle of the texture to display
+    ///
+    /// \return Index of the new sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Texture& texture, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a copy of a sprite
+    ///
+    /// The texture, texture rectangle, color, position, origin,
+    /// scale and rotation of the sprite are copied.
+    ///
+    /// \param sprite Sprite to copy, its texture must outlive the batch
+    ///
+    /// \return Index of the new sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite displaying a whole layer of a texture array
+    ///
+    /// Sprites displaying layers of the same texture array are
+    /// drawn with a single draw call, whatever their layer.
+    /// The new sprite is at position (0, 0), with origin (0, 0),
+    /// scale (1, 1), no rotation and a white color.
+    ///
+    /// \param textureArray Texture array of the sprite, it must outlive the batch
+    /// \param layer        Index of the layer to display
+    ///
+    /// \return Index of the new sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const TextureArray& textureArray, unsigned int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite displaying a part of a layer of a texture array
+    ///
+    /// \param textureArray Texture array of the sprite, it must outlive the batch
+    /// \param layer        Index of the layer to display
+    /// \param textureRect  Sub-rectangle of the layer to display
+    ///
+    /// \return Index of the new sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const TextureArray& textureArray, unsigned int layer, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a sprite
+    ///
+    /// The last sprite of the batch is moved to \a index
+    /// to fill the gap, so this operation doesn't shift the
+    /// other sprites, but it changes the index of the last one.
+    ///
+    /// \param index Index of the sprite to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for a number of sprites
+    ///
+    /// \param spriteCount Number of sprites to reserve memory for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t spriteCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sprites in the batch
+    ///
+    /// \return Number of sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSpriteCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture of a sprite
+    ///
+    /// The texture rectangle of the sprite is left unchanged.
+    ///
+    /// \param index   Index of the sprite
+    /// \param texture New texture, it must outlive the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(std::size_t index, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(std::size_t index, Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a sprite
+    ///
+    /// The sprite must display a texture, not a layer of a
+    /// texture array.
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Texture of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make a sprite display a layer of a texture array
+    ///
+    /// The texture rectangle of the sprite is left unchanged.
+    ///
+    /// \param index        Index of the sprite
+    /// \param textureArray New texture array, it must outlive the batch
+    /// \param layer        Index of the layer to display
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureArray(std::size_t index, const TextureArray& textureArray, unsigned int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureArray(std::size_t index, TextureArray&& textureArray, unsigned int layer) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture array of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Texture array of the sprite, or a null pointer if it displays a texture
+    ///
+    ////////////////////////////////////////////////////////////
+    const TextureArray* getTextureArray(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the texture array that a sprite displays
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Index of the layer, 0 if the sprite displays a texture
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getLayer(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture that a sprite displays
+    ///
+    /// \param index       Index of the sprite
+    /// \param textureRect Rectangle defining the region of the texture to display
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(std::size_t index, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture that a sprite displays
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Texture rectangle of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const IntRect& getTextureRect(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a sprite
+    ///
+    /// \param index    Index of the sprite
+    /// \param position New position, in the local coordinates of the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(std::size_t index, const Vector2f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Position of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getPosition(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the origin of a sprite
+    ///
+    /// The origin is the point of the sprite, in its local
+    /// coordinates, around which it is positioned, rotated
+    /// and scaled.
+    ///
+    /// \param index  Index of the sprite
+    /// \param origin New origin
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(std::size_t index, const Vector2f& origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the origin of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Origin of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getOrigin(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of a sprite
+    ///
+    /// \param index   Index of the sprite
+    /// \param factors New scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(std::size_t index, const Vector2f& factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Scale factors of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getScale(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the orientation of a sprite
+    ///
+    /// \param index Index of the sprite
+    /// \param angle New rotation
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(std::size_t index, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the orientation of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Rotation of the sprite, always in the range [0, 360]
+    ///
+    ////////////////////////////////////////////////////////////
+    Angle getRotation(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color of a sprite
+    ///
+    /// The color is modulated (multiplied) with the texture.
+    ///
+    /// \param index Index of the sprite
+    /// \param color New color
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColor(std::size_t index, const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Color of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the transform of the parent of a sprite
+    ///
+    /// The parent transform is applied to the sprite after its
+    /// own position, origin, scale and rotation, and before
+    /// the transform of the batch. It attaches the sprite to
+    /// another object, typically a node of a
+    /// sf::TransformHierarchy. By default, it is the identity.
+    ///
+    /// \param index     Index of the sprite
+    /// \param transform New parent transform
+    ///
+    /// \see sf::TransformHierarchy::getWorldTransform
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParentTransform(std::size_t index, const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of the parent of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Parent transform of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    const Transform& getParentTransform(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how the vertices of the sprites are computed
+    ///
+    /// With ExecutionPolicy::Parallel, the vertices of large
+    /// batches are computed by several threads, or by the job
+    /// scheduler set with sf::setJobScheduler. The result is the
+    /// same with both policies.
+    ///
+    /// The default policy is ExecutionPolicy::Sequential.
+    ///
+    /// \param policy New execution policy
+    ///
+    /// \see getExecutionPolicy
+    ///
+    ////////////////////////////////////////////////////////////
+    void setExecutionPolicy(ExecutionPolicy policy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how the vertices of the sprites are computed
+    ///
+    /// \return Current execution policy
+    ///
+    /// \see setExecutionPolicy
+    ///
+    ////////////////////////////////////////////////////////////
+    ExecutionPolicy getExecutionPolicy() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the sprites to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Group the sprites by texture and compute their vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the vertices for drawing
+    ///
+    /// \return True if the GPU buffers can be drawn, false to draw the client-side triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    bool updateBuffers() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the vertices to the GPU buffers
+    ///
+    /// \return True if the buffers are up to date, false if buffer objects can't be used
+    ///
+    ////////////////////////////////////////////////////////////
+    bool uploadBuffers() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sprites sharing the same texture, drawn with a single call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Group
+    {
+        const Texture*      texture{};      //!< Texture of the sprites
+        const TextureArray* textureArray{}; //!< Texture array of the sprites, used if there's no texture
+        std::size_t         firstSprite{};  //!< Index of the first quad of the group in the vertices
+        std::size_t         spriteCount{};  //!< Number of sprites in the group
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the shader sampling the layers of a texture array
+    ///
+    /// \param textureArray Texture array to sample
+    ///
+    /// \return Shader to draw the group with, or a null pointer if it can't be drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getTextureArrayShader(const TextureArray& textureArray) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<const Texture*>      m_textures;             //!< Texture of each sprite, null for texture arrays
+    std::vector<const TextureArray*> m_textureArrays;        //!< Texture array of each sprite, null for textures
+    std::vector<unsigned int>        m_layers;               //!< Layer of the texture array of each sprite
+    std::vector<IntRect>             m_textureRects;         //!< Texture rectangle of each sprite
+    std::vector<Vector2f>            m_positions;            //!< Position of each sprite
+    std::vector<Vector2f>            m_origins;              //!< Origin of each sprite
+    std::vector<Vector2f>            m_scales;               //!< Scale factors of each sprite
+    std::vector<Angle>               m_rotations;            //!< Rotation of each sprite
+    std::vector<Vector2f>            m_directions;           //!< Cosine and sine of the opposite of each rotation
+    std::vector<Color>               m_colors;               //!< Color of each sprite
+    std::vector<Transform>           m_parentTransforms;     //!< Transform of the parent of each sprite
+    ExecutionPolicy                  m_executionPolicy{};    //!< How the vertices are computed
+    mutable std::vector<Group>       m_groups;               //!< Sprites grouped by texture, in order of appearance
+    mutable std::vector<Vertex>      m_vertices;             //!< Pre-transformed quads of all the sprites, by group
+    mutable std::vector<Vertex>      m_triangles;            //!< Triangles drawn when buffer objects are not available
+    mutable VertexBuffer             m_vertexBuffer;         //!< GPU copy of the quads
+    mutable IndexBuffer              m_indexBuffer;          //!< Indices splitting each quad in two triangles
+    mutable bool                     m_geometryNeedUpdate{}; //!< Do the vertices need to be recomputed?
+    mutable bool                     m_buffersNeedUpdate{};  //!< Do the GPU buffers need to be updated?
+    mutable bool                     m_useBuffers{};         //!< Are the GPU buffers drawn instead of the triangles?
+    mutable std::shared_ptr<Shader>  m_textureArrayShader;   //!< Built-in shader sampling the texture arrays
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// Drawing thousands of sf::Sprite objects one by one is
+/// limited by the cost of each draw call, not by the GPU.
+/// sf::SpriteBatch stores the properties of many sprites
+/// in contiguous arrays (one per property), computes all
+/// their vertices in a single pass and draws them with one
+/// draw call per texture. The vertices are uploaded to a
+/// vertex buffer when the system supports it.
+///
+/// Each sprite of the batch has the same properties as a
+/// sf::Sprite: a texture and texture rectangle, a color,
+/// and a position, origin, scale and rotation. Sprites are
+/// identified by their index. The batch itself is a
+/// sf::Transformable, its transform applies to all the sprites.
+/// Each sprite can also be given a parent transform, for
+/// example the world transform of a node of a
+/// sf::TransformHierarchy, applied between its own transform
+/// and the one of the batch (see setParentTransform).
+///
+/// Sprites are drawn grouped by texture, so sprites using
+/// different textures should not overlap if their drawing
+/// order matters. Within a texture, sprites are drawn in
+/// the order of their indices. Using a texture atlas for all
+/// the sprites of a batch gives both a correct drawing order
+/// and a single draw call.
+///
+/// Sprites can also display the layers of a sf::TextureArray.
+/// All the sprites using the same texture array are drawn with
+/// a single call, even if they display different layers, which
+/// gives the drawing order and the draw call count of an atlas
+/// without having to pack the images. These sprites are drawn
+/// with a built-in shader when the render states don't provide
+/// one; a custom shader receives the layer in the horizontal
+/// texture coordinate, as \p x + \p layer * (\p width + 1)
+/// where \p width is the width of the layers. Texture arrays
+/// are not drawn to core profile contexts.
+///
+/// Like sf::Sprite, sf::SpriteBatch doesn't own its textures,
+/// they must live as long as the batch uses them.
+///
+/// Usage example:
+/// \code
+/// sf::SpriteBatch bullets;
+///
+/// // Add the sprites
+/// for (const auto& bullet : game.bullets)
+/// {
+///     const std::size_t index = bullets.add(atlas, bulletRect);
+///     bullets.setOrigin(index, {4, 4});
+/// }
+///
+/// // Update them every frame
+/// for (std::size_t i = 0; i < bullets.getSpriteCount(); ++i)
+/// {
+///     bullets.setPosition(i, game.bullets[i].position);
+///     bullets.setRotation(i, game.bullets[i].heading);
+/// }
+///
+/// // Draw all of them at once
+/// window.draw(bullets);
+/// \endcode
+///
+/// \see sf::Sprite, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Texture updated from video frames in planar YUV formats
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API StreamingTexture
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Layout of the planes of a frame
+    ///
+    /// In both formats, the chroma planes have half the width
+    /// and half the height of the luma plane, rounded up.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        NV12, //!< A luma plane followed by a plane of interleaved U and V samples
+        I420  //!< A luma plane followed by a U plane and a V plane
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Matrix converting YUV samples to RGB colors
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class ColorSpace
+    {
+        Bt601, //!< ITU-R BT.601, used by standard definition video
+        Bt709  //!< ITU-R BT.709, used by high definition video
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Plane of a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Plane
+    {
+        const std::uint8_t* data{};     //!< Pointer to the first sample of the first row
+        std::size_t         rowPitch{}; //!< Number of bytes between the beginning of two rows
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a streaming texture
+    ///
+    /// The conversion to RGB is done by a shader, so shaders
+    /// and render textures must be supported.
+    ///
+    /// \param size   Width and height of the frames, in pixels
+    /// \param format Layout of the planes of the frames
+    ///
+    /// \return Streaming texture if creation succeeded, otherwise `std::nullopt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<StreamingTexture> create(const Vector2u& size, Format format);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the texture with a new frame
+    ///
+    /// \a planes must point to the planes of the frame: 2 for
+    /// NV12 (Y, then UV), 3 for I420 (Y, U, then V). The
+    /// samples are staged in pixel buffers from which the
+    /// graphics card transfers them in the background, see
+    /// sf::Texture::updateAsync; the frame can be reused or
+    /// released as soon as this function returns. The planes
+    /// are then converted to RGB on the GPU.
+    ///
+    /// \param planes Pointer to the planes of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Plane* planes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color space of the frames
+    ///
+    /// Video is usually encoded in limited range, where luma
+    /// goes from 16 to 235 and chroma from 16 to 240; some
+    /// sources, like JPEG-based camera feeds, use the full
+    /// range of the samples. The default is BT.601 in limited
+    /// range. The change applies to the next update.
+    ///
+    /// \param colorSpace Matrix converting YUV samples to RGB colors
+    /// \param fullRange  True if the samples use their full range
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColorSpace(ColorSpace colorSpace, bool fullRange = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color space of the frames
+    ///
+    /// \return Matrix converting YUV samples to RGB colors
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ColorSpace getColorSpace() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the samples of the frames use their full range
+    ///
+    /// \return True if the samples use their full range, false if they use limited range
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isFullRange() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layout of the planes of the frames
+    ///
+    /// \return Format of the frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Format getFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the frames
+    ///
+    /// \return Width and height of the frames, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture holding the last frame, in RGBA
+    ///
+    /// The texture can be drawn like any other texture, for
+    /// example with a sf::Sprite. It is black until the first
+    /// update.
+    ///
+    /// \return Texture of the last frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from the resources created by create
+    ///
+    /// \param target Render texture receiving the converted frames
+    /// \param shader Shader converting the planes to RGB
+    /// \param planes Textures receiving the samples of the planes
+    /// \param size   Width and height of the frames, in pixels
+    /// \param format Layout of the planes of the frames
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingTexture(RenderTexture&&        target,
+                     Shader&&               shader,
+                     std::vector<Texture>&& planes,
+                     const Vector2u&        size,
+                     Format                 format);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    RenderTexture             m_target;                        //!< Render texture receiving the converted frames
+    Shader                    m_shader;                        //!< Shader converting the planes to RGB
+    std::vector<Texture>      m_planes;                        //!< Samples of the planes, 4 per texel
+    std::vector<std::uint8_t> m_staging;                       //!< Rows repacked when they are not contiguous
+    Vector2u                  m_size;                          //!< Size of the frames, in pixels
+    Format                    m_format;                        //!< Layout of the planes of the frames
+    ColorSpace                m_colorSpace{ColorSpace::Bt601}; //!< Matrix converting YUV samples to RGB colors
+    bool                      m_fullRange{};                   //!< Do the samples use their full range?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::StreamingTexture
+/// \ingroup graphics
+///
+/// sf::StreamingTexture displays video decoded by a third-party
+/// library, such as FFmpeg, or captured from a camera, without
+/// converting the frames to RGBA on the CPU. Decoders output
+/// planar YUV frames; sf::StreamingTexture uploads their planes
+/// as they are, which also moves less than half the data of an
+/// RGBA frame, and converts them to RGB on the GPU.
+///
+/// The planes are uploaded through pixel buffers as with
+/// sf::Texture::updateAsync, so update returns without waiting
+/// for the transfer, and the frame can be released right away.
+/// Rows are copied directly when they are contiguous with a
+/// width multiple of 4 bytes; otherwise they are repacked first.
+///
+/// Usage example:
+/// \code
+/// auto video = sf::StreamingTexture::create({1920, 1080}, sf::StreamingTexture::Format::NV12).value();
+/// video.setColorSpace(sf::StreamingTexture::ColorSpace::Bt709);
+///
+/// while (window.isOpen())
+/// {
+///     // AVFrame* frame decoded by FFmpeg in AV_PIX_FMT_NV12
+///     const sf::StreamingTexture::Plane planes[] = {{frame->data[0], std::size_t(frame->linesize[0])},
+///                                                   {frame->data[1], std::size_t(frame->linesize[1])}};
+///     video.update(planes);
+///
+///     window.clear();
+///     window.draw(sf::Sprite(video.getTexture()));
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -38,8 +38,12 @@
 #include <SFML/Graphics/VertexArray.hpp>
 
 #include <SFML/System/String.hpp>
+#include <SFML/System/Utf8View.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <string>
+#include <vector>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -48,6 +52,7 @@ namespace sf
 {
 class Font;
 class RenderTarget;
+class TextLayoutCache;
 
 ////////////////////////////////////////////////////////////
 /// \brief Graphical text that can be drawn to a render target
@@ -106,6 +111,12 @@ public:
     /// \endcode
     /// A text's string is empty by default.
     ///
+    /// Only the lines that differ from the previous string are
+    /// rebuilt, so appending characters or changing a few
+    /// characters of a line is cheap even for long texts. The
+    /// other lines are kept as they are, and just moved if the
+    /// number of lines before them changed.
+    ///
     /// \param string New string
     ///
     /// \see getString
@@ -113,6 +124,25 @@ public:
     ////////////////////////////////////////////////////////////
     void setString(const String& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the text's string from UTF-8 encoded characters
+    ///
+    /// The characters are copied as they are, and only decoded
+    /// when the text is drawn or measured, or its string is
+    /// requested. Setting the same characters again, as labels
+    /// updated every frame often do, costs a comparison.
+    ///
+    /// \code
+    /// text.setString(sf::Utf8View(label));
+    /// \endcode
+    ///
+    /// \param string New string, encoded in UTF-8
+    ///
+    /// \see getString
+    ///
+    ////////////////////////////////////////////////////////////
+    void setString(Utf8View string);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
@@ -236,6 +266,12 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// The outline glyphs are rasterized and stored in the font
+    /// texture for every distinct thickness, unless the font is
+    /// in distance field mode: the outline is then drawn from
+    /// the fill glyphs, which makes animating the thickness free
+    /// (see sf::Font::setDistanceFieldEnabled).
+    ///
     /// \param thickness New outline thickness, in pixels
     ///
     /// \see getOutlineThickness
@@ -243,6 +279,26 @@ public:
     ////////////////////////////////////////////////////////////
     void setOutlineThickness(float thickness);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the cache of shaped runs used to lay out the text
+    ///
+    /// With a layout cache, the parts of the string between new
+    /// lines and tabulations are shaped as whole runs, with
+    /// HarfBuzz if SFML was built with it, and the shaped runs
+    /// are reused by all the texts sharing the cache. Without
+    /// one, which is the default, characters are placed one by
+    /// one with the kerning of the font.
+    ///
+    /// The cache is not owned by the text and must outlive it,
+    /// or be replaced before being destroyed.
+    ///
+    /// \param layoutCache Layout cache to use, or a null pointer to disable shaping
+    ///
+    /// \see getLayoutCache
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayoutCache(TextLayoutCache* layoutCache);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's string
     ///
@@ -345,6 +401,16 @@ public:
     ////////////////////////////////////////////////////////////
     float getOutlineThickness() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cache of shaped runs used to lay out the text
+    ///
+    /// \return Layout cache of the text, or a null pointer if it has none
+    ///
+    /// \see setLayoutCache
+    ///
+    ////////////////////////////////////////////////////////////
+    TextLayoutCache* getLayoutCache() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the position of the \a index-th character
     ///
@@ -409,23 +475,89 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry of a line of the text
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Line
+    {
+        std::size_t characterCount{};     //!< Number of characters, including the terminating new line if any
+        std::size_t vertexCount{};        //!< Number of fill vertices
+        std::size_t outlineVertexCount{}; //!< Number of outline vertices
+        float       minX{};               //!< Left bound of the line's glyphs
+        float       minY{};               //!< Top bound of the line's glyphs
+        float       maxX{};               //!< Right bound of the line's glyphs
+        float       maxY{};               //!< Bottom bound of the line's glyphs
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Build the geometry of a range of characters
+    ///
+    /// The range must start at the beginning of a line, and end
+    /// either just after a new line or at the end of the string.
+    /// The line following the range is always added to \a lines,
+    /// empty if the range ends with a new line.
+    ///
+    /// \param begin           Index of the first character to build
+    /// \param end             Index past the last character to build
+    /// \param firstLine       Index of the line starting at \a begin
+    /// \param vertices        Vertex array to append the fill geometry to
+    /// \param outlineVertices Vertex array to append the outline geometry to
+    /// \param lines           Line table to append the built lines to
+    ///
+    ////////////////////////////////////////////////////////////
+    void buildLines(std::size_t        begin,
+                    std::size_t        end,
+                    std::size_t        firstLine,
+                    VertexArray&       vertices,
+                    VertexArray&       outlineVertices,
+                    std::vector<Line>& lines) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the lines containing characters changed by setString
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChangedLines() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the string, keeping track of the unchanged characters
+    ///
+    /// \param string New string
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateString(const String& string) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the UTF-8 string given to setString, if it wasn't yet
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureStringDecoded() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    String                m_string;                                    //!< String to display
-    const Font*           m_font{};                                    //!< Font used to display the string
-    unsigned int          m_characterSize{30};                         //!< Base size of characters, in pixels
-    float                 m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
-    float                 m_lineSpacingFactor{1.f};                    //!< Spacing factor between lines
-    std::uint32_t         m_style{Regular};                            //!< Text style (see Style enum)
-    Color                 m_fillColor{Color::White};                   //!< Text fill color
-    Color                 m_outlineColor{Color::Black};                //!< Text outline color
-    float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
-    mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
-    mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
-    mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable String            m_string;                                    //!< String to display
+    std::string               m_utf8String;                                //!< UTF-8 characters last given to setString
+    bool                      m_hasUtf8String{};                           //!< Was the string last set from UTF-8?
+    mutable bool              m_utf8StringPending{};                       //!< Does m_utf8String still need decoding?
+    const Font*               m_font{};                                    //!< Font used to display the string
+    unsigned int              m_characterSize{30};                         //!< Base size of characters, in pixels
+    float                     m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
+    float                     m_lineSpacingFactor{1.f};                    //!< Spacing factor between lines
+    std::uint32_t             m_style{Regular};                            //!< Text style (see Style enum)
+    Color                     m_fillColor{Color::White};                   //!< Text fill color
+    Color                     m_outlineColor{Color::Black};                //!< Text outline color
+    float                     m_outlineThickness{0.f};                     //!< Thickness of the text's outline
+    TextLayoutCache*          m_layoutCache{};                             //!< Cache of shaped runs, if any
+    mutable VertexArray       m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
+    mutable VertexArray       m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
+    mutable FloatRect         m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
+    mutable bool              m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
+    mutable bool              m_stringNeedUpdate{};   //!< Do the lines changed by setString need an update?
+    mutable std::size_t       m_unchangedPrefix{};    //!< Leading characters unchanged since the last update
+    mutable std::size_t       m_unchangedSuffix{};    //!< Trailing characters unchanged since the last update
+    mutable std::vector<Line> m_lines;                //!< Geometry of each line of the string
+    mutable std::uint64_t     m_fontTextureId{};      //!< The font texture id
 };
 
 } // namespace sf
@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Font;
+
+////////////////////////////////////////////////////////////
+/// \brief Cache of shaped runs of text, shared by texts
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextLayoutCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Glyph of a shaped run of text
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ShapedGlyph
+    {
+        std::uint32_t glyphIndex{}; //!< Index of the glyph in the font
+        std::uint32_t cluster{};    //!< Index of the first character of the run that the glyph represents
+        Vector2f      offset;       //!< Offset of the glyph from the pen position
+        float         advance{};    //!< Horizontal distance to the pen position of the next glyph
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default memory budget of a cache, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t DefaultMemoryBudget = 1024 * 1024;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty cache
+    ///
+    /// \param memoryBudget Approximate maximum amount of memory used by the runs, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextLayoutCache(std::size_t memoryBudget = DefaultMemoryBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether SFML was built with a text shaper
+    ///
+    /// With HarfBuzz (enabled with the SFML_USE_HARFBUZZ CMake
+    /// option), runs are shaped according to the rules of their
+    /// script: ligatures, contextual forms, marks, right-to-left
+    /// scripts. Otherwise every character is mapped to its own
+    /// glyph and spaced by the kerning of the font.
+    ///
+    /// \return True if the runs are shaped by HarfBuzz
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isShapingAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the glyphs of a run of text, shaping it if it is not in the cache
+    ///
+    /// Runs are identified by the font, the character size,
+    /// the weight and the characters. When the new run does not
+    /// fit in the memory budget, the least recently used runs
+    /// are removed from the cache.
+    ///
+    /// The returned reference stays valid until the next call
+    /// to shape, setMemoryBudget or clear.
+    ///
+    /// \param font          Font used to shape the run
+    /// \param text          Characters of the run, without new lines or tabulations
+    /// \param characterSize Character size, in pixels
+    /// \param bold          Shape the bold version or the regular one?
+    ///
+    /// \return Glyphs of the run, in visual order
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<ShapedGlyph>& shape(const Font&         font,
+                                          std::u32string_view text,
+                                          unsigned int        characterSize,
+                                          bool                bold);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the memory budget of the cache
+    ///
+    /// Runs are removed if the cache uses more than the new budget.
+    ///
+    /// \param memoryBudget Approximate maximum amount of memory used by the runs, in bytes
+    ///
+    /// \see getMemoryBudget, getMemoryUsage
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t memoryBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory budget of the cache
+    ///
+    /// \return Approximate maximum amount of memory used by the runs, in bytes
+    ///
+    /// \see setMemoryBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory currently used by the runs of the cache
+    ///
+    /// \return Approximate amount of memory used by the runs, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of runs in the cache
+    ///
+    /// \return Number of runs
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getRunCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the runs from the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Shaped run of text
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Run
+    {
+        std::uint64_t            fontId{};        //!< Identifier of the glyphs and metrics of the font
+        unsigned int             characterSize{}; //!< Character size the run was shaped at
+        bool                     bold{};          //!< Was the run shaped with the bold version?
+        std::u32string           text;            //!< Characters of the run
+        std::vector<ShapedGlyph> glyphs;          //!< Glyphs of the run
+        std::size_t              hash{};          //!< Hash of the key of the run
+        std::size_t              memoryUsage{};   //!< Approximate amount of memory used by the run
+    };
+
+    using RunList = std::list<Run>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the least recently used runs until the cache fits in the budget
+    ///
+    /// The most recently used run is never removed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void trim();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    RunList                                                 m_runs;          //!< Runs, the most recently used first
+    std::unordered_multimap<std::size_t, RunList::iterator> m_index;         //!< Runs by hash of their key
+    std::size_t                                             m_memoryBudget;  //!< Maximum memory used by the runs
+    std::size_t                                             m_memoryUsage{}; //!< Memory used by the runs
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextLayoutCache
+/// \ingroup graphics
+///
+/// Laying out a text requires converting its characters to
+/// glyphs and computing their positions, which is called
+/// shaping. Shaping complex scripts with HarfBuzz is much
+/// more expensive than drawing the result, and even simple
+/// kerning lookups add up when many texts are rebuilt.
+///
+/// sf::TextLayoutCache stores the shaped runs of text (the
+/// parts of a string between line breaks and tabulations)
+/// so that texts displaying the same strings, or a text whose
+/// string is updated with mostly the same lines, reuse them.
+/// Runs are kept in least recently used order and removed
+/// when the cache exceeds its memory budget.
+///
+/// A cache is given to texts with sf::Text::setLayoutCache,
+/// and can be shared by any number of texts and fonts. Texts
+/// without a cache use the kerning of the font directly. The
+/// cache must outlive the texts that use it.
+///
+/// Usage example:
+/// \code
+/// sf::TextLayoutCache cache;
+///
+/// sf::Text title(font, "Title");
+/// title.setLayoutCache(&cache);
+///
+/// sf::Text label(font, "Label");
+/// label.setLayoutCache(&cache);
+/// \endcode
+///
+/// \see sf::Text, sf::Font
+///
+////////////////////////////////////////////////////////////
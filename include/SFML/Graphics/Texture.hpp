@@ -34,10 +34,13 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <SFML/System/MemoryStats.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
 #include <filesystem>
 #include <optional>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -48,6 +51,12 @@ namespace sf
 class InputStream;
 class Window;
 class Image;
+class TextureReadback;
+
+namespace priv
+{
+struct CompressedImage;
+}
 
 ////////////////////////////////////////////////////////////
 /// \brief Image living on the graphics card that can be used for drawing
@@ -56,6 +65,43 @@ class Image;
 class SFML_GRAPHICS_API Texture : GlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Block compressed pixel formats
+    ///
+    /// Textures in these formats are decoded by the graphics
+    /// card itself, they use 4 to 8 times less video memory
+    /// than uncompressed RGBA textures.
+    ///
+    /// \see loadCompressedFromFile, isCompressedFormatAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class CompressedFormat
+    {
+        Bc1,       //!< BC1 (DXT1), RGB with optional 1-bit alpha, 8 bytes per 4x4 block
+        Bc2,       //!< BC2 (DXT3), RGBA with explicit 4-bit alpha, 16 bytes per 4x4 block
+        Bc3,       //!< BC3 (DXT5), RGBA with interpolated alpha, 16 bytes per 4x4 block
+        Bc4,       //!< BC4 (RGTC1), single red channel, 8 bytes per 4x4 block
+        Bc5,       //!< BC5 (RGTC2), red and green channels, 16 bytes per 4x4 block
+        Bc7,       //!< BC7 (BPTC), high quality RGBA, 16 bytes per 4x4 block
+        Etc2Rgb,   //!< ETC2 RGB, 8 bytes per 4x4 block
+        Etc2RgbA1, //!< ETC2 RGB with 1-bit alpha, 8 bytes per 4x4 block
+        Etc2Rgba,  //!< ETC2 RGBA with EAC alpha, 16 bytes per 4x4 block
+        Astc4x4,   //!< ASTC LDR, 16 bytes per 4x4 block
+        Astc5x4,   //!< ASTC LDR, 16 bytes per 5x4 block
+        Astc5x5,   //!< ASTC LDR, 16 bytes per 5x5 block
+        Astc6x5,   //!< ASTC LDR, 16 bytes per 6x5 block
+        Astc6x6,   //!< ASTC LDR, 16 bytes per 6x6 block
+        Astc8x5,   //!< ASTC LDR, 16 bytes per 8x5 block
+        Astc8x6,   //!< ASTC LDR, 16 bytes per 8x6 block
+        Astc8x8,   //!< ASTC LDR, 16 bytes per 8x8 block
+        Astc10x5,  //!< ASTC LDR, 16 bytes per 10x5 block
+        Astc10x6,  //!< ASTC LDR, 16 bytes per 10x6 block
+        Astc10x8,  //!< ASTC LDR, 16 bytes per 10x8 block
+        Astc10x10, //!< ASTC LDR, 16 bytes per 10x10 block
+        Astc12x10, //!< ASTC LDR, 16 bytes per 12x10 block
+        Astc12x12  //!< ASTC LDR, 16 bytes per 12x12 block
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -208,6 +254,59 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<Texture> loadFromImage(const Image& image, bool sRgb = false, const IntRect& area = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a block compressed texture from a file on disk
+    ///
+    /// The supported containers are KTX2 (without supercompression)
+    /// and DDS. The pixels are uploaded as they are stored in the
+    /// file, without being decoded, together with the mipmap levels
+    /// that the file contains. Whether the texture is converted
+    /// from sRGB is defined by the format stored in the file.
+    ///
+    /// If the graphics card doesn't support the format of the file,
+    /// loading fails: use isCompressedFormatAvailable to select
+    /// which files to load.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param filename Path of the KTX2 or DDS file to load
+    ///
+    /// \return Texture if loading was successful, otherwise `std::nullopt`
+    ///
+    /// \see loadCompressedFromMemory, loadCompressedFromStream, isCompressedFormatAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Texture> loadCompressedFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a block compressed texture from a file in memory
+    ///
+    /// See loadCompressedFromFile for the supported containers.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return Texture if loading was successful, otherwise `std::nullopt`
+    ///
+    /// \see loadCompressedFromFile, loadCompressedFromStream, isCompressedFormatAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Texture> loadCompressedFromMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a block compressed texture from a custom stream
+    ///
+    /// See loadCompressedFromFile for the supported containers.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return Texture if loading was successful, otherwise `std::nullopt`
+    ///
+    /// \see loadCompressedFromFile, loadCompressedFromMemory, isCompressedFormatAvailable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Texture> loadCompressedFromStream(InputStream& stream);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the texture
     ///
@@ -231,6 +330,28 @@ public:
     ////////////////////////////////////////////////////////////
     Image copyToImage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the texture pixels to an image in the background
+    ///
+    /// Unlike copyToImage, this function doesn't wait for the
+    /// graphics card: the pixels are transferred to a pixel
+    /// buffer while the application keeps going, and the image
+    /// is built when it is requested from the returned object.
+    ///
+    /// The copy holds the pixels of the texture at the time this
+    /// function is called, later updates of the texture don't
+    /// change it.
+    ///
+    /// If pixel buffers are not supported, the copy is made
+    /// synchronously and the returned object is already complete.
+    ///
+    /// \return Pending copy of the texture's pixels
+    ///
+    /// \see copyToImage, sf::TextureReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureReadback copyToImageAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole texture from an array of pixels
     ///
@@ -269,6 +390,60 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from a strided array of pixels
+    ///
+    /// The \a pixels array must contain 32-bits RGBA pixels, and
+    /// the first pixel of each row is \a rowPitch bytes after the
+    /// first pixel of the previous one. This allows uploading a
+    /// region of a larger pixel buffer without repacking its rows
+    /// first; the whole region is uploaded with a single call
+    /// when the platform supports it.
+    ///
+    /// \a rowPitch must be a multiple of 4 and at least 4 times
+    /// the width of the region. No additional check is performed
+    /// on the size of the pixel array or the bounds of the area
+    /// to update. Passing invalid arguments will lead to an
+    /// undefined behavior.
+    ///
+    /// This function does nothing if \a pixels is null or if the
+    /// texture was not previously created.
+    ///
+    /// \param pixels   Array of pixels to copy to the texture
+    /// \param rowPitch Distance between the beginning of two consecutive rows, in bytes
+    /// \param size     Width and height of the pixel region to copy
+    /// \param dest     Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const std::uint8_t* pixels, std::size_t rowPitch, const Vector2u& size, const Vector2u& dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture without waiting for the transfer
+    ///
+    /// This function behaves like update(const std::uint8_t*, const Vector2u&, const Vector2u&),
+    /// except that the pixels are staged in a pixel buffer from
+    /// which the graphics card transfers them in the background.
+    /// The \a pixels array can be reused as soon as this function
+    /// returns, and the rendering thread isn't blocked while the
+    /// pixels travel to the texture.
+    ///
+    /// Draw calls issued afterwards in the same context always
+    /// see the new contents. Contrary to update, this function
+    /// doesn't flush the OpenGL commands, so a texture shared
+    /// with other contexts shows the new contents there only once
+    /// the commands of this context are flushed (which happens
+    /// at the latest when its window is displayed).
+    ///
+    /// If pixel buffers are not supported, the texture is updated
+    /// synchronously.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in \a pixels
+    /// \param dest   Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAsync(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update a part of this texture from another texture
     ///
@@ -416,6 +591,35 @@ public:
     ////////////////////////////////////////////////////////////
     bool isSrgb() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare whether the colors of the texture are premultiplied by their alpha
+    ///
+    /// The pixels are not modified: this only tells how they
+    /// must be blended. sf::Sprite draws a premultiplied texture
+    /// with sf::BlendPremultipliedAlpha in place of sf::BlendAlpha,
+    /// and premultiplies its own color accordingly.
+    /// Images can be premultiplied with sf::Image::premultiplyAlpha
+    /// before being loaded; the contents of a sf::RenderTexture
+    /// drawn with sf::BlendAlpha are premultiplied.
+    /// Colors are considered straight by default.
+    ///
+    /// \param premultiplied True if the colors are premultiplied by their alpha
+    ///
+    /// \see isPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPremultipliedAlpha(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the colors of the texture are premultiplied by their alpha
+    ///
+    /// \return True if the colors are premultiplied, false if they are straight
+    ///
+    /// \see setPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPremultipliedAlpha() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable repeating
     ///
@@ -475,6 +679,45 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool generateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a mipmap computed on the CPU
+    ///
+    /// This is an alternative to generateMipmap, which lets
+    /// the driver filter the levels; sf::Image::generateMipChain
+    /// creates levels with a filter chosen by the caller, and
+    /// doesn't require the framebuffer object extension.
+    ///
+    /// \a levels must hold the levels 1 to N of the mipmap:
+    /// each one half the size of the previous one (rounded
+    /// down, but at least 1), the first one half the size of
+    /// the texture, the last one 1x1. Compressed textures, and
+    /// textures whose actual size was rounded up to a power of
+    /// two, are not supported.
+    /// As with generateMipmap, the mipmap is only valid until the
+    /// next time the base level is modified.
+    ///
+    /// \param levels Images of the levels below the base level
+    ///
+    /// \return True if the mipmap was uploaded, false if unsuccessful
+    ///
+    /// \see generateMipmap, sf::Image::generateMipChain
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setMipmap(const std::vector<Image>& levels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compressed format of the texture
+    ///
+    /// Compressed textures can be drawn like any other texture,
+    /// but their pixels cannot be updated and they cannot
+    /// generate their own mipmap. Copying a compressed texture
+    /// creates an uncompressed copy.
+    ///
+    /// \return Compressed format, or `std::nullopt` if the texture is not compressed
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<CompressedFormat> getCompressedFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Swap the contents of this texture with those of another
     ///
@@ -540,10 +783,25 @@ public:
     ////////////////////////////////////////////////////////////
     static unsigned int getMaximumSize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the graphics card supports a compressed format
+    ///
+    /// Support varies widely: desktop graphics cards usually
+    /// provide the BCn formats, while mobile ones provide ETC2
+    /// and ASTC.
+    ///
+    /// \param format Compressed format to check
+    ///
+    /// \return True if textures of this format can be loaded
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isCompressedFormatAvailable(CompressedFormat format);
+
 private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureStreamer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
@@ -568,6 +826,34 @@ private:
     ////////////////////////////////////////////////////////////
     static unsigned int getValidSize(unsigned int size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a texture from the levels of a parsed compressed file
+    ///
+    /// Only the levels from \a firstLevel to the last one are
+    /// uploaded; sampling starts at \a firstLevel, so the
+    /// texture keeps the size of the full image while using
+    /// the memory of the smaller levels only. OpenGL ES can't
+    /// skip levels, all of them are uploaded there.
+    ///
+    /// \param image      Parsed compressed file
+    /// \param firstLevel Index of the largest level to upload
+    ///
+    /// \return Texture if loading was successful, otherwise `std::nullopt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Texture> loadCompressedImage(const priv::CompressedImage& image,
+                                                                    std::size_t                  firstLevel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the video memory used by the texture
+    ///
+    /// \param bytes Memory used by the pixels and mipmap of the texture, in bytes
+    ///
+    /// \see sf::GpuMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryUsage(std::uint64_t bytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Invalidate the mipmap if one exists
     ///
@@ -577,6 +863,19 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the matrix applied to the texture coordinates
+    ///
+    /// The matrix scales pixel coordinates to the [0 .. 1] range
+    /// and inverts the Y axis of textures whose pixels are flipped.
+    ///
+    /// \param coordinateType Type of texture coordinates to use
+    ///
+    /// \return Column-major 4x4 texture matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::array<float, 16> getTextureMatrix(CoordinateType coordinateType) const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -585,11 +884,17 @@ private:
     unsigned int  m_texture{};       //!< Internal texture identifier
     bool          m_isSmooth{};      //!< Status of the smooth filter
     bool          m_sRgb{};          //!< Should the texture source be converted from sRGB?
+    bool          m_premultiplied{}; //!< Are the colors premultiplied by their alpha?
     bool          m_isRepeated{};    //!< Is the texture in repeat mode?
     mutable bool  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
     bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
     bool          m_hasMipmap{};     //!< Has the mipmap been generated?
     std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+    std::uint64_t m_memoryUsage{};   //!< Video memory used by the texture, in bytes
+
+    std::optional<CompressedFormat> m_compressedFormat; //!< Format of the pixels if the texture is compressed
+
+    priv::MemoryCounter<MemoryStats::Category::Texture> m_memoryCounter; //!< Counts the texture in sf::MemoryStats
 };
 
 ////////////////////////////////////////////////////////////
@@ -632,6 +937,14 @@ SFML_GRAPHICS_API void swap(Texture& left, Texture& right) noexcept;
 /// sf::Image, do whatever you need with the pixels, and then call
 /// Texture::loadFromImage.
 ///
+/// Large texture sets can instead be stored pre-compressed in
+/// KTX2 or DDS files and loaded with Texture::loadCompressedFromFile.
+/// Their blocks, and the mipmap levels stored along with them,
+/// are uploaded without being decoded, so they use a fraction
+/// of the video memory and load much faster. Which formats are
+/// supported depends on the graphics card, see
+/// Texture::isCompressedFormatAvailable.
+///
 /// Since they live in the graphics card memory, the pixels of a texture
 /// cannot be accessed without a slow copy first. And they cannot be
 /// accessed individually. Therefore, if you need to read the texture's
@@ -0,0 +1,310 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Stack of images of the same size living on the graphics card
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureArray : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureArray();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray(const TextureArray&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray& operator=(const TextureArray&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray(TextureArray&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray& operator=(TextureArray&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the texture array
+    ///
+    /// The pixels of the layers are undefined until they are
+    /// set with update.
+    ///
+    /// \param size       Width and height of every layer
+    /// \param layerCount Number of layers
+    /// \param sRgb       True to enable sRGB conversion, false to disable it
+    ///
+    /// \return Texture array if creation was successful, otherwise `std::nullopt`
+    ///
+    /// \see isAvailable, getMaximumLayerCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<TextureArray> create(const Vector2u& size,
+                                                            unsigned int    layerCount,
+                                                            bool            sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the layers
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of layers
+    ///
+    /// \return Number of layers
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLayerCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a whole layer from an array of pixels
+    ///
+    /// The pixel array is assumed to have the same size as
+    /// the layers, with 32-bits RGBA pixels.
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array or the index of the layer. Passing invalid arguments
+    /// will lead to an undefined behavior.
+    ///
+    /// \param pixels Array of pixels to copy to the layer
+    /// \param layer  Index of the layer to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const std::uint8_t* pixels, unsigned int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of a layer from an array of pixels
+    ///
+    /// The size of the pixel array must match the \a size argument,
+    /// with 32-bits RGBA pixels.
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array or the bounds of the area to update. Passing invalid
+    /// arguments will lead to an undefined behavior.
+    ///
+    /// \param pixels Array of pixels to copy to the layer
+    /// \param size   Width and height of the pixel region contained in \a pixels
+    /// \param dest   Coordinates of the destination position
+    /// \param layer  Index of the layer to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest, unsigned int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a layer from an image
+    ///
+    /// The image is copied to the top-left corner of the layer;
+    /// it must not be larger than the layers.
+    ///
+    /// \param image Image to copy to the layer
+    /// \param layer Index of the layer to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Image& image, unsigned int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of a layer from an image
+    ///
+    /// No additional check is performed on the size of the image.
+    /// Passing an invalid combination of image size and offset
+    /// will lead to an undefined behavior.
+    ///
+    /// \param image Image to copy to the layer
+    /// \param dest  Coordinates of the destination position
+    /// \param layer Index of the layer to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Image& image, const Vector2u& dest, unsigned int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// The smooth filter is disabled by default.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels are converted from sRGB or not
+    ///
+    /// \return True if the pixels are converted from sRGB, false if not
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSrgb() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the texture array
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a texture array for rendering
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix sf::TextureArray with OpenGL code. Texture arrays are
+    /// bound to GL_TEXTURE_2D_ARRAY, so they don't replace the
+    /// texture bound by sf::Texture::bind.
+    ///
+    /// \param textureArray Pointer to the texture array to bind, can be null to use no texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(const TextureArray* textureArray);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports texture arrays
+    ///
+    /// Texture arrays require OpenGL 3.0 or EXT_texture_array.
+    ///
+    /// \return True if texture arrays are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of layers allowed
+    ///
+    /// This maximum is defined by the graphics driver; it is
+    /// at least 256 with OpenGL 3.0.
+    ///
+    /// \return Maximum number of layers, 0 if texture arrays are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getMaximumLayerCount();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from an OpenGL texture
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray(const Vector2u& size, unsigned int layerCount, unsigned int texture, bool sRgb);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u      m_size;          //!< Size of the layers
+    unsigned int  m_layerCount{};  //!< Number of layers
+    unsigned int  m_texture{};     //!< Internal texture identifier
+    bool          m_isSmooth{};    //!< Status of the smooth filter
+    bool          m_sRgb{};        //!< Should the pixels be converted from sRGB?
+    std::uint64_t m_memoryUsage{}; //!< Video memory used by the layers, in bytes
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureArray
+/// \ingroup graphics
+///
+/// sf::TextureArray stores several images of the same size,
+/// its layers, in a single OpenGL texture. Since the render
+/// states only hold one texture, sprites drawn from different
+/// sf::Texture objects can't be drawn together; sprites drawn
+/// from different layers of the same texture array can.
+///
+/// Unlike the pages of a sf::TextureAtlas, the layers don't
+/// bleed into each other when filtered or repeated, and a
+/// new image never requires repacking the others.
+///
+/// Sampling a texture array requires a shader: bind it to a
+/// \p sampler2DArray uniform with sf::Shader::setUniform.
+/// sf::SpriteBatch provides a built-in shader so that sprites
+/// can display any layer of an array, all in one draw call.
+///
+/// Usage example:
+/// \code
+/// auto textureArray = sf::TextureArray::create({64, 64}, 300).value();
+/// for (unsigned int layer = 0; layer < 300; ++layer)
+///     textureArray.update(sf::Image::loadFromFile("part" + std::to_string(layer) + ".png").value(), layer);
+///
+/// sf::SpriteBatch batch;
+/// for (unsigned int layer = 0; layer < 300; ++layer)
+///     batch.setPosition(batch.add(textureArray, layer), {layer * 64.f, 0.f});
+///
+/// window.draw(batch); // a single draw call
+/// \endcode
+///
+/// \see sf::Texture, sf::SpriteBatch, sf::Shader
+///
+////////////////////////////////////////////////////////////
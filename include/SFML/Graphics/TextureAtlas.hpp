@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Set of large textures packing many images together
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of an image inside the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Region
+    {
+        std::size_t page{}; //!< Index of the page texture holding the image
+        IntRect     rect;   //!< Area of the page texture covered by the image
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty atlas
+    ///
+    /// No texture is created until the first image is added.
+    ///
+    /// \param pageSize Size of the textures images are packed into
+    /// \param padding  Number of empty pixels kept around every image
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(const Vector2u& pageSize = {2048, 2048}, unsigned int padding = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(const TextureAtlas&);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(const TextureAtlas&);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pack an image into the atlas
+    ///
+    /// The image is placed in the first page that has enough
+    /// space left for it. If none has, a new page is created.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return Location of the image in the atlas, or an empty
+    ///         optional if the image is larger than a page or
+    ///         no page texture could be created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Region> add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the images from the atlas
+    ///
+    /// The page textures are released as well.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of page textures
+    ///
+    /// \return Number of pages
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a page
+    ///
+    /// \a page must be lower than getPageCount().
+    ///
+    /// \param page Index of the page
+    ///
+    /// \return Texture of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture(std::size_t page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the page textures
+    ///
+    /// \return Size of a page, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getPageSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill efficiency of the atlas
+    ///
+    /// The efficiency is the ratio of the area covered by
+    /// images (padding excluded) to the total area of the
+    /// pages. It is 0 if the atlas has no page.
+    ///
+    /// \return Fill efficiency, between 0 and 1
+    ///
+    ////////////////////////////////////////////////////////////
+    float getEfficiency() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter on the page textures
+    ///
+    /// A padding of at least 1 pixel should be kept when smoothing
+    /// is enabled, to prevent neighboring images from bleeding
+    /// into each other.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled on the page textures
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSmooth() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Page texture along with the packer managing its space
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Page;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u          m_pageSize;   //!< Size of the page textures
+    unsigned int      m_padding;    //!< Number of empty pixels kept around every image
+    bool              m_isSmooth{}; //!< Status of the smooth filter of the page textures
+    std::uint64_t     m_usedArea{}; //!< Total area of the images packed so far
+    std::vector<Page> m_pages;      //!< Pages of the atlas
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// Every sf::Texture is a separate OpenGL texture, and drawing
+/// entities that use different textures requires a texture
+/// switch, which prevents them from being batched together.
+/// sf::TextureAtlas packs many small images into a few large
+/// textures ("pages") so that entities using these images
+/// can share a texture.
+///
+/// Images can be added at any time; each one is placed using a
+/// skyline packer, which keeps the pages tightly filled even
+/// when images have very different sizes. New pages are created
+/// on demand when the existing ones are full.
+///
+/// The region returned for an image can be used directly as
+/// the texture rectangle of a sprite:
+/// \code
+/// sf::TextureAtlas atlas;
+///
+/// const auto hero  = atlas.add(sf::Image::loadFromFile("hero.png").value()).value();
+/// const auto enemy = atlas.add(sf::Image::loadFromFile("enemy.png").value()).value();
+///
+/// sf::Sprite heroSprite(atlas.getTexture(hero.page), hero.rect);
+/// sf::Sprite enemySprite(atlas.getTexture(enemy.page), enemy.rect);
+/// \endcode
+///
+/// Page textures are owned by the atlas: sprites using them
+/// must not outlive it, and clear() invalidates them.
+///
+/// \see sf::Texture, sf::Image, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Pending copy of the pixels of a texture to an image
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReadback : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Discards the pixels if they were not retrieved.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(TextureReadback&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(TextureReadback&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels have reached system memory
+    ///
+    /// This function never blocks. Once it returns true,
+    /// getImage() returns without waiting for the GPU.
+    ///
+    /// If the system doesn't support fences, the completion of
+    /// the copy can't be queried and this function always
+    /// returns true.
+    ///
+    /// \return True if the copy is complete
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the image holding the pixels of the texture
+    ///
+    /// If the copy is not complete yet, this function waits
+    /// until it is.
+    ///
+    /// \return Image containing the pixels of the texture at
+    ///         the time the copy was requested
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Image& getImage();
+
+private:
+    friend class Texture;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a readback which is already complete
+    ///
+    /// \param image Image holding the pixels of the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureReadback(Image image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a readback from a pixel buffer being filled
+    ///
+    /// \param buffer        OpenGL identifier of the pixel buffer receiving the pixels
+    /// \param fence         Fence signaled when the copy is complete, can be null
+    /// \param size          Size of the texture
+    /// \param actualSize    Size of the texture storage, including padding
+    /// \param pixelsFlipped Are the pixels of the texture flipped vertically?
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(unsigned int    buffer,
+                    void*           fence,
+                    const Vector2u& size,
+                    const Vector2u& actualSize,
+                    bool            pixelsFlipped);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the pixel buffer and the fence
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroy();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::optional<Image> m_image;           //!< Pixels of the texture, once they have been retrieved
+    unsigned int         m_buffer{};        //!< Pixel buffer receiving the pixels
+    void*                m_fence{};         //!< Fence signaled when the pixel buffer is filled
+    Vector2u             m_size;            //!< Size of the texture
+    Vector2u             m_actualSize;      //!< Size of the texture storage, including padding
+    bool                 m_pixelsFlipped{}; //!< Are the pixels flipped vertically?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReadback
+/// \ingroup graphics
+///
+/// sf::TextureReadback is returned by
+/// sf::Texture::copyToImageAsync. The pixels of the texture
+/// are copied to a pixel buffer by the GPU in the background,
+/// while the application keeps rendering; the image is only
+/// built when it is requested with getImage().
+///
+/// Polling isReady() once per frame lets the application
+/// retrieve the image without ever stalling the rendering.
+///
+/// Example:
+/// \code
+/// std::optional<sf::TextureReadback> screenshot;
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     if (screenshotRequested)
+///         screenshot = renderTexture.getTexture().copyToImageAsync();
+///
+///     if (screenshot && screenshot->isReady())
+///     {
+///         screenshot->getImage().saveToFile("screenshot.png");
+///         screenshot.reset();
+///     }
+/// }
+/// \endcode
+///
+/// When pixel buffers are not supported, the copy is made
+/// synchronously by copyToImageAsync and the readback is
+/// complete right away.
+///
+/// \see sf::Texture::copyToImageAsync
+///
+////////////////////////////////////////////////////////////
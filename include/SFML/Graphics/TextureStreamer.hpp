@@ -0,0 +1,436 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Keep the mipmap levels of compressed textures in video memory as they are needed
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureStreamer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a streamed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::size_t;
+
+    static constexpr std::uint64_t DefaultMemoryBudget{256 * 1024 * 1024}; //!< Default video memory budget, in bytes
+    static constexpr std::uint64_t DefaultUploadLimit{16 * 1024 * 1024};   //!< Default size of the uploads of an update
+    static constexpr unsigned int  DefaultBaseSize{64};                    //!< Default size of the base levels
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the streamer with a video memory budget
+    ///
+    /// \param memoryBudget Video memory that the streamed textures may use, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureStreamer(std::uint64_t memoryBudget = DefaultMemoryBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureStreamer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer(TextureStreamer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer& operator=(TextureStreamer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a texture from a compressed file on disk
+    ///
+    /// The file must be a KTX2 or DDS file containing mipmap
+    /// levels, see sf::Texture::loadCompressedFromFile. Only
+    /// its smallest levels, no larger than the base size, are
+    /// uploaded right away; the larger ones are uploaded by
+    /// update once the texture is requested at a larger size.
+    /// The contents of the file are kept in memory for that.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return Handle of the new texture, or `std::nullopt` if loading failed
+    ///
+    /// \see loadFromMemory, remove
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Handle> loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a texture from a compressed file in memory
+    ///
+    /// The data is copied, it can be destroyed when this
+    /// function returns. See loadFromFile for details.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return Handle of the new texture, or `std::nullopt` if loading failed
+    ///
+    /// \see loadFromFile, remove
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Handle> loadFromMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a texture from the streamer
+    ///
+    /// The texture is destroyed, and its handle may be reused
+    /// by a texture added later.
+    ///
+    /// \param handle Handle of the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a handle identifies a texture of the streamer
+    ///
+    /// \param handle Handle to check
+    ///
+    /// \return True if the texture was added and not removed since
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a streamed texture
+    ///
+    /// The texture always has the size of the full image,
+    /// whatever levels are in memory, so texture rectangles
+    /// don't depend on streaming. The reference stays valid
+    /// until the texture is removed.
+    ///
+    /// \param handle Handle of the texture
+    ///
+    /// \return Texture to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell the streamer that a texture is displayed
+    ///
+    /// This function should be called every frame for the
+    /// textures that are drawn, typically after culling. The
+    /// requested size selects the smallest level at least as
+    /// large, which update brings into memory. It also marks
+    /// the texture as used: when the budget is exceeded, the
+    /// textures that were requested least recently lose their
+    /// larger levels first.
+    ///
+    /// \param handle      Handle of the texture
+    /// \param displaySize Size covered by the whole texture on the screen, in pixels
+    ///
+    /// \see update
+    ///
+    ////////////////////////////////////////////////////////////
+    void request(Handle handle, const Vector2f& displaySize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload and evict levels according to the last requests
+    ///
+    /// Every texture gets the level it was last requested at,
+    /// from the most to the least recently requested, as long
+    /// as the budget allows; the others are reduced to the
+    /// largest level that fits, or to their base levels. The
+    /// levels are evicted before the new ones are uploaded,
+    /// and the uploads stop when the upload limit is reached;
+    /// the remaining ones are done by the next updates.
+    ///
+    /// This function should be called once per frame.
+    ///
+    /// \see request, setMemoryBudget, setUploadLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the level of a texture that is sampled
+    ///
+    /// \param handle Handle of the texture
+    ///
+    /// \return Index of the largest level in memory, 0 being the full size image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getResidentLevel(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the video memory budget
+    ///
+    /// The base levels of the textures are always in memory,
+    /// even if they exceed the budget. The new budget is
+    /// applied by the next update.
+    ///
+    /// \param memoryBudget Video memory that the streamed textures may use, in bytes
+    ///
+    /// \see getMemoryBudget, getMemoryUsage
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::uint64_t memoryBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the video memory budget
+    ///
+    /// \return Video memory that the streamed textures may use, in bytes
+    ///
+    /// \see setMemoryBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the video memory used by the streamed textures
+    ///
+    /// \return Memory used by the levels in memory, in bytes
+    ///
+    /// \see setMemoryBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getMemoryUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum amount of data uploaded by an update
+    ///
+    /// Uploading a level takes time; limiting the uploads of
+    /// each update spreads them over several frames instead
+    /// of stalling one. At least one texture is uploaded by
+    /// each update, whatever its size.
+    ///
+    /// \param uploadLimit Maximum size of the uploads of an update, in bytes
+    ///
+    /// \see getUploadLimit, update
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUploadLimit(std::uint64_t uploadLimit);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum amount of data uploaded by an update
+    ///
+    /// \return Maximum size of the uploads of an update, in bytes
+    ///
+    /// \see setUploadLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getUploadLimit() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the levels that always stay in memory
+    ///
+    /// The levels whose width and height are both no larger than
+    /// this size are uploaded when a texture is loaded and never
+    /// evicted, so that every texture can be drawn, blurry, at
+    /// any time. It applies to the textures loaded afterwards.
+    ///
+    /// \param baseSize Largest width and height of the base levels, in pixels
+    ///
+    /// \see getBaseSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBaseSize(unsigned int baseSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the levels that always stay in memory
+    ///
+    /// \return Largest width and height of the base levels, in pixels
+    ///
+    /// \see setBaseSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBaseSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter of the streamed textures
+    ///
+    /// It applies to all the textures of the streamer, the
+    /// setting is kept when their levels change. The filter
+    /// is disabled by default.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth, sf::Texture::setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter of the streamed textures is enabled
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+private:
+    struct Entry;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a texture from the contents of a compressed file
+    ///
+    /// \param data Contents of the file
+    ///
+    /// \return Handle of the new texture, or `std::nullopt` if loading failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Handle> add(std::vector<std::uint8_t>&& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the entry of a texture
+    ///
+    /// \param handle Handle of the texture
+    ///
+    /// \return Entry of the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Entry& getEntry(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the texture of an entry with one starting at another level
+    ///
+    /// \param entry Entry of the texture
+    /// \param level Index of the largest level to upload
+    ///
+    /// \return True if the texture was replaced
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setResidentLevel(Entry& entry, std::size_t level) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Entry>> m_entries;                         //!< Streamed textures, null when removed
+    std::vector<Handle>                 m_freeHandles;                     //!< Handles of the removed textures
+    std::uint64_t                       m_memoryBudget;                    //!< Video memory that the textures may use
+    std::uint64_t                       m_uploadLimit{DefaultUploadLimit}; //!< Maximum size of the uploads of an update
+    std::uint64_t                       m_updateCount{};                   //!< Number of updates so far
+    unsigned int                        m_baseSize{DefaultBaseSize};       //!< Largest size of the base levels
+    bool                                m_isSmooth{};                      //!< Status of the smooth filter
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureStreamer
+/// \ingroup graphics
+///
+/// Large worlds can have more texture data than the graphics
+/// card can hold, while only a fraction of it is on screen at
+/// a time, and most of that at a fraction of its size.
+/// sf::TextureStreamer keeps in video memory only the mipmap
+/// levels of its textures that are needed for their current
+/// size on screen, within a memory budget.
+///
+/// The textures are loaded from KTX2 or DDS files, which
+/// store their mipmap levels precomputed (see
+/// sf::Texture::loadCompressedFromFile). When a texture is
+/// added, only its smallest levels are uploaded, so that it
+/// can be drawn right away. Each frame, the application
+/// requests the textures that it draws with their size on
+/// screen, then calls update: the larger levels that are
+/// needed are uploaded, and when the budget is exceeded the
+/// least recently requested textures are reduced to smaller
+/// levels. The textures keep their full size whatever levels
+/// are in memory, so sprites don't need to be updated.
+///
+/// Textures that are not stored in such files can't be
+/// streamed: sf::Texture::generateMipmap computes the smaller
+/// levels from the full size image, which must be uploaded
+/// first. On OpenGL ES, sampling can't start at a smaller
+/// level, so the textures are always fully loaded.
+///
+/// The video memory used by the textures is also reported
+/// to sf::GpuMemory.
+///
+/// Usage example:
+/// \code
+/// sf::TextureStreamer streamer(512 * 1024 * 1024);
+/// streamer.setSmooth(true);
+/// const auto handle = streamer.loadFromFile("terrain.ktx2").value();
+/// sf::Sprite sprite(streamer.getTexture(handle));
+///
+/// while (window.isOpen())
+/// {
+///     // ...
+///
+///     // Size of the sprite on screen, through the current view
+///     const sf::FloatRect bounds = sprite.getGlobalBounds();
+///     const sf::Vector2f  scale(window.getSize().x / window.getView().getSize().x,
+///                               window.getSize().y / window.getView().getSize().y);
+///     streamer.request(handle, {bounds.width * scale.x, bounds.height * scale.y});
+///     streamer.update();
+///
+///     window.clear();
+///     window.draw(sprite);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::GpuMemory
+///
+////////////////////////////////////////////////////////////
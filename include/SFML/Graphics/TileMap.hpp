@@ -0,0 +1,298 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles taken from a tileset texture, stored in chunks
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Index of a tile that is not drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::uint32_t EmptyTile = 0xFFFFFFFF;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty map
+    ///
+    /// All the tiles of the new map are empty.
+    ///
+    /// The tiles of the tileset are numbered row by row,
+    /// starting from 0 at its top-left corner.
+    ///
+    /// \param tileset   Texture containing the tiles, it must outlive the map
+    /// \param tileSize  Size of a tile, in pixels
+    /// \param mapSize   Number of tiles of the map in each direction
+    /// \param chunkSize Number of tiles of a chunk in each direction
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture& tileset, const Vector2u& tileSize, const Vector2u& mapSize, unsigned int chunkSize = 16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(Texture&& tileset, const Vector2u& tileSize, const Vector2u& mapSize, unsigned int chunkSize = 16) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Only the vertices of the tile are updated, the chunk
+    /// containing it uploads them the next time it is drawn.
+    ///
+    /// \param position Coordinates of the tile in the map
+    /// \param tile     Index of the tile in the tileset, or EmptyTile
+    ///
+    /// \see getTile, setTiles
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(const Vector2u& position, std::uint32_t tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change all the tiles of the map
+    ///
+    /// \param tiles Pointer to the indices of the tiles in the tileset (or EmptyTile), row by row
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTiles(const std::uint32_t* tiles);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// \param position Coordinates of the tile in the map
+    ///
+    /// \return Index of the tile in the tileset, or EmptyTile
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getTile(const Vector2u& position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture of the map
+    ///
+    /// \return Texture containing the tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTileset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Number of tiles of the map in each direction
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the chunks of the map
+    ///
+    /// \return Number of tiles of a chunk in each direction
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks of the map
+    ///
+    /// \return Number of chunks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the map.
+    ///
+    /// \return Local bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the map
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the map.
+    ///
+    /// \return Global bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Square block of tiles drawn with a single draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Vector2u            firstTile;    //!< Coordinates of the top-left tile of the chunk in the map
+        Vector2u            size;         //!< Number of tiles of the chunk in each direction
+        std::vector<Vertex> vertices;     //!< Two triangles per tile, row by row
+        VertexBuffer        vertexBuffer; //!< GPU copy of the vertices
+        std::size_t         tileCount{};  //!< Number of non-empty tiles of the chunk
+        std::size_t         dirtyBegin{}; //!< First vertex that needs to be uploaded
+        std::size_t         dirtyEnd{};   //!< One past the last vertex that needs to be uploaded
+        bool                useBuffer{};  //!< Is the vertex buffer drawn instead of the vertices?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the map to a render target
+    ///
+    /// Only the non-empty chunks overlapping the view of the
+    /// target are drawn.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the chunk containing a tile
+    ///
+    /// \param position Coordinates of the tile in the map
+    ///
+    /// \return Index of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getChunkIndex(const Vector2u& position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the vertices of a tile in its chunk
+    ///
+    /// \param position Coordinates of the tile in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTileVertices(const Vector2u& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the modified vertices of a chunk to its vertex buffer
+    ///
+    /// \param chunk Chunk to update
+    ///
+    ////////////////////////////////////////////////////////////
+    static void uploadChunk(Chunk& chunk);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*             m_tileset;    //!< Texture containing the tiles
+    Vector2u                   m_tileSize;   //!< Size of a tile, in pixels
+    Vector2u                   m_mapSize;    //!< Number of tiles of the map in each direction
+    unsigned int               m_chunkSize;  //!< Number of tiles of a chunk in each direction
+    Vector2u                   m_chunkCount; //!< Number of chunks of the map in each direction
+    std::vector<std::uint32_t> m_tiles;      //!< Tile of each position, row by row
+    mutable std::vector<Chunk> m_chunks;     //!< Chunks of the map, row by row
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap draws a grid of tiles taken from a single
+/// texture, the tileset. Building such a map as one big
+/// sf::VertexArray means submitting all of its vertices every
+/// frame; sf::TileMap instead splits the map into square
+/// chunks of tiles, each chunk keeping its vertices in a
+/// static sf::VertexBuffer.
+///
+/// Changing a tile only modifies its own vertices: the next
+/// time its chunk is drawn, the range of modified vertices is
+/// uploaded, and the other chunks are left untouched. When
+/// the map is drawn, only the chunks overlapping the view of
+/// the render target are submitted (and not even those if
+/// all their tiles are empty), so the cost of drawing a large
+/// map depends on what is visible, not on its size.
+///
+/// If vertex buffers are not available on the system, the
+/// chunks are drawn from their vertices in system memory.
+///
+/// Like sf::Sprite, sf::TileMap doesn't own its texture, it
+/// must live as long as the map uses it.
+///
+/// Usage example:
+/// \code
+/// const auto tileset = sf::Texture::loadFromFile("tileset.png").value();
+///
+/// // A map of 256x256 tiles of 32x32 pixels
+/// sf::TileMap map(tileset, {32, 32}, {256, 256});
+/// map.setTiles(level.data());
+///
+/// // Open a door
+/// map.setTile({12, 40}, openDoorTile);
+///
+/// window.draw(map);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::SpriteBatch
+///
+////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 
 #include <array>
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -115,6 +117,26 @@ public:
     ////////////////////////////////////////////////////////////
     constexpr Vector2f transformPoint(const Vector2f& point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// The result is the same as calling transformPoint on each
+    /// point, but the points are processed several at a time with
+    /// the SIMD instructions of the processor when available,
+    /// which is much faster for large arrays.
+    ///
+    /// \a output may be the same array as \a points, to transform
+    /// the points in place; otherwise the arrays must not overlap.
+    ///
+    /// \param points Array of points to transform
+    /// \param output Array receiving the transformed points
+    /// \param count  Number of points in both arrays
+    ///
+    /// \see transformPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformPoints(const Vector2f* points, Vector2f* output, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -0,0 +1,505 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/SpatialGrid.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Hierarchy of nodes whose transforms are combined with the ones of their parents
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TransformHierarchy
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a node of the hierarchy
+    ///
+    ////////////////////////////////////////////////////////////
+    using Node = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Value used as the parent of the nodes at the top of the hierarchy
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr Node NoParent = std::numeric_limits<Node>::max();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty hierarchy
+    ///
+    /// \param cellSize Cell size of the spatial grid indexing the world bounds of the nodes, see sf::SpatialGrid
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TransformHierarchy(float cellSize = 256.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a node to the hierarchy
+    ///
+    /// The new node has an identity local transform and empty
+    /// local bounds. The identifier of a removed node may be
+    /// returned again for a node added later.
+    ///
+    /// \param parent Parent of the new node, or NoParent to add it at the top of the hierarchy
+    ///
+    /// \return Identifier of the new node
+    ///
+    /// \see remove
+    ///
+    ////////////////////////////////////////////////////////////
+    Node add(Node parent = NoParent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a node and all its descendants from the hierarchy
+    ///
+    /// \param node Node to remove
+    ///
+    /// \see add, clear
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Node node);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the nodes from the hierarchy
+    ///
+    /// \see remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for a number of nodes
+    ///
+    /// \param nodeCount Number of nodes to reserve memory for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t nodeCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of nodes in the hierarchy
+    ///
+    /// \return Number of nodes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getNodeCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a node is in the hierarchy
+    ///
+    /// \param node Node to check
+    ///
+    /// \return True if the node was added and not removed since
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a node, with all its descendants, to another parent
+    ///
+    /// The local transform of the node is kept, so its world
+    /// transform changes. The new parent must not be the node
+    /// itself or one of its descendants.
+    ///
+    /// \param node   Node to move
+    /// \param parent New parent of the node, or NoParent to move it to the top of the hierarchy
+    ///
+    /// \see getParent
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParent(Node node, Node parent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parent of a node
+    ///
+    /// \param node Node
+    ///
+    /// \return Parent of the node, or NoParent if it is at the top of the hierarchy
+    ///
+    /// \see setParent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Node getParent(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a node, relative to its parent
+    ///
+    /// \param node     Node
+    /// \param position New position
+    ///
+    /// \see getPosition
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(Node node, const Vector2f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a node, relative to its parent
+    ///
+    /// \param node Node
+    ///
+    /// \return Position of the node
+    ///
+    /// \see setPosition
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Vector2f& getPosition(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the rotation of a node, relative to its parent
+    ///
+    /// \param node  Node
+    /// \param angle New rotation
+    ///
+    /// \see getRotation
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(Node node, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rotation of a node, relative to its parent
+    ///
+    /// \param node Node
+    ///
+    /// \return Rotation of the node, in the range [0, 360] degrees
+    ///
+    /// \see setRotation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Angle getRotation(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of a node, relative to its parent
+    ///
+    /// \param node    Node
+    /// \param factors New scale factors
+    ///
+    /// \see getScale
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(Node node, const Vector2f& factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of a node, relative to its parent
+    ///
+    /// \param node Node
+    ///
+    /// \return Scale factors of the node
+    ///
+    /// \see setScale
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Vector2f& getScale(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of a node
+    ///
+    /// \param node   Node
+    /// \param origin New origin
+    ///
+    /// \see getOrigin
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(Node node, const Vector2f& origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of a node
+    ///
+    /// \param node Node
+    ///
+    /// \return Origin of the node
+    ///
+    /// \see setOrigin
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Vector2f& getOrigin(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the bounds of the contents of a node, in its local coordinates
+    ///
+    /// Nodes with non-empty local bounds are indexed by their
+    /// world bounds, so that they can be found by query.
+    ///
+    /// \param node   Node
+    /// \param bounds Local bounding rectangle, for example the local bounds of the sprite attached to the node
+    ///
+    /// \see getLocalBounds, getWorldBounds
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLocalBounds(Node node, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds of the contents of a node, in its local coordinates
+    ///
+    /// \param node Node
+    ///
+    /// \return Local bounding rectangle of the node
+    ///
+    /// \see setLocalBounds
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FloatRect& getLocalBounds(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of a node relative to its parent
+    ///
+    /// \param node Node
+    ///
+    /// \return Local transform of the node
+    ///
+    /// \see getWorldTransform
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Transform& getLocalTransform(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of a node combined with the ones of all its ancestors
+    ///
+    /// The world transforms are brought up to date first if needed.
+    ///
+    /// \param node Node
+    ///
+    /// \return World transform of the node
+    ///
+    /// \see getLocalTransform, update
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Transform& getWorldTransform(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounds of a node transformed by its world transform
+    ///
+    /// The world transforms are brought up to date first if needed.
+    ///
+    /// \param node Node
+    ///
+    /// \return World bounding rectangle of the node
+    ///
+    /// \see setLocalBounds, update
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getWorldBounds(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bring the world transforms and bounds up to date
+    ///
+    /// Only the nodes that changed since the last update, and
+    /// their descendants, are recomputed. This function is
+    /// called automatically when a world transform, world
+    /// bounds or a query is requested.
+    ///
+    /// \see getChangedNodes
+    ///
+    ////////////////////////////////////////////////////////////
+    void update() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the nodes whose world transform changed during the last update
+    ///
+    /// This is the list of transforms to copy to the objects
+    /// attached to the nodes, for example with
+    /// sf::SpriteBatch::setParentTransform. The nodes are
+    /// listed parents first.
+    ///
+    /// \return Nodes recomputed by the last update that recomputed anything
+    ///
+    /// \see update
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Node>& getChangedNodes() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the nodes whose world bounds overlap an area
+    ///
+    /// The nodes are appended to \a result, in no particular
+    /// order. Nodes with empty local bounds are never found.
+    ///
+    /// \param area   Area to search, in world coordinates
+    /// \param result Vector the found nodes are appended to
+    ///
+    /// \see sf::SpatialGrid::query
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const FloatRect& area, std::vector<Node>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the nodes visible through a view
+    ///
+    /// This is equivalent to calling query(view.getVisibleArea(), result).
+    ///
+    /// \param view   View to search through
+    /// \param result Vector the found nodes are appended to
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const View& view, std::vector<Node>& result) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Value marking the absence of a slot or of a grid handle
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t None = std::numeric_limits<std::size_t>::max();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the slot of a node in the arrays
+    ///
+    /// \param node Node
+    ///
+    /// \return Slot of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSlot(Node node) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the local transform of a node as changed
+    ///
+    /// \param slot Slot of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate(std::size_t slot);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the slots of a subtree after all the others, or destroy them
+    ///
+    /// The relative order of the slots is kept.
+    ///
+    /// \param subtree For every slot, true if it belongs to the subtree
+    /// \param destroy True to destroy the slots of the subtree, false to move them
+    ///
+    ////////////////////////////////////////////////////////////
+    void reorder(const std::vector<bool>& subtree, bool destroy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the slots of a node and of all its descendants
+    ///
+    /// \param slot Slot of the node
+    ///
+    /// \return For every slot, true if it belongs to the subtree of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<bool> markSubtree(std::size_t slot) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::size_t>                 m_slots;        //!< Slot of each node, None for removed nodes
+    std::vector<Node>                        m_freeNodes;    //!< Identifiers of the removed nodes
+    std::vector<Node>                        m_nodes;        //!< Node of each slot, slots are ordered parents first
+    std::vector<std::size_t>                 m_parents;      //!< Slot of the parent of each slot, None for top nodes
+    std::vector<Vector2f>                    m_positions;    //!< Position of each slot
+    std::vector<Vector2f>                    m_origins;      //!< Origin of each slot
+    std::vector<Vector2f>                    m_scales;       //!< Scale factors of each slot
+    std::vector<Angle>                       m_rotations;    //!< Rotation of each slot
+    std::vector<FloatRect>                   m_bounds;       //!< Local bounds of each slot
+    mutable std::vector<Transform>           m_locals;       //!< Local transform of each slot
+    mutable std::vector<Transform>           m_worlds;       //!< World transform of each slot
+    mutable std::vector<std::uint8_t>        m_dirty;        //!< What has to be recomputed for each slot
+    mutable std::vector<std::size_t>         m_gridHandles;  //!< Grid handle of each slot, None for empty bounds
+    mutable std::vector<Node>                m_gridNodes;    //!< Node of each grid handle
+    mutable std::vector<Node>                m_changedNodes; //!< Nodes recomputed by the last update
+    mutable std::vector<SpatialGrid::Handle> m_queryHandles; //!< Grid handles found by the last query
+    mutable SpatialGrid                      m_grid;         //!< Grid indexing the world bounds of the nodes
+    mutable bool                             m_needUpdate{}; //!< Has any node changed since the last update?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TransformHierarchy
+/// \ingroup graphics
+///
+/// Objects attached to other objects, like the wheels of a
+/// car or the items held by a character, are positioned
+/// relative to their parent. Combining the transforms by
+/// hand at every draw call repeats the same matrix products
+/// every frame, even for the parts of the scene that don't
+/// move.
+///
+/// sf::TransformHierarchy stores the nodes of such a scene:
+/// each node has a position, rotation, scale and origin like
+/// a sf::Transformable, relative to its parent. The world
+/// transform of a node is the product of its local transform
+/// with the world transform of its parent, and is only
+/// recomputed when the node or one of its ancestors changed.
+///
+/// The properties of the nodes are stored in contiguous arrays
+/// (one per property), ordered so that parents always come
+/// before their children: bringing all the world transforms
+/// up to date is a single linear pass, which skips the
+/// matrices of the unchanged subtrees.
+///
+/// The hierarchy doesn't store the drawn objects. Nodes
+/// are identified by the value returned by add, which can
+/// be associated with your own objects:
+/// \li getChangedNodes lists the nodes whose world transform
+///     was recomputed, to be copied for example to the sprites
+///     of a sf::SpriteBatch with sf::SpriteBatch::setParentTransform
+/// \li nodes given local bounds with setLocalBounds are indexed
+///     by their world bounds in a sf::SpatialGrid, to only draw
+///     the nodes which are visible through a view (see query)
+///
+/// Usage example:
+/// \code
+/// sf::TransformHierarchy scene;
+/// sf::SpriteBatch batch;
+///
+/// const auto car = scene.add();
+/// const auto wheel = scene.add(car);
+/// scene.setPosition(wheel, {20, 40});
+/// scene.setLocalBounds(wheel, wheelSprite.getLocalBounds());
+/// const std::size_t wheelIndex = batch.add(wheelSprite);
+///
+/// // In the main loop
+/// scene.setPosition(car, carPosition);
+/// scene.setRotation(wheel, wheelAngle);
+/// scene.update();
+/// for (const auto node : scene.getChangedNodes())
+///     if (node == wheel)
+///         batch.setParentTransform(wheelIndex, scene.getWorldTransform(node));
+/// window.draw(batch);
+/// \endcode
+///
+/// \see sf::Transformable, sf::SpriteBatch, sf::SpatialGrid
+///
+////////////////////////////////////////////////////////////
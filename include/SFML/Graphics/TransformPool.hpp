@@ -0,0 +1,374 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/ExecutionPolicy.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Compact storage for the transforms of many objects, computed in bulk
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TransformPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a transform of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of floats written by computeAll for each transform
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t MatrixSize = 6;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a transform to the pool
+    ///
+    /// The new transform is the identity: zero position, origin
+    /// and rotation, unit scale. The handle of a removed
+    /// transform may be returned again by a later call.
+    ///
+    /// \return Handle of the new transform
+    ///
+    /// \see remove
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle add();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a transform from the pool
+    ///
+    /// The last transform of the pool takes the index of the
+    /// removed one, see getIndex.
+    ///
+    /// \param handle Transform to remove
+    ///
+    /// \see add, clear
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the transforms from the pool
+    ///
+    /// \see remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for a number of transforms
+    ///
+    /// \param count Number of transforms to reserve memory for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of transforms in the pool
+    ///
+    /// \return Number of transforms
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a handle designates a transform of the pool
+    ///
+    /// \param handle Handle to check
+    ///
+    /// \return True if the handle was returned by add and not removed since
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of a transform in the output of computeAll
+    ///
+    /// Indices are contiguous, from 0 to getSize() - 1; they
+    /// only change when a transform is removed.
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Index of the transform
+    ///
+    /// \see getHandle
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndex(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform stored at an index
+    ///
+    /// \param index Index of the transform, lower than getSize()
+    ///
+    /// \return Handle of the transform
+    ///
+    /// \see getIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle getHandle(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a transform
+    ///
+    /// \param handle   Transform
+    /// \param position New position
+    ///
+    /// \see getPosition, sf::Transformable::setPosition
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(Handle handle, const Vector2f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a transform
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Position of the transform
+    ///
+    /// \see setPosition
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getPosition(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the rotation of a transform
+    ///
+    /// The sine and cosine of the angle are computed here, so
+    /// that computeAll is only made of products and sums.
+    ///
+    /// \param handle Transform
+    /// \param angle  New rotation
+    ///
+    /// \see getRotation, sf::Transformable::setRotation
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(Handle handle, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rotation of a transform
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Rotation of the transform, in the range [0, 360] degrees
+    ///
+    /// \see setRotation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Angle getRotation(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of a transform
+    ///
+    /// \param handle  Transform
+    /// \param factors New scale factors
+    ///
+    /// \see getScale, sf::Transformable::setScale
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(Handle handle, const Vector2f& factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of a transform
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Scale factors of the transform
+    ///
+    /// \see setScale
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getScale(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of a transform
+    ///
+    /// \param handle Transform
+    /// \param origin New origin
+    ///
+    /// \see getOrigin, sf::Transformable::setOrigin
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(Handle handle, const Vector2f& origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of a transform
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Origin of the transform
+    ///
+    /// \see setOrigin
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getOrigin(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute a single transform
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Same transform as a sf::Transformable with the same properties
+    ///
+    /// \see computeAll
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Transform getTransform(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute all the transforms of the pool
+    ///
+    /// The transform of index i is written at \a output + i * \a stride,
+    /// as MatrixSize floats holding the three columns of its
+    /// 3x2 affine matrix: a, b, c, d, tx, ty, such that
+    /// x' = a * x + c * y + tx and y' = b * x + d * y + ty. This
+    /// is the layout of a GLSL mat3x2 with no padding, so
+    /// \a output can be a mapped buffer of per-instance data,
+    /// \a stride being the size of one instance.
+    ///
+    /// \param output Address receiving the first matrix, no alignment is required
+    /// \param stride Distance between two consecutive matrices, in bytes, at least MatrixSize floats
+    /// \param policy Whether the work may be split among several threads
+    ///
+    /// \see getTransform, getIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    void computeAll(std::byte*      output,
+                    std::size_t     stride = MatrixSize * sizeof(float),
+                    ExecutionPolicy policy = ExecutionPolicy::Sequential) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute all the transforms of the pool as sf::Transform
+    ///
+    /// \a output is resized to getSize(); the transform of
+    /// index i is stored in output[i].
+    ///
+    /// \param output Vector receiving the transforms
+    /// \param policy Whether the work may be split among several threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void computeAll(std::vector<Transform>& output, ExecutionPolicy policy = ExecutionPolicy::Sequential) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Value marking a removed handle
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t None = std::numeric_limits<std::size_t>::max();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of a transform, checking the handle in debug builds
+    ///
+    /// \param handle Transform
+    ///
+    /// \return Index of the transform
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSlot(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::size_t> m_indices;     //!< Index of each handle, None for removed handles
+    std::vector<Handle>      m_freeHandles; //!< Removed handles
+    std::vector<Handle>      m_handles;     //!< Handle of each index
+    std::vector<float>       m_positionsX;  //!< Horizontal position of each transform
+    std::vector<float>       m_positionsY;  //!< Vertical position of each transform
+    std::vector<float>       m_originsX;    //!< Horizontal origin of each transform
+    std::vector<float>       m_originsY;    //!< Vertical origin of each transform
+    std::vector<float>       m_scalesX;     //!< Horizontal scale factor of each transform
+    std::vector<float>       m_scalesY;     //!< Vertical scale factor of each transform
+    std::vector<float>       m_cosines;     //!< Cosine of the opposite of each rotation
+    std::vector<float>       m_sines;       //!< Sine of the opposite of each rotation
+    std::vector<Angle>       m_rotations;   //!< Rotation of each transform
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TransformPool
+/// \ingroup graphics
+///
+/// Every sf::Transformable carries its own position, rotation,
+/// scale, origin and two cached matrices, and checks whether
+/// they are up to date when getTransform is called. When tens
+/// of thousands of objects move every frame, these checks and
+/// the scattered memory accesses cost more than the matrix
+/// computations themselves.
+///
+/// sf::TransformPool stores the same properties for many
+/// objects, in one contiguous array per component, and
+/// computes all the transforms in a single linear pass with
+/// SIMD instructions where available. The sine and cosine of
+/// each rotation are computed when it is set rather than at
+/// every pass. The matrices are written into memory provided
+/// by the caller, typically the per-instance data of a
+/// vertex buffer, or into a vector of sf::Transform.
+///
+/// Transforms are identified by the value returned by add.
+/// They are stored at contiguous indices, which are also
+/// their positions in the output of computeAll; removing a
+/// transform moves the last one to its index.
+///
+/// Usage example:
+/// \code
+/// sf::TransformPool pool;
+/// std::vector<sf::TransformPool::Handle> enemies;
+/// for (int i = 0; i < 100000; ++i)
+///     enemies.push_back(pool.add());
+///
+/// // In the main loop
+/// for (std::size_t i = 0; i < enemies.size(); ++i)
+///     pool.setPosition(enemies[i], positions[i]);
+///
+/// std::vector<float> instances(pool.getSize() * sf::TransformPool::MatrixSize);
+/// pool.computeAll(reinterpret_cast<std::byte*>(instances.data()));
+/// \endcode
+///
+/// \see sf::Transformable, sf::TransformHierarchy
+///
+////////////////////////////////////////////////////////////
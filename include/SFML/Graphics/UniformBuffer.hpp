@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Buffer storing the values of a GLSL uniform block in graphics memory
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// \see sf::VertexBuffer::Usage
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a UniformBuffer with a specific usage specifier
+    ///
+    /// Creates an empty uniform buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit UniformBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates \p size bytes
+    /// of graphics memory. Any previously allocated memory is
+    /// freed in the process.
+    ///
+    /// The size must match the size of the uniform block as
+    /// laid out by the GLSL compiler. Declaring the block with
+    /// the std140 layout makes this layout predictable.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from raw data
+    ///
+    /// The data is uploaded with a single call, no matter how
+    /// many uniforms of the block it contains. When the whole
+    /// buffer is overwritten, its previous storage is orphaned
+    /// so that the update doesn't wait for draw calls still
+    /// reading the previous values.
+    ///
+    /// The update fails if \p offset + \p size exceeds the
+    /// size of the buffer.
+    ///
+    /// \param data   Pointer to the data to copy to the buffer
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this uniform buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(UniformBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this uniform buffer
+    ///
+    /// After changing the usage specifier, the uniform buffer has
+    /// to be created again for the usage specifier to take effect.
+    ///
+    /// The default usage type is sf::VertexBuffer::Usage::Stream.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this uniform buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// This function should always be called before using
+    /// the uniform buffer features. If it returns false, then
+    /// any attempt to use sf::UniformBuffer will fail.
+    ///
+    /// \return True if uniform buffers are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};             //!< Internal buffer identifier
+    std::size_t  m_size{};               //!< Size in bytes of the currently allocated buffer
+    Usage        m_usage{Usage::Stream}; //!< How this uniform buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one uniform buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(UniformBuffer& left, UniformBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// sf::UniformBuffer stores the values of a GLSL uniform block
+/// in graphics memory. Instead of setting each uniform of a
+/// shader individually, the application fills a structure
+/// matching the block and uploads it with a single call.
+/// The same buffer can be attached to any number of shaders
+/// with sf::Shader::setUniformBlock.
+///
+/// Uniform buffers require OpenGL 3.1 or the
+/// ARB_uniform_buffer_object extension, check isAvailable()
+/// before using them.
+///
+/// Example:
+/// \code
+/// // layout(std140) uniform Frame { vec4 tint; float time; };
+/// struct Frame
+/// {
+///     float tint[4];
+///     float time;
+///     float padding[3];
+/// };
+///
+/// sf::UniformBuffer buffer(sf::UniformBuffer::Usage::Dynamic);
+/// if (!buffer.create(sizeof(Frame)))
+///     return -1;
+///
+/// shader.setUniformBlock("Frame", buffer);
+///
+/// while (window.isOpen())
+/// {
+///     Frame frame{{1.f, 1.f, 1.f, 1.f}, clock.getElapsedTime().asSeconds(), {}};
+///     buffer.update(&frame, sizeof(frame));
+///     window.draw(sprite, &shader);
+/// }
+/// \endcode
+///
+/// \see sf::Shader
+///
+////////////////////////////////////////////////////////////
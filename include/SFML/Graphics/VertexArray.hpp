@@ -30,11 +30,13 @@
 #include <SFML/Graphics/Export.hpp>
 
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/ExecutionPolicy.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 
+#include <functional>
 #include <vector>
 
 #include <cstddef>
@@ -141,6 +143,32 @@ public:
     ////////////////////////////////////////////////////////////
     void append(const Vertex& vertex);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Fill the vertex array with generated instances
+    ///
+    /// The array is resized to hold \a instanceCount instances of
+    /// \a verticesPerInstance vertices each, then \a generator is
+    /// called once per instance with the index of the instance and
+    /// a pointer to its first vertex, to write all its vertices.
+    ///
+    /// With ExecutionPolicy::Parallel, the generator may be called
+    /// concurrently from several threads (or from the job scheduler
+    /// set with sf::setJobScheduler) for different instances. It
+    /// must then only write the vertices of the instance it is
+    /// given and must not modify shared state without
+    /// synchronization.
+    ///
+    /// \param instanceCount       Number of instances to generate
+    /// \param verticesPerInstance Number of vertices of each instance
+    /// \param generator           Function writing the vertices of an instance
+    /// \param policy              How the calls to \a generator are executed
+    ///
+    ////////////////////////////////////////////////////////////
+    void generate(std::size_t                                      instanceCount,
+                  std::size_t                                      verticesPerInstance,
+                  const std::function<void(std::size_t, Vertex*)>& generator,
+                  ExecutionPolicy                                  policy = ExecutionPolicy::Sequential);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the type of primitives to draw
     ///
@@ -170,12 +198,100 @@ public:
     /// This function returns the minimal axis-aligned rectangle
     /// that contains all the vertices of the array.
     ///
+    /// The bounds are cached: they are computed again only after
+    /// vertices were accessed with the non-const operator[],
+    /// removed, or generated. Appending vertices extends the
+    /// cached bounds without scanning the array again.
+    ///
     /// \return Bounding rectangle of the vertex array
     ///
     ////////////////////////////////////////////////////////////
     FloatRect getBounds() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Split the vertex array into chunks with their own bounds
+    ///
+    /// When the vertices are split into chunks of \a vertexCount
+    /// vertices, each chunk gets its own cached bounds, and when
+    /// the render target culls drawables (see
+    /// sf::RenderTarget::setCullingEnabled), only the chunks that
+    /// intersect the view are drawn. This is useful for large
+    /// arrays, such as a whole tile map, of which only a small
+    /// part is visible at a time.
+    ///
+    /// Chunks are culled separately only with the primitive types
+    /// whose primitives are independent (points, lines and
+    /// triangles); \a vertexCount should then be a multiple of
+    /// the number of vertices of a primitive. Strips and fans are
+    /// always drawn entirely.
+    ///
+    /// By default, the array is not split (chunk size of 0).
+    ///
+    /// \param vertexCount Number of vertices of each chunk, or 0 to not split the array
+    ///
+    /// \see getChunkCount, getChunkBounds
+    ///
+    ////////////////////////////////////////////////////////////
+    void setChunkSize(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertices of each chunk
+    ///
+    /// \return Number of vertices of each chunk, 0 if the array is not split
+    ///
+    /// \see setChunkSize
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks of the vertex array
+    ///
+    /// The last chunk may hold less vertices than the others.
+    ///
+    /// \return Number of chunks, 0 if the array is not split
+    ///
+    /// \see setChunkSize
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the bounding rectangle of a chunk
+    ///
+    /// This function doesn't check \a chunk, it must be in range
+    /// [0, getChunkCount() - 1]. The behavior is undefined
+    /// otherwise.
+    ///
+    /// \param chunk Index of the chunk
+    ///
+    /// \return Bounding rectangle of the vertices of the chunk
+    ///
+    /// \see setChunkSize, getBounds
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getChunkBounds(std::size_t chunk) const;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached bounds of a range of vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Bounds
+    {
+        Vector2f min;     //!< Minimum coordinates of the vertices
+        Vector2f max;     //!< Maximum coordinates of the vertices
+        bool     valid{}; //!< Are the coordinates up to date?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Invalidate the cached bounds containing a vertex
+    ///
+    /// \param index Index of the vertex that may change
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateBounds(std::size_t index);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the vertex array to a render target
     ///
@@ -188,8 +304,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<Vertex> m_vertices;                             //!< Vertices contained in the array
-    PrimitiveType       m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    std::vector<Vertex>         m_vertices;                             //!< Vertices contained in the array
+    PrimitiveType               m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    std::size_t                 m_chunkSize{};                          //!< Vertices of each chunk, 0 if not split
+    mutable Bounds              m_bounds;                               //!< Cached bounds of the whole array
+    mutable std::vector<Bounds> m_chunkBounds;                          //!< Cached bounds of each chunk
 };
 
 } // namespace sf
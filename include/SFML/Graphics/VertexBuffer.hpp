@@ -32,10 +32,14 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <SFML/System/MemoryStats.hpp>
+
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
@@ -67,6 +71,17 @@ public:
         Static   //!< Rarely changing data
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief How the GPU is synchronized with a mapped range
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class MapMode
+    {
+        Write,         //!< Wait until the GPU is done with the range, its previous contents are kept
+        Discard,       //!< The previous contents of the range are discarded, no need to wait for the GPU
+        Unsynchronized //!< Don't wait for the GPU, the caller guarantees that it is not using the range
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -125,8 +140,9 @@ public:
     /// \brief Create the vertex buffer
     ///
     /// Creates the vertex buffer and allocates enough graphics
-    /// memory to hold \p vertexCount vertices. Any previously
-    /// allocated memory is freed in the process.
+    /// memory to hold \p vertexCount vertices of the current
+    /// layout. Any previously allocated memory is freed in the
+    /// process.
     ///
     /// In order to deallocate previously allocated memory pass 0
     /// as \p vertexCount. Don't forget to recreate with a non-zero
@@ -200,6 +216,25 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from vertices of any layout
+    ///
+    /// This function behaves like the overload taking sf::Vertex
+    /// instances, except that the vertices are stored as described
+    /// by the layout of the buffer: \p vertices must point to
+    /// \p vertexCount times the stride of the layout bytes.
+    ///
+    /// \param vertices    Pointer to the vertices to copy to the buffer
+    /// \param vertexCount Number of vertices to copy
+    /// \param offset      Offset in the buffer to copy to, in vertices
+    ///
+    /// \return True if the update was successful
+    ///
+    /// \see setLayout
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* vertices, std::size_t vertexCount, unsigned int offset);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the contents of another buffer into this buffer
     ///
@@ -210,6 +245,75 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const VertexBuffer& vertexBuffer);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a part of the buffer to write vertices directly into it
+    ///
+    /// This avoids building the vertices in an intermediate
+    /// array that update() would then copy. The returned
+    /// memory is write-only: reading from it is slow at best.
+    ///
+    /// \p mode tells how to synchronize with the GPU, which may
+    /// still be reading the range from previous draw calls:
+    /// \li MapMode::Write waits for the GPU if needed, the vertices
+    ///     that are not written keep their previous values
+    /// \li MapMode::Discard lets the driver give a fresh storage
+    ///     for the range, all of its vertices must be written
+    /// \li MapMode::Unsynchronized doesn't wait at all, the caller
+    ///     must only write vertices that the GPU is not using,
+    ///     typically a range that wasn't drawn since a previous frame
+    ///
+    /// Mapping the whole buffer with MapMode::Discard orphans its
+    /// storage: the driver rotates between storages internally, so
+    /// a buffer with Usage::Stream can be refilled every frame
+    /// without waiting for the frame that uses the previous data.
+    ///
+    /// The buffer must be unmapped with unmap() before it is
+    /// drawn, updated or mapped again.
+    ///
+    /// This function fails if the buffer was not created, if it
+    /// is already mapped, if the range is empty or exceeds the
+    /// size of the buffer or if mapping is not supported (OpenGL ES).
+    ///
+    /// The buffer must use the default layout, since the mapped
+    /// vertices are sf::Vertex instances.
+    ///
+    /// \param offset      Index of the first vertex to map
+    /// \param vertexCount Number of vertices to map
+    /// \param mode        How the mapping is synchronized with the GPU
+    ///
+    /// \return Pointer to the first mapped vertex, or a null pointer if mapping failed
+    ///
+    /// \see unmap, isMapped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* map(std::size_t offset, std::size_t vertexCount, MapMode mode = MapMode::Discard);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the buffer after writing to it
+    ///
+    /// The pointer returned by map() must not be used anymore
+    /// after calling this function.
+    ///
+    /// \return True if the written vertices are valid, false if the
+    ///         buffer was not mapped or if its contents were lost
+    ///         while it was mapped (on some systems, when the screen
+    ///         mode changes) and must be written again
+    ///
+    /// \see map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool unmap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the buffer is currently mapped
+    ///
+    /// \return True if the buffer is mapped, false otherwise
+    ///
+    /// \see map, unmap
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMapped() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -261,6 +365,37 @@ public:
     ////////////////////////////////////////////////////////////
     PrimitiveType getPrimitiveType() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how the vertices are stored in the buffer
+    ///
+    /// The layout defines the size of a vertex and where its
+    /// attributes are, so that the buffer can hold vertices that
+    /// are more compact than sf::Vertex or that provide additional
+    /// attributes to shaders.
+    ///
+    /// The memory of the buffer is not reallocated: its vertex
+    /// count is adjusted to the new size of a vertex. The layout
+    /// should therefore be set before the buffer is created.
+    ///
+    /// The default layout is the one of sf::Vertex.
+    ///
+    /// \param layout New layout of the vertices
+    ///
+    /// \see getLayout
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayout(const VertexLayout& layout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how the vertices are stored in the buffer
+    ///
+    /// \return Layout of the vertices
+    ///
+    /// \see setLayout
+    ///
+    ////////////////////////////////////////////////////////////
+    const VertexLayout& getLayout() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the usage specifier of this vertex buffer
     ///
@@ -338,6 +473,11 @@ private:
     std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
     PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    bool          m_mapped{};                             //!< Is the buffer currently mapped?
+    VertexLayout  m_layout;                               //!< How the vertices are stored
+    std::uint64_t m_memoryUsage{};                        //!< Video memory used by the buffer, in bytes
+
+    priv::MemoryCounter<MemoryStats::Category::VertexBuffer> m_memoryCounter; //!< Counts the buffer in sf::MemoryStats
 };
 
 ////////////////////////////////////////////////////////////
@@ -409,6 +549,27 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// window.draw(triangles);
 /// \endcode
 ///
-/// \see sf::Vertex, sf::VertexArray
+/// Vertices that change every frame, such as particles, can be
+/// written directly into the buffer instead:
+/// \code
+/// sf::VertexBuffer particles(sf::PrimitiveType::Points, sf::VertexBuffer::Usage::Stream);
+/// particles.create(particleCount);
+/// ...
+/// if (sf::Vertex* vertices = particles.map(0, particleCount))
+/// {
+///     for (std::size_t i = 0; i < particleCount; ++i)
+///         vertices[i] = {system.getPosition(i), system.getColor(i)};
+///
+///     if (particles.unmap())
+///         window.draw(particles);
+/// }
+/// \endcode
+///
+/// Vertices don't have to be sf::Vertex instances: the storage
+/// of the vertices can be described with a sf::VertexLayout, for
+/// example to use 16-bit coordinates or to pass additional
+/// attributes to a shader.
+///
+/// \see sf::Vertex, sf::VertexArray, sf::VertexLayout
 ///
 ////////////////////////////////////////////////////////////
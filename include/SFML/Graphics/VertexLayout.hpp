@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Description of how vertices are stored in memory
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API VertexLayout
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of the components of an attribute
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        Int8,   //!< 8-bit signed integer
+        UInt8,  //!< 8-bit unsigned integer
+        Int16,  //!< 16-bit signed integer
+        UInt16, //!< 16-bit unsigned integer
+        Float   //!< 32-bit floating point number
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Location and format of an attribute within a vertex
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Attribute
+    {
+        Type         type{Type::Float}; //!< Type of the components
+        unsigned int componentCount{};  //!< Number of components, from 1 to 4
+        std::size_t  offset{};          //!< Offset of the first component from the start of the vertex, in bytes
+        bool         normalized{};      //!< Are integers mapped to [0, 1] (unsigned) or [-1, 1] (signed)?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attribute passed to shaders by name
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CustomAttribute
+    {
+        std::string name;      //!< Name of the attribute variable in the vertex shader
+        Attribute   attribute; //!< Location and format of the attribute
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates the layout of sf::Vertex: a 2D position of floats,
+    /// a color of 4 bytes and texture coordinates of floats.
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexLayout();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a layout from its standard attributes
+    ///
+    /// The standard attributes must fit the fixed-function
+    /// pipeline of OpenGL:
+    /// \li \p position has 2 components of type Int16 or Float,
+    ///     which are not normalized
+    /// \li \p color has 4 components of type UInt8, which are
+    ///     normalized, or of type Float
+    /// \li \p texCoords has 2 components of type Int16 or Float,
+    ///     which are not normalized
+    ///
+    /// \param stride    Size of a vertex, in bytes
+    /// \param position  Position of the vertices
+    /// \param color     Color of the vertices
+    /// \param texCoords Texture coordinates of the vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexLayout(std::size_t stride, const Attribute& position, const Attribute& color, const Attribute& texCoords);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an attribute passed to the vertex shader
+    ///
+    /// The attribute feeds the vertex shader variable named
+    /// \p name when the vertices are drawn with a shader that
+    /// declares it; otherwise it is ignored.
+    ///
+    /// \param name      Name of the attribute variable in the vertex shader
+    /// \param attribute Location and format of the attribute
+    ///
+    ////////////////////////////////////////////////////////////
+    void addAttribute(std::string name, const Attribute& attribute);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a vertex
+    ///
+    /// \return Size of a vertex, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getStride() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position attribute
+    ///
+    /// \return Location and format of the position
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Attribute& getPosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color attribute
+    ///
+    /// \return Location and format of the color
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Attribute& getColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture coordinates attribute
+    ///
+    /// \return Location and format of the texture coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Attribute& getTexCoords() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the attributes passed to shaders by name
+    ///
+    /// \return Attributes added with addAttribute, in order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<CustomAttribute>& getCustomAttributes() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether this is the layout of sf::Vertex
+    ///
+    /// \return True if vertices of this layout are sf::Vertex instances
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDefault() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a component type
+    ///
+    /// \param type Type of component
+    ///
+    /// \return Size of a component of this type, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t getTypeSize(Type type);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t                  m_stride;           //!< Size of a vertex, in bytes
+    Attribute                    m_position;         //!< Position of the vertices
+    Attribute                    m_color;            //!< Color of the vertices
+    Attribute                    m_texCoords;        //!< Texture coordinates of the vertices
+    std::vector<CustomAttribute> m_customAttributes; //!< Attributes passed to shaders by name
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::VertexLayout
+/// \ingroup graphics
+///
+/// sf::VertexLayout tells sf::VertexBuffer how its vertices are
+/// stored, so that vertices don't have to be sf::Vertex
+/// instances. A compact layout reduces the memory and the
+/// bandwidth used by large meshes: for instance 16-bit positions
+/// relative to the origin of a chunk, given by the transform of
+/// the render states, and 16-bit texture coordinates in pixels
+/// take 12 bytes per vertex instead of 20.
+///
+/// Texture coordinates are interpreted according to the
+/// coordinate type of the render states, like those of sf::Vertex.
+///
+/// Additional attributes can be passed to the vertex shader of
+/// the render states; they are matched to the shader variables
+/// by name. Core profile contexts only use the standard
+/// attributes, since they draw with a built-in shader.
+///
+/// Usage example:
+/// \code
+/// struct TileVertex
+/// {
+///     std::int16_t  position[2];
+///     std::uint8_t  color[4];
+///     std::int16_t  texCoords[2];
+///     std::uint8_t  light[4];
+/// };
+///
+/// using Type = sf::VertexLayout::Type;
+/// sf::VertexLayout layout(sizeof(TileVertex),
+///                         {Type::Int16, 2, offsetof(TileVertex, position)},
+///                         {Type::UInt8, 4, offsetof(TileVertex, color), true},
+///                         {Type::Int16, 2, offsetof(TileVertex, texCoords)});
+/// layout.addAttribute("light", {Type::UInt8, 4, offsetof(TileVertex, light), true});
+///
+/// sf::VertexBuffer chunk(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+/// chunk.setLayout(layout);
+/// if (chunk.create(vertices.size()) && chunk.update(vertices.data(), vertices.size(), 0))
+///     window.draw(chunk, &tileShader);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::Vertex
+///
+////////////////////////////////////////////////////////////
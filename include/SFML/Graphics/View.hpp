@@ -230,6 +230,21 @@ public:
     ////////////////////////////////////////////////////////////
     void zoom(float factor);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of the scene seen through the view
+    ///
+    /// The visible area is the view rectangle defined by its
+    /// center and its size. If the view is rotated, the
+    /// returned rectangle is the smallest axis-aligned
+    /// rectangle that contains it.
+    ///
+    /// \return Bounding rectangle of the visible area, in scene coordinates
+    ///
+    /// \see getCenter, getSize, getRotation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getVisibleArea() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the projection transform of the view
     ///
@@ -0,0 +1,334 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <filesystem>
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Image too large for a texture, streamed tile by tile as it is displayed
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API VirtualTexture : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Build the tile pyramid of an image
+    ///
+    /// The image is cut into tiles of \a tileSize x \a tileSize
+    /// pixels, which are saved as qoi files in \a directory
+    /// along with the tiles of its successive half-size
+    /// levels, down to a level made of a single tile.
+    ///
+    /// Qoi images are decoded a band of rows at a time, so
+    /// that images much larger than the available memory can
+    /// be processed. Images in other formats are decoded whole
+    /// first, with the limits of sf::Image::loadFromFile.
+    ///
+    /// This is typically done once, offline or when the image
+    /// is installed, before it is opened with open.
+    ///
+    /// \param imageFilename Path of the image to cut
+    /// \param directory     Directory to write the pyramid to, created if needed
+    /// \param tileSize      Size of the tiles, in pixels
+    ///
+    /// \return True if the whole pyramid was written
+    ///
+    /// \see open
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool buildPyramid(const std::filesystem::path& imageFilename,
+                                           const std::filesystem::path& directory,
+                                           unsigned int                 tileSize = 256);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty virtual texture, which draws nothing
+    /// until a pyramid is opened.
+    ///
+    ////////////////////////////////////////////////////////////
+    VirtualTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~VirtualTexture() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    VirtualTexture(const VirtualTexture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    VirtualTexture& operator=(const VirtualTexture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a tile pyramid
+    ///
+    /// The coarsest level is loaded immediately, so that the
+    /// whole image can be drawn, blurry, right away. The other
+    /// tiles are loaded in the background as they are displayed.
+    ///
+    /// \param directory Directory of a pyramid written by buildPyramid
+    ///
+    /// \return True if the pyramid was opened successfully
+    ///
+    /// \see buildPyramid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the full resolution image
+    ///
+    /// \return Size of the image in pixels, or (0, 0) if no pyramid is open
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the tiles of the pyramid
+    ///
+    /// \return Size of the tiles, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of levels of the pyramid
+    ///
+    /// Level 0 is the full resolution image, each following
+    /// level is half the size of the previous one.
+    ///
+    /// \return Number of levels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLevelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of tiles kept in video memory
+    ///
+    /// The tiles are stored in a single cache texture; the
+    /// least recently displayed tiles are replaced when it is
+    /// full. The capacity is reduced if the cache texture
+    /// would exceed sf::Texture::getMaximumSize. Changing it
+    /// discards the loaded tiles. The default capacity is 144.
+    ///
+    /// \param tileCount Maximum number of resident tiles, at least 2
+    ///
+    /// \see getCacheCapacity
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCacheCapacity(std::size_t tileCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of tiles kept in video memory
+    ///
+    /// \return Maximum number of resident tiles
+    ///
+    /// \see setCacheCapacity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCacheCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of tiles uploaded each time the texture is drawn
+    ///
+    /// Limiting the uploads spreads their cost over several
+    /// frames when many tiles become visible at once. The
+    /// default limit is 4 tiles.
+    ///
+    /// \param tileCount Maximum number of tiles uploaded per draw, at least 1
+    ///
+    /// \see getUploadLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUploadLimit(std::size_t tileCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of tiles uploaded each time the texture is drawn
+    ///
+    /// \return Maximum number of tiles uploaded per draw
+    ///
+    /// \see setUploadLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getUploadLimit() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// Smoothing is enabled by default.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of tiles currently in video memory
+    ///
+    /// \return Number of resident tiles, including the coarsest level
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getResidentTileCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of tiles waiting to be loaded or uploaded
+    ///
+    /// When it drops to 0, everything that was displayed by
+    /// the last draw is shown at the right resolution.
+    ///
+    /// \return Number of pending tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingTileCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the image
+    ///
+    /// \return Local bounding rectangle, one unit per pixel of the full resolution image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the image
+    ///
+    /// \return Global bounding rectangle of the image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible tiles to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::VirtualTexture
+/// \ingroup graphics
+///
+/// sf::VirtualTexture displays images far larger than the
+/// maximum size of a texture, and than the memory budget of
+/// the application, such as map scans or satellite pictures.
+///
+/// The image is first cut into a pyramid of tiles with
+/// buildPyramid: level 0 holds the tiles of the full
+/// resolution image, each following level the tiles of an
+/// image of half the size, like mipmaps. The pyramid is a
+/// directory of small qoi files, fast to decode.
+///
+/// When the virtual texture is drawn, it computes which
+/// tiles are visible through the view of the target, and at
+/// which level, from the number of pixels of the image that
+/// cover a pixel of the target. The tiles that are already in
+/// video memory are drawn; the missing ones are requested
+/// from a background thread, which decodes them, and are
+/// replaced in the meantime by the corresponding part of the
+/// closest coarser level that is loaded. This feedback is
+/// entirely internal: drawing the texture is all it takes.
+///
+/// The loaded tiles are kept in a single cache texture, so
+/// that all the visible tiles are drawn in one call, and the
+/// least recently used ones are replaced when it is full.
+///
+/// The virtual texture is drawn with the transform of its
+/// sf::Transformable base, one unit per pixel of the full
+/// resolution image, like a sprite.
+///
+/// Usage example:
+/// \code
+/// // Once, offline
+/// if (!sf::VirtualTexture::buildPyramid("scan.qoi", "scan"))
+///     return -1;
+///
+/// // In the application
+/// sf::VirtualTexture map;
+/// if (!map.open("scan"))
+///     return -1;
+///
+/// sf::View view(window.getDefaultView());
+/// ...
+/// window.setView(view); // zoomed and moved by the user
+/// window.clear();
+/// window.draw(map);
+/// window.display();
+/// \endcode
+///
+/// \see sf::Texture, sf::TextureStreamer
+///
+////////////////////////////////////////////////////////////
@@ -30,13 +30,21 @@
 
 #include <SFML/Network/Ftp.hpp>
 #include <SFML/Network/Http.hpp>
+#include <SFML/Network/HttpDownloader.hpp>
+#include <SFML/Network/IoContext.hpp>
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/NetworkStats.hpp>
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketPool.hpp>
+#include <SFML/Network/PacketView.hpp>
+#include <SFML/Network/ReliableUdpChannel.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketHandle.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpListener.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TimerWheel.hpp>
+#include <SFML/Network/TlsSocket.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <SFML/System.hpp>
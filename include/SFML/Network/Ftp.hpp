@@ -37,6 +37,8 @@
 #include <string>
 #include <vector>
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -507,6 +509,61 @@ public:
                                   TransferMode                 mode   = TransferMode::Binary,
                                   bool                         append = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resume the download of a file from the server
+    ///
+    /// This function works like download, except that if the
+    /// local file already exists, only the part of the distant
+    /// file that it doesn't contain yet is downloaded and
+    /// appended to it. Unlike download, the local file is kept
+    /// if the transfer fails, so that it can be resumed later.
+    /// The server must support the REST command.
+    ///
+    /// \param remoteFile Filename of the distant file to download
+    /// \param localPath  The directory in which to put the file on the local computer
+    /// \param mode       Transfer mode
+    ///
+    /// \return Server response to the request
+    ///
+    /// \see download, resumeUpload
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response resumeDownload(const std::filesystem::path& remoteFile,
+                                          const std::filesystem::path& localPath,
+                                          TransferMode                 mode = TransferMode::Binary);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resume the upload of a file to the server
+    ///
+    /// This function works like upload, except that if the
+    /// remote file already exists, only the part of the local
+    /// file that it doesn't contain yet is uploaded and appended
+    /// to it. The server must support the SIZE command.
+    ///
+    /// \param localFile  Path of the local file to upload
+    /// \param remotePath The directory in which to put the file on the server
+    /// \param mode       Transfer mode
+    ///
+    /// \return Server response to the request
+    ///
+    /// \see upload, resumeDownload
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response resumeUpload(const std::filesystem::path& localFile,
+                                        const std::filesystem::path& remotePath,
+                                        TransferMode                 mode = TransferMode::Binary);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the buffer used to transfer files
+    ///
+    /// Larger buffers need less system calls to transfer a
+    /// file. The default size is 64 KiB.
+    ///
+    /// \param size Size of the transfer buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransferBufferSize(std::size_t size);
+
     ////////////////////////////////////////////////////////////
     /// \brief Send a command to the FTP server
     ///
@@ -537,6 +594,40 @@ private:
     ////////////////////////////////////////////////////////////
     Response getResponse();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Download a file, possibly resuming a previous download
+    ///
+    /// \param remoteFile Filename of the distant file to download
+    /// \param localPath  The directory in which to put the file on the local computer
+    /// \param mode       Transfer mode
+    /// \param resume     Pass true to complete the existing local file
+    ///
+    /// \return Server response to the request
+    ///
+    ////////////////////////////////////////////////////////////
+    Response receiveFile(const std::filesystem::path& remoteFile,
+                         const std::filesystem::path& localPath,
+                         TransferMode                 mode,
+                         bool                         resume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a file, possibly resuming a previous upload
+    ///
+    /// \param localFile  Path of the local file to upload
+    /// \param remotePath The directory in which to put the file on the server
+    /// \param mode       Transfer mode
+    /// \param append     Pass true to append to the remote file if it already exists
+    /// \param resume     Pass true to complete the existing remote file
+    ///
+    /// \return Server response to the request
+    ///
+    ////////////////////////////////////////////////////////////
+    Response sendFile(const std::filesystem::path& localFile,
+                      const std::filesystem::path& remotePath,
+                      TransferMode                 mode,
+                      bool                         append,
+                      bool                         resume);
+
     ////////////////////////////////////////////////////////////
     /// \brief Utility class for exchanging data with the server
     ///        on the data channel
@@ -549,8 +640,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket   m_commandSocket; //!< Socket holding the control connection with the server
-    std::string m_receiveBuffer; //!< Received command data that is yet to be processed
+    TcpSocket   m_commandSocket;             //!< Socket holding the control connection with the server
+    std::string m_receiveBuffer;             //!< Received command data that is yet to be processed
+    std::size_t m_transferBufferSize{65536}; //!< Size of the buffer used to transfer files
 };
 
 } // namespace sf
@@ -587,6 +679,10 @@ private:
 /// to block your application while the server is completing
 /// the task.
 ///
+/// A FTP connection transfers one file at a time. Several files
+/// can be transferred in parallel with several sf::Ftp instances,
+/// each one used by its own thread.
+///
 /// Usage example:
 /// \code
 /// // Create a new FTP client
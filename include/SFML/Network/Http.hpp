@@ -30,15 +30,17 @@
 #include <SFML/Network/Export.hpp>
 
 #include <SFML/Network/IpAddress.hpp>
-#include <SFML/Network/TcpSocket.hpp>
 
 #include <SFML/System/Time.hpp>
 
+#include <functional>
 #include <iosfwd>
 #include <map>
 #include <optional>
 #include <string>
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -301,13 +303,12 @@ public:
         /// \brief Construct the header from a response string
         ///
         /// This function is used by Http to build the response
-        /// of a request.
+        /// of a request, before its body is received.
         ///
-        /// \param data Content of the response to parse
+        /// \param header Status line and header fields of the response
         ///
         ////////////////////////////////////////////////////////////
-        void parse(const std::string& data);
-
+        void parseHeader(const std::string& header);
 
         ////////////////////////////////////////////////////////////
         /// \brief Read values passed in the answer header
@@ -347,9 +348,9 @@ public:
     /// This is equivalent to calling setHost(host, port).
     /// The port has a default value of 0, which means that the
     /// HTTP client will use the right port according to the
-    /// protocol used (80 for HTTP). You should leave it like
-    /// this unless you really need a port other than the
-    /// standard one, or use an unknown protocol.
+    /// protocol used (80 for HTTP, 443 for HTTPS). You should
+    /// leave it like this unless you really need a port other
+    /// than the standard one, or use an unknown protocol.
     ///
     /// \param host Web server to connect to
     /// \param port Port to use for connection
@@ -376,9 +377,13 @@ public:
     /// doesn't actually connect to it until you send a request.
     /// The port has a default value of 0, which means that the
     /// HTTP client will use the right port according to the
-    /// protocol used (80 for HTTP). You should leave it like
-    /// this unless you really need a port other than the
-    /// standard one, or use an unknown protocol.
+    /// protocol used (80 for HTTP, 443 for HTTPS). You should
+    /// leave it like this unless you really need a port other
+    /// than the standard one, or use an unknown protocol.
+    ///
+    /// HTTPS hosts require SFML to be built with a TLS backend
+    /// (see sf::TlsSocket::isAvailable); otherwise, the host is
+    /// rejected and the requests fail.
     ///
     /// \param host Web server to connect to
     /// \param port Port to use for connection
@@ -398,6 +403,13 @@ public:
     /// of Time::Zero means that the client will use the system default timeout
     /// (which is usually pretty long).
     ///
+    /// HTTP/1.1 connections are persistent: unless the request or
+    /// the response has a "Connection: close" field, the connection
+    /// is kept open after the response, and reused by the next
+    /// requests sent to the same host, even by other sf::Http
+    /// instances. HTTP/1.0 requests can ask for the same behavior
+    /// with a "Connection: keep-alive" field.
+    ///
     /// \param request Request to send
     /// \param timeout Maximum time to wait
     ///
@@ -406,14 +418,44 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback receiving the body of a response
+    ///
+    /// The callback is given the body piece by piece, as it is
+    /// received, and returns false to cancel the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using BodyCallback = std::function<bool(const char* data, std::size_t size)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the body of the server's response
+    ///
+    /// This function works like sendRequest(request, timeout),
+    /// but the body of the response is passed to \a bodyCallback
+    /// as it is received instead of being stored in the returned
+    /// response. This allows downloading large files without
+    /// holding them in memory. The callback is called from the
+    /// thread calling this function, before it returns.
+    ///
+    /// \param request      Request to send
+    /// \param bodyCallback Function receiving the body of the response
+    /// \param timeout      Maximum time to wait
+    ///
+    /// \return Server's response, with an empty body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request&      request,
+                                       const BodyCallback& bodyCallback,
+                                       Time                timeout = Time::Zero);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket                m_connection; //!< Connection to the host
     std::optional<IpAddress> m_host;       //!< Web host address
     std::string              m_hostName;   //!< Web host name
     unsigned short           m_port{};     //!< Port used for connection with host
+    bool                     m_isSecure{}; //!< Use HTTPS?
 };
 
 } // namespace sf
@@ -427,7 +469,8 @@ private:
 /// to communicate with a web server. You can retrieve
 /// web pages, send data to an interactive resource,
 /// download a remote file, etc. The HTTPS protocol is
-/// not supported.
+/// supported when SFML is built with a TLS backend (see
+/// sf::TlsSocket).
 ///
 /// The HTTP client is split into 3 classes:
 /// \li sf::Http::Request
@@ -477,4 +520,17 @@ private:
 /// }
 /// \endcode
 ///
+/// Large resources can be received piece by piece, and the
+/// connection kept alive for the next requests:
+/// \code
+/// sf::Http::Request request("/patches/data.pak");
+/// request.setHttpVersion(1, 1);
+///
+/// std::ofstream file("data.pak", std::ios::binary);
+/// const auto    writeToFile = [&file](const char* data, std::size_t size)
+/// { return static_cast<bool>(file.write(data, static_cast<std::streamsize>(size))); };
+///
+/// sf::Http::Response response = http.sendRequest(request, writeToFile);
+/// \endcode
+///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Download of large files over several HTTP connections
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API HttpDownloader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback receiving the progress of a download
+    ///
+    /// The callback is given the number of bytes downloaded so
+    /// far and the size of the file, each time a chunk is
+    /// complete, and returns false to cancel the download.
+    ///
+    ////////////////////////////////////////////////////////////
+    using ProgressCallback = std::function<bool(std::uint64_t downloaded, std::uint64_t total)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the downloader with the target host
+    ///
+    /// The host and port are interpreted like sf::Http::setHost
+    /// does, HTTPS hosts are supported when SFML is built with
+    /// a TLS backend.
+    ///
+    /// \param host Web server to download the files from
+    /// \param port Port to use for connection
+    ///
+    ////////////////////////////////////////////////////////////
+    HttpDownloader(std::string host, unsigned short port = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of connections used by a download
+    ///
+    /// The chunks of a file are downloaded concurrently, each
+    /// connection in a thread of its own. The default is 4.
+    ///
+    /// \param count Maximum number of concurrent connections
+    ///
+    ////////////////////////////////////////////////////////////
+    void setConnectionCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the chunks that the files are split into
+    ///
+    /// Each chunk is requested separately, with a "Range" header
+    /// field. It is also the granularity of the hashes and of the
+    /// resumption of interrupted downloads. The default is 4 MiB.
+    ///
+    /// \param size Size of the chunks, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setChunkSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the expected hashes of the chunks of the next downloads
+    ///
+    /// Each downloaded chunk is hashed with computeHash and
+    /// compared with the corresponding hash; chunks that don't
+    /// match are downloaded again. The hashes must have been
+    /// computed with the same chunk size, the last chunk being
+    /// smaller if the file size isn't a multiple of it. There
+    /// are no hashes by default, and the chunks aren't verified.
+    ///
+    /// \param hashes Hash of each chunk of the file, in order, or an empty vector to disable the verification
+    ///
+    /// \see computeHash
+    ///
+    ////////////////////////////////////////////////////////////
+    void setChunkHashes(std::vector<std::uint64_t> hashes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum time to wait for each request
+    ///
+    /// \param timeout Maximum time to wait, Time::Zero for the system default
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTimeout(Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Download a file
+    ///
+    /// The size of the file is first requested from the server.
+    /// The destination file is then allocated to its final size,
+    /// and the chunks are requested over several connections and
+    /// written in place as they are received. Servers that don't
+    /// support ranges send the file over a single connection.
+    ///
+    /// The progress of the download is saved next to the file,
+    /// with a ".resume" extension. If the download is interrupted
+    /// (by an error, a cancellation or the end of the program),
+    /// calling this function again with the same file only
+    /// downloads the missing chunks, as long as the file didn't
+    /// change on the server, as told by its "ETag" or
+    /// "Last-Modified" field.
+    ///
+    /// This function blocks until the download is over. The
+    /// progress callback is called from the threads of the
+    /// connections, but never from several threads at once.
+    ///
+    /// \param uri              URI of the file, relative to the host
+    /// \param filename         Path of the destination file
+    /// \param progressCallback Optional function receiving the progress of the download
+    ///
+    /// \return True if the whole file was downloaded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool download(const std::string&           uri,
+                                const std::filesystem::path& filename,
+                                const ProgressCallback&      progressCallback = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the hash used to verify the chunks
+    ///
+    /// The hash is the 64-bit FNV-1a hash of the data. It
+    /// detects corruption, but doesn't protect against a
+    /// malicious server.
+    ///
+    /// \param data Pointer to the data of the chunk
+    /// \param size Size of the chunk, in bytes
+    ///
+    /// \return Hash of the chunk
+    ///
+    /// \see setChunkHashes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::uint64_t computeHash(const void* data, std::size_t size);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::string                m_host;                       //!< Web server to download the files from
+    unsigned short             m_port{};                     //!< Port used for connection with the host
+    std::size_t                m_connectionCount{4};         //!< Maximum number of concurrent connections
+    std::size_t                m_chunkSize{4 * 1024 * 1024}; //!< Size of the chunks requested separately
+    std::vector<std::uint64_t> m_chunkHashes;                //!< Expected hash of each chunk
+    Time                       m_timeout;                    //!< Maximum time to wait for each request
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::HttpDownloader
+/// \ingroup network
+///
+/// sf::HttpDownloader downloads large files, such as the
+/// content of a game patch, faster and more reliably than a
+/// single sf::Http request. The file is split into chunks
+/// that are requested with "Range" header fields over several
+/// concurrent connections, which makes better use of links
+/// with a high latency. The chunks are written directly at
+/// their place in the destination file, and can be checked
+/// against a list of hashes published along with the file.
+///
+/// Interrupted downloads are resumed where they stopped: only
+/// the chunks that weren't complete are downloaded again.
+///
+/// Usage example:
+/// \code
+/// sf::HttpDownloader downloader("https://cdn.example.com");
+/// downloader.setConnectionCount(8);
+///
+/// const bool success = downloader.download("/patches/data.pak",
+///                                          "data.pak",
+///                                          [](std::uint64_t downloaded, std::uint64_t total)
+///                                          {
+///                                              std::cout << downloaded * 100 / total << "%" << std::endl;
+///                                              return true;
+///                                          });
+/// \endcode
+///
+/// \see sf::Http
+///
+////////////////////////////////////////////////////////////
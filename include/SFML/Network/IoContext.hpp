@@ -0,0 +1,399 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+#include <SFML/Network/TimerWheel.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Packet;
+class TcpListener;
+class TcpSocket;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Event loop running asynchronous socket operations
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API IoContext
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of operations that transfer bytes
+    ///
+    /// The handler receives the status of the operation and the
+    /// number of bytes that were sent or received.
+    ///
+    ////////////////////////////////////////////////////////////
+    using TransferHandler = std::function<void(Socket::Status, std::size_t)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of operations that only report a status
+    ///
+    ////////////////////////////////////////////////////////////
+    using StatusHandler = std::function<void(Socket::Status)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of UDP receptions
+    ///
+    /// The handler receives the status of the operation, the
+    /// number of bytes received, and the address and port of
+    /// the sender.
+    ///
+    ////////////////////////////////////////////////////////////
+    using DatagramHandler = std::function<void(Socket::Status, std::size_t, std::optional<IpAddress>, unsigned short)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The handlers of the operations that are still pending
+    /// are destroyed without being called.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IoContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext(const IoContext&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext& operator=(const IoContext&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a function to be called by the event loop
+    ///
+    /// This function can be called from any thread, including
+    /// from the handlers run by the loop.
+    ///
+    /// \param handler Function to call
+    ///
+    ////////////////////////////////////////////////////////////
+    void post(std::function<void()> handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept a new connection asynchronously
+    ///
+    /// \param listener Listener to accept the connection from
+    /// \param socket   Socket that will hold the new connection
+    /// \param handler  Function called with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncAccept(TcpListener& listener, TcpSocket& socket, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send raw data asynchronously to the remote peer
+    ///
+    /// The operation completes once all the data is sent, or
+    /// when the connection fails. The data must stay valid
+    /// until the handler is called.
+    ///
+    /// \param socket  Connected socket to send the data with
+    /// \param data    Pointer to the sequence of bytes to send
+    /// \param size    Number of bytes to send
+    /// \param handler Function called with the status of the operation and the number of bytes sent
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket& socket, const void* data, std::size_t size, TransferHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive raw data asynchronously from the remote peer
+    ///
+    /// The operation completes as soon as some data is received,
+    /// like TcpSocket::receive. The buffer must stay valid until
+    /// the handler is called.
+    ///
+    /// \param socket  Connected socket to receive the data with
+    /// \param data    Pointer to the array to fill with the received bytes
+    /// \param size    Maximum number of bytes that can be received
+    /// \param handler Function called with the status of the operation and the number of bytes received
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket& socket, void* data, std::size_t size, TransferHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a formatted packet asynchronously to the remote peer
+    ///
+    /// The packet must stay valid, and must not be modified,
+    /// until the handler is called.
+    ///
+    /// \param socket  Connected socket to send the packet with
+    /// \param packet  Packet to send
+    /// \param handler Function called with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket& socket, Packet& packet, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a formatted packet asynchronously from the remote peer
+    ///
+    /// The operation completes once the whole packet is received.
+    /// The packet must stay valid until the handler is called.
+    ///
+    /// \param socket  Connected socket to receive the packet with
+    /// \param packet  Packet to fill with the received data
+    /// \param handler Function called with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket& socket, Packet& packet, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a datagram asynchronously to a remote peer
+    ///
+    /// The data must stay valid until the handler is called.
+    ///
+    /// \param socket        Socket to send the datagram with
+    /// \param data          Pointer to the sequence of bytes to send
+    /// \param size          Number of bytes to send
+    /// \param remoteAddress Address of the receiver
+    /// \param remotePort    Port of the receiver to send the data to
+    /// \param handler       Function called with the status of the operation and the number of bytes sent
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(UdpSocket&       socket,
+                   const void*      data,
+                   std::size_t      size,
+                   const IpAddress& remoteAddress,
+                   unsigned short   remotePort,
+                   TransferHandler  handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a datagram asynchronously
+    ///
+    /// The buffer must stay valid until the handler is called.
+    ///
+    /// \param socket  Bound socket to receive the datagram with
+    /// \param data    Pointer to the array to fill with the received bytes
+    /// \param size    Maximum number of bytes that can be received
+    /// \param handler Function called with the status of the operation, the size and the sender of the datagram
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(UdpSocket& socket, void* data, std::size_t size, DatagramHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function asynchronously after a delay
+    ///
+    /// The timers are kept in a sf::TimerWheel, so that starting
+    /// and cancelling them is cheap even with one timer per
+    /// connection. The loop wakes up in time to run the handler,
+    /// and pending timers keep run from returning.
+    ///
+    /// \param delay   Time to wait before calling the handler
+    /// \param handler Function to call once the delay is over
+    ///
+    /// \return Identifier of the timer, to give to cancelWait
+    ///
+    /// \see cancelWait
+    ///
+    ////////////////////////////////////////////////////////////
+    TimerWheel::Id asyncWait(Time delay, std::function<void()> handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cancel a timer started by asyncWait
+    ///
+    /// The handler of the timer is destroyed without being called.
+    ///
+    /// \param timer Identifier returned by asyncWait
+    ///
+    /// \return True if the timer was cancelled, false if it already expired or was cancelled
+    ///
+    /// \see asyncWait
+    ///
+    ////////////////////////////////////////////////////////////
+    bool cancelWait(TimerWheel::Id timer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the event loop
+    ///
+    /// This function blocks until there are no more pending
+    /// operations and handlers, or until stop is called. It can
+    /// be called from several threads at once, which then share
+    /// the handlers to run.
+    ///
+    /// \return Number of handlers that were run by this call
+    ///
+    /// \see poll, stop
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t run();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the handlers that are ready, without blocking
+    ///
+    /// This is meant to be called once per frame by applications
+    /// that already have a main loop.
+    ///
+    /// \return Number of handlers that were run by this call
+    ///
+    /// \see run
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t poll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the event loop
+    ///
+    /// All the calls to run and poll return as soon as possible.
+    /// Later calls return immediately, until restart is called.
+    /// Pending operations are kept.
+    ///
+    /// \see restart, isStopped
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allow the event loop to run again after being stopped
+    ///
+    /// \see stop
+    ///
+    ////////////////////////////////////////////////////////////
+    void restart();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the event loop is stopped
+    ///
+    /// \return True if stop was called since the last restart
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isStopped() const;
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IoContext
+/// \ingroup network
+///
+/// sf::IoContext runs socket operations asynchronously and
+/// calls a completion handler when each of them is over, so
+/// that a server can handle many connections without a thread
+/// per connection or a hand-written sf::SocketSelector loop.
+///
+/// The sockets used with an sf::IoContext are switched to
+/// non-blocking mode, and must stay alive, and must not be
+/// moved, while they have pending operations.
+///
+/// The loop runs in run (or poll), which can be called from
+/// several threads. The handlers of the operations on a
+/// same socket are never called concurrently, and operations
+/// of the same kind on a socket complete in the order they
+/// were started, so the state of a connection doesn't need to
+/// be protected by a mutex as long as it is only touched by
+/// its handlers. The handlers given to post can run on any
+/// thread.
+///
+/// Starting a new operation from a completion handler is the
+/// usual way to keep a connection going. Timeouts, heartbeats
+/// and other delayed work are started with asyncWait, whose
+/// handlers run on the loop like the completion handlers.
+///
+/// On Linux 5.11 and later, the loop waits for the sockets with
+/// io_uring, which submits the changes of the watched sockets
+/// along with the wait in a single system call; older kernels,
+/// and systems where io_uring is disabled, use epoll.
+///
+/// Usage example:
+/// \code
+/// sf::IoContext context;
+/// sf::TcpListener listener;
+/// if (listener.listen(55001) != sf::Socket::Status::Done)
+/// {
+///     // Handle error...
+/// }
+///
+/// struct Client
+/// {
+///     sf::TcpSocket socket;
+///     sf::Packet    packet;
+/// };
+///
+/// std::function<void(Client&)> receive = [&](Client& client)
+/// {
+///     context.asyncReceive(client.socket, client.packet, [&](sf::Socket::Status status)
+///     {
+///         if (status != sf::Socket::Status::Done)
+///             return; // Disconnected
+///
+///         // Process client.packet...
+///         receive(client);
+///     });
+/// };
+///
+/// std::list<Client> clients;
+/// std::function<void()> accept = [&]
+/// {
+///     Client& client = clients.emplace_back();
+///     context.asyncAccept(listener, client.socket, [&](sf::Socket::Status status)
+///     {
+///         if (status == sf::Socket::Status::Done)
+///             receive(client);
+///         accept();
+///     });
+/// };
+///
+/// accept();
+/// context.run();
+/// \endcode
+///
+/// \see sf::SocketSelector, sf::TcpSocket, sf::UdpSocket
+///
+////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 
 #include <SFML/System/Time.hpp>
 
+#include <array>
+#include <future>
 #include <iosfwd>
 #include <optional>
 #include <string>
@@ -42,23 +44,70 @@
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Encapsulate an IPv4 network address
+/// \brief Encapsulate an IPv4 or IPv6 network address
 ///
 ////////////////////////////////////////////////////////////
 class SFML_NETWORK_API IpAddress
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Version of the Internet Protocol of an address
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        V4, //!< IPv4 address, made of 4 bytes
+        V6  //!< IPv6 address, made of 16 bytes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the address from a null-terminated string view
     ///
     /// Here \a address can be either a decimal address
-    /// (ex: "192.168.1.56") or a network name (ex: "localhost").
+    /// (ex: "192.168.1.56"), a hexadecimal IPv6 address
+    /// (ex: "2001:db8::1") or a network name (ex: "localhost").
+    /// When a network name has both IPv4 and IPv6 addresses,
+    /// the IPv4 one is preferred.
     ///
     /// \param address IP address or network name
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<IpAddress> resolve(std::string_view address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve an address without blocking the calling thread
+    ///
+    /// Host names are resolved by a small pool of background
+    /// threads, so that a slow resolver doesn't freeze the
+    /// application. Addresses that are already in decimal form,
+    /// or whose resolution is cached, are available right away.
+    ///
+    /// \param address IP address or network name
+    ///
+    /// \return Future that provides the address once it is resolved
+    ///
+    /// \see resolve, setResolveCacheDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::future<std::optional<IpAddress>> resolveAsync(std::string address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change how long host names that were resolved are remembered
+    ///
+    /// Both resolve and resolveAsync reuse the address of a host
+    /// name resolved within this duration instead of querying
+    /// the resolver again. Failed resolutions are not cached.
+    /// The system resolver doesn't give the lifetime of DNS
+    /// records, so the same duration applies to all of them.
+    /// Setting a duration of zero disables the cache and empties it.
+    ///
+    /// The default duration is 30 seconds.
+    ///
+    /// \param duration Time during which a resolved address is reused
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setResolveCacheDuration(Time duration);
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the address from 4 bytes
     ///
@@ -89,12 +138,34 @@ public:
     ////////////////////////////////////////////////////////////
     explicit IpAddress(std::uint32_t address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IPv6 address from its 16 bytes
+    ///
+    /// The bytes are given in network order, i.e. the
+    /// address 2001:db8::1 starts with 0x20 and 0x01.
+    ///
+    /// \param bytes 16 bytes of the address
+    ///
+    /// \see toBytes
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IpAddress(const std::array<std::uint8_t, 16>& bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the version of the Internet Protocol of the address
+    ///
+    /// \return Type of the address
+    ///
+    ////////////////////////////////////////////////////////////
+    Type getType() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a string representation of the address
     ///
-    /// The returned string is the decimal representation of the
-    /// IP address (like "192.168.1.56"), even if it was constructed
-    /// from a host name.
+    /// The returned string is the decimal representation of an
+    /// IPv4 address (like "192.168.1.56") or the shortest
+    /// hexadecimal representation of an IPv6 address (like
+    /// "2001:db8::1"), even if it was constructed from a host name.
     ///
     /// \return String representation of the address
     ///
@@ -112,13 +183,29 @@ public:
     /// The integer produced by this function can then be converted
     /// back to a sf::IpAddress with the proper constructor.
     ///
+    /// This function can only be called on IPv4 addresses.
+    ///
     /// \return 32-bits unsigned integer representation of the address
     ///
-    /// \see toString
+    /// \see toString, toBytes
     ///
     ////////////////////////////////////////////////////////////
     std::uint32_t toInteger() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the 16 bytes of the address, in network order
+    ///
+    /// IPv4 addresses are returned in their IPv4-mapped IPv6
+    /// form (like ::ffff:192.168.1.56), which is how dual-stack
+    /// sockets see them.
+    ///
+    /// \return 16 bytes of the address
+    ///
+    /// \see toInteger
+    ///
+    ////////////////////////////////////////////////////////////
+    std::array<std::uint8_t, 16> toBytes() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the computer's local address
     ///
@@ -163,9 +250,11 @@ public:
     // Static member data
     ////////////////////////////////////////////////////////////
     // NOLINTBEGIN(readability-identifier-naming)
-    static const IpAddress Any;       //!< Value representing any address (0.0.0.0)
-    static const IpAddress LocalHost; //!< The "localhost" address (for connecting a computer to itself locally)
-    static const IpAddress Broadcast; //!< The "broadcast" address (for sending UDP messages to everyone on a local network)
+    static const IpAddress Any;         //!< Value representing any address (0.0.0.0)
+    static const IpAddress LocalHost;   //!< The "localhost" address (for connecting a computer to itself locally)
+    static const IpAddress Broadcast;   //!< The "broadcast" address (for sending UDP messages to everyone on a local network)
+    static const IpAddress AnyV6;       //!< Value representing any IPv6 address (::), also accepting IPv4 clients
+    static const IpAddress LocalHostV6; //!< The IPv6 "localhost" address (::1)
     // NOLINTEND(readability-identifier-naming)
 
 private:
@@ -174,7 +263,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::uint32_t m_address; //!< Address stored as an unsigned 32 bits integer
+    std::array<std::uint8_t, 16> m_bytes{};        //!< Address bytes in network order, IPv4 ones stored in the first 4
+    Type                         m_type{Type::V4}; //!< Version of the Internet Protocol of the address
 };
 
 ////////////////////////////////////////////////////////////
@@ -287,9 +377,24 @@ SFML_NETWORK_API std::ostream& operator<<(std::ostream& stream, const IpAddress&
 /// auto a7 = sf::IpAddress::resolve("www.google.com"); // a distant address created from a network name
 /// auto a8 = sf::IpAddress::getLocalAddress();         // my address on the local network
 /// auto a9 = sf::IpAddress::getPublicAddress();        // my address on the internet
+/// auto a10 = sf::IpAddress::resolve("::1");           // the IPv6 local host address
+/// \endcode
+///
+/// Resolving a host name may take a while. resolveAsync does it
+/// in the background, and the result can be checked every frame:
+/// \code
+/// auto future = sf::IpAddress::resolveAsync("matchmaking.example.com");
+///
+/// // In the main loop
+/// if (future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+/// {
+///     if (const std::optional<sf::IpAddress> address = future.get())
+///         connect(*address);
+/// }
 /// \endcode
 ///
-/// Note that sf::IpAddress currently doesn't support IPv6
-/// nor other types of network addresses.
+/// IPv6 addresses are supported too. A socket bound or connected
+/// to an IPv6 address is dual-stack: it also talks to IPv4 peers,
+/// which it reports as regular IPv4 addresses.
 ///
 ////////////////////////////////////////////////////////////
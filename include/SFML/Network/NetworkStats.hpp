@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Counters of the network activity
+///
+////////////////////////////////////////////////////////////
+struct SFML_NETWORK_API NetworkStats
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of buckets of the latency histogram
+    ///
+    /// Bucket 0 counts the latencies below 2 microseconds,
+    /// bucket i the latencies in [2^i, 2^(i+1)) microseconds,
+    /// and the last bucket all the latencies above.
+    ///
+    ////////////////////////////////////////////////////////////
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static constexpr std::size_t LatencyBucketCount{24};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the collection of statistics
+    ///
+    /// Statistics are disabled by default, and then cost
+    /// nothing more than a test per operation. While they are
+    /// disabled, the counters keep their values.
+    ///
+    /// \param enabled True to collect statistics
+    ///
+    /// \see isEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether statistics are collected
+    ///
+    /// \return True if statistics are collected
+    ///
+    /// \see setEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isEnabled();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics aggregated over all the sockets
+    ///
+    /// This function can be called from any thread.
+    ///
+    /// \return Snapshot of the global counters
+    ///
+    /// \see resetGlobal, sf::Socket::getStats
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static NetworkStats getGlobal();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the global counters to zero
+    ///
+    /// \see getGlobal
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resetGlobal();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bucket of the latency histogram that counts a latency
+    ///
+    /// \param latency Latency to classify
+    ///
+    /// \return Index of the bucket, in [0, LatencyBucketCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t getLatencyBucket(Time latency);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::uint64_t                                 bytesSent{};       //!< Number of bytes sent
+    std::uint64_t                                 bytesReceived{};   //!< Number of bytes received
+    std::uint64_t                                 packetsSent{};     //!< Number of packets or datagrams sent
+    std::uint64_t                                 packetsReceived{}; //!< Number of packets or datagrams received
+    std::uint64_t                                 systemCalls{};     //!< Number of system calls moving data
+    std::uint64_t                                 partialSends{};    //!< Number of partial sends
+    Time                                          selectorWaitTime;  //!< Time waiting in sf::SocketSelector (global)
+    std::array<std::uint64_t, LatencyBucketCount> receiveLatency{};  //!< Histogram of TCP packet latencies
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::NetworkStats
+/// \ingroup network
+///
+/// sf::NetworkStats gathers counters of the network activity,
+/// to monitor an application or feed a metrics pipeline
+/// without wrapping every socket call. The collection is
+/// opt-in: enable it with sf::NetworkStats::setEnabled.
+///
+/// Every socket keeps its own counters (see sf::Socket::getStats),
+/// and all of them are also added to global counters, which
+/// can be read from any thread with sf::NetworkStats::getGlobal.
+///
+/// The byte counters count the payload given to or returned by
+/// the socket functions; for sf::TlsSocket, it is the data
+/// before encryption. The size that prefixes sf::Packet data
+/// over TCP is counted too.
+///
+/// The receive latency histogram measures, for each sf::Packet
+/// received by sf::TcpSocket::receive(Packet&), the time elapsed
+/// between the arrival of its first byte and its completion;
+/// it shows how long packets stay partially received.
+///
+/// Usage example:
+/// \code
+/// sf::NetworkStats::setEnabled(true);
+///
+/// // ... use sockets ...
+///
+/// const sf::NetworkStats stats = sf::NetworkStats::getGlobal();
+/// std::cout << stats.bytesSent << " bytes sent in " << stats.systemCalls << " system calls" << std::endl;
+/// for (std::size_t i = 0; i < sf::NetworkStats::LatencyBucketCount; ++i)
+///     std::cout << "< " << (2 << i) << " us: " << stats.receiveLatency[i] << std::endl;
+/// \endcode
+///
+/// \see sf::Socket
+///
+////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <SFML/System/Allocator.hpp>
+#include <SFML/System/MemoryStats.hpp>
+
 #include <string>
 #include <vector>
 
@@ -48,6 +51,16 @@ class String;
 class SFML_NETWORK_API Packet
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Compression applied to the data sent over the network
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Compression
+    {
+        None, //!< The data is sent as is
+        Lz4   //!< The data is compressed with LZ4, unless this doesn't make it smaller
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -113,13 +126,95 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Clear the packet
     ///
-    /// After calling Clear, the packet is empty.
+    /// After calling Clear, the packet is empty. The memory that
+    /// it allocated is kept, so that filling it again with no
+    /// more data than before doesn't allocate.
     ///
-    /// \see append
+    /// \see append, reserve
     ///
     ////////////////////////////////////////////////////////////
     void clear();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate memory for the data to come
+    ///
+    /// After this call, appending data doesn't allocate memory
+    /// until the packet holds more than \a sizeInBytes bytes.
+    ///
+    /// \param sizeInBytes Number of bytes to allocate
+    ///
+    /// \see getCapacity
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes the packet can hold without allocating memory
+    ///
+    /// \return Capacity of the packet, in bytes
+    ///
+    /// \see reserve
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose how the packet is compressed when it is sent
+    ///
+    /// The receiving packet must use the same compression as the
+    /// sending one, because the compressed data carries a small
+    /// header that an uncompressed packet would keep as is.
+    /// Compression is a setting of the packet: clear doesn't
+    /// change it.
+    ///
+    /// \param compression Compression to apply
+    ///
+    /// \see getCompression
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCompression(Compression compression);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compression applied when the packet is sent
+    ///
+    /// \return Current compression of the packet
+    ///
+    /// \see setCompression
+    ///
+    ////////////////////////////////////////////////////////////
+    Compression getCompression() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the data of the packet by its difference with a reference packet
+    ///
+    /// Each byte is combined with the byte at the same position
+    /// in \a reference, so the bytes that didn't change become
+    /// zeros, which compress very well. This is meant to send
+    /// state snapshots as the difference with the last snapshot
+    /// known to the receiver, which calls decodeDelta with the
+    /// same reference to get the snapshot back.
+    ///
+    /// The read position is moved back to the beginning.
+    ///
+    /// \param reference Packet that the data is compared to
+    ///
+    /// \see decodeDelta
+    ///
+    ////////////////////////////////////////////////////////////
+    void encodeDelta(const Packet& reference);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restore the data of a packet produced by encodeDelta
+    ///
+    /// The read position is moved back to the beginning.
+    ///
+    /// \param reference Packet that was given to encodeDelta
+    ///
+    /// \see encodeDelta
+    ///
+    ////////////////////////////////////////////////////////////
+    void decodeDelta(const Packet& reference);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a pointer to the data contained in the packet
     ///
@@ -364,8 +459,192 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an array of numbers to the packet
+    ///
+    /// This writes the same data as inserting each value with
+    /// operator <<, but it is done in a single pass over the
+    /// packet memory.
+    ///
+    /// \param data  Pointer to the values to append
+    /// \param count Number of values to append
+    ///
+    /// \see extractArray
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendArray(const std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    void appendArray(const double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an array of numbers from the packet
+    ///
+    /// This reads the same data as extracting each value with
+    /// operator >>. If the packet doesn't hold enough data,
+    /// nothing is extracted and the packet becomes invalid.
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to extract
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see appendArray
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& extractArray(double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an unsigned integer with a variable-length encoding
+    ///
+    /// The value is written 7 bits at a time, so that small
+    /// values take fewer bytes: values below 128 take a single
+    /// byte, and the largest ones take 10 bytes.
+    ///
+    /// \param data Value to append
+    ///
+    /// \see extractVarUInt, appendVarInt
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendVarUInt(std::uint64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a signed integer with a variable-length encoding
+    ///
+    /// The value is zigzag encoded before being written like
+    /// appendVarUInt does, so that small negative values are
+    /// short as well.
+    ///
+    /// \param data Value to append
+    ///
+    /// \see extractVarInt, appendVarUInt
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendVarInt(std::int64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an unsigned integer written by appendVarUInt
+    ///
+    /// \param data Variable to fill
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see appendVarUInt
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& extractVarUInt(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a signed integer written by appendVarInt
+    ///
+    /// \param data Variable to fill
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see appendVarInt
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& extractVarInt(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a string encoded in UTF-8
+    ///
+    /// The string is written as its size in bytes, with the
+    /// variable-length encoding of appendVarUInt, followed by
+    /// its UTF-8 representation. This is much more compact than
+    /// operator <<, which writes 4 bytes per character.
+    ///
+    /// \param data String to append
+    ///
+    /// \see extractUtf8
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendUtf8(const String& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a string written by appendUtf8
+    ///
+    /// \param data String to fill
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see appendUtf8
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& extractUtf8(String& data);
+
 protected:
+    friend class PacketPool;
+    friend class ReliableUdpChannel;
     friend class TcpSocket;
+    friend class TlsSocket;
     friend class UdpSocket;
 
     ////////////////////////////////////////////////////////////
@@ -376,8 +655,8 @@ protected:
     /// used for compression, encryption, etc.
     /// The function must return a pointer to the modified data,
     /// as well as the number of bytes pointed.
-    /// The default implementation provides the packet's data
-    /// without transforming it.
+    /// The default implementation applies the compression chosen
+    /// with setCompression, if any.
     ///
     /// \param size Variable to fill with the size of data to send
     ///
@@ -396,8 +675,9 @@ protected:
     /// used for decompression, decryption, etc.
     /// The function receives a pointer to the received data,
     /// and must fill the packet with the transformed bytes.
-    /// The default implementation fills the packet directly
-    /// without transforming the data.
+    /// The default implementation fills the packet directly,
+    /// after undoing the compression chosen with setCompression
+    /// if any.
     ///
     /// \param data Pointer to the received bytes
     /// \param size Number of bytes
@@ -420,13 +700,28 @@ private:
     ////////////////////////////////////////////////////////////
     bool checkSize(std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the memory used by the packet to sf::MemoryStats
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateMemoryUsage();
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using Buffer = priv::Vector<std::byte, MemoryModule::Network>;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_data;          //!< Data stored in the packet
+    Buffer                 m_data;          //!< Data stored in the packet
     std::size_t            m_readPos{};     //!< Current reading position in the packet
     std::size_t            m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
     bool                   m_isValid{true}; //!< Reading state of the packet
+    Compression            m_compression{}; //!< Compression applied when the packet is sent
+    std::vector<std::byte> m_sendBuffer;    //!< Compressed data being sent
+
+    priv::MemoryCounter<MemoryStats::Category::Packet> m_memoryCounter; //!< Counts the packet in sf::MemoryStats
 };
 
 } // namespace sf
@@ -513,6 +808,27 @@ private:
 /// }
 /// \endcode
 ///
+/// When bandwidth matters, integers can be written with a
+/// variable-length encoding (appendVarUInt, appendVarInt) and
+/// strings in UTF-8 (appendUtf8), and arrays of numbers can be
+/// written in one go with appendArray. These functions have
+/// their own wire format, so the values must be extracted with
+/// the matching extract functions.
+///
+/// Packets can compress their data with LZ4 when they are sent
+/// (see setCompression). Combined with encodeDelta, which turns
+/// a state snapshot into its difference with the previous one,
+/// this makes state updates very small.
+/// \code
+/// sf::Packet packet;
+/// packet << state;
+///
+/// sf::Packet delta = packet;
+/// delta.encodeDelta(lastAcknowledgedPacket);
+/// delta.setCompression(sf::Packet::Compression::Lz4);
+/// socket.send(delta, address, port);
+/// \endcode
+///
 /// Packets also provide an extra feature that allows to apply
 /// custom transformations to the data before it is sent,
 /// and after it is received. This is typically used to
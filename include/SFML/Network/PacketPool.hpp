@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/Packet.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of packets recycled to avoid memory allocations
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleter giving a packet back to its pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SFML_NETWORK_API Recycler
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Give a packet back to the pool
+        ///
+        /// \param packet Packet to recycle
+        ///
+        ////////////////////////////////////////////////////////////
+        void operator()(Packet* packet) const;
+
+        PacketPool* pool{}; //!< Pool that the packet belongs to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Packet borrowed from a pool
+    ///
+    /// The packet is given back to the pool when the pointer is
+    /// destroyed or reset.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::unique_ptr<Packet, Recycler>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool
+    ///
+    /// \param packetCapacity Number of bytes reserved in each new packet
+    /// \param maxPacketCount Maximum number of free packets kept by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PacketPool(std::size_t packetCapacity = 0, std::size_t maxPacketCount = 1024);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketPool(const PacketPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketPool& operator=(const PacketPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Borrow an empty packet from the pool
+    ///
+    /// A recycled packet is returned if there is one, so that
+    /// the memory it allocated before is reused; otherwise a
+    /// new packet is created.
+    ///
+    /// This function is thread-safe.
+    ///
+    /// \return Empty packet that goes back to the pool when destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle acquire();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create packets in advance
+    ///
+    /// \param count Number of free packets that the pool should hold
+    ///
+    ////////////////////////////////////////////////////////////
+    void preallocate(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of free packets held by the pool
+    ///
+    /// \return Number of packets that can be acquired without allocating
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFreeCount() const;
+
+private:
+    friend struct Recycler;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take a packet back
+    ///
+    /// \param packet Packet to recycle
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(Packet* packet);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable std::mutex                   m_mutex;          //!< Mutex protecting the free packets
+    std::vector<std::unique_ptr<Packet>> m_freePackets;    //!< Packets ready to be acquired
+    std::size_t                          m_packetCapacity; //!< Number of bytes reserved in each new packet
+    std::size_t                          m_maxPacketCount; //!< Maximum number of free packets kept
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketPool
+/// \ingroup network
+///
+/// Building a new sf::Packet for every message allocates its
+/// storage again and again. sf::PacketPool keeps the packets
+/// that are not used anymore, with their storage, and hands
+/// them out again, so that a server sending many messages
+/// reaches a steady state where no memory is allocated.
+///
+/// Packets are borrowed with acquire, which returns a smart
+/// pointer that gives the packet back to the pool when it is
+/// destroyed. The pool must therefore outlive the packets
+/// borrowed from it.
+///
+/// Usage example:
+/// \code
+/// sf::PacketPool pool(1024);
+/// pool.preallocate(64);
+///
+/// for (Client& client : clients)
+/// {
+///     const sf::PacketPool::Handle packet = pool.acquire();
+///     *packet << client.position.x << client.position.y;
+///     (void)client.socket.send(*packet);
+/// } // The packet goes back to the pool here
+/// \endcode
+///
+/// \see sf::Packet
+///
+////////////////////////////////////////////////////////////
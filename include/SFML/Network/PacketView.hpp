@@ -0,0 +1,364 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+class String;
+
+////////////////////////////////////////////////////////////
+/// \brief Read-only view over data formatted like a packet
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketView
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty view.
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from a sequence of bytes
+    ///
+    /// The bytes are not copied, they must stay alive and
+    /// unchanged as long as the view is used.
+    ///
+    /// \param data        Pointer to the sequence of bytes to read
+    /// \param sizeInBytes Number of bytes to read
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from the data of a packet
+    ///
+    /// The view starts reading at the beginning of the packet,
+    /// regardless of its read position. It becomes invalid as
+    /// soon as data is appended to the packet.
+    ///
+    /// \param packet Packet to read
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PacketView(const Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the view
+    ///
+    /// The next read operation will read data from this position
+    ///
+    /// \return The byte offset of the current read position
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getReadPosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the data the view reads
+    ///
+    /// \return Pointer to the data
+    ///
+    /// \see getDataSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the data the view reads
+    ///
+    /// \return Data size, in bytes
+    ///
+    /// \see getData
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell if the reading position has reached the
+    ///        end of the data
+    ///
+    /// \return True if all data was read, false otherwise
+    ///
+    /// \see operator bool
+    ///
+    ////////////////////////////////////////////////////////////
+    bool endOfPacket() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Test the validity of the view, for reading
+    ///
+    /// Like sf::Packet, a view becomes invalid as soon as an
+    /// extraction needs more data than what is left, and all
+    /// the extractions that follow fail.
+    ///
+    /// \return True if last data extraction from the view was successful
+    ///
+    /// \see endOfPacket
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit operator bool() const;
+
+    ////////////////////////////////////////////////////////////
+    /// Overload of operator >> to read data from the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(bool& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int8_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint8_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int16_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint16_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int32_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint32_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(float& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(double& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(char* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(wchar_t* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::wstring& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(String& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an array of numbers from the view
+    ///
+    /// This reads the same data as extracting each value with
+    /// operator >>. If the view doesn't hold enough data,
+    /// nothing is extracted and the view becomes invalid.
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to extract
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& extractArray(double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an unsigned integer written by sf::Packet::appendVarUInt
+    ///
+    /// \param data Variable to fill
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& extractVarUInt(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a signed integer written by sf::Packet::appendVarInt
+    ///
+    /// \param data Variable to fill
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& extractVarInt(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a string written by sf::Packet::appendUtf8
+    ///
+    /// \param data String to fill
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& extractUtf8(String& data);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the view can extract a given number of bytes
+    ///
+    /// This function updates accordingly the state of the view.
+    ///
+    /// \param size Size to check
+    ///
+    /// \return True if \a size bytes can be read from the view
+    ///
+    ////////////////////////////////////////////////////////////
+    bool checkSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte* m_data{};        //!< Data read by the view
+    std::size_t      m_size{};        //!< Number of bytes pointed to by m_data
+    std::size_t      m_readPos{};     //!< Current reading position in the data
+    bool             m_isValid{true}; //!< Reading state of the view
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketView
+/// \ingroup network
+///
+/// sf::PacketView reads data in the format written by
+/// sf::Packet, straight from memory that it doesn't own: a
+/// receive buffer, a batch of datagrams, a memory-mapped
+/// replay file... It provides the same extraction functions
+/// and the same validity checks as sf::Packet, without first
+/// copying the bytes into a packet.
+///
+/// A view is a small object that can be passed by value.
+/// It never modifies the data, and all the functions that
+/// build or send a packet are missing, as well as the LZ4
+/// decompression performed when a packet is received:
+/// compressed data must go through sf::Packet.
+///
+/// Usage example:
+/// \code
+/// std::byte buffer[sf::UdpSocket::MaxDatagramSize];
+/// std::size_t received = 0;
+/// std::optional<sf::IpAddress> sender;
+/// unsigned short port = 0;
+/// if (socket.receive(buffer, sizeof(buffer), received, sender, port) == sf::Socket::Status::Done)
+/// {
+///     sf::PacketView view(buffer, received);
+///
+///     std::uint32_t x;
+///     std::string s;
+///     if (view >> x >> s)
+///     {
+///         // Data extracted successfully...
+///     }
+/// }
+/// \endcode
+///
+/// Custom types can be read by overloading operator >> for
+/// sf::PacketView, the same way as for sf::Packet.
+///
+/// \see sf::Packet
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,403 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Message channel with optional reliability on top of a UDP socket
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API ReliableUdpChannel
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Delivery guarantees of a message
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Lane
+    {
+        Unreliable,          //!< The message may be lost, duplicated or delivered out of order
+        UnreliableSequenced, //!< The message may be lost, but is never delivered after a newer one
+        ReliableOrdered      //!< The message is delivered exactly once, in the order it was sent
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Measurements made by the channel
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        Time          roundTripTime;         //!< Smoothed round-trip time
+        Time          roundTripTimeVariance; //!< Variation of the round-trip time
+        Time          retransmissionTimeout; //!< Time after which an unacknowledged datagram is considered lost
+        std::size_t   congestionWindow{};    //!< Number of bytes allowed to be in flight
+        std::size_t   bytesInFlight{};       //!< Number of bytes sent and not acknowledged yet
+        std::uint64_t datagramsSent{};       //!< Number of datagrams sent
+        std::uint64_t datagramsReceived{};   //!< Number of valid datagrams received
+        std::uint64_t datagramsLost{};       //!< Number of datagrams considered lost
+        std::uint64_t messagesDropped{};     //!< Number of unreliable messages dropped by the congestion control
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static constexpr std::size_t DefaultMaxDatagramSize{1200}; //!< Datagram size that doesn't fragment on the Internet
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the channel
+    ///
+    /// The socket is not owned by the channel; it must be bound
+    /// and must outlive the channel. Several channels may share
+    /// the same socket.
+    ///
+    /// \param socket        Socket used to send the datagrams
+    /// \param remoteAddress Address of the peer
+    /// \param remotePort    Port of the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    ReliableUdpChannel(UdpSocket& socket, const IpAddress& remoteAddress, unsigned short remotePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of the peer
+    ///
+    /// \return Address of the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IpAddress& getRemoteAddress() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port of the peer
+    ///
+    /// \return Port of the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getRemotePort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the maximum size of the datagrams sent by the channel
+    ///
+    /// Messages larger than a datagram are split into fragments.
+    /// The size should stay below the path MTU, minus the IP and
+    /// UDP headers, so that the datagrams are not fragmented by
+    /// IP. It only applies to the messages sent afterwards.
+    /// The default size is DefaultMaxDatagramSize.
+    ///
+    /// \param size Maximum size of a datagram, in bytes (between 64 and UdpSocket::MaxDatagramSize)
+    ///
+    /// \see getMaxDatagramSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxDatagramSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum size of the datagrams sent by the channel
+    ///
+    /// \return Maximum size of a datagram, in bytes
+    ///
+    /// \see setMaxDatagramSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMaxDatagramSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a message for sending
+    ///
+    /// The message is actually sent by the next call to flush.
+    ///
+    /// \param lane Delivery guarantees of the message
+    /// \param data Pointer to the bytes of the message
+    /// \param size Number of bytes of the message
+    ///
+    /// \return True if the message was queued, false if it is too large
+    ///
+    /// \see flush
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(Lane lane, const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a packet for sending
+    ///
+    /// \param lane   Delivery guarantees of the packet
+    /// \param packet Packet to send
+    ///
+    /// \return True if the packet was queued, false if it is too large
+    ///
+    /// \see flush
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(Lane lane, Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the queued messages and acknowledgments
+    ///
+    /// This function should be called regularly (typically once
+    /// per frame or network tick), even when there is nothing to
+    /// send: it also acknowledges the received datagrams and sends
+    /// again the reliable messages that were lost.
+    /// The messages are sent in a single batch, as long as the
+    /// congestion window allows it. Reliable messages that don't
+    /// fit wait for the next call, while unreliable ones are
+    /// dropped since they would be outdated.
+    ///
+    /// \return Status code of the socket
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a datagram received from the peer
+    ///
+    /// The channel doesn't read the socket itself, so that a
+    /// server can receive the datagrams of all its peers in
+    /// batches and dispatch them to the right channel.
+    ///
+    /// \param data Pointer to the bytes of the datagram
+    /// \param size Number of bytes of the datagram
+    ///
+    /// \return True if the datagram was valid, false if it was ignored
+    ///
+    /// \see receive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool processDatagram(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the next message delivered by the channel
+    ///
+    /// \param packet Packet to fill with the message
+    ///
+    /// \return True if a message was available, false otherwise
+    ///
+    /// \see processDatagram
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool receive(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the measurements made by the channel
+    ///
+    /// \return Round-trip time, congestion and traffic figures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Piece of a message carried by a datagram
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Fragment
+    {
+        Lane              lane{};      //!< Lane of the message
+        std::uint16_t     messageId{}; //!< Identifier of the message in its lane
+        std::uint16_t     index{};     //!< Position of the fragment in the message
+        std::uint16_t     count{};     //!< Number of fragments of the message
+        std::vector<char> data;        //!< Bytes of the fragment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram waiting for an acknowledgment
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SentDatagram
+    {
+        std::uint16_t         sequence{};        //!< Sequence number of the datagram
+        Time                  sendTime;          //!< Time at which the datagram was sent
+        std::size_t           size{};            //!< Size of the datagram, in bytes
+        std::vector<Fragment> reliableFragments; //!< Reliable fragments to send again if the datagram is lost
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Message being reassembled
+    ///
+    ////////////////////////////////////////////////////////////
+    struct IncomingMessage
+    {
+        std::vector<std::vector<char>> fragments;    //!< Fragments of the message, by position
+        std::vector<bool>              received;     //!< Whether each fragment was received
+        std::size_t                    remaining{};  //!< Number of fragments still missing
+        Time                           firstArrival; //!< Time at which the first fragment arrived
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle an acknowledgment received from the peer
+    ///
+    /// \param ack     Most recent datagram received by the peer
+    /// \param ackBits Datagrams received before \a ack, one bit each
+    /// \param now     Current time
+    ///
+    ////////////////////////////////////////////////////////////
+    void processAcks(std::uint16_t ack, std::uint32_t ackBits, Time now);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the loss of datagrams that were late or timed out
+    ///
+    /// \param now Current time
+    ///
+    ////////////////////////////////////////////////////////////
+    void detectLosses(Time now);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a fragment received from the peer
+    ///
+    /// \param fragment Received fragment
+    /// \param now      Current time
+    ///
+    ////////////////////////////////////////////////////////////
+    void processFragment(Fragment&& fragment, Time now);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the header of a new datagram
+    ///
+    /// \param datagram Buffer to fill
+    ///
+    /// \return Sequence number of the datagram
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint16_t writeHeader(std::vector<char>& datagram);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    UdpSocket*                               m_socket;             //!< Socket used to send the datagrams
+    IpAddress                                m_remoteAddress;      //!< Address of the peer
+    unsigned short                           m_remotePort;         //!< Port of the peer
+    std::size_t                              m_maxDatagramSize;    //!< Maximum size of the datagrams sent
+    Clock                                    m_clock;              //!< Clock measuring the round-trip times
+    std::array<std::uint16_t, 3>             m_nextMessageIds{};   //!< Identifier of the next message, by lane
+    std::deque<Fragment>                     m_sendQueue;          //!< Fragments waiting to be sent
+    std::deque<Fragment>                     m_resendQueue;        //!< Lost reliable fragments to send again
+    std::deque<SentDatagram>                 m_inFlight;           //!< Datagrams waiting for an acknowledgment
+    std::uint16_t                            m_localSequence{};    //!< Sequence number of the next datagram
+    std::uint16_t                            m_recoverySequence{}; //!< Last datagram sent when a loss was handled
+    bool                                     m_inRecovery{};       //!< Whether m_recoverySequence is meaningful
+    std::uint16_t                            m_remoteSequence{};   //!< Most recent datagram received
+    std::uint32_t                            m_receivedBits{};     //!< Datagrams received before it, one bit each
+    bool                                     m_hasReceived{};      //!< Whether a datagram was received
+    bool                                     m_ackPending{};       //!< Whether received data must be acknowledged
+    std::map<std::uint32_t, IncomingMessage> m_incoming;           //!< Messages being reassembled, by lane and id
+    std::uint16_t                            m_nextReliableId{};   //!< Next reliable message to deliver
+    std::uint16_t                            m_lastSequencedId{};  //!< Last sequenced message delivered
+    bool                                     m_hasSequenced{};     //!< Whether a sequenced message was delivered
+    std::deque<std::vector<char>>            m_delivered;          //!< Messages ready to be received
+    std::vector<std::vector<char>>           m_outgoing;           //!< Datagrams built by flush
+    Statistics                               m_statistics;         //!< Measurements made by the channel
+    bool                                     m_hasRoundTripTime{}; //!< Whether the round-trip time was measured
+    std::size_t                              m_slowStartThreshold; //!< Window size where the slow start ends
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ReliableUdpChannel
+/// \ingroup network
+///
+/// UDP datagrams may be lost, duplicated or reordered, and
+/// large datagrams are fragmented by IP, which makes them even
+/// more likely to be lost. sf::ReliableUdpChannel handles all
+/// this for the messages exchanged with one peer, while keeping
+/// the low latency of UDP for the messages that don't need
+/// any guarantee.
+///
+/// Each message is sent on a lane:
+/// \li ReliableOrdered messages are sent again until the peer
+///     acknowledges them, and delivered in order
+/// \li UnreliableSequenced messages are sent once, and older
+///     messages arriving after newer ones are discarded, which
+///     suits state updates
+/// \li Unreliable messages are sent once and delivered as they
+///     arrive
+///
+/// Messages larger than the maximum datagram size are split into
+/// fragments and reassembled by the peer; small messages are
+/// packed together in the same datagram. Every datagram
+/// acknowledges the last 33 datagrams received, so that a lost
+/// acknowledgment is covered by the next ones. The acknowledgments
+/// are used to measure the round-trip time and to adapt the
+/// amount of data in flight to the capacity of the network.
+///
+/// Both peers must use a channel. The channel doesn't read the
+/// socket: datagrams received from the peer must be given to
+/// processDatagram, after which the delivered messages can be
+/// taken with receive. flush must be called regularly to send
+/// the queued messages and the acknowledgments.
+///
+/// Usage example:
+/// \code
+/// sf::UdpSocket socket;
+/// (void)socket.bind(54000);
+/// socket.setBlocking(false);
+/// sf::ReliableUdpChannel channel(socket, serverAddress, 54000);
+///
+/// while (running)
+/// {
+///     std::array<char, sf::UdpSocket::MaxDatagramSize> buffer;
+///     std::size_t                                       received = 0;
+///     std::optional<sf::IpAddress>                      sender;
+///     unsigned short                                    port = 0;
+///     while (socket.receive(buffer.data(), buffer.size(), received, sender, port) == sf::Socket::Status::Done)
+///         (void)channel.processDatagram(buffer.data(), received);
+///
+///     sf::Packet packet;
+///     while (channel.receive(packet))
+///         handleMessage(packet);
+///
+///     sf::Packet input;
+///     input << player.inputs;
+///     (void)channel.send(sf::ReliableUdpChannel::Lane::UnreliableSequenced, input);
+///     (void)channel.flush();
+/// }
+/// \endcode
+///
+/// \see sf::UdpSocket, sf::Packet
+///
+////////////////////////////////////////////////////////////
@@ -29,8 +29,18 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/NetworkStats.hpp>
 #include <SFML/Network/SocketHandle.hpp>
 
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
 
 namespace sf
 {
@@ -54,6 +64,28 @@ public:
         Error         //!< An unexpected error happened
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Options that tune the behavior of a socket
+    ///
+    /// Every option holds an integer value; boolean options
+    /// use 0 and 1. Options that the current platform doesn't
+    /// provide are rejected by setOption.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Option
+    {
+        SendBufferSize,      //!< Size of the system send buffer, in bytes (SO_SNDBUF)
+        ReceiveBufferSize,   //!< Size of the system receive buffer, in bytes (SO_RCVBUF)
+        NoDelay,             //!< TCP only: disable the Nagle algorithm (TCP_NODELAY), enabled by default
+        QuickAck,            //!< TCP only: acknowledge received data immediately (TCP_QUICKACK)
+        NotSentLowWatermark, //!< TCP only: unsent bytes above which the socket isn't writable (TCP_NOTSENT_LOWAT)
+        BusyPoll,            //!< Time to busy poll the device when receiving, in microseconds (SO_BUSY_POLL)
+        TypeOfService,       //!< Type of service byte, with the DSCP in its upper 6 bits (IP_TOS / IPV6_TCLASS)
+        Timestamp,           //!< UDP only: record the reception time of datagrams (SO_TIMESTAMPNS)
+        MulticastTtl,        //!< UDP only: number of hops of multicast datagrams, 1 by default (IP_MULTICAST_TTL)
+        MulticastLoopback    //!< UDP only: deliver multicast datagrams to this host too, enabled by default
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Some special values used by sockets
     ///
@@ -61,6 +93,17 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr unsigned short AnyPort{0}; //!< Special value that tells the system to pick any available port
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called when a send is partial
+    ///
+    /// \a sent is the amount of data sent so far and \a size
+    /// the total amount to send: bytes for the functions
+    /// sending bytes or packets, datagrams for
+    /// sf::UdpSocket::sendBatch.
+    ///
+    ////////////////////////////////////////////////////////////
+    using PartialSendCallback = std::function<void(std::size_t sent, std::size_t size)>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -120,6 +163,80 @@ public:
     ////////////////////////////////////////////////////////////
     bool isBlocking() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the value of a socket option
+    ///
+    /// Options are kept by the socket and applied again
+    /// whenever the underlying system socket is created, so
+    /// they can be set before the socket is bound or connected
+    /// and they survive a disconnection.
+    /// Not all options are available everywhere: QuickAck,
+    /// BusyPoll and Timestamp are Linux specific, and
+    /// NotSentLowWatermark requires Linux or macOS. Note that
+    /// the system may not keep QuickAck enabled, and that it
+    /// may adjust the buffer sizes (Linux doubles them).
+    ///
+    /// \param option Option to change
+    /// \param value  New value of the option
+    ///
+    /// \return True if the option is supported and was applied
+    ///
+    /// \see getOption
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setOption(Option option, int value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the value of a socket option
+    ///
+    /// If the system socket exists, the value is read from it;
+    /// otherwise the value last given to setOption is returned.
+    ///
+    /// \param option Option to read
+    ///
+    /// \return Value of the option, or `std::nullopt` if it is unknown
+    ///
+    /// \see setOption
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<int> getOption(Option option) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the socket
+    ///
+    /// Statistics are only collected while they are enabled
+    /// (see sf::NetworkStats::setEnabled). The counters are
+    /// kept across disconnections, until resetStats is called.
+    ///
+    /// \return Snapshot of the counters of the socket
+    ///
+    /// \see resetStats
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] NetworkStats getStats() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the statistics of the socket to zero
+    ///
+    /// The global statistics are not affected.
+    ///
+    /// \see getStats
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStats();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function called when a send is partial
+    ///
+    /// The callback is called whenever a send function of the
+    /// socket returns Status::Partial, from the thread calling
+    /// that function, even if statistics are disabled.
+    ///
+    /// \param callback Function to call, or an empty function to remove it
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPartialSendCallback(PartialSendCallback callback);
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Types of protocols that the socket can use
@@ -153,13 +270,29 @@ protected:
     ////////////////////////////////////////////////////////////
     SocketHandle getNativeHandle() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the type of the addresses handled by the socket
+    ///
+    /// IPv6 sockets are dual-stack: they can also reach IPv4
+    /// addresses. This function can only be accessed by derived
+    /// classes.
+    ///
+    /// \return Type of the addresses handled by the socket
+    ///
+    ////////////////////////////////////////////////////////////
+    IpAddress::Type getAddressType() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Create the internal representation of the socket
     ///
+    /// Nothing happens if the socket already exists, even if it
+    /// handles another type of addresses.
     /// This function can only be accessed by derived classes.
     ///
+    /// \param addressType Type of the addresses handled by the socket
+    ///
     ////////////////////////////////////////////////////////////
-    void create();
+    void create(IpAddress::Type addressType = IpAddress::Type::V4);
 
     ////////////////////////////////////////////////////////////
     /// \brief Create the internal representation of the socket
@@ -180,15 +313,64 @@ protected:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Record sent data in the statistics
+    ///
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param bytes       Number of bytes sent
+    /// \param packets     Number of packets or datagrams sent
+    /// \param systemCalls Number of system calls made
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordSend(std::size_t bytes, std::size_t packets, std::size_t systemCalls);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record received data in the statistics
+    ///
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param bytes       Number of bytes received
+    /// \param packets     Number of packets or datagrams received
+    /// \param systemCalls Number of system calls made
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordReceive(std::size_t bytes, std::size_t packets, std::size_t systemCalls);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a partial send and notify the callback
+    ///
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param sent Amount of data sent so far
+    /// \param size Total amount of data to send
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordPartialSend(std::size_t sent, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the time taken to receive a packet
+    ///
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param latency Time between the first byte and the completion of the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordReceiveLatency(Time latency);
+
 private:
     friend class SocketSelector;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Type         m_type;             //!< Type of the socket (TCP or UDP)
-    SocketHandle m_socket;           //!< Socket descriptor
-    bool         m_isBlocking{true}; //!< Current blocking mode of the socket
+    Type                                m_type;                             //!< Type of the socket (TCP or UDP)
+    SocketHandle                        m_socket;                           //!< Socket descriptor
+    bool                                m_isBlocking{true};                 //!< Current blocking mode
+    IpAddress::Type                     m_addressType{IpAddress::Type::V4}; //!< Type of the addresses handled
+    std::vector<std::pair<Option, int>> m_options;                          //!< Options set by the user
+    std::unique_ptr<NetworkStats>       m_stats;                            //!< Statistics, allocated when first used
+    PartialSendCallback                 m_partialSendCallback;              //!< Function called on partial sends
 };
 
 } // namespace sf
@@ -203,8 +385,8 @@ private:
 ///
 /// The only public features that it defines, and which
 /// is therefore common to all the socket classes, is the
-/// blocking state. All sockets can be set as blocking or
-/// non-blocking.
+/// blocking state and the options. All sockets can be set as
+/// blocking or non-blocking, and tuned with setOption.
 ///
 /// In blocking mode, socket functions will hang until
 /// the operation completes, which means that the entire
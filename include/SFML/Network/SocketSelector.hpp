@@ -32,10 +32,13 @@
 #include <SFML/System/Time.hpp>
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 
 namespace sf
 {
+class IoContext;
 class Socket;
 
 ////////////////////////////////////////////////////////////
@@ -95,6 +98,10 @@ public:
     /// while it is stored in the selector.
     /// This function does nothing if the socket is not valid.
     ///
+    /// Adding a socket that is already in the selector updates
+    /// the address reported by getReadySockets, which is useful
+    /// if the socket was moved since it was added.
+    ///
     /// \param socket Reference to the socket to add
     ///
     /// \see remove, clear
@@ -159,12 +166,79 @@ public:
     ///
     /// \return True if the socket is ready to read, false otherwise
     ///
-    /// \see isReady
+    /// \see isReady, getReadySockets
     ///
     ////////////////////////////////////////////////////////////
     bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sockets that are ready to receive data
+    ///
+    /// This function must be used after a call to wait, to visit
+    /// only the sockets that are ready instead of testing all the
+    /// sockets of the selector with isReady. The sockets are
+    /// given by the address that was passed to add; if a socket
+    /// is moved after being added, add it again so that the
+    /// address is updated.
+    ///
+    /// The list is valid until the next call to wait, remove or
+    /// clear.
+    ///
+    /// \return Sockets that are ready to read, in no particular order
+    ///
+    /// \see wait, isReady
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<Socket*>& getReadySockets() const;
+
 private:
+    friend class IoContext;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose the readiness that a socket is watched for
+    ///
+    /// Unlike add, this also allows waiting until a socket is
+    /// ready to send data. Watching a socket for nothing removes
+    /// it from the selector.
+    ///
+    /// \param socket  Reference to the socket to watch
+    /// \param receive True to watch the socket for data to receive
+    /// \param send    True to watch the socket for room to send data
+    ///
+    ////////////////////////////////////////////////////////////
+    void watch(Socket& socket, bool receive, bool send);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait with io_uring instead of epoll, when the kernel supports it
+    ///
+    /// io_uring keeps the sockets that it waits for open, so
+    /// this is only meant for owners which always stop watching
+    /// sockets before they are closed. It must be called while
+    /// the selector is empty, and has no effect on other systems.
+    ///
+    ////////////////////////////////////////////////////////////
+    void enableIoUring();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until one or more sockets are ready
+    ///
+    /// \param timeout Maximum time to wait, zero to return immediately, `std::nullopt` for infinity
+    ///
+    /// \return True if there are sockets ready, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool waitFor(std::optional<Time> timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Test a socket to know if it is ready to send data
+    ///
+    /// \param socket Socket to test
+    ///
+    /// \return True if the socket is ready to send, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isReadyToSend(Socket& socket) const;
+
     struct SocketSelectorImpl;
 
     ////////////////////////////////////////////////////////////
@@ -205,6 +279,13 @@ private:
 /// \li make it wait until there is data available on any of the sockets
 /// \li test each socket to find out which ones are ready
 ///
+/// The selector is built on epoll on Linux and Android, and on
+/// kqueue on macOS, iOS and the BSDs, so that waiting doesn't
+/// depend on the number of sockets, and a selector can hold
+/// thousands of them. When there are many sockets, iterate the
+/// ones returned by getReadySockets rather than testing each of
+/// them with isReady.
+///
 /// Usage example:
 /// \code
 /// // Create a socket to listen to new connections
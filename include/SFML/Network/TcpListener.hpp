@@ -32,6 +32,8 @@
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Socket.hpp>
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -87,6 +89,35 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status listen(unsigned short port, const IpAddress& address = IpAddress::Any);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Allow other listeners to listen on the same port
+    ///
+    /// When enabled, several listeners (usually one per thread)
+    /// can listen on the same port, and the system distributes
+    /// the incoming connections between them. Every listener
+    /// sharing the port must enable this option. It is applied
+    /// by the next call to listen, and is disabled by default.
+    ///
+    /// This option is not supported on Windows, where listen
+    /// fails if it is enabled.
+    ///
+    /// \param reusePort True to share the port with other listeners
+    ///
+    /// \see getReusePort, listen
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReusePort(bool reusePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the port can be shared with other listeners
+    ///
+    /// \return True if the port can be shared with other listeners
+    ///
+    /// \see setReusePort
+    ///
+    ////////////////////////////////////////////////////////////
+    bool getReusePort() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Stop listening and close the socket
     ///
@@ -112,6 +143,33 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status accept(TcpSocket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept several new connections at once
+    ///
+    /// This function accepts the connections waiting to be
+    /// accepted, up to \a count of them. If the socket is in
+    /// blocking mode, it waits for the first connection, then
+    /// only accepts the ones that are already pending.
+    /// A non-blocking listener returns Status::NotReady if
+    /// there is no connection to accept.
+    ///
+    /// \param sockets  Array of sockets that will hold the new connections
+    /// \param count    Number of sockets in the array
+    /// \param accepted Number of connections actually accepted
+    ///
+    /// \return Status code
+    ///
+    /// \see accept
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status acceptBatch(TcpSocket* sockets, std::size_t count, std::size_t& accepted);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    bool m_reusePort{}; //!< Can the port be shared with other listeners?
 };
 
 
@@ -161,6 +219,23 @@ public:
 /// }
 /// \endcode
 ///
+/// Servers receiving many connections at once can accept them
+/// by batches, and share the port between several threads, each
+/// one with its own listener:
+/// \code
+/// sf::TcpListener listener;
+/// listener.setReusePort(true);
+/// listener.listen(55001);
+///
+/// std::array<sf::TcpSocket, 64> clients;
+/// std::size_t                   accepted = 0;
+/// if (listener.acceptBatch(clients.data(), clients.size(), accepted) == sf::Socket::Status::Done)
+/// {
+///     for (std::size_t i = 0; i < accepted; ++i)
+///         doSomethingWith(std::move(clients[i]));
+/// }
+/// \endcode
+///
 /// \see sf::TcpSocket, sf::Socket
 ///
 ////////////////////////////////////////////////////////////
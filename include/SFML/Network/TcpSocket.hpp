@@ -31,6 +31,9 @@
 
 #include <SFML/Network/Socket.hpp>
 
+#include <SFML/System/Allocator.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/MemoryStats.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <optional>
@@ -126,7 +129,7 @@ public:
     /// \see connect
     ///
     ////////////////////////////////////////////////////////////
-    void disconnect();
+    virtual void disconnect();
 
     ////////////////////////////////////////////////////////////
     /// \brief Send raw data to the remote peer
@@ -160,7 +163,7 @@ public:
     /// \see receive
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] Status send(const void* data, std::size_t size, std::size_t& sent);
+    [[nodiscard]] virtual Status send(const void* data, std::size_t size, std::size_t& sent);
 
     ////////////////////////////////////////////////////////////
     /// \brief Receive raw data from the remote peer
@@ -178,7 +181,7 @@ public:
     /// \see send
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] Status receive(void* data, std::size_t size, std::size_t& received);
+    [[nodiscard]] virtual Status receive(void* data, std::size_t size, std::size_t& received);
 
     ////////////////////////////////////////////////////////////
     /// \brief Send a formatted packet of data to the remote peer
@@ -196,7 +199,7 @@ public:
     /// \see receive
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] Status send(Packet& packet);
+    [[nodiscard]] virtual Status send(Packet& packet);
 
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
@@ -214,25 +217,104 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a formatted packet to the send queue
+    ///
+    /// The packet is copied, with the same format as send(Packet&),
+    /// at the end of a buffer that is only sent by flush. Queuing
+    /// many small packets and flushing them once sends them all
+    /// with a single system call, instead of one per packet.
+    ///
+    /// If the queue then holds at least the number of bytes given
+    /// to setSendQueueFlushSize, it is flushed immediately and
+    /// the status of flush is returned.
+    ///
+    /// Packets sent directly with send(Packet&) or raw data bypass
+    /// the queue, so the queue should be flushed first to keep
+    /// the data in order.
+    ///
+    /// \param packet Packet to queue
+    ///
+    /// \return Status::Done if the packet was queued, or the status of flush
+    ///
+    /// \see flush, getQueuedSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status queue(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the data of the queued packets
+    ///
+    /// Unlike send(Packet&), partial sends are handled by the
+    /// queue: the bytes that couldn't be sent stay at the front
+    /// of the queue, and the next call to flush resumes from
+    /// there. Packets can still be queued in the meantime.
+    ///
+    /// \return Status::Done if the queue is now empty, Status::Partial or
+    ///         Status::NotReady if some data remains to be sent, or an error
+    ///
+    /// \see queue
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size from which the send queue is flushed by queue
+    ///
+    /// By default, the size is 0, and the queue is only sent
+    /// by explicit calls to flush.
+    ///
+    /// \param size Number of queued bytes that trigger a flush, 0 to disable
+    ///
+    /// \see queue, flush
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSendQueueFlushSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes waiting in the send queue
+    ///
+    /// \return Number of bytes that flush still has to send
+    ///
+    /// \see queue, flush
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getQueuedSize() const;
+
 private:
+    friend class Ftp;
     friend class TcpListener;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the memory used by the buffers to sf::MemoryStats
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateMemoryUsage();
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure holding the data of a pending packet
     ///
     ////////////////////////////////////////////////////////////
     struct PendingPacket
     {
-        std::uint32_t          size{};         //!< Data of packet size
-        std::size_t            sizeReceived{}; //!< Number of size bytes received so far
-        std::vector<std::byte> data;           //!< Data of the packet
+        using Buffer = priv::Vector<std::byte, MemoryModule::Network>;
+
+        std::uint32_t size{};         //!< Data of packet size
+        std::size_t   sizeReceived{}; //!< Number of size bytes received so far
+        std::size_t   dataReceived{}; //!< Number of data bytes received so far
+        Buffer        data;           //!< Buffer receiving the data of the packet, swapped with the one of the packet
+        Clock         clock;          //!< Time since the first byte of the packet was received
     };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    PendingPacket          m_pendingPacket;        //!< Temporary data of the packet currently being received
+    std::vector<std::byte> m_sendQueue;            //!< Size and data of the queued packets not sent yet
+    std::size_t            m_queuedPackets{};      //!< Number of packets ending in the send queue
+    std::size_t            m_sendQueueFlushSize{}; //!< Size of the send queue from which queue flushes it
+
+    priv::MemoryCounter<MemoryStats::Category::Socket> m_memoryCounter; //!< Counts the socket in sf::MemoryStats
 };
 
 } // namespace sf
@@ -268,6 +350,12 @@ private:
 /// the data that is exchanged. You can look at the sf::Packet
 /// class to get more details about how they work.
 ///
+/// Servers sending many small packets to each client can
+/// avoid a system call per packet with the send queue:
+/// queue adds packets to a buffer, and flush sends the whole
+/// buffer at once, typically once per update of the server,
+/// taking care of partial sends itself.
+///
 /// The socket is automatically disconnected when it is destroyed,
 /// but if you want to explicitly close the connection while
 /// the socket instance is still alive, you can call disconnect.
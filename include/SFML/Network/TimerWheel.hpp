@@ -0,0 +1,288 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Scheduler of a large number of timers
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API TimerWheel
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a scheduled timer
+    ///
+    /// Identifiers are never 0, and are not reused before about
+    /// 4 billion other timers have used the same storage.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Id = std::uint64_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called when a timer expires
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handler = std::function<void()>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the wheel
+    ///
+    /// Expiration times are rounded up to a multiple of the
+    /// resolution, so timers never expire early, but may expire
+    /// up to \a resolution late. Timers can be scheduled up to
+    /// 2^32 times the resolution in advance (about 50 days with
+    /// the default resolution) without being rescheduled.
+    ///
+    /// \param resolution Granularity of the expiration times
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TimerWheel(Time resolution = milliseconds(1));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule a timer
+    ///
+    /// This function doesn't depend on the number of
+    /// timers already scheduled.
+    ///
+    /// \param delay   Time after which the timer expires
+    /// \param handler Function to call when the timer expires
+    ///
+    /// \return Identifier of the timer, to give to cancel
+    ///
+    /// \see cancel, expire
+    ///
+    ////////////////////////////////////////////////////////////
+    Id schedule(Time delay, Handler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cancel a timer
+    ///
+    /// The handler of the timer is destroyed without being
+    /// called. This function doesn't depend on the number of
+    /// timers scheduled.
+    ///
+    /// \param id Identifier returned by schedule
+    ///
+    /// \return True if the timer was cancelled, false if it already expired or was cancelled
+    ///
+    /// \see schedule
+    ///
+    ////////////////////////////////////////////////////////////
+    bool cancel(Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call the handlers of the timers that expired
+    ///
+    /// The handlers may schedule and cancel timers, including
+    /// the ones that expired along with them. A timer scheduled
+    /// by a handler never expires before the next tick.
+    ///
+    /// \return Number of handlers called
+    ///
+    /// \see getTimeUntilNextExpiry
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t expire();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time until expire has work to do
+    ///
+    /// This is meant to be given as a timeout to functions of
+    /// sf::SocketSelector, so that a network loop wakes up in
+    /// time to call expire. The result may be earlier than the
+    /// next expiration, when the wheel has to reorganize its
+    /// timers, but never later.
+    ///
+    /// \return Time until the next call to expire, or an empty optional if no timer is scheduled
+    ///
+    /// \see expire
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Time> getTimeUntilNextExpiry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of timers scheduled
+    ///
+    /// \return Number of timers that didn't expire nor were cancelled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTimerCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t   levelBits{8};                          //!< Bits of the tick selecting a slot
+    static constexpr std::size_t   slotCount{1 << levelBits};             //!< Number of slots of each level
+    static constexpr std::size_t   levelCount{4};                         //!< Number of levels of the wheel
+    static constexpr std::uint32_t dueList{levelCount * slotCount};       //!< Head of the list of expired timers
+    static constexpr std::uint32_t firstTimer{dueList + 1};               //!< Index of the first node that is a timer
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Timer, or head of a circular list of timers
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Node
+    {
+        std::uint32_t previous{};   //!< Index of the previous node of the list
+        std::uint32_t next{};       //!< Index of the next node of the list, or of the next free node
+        std::uint32_t list{};       //!< Index of the head of the list containing the timer
+        std::uint32_t generation{}; //!< Incremented each time the node is freed, to detect stale identifiers
+        bool          active{};     //!< Is the node a scheduled timer?
+        std::uint64_t expiry{};     //!< Tick at which the timer expires
+        Handler       handler;      //!< Function to call when the timer expires
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current tick
+    ///
+    /// \return Number of whole resolutions elapsed since the wheel was created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getCurrentTick() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert a timer in the slot matching its expiry
+    ///
+    /// \param index Index of the timer
+    ///
+    ////////////////////////////////////////////////////////////
+    void insert(std::uint32_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert a node at the end of a list
+    ///
+    /// \param list  Index of the head of the list
+    /// \param index Index of the node to insert
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(std::uint32_t list, std::uint32_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a node from its list
+    ///
+    /// \param index Index of the node to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(std::uint32_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the handler of a timer and make its node available
+    ///
+    /// \param index Index of the timer, which must not be in a list
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(std::uint32_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a list is empty
+    ///
+    /// \param list Index of the head of the list
+    ///
+    /// \return True if the list has no node
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmpty(std::uint32_t list) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time              m_resolution;        //!< Duration of a tick
+    Clock             m_clock;             //!< Time since the wheel was created
+    std::vector<Node> m_nodes;             //!< Heads of the lists, followed by the timers
+    std::uint32_t     m_freeNodes{};       //!< Index of the first free timer, 0 if there is none
+    std::size_t       m_timerCount{};      //!< Number of timers scheduled
+    std::size_t       m_firstLevelCount{}; //!< Number of timers in the slots of the first level
+    std::uint64_t     m_nextTick{};        //!< First tick that expire hasn't processed yet
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TimerWheel
+/// \ingroup network
+///
+/// sf::TimerWheel keeps track of timers such as connection
+/// timeouts, heartbeats or resend timers, and calls a handler
+/// when each of them expires. Timers are sorted in buckets of
+/// a hierarchical wheel rather than in a heap, so scheduling
+/// and cancelling a timer take constant time, which matters
+/// when a server keeps one or more timers per connection.
+///
+/// The wheel doesn't run on its own: expire must be called
+/// regularly, typically from the network loop, with
+/// getTimeUntilNextExpiry as the timeout of the wait on the
+/// sockets. sf::IoContext embeds a wheel, see
+/// sf::IoContext::asyncWait.
+///
+/// A wheel isn't thread-safe, it must be protected by a mutex
+/// if several threads use it.
+///
+/// Usage example:
+/// \code
+/// sf::TimerWheel timers;
+/// sf::SocketSelector selector;
+///
+/// // Disconnect the client if it stays silent for 30 seconds
+/// sf::TimerWheel::Id timeout = timers.schedule(sf::seconds(30), [&] { client.disconnect(); });
+///
+/// while (running)
+/// {
+///     if (selector.waitFor(timers.getTimeUntilNextExpiry()))
+///     {
+///         if (selector.isReady(client))
+///         {
+///             // Receive data from the client, and restart its timeout...
+///             timers.cancel(timeout);
+///             timeout = timers.schedule(sf::seconds(30), [&] { client.disconnect(); });
+///         }
+///     }
+///
+///     timers.expire();
+/// }
+/// \endcode
+///
+/// \see sf::IoContext, sf::SocketSelector
+///
+////////////////////////////////////////////////////////////
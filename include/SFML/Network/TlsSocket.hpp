@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class IpAddress;
+class Packet;
+
+namespace priv
+{
+class TlsSocketImpl;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief TCP socket encrypted with TLS
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API TlsSocket : public TcpSocket
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether SFML was built with a TLS backend
+    ///
+    /// Without a backend, connect always fails.
+    ///
+    /// \return True if TLS connections are supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSocket();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TlsSocket() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSocket(TlsSocket&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSocket& operator=(TlsSocket&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the verification of the server certificate
+    ///
+    /// By default, the certificate of the server must be valid,
+    /// signed by an authority trusted by the system, and issued
+    /// for the host name given to connect. Disabling the
+    /// verification makes the connection vulnerable to
+    /// man-in-the-middle attacks; it should only be done for
+    /// testing purposes.
+    ///
+    /// \param verify True to verify the certificate of the server
+    ///
+    /// \see connect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVerifyPeer(bool verify);
+
+    using TcpSocket::receive;
+    using TcpSocket::send;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect the socket to a remote server and establish a TLS session
+    ///
+    /// This function always blocks until the TLS handshake is
+    /// complete, fails, or the timeout is over, even if the
+    /// socket is in non-blocking mode.
+    ///
+    /// If a session was established recently with the same host,
+    /// it is resumed, which saves the certificate exchange. When
+    /// the resumed session allows it (TLS 1.3), \a earlyData is
+    /// sent along with the handshake, saving a whole round trip
+    /// (0-RTT); otherwise it is sent right after the handshake.
+    /// Either way, it has been sent when the function returns Done.
+    /// Since an attacker may replay early data, only requests
+    /// that are safe to process twice should be sent this way.
+    ///
+    /// \param remoteAddress Address of the remote server
+    /// \param remotePort    Port of the remote server
+    /// \param hostName      Name of the server, used to verify its certificate
+    /// \param timeout       Optional maximum time to wait
+    /// \param earlyData     Optional data to send as soon as possible
+    ///
+    /// \return Status code
+    ///
+    /// \see disconnect, isSessionReused, isEarlyDataAccepted
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status connect(const IpAddress&   remoteAddress,
+                                 unsigned short     remotePort,
+                                 const std::string& hostName,
+                                 Time               timeout   = Time::Zero,
+                                 std::string_view   earlyData = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the TLS session and disconnect the socket
+    ///
+    /// \see connect
+    ///
+    ////////////////////////////////////////////////////////////
+    void disconnect() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send raw data to the remote peer through the TLS session
+    ///
+    /// \param data Pointer to the sequence of bytes to send
+    /// \param size Number of bytes to send
+    /// \param sent The number of bytes sent will be written here
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const void* data, std::size_t size, std::size_t& sent) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive raw data from the remote peer through the TLS session
+    ///
+    /// \param data     Pointer to the array to fill with the received bytes
+    /// \param size     Maximum number of bytes that can be received
+    /// \param received This variable is filled with the actual number of bytes received
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(void* data, std::size_t size, std::size_t& received) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a formatted packet of data through the TLS session
+    ///
+    /// \param packet Packet to send
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(Packet& packet) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the current session was resumed
+    ///
+    /// \return True if the last connection resumed a previous session
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSessionReused() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the server accepted the early data
+    ///
+    /// \return True if the early data given to connect was sent with the handshake
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEarlyDataAccepted() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<priv::TlsSocketImpl> m_impl;             //!< Implementation of the TLS session
+    bool                                 m_verifyPeer{true}; //!< Verify the certificate of the server?
+    std::vector<std::byte>               m_packetBuffer;     //!< Size and data of the packet being sent
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TlsSocket
+/// \ingroup network
+///
+/// sf::TlsSocket is a TCP socket whose data is encrypted with
+/// the TLS protocol, like the one used by HTTPS. It is used
+/// exactly like sf::TcpSocket, except that connect needs the
+/// name of the server to verify its identity. The functions
+/// sending and receiving data are virtual, so a TLS socket
+/// can be used wherever a TCP socket is expected.
+///
+/// TLS is provided by a third-party library chosen when SFML
+/// is built; currently OpenSSL, enabled with the
+/// SFML_USE_OPENSSL CMake option. Use isAvailable to check
+/// whether TLS is supported.
+///
+/// Establishing a TLS session requires several round trips.
+/// Sessions are cached by SFML and resumed by the next
+/// connections to the same server; with TLS 1.3, the first
+/// request can even be sent with the handshake (see connect).
+///
+/// Only the client side of TLS is supported.
+///
+/// Usage example:
+/// \code
+/// sf::TlsSocket socket;
+/// const std::string request = "GET / HTTP/1.1\r\nHost: www.sfml-dev.org\r\n\r\n";
+/// const auto address = sf::IpAddress::resolve("www.sfml-dev.org");
+/// if (address && socket.connect(*address, 443, "www.sfml-dev.org", sf::seconds(5), request) ==
+///                     sf::Socket::Status::Done)
+/// {
+///     char        buffer[1024];
+///     std::size_t received = 0;
+///     (void)socket.receive(buffer, sizeof(buffer), received);
+/// }
+/// \endcode
+///
+/// \see sf::TcpSocket, sf::Http
+///
+////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Socket.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #include <optional>
 #include <vector>
 
@@ -55,6 +57,34 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Description of a datagram sent or received in a batch
+    ///
+    /// \see sendBatch, receiveBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Datagram
+    {
+        void*          data{};                        //!< Bytes to send, or buffer to fill with the received bytes
+        std::size_t    size{};                        //!< Number of bytes to send, or size of the buffer to fill
+        std::size_t    received{};                    //!< Number of bytes received (set by receiveBatch)
+        IpAddress      remoteAddress{IpAddress::Any}; //!< Address of the receiver, or of the sender
+        unsigned short remotePort{};                  //!< Port of the receiver, or of the sender
+        Time           timestamp{};                   //!< Reception time since the epoch (set by receiveBatch)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receiver of a datagram sent to several peers
+    ///
+    /// \see sendToAll
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Destination
+    {
+        IpAddress      address{IpAddress::Any}; //!< Address of the receiver
+        unsigned short port{};                  //!< Port of the receiver
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,11 +224,167 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several datagrams to remote peers
+    ///
+    /// This is equivalent to calling send for each datagram, but
+    /// it is done with as few system calls as possible (a single
+    /// one for up to 64 datagrams on Linux). The data, size and
+    /// destination of each datagram are read, its received
+    /// member is ignored.
+    ///
+    /// In non-blocking mode, this function may send only the
+    /// first datagrams and return sf::Socket::Status::Partial.
+    /// The remaining ones can be sent later.
+    ///
+    /// \param datagrams Pointer to the array of datagrams to send
+    /// \param count     Number of datagrams in the array
+    /// \param sent      This variable is filled with the number of datagrams sent
+    ///
+    /// \return Status code
+    ///
+    /// \see receiveBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status sendBatch(const Datagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several datagrams from remote peers
+    ///
+    /// In blocking mode, this function waits until at least one
+    /// datagram is received, and then gets the ones that are
+    /// already queued without waiting any further. The datagrams
+    /// are received directly into the buffers described by the
+    /// data and size members, which must be large enough to hold
+    /// them; the size received and the sender are then written
+    /// to the other members.
+    /// When the Socket::Option::Timestamp option is enabled, the
+    /// time at which the system received each datagram is written
+    /// to its timestamp member; otherwise it is left to zero.
+    ///
+    /// \param datagrams Pointer to the array of datagrams to fill
+    /// \param count     Number of datagrams in the array
+    /// \param received  This variable is filled with the number of datagrams received
+    ///
+    /// \return Status code
+    ///
+    /// \see sendBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receiveBatch(Datagram* datagrams, std::size_t count, std::size_t& received);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the same data to several remote peers
+    ///
+    /// This is equivalent to calling send for each destination,
+    /// but the data is shared by all the datagrams, and they are
+    /// sent like with sendBatch.
+    ///
+    /// \param data         Pointer to the sequence of bytes to send
+    /// \param size         Number of bytes to send
+    /// \param destinations Pointer to the array of receivers
+    /// \param count        Number of receivers in the array
+    /// \param sent         This variable is filled with the number of receivers the data was sent to
+    ///
+    /// \return Status code
+    ///
+    /// \see sendBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status sendToAll(const void*        data,
+                                   std::size_t        size,
+                                   const Destination* destinations,
+                                   std::size_t        count,
+                                   std::size_t&       sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the same formatted packet to several remote peers
+    ///
+    /// The packet is prepared for sending once, then sent to
+    /// every destination like with sendToAll.
+    ///
+    /// \param packet       Packet to send
+    /// \param destinations Pointer to the array of receivers
+    /// \param count        Number of receivers in the array
+    /// \param sent         This variable is filled with the number of receivers the packet was sent to
+    ///
+    /// \return Status code
+    ///
+    /// \see sendBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status sendToAll(Packet&            packet,
+                                   const Destination* destinations,
+                                   std::size_t        count,
+                                   std::size_t&       sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Join a multicast group
+    ///
+    /// Once the socket has joined a group, it receives the
+    /// datagrams sent to the address of the group, on the port
+    /// that the socket is bound to.
+    /// IPv6 groups are always joined on the default interface.
+    ///
+    /// \param group            Address of the multicast group
+    /// \param interfaceAddress Address of the IPv4 interface to join the group on, IpAddress::Any for the default one
+    ///
+    /// \return True if the group was joined
+    ///
+    /// \see leaveMulticastGroup, setMulticastInterface
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool joinMulticastGroup(const IpAddress& group, const IpAddress& interfaceAddress = IpAddress::Any);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Leave a multicast group
+    ///
+    /// \param group            Address of the multicast group
+    /// \param interfaceAddress Address of the interface the group was joined on
+    ///
+    /// \return True if the group was left
+    ///
+    /// \see joinMulticastGroup
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool leaveMulticastGroup(const IpAddress& group, const IpAddress& interfaceAddress = IpAddress::Any);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose the interface that IPv4 multicast datagrams are sent from
+    ///
+    /// By default, the system picks the interface from its
+    /// routing table. The number of hops and the loopback of
+    /// multicast datagrams are set with the
+    /// Socket::Option::MulticastTtl and
+    /// Socket::Option::MulticastLoopback options.
+    ///
+    /// \param interfaceAddress Address of the interface, IpAddress::Any for the default one
+    ///
+    /// \return True if the interface was selected
+    ///
+    /// \see joinMulticastGroup
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setMulticastInterface(const IpAddress& interfaceAddress);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Join or leave a multicast group
+    ///
+    /// \param group            Address of the multicast group
+    /// \param interfaceAddress Address of the IPv4 interface
+    /// \param join             True to join the group, false to leave it
+    ///
+    /// \return True on success
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setMembership(const IpAddress& group, const IpAddress& interfaceAddress, bool join);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data in Receive(Packet)
+    std::vector<Datagram>  m_fanOut;                  //!< Datagrams built by sendToAll, kept to reuse their memory
 };
 
 } // namespace sf
@@ -243,6 +429,11 @@ private:
 /// of the protocol (dropped, mixed or duplicated datagrams may
 /// lead to a big mess when trying to recompose a packet).
 ///
+/// The same data can be sent to many peers at once with
+/// sendToAll, or to every member of a multicast group by
+/// sending it to the address of the group; receivers join the
+/// group with joinMulticastGroup.
+///
 /// If the socket is bound to a port, it is automatically
 /// unbound from it when the socket is destroyed. However,
 /// you can unbind the socket explicitly with the Unbind
@@ -30,16 +30,31 @@
 
 #include <SFML/Config.hpp>
 
+#include <SFML/System/Allocator.hpp>
 #include <SFML/System/Angle.hpp>
+#include <SFML/System/AsyncLogSink.hpp>
+#include <SFML/System/Checksum.hpp>
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
+#include <SFML/System/FastClock.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/FileSystem.hpp>
+#include <SFML/System/FixedStepLoop.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/MemoryStats.hpp>
+#include <SFML/System/MpscQueue.hpp>
+#include <SFML/System/Profiler.hpp>
+#include <SFML/System/ResourceCache.hpp>
 #include <SFML/System/Sleep.hpp>
+#include <SFML/System/SpscQueue.hpp>
 #include <SFML/System/String.hpp>
+#include <SFML/System/ThreadPool.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/TraceEventSink.hpp>
 #include <SFML/System/Utf.hpp>
+#include <SFML/System/Utf8View.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
@@ -0,0 +1,342 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Modules of SFML, to which allocations are attributed
+///
+////////////////////////////////////////////////////////////
+enum class MemoryModule
+{
+    System,   //!< sf::System module
+    Window,   //!< sf::Window module
+    Graphics, //!< sf::Graphics module
+    Audio,    //!< sf::Audio module
+    Network   //!< sf::Network module
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Source of the memory allocated by SFML
+///
+/// The interface mirrors std::pmr::memory_resource, so that
+/// any standard memory resource can be plugged in with a
+/// trivial adapter.
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MemoryResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~MemoryResource() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate a block of memory
+    ///
+    /// \param size      Size of the block, in bytes
+    /// \param alignment Alignment of the block, a power of 2
+    ///
+    /// \return Pointer to the block, never a null pointer (throw std::bad_alloc on failure)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual void* allocate(std::size_t size, std::size_t alignment) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free a block of memory returned by allocate
+    ///
+    /// \param pointer   Pointer to the block
+    /// \param size      Size of the block, as given to allocate
+    /// \param alignment Alignment of the block, as given to allocate
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void deallocate(void* pointer, std::size_t size, std::size_t alignment) = 0;
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Counters of the allocations made by a module
+///
+////////////////////////////////////////////////////////////
+struct AllocationStats
+{
+    std::uint64_t allocationCount{};   //!< Number of blocks allocated since the program started
+    std::uint64_t deallocationCount{}; //!< Number of blocks freed since the program started
+    std::size_t   bytesInUse{};        //!< Size of the blocks currently allocated, in bytes
+    std::size_t   peakBytesInUse{};    //!< Highest value of bytesInUse since the program started
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Set the memory resource used by SFML containers
+///
+/// Containers capture the current resource when they are
+/// constructed, and return their memory to that same
+/// resource: changing it only affects the containers created
+/// afterwards. A resource must therefore outlive all the SFML
+/// objects created while it was set. It must be thread-safe,
+/// since these objects may be used from any thread.
+///
+/// \param resource Resource to use, or a null pointer to use the global operator new
+///
+/// \see getAllocator
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void setAllocator(MemoryResource* resource);
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Get the memory resource used by SFML containers
+///
+/// \return Current resource, or a null pointer if the global operator new is used
+///
+/// \see setAllocator
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API MemoryResource* getAllocator();
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Get the counters of the allocations made by a module
+///
+/// The counters are updated whichever memory resource is used.
+///
+/// \param module Module to get the counters of
+///
+/// \return Counters of the allocations made by \a module
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API AllocationStats getAllocationStats(MemoryModule module);
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory from a resource on behalf of a module
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API void* allocate(MemoryResource* resource,
+                                             std::size_t     size,
+                                             std::size_t     alignment,
+                                             MemoryModule    module);
+
+////////////////////////////////////////////////////////////
+/// \brief Free memory allocated by priv::allocate
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void deallocate(MemoryResource* resource,
+                                void*           pointer,
+                                std::size_t     size,
+                                std::size_t     alignment,
+                                MemoryModule    module) noexcept;
+} // namespace priv
+
+////////////////////////////////////////////////////////////
+/// \brief Standard allocator drawing from the resource set with sf::setAllocator
+///
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+class ModuleAllocator
+{
+public:
+    // Standard allocator types
+    // NOLINTBEGIN(readability-identifier-naming)
+    using value_type                             = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = ModuleAllocator<U, Module>;
+    };
+    // NOLINTEND(readability-identifier-naming)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The allocator uses the resource currently set with sf::setAllocator.
+    ///
+    ////////////////////////////////////////////////////////////
+    ModuleAllocator() noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from an allocator of another type
+    ///
+    /// \param other Allocator to share the resource of
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename U>
+    ModuleAllocator(const ModuleAllocator<U, Module>& other) noexcept; // NOLINT(google-explicit-constructor)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate memory for an array of elements
+    ///
+    /// \param count Number of elements
+    ///
+    /// \return Pointer to the uninitialized memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] T* allocate(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free memory returned by allocate
+    ///
+    /// \param pointer Pointer to the memory
+    /// \param count   Number of elements given to allocate
+    ///
+    ////////////////////////////////////////////////////////////
+    void deallocate(T* pointer, std::size_t count) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the resource the memory is allocated from
+    ///
+    /// \return Resource, or a null pointer for the global operator new
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] MemoryResource* getResource() const noexcept;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    MemoryResource* m_resource; //!< Resource the memory is allocated from
+};
+
+////////////////////////////////////////////////////////////
+/// \relates ModuleAllocator
+/// \brief Tell whether memory allocated by an allocator can be freed by another
+///
+////////////////////////////////////////////////////////////
+template <typename T, typename U, MemoryModule Module>
+[[nodiscard]] bool operator==(const ModuleAllocator<T, Module>& left, const ModuleAllocator<U, Module>& right) noexcept;
+
+////////////////////////////////////////////////////////////
+/// \relates ModuleAllocator
+/// \brief Tell whether memory allocated by an allocator cannot be freed by another
+///
+////////////////////////////////////////////////////////////
+template <typename T, typename U, MemoryModule Module>
+[[nodiscard]] bool operator!=(const ModuleAllocator<T, Module>& left, const ModuleAllocator<U, Module>& right) noexcept;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Vector allocating through sf::ModuleAllocator
+///
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+using Vector = std::vector<T, ModuleAllocator<T, Module>>;
+
+////////////////////////////////////////////////////////////
+/// \brief Hash map allocating through sf::ModuleAllocator
+///
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, MemoryModule Module>
+using UnorderedMap = std::unordered_map<Key,
+                                        Value,
+                                        std::hash<Key>,
+                                        std::equal_to<Key>,
+                                        ModuleAllocator<std::pair<const Key, Value>, Module>>;
+} // namespace priv
+
+} // namespace sf
+
+#include <SFML/System/Allocator.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MemoryResource
+/// \ingroup system
+///
+/// The containers that SFML allocates on hot paths, such as
+/// the data of packets, the samples of sound buffers, the
+/// glyph pages of fonts, the uniform caches of shaders and
+/// the event queues of windows, get their memory through
+/// sf::ModuleAllocator. By default it comes from the global
+/// operator new; sf::setAllocator routes it to a custom
+/// memory resource instead, such as an arena tracked by the
+/// application.
+///
+/// Every allocation is attributed to the module it was made
+/// by, and counted whichever resource is used: the counters
+/// returned by sf::getAllocationStats make it easy to find
+/// allocations made in steady state, for example every frame.
+///
+/// Usage example, with a standard memory resource:
+/// \code
+/// class PmrResource : public sf::MemoryResource
+/// {
+/// public:
+///     explicit PmrResource(std::pmr::memory_resource& resource) : m_resource(resource)
+///     {
+///     }
+///
+///     void* allocate(std::size_t size, std::size_t alignment) override
+///     {
+///         return m_resource.allocate(size, alignment);
+///     }
+///
+///     void deallocate(void* pointer, std::size_t size, std::size_t alignment) override
+///     {
+///         m_resource.deallocate(pointer, size, alignment);
+///     }
+///
+/// private:
+///     std::pmr::memory_resource& m_resource;
+/// };
+///
+/// std::pmr::synchronized_pool_resource pool;
+/// PmrResource resource(pool);
+/// sf::setAllocator(&resource);
+///
+/// // Create and use SFML objects...
+///
+/// const sf::AllocationStats before = sf::getAllocationStats(sf::MemoryModule::Graphics);
+/// // Run a frame...
+/// const sf::AllocationStats after = sf::getAllocationStats(sf::MemoryModule::Graphics);
+/// std::cout << after.allocationCount - before.allocationCount << " allocations this frame" << std::endl;
+/// \endcode
+///
+/// \see sf::ModuleAllocator
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Allocator.hpp> // NOLINT(misc-header-include-cycle)
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+ModuleAllocator<T, Module>::ModuleAllocator() noexcept : m_resource(getAllocator())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+template <typename U>
+ModuleAllocator<T, Module>::ModuleAllocator(const ModuleAllocator<U, Module>& other) noexcept :
+m_resource(other.getResource())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+T* ModuleAllocator<T, Module>::allocate(std::size_t count)
+{
+    return static_cast<T*>(priv::allocate(m_resource, count * sizeof(T), alignof(T), Module));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+void ModuleAllocator<T, Module>::deallocate(T* pointer, std::size_t count) noexcept
+{
+    priv::deallocate(m_resource, pointer, count * sizeof(T), alignof(T), Module);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, MemoryModule Module>
+MemoryResource* ModuleAllocator<T, Module>::getResource() const noexcept
+{
+    return m_resource;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, typename U, MemoryModule Module>
+bool operator==(const ModuleAllocator<T, Module>& left, const ModuleAllocator<U, Module>& right) noexcept
+{
+    return left.getResource() == right.getResource();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, typename U, MemoryModule Module>
+bool operator!=(const ModuleAllocator<T, Module>& left, const ModuleAllocator<U, Module>& right) noexcept
+{
+    return !(left == right);
+}
+
+} // namespace sf
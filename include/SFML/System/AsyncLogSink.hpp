@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/MpscQueue.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Log sink forwarding the messages from a background thread
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API AsyncLogSink : public LogSink
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the sink and start its thread
+    ///
+    /// \param target   Sink receiving the messages on the background thread, or a null pointer to print them to stderr
+    /// \param capacity Maximum number of messages waiting to be forwarded
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit AsyncLogSink(LogSink* target = nullptr, std::size_t capacity = 1024);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Forwards the messages still waiting, then stops the thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AsyncLogSink() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncLogSink(const AsyncLogSink&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Limit the number of times a message is repeated
+    ///
+    /// Within each \a interval, only the first \a maxRepeats
+    /// occurrences of a message are forwarded; the others are
+    /// counted, and reported by a single message once the
+    /// interval is over. The default is 5 repeats per second.
+    ///
+    /// \param maxRepeats Maximum number of identical messages per interval, 0 to forward them all
+    /// \param interval   Duration of the interval
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRateLimit(std::size_t maxRepeats, Time interval);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a message
+    ///
+    /// This function never blocks: the message is copied to a
+    /// lock-free queue, or dropped if the queue is full.
+    ///
+    /// \param severity Severity of the message
+    /// \param message  Text of the message
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(LogSeverity severity, std::string_view message) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the messages queued so far are forwarded
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of messages dropped because the queue was full
+    ///
+    /// \return Number of dropped messages since the sink was created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getDroppedCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Message waiting in the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Message
+    {
+        LogSeverity severity{}; //!< Severity of the message
+        std::string text;       //!< Text of the message
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Occurrences of a message in the current interval
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Repeats
+    {
+        LogSeverity   severity{};   //!< Severity of the last occurrence
+        Time          windowStart;  //!< Time of the first occurrence in the interval
+        std::size_t   count{};      //!< Number of occurrences in the interval
+        std::uint64_t suppressed{}; //!< Number of occurrences not forwarded
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Body of the background thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forward a message unless it is repeated too often
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(const Message& message, Time now);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the suppressed messages of the intervals that are over
+    ///
+    /// \param all True to report all of them, ignoring the intervals
+    ///
+    ////////////////////////////////////////////////////////////
+    void expireRepeats(Time now, bool all);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forward a message to the target
+    ///
+    ////////////////////////////////////////////////////////////
+    void forward(LogSeverity severity, std::string_view message);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    LogSink* const                           m_target;            //!< Sink receiving the messages, null for stderr
+    MpscQueue<Message>                       m_queue;             //!< Messages waiting to be forwarded
+    std::atomic<std::uint64_t>               m_queuedCount{};     //!< Number of messages pushed to the queue
+    std::atomic<std::uint64_t>               m_processedCount{};  //!< Number of messages popped from the queue
+    std::atomic<std::uint64_t>               m_droppedCount{};    //!< Number of messages dropped, the queue being full
+    std::atomic<std::size_t>                 m_maxRepeats{5};     //!< Maximum number of identical messages per interval
+    std::atomic<std::int64_t>                m_interval{1000000}; //!< Duration of the interval, in microseconds
+    std::unordered_map<std::string, Repeats> m_repeats;           //!< Recent messages, only used by the thread
+    std::uint64_t                            m_reportedDrops{};   //!< Number of dropped messages already reported
+    std::mutex                               m_mutex;             //!< Mutex protecting the sleep of the thread
+    std::condition_variable                  m_wakeUp;            //!< Wakes the thread up when messages are queued
+    bool                                     m_stopping{};        //!< Is the sink being destroyed?
+    std::thread                              m_thread;            //!< Thread forwarding the messages
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AsyncLogSink
+/// \ingroup system
+///
+/// Printing to a console can take a long time, long enough to
+/// make a game stutter if it happens every frame. When it is
+/// set with sf::setLogSink, sf::AsyncLogSink takes the messages
+/// written to sf::err out of the threads that write them: they
+/// are only copied to a lock-free queue, and a background
+/// thread forwards them to another sink, or prints them to
+/// stderr.
+///
+/// The background thread also keeps messages that repeat, such
+/// as an error reported every frame, from flooding the output:
+/// see setRateLimit.
+///
+/// The sink must be unset before it is destroyed.
+///
+/// Usage example:
+/// \code
+/// sf::AsyncLogSink sink;
+/// sink.setRateLimit(3, sf::seconds(10));
+/// sf::setLogSink(&sink);
+///
+/// // Run the application...
+///
+/// sf::setLogSink(nullptr);
+/// \endcode
+///
+/// \see sf::LogSink, sf::err
+///
+////////////////////////////////////////////////////////////
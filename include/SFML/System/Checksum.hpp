@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Compute the CRC-32C (Castagnoli) checksum of a buffer
+///
+/// The checksum is computed with the CRC instructions of the
+/// processor when they are available (SSE 4.2 on x86, the CRC
+/// extension of ARMv8), and with lookup tables otherwise; all
+/// the implementations give the same result.
+///
+/// The checksum of data split into several buffers is computed
+/// by passing the result of each call to the next one:
+/// \code
+/// std::uint32_t crc = sf::crc32c(header.data(), header.size());
+/// crc = sf::crc32c(payload.data(), payload.size(), crc);
+/// \endcode
+///
+/// \param data Pointer to the data
+/// \param size Size of the data, in bytes
+/// \param crc  Checksum of the preceding data, 0 to start a new checksum
+///
+/// \return CRC-32C of the data
+///
+/// \see hash64
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API std::uint32_t crc32c(const void* data, std::size_t size, std::uint32_t crc = 0);
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Compute a fast non-cryptographic 64-bit hash of a buffer
+///
+/// The hash is XXH64, which processes several bytes per cycle
+/// and gives the same result on every platform, so it can be
+/// stored or sent over the network. It detects accidental
+/// changes and is suited for hash tables and deduplication,
+/// but doesn't protect against deliberate collisions.
+///
+/// \param data Pointer to the data
+/// \param size Size of the data, in bytes
+/// \param seed Seed of the hash, which gives independent hashes for different values
+///
+/// \return Hash of the data
+///
+/// \see crc32c
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API std::uint64_t hash64(const void* data, std::size_t size, std::uint64_t seed = 0);
+
+} // namespace sf
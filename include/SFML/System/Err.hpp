@@ -30,16 +30,90 @@
 #include <SFML/System/Export.hpp>
 
 #include <iosfwd>
+#include <string_view>
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Standard stream used by SFML to output warnings and errors
+/// \brief Severity of the messages written to sf::err
+///
+////////////////////////////////////////////////////////////
+enum class LogSeverity
+{
+    Info,    //!< Information about the normal operation of SFML
+    Warning, //!< Unexpected situation that SFML can work around
+    Error    //!< Failure of an operation
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Receiver of the messages written to sf::err
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API LogSink
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~LogSink() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Called for every message written to sf::err
+    ///
+    /// This function is called from the thread that wrote the
+    /// message, so it must be thread-safe.
+    ///
+    /// \param severity Severity of the message
+    /// \param message  Text of the message, without its final line break
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void write(LogSeverity severity, std::string_view message) = 0;
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Standard stream used by SFML to output errors
 ///
 ////////////////////////////////////////////////////////////
 SFML_SYSTEM_API std::ostream& err();
 
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Standard stream used by SFML to output messages of a given severity
+///
+/// \param severity Severity of the messages written to the stream
+///
+/// \return Reference to the stream of \a severity
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API std::ostream& err(LogSeverity severity);
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Set the sink receiving the messages written to sf::err
+///
+/// The sink must outlive its use: reset it to a null pointer
+/// before destroying it.
+///
+/// \param sink Sink to use, or a null pointer to write the messages to stderr
+///
+/// \see getLogSink
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void setLogSink(LogSink* sink);
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Get the sink receiving the messages written to sf::err
+///
+/// \return Current sink, or a null pointer if the messages are written to stderr
+///
+/// \see setLogSink
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API LogSink* getLogSink();
+
 } // namespace sf
 
 
@@ -55,9 +129,22 @@ SFML_SYSTEM_API std::ostream& err();
 /// insertion operations defined by the STL
 /// (operator <<, manipulators, etc.).
 ///
-/// sf::err() can be redirected to write to another output, independently
-/// of std::cerr, by using the rdbuf() function provided by the
-/// std::ostream class.
+/// Each message, i.e. the text written until the stream is
+/// flushed (for example by std::endl), is gathered separately
+/// by each thread, so that messages written at the same time
+/// by several threads never interleave.
+///
+/// Instead of being printed, messages can be handed over to a
+/// sf::LogSink with sf::setLogSink, along with their severity:
+/// SFML writes errors to sf::err(), and the warnings and
+/// information it produces to sf::err(severity). The sink
+/// sf::AsyncLogSink moves the actual output to a background
+/// thread and limits the rate of repeated messages, so that
+/// diagnostics never stall the threads that report them.
+///
+/// sf::err() can also be redirected to write to another output,
+/// independently of std::cerr, by using the rdbuf() function
+/// provided by the std::ostream class.
 ///
 /// Example:
 /// \code
@@ -70,6 +157,14 @@ SFML_SYSTEM_API std::ostream& err();
 ///
 /// // Restore the original output
 /// sf::err().rdbuf(previous);
+///
+/// // Write the messages from a background thread
+/// sf::AsyncLogSink sink;
+/// sf::setLogSink(&sink);
+///
+/// // Run the application...
+///
+/// sf::setLogSink(nullptr);
 /// \endcode
 ///
 /// \return Reference to std::ostream representing the SFML error stream
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <chrono>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Chrono-compatible monotonic clock reading the CPU cycle counter
+///
+////////////////////////////////////////////////////////////
+struct SFML_SYSTEM_API FastClock
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Type traits and static members
+    ///
+    /// These type traits and static members meet the requirements
+    /// of a Clock concept in the C++ Standard. More specifically,
+    /// TrivialClock requirements are met. Thus, naming convention
+    /// has been kept consistent to allow for extended use e.g.
+    /// https://en.cppreference.com/w/cpp/chrono/is_clock
+    ///
+    ////////////////////////////////////////////////////////////
+    using duration   = std::chrono::nanoseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::time_point<FastClock, duration>;
+
+    static constexpr bool is_steady = true; // NOLINT(readability-identifier-naming)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current time
+    ///
+    /// The first call calibrates the cycle counter against
+    /// the system clock on x86, which takes about 2 milliseconds.
+    ///
+    /// \return Current time, in nanoseconds since an unspecified origin
+    ///
+    ////////////////////////////////////////////////////////////
+    static time_point now() noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the clock reads the CPU cycle counter
+    ///
+    /// The cycle counter is used on x86 processors with an
+    /// invariant time stamp counter, and on 64-bit ARM. On other
+    /// systems, the clock falls back to the one of sf::Clock.
+    ///
+    /// \return True if the cycle counter is used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isCycleCounterUsed();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a duration measured by the clock to sf::Time
+    ///
+    /// \param duration Difference between two time points
+    ///
+    /// \return Duration, truncated to microseconds
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static constexpr Time toTime(duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    }
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FastClock
+/// \ingroup system
+///
+/// sf::FastClock gives the same monotonic time as sf::Clock,
+/// at a fraction of the cost: instead of asking the system
+/// (QueryPerformanceCounter, clock_gettime, ...), which can
+/// take tens of nanoseconds on virtual machines and some
+/// Windows configurations, it reads the cycle counter of the
+/// CPU (rdtsc on x86, cntvct_el0 on ARM) and converts it to
+/// nanoseconds. It is meant for code that reads the time very
+/// often, like profiling zones.
+///
+/// On x86, the frequency of the counter is measured against
+/// the system clock the first time the clock is used, and the
+/// counter is only used if the processor reports it as
+/// invariant, i.e. ticking at a constant rate regardless of
+/// frequency scaling and sleep states. Otherwise, and on
+/// architectures without a usable counter, sf::FastClock
+/// falls back to the clock of sf::Clock; isCycleCounterUsed
+/// tells which one is used.
+///
+/// Like the standard clocks, it returns time points whose
+/// differences are std::chrono durations; toTime converts
+/// them to sf::Time.
+///
+/// Usage example:
+/// \code
+/// const auto start = sf::FastClock::now();
+/// ...
+/// const sf::Time elapsed = sf::FastClock::toTime(sf::FastClock::now() - start);
+/// \endcode
+///
+/// \see sf::Clock
+///
+////////////////////////////////////////////////////////////
@@ -39,12 +39,13 @@
 #include <cstdint>
 #include <cstdio>
 
-#ifdef SFML_SYSTEM_ANDROID
 namespace sf::priv
 {
+class AsyncFileImpl;
+#ifdef SFML_SYSTEM_ANDROID
 class SFML_SYSTEM_API ResourceStream;
-}
 #endif
+} // namespace sf::priv
 
 
 namespace sf
@@ -142,6 +143,23 @@ public:
     ////////////////////////////////////////////////////////////
     std::int64_t getSize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from a given position, in the background
+    ///
+    /// The read is handed to the operating system, and completed
+    /// while the calling thread goes on. The reading position is
+    /// left unchanged. The buffer must remain valid until the
+    /// future is ready, the stream itself may be closed earlier.
+    ///
+    /// \param position Position of the data to read, from the beginning
+    /// \param data     Buffer where to copy the read data
+    /// \param size     Desired number of bytes to read
+    ///
+    /// \return Future receiving the number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::int64_t> readAsync(std::int64_t position, void* data, std::int64_t size) override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -158,7 +176,8 @@ private:
         void operator()(std::FILE* file);
     };
 
-    std::unique_ptr<std::FILE, FileCloser> m_file; //!< stdio file stream
+    std::unique_ptr<std::FILE, FileCloser> m_file;      //!< stdio file stream
+    std::shared_ptr<priv::AsyncFileImpl>   m_asyncFile; //!< Background reader of the file, created on first use
 };
 
 } // namespace sf
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace sf
+{
+class InputStream;
+
+namespace priv
+{
+class Archive;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Virtual file system made of directories and packed archives
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API FileSystem
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Description of a file to store in an archive
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ArchiveEntry
+    {
+        std::string           name;       //!< Path of the file in the archive, with '/' separators
+        std::filesystem::path source;     //!< File to read the contents from
+        bool                  compress{}; //!< Compress the contents with LZ4?
+        bool                  prefetch{}; //!< Read the contents ahead when the archive is mounted?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a packed archive
+    ///
+    /// Compressed entries that don't get smaller are stored
+    /// uncompressed.
+    ///
+    /// \param filename Path of the archive to write
+    /// \param entries  Files to store in the archive
+    ///
+    /// \return True if the archive was written successfully
+    ///
+    /// \see mountArchive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool createArchive(const std::filesystem::path&     filename,
+                                            const std::vector<ArchiveEntry>& entries);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mount a directory of the native file system
+    ///
+    /// \param directory  Path of the directory to mount
+    /// \param mountPoint Virtual directory where the files of the directory appear
+    ///
+    /// \return True if the directory exists
+    ///
+    /// \see mountArchive, unmount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool mountDirectory(const std::filesystem::path& directory, std::string_view mountPoint = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mount a packed archive
+    ///
+    /// The archive is mapped into memory once, its directory
+    /// is validated, and its entries marked for prefetching
+    /// start being read by the operating system in the
+    /// background.
+    ///
+    /// \param filename   Path of the archive to mount
+    /// \param mountPoint Virtual directory where the files of the archive appear
+    ///
+    /// \return True if the archive was mounted successfully
+    ///
+    /// \see createArchive, mountDirectory, unmount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool mountArchive(const std::filesystem::path& filename, std::string_view mountPoint = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmount all the directories and archives mounted at a virtual directory
+    ///
+    /// Streams already opened from them remain valid.
+    ///
+    /// \param mountPoint Virtual directory given to mountDirectory or mountArchive
+    ///
+    ////////////////////////////////////////////////////////////
+    void unmount(std::string_view mountPoint);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a file exists in the virtual file system
+    ///
+    /// \param path Virtual path of the file, with '/' separators
+    ///
+    /// \return True if one of the mounted directories or archives contains the file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool exists(std::string_view path) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a file of the virtual file system
+    ///
+    /// The directories and archives mounted last are searched
+    /// first. Files of archives are read from the mapping of
+    /// the archive, compressed ones are decompressed into
+    /// memory owned by the stream.
+    ///
+    /// \param path Virtual path of the file, with '/' separators
+    ///
+    /// \return Stream reading the file, or a null pointer if it doesn't exist
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::unique_ptr<InputStream> open(std::string_view path) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Directory or archive mounted in the file system
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Mount
+    {
+        std::string                          mountPoint; //!< Virtual directory of the files
+        std::filesystem::path                directory;  //!< Mounted directory, if not an archive
+        std::shared_ptr<const priv::Archive> archive;    //!< Mounted archive, if not a directory
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Mount> m_mounts; //!< Mounted directories and archives, by order of mounting
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FileSystem
+/// \ingroup system
+///
+/// sf::FileSystem gathers directories and packed archives into
+/// a single tree of virtual paths, and opens its files as
+/// sf::InputStream, that every loadFromStream function accepts.
+///
+/// Packed archives store many files in one, which they index
+/// with a hashed directory. Mounting an archive maps it into
+/// memory, so that its files are then opened without any system
+/// call and decoded in place, instead of opening thousands of
+/// small files. Archives are created with createArchive, their
+/// entries can be compressed with LZ4 and marked to be read
+/// ahead by the operating system as soon as they are mounted.
+///
+/// Virtual paths use '/' separators, are relative to the root
+/// of the virtual file system and are case-sensitive. A file
+/// mounted at "textures" and named "grass.png" in its archive
+/// is opened as "textures/grass.png". Paths containing ".."
+/// components are rejected.
+///
+/// Streams opened from the file system must outlive the resources
+/// that keep reading from them, like sf::Font and sf::Music.
+///
+/// Usage example:
+/// \code
+/// // When packaging the game
+/// if (!sf::FileSystem::createArchive("assets.pak", {{"grass.png", "assets/grass.png"},
+///                                                   {"music.ogg", "assets/music.ogg", false, true},
+///                                                   {"level1.txt", "assets/level1.txt", true}}))
+///     return EXIT_FAILURE;
+///
+/// // In the game
+/// sf::FileSystem fileSystem;
+/// if (!fileSystem.mountArchive("assets.pak", "assets"))
+///     return EXIT_FAILURE;
+///
+/// // Loose files override the ones of the archive, for example for mods
+/// (void)fileSystem.mountDirectory("mods", "assets");
+///
+/// if (const auto stream = fileSystem.open("assets/grass.png"))
+///     const auto texture = sf::Texture::loadFromStream(*stream);
+/// \endcode
+///
+/// \see sf::InputStream
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <chrono>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Schedule fixed-duration simulation steps in a variable-rate loop
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API FixedStepLoop
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the loop with the duration of a step
+    ///
+    /// The internal clock starts right away.
+    ///
+    /// \param step             Duration of a simulation step (at least one microsecond)
+    /// \param maxStepsPerFrame Maximum number of steps that advance can return (at least 1)
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit FixedStepLoop(Time step, unsigned int maxStepsPerFrame = 8);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Measure the time elapsed since the last call and compute the steps to run
+    ///
+    /// The elapsed time is measured with the internal clock and
+    /// added to the time left over by the previous calls. The
+    /// measure always starts exactly where the previous one ended,
+    /// so that no time is ever lost or counted twice, whatever
+    /// the precision of the clock.
+    ///
+    /// \return Number of simulation steps to run during this frame
+    ///
+    /// \see getAlpha, waitForNextStep
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int advance();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an elapsed time and compute the steps to run
+    ///
+    /// This overload ignores the internal clock and lets the
+    /// caller feed the loop, for example with a scaled time, a
+    /// replayed recording or a time step given by another system.
+    /// Negative durations are ignored.
+    ///
+    /// When the accumulated time amounts to more steps than the
+    /// maximum number of steps per frame, the excess time is
+    /// dropped (see getDroppedTime): the simulation slows down
+    /// instead of spending ever more time catching up after a
+    /// long frame.
+    ///
+    /// \param elapsed Time elapsed since the previous call
+    ///
+    /// \return Number of simulation steps to run during this frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int advance(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the interpolation factor between the last two steps
+    ///
+    /// The factor is the fraction of a step accumulated since
+    /// the last step returned by advance, in the range [0, 1).
+    /// Rendering a blend of the previous and current simulation
+    /// states with this factor makes the motion smooth even when
+    /// the framerate and the step rate don't match:
+    /// \code
+    /// const float alpha = loop.getAlpha();
+    /// const sf::Vector2f position = previous * (1.f - alpha) + current * alpha;
+    /// \endcode
+    ///
+    /// \return Interpolation factor, in the range [0, 1)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getAlpha() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sleep until the next simulation step is due
+    ///
+    /// This is meant for loops without a window to pace them,
+    /// like dedicated servers. The deadline comes from the same
+    /// time line as advance, so calling advance after this
+    /// function returns at least one step, and a loop alternating
+    /// both functions runs exactly at the step rate on average.
+    ///
+    /// The function has no effect if advance was last called
+    /// with an explicit elapsed time.
+    ///
+    /// \see sf::sleepUntil
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForNextStep() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the accumulated time and restart the internal clock
+    ///
+    /// Call this function after a pause, such as a loading
+    /// screen, so that the time spent is not simulated. The
+    /// step count and dropped time are not changed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the duration of a simulation step
+    ///
+    /// The time accumulated so far is kept.
+    ///
+    /// \param step Duration of a simulation step (at least one microsecond)
+    ///
+    /// \see getStep
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStep(Time step);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of a simulation step
+    ///
+    /// \return Duration of a simulation step
+    ///
+    /// \see setStep
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getStep() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the maximum number of steps returned by advance
+    ///
+    /// \param maxStepsPerFrame Maximum number of steps per call to advance (at least 1)
+    ///
+    /// \see getMaxStepsPerFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxStepsPerFrame(unsigned int maxStepsPerFrame);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of steps returned by advance
+    ///
+    /// \return Maximum number of steps per call to advance
+    ///
+    /// \see setMaxStepsPerFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getMaxStepsPerFrame() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of steps returned by advance
+    ///
+    /// \return Number of steps since the construction of the loop
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getStepCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the simulated time
+    ///
+    /// \return Step count multiplied by the duration of a step, if it never changed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getSimulationTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total time dropped because of the catch-up limit
+    ///
+    /// \return Time which was accumulated but never simulated
+    ///
+    /// \see setMaxStepsPerFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getDroppedTime() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time                                  m_step;               //!< Duration of a simulation step
+    unsigned int                          m_maxStepsPerFrame{}; //!< Catch-up limit of advance
+    Time                                  m_accumulator;        //!< Time not simulated yet, less than a step
+    Time                                  m_simulationTime;     //!< Total simulated time
+    Time                                  m_droppedTime;        //!< Total time dropped by the catch-up limit
+    std::uint64_t                         m_stepCount{};        //!< Total number of steps
+    std::chrono::steady_clock::time_point m_lastTime;           //!< Time point up to which the clock was accounted
+    bool                                  m_manual{};           //!< Was the loop last fed an explicit time?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FixedStepLoop
+/// \ingroup system
+///
+/// sf::FixedStepLoop turns the variable duration of the frames
+/// of a program into a whole number of simulation steps of a
+/// fixed duration. Physics and gameplay code updated with a
+/// fixed step behaves the same whatever the framerate, and is
+/// deterministic.
+///
+/// Each frame, advance returns how many steps to run; the time
+/// left over is carried to the next frame, and getAlpha tells
+/// how far the loop is between the last step and the next one,
+/// to interpolate what is drawn. Time is counted in whole
+/// microseconds, so the schedule never drifts.
+///
+/// To avoid the "spiral of death" where a slow frame leads to
+/// more steps, which make the next frame slower, advance never
+/// returns more than a maximum number of steps; the rest of
+/// the time is dropped.
+///
+/// To draw exactly one step per frame when the display allows
+/// it, give the step to sf::Window::setFrameTimeLimit.
+///
+/// Usage example:
+/// \code
+/// sf::FixedStepLoop loop(sf::microseconds(16'667));
+/// window.setFrameTimeLimit(loop.getStep());
+///
+/// while (window.isOpen())
+/// {
+///     // handle events...
+///
+///     for (unsigned int steps = loop.advance(); steps > 0; --steps)
+///     {
+///         previous = current;
+///         current  = simulate(current, loop.getStep());
+///     }
+///
+///     draw(interpolate(previous, current, loop.getAlpha()));
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Clock, sf::Window::setFrameTimeLimit
+///
+////////////////////////////////////////////////////////////
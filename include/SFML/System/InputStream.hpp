@@ -31,6 +31,8 @@
 
 #include <SFML/System/Export.hpp>
 
+#include <future>
+
 #include <cstdint>
 
 
@@ -88,6 +90,42 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual std::int64_t getSize() = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from a given position, in the background
+    ///
+    /// The reading position of the stream is left unchanged.
+    /// The buffer must remain valid, and must not be accessed,
+    /// until the future is ready.
+    ///
+    /// Streams that can't read in the background, like the ones
+    /// using this default implementation, which calls seek and
+    /// read, complete the read before returning.
+    ///
+    /// \param position Position of the data to read, from the beginning
+    /// \param data     Buffer where to copy the read data
+    /// \param size     Desired number of bytes to read
+    ///
+    /// \return Future receiving the number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::future<std::int64_t> readAsync(std::int64_t position, void* data, std::int64_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the whole contents of the stream, if they are in memory
+    ///
+    /// Streams whose contents are already in memory, like
+    /// memory buffers or mapped files, can return them so that
+    /// readers can parse them in place instead of copying them
+    /// out with read. The pointer must remain valid, and the
+    /// contents unchanged, as long as the stream is open.
+    ///
+    /// The default implementation returns a null pointer.
+    ///
+    /// \return Pointer to the first of getSize() bytes, or a null pointer if the contents are not in memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual const void* getData() const;
 };
 
 } // namespace sf
@@ -108,6 +146,12 @@ public:
 /// own class from sf::InputStream and load SFML resources with
 /// their loadFromStream function.
 ///
+/// readAsync lets disk latency overlap with other work, such as
+/// decoding the data read previously. Streams reading from
+/// files override it to read in the background, with io_uring
+/// on Linux, overlapped I/O on Windows and Grand Central
+/// Dispatch on macOS and iOS.
+///
 /// Usage example:
 /// \code
 /// // custom stream class that reads from inside a zip file
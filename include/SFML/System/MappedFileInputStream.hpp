@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <filesystem>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on a file mapped in memory
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFileInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MappedFileInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(MappedFileInputStream&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(MappedFileInputStream&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from a file path
+    ///
+    /// The whole file is mapped read-only in the address space
+    /// of the process. Its contents are paged in by the
+    /// operating system when they are first accessed.
+    ///
+    /// \param filename Name of the file to open
+    ///
+    /// \return `true` on success, `false` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t read(void* data, std::int64_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t seek(std::int64_t position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or -1 on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    std::int64_t getSize() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from a given position
+    ///
+    /// The data is copied from memory before the function
+    /// returns, and the reading position is left unchanged.
+    ///
+    /// \param position Position of the data to read, from the beginning
+    /// \param data     Buffer where to copy the read data
+    /// \param size     Desired number of bytes to read
+    ///
+    /// \return Future receiving the number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::int64_t> readAsync(std::int64_t position, void* data, std::int64_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the mapped contents of the file
+    ///
+    /// The pointer remains valid until the stream is closed,
+    /// reopened or destroyed. It is null if no file is open
+    /// or if the file is empty.
+    ///
+    /// \return Pointer to the first byte of the file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the current file, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte* m_data{};   //!< Mapped contents of the file
+    std::int64_t     m_size{};   //!< Size of the file
+    std::int64_t     m_offset{}; //!< Current reading position
+    bool             m_isOpen{}; //!< Is a file currently mapped?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MappedFileInputStream
+/// \ingroup system
+///
+/// This class is a specialization of InputStream that
+/// reads from a file on disk mapped in memory.
+///
+/// The file is not read when it is opened: the operating
+/// system loads its pages on demand, and reading from the
+/// stream is a plain copy out of the mapping. In addition,
+/// getData gives direct access to the mapped bytes, so that
+/// the contents of the file can be parsed in place without
+/// any copy.
+///
+/// On Android, only files of the regular filesystem can be
+/// mapped; use FileInputStream to read the assets of the
+/// application.
+///
+/// Usage example:
+/// \code
+/// void process(const void* data, std::size_t size);
+///
+/// sf::MappedFileInputStream stream;
+/// if (stream.open("some_file.dat"))
+///    process(stream.getData(), static_cast<std::size_t>(stream.getSize()));
+/// \endcode
+///
+/// InputStream, FileInputStream, MemoryInputStream
+///
+////////////////////////////////////////////////////////////
@@ -95,6 +95,29 @@ public:
     ////////////////////////////////////////////////////////////
     std::int64_t getSize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from a given position
+    ///
+    /// The data is copied from memory before the function
+    /// returns, and the reading position is left unchanged.
+    ///
+    /// \param position Position of the data to read, from the beginning
+    /// \param data     Buffer where to copy the read data
+    /// \param size     Desired number of bytes to read
+    ///
+    /// \return Future receiving the number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::int64_t> readAsync(std::int64_t position, void* data, std::int64_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the data the stream reads from
+    ///
+    /// \return Pointer to the data given to open, or a null pointer if the stream is not open
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
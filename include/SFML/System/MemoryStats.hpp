@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Keep track of the objects held by SFML and of the memory they use
+///
+////////////////////////////////////////////////////////////
+namespace sf::MemoryStats
+{
+////////////////////////////////////////////////////////////
+/// \brief Kinds of objects which are counted
+///
+////////////////////////////////////////////////////////////
+enum class Category
+{
+    Texture,       //!< sf::Texture, each holding an OpenGL texture
+    RenderTexture, //!< sf::RenderTexture, each holding an OpenGL framebuffer
+    VertexBuffer,  //!< sf::VertexBuffer, each holding an OpenGL buffer
+    Shader,        //!< sf::Shader and the cached locations of its uniforms
+    Font,          //!< sf::Font and its glyph tables
+    SoundBuffer,   //!< sf::SoundBuffer and its samples
+    Packet,        //!< sf::Packet and its data
+    Socket         //!< sf::TcpSocket and the data waiting to be sent or received
+};
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+static constexpr unsigned int CategoryCount{8}; //!< The total number of object categories
+
+////////////////////////////////////////////////////////////
+/// \brief Objects of a category and memory they use
+///
+////////////////////////////////////////////////////////////
+struct Statistics
+{
+    std::size_t   objectCount{};     //!< Number of objects currently alive
+    std::size_t   peakObjectCount{}; //!< Highest objectCount since the start of the program
+    std::uint64_t bytes{};           //!< System memory currently used by the objects, in bytes
+    std::uint64_t peakBytes{};       //!< Highest bytes since the start of the program
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the objects of a category and the memory they use
+///
+/// \param category Category of objects
+///
+/// \return Statistics of the category
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API Statistics getStatistics(Category category);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the system memory used by all the counted objects
+///
+/// \return Sum of the memory used by all the categories, in bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API std::uint64_t getTotalUsage();
+
+} // namespace sf::MemoryStats
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Update the statistics of a category
+///
+/// \param category     Category of the object
+/// \param objectDelta  Number of objects created (positive) or destroyed (negative)
+/// \param bytesRemoved Memory released by the object, in bytes
+/// \param bytesAdded   Memory taken by the object, in bytes
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void updateMemoryStats(MemoryStats::Category category,
+                                       int                   objectDelta,
+                                       std::uint64_t         bytesRemoved,
+                                       std::uint64_t         bytesAdded) noexcept;
+
+////////////////////////////////////////////////////////////
+/// \brief Member counting its owner and the memory it uses in sf::MemoryStats
+///
+/// Every counter alive counts as one object of \a Category.
+/// The owner reports its memory with setBytes; copies start
+/// with the memory of the original, and moves transfer it.
+///
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+class MemoryCounter
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MemoryCounter() noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MemoryCounter(const MemoryCounter& copy) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MemoryCounter(MemoryCounter&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MemoryCounter& operator=(const MemoryCounter& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MemoryCounter& operator=(MemoryCounter&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MemoryCounter();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the memory used by the owner
+    ///
+    /// \param bytes Memory currently used, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBytes(std::uint64_t bytes) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory reported for the owner
+    ///
+    /// \return Memory reported by the last call to setBytes, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getBytes() const noexcept;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::uint64_t m_bytes{}; //!< Memory reported for the owner, in bytes
+};
+
+} // namespace sf::priv
+
+#include <SFML/System/MemoryStats.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::MemoryStats
+/// \ingroup system
+///
+/// sf::MemoryStats counts the live objects of the classes of
+/// SFML that hold resources, and the system memory they use:
+/// the glyph tables of fonts, the samples of sound buffers,
+/// the data of packets and sockets, and so on. Along with the
+/// current figures, the highest values ever reached are kept,
+/// which, measured over a session, tell how much memory an
+/// application really needs.
+///
+/// The memory of textures, render textures and vertex
+/// buffers lives in video memory; it is reported by
+/// sf::GpuMemory, while their categories here count the
+/// objects and thus the OpenGL objects they hold.
+///
+/// The figures are computed from the sizes of the data the
+/// objects hold, not including the overhead of the allocator.
+/// sf::getAllocationStats gives the exact amount of memory
+/// allocated by each module instead.
+///
+/// Usage example:
+/// \code
+/// const auto fonts = sf::MemoryStats::getStatistics(sf::MemoryStats::Category::Font);
+/// std::cout << fonts.objectCount << " fonts use " << fonts.bytes / 1024 << " KiB\n";
+///
+/// if (sf::MemoryStats::getTotalUsage() > 64 * 1024 * 1024)
+///     cache.clear();
+/// \endcode
+///
+/// \see sf::GpuMemory, sf::getAllocationStats
+///
+////////////////////////////////////////////////////////////
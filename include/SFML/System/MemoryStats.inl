@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MemoryStats.hpp> // NOLINT(misc-header-include-cycle)
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+MemoryCounter<Category>::MemoryCounter() noexcept
+{
+    updateMemoryStats(Category, 1, 0, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+MemoryCounter<Category>::MemoryCounter(const MemoryCounter& copy) noexcept : m_bytes(copy.m_bytes)
+{
+    updateMemoryStats(Category, 1, 0, m_bytes);
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+MemoryCounter<Category>::MemoryCounter(MemoryCounter&& source) noexcept : m_bytes(source.m_bytes)
+{
+    source.m_bytes = 0;
+    updateMemoryStats(Category, 1, 0, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+MemoryCounter<Category>& MemoryCounter<Category>::operator=(const MemoryCounter& right) noexcept
+{
+    setBytes(right.m_bytes);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+MemoryCounter<Category>& MemoryCounter<Category>::operator=(MemoryCounter&& right) noexcept
+{
+    if (&right != this)
+    {
+        // The memory of the right object changes hands, ours is released
+        updateMemoryStats(Category, 0, m_bytes, 0);
+        m_bytes       = right.m_bytes;
+        right.m_bytes = 0;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+MemoryCounter<Category>::~MemoryCounter()
+{
+    updateMemoryStats(Category, -1, m_bytes, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+void MemoryCounter<Category>::setBytes(std::uint64_t bytes) noexcept
+{
+    if (bytes == m_bytes)
+        return;
+
+    updateMemoryStats(Category, 0, m_bytes, bytes);
+    m_bytes = bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+template <MemoryStats::Category Category>
+std::uint64_t MemoryCounter<Category>::getBytes() const noexcept
+{
+    return m_bytes;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Lock-free queue with several producers and a single consumer
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class MpscQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the queue
+    ///
+    /// The storage of all the elements is allocated here, the
+    /// queue never allocates memory afterwards.
+    ///
+    /// \param capacity Maximum number of elements, rounded up to a power of two
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit MpscQueue(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MpscQueue(const MpscQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push an element at the back of the queue
+    ///
+    /// May be called from any number of threads at the same time.
+    ///
+    /// \param value Element to push
+    ///
+    /// \return True if the element was pushed, false if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool push(const T& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push an element at the back of the queue, moving it
+    ///
+    /// May be called from any number of threads at the same time.
+    /// The element is left untouched if the queue is full.
+    ///
+    /// \param value Element to push
+    ///
+    /// \return True if the element was pushed, false if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool push(T&& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop the element at the front of the queue
+    ///
+    /// Must only be called from the consumer thread.
+    ///
+    /// \param value Receives the popped element
+    ///
+    /// \return True if an element was popped, false if the queue is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool pop(T& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of elements of the queue
+    ///
+    /// \return Capacity of the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCapacity() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Slot of the ring buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence; //!< Position the cell is free for, that position + 1 once written
+        T                        value{};  //!< Stored element
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Claim the slot of the next element
+    ///
+    /// \return Claimed cell, or nullptr if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    Cell* reserve();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Cell[]>              m_cells; //!< Storage of the elements
+    std::size_t                          m_mask;  //!< Capacity - 1, to wrap positions into the buffer
+    alignas(64) std::atomic<std::size_t> m_head;  //!< Position of the next element to pop, written by the consumer
+    alignas(64) std::atomic<std::size_t> m_tail;  //!< Position of the next slot to claim, shared by the producers
+};
+
+} // namespace sf
+
+#include <SFML/System/MpscQueue.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MpscQueue
+/// \ingroup system
+///
+/// sf::MpscQueue is a bounded queue that any number of threads
+/// fill while a single thread empties it, without ever locking
+/// a mutex. Its storage is allocated once by the constructor,
+/// so pushing and popping never allocate either. It is meant
+/// to hand work to threads that must never block, like the
+/// audio thread, from anywhere in the program.
+///
+/// Each slot carries a sequence number telling whether it is
+/// free or holds an element: producers claim slots with a
+/// single atomic operation and the consumer only waits for
+/// the element at the front to be published.
+///
+/// T must be default constructible and move assignable. A
+/// popped slot keeps the moved-from element until it is
+/// overwritten.
+///
+/// With a single producer, sf::SpscQueue is a bit cheaper.
+///
+/// Usage example:
+/// \code
+/// // Commands sent to the audio thread by any thread of the program
+/// sf::MpscQueue<Command> commands(256);
+///
+/// // Any thread
+/// if (!commands.push(Command{Command::Type::FadeOut, sf::seconds(2)}))
+///     sf::err() << "Too many pending audio commands" << std::endl;
+///
+/// // Audio thread, in the processing callback
+/// Command command;
+/// while (commands.pop(command))
+///     execute(command);
+/// \endcode
+///
+/// \see sf::SpscQueue
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MpscQueue.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+MpscQueue<T>::MpscQueue(std::size_t capacity) : m_head(0), m_tail(0)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+
+    m_cells = std::make_unique<Cell[]>(size);
+    m_mask  = size - 1;
+
+    for (std::size_t i = 0; i < size; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool MpscQueue<T>::push(const T& value)
+{
+    Cell* cell = reserve();
+    if (!cell)
+        return false;
+
+    cell->value = value;
+    cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool MpscQueue<T>::push(T&& value)
+{
+    Cell* cell = reserve();
+    if (!cell)
+        return false;
+
+    cell->value = std::move(value);
+    cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool MpscQueue<T>::pop(T& value)
+{
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    Cell&             cell = m_cells[head & m_mask];
+
+    // The element at the front may be claimed but not written yet, it is then considered absent
+    if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+        return false;
+
+    value = std::move(cell.value);
+
+    // Make the cell available to the producers for the next round of the ring
+    cell.sequence.store(head + m_mask + 1, std::memory_order_release);
+    m_head.store(head + 1, std::memory_order_relaxed);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t MpscQueue<T>::getCapacity() const
+{
+    return m_mask + 1;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename MpscQueue<T>::Cell* MpscQueue<T>::reserve()
+{
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Cell&             cell     = m_cells[tail & m_mask];
+        const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto        distance = static_cast<std::ptrdiff_t>(sequence - tail);
+
+        if (distance == 0)
+        {
+            // The cell is free for this position: claim it, unless another producer was faster
+            if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                return &cell;
+        }
+        else if (distance < 0)
+        {
+            // The cell still holds the element of the previous round: the queue is full
+            return nullptr;
+        }
+        else
+        {
+            // Another producer claimed this position in the meantime
+            tail = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Receiver of the profiling zones entered by SFML
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ProfilerSink
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~ProfilerSink() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Called when a thread enters a profiling zone
+    ///
+    /// \param name Name of the zone, a string literal that remains valid forever
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void beginZone(const char* name) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Called when a thread leaves the last zone it entered
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void endZone() = 0;
+};
+
+namespace Profiler
+{
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Tell whether SFML was built with profiling zones
+///
+/// Zones are only compiled in when SFML is built with the
+/// SFML_ENABLE_PROFILING CMake option; otherwise they cost
+/// nothing and the sink is never called.
+///
+/// \return True if SFML reports its profiling zones
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API bool isAvailable();
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Set the sink receiving the profiling zones
+///
+/// The sink is called from every thread running SFML code,
+/// including the audio and network threads, so it must be
+/// thread-safe. It must outlive its use: reset the sink to
+/// a null pointer before destroying it.
+///
+/// \param sink Sink to use, or a null pointer to stop profiling
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void setSink(ProfilerSink* sink);
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Get the sink receiving the profiling zones
+///
+/// \return Current sink, or a null pointer if there is none
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API ProfilerSink* getSink();
+} // namespace Profiler
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ProfilerSink
+/// \ingroup system
+///
+/// When SFML is built with the SFML_ENABLE_PROFILING CMake
+/// option, its most expensive functions (drawing, text layout,
+/// glyph rasterization, texture uploads, event processing,
+/// audio streaming and socket I/O) are instrumented with
+/// profiling zones. Every zone entered and left is reported to
+/// the sink given to sf::Profiler::setSink, which forwards them
+/// to a profiler. When the option is disabled, the zones
+/// compile to nothing.
+///
+/// Zones are properly nested on each thread: endZone always
+/// closes the last zone opened by beginZone on the same thread.
+///
+/// SFML provides two sinks: sf::TraceEventSink records the
+/// zones to a file that can be opened in Perfetto, and
+/// sf::TracyProfilerSink forwards them to the Tracy profiler.
+///
+/// Usage example:
+/// \code
+/// sf::TraceEventSink sink;
+/// sf::Profiler::setSink(&sink);
+///
+/// // Run the application...
+///
+/// sf::Profiler::setSink(nullptr);
+/// if (!sink.saveToFile("trace.json"))
+///     std::cerr << "Failed to save the trace" << std::endl;
+/// \endcode
+///
+/// \see sf::TraceEventSink, sf::TracyProfilerSink
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,425 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Cache sharing the resources loaded from the same source
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class ResourceCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Shared handle to a cached resource
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::shared_ptr<T>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function returning the memory used by a resource, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    using MemoryFunction = std::function<std::uint64_t(const T&)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t hits{};          //!< Number of loads answered by the cache
+        std::uint64_t misses{};        //!< Number of loads that had to read the resource
+        std::size_t   resourceCount{}; //!< Number of resources currently alive in the cache
+        std::uint64_t memory{};        //!< Memory used by these resources, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the cache
+    ///
+    /// \param memoryFunction Function returning the memory used by a resource, if memory should be counted
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ResourceCache(MemoryFunction memoryFunction = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceCache(const ResourceCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a resource, loading it if it is not in the cache
+    ///
+    /// If a resource is alive under \a key, it is returned and
+    /// \a loader is not called. If it is being loaded with
+    /// loadAsync, its loading is waited for. Otherwise \a loader
+    /// is called and its result is cached. Failed loads are not
+    /// cached, the next call tries again.
+    ///
+    /// \param key    Key identifying the resource
+    /// \param loader Function returning a std::optional<T>, empty on failure
+    ///
+    /// \return Handle to the resource, or null if it failed to load
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Loader>
+    [[nodiscard]] Handle load(const std::string& key, Loader&& loader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a resource loaded from a file
+    ///
+    /// The resource is loaded with T::loadFromFile(filename, args...)
+    /// and cached under getFileKey(filename), so that different
+    /// spellings of the same path share the resource. The extra
+    /// arguments are not part of the key: to keep variants of the
+    /// same file, such as sRGB and linear textures, or shaders
+    /// made of several files, use load with keys of your own.
+    ///
+    /// \param filename Path of the file to load
+    /// \param args     Extra arguments given to T::loadFromFile
+    ///
+    /// \return Handle to the resource, or null if it failed to load
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename... Args>
+    [[nodiscard]] Handle loadFromFile(const std::filesystem::path& filename, Args&&... args);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a resource loaded from a file in memory
+    ///
+    /// The resource is loaded with T::loadFromMemory(data, size, args...)
+    /// and cached under getMemoryKey(data, size), a hash of the
+    /// content: the same file embedded twice is loaded once. As
+    /// with loadFromFile, the extra arguments are not part of the key.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    /// \param args Extra arguments given to T::loadFromMemory
+    ///
+    /// \return Handle to the resource, or null if it failed to load
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename... Args>
+    [[nodiscard]] Handle loadFromMemory(const void* data, std::size_t size, Args&&... args);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading a resource in the background
+    ///
+    /// \a start is called only if the resource is neither alive
+    /// in the cache nor already being loaded, and must return a
+    /// std::future<std::optional<T>>, like the functions of
+    /// sf::ResourceLoader or std::async do. The resource can then
+    /// be polled with get, or waited for with wait or load.
+    ///
+    /// \param key   Key identifying the resource
+    /// \param start Function starting the load and returning its future
+    ///
+    /// \see get, wait, isLoading
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Start>
+    void loadAsync(const std::string& key, Start&& start);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a resource if it is available, without blocking
+    ///
+    /// A background load that is complete is collected first.
+    /// This function does not change the hit and miss counters.
+    ///
+    /// \param key Key identifying the resource
+    ///
+    /// \return Handle to the resource, or null if it is not loaded (yet)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle get(const std::string& key);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a resource, waiting for its background load if any
+    ///
+    /// This function does not change the hit and miss counters.
+    ///
+    /// \param key Key identifying the resource
+    ///
+    /// \return Handle to the resource, or null if it is not in the cache or failed to load
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle wait(const std::string& key);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a resource is being loaded in the background
+    ///
+    /// \param key Key identifying the resource
+    ///
+    /// \return True if a load started with loadAsync was not collected yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isLoading(const std::string& key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a resource is alive in the cache
+    ///
+    /// \param key Key identifying the resource
+    ///
+    /// \return True if the resource is loaded and still alive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(const std::string& key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a resource from the cache
+    ///
+    /// Handles to the resource remain valid, but the next load
+    /// of the same key loads it again.
+    ///
+    /// \param key Key identifying the resource
+    ///
+    /// \return True if the resource was in the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    bool remove(const std::string& key);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the resources used only by the cache
+    ///
+    /// The resources that no handle outside of the cache refers
+    /// to are destroyed.
+    ///
+    /// \return Number of resources evicted
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t evictUnused();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the resources from the cache
+    ///
+    /// Background loads in progress are waited for and discarded.
+    /// The statistics are kept.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable keeping unused resources alive
+    ///
+    /// By default, the cache owns the resources until they are
+    /// evicted, so that a resource used again later is not
+    /// reloaded. When disabled, the cache only keeps weak
+    /// references: a resource is destroyed as soon as its last
+    /// handle is, and is reloaded by the next load. Disabling it
+    /// releases the resources that are not used anymore.
+    ///
+    /// \param keepAlive True to keep unused resources alive
+    ///
+    /// \see evictUnused
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeepAlive(bool keepAlive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether unused resources are kept alive
+    ///
+    /// \return True if the cache keeps the resources alive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool getKeepAlive() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the cache
+    ///
+    /// \return Hit and miss counters, number and memory of the resources alive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the hit and miss counters
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the key under which a file is cached
+    ///
+    /// The path is made absolute and normalized, following
+    /// symbolic links when the file exists.
+    ///
+    /// \param filename Path of the file
+    ///
+    /// \return Key of the file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::string getFileKey(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the key under which a file in memory is cached
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return Key made of a hash and the size of the data
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::string getMemoryKey(const void* data, std::size_t size);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached resource
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Handle           strong;   //!< Owning reference, null when resources are not kept alive
+        std::weak_ptr<T> weak;     //!< Reference used to find the resource while it is alive
+        std::uint64_t    memory{}; //!< Memory used by the resource, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a resource that is alive
+    ///
+    /// \param key Key identifying the resource
+    ///
+    /// \return Handle to the resource, or null
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle find(const std::string& key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a loaded resource to the cache
+    ///
+    /// \param key      Key identifying the resource
+    /// \param resource Resource, empty if it failed to load
+    ///
+    /// \return Handle to the resource, or null
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle insert(const std::string& key, std::optional<T>&& resource);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Collect the result of a background load
+    ///
+    /// \param key   Key identifying the resource
+    /// \param block True to wait for the load to complete
+    ///
+    /// \return Handle to the resource, or null if it is not available
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle collect(const std::string& key, bool block);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    MemoryFunction                                                 m_memoryFunction;  //!< Memory used by a resource
+    std::unordered_map<std::string, Entry>                         m_entries;         //!< Resources loaded, by key
+    std::unordered_map<std::string, std::future<std::optional<T>>> m_pending;         //!< Background loads, by key
+    bool                                                           m_keepAlive{true}; //!< Own the resources?
+    std::uint64_t                                                  m_hits{};          //!< Loads answered by the cache
+    std::uint64_t                                                  m_misses{};        //!< Loads that read the resource
+};
+
+} // namespace sf
+
+#include <SFML/System/ResourceCache.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ResourceCache
+/// \ingroup system
+///
+/// sf::ResourceCache makes sure that a resource is loaded only
+/// once, however many parts of the application ask for it. It
+/// works with any resource type providing factory functions
+/// returning a std::optional, like sf::Texture, sf::Font,
+/// sf::SoundBuffer and sf::Shader. The resources are handed out
+/// as std::shared_ptr, whose address never changes, so that
+/// sprites, texts and sounds can refer to them safely.
+///
+/// Resources are identified by a key: the normalized path for
+/// loadFromFile, a hash of the content for loadFromMemory, or
+/// any string for load, which takes a function doing the actual
+/// loading. loadAsync starts a background load, for example with
+/// sf::ResourceLoader; loading the same key again meanwhile
+/// waits for it instead of reading the file a second time.
+///
+/// By default the cache owns the resources, and evictUnused
+/// releases the ones that are not used anymore, for example
+/// between two levels. With setKeepAlive(false), the cache only
+/// holds weak references and a resource lives as long as its
+/// handles.
+///
+/// The cache is not thread-safe: it must be used by one thread
+/// at a time, which is usually the main thread.
+///
+/// Usage example:
+/// \code
+/// sf::ResourceCache<sf::Texture> textures([](const sf::Texture& texture)
+///                                         { return std::uint64_t{texture.getSize().x} * texture.getSize().y * 4; });
+///
+/// // Both sprites share the same texture
+/// const sf::ResourceCache<sf::Texture>::Handle texture = textures.loadFromFile("ball.png");
+/// if (!texture)
+///     return -1;
+/// sf::Sprite first(*texture);
+/// sf::Sprite second(*textures.loadFromFile("./ball.png"));
+///
+/// // Load the next level in the background
+/// sf::ResourceLoader loader;
+/// const std::string  key = textures.getFileKey("level2.png");
+/// textures.loadAsync(key, [&] { return loader.loadTexture("level2.png"); });
+/// ...
+/// if (const auto background = textures.get(key))
+///     startLevel(*background);
+///
+/// // Release what the previous level does not use anymore
+/// textures.evictUnused();
+/// \endcode
+///
+/// \see sf::ResourceLoader
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/ResourceCache.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <SFML/System/Checksum.hpp>
+
+#include <chrono>
+#include <system_error>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+ResourceCache<T>::ResourceCache(MemoryFunction memoryFunction) : m_memoryFunction(std::move(memoryFunction))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename Loader>
+typename ResourceCache<T>::Handle ResourceCache<T>::load(const std::string& key, Loader&& loader)
+{
+    if (Handle resource = find(key))
+    {
+        ++m_hits;
+        return resource;
+    }
+
+    // Someone already asked for the resource, share its load
+    if (m_pending.count(key) != 0)
+    {
+        ++m_hits;
+        return collect(key, true);
+    }
+
+    ++m_misses;
+    return insert(key, std::forward<Loader>(loader)());
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+typename ResourceCache<T>::Handle ResourceCache<T>::loadFromFile(const std::filesystem::path& filename, Args&&... args)
+{
+    return load(getFileKey(filename), [&] { return T::loadFromFile(filename, std::forward<Args>(args)...); });
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+typename ResourceCache<T>::Handle ResourceCache<T>::loadFromMemory(const void* data, std::size_t size, Args&&... args)
+{
+    return load(getMemoryKey(data, size), [&] { return T::loadFromMemory(data, size, std::forward<Args>(args)...); });
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename Start>
+void ResourceCache<T>::loadAsync(const std::string& key, Start&& start)
+{
+    if (find(key) || m_pending.count(key) != 0)
+    {
+        ++m_hits;
+        return;
+    }
+
+    ++m_misses;
+    m_pending.emplace(key, std::forward<Start>(start)());
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::get(const std::string& key)
+{
+    return collect(key, false);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::wait(const std::string& key)
+{
+    return collect(key, true);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool ResourceCache<T>::isLoading(const std::string& key) const
+{
+    return m_pending.count(key) != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool ResourceCache<T>::contains(const std::string& key) const
+{
+    return find(key) != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool ResourceCache<T>::remove(const std::string& key)
+{
+    const bool loaded  = m_entries.erase(key) != 0;
+    const bool pending = m_pending.erase(key) != 0;
+    return loaded || pending;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::evictUnused()
+{
+    std::size_t evicted = 0;
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        // The only handle left is the one of the cache, if any
+        const long useCount = it->second.weak.use_count();
+        if (useCount <= (it->second.strong ? 1 : 0))
+        {
+            if (useCount > 0)
+                ++evicted;
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return evicted;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::clear()
+{
+    // Let the loads complete so that their resources are not destroyed by the loading threads
+    for (auto& [key, future] : m_pending)
+        future.wait();
+
+    m_pending.clear();
+    m_entries.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::setKeepAlive(bool keepAlive)
+{
+    m_keepAlive = keepAlive;
+    for (auto& [key, entry] : m_entries)
+        entry.strong = keepAlive ? entry.weak.lock() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool ResourceCache<T>::getKeepAlive() const
+{
+    return m_keepAlive;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Statistics ResourceCache<T>::getStatistics() const
+{
+    Statistics statistics;
+    statistics.hits   = m_hits;
+    statistics.misses = m_misses;
+    for (const auto& [key, entry] : m_entries)
+    {
+        if (!entry.weak.expired())
+        {
+            ++statistics.resourceCount;
+            statistics.memory += entry.memory;
+        }
+    }
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::resetStatistics()
+{
+    m_hits   = 0;
+    m_misses = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::string ResourceCache<T>::getFileKey(const std::filesystem::path& filename)
+{
+    std::error_code       error;
+    std::filesystem::path path = std::filesystem::absolute(filename, error);
+    if (error)
+        path = filename;
+    else if (auto canonical = std::filesystem::weakly_canonical(path, error); !error)
+        path = std::move(canonical);
+
+    // The part of the path that does not exist is not normalized by weakly_canonical
+    return path.lexically_normal().generic_string();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::string ResourceCache<T>::getMemoryKey(const void* data, std::size_t size)
+{
+    // The size is added to the key to make collisions even less likely
+    const std::uint64_t hash = hash64(data, size);
+
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string           key      = "memory:";
+    for (int shift = 60; shift >= 0; shift -= 4)
+        key += digits[(hash >> shift) & 0xf];
+    return key + ':' + std::to_string(size);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::find(const std::string& key) const
+{
+    const auto it = m_entries.find(key);
+    return it != m_entries.end() ? it->second.weak.lock() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::insert(const std::string& key, std::optional<T>&& resource)
+{
+    if (!resource)
+        return nullptr;
+
+    auto   handle = std::make_shared<T>(std::move(*resource));
+    Entry& entry  = m_entries[key];
+    entry.strong  = m_keepAlive ? handle : nullptr;
+    entry.weak    = handle;
+    entry.memory  = m_memoryFunction ? m_memoryFunction(*handle) : 0;
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::collect(const std::string& key, bool block)
+{
+    const auto it = m_pending.find(key);
+    if (it == m_pending.end())
+        return find(key);
+
+    if (!block && it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return nullptr;
+
+    // Forget the load before getting its result, which may throw
+    std::future<std::optional<T>> future = std::move(it->second);
+    m_pending.erase(it);
+    return insert(key, future.get());
+}
+
+} // namespace sf
@@ -29,6 +29,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Export.hpp>
 
+#include <chrono>
+
 
 namespace sf
 {
@@ -44,14 +46,67 @@ class Time;
 /// one provides more accurate sleeping time thanks to some
 /// platform-specific tweaks.
 ///
-/// sf::sleep only guarantees millisecond precision. Sleeping
-/// for a duration less than 1 millisecond is prone to result
-/// in the actual sleep duration being less than what is
-/// requested.
+/// sf::sleep never returns early, but the system may wake the
+/// thread up later than requested, usually by a fraction of a
+/// millisecond and sometimes by several milliseconds when it is
+/// busy. Use sf::sleepPrecise when the wake-up time matters.
 ///
 /// \param duration Time to sleep
 ///
+/// \see sleepPrecise, sleepUntil
+///
 ////////////////////////////////////////////////////////////
 void SFML_SYSTEM_API sleep(Time duration);
 
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Make the current thread sleep for a precise duration
+///
+/// Equivalent to sleepUntil(std::chrono::steady_clock::now() + duration).
+///
+/// \param duration Time to sleep
+///
+/// \see sleep, sleepUntil
+///
+////////////////////////////////////////////////////////////
+void SFML_SYSTEM_API sleepPrecise(Time duration);
+
+////////////////////////////////////////////////////////////
+/// \ingroup system
+/// \brief Make the current thread sleep until a precise point in time
+///
+/// The thread sleeps with the most accurate timer of the system
+/// until shortly before the deadline, then spins for the
+/// remaining time, which brings the wake-up within a few
+/// microseconds of the deadline. The length of the spin adapts
+/// to how late the system timer was in the previous sleeps, so
+/// that little CPU time is burnt on systems that wake threads
+/// up accurately.
+///
+/// This is meant for frame limiters, fixed-rate network ticks
+/// or audio schedulers, which need to wake up on time; for
+/// long or non-critical waits, sf::sleep is cheaper.
+///
+/// Sleeping until an absolute deadline, rather than for a
+/// duration computed from it, keeps the error from piling up
+/// across the iterations of a loop:
+/// \code
+/// auto deadline = std::chrono::steady_clock::now();
+/// while (running)
+/// {
+///     update();
+///     deadline += std::chrono::microseconds(15625); // 64 Hz
+///     sf::sleepUntil(deadline);
+/// }
+/// \endcode
+///
+/// The function returns immediately if the deadline is over.
+///
+/// \param deadline Point in time at which the function returns
+///
+/// \see sleep, sleepPrecise
+///
+////////////////////////////////////////////////////////////
+void SFML_SYSTEM_API sleepUntil(std::chrono::steady_clock::time_point deadline);
+
 } // namespace sf
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <array>
+#include <atomic>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Lock-free queue with a single producer and a single consumer
+///
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+class SpscQueue
+{
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push an element at the back of the queue
+    ///
+    /// Must only be called from the producer thread.
+    ///
+    /// \param value Element to push
+    ///
+    /// \return True if the element was pushed, false if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool push(const T& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push an element at the back of the queue, moving it
+    ///
+    /// Must only be called from the producer thread. The element
+    /// is left untouched if the queue is full.
+    ///
+    /// \param value Element to push
+    ///
+    /// \return True if the element was pushed, false if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool push(T&& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop the element at the front of the queue
+    ///
+    /// Must only be called from the consumer thread.
+    ///
+    /// \param value Receives the popped element
+    ///
+    /// \return True if an element was popped, false if the queue is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool pop(T& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the queue is empty
+    ///
+    /// The result is exact when called from the consumer thread.
+    /// From another thread, it may be outdated by the time it is
+    /// used.
+    ///
+    /// \return True if the queue contains no element
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of elements of the queue
+    ///
+    /// \return Capacity of the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static constexpr std::size_t getCapacity();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for a free slot
+    ///
+    /// \return Position of the free slot, or nullptr if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    T* reserve();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::array<T, Capacity>              m_buffer{};     //!< Storage of the elements
+    alignas(64) std::atomic<std::size_t> m_head{};       //!< Number of elements popped, written by the consumer
+    std::size_t                          m_cachedTail{}; //!< Last value of m_tail seen by the consumer
+    alignas(64) std::atomic<std::size_t> m_tail{};       //!< Number of elements pushed, written by the producer
+    std::size_t                          m_cachedHead{}; //!< Last value of m_head seen by the producer
+};
+
+} // namespace sf
+
+#include <SFML/System/SpscQueue.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpscQueue
+/// \ingroup system
+///
+/// sf::SpscQueue is a fixed-size ring buffer that one thread
+/// fills while another one empties it, without ever locking
+/// a mutex nor allocating memory. This makes it suitable to
+/// send data to or from threads that must never block, like
+/// the audio thread: a thread holding a mutex can be preempted,
+/// making the audio thread wait for it (priority inversion).
+///
+/// Each thread only writes its own counter, on its own cache
+/// line, and keeps a copy of the counter of the other thread
+/// so that it rarely has to read it.
+///
+/// The elements are stored inline: T must be default
+/// constructible and move assignable, and the capacity must
+/// be a power of two. A popped slot keeps the moved-from
+/// element until it is overwritten.
+///
+/// When several threads need to push into the same queue,
+/// use sf::MpscQueue instead.
+///
+/// Usage example:
+/// \code
+/// // Shared between the game thread and the audio thread
+/// sf::SpscQueue<float, 64> volumes;
+///
+/// // Game thread: if the queue is full, the audio thread is late and the change can wait for the next frame
+/// const bool sent = volumes.push(0.5f);
+///
+/// // Audio thread, in the processing callback
+/// float volume = 0.f;
+/// while (volumes.pop(volume))
+///     currentVolume = volume;
+/// \endcode
+///
+/// \see sf::MpscQueue
+///
+////////////////////////////////////////////////////////////
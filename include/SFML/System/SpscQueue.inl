@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/SpscQueue.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::push(const T& value)
+{
+    T* slot = reserve();
+    if (!slot)
+        return false;
+
+    *slot = value;
+    m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::push(T&& value)
+{
+    T* slot = reserve();
+    if (!slot)
+        return false;
+
+    *slot = std::move(value);
+    m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::pop(T& value)
+{
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+    // Only read the counter of the producer when the elements known to be available are exhausted
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail)
+            return false;
+    }
+
+    value = std::move(m_buffer[head & (Capacity - 1)]);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::isEmpty() const
+{
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+constexpr std::size_t SpscQueue<T, Capacity>::getCapacity()
+{
+    return Capacity;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Capacity>
+T* SpscQueue<T, Capacity>::reserve()
+{
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    // The counters only grow, their difference is the number of elements even when they wrap around
+    if (tail - m_cachedHead == Capacity)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (tail - m_cachedHead == Capacity)
+            return nullptr;
+    }
+
+    return &m_buffer[tail & (Capacity - 1)];
+}
+
+} // namespace sf
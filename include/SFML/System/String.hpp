@@ -547,6 +547,30 @@ private:
     friend SFML_SYSTEM_API bool operator==(const String& left, const String& right);
     friend SFML_SYSTEM_API bool operator<(const String& left, const String& right);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the contents with a contiguous UTF-8 sequence
+    ///
+    /// Faster than converting one character at a time: the
+    /// string is allocated once and ASCII runs are widened by
+    /// whole blocks.
+    ///
+    /// \param begin Pointer to the beginning of the UTF-8 sequence
+    /// \param end   Pointer to the end of the UTF-8 sequence
+    ///
+    ////////////////////////////////////////////////////////////
+    void assignUtf8(const std::uint8_t* begin, const std::uint8_t* end);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the contents with a contiguous UTF-16 sequence
+    ///
+    /// \param begin Pointer to the beginning of the UTF-16 sequence
+    /// \param end   Pointer to the end of the UTF-16 sequence
+    ///
+    /// \see assignUtf8
+    ///
+    ////////////////////////////////////////////////////////////
+    void assignUtf16(const char16_t* begin, const char16_t* end);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
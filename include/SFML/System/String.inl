@@ -28,16 +28,46 @@
 #include <SFML/System/String.hpp> // NOLINT(misc-header-include-cycle)
 
 #include <iterator>
+#include <string>
+#include <type_traits>
 
 
 namespace sf
 {
+namespace priv
+{
+////////////////////////////////////////////////////////////
+// Tell whether an iterator points to contiguous integers of a given size
+template <typename T, std::size_t Size>
+constexpr bool isContiguousIterator()
+{
+    using Value = typename std::iterator_traits<T>::value_type;
+    if constexpr (!std::is_integral_v<Value> || (sizeof(Value) != Size))
+        return false;
+    else
+        return std::is_pointer_v<T> || std::is_same_v<T, typename std::basic_string<Value>::iterator> ||
+               std::is_same_v<T, typename std::basic_string<Value>::const_iterator>;
+}
+} // namespace priv
+
+
 ////////////////////////////////////////////////////////////
 template <typename T>
 String String::fromUtf8(T begin, T end)
 {
     String string;
-    Utf8::toUtf32(begin, end, std::back_inserter(string.m_string));
+    if constexpr (priv::isContiguousIterator<T, 1>())
+    {
+        if (begin != end)
+        {
+            const auto* data = reinterpret_cast<const std::uint8_t*>(&*begin);
+            string.assignUtf8(data, data + (end - begin));
+        }
+    }
+    else
+    {
+        Utf8::toUtf32(begin, end, std::back_inserter(string.m_string));
+    }
     return string;
 }
 
@@ -47,7 +77,18 @@ template <typename T>
 String String::fromUtf16(T begin, T end)
 {
     String string;
-    Utf16::toUtf32(begin, end, std::back_inserter(string.m_string));
+    if constexpr (priv::isContiguousIterator<T, 2>())
+    {
+        if (begin != end)
+        {
+            const auto* data = reinterpret_cast<const char16_t*>(&*begin);
+            string.assignUtf16(data, data + (end - begin));
+        }
+    }
+    else
+    {
+        Utf16::toUtf32(begin, end, std::back_inserter(string.m_string));
+    }
     return string;
 }
 
@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of worker threads running tasks
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ThreadPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Priority of a task
+    ///
+    /// Workers always run the pending tasks of the highest
+    /// priority first.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Priority
+    {
+        High,   //!< Tasks something is waiting for, like the ranges of parallelFor
+        Normal, //!< Regular tasks
+        Low     //!< Background tasks, run when nothing else is pending
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Starts one worker thread per hardware thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool with a given number of worker threads
+    ///
+    /// \param threadCount Number of worker threads, at least one is started
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ThreadPool(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Completes the tasks that are still pending, then stops
+    /// the worker threads.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool(const ThreadPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run a task on a worker thread
+    ///
+    /// Tasks submitted from a worker thread are queued on that
+    /// worker, idle workers steal them if it is busy.
+    ///
+    /// \param task     Function to call, without arguments
+    /// \param priority Priority of the task
+    ///
+    /// \return Future receiving the result of the task, or the exception it threw
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    [[nodiscard]] std::future<std::invoke_result_t<F>> submit(F&& task, Priority priority = Priority::Normal);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function for each index of a range, concurrently
+    ///
+    /// The indices are split into chunks processed by the calling
+    /// thread and by the worker threads, and the function returns
+    /// once all of them are done. It may be called from a task
+    /// running on the pool.
+    ///
+    /// If the function throws, the first exception is rethrown
+    /// once the chunks that already started are done, and the
+    /// other chunks are skipped.
+    ///
+    /// \param begin    First index
+    /// \param end      Past-the-end index
+    /// \param function Function to call with each index
+    ///
+    ////////////////////////////////////////////////////////////
+    void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t)>& function);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pool shared by the whole application
+    ///
+    /// It is created on first use, with one worker thread less
+    /// than there are hardware threads, since the threads waiting
+    /// for its work take part in it. SFML runs its own parallel
+    /// work on this pool when no job scheduler is set.
+    ///
+    /// \return Global thread pool
+    ///
+    /// \see setJobScheduler
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ThreadPool& getGlobal();
+
+private:
+    struct Queue;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a task
+    ///
+    /// \param task     Function to call on a worker thread
+    /// \param priority Priority of the task
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(std::function<void()> task, Priority priority);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the next task to run
+    ///
+    /// \param index Index of the queue of the worker, tried first
+    /// \param task  Receives the task
+    ///
+    /// \return True if a task was found
+    ///
+    ////////////////////////////////////////////////////////////
+    bool pop(std::size_t index, std::function<void()>& task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Main function of the worker threads
+    ///
+    /// \param index Index of the worker
+    ///
+    ////////////////////////////////////////////////////////////
+    void run(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Queue>> m_queues;         //!< Tasks of each worker
+    std::vector<std::thread>            m_threads;        //!< Worker threads
+    std::atomic<std::size_t>            m_nextQueue{};    //!< Queue receiving the next task submitted from outside
+    std::atomic<std::size_t>            m_pendingTasks{}; //!< Number of tasks waiting in the queues
+    std::mutex                          m_sleepMutex;     //!< Mutex protecting the sleep of idle workers
+    std::condition_variable             m_wakeUp;         //!< Wakes idle workers up when tasks are queued
+    bool                                m_stopping{};     //!< Is the pool being destroyed?
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Function running jobs concurrently
+///
+/// A job scheduler receives a number of jobs and a function to
+/// call with the index of each one of them, in [0, jobCount).
+/// It may run the jobs in any order and on any thread, but
+/// must return only once all of them are done.
+///
+////////////////////////////////////////////////////////////
+using JobScheduler = std::function<void(std::size_t jobCount, const std::function<void(std::size_t job)>& job)>;
+
+////////////////////////////////////////////////////////////
+/// \brief Set the job scheduler used by the parallel work of SFML
+///
+/// By default, the parallel work of SFML, like the operations
+/// executed with sf::ExecutionPolicy::Parallel, the loading of
+/// several glyphs or sound files and the decoding of long
+/// sounds, runs on sf::ThreadPool::getGlobal(). Setting a job
+/// scheduler makes it submit the work to it instead, for example
+/// to integrate with the task system of an engine and avoid
+/// running more threads than there are cores. Passing an empty
+/// function restores the default behavior.
+///
+/// The scheduler must not be changed while parallel work is
+/// running.
+///
+/// \param scheduler Job scheduler to use, or an empty function to use the global thread pool
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void setJobScheduler(JobScheduler scheduler);
+
+} // namespace sf
+
+#include <SFML/System/ThreadPool.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ThreadPool
+/// \ingroup system
+///
+/// sf::ThreadPool runs tasks on a fixed set of worker threads.
+/// Each worker has its own queues, one per priority, where the
+/// tasks it submits itself are added; idle workers steal tasks
+/// from the others, so that the load stays balanced without a
+/// single queue shared by all the threads.
+///
+/// submit runs a single task and hands its result back through
+/// a std::future. parallelFor splits a loop over indices into
+/// chunks and waits for all of them, with the calling thread
+/// taking part in the work.
+///
+/// Usage example:
+/// \code
+/// sf::ThreadPool pool;
+///
+/// // Run a task in the background
+/// std::future<std::optional<sf::Image>> image = pool.submit([] { return sf::Image::loadFromFile("map.png"); });
+///
+/// // Process many items concurrently
+/// std::vector<float> heights(1'000'000);
+/// pool.parallelFor(0, heights.size(), [&](std::size_t i) { heights[i] = computeHeight(i); });
+///
+/// // Let the parallel work of SFML run on the pool as well
+/// sf::setJobScheduler([&pool](std::size_t jobCount, const std::function<void(std::size_t)>& job)
+///                     { pool.parallelFor(0, jobCount, job); });
+/// \endcode
+///
+/// \see sf::setJobScheduler
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/FastClock.hpp>
+#include <SFML/System/Profiler.hpp>
+
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Profiler sink recording zones in the Trace Event Format
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API TraceEventSink : public ProfilerSink
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the beginning of a zone
+    ///
+    /// \param name Name of the zone
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginZone(const char* name) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the end of the current zone
+    ///
+    ////////////////////////////////////////////////////////////
+    void endZone() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the recorded zones to a JSON file
+    ///
+    /// The file can be opened in Perfetto (https://ui.perfetto.dev)
+    /// or in the chrome://tracing page of Chromium browsers.
+    ///
+    /// \param filename Path of the file to write
+    ///
+    /// \return True if the file was written
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveToFile(const std::filesystem::path& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the recorded zones
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of events recorded so far
+    ///
+    /// Every zone produces two events, one when it begins and
+    /// one when it ends.
+    ///
+    /// \return Number of events
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getEventCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Beginning or end of a zone
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Event
+    {
+        const char*  name{};      //!< Name of the zone, null for the end of a zone
+        unsigned int thread{};    //!< Index of the thread, in order of appearance
+        std::int64_t timestamp{}; //!< Time of the event, in microseconds since the creation of the sink
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record an event on the current thread
+    ///
+    /// \param name Name of the zone, null for the end of a zone
+    ///
+    ////////////////////////////////////////////////////////////
+    void record(const char* name);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable std::mutex                                m_mutex;   //!< Protects the events, recorded from any thread
+    std::vector<Event>                                m_events;  //!< Events recorded so far
+    std::unordered_map<std::thread::id, unsigned int> m_threads; //!< Index of each thread that recorded events
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TraceEventSink
+/// \ingroup system
+///
+/// sf::TraceEventSink keeps every zone reported by SFML in
+/// memory, with the thread that entered it and its timestamps,
+/// until saveToFile writes them in the Trace Event Format used
+/// by Perfetto and Chromium's tracing tools. Since the events
+/// accumulate, it is meant to profile sessions of limited
+/// length; call clear to start over.
+///
+/// It requires SFML to be built with the SFML_ENABLE_PROFILING
+/// CMake option, see sf::ProfilerSink.
+///
+/// \see sf::ProfilerSink, sf::TracyProfilerSink
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Profiler.hpp>
+
+#include <tracy/TracyC.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Profiler sink forwarding zones to the Tracy profiler
+///
+////////////////////////////////////////////////////////////
+class TracyProfilerSink : public ProfilerSink
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Begin a Tracy zone
+    ///
+    /// \param name Name of the zone
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginZone(const char* name) override
+    {
+        getZones().push_back(___tracy_emit_zone_begin(getLocation(name), 1));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the current Tracy zone of the calling thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void endZone() override
+    {
+        std::vector<TracyCZoneCtx>& zones = getZones();
+        ___tracy_emit_zone_end(zones.back());
+        zones.pop_back();
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the zones opened by the calling thread
+    ///
+    /// \return Stack of the zones, the innermost one last
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::vector<TracyCZoneCtx>& getZones()
+    {
+        thread_local std::vector<TracyCZoneCtx> zones;
+        return zones;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source location Tracy associates to a zone
+    ///
+    /// Tracy reads source locations long after the zones were
+    /// entered, so they are never destroyed.
+    ///
+    /// \param name Name of the zone
+    ///
+    /// \return Source location describing the zone
+    ///
+    ////////////////////////////////////////////////////////////
+    static const ___tracy_source_location_data* getLocation(const char* name)
+    {
+        static std::mutex mutex;
+        static auto&      locations = *new std::unordered_map<const char*, ___tracy_source_location_data>;
+
+        const std::lock_guard lock(mutex);
+        return &locations.try_emplace(name, ___tracy_source_location_data{name, name, "SFML", 0, 0}).first->second;
+    }
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TracyProfilerSink
+/// \ingroup system
+///
+/// sf::TracyProfilerSink reports the zones of SFML to Tracy
+/// (https://github.com/wolfpld/tracy), where they appear next
+/// to the zones of the application on the same threads.
+///
+/// This class is defined entirely in its header so that SFML
+/// doesn't depend on Tracy: it is compiled in the application,
+/// which must find the Tracy headers, define TRACY_ENABLE and
+/// link to the Tracy client library. SFML itself must be built
+/// with the SFML_ENABLE_PROFILING CMake option.
+///
+/// Usage example:
+/// \code
+/// #include <SFML/System/TracyProfilerSink.hpp>
+///
+/// sf::TracyProfilerSink sink;
+/// sf::Profiler::setSink(&sink);
+/// \endcode
+///
+/// \see sf::ProfilerSink, sf::TraceEventSink
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/String.hpp>
+
+#include <string_view>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Non-owning view of a UTF-8 encoded string
+///
+////////////////////////////////////////////////////////////
+class Utf8View
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty view.
+    ///
+    ////////////////////////////////////////////////////////////
+    constexpr Utf8View() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from UTF-8 encoded characters
+    ///
+    /// This constructor is explicit because the characters of
+    /// a std::string are interpreted as ANSI by sf::String.
+    ///
+    /// \param string UTF-8 encoded characters
+    ///
+    ////////////////////////////////////////////////////////////
+    constexpr explicit Utf8View(std::string_view string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from a UTF-8 string
+    ///
+    /// \param string UTF-8 string, must outlive the view
+    ///
+    ////////////////////////////////////////////////////////////
+    Utf8View(const U8String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the UTF-8 encoded characters of the view
+    ///
+    /// \return Characters of the view, not null-terminated
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr std::string_view getBytes() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the view
+    ///
+    /// \return Number of bytes in the view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the view is empty or not
+    ///
+    /// \return True if the view is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the view into a sf::String
+    ///
+    /// \return UTF-32 string holding the characters of the view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] String toString() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::string_view m_bytes; //!< UTF-8 encoded characters
+};
+
+////////////////////////////////////////////////////////////
+/// \relates Utf8View
+/// \brief Overload of operator== to compare two views
+///
+/// \param left  Left operand (a view)
+/// \param right Right operand (a view)
+///
+/// \return True if both views hold the same bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr bool operator==(Utf8View left, Utf8View right);
+
+////////////////////////////////////////////////////////////
+/// \relates Utf8View
+/// \brief Overload of operator!= to compare two views
+///
+/// \param left  Left operand (a view)
+/// \param right Right operand (a view)
+///
+/// \return True if the views hold different bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr bool operator!=(Utf8View left, Utf8View right);
+
+} // namespace sf
+
+#include <SFML/System/Utf8View.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Utf8View
+/// \ingroup system
+///
+/// sf::Utf8View refers to UTF-8 text stored elsewhere, such as a
+/// string literal or a std::string holding data read from a file,
+/// without copying or decoding it. Classes that display text,
+/// like sf::Text and sf::WindowBase, accept it in addition to
+/// sf::String: they can then keep the text in UTF-8, skip the
+/// work when the same text is given again, and only decode it to
+/// UTF-32 when the codepoints are actually needed.
+///
+/// The view doesn't own the characters, they must remain valid
+/// for as long as the view is used.
+///
+/// Usage example:
+/// \code
+/// sf::Text text(font);
+/// const std::string label = "Caf\xc3\xa9";
+///
+/// // Every frame
+/// text.setString(sf::Utf8View(label)); // decoded only when the label changes
+/// \endcode
+///
+/// \see sf::String, sf::Utf8
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Utf8View.hpp> // NOLINT(misc-header-include-cycle)
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+constexpr Utf8View::Utf8View(std::string_view string) : m_bytes(string)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+inline Utf8View::Utf8View(const U8String& string) :
+m_bytes(reinterpret_cast<const char*>(string.data()), string.size())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr std::string_view Utf8View::getBytes() const
+{
+    return m_bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr std::size_t Utf8View::getSize() const
+{
+    return m_bytes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr bool Utf8View::isEmpty() const
+{
+    return m_bytes.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline String Utf8View::toString() const
+{
+    return String::fromUtf8(m_bytes.data(), m_bytes.data() + m_bytes.size());
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr bool operator==(Utf8View left, Utf8View right)
+{
+    return left.getBytes() == right.getBytes();
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr bool operator!=(Utf8View left, Utf8View right)
+{
+    return !(left == right);
+}
+
+} // namespace sf
@@ -29,10 +29,13 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Export.hpp>
 
+#include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/GlResource.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <future>
 #include <memory>
 #include <string_view>
 
@@ -46,8 +49,6 @@ namespace priv
 class GlContext;
 }
 
-struct ContextSettings;
-
 using GlFunctionPointer = void (*)();
 
 ////////////////////////////////////////////////////////////
@@ -57,6 +58,19 @@ using GlFunctionPointer = void (*)();
 class SFML_WINDOW_API Context : GlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters of the context activity of the whole application
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t contextSwitches{};      //!< Number of times a context was made current or released
+        std::uint64_t redundantActivations{}; //!< Number of activations skipped because the context was already current
+        Time          sharedContextCreation;  //!< Time spent creating the hidden context shared by all contexts
+        Time          formatSelection;        //!< Time spent scoring pixel formats, excluding cached selections
+        std::uint64_t formatCacheHits{};      //!< Number of pixel format selections answered from the cache
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -165,6 +179,46 @@ public:
     ////////////////////////////////////////////////////////////
     static std::uint64_t getActiveContextId();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the context activations
+    ///
+    /// Making a context current is an expensive operation for
+    /// the driver. These counters, shared by all the threads,
+    /// accumulate from the start of the application; compare
+    /// them between two frames to find the switches issued per
+    /// frame. Render textures using FBOs render in the context
+    /// which is active when they are drawn to, so drawing them
+    /// from the thread of a window doesn't switch contexts.
+    ///
+    /// \return Statistics accumulated since the start of the application
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Statistics getStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the creation of a window on a background thread
+    ///
+    /// Creating the first window initializes the OpenGL driver,
+    /// creates the hidden context shared by all contexts and
+    /// selects a pixel format, which can block for a long time.
+    /// This function does all of it on another thread, so that
+    /// the application can keep showing a splash screen in the
+    /// meantime; creating a window with the same settings and
+    /// pixel depth is cheap afterwards. The shared context is
+    /// kept alive until the next window or context is created.
+    ///
+    /// The returned future must be kept until it is ready, its
+    /// destructor waits for the background thread otherwise.
+    ///
+    /// \param settings     Creation parameters of the future window
+    /// \param bitsPerPixel Pixel depth of the future window, in bits per pixel
+    ///
+    /// \return Future receiving true if the shared context is usable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::future<bool> preloadAsync(const ContextSettings& settings     = {},
+                                                        unsigned int           bitsPerPixel = 32);
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct a in-memory context
     ///
@@ -221,4 +275,15 @@ private:
 /// // by the sf::Context destructor
 /// \endcode
 ///
+/// The first window, or context, takes a while to create
+/// since the OpenGL driver has to be initialized. This can be
+/// done on a background thread in advance:
+/// \code
+/// std::future<bool> preload = sf::Context::preloadAsync();
+/// while (preload.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+///     showSplashScreen();
+///
+/// sf::Window window(sf::VideoMode({800, 600}), "SFML window"); // cheap now
+/// \endcode
+///
 ////////////////////////////////////////////////////////////
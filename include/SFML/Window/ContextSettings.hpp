@@ -59,6 +59,8 @@ struct ContextSettings
     unsigned int  minorVersion{1};                    //!< Minor number of the context version to create
     std::uint32_t attributeFlags{Attribute::Default}; //!< The attribute flags to create the context with
     bool          sRgbCapable{};                      //!< Whether the context framebuffer is sRGB capable
+    bool          lowLatencyPresentation{};           //!< Whether the frames are presented through a DXGI swap chain
+    bool          sharedWindowContext{};              //!< Whether windows with the same settings share one context
 };
 
 } // namespace sf
@@ -115,6 +117,37 @@ struct ContextSettings
 /// OpenGL Capabilities Tables</a> page. OS X also currently does
 /// not support debug contexts.
 ///
+/// lowLatencyPresentation only applies to windows on Windows.
+/// When enabled, the frames are presented through a DXGI flip
+/// model swap chain (shared with OpenGL through the
+/// WGL_NV_DX_interop2 extension) instead of SwapBuffers. This
+/// saves the frame of latency added by the compositor to
+/// windowed applications, lets the frames tear when vertical
+/// synchronization is disabled, which variable refresh rate
+/// monitors need, and makes display() wait until the next
+/// frame can be queued instead of letting the driver queue
+/// several ones. The frames are then rendered to a framebuffer
+/// object which is bound when the context is created: custom
+/// OpenGL code must bind it back, not the framebuffer 0, to
+/// render to the window (sf::RenderWindow does it). It is not
+/// compatible with anti-aliasing.
+///
+/// sharedWindowContext lets windows render through a single
+/// OpenGL context instead of one each. A window created with
+/// it enabled reuses the context of an existing window that
+/// was also created with it, with the same settings and pixel
+/// depth, if their pixel formats are compatible. Activating
+/// another window of the group then only switches the surface
+/// rendered to: the OpenGL state and the objects that can't be
+/// shared between contexts, such as vertex array objects and
+/// framebuffer objects, stay valid, and sf::RenderWindow keeps
+/// its cached states. Since a context can only be active in
+/// one thread at a time, the windows of a group must all be
+/// drawn from the same thread. It is currently supported by
+/// GLX (Linux and BSD with X11) and WGL (Windows), except for
+/// windows using lowLatencyPresentation; elsewhere each window
+/// keeps its own context.
+///
 /// Please note that these values are only a hint.
 /// No failure will be reported if one or more of these values
 /// are not supported by the system; instead, SFML will try to
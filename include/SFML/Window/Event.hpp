@@ -34,6 +34,7 @@
 #include <SFML/Window/Mouse.hpp>
 #include <SFML/Window/Sensor.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <variant>
@@ -274,6 +275,19 @@ public:
         Vector3f     value;  //!< Current value of the sensor on the X, Y, and Z axes
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Monitors changed event
+    ///
+    /// Sent when a monitor is plugged or unplugged, or when the
+    /// video mode, position or orientation of a monitor changes.
+    /// The video modes and monitors reported by sf::VideoMode
+    /// are already up to date when it is received.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct MonitorsChanged
+    {
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -320,6 +334,40 @@ public:
         return !is<Empty>();
     }
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time at which the event happened
+    ///
+    /// The timestamp is measured on the monotonic clock used by
+    /// sf::Clock, from an unspecified origin: only the difference
+    /// between two timestamps is meaningful. When the operating
+    /// system provides the time of an input event, it is used,
+    /// otherwise the timestamp is the time at which SFML read the
+    /// event. It is independent from the time at which the event
+    /// is polled.
+    ///
+    /// \return Timestamp of the event, or sf::Time::Zero if the event wasn't produced by a window
+    ///
+    /// \see setTimestamp
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getTimestamp() const
+    {
+        return m_timestamp;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the time at which the event happened
+    ///
+    /// \param timestamp New timestamp of the event
+    ///
+    /// \see getTimestamp
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTimestamp(Time timestamp)
+    {
+        m_timestamp = timestamp;
+    }
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -347,8 +395,10 @@ private:
                  TouchBegan,
                  TouchMoved,
                  TouchEnded,
-                 SensorChanged>
+                 SensorChanged,
+                 MonitorsChanged>
         m_data; //!< Event data
+    Time m_timestamp; //!< Time at which the event happened
 
     ////////////////////////////////////////////////////////////
     // Helper functions
@@ -409,4 +459,8 @@ private:
 /// }
 /// \endcode
 ///
+/// Every event polled from a window is timestamped (see
+/// sf::Event::getTimestamp), which allows measuring input
+/// timing independently from the frame rate.
+///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Export.hpp>
+
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <bitset>
+
+
+namespace sf
+{
+class Event;
+class WindowBase;
+
+////////////////////////////////////////////////////////////
+/// \brief State of the keyboard and mouse at a given time
+///
+////////////////////////////////////////////////////////////
+class SFML_WINDOW_API InputSnapshot
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the current state of the keyboard and mouse
+    ///
+    /// The state of all the keys, all the buttons and the
+    /// position of the mouse are read at once, with as few
+    /// requests to the system as possible. The mouse position
+    /// is in desktop coordinates.
+    ///
+    /// \see update
+    ///
+    ////////////////////////////////////////////////////////////
+    void capture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the current state of the keyboard and mouse, relative to a window
+    ///
+    /// This is the same as capture(), except that the mouse
+    /// position is relative to the given window.
+    ///
+    /// \param relativeTo Reference window
+    ///
+    /// \see update
+    ///
+    ////////////////////////////////////////////////////////////
+    void capture(const WindowBase& relativeTo);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the state with an event
+    ///
+    /// Giving every event of a window to this function keeps the
+    /// snapshot up to date without querying the system at all.
+    /// Key and mouse button events change the state of the key or
+    /// button, mouse events change the position of the mouse
+    /// (relative to the window of the event), and the state of
+    /// all the keys and buttons is cleared when the window loses
+    /// the focus, since their release is not reported anymore.
+    /// Other events are ignored.
+    ///
+    /// \param event Event received from the window
+    ///
+    /// \see capture
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Event& event);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key was pressed
+    ///
+    /// \param key Key to check
+    ///
+    /// \return True if the key was pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyPressed(Keyboard::Key key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key was pressed
+    ///
+    /// \param code Scancode to check
+    ///
+    /// \return True if the physical key was pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyPressed(Keyboard::Scancode code) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a mouse button was pressed
+    ///
+    /// \param button Button to check
+    ///
+    /// \return True if the button was pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMouseButtonPressed(Mouse::Button button) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the mouse
+    ///
+    /// The coordinates are the ones of the last capture or
+    /// event: desktop coordinates after capture(), coordinates
+    /// relative to the window otherwise.
+    ///
+    /// \return Position of the mouse
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2i getMousePosition() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::bitset<Keyboard::KeyCount>      m_keys;          //!< State of each key
+    std::bitset<Keyboard::ScancodeCount> m_scancodes;     //!< State of each physical key
+    std::bitset<Mouse::ButtonCount>      m_mouseButtons;  //!< State of each mouse button
+    Vector2i                             m_mousePosition; //!< Position of the mouse
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InputSnapshot
+/// \ingroup window
+///
+/// The functions of sf::Keyboard and sf::Mouse query the system
+/// every time they are called, which is slow on some platforms:
+/// with X11, each call waits for an answer from the X server,
+/// which may be far away on a remote or nested display. Code
+/// checking dozens of keys each frame should rather read them
+/// from a snapshot, which answers from memory.
+///
+/// A snapshot is filled either by capture, which reads the whole
+/// state at once, or by giving it the events of the window with
+/// update. Both can be combined: capture once when the window
+/// gains the focus, and update with each event afterwards.
+///
+/// Usage example:
+/// \code
+/// sf::InputSnapshot input;
+///
+/// while (window.isOpen())
+/// {
+///     while (const std::optional event = window.pollEvent())
+///         input.update(*event);
+///
+///     if (input.isKeyPressed(sf::Keyboard::Key::Left))
+///         moveLeft();
+///     if (input.isMouseButtonPressed(sf::Mouse::Button::Left))
+///         fire(input.getMousePosition());
+/// }
+/// \endcode
+///
+/// \see sf::Keyboard, sf::Mouse
+///
+////////////////////////////////////////////////////////////
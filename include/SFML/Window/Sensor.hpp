@@ -29,8 +29,11 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Export.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <vector>
+
 ////////////////////////////////////////////////////////////
 /// \brief Give access to the real-time state of the sensors
 ///
@@ -54,6 +57,16 @@ enum class Type
 // NOLINTNEXTLINE(readability-identifier-naming)
 static constexpr unsigned int Count{6}; //!< The total number of sensor types
 
+////////////////////////////////////////////////////////////
+/// \brief Value of a sensor measured at a given time
+///
+////////////////////////////////////////////////////////////
+struct Sample
+{
+    Vector3f value;     //!< Value of the sensor, in the unit of its type
+    Time     timestamp; //!< Time of the measure, since the device was booted
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief Check if a sensor is available on the underlying platform
 ///
@@ -88,6 +101,59 @@ SFML_WINDOW_API void setEnabled(Type sensor, bool enabled);
 ///
 ////////////////////////////////////////////////////////////
 SFML_WINDOW_API Vector3f getValue(Type sensor);
+
+////////////////////////////////////////////////////////////
+/// \brief Enable or disable the batching of the samples of a sensor
+///
+/// getValue only returns the latest value of a sensor, so
+/// reading it once per frame drops most of the samples of a
+/// sensor running at several hundreds of hertz. When batching
+/// is enabled, every sample is kept with its timestamp, and
+/// read with getSamples.
+///
+/// Sensors which have a hardware FIFO (Android, API level 26)
+/// store their samples there for up to \a maxReportLatency,
+/// so that the CPU is woken up once per batch instead of once
+/// per sample. On iOS, the samples are delivered to a
+/// background queue and \a maxReportLatency is ignored.
+///
+/// Batching is disabled by default, and doesn't enable the
+/// sensor: setEnabled must still be called. The samples are
+/// kept until they are read, so getSamples should be called
+/// regularly, typically once per frame.
+///
+/// \param sensor           Sensor to modify
+/// \param enabled          True to keep every sample, false to only keep the latest value
+/// \param samplingPeriod   Time between two samples, zero to use the fastest rate of the sensor
+/// \param maxReportLatency Maximum time the samples can be held back before being reported
+///
+/// \return True if batching was changed, false if it is not supported for this sensor
+///
+/// \see getSamples
+///
+////////////////////////////////////////////////////////////
+SFML_WINDOW_API bool setBatchingEnabled(Type sensor,
+                                        bool enabled,
+                                        Time samplingPeriod   = Time::Zero,
+                                        Time maxReportLatency = milliseconds(100));
+
+////////////////////////////////////////////////////////////
+/// \brief Read the samples of a sensor measured since the previous call
+///
+/// The returned samples are sorted from the oldest to the
+/// newest. They are not copied: the reference stays valid
+/// until the next call to this function for the same sensor,
+/// and the storage of the samples is reused from one call to
+/// the next.
+///
+/// \param sensor Sensor to read
+///
+/// \return Samples measured since the previous call, empty if batching is disabled
+///
+/// \see setBatchingEnabled
+///
+////////////////////////////////////////////////////////////
+SFML_WINDOW_API const std::vector<Sample>& getSamples(Type sensor);
 } // namespace sf::Sensor
 
 
@@ -136,4 +202,15 @@ SFML_WINDOW_API Vector3f getValue(Type sensor);
 /// sf::Vector3f gravity = sf::Sensor::getValue(sf::Sensor::Type::Gravity);
 /// \endcode
 ///
+/// Gesture recognition needs every sample of a sensor rather
+/// than its latest value: enable batching, and read the
+/// samples accumulated since the previous frame.
+/// \code
+/// sf::Sensor::setBatchingEnabled(sf::Sensor::Type::Accelerometer, true, sf::milliseconds(5));
+/// sf::Sensor::setEnabled(sf::Sensor::Type::Accelerometer, true);
+/// ...
+/// for (const sf::Sensor::Sample& sample : sf::Sensor::getSamples(sf::Sensor::Type::Accelerometer))
+///     recognizer.addSample(sample.timestamp, sample.value);
+/// \endcode
+///
 ////////////////////////////////////////////////////////////
@@ -31,11 +31,14 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <string>
 #include <vector>
 
 
 namespace sf
 {
+struct Monitor;
+
 ////////////////////////////////////////////////////////////
 /// \brief VideoMode defines a video mode (width, height, bpp)
 ///
@@ -63,8 +66,12 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Get the current desktop video mode
     ///
+    /// The desktop mode is the one of the primary monitor.
+    ///
     /// \return Current desktop video mode
     ///
+    /// \see getMonitors
+    ///
     ////////////////////////////////////////////////////////////
     static VideoMode getDesktopMode();
 
@@ -84,6 +91,19 @@ public:
     ////////////////////////////////////////////////////////////
     static const std::vector<VideoMode>& getFullscreenModes();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the monitors connected to the desktop
+    ///
+    /// The primary monitor comes first. The returned array is
+    /// updated in place when the configuration of the monitors
+    /// changes, so its content must be read again after a
+    /// sf::Event::MonitorsChanged event.
+    ///
+    /// \return Array containing the connected monitors
+    ///
+    ////////////////////////////////////////////////////////////
+    static const std::vector<Monitor>& getMonitors();
+
     ////////////////////////////////////////////////////////////
     /// \brief Tell whether or not the video mode is valid
     ///
@@ -103,6 +123,19 @@ public:
     unsigned int bitsPerPixel{}; //!< Video mode pixel depth, in bits per pixels
 };
 
+////////////////////////////////////////////////////////////
+/// \brief Monitor connected to the desktop
+///
+////////////////////////////////////////////////////////////
+struct Monitor
+{
+    std::string name;          //!< Name given to the monitor by the system
+    Vector2i    position;      //!< Position of the top-left corner of the monitor on the desktop
+    VideoMode   mode;          //!< Current video mode of the monitor
+    float       refreshRate{}; //!< Refresh rate of the current video mode in Hz, 0 if unknown
+    bool        primary{};     //!< Is it the primary monitor?
+};
+
 ////////////////////////////////////////////////////////////
 /// \relates VideoMode
 /// \brief Overload of == operator to compare two video modes
@@ -202,7 +235,16 @@ SFML_WINDOW_API bool operator>=(const VideoMode& left, const VideoMode& right);
 /// Additionally, sf::VideoMode provides a static function
 /// to get the mode currently used by the desktop: getDesktopMode().
 /// This allows to build windows with the same size or pixel
-/// depth as the current resolution.
+/// depth as the current resolution. The monitors of the
+/// desktop, with their position and refresh rate, are given
+/// by getMonitors().
+///
+/// The results of these functions are cached, querying the
+/// system can be slow. On Windows, macOS, X11 and Wayland,
+/// the cache is refreshed when the configuration of the
+/// monitors changes, which is reported to the windows by a
+/// sf::Event::MonitorsChanged event; on the other systems,
+/// the desktop mode and the monitors are queried every time.
 ///
 /// Usage example:
 /// \code
@@ -32,19 +32,30 @@
 #include <vector>
 
 
-using VkInstance = struct VkInstance_T*;
+using VkInstance       = struct VkInstance_T*;
+using VkPhysicalDevice = struct VkPhysicalDevice_T*;
+using VkDevice         = struct VkDevice_T*;
+using VkQueue          = struct VkQueue_T*;
 
 #if defined(__LP64__) || defined(_WIN64) || (defined(__x86_64__) && !defined(__ILP32__)) || defined(_M_X64) || \
     defined(__ia64) || defined(_M_IA64) || defined(__aarch64__) || defined(__powerpc64__)
 
-using VkSurfaceKHR = struct VkSurfaceKHR_T*;
+using VkSurfaceKHR   = struct VkSurfaceKHR_T*;
+using VkSwapchainKHR = struct VkSwapchainKHR_T*;
+using VkImage        = struct VkImage_T*;
+using VkImageView    = struct VkImageView_T*;
+using VkSemaphore    = struct VkSemaphore_T*;
 
 #else
 
 #include <cstdint>
 
 
-using VkSurfaceKHR = std::uint64_t;
+using VkSurfaceKHR   = std::uint64_t;
+using VkSwapchainKHR = std::uint64_t;
+using VkImage        = std::uint64_t;
+using VkImageView    = std::uint64_t;
+using VkSemaphore    = std::uint64_t;
 
 #endif
 
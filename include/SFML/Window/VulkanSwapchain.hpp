@@ -0,0 +1,375 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Export.hpp>
+
+#include <SFML/Window/Vulkan.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Vulkan swapchain presenting to a window surface
+///
+////////////////////////////////////////////////////////////
+class SFML_WINDOW_API VulkanSwapchain
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Way presented images are synchronized with the display
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class PresentMode
+    {
+        Fifo,        //!< Wait for the vertical blank, always supported (VK_PRESENT_MODE_FIFO_KHR)
+        FifoRelaxed, //!< Wait for the vertical blank unless the frame is late (VK_PRESENT_MODE_FIFO_RELAXED_KHR)
+        Mailbox,     //!< Display the latest image at the vertical blank, without blocking (VK_PRESENT_MODE_MAILBOX_KHR)
+        Immediate    //!< Display images right away, may tear (VK_PRESENT_MODE_IMMEDIATE_KHR)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Parameters of the swapchain
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Settings
+    {
+        PresentMode                presentMode{PresentMode::Fifo}; //!< Requested present mode, Fifo if unsupported
+        bool                       sRgb{};                         //!< Prefer a sRGB image format?
+        std::uint32_t              minImageCount{};                //!< Minimum number of images, 0 for the default
+        std::vector<std::uint32_t> queueFamilies;                  //!< Families of the queues using the images
+        bool                       presentWait{};                  //!< Use VK_KHR_present_id and VK_KHR_present_wait?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Construct an empty swapchain, call create to use it.
+    ///
+    ////////////////////////////////////////////////////////////
+    VulkanSwapchain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// \see destroy
+    ///
+    ////////////////////////////////////////////////////////////
+    ~VulkanSwapchain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    VulkanSwapchain(const VulkanSwapchain&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    VulkanSwapchain& operator=(const VulkanSwapchain&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the swapchain
+    ///
+    /// The surface is typically created with
+    /// sf::WindowBase::createVulkanSurface. The device must
+    /// have been created with the VK_KHR_swapchain extension,
+    /// and, if \a settings.presentWait is true, with the
+    /// VK_KHR_present_id and VK_KHR_present_wait extensions
+    /// and their features enabled. If \a settings.queueFamilies
+    /// holds several families, the images are shared by their
+    /// queues concurrently.
+    ///
+    /// The image format is chosen among those supported by the
+    /// surface, 8-bit BGRA or RGBA, sRGB or not according to
+    /// \a settings.sRgb.
+    ///
+    /// \param physicalDevice Physical device the device was created from
+    /// \param device         Device owning the swapchain
+    /// \param surface        Surface to present to
+    /// \param size           Size of the images, usually the size of the window
+    /// \param settings       Parameters of the swapchain
+    ///
+    /// \return True if the swapchain was created
+    ///
+    /// \see recreate, destroy
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(VkPhysicalDevice physicalDevice,
+                              VkDevice         device,
+                              VkSurfaceKHR     surface,
+                              const Vector2u&  size,
+                              const Settings&  settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the swapchain with the default settings
+    ///
+    /// \param physicalDevice Physical device the device was created from
+    /// \param device         Device owning the swapchain
+    /// \param surface        Surface to present to
+    /// \param size           Size of the images, usually the size of the window
+    ///
+    /// \return True if the swapchain was created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(VkPhysicalDevice physicalDevice,
+                              VkDevice         device,
+                              VkSurfaceKHR     surface,
+                              const Vector2u&  size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recreate the swapchain with a new size
+    ///
+    /// This must be called when the window is resized, or when
+    /// isOutOfDate returns true. The device isn't waited for:
+    /// the images of the previous swapchain may still be in
+    /// flight, so it is only destroyed after the new one has
+    /// presented as many times as it has images.
+    ///
+    /// The swapchain can't be created while the window is
+    /// minimized; this function then returns false and can be
+    /// called again later.
+    ///
+    /// \param size New size of the images
+    ///
+    /// \return True if the swapchain was recreated
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool recreate(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the swapchain
+    ///
+    /// The images and image views of the swapchain must not be
+    /// in use anymore, for example after vkDeviceWaitIdle.
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroy();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Acquire the next image to render to
+    ///
+    /// \param semaphore Semaphore signaled when the image can be rendered to
+    ///
+    /// \return Index of the image, or `std::nullopt` if the swapchain must be recreated or acquisition failed
+    ///
+    /// \see present, isOutOfDate
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::uint32_t> acquireNextImage(VkSemaphore semaphore);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Present an acquired image
+    ///
+    /// If present wait is enabled, the presentation is given
+    /// the identifier returned by getLastPresentId.
+    ///
+    /// \param queue      Queue to present from
+    /// \param imageIndex Index of the image, as returned by acquireNextImage
+    /// \param semaphore  Semaphore to wait for before presenting, signaled by the rendering of the image
+    ///
+    /// \return True if the image was queued for presentation
+    ///
+    /// \see acquireNextImage, waitForPresent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool present(VkQueue queue, std::uint32_t imageIndex, VkSemaphore semaphore);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a presented image is displayed
+    ///
+    /// Waiting for the previous frame to be displayed before
+    /// starting the next one keeps the latency between input
+    /// and display to a minimum. This requires present wait,
+    /// see isPresentWaitEnabled. Presentations made before the
+    /// last call to recreate are considered displayed.
+    ///
+    /// \param presentId Identifier of the presentation, as returned by getLastPresentId
+    /// \param timeout   Maximum time to wait
+    ///
+    /// \return True if the image was displayed before the timeout
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool waitForPresent(std::uint64_t presentId, Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of the last presentation
+    ///
+    /// Identifiers increase by 1 with each successful call to
+    /// present, starting at 1.
+    ///
+    /// \return Identifier of the last presentation, 0 if nothing was presented
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getLastPresentId() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether present wait is used
+    ///
+    /// \return True if presentations have identifiers that can be waited for
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPresentWaitEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the swapchain no longer matches its surface
+    ///
+    /// \return True if recreate must be called
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isOutOfDate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying Vulkan swapchain
+    ///
+    /// \return Swapchain handle, null if the swapchain isn't created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] VkSwapchainKHR getHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the images
+    ///
+    /// \return VkFormat of the images
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the images
+    ///
+    /// It may differ from the size given to create or recreate
+    /// if the surface imposes its own size.
+    ///
+    /// \return Size of the images, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the present mode actually used
+    ///
+    /// \return Present mode
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] PresentMode getPresentMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the images of the swapchain
+    ///
+    /// \return Images, indexed by the value returned by acquireNextImage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<VkImage>& getImages() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a 2D color view of each image of the swapchain
+    ///
+    /// \return Image views, indexed by the value returned by acquireNextImage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<VkImageView>& getImageViews() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::VulkanSwapchain
+/// \ingroup window
+///
+/// sf::VulkanSwapchain takes care of the swapchain of a
+/// Vulkan application rendering to a SFML window: choosing
+/// an image format and present mode supported by the surface,
+/// creating the images and their views, and recreating them
+/// when the window is resized. The application keeps full
+/// control over the instance, the device, the queues and the
+/// synchronization.
+///
+/// The present modes with the lowest latency, Mailbox and
+/// Immediate, are used when the surface supports them, with
+/// Fifo as the fallback. When the device supports the
+/// VK_KHR_present_wait extension, each presentation gets an
+/// identifier, and waitForPresent lets the application wait
+/// until a frame is actually displayed before starting the
+/// next one, to pace frames without queuing them.
+///
+/// Usage example:
+/// \code
+/// VkSurfaceKHR surface{};
+/// if (!window.createVulkanSurface(instance, surface))
+///     return -1;
+///
+/// sf::VulkanSwapchain::Settings settings;
+/// settings.presentMode = sf::VulkanSwapchain::PresentMode::Mailbox;
+///
+/// sf::VulkanSwapchain swapchain;
+/// if (!swapchain.create(physicalDevice, device, surface, window.getSize(), settings))
+///     return -1;
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     if (swapchain.isOutOfDate() || (swapchain.getSize() != window.getSize()))
+///         (void)swapchain.recreate(window.getSize());
+///
+///     const auto image = swapchain.acquireNextImage(imageAvailable);
+///     if (!image)
+///         continue;
+///
+///     // Render to swapchain.getImageViews()[*image], signaling renderFinished
+///     ...
+///
+///     (void)swapchain.present(queue, *image, renderFinished);
+/// }
+///
+/// vkDeviceWaitIdle(device);
+/// swapchain.destroy();
+/// \endcode
+///
+/// \see sf::Vulkan, sf::WindowBase::createVulkanSurface
+///
+////////////////////////////////////////////////////////////
@@ -33,10 +33,12 @@
 #include <SFML/Window/WindowEnums.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 
-#include <SFML/System/Clock.hpp>
+#include <SFML/System/FastClock.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <cstdint>
 
@@ -55,6 +57,40 @@ class GlContext;
 class SFML_WINDOW_API Window : public WindowBase, GlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Durations of the frames displayed by the window
+    ///
+    /// The duration of a frame is the time elapsed between two
+    /// consecutive calls to display(), including the time spent
+    /// waiting to honor the framerate limit.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct FrameStatistics
+    {
+        std::uint64_t frameCount{};      //!< Number of frames measured
+        Time          lastFrameTime;     //!< Duration of the last frame
+        Time          averageFrameTime;  //!< Average duration of the measured frames
+        Time          minFrameTime;      //!< Duration of the shortest measured frame
+        Time          maxFrameTime;      //!< Duration of the longest measured frame
+        std::uint64_t missedDeadlines{}; //!< Number of frames that ended after the deadline set by the framerate limit
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Timing of the presentation of the frames on the monitor
+    ///
+    /// The time of the last vertical blank is measured by the
+    /// unadjusted system clock of the driver: it can be compared
+    /// with other present timings, not with sf::Clock.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PresentTiming
+    {
+        Time          lastVerticalBlank;    //!< Time of the last vertical blank, measured by the system clock
+        std::uint64_t verticalBlankCount{}; //!< Number of vertical blanks since an arbitrary point in the past
+        std::uint64_t swapCount{};          //!< Number of buffer swaps completed for the window
+        float         refreshRate{};        //!< Refresh rate of the monitor, in Hz (0 if unknown)
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -238,6 +274,123 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when displaying a frame
+    ///
+    /// An interval of 0 disables vertical synchronization and
+    /// 1 enables it, like setVerticalSyncEnabled(). Higher
+    /// intervals divide the refresh rate of the monitor.
+    ///
+    /// A negative interval enables adaptive vertical
+    /// synchronization: frames that are ready in time wait for
+    /// the vertical blank, frames that are late are displayed
+    /// immediately, which trades a tear line for a lower
+    /// latency instead of waiting a whole refresh period.
+    /// Adaptive synchronization requires the GLX or WGL
+    /// EXT_swap_control_tear extension.
+    ///
+    /// \param interval Number of vertical blanks to wait for, negative for adaptive synchronization
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    /// \see setVerticalSyncEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pace the displayed frames to a target frame rate
+    ///
+    /// The frame rate is matched to the refresh rate of the
+    /// monitor by setting the swap interval closest to their
+    /// ratio: 30 FPS waits for 4 vertical blanks on a 120 Hz
+    /// monitor and 2 on a 60 Hz monitor. Contrary to
+    /// setFramerateLimit, each frame stays on screen for a whole
+    /// number of refreshes, which avoids judder.
+    ///
+    /// On Android, the system is also asked to switch the
+    /// display to a refresh rate compatible with the frame rate
+    /// (API level 30), and the frames are scheduled on the
+    /// vertical blanks reported by AChoreographer with
+    /// EGL_ANDROID_presentation_time. A frame that misses its
+    /// vertical blank then delays the next ones by one refresh
+    /// instead of making them alternate between two durations,
+    /// and frames aren't rendered faster than they can be shown.
+    ///
+    /// On iOS and macOS 14, the rate is requested from a display
+    /// link, which lets ProMotion screens refresh at that rate.
+    ///
+    /// On the other systems, the refresh rate must be reported
+    /// by getPresentTiming.
+    ///
+    /// \param frameRate Target number of frames per second, 0 to display a frame at each vertical blank
+    ///
+    /// \return True if the frames are paced, false if it is not supported
+    ///
+    /// \see setSwapInterval, getPresentTiming
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTargetFrameRate(unsigned int frameRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until shortly before the next vertical blank
+    ///
+    /// With vertical synchronization, a frame rendered right
+    /// after the previous one was displayed waits for almost a
+    /// whole refresh period, with its input already outdated.
+    /// Calling this function before polling events and rendering
+    /// moves that wait before input sampling: it blocks until
+    /// \a delay before the next vertical blank, leaving just that
+    /// time to process the input and render the frame.
+    ///
+    /// \code
+    /// window.setVerticalSyncEnabled(true);
+    /// while (window.isOpen())
+    /// {
+    ///     (void)window.delayBeforeSwap(sf::milliseconds(4));
+    ///     while (const auto event = window.pollEvent())
+    ///         ...
+    ///     render();
+    ///     window.display();
+    /// }
+    /// \endcode
+    ///
+    /// This function requires the GLX or WGL NV_delay_before_swap
+    /// extension; on iOS and macOS, the vertical blanks are
+    /// reported by a display link. If it is not supported, it
+    /// returns immediately.
+    ///
+    /// \param delay Time to leave before the vertical blank
+    ///
+    /// \return True if the function waited, false if it is not supported
+    ///
+    /// \see getPresentTiming
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool delayBeforeSwap(Time delay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames on the monitor
+    ///
+    /// This allows to measure when frames are actually
+    /// displayed, for example to estimate the latency between
+    /// input and display or to schedule rendering relatively
+    /// to the vertical blanks.
+    ///
+    /// This function requires the GLX or WGL OML_sync_control
+    /// extension. On Android, the time at which the last frame
+    /// was displayed is reported if EGL_ANDROID_get_frame_timestamps
+    /// is supported, otherwise the time of the last vertical blank
+    /// reported by AChoreographer (API level 29). On iOS and
+    /// macOS, the vertical blanks are reported by a display link.
+    ///
+    /// \return Present timing, or an empty optional if it is not supported
+    ///
+    /// \see delayBeforeSwap
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<PresentTiming> getPresentTiming() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Limit the framerate to a maximum fixed frequency
     ///
@@ -248,13 +401,92 @@ public:
     /// but since it internally uses sf::sleep, whose precision
     /// depends on the underlying OS, the results may be a little
     /// imprecise as well (for example, you can get 65 FPS when
-    /// requesting 60).
+    /// requesting 60). Enable precise frame pacing to get rid of
+    /// this imprecision.
+    ///
+    /// The end of each frame is scheduled one frame duration
+    /// after the end of the previous one was scheduled, so that
+    /// a frame that ends a bit late is compensated by the next
+    /// one and errors don't accumulate. After a frame that took
+    /// much longer than the limit, the schedule starts over.
     ///
     /// \param limit Framerate limit, in frames per seconds (use 0 to disable limit)
     ///
+    /// \see setFrameTimeLimit, setPreciseFramePacingEnabled
+    ///
     ////////////////////////////////////////////////////////////
     void setFramerateLimit(unsigned int limit);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Limit the framerate to a minimum frame duration
+    ///
+    /// This function works like setFramerateLimit, but takes the
+    /// duration of a frame instead of a number of frames per
+    /// second, which lets the limit match exactly the step of a
+    /// fixed-step simulation (see sf::FixedStepLoop).
+    ///
+    /// \param limit Minimum duration of a frame (use Time::Zero to disable limit)
+    ///
+    /// \see setFramerateLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrameTimeLimit(Time limit);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable precise frame pacing
+    ///
+    /// The sleep functions of operating systems usually wake
+    /// threads up late, by up to a few milliseconds, which
+    /// makes frames displayed with a framerate limit last
+    /// irregularly. With precise frame pacing, the window only
+    /// sleeps for the largest part of the delay and then yields
+    /// the processor in a loop until the exact end of the frame.
+    /// The part which is not slept adapts to how late the system
+    /// wakes up threads (see sf::sleepPrecise).
+    ///
+    /// Precise frame pacing keeps a processor core busy for a
+    /// fraction of a millisecond to a few milliseconds every frame.
+    /// It has no effect when no framerate limit is set.
+    ///
+    /// Precise frame pacing is disabled by default.
+    ///
+    /// \param enabled True to enable precise frame pacing, false to disable it
+    ///
+    /// \see setFramerateLimit, isPreciseFramePacingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPreciseFramePacingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether precise frame pacing is enabled
+    ///
+    /// \return True if precise frame pacing is enabled, false otherwise
+    ///
+    /// \see setPreciseFramePacingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPreciseFramePacingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the durations of the frames displayed since the last reset
+    ///
+    /// \return Statistics of the frame durations
+    ///
+    /// \see resetFrameStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FrameStatistics& getFrameStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the frame statistics
+    ///
+    /// The next measured frame starts when this function is called.
+    ///
+    /// \see getFrameStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetFrameStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the window as the current target
     ///        for OpenGL rendering
@@ -273,6 +505,47 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setActive(bool active = true) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark a region of the window as modified in the current frame
+    ///
+    /// If regions are marked before display() is called, only
+    /// these regions are sent to the window system, which saves
+    /// memory bandwidth in the compositor (and battery). The rest
+    /// of the window is assumed to be unchanged since the previous
+    /// frame. The regions are forgotten once the frame is displayed;
+    /// if no region is marked, the whole window is displayed.
+    ///
+    /// Damage is supported by EGL contexts with the
+    /// EGL_KHR_swap_buffers_with_damage extension; other contexts
+    /// display the whole window.
+    ///
+    /// \param position Position of the top-left corner of the region, in pixels
+    /// \param size     Size of the region, in pixels
+    ///
+    /// \see getBufferAge
+    ///
+    ////////////////////////////////////////////////////////////
+    void addDamage(Vector2i position, Vector2i size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the age of the back buffer
+    ///
+    /// The back buffer which is being rendered to contains the
+    /// frame displayed this number of frames ago. To render only
+    /// the regions that changed, an application has to redraw the
+    /// regions damaged in all the frames displayed since then.
+    /// A value of 0 means that the content of the back buffer is
+    /// unknown, and that the whole window has to be redrawn.
+    ///
+    /// This function requires the EGL_EXT_buffer_age extension.
+    ///
+    /// \return Age of the back buffer, in frames, or 0 if it is unknown
+    ///
+    /// \see addDamage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBufferAge() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Display on screen what has been rendered to the window so far
     ///
@@ -280,9 +553,22 @@ public:
     /// has been done for the current frame, in order to show
     /// it on screen.
     ///
+    /// \see addDamage
+    ///
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function is called so that derived classes can
+    /// complete the rendering of the frame, whichever class
+    /// display() is called through.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Perform some common internal initializations
@@ -290,12 +576,30 @@ private:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the deadline of the current frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForFrameDeadline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the frame that just ended to the statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateFrameStatistics();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::unique_ptr<priv::GlContext> m_context;        //!< Platform-specific implementation of the OpenGL context
-    Clock                            m_clock;          //!< Clock for measuring the elapsed time between frames
-    Time                             m_frameTimeLimit; //!< Current framerate limit
+    std::unique_ptr<priv::GlContext> m_context;         //!< Platform-specific implementation of the OpenGL context
+    FastClock::time_point            m_start;           //!< Time at which the window was initialized
+    Time                             m_frameTimeLimit;  //!< Current framerate limit
+    Time                             m_frameDeadline;   //!< Time at which the current frame should end
+    Time                             m_lastFrameEnd;    //!< Time at which the last measured frame ended
+    Time                             m_totalFrameTime;  //!< Sum of the durations of the measured frames
+    FrameStatistics                  m_frameStatistics; //!< Statistics of the frame durations
+    bool                             m_precisePacing{}; //!< Is precise frame pacing enabled?
+    std::vector<int>                 m_damage;          //!< Damaged rectangles of the current frame in OpenGL coordinates
 };
 
 } // namespace sf
@@ -33,11 +33,15 @@
 #include <SFML/Window/WindowEnums.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Utf8View.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <memory>
 #include <optional>
+#include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -61,6 +65,47 @@ class Event;
 class SFML_WINDOW_API WindowBase
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Raw movement of the mouse reported by the system
+    ///
+    ////////////////////////////////////////////////////////////
+    struct RawMouseSample
+    {
+        Vector2i delta;     //!< Raw movement of the mouse, see sf::Event::MouseMovedRaw
+        Time     timestamp; //!< Time of the movement, with the same origin as sf::Event::getTimestamp
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Raw mouse movements accumulated between two reads
+    ///
+    ////////////////////////////////////////////////////////////
+    struct RawMouseInput
+    {
+        Vector2i                    delta;   //!< Sum of the movements of all the samples
+        std::vector<RawMouseSample> samples; //!< Individual movements, oldest first
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Position of a finger reported by the system
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TouchSample
+    {
+        unsigned int finger{};  //!< Index of the finger, see sf::Event::TouchMoved
+        Vector2i     position;  //!< Position of the touch, relative to the top left of the window
+        Time         timestamp; //!< Time of the sample (or prediction), with the same origin as sf::Event::getTimestamp
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Touch movements accumulated between two reads
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TouchInput
+    {
+        std::vector<TouchSample> samples;   //!< Movements of all the fingers, oldest first
+        std::vector<TouchSample> predicted; //!< Movements predicted after the last samples of each finger
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -221,6 +266,217 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Event waitEvent();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop several events from the front of the FIFO event queue
+    ///
+    /// This function is not blocking: it fills \a events with up to
+    /// \a maxCount pending events, oldest first, and returns how
+    /// many were written. It is equivalent to calling pollEvent()
+    /// \a maxCount times, but drains the queue in a single call.
+    /// \code
+    /// std::array<sf::Event, 64> events;
+    /// const std::size_t count = window.pollEvents(events.data(), events.size());
+    /// for (std::size_t i = 0; i < count; ++i)
+    /// {
+    ///    // process events[i]...
+    /// }
+    /// \endcode
+    ///
+    /// \param events   Array of at least \a maxCount events to fill
+    /// \param maxCount Maximum number of events to pop
+    ///
+    /// \return Number of events written to \a events; 0 if no events are pending
+    ///
+    /// \see pollEvent, handleEvents
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t pollEvents(Event* events, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a handler for every pending event
+    ///
+    /// This function is not blocking: it pops all the pending
+    /// events in batches and calls \a handler with each of them,
+    /// in order. The handler is called as `handler(event)`, with
+    /// a `const sf::Event&`.
+    /// \code
+    /// window.handleEvents([&](const sf::Event& event)
+    /// {
+    ///     if (event.is<sf::Event::Closed>())
+    ///         window.close();
+    /// });
+    /// \endcode
+    ///
+    /// \param handler Callable invoked with every pending event
+    ///
+    /// \see pollEvents
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Handler>
+    void handleEvents(Handler&& handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the processing of system events on a dedicated thread
+    ///
+    /// By default, system events are only read from the operating
+    /// system when pollEvent(), pollEvents() or waitEvent() is
+    /// called, so a long frame delays their processing. When the
+    /// event thread is enabled, SFML reads them continuously on a
+    /// background thread and queues them until they are polled.
+    /// The way events are polled doesn't change.
+    ///
+    /// Joystick and sensor events are still polled by the thread
+    /// calling pollEvent(). Most windowing systems (X11, Win32,
+    /// macOS) require the events of a window to be processed by
+    /// the thread which created it: only the DRM backend
+    /// supports the event thread for now.
+    ///
+    /// \param enabled True to process the events on a dedicated thread
+    ///
+    /// \return True if the event thread is in the requested state, false if not supported
+    ///
+    /// \see isEventThreadEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setEventThreadEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether system events are processed on a dedicated thread
+    ///
+    /// \return True if the event thread is enabled
+    ///
+    /// \see setEventThreadEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEventThreadEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the batching of raw mouse movements
+    ///
+    /// High-frequency mice report up to several thousands of raw
+    /// movements per second, each one producing a separate
+    /// sf::Event::MouseMovedRaw event. When batching is enabled,
+    /// these events are not produced anymore: the movements are
+    /// accumulated instead, and read once per frame with
+    /// getRawMouseInput().
+    ///
+    /// Batching is disabled by default.
+    ///
+    /// \param enabled True to accumulate the raw mouse movements
+    ///
+    /// \see getRawMouseInput
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRawMouseBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether raw mouse movements are batched
+    ///
+    /// \return True if raw mouse batching is enabled
+    ///
+    /// \see setRawMouseBatchingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isRawMouseBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the raw mouse movements accumulated since the previous call
+    ///
+    /// Raw movements are gathered while system events are
+    /// processed, so this function is meant to be called after
+    /// polling the events of the frame. The returned batch holds
+    /// both the total movement and every individual sample with
+    /// its timestamp. It is not copied: the reference stays valid
+    /// until the next call to this function, and the storage of
+    /// the samples is reused from one call to the next.
+    /// \code
+    /// window.setRawMouseBatchingEnabled(true);
+    /// ...
+    /// while (const auto event = window.pollEvent())
+    ///     ...
+    /// const sf::WindowBase::RawMouseInput& rawInput = window.getRawMouseInput();
+    /// camera.rotate(rawInput.delta);
+    /// \endcode
+    ///
+    /// \return Raw movements accumulated since the previous call, empty if batching is disabled
+    ///
+    /// \see setRawMouseBatchingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const RawMouseInput& getRawMouseInput();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the coalescing of touch movements
+    ///
+    /// Touchscreens sample the fingers faster than the display
+    /// refreshes, up to 240 Hz. The system only reports some of
+    /// these samples as sf::Event::TouchMoved events, so that
+    /// strokes drawn from them are less precise, while delivering
+    /// all of them as events would flood the event queue. When
+    /// coalescing is enabled, touch movements don't produce
+    /// sf::Event::TouchMoved events anymore: every sample is
+    /// accumulated instead, and read once per frame with
+    /// getTouchInput(). sf::Event::TouchBegan and
+    /// sf::Event::TouchEnded events are still produced.
+    ///
+    /// The intermediate samples are provided by iOS (coalesced
+    /// touches) and Android (historical samples of the motion
+    /// events). On iOS, the positions that the system predicts
+    /// for the next frame are provided too.
+    ///
+    /// Coalescing is disabled by default.
+    ///
+    /// \param enabled True to accumulate the touch movements
+    ///
+    /// \see getTouchInput
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTouchCoalescingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether touch movements are coalesced
+    ///
+    /// \return True if touch coalescing is enabled
+    ///
+    /// \see setTouchCoalescingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isTouchCoalescingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the touch movements accumulated since the previous call
+    ///
+    /// Touch movements are gathered while system events are
+    /// processed, so this function is meant to be called after
+    /// polling the events of the frame. The returned batch holds
+    /// every sample of every finger, with its timestamp, and the
+    /// movements predicted by the system after the last sample
+    /// of each finger. A drawing application lowers its perceived
+    /// latency by drawing the predicted part of a stroke, and
+    /// replacing it with the actual samples on the next frame.
+    /// \code
+    /// window.setTouchCoalescingEnabled(true);
+    /// ...
+    /// while (const auto event = window.pollEvent())
+    ///     ...
+    /// const sf::WindowBase::TouchInput& touchInput = window.getTouchInput();
+    /// for (const sf::WindowBase::TouchSample& sample : touchInput.samples)
+    ///     strokes[sample.finger].append(sample.position);
+    /// for (const sf::WindowBase::TouchSample& sample : touchInput.predicted)
+    ///     predictedStrokes[sample.finger].append(sample.position);
+    /// \endcode
+    ///
+    /// The batch is not copied: the reference stays valid until
+    /// the next call to this function, and the storage of the
+    /// samples is reused from one call to the next.
+    ///
+    /// \return Touch movements accumulated since the previous call, empty if coalescing is disabled
+    ///
+    /// \see setTouchCoalescingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const TouchInput& getTouchInput();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the position of the window
     ///
@@ -298,6 +554,16 @@ public:
     ////////////////////////////////////////////////////////////
     void setTitle(const String& title);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the title of the window from UTF-8 encoded characters
+    ///
+    /// \param title New title, encoded in UTF-8
+    ///
+    /// \see setIcon
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTitle(Utf8View title);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the window's icon
     ///
@@ -533,6 +799,8 @@ private:
 
 } // namespace sf
 
+#include <SFML/Window/WindowBase.inl>
+
 
 ////////////////////////////////////////////////////////////
 /// \class sf::WindowBase
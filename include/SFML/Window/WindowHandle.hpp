@@ -44,7 +44,7 @@ using WindowHandle = HWND__*;
 #elif defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD) || defined(SFML_SYSTEM_OPENBSD) || \
     defined(SFML_SYSTEM_NETBSD)
 
-// Window handle is Window (unsigned long) on Unix - X11
+// Window handle is Window (unsigned long) on Unix - X11, or wl_surface* disguised as unsigned long on Wayland
 using WindowHandle = unsigned long;
 
 #elif defined(SFML_SYSTEM_MACOS)
@@ -82,7 +82,7 @@ using WindowHandle = "platform-specific";
 /// Platform        | Type
 /// ----------------|------------------------------------------------------------
 /// Windows         | \p HWND
-/// Linux/FreeBSD   | \p %Window
+/// Linux/FreeBSD   | \p %Window, or \p wl_surface* disguised as \p unsigned \p long with Wayland
 /// macOS           | either \p NSWindow* or \p NSView*, disguised as \p void*
 /// iOS             | \p UIWindow*
 /// Android         | \p ANativeWindow*
@@ -96,4 +96,11 @@ using WindowHandle = "platform-specific";
 /// return the handle that was used to create the window,
 /// which is a \p NSWindow* by default.
 ///
+/// \par Wayland Specification
+///
+/// When SFML is built with SFML_USE_WAYLAND, the handle is
+/// the \p wl_surface* of the window. Wayland doesn't allow
+/// a client to take over the surface of another one, so
+/// windows can't be created from an existing handle.
+///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBus.hpp>
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <miniaudio.h>
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include <cassert>
+
+
+namespace sf
+{
+struct AudioBus::Impl
+{
+    Impl()
+    {
+        // Buses are reinitialized before the sounds, so that the sounds can connect to them again
+        resourceEntryIter = priv::AudioDevice::registerResource(
+            this,
+            [](void* ptr) { static_cast<Impl*>(ptr)->deinitialize(); },
+            [](void* ptr) { static_cast<Impl*>(ptr)->initialize(); },
+            true);
+
+        initialize();
+    }
+
+    ~Impl()
+    {
+        priv::AudioDevice::unregisterResource(resourceEntryIter);
+        deinitialize();
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    void initialize()
+    {
+        auto* engine = priv::AudioDevice::getEngine();
+
+        if (engine == nullptr)
+        {
+            err() << "Failed to initialize audio bus: No engine available" << std::endl;
+            return;
+        }
+
+        // Spatialization is done by each sound, the bus only mixes them
+        if (const ma_result result = ma_sound_group_init(engine, MA_SOUND_FLAG_NO_SPATIALIZATION, nullptr, &group);
+            result != MA_SUCCESS)
+        {
+            err() << "Failed to initialize audio bus: " << ma_result_description(result) << std::endl;
+            return;
+        }
+
+        // Initialize the custom effect node
+        effectNodeVTable.onProcess =
+            [](ma_node* node, const float** framesIn, ma_uint32* frameCountIn, float** framesOut, ma_uint32* frameCountOut)
+        {
+            const auto& self = *static_cast<EffectNode*>(node);
+            priv::MiniaudioUtils::processEffect(self.impl->effectProcessor,
+                                                self.channelCount,
+                                                framesIn,
+                                                *frameCountIn,
+                                                framesOut,
+                                                *frameCountOut);
+        };
+        effectNodeVTable.onGetRequiredInputFrameCount = nullptr;
+        effectNodeVTable.inputBusCount                = 1;
+        effectNodeVTable.outputBusCount               = 1;
+        effectNodeVTable.flags = MA_NODE_FLAG_CONTINUOUS_PROCESSING | MA_NODE_FLAG_ALLOW_NULL_INPUT;
+
+        const auto     nodeChannelCount = ma_engine_get_channels(engine);
+        ma_node_config nodeConfig       = ma_node_config_init();
+        nodeConfig.vtable               = &effectNodeVTable;
+        nodeConfig.pInputChannels       = &nodeChannelCount;
+        nodeConfig.pOutputChannels      = &nodeChannelCount;
+
+        if (const ma_result result = ma_node_init(ma_engine_get_node_graph(engine), &nodeConfig, nullptr, &effectNode);
+            result != MA_SUCCESS)
+        {
+            err() << "Failed to initialize audio bus effect node: " << ma_result_description(result) << std::endl;
+            ma_sound_group_uninit(&group);
+            return;
+        }
+
+        effectNode.impl         = this;
+        effectNode.channelCount = nodeChannelCount;
+        initialized             = true;
+
+        ma_sound_group_set_volume(&group, volume);
+        connect();
+
+        // Child buses reinitialized before this one output to the engine endpoint until now
+        for (AudioBus* child : children)
+            child->m_impl->connect();
+    }
+
+    void deinitialize()
+    {
+        if (!initialized)
+            return;
+
+        ma_sound_group_uninit(&group);
+        ma_node_uninit(&effectNode, nullptr);
+        initialized = false;
+    }
+
+    [[nodiscard]] ma_node* getOutputNode(ma_engine& engine) const
+    {
+        if (parent && parent->m_impl->initialized)
+            return &parent->m_impl->group;
+
+        return ma_engine_get_endpoint(&engine);
+    }
+
+    void connect()
+    {
+        auto* engine = priv::AudioDevice::getEngine();
+
+        if (!initialized || engine == nullptr)
+            return;
+
+        // Route the group through the effect node depending on whether an effect processor is set
+        if (effectProcessor)
+        {
+            if (const ma_result result = ma_node_attach_output_bus(&effectNode, 0, getOutputNode(*engine), 0);
+                result != MA_SUCCESS)
+            {
+                err() << "Failed to attach audio bus effect node: " << ma_result_description(result) << std::endl;
+                return;
+            }
+        }
+        else
+        {
+            ma_node_detach_output_bus(&effectNode, 0);
+        }
+
+        ma_node* const output = effectProcessor ? &effectNode : getOutputNode(*engine);
+
+        if (const ma_result result = ma_node_attach_output_bus(&group, 0, output, 0); result != MA_SUCCESS)
+        {
+            err() << "Failed to attach audio bus output: " << ma_result_description(result) << std::endl;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct EffectNode
+    {
+        ma_node_base base{};
+        Impl*        impl{};
+        ma_uint32    channelCount{};
+    };
+
+    ma_sound_group                                group{};            //!< The group mixing the sounds of the bus
+    ma_node_vtable                                effectNodeVTable{}; //!< Vtable of the effect node
+    EffectNode                                    effectNode;         //!< The node that performs effect processing
+    bool                                          initialized{};      //!< Whether the miniaudio objects exist
+    float                                         volume{1.f};        //!< Volume, restored after reinitialization
+    SoundSource::EffectProcessor                  effectProcessor;    //!< The effect processor
+    AudioBus*                                     parent{};           //!< The bus this bus outputs to
+    std::vector<AudioBus*>                        children;           //!< The buses that output to this bus
+    std::vector<priv::MiniaudioUtils::SoundBase*> sounds;             //!< The sounds that output to this bus
+    priv::AudioDevice::ResourceEntryIter resourceEntryIter; //!< Iterator to the resource entry registered with the AudioDevice
+};
+
+
+////////////////////////////////////////////////////////////
+AudioBus::AudioBus() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus::~AudioBus()
+{
+    // Reroute everything that outputs to this bus to the engine endpoint
+    while (!m_impl->sounds.empty())
+        m_impl->sounds.back()->setBus(nullptr);
+
+    while (!m_impl->children.empty())
+        m_impl->children.back()->setParent(nullptr);
+
+    setParent(nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::setVolume(float volume)
+{
+    m_impl->volume = volume * 0.01f;
+
+    if (m_impl->initialized)
+        ma_sound_group_set_volume(&m_impl->group, m_impl->volume);
+}
+
+
+////////////////////////////////////////////////////////////
+float AudioBus::getVolume() const
+{
+    return m_impl->volume * 100.f;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::setParent(AudioBus* parent)
+{
+    if (m_impl->parent == parent)
+        return;
+
+#ifdef SFML_DEBUG
+    for (const AudioBus* ancestor = parent; ancestor; ancestor = ancestor->m_impl->parent)
+        assert(ancestor != this && "AudioBus::setParent() A bus cannot output to itself");
+#endif
+
+    if (m_impl->parent)
+    {
+        auto& siblings = m_impl->parent->m_impl->children;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+
+    m_impl->parent = parent;
+
+    if (m_impl->parent)
+        m_impl->parent->m_impl->children.push_back(this);
+
+    m_impl->connect();
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus* AudioBus::getParent() const
+{
+    return m_impl->parent;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::setEffectProcessor(SoundSource::EffectProcessor effectProcessor)
+{
+    m_impl->effectProcessor = std::move(effectProcessor);
+    m_impl->connect();
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::attachSound(priv::MiniaudioUtils::SoundBase* sound)
+{
+    m_impl->sounds.push_back(sound);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::detachSound(priv::MiniaudioUtils::SoundBase* sound)
+{
+    auto& sounds = m_impl->sounds;
+    if (const auto it = std::find(sounds.begin(), sounds.end(), sound); it != sounds.end())
+    {
+        std::swap(*it, sounds.back());
+        sounds.pop_back();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void* AudioBus::getInputNode() const
+{
+    return &m_impl->group;
+}
+
+} // namespace sf
@@ -32,6 +32,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <ostream>
 #include <unordered_map>
 
@@ -53,6 +55,79 @@ std::optional<std::string>& getCurrentDevice()
     static std::optional<std::string> currentDevice;
     return currentDevice;
 }
+
+PlaybackDevice::Settings& getCurrentSettings()
+{
+    static PlaybackDevice::Settings currentSettings;
+    return currentSettings;
+}
+
+// The counters read by PlaybackDevice::getStatistics, durations are in microseconds
+struct StatisticsCounters
+{
+    std::array<std::atomic<std::uint64_t>, PlaybackDevice::Statistics::LoadBucketCount> loadHistogram{};
+
+    std::atomic<std::uint64_t>  callbackCount{};
+    std::atomic<std::uint64_t>  lateCallbackCount{};
+    std::atomic<std::int64_t>   lastCallbackDuration{};
+    std::atomic<std::int64_t>   maxCallbackDuration{};
+    std::atomic<unsigned int>   periodSizeInFrames{};
+    std::atomic<std::int64_t>   periodDuration{};
+    std::atomic<unsigned int>   activeVoiceCount{};
+    std::atomic<unsigned int>   streamingVoiceCount{};
+    std::atomic<std::ptrdiff_t> virtualVoiceCount{};
+    std::atomic<std::uint64_t>  underrunCount{};
+    std::atomic<float>          minDecodeAheadFill{1.f};
+
+    // Accumulated while mixing a period, only accessed by the audio thread
+    std::uint64_t mixIndex{};
+    unsigned int  mixedVoiceCount{};
+    unsigned int  mixedStreamCount{};
+    float         mixedMinFill{1.f};
+};
+
+StatisticsCounters& getStatisticsCounters()
+{
+    static StatisticsCounters counters;
+    return counters;
+}
+
+// Start accumulating the counters of a new period
+void beginPeriod()
+{
+    auto& counters = getStatisticsCounters();
+    ++counters.mixIndex;
+    counters.mixedVoiceCount  = 0;
+    counters.mixedStreamCount = 0;
+    counters.mixedMinFill     = 1.f;
+}
+
+// Publish the counters of the period that was just mixed
+void endPeriod(ma_uint32 frameCount, ma_uint32 sampleRate, std::chrono::steady_clock::duration elapsed)
+{
+    auto& counters = getStatisticsCounters();
+
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    const auto period   = sampleRate > 0 ? std::int64_t{frameCount} * 1'000'000 / sampleRate : std::int64_t{0};
+    const auto load     = period > 0 ? static_cast<double>(duration) / static_cast<double>(period) : 0.0;
+    const auto bucket   = std::min(static_cast<std::size_t>(load * PlaybackDevice::Statistics::LoadBucketCount),
+                                 PlaybackDevice::Statistics::LoadBucketCount - 1);
+
+    counters.loadHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    counters.callbackCount.fetch_add(1, std::memory_order_relaxed);
+    if (load >= 1.0)
+        counters.lateCallbackCount.fetch_add(1, std::memory_order_relaxed);
+
+    counters.lastCallbackDuration.store(duration, std::memory_order_relaxed);
+    if (duration > counters.maxCallbackDuration.load(std::memory_order_relaxed))
+        counters.maxCallbackDuration.store(duration, std::memory_order_relaxed);
+
+    counters.periodSizeInFrames.store(frameCount, std::memory_order_relaxed);
+    counters.periodDuration.store(period, std::memory_order_relaxed);
+    counters.activeVoiceCount.store(counters.mixedVoiceCount, std::memory_order_relaxed);
+    counters.streamingVoiceCount.store(counters.mixedStreamCount, std::memory_order_relaxed);
+    counters.minDecodeAheadFill.store(counters.mixedMinFill, std::memory_order_relaxed);
+}
 } // namespace
 
 
@@ -143,6 +218,10 @@ AudioDevice::AudioDevice()
 ////////////////////////////////////////////////////////////
 AudioDevice::~AudioDevice()
 {
+    // Stop the device first, the engine doesn't do it in binaural mode since it doesn't drive the device
+    if (m_playbackDevice)
+        ma_device_stop(&*m_playbackDevice);
+
     // Destroy the engine
     if (m_engine)
         ma_engine_uninit(&*m_engine);
@@ -192,7 +271,10 @@ bool AudioDevice::reinitialize()
     for (const auto& entry : instance->m_resources)
         entry.deinitializeFunc(entry.resource);
 
-    // Destroy the old engine
+    // Stop the old playback device, then destroy the old engine
+    if (instance->m_playbackDevice)
+        ma_device_stop(&*instance->m_playbackDevice);
+
     if (instance->m_engine)
         ma_engine_uninit(&*instance->m_engine);
 
@@ -211,6 +293,36 @@ bool AudioDevice::reinitialize()
 }
 
 
+////////////////////////////////////////////////////////////
+void AudioDevice::queueSpatialUpdates(const SpatialUpdate* updates, std::size_t count)
+{
+    auto* instance = getInstance();
+
+    if (!instance)
+        return;
+
+    const std::lock_guard lock(instance->m_spatialMutex);
+    instance->m_spatialUpdates.insert(instance->m_spatialUpdates.end(), updates, updates + count);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::cancelSpatialUpdates(const ma_sound* sound)
+{
+    auto* instance = getInstance();
+
+    if (!instance)
+        return;
+
+    const std::lock_guard lock(instance->m_spatialMutex);
+    auto&                 updates = instance->m_spatialUpdates;
+    updates.erase(std::remove_if(updates.begin(),
+                                 updates.end(),
+                                 [sound](const SpatialUpdate& update) { return update.sound == sound; }),
+                  updates.end());
+}
+
+
 ////////////////////////////////////////////////////////////
 std::vector<AudioDevice::DeviceEntry> AudioDevice::getAvailableDevices()
 {
@@ -290,16 +402,152 @@ std::optional<std::string> AudioDevice::getDevice()
 }
 
 
+////////////////////////////////////////////////////////////
+bool AudioDevice::setSettings(const PlaybackDevice::Settings& settings)
+{
+    getCurrentSettings() = settings;
+    return reinitialize();
+}
+
+
+////////////////////////////////////////////////////////////
+PlaybackDevice::Settings AudioDevice::getSettings()
+{
+    return getCurrentSettings();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<PlaybackDevice::Settings> AudioDevice::getActiveSettings()
+{
+    auto* instance = getInstance();
+
+    if (!instance || !instance->m_playbackDevice)
+        return std::nullopt;
+
+    const auto& playback = instance->m_playbackDevice->playback;
+
+    PlaybackDevice::Settings settings;
+    settings.periodSizeInFrames = playback.internalPeriodSizeInFrames;
+    settings.periodCount        = playback.internalPeriods;
+    settings.sampleRate         = playback.internalSampleRate;
+    settings.exclusiveMode      = (playback.shareMode == ma_share_mode_exclusive);
+    settings.lowLatency         = getCurrentSettings().lowLatency;
+    settings.binaural           = instance->m_binauralRenderer.has_value();
+    return settings;
+}
+
+
+////////////////////////////////////////////////////////////
+Time AudioDevice::getLatency()
+{
+    const auto settings = getActiveSettings();
+
+    if (!settings || settings->sampleRate == 0)
+        return Time::Zero;
+
+    return seconds(static_cast<float>(settings->periodSizeInFrames * settings->periodCount) /
+                   static_cast<float>(settings->sampleRate));
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t AudioDevice::getClock()
+{
+    // The time of the node graph is atomic, it can be read while the audio thread advances it
+    if (auto* engine = getEngine())
+        return ma_engine_get_time_in_pcm_frames(engine);
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+PlaybackDevice::Statistics AudioDevice::getStatistics()
+{
+    const auto&                counters = getStatisticsCounters();
+    PlaybackDevice::Statistics statistics;
+
+    for (std::size_t i = 0; i < statistics.loadHistogram.size(); ++i)
+        statistics.loadHistogram[i] = counters.loadHistogram[i].load(std::memory_order_relaxed);
+
+    statistics.callbackCount        = counters.callbackCount.load(std::memory_order_relaxed);
+    statistics.lateCallbackCount    = counters.lateCallbackCount.load(std::memory_order_relaxed);
+    statistics.lastCallbackDuration = microseconds(counters.lastCallbackDuration.load(std::memory_order_relaxed));
+    statistics.maxCallbackDuration  = microseconds(counters.maxCallbackDuration.load(std::memory_order_relaxed));
+    statistics.periodSizeInFrames   = counters.periodSizeInFrames.load(std::memory_order_relaxed);
+    statistics.periodDuration       = microseconds(counters.periodDuration.load(std::memory_order_relaxed));
+    statistics.activeVoiceCount     = counters.activeVoiceCount.load(std::memory_order_relaxed);
+    statistics.streamingVoiceCount  = counters.streamingVoiceCount.load(std::memory_order_relaxed);
+    statistics.virtualVoiceCount    = static_cast<unsigned int>(
+        std::max<std::ptrdiff_t>(counters.virtualVoiceCount.load(std::memory_order_relaxed), 0));
+    statistics.underrunCount      = counters.underrunCount.load(std::memory_order_relaxed);
+    statistics.minDecodeAheadFill = counters.minDecodeAheadFill.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::resetStatistics()
+{
+    auto& counters = getStatisticsCounters();
+
+    for (auto& bucket : counters.loadHistogram)
+        bucket.store(0, std::memory_order_relaxed);
+
+    counters.callbackCount.store(0, std::memory_order_relaxed);
+    counters.lateCallbackCount.store(0, std::memory_order_relaxed);
+    counters.maxCallbackDuration.store(0, std::memory_order_relaxed);
+    counters.underrunCount.store(0, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::countMixedVoice(std::uint64_t& lastMixIndex, bool streaming, float decodeAheadFill)
+{
+    auto& counters = getStatisticsCounters();
+
+    // The engine may read a voice several times per period, only count it the first time
+    if (lastMixIndex != counters.mixIndex)
+    {
+        lastMixIndex = counters.mixIndex;
+        ++counters.mixedVoiceCount;
+
+        if (streaming)
+            ++counters.mixedStreamCount;
+    }
+
+    counters.mixedMinFill = std::min(counters.mixedMinFill, decodeAheadFill);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::countUnderrun()
+{
+    getStatisticsCounters().underrunCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::addVirtualVoices(std::ptrdiff_t delta)
+{
+    getStatisticsCounters().virtualVoiceCount.fetch_add(delta, std::memory_order_relaxed);
+}
+
+
 ////////////////////////////////////////////////////////////
 AudioDevice::ResourceEntryIter AudioDevice::registerResource(void*               resource,
                                                              ResourceEntry::Func deinitializeFunc,
-                                                             ResourceEntry::Func reinitializeFunc)
+                                                             ResourceEntry::Func reinitializeFunc,
+                                                             bool                reinitializeFirst)
 {
     // There should always be an AudioDevice instance when registerResource is called
     auto* instance = getInstance();
     assert(instance && "AudioDevice instance should exist when calling AudioDevice::registerResource");
     const std::lock_guard lock(instance->m_resourcesMutex);
-    return instance->m_resources.insert(instance->m_resources.end(), {resource, deinitializeFunc, reinitializeFunc});
+    const auto position = reinitializeFirst ? instance->m_resources.begin() : instance->m_resources.end();
+    return instance->m_resources.insert(position, {resource, deinitializeFunc, reinitializeFunc});
 }
 
 
@@ -325,7 +573,7 @@ void AudioDevice::setGlobalVolume(float volume)
     if (!instance || !instance->m_engine)
         return;
 
-    if (const auto result = ma_device_set_master_volume(ma_engine_get_device(&*instance->m_engine), volume * 0.01f);
+    if (const auto result = ma_device_set_master_volume(&*instance->m_playbackDevice, volume * 0.01f);
         result != MA_SUCCESS)
         err() << "Failed to set audio device master volume: " << ma_result_description(result) << std::endl;
 }
@@ -486,22 +734,80 @@ bool AudioDevice::initialize()
     {
         auto& audioDevice = *static_cast<AudioDevice*>(device->pUserData);
 
-        if (audioDevice.m_engine)
+        if (!audioDevice.m_engine)
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        beginPeriod();
+        audioDevice.applySpatialUpdates();
+
+        if (!audioDevice.m_binauralRenderer)
         {
             if (const auto result = ma_engine_read_pcm_frames(&*audioDevice.m_engine, output, frameCount, nullptr);
                 result != MA_SUCCESS)
                 err() << "Failed to read PCM frames from audio engine: " << ma_result_description(result) << std::endl;
         }
+        else
+        {
+            // In binaural mode, the engine mixes to virtual speakers that are rendered to the stereo output in blocks
+            constexpr ma_uint32 blockSize = 256;
+            std::array<float, blockSize * BinauralRenderer::InputChannelCount> speakers{};
+
+            for (ma_uint32 offset = 0; offset < frameCount; offset += blockSize)
+            {
+                const ma_uint32 count = std::min(blockSize, frameCount - offset);
+
+                auto* engine = &*audioDevice.m_engine;
+                if (const auto result = ma_engine_read_pcm_frames(engine, speakers.data(), count, nullptr);
+                    result != MA_SUCCESS)
+                    err() << "Failed to read PCM frames from audio engine: " << ma_result_description(result)
+                          << std::endl;
+
+                auto* stereo = static_cast<float*>(output) + offset * 2;
+                audioDevice.m_binauralRenderer->process(speakers.data(), stereo, count);
+            }
+        }
+
+        endPeriod(frameCount, device->sampleRate, std::chrono::steady_clock::now() - start);
     };
     playbackDeviceConfig.pUserData          = this;
     playbackDeviceConfig.playback.format    = ma_format_f32;
     playbackDeviceConfig.playback.pDeviceID = deviceId ? &*deviceId : nullptr;
 
-    if (const auto result = ma_device_init(&*m_context, &playbackDeviceConfig, &*m_playbackDevice); result != MA_SUCCESS)
+    // Apply the requested settings, 0 values keep the defaults of the backend
+    const auto& settings                    = getCurrentSettings();
+    playbackDeviceConfig.sampleRate         = settings.sampleRate;
+    playbackDeviceConfig.periodSizeInFrames = settings.periodSizeInFrames;
+    playbackDeviceConfig.periods            = settings.periodCount;
+    playbackDeviceConfig.playback.shareMode = settings.exclusiveMode ? ma_share_mode_exclusive : ma_share_mode_shared;
+    playbackDeviceConfig.playback.channels  = settings.binaural ? 2 : 0;
+
+    if (settings.lowLatency)
+    {
+        playbackDeviceConfig.performanceProfile = ma_performance_profile_low_latency;
+
+        // The engine accepts callbacks of any size, so there is no need
+        // for the intermediary buffer that adds up to a period of latency
+        playbackDeviceConfig.noFixedSizedCallback = MA_TRUE;
+    }
+
+    auto deviceResult = ma_device_init(&*m_context, &playbackDeviceConfig, &*m_playbackDevice);
+
+    // Not every backend or device supports exclusive mode, so fall back to shared mode if it is refused
+    if ((deviceResult != MA_SUCCESS) && settings.exclusiveMode)
+    {
+        err() << "Failed to open the audio playback device in exclusive mode, falling back to shared mode: "
+              << ma_result_description(deviceResult) << std::endl;
+
+        playbackDeviceConfig.playback.shareMode = ma_share_mode_shared;
+        deviceResult = ma_device_init(&*m_context, &playbackDeviceConfig, &*m_playbackDevice);
+    }
+
+    if (deviceResult != MA_SUCCESS)
     {
         m_playbackDevice.reset();
         getCurrentDevice() = std::nullopt;
-        err() << "Failed to initialize the audio playback device: " << ma_result_description(result) << std::endl;
+        err() << "Failed to initialize the audio playback device: " << ma_result_description(deviceResult) << std::endl;
         return false;
     }
 
@@ -532,17 +838,40 @@ bool AudioDevice::initialize()
     engineConfig.pDevice       = &*m_playbackDevice;
     engineConfig.listenerCount = 1;
 
+    // In binaural mode, the engine mixes to virtual speakers instead of the channels of the device
+    m_binauralRenderer.reset();
+
+    if (settings.binaural)
+    {
+        engineConfig.pDevice    = nullptr;
+        engineConfig.noDevice   = MA_TRUE;
+        engineConfig.channels   = BinauralRenderer::InputChannelCount;
+        engineConfig.sampleRate = m_playbackDevice->sampleRate;
+        m_binauralRenderer.emplace(m_playbackDevice->sampleRate);
+    }
+
     m_engine.emplace();
 
     if (const auto result = ma_engine_init(&engineConfig, &*m_engine); result != MA_SUCCESS)
     {
         m_engine.reset();
+        m_binauralRenderer.reset();
         err() << "Failed to initialize the audio engine: " << ma_result_description(result) << std::endl;
         return false;
     }
 
+    // The engine only starts the device itself when it drives it
+    if (settings.binaural)
+    {
+        if (const auto result = ma_device_start(&*m_playbackDevice); result != MA_SUCCESS)
+        {
+            err() << "Failed to start the audio playback device: " << ma_result_description(result) << std::endl;
+            return false;
+        }
+    }
+
     // Set master volume, position, velocity, cone and world up vector
-    if (const auto result = ma_device_set_master_volume(ma_engine_get_device(&*m_engine),
+    if (const auto result = ma_device_set_master_volume(&*m_playbackDevice,
                                                         getListenerProperties().volume * 0.01f);
         result != MA_SUCCESS)
         err() << "Failed to set audio device master volume: " << ma_result_description(result) << std::endl;
@@ -572,6 +901,30 @@ bool AudioDevice::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+void AudioDevice::applySpatialUpdates()
+{
+    // Never wait for a game thread here, the updates can as well be applied in the next period
+    const std::unique_lock lock(m_spatialMutex, std::try_to_lock);
+
+    if (!lock.owns_lock() || m_spatialUpdates.empty())
+        return;
+
+    for (const SpatialUpdate& update : m_spatialUpdates)
+    {
+        if (update.position)
+            ma_sound_set_position(update.sound, update.position->x, update.position->y, update.position->z);
+        if (update.velocity)
+            ma_sound_set_velocity(update.sound, update.velocity->x, update.velocity->y, update.velocity->z);
+        if (update.direction)
+            ma_sound_set_direction(update.sound, update.direction->x, update.direction->y, update.direction->z);
+    }
+
+    // Clearing keeps the capacity, so that queuing doesn't allocate once the vector has grown
+    m_spatialUpdates.clear();
+}
+
+
 ////////////////////////////////////////////////////////////
 AudioDevice*& AudioDevice::getInstance()
 {
@@ -27,7 +27,9 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/BinauralRenderer.hpp>
 #include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/PlaybackDevice.hpp>
 
 #include <SFML/System/Vector3.hpp>
 
@@ -39,6 +41,9 @@
 #include <string>
 #include <vector>
 
+#include <cstddef>
+#include <cstdint>
+
 
 namespace sf::priv
 {
@@ -87,6 +92,39 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool reinitialize();
 
+    struct SpatialUpdate
+    {
+        ma_sound*               sound{};   //!< Sound to update
+        std::optional<Vector3f> position;  //!< New position of the sound
+        std::optional<Vector3f> velocity;  //!< New velocity of the sound
+        std::optional<Vector3f> direction; //!< New direction of the sound
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue spatial updates to apply before the next period
+    ///
+    /// The audio thread applies all the queued updates together
+    /// at the start of a period, without ever waiting for the
+    /// calling thread. If it can't take the queue because this
+    /// function is adding to it, it applies them one period later.
+    ///
+    /// \param updates Pointer to the array of updates to queue
+    /// \param count   Number of updates in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    static void queueSpatialUpdates(const SpatialUpdate* updates, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the queued spatial updates of a sound
+    ///
+    /// Must be called before the sound is uninitialized, so that
+    /// the audio thread never applies an update to it.
+    ///
+    /// \param sound Sound whose updates to discard
+    ///
+    ////////////////////////////////////////////////////////////
+    static void cancelSpatialUpdates(const ma_sound* sound);
+
     struct DeviceEntry
     {
         std::string  name;
@@ -136,6 +174,94 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<std::string> getDevice();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the configuration of the audio playback device
+    ///
+    /// The device is reinitialized with the new settings, in the
+    /// same way as when switching devices.
+    ///
+    /// \param settings The settings to apply
+    ///
+    /// \return True, if the device could be reinitialized
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool setSettings(const PlaybackDevice::Settings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the requested configuration of the audio playback device
+    ///
+    /// \return The settings last passed to setSettings
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static PlaybackDevice::Settings getSettings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the configuration negotiated with the audio backend
+    ///
+    /// \return The settings of the current device or `std::nullopt` if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<PlaybackDevice::Settings> getActiveSettings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of the buffer of the audio playback device
+    ///
+    /// \return The latency of the current device, or Time::Zero if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Time getLatency();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames mixed by the engine since it was created
+    ///
+    /// \return The time of the engine in frames, or 0 if there is no engine
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::uint64_t getClock();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the performance counters of the audio engine
+    ///
+    /// \return The counters accumulated since the last reset
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static PlaybackDevice::Statistics getStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the accumulated performance counters
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resetStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a voice mixed by the current period
+    ///
+    /// This function must be called from the audio thread each
+    /// time a sound or a stream provides samples to the engine.
+    /// A voice read several times during the same period is
+    /// only counted once.
+    ///
+    /// \param lastMixIndex    Index of the last period the voice was counted in, updated by the function
+    /// \param streaming       True if the voice is a stream
+    /// \param decodeAheadFill Fill ratio of the decode-ahead buffer of the stream, 1 if it has none
+    ///
+    ////////////////////////////////////////////////////////////
+    static void countMixedVoice(std::uint64_t& lastMixIndex, bool streaming, float decodeAheadFill = 1.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a stream that ran out of decoded samples
+    ///
+    ////////////////////////////////////////////////////////////
+    static void countUnderrun();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the number of virtual voices of the sound pools
+    ///
+    /// \param delta Number of voices that became virtual, negative if they became real or were released
+    ///
+    ////////////////////////////////////////////////////////////
+    static void addVirtualVoices(std::ptrdiff_t delta);
+
     struct ResourceEntry
     {
         using Func = void (*)(void*);
@@ -158,16 +284,24 @@ public:
     /// notified, they need to register themselves with the
     /// AudioDevice using this function
     ///
-    /// \param resource         A pointer uniquely identifying the object
-    /// \param deinitializeFunc The function to call to deinitialize the object
-    /// \param reinitializeFunc The function to call to reinitialize the object
+    /// Resources are reinitialized in the order they were
+    /// registered, except the ones registered with
+    /// \a reinitializeFirst which go before all the others.
+    /// This lets buses exist again before the sounds that
+    /// output to them.
+    ///
+    /// \param resource          A pointer uniquely identifying the object
+    /// \param deinitializeFunc  The function to call to deinitialize the object
+    /// \param reinitializeFunc  The function to call to reinitialize the object
+    /// \param reinitializeFirst Whether the object must be reinitialized before the other resources
     ///
     /// \see unregisterResource
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static ResourceEntryIter registerResource(void*               resource,
                                                             ResourceEntry::Func deinitializeFunc,
-                                                            ResourceEntry::Func reinitializeFunc);
+                                                            ResourceEntry::Func reinitializeFunc,
+                                                            bool                reinitializeFirst = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Unregister an audio resource
@@ -341,6 +475,15 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the queued spatial updates
+    ///
+    /// Called from the audio thread at the start of a period.
+    /// Leaves the updates queued if the queue is being modified.
+    ///
+    ////////////////////////////////////////////////////////////
+    void applySpatialUpdates();
+
     ////////////////////////////////////////////////////////////
     /// \brief This function makes sure the instance pointer is initialized before using it
     ///
@@ -370,12 +513,15 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::optional<ma_log>     m_log;            //!< The miniaudio log
-    std::optional<ma_context> m_context;        //!< The miniaudio context
-    std::optional<ma_device>  m_playbackDevice; //!< The miniaudio playback device
-    std::optional<ma_engine>  m_engine;         //!< The miniaudio engine (used for effects and spatialisation)
-    ResourceEntryList         m_resources;      //!< Registered resources
-    std::mutex                m_resourcesMutex; //!< The mutex guarding the registered resources
+    std::optional<ma_log>           m_log;              //!< The miniaudio log
+    std::optional<ma_context>       m_context;          //!< The miniaudio context
+    std::optional<ma_device>        m_playbackDevice;   //!< The miniaudio playback device
+    std::optional<ma_engine>        m_engine;           //!< The miniaudio engine (used for effects and spatialisation)
+    std::optional<BinauralRenderer> m_binauralRenderer; //!< Renders the engine output for headphones in binaural mode
+    ResourceEntryList               m_resources;        //!< Registered resources
+    std::mutex                      m_resourcesMutex;   //!< The mutex guarding the registered resources
+    std::vector<SpatialUpdate>      m_spatialUpdates;   //!< Spatial updates waiting for the next period
+    std::mutex                      m_spatialMutex;     //!< Guards the spatial updates, only tried by the audio thread
 };
 
 } // namespace sf::priv
@@ -0,0 +1,444 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/AudioGenerator.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
+
+#include <miniaudio.h>
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace AudioGeneratorImpl
+{
+// Whether the current thread is running AudioGenerator::onGenerate
+thread_local bool realTimeContext = false;
+
+////////////////////////////////////////////////////////////
+/// \brief Mark the current thread as running onGenerate for the lifetime of the object
+///
+////////////////////////////////////////////////////////////
+struct RealTimeScope
+{
+    RealTimeScope()
+    {
+        realTimeContext = true;
+    }
+
+    ~RealTimeScope()
+    {
+        realTimeContext = false;
+    }
+
+    RealTimeScope(const RealTimeScope&)            = delete;
+    RealTimeScope& operator=(const RealTimeScope&) = delete;
+};
+} // namespace AudioGeneratorImpl
+} // namespace
+
+
+namespace sf
+{
+struct AudioGenerator::Impl : priv::MiniaudioUtils::SoundBase
+{
+    Impl(AudioGenerator* ownerPtr) :
+    SoundBase(vtable, [](void* ptr) { static_cast<Impl*>(ptr)->initialize(); }),
+    owner(ownerPtr)
+    {
+        // Initialize sound structure and set default settings
+        initialize();
+    }
+
+    void initialize()
+    {
+        SoundBase::initialize(onEnd);
+
+        // Because we are providing a custom data source, we have to provide the channel map ourselves
+        if (!channelMap.empty())
+        {
+            soundChannelMap.clear();
+
+            for (const SoundChannel channel : channelMap)
+            {
+                soundChannelMap.push_back(priv::MiniaudioUtils::soundChannelToMiniaudioChannel(channel));
+            }
+
+            sound.engineNode.spatializer.pChannelMapIn = soundChannelMap.data();
+        }
+        else
+        {
+            sound.engineNode.spatializer.pChannelMapIn = nullptr;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a call to a function that isn't real-time safe from onGenerate
+    ///
+    /// \param function Name of the function, for the error message
+    ///
+    ////////////////////////////////////////////////////////////
+    void checkNotRealTime([[maybe_unused]] const char* function)
+    {
+#ifdef SFML_DEBUG
+        if (AudioGeneratorImpl::realTimeContext)
+        {
+            violationCount.fetch_add(1, std::memory_order_relaxed);
+            err() << function << " is not real-time safe and must not be called from onGenerate" << std::endl;
+        }
+#endif
+    }
+
+    static void onEnd(void* userData, ma_sound* soundPtr)
+    {
+        // Rewind the generator when it finishes playing
+        auto& impl      = *static_cast<Impl*>(userData);
+        impl.generating = true;
+        impl.status     = Status::Stopped;
+
+        if (const ma_result result = ma_sound_seek_to_pcm_frame(soundPtr, 0); result != MA_SUCCESS)
+            err() << "Failed to seek sound to frame 0: " << ma_result_description(result) << std::endl;
+    }
+
+    static ma_result read(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead)
+    {
+        SFML_PROFILE_ZONE("sf::AudioGenerator::read");
+
+        auto& impl = *static_cast<Impl*>(dataSource);
+
+        priv::AudioDevice::countMixedVoice(impl.lastMixIndex, false);
+
+        // The previous call asked to stop, or the generator isn't initialized yet
+        if (!impl.generating || (impl.channelCount == 0))
+        {
+            *framesRead = 0;
+            return MA_SUCCESS;
+        }
+
+        // The whole arena is available again to each call
+        impl.arenaOffset = 0;
+
+        {
+            SFML_PROFILE_ZONE("sf::AudioGenerator::onGenerate");
+
+            const AudioGeneratorImpl::RealTimeScope scope;
+            auto* const         frames = static_cast<float*>(framesOut);
+            impl.generating            = impl.owner->onGenerate(frames, static_cast<std::size_t>(frameCount));
+        }
+
+        impl.framesGenerated += frameCount;
+        *framesRead = frameCount;
+
+        return MA_SUCCESS;
+    }
+
+    static ma_result seek(ma_data_source* dataSource, ma_uint64 frameIndex)
+    {
+        // Generated audio can't be sought, only restarted
+        auto& impl           = *static_cast<Impl*>(dataSource);
+        impl.framesGenerated = frameIndex;
+        impl.generating      = true;
+
+        return MA_SUCCESS;
+    }
+
+    static ma_result getFormat(ma_data_source* dataSource,
+                               ma_format*      format,
+                               ma_uint32*      channels,
+                               ma_uint32*      sampleRate,
+                               ma_channel*,
+                               size_t)
+    {
+        const auto& impl = *static_cast<const Impl*>(dataSource);
+
+        // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
+        *format     = ma_format_f32;
+        *channels   = impl.channelCount ? impl.channelCount : 1;
+        *sampleRate = impl.sampleRate ? impl.sampleRate : 44100;
+
+        return MA_SUCCESS;
+    }
+
+    static ma_result getCursor(ma_data_source* dataSource, ma_uint64* cursor)
+    {
+        *cursor = static_cast<Impl*>(dataSource)->framesGenerated;
+
+        return MA_SUCCESS;
+    }
+
+    static ma_result getLength(ma_data_source*, ma_uint64* length)
+    {
+        *length = 0;
+
+        return MA_NOT_IMPLEMENTED;
+    }
+
+    static ma_result setLooping(ma_data_source*, ma_bool32)
+    {
+        return MA_SUCCESS;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr ma_data_source_vtable vtable{read, seek, getFormat, getCursor, getLength, setLooping, /* flags */ 0};
+    AudioGenerator* const                  owner;             //!< Owning AudioGenerator object
+    unsigned int                           channelCount{};    //!< Number of channels (1 = mono, 2 = stereo, ...)
+    unsigned int                           sampleRate{};      //!< Frequency (samples / second)
+    std::vector<SoundChannel>              channelMap;        //!< The map of position in sample frame to sound channel
+    bool                                   generating{true};  //!< False once onGenerate asked to stop
+    ma_uint64                              framesGenerated{}; //!< Number of frames generated since the last restart
+    std::uint64_t                          lastMixIndex{};    //!< Last period the generator was counted in
+    std::vector<std::byte>                 arena;             //!< Scratch memory handed out by allocate
+    std::size_t                            arenaOffset{};     //!< Number of bytes of the arena used by the current call
+    std::atomic<std::uint64_t>             violationCount{};  //!< Number of real-time violations detected
+};
+
+
+////////////////////////////////////////////////////////////
+AudioGenerator::AudioGenerator() : m_impl(std::make_unique<Impl>(this))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AudioGenerator::~AudioGenerator() = default;
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::initialize(unsigned int                     channelCount,
+                                unsigned int                     sampleRate,
+                                const std::vector<SoundChannel>& channelMap)
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::initialize");
+
+    m_impl->channelCount    = channelCount;
+    m_impl->sampleRate      = sampleRate;
+    m_impl->channelMap      = channelMap;
+    m_impl->generating      = true;
+    m_impl->framesGenerated = 0;
+
+    m_impl->deinitialize();
+    m_impl->initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::play()
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::play");
+
+    if (m_impl->status == Status::Playing)
+        return;
+
+    if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
+    {
+        err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
+    }
+    else
+    {
+        m_impl->status = Status::Playing;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::pause()
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::pause");
+
+    if (const ma_result result = ma_sound_stop(&m_impl->sound); result != MA_SUCCESS)
+    {
+        err() << "Failed to stop playing sound: " << ma_result_description(result) << std::endl;
+    }
+    else
+    {
+        if (m_impl->status == Status::Playing)
+            m_impl->status = Status::Paused;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::stop()
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::stop");
+
+    if (const ma_result result = ma_sound_stop(&m_impl->sound); result != MA_SUCCESS)
+    {
+        err() << "Failed to stop playing sound: " << ma_result_description(result) << std::endl;
+    }
+    else
+    {
+        if (m_impl->sound.pDataSource && m_impl->sound.engineNode.pEngine)
+        {
+            if (const ma_result seekResult = ma_sound_seek_to_pcm_frame(&m_impl->sound, 0); seekResult != MA_SUCCESS)
+                err() << "Failed to seek sound to frame 0: " << ma_result_description(seekResult) << std::endl;
+        }
+
+        m_impl->status = Status::Stopped;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int AudioGenerator::getChannelCount() const
+{
+    return m_impl->channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int AudioGenerator::getSampleRate() const
+{
+    return m_impl->sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<SoundChannel> AudioGenerator::getChannelMap() const
+{
+    return m_impl->channelMap;
+}
+
+
+////////////////////////////////////////////////////////////
+AudioGenerator::Status AudioGenerator::getStatus() const
+{
+    return m_impl->status;
+}
+
+
+////////////////////////////////////////////////////////////
+Time AudioGenerator::getPlayingOffset() const
+{
+    if (m_impl->channelCount == 0 || m_impl->sampleRate == 0)
+        return {};
+
+    return priv::MiniaudioUtils::getPlayingOffset(m_impl->sound);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::setArenaSize(std::size_t size)
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::setArenaSize");
+
+    if (m_impl->status != Status::Stopped)
+    {
+        err() << "Failed to set the arena size of the generator: it must be stopped first" << std::endl;
+        return;
+    }
+
+    m_impl->arena.resize(size);
+    m_impl->arena.shrink_to_fit();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AudioGenerator::getArenaSize() const
+{
+    return m_impl->arena.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t AudioGenerator::getRealTimeViolationCount() const
+{
+    return m_impl->violationCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool AudioGenerator::isRealTimeContext()
+{
+    return AudioGeneratorImpl::realTimeContext;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::setEffectProcessor(EffectProcessor effectProcessor)
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::setEffectProcessor");
+
+    m_impl->effectProcessor = std::move(effectProcessor);
+    m_impl->connectEffect(bool{m_impl->effectProcessor});
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioGenerator::setBus(AudioBus* bus)
+{
+    m_impl->checkNotRealTime("sf::AudioGenerator::setBus");
+
+    m_impl->setBus(bus);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus* AudioGenerator::getBus() const
+{
+    return m_impl->bus;
+}
+
+
+////////////////////////////////////////////////////////////
+void* AudioGenerator::allocate(std::size_t size, std::size_t alignment)
+{
+    void*       pointer   = m_impl->arena.data() + m_impl->arenaOffset;
+    std::size_t available = m_impl->arena.size() - m_impl->arenaOffset;
+
+    if (!std::align(alignment, size, pointer, available))
+    {
+        m_impl->violationCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    m_impl->arenaOffset = m_impl->arena.size() - available + size;
+    return pointer;
+}
+
+
+////////////////////////////////////////////////////////////
+void* AudioGenerator::getSound() const
+{
+    return &m_impl->sound;
+}
+
+} // namespace sf
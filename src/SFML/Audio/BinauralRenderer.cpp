@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/BinauralRenderer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace BinauralRendererImpl
+{
+// Horizontal direction of the speakers of the 7.1 layout, in listener space (x to the right, z to the back)
+struct Direction
+{
+    float x;
+    float z;
+};
+
+constexpr std::array<std::optional<Direction>, sf::priv::BinauralRenderer::InputChannelCount> speakerDirections{
+    Direction{-0.7071f, -0.7071f}, // Front left
+    Direction{+0.7071f, -0.7071f}, // Front right
+    Direction{0.f, -1.f},          // Front center
+    std::nullopt,                  // Low frequency
+    Direction{-0.7071f, +0.7071f}, // Back left
+    Direction{+0.7071f, +0.7071f}, // Back right
+    Direction{-1.f, 0.f},          // Side left
+    Direction{+1.f, 0.f}           // Side right
+};
+
+// Parameters of the spherical head model
+constexpr double headRadius    = 0.0875; // Average radius of a human head, in meters
+constexpr double speedOfSound  = 343.0;  // In meters per second
+constexpr double minAlpha      = 0.1;    // Strength of the head shadow on the far side
+constexpr double minAlphaAngle = 150.0;  // Angle from the ear where the head shadow is the strongest, in degrees
+constexpr double piDouble      = 3.14159265358979323846; // Not named pi, which would be hidden by sf::priv::pi
+} // namespace BinauralRendererImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+BinauralRenderer::BinauralRenderer(unsigned int sampleRate)
+{
+    using namespace BinauralRendererImpl;
+
+    // Time for the sound to travel the radius of the head, in frames
+    const double headDelay = headRadius / speedOfSound * sampleRate;
+
+    // The head shadow filter H(s) = (alpha * s + beta) / (s + beta), discretized with the bilinear transform
+    const double beta = 2.0 * speedOfSound / headRadius;
+    const double k    = 2.0 * sampleRate;
+
+    for (unsigned int channel = 0; channel < InputChannelCount; ++channel)
+    {
+        const auto& direction = speakerDirections[channel];
+        if (!direction)
+            continue;
+
+        Speaker& speaker = m_speakers.emplace_back();
+        speaker.channel  = channel;
+
+        for (std::size_t side = 0; side < speaker.ears.size(); ++side)
+        {
+            // Angle between the direction of the speaker and the axis of the ear
+            const double cosine = std::clamp(static_cast<double>(direction->x) * (side == 0 ? -1.0 : 1.0), -1.0, 1.0);
+            const double angle  = std::acos(cosine);
+
+            // The sound travels around the head to reach the far ear, the path is in head radii
+            const double path = angle < piDouble / 2 ? 1.0 - cosine : 1.0 + angle - piDouble / 2;
+            Ear&         ear  = speaker.ears[side];
+            ear.delay         = static_cast<float>(headDelay * path);
+
+            // Above the corner frequency, the near ear is boosted and the far ear is shadowed
+            const double alpha = (1.0 + minAlpha / 2) + (1.0 - minAlpha / 2) * std::cos(angle * 180.0 / minAlphaAngle);
+            ear.b0             = static_cast<float>((beta + alpha * k) / (beta + k));
+            ear.b1             = static_cast<float>((beta - alpha * k) / (beta + k));
+            ear.a1             = static_cast<float>((beta - k) / (beta + k));
+
+            assert(ear.delay + 1 < HistorySize && "BinauralRenderer::BinauralRenderer() Delay longer than the history");
+        }
+    }
+
+    // The engine spreads a sound over about half of the speakers
+    m_gain = 2.f / static_cast<float>(m_speakers.size());
+    m_history.resize(m_speakers.size() * HistorySize);
+}
+
+
+////////////////////////////////////////////////////////////
+void BinauralRenderer::process(const float* input, float* output, std::size_t frameCount)
+{
+    for (std::size_t frame = 0; frame < frameCount; ++frame)
+    {
+        std::array<float, 2> sum{};
+
+        for (std::size_t i = 0; i < m_speakers.size(); ++i)
+        {
+            Speaker&     speaker = m_speakers[i];
+            float* const history = &m_history[i * HistorySize];
+            history[m_historyPosition] = input[frame * InputChannelCount + speaker.channel];
+
+            for (std::size_t side = 0; side < speaker.ears.size(); ++side)
+            {
+                Ear& ear = speaker.ears[side];
+
+                // Read the delayed sample, interpolated between the two nearest samples
+                const auto        whole    = static_cast<std::size_t>(ear.delay);
+                const float       fraction = ear.delay - static_cast<float>(whole);
+                const std::size_t newer    = (m_historyPosition - whole) & (HistorySize - 1);
+                const std::size_t older    = (newer - 1) & (HistorySize - 1);
+                const float       delayed  = history[newer] + fraction * (history[older] - history[newer]);
+
+                ear.output = ear.b0 * delayed + ear.b1 * ear.input - ear.a1 * ear.output;
+                ear.input  = delayed;
+                sum[side] += ear.output;
+            }
+        }
+
+        output[frame * 2]     = sum[0] * m_gain;
+        output[frame * 2 + 1] = sum[1] * m_gain;
+        m_historyPosition     = (m_historyPosition + 1) & (HistorySize - 1);
+    }
+}
+
+} // namespace sf::priv
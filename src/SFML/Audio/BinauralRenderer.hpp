@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <array>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Render virtual surround speakers for headphones
+///
+/// The engine spatializes the sounds to a ring of virtual
+/// speakers around the listener, and each speaker is rendered
+/// to the two ears with a spherical head model of the head
+/// related transfer function (Brown and Duda, 1998): the
+/// sound reaches the far ear later, and its high frequencies
+/// are shadowed by the head. The cost only depends on the
+/// number of speakers, not on the number of sounds.
+///
+////////////////////////////////////////////////////////////
+class BinauralRenderer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of channels of the input frames
+    ///
+    /// The channels follow the standard 7.1 layout; the low
+    /// frequency channel is ignored.
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int InputChannelCount = 8;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the renderer
+    ///
+    /// \param sampleRate Sample rate of the input and output frames
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit BinauralRenderer(unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render frames of the virtual speakers to stereo frames
+    ///
+    /// \param input      Input frames, InputChannelCount channels interleaved
+    /// \param output     Output frames, left and right channels interleaved
+    /// \param frameCount Number of frames to render
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(const float* input, float* output, std::size_t frameCount);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct Ear
+    {
+        float delay{};  //!< Delay of the sound from the speaker to the ear, in frames
+        float b0{};     //!< Coefficient of the current input of the head shadow filter
+        float b1{};     //!< Coefficient of the previous input of the head shadow filter
+        float a1{};     //!< Coefficient of the previous output of the head shadow filter
+        float input{};  //!< Previous input of the head shadow filter
+        float output{}; //!< Previous output of the head shadow filter
+    };
+
+    struct Speaker
+    {
+        unsigned int       channel{}; //!< Index of the channel of the speaker in the input frames
+        std::array<Ear, 2> ears;      //!< Left and right ears
+    };
+
+    static constexpr std::size_t HistorySize = 256; //!< Number of past samples kept per speaker, a power of two
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Speaker> m_speakers;          //!< Virtual speakers
+    std::vector<float>   m_history;           //!< Past samples of each speaker, for the delays
+    std::size_t          m_historyPosition{}; //!< Position of the next sample in the history
+    float                m_gain{};            //!< Gain compensating the sum of the speakers
+};
+
+} // namespace sf::priv
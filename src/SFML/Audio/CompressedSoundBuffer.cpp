@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/CompressedSoundBuffer.hpp>
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/Sound.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CompressedSoundBuffer::CompressedSoundBuffer(const CompressedSoundBuffer& copy) :
+m_data(copy.m_data),
+m_sampleCount(copy.m_sampleCount),
+m_sampleRate(copy.m_sampleRate),
+m_channelMap(copy.m_channelMap),
+m_duration(copy.m_duration)
+{
+    // don't copy the attached sounds
+}
+
+
+////////////////////////////////////////////////////////////
+CompressedSoundBuffer::~CompressedSoundBuffer()
+{
+    // To prevent the iterator from becoming invalid, move the entire buffer to another
+    // container. Otherwise calling detachBuffer would result in detachSound being
+    // called which removes the sound from the internal list.
+    SoundList sounds;
+    sounds.swap(m_sounds);
+
+    // Detach the buffer from the sounds that use it
+    for (Sound* soundPtr : sounds)
+        soundPtr->detachBuffer();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedSoundBuffer> CompressedSoundBuffer::loadFromFile(const std::filesystem::path& filename)
+{
+    FileInputStream stream;
+    if (!stream.open(filename))
+    {
+        err() << "Failed to open sound file\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    return loadFromStream(stream);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedSoundBuffer> CompressedSoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes)
+{
+    if (!data || !sizeInBytes)
+    {
+        err() << "Failed to load compressed sound buffer from memory (no data)" << std::endl;
+        return std::nullopt;
+    }
+
+    const auto* bytes = static_cast<const std::byte*>(data);
+    return initialize(std::vector<std::byte>(bytes, bytes + sizeInBytes));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedSoundBuffer> CompressedSoundBuffer::loadFromStream(InputStream& stream)
+{
+    const std::int64_t size = stream.getSize();
+    if (size <= 0)
+    {
+        err() << "Failed to load compressed sound buffer from stream (empty or unsized stream)" << std::endl;
+        return std::nullopt;
+    }
+
+    if (stream.seek(0) == -1)
+    {
+        err() << "Failed to seek compressed sound buffer stream" << std::endl;
+        return std::nullopt;
+    }
+
+    std::vector<std::byte> data(static_cast<std::size_t>(size));
+    if (stream.read(data.data(), size) != size)
+    {
+        err() << "Failed to read compressed sound buffer stream" << std::endl;
+        return std::nullopt;
+    }
+
+    return initialize(std::move(data));
+}
+
+
+////////////////////////////////////////////////////////////
+const void* CompressedSoundBuffer::getData() const
+{
+    return m_data.data();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CompressedSoundBuffer::getDataSize() const
+{
+    return m_data.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t CompressedSoundBuffer::getSampleCount() const
+{
+    return m_sampleCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int CompressedSoundBuffer::getSampleRate() const
+{
+    return m_sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int CompressedSoundBuffer::getChannelCount() const
+{
+    return static_cast<unsigned int>(m_channelMap.size());
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<SoundChannel> CompressedSoundBuffer::getChannelMap() const
+{
+    return m_channelMap;
+}
+
+
+////////////////////////////////////////////////////////////
+Time CompressedSoundBuffer::getDuration() const
+{
+    return m_duration;
+}
+
+
+////////////////////////////////////////////////////////////
+CompressedSoundBuffer& CompressedSoundBuffer::operator=(const CompressedSoundBuffer& right)
+{
+    CompressedSoundBuffer temp(right);
+
+    std::swap(m_data, temp.m_data);
+    std::swap(m_sampleCount, temp.m_sampleCount);
+    std::swap(m_sampleRate, temp.m_sampleRate);
+    std::swap(m_channelMap, temp.m_channelMap);
+    std::swap(m_duration, temp.m_duration);
+    std::swap(m_sounds, temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+CompressedSoundBuffer::CompressedSoundBuffer(std::vector<std::byte>&& data, const InputSoundFile& file) :
+m_data(std::move(data)),
+m_sampleCount(file.getSampleCount()),
+m_sampleRate(file.getSampleRate()),
+m_channelMap(file.getChannelMap()),
+m_duration(file.getDuration())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedSoundBuffer> CompressedSoundBuffer::initialize(std::vector<std::byte>&& data)
+{
+    // Open the data once to make sure that it can be decoded, and to retrieve the sound parameters
+    const auto file = InputSoundFile::openFromMemory(data.data(), data.size());
+    if (!file)
+        return std::nullopt;
+
+    if (!file->getChannelCount() || !file->getSampleRate() || file->getChannelMap().empty())
+    {
+        err() << "Failed to load compressed sound buffer (invalid sound parameters)" << std::endl;
+        return std::nullopt;
+    }
+
+    // The file only refers to the data, which doesn't move when the vector is moved
+    return CompressedSoundBuffer(std::move(data), *file);
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedSoundBuffer::attachSound(Sound* sound) const
+{
+    if (std::find(m_sounds.begin(), m_sounds.end(), sound) == m_sounds.end())
+        m_sounds.push_back(sound);
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedSoundBuffer::detachSound(Sound* sound) const
+{
+    // The order of the sounds doesn't matter, so the last one takes the place of the removed one
+    if (const auto it = std::find(m_sounds.begin(), m_sounds.end(), sound); it != m_sounds.end())
+    {
+        *it = m_sounds.back();
+        m_sounds.pop_back();
+    }
+}
+
+} // namespace sf
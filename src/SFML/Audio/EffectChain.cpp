@@ -0,0 +1,867 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/EffectChain.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_EFFECT_CHAIN_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SFML_EFFECT_CHAIN_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace EffectChainImpl
+{
+////////////////////////////////////////////////////////////
+// Up to 4 channels of a frame are processed at once
+////////////////////////////////////////////////////////////
+constexpr unsigned int laneCount = 4;
+
+#if defined(SFML_EFFECT_CHAIN_SSE2)
+
+using Lanes = __m128;
+
+Lanes splat(float value)
+{
+    return _mm_set1_ps(value);
+}
+
+Lanes add(Lanes left, Lanes right)
+{
+    return _mm_add_ps(left, right);
+}
+
+Lanes sub(Lanes left, Lanes right)
+{
+    return _mm_sub_ps(left, right);
+}
+
+Lanes mul(Lanes left, Lanes right)
+{
+    return _mm_mul_ps(left, right);
+}
+
+Lanes loadLanes(const float* values)
+{
+    return _mm_loadu_ps(values);
+}
+
+void storeLanes(float* values, Lanes lanes)
+{
+    _mm_storeu_ps(values, lanes);
+}
+
+#elif defined(SFML_EFFECT_CHAIN_NEON)
+
+using Lanes = float32x4_t;
+
+Lanes splat(float value)
+{
+    return vdupq_n_f32(value);
+}
+
+Lanes add(Lanes left, Lanes right)
+{
+    return vaddq_f32(left, right);
+}
+
+Lanes sub(Lanes left, Lanes right)
+{
+    return vsubq_f32(left, right);
+}
+
+Lanes mul(Lanes left, Lanes right)
+{
+    return vmulq_f32(left, right);
+}
+
+Lanes loadLanes(const float* values)
+{
+    return vld1q_f32(values);
+}
+
+void storeLanes(float* values, Lanes lanes)
+{
+    vst1q_f32(values, lanes);
+}
+
+#else
+
+struct Lanes
+{
+    std::array<float, laneCount> values;
+};
+
+Lanes splat(float value)
+{
+    return {{value, value, value, value}};
+}
+
+template <typename Operation>
+Lanes apply(const Lanes& left, const Lanes& right, Operation operation)
+{
+    Lanes result{};
+    for (unsigned int i = 0; i < laneCount; ++i)
+        result.values[i] = operation(left.values[i], right.values[i]);
+    return result;
+}
+
+Lanes add(const Lanes& left, const Lanes& right)
+{
+    return apply(left, right, [](float a, float b) { return a + b; });
+}
+
+Lanes sub(const Lanes& left, const Lanes& right)
+{
+    return apply(left, right, [](float a, float b) { return a - b; });
+}
+
+Lanes mul(const Lanes& left, const Lanes& right)
+{
+    return apply(left, right, [](float a, float b) { return a * b; });
+}
+
+Lanes loadLanes(const float* values)
+{
+    Lanes result{};
+    std::memcpy(result.values.data(), values, sizeof(result.values));
+    return result;
+}
+
+void storeLanes(float* values, const Lanes& lanes)
+{
+    std::memcpy(values, lanes.values.data(), sizeof(lanes.values));
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Load the channels [0, count) of a group, the other lanes are zero
+////////////////////////////////////////////////////////////
+Lanes loadChannels(const float* frame, unsigned int count)
+{
+    if (count == laneCount)
+        return loadLanes(frame);
+
+    std::array<float, laneCount> values{};
+    std::memcpy(values.data(), frame, count * sizeof(float));
+    return loadLanes(values.data());
+}
+
+
+////////////////////////////////////////////////////////////
+void storeChannels(float* frame, Lanes lanes, unsigned int count)
+{
+    if (count == laneCount)
+    {
+        storeLanes(frame, lanes);
+        return;
+    }
+
+    std::array<float, laneCount> values{};
+    storeLanes(values.data(), lanes);
+    std::memcpy(frame, values.data(), count * sizeof(float));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int getGroupCount(unsigned int channelCount)
+{
+    return (channelCount + laneCount - 1) / laneCount;
+}
+
+
+////////////////////////////////////////////////////////////
+float decibelsToGain(float decibels)
+{
+    return std::pow(10.f, decibels / 20.f);
+}
+
+
+////////////////////////////////////////////////////////////
+// Coefficient of a one-pole smoother reaching ~63% of its target after the given time
+////////////////////////////////////////////////////////////
+float getSmoothingCoefficient(float seconds, unsigned int sampleRate)
+{
+    if (seconds <= 0.f)
+        return 0.f;
+
+    return std::exp(-1.f / (seconds * static_cast<float>(sampleRate)));
+}
+
+
+////////////////////////////////////////////////////////////
+float getPeak(const float* frame, unsigned int channelCount)
+{
+    float peak = 0.f;
+    for (unsigned int channel = 0; channel < channelCount; ++channel)
+        peak = std::max(peak, std::abs(frame[channel]));
+    return peak;
+}
+
+
+////////////////////////////////////////////////////////////
+// Apply a gain to the first channels of a frame
+////////////////////////////////////////////////////////////
+void applyGain(float* frame, unsigned int channelCount, Lanes gain)
+{
+    for (unsigned int first = 0; first < channelCount; first += laneCount)
+    {
+        const unsigned int count = std::min(laneCount, channelCount - first);
+        storeChannels(frame + first, mul(loadChannels(frame + first, count), gain), count);
+    }
+}
+} // namespace EffectChainImpl
+} // namespace
+
+
+// The nodes are held by EffectChain::Impl, so they can't be declared in the anonymous namespace
+namespace sf::priv::EffectChainNodes
+{
+// No other file opens this namespace, so the helpers can be made visible to all of it
+using namespace ::EffectChainImpl;
+
+////////////////////////////////////////////////////////////
+enum class NodeType
+{
+    Filter,
+    ReverbSend,
+    Compressor,
+    Limiter
+};
+
+
+////////////////////////////////////////////////////////////
+// Base class of the nodes
+//
+// Parameters are written by any thread through atomics, and
+// `changed` tells the audio thread to take them into account.
+////////////////////////////////////////////////////////////
+struct Node
+{
+    Node(NodeType theType, unsigned int theChannelCount, unsigned int theSampleRate) :
+    type(theType),
+    channelCount(theChannelCount),
+    sampleRate(theSampleRate)
+    {
+    }
+
+    virtual ~Node() = default;
+
+    Node(const Node&)            = delete;
+    Node& operator=(const Node&) = delete;
+
+    // Process the interleaved frames in place, only the first channelCount channels are touched
+    virtual void process(float* frames, unsigned int frameCount, unsigned int frameChannelCount) = 0;
+
+    const NodeType     type;
+    const unsigned int channelCount;
+    const unsigned int sampleRate;
+    std::atomic<bool>  bypassed{};
+    std::atomic<bool>  changed{true};
+};
+
+
+////////////////////////////////////////////////////////////
+// Biquad filter in transposed direct form II (RBJ audio EQ cookbook)
+////////////////////////////////////////////////////////////
+struct FilterNode : Node
+{
+    FilterNode(sf::EffectChain::FilterType theFilterType, unsigned int theChannelCount, unsigned int theSampleRate) :
+    Node(NodeType::Filter, theChannelCount, theSampleRate),
+    filterType(theFilterType),
+    z1(std::size_t{getGroupCount(theChannelCount)} * laneCount),
+    z2(std::size_t{getGroupCount(theChannelCount)} * laneCount)
+    {
+    }
+
+    void updateCoefficients()
+    {
+        const float nyquist = static_cast<float>(sampleRate) / 2.f;
+        const float f       = std::clamp(frequency.load(std::memory_order_relaxed), 1.f, nyquist * 0.99f);
+        const float w0      = 2.f * 3.14159265f * f / static_cast<float>(sampleRate);
+        const float cosW0   = std::cos(w0);
+        const float alpha   = std::sin(w0) / (2.f * std::max(q.load(std::memory_order_relaxed), 1e-3f));
+        const float a       = std::pow(10.f, gain.load(std::memory_order_relaxed) / 40.f);
+        const float shelf   = 2.f * std::sqrt(a) * alpha;
+
+        float b0 = 1.f;
+        float b1 = 0.f;
+        float b2 = 0.f;
+        float a0 = 1.f;
+        float a1 = 0.f;
+        float a2 = 0.f;
+
+        switch (filterType)
+        {
+            case sf::EffectChain::FilterType::LowPass:
+                b0 = (1.f - cosW0) / 2.f;
+                b1 = 1.f - cosW0;
+                b2 = b0;
+                a0 = 1.f + alpha;
+                a1 = -2.f * cosW0;
+                a2 = 1.f - alpha;
+                break;
+            case sf::EffectChain::FilterType::HighPass:
+                b0 = (1.f + cosW0) / 2.f;
+                b1 = -(1.f + cosW0);
+                b2 = b0;
+                a0 = 1.f + alpha;
+                a1 = -2.f * cosW0;
+                a2 = 1.f - alpha;
+                break;
+            case sf::EffectChain::FilterType::BandPass:
+                b0 = alpha;
+                b1 = 0.f;
+                b2 = -alpha;
+                a0 = 1.f + alpha;
+                a1 = -2.f * cosW0;
+                a2 = 1.f - alpha;
+                break;
+            case sf::EffectChain::FilterType::Notch:
+                b0 = 1.f;
+                b1 = -2.f * cosW0;
+                b2 = 1.f;
+                a0 = 1.f + alpha;
+                a1 = -2.f * cosW0;
+                a2 = 1.f - alpha;
+                break;
+            case sf::EffectChain::FilterType::Peak:
+                b0 = 1.f + alpha * a;
+                b1 = -2.f * cosW0;
+                b2 = 1.f - alpha * a;
+                a0 = 1.f + alpha / a;
+                a1 = -2.f * cosW0;
+                a2 = 1.f - alpha / a;
+                break;
+            case sf::EffectChain::FilterType::LowShelf:
+                b0 = a * ((a + 1.f) - (a - 1.f) * cosW0 + shelf);
+                b1 = 2.f * a * ((a - 1.f) - (a + 1.f) * cosW0);
+                b2 = a * ((a + 1.f) - (a - 1.f) * cosW0 - shelf);
+                a0 = (a + 1.f) + (a - 1.f) * cosW0 + shelf;
+                a1 = -2.f * ((a - 1.f) + (a + 1.f) * cosW0);
+                a2 = (a + 1.f) + (a - 1.f) * cosW0 - shelf;
+                break;
+            case sf::EffectChain::FilterType::HighShelf:
+                b0 = a * ((a + 1.f) + (a - 1.f) * cosW0 + shelf);
+                b1 = -2.f * a * ((a - 1.f) + (a + 1.f) * cosW0);
+                b2 = a * ((a + 1.f) + (a - 1.f) * cosW0 - shelf);
+                a0 = (a + 1.f) - (a - 1.f) * cosW0 + shelf;
+                a1 = 2.f * ((a - 1.f) - (a + 1.f) * cosW0);
+                a2 = (a + 1.f) - (a - 1.f) * cosW0 - shelf;
+                break;
+        }
+
+        coefficients = {b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0};
+    }
+
+    void process(float* frames, unsigned int frameCount, unsigned int frameChannelCount) override
+    {
+        if (changed.exchange(false, std::memory_order_acquire))
+            updateCoefficients();
+
+        const Lanes b0 = splat(coefficients[0]);
+        const Lanes b1 = splat(coefficients[1]);
+        const Lanes b2 = splat(coefficients[2]);
+        const Lanes a1 = splat(coefficients[3]);
+        const Lanes a2 = splat(coefficients[4]);
+
+        const unsigned int processed = std::min(channelCount, frameChannelCount);
+
+        for (unsigned int group = 0; group < getGroupCount(processed); ++group)
+        {
+            const unsigned int first = group * laneCount;
+            const unsigned int count = std::min(laneCount, processed - first);
+            float*             frame = frames + first;
+
+            Lanes s1 = loadLanes(&z1[first]);
+            Lanes s2 = loadLanes(&z2[first]);
+
+            for (unsigned int i = 0; i < frameCount; ++i, frame += frameChannelCount)
+            {
+                const Lanes x = loadChannels(frame, count);
+                const Lanes y = add(mul(b0, x), s1);
+                s1            = add(sub(mul(b1, x), mul(a1, y)), s2);
+                s2            = sub(mul(b2, x), mul(a2, y));
+                storeChannels(frame, y, count);
+            }
+
+            storeLanes(&z1[first], s1);
+            storeLanes(&z2[first], s2);
+        }
+    }
+
+    const sf::EffectChain::FilterType filterType;
+    std::atomic<float>                frequency{};
+    std::atomic<float>                q{};
+    std::atomic<float>                gain{};
+    std::array<float, 5>              coefficients{};
+    std::vector<float>                z1; // First state variable of each channel, padded to whole lane groups
+    std::vector<float>                z2; // Second state variable of each channel, padded to whole lane groups
+};
+
+
+////////////////////////////////////////////////////////////
+// Schroeder-Moorer reverberator (parallel damped combs followed by all-pass filters, as in Freeverb)
+////////////////////////////////////////////////////////////
+struct ReverbSendNode : Node
+{
+    struct Delay
+    {
+        std::vector<float> buffer; // Delayed frames, padded to whole lane groups
+        std::vector<float> stores; // Low-pass state of the combs, padded to whole lane groups
+        std::size_t        length{};
+        std::size_t        cursor{};
+    };
+
+    ReverbSendNode(unsigned int theChannelCount, unsigned int theSampleRate) :
+    Node(NodeType::ReverbSend, theChannelCount, theSampleRate)
+    {
+        static constexpr std::array<std::size_t, 4> combLengths    = {1116, 1188, 1277, 1356};
+        static constexpr std::array<std::size_t, 2> allPassLengths = {556, 441};
+
+        const auto initialize = [this](Delay& delay, std::size_t length)
+        {
+            const auto scaled = static_cast<double>(length) * sampleRate / 44100.0;
+            delay.length      = std::max<std::size_t>(1, static_cast<std::size_t>(scaled));
+            delay.buffer.assign(delay.length * getGroupCount(channelCount) * laneCount, 0.f);
+            delay.stores.assign(std::size_t{getGroupCount(channelCount)} * laneCount, 0.f);
+        };
+
+        for (std::size_t i = 0; i < combs.size(); ++i)
+            initialize(combs[i], combLengths[i]);
+
+        for (std::size_t i = 0; i < allPasses.size(); ++i)
+            initialize(allPasses[i], allPassLengths[i]);
+    }
+
+    void process(float* frames, unsigned int frameCount, unsigned int frameChannelCount) override
+    {
+        if (changed.exchange(false, std::memory_order_acquire))
+        {
+            const float damping = std::clamp(dampingParameter.load(std::memory_order_relaxed), 0.f, 1.f) * 0.4f;
+
+            wet      = std::clamp(send.load(std::memory_order_relaxed), 0.f, 1.f);
+            feedback = std::clamp(roomSize.load(std::memory_order_relaxed), 0.f, 1.f) * 0.28f + 0.7f;
+            damp1    = damping;
+            damp2    = 1.f - damping;
+        }
+
+        const unsigned int processed   = std::min(channelCount, frameChannelCount);
+        const std::size_t  groupCount  = getGroupCount(processed);
+        const std::size_t  stride      = std::size_t{getGroupCount(channelCount)} * laneCount;
+        const Lanes        inputGain   = splat(0.03f);
+        const Lanes        wetGain     = splat(wet);
+        const Lanes        feedbacks   = splat(feedback);
+        const Lanes        damps1      = splat(damp1);
+        const Lanes        damps2      = splat(damp2);
+        const Lanes        allPassGain = splat(0.5f);
+
+        for (unsigned int i = 0; i < frameCount; ++i, frames += frameChannelCount)
+        {
+            for (std::size_t group = 0; group < groupCount; ++group)
+            {
+                const auto  first = static_cast<unsigned int>(group * laneCount);
+                const auto  count = std::min(laneCount, processed - first);
+                float*      frame = frames + first;
+                const Lanes dry   = loadChannels(frame, count);
+                const Lanes input = mul(dry, inputGain);
+
+                Lanes output = splat(0.f);
+                for (Delay& comb : combs)
+                {
+                    float*      delayed = &comb.buffer[comb.cursor * stride + first];
+                    const Lanes combOut = loadLanes(delayed);
+                    const Lanes store   = add(mul(combOut, damps2), mul(loadLanes(&comb.stores[first]), damps1));
+                    storeLanes(&comb.stores[first], store);
+                    storeLanes(delayed, add(input, mul(store, feedbacks)));
+                    output = add(output, combOut);
+                }
+
+                for (Delay& allPass : allPasses)
+                {
+                    float*      delayed = &allPass.buffer[allPass.cursor * stride + first];
+                    const Lanes bufOut  = loadLanes(delayed);
+                    storeLanes(delayed, add(output, mul(bufOut, allPassGain)));
+                    output = sub(bufOut, output);
+                }
+
+                storeChannels(frame, add(dry, mul(output, wetGain)), count);
+            }
+
+            for (Delay& comb : combs)
+                comb.cursor = (comb.cursor + 1) % comb.length;
+
+            for (Delay& allPass : allPasses)
+                allPass.cursor = (allPass.cursor + 1) % allPass.length;
+        }
+    }
+
+    std::atomic<float>   send{};
+    std::atomic<float>   roomSize{};
+    std::atomic<float>   dampingParameter{};
+    float                wet{};
+    float                feedback{};
+    float                damp1{};
+    float                damp2{};
+    std::array<Delay, 4> combs;
+    std::array<Delay, 2> allPasses;
+};
+
+
+////////////////////////////////////////////////////////////
+// Feed-forward compressor with a linked peak detector, smoothed in the decibel domain
+////////////////////////////////////////////////////////////
+struct CompressorNode : Node
+{
+    CompressorNode(unsigned int theChannelCount, unsigned int theSampleRate) :
+    Node(NodeType::Compressor, theChannelCount, theSampleRate)
+    {
+    }
+
+    void process(float* frames, unsigned int frameCount, unsigned int frameChannelCount) override
+    {
+        if (changed.exchange(false, std::memory_order_acquire))
+        {
+            thresholdDecibels  = threshold.load(std::memory_order_relaxed);
+            thresholdGain      = decibelsToGain(thresholdDecibels);
+            slope              = 1.f - 1.f / std::max(ratio.load(std::memory_order_relaxed), 1.f);
+            attackCoefficient  = getSmoothingCoefficient(attack.load(std::memory_order_relaxed), sampleRate);
+            releaseCoefficient = getSmoothingCoefficient(release.load(std::memory_order_relaxed), sampleRate);
+        }
+
+        const unsigned int processed = std::min(channelCount, frameChannelCount);
+
+        for (unsigned int i = 0; i < frameCount; ++i, frames += frameChannelCount)
+        {
+            const float peak = getPeak(frames, processed);
+
+            // Skip the logarithms while the signal stays below the threshold and nothing is left to release
+            if (peak <= thresholdGain && reduction < 1e-4f)
+            {
+                reduction = 0.f;
+                continue;
+            }
+
+            const float level       = 20.f * std::log10(std::max(peak, 1e-9f));
+            const float target      = std::max(level - thresholdDecibels, 0.f) * slope;
+            const float coefficient = target > reduction ? attackCoefficient : releaseCoefficient;
+            reduction               = target + coefficient * (reduction - target);
+
+            applyGain(frames, processed, splat(decibelsToGain(-reduction)));
+        }
+    }
+
+    std::atomic<float> threshold{};
+    std::atomic<float> ratio{};
+    std::atomic<float> attack{};
+    std::atomic<float> release{};
+    float              thresholdDecibels{};
+    float              thresholdGain{};
+    float              slope{};
+    float              attackCoefficient{};
+    float              releaseCoefficient{};
+    float              reduction{}; // Current gain reduction, in dB
+};
+
+
+////////////////////////////////////////////////////////////
+// Peak limiter with instant attack, smoothed in the linear domain
+////////////////////////////////////////////////////////////
+struct LimiterNode : Node
+{
+    LimiterNode(unsigned int theChannelCount, unsigned int theSampleRate) :
+    Node(NodeType::Limiter, theChannelCount, theSampleRate)
+    {
+    }
+
+    void process(float* frames, unsigned int frameCount, unsigned int frameChannelCount) override
+    {
+        if (changed.exchange(false, std::memory_order_acquire))
+        {
+            ceilingGain        = decibelsToGain(ceiling.load(std::memory_order_relaxed));
+            releaseCoefficient = getSmoothingCoefficient(release.load(std::memory_order_relaxed), sampleRate);
+        }
+
+        const unsigned int processed = std::min(channelCount, frameChannelCount);
+
+        for (unsigned int i = 0; i < frameCount; ++i, frames += frameChannelCount)
+        {
+            const float peak   = getPeak(frames, processed);
+            const float target = peak > ceilingGain ? ceilingGain / peak : 1.f;
+            gain               = target < gain ? target : target + releaseCoefficient * (gain - target);
+
+            if (gain < 1.f)
+                applyGain(frames, processed, splat(gain));
+        }
+    }
+
+    std::atomic<float> ceiling{};
+    std::atomic<float> release{};
+    float              ceilingGain{1.f};
+    float              releaseCoefficient{};
+    float              gain{1.f};
+};
+} // namespace sf::priv::EffectChainNodes
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct EffectChain::Impl
+{
+    using Node     = priv::EffectChainNodes::Node;
+    using NodeType = priv::EffectChainNodes::NodeType;
+
+    Impl(unsigned int theChannelCount, unsigned int theSampleRate) :
+    channelCount(theChannelCount),
+    sampleRate(theSampleRate)
+    {
+    }
+
+    template <typename T = Node>
+    T& getNode(std::size_t index, [[maybe_unused]] std::optional<NodeType> type = std::nullopt) const
+    {
+        assert(index < nodes.size() && "EffectChain: Node index out of range");
+        assert((!type || nodes[index]->type == *type) && "EffectChain: Node has a different type");
+        return static_cast<T&>(*nodes[index]);
+    }
+
+    std::size_t addNode(std::unique_ptr<Node> node)
+    {
+        assert(!processorCreated && "EffectChain: Nodes can't be added once a processor was created");
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+    }
+
+    void process(const float*  inputFrames,
+                 unsigned int& inputFrameCount,
+                 float*        outputFrames,
+                 unsigned int& outputFrameCount,
+                 unsigned int  frameChannelCount) const
+    {
+        // Process data 1:1, reading silence if no input data is available
+        const unsigned int frameCount = inputFrames ? std::min(inputFrameCount, outputFrameCount) : outputFrameCount;
+
+        if (inputFrames)
+            std::memcpy(outputFrames, inputFrames, std::size_t{frameCount} * frameChannelCount * sizeof(float));
+        else
+            std::fill_n(outputFrames, std::size_t{frameCount} * frameChannelCount, 0.f);
+
+        for (const std::unique_ptr<Node>& node : nodes)
+        {
+            if (!node->bypassed.load(std::memory_order_relaxed))
+                node->process(outputFrames, frameCount, frameChannelCount);
+        }
+
+        inputFrameCount  = inputFrames ? frameCount : 0;
+        outputFrameCount = frameCount;
+    }
+
+    const unsigned int                 channelCount;       //!< Number of channels processed by the nodes
+    const unsigned int                 sampleRate;         //!< Sample rate the nodes are configured for
+    std::vector<std::unique_ptr<Node>> nodes;              //!< Nodes, in processing order
+    bool                               processorCreated{}; //!< Whether the audio thread may be using the nodes
+};
+
+
+////////////////////////////////////////////////////////////
+EffectChain::EffectChain(unsigned int channelCount, unsigned int sampleRate) :
+m_impl(std::make_shared<Impl>(channelCount, sampleRate))
+{
+    assert(channelCount > 0 && "EffectChain::EffectChain() Channel count must be greater than 0");
+    assert(sampleRate > 0 && "EffectChain::EffectChain() Sample rate must be greater than 0");
+}
+
+
+////////////////////////////////////////////////////////////
+EffectChain::~EffectChain() = default;
+
+
+////////////////////////////////////////////////////////////
+EffectChain::EffectChain(EffectChain&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+EffectChain& EffectChain::operator=(EffectChain&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::size_t EffectChain::addFilter(FilterType type, float frequency, float q, float gain)
+{
+    using namespace priv::EffectChainNodes;
+
+    const std::size_t index = m_impl->addNode(
+        std::make_unique<FilterNode>(type, m_impl->channelCount, m_impl->sampleRate));
+    setFilter(index, frequency, q, gain);
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t EffectChain::addReverbSend(float send, float roomSize, float damping)
+{
+    using namespace priv::EffectChainNodes;
+
+    const std::size_t index = m_impl->addNode(
+        std::make_unique<ReverbSendNode>(m_impl->channelCount, m_impl->sampleRate));
+    setReverbSend(index, send, roomSize, damping);
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t EffectChain::addCompressor(float threshold, float ratio, Time attack, Time release)
+{
+    using namespace priv::EffectChainNodes;
+
+    const std::size_t index = m_impl->addNode(
+        std::make_unique<CompressorNode>(m_impl->channelCount, m_impl->sampleRate));
+    setCompressor(index, threshold, ratio, attack, release);
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t EffectChain::addLimiter(float ceiling, Time release)
+{
+    using namespace priv::EffectChainNodes;
+
+    const std::size_t index = m_impl->addNode(
+        std::make_unique<LimiterNode>(m_impl->channelCount, m_impl->sampleRate));
+    setLimiter(index, ceiling, release);
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::setFilter(std::size_t node, float frequency, float q, float gain)
+{
+    using namespace priv::EffectChainNodes;
+
+    auto& filter = m_impl->getNode<FilterNode>(node, NodeType::Filter);
+
+    filter.frequency.store(frequency, std::memory_order_relaxed);
+    filter.q.store(q, std::memory_order_relaxed);
+    filter.gain.store(gain, std::memory_order_relaxed);
+    filter.changed.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::setReverbSend(std::size_t node, float send, float roomSize, float damping)
+{
+    using namespace priv::EffectChainNodes;
+
+    auto& reverb = m_impl->getNode<ReverbSendNode>(node, NodeType::ReverbSend);
+
+    reverb.send.store(send, std::memory_order_relaxed);
+    reverb.roomSize.store(roomSize, std::memory_order_relaxed);
+    reverb.dampingParameter.store(damping, std::memory_order_relaxed);
+    reverb.changed.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::setCompressor(std::size_t node, float threshold, float ratio, Time attack, Time release)
+{
+    using namespace priv::EffectChainNodes;
+
+    auto& compressor = m_impl->getNode<CompressorNode>(node, NodeType::Compressor);
+
+    compressor.threshold.store(threshold, std::memory_order_relaxed);
+    compressor.ratio.store(ratio, std::memory_order_relaxed);
+    compressor.attack.store(attack.asSeconds(), std::memory_order_relaxed);
+    compressor.release.store(release.asSeconds(), std::memory_order_relaxed);
+    compressor.changed.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::setLimiter(std::size_t node, float ceiling, Time release)
+{
+    using namespace priv::EffectChainNodes;
+
+    auto& limiter = m_impl->getNode<LimiterNode>(node, NodeType::Limiter);
+
+    limiter.ceiling.store(ceiling, std::memory_order_relaxed);
+    limiter.release.store(release.asSeconds(), std::memory_order_relaxed);
+    limiter.changed.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::setBypassed(std::size_t node, bool bypassed)
+{
+    m_impl->getNode(node).bypassed.store(bypassed, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool EffectChain::isBypassed(std::size_t node) const
+{
+    return m_impl->getNode(node).bypassed.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t EffectChain::getNodeCount() const
+{
+    return m_impl->nodes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+SoundSource::EffectProcessor EffectChain::getProcessor() const
+{
+    m_impl->processorCreated = true;
+
+    return [impl = m_impl](const float*  inputFrames,
+                           unsigned int& inputFrameCount,
+                           float*        outputFrames,
+                           unsigned int& outputFrameCount,
+                           unsigned int  frameChannelCount)
+    { impl->process(inputFrames, inputFrameCount, outputFrames, outputFrameCount, frameChannelCount); };
+}
+
+} // namespace sf
@@ -32,11 +32,19 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/Jobs.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Utils.hpp>
 
+#include <algorithm>
 #include <ostream>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstdint>
@@ -68,24 +76,47 @@ void InputSoundFile::StreamDeleter::operator()(InputStream* ptr) const
 ////////////////////////////////////////////////////////////
 std::optional<InputSoundFile> InputSoundFile::openFromFile(const std::filesystem::path& filename)
 {
-    // Find a suitable reader for the file type
-    auto reader = SoundFileFactory::createReaderFromFilename(filename);
-    if (!reader)
-        return std::nullopt;
-
-    // Wrap the file into a stream
+#ifdef SFML_SYSTEM_ANDROID
+    // Wrap the file into a stream, which also finds the assets of the application
     auto file = std::make_unique<FileInputStream>();
+#else
+    // Map the file into memory, so that the reader doesn't pay a system call for each of its small reads
+    auto file = std::make_unique<MappedFileInputStream>();
+#endif
 
-    // Open it
+    // Open it, once for both the detection of the format and the reader
     if (!file->open(filename))
+    {
+        err() << "Failed to open sound file (couldn't open stream)\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    // Find a suitable reader for the file type, trusting the extension of the file
+    auto reader = SoundFileFactory::createReaderFromStream(*file, filename);
+    if (!reader || (file->seek(0) != 0))
         return std::nullopt;
 
     // Pass the stream to the reader
     auto info = reader->open(*file);
     if (!info)
-        return std::nullopt;
+    {
+        // The extension may not match the contents, in which case the reader detected from the contents is tried
+        const auto isSameReader = [](const SoundFileReader& left, const SoundFileReader& right)
+        { return typeid(left) == typeid(right); };
+
+        auto detected = SoundFileFactory::createReaderFromStream(*file);
+        if (!detected || isSameReader(*detected, *reader) || (file->seek(0) != 0))
+            return std::nullopt;
+
+        reader = std::move(detected);
+        info   = reader->open(*file);
+        if (!info)
+            return std::nullopt;
+    }
 
-    return InputSoundFile(std::move(reader), std::move(file), info->sampleCount, info->sampleRate, std::move(info->channelMap));
+    InputSoundFile soundFile(std::move(reader), std::move(file), info->sampleCount, info->sampleRate, std::move(info->channelMap));
+    soundFile.m_filename = filename;
+    return soundFile;
 }
 
 
@@ -108,7 +139,10 @@ std::optional<InputSoundFile> InputSoundFile::openFromMemory(const void* data, s
     if (!info)
         return std::nullopt;
 
-    return InputSoundFile(std::move(reader), std::move(memory), info->sampleCount, info->sampleRate, std::move(info->channelMap));
+    InputSoundFile soundFile(std::move(reader), std::move(memory), info->sampleCount, info->sampleRate, std::move(info->channelMap));
+    soundFile.m_data     = data;
+    soundFile.m_dataSize = sizeInBytes;
+    return soundFile;
 }
 
 
@@ -230,6 +264,44 @@ std::uint64_t InputSoundFile::read(std::int16_t* samples, std::uint64_t maxCount
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t InputSoundFile::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_reader);
+
+    std::uint64_t readSamples = 0;
+    if (samples && maxCount)
+        readSamples = m_reader->readFloat(samples, maxCount);
+    m_sampleOffset += readSamples;
+    return readSamples;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t InputSoundFile::readInPlace(const float*& samples, std::uint64_t maxCount)
+{
+    assert(m_reader);
+
+    const std::uint64_t readSamples = m_reader->readFloatInPlace(samples, maxCount);
+    m_sampleOffset += readSamples;
+    return readSamples;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t InputSoundFile::readParallel(std::int16_t* samples, std::uint64_t maxCount, unsigned int threadCount)
+{
+    return readSegments(samples, maxCount, threadCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t InputSoundFile::readParallelFloat(float* samples, std::uint64_t maxCount, unsigned int threadCount)
+{
+    return readSegments(samples, maxCount, threadCount);
+}
+
+
 ////////////////////////////////////////////////////////////
 void InputSoundFile::close()
 {
@@ -252,4 +324,83 @@ m_channelMap(std::move(channelMap))
 {
 }
 
+
+////////////////////////////////////////////////////////////
+std::optional<InputSoundFile> InputSoundFile::reopen() const
+{
+    if (!m_filename.empty())
+        return openFromFile(m_filename);
+
+    if (m_data)
+        return openFromMemory(m_data, m_dataSize);
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::uint64_t InputSoundFile::readSegments(T* samples, std::uint64_t maxCount, unsigned int threadCount)
+{
+    assert(m_reader);
+
+    // The float functions are not overloads of the 16-bit ones, so pick the right one for the sample type
+    const auto readInto = [](InputSoundFile& file, T* destination, std::uint64_t destinationCount)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return file.readFloat(destination, destinationCount);
+        else
+            return file.read(destination, destinationCount);
+    };
+
+    const std::uint64_t channelCount = m_channelMap.size();
+    const std::uint64_t start        = m_sampleOffset;
+    const std::uint64_t count        = std::min(maxCount, m_sampleCount - start);
+
+    // Segments shorter than a quarter of a second are not worth the cost of opening and seeking another reader
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    const std::uint64_t minimumSegmentSize = std::max(std::uint64_t{m_sampleRate} * channelCount / 4, std::uint64_t{1});
+    const std::uint64_t maxSegmentCount    = count / minimumSegmentSize;
+    const auto          segmentCount = static_cast<unsigned int>(std::min(std::uint64_t{threadCount}, maxSegmentCount));
+
+    if (!samples || (channelCount == 0) || (segmentCount < 2) || (m_filename.empty() && !m_data))
+        return readInto(*this, samples, maxCount);
+
+    // Split the samples at frame boundaries, the last segment takes the remainder
+    const std::uint64_t segmentSize    = count / channelCount / segmentCount * channelCount;
+    const auto          getSegmentSize = [&](unsigned int index)
+    { return (index + 1 == segmentCount) ? count - index * segmentSize : segmentSize; };
+
+    std::vector<std::uint64_t> segmentsRead(segmentCount);
+
+    // The first segment is read with this file, which is already positioned at its beginning
+    priv::runJobs(segmentCount,
+                  [&](std::size_t job)
+                  {
+                      const auto index = static_cast<unsigned int>(job);
+                      if (index == 0)
+                      {
+                          segmentsRead[0] = readInto(*this, samples, getSegmentSize(0));
+                      }
+                      else if (auto file = reopen())
+                      {
+                          file->seek(start + index * segmentSize);
+                          segmentsRead[index] = readInto(*file, samples + index * segmentSize, getSegmentSize(index));
+                      }
+                  });
+
+    // Stop at the first incomplete segment, so that the samples read are contiguous
+    std::uint64_t readSamples = 0;
+    for (unsigned int i = 0; i < segmentCount; ++i)
+    {
+        readSamples += segmentsRead[i];
+        if (segmentsRead[i] < getSegmentSize(i))
+            break;
+    }
+
+    seek(start + readSamples);
+    return readSamples;
+}
+
 } // namespace sf
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBus.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
@@ -131,7 +132,11 @@ MiniaudioUtils::SoundBase::SoundBase(const ma_data_source_vtable&     dataSource
 ////////////////////////////////////////////////////////////
 MiniaudioUtils::SoundBase::~SoundBase()
 {
+    if (bus)
+        bus->detachSound(this);
+
     priv::AudioDevice::unregisterResource(resourceEntryIter);
+    priv::AudioDevice::cancelSpatialUpdates(&sound);
     ma_sound_uninit(&sound);
     ma_node_uninit(&effectNode, nullptr);
     ma_data_source_uninit(&dataSourceBase);
@@ -199,6 +204,7 @@ void MiniaudioUtils::SoundBase::initialize(ma_sound_end_proc endCallback)
 void MiniaudioUtils::SoundBase::deinitialize()
 {
     savedSettings = saveSettings(sound);
+    priv::AudioDevice::cancelSpatialUpdates(&sound);
     ma_sound_uninit(&sound);
     ma_node_uninit(&effectNode, nullptr);
 }
@@ -210,28 +216,12 @@ void MiniaudioUtils::SoundBase::processEffect(const float** framesIn,
                                               float**       framesOut,
                                               ma_uint32&    frameCountOut) const
 {
-    // If a processor is set, call it
-    if (effectProcessor)
-    {
-        if (!framesIn)
-            frameCountIn = 0;
-
-        effectProcessor(framesIn ? framesIn[0] : nullptr, frameCountIn, framesOut[0], frameCountOut, effectNode.channelCount);
-        return;
-    }
-
-    // Otherwise just pass the data through 1:1
-    if (framesIn == nullptr)
-    {
-        frameCountIn  = 0;
-        frameCountOut = 0;
-        return;
-    }
-
-    const auto toProcess = std::min(frameCountIn, frameCountOut);
-    std::memcpy(framesOut[0], framesIn[0], toProcess * effectNode.channelCount * sizeof(float));
-    frameCountIn  = toProcess;
-    frameCountOut = toProcess;
+    MiniaudioUtils::processEffect(effectProcessor,
+                                  effectNode.channelCount,
+                                  framesIn,
+                                  frameCountIn,
+                                  framesOut,
+                                  frameCountOut);
 }
 
 
@@ -248,8 +238,8 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
 
     if (connect)
     {
-        // Attach the custom effect node output to our engine endpoint
-        if (const ma_result result = ma_node_attach_output_bus(&effectNode, 0, ma_engine_get_endpoint(engine), 0);
+        // Attach the custom effect node output to the bus or the engine endpoint
+        if (const ma_result result = ma_node_attach_output_bus(&effectNode, 0, getOutputNode(*engine), 0);
             result != MA_SUCCESS)
         {
             err() << "Failed to attach effect node output to endpoint: " << ma_result_description(result) << std::endl;
@@ -266,8 +256,8 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
         }
     }
 
-    // Attach the sound output to the custom effect node or the engine endpoint
-    if (const ma_result result = ma_node_attach_output_bus(&sound, 0, connect ? &effectNode : ma_engine_get_endpoint(engine), 0);
+    // Attach the sound output to the custom effect node or the output node
+    if (const ma_result result = ma_node_attach_output_bus(&sound, 0, connect ? &effectNode : getOutputNode(*engine), 0);
         result != MA_SUCCESS)
     {
         err() << "Failed to attach sound node output to effect node: " << ma_result_description(result) << std::endl;
@@ -276,6 +266,68 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
 }
 
 
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::SoundBase::setBus(AudioBus* newBus)
+{
+    if (bus == newBus)
+        return;
+
+    if (bus)
+        bus->detachSound(this);
+
+    bus = newBus;
+
+    if (bus)
+        bus->attachSound(this);
+
+    // Route the sound (or its effect node) to the new output
+    connectEffect(bool{effectProcessor});
+}
+
+
+////////////////////////////////////////////////////////////
+ma_node* MiniaudioUtils::SoundBase::getOutputNode(ma_engine& engine) const
+{
+    if (bus)
+        return static_cast<ma_node*>(bus->getInputNode());
+
+    return ma_engine_get_endpoint(&engine);
+}
+
+
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::processEffect(const SoundSource::EffectProcessor& effectProcessor,
+                                   ma_uint32                           channelCount,
+                                   const float**                       framesIn,
+                                   ma_uint32&                          frameCountIn,
+                                   float**                             framesOut,
+                                   ma_uint32&                          frameCountOut)
+{
+    // If a processor is set, call it
+    if (effectProcessor)
+    {
+        if (!framesIn)
+            frameCountIn = 0;
+
+        effectProcessor(framesIn ? framesIn[0] : nullptr, frameCountIn, framesOut[0], frameCountOut, channelCount);
+        return;
+    }
+
+    // Otherwise just pass the data through 1:1
+    if (framesIn == nullptr)
+    {
+        frameCountIn  = 0;
+        frameCountOut = 0;
+        return;
+    }
+
+    const auto toProcess = std::min(frameCountIn, frameCountOut);
+    std::memcpy(framesOut[0], framesIn[0], toProcess * channelCount * sizeof(float));
+    frameCountIn  = toProcess;
+    frameCountOut = toProcess;
+}
+
+
 ////////////////////////////////////////////////////////////
 ma_channel MiniaudioUtils::soundChannelToMiniaudioChannel(SoundChannel soundChannel)
 {
@@ -80,6 +80,8 @@ struct SoundBase
     void deinitialize();
     void processEffect(const float** framesIn, ma_uint32& frameCountIn, float** framesOut, ma_uint32& frameCountOut) const;
     void connectEffect(bool connect);
+    void setBus(AudioBus* newBus);
+    [[nodiscard]] ma_node* getOutputNode(ma_engine& engine) const;
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -98,10 +100,18 @@ struct SoundBase
     ma_sound                sound{};         //!< The sound
     SoundSource::Status     status{SoundSource::Status::Stopped}; //!< The status
     SoundSource::EffectProcessor         effectProcessor;         //!< The effect processor
+    AudioBus*                            bus{};                   //!< The bus the sound outputs to, nullptr for the engine endpoint
     priv::AudioDevice::ResourceEntryIter resourceEntryIter; //!< Iterator to the resource entry registered with the AudioDevice
     priv::MiniaudioUtils::SavedSettings savedSettings; //!< Saved settings used to restore ma_sound state in case we need to recreate it
 };
 
+void processEffect(const SoundSource::EffectProcessor& effectProcessor,
+                   ma_uint32                           channelCount,
+                   const float**                       framesIn,
+                   ma_uint32&                          frameCountIn,
+                   float**                             framesOut,
+                   ma_uint32&                          frameCountOut);
+
 [[nodiscard]] ma_channel   soundChannelToMiniaudioChannel(SoundChannel soundChannel);
 [[nodiscard]] SoundChannel miniaudioChannelToSoundChannel(ma_channel soundChannel);
 [[nodiscard]] Time         getPlayingOffset(ma_sound& sound);
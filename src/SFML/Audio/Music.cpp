@@ -31,8 +31,8 @@
 #include <SFML/System/Time.hpp>
 
 #include <algorithm>
-#include <mutex>
 #include <ostream>
+#include <utility>
 
 #include <cassert>
 
@@ -50,8 +50,9 @@ Music::~Music()
 ////////////////////////////////////////////////////////////
 bool Music::openFromFile(const std::filesystem::path& filename)
 {
-    // First stop the music if it was already running
+    // First stop the music if it was already running, and forget the tracks queued after it
     stop();
+    clearQueue();
 
     // Open the underlying sound file
     m_file = sf::InputSoundFile::openFromFile(filename);
@@ -68,8 +69,9 @@ bool Music::openFromFile(const std::filesystem::path& filename)
 ////////////////////////////////////////////////////////////
 bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
 {
-    // First stop the music if it was already running
+    // First stop the music if it was already running, and forget the tracks queued after it
     stop();
+    clearQueue();
 
     // Open the underlying sound file
     m_file = sf::InputSoundFile::openFromMemory(data, sizeInBytes);
@@ -86,8 +88,9 @@ bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
 ////////////////////////////////////////////////////////////
 bool Music::openFromStream(InputStream& stream)
 {
-    // First stop the music if it was already running
+    // First stop the music if it was already running, and forget the tracks queued after it
     stop();
+    clearQueue();
 
     // Open the underlying sound file
     m_file = sf::InputSoundFile::openFromStream(stream);
@@ -104,6 +107,9 @@ bool Music::openFromStream(InputStream& stream)
 ////////////////////////////////////////////////////////////
 Time Music::getDuration() const
 {
+    // The file may be replaced by a queued track at any time
+    const std::lock_guard lock(m_queueMutex);
+
     assert(m_file && "Music::getDuration() Cannot get duration until music is opened");
     return m_file->getDuration();
 }
@@ -176,12 +182,75 @@ void Music::setLoopPoints(TimeSpan timePoints)
 }
 
 
+////////////////////////////////////////////////////////////
+template <typename OpenFunction>
+void Music::queue(OpenFunction open)
+{
+    auto track = std::async(std::launch::async,
+                            [open]() -> std::optional<QueuedTrack>
+                            {
+                                std::optional<InputSoundFile> file = open();
+                                if (!file)
+                                    return std::nullopt;
+
+                                // Decode the first second now, so that the track starts without reading the file
+                                const std::size_t  size = std::size_t{file->getSampleRate()} * file->getChannelCount();
+                                std::vector<float> samples(size);
+                                const auto         count = static_cast<std::size_t>(
+                                    file->readFloat(samples.data(), size));
+                                return QueuedTrack{std::move(*file), std::move(samples), count};
+                            });
+
+    const std::lock_guard lock(m_queueMutex);
+    m_queue.push_back(std::move(track));
+}
+
+
+////////////////////////////////////////////////////////////
+void Music::queueFromFile(const std::filesystem::path& filename)
+{
+    queue([filename] { return InputSoundFile::openFromFile(filename); });
+}
+
+
+////////////////////////////////////////////////////////////
+void Music::queueFromMemory(const void* data, std::size_t sizeInBytes)
+{
+    queue([data, sizeInBytes] { return InputSoundFile::openFromMemory(data, sizeInBytes); });
+}
+
+
+////////////////////////////////////////////////////////////
+void Music::clearQueue()
+{
+    // Destroy the tracks out of the lock, as their destructor waits for the worker threads
+    std::deque<std::future<std::optional<QueuedTrack>>> tracks;
+
+    const std::lock_guard lock(m_queueMutex);
+    tracks.swap(m_queue);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Music::getQueueSize() const
+{
+    const std::lock_guard lock(m_queueMutex);
+    return m_queue.size();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Music::onGetData(SoundStream::Chunk& data)
 {
     assert(m_file && "Music::onGetData() Cannot perform operation until music is opened");
 
-    const std::lock_guard lock(m_mutex);
+    // The beginning of a queued track was decoded ahead of time
+    if (m_prefetched > 0)
+    {
+        data.floatSamples = m_samples.data();
+        data.sampleCount  = std::exchange(m_prefetched, 0);
+        return m_file->getSampleOffset() < m_file->getSampleCount();
+    }
 
     std::size_t         toFill        = m_samples.size();
     std::uint64_t       currentOffset = m_file->getSampleOffset();
@@ -193,9 +262,16 @@ bool Music::onGetData(SoundStream::Chunk& data)
     if (getLoop() && (m_loopSpan.length != 0) && (currentOffset <= loopEnd) && (currentOffset + toFill > loopEnd))
         toFill = static_cast<std::size_t>(loopEnd - currentOffset);
 
-    // Fill the chunk parameters
-    data.samples     = m_samples.data();
-    data.sampleCount = static_cast<std::size_t>(m_file->read(m_samples.data(), toFill));
+    // Fill the chunk parameters, files storing floating point samples are streamed without any copy
+    const float* samples = nullptr;
+    data.sampleCount     = static_cast<std::size_t>(m_file->readInPlace(samples, toFill));
+    if (!samples)
+    {
+        samples          = m_samples.data();
+        data.sampleCount = static_cast<std::size_t>(m_file->readFloat(m_samples.data(), toFill));
+    }
+
+    data.floatSamples = samples;
     currentOffset += data.sampleCount;
 
     // Check if we have stopped obtaining samples or reached either the EOF or the loop end point
@@ -209,7 +285,7 @@ void Music::onSeek(Time timeOffset)
 {
     assert(m_file && "Music::onSeek() Cannot perform operation until music is opened");
 
-    const std::lock_guard lock(m_mutex);
+    m_prefetched = 0;
     m_file->seek(timeOffset);
 }
 
@@ -219,9 +295,12 @@ std::optional<std::uint64_t> Music::onLoop()
 {
     assert(m_file && "Music::onLoop() Cannot perform operation until music is opened");
 
+    // A queued track takes over from the loop
+    if (const auto position = startQueuedTrack())
+        return position;
+
     // Called by underlying SoundStream so we can determine where to loop.
-    const std::lock_guard lock(m_mutex);
-    const std::uint64_t   currentOffset = m_file->getSampleOffset();
+    const std::uint64_t currentOffset = m_file->getSampleOffset();
     if (getLoop() && (m_loopSpan.length != 0) && (currentOffset == m_loopSpan.offset + m_loopSpan.length))
     {
         // Looping is enabled, and either we're at the loop end, or we're at the EOF
@@ -239,6 +318,53 @@ std::optional<std::uint64_t> Music::onLoop()
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<std::uint64_t> Music::onEnd()
+{
+    return startQueuedTrack();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::uint64_t> Music::startQueuedTrack()
+{
+    for (;;)
+    {
+        std::future<std::optional<QueuedTrack>> next;
+        {
+            const std::lock_guard lock(m_queueMutex);
+            if (m_queue.empty())
+                return std::nullopt;
+
+            next = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // The track is usually ready long before, waiting only happens if it was queued at the last moment
+        std::optional<QueuedTrack> track = next.get();
+        if (!track)
+            continue;
+
+        // The stream can't change its format while playing
+        if (track->file.getChannelCount() != getChannelCount() || track->file.getSampleRate() != getSampleRate() ||
+            track->file.getChannelMap() != getChannelMap())
+        {
+            err() << "Failed to play queued music, its sample rate and channels differ from the current music"
+                  << std::endl;
+            continue;
+        }
+
+        const std::lock_guard lock(m_queueMutex);
+        m_file            = std::move(track->file);
+        m_samples         = std::move(track->samples);
+        m_prefetched      = track->sampleCount;
+        m_loopSpan.offset = 0;
+        m_loopSpan.length = m_file->getSampleCount();
+        return 0;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Music::initialize()
 {
@@ -249,8 +375,11 @@ void Music::initialize()
     // Resize the internal buffer so that it can contain 1 second of audio samples
     m_samples.resize(m_file->getSampleRate() * m_file->getChannelCount());
 
-    // Initialize the stream
-    SoundStream::initialize(m_file->getChannelCount(), m_file->getSampleRate(), m_file->getChannelMap());
+    // Initialize the stream, with floating point samples so that they reach the mixer without any conversion
+    SoundStream::initialize(m_file->getChannelCount(),
+                            m_file->getSampleRate(),
+                            m_file->getChannelMap(),
+                            SampleFormat::Float32);
 }
 
 ////////////////////////////////////////////////////////////
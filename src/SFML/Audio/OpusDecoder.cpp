@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/OpusDecoder.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#ifdef SFML_USE_OPUS
+#include <opus.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <ostream>
+
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace OpusDecoderImpl
+{
+#ifdef SFML_USE_OPUS
+// Opus packets hold at most 120 milliseconds of sound
+constexpr std::size_t maxPacketDuration = 120;
+#endif
+
+bool isSupportedFormat(unsigned int sampleRate, unsigned int channelCount)
+{
+    constexpr unsigned int sampleRates[] = {8000, 12000, 16000, 24000, 48000};
+    return std::find(std::begin(sampleRates), std::end(sampleRates), sampleRate) != std::end(sampleRates) &&
+           (channelCount == 1 || channelCount == 2);
+}
+} // namespace OpusDecoderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct OpusDecoder::Impl
+{
+#ifdef SFML_USE_OPUS
+    ~Impl()
+    {
+        if (decoder)
+            opus_decoder_destroy(decoder);
+    }
+
+    ::OpusDecoder* decoder{}; //!< libopus decoder
+#endif
+    unsigned int sampleRate{};   //!< Sample rate of the decoded samples
+    unsigned int channelCount{}; //!< Number of channels of the decoded samples
+};
+
+
+////////////////////////////////////////////////////////////
+bool OpusDecoder::isAvailable()
+{
+#ifdef SFML_USE_OPUS
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<OpusDecoder> OpusDecoder::create(unsigned int sampleRate, unsigned int channelCount)
+{
+    if (!OpusDecoderImpl::isSupportedFormat(sampleRate, channelCount))
+    {
+        err() << "Failed to create Opus decoder (unsupported format: " << sampleRate << " Hz, " << channelCount
+              << " channels)" << std::endl;
+        return std::nullopt;
+    }
+
+#ifdef SFML_USE_OPUS
+    auto impl          = std::make_unique<Impl>();
+    impl->sampleRate   = sampleRate;
+    impl->channelCount = channelCount;
+
+    int error     = OPUS_OK;
+    impl->decoder = opus_decoder_create(static_cast<opus_int32>(sampleRate), static_cast<int>(channelCount), &error);
+    if (error != OPUS_OK)
+    {
+        impl->decoder = nullptr;
+        err() << "Failed to create Opus decoder (" << opus_strerror(error) << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    return OpusDecoder(std::move(impl));
+#else
+    err() << "Failed to create Opus decoder (SFML was built without Opus support, see SFML_USE_OPUS)" << std::endl;
+    return std::nullopt;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+OpusDecoder::OpusDecoder(std::unique_ptr<Impl> impl) : m_impl(std::move(impl))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+OpusDecoder::~OpusDecoder() = default;
+
+
+////////////////////////////////////////////////////////////
+OpusDecoder::OpusDecoder(OpusDecoder&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+OpusDecoder& OpusDecoder::operator=(OpusDecoder&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+unsigned int OpusDecoder::getSampleRate() const
+{
+    return m_impl->sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int OpusDecoder::getChannelCount() const
+{
+    return m_impl->channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+bool OpusDecoder::decode(const void* data, std::size_t sizeInBytes, std::vector<std::int16_t>& samples)
+{
+    assert((data || sizeInBytes == 0) && "Packet to decode is missing");
+
+#ifdef SFML_USE_OPUS
+    // A null packet would trigger the loss concealment, an empty packet is invalid
+    if (sizeInBytes == 0)
+        return false;
+
+    // Make room for the largest packet, then shrink to the actual count
+    const std::size_t offset   = samples.size();
+    const std::size_t maxCount = std::size_t{m_impl->sampleRate} * OpusDecoderImpl::maxPacketDuration / 1000;
+    samples.resize(offset + maxCount * m_impl->channelCount);
+
+    const int frameCount = opus_decode(m_impl->decoder,
+                                       static_cast<const unsigned char*>(data),
+                                       static_cast<opus_int32>(sizeInBytes),
+                                       samples.data() + offset,
+                                       static_cast<int>(maxCount),
+                                       0);
+    if (frameCount < 0)
+    {
+        samples.resize(offset);
+        return false;
+    }
+
+    samples.resize(offset + static_cast<std::size_t>(frameCount) * m_impl->channelCount);
+    return true;
+#else
+    (void)samples;
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void OpusDecoder::decodeLost(std::vector<std::int16_t>& samples)
+{
+#ifdef SFML_USE_OPUS
+    // Conceal as many samples as in the last packet, 20 milliseconds if nothing was decoded yet
+    opus_int32 frameCount = 0;
+    opus_decoder_ctl(m_impl->decoder, OPUS_GET_LAST_PACKET_DURATION(&frameCount));
+    if (frameCount <= 0)
+        frameCount = static_cast<opus_int32>(m_impl->sampleRate / 50);
+
+    const std::size_t offset = samples.size();
+    samples.resize(offset + static_cast<std::size_t>(frameCount) * m_impl->channelCount);
+
+    const int decoded = opus_decode(m_impl->decoder, nullptr, 0, samples.data() + offset, frameCount, 0);
+    samples.resize(offset + static_cast<std::size_t>(std::max(decoded, 0)) * m_impl->channelCount);
+#else
+    (void)samples;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void OpusDecoder::reset()
+{
+#ifdef SFML_USE_OPUS
+    opus_decoder_ctl(m_impl->decoder, OPUS_RESET_STATE);
+#endif
+}
+
+} // namespace sf
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/OpusEncoder.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#ifdef SFML_USE_OPUS
+#include <opus.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <ostream>
+
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace OpusEncoderImpl
+{
+#ifdef SFML_USE_OPUS
+// Opus packets may not be larger than this, whatever the bitrate
+constexpr std::size_t maxPacketSize = 1275;
+#endif
+
+bool isSupportedFormat(unsigned int sampleRate, unsigned int channelCount)
+{
+    constexpr unsigned int sampleRates[] = {8000, 12000, 16000, 24000, 48000};
+    return std::find(std::begin(sampleRates), std::end(sampleRates), sampleRate) != std::end(sampleRates) &&
+           (channelCount == 1 || channelCount == 2);
+}
+} // namespace OpusEncoderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct OpusEncoder::Impl
+{
+#ifdef SFML_USE_OPUS
+    ~Impl()
+    {
+        if (encoder)
+            opus_encoder_destroy(encoder);
+    }
+
+    ::OpusEncoder* encoder{}; //!< libopus encoder
+#endif
+    unsigned int              sampleRate{};   //!< Sample rate of the encoded samples
+    unsigned int              channelCount{}; //!< Number of channels of the encoded samples
+    std::vector<std::int16_t> samples;        //!< Samples pushed but not encoded yet
+};
+
+
+////////////////////////////////////////////////////////////
+bool OpusEncoder::isAvailable()
+{
+#ifdef SFML_USE_OPUS
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<OpusEncoder> OpusEncoder::create(unsigned int sampleRate,
+                                               unsigned int channelCount,
+                                               Application  application)
+{
+    if (!OpusEncoderImpl::isSupportedFormat(sampleRate, channelCount))
+    {
+        err() << "Failed to create Opus encoder (unsupported format: " << sampleRate << " Hz, " << channelCount
+              << " channels)" << std::endl;
+        return std::nullopt;
+    }
+
+#ifdef SFML_USE_OPUS
+    int opusApplication = OPUS_APPLICATION_VOIP;
+    switch (application)
+    {
+        case Application::Voip:
+            opusApplication = OPUS_APPLICATION_VOIP;
+            break;
+        case Application::Audio:
+            opusApplication = OPUS_APPLICATION_AUDIO;
+            break;
+        case Application::LowDelay:
+            opusApplication = OPUS_APPLICATION_RESTRICTED_LOWDELAY;
+            break;
+    }
+
+    auto impl          = std::make_unique<Impl>();
+    impl->sampleRate   = sampleRate;
+    impl->channelCount = channelCount;
+
+    int error     = OPUS_OK;
+    impl->encoder = opus_encoder_create(static_cast<opus_int32>(sampleRate),
+                                        static_cast<int>(channelCount),
+                                        opusApplication,
+                                        &error);
+    if (error != OPUS_OK)
+    {
+        impl->encoder = nullptr;
+        err() << "Failed to create Opus encoder (" << opus_strerror(error) << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    return OpusEncoder(std::move(impl));
+#else
+    (void)application;
+    err() << "Failed to create Opus encoder (SFML was built without Opus support, see SFML_USE_OPUS)" << std::endl;
+    return std::nullopt;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+OpusEncoder::OpusEncoder(std::unique_ptr<Impl> impl) : m_impl(std::move(impl))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+OpusEncoder::~OpusEncoder() = default;
+
+
+////////////////////////////////////////////////////////////
+OpusEncoder::OpusEncoder(OpusEncoder&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+OpusEncoder& OpusEncoder::operator=(OpusEncoder&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void OpusEncoder::setBitrate(unsigned int bitrate)
+{
+#ifdef SFML_USE_OPUS
+    opus_encoder_ctl(m_impl->encoder, OPUS_SET_BITRATE(static_cast<opus_int32>(bitrate)));
+#else
+    (void)bitrate;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int OpusEncoder::getSampleRate() const
+{
+    return m_impl->sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int OpusEncoder::getChannelCount() const
+{
+    return m_impl->channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t OpusEncoder::getPacketSampleCount() const
+{
+    // 20 milliseconds of sound
+    return std::size_t{m_impl->sampleRate} / 50 * m_impl->channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void OpusEncoder::pushSamples(const std::int16_t* samples, std::size_t sampleCount)
+{
+    assert((samples || sampleCount == 0) && "Samples to encode are missing");
+    m_impl->samples.insert(m_impl->samples.end(), samples, samples + sampleCount);
+}
+
+
+////////////////////////////////////////////////////////////
+bool OpusEncoder::popPacket(std::vector<std::byte>& packet)
+{
+    const std::size_t sampleCount = getPacketSampleCount();
+    if (m_impl->samples.size() < sampleCount)
+        return false;
+
+#ifdef SFML_USE_OPUS
+    packet.resize(OpusEncoderImpl::maxPacketSize);
+    const opus_int32 size = opus_encode(m_impl->encoder,
+                                        m_impl->samples.data(),
+                                        static_cast<int>(sampleCount / m_impl->channelCount),
+                                        reinterpret_cast<unsigned char*>(packet.data()),
+                                        static_cast<opus_int32>(packet.size()));
+    m_impl->samples.erase(m_impl->samples.begin(), m_impl->samples.begin() + static_cast<std::ptrdiff_t>(sampleCount));
+    if (size < 0)
+    {
+        err() << "Failed to encode Opus packet (" << opus_strerror(size) << ")" << std::endl;
+        packet.clear();
+        return false;
+    }
+
+    packet.resize(static_cast<std::size_t>(size));
+    return true;
+#else
+    (void)packet;
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void OpusEncoder::flush()
+{
+    const std::size_t sampleCount = getPacketSampleCount();
+    const std::size_t remainder   = m_impl->samples.size() % sampleCount;
+    if (remainder != 0)
+        m_impl->samples.resize(m_impl->samples.size() + sampleCount - remainder, 0);
+}
+
+} // namespace sf
@@ -29,11 +29,171 @@
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include <SFML/Audio/SoundFileWriter.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 #include <cassert>
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct OutputSoundFile::AsyncWriter
+{
+    AsyncWriter(std::unique_ptr<SoundFileWriter>&& fileWriter, std::size_t capacity, OverflowPolicy overflowPolicy) :
+    writer(std::move(fileWriter)),
+    policy(overflowPolicy)
+    {
+        // The ring size is a power of two, so that the indices can wrap around freely
+        std::size_t size = 1;
+        while (size < capacity)
+            size *= 2;
+        ring.resize(size);
+
+        thread = std::thread(&AsyncWriter::run, this);
+    }
+
+    ~AsyncWriter()
+    {
+        // The encoder thread drains the queue before it exits
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_one();
+        thread.join();
+    }
+
+    void push(const std::int16_t* samples, std::uint64_t count)
+    {
+        bool stalled = false;
+        while (count > 0)
+        {
+            const std::size_t write = writeIndex.load(std::memory_order_relaxed);
+            const std::size_t read  = readIndex.load(std::memory_order_acquire);
+            const std::size_t room  = ring.size() - (write - read);
+            if (room == 0)
+            {
+                if (policy == OverflowPolicy::Drop)
+                {
+                    droppedSampleCount.fetch_add(count, std::memory_order_relaxed);
+                    break;
+                }
+
+                // Wait for the encoder thread to make room
+                if (!stalled)
+                    stallCount.fetch_add(1, std::memory_order_relaxed);
+                stalled = true;
+                wakeUp.notify_one();
+                std::this_thread::yield();
+                continue;
+            }
+
+            const auto        sampleCount = static_cast<std::size_t>(std::min<std::uint64_t>(count, room));
+            const std::size_t position    = write & (ring.size() - 1);
+            const std::size_t first       = std::min(sampleCount, ring.size() - position);
+            std::copy(samples, samples + first, ring.begin() + static_cast<std::ptrdiff_t>(position));
+            std::copy(samples + first, samples + sampleCount, ring.begin());
+            writeIndex.store(write + sampleCount, std::memory_order_release);
+
+            // Only this thread writes the peak, no need for a compare-exchange
+            const std::size_t queued = write + sampleCount - read;
+            if (queued > peakQueuedSampleCount.load(std::memory_order_relaxed))
+                peakQueuedSampleCount.store(queued, std::memory_order_relaxed);
+
+            samples += sampleCount;
+            count -= sampleCount;
+        }
+
+        // Only pay for the notification when the encoder thread is waiting
+        if (sleeping.load(std::memory_order_acquire))
+            wakeUp.notify_one();
+    }
+
+    std::future<void> flush()
+    {
+        std::promise<void> promise;
+        std::future<void>  future = promise.get_future();
+        {
+            const std::lock_guard lock(mutex);
+            flushes.emplace_back(writeIndex.load(std::memory_order_relaxed), std::move(promise));
+        }
+        wakeUp.notify_one();
+        return future;
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            // Encode the samples straight from the ring, one contiguous range at a time
+            const std::size_t read  = readIndex.load(std::memory_order_relaxed);
+            const std::size_t write = writeIndex.load(std::memory_order_acquire);
+            if (write != read)
+            {
+                const std::size_t position    = read & (ring.size() - 1);
+                const std::size_t sampleCount = std::min(write - read, ring.size() - position);
+                writer->write(ring.data() + position, sampleCount);
+                readIndex.store(read + sampleCount, std::memory_order_release);
+                encodedSampleCount.fetch_add(sampleCount, std::memory_order_relaxed);
+                continue;
+            }
+
+            // The queue is empty: complete the flushes of the samples encoded so far
+            std::unique_lock lock(mutex);
+            const auto completed = std::partition(flushes.begin(),
+                                                  flushes.end(),
+                                                  [read](const Flush& flush) { return flush.first > read; });
+            for (auto it = completed; it != flushes.end(); ++it)
+                it->second.set_value();
+            flushes.erase(completed, flushes.end());
+
+            if (stopping)
+                break;
+
+            // The timeout covers a notification sent right before the flag is raised
+            sleeping.store(true, std::memory_order_release);
+            wakeUp.wait_for(lock,
+                            std::chrono::milliseconds(10),
+                            [this, read] {
+                                return stopping || !flushes.empty() ||
+                                       writeIndex.load(std::memory_order_acquire) != read;
+                            });
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using Flush = std::pair<std::size_t, std::promise<void>>; //!< Write index waited for, and promise to fulfill
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<SoundFileWriter>     writer;                  //!< Writer of the file format
+    OverflowPolicy                       policy;                  //!< What push does when the ring is full
+    std::vector<std::int16_t>            ring;                    //!< Ring buffer of the queued samples
+    alignas(64) std::atomic<std::size_t> readIndex{};             //!< Number of samples encoded, wraps around
+    alignas(64) std::atomic<std::size_t> writeIndex{};            //!< Number of samples queued, wraps around
+    std::atomic<std::size_t>             peakQueuedSampleCount{}; //!< Highest number of samples in the ring
+    std::atomic<std::uint64_t>           encodedSampleCount{};    //!< Number of samples given to the writer
+    std::atomic<std::uint64_t>           stallCount{};            //!< Number of pushes that waited for room
+    std::atomic<std::uint64_t>           droppedSampleCount{};    //!< Number of samples dropped by pushes
+    std::atomic<bool>                    sleeping{};              //!< Whether the encoder thread waits for samples
+    std::mutex                           mutex;                   //!< Protects the flushes and the stop request
+    std::condition_variable              wakeUp;                  //!< Wakes the encoder thread up
+    std::vector<Flush>                   flushes;                 //!< Pending flushes
+    bool                                 stopping{};              //!< Whether the encoder thread must exit when idle
+    std::thread                          thread;                  //!< Encoder thread
+};
+
+
 ////////////////////////////////////////////////////////////
 std::optional<OutputSoundFile> OutputSoundFile::openFromFile(
     const std::filesystem::path&     filename,
@@ -56,20 +216,86 @@ std::optional<OutputSoundFile> OutputSoundFile::openFromFile(
 }
 
 
+////////////////////////////////////////////////////////////
+OutputSoundFile::~OutputSoundFile() = default;
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile::OutputSoundFile(OutputSoundFile&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile& OutputSoundFile::operator=(OutputSoundFile&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void OutputSoundFile::startAsyncWriting(std::size_t queueCapacity, OverflowPolicy overflowPolicy)
+{
+    assert(queueCapacity > 0 && "OutputSoundFile::startAsyncWriting() Queue capacity must be positive");
+
+    // The encoder thread takes ownership of the writer
+    if (m_writer)
+        m_async = std::make_unique<AsyncWriter>(std::move(m_writer), queueCapacity, overflowPolicy);
+}
+
+
+////////////////////////////////////////////////////////////
+bool OutputSoundFile::isAsync() const
+{
+    return m_async != nullptr;
+}
+
+
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::write(const std::int16_t* samples, std::uint64_t count)
 {
-    assert(m_writer);
+    assert(m_writer || m_async);
 
-    if (samples && count)
+    if (!samples || !count)
+        return;
+
+    if (m_async)
+        m_async->push(samples, count);
+    else
         m_writer->write(samples, count);
 }
 
 
+////////////////////////////////////////////////////////////
+std::future<void> OutputSoundFile::flush()
+{
+    if (m_async)
+        return m_async->flush();
+
+    // Synchronous files encode the samples as they are written
+    std::promise<void> promise;
+    promise.set_value();
+    return promise.get_future();
+}
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile::AsyncStatistics OutputSoundFile::getAsyncStatistics() const
+{
+    AsyncStatistics statistics;
+    if (m_async)
+    {
+        statistics.queuedSampleCount     = m_async->writeIndex.load(std::memory_order_relaxed) -
+                                       m_async->readIndex.load(std::memory_order_relaxed);
+        statistics.peakQueuedSampleCount = m_async->peakQueuedSampleCount.load(std::memory_order_relaxed);
+        statistics.encodedSampleCount    = m_async->encodedSampleCount.load(std::memory_order_relaxed);
+        statistics.stallCount            = m_async->stallCount.load(std::memory_order_relaxed);
+        statistics.droppedSampleCount    = m_async->droppedSampleCount.load(std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::close()
 {
-    // Destroy the reader
+    // Drain the queue, then destroy the writer
+    m_async.reset();
     m_writer.reset();
 }
 
@@ -80,4 +80,53 @@ std::optional<std::string> getDevice()
     return priv::AudioDevice::getDevice();
 }
 
+
+////////////////////////////////////////////////////////////
+bool setSettings(const Settings& settings)
+{
+    return priv::AudioDevice::setSettings(settings);
+}
+
+
+////////////////////////////////////////////////////////////
+Settings getSettings()
+{
+    return priv::AudioDevice::getSettings();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Settings> getActiveSettings()
+{
+    return priv::AudioDevice::getActiveSettings();
+}
+
+
+////////////////////////////////////////////////////////////
+Time getLatency()
+{
+    return priv::AudioDevice::getLatency();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t getClock()
+{
+    return priv::AudioDevice::getClock();
+}
+
+
+////////////////////////////////////////////////////////////
+Statistics getStatistics()
+{
+    return priv::AudioDevice::getStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+void resetStatistics()
+{
+    priv::AudioDevice::resetStatistics();
+}
+
 } // namespace sf::PlaybackDevice
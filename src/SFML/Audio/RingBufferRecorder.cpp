@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/RingBufferRecorder.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RingBufferRecorderImpl
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+void pushSamples(std::vector<T>&                 ring,
+                 std::atomic<std::size_t>&       writeIndex,
+                 const std::atomic<std::size_t>& readIndex,
+                 std::atomic<std::uint64_t>&     overrunCount,
+                 const T*                        samples,
+                 std::size_t                     sampleCount)
+{
+    const std::size_t write = writeIndex.load(std::memory_order_relaxed);
+    const std::size_t read  = readIndex.load(std::memory_order_acquire);
+    const std::size_t count = std::min(sampleCount, ring.size() - (write - read));
+
+    // The ring size is a power of two, so the position wraps around with a mask
+    const std::size_t position = write & (ring.size() - 1);
+    const std::size_t first    = std::min(count, ring.size() - position);
+    std::copy(samples, samples + first, ring.begin() + static_cast<std::ptrdiff_t>(position));
+    std::copy(samples + first, samples + count, ring.begin());
+
+    writeIndex.store(write + count, std::memory_order_release);
+
+    // Drop the samples that don't fit rather than waiting for the reader
+    if (count < sampleCount)
+        overrunCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t popSamples(const std::vector<T>&           ring,
+                       std::atomic<std::size_t>&       readIndex,
+                       const std::atomic<std::size_t>& writeIndex,
+                       T*                              samples,
+                       std::size_t                     maxCount)
+{
+    const std::size_t read  = readIndex.load(std::memory_order_relaxed);
+    const std::size_t write = writeIndex.load(std::memory_order_acquire);
+    const std::size_t count = std::min(maxCount, write - read);
+
+    const std::size_t position = read & (ring.size() - 1);
+    const std::size_t first    = std::min(count, ring.size() - position);
+    const auto        begin    = ring.begin() + static_cast<std::ptrdiff_t>(position);
+    std::copy(begin, begin + static_cast<std::ptrdiff_t>(first), samples);
+    std::copy(ring.begin(), ring.begin() + static_cast<std::ptrdiff_t>(count - first), samples + first);
+
+    readIndex.store(read + count, std::memory_order_release);
+
+    return count;
+}
+} // namespace RingBufferRecorderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RingBufferRecorder::RingBufferRecorder(Time capacity) : m_capacity(capacity)
+{
+    assert(capacity > Time::Zero && "RingBufferRecorder::RingBufferRecorder() Capacity must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+RingBufferRecorder::~RingBufferRecorder()
+{
+    // Make sure to stop the recording thread
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RingBufferRecorder::read(std::int16_t* samples, std::size_t maxCount)
+{
+    assert(getSampleFormat() == SampleFormat::Int16 &&
+           "RingBufferRecorder::read() The recorder doesn't capture 16-bit samples");
+
+    if (m_samples.empty())
+        return 0;
+
+    return RingBufferRecorderImpl::popSamples(m_samples, m_readIndex, m_writeIndex, samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RingBufferRecorder::read(float* samples, std::size_t maxCount)
+{
+    assert(getSampleFormat() == SampleFormat::Float32 &&
+           "RingBufferRecorder::read() The recorder doesn't capture floating point samples");
+
+    if (m_floatSamples.empty())
+        return 0;
+
+    return RingBufferRecorderImpl::popSamples(m_floatSamples, m_readIndex, m_writeIndex, samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RingBufferRecorder::getAvailableSampleCount() const
+{
+    return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t RingBufferRecorder::getOverrunCount() const
+{
+    return m_overrunCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RingBufferRecorder::onStart()
+{
+    // Round the capacity up to a power of two, so that indices can wrap around freely
+    const double samplesPerSecond = static_cast<double>(getSampleRate()) * getChannelCount();
+    const double capacitySeconds  = static_cast<double>(m_capacity.asSeconds());
+    const auto   requested        = static_cast<std::size_t>(std::ceil(capacitySeconds * samplesPerSecond));
+    std::size_t  size             = 1;
+    while (size < requested)
+        size *= 2;
+
+    // Only allocate the ring matching the captured format
+    m_samples.clear();
+    m_floatSamples.clear();
+    if (getSampleFormat() == SampleFormat::Float32)
+        m_floatSamples.resize(size);
+    else
+        m_samples.resize(size);
+
+    m_readIndex.store(0, std::memory_order_relaxed);
+    m_writeIndex.store(0, std::memory_order_relaxed);
+    m_overrunCount.store(0, std::memory_order_relaxed);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RingBufferRecorder::onProcessSamples(const std::int16_t* samples, std::size_t sampleCount)
+{
+    RingBufferRecorderImpl::pushSamples(m_samples, m_writeIndex, m_readIndex, m_overrunCount, samples, sampleCount);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RingBufferRecorder::onProcessFloatSamples(const float* samples, std::size_t sampleCount)
+{
+    RingBufferRecorderImpl::pushSamples(m_floatSamples,
+                                        m_writeIndex,
+                                        m_readIndex,
+                                        m_overrunCount,
+                                        samples,
+                                        sampleCount);
+
+    return true;
+}
+
+} // namespace sf
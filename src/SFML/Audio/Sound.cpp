@@ -25,6 +25,9 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/CompressedSoundBuffer.hpp>
+#include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
@@ -34,6 +37,8 @@
 #include <miniaudio.h>
 
 #include <algorithm>
+#include <limits>
+#include <optional>
 #include <ostream>
 #include <vector>
 
@@ -54,13 +59,14 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
     void initialize()
     {
         SoundBase::initialize(onEnd);
+        stopTime = noStopTime;
 
         // Because we are providing a custom data source, we have to provide the channel map ourselves
-        if (buffer && !buffer->getChannelMap().empty())
+        if (const std::vector<SoundChannel> channelMap = getChannelMap(); !channelMap.empty())
         {
             soundChannelMap.clear();
 
-            for (const SoundChannel channel : buffer->getChannelMap())
+            for (const SoundChannel channel : channelMap)
             {
                 soundChannelMap.push_back(priv::MiniaudioUtils::soundChannelToMiniaudioChannel(channel));
             }
@@ -71,6 +77,112 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
         {
             sound.engineNode.spatializer.pChannelMapIn = nullptr;
         }
+
+        // Remember which buffer format the data source was created for, so that buffers
+        // with the same format can later be swapped in without recreating the sound
+        initializedChannelCount = getChannelCount();
+        initializedSampleRate   = getSampleRate();
+        initializedSampleFormat = getSampleFormat();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether a buffer can be played without recreating the sound
+    ///
+    /// \param channelCount Channel count of the buffer
+    /// \param sampleRate   Sample rate of the buffer
+    /// \param sampleFormat Sample format of the buffer
+    /// \param channelMap   Channel map of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isInitializedFor(unsigned int                     channelCount,
+                          unsigned int                     sampleRate,
+                          SampleFormat                     sampleFormat,
+                          const std::vector<SoundChannel>& channelMap) const
+    {
+        if ((initializedChannelCount == 0) || (channelCount != initializedChannelCount) ||
+            (sampleRate != initializedSampleRate) || (sampleFormat != initializedSampleFormat))
+            return false;
+
+        return std::equal(channelMap.begin(),
+                          channelMap.end(),
+                          soundChannelMap.begin(),
+                          soundChannelMap.end(),
+                          [](SoundChannel channel, ma_channel initialized)
+                          { return priv::MiniaudioUtils::soundChannelToMiniaudioChannel(channel) == initialized; });
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the properties of the bound buffer, whichever its kind
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getChannelCount() const
+    {
+        return buffer ? buffer->getChannelCount() : compressedBuffer ? compressedBuffer->getChannelCount() : 0;
+    }
+
+    unsigned int getSampleRate() const
+    {
+        return buffer ? buffer->getSampleRate() : compressedBuffer ? compressedBuffer->getSampleRate() : 0;
+    }
+
+    std::uint64_t getSampleCount() const
+    {
+        return buffer ? buffer->getSampleCount() : compressedBuffer ? compressedBuffer->getSampleCount() : 0;
+    }
+
+    SampleFormat getSampleFormat() const
+    {
+        // Compressed buffers are always decoded to 16-bit samples
+        return buffer ? buffer->getSampleFormat() : SampleFormat::Int16;
+    }
+
+    std::vector<SoundChannel> getChannelMap() const
+    {
+        if (buffer)
+            return buffer->getChannelMap();
+
+        return compressedBuffer ? compressedBuffer->getChannelMap() : std::vector<SoundChannel>();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read samples of the compressed buffer through the decode cache
+    ///
+    /// \param samples    Array of samples to fill
+    /// \param frameCount Number of frames to read
+    ///
+    /// \return Number of frames actually read
+    ///
+    ////////////////////////////////////////////////////////////
+    ma_uint64 readCompressed(std::int16_t* samples, ma_uint64 frameCount)
+    {
+        const std::uint64_t channelCount = compressedBuffer->getChannelCount();
+        const std::uint64_t sampleCount  = compressedBuffer->getSampleCount();
+        const std::uint64_t remaining    = sampleCount - std::min<std::uint64_t>(cursor, sampleCount);
+        const std::uint64_t toRead       = std::min<std::uint64_t>(frameCount * channelCount, remaining);
+
+        std::uint64_t written = 0;
+        while (written < toRead)
+        {
+            // Decode the next block when the cursor leaves the cache, seeking only if playback jumped elsewhere
+            if ((cursor < cacheOffset) || (cursor >= cacheOffset + cacheSize))
+            {
+                if (decoder->getSampleOffset() != cursor)
+                    decoder->seek(cursor);
+
+                cacheOffset = cursor;
+                cacheSize   = static_cast<std::size_t>(decoder->read(decodeCache.data(), decodeCache.size()));
+
+                if (cacheSize == 0)
+                    break;
+            }
+
+            const auto count = static_cast<std::size_t>(std::min(toRead - written, cacheOffset + cacheSize - cursor));
+            std::memcpy(samples + written, decodeCache.data() + (cursor - cacheOffset), count * sizeof(std::int16_t));
+            written += count;
+            cursor += count;
+        }
+
+        return written / channelCount;
     }
 
     static void onEnd(void* userData, ma_sound* soundPtr)
@@ -88,18 +200,36 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
         auto&       impl   = *static_cast<Impl*>(dataSource);
         const auto* buffer = impl.buffer;
 
+        priv::AudioDevice::countMixedVoice(impl.lastMixIndex, false);
+
+        if (impl.compressedBuffer && impl.decoder)
+        {
+            *framesRead = impl.readCompressed(static_cast<std::int16_t*>(framesOut), frameCount);
+
+            // If we are looping and at the end of the sound, set the cursor back to the start
+            if (impl.looping && (impl.cursor >= impl.compressedBuffer->getSampleCount()))
+                impl.cursor = 0;
+
+            return MA_SUCCESS;
+        }
+
         if (buffer == nullptr)
             return MA_NO_DATA_AVAILABLE;
 
         // Determine how many frames we can read
         *framesRead = std::min<ma_uint64>(frameCount, (buffer->getSampleCount() - impl.cursor) / buffer->getChannelCount());
 
-        // Copy the samples to the output
+        // Copy the samples to the output, in the format they are stored in
         const auto sampleCount = *framesRead * buffer->getChannelCount();
 
-        std::memcpy(framesOut,
-                    buffer->getSamples() + impl.cursor,
-                    static_cast<std::size_t>(sampleCount) * sizeof(buffer->getSamples()[0]));
+        if (buffer->getSampleFormat() == SampleFormat::Float32)
+            std::memcpy(framesOut,
+                        buffer->getFloatSamples() + impl.cursor,
+                        static_cast<std::size_t>(sampleCount) * sizeof(float));
+        else
+            std::memcpy(framesOut,
+                        buffer->getSamples() + impl.cursor,
+                        static_cast<std::size_t>(sampleCount) * sizeof(std::int16_t));
 
         impl.cursor += static_cast<std::size_t>(sampleCount);
 
@@ -112,13 +242,13 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
 
     static ma_result seek(ma_data_source* dataSource, ma_uint64 frameIndex)
     {
-        auto&       impl   = *static_cast<Impl*>(dataSource);
-        const auto* buffer = impl.buffer;
+        auto&              impl         = *static_cast<Impl*>(dataSource);
+        const unsigned int channelCount = impl.getChannelCount();
 
-        if (buffer == nullptr)
+        if (channelCount == 0)
             return MA_NO_DATA_AVAILABLE;
 
-        impl.cursor = static_cast<std::size_t>(frameIndex * buffer->getChannelCount());
+        impl.cursor = static_cast<std::size_t>(frameIndex * channelCount);
 
         return MA_SUCCESS;
     }
@@ -130,39 +260,38 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
                                ma_channel*,
                                size_t)
     {
-        const auto& impl   = *static_cast<const Impl*>(dataSource);
-        const auto* buffer = impl.buffer;
+        const auto& impl = *static_cast<const Impl*>(dataSource);
 
         // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
-        *format     = ma_format_s16;
-        *channels   = buffer && buffer->getChannelCount() ? buffer->getChannelCount() : 1;
-        *sampleRate = buffer && buffer->getSampleRate() ? buffer->getSampleRate() : 44100;
+        *format     = (impl.getSampleFormat() == SampleFormat::Float32) ? ma_format_f32 : ma_format_s16;
+        *channels   = impl.getChannelCount() ? impl.getChannelCount() : 1;
+        *sampleRate = impl.getSampleRate() ? impl.getSampleRate() : 44100;
 
         return MA_SUCCESS;
     }
 
     static ma_result getCursor(ma_data_source* dataSource, ma_uint64* cursor)
     {
-        const auto& impl   = *static_cast<const Impl*>(dataSource);
-        const auto* buffer = impl.buffer;
+        const auto&        impl         = *static_cast<const Impl*>(dataSource);
+        const unsigned int channelCount = impl.getChannelCount();
 
-        if (buffer == nullptr)
+        if (channelCount == 0)
             return MA_NO_DATA_AVAILABLE;
 
-        *cursor = impl.cursor / buffer->getChannelCount();
+        *cursor = impl.cursor / channelCount;
 
         return MA_SUCCESS;
     }
 
     static ma_result getLength(ma_data_source* dataSource, ma_uint64* length)
     {
-        const auto& impl   = *static_cast<const Impl*>(dataSource);
-        const auto* buffer = impl.buffer;
+        const auto&        impl         = *static_cast<const Impl*>(dataSource);
+        const unsigned int channelCount = impl.getChannelCount();
 
-        if (buffer == nullptr)
+        if (channelCount == 0)
             return MA_NO_DATA_AVAILABLE;
 
-        *length = buffer->getSampleCount() / buffer->getChannelCount();
+        *length = impl.getSampleCount() / channelCount;
 
         return MA_SUCCESS;
     }
@@ -179,9 +308,21 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
     // Member data
     ////////////////////////////////////////////////////////////
     static constexpr ma_data_source_vtable vtable{read, seek, getFormat, getCursor, getLength, setLooping, 0};
-    std::size_t                            cursor{};  //!< The current playing position
-    bool                                   looping{}; //!< True if we are looping the sound
-    const SoundBuffer*                     buffer{};  //!< Sound buffer bound to the source
+    static constexpr std::uint64_t         noStopTime{std::numeric_limits<std::uint64_t>::max()};
+    static constexpr std::size_t           decodeCacheFrames{2048}; //!< Size of the decode cache, in frames
+    std::size_t                            cursor{};                //!< The current playing position
+    bool                                   looping{};               //!< True if we are looping the sound
+    const SoundBuffer*                     buffer{};                //!< Sound buffer bound to the source
+    const CompressedSoundBuffer*           compressedBuffer{};      //!< Compressed sound buffer bound to the source
+    std::optional<InputSoundFile>          decoder;                 //!< Decoder of the compressed buffer
+    std::vector<std::int16_t>              decodeCache;             //!< Last block of decoded samples
+    std::uint64_t                          cacheOffset{};           //!< Offset of the first sample of the decode cache
+    std::size_t                            cacheSize{};             //!< Number of valid samples in the decode cache
+    std::uint64_t                          lastMixIndex{};          //!< Last period the sound was counted in
+    std::uint64_t                          stopTime{noStopTime};    //!< Time of the audio clock given to stopAt
+    unsigned int initializedChannelCount{}; //!< Channel count of the buffer the sound was created for, 0 if none
+    unsigned int initializedSampleRate{};   //!< Sample rate of the buffer the sound was created for
+    SampleFormat initializedSampleFormat{}; //!< Sample format of the buffer the sound was created for
 };
 
 
@@ -192,6 +333,13 @@ Sound::Sound(const SoundBuffer& buffer) : m_impl(std::make_unique<Impl>())
 }
 
 
+////////////////////////////////////////////////////////////
+Sound::Sound(const CompressedSoundBuffer& buffer) : m_impl(std::make_unique<Impl>())
+{
+    setBuffer(buffer);
+}
+
+
 ////////////////////////////////////////////////////////////
 // NOLINTNEXTLINE(readability-redundant-member-init)
 Sound::Sound(const Sound& copy) : SoundSource(copy), m_impl(std::make_unique<Impl>())
@@ -200,6 +348,8 @@ Sound::Sound(const Sound& copy) : SoundSource(copy), m_impl(std::make_unique<Imp
 
     if (copy.m_impl->buffer)
         setBuffer(*copy.m_impl->buffer);
+    else if (copy.m_impl->compressedBuffer)
+        setBuffer(*copy.m_impl->compressedBuffer);
     setLoop(copy.getLoop());
 }
 
@@ -210,15 +360,29 @@ Sound::~Sound()
     stop();
     if (m_impl->buffer)
         m_impl->buffer->detachSound(this);
+    if (m_impl->compressedBuffer)
+        m_impl->compressedBuffer->detachSound(this);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::play()
+{
+    playAt(0);
+}
+
+
+////////////////////////////////////////////////////////////
+void Sound::playAt(std::uint64_t clockTime)
 {
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
+    // The engine doesn't read the sound before the start time, and the times must be set before it is started
+    ma_sound_set_start_time_in_pcm_frames(&m_impl->sound, clockTime);
+    ma_sound_set_stop_time_in_pcm_frames(&m_impl->sound, Impl::noStopTime);
+    m_impl->stopTime = Impl::noStopTime;
+
     if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
@@ -230,6 +394,14 @@ void Sound::play()
 }
 
 
+////////////////////////////////////////////////////////////
+void Sound::stopAt(std::uint64_t clockTime)
+{
+    ma_sound_set_stop_time_in_pcm_frames(&m_impl->sound, clockTime);
+    m_impl->stopTime = clockTime;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Sound::pause()
 {
@@ -239,8 +411,10 @@ void Sound::pause()
     }
     else
     {
-        if (m_impl->status == Status::Playing)
+        if (getStatus() == Status::Playing)
             m_impl->status = Status::Paused;
+
+        m_impl->stopTime = Impl::noStopTime;
     }
 }
 
@@ -255,7 +429,8 @@ void Sound::stop()
     else
     {
         setPlayingOffset(Time::Zero);
-        m_impl->status = Status::Stopped;
+        m_impl->status   = Status::Stopped;
+        m_impl->stopTime = Impl::noStopTime;
     }
 }
 
@@ -264,19 +439,62 @@ void Sound::stop()
 void Sound::setBuffer(const SoundBuffer& buffer)
 {
     // First detach from the previous buffer
-    if (m_impl->buffer)
+    if (m_impl->buffer || m_impl->compressedBuffer)
     {
-        stop();
+        detachBuffer();
 
         // Reset cursor
         m_impl->cursor = 0;
-        m_impl->buffer->detachSound(this);
     }
 
     // Assign and use the new buffer
     m_impl->buffer = &buffer;
     m_impl->buffer->attachSound(this);
 
+    // The miniaudio sound only depends on the format of the buffer, so it
+    // is kept when switching between buffers that share the same format
+    if (m_impl->isInitializedFor(buffer.getChannelCount(),
+                                 buffer.getSampleRate(),
+                                 buffer.getSampleFormat(),
+                                 buffer.m_channelMap))
+        return;
+
+    m_impl->deinitialize();
+    m_impl->initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+void Sound::setBuffer(const CompressedSoundBuffer& buffer)
+{
+    // First detach from the previous buffer
+    if (m_impl->buffer || m_impl->compressedBuffer)
+    {
+        detachBuffer();
+
+        // Reset cursor
+        m_impl->cursor = 0;
+    }
+
+    // Assign and use the new buffer
+    m_impl->compressedBuffer = &buffer;
+    m_impl->compressedBuffer->attachSound(this);
+
+    // Each sound decodes the buffer on its own, so that several of them can play it at different positions
+    m_impl->decoder = InputSoundFile::openFromMemory(buffer.getData(), buffer.getDataSize());
+    m_impl->decodeCache.resize(Impl::decodeCacheFrames * buffer.getChannelCount());
+    m_impl->cacheOffset = 0;
+    m_impl->cacheSize   = 0;
+
+    if (!m_impl->decoder)
+        err() << "Failed to open the decoder of a compressed sound buffer" << std::endl;
+
+    if (m_impl->isInitializedFor(buffer.getChannelCount(),
+                                 buffer.getSampleRate(),
+                                 SampleFormat::Int16,
+                                 buffer.m_channelMap))
+        return;
+
     m_impl->deinitialize();
     m_impl->initialize();
 }
@@ -297,8 +515,8 @@ void Sound::setPlayingOffset(Time timeOffset)
 
     const auto frameIndex = priv::MiniaudioUtils::getFrameIndex(m_impl->sound, timeOffset);
 
-    if (m_impl->buffer)
-        m_impl->cursor = static_cast<std::size_t>(frameIndex * m_impl->buffer->getChannelCount());
+    if (m_impl->buffer || m_impl->compressedBuffer)
+        m_impl->cursor = static_cast<std::size_t>(frameIndex * m_impl->getChannelCount());
 }
 
 
@@ -310,6 +528,20 @@ void Sound::setEffectProcessor(EffectProcessor effectProcessor)
 }
 
 
+////////////////////////////////////////////////////////////
+void Sound::setBus(AudioBus* bus)
+{
+    m_impl->setBus(bus);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus* Sound::getBus() const
+{
+    return m_impl->bus;
+}
+
+
 ////////////////////////////////////////////////////////////
 const SoundBuffer& Sound::getBuffer() const
 {
@@ -318,6 +550,13 @@ const SoundBuffer& Sound::getBuffer() const
 }
 
 
+////////////////////////////////////////////////////////////
+const CompressedSoundBuffer* Sound::getCompressedBuffer() const
+{
+    return m_impl->compressedBuffer;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Sound::getLoop() const
 {
@@ -328,7 +567,7 @@ bool Sound::getLoop() const
 ////////////////////////////////////////////////////////////
 Time Sound::getPlayingOffset() const
 {
-    if (!m_impl->buffer || m_impl->buffer->getChannelCount() == 0 || m_impl->buffer->getSampleRate() == 0)
+    if (m_impl->getChannelCount() == 0 || m_impl->getSampleRate() == 0)
         return {};
 
     return priv::MiniaudioUtils::getPlayingOffset(m_impl->sound);
@@ -338,6 +577,10 @@ Time Sound::getPlayingOffset() const
 ////////////////////////////////////////////////////////////
 Sound::Status Sound::getStatus() const
 {
+    // The engine stops mixing the sound by itself once the time given to stopAt is reached
+    if ((m_impl->status == Status::Playing) && (m_impl->stopTime <= priv::AudioDevice::getClock()))
+        return Status::Stopped;
+
     return m_impl->status;
 }
 
@@ -356,16 +599,14 @@ Sound& Sound::operator=(const Sound& right)
     SoundSource::operator=(right);
 
     // Detach the sound instance from the previous buffer (if any)
-    if (m_impl->buffer)
-    {
-        stop();
-        m_impl->buffer->detachSound(this);
-        m_impl->buffer = nullptr;
-    }
+    if (m_impl->buffer || m_impl->compressedBuffer)
+        detachBuffer();
 
     // Copy the remaining sound attributes
     if (right.m_impl->buffer)
         setBuffer(*right.m_impl->buffer);
+    else if (right.m_impl->compressedBuffer)
+        setBuffer(*right.m_impl->compressedBuffer);
     setLoop(right.getLoop());
 
     return *this;
@@ -384,6 +625,13 @@ void Sound::detachBuffer()
         m_impl->buffer->detachSound(this);
         m_impl->buffer = nullptr;
     }
+
+    if (m_impl->compressedBuffer)
+    {
+        m_impl->compressedBuffer->detachSound(this);
+        m_impl->compressedBuffer = nullptr;
+        m_impl->decoder.reset();
+    }
 }
 
 
@@ -25,26 +25,228 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/AudioResource.hpp>
 #include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/OutputSoundFile.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundFileReaderWav.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Jobs.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/Utils.hpp>
 
+#include <miniaudio.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <exception>
 #include <ostream>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
+#include <cmath>
+
+
+namespace
+{
+std::int16_t toInt16(float sample)
+{
+    return static_cast<std::int16_t>(std::clamp(std::lround(sample * 32768.f), -32768l, 32767l));
+}
+
+
+// Sample rate at which the engine mixes the sounds, opening the playback device if needed
+unsigned int getPlaybackSampleRate()
+{
+    struct DeviceHandle : sf::AudioResource
+    {
+    };
+
+    std::optional<DeviceHandle> handle;
+    if (!sf::priv::AudioDevice::getEngine())
+        handle.emplace();
+
+    if (auto* engine = sf::priv::AudioDevice::getEngine())
+        return ma_engine_get_sample_rate(engine);
+
+    return 0;
+}
+
+
+// Modified Bessel function of the first kind and order 0, used by the Kaiser window
+double besselI0(double x)
+{
+    double sum  = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 50 && term > sum * 1e-12; ++k)
+    {
+        const double factor = x / (2.0 * k);
+        term *= factor * factor;
+        sum += term;
+    }
+    return sum;
+}
+
+
+// Resample interleaved samples with a Kaiser windowed sinc filter, in parallel
+std::vector<float> resample(const std::vector<float>& input,
+                            unsigned int              channelCount,
+                            unsigned int              inputRate,
+                            unsigned int              outputRate)
+{
+    constexpr std::size_t phaseCount    = 256;  // Number of precomputed fractional positions
+    constexpr double      zeroCrossings = 16.0; // Zero crossings of the sinc on each side of the sample
+    constexpr double      beta          = 8.6;  // Kaiser window shape, about 90 dB of stopband attenuation
+    constexpr double      pi            = 3.14159265358979323846;
+
+    // When downsampling, the filter cuts the frequencies that the output rate can't represent
+    const double cutoff = 0.95 * std::min(1.0, static_cast<double>(outputRate) / static_cast<double>(inputRate));
+    const auto   halfWidth = static_cast<std::size_t>(std::ceil(zeroCrossings / cutoff));
+    const std::size_t tapCount = 2 * halfWidth;
+
+    // Precompute the filter for each fractional position (plus one to interpolate the last one)
+    std::vector<float> table((phaseCount + 1) * tapCount);
+    for (std::size_t phase = 0; phase <= phaseCount; ++phase)
+    {
+        float* const row = &table[phase * tapCount];
+        double       sum = 0.0;
+        for (std::size_t tap = 0; tap < tapCount; ++tap)
+        {
+            const double distance = static_cast<double>(phase) / phaseCount + static_cast<double>(halfWidth) - 1.0 -
+                                    static_cast<double>(tap);
+            const double x        = cutoff * distance * pi;
+            const double sinc     = (x == 0.0) ? 1.0 : std::sin(x) / x;
+            const double position = distance / static_cast<double>(halfWidth);
+            const double window   = (std::abs(position) >= 1.0)
+                                        ? 0.0
+                                        : besselI0(beta * std::sqrt(1.0 - position * position)) / besselI0(beta);
+            row[tap]              = static_cast<float>(sinc * window);
+            sum += sinc * window;
+        }
+
+        // Normalize the filter so that it doesn't change the level of the sound
+        for (std::size_t tap = 0; tap < tapCount; ++tap)
+            row[tap] = static_cast<float>(static_cast<double>(row[tap]) / sum);
+    }
+
+    const std::uint64_t inputFrames  = input.size() / channelCount;
+    const std::uint64_t outputFrames = (inputFrames * outputRate + inputRate - 1) / inputRate;
+    std::vector<float>  output(static_cast<std::size_t>(outputFrames * channelCount));
+
+    const auto resampleFrame = [&](std::uint64_t frame)
+    {
+        // Position of the output frame in the input, as an integer part and a fraction of phaseCount
+        const std::uint64_t position = frame * inputRate;
+        const std::uint64_t integer  = position / outputRate;
+        const double phase = static_cast<double>(position % outputRate) * phaseCount / static_cast<double>(outputRate);
+        const auto   phaseIndex = static_cast<std::size_t>(phase);
+        const auto   weight     = static_cast<float>(phase - static_cast<double>(phaseIndex));
+
+        const float* const row0  = &table[phaseIndex * tapCount];
+        const float* const row1  = row0 + tapCount;
+        float* const       out   = &output[static_cast<std::size_t>(frame * channelCount)];
+        const auto         first = static_cast<std::int64_t>(integer) - static_cast<std::int64_t>(halfWidth) + 1;
+
+        // Samples before the beginning and after the end of the sound are silent
+        const std::int64_t begin = std::max<std::int64_t>(-first, 0);
+        const std::int64_t end   = std::min(static_cast<std::int64_t>(inputFrames) - first,
+                                          static_cast<std::int64_t>(tapCount));
+
+        for (std::int64_t tap = begin; tap < end; ++tap)
+        {
+            const auto   index       = static_cast<std::size_t>(tap);
+            const float  coefficient = row0[index] + weight * (row1[index] - row0[index]);
+            const float* in          = &input[static_cast<std::size_t>(first + tap) * channelCount];
+            for (unsigned int channel = 0; channel < channelCount; ++channel)
+                out[channel] += coefficient * in[channel];
+        }
+    };
+
+    // Split the output in blocks that the jobs pick one after the other
+    constexpr std::uint64_t  blockSize  = 16384;
+    const std::uint64_t      blockCount = (outputFrames + blockSize - 1) / blockSize;
+    std::atomic<std::size_t> next{0};
+    const auto               jobCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                                                static_cast<std::size_t>(blockCount));
+
+    sf::priv::runJobs(jobCount,
+                      [&](std::size_t)
+                      {
+                          for (std::uint64_t block = next++; block < blockCount; block = next++)
+                          {
+                              const std::uint64_t last = std::min(outputFrames, (block + 1) * blockSize);
+                              for (std::uint64_t frame = block * blockSize; frame < last; ++frame)
+                                  resampleFrame(frame);
+                          }
+                      });
+
+    return output;
+}
+
+
+// Mix interleaved samples into other channels, the same way as miniaudio does during playback
+std::optional<std::vector<float>> convertChannels(const std::vector<float>&              input,
+                                                  const std::vector<sf::SoundChannel>& inputMap,
+                                                  const std::vector<sf::SoundChannel>& outputMap)
+{
+    std::vector<ma_channel> inputChannels;
+    std::vector<ma_channel> outputChannels;
+    for (const sf::SoundChannel channel : inputMap)
+        inputChannels.push_back(sf::priv::MiniaudioUtils::soundChannelToMiniaudioChannel(channel));
+    for (const sf::SoundChannel channel : outputMap)
+        outputChannels.push_back(sf::priv::MiniaudioUtils::soundChannelToMiniaudioChannel(channel));
+
+    const auto config = ma_channel_converter_config_init(ma_format_f32,
+                                                         static_cast<ma_uint32>(inputChannels.size()),
+                                                         inputChannels.data(),
+                                                         static_cast<ma_uint32>(outputChannels.size()),
+                                                         outputChannels.data(),
+                                                         ma_channel_mix_mode_default);
+
+    ma_channel_converter converter;
+    if (const ma_result result = ma_channel_converter_init(&config, nullptr, &converter); result != MA_SUCCESS)
+    {
+        sf::err() << "Failed to initialize channel converter: " << ma_result_description(result) << std::endl;
+        return std::nullopt;
+    }
+
+    const std::size_t  frameCount = input.size() / inputMap.size();
+    std::vector<float> output(frameCount * outputMap.size());
+    const ma_result    result = ma_channel_converter_process_pcm_frames(&converter,
+                                                                     output.data(),
+                                                                     input.data(),
+                                                                     frameCount);
+    ma_channel_converter_uninit(&converter, nullptr);
+
+    if (result != MA_SUCCESS)
+    {
+        sf::err() << "Failed to convert sound buffer channels: " << ma_result_description(result) << std::endl;
+        return std::nullopt;
+    }
+
+    return output;
+}
+} // namespace
+
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 SoundBuffer::SoundBuffer(const SoundBuffer& copy)
 {
-    // don't copy the attached sounds
-    m_samples  = copy.m_samples;
-    m_duration = copy.m_duration;
+    // don't copy the attached sounds; mapped samples are shared rather than copied
+    m_samples           = copy.m_samples;
+    m_floatSamples      = copy.m_floatSamples;
+    m_mapping           = copy.m_mapping;
+    m_mappedSamples     = copy.m_mappedSamples;
+    m_mappedSampleCount = copy.m_mappedSampleCount;
+    m_duration          = copy.m_duration;
 
     // Update the internal buffer with the new samples
     if (!update(copy.getChannelCount(), copy.getSampleRate(), copy.getChannelMap()))
@@ -68,30 +270,107 @@ SoundBuffer::~SoundBuffer()
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::loadFromFile(const std::filesystem::path& filename)
+std::optional<SoundBuffer> SoundBuffer::loadFromFile(const std::filesystem::path& filename, SampleFormat format)
 {
     if (auto file = InputSoundFile::openFromFile(filename))
-        return initialize(*file);
+        return initialize(*file, format);
     else
         return std::nullopt;
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes)
+std::optional<SoundBuffer> SoundBuffer::loadFromFile(const std::filesystem::path& filename,
+                                                     const Conversion&            conversion,
+                                                     SampleFormat                 format)
+{
+    if (const auto soundBuffer = loadFromFile(filename, format))
+        return soundBuffer->convert(conversion);
+    else
+        return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadFromMappedFile(const std::filesystem::path& filename)
+{
+    auto mapping = std::make_shared<MappedFileInputStream>();
+    if (!mapping->open(filename))
+    {
+        err() << "Failed to map sound file\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    const void*       data = mapping->getData();
+    const std::size_t size = static_cast<std::size_t>(mapping->getSize());
+
+    // Parse the header with the regular readers, so that the file is validated the same way as by loadFromFile
+    auto file = InputSoundFile::openFromMemory(data, size);
+    if (!file)
+        return std::nullopt;
+
+    // 16-bit PCM wav samples can be played straight from the mapping, if they are properly aligned
+    if (const auto pcm = priv::SoundFileReaderWav::findPcm16Samples(data, size);
+        pcm && (pcm->offset % alignof(std::int16_t) == 0) &&
+        (pcm->size / sizeof(std::int16_t) >= file->getSampleCount()))
+    {
+        const auto* samples = reinterpret_cast<const std::int16_t*>(static_cast<const std::byte*>(data) + pcm->offset);
+        SoundBuffer soundBuffer(std::move(mapping), samples, file->getSampleCount());
+
+        // Update the internal buffer with the new samples
+        if (!soundBuffer.update(file->getChannelCount(), file->getSampleRate(), file->getChannelMap()))
+            return std::nullopt;
+        return soundBuffer;
+    }
+
+    // Any other file is decoded; the mapping is only used as a faster way to read it
+    return initialize(*file, SampleFormat::Int16);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::optional<SoundBuffer>> SoundBuffer::loadFromFiles(const std::vector<std::filesystem::path>& filenames,
+                                                                   SampleFormat format,
+                                                                   unsigned int threadCount)
+{
+    std::vector<std::optional<SoundBuffer>> soundBuffers(filenames.size());
+
+    // Each job picks the next file to load until there are none left
+    std::atomic<std::size_t> next{0};
+    const auto               work = [&]
+    {
+        for (std::size_t i = next++; i < filenames.size(); i = next++)
+        {
+            soundBuffers[i] = (format == SampleFormat::Int16) ? loadFromMappedFile(filenames[i])
+                                                              : loadFromFile(filenames[i], format);
+        }
+    };
+
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(std::min<std::size_t>(threadCount, filenames.size()));
+
+    priv::runJobs(threadCount, [&](std::size_t) { work(); });
+
+    return soundBuffers;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes, SampleFormat format)
 {
     if (auto file = InputSoundFile::openFromMemory(data, sizeInBytes))
-        return initialize(*file);
+        return initialize(*file, format);
     else
         return std::nullopt;
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::loadFromStream(InputStream& stream)
+std::optional<SoundBuffer> SoundBuffer::loadFromStream(InputStream& stream, SampleFormat format)
 {
     if (auto file = InputSoundFile::openFromStream(stream))
-        return initialize(*file);
+        return initialize(*file, format);
     else
         return std::nullopt;
 }
@@ -108,7 +387,39 @@ std::optional<SoundBuffer> SoundBuffer::loadFromSamples(
     if (samples && sampleCount && channelCount && sampleRate && !channelMap.empty())
     {
         // Copy the new audio samples
-        SoundBuffer soundBuffer(std::vector<std::int16_t>(samples, samples + sampleCount));
+        SoundBuffer soundBuffer(Samples(samples, samples + sampleCount));
+
+        // Update the internal buffer with the new samples
+        if (!soundBuffer.update(channelCount, sampleRate, channelMap))
+            return std::nullopt;
+        return soundBuffer;
+    }
+    else
+    {
+        // Error...
+        err() << "Failed to load sound buffer from samples ("
+              << "array: " << samples << ", "
+              << "count: " << sampleCount << ", "
+              << "channels: " << channelCount << ", "
+              << "samplerate: " << sampleRate << ")" << std::endl;
+
+        return std::nullopt;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::loadFromSamples(
+    const float*                     samples,
+    std::uint64_t                    sampleCount,
+    unsigned int                     channelCount,
+    unsigned int                     sampleRate,
+    const std::vector<SoundChannel>& channelMap)
+{
+    if (samples && sampleCount && channelCount && sampleRate && !channelMap.empty())
+    {
+        // Copy the new audio samples
+        SoundBuffer soundBuffer(std::vector<float>(samples, samples + sampleCount));
 
         // Update the internal buffer with the new samples
         if (!soundBuffer.update(channelCount, sampleRate, channelMap))
@@ -136,7 +447,24 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
     if (auto file = OutputSoundFile::openFromFile(filename, getSampleRate(), getChannelCount(), getChannelMap()))
     {
         // Write the samples to the opened file
-        file->write(m_samples.data(), m_samples.size());
+        if (getSampleFormat() == SampleFormat::Int16)
+        {
+            file->write(getSamples(), getSampleCount());
+            return true;
+        }
+
+        // Sound files are written from 16-bit samples, so convert floating point samples in blocks
+        // (with the inverse of the conversion used when reading, so that 16-bit sources round-trip exactly)
+        std::array<std::int16_t, 4096> block{};
+        for (std::size_t offset = 0; offset < m_floatSamples.size(); offset += block.size())
+        {
+            const std::size_t count = std::min(block.size(), m_floatSamples.size() - offset);
+            std::transform(m_floatSamples.begin() + static_cast<std::ptrdiff_t>(offset),
+                           m_floatSamples.begin() + static_cast<std::ptrdiff_t>(offset + count),
+                           block.begin(),
+                           toInt16);
+            file->write(block.data(), count);
+        }
 
         return true;
     }
@@ -147,17 +475,109 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::convert(const Conversion& conversion) const
+{
+    const unsigned int sampleRate = conversion.sampleRate ? conversion.sampleRate : getPlaybackSampleRate();
+    const std::vector<SoundChannel>& channelMap = conversion.channelMap.empty() ? m_channelMap : conversion.channelMap;
+
+    if (!sampleRate)
+    {
+        err() << "Failed to convert sound buffer: the sample rate of the playback device is unknown" << std::endl;
+        return std::nullopt;
+    }
+
+    // The conversion works on floating point samples
+    std::vector<float> samples;
+    if (getSampleFormat() == SampleFormat::Float32)
+    {
+        samples = m_floatSamples;
+    }
+    else
+    {
+        const std::int16_t* const source = getSamples();
+        samples.resize(static_cast<std::size_t>(getSampleCount()));
+        std::transform(source,
+                       source + getSampleCount(),
+                       samples.begin(),
+                       [](std::int16_t sample) { return static_cast<float>(sample) / 32768.f; });
+    }
+
+    // Resample with as few channels as possible: remove channels before resampling, add them after
+    const auto mix = [&]
+    {
+        if (channelMap == m_channelMap)
+            return true;
+
+        auto mixed = convertChannels(samples, m_channelMap, channelMap);
+        if (!mixed)
+            return false;
+
+        samples = std::move(*mixed);
+        return true;
+    };
+
+    if ((channelMap.size() < m_channelMap.size()) && !mix())
+        return std::nullopt;
+
+    if (sampleRate != m_sampleRate && !samples.empty())
+    {
+        const auto channelCount = static_cast<unsigned int>(std::min(channelMap.size(), m_channelMap.size()));
+        samples                 = resample(samples, channelCount, m_sampleRate, sampleRate);
+    }
+
+    if ((channelMap.size() >= m_channelMap.size()) && !mix())
+        return std::nullopt;
+
+    // Store the samples in the format of this buffer
+    const auto create = [&](auto&& converted) -> std::optional<SoundBuffer>
+    {
+        SoundBuffer soundBuffer(std::move(converted));
+        if (!soundBuffer.update(static_cast<unsigned int>(channelMap.size()), sampleRate, channelMap))
+            return std::nullopt;
+        return soundBuffer;
+    };
+
+    if (getSampleFormat() == SampleFormat::Float32)
+        return create(std::move(samples));
+
+    Samples converted(samples.size());
+    std::transform(samples.begin(), samples.end(), converted.begin(), toInt16);
+    return create(std::move(converted));
+}
+
+
 ////////////////////////////////////////////////////////////
 const std::int16_t* SoundBuffer::getSamples() const
 {
+    if (m_mappedSamples)
+        return m_mappedSamples;
+
     return m_samples.empty() ? nullptr : m_samples.data();
 }
 
 
+////////////////////////////////////////////////////////////
+const float* SoundBuffer::getFloatSamples() const
+{
+    return m_floatSamples.empty() ? nullptr : m_floatSamples.data();
+}
+
+
+////////////////////////////////////////////////////////////
+SampleFormat SoundBuffer::getSampleFormat() const
+{
+    return m_floatSamples.empty() ? SampleFormat::Int16 : SampleFormat::Float32;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundBuffer::getSampleCount() const
 {
-    return m_samples.size();
+    if (m_mappedSamples)
+        return m_mappedSampleCount;
+
+    return (getSampleFormat() == SampleFormat::Float32) ? m_floatSamples.size() : m_samples.size();
 }
 
 
@@ -195,41 +615,72 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
     SoundBuffer temp(right);
 
     std::swap(m_samples, temp.m_samples);
+    std::swap(m_floatSamples, temp.m_floatSamples);
+    std::swap(m_mapping, temp.m_mapping);
+    std::swap(m_mappedSamples, temp.m_mappedSamples);
+    std::swap(m_mappedSampleCount, temp.m_mappedSampleCount);
     std::swap(m_sampleRate, temp.m_sampleRate);
     std::swap(m_channelMap, temp.m_channelMap);
     std::swap(m_duration, temp.m_duration);
     std::swap(m_sounds, temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
+    std::swap(m_memoryCounter, temp.m_memoryCounter);
 
     return *this;
 }
 
 
 ////////////////////////////////////////////////////////////
-SoundBuffer::SoundBuffer(std::vector<std::int16_t>&& samples) : m_samples(std::move(samples))
+SoundBuffer::SoundBuffer(Samples&& samples) : m_samples(std::move(samples))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBuffer::SoundBuffer(std::vector<float>&& floatSamples) : m_floatSamples(std::move(floatSamples))
 {
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<SoundBuffer> SoundBuffer::initialize(InputSoundFile& file)
+SoundBuffer::SoundBuffer(std::shared_ptr<const MappedFileInputStream> mapping,
+                         const std::int16_t*                          samples,
+                         std::uint64_t                                sampleCount) :
+m_mapping(std::move(mapping)),
+m_mappedSamples(samples),
+m_mappedSampleCount(sampleCount)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundBuffer> SoundBuffer::initialize(InputSoundFile& file, SampleFormat format)
 {
     // Retrieve the sound parameters
     const std::uint64_t sampleCount = file.getSampleCount();
 
-    // Read the samples from the provided file
-    std::vector<std::int16_t> samples(static_cast<std::size_t>(sampleCount));
-    if (file.read(samples.data(), sampleCount) == sampleCount)
+    // Read the samples from the provided file, decoding straight to the requested format
+    const auto read = [&](auto&& samples) -> std::optional<SoundBuffer>
     {
+        std::uint64_t readCount = 0;
+        if constexpr (std::is_same_v<typename std::decay_t<decltype(samples)>::value_type, float>)
+            readCount = file.readFloat(samples.data(), sampleCount);
+        else
+            readCount = file.read(samples.data(), sampleCount);
+
+        if (readCount != sampleCount)
+            return std::nullopt;
+
         // Update the internal buffer with the new samples
         SoundBuffer soundBuffer(std::move(samples));
         if (!soundBuffer.update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
             return std::nullopt;
         return soundBuffer;
-    }
-    else
-    {
-        return std::nullopt;
-    }
+    };
+
+    if (format == SampleFormat::Float32)
+        return read(std::vector<float>(static_cast<std::size_t>(sampleCount)));
+
+    return read(Samples(static_cast<std::size_t>(sampleCount)));
 }
 
 
@@ -243,6 +694,9 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
     m_sampleRate = sampleRate;
     m_channelMap = channelMap;
 
+    // Samples read from a file mapping are not counted, they don't use any allocated memory
+    m_memoryCounter.setBytes(m_samples.capacity() * sizeof(std::int16_t) + m_floatSamples.capacity() * sizeof(float));
+
     // First make a copy of the list of sounds so we can reattach later
     const SoundList sounds(m_sounds);
 
@@ -252,7 +706,7 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
 
     // Compute the duration
     m_duration = seconds(
-        static_cast<float>(m_samples.size()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
+        static_cast<float>(getSampleCount()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
 
     // Now reattach the buffer to the sounds that use it
     for (Sound* soundPtr : sounds)
@@ -265,14 +719,20 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
 ////////////////////////////////////////////////////////////
 void SoundBuffer::attachSound(Sound* sound) const
 {
-    m_sounds.insert(sound);
+    if (std::find(m_sounds.begin(), m_sounds.end(), sound) == m_sounds.end())
+        m_sounds.push_back(sound);
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundBuffer::detachSound(Sound* sound) const
 {
-    m_sounds.erase(sound);
+    // The order of the sounds doesn't matter, so the last one takes the place of the removed one
+    if (const auto it = std::find(m_sounds.begin(), m_sounds.end(), sound); it != m_sounds.end())
+    {
+        *it = m_sounds.back();
+        m_sounds.pop_back();
+    }
 }
 
 } // namespace sf
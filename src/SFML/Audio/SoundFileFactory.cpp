@@ -34,12 +34,112 @@
 #include <SFML/Audio/SoundFileWriterOgg.hpp>
 #include <SFML/Audio/SoundFileWriterWav.hpp>
 
+#ifdef SFML_USE_OPUS
+#include <SFML/Audio/SoundFileReaderOpus.hpp>
+#include <SFML/Audio/SoundFileWriterOpus.hpp>
+#endif
+
 #include <SFML/System/Err.hpp>
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <array>
 #include <ostream>
+#include <string>
+#include <string_view>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+namespace SoundFileFactoryImpl
+{
+using CreateReaderFnPtr = std::unique_ptr<sf::SoundFileReader> (*)();
+
+// Reader of the built-in format designated by the extension of a file name, if any
+CreateReaderFnPtr getExtensionReader(const std::filesystem::path& filename)
+{
+    const std::string extension = sf::toLower(filename.extension().string());
+
+    if (extension == ".wav")
+        return &sf::priv::createReader<sf::priv::SoundFileReaderWav>;
+    if (extension == ".flac")
+        return &sf::priv::createReader<sf::priv::SoundFileReaderFlac>;
+    if (extension == ".mp3")
+        return &sf::priv::createReader<sf::priv::SoundFileReaderMp3>;
+    if ((extension == ".ogg") || (extension == ".oga"))
+        return &sf::priv::createReader<sf::priv::SoundFileReaderOgg>;
+#ifdef SFML_USE_OPUS
+    if (extension == ".opus")
+        return &sf::priv::createReader<sf::priv::SoundFileReaderOpus>;
+#endif
+
+    return nullptr;
+}
+
+
+// Reader of the built-in format identified by the magic bytes at the beginning of a stream, if any
+CreateReaderFnPtr sniffReader(sf::InputStream& stream)
+{
+    // A single read gets the headers of all the formats
+    std::array<std::uint8_t, 64> header{};
+    const std::int64_t           read = stream.read(header.data(), static_cast<std::int64_t>(header.size()));
+    if (read < 16)
+        return nullptr;
+
+    const auto size    = static_cast<std::size_t>(read);
+    const auto matches = [&](std::size_t offset, std::string_view magic)
+    {
+        return (offset + magic.size() <= size) &&
+               (std::memcmp(header.data() + offset, magic.data(), magic.size()) == 0);
+    };
+
+    if ((matches(0, "RIFF") || matches(0, "RF64")) && matches(8, "WAVE"))
+        return &sf::priv::createReader<sf::priv::SoundFileReaderWav>;
+
+    if (matches(0, "fLaC"))
+        return &sf::priv::createReader<sf::priv::SoundFileReaderFlac>;
+
+    // The first packet of an Ogg stream, following the segment table of the first page, identifies the codec
+    if (matches(0, "OggS"))
+    {
+        const std::size_t packet = 27 + std::size_t{header[26]};
+        if (matches(packet, "\x01vorbis"))
+            return &sf::priv::createReader<sf::priv::SoundFileReaderOgg>;
+#ifdef SFML_USE_OPUS
+        if (matches(packet, "OpusHead"))
+            return &sf::priv::createReader<sf::priv::SoundFileReaderOpus>;
+#endif
+        return nullptr;
+    }
+
+    // An ID3 tag may precede mp3 frames as well as flac metadata, the data that follows it tells them apart
+    if (matches(0, "ID3") && ((header[6] | header[7] | header[8] | header[9]) & 0x80) == 0)
+    {
+        const std::int64_t tagSize = 10 + ((header[5] & 0x10) ? 10 : 0) +
+                                     ((std::int64_t{header[6]} << 21) | (std::int64_t{header[7]} << 14) |
+                                      (std::int64_t{header[8]} << 7) | std::int64_t{header[9]});
+
+        std::array<char, 4> magic{};
+        if ((stream.seek(tagSize) == tagSize) && (stream.read(magic.data(), 4) == 4) &&
+            (std::string_view(magic.data(), magic.size()) == "fLaC"))
+            return &sf::priv::createReader<sf::priv::SoundFileReaderFlac>;
+
+        return &sf::priv::createReader<sf::priv::SoundFileReaderMp3>;
+    }
+
+    // MPEG audio frame header: sync word, then valid layer, bitrate and sample rate
+    if ((header[0] == 0xFF) && ((header[1] & 0xE0) == 0xE0) && ((header[1] & 0x06) != 0) &&
+        ((header[2] >> 4) != 15) && (((header[2] >> 2) & 3) != 3))
+        return &sf::priv::createReader<sf::priv::SoundFileReaderMp3>;
+
+    return nullptr;
+}
+} // namespace SoundFileFactoryImpl
+} // namespace
 
 
 namespace sf
@@ -55,18 +155,9 @@ std::unique_ptr<SoundFileReader> SoundFileFactory::createReaderFromFilename(cons
         return nullptr;
     }
 
-    // Test the filename in all the registered factories
-    for (const auto& [fpCreate, fpCheck] : getReaderFactoryMap())
-    {
-        if (stream.seek(0) == -1)
-        {
-            err() << "Failed to seek sound stream" << std::endl;
-            return nullptr;
-        }
-
-        if (fpCheck(stream))
-            return fpCreate();
-    }
+    // Find the reader from the extension, or else from the contents of the file read once
+    if (auto reader = createReader(stream, filename))
+        return reader;
 
     // No suitable reader found
     err() << "Failed to open sound file (format not supported)\n" << formatDebugPathInfo(filename) << std::endl;
@@ -81,18 +172,9 @@ std::unique_ptr<SoundFileReader> SoundFileFactory::createReaderFromMemory(const
     MemoryInputStream stream;
     stream.open(data, sizeInBytes);
 
-    // Test the stream for all the registered factories
-    for (const auto& [fpCreate, fpCheck] : getReaderFactoryMap())
-    {
-        if (stream.seek(0) == -1)
-        {
-            err() << "Failed to seek sound stream" << std::endl;
-            return nullptr;
-        }
-
-        if (fpCheck(stream))
-            return fpCreate();
-    }
+    // Find the reader from the contents of the file
+    if (auto reader = createReader(stream, {}))
+        return reader;
 
     // No suitable reader found
     err() << "Failed to open sound file from memory (format not supported)" << std::endl;
@@ -103,25 +185,43 @@ std::unique_ptr<SoundFileReader> SoundFileFactory::createReaderFromMemory(const
 ////////////////////////////////////////////////////////////
 std::unique_ptr<SoundFileReader> SoundFileFactory::createReaderFromStream(InputStream& stream)
 {
-    // Test the stream for all the registered factories
-    for (const auto& [fpCreate, fpCheck] : getReaderFactoryMap())
+    if (stream.seek(0) == -1)
     {
-        if (stream.seek(0) == -1)
-        {
-            err() << "Failed to seek sound stream" << std::endl;
-            return nullptr;
-        }
-
-        if (fpCheck(stream))
-            return fpCreate();
+        err() << "Failed to seek sound stream" << std::endl;
+        return nullptr;
     }
 
+    // Find the reader from the contents of the stream
+    if (auto reader = createReader(stream, {}))
+        return reader;
+
     // No suitable reader found
     err() << "Failed to open sound file from stream (format not supported)" << std::endl;
     return nullptr;
 }
 
 
+////////////////////////////////////////////////////////////
+std::unique_ptr<SoundFileReader> SoundFileFactory::createReaderFromStream(InputStream&                 stream,
+                                                                          const std::filesystem::path& formatHint)
+{
+    if (stream.seek(0) == -1)
+    {
+        err() << "Failed to seek sound stream" << std::endl;
+        return nullptr;
+    }
+
+    // Find the reader from the extension, or else from the contents of the stream
+    if (auto reader = createReader(stream, formatHint))
+        return reader;
+
+    // No suitable reader found
+    err() << "Failed to open sound file from stream (format not supported)\n"
+          << formatDebugPathInfo(formatHint) << std::endl;
+    return nullptr;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::unique_ptr<SoundFileWriter> SoundFileFactory::createWriterFromFilename(const std::filesystem::path& filename)
 {
@@ -138,6 +238,37 @@ std::unique_ptr<SoundFileWriter> SoundFileFactory::createWriterFromFilename(cons
 }
 
 
+////////////////////////////////////////////////////////////
+std::unique_ptr<SoundFileReader> SoundFileFactory::createReader(InputStream&                 stream,
+                                                                const std::filesystem::path& formatHint)
+{
+    const ReaderFactoryMap& readers = getReaderFactoryMap();
+
+    // The extension of a built-in format is trusted, so that the stream isn't even read
+    if (const auto create = SoundFileFactoryImpl::getExtensionReader(formatHint); create && readers.count(create))
+        return create();
+
+    // Otherwise the magic bytes of the built-in formats are looked for, without parsing anything
+    if (const auto create = SoundFileFactoryImpl::sniffReader(stream); create && readers.count(create))
+        return create();
+
+    // Finally, the registered readers are asked one by one, which is needed for custom formats
+    for (const auto& [fpCreate, fpCheck] : readers)
+    {
+        if (stream.seek(0) == -1)
+        {
+            err() << "Failed to seek sound stream" << std::endl;
+            return nullptr;
+        }
+
+        if (fpCheck(stream))
+            return fpCreate();
+    }
+
+    return nullptr;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundFileFactory::ReaderFactoryMap& SoundFileFactory::getReaderFactoryMap()
 {
@@ -145,7 +276,11 @@ SoundFileFactory::ReaderFactoryMap& SoundFileFactory::getReaderFactoryMap()
     static ReaderFactoryMap result{{&priv::createReader<priv::SoundFileReaderFlac>, &priv::SoundFileReaderFlac::check},
                                    {&priv::createReader<priv::SoundFileReaderMp3>, &priv::SoundFileReaderMp3::check},
                                    {&priv::createReader<priv::SoundFileReaderOgg>, &priv::SoundFileReaderOgg::check},
-                                   {&priv::createReader<priv::SoundFileReaderWav>, &priv::SoundFileReaderWav::check}};
+                                   {&priv::createReader<priv::SoundFileReaderWav>, &priv::SoundFileReaderWav::check},
+#ifdef SFML_USE_OPUS
+                                   {&priv::createReader<priv::SoundFileReaderOpus>, &priv::SoundFileReaderOpus::check},
+#endif
+    };
 
     return result;
 }
@@ -157,7 +292,11 @@ SoundFileFactory::WriterFactoryMap& SoundFileFactory::getWriterFactoryMap()
     // The map is pre-populated with default writers on construction
     static WriterFactoryMap result{{&priv::createWriter<priv::SoundFileWriterFlac>, &priv::SoundFileWriterFlac::check},
                                    {&priv::createWriter<priv::SoundFileWriterOgg>, &priv::SoundFileWriterOgg::check},
-                                   {&priv::createWriter<priv::SoundFileWriterWav>, &priv::SoundFileWriterWav::check}};
+                                   {&priv::createWriter<priv::SoundFileWriterWav>, &priv::SoundFileWriterWav::check},
+#ifdef SFML_USE_OPUS
+                                   {&priv::createWriter<priv::SoundFileWriterOpus>, &priv::SoundFileWriterOpus::check},
+#endif
+    };
 
     return result;
 }
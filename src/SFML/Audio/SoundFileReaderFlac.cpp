@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <ostream>
+#include <type_traits>
 
 #include <cassert>
 #include <cstddef>
@@ -110,6 +111,16 @@ FLAC__bool streamEof(const FLAC__StreamDecoder*, void* clientData)
     return data->stream->tell() == data->stream->getSize();
 }
 
+std::int16_t toInt16(std::int32_t sample)
+{
+    return static_cast<std::int16_t>(sample >> 16);
+}
+
+float toFloat(std::int32_t sample)
+{
+    return static_cast<float>(sample) / 2147483648.f;
+}
+
 FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
                                            const FLAC__Frame*       frame,
                                            const FLAC__int32* const buffer[],
@@ -122,36 +133,28 @@ FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
     if (data->remaining < frameSamples)
         data->leftovers.reserve(static_cast<std::size_t>(frameSamples - data->remaining));
 
+    // Samples are kept left-justified to 32 bits so that they can be converted to any output format
+    const unsigned int bitsPerSample = frame->header.bits_per_sample;
+    assert(bitsPerSample >= 4 && bitsPerSample <= 32 && "Invalid bits per sample. Must be between 4 and 32.");
+    const unsigned int shift = 32 - bitsPerSample;
+
     // Decode the samples
     for (unsigned i = 0; i < frame->header.blocksize; ++i)
     {
         for (unsigned int j = 0; j < frame->header.channels; ++j)
         {
             // Decode the current sample
-            std::int16_t sample = 0;
-            switch (frame->header.bits_per_sample)
-            {
-                case 8:
-                    sample = static_cast<std::int16_t>(buffer[j][i] << 8);
-                    break;
-                case 16:
-                    sample = static_cast<std::int16_t>(buffer[j][i]);
-                    break;
-                case 24:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 8);
-                    break;
-                case 32:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 16);
-                    break;
-                default:
-                    assert(false && "Invalid bits per sample. Must be 8, 16, 24, or 32.");
-                    break;
-            }
+            const auto sample = static_cast<std::int32_t>(static_cast<std::uint32_t>(buffer[j][i]) << shift);
 
             if (data->buffer && data->remaining > 0)
             {
                 // If there's room in the output buffer, copy the sample there
-                *data->buffer++ = sample;
+                *data->buffer++ = toInt16(sample);
+                --data->remaining;
+            }
+            else if (data->floatBuffer && data->remaining > 0)
+            {
+                *data->floatBuffer++ = toFloat(sample);
                 --data->remaining;
             }
             else
@@ -335,8 +338,9 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
     // Reset the callback data (the "write" callback will be called)
-    m_clientData.buffer    = nullptr;
-    m_clientData.remaining = 0;
+    m_clientData.buffer      = nullptr;
+    m_clientData.floatBuffer = nullptr;
+    m_clientData.remaining   = 0;
     m_clientData.leftovers.clear();
 
     // FLAC decoder expects absolute sample offset, so we take the channel count out
@@ -361,9 +365,32 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
 
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t maxCount)
+{
+    return readSamples(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderFlac::readFloat(float* samples, std::uint64_t maxCount)
+{
+    return readSamples(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::uint64_t SoundFileReaderFlac::readSamples(T* samples, std::uint64_t maxCount)
 {
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
+    const auto convert = [](std::int32_t sample)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return toFloat(sample);
+        else
+            return toInt16(sample);
+    };
+
     // If there are leftovers from previous call, use it first
     const std::size_t left = m_clientData.leftovers.size();
     if (left > 0)
@@ -371,24 +398,23 @@ std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t max
         if (left > maxCount)
         {
             // There are more leftovers than needed
-            std::copy(m_clientData.leftovers.begin(),
-                      m_clientData.leftovers.begin() + static_cast<std::vector<std::int16_t>::difference_type>(maxCount),
-                      samples);
-            std::vector<std::int16_t> leftovers(m_clientData.leftovers.begin() +
-                                                    static_cast<std::vector<std::int16_t>::difference_type>(maxCount),
-                                                m_clientData.leftovers.end());
-            m_clientData.leftovers.swap(leftovers);
+            const auto used = m_clientData.leftovers.begin() + static_cast<std::ptrdiff_t>(maxCount);
+            std::transform(m_clientData.leftovers.begin(), used, samples, convert);
+            m_clientData.leftovers.erase(m_clientData.leftovers.begin(), used);
             return maxCount;
         }
         else
         {
             // We can use all the leftovers and decode new frames
-            std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples);
+            std::transform(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples, convert);
         }
     }
 
     // Reset the data that will be used in the callback
-    m_clientData.buffer    = samples + left;
+    if constexpr (std::is_same_v<T, float>)
+        m_clientData.floatBuffer = samples + left;
+    else
+        m_clientData.buffer = samples + left;
     m_clientData.remaining = maxCount - left;
     m_clientData.leftovers.clear();
 
@@ -405,6 +431,9 @@ std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t max
             break;
     }
 
+    m_clientData.buffer      = nullptr;
+    m_clientData.floatBuffer = nullptr;
+
     return maxCount - m_clientData.remaining;
 }
 
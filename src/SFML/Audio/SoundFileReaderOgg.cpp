@@ -30,6 +30,8 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <ostream>
 
 #include <cassert>
@@ -173,6 +175,11 @@ std::optional<SoundFileReader::Info> SoundFileReaderOgg::open(InputStream& strea
     // We must keep the channel count for the seek function
     m_channelCount = info.channelCount;
 
+    // The seek index is only built on the first seek, playing the file from the start doesn't need it
+    m_stream = &stream;
+    m_seekIndex.clear();
+    m_seekIndexBuilt = false;
+
     return info;
 }
 
@@ -182,7 +189,36 @@ void SoundFileReaderOgg::seek(std::uint64_t sampleOffset)
 {
     assert(m_vorbis.datasource && "Vorbis datasource is missing. Call SoundFileReaderOgg::open() to initialize it.");
 
-    ov_pcm_seek(&m_vorbis, static_cast<ogg_int64_t>(sampleOffset / m_channelCount));
+    const auto frame = static_cast<ogg_int64_t>(sampleOffset / m_channelCount);
+
+    if (!m_seekIndexBuilt)
+        buildSeekIndex();
+
+    // Jump to a page starting a bit before the requested frame, since decoding
+    // starts after the first packet of the page, then decode up to the frame
+    const auto next = std::upper_bound(m_seekIndex.begin(),
+                                       m_seekIndex.end(),
+                                       frame,
+                                       [](ogg_int64_t value, const SeekPoint& point) { return value < point.frame; });
+    if (next - m_seekIndex.begin() >= 2 && ov_raw_seek(&m_vorbis, std::prev(next, 2)->offset) == 0)
+    {
+        ogg_int64_t position = ov_pcm_tell(&m_vorbis);
+        while ((position >= 0) && (position < frame))
+        {
+            float**    channels   = nullptr;
+            const auto framesLeft = static_cast<int>(std::min<ogg_int64_t>(frame - position, 4096));
+            if (ov_read_float(&m_vorbis, &channels, framesLeft, nullptr) <= 0)
+                break;
+
+            position = ov_pcm_tell(&m_vorbis);
+        }
+
+        if (position == frame)
+            return;
+    }
+
+    // Fall back to the bisection of libvorbisfile
+    ov_pcm_seek(&m_vorbis, frame);
 }
 
 
@@ -214,6 +250,37 @@ std::uint64_t SoundFileReaderOgg::read(std::int16_t* samples, std::uint64_t maxC
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderOgg::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_vorbis.datasource && "Vorbis datasource is missing. Call SoundFileReaderOgg::open() to initialize it.");
+
+    // Vorbis decodes to floating point natively, so the samples only need to be interleaved
+    std::uint64_t count = 0;
+    while (count + m_channelCount <= maxCount)
+    {
+        float**    channels     = nullptr;
+        const auto framesToRead = static_cast<int>((maxCount - count) / m_channelCount);
+        const long framesRead   = ov_read_float(&m_vorbis, &channels, framesToRead, nullptr);
+        if (framesRead > 0)
+        {
+            for (long i = 0; i < framesRead; ++i)
+                for (unsigned int j = 0; j < m_channelCount; ++j)
+                    *samples++ = channels[j][i];
+
+            count += static_cast<std::uint64_t>(framesRead) * m_channelCount;
+        }
+        else
+        {
+            // error or end of file
+            break;
+        }
+    }
+
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileReaderOgg::close()
 {
@@ -222,7 +289,65 @@ void SoundFileReaderOgg::close()
         ov_clear(&m_vorbis);
         m_vorbis.datasource = nullptr;
         m_channelCount      = 0;
+        m_stream            = nullptr;
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderOgg::buildSeekIndex()
+{
+    m_seekIndexBuilt = true;
+
+    if (!m_stream || !ov_seekable(&m_vorbis) || ov_streams(&m_vorbis) != 1)
+        return;
+
+    if (m_stream->seek(0) != 0)
+        return;
+
+    ogg_sync_state sync;
+    ogg_sync_init(&sync);
+
+    // Record every audio page of the Vorbis stream, with the frame that decoding from the page resumes at
+    const long  serialNumber  = ov_serialnumber(&m_vorbis, 0);
+    ogg_page    page;
+    ogg_int64_t offset        = 0;
+    ogg_int64_t previousFrame = 0;
+    for (;;)
+    {
+        const long result = ogg_sync_pageseek(&sync, &page);
+        if (result == 0)
+        {
+            // Not enough data for a full page, read more
+            constexpr long bufferSize = 65536;
+            char*          buffer     = ogg_sync_buffer(&sync, bufferSize);
+            const auto     bytesRead  = m_stream->read(buffer, bufferSize);
+            if (bytesRead <= 0)
+                break;
+
+            ogg_sync_wrote(&sync, static_cast<long>(bytesRead));
+        }
+        else if (result < 0)
+        {
+            // Skipped bytes that are not part of a page
+            offset -= result;
+        }
+        else
+        {
+            // Header pages have a zero granule position, pages that don't end a packet have none
+            const ogg_int64_t granule = ogg_page_granulepos(&page);
+            if ((ogg_page_serialno(&page) == serialNumber) && (granule > 0))
+            {
+                if (previousFrame > 0)
+                    m_seekIndex.push_back({previousFrame, offset});
+                previousFrame = granule;
+            }
+
+            offset += result;
+        }
+    }
+
+    ogg_sync_clear(&sync);
+}
+
 } // namespace sf::priv
@@ -32,6 +32,7 @@
 #include <vorbis/vorbisfile.h>
 
 #include <optional>
+#include <vector>
 
 #include <cstdint>
 
@@ -86,6 +87,10 @@ public:
     /// If the given offset exceeds to total number of samples,
     /// this function must jump to the end of the file.
     ///
+    /// The first seek builds an index of the pages of the file,
+    /// so that the following seeks jump straight to the right
+    /// page instead of bisecting the file.
+    ///
     /// \param sampleOffset Index of the sample to jump to, relative to the beginning
     ///
     ////////////////////////////////////////////////////////////
@@ -102,6 +107,17 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as floating point values
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override;
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Close the open Vorbis file
@@ -109,11 +125,33 @@ private:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Scan the pages of the file to build the seek index
+    ///
+    /// Chained files and files that can't be seeked are not
+    /// indexed, they are seeked by bisection.
+    ///
+    ////////////////////////////////////////////////////////////
+    void buildSeekIndex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Page of the file where decoding can start
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SeekPoint
+    {
+        ogg_int64_t frame{};  //!< Approximate index of the first frame decoded from the page
+        ogg_int64_t offset{}; //!< Offset of the page, in bytes from the beginning of the file
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    OggVorbis_File m_vorbis{};       // ogg/vorbis file handle
-    unsigned int   m_channelCount{}; // number of channels of the open sound file
+    OggVorbis_File         m_vorbis{};         // ogg/vorbis file handle
+    unsigned int           m_channelCount{};   // number of channels of the open sound file
+    InputStream*           m_stream{};         // stream of the open sound file, scanned to build the seek index
+    std::vector<SeekPoint> m_seekIndex;        // seek points of the file, ordered by frame
+    bool                   m_seekIndexBuilt{}; // whether the file was already scanned to build the seek index
 };
 
 } // namespace sf::priv
@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundFileReaderOpus.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/InputStream.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cassert>
+#include <cstdio>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SoundFileReaderOpusImpl
+{
+int read(void* data, unsigned char* ptr, int nbytes)
+{
+    auto* stream = static_cast<sf::InputStream*>(data);
+    return static_cast<int>(stream->read(ptr, nbytes));
+}
+
+int seek(void* data, opus_int64 offset, int whence)
+{
+    auto* stream = static_cast<sf::InputStream*>(data);
+    switch (whence)
+    {
+        case SEEK_SET:
+            break;
+        case SEEK_CUR:
+            offset += stream->tell();
+            break;
+        case SEEK_END:
+            offset = stream->getSize() + offset;
+            break;
+    }
+
+    // Unlike libvorbisfile, libopusfile expects 0 on success
+    return stream->seek(offset) == offset ? 0 : -1;
+}
+
+opus_int64 tell(void* data)
+{
+    auto* stream = static_cast<sf::InputStream*>(data);
+    return stream->tell();
+}
+
+const OpusFileCallbacks callbacks = {&read, &seek, &tell, nullptr};
+} // namespace SoundFileReaderOpusImpl
+} // namespace
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool SoundFileReaderOpus::check(InputStream& stream)
+{
+    OggOpusFile* file = op_test_callbacks(&stream, &SoundFileReaderOpusImpl::callbacks, nullptr, 0, nullptr);
+    if (file)
+    {
+        op_free(file);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+SoundFileReaderOpus::~SoundFileReaderOpus()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SoundFileReader::Info> SoundFileReaderOpus::open(InputStream& stream)
+{
+    // Open the Opus stream
+    int error = 0;
+    m_opus    = op_open_callbacks(&stream, &SoundFileReaderOpusImpl::callbacks, nullptr, 0, &error);
+    if (!m_opus)
+    {
+        err() << "Failed to open Opus file for reading" << std::endl;
+        return std::nullopt;
+    }
+
+    // Retrieve the music attributes; libopusfile always decodes at 48 kHz
+    const OpusHead*   header     = op_head(m_opus, -1);
+    const ogg_int64_t frameCount = op_pcm_total(m_opus, -1);
+    Info              info;
+    info.channelCount = static_cast<unsigned int>(header->channel_count);
+    info.sampleRate   = 48000;
+    info.sampleCount  = static_cast<std::uint64_t>(std::max<ogg_int64_t>(frameCount, 0)) * info.channelCount;
+
+    // Opus uses the Vorbis channel mapping, refer to: https://www.rfc-editor.org/rfc/rfc7845#section-5.1.1.2
+    switch (info.channelCount)
+    {
+        case 0:
+            err() << "No channels in Opus file" << std::endl;
+            break;
+        case 1:
+            info.channelMap = {SoundChannel::Mono};
+            break;
+        case 2:
+            info.channelMap = {SoundChannel::FrontLeft, SoundChannel::FrontRight};
+            break;
+        case 3:
+            info.channelMap = {SoundChannel::FrontLeft, SoundChannel::FrontCenter, SoundChannel::FrontRight};
+            break;
+        case 4:
+            info.channelMap = {SoundChannel::FrontLeft, SoundChannel::FrontRight, SoundChannel::BackLeft, SoundChannel::BackRight};
+            break;
+        case 5:
+            info.channelMap = {SoundChannel::FrontLeft,
+                               SoundChannel::FrontCenter,
+                               SoundChannel::FrontRight,
+                               SoundChannel::BackLeft,
+                               SoundChannel::BackRight};
+            break;
+        case 6:
+            info.channelMap = {SoundChannel::FrontLeft,
+                               SoundChannel::FrontCenter,
+                               SoundChannel::FrontRight,
+                               SoundChannel::BackLeft,
+                               SoundChannel::BackRight,
+                               SoundChannel::LowFrequencyEffects};
+            break;
+        case 7:
+            info.channelMap = {SoundChannel::FrontLeft,
+                               SoundChannel::FrontCenter,
+                               SoundChannel::FrontRight,
+                               SoundChannel::SideLeft,
+                               SoundChannel::SideRight,
+                               SoundChannel::BackCenter,
+                               SoundChannel::LowFrequencyEffects};
+            break;
+        case 8:
+            info.channelMap = {SoundChannel::FrontLeft,
+                               SoundChannel::FrontCenter,
+                               SoundChannel::FrontRight,
+                               SoundChannel::SideLeft,
+                               SoundChannel::SideRight,
+                               SoundChannel::BackLeft,
+                               SoundChannel::BackRight,
+                               SoundChannel::LowFrequencyEffects};
+            break;
+        default:
+            err() << "Opus files with more than 8 channels not supported" << std::endl;
+            close();
+            return std::nullopt;
+    }
+
+    // We must keep the channel count for the seek function
+    m_channelCount = info.channelCount;
+
+    return info;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderOpus::seek(std::uint64_t sampleOffset)
+{
+    assert(m_opus && "Opus file is missing. Call SoundFileReaderOpus::open() to initialize it.");
+
+    // libopusfile fails to seek past the end, clamp to the last frame
+    const ogg_int64_t total = op_pcm_total(m_opus, -1);
+    const auto        frame = static_cast<ogg_int64_t>(sampleOffset / m_channelCount);
+    op_pcm_seek(m_opus, total >= 0 ? std::min(frame, total) : frame);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderOpus::read(std::int16_t* samples, std::uint64_t maxCount)
+{
+    assert(m_opus && "Opus file is missing. Call SoundFileReaderOpus::open() to initialize it.");
+
+    // Try to read the requested number of samples, stop only on error or end of file
+    std::uint64_t count = 0;
+    while (count + m_channelCount <= maxCount)
+    {
+        const auto samplesToRead = static_cast<int>(std::min<std::uint64_t>(maxCount - count, 1 << 20));
+        int        link          = 0;
+        const int  framesRead    = op_read(m_opus, samples, samplesToRead, &link);
+        if (framesRead == OP_HOLE)
+            continue;
+
+        // Stop on error, end of file or a chained link with a different channel count
+        if ((framesRead <= 0) || (static_cast<unsigned int>(op_channel_count(m_opus, link)) != m_channelCount))
+            break;
+
+        const std::uint64_t samplesRead = static_cast<std::uint64_t>(framesRead) * m_channelCount;
+        count += samplesRead;
+        samples += samplesRead;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderOpus::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_opus && "Opus file is missing. Call SoundFileReaderOpus::open() to initialize it.");
+
+    // Opus decodes to floating point natively, no conversion needed
+    std::uint64_t count = 0;
+    while (count + m_channelCount <= maxCount)
+    {
+        const auto samplesToRead = static_cast<int>(std::min<std::uint64_t>(maxCount - count, 1 << 20));
+        int        link          = 0;
+        const int  framesRead    = op_read_float(m_opus, samples, samplesToRead, &link);
+        if (framesRead == OP_HOLE)
+            continue;
+
+        // Stop on error, end of file or a chained link with a different channel count
+        if ((framesRead <= 0) || (static_cast<unsigned int>(op_channel_count(m_opus, link)) != m_channelCount))
+            break;
+
+        const std::uint64_t samplesRead = static_cast<std::uint64_t>(framesRead) * m_channelCount;
+        count += samplesRead;
+        samples += samplesRead;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderOpus::close()
+{
+    if (m_opus)
+    {
+        op_free(m_opus);
+        m_opus         = nullptr;
+        m_channelCount = 0;
+    }
+}
+
+} // namespace sf::priv
@@ -31,12 +31,17 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
 #include <array>
+#include <optional>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 
 namespace
@@ -83,6 +88,67 @@ ma_result onSeek(ma_decoder* decoder, ma_int64 byteOffset, ma_seek_origin origin
             return MA_ERROR;
     }
 }
+
+std::uint32_t readUint32(const unsigned char* bytes)
+{
+    return static_cast<std::uint32_t>(bytes[0] | (bytes[1] << 8) | (bytes[2] << 16)) |
+           (static_cast<std::uint32_t>(bytes[3]) << 24);
+}
+
+std::uint16_t readUint16(const unsigned char* bytes)
+{
+    return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+// Locate the samples of a wav file stored in memory, if they are stored little endian with the given encoding
+std::optional<std::pair<std::size_t, std::size_t>> findSamples(const void*   data,
+                                                               std::size_t   sizeInBytes,
+                                                               std::uint16_t encoding,
+                                                               std::uint16_t bitsPerSample)
+{
+    // Samples are stored in little endian order
+    constexpr std::uint16_t probe = 1;
+    if (*reinterpret_cast<const unsigned char*>(&probe) != 1)
+        return std::nullopt;
+
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    if (sizeInBytes < 12 || std::memcmp(bytes, "RIFF", 4) != 0 || std::memcmp(bytes + 8, "WAVE", 4) != 0)
+        return std::nullopt;
+
+    // Walk the chunks, the format chunk comes before the data chunk
+    bool        isMatching = false;
+    std::size_t offset     = 12;
+    while (offset < sizeInBytes && sizeInBytes - offset >= 8)
+    {
+        const unsigned char* chunk     = bytes + offset;
+        const std::size_t    chunkSize = std::min<std::size_t>(readUint32(chunk + 4), sizeInBytes - offset - 8);
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16)
+        {
+            const std::uint16_t formatTag    = readUint16(chunk + 8);
+            const std::uint16_t channelCount = readUint16(chunk + 10);
+            const std::uint16_t blockAlign   = readUint16(chunk + 20);
+            const std::uint16_t bits         = readUint16(chunk + 22);
+
+            // The encoding tag, or WAVE_FORMAT_EXTENSIBLE whose sub-format GUID starts with the encoding tag
+            const bool isExtensible = formatTag == 0xFFFE && chunkSize >= 40 && readUint16(chunk + 32) == encoding;
+            isMatching = (formatTag == encoding || isExtensible) && bits == bitsPerSample &&
+                         blockAlign == channelCount * bitsPerSample / 8;
+        }
+        else if (std::memcmp(chunk, "data", 4) == 0)
+        {
+            if (!isMatching)
+                return std::nullopt;
+
+            return std::pair(offset + 8, chunkSize);
+        }
+
+        // Chunks are padded to an even size
+        offset += 8 + chunkSize + (chunkSize % 2);
+    }
+
+    return std::nullopt;
+}
 } // namespace
 
 namespace sf::priv
@@ -105,6 +171,18 @@ bool SoundFileReaderWav::check(InputStream& stream)
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<SoundFileReaderWav::Pcm16Samples> SoundFileReaderWav::findPcm16Samples(const void* data,
+                                                                                  std::size_t sizeInBytes)
+{
+    // WAVE_FORMAT_PCM
+    if (const auto samples = findSamples(data, sizeInBytes, 1, 16))
+        return Pcm16Samples{samples->first, samples->second};
+
+    return std::nullopt;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundFileReaderWav::~SoundFileReaderWav()
 {
@@ -134,7 +212,7 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
 
     auto config           = ma_decoder_config_init_default();
     config.encodingFormat = ma_encoding_format_wav;
-    config.format         = ma_format_s16;
+    config.format         = ma_format_unknown; // Decode in the format of the file, read() converts as needed
 
     if (const ma_result result = ma_decoder_init(&onRead, &onSeek, &stream, &config, &*m_decoder); result != MA_SUCCESS)
     {
@@ -150,11 +228,10 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
         return std::nullopt;
     }
 
-    auto                       format = ma_format_unknown;
     ma_uint32                  sampleRate{};
     std::array<ma_channel, 20> channelMap{};
     if (const ma_result result = ma_decoder_get_data_format(&*m_decoder,
-                                                            &format,
+                                                            &m_format,
                                                             &m_channelCount,
                                                             &sampleRate,
                                                             channelMap.data(),
@@ -171,6 +248,24 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
     for (auto i = 0u; i < m_channelCount; ++i)
         soundChannels.emplace_back(priv::MiniaudioUtils::miniaudioChannelToSoundChannel(channelMap[i]));
 
+    // Floating point samples of a file held in memory can be handed out without being decoded
+    m_inPlaceSamples = nullptr;
+    m_frameCount     = frameCount;
+
+    if (const void* data = stream.getData(); data && (m_format == ma_format_f32))
+    {
+        // WAVE_FORMAT_IEEE_FLOAT
+        const auto size    = static_cast<std::size_t>(stream.getSize());
+        const auto samples = findSamples(data, size, 3, 32);
+
+        if (samples && (samples->second / (m_channelCount * sizeof(float)) >= frameCount))
+        {
+            const auto* first = static_cast<const std::byte*>(data) + samples->first;
+            if (reinterpret_cast<std::uintptr_t>(first) % alignof(float) == 0)
+                m_inPlaceSamples = reinterpret_cast<const float*>(first);
+        }
+    }
+
     return Info{frameCount * m_channelCount, m_channelCount, sampleRate, std::move(soundChannels)};
 }
 
@@ -188,14 +283,90 @@ void SoundFileReaderWav::seek(std::uint64_t sampleOffset)
 
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundFileReaderWav::read(std::int16_t* samples, std::uint64_t maxCount)
+{
+    return readConverted(samples, ma_format_s16, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readFloat(float* samples, std::uint64_t maxCount)
+{
+    return readConverted(samples, ma_format_f32, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readFloatInPlace(const float*& samples, std::uint64_t maxCount)
 {
     assert(m_decoder && "wav decoder not initialized. Call SoundFileReaderWav::open() to initialize it.");
 
-    ma_uint64 framesRead{};
+    samples = nullptr;
+    if (!m_inPlaceSamples)
+        return 0;
 
-    if (const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, samples, maxCount / m_channelCount, &framesRead);
-        result != MA_SUCCESS)
-        err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+    ma_uint64 cursor{};
+    if (const ma_result result = ma_decoder_get_cursor_in_pcm_frames(&*m_decoder, &cursor); result != MA_SUCCESS)
+    {
+        err() << "Failed to get the cursor of wav sound stream: " << ma_result_description(result) << std::endl;
+        return 0;
+    }
+
+    cursor                 = std::min(cursor, m_frameCount);
+    const ma_uint64 frames = std::min<ma_uint64>(maxCount / m_channelCount, m_frameCount - cursor);
+
+    // Move the decoder past the samples, so that the next reads and seeks start from there
+    if (const ma_result result = ma_decoder_seek_to_pcm_frame(&*m_decoder, cursor + frames); result != MA_SUCCESS)
+    {
+        err() << "Failed to seek wav sound stream: " << ma_result_description(result) << std::endl;
+        return 0;
+    }
+
+    samples = m_inPlaceSamples + cursor * m_channelCount;
+    return frames * m_channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readConverted(void* samples, ma_format format, std::uint64_t maxCount)
+{
+    assert(m_decoder && "wav decoder not initialized. Call SoundFileReaderWav::open() to initialize it.");
+
+    const ma_uint64 frameCount = maxCount / m_channelCount;
+    ma_uint64       framesRead{};
+
+    // Samples stored in the requested format are decoded straight to the output
+    if (m_format == format)
+    {
+        if (const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, samples, frameCount, &framesRead);
+            (result != MA_SUCCESS) && (result != MA_AT_END))
+            err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+
+        return framesRead * m_channelCount;
+    }
+
+    // Other formats go through a temporary block that is converted to the requested format
+    constexpr ma_uint64 blockFrames = 1024;
+    const ma_uint32     frameSize   = ma_get_bytes_per_frame(m_format, m_channelCount);
+    const ma_uint32     outputSize  = ma_get_bytes_per_frame(format, m_channelCount);
+    m_block.resize(static_cast<std::size_t>(blockFrames * frameSize));
+
+    auto* output = static_cast<std::uint8_t*>(samples);
+    while (framesRead < frameCount)
+    {
+        const ma_uint64 toRead = std::min(frameCount - framesRead, blockFrames);
+        ma_uint64       read{};
+
+        if (const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, m_block.data(), toRead, &read);
+            (result != MA_SUCCESS) && (result != MA_AT_END))
+            err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+
+        ma_pcm_convert(output, format, m_block.data(), m_format, read * m_channelCount, ma_dither_mode_none);
+        output += read * outputSize;
+        framesRead += read;
+
+        if (read < toRead)
+            break;
+    }
 
     return framesRead * m_channelCount;
 }
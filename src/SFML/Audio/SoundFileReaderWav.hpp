@@ -32,7 +32,9 @@
 #include <miniaudio.h>
 
 #include <optional>
+#include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -60,6 +62,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool check(InputStream& stream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of 16-bit PCM samples in a wav file
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Pcm16Samples
+    {
+        std::size_t offset{}; //!< Offset of the first sample, in bytes from the beginning of the file
+        std::size_t size{};   //!< Size of the samples, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Locate the samples of a wav file stored in memory
+    ///
+    /// Only files storing 16-bit little endian PCM samples on
+    /// a little endian machine can be read in place; any other
+    /// file has to be decoded.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to load, in bytes
+    ///
+    /// \return Location of the samples if they can be used without decoding
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Pcm16Samples> findPcm16Samples(const void* data, std::size_t sizeInBytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -102,12 +129,54 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as floating point values
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next floating point samples of the file without copying them
+    ///
+    /// Only files storing 32-bit floating point samples, opened
+    /// from a stream whose contents are in memory, can be read
+    /// in place.
+    ///
+    /// \param samples  Pointer to set to the first sample, or to a null pointer if the samples can't be read in place
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloatInPlace(const float*& samples, std::uint64_t maxCount) override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples and convert them to the given format
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param format   Format of the samples to output
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readConverted(void* samples, ma_format format, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::optional<ma_decoder> m_decoder;        //!< wav decoder
-    ma_uint32                 m_channelCount{}; //!< Number of channels
+    std::optional<ma_decoder> m_decoder;                   //!< wav decoder
+    ma_uint32                 m_channelCount{};            //!< Number of channels
+    ma_format                 m_format{ma_format_unknown}; //!< Format in which the file stores its samples
+    std::vector<std::uint8_t> m_block;                     //!< Decoded samples waiting to be converted
+    const float*              m_inPlaceSamples{};          //!< Samples of a file in memory, if readable in place
+    ma_uint64                 m_frameCount{};              //!< Number of frames of the file
 };
 
 } // namespace sf::priv
@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundFileWriterOpus.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <string_view>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SoundFileWriterOpusImpl
+{
+void appendUint16(std::vector<unsigned char>& data, std::uint16_t value)
+{
+    data.push_back(static_cast<unsigned char>(value & 0xFF));
+    data.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+void appendUint32(std::vector<unsigned char>& data, std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        data.push_back(static_cast<unsigned char>((value >> (i * 8)) & 0xFF));
+}
+
+void appendString(std::vector<unsigned char>& data, std::string_view string)
+{
+    data.insert(data.end(), string.begin(), string.end());
+}
+} // namespace SoundFileWriterOpusImpl
+} // namespace
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool SoundFileWriterOpus::check(const std::filesystem::path& filename)
+{
+    return toLower(filename.extension().string()) == ".opus";
+}
+
+
+////////////////////////////////////////////////////////////
+SoundFileWriterOpus::~SoundFileWriterOpus()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileWriterOpus::open(const std::filesystem::path&     filename,
+                               unsigned int                     sampleRate,
+                               unsigned int                     channelCount,
+                               const std::vector<SoundChannel>& channelMap)
+{
+    using namespace SoundFileWriterOpusImpl;
+
+    // Opus only encodes a few sample rates, all dividing the 48 kHz rate of the granule positions
+    if (sampleRate != 8000 && sampleRate != 12000 && sampleRate != 16000 && sampleRate != 24000 && sampleRate != 48000)
+    {
+        err() << "Failed to write Opus file (unsupported sample rate: " << sampleRate << " Hz)\n"
+              << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    std::vector<SoundChannel> targetChannelMap;
+
+    // Opus uses the Vorbis channel mapping, refer to: https://www.rfc-editor.org/rfc/rfc7845#section-5.1.1.2
+    switch (channelCount)
+    {
+        case 0:
+            err() << "No channels to write to Opus file" << std::endl;
+            return false;
+        case 1:
+            targetChannelMap = {SoundChannel::Mono};
+            break;
+        case 2:
+            targetChannelMap = {SoundChannel::FrontLeft, SoundChannel::FrontRight};
+            break;
+        case 3:
+            targetChannelMap = {SoundChannel::FrontLeft, SoundChannel::FrontCenter, SoundChannel::FrontRight};
+            break;
+        case 4:
+            targetChannelMap = {SoundChannel::FrontLeft, SoundChannel::FrontRight, SoundChannel::BackLeft, SoundChannel::BackRight};
+            break;
+        case 5:
+            targetChannelMap = {SoundChannel::FrontLeft,
+                                SoundChannel::FrontCenter,
+                                SoundChannel::FrontRight,
+                                SoundChannel::BackLeft,
+                                SoundChannel::BackRight};
+            break;
+        case 6:
+            targetChannelMap = {SoundChannel::FrontLeft,
+                                SoundChannel::FrontCenter,
+                                SoundChannel::FrontRight,
+                                SoundChannel::BackLeft,
+                                SoundChannel::BackRight,
+                                SoundChannel::LowFrequencyEffects};
+            break;
+        case 7:
+            targetChannelMap = {SoundChannel::FrontLeft,
+                                SoundChannel::FrontCenter,
+                                SoundChannel::FrontRight,
+                                SoundChannel::SideLeft,
+                                SoundChannel::SideRight,
+                                SoundChannel::BackCenter,
+                                SoundChannel::LowFrequencyEffects};
+            break;
+        case 8:
+            targetChannelMap = {SoundChannel::FrontLeft,
+                                SoundChannel::FrontCenter,
+                                SoundChannel::FrontRight,
+                                SoundChannel::SideLeft,
+                                SoundChannel::SideRight,
+                                SoundChannel::BackLeft,
+                                SoundChannel::BackRight,
+                                SoundChannel::LowFrequencyEffects};
+            break;
+        default:
+            err() << "Opus files with more than 8 channels not supported" << std::endl;
+            return false;
+    }
+
+    // Check if the channel map contains channels that we cannot remap to a mapping supported by Opus
+    if (!std::is_permutation(channelMap.begin(), channelMap.end(), targetChannelMap.begin()))
+    {
+        err() << "Provided channel map cannot be reordered to a channel map supported by Opus" << std::endl;
+        return false;
+    }
+
+    // Build the remap table
+    for (auto i = 0u; i < channelCount; ++i)
+        m_remapTable[i] = static_cast<std::size_t>(
+            std::find(channelMap.begin(), channelMap.end(), targetChannelMap[i]) - channelMap.begin());
+
+    // Save the channel count
+    m_channelCount = channelCount;
+
+    // Create the encoder: mapping family 0 for mono and stereo, family 1 (surround) above
+    const int                    mappingFamily = channelCount > 2 ? 1 : 0;
+    int                          streamCount   = 0;
+    int                          coupledCount  = 0;
+    std::array<unsigned char, 8> mapping{};
+    int                          status = OPUS_OK;
+    m_encoder = opus_multistream_surround_encoder_create(static_cast<opus_int32>(sampleRate),
+                                                         static_cast<int>(channelCount),
+                                                         mappingFamily,
+                                                         &streamCount,
+                                                         &coupledCount,
+                                                         mapping.data(),
+                                                         OPUS_APPLICATION_AUDIO,
+                                                         &status);
+    if (status != OPUS_OK)
+    {
+        err() << "Failed to write Opus file (" << opus_strerror(status) << ")\n"
+              << formatDebugPathInfo(filename) << std::endl;
+        m_encoder = nullptr;
+        return false;
+    }
+
+    // The delay of the encoder is skipped by the decoders, it is expressed at 48 kHz like all positions
+    opus_int32 lookahead = 0;
+    opus_multistream_encoder_ctl(m_encoder, OPUS_GET_LOOKAHEAD(&lookahead));
+    m_granuleScale  = static_cast<ogg_int64_t>(48000 / sampleRate);
+    m_preSkip       = lookahead * m_granuleScale;
+    m_inputFrames   = 0;
+    m_encodedFrames = 0;
+    m_packetNumber  = 0;
+
+    // Frames of 20 ms, each packet may take up to 1275 bytes per stream plus the framing of the streams
+    m_frameSize = sampleRate / 50;
+    m_frameFill = 0;
+    m_frame.assign(m_frameSize * channelCount, 0);
+    m_packet.resize(1277 * static_cast<std::size_t>(streamCount));
+
+    // Open the file after the opus setup is ok
+    m_file.open(filename, std::ios::binary);
+    if (!m_file)
+    {
+        err() << "Failed to write Opus file (cannot open file)\n" << formatDebugPathInfo(filename) << std::endl;
+        close();
+        return false;
+    }
+
+    // Initialize the ogg stream
+    static std::mt19937 rng(std::random_device{}());
+    ogg_stream_init(&m_ogg, std::uniform_int_distribution(0, std::numeric_limits<int>::max())(rng));
+
+    // Write the identification header, refer to: https://www.rfc-editor.org/rfc/rfc7845#section-5.1
+    std::vector<unsigned char> header;
+    appendString(header, "OpusHead");
+    header.push_back(1); // version
+    header.push_back(static_cast<unsigned char>(channelCount));
+    appendUint16(header, static_cast<std::uint16_t>(m_preSkip));
+    appendUint32(header, sampleRate);
+    appendUint16(header, 0); // output gain
+    header.push_back(static_cast<unsigned char>(mappingFamily));
+    if (mappingFamily != 0)
+    {
+        header.push_back(static_cast<unsigned char>(streamCount));
+        header.push_back(static_cast<unsigned char>(coupledCount));
+        header.insert(header.end(), mapping.begin(), mapping.begin() + channelCount);
+    }
+
+    ogg_packet packet{};
+    packet.packet   = header.data();
+    packet.bytes    = static_cast<long>(header.size());
+    packet.b_o_s    = 1;
+    packet.packetno = m_packetNumber++;
+    ogg_stream_packetin(&m_ogg, &packet);
+    writePages(true);
+
+    // Write the comment header (leave it empty), it must start on a new page as well as the audio data
+    std::vector<unsigned char> tags;
+    const std::string_view     vendor = opus_get_version_string();
+    appendString(tags, "OpusTags");
+    appendUint32(tags, static_cast<std::uint32_t>(vendor.size()));
+    appendString(tags, vendor);
+    appendUint32(tags, 0); // comment count
+
+    packet          = ogg_packet{};
+    packet.packet   = tags.data();
+    packet.bytes    = static_cast<long>(tags.size());
+    packet.packetno = m_packetNumber++;
+    ogg_stream_packetin(&m_ogg, &packet);
+    writePages(true);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterOpus::write(const std::int16_t* samples, std::uint64_t count)
+{
+    // A frame contains a sample from each channel
+    for (std::uint64_t frameCount = count / m_channelCount; frameCount > 0; --frameCount)
+    {
+        // Remap the samples to the target channels
+        std::int16_t* frame = m_frame.data() + m_frameFill * m_channelCount;
+        for (unsigned int j = 0; j < m_channelCount; ++j)
+            frame[j] = samples[m_remapTable[j]];
+
+        samples += m_channelCount;
+        m_inputFrames += m_granuleScale;
+
+        // Encode the frame once it is full
+        if (++m_frameFill == m_frameSize)
+            encodeFrame(false);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileWriterOpus::encodeFrame(bool endOfStream)
+{
+    m_frameFill = 0;
+
+    const opus_int32 size = opus_multistream_encode(m_encoder,
+                                                    m_frame.data(),
+                                                    static_cast<int>(m_frameSize),
+                                                    m_packet.data(),
+                                                    static_cast<opus_int32>(m_packet.size()));
+    if (size < 0)
+    {
+        err() << "Failed to encode Opus packet (" << opus_strerror(size) << ")" << std::endl;
+        return false;
+    }
+
+    m_encodedFrames += static_cast<ogg_int64_t>(m_frameSize) * m_granuleScale;
+
+    // The position of the last packet trims the padding of the last frame
+    ogg_packet packet{};
+    packet.packet     = m_packet.data();
+    packet.bytes      = size;
+    packet.e_o_s      = endOfStream ? 1 : 0;
+    packet.granulepos = endOfStream ? m_preSkip + m_inputFrames : m_encodedFrames;
+    packet.packetno   = m_packetNumber++;
+    ogg_stream_packetin(&m_ogg, &packet);
+    writePages(endOfStream);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterOpus::writePages(bool flush)
+{
+    ogg_page page;
+    while ((flush ? ogg_stream_flush(&m_ogg, &page) : ogg_stream_pageout(&m_ogg, &page)) > 0)
+    {
+        m_file.write(reinterpret_cast<const char*>(page.header), page.header_len);
+        m_file.write(reinterpret_cast<const char*>(page.body), page.body_len);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterOpus::close()
+{
+    if (m_file.is_open())
+    {
+        // Pad the last frame with silence, and keep encoding silence until the delay of the encoder is flushed
+        bool endOfStream = false;
+        while (!endOfStream)
+        {
+            std::fill(m_frame.begin() + static_cast<std::ptrdiff_t>(m_frameFill * m_channelCount), m_frame.end(), 0);
+            endOfStream = m_encodedFrames + static_cast<ogg_int64_t>(m_frameSize) * m_granuleScale >=
+                          m_preSkip + m_inputFrames;
+            if (!encodeFrame(endOfStream))
+                break;
+        }
+
+        // Close the file
+        m_file.close();
+    }
+
+    // Clear the ogg/opus structures
+    if (m_encoder)
+    {
+        opus_multistream_encoder_destroy(m_encoder);
+        m_encoder = nullptr;
+    }
+    ogg_stream_clear(&m_ogg);
+}
+
+} // namespace sf::priv
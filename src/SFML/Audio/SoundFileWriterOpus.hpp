@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundFileWriter.hpp>
+
+#include <ogg/ogg.h>
+#include <opus_multistream.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of sound file writer that handles OGG/Opus files
+///
+////////////////////////////////////////////////////////////
+class SoundFileWriterOpus : public SoundFileWriter
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if this writer can handle a file on disk
+    ///
+    /// \param filename Path of the sound file to check
+    ///
+    /// \return True if the file can be written by this writer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool check(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundFileWriterOpus() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a sound file for writing
+    ///
+    /// Opus only supports the sample rates 8000, 12000, 16000,
+    /// 24000 and 48000.
+    ///
+    /// \param filename     Path of the file to open
+    /// \param sampleRate   Sample rate of the sound
+    /// \param channelCount Number of channels of the sound
+    /// \param channelMap   Map of position in sample frame to sound channel
+    ///
+    /// \return True if the file was successfully opened
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path&     filename,
+                            unsigned int                     sampleRate,
+                            unsigned int                     channelCount,
+                            const std::vector<SoundChannel>& channelMap) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write audio samples to the open file
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(const std::int16_t* samples, std::uint64_t count) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode the buffered frame and write it to the ogg stream
+    ///
+    /// \param endOfStream True to mark the packet as the last one of the stream
+    ///
+    /// \return True if the frame was encoded
+    ///
+    ////////////////////////////////////////////////////////////
+    bool encodeFrame(bool endOfStream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the pages produced by the ogg stream, if any
+    ///
+    /// \param flush True to write the incomplete page too
+    ///
+    ////////////////////////////////////////////////////////////
+    void writePages(bool flush);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the file
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int               m_channelCount{};  //!< Channel count of the sound being written
+    std::array<std::size_t, 8> m_remapTable{};    //!< Table we use to remap source to target channel order
+    std::ofstream              m_file;            //!< Output file
+    ogg_stream_state           m_ogg{};           //!< OGG stream
+    OpusMSEncoder*             m_encoder{};       //!< Opus encoder
+    std::vector<std::int16_t>  m_frame;           //!< Samples of the frame being filled, in target channel order
+    std::size_t                m_frameSize{};     //!< Number of samples per channel in a frame
+    std::size_t                m_frameFill{};     //!< Number of samples per channel already in the frame
+    std::vector<unsigned char> m_packet;          //!< Buffer receiving the encoded packets
+    ogg_int64_t                m_granuleScale{};  //!< Factor converting the sample rate to the 48 kHz granule rate
+    ogg_int64_t                m_preSkip{};       //!< Samples of encoder delay to skip when decoding, at 48 kHz
+    ogg_int64_t                m_inputFrames{};   //!< Number of frames written so far, at 48 kHz
+    ogg_int64_t                m_encodedFrames{}; //!< Number of frames encoded so far, at 48 kHz
+    ogg_int64_t                m_packetNumber{};  //!< Index of the next packet in the ogg stream
+};
+
+} // namespace sf::priv
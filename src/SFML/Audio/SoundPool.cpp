@@ -0,0 +1,369 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundPool.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundPool::SoundPool(std::size_t voiceCount, std::size_t capacity) :
+m_voices(voiceCount),
+m_busyVoices(voiceCount),
+m_instances(capacity)
+{
+    assert(capacity > 0 && "SoundPool::SoundPool() Capacity must be greater than 0");
+
+    m_order.reserve(capacity);
+}
+
+
+////////////////////////////////////////////////////////////
+SoundPool::~SoundPool()
+{
+    // Remove the virtual sounds of the pool from the statistics of the audio engine
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundPool::play(const SoundBuffer& buffer, const Vector3f& position, float volume, int priority)
+{
+    Instance candidate;
+    candidate.buffer   = &buffer;
+    candidate.position = position;
+    candidate.volume   = volume;
+    candidate.priority = priority;
+    candidate.gain     = computeGain(candidate, Listener::getPosition());
+
+    // Find a free slot, or take the one of the least important sound if the new one matters more
+    std::size_t index = 0;
+    if (m_playingCount < m_instances.size())
+    {
+        while (m_instances[index].buffer)
+            ++index;
+    }
+    else
+    {
+        for (std::size_t i = 1; i < m_instances.size(); ++i)
+        {
+            if (isMoreImportant(m_instances[index], m_instances[i]))
+                index = i;
+        }
+
+        if (!isMoreImportant(candidate, m_instances[index]))
+            return false;
+
+        release(index);
+    }
+
+    m_instances[index] = candidate;
+    ++m_playingCount;
+
+    // Every tracked instance is virtual until it is given a voice
+    priv::AudioDevice::addVirtualVoices(1);
+
+    // Inaudible sounds are only tracked
+    if (candidate.gain < m_audibilityThreshold)
+        return true;
+
+    // Find a free voice, or steal the one of a less important sound
+    std::size_t voice = findFreeVoice();
+    if (voice == m_voices.size())
+    {
+        const std::size_t victim = findLeastImportantReal();
+        if (victim == m_instances.size() || !isMoreImportant(m_instances[index], m_instances[victim]))
+            return true;
+
+        voice = m_instances[victim].voice;
+        makeVirtual(victim);
+    }
+
+    makeReal(index, voice);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::update()
+{
+    const Time     elapsed          = m_clock.restart();
+    const Vector3f listenerPosition = Listener::getPosition();
+
+    // Release the finished sounds, advance the others and rank the audible ones
+    m_order.clear();
+    for (std::size_t i = 0; i < m_instances.size(); ++i)
+    {
+        Instance& instance = m_instances[i];
+        if (!instance.buffer)
+            continue;
+
+        if (instance.voice != noVoice)
+        {
+            const Sound& sound = *m_voices[instance.voice];
+            if (sound.getStatus() == Sound::Status::Stopped)
+            {
+                release(i);
+                continue;
+            }
+
+            instance.offset = sound.getPlayingOffset();
+        }
+        else
+        {
+            instance.offset += elapsed;
+            if (instance.offset >= instance.buffer->getDuration())
+            {
+                release(i);
+                continue;
+            }
+        }
+
+        instance.gain = computeGain(instance, listenerPosition);
+        if (instance.gain >= m_audibilityThreshold)
+            m_order.push_back(i);
+        else if (instance.voice != noVoice)
+            makeVirtual(i);
+    }
+
+    // Keep the most important sounds in front
+    const std::size_t realCount = std::min(m_voices.size(), m_order.size());
+    if (realCount < m_order.size())
+    {
+        std::nth_element(m_order.begin(),
+                         m_order.begin() + static_cast<std::ptrdiff_t>(realCount),
+                         m_order.end(),
+                         [this](std::size_t left, std::size_t right)
+                         { return isMoreImportant(m_instances[left], m_instances[right]); });
+    }
+
+    // Free the voices of the sounds that are no longer important enough...
+    for (std::size_t i = realCount; i < m_order.size(); ++i)
+    {
+        if (m_instances[m_order[i]].voice != noVoice)
+            makeVirtual(m_order[i]);
+    }
+
+    // ... and give them to the ones that became important
+    for (std::size_t i = 0; i < realCount; ++i)
+    {
+        if (m_instances[m_order[i]].voice == noVoice)
+            makeReal(m_order[i], findFreeVoice());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::stop()
+{
+    for (std::size_t i = 0; i < m_instances.size(); ++i)
+    {
+        if (m_instances[i].buffer)
+            release(i);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::setMinDistance(float distance)
+{
+    m_minDistance = distance;
+
+    for (std::optional<Sound>& voice : m_voices)
+    {
+        if (voice)
+            voice->setMinDistance(distance);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::setAttenuation(float attenuation)
+{
+    m_attenuation = attenuation;
+
+    for (std::optional<Sound>& voice : m_voices)
+    {
+        if (voice)
+            voice->setAttenuation(attenuation);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::setAudibilityThreshold(float threshold)
+{
+    m_audibilityThreshold = threshold;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::getVoiceCount() const
+{
+    return m_voices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::getCapacity() const
+{
+    return m_instances.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::getPlayingCount() const
+{
+    return m_playingCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::getVirtualCount() const
+{
+    return m_playingCount - m_realCount;
+}
+
+
+////////////////////////////////////////////////////////////
+float SoundPool::computeGain(const Instance& instance, const Vector3f& listenerPosition) const
+{
+    // Same inverse distance model as the one used by miniaudio for sf::SoundSource
+    const float distance = std::max((instance.position - listenerPosition).length(), m_minDistance);
+    const float divisor  = m_minDistance + m_attenuation * (distance - m_minDistance);
+    const float factor   = divisor > 0.f ? m_minDistance / divisor : 1.f;
+
+    return instance.volume / 100.f * std::min(factor, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundPool::isMoreImportant(const Instance& left, const Instance& right)
+{
+    if (left.priority != right.priority)
+        return left.priority > right.priority;
+
+    return left.gain > right.gain;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::findLeastImportantReal() const
+{
+    std::size_t result = m_instances.size();
+    for (std::size_t i = 0; i < m_instances.size(); ++i)
+    {
+        if (m_instances[i].voice == noVoice)
+            continue;
+
+        if (result == m_instances.size() || isMoreImportant(m_instances[result], m_instances[i]))
+            result = i;
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::findFreeVoice() const
+{
+    return static_cast<std::size_t>(std::find(m_busyVoices.begin(), m_busyVoices.end(), false) - m_busyVoices.begin());
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::makeReal(std::size_t index, std::size_t voice)
+{
+    Instance&             instance = m_instances[index];
+    std::optional<Sound>& sound    = m_voices[voice];
+
+    if (sound)
+    {
+        // Cheap when the previous buffer of the voice has the same format
+        sound->setBuffer(*instance.buffer);
+    }
+    else
+    {
+        sound.emplace(*instance.buffer);
+        sound->setMinDistance(m_minDistance);
+        sound->setAttenuation(m_attenuation);
+    }
+
+    sound->setPosition(instance.position);
+    sound->setVolume(instance.volume);
+    sound->setPlayingOffset(instance.offset);
+    sound->play();
+
+    instance.voice       = voice;
+    m_busyVoices[voice] = true;
+    ++m_realCount;
+    priv::AudioDevice::addVirtualVoices(-1);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::makeVirtual(std::size_t index)
+{
+    Instance& instance = m_instances[index];
+    Sound&    sound    = *m_voices[instance.voice];
+
+    instance.offset = sound.getPlayingOffset();
+    sound.stop();
+
+    m_busyVoices[instance.voice] = false;
+    instance.voice               = noVoice;
+    --m_realCount;
+    priv::AudioDevice::addVirtualVoices(1);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::release(std::size_t index)
+{
+    if (m_instances[index].voice != noVoice)
+    {
+        m_voices[m_instances[index].voice]->stop();
+        m_busyVoices[m_instances[index].voice] = false;
+        --m_realCount;
+    }
+    else
+    {
+        priv::AudioDevice::addVirtualVoices(-1);
+    }
+
+    m_instances[index] = Instance();
+    --m_playingCount;
+}
+
+} // namespace sf
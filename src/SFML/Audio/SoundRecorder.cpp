@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/OutputSoundFile.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -38,7 +39,16 @@
 #include <ostream>
 
 #include <cassert>
-#include <cstring>
+#include <cmath>
+
+
+namespace
+{
+std::int16_t toInt16(float sample)
+{
+    return static_cast<std::int16_t>(std::clamp(std::lround(sample * 32768.f), -32768l, 32767l));
+}
+} // namespace
 
 
 namespace sf
@@ -74,22 +84,46 @@ struct SoundRecorder::Impl
             captureDevice.emplace();
         }
 
-        auto captureDeviceConfig              = ma_device_config_init(ma_device_type_capture);
-        captureDeviceConfig.capture.pDeviceID = &iter->id;
-        captureDeviceConfig.capture.channels  = channelCount;
-        captureDeviceConfig.capture.format    = ma_format_s16;
-        captureDeviceConfig.sampleRate        = sampleRate;
-        captureDeviceConfig.pUserData         = this;
-        captureDeviceConfig.dataCallback      = [](ma_device* device, void*, const void* input, ma_uint32 frameCount)
+        const ma_format captureFormat = (sampleFormat == SampleFormat::Float32) ? ma_format_f32 : ma_format_s16;
+
+        auto captureDeviceConfig                     = ma_device_config_init(ma_device_type_capture);
+        captureDeviceConfig.capture.pDeviceID        = &iter->id;
+        captureDeviceConfig.capture.channels         = channelCount;
+        captureDeviceConfig.capture.format           = captureFormat;
+        captureDeviceConfig.sampleRate               = sampleRate;
+        captureDeviceConfig.periodSizeInMilliseconds = static_cast<ma_uint32>(processingInterval.asMilliseconds());
+        captureDeviceConfig.pUserData                = this;
+        captureDeviceConfig.dataCallback = [](ma_device* device, void*, const void* input, ma_uint32 frameCount)
         {
-            auto& impl = *static_cast<Impl*>(device->pUserData);
+            auto&             impl        = *static_cast<Impl*>(device->pUserData);
+            const std::size_t sampleCount = std::size_t{frameCount} * impl.channelCount;
+
+            // Notify the derived class of the availability of new samples, which are
+            // given straight from the buffer of the device, without any copy
+            bool keepRecording = false;
 
-            // Copy the new samples into our temporary buffer
-            impl.samples.resize(frameCount * impl.channelCount);
-            std::memcpy(impl.samples.data(), input, frameCount * impl.channelCount * sizeof(std::int16_t));
+            if (impl.sampleFormat == SampleFormat::Float32)
+                keepRecording = impl.owner->onProcessFloatSamples(static_cast<const float*>(input), sampleCount);
+            else
+                keepRecording = impl.owner->onProcessSamples(static_cast<const std::int16_t*>(input), sampleCount);
 
-            // Notify the derived class of the availability of new samples
-            if (!impl.owner->onProcessSamples(impl.samples.data(), impl.samples.size()))
+            // Pipe the samples to the output file, if any
+            if (impl.outputFile)
+            {
+                if (impl.sampleFormat == SampleFormat::Float32)
+                {
+                    const auto* floatSamples = static_cast<const float*>(input);
+                    impl.fileSamples.resize(sampleCount);
+                    std::transform(floatSamples, floatSamples + sampleCount, impl.fileSamples.begin(), &toInt16);
+                    impl.outputFile->write(impl.fileSamples.data(), sampleCount);
+                }
+                else
+                {
+                    impl.outputFile->write(static_cast<const std::int16_t*>(input), sampleCount);
+                }
+            }
+
+            if (!keepRecording)
             {
                 // If the derived class wants to stop, stop the capture
                 if (const auto result = ma_device_stop(device); result != MA_SUCCESS)
@@ -107,6 +141,13 @@ struct SoundRecorder::Impl
             return false;
         }
 
+        // Preallocate the buffer used to convert floating point samples, so that the capture callback doesn't allocate
+        if (sampleFormat == SampleFormat::Float32)
+        {
+            samples.reserve(std::size_t{captureDevice->capture.internalPeriodSizeInFrames} * channelCount * 2);
+            fileSamples.reserve(samples.capacity());
+        }
+
         return true;
     }
 
@@ -147,15 +188,19 @@ struct SoundRecorder::Impl
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    SoundRecorder* const      owner;                          //!< Owning SoundRecorder object
-    std::optional<ma_log>     log;                            //!< The miniaudio log
-    std::optional<ma_context> context;                        //!< The miniaudio context
-    std::optional<ma_device>  captureDevice;                  //!< The miniaudio capture device
-    std::string               deviceName{getDefaultDevice()}; //!< Name of the audio capture device
-    unsigned int              channelCount{1};                //!< Number of recording channels
-    unsigned int              sampleRate{44100};              //!< Sample rate
-    std::vector<std::int16_t> samples;                        //!< Buffer to store captured samples
-    std::vector<SoundChannel> channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
+    SoundRecorder* const      owner;                             //!< Owning SoundRecorder object
+    std::optional<ma_log>     log;                               //!< The miniaudio log
+    std::optional<ma_context> context;                           //!< The miniaudio context
+    std::optional<ma_device>  captureDevice;                     //!< The miniaudio capture device
+    std::string               deviceName{getDefaultDevice()};    //!< Name of the audio capture device
+    unsigned int              channelCount{1};                   //!< Number of recording channels
+    unsigned int              sampleRate{44100};                 //!< Sample rate
+    SampleFormat              sampleFormat{SampleFormat::Int16}; //!< Format of the captured samples
+    Time                      processingInterval;                //!< Duration of the captured chunks, zero for default
+    std::vector<std::int16_t> samples;                           //!< Buffer to convert floating point samples
+    std::vector<std::int16_t> fileSamples;                       //!< Buffer to convert the samples written to the file
+    OutputSoundFile*          outputFile{};                      //!< File receiving the captured samples, if any
+    std::vector<SoundChannel> channelMap{SoundChannel::Mono};    //!< Map of position in sample frame to sound channel
 };
 
 
@@ -443,6 +488,32 @@ const std::vector<SoundChannel>& SoundRecorder::getChannelMap() const
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundRecorder::setSampleFormat(SampleFormat format)
+{
+    // Store the sample format and re-initialize if necessary
+    if (m_impl->sampleFormat != format)
+    {
+        m_impl->sampleFormat = format;
+        m_impl->initialize();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+SampleFormat SoundRecorder::getSampleFormat() const
+{
+    return m_impl->sampleFormat;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundRecorder::setOutputFile(OutputSoundFile* file)
+{
+    m_impl->outputFile = file;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundRecorder::isAvailable()
 {
@@ -467,10 +538,33 @@ bool SoundRecorder::onStart()
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundRecorder::onProcessFloatSamples(const float* samples, std::size_t sampleCount)
+{
+    // Convert the samples for recorders that only process 16-bit samples
+    m_impl->samples.resize(sampleCount);
+    std::transform(samples, samples + sampleCount, m_impl->samples.begin(), &toInt16);
+
+    return onProcessSamples(m_impl->samples.data(), sampleCount);
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundRecorder::onStop()
 {
     // Nothing to do
 }
 
+
+////////////////////////////////////////////////////////////
+void SoundRecorder::setProcessingInterval(Time interval)
+{
+    // Store the interval and re-initialize if necessary
+    if (m_impl->processingInterval != interval)
+    {
+        m_impl->processingInterval = interval;
+        m_impl->initialize();
+    }
+}
+
 } // namespace sf
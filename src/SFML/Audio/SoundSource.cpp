@@ -25,11 +25,13 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
 #include <miniaudio.h>
 
 #include <algorithm>
+#include <vector>
 
 
 namespace sf
@@ -102,6 +104,25 @@ void SoundSource::setVelocity(const Vector3f& velocity)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundSource::updateSpatial(const SpatialUpdate* updates, std::size_t count)
+{
+    std::vector<priv::AudioDevice::SpatialUpdate> queued;
+    queued.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const SpatialUpdate& update = updates[i];
+        auto* sound = update.source ? static_cast<ma_sound*>(update.source->getSound()) : nullptr;
+        if (sound)
+            queued.push_back({sound, update.position, update.velocity, update.direction});
+    }
+
+    // The engine applies the whole batch at the start of a period, so that the scene stays consistent
+    priv::AudioDevice::queueSpatialUpdates(queued.data(), queued.size());
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundSource::setDopplerFactor(float factor)
 {
@@ -173,6 +194,12 @@ void SoundSource::setEffectProcessor(EffectProcessor)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundSource::setBus(AudioBus*)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 float SoundSource::getPitch() const
 {
@@ -350,6 +377,13 @@ float SoundSource::getAttenuation() const
 }
 
 
+////////////////////////////////////////////////////////////
+AudioBus* SoundSource::getBus() const
+{
+    return nullptr;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundSource& SoundSource::operator=(const SoundSource& right)
 {
@@ -369,6 +403,7 @@ SoundSource& SoundSource::operator=(const SoundSource& right)
     setMinGain(right.getMinGain());
     setMaxGain(right.getMaxGain());
     setAttenuation(right.getAttenuation());
+    setBus(right.getBus());
 
     return *this;
 }
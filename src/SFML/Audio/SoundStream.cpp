@@ -25,16 +25,25 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
 #include <SFML/System/Sleep.hpp>
+#include <SFML/System/SpscQueue.hpp>
 
 #include <miniaudio.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
 #include <ostream>
+#include <thread>
 #include <vector>
 
 #include <cassert>
@@ -82,55 +91,411 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
         impl.streaming = true;
         impl.status    = Status::Stopped;
 
+        // Let the decoding thread prepare the beginning of the stream for the next time it is played
+        if (impl.decodeThread.joinable())
+            impl.seekTo(0);
+
         if (const ma_result result = ma_sound_seek_to_pcm_frame(soundPtr, 0); result != MA_SUCCESS)
             err() << "Failed to seek sound to frame 0: " << ma_result_description(result) << std::endl;
     }
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Position in the decode-ahead buffer at which the playing position jumps
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Jump
+    {
+        std::uint64_t position{};         //!< Index of the first sample played at the new position
+        std::uint64_t samplesProcessed{}; //!< New playing position, in samples
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the decoding thread if a decode-ahead buffer is requested
+    ///
+    ////////////////////////////////////////////////////////////
+    void startDecoding()
+    {
+        if (decodeThread.joinable())
+            return;
+
+        const auto frames = static_cast<std::size_t>(decodeAheadDuration.asSeconds() * static_cast<float>(sampleRate));
+
+        // The position of the source is only known if it was last moved by flush()
+        if (ring.empty())
+            flushFrame = noSeek;
+
+        ring.clear();
+        ring.shrink_to_fit();
+
+        if ((frames == 0) || (channelCount == 0))
+            return;
+
+        ring.resize(frames * channelCount * sampleSize());
+        readIndex.store(0, std::memory_order_relaxed);
+        writeIndex.store(0, std::memory_order_relaxed);
+        flushIndex.store(0, std::memory_order_relaxed);
+        endIndex.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        seekRequest.store(noSeek, std::memory_order_relaxed);
+        pendingJump.reset();
+
+        // Decode a first chunk right away so that playback doesn't start with an underrun, from the position
+        // requested while decoding on the audio thread if it didn't get to apply it
+        {
+            const std::lock_guard lock(decodeMutex);
+            if (const ma_uint64 frameIndex = pendingSeek.exchange(noSeek, std::memory_order_acquire);
+                frameIndex != noSeek)
+                flush(frameIndex);
+            decode();
+        }
+
+        decoding     = true;
+        decodeThread = std::thread(
+            [this]
+            {
+                std::unique_lock lock(decodeMutex);
+
+                while (decoding)
+                {
+                    // Only clear the request once it is done, so that the audio thread doesn't mistake the
+                    // samples decoded before the seek for the end of the stream in the meantime
+                    if (auto frameIndex = seekRequest.load(std::memory_order_acquire); frameIndex != noSeek)
+                    {
+                        flush(frameIndex);
+                        seekRequest.compare_exchange_strong(frameIndex, noSeek, std::memory_order_release);
+                    }
+
+                    // Keep decoding as long as there is room in the buffer, then wait a bit for it to drain
+                    if (!decode())
+                        decodeCondition.wait_for(lock,
+                                                 std::chrono::milliseconds(10),
+                                                 [this]
+                                                 {
+                                                     return !decoding ||
+                                                            (seekRequest.load(std::memory_order_relaxed) != noSeek);
+                                                 });
+                }
+            });
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the decoding thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopDecoding()
+    {
+        if (!decodeThread.joinable())
+            return;
+
+        {
+            const std::lock_guard lock(decodeMutex);
+            decoding = false;
+        }
+
+        decodeCondition.notify_all();
+        decodeThread.join();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move samples from the source into the decode-ahead buffer
+    ///
+    /// Must be called with decodeMutex locked.
+    ///
+    /// \return True if progress was made, false if the buffer is full or the source exhausted
+    ///
+    ////////////////////////////////////////////////////////////
+    bool decode()
+    {
+        // Ask the source for more samples once the previous chunk was consumed
+        if ((pendingCount == 0) && !sourceEnded)
+        {
+            SFML_PROFILE_ZONE("sf::SoundStream::onGetData");
+
+            Chunk chunk;
+
+            sourceEnded   = !owner->onGetData(chunk);
+            pendingCursor = getChunkData(chunk);
+            pendingCount  = pendingCursor ? chunk.sampleCount : 0;
+
+            if (sourceEnded)
+                loopPosition = loop ? owner->onLoop() : owner->onEnd();
+        }
+
+        const std::uint64_t write = writeIndex.load(std::memory_order_relaxed);
+        const std::uint64_t read  = std::max(readIndex.load(std::memory_order_acquire),
+                                            flushIndex.load(std::memory_order_relaxed));
+        const std::size_t   capacity = ring.size() / sampleSize();
+        const auto          space    = static_cast<std::size_t>(capacity - (write - read));
+        const std::size_t   count    = std::min(pendingCount, space);
+
+        // Copy the samples, in two parts if they wrap around the end of the buffer
+        if (count > 0)
+        {
+            const auto        offset = static_cast<std::size_t>(write % capacity);
+            const std::size_t first  = std::min(count, capacity - offset);
+            std::memcpy(ring.data() + offset * sampleSize(), pendingCursor, first * sampleSize());
+            std::memcpy(ring.data(), pendingCursor + first * sampleSize(), (count - first) * sampleSize());
+
+            writeIndex.store(write + count, std::memory_order_release);
+            pendingCursor += count * sampleSize();
+            pendingCount -= count;
+        }
+
+        if (pendingCount > 0)
+            return count > 0;
+
+        if (sourceEnded && loopPosition)
+        {
+            // Let the audio thread rewind its playing position when it reaches the loop point
+            if (!jumps.push(Jump{write + count, *loopPosition}))
+                return count > 0;
+
+            loopPosition.reset();
+            sourceEnded = false;
+            return true;
+        }
+
+        if (sourceEnded && !endPublished)
+        {
+            endIndex.store(write + count, std::memory_order_release);
+            endPublished = true;
+            return true;
+        }
+
+        return (count > 0) || !sourceEnded;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy samples out of the decode-ahead buffer, called from the audio thread
+    ///
+    ////////////////////////////////////////////////////////////
+    ma_uint64 readDecoded(std::uint8_t* samplesOut, ma_uint64 frameCount)
+    {
+        const bool          seeking = seekRequest.load(std::memory_order_acquire) != noSeek;
+        const std::uint64_t flush   = flushIndex.load(std::memory_order_acquire);
+        const std::uint64_t end     = endIndex.load(std::memory_order_acquire);
+        const std::uint64_t write   = writeIndex.load(std::memory_order_acquire);
+        std::uint64_t       read    = std::max(readIndex.load(std::memory_order_relaxed), flush);
+
+        const auto frames = std::min<ma_uint64>(frameCount, (write - read) / channelCount);
+        const auto count  = static_cast<std::size_t>(frames * channelCount);
+
+        const std::size_t capacity = ring.size() / sampleSize();
+        const auto        offset   = static_cast<std::size_t>(read % capacity);
+        const std::size_t first    = std::min(count, capacity - offset);
+        std::memcpy(samplesOut, ring.data() + offset * sampleSize(), first * sampleSize());
+        std::memcpy(samplesOut + first * sampleSize(), ring.data(), (count - first) * sampleSize());
+
+        read += count;
+        readIndex.store(read, std::memory_order_release);
+        samplesProcessed += count;
+
+        // Apply the seeks and loops that were decoded in the samples we just played
+        for (;;)
+        {
+            if (!pendingJump)
+            {
+                Jump jump;
+                if (!jumps.pop(jump))
+                    break;
+
+                pendingJump = jump;
+            }
+
+            if (pendingJump->position > read)
+                break;
+
+            samplesProcessed = pendingJump->samplesProcessed + (read - pendingJump->position);
+            pendingJump.reset();
+        }
+
+        // Reaching the end of the stream source ends the sound, unless a seek is about to rewind it
+        if ((frames == frameCount) || ((read >= end) && !seeking))
+            return frames;
+
+        // The decoding thread couldn't keep up or is still seeking: play silence instead of stopping the sound
+        const auto silence = static_cast<std::size_t>((frameCount - frames) * channelCount);
+        std::memset(samplesOut + count * sampleSize(), 0, silence * sampleSize());
+
+        if (!seeking)
+        {
+            underrunCount.fetch_add(1, std::memory_order_relaxed);
+            priv::AudioDevice::countUnderrun();
+        }
+
+        return frameCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the stream source to a new position
+    ///
+    /// The seek is performed by the thread calling onGetData, the
+    /// decoding thread or the audio thread, so that the stream
+    /// source is only ever accessed by one thread at a time and
+    /// neither the caller nor the audio thread wait for it.
+    ///
+    /// \param frameIndex New playing position, in frames
+    ///
+    ////////////////////////////////////////////////////////////
+    void seekTo(ma_uint64 frameIndex)
+    {
+        samplesProcessed = frameIndex * channelCount;
+
+        if (decodeThread.joinable())
+        {
+            seekRequest.store(frameIndex, std::memory_order_release);
+            return;
+        }
+
+        if (!ring.empty())
+        {
+            const std::lock_guard lock(decodeMutex);
+            flush(frameIndex);
+            return;
+        }
+
+        // Let the audio thread move the source itself, so that it never waits for another thread to release it
+        pendingSeek.store(frameIndex, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the samples decoded so far and move the stream source to a new position
+    ///
+    /// Must be called with decodeMutex locked.
+    ///
+    /// \param frameIndex New playing position, in frames
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush(ma_uint64 frameIndex)
+    {
+        // If nothing was played since the last seek to the same position, the decoded samples are still valid
+        const bool played = readIndex.load(std::memory_order_acquire) > flushIndex.load(std::memory_order_relaxed);
+        if ((frameIndex == flushFrame) && !played)
+            return;
+
+        flushFrame    = frameIndex;
+        pendingCursor = nullptr;
+        pendingCount  = 0;
+        sourceEnded   = false;
+        endPublished  = false;
+        loopPosition.reset();
+
+        // The audio thread skips the stale samples and restarts counting from the new position
+        const std::uint64_t write = writeIndex.load(std::memory_order_relaxed);
+        endIndex.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        (void)jumps.push(Jump{write, frameIndex * channelCount});
+        flushIndex.store(write, std::memory_order_release);
+
+        owner->onSeek(toOffset(frameIndex));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a frame index to the offset passed to onSeek
+    ///
+    ////////////////////////////////////////////////////////////
+    Time toOffset(ma_uint64 frameIndex) const
+    {
+        return (sampleRate != 0) ? seconds(static_cast<float>(frameIndex / sampleRate)) : Time::Zero;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a sample, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t sampleSize() const
+    {
+        return (sampleFormat == SampleFormat::Float32) ? sizeof(float) : sizeof(std::int16_t);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the samples of a chunk in the format the stream was initialized with
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::uint8_t* getChunkData(const Chunk& chunk) const
+    {
+        if (sampleFormat == SampleFormat::Float32)
+            return reinterpret_cast<const std::uint8_t*>(chunk.floatSamples);
+
+        return reinterpret_cast<const std::uint8_t*>(chunk.samples);
+    }
+
     static ma_result read(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead)
     {
+        SFML_PROFILE_ZONE("sf::SoundStream::read");
+
         auto& impl  = *static_cast<Impl*>(dataSource);
         auto* owner = impl.owner;
 
-        // Try to fill our buffer with new samples if the source is still willing to stream data
-        if (impl.sampleBuffer.empty() && impl.streaming)
+        // When decoding ahead, only copy the samples that were already decoded
+        if (!impl.ring.empty())
+        {
+            const auto capacity = static_cast<float>(impl.ring.size() / impl.sampleSize());
+            const auto decoded  = static_cast<float>(impl.writeIndex.load(std::memory_order_relaxed) -
+                                                    impl.readIndex.load(std::memory_order_relaxed));
+            priv::AudioDevice::countMixedVoice(impl.lastMixIndex, true, std::min(decoded / capacity, 1.f));
+
+            *framesRead = impl.readDecoded(static_cast<std::uint8_t*>(framesOut), frameCount);
+            return MA_SUCCESS;
+        }
+
+        priv::AudioDevice::countMixedVoice(impl.lastMixIndex, true);
+
+        // Apply the last seek requested since the previous read
+        if (const ma_uint64 frameIndex = impl.pendingSeek.exchange(noSeek, std::memory_order_acquire);
+            frameIndex != noSeek)
         {
+            impl.streaming        = true;
+            impl.chunkData        = nullptr;
+            impl.chunkSize        = 0;
+            impl.chunkCursor      = 0;
+            impl.samplesProcessed = frameIndex * impl.channelCount;
+            owner->onSeek(impl.toOffset(frameIndex));
+        }
+
+        // Ask for a new chunk if the source is still willing to stream data
+        if (!impl.chunkData && impl.streaming)
+        {
+            SFML_PROFILE_ZONE("sf::SoundStream::onGetData");
+
             Chunk chunk;
 
             impl.streaming = owner->onGetData(chunk);
 
-            if (chunk.samples && chunk.sampleCount)
+            // The samples are read in place, the source keeps them alive until it is asked for the next chunk
+            if (const std::uint8_t* data = impl.getChunkData(chunk); data && chunk.sampleCount)
             {
-                impl.sampleBuffer.assign(chunk.samples, chunk.samples + chunk.sampleCount);
-                impl.sampleBufferCursor = 0;
+                impl.chunkData   = data;
+                impl.chunkSize   = chunk.sampleCount * impl.sampleSize();
+                impl.chunkCursor = 0;
             }
         }
 
         // Push the samples to miniaudio
-        if (!impl.sampleBuffer.empty())
+        if (impl.chunkData)
         {
             // Determine how many frames we can read
-            *framesRead = std::min<ma_uint64>(frameCount,
-                                              (impl.sampleBuffer.size() - impl.sampleBufferCursor) / impl.channelCount);
+            const std::size_t frameSize = impl.channelCount * impl.sampleSize();
+            *framesRead = std::min<ma_uint64>(frameCount, (impl.chunkSize - impl.chunkCursor) / frameSize);
 
             const auto sampleCount = *framesRead * impl.channelCount;
+            const auto byteCount   = static_cast<std::size_t>(*framesRead * frameSize);
 
             // Copy the samples to the output
-            std::memcpy(framesOut,
-                        impl.sampleBuffer.data() + impl.sampleBufferCursor,
-                        static_cast<std::size_t>(sampleCount) * sizeof(impl.sampleBuffer[0]));
+            std::memcpy(framesOut, impl.chunkData + impl.chunkCursor, byteCount);
 
-            impl.sampleBufferCursor += static_cast<std::size_t>(sampleCount);
+            impl.chunkCursor += byteCount;
             impl.samplesProcessed += sampleCount;
 
-            if (impl.sampleBufferCursor >= impl.sampleBuffer.size())
+            if (impl.chunkCursor >= impl.chunkSize)
             {
-                impl.sampleBuffer.clear();
-                impl.sampleBufferCursor = 0;
+                impl.chunkData   = nullptr;
+                impl.chunkSize   = 0;
+                impl.chunkCursor = 0;
 
-                // If we are looping and at the end of the loop, set the cursor back to the beginning of the loop
-                if (!impl.streaming && impl.loop)
+                // If we are looping and at the end of the loop, set the cursor back to the beginning of the loop,
+                // otherwise let the owner chain another source
+                if (!impl.streaming)
                 {
-                    if (const auto seekPositionAfterLoop = owner->onLoop())
+                    if (const auto seekPositionAfterLoop = impl.loop ? owner->onLoop() : owner->onEnd())
                     {
                         impl.streaming        = true;
                         impl.samplesProcessed = *seekPositionAfterLoop;
@@ -148,22 +513,8 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
 
     static ma_result seek(ma_data_source* dataSource, ma_uint64 frameIndex)
     {
-        auto& impl  = *static_cast<Impl*>(dataSource);
-        auto* owner = impl.owner;
-
-        impl.streaming = true;
-        impl.sampleBuffer.clear();
-        impl.sampleBufferCursor = 0;
-        impl.samplesProcessed   = frameIndex * impl.channelCount;
-
-        if (impl.sampleRate != 0)
-        {
-            owner->onSeek(seconds(static_cast<float>(frameIndex / impl.sampleRate)));
-        }
-        else
-        {
-            owner->onSeek(Time::Zero);
-        }
+        // When decoding ahead, this only posts the request to the decoding thread
+        static_cast<Impl*>(dataSource)->seekTo(frameIndex);
 
         return MA_SUCCESS;
     }
@@ -178,7 +529,7 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
         const auto& impl = *static_cast<const Impl*>(dataSource);
 
         // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
-        *format     = ma_format_s16;
+        *format     = (impl.sampleFormat == SampleFormat::Float32) ? ma_format_f32 : ma_format_s16;
         *channels   = impl.channelCount ? impl.channelCount : 1;
         *sampleRate = impl.sampleRate ? impl.sampleRate : 44100;
 
@@ -210,16 +561,43 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
+    static constexpr ma_uint64             noSeek{std::numeric_limits<ma_uint64>::max()};
     static constexpr ma_data_source_vtable vtable{read, seek, getFormat, getCursor, getLength, setLooping, /* flags */ 0};
     SoundStream* const                     owner;        //!< Owning SoundStream object
-    std::vector<std::int16_t>              sampleBuffer; //!< Our temporary sample buffer
-    std::size_t               sampleBufferCursor{};      //!< The current read position in the temporary sample buffer
+    const std::uint8_t*                    chunkData{};  //!< Samples of the last chunk, owned by the stream source
+    std::size_t               chunkSize{};               //!< Size of the last chunk, in bytes
+    std::size_t               chunkCursor{};             //!< Read position in the last chunk, in bytes
     std::uint64_t             samplesProcessed{};        //!< Number of samples processed since beginning of the stream
     unsigned int              channelCount{};            //!< Number of channels (1 = mono, 2 = stereo, ...)
     unsigned int              sampleRate{};              //!< Frequency (samples / second)
     std::vector<SoundChannel> channelMap;                //!< The map of position in sample frame to sound channel
+    SampleFormat              sampleFormat{};            //!< Format of the samples provided by onGetData
     bool                      loop{};                    //!< Loop flag (true to loop, false to play once)
     bool                      streaming{true};           //!< True if we are still streaming samples from the source
+    std::uint64_t             lastMixIndex{};            //!< Last period the stream was counted in
+
+    // Decode-ahead buffer, filled by the decoding thread and drained by the audio thread
+    Time                         decodeAheadDuration; //!< Requested length of the decode-ahead buffer
+    std::vector<std::uint8_t>    ring;                //!< Decoded samples, empty when decoding on the audio thread
+    std::atomic<std::uint64_t>   readIndex{};         //!< Number of samples read from the ring since it started
+    std::atomic<std::uint64_t>   writeIndex{};        //!< Number of samples written to the ring since it started
+    std::atomic<std::uint64_t>   flushIndex{};        //!< Samples before this index were discarded by a seek
+    std::atomic<std::uint64_t>   endIndex{};          //!< Index at which the source ran out of samples
+    std::atomic<ma_uint64>       seekRequest{noSeek}; //!< Frame the decoding thread must seek to, noSeek if none
+    std::atomic<ma_uint64>       pendingSeek{noSeek}; //!< Frame the audio thread must seek to, noSeek if none
+    std::atomic<std::uint64_t>   underrunCount{};     //!< Number of times the ring ran dry
+    SpscQueue<Jump, 16>          jumps;               //!< Position changes, in the order they were decoded
+    std::optional<Jump>          pendingJump;         //!< Next position change, used by the audio thread
+    std::thread                  decodeThread;        //!< Thread filling the ring
+    std::mutex                   decodeMutex;         //!< Serializes access to the stream source
+    std::condition_variable      decodeCondition;     //!< Wakes the decoding thread up when it must stop
+    bool                         decoding{};          //!< Whether the decoding thread should keep running
+    const std::uint8_t*          pendingCursor{};     //!< Samples of the last chunk not yet copied to the ring
+    std::size_t                  pendingCount{};      //!< Number of samples of the last chunk not yet copied
+    bool                         sourceEnded{};       //!< Whether the source returned its last chunk
+    bool                         endPublished{};      //!< Whether endIndex was set for the current source position
+    std::optional<std::uint64_t> loopPosition;        //!< Position to jump to once the last chunk is copied
+    ma_uint64                    flushFrame{noSeek};  //!< Frame the source was last moved to by flush()
 };
 
 
@@ -230,17 +608,32 @@ SoundStream::SoundStream() : m_impl(std::make_unique<Impl>(this))
 
 
 ////////////////////////////////////////////////////////////
-SoundStream::~SoundStream() = default;
+SoundStream::~SoundStream()
+{
+    m_impl->stopDecoding();
+}
 
 
 ////////////////////////////////////////////////////////////
-void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap)
+void SoundStream::initialize(unsigned int                     channelCount,
+                             unsigned int                     sampleRate,
+                             const std::vector<SoundChannel>& channelMap,
+                             SampleFormat                     sampleFormat)
 {
     m_impl->channelCount     = channelCount;
     m_impl->sampleRate       = sampleRate;
     m_impl->channelMap       = channelMap;
+    m_impl->sampleFormat     = sampleFormat;
     m_impl->samplesProcessed = 0;
+    m_impl->pendingSeek.store(Impl::noSeek, std::memory_order_relaxed);
 
+    // Samples left over from the previous settings may not even have the same format
+    m_impl->chunkData   = nullptr;
+    m_impl->chunkSize   = 0;
+    m_impl->chunkCursor = 0;
+
+    m_impl->stopDecoding();
+    m_impl->flushFrame = Impl::noSeek;
     m_impl->deinitialize();
     m_impl->initialize();
 }
@@ -252,6 +645,8 @@ void SoundStream::play()
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
+    m_impl->startDecoding();
+
     if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
@@ -287,6 +682,7 @@ void SoundStream::stop()
     }
     else
     {
+        m_impl->stopDecoding();
         setPlayingOffset(Time::Zero);
         m_impl->status = Status::Stopped;
     }
@@ -330,14 +726,16 @@ void SoundStream::setPlayingOffset(Time timeOffset)
     if (m_impl->sound.pDataSource == nullptr || m_impl->sound.engineNode.pEngine == nullptr)
         return;
 
-    const auto frameIndex = priv::MiniaudioUtils::getFrameIndex(m_impl->sound, timeOffset);
-
-    m_impl->streaming = true;
-    m_impl->sampleBuffer.clear();
-    m_impl->sampleBufferCursor = 0;
-    m_impl->samplesProcessed   = frameIndex * m_impl->channelCount;
+    // When decoding ahead, miniaudio must not seek the data source on its own since
+    // that would make the audio thread discard the buffer a second time
+    if ((m_impl->decodeAheadDuration != Time::Zero) || !m_impl->ring.empty())
+    {
+        m_impl->seekTo(static_cast<ma_uint64>(timeOffset.asSeconds() * static_cast<float>(m_impl->sampleRate)));
+        m_impl->decodeCondition.notify_one();
+        return;
+    }
 
-    onSeek(seconds(static_cast<float>(frameIndex / m_impl->sampleRate)));
+    m_impl->seekTo(priv::MiniaudioUtils::getFrameIndex(m_impl->sound, timeOffset));
 }
 
 
@@ -373,6 +771,41 @@ void SoundStream::setEffectProcessor(EffectProcessor effectProcessor)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundStream::setBus(AudioBus* bus)
+{
+    m_impl->setBus(bus);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus* SoundStream::getBus() const
+{
+    return m_impl->bus;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundStream::setDecodeAheadDuration(Time duration)
+{
+    m_impl->decodeAheadDuration = std::max(duration, Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundStream::getDecodeAheadDuration() const
+{
+    return m_impl->decodeAheadDuration;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundStream::getUnderrunCount() const
+{
+    return m_impl->underrunCount.load(std::memory_order_relaxed);
+}
+
+
 ////////////////////////////////////////////////////////////
 std::optional<std::uint64_t> SoundStream::onLoop()
 {
@@ -381,6 +814,13 @@ std::optional<std::uint64_t> SoundStream::onLoop()
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<std::uint64_t> SoundStream::onEnd()
+{
+    return std::nullopt;
+}
+
+
 ////////////////////////////////////////////////////////////
 void* SoundStream::getSound() const
 {
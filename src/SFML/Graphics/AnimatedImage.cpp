@@ -0,0 +1,546 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/AnimatedImage.hpp>
+#include <SFML/Graphics/GifImage.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct AnimatedImage::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Layer of the texture array holding a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        std::size_t   frame{};    //!< Frame stored in the slot
+        std::uint64_t lastUsed{}; //!< Value of useCount when the frame was last made current
+        bool          used{};     //!< Does the slot hold a frame?
+    };
+
+    using DecodedFrame = std::pair<std::size_t, std::vector<std::uint8_t>>;
+
+    ////////////////////////////////////////////////////////////
+    ~Impl()
+    {
+        stopWorker();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void stopWorker()
+    {
+        if (!worker.joinable())
+            return;
+
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        condition.notify_all();
+        worker.join();
+
+        requests.clear();
+        decoded.clear();
+        loadingFrame.reset();
+        stopping = false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void run()
+    {
+        for (;;)
+        {
+            std::size_t frame = 0;
+
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this] { return stopping || !requests.empty(); });
+
+                if (stopping)
+                    return;
+
+                frame = requests.front();
+                requests.erase(requests.begin());
+                loadingFrame = frame;
+            }
+
+            std::vector<std::uint8_t> framePixels(std::size_t{size.x} * size.y * 4);
+            bool                      success = false;
+
+            {
+                const std::lock_guard lock(decoderMutex);
+                success = decoder.decode(frame, framePixels.data());
+            }
+
+            const std::lock_guard lock(mutex);
+            if (success)
+                decoded.emplace_back(frame, std::move(framePixels));
+            loadingFrame.reset();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void close()
+    {
+        stopWorker();
+        textureArray.reset();
+        slots.clear();
+        resident.clear();
+        delays.clear();
+        duration     = Time::Zero;
+        size         = {};
+        currentFrame = 0;
+        file.reset();
+        streamData.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const char* open(const void* data, std::size_t dataSize)
+    {
+        std::optional<priv::GifInfo> info = priv::readGifInfo(data, dataSize);
+        if (!info)
+            return "Not a valid gif file";
+
+        if (!TextureArray::isAvailable())
+            return "Texture arrays are not supported by the system";
+
+        decoder.open(data, dataSize, *info);
+        size     = info->size;
+        delays   = std::move(info->delays);
+        duration = std::accumulate(delays.begin(), delays.end(), Time::Zero);
+        pixels.resize(std::size_t{size.x} * size.y * 4);
+        if (!createCache())
+        {
+            close();
+            return "Failed to create the texture array";
+        }
+
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool createCache()
+    {
+        resident.clear();
+        slots.clear();
+        textureArray.reset();
+
+        const std::size_t layerCount = std::min({cacheCapacity,
+                                                 delays.size(),
+                                                 std::size_t{TextureArray::getMaximumLayerCount()}});
+
+        textureArray = TextureArray::create(size, static_cast<unsigned int>(layerCount));
+        if (!textureArray)
+            return false;
+
+        textureArray->setSmooth(smooth);
+        slots.resize(layerCount);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void upload(std::size_t frame, const std::uint8_t* framePixels)
+    {
+        // Replace the least recently used frame, but never the current one
+        std::size_t slot = slots.size();
+        for (std::size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i].used && (slots[i].frame == currentFrame))
+                continue;
+
+            if (!slots[i].used)
+            {
+                slot = i;
+                break;
+            }
+
+            if ((slot == slots.size()) || (slots[i].lastUsed < slots[slot].lastUsed))
+                slot = i;
+        }
+
+        if (slot == slots.size())
+            return;
+
+        textureArray->update(framePixels, static_cast<unsigned int>(slot));
+
+        if (slots[slot].used)
+            resident.erase(slots[slot].frame);
+
+        slots[slot]     = {frame, useCount, true};
+        resident[frame] = slot;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void uploadDecoded()
+    {
+        std::vector<DecodedFrame> frames;
+
+        {
+            const std::lock_guard lock(mutex);
+            frames.swap(decoded);
+        }
+
+        for (const auto& [frame, framePixels] : frames)
+        {
+            if (resident.find(frame) == resident.end())
+                upload(frame, framePixels.data());
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void requestPrefetch()
+    {
+        // Prefetched frames must not evict the current one
+        const std::size_t count = std::min(prefetchCount, slots.size() - 1);
+        if (count == 0)
+            return;
+
+        if (!worker.joinable())
+            worker = std::thread(&Impl::run, this);
+
+        {
+            const std::lock_guard lock(mutex);
+            requests.clear();
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                const std::size_t frame = (currentFrame + i) % delays.size();
+                if ((frame == currentFrame) || (resident.find(frame) != resident.end()) || (loadingFrame == frame))
+                    continue;
+
+                const auto isFrame = [frame](const DecodedFrame& entry) { return entry.first == frame; };
+                if (std::none_of(decoded.begin(), decoded.end(), isFrame))
+                    requests.push_back(frame);
+            }
+        }
+
+        condition.notify_one();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::optional<MappedFileInputStream>         file;             //!< File the animation is read from
+    std::vector<std::uint8_t>                    streamData;       //!< Copy of the stream the animation was read from
+    Vector2u                                     size;             //!< Size of the frames
+    std::vector<Time>                            delays;           //!< Delay of each frame
+    Time                                         duration;         //!< Sum of the delays
+    std::size_t                                  cacheCapacity{8}; //!< Requested number of cached frames
+    std::size_t                                  prefetchCount{2}; //!< Number of frames decoded ahead
+    bool                                         smooth{};         //!< Smooth the texture array?
+    std::optional<TextureArray>                  textureArray;     //!< Texture array holding the cached frames
+    std::vector<Slot>                            slots;            //!< Layers of the texture array
+    std::unordered_map<std::size_t, std::size_t> resident;         //!< Layer of each cached frame
+    std::size_t                                  currentFrame{};   //!< Index of the current frame
+    std::uint64_t                                useCount{};       //!< Number of calls to setFrame so far
+    std::vector<std::uint8_t>                    pixels;           //!< Frame decoded on demand
+
+    std::mutex                 decoderMutex; //!< Mutex protecting the decoder, used by both threads
+    priv::GifDecoder           decoder;      //!< Decoder of the frames
+    std::mutex                 mutex;        //!< Mutex protecting the members below it
+    std::condition_variable    condition;    //!< Wakes the worker up when frames are requested
+    bool                       stopping{};   //!< Should the worker stop?
+    std::vector<std::size_t>   requests;     //!< Frames to decode, in order
+    std::optional<std::size_t> loadingFrame; //!< Frame being decoded by the worker
+    std::vector<DecodedFrame>  decoded;      //!< Decoded frames waiting to be uploaded
+    std::thread                worker;       //!< Thread decoding the following frames
+};
+
+
+////////////////////////////////////////////////////////////
+AnimatedImage::AnimatedImage() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AnimatedImage::~AnimatedImage() = default;
+
+
+////////////////////////////////////////////////////////////
+bool AnimatedImage::openFromFile(const std::filesystem::path& filename)
+{
+    m_impl->close();
+
+    if (!m_impl->file.emplace().open(filename))
+    {
+        err() << "Failed to open animated image\n"
+              << formatDebugPathInfo(filename) << "\nReason: Unable to open file" << std::endl;
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(m_impl->file->getSize());
+    if (const char* reason = m_impl->open(m_impl->file->getData(), size))
+    {
+        err() << "Failed to open animated image\n"
+              << formatDebugPathInfo(filename) << "\nReason: " << reason << std::endl;
+        m_impl->close();
+        return false;
+    }
+
+    return setFrame(0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool AnimatedImage::openFromMemory(const void* data, std::size_t sizeInBytes)
+{
+    m_impl->close();
+
+    if (const char* reason = m_impl->open(data, sizeInBytes))
+    {
+        err() << "Failed to open animated image from memory. Reason: " << reason << std::endl;
+        return false;
+    }
+
+    return setFrame(0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool AnimatedImage::openFromStream(InputStream& stream)
+{
+    m_impl->close();
+
+    // The frames are decoded from memory; the stream can't be read from the background thread anyway
+    const std::int64_t size = stream.getSize();
+    if ((size < 0) || (stream.seek(0) != 0))
+    {
+        err() << "Failed to open animated image from stream. Reason: Unable to read the stream" << std::endl;
+        return false;
+    }
+
+    m_impl->streamData.resize(static_cast<std::size_t>(size));
+    if (stream.read(m_impl->streamData.data(), size) != size)
+    {
+        err() << "Failed to open animated image from stream. Reason: Unable to read the stream" << std::endl;
+        m_impl->streamData.clear();
+        return false;
+    }
+
+    if (const char* reason = m_impl->open(m_impl->streamData.data(), m_impl->streamData.size()))
+    {
+        err() << "Failed to open animated image from stream. Reason: " << reason << std::endl;
+        m_impl->close();
+        return false;
+    }
+
+    return setFrame(0);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u AnimatedImage::getSize() const
+{
+    return m_impl->size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AnimatedImage::getFrameCount() const
+{
+    return m_impl->delays.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Time AnimatedImage::getFrameDelay(std::size_t frame) const
+{
+    assert(frame < m_impl->delays.size() && "AnimatedImage::getFrameDelay() frame index out of range");
+    return m_impl->delays[frame];
+}
+
+
+////////////////////////////////////////////////////////////
+Time AnimatedImage::getDuration() const
+{
+    return m_impl->duration;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AnimatedImage::getFrameAt(Time time) const
+{
+    if (m_impl->duration <= Time::Zero)
+        return 0;
+
+    time %= m_impl->duration;
+    if (time < Time::Zero)
+        time += m_impl->duration;
+
+    for (std::size_t frame = 0; frame < m_impl->delays.size(); ++frame)
+    {
+        if (time < m_impl->delays[frame])
+            return frame;
+
+        time -= m_impl->delays[frame];
+    }
+
+    return m_impl->delays.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void AnimatedImage::setCacheCapacity(std::size_t frameCount)
+{
+    m_impl->cacheCapacity = std::max<std::size_t>(frameCount, 1);
+
+    if (m_impl->textureArray && !m_impl->createCache())
+    {
+        err() << "Failed to create the texture array of an animated image" << std::endl;
+        m_impl->close();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AnimatedImage::getCacheCapacity() const
+{
+    return m_impl->textureArray ? m_impl->slots.size() : m_impl->cacheCapacity;
+}
+
+
+////////////////////////////////////////////////////////////
+void AnimatedImage::setPrefetchCount(std::size_t frameCount)
+{
+    m_impl->prefetchCount = frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AnimatedImage::getPrefetchCount() const
+{
+    return m_impl->prefetchCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void AnimatedImage::setSmooth(bool smooth)
+{
+    m_impl->smooth = smooth;
+
+    if (m_impl->textureArray)
+        m_impl->textureArray->setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool AnimatedImage::isSmooth() const
+{
+    return m_impl->smooth;
+}
+
+
+////////////////////////////////////////////////////////////
+bool AnimatedImage::setFrame(std::size_t frame)
+{
+    Impl& impl = *m_impl;
+    if (!impl.textureArray || (frame >= impl.delays.size()))
+        return false;
+
+    impl.uploadDecoded();
+    impl.currentFrame = frame;
+    ++impl.useCount;
+
+    if (const auto it = impl.resident.find(frame); it != impl.resident.end())
+    {
+        impl.slots[it->second].lastUsed = impl.useCount;
+    }
+    else
+    {
+        bool success = false;
+
+        {
+            const std::lock_guard lock(impl.decoderMutex);
+            success = impl.decoder.decode(frame, impl.pixels.data());
+        }
+
+        if (!success)
+            return false;
+
+        impl.upload(frame, impl.pixels.data());
+    }
+
+    impl.requestPrefetch();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AnimatedImage::getFrame() const
+{
+    return m_impl->currentFrame;
+}
+
+
+////////////////////////////////////////////////////////////
+const TextureArray* AnimatedImage::getTextureArray() const
+{
+    return m_impl->textureArray ? &*m_impl->textureArray : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int AnimatedImage::getLayer() const
+{
+    const auto it = m_impl->resident.find(m_impl->currentFrame);
+    return it != m_impl->resident.end() ? static_cast<unsigned int>(it->second) : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AnimatedImage::getCachedFrameCount() const
+{
+    return m_impl->resident.size();
+}
+
+} // namespace sf
@@ -39,6 +39,9 @@ const BlendMode BlendAlpha(BlendMode::Factor::SrcAlpha,
                            BlendMode::Factor::One,
                            BlendMode::Factor::OneMinusSrcAlpha,
                            BlendMode::Equation::Add);
+const BlendMode BlendPremultipliedAlpha(BlendMode::Factor::One,
+                                        BlendMode::Factor::OneMinusSrcAlpha,
+                                        BlendMode::Equation::Add);
 const BlendMode BlendAdd(BlendMode::Factor::SrcAlpha,
                          BlendMode::Factor::One,
                          BlendMode::Equation::Add,
@@ -29,11 +29,52 @@
 
 #include <SFML/System/Angle.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
+#include <cassert>
+
+
+namespace
+{
+namespace CircleShapeImpl
+{
+// Circles with the same point count share the directions of their points, so that changing
+// their radius or creating new ones doesn't require any trigonometry
+std::shared_ptr<const std::vector<sf::Vector2f>> getUnitCircle(std::size_t pointCount)
+{
+    using UnitCircle = std::vector<sf::Vector2f>;
+
+    static std::mutex                                                       mutex;
+    static std::unordered_map<std::size_t, std::weak_ptr<const UnitCircle>> cache;
+
+    const std::lock_guard lock(mutex);
+
+    std::weak_ptr<const UnitCircle>& entry = cache[pointCount];
+    if (auto unitCircle = entry.lock())
+        return unitCircle;
+
+    auto unitCircle = std::make_shared<UnitCircle>(pointCount);
+    for (std::size_t i = 0; i < pointCount; ++i)
+    {
+        const float ratio = static_cast<float>(i) / static_cast<float>(pointCount);
+        (*unitCircle)[i]  = sf::Vector2f(1.f, ratio * sf::degrees(360.f) - sf::degrees(90.f));
+    }
+
+    entry = unitCircle;
+    return unitCircle;
+}
+} // namespace CircleShapeImpl
+} // namespace
+
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-CircleShape::CircleShape(float radius, std::size_t pointCount) : m_radius(radius), m_pointCount(pointCount)
+CircleShape::CircleShape(float radius, std::size_t pointCount) :
+m_radius(radius),
+m_pointCount(pointCount),
+m_unitCircle(CircleShapeImpl::getUnitCircle(pointCount))
 {
     update();
 }
@@ -57,7 +98,12 @@ float CircleShape::getRadius() const
 ////////////////////////////////////////////////////////////
 void CircleShape::setPointCount(std::size_t count)
 {
-    m_pointCount = count;
+    if (count != m_pointCount)
+    {
+        m_pointCount = count;
+        m_unitCircle = CircleShapeImpl::getUnitCircle(count);
+    }
+
     update();
 }
 
@@ -71,8 +117,17 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    const Angle angle = static_cast<float>(index) / static_cast<float>(m_pointCount) * degrees(360.f) - degrees(90.f);
-    return Vector2f(m_radius, m_radius) + Vector2f(m_radius, angle);
+    assert(index < m_pointCount && "Index is out of bounds");
+    return Vector2f(m_radius, m_radius) + (*m_unitCircle)[index] * m_radius;
+}
+
+
+////////////////////////////////////////////////////////////
+void CircleShape::getPoints(Vector2f* points) const
+{
+    const Vector2f center(m_radius, m_radius);
+    for (std::size_t i = 0; i < m_pointCount; ++i)
+        points[i] = center + (*m_unitCircle)[i] * m_radius;
 }
 
 
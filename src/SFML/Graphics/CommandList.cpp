@@ -0,0 +1,931 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandList.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CommandListImpl
+{
+// Magic number and version at the beginning of the files saved by sf::CommandList
+constexpr std::uint32_t fileMagic   = 0x4C434653; // "SFCL"
+constexpr std::uint32_t fileVersion = 3;
+
+// Size of a vertex in a file: position, color and texture coordinates
+constexpr std::size_t vertexSize = 20;
+
+// Type of the commands in a file
+enum class Tag : std::uint8_t
+{
+    Clear,
+    View,
+    Vertices,
+    Buffers
+};
+
+// Serializer of little-endian values
+class Writer
+{
+public:
+    void write8(std::uint8_t value)
+    {
+        m_data.push_back(value);
+    }
+
+    void write32(std::uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+            write8(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    void write64(std::uint64_t value)
+    {
+        write32(static_cast<std::uint32_t>(value));
+        write32(static_cast<std::uint32_t>(value >> 32));
+    }
+
+    void writeFloat(float value)
+    {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        write32(bits);
+    }
+
+    template <typename T>
+    void writeEnum(T value)
+    {
+        write8(static_cast<std::uint8_t>(value));
+    }
+
+    [[nodiscard]] const std::vector<std::uint8_t>& getData() const
+    {
+        return m_data;
+    }
+
+private:
+    std::vector<std::uint8_t> m_data;
+};
+
+// Deserializer of little-endian values, reading past the end or invalid values marks it as failed
+class Reader
+{
+public:
+    explicit Reader(const std::vector<std::uint8_t>& data) : m_data(data)
+    {
+    }
+
+    std::uint8_t read8()
+    {
+        if (m_position >= m_data.size())
+        {
+            m_failed = true;
+            return 0;
+        }
+
+        return m_data[m_position++];
+    }
+
+    std::uint32_t read32()
+    {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; ++i)
+            value |= std::uint32_t{read8()} << (8 * i);
+        return value;
+    }
+
+    std::uint64_t read64()
+    {
+        const std::uint64_t low = read32();
+        return low | (std::uint64_t{read32()} << 32);
+    }
+
+    float readFloat()
+    {
+        const std::uint32_t bits  = read32();
+        float               value = 0.f;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Read an enumerator, checking that it's within the range of the enumeration
+    template <typename T>
+    T readEnum(T last)
+    {
+        const std::uint8_t value = read8();
+        if (value > static_cast<std::uint8_t>(last))
+        {
+            m_failed = true;
+            return {};
+        }
+
+        return static_cast<T>(value);
+    }
+
+    // Read a number of elements, checking that the remaining data can hold them
+    std::size_t readCount(std::size_t elementSize)
+    {
+        const std::uint64_t count = read64();
+        if (count > (m_data.size() - m_position) / elementSize)
+        {
+            m_failed = true;
+            return 0;
+        }
+
+        return static_cast<std::size_t>(count);
+    }
+
+    void fail()
+    {
+        m_failed = true;
+    }
+
+    [[nodiscard]] bool hasFailed() const
+    {
+        return m_failed;
+    }
+
+    [[nodiscard]] bool isAtEnd() const
+    {
+        return m_position == m_data.size();
+    }
+
+private:
+    const std::vector<std::uint8_t>& m_data;
+    std::size_t                      m_position{};
+    bool                             m_failed{};
+};
+
+// Identifiers of the resources referenced by a command list, 0 meaning no resource
+template <typename T>
+class ResourceTable
+{
+public:
+    std::uint32_t add(const T* resource)
+    {
+        if (!resource)
+            return 0;
+
+        const auto [it, inserted] = m_ids.try_emplace(resource, static_cast<std::uint32_t>(m_resources.size() + 1));
+        if (inserted)
+            m_resources.push_back(resource);
+        return it->second;
+    }
+
+    [[nodiscard]] std::uint32_t getId(const T* resource) const
+    {
+        return resource ? m_ids.at(resource) : 0;
+    }
+
+    [[nodiscard]] const std::vector<const T*>& getResources() const
+    {
+        return m_resources;
+    }
+
+private:
+    std::unordered_map<const T*, std::uint32_t> m_ids;
+    std::vector<const T*>                       m_resources;
+};
+
+// Find the resource of an identifier read from a file, 0 meaning no resource
+template <typename T>
+const T* findResource(Reader& reader, const std::vector<std::unique_ptr<T>>& resources)
+{
+    const std::uint32_t id = reader.read32();
+    if (id > resources.size())
+    {
+        reader.fail();
+        return nullptr;
+    }
+
+    return id ? resources[id - 1].get() : nullptr;
+}
+
+void writeVector(Writer& writer, sf::Vector2f vector)
+{
+    writer.writeFloat(vector.x);
+    writer.writeFloat(vector.y);
+}
+
+sf::Vector2f readVector(Reader& reader)
+{
+    const float x = reader.readFloat();
+    return {x, reader.readFloat()};
+}
+
+void writeRect(Writer& writer, const sf::FloatRect& rect)
+{
+    writeVector(writer, rect.getPosition());
+    writeVector(writer, rect.getSize());
+}
+
+sf::FloatRect readRect(Reader& reader)
+{
+    const sf::Vector2f position = readVector(reader);
+    return {position, readVector(reader)};
+}
+
+void writeColor(Writer& writer, sf::Color color)
+{
+    writer.write32(color.toInteger());
+}
+
+sf::Color readColor(Reader& reader)
+{
+    return sf::Color(reader.read32());
+}
+
+// Write the 3x3 matrix of a transform, in row-major order
+void writeTransform(Writer& writer, const sf::Transform& transform)
+{
+    const float* matrix = transform.getMatrix();
+    for (const int index : {0, 4, 12, 1, 5, 13, 3, 7, 15})
+        writer.writeFloat(matrix[index]);
+}
+
+sf::Transform readTransform(Reader& reader)
+{
+    float elements[9];
+    for (float& element : elements)
+        element = reader.readFloat();
+
+    return {elements[0],
+            elements[1],
+            elements[2],
+            elements[3],
+            elements[4],
+            elements[5],
+            elements[6],
+            elements[7],
+            elements[8]};
+}
+
+void writeStates(Writer&                           writer,
+                 const sf::RenderStates&           states,
+                 const ResourceTable<sf::Texture>& textures,
+                 const ResourceTable<sf::Shader>&  shaders)
+{
+    const sf::BlendMode&   blendMode   = states.blendMode;
+    const sf::StencilMode& stencilMode = states.stencilMode;
+    const sf::DepthMode&   depthMode   = states.depthMode;
+
+    writer.writeEnum(blendMode.colorSrcFactor);
+    writer.writeEnum(blendMode.colorDstFactor);
+    writer.writeEnum(blendMode.colorEquation);
+    writer.writeEnum(blendMode.alphaSrcFactor);
+    writer.writeEnum(blendMode.alphaDstFactor);
+    writer.writeEnum(blendMode.alphaEquation);
+    writer.writeEnum(stencilMode.stencilComparison);
+    writer.writeEnum(stencilMode.stencilUpdateOperation);
+    writer.write32(stencilMode.stencilReference.value);
+    writer.write32(stencilMode.stencilMask.value);
+    writer.write8(stencilMode.stencilOnly ? 1 : 0);
+    writer.writeEnum(depthMode.depthComparison);
+    writer.write8(depthMode.depthWrite ? 1 : 0);
+    writer.writeFloat(depthMode.depth);
+    writeTransform(writer, states.transform);
+    writer.writeEnum(states.coordinateType);
+    writer.write32(textures.getId(states.texture));
+    writer.write32(shaders.getId(states.shader));
+    writer.writeFloat(states.shaderParameters.x);
+    writer.writeFloat(states.shaderParameters.y);
+    writer.writeFloat(states.shaderParameters.z);
+    writer.writeFloat(states.shaderParameters.w);
+}
+
+sf::RenderStates readStates(Reader&                                          reader,
+                            const std::vector<std::unique_ptr<sf::Texture>>& textures,
+                            const std::vector<std::unique_ptr<sf::Shader>>&  shaders)
+{
+    using Factor   = sf::BlendMode::Factor;
+    using Equation = sf::BlendMode::Equation;
+
+    sf::RenderStates states;
+    sf::BlendMode&   blendMode   = states.blendMode;
+    sf::StencilMode& stencilMode = states.stencilMode;
+    sf::DepthMode&   depthMode   = states.depthMode;
+
+    blendMode.colorSrcFactor           = reader.readEnum(Factor::OneMinusDstAlpha);
+    blendMode.colorDstFactor           = reader.readEnum(Factor::OneMinusDstAlpha);
+    blendMode.colorEquation            = reader.readEnum(Equation::Max);
+    blendMode.alphaSrcFactor           = reader.readEnum(Factor::OneMinusDstAlpha);
+    blendMode.alphaDstFactor           = reader.readEnum(Factor::OneMinusDstAlpha);
+    blendMode.alphaEquation            = reader.readEnum(Equation::Max);
+    stencilMode.stencilComparison      = reader.readEnum(sf::StencilComparison::Always);
+    stencilMode.stencilUpdateOperation = reader.readEnum(sf::StencilUpdateOperation::Invert);
+    stencilMode.stencilReference       = reader.read32();
+    stencilMode.stencilMask            = reader.read32();
+    stencilMode.stencilOnly            = reader.read8() != 0;
+    depthMode.depthComparison          = reader.readEnum(sf::DepthComparison::Always);
+    depthMode.depthWrite               = reader.read8() != 0;
+    depthMode.depth                    = reader.readFloat();
+    states.transform                   = readTransform(reader);
+    states.coordinateType              = reader.readEnum(sf::CoordinateType::Pixels);
+    states.texture                     = findResource(reader, textures);
+    states.shader                      = findResource(reader, shaders);
+    states.shaderParameters.x          = reader.readFloat();
+    states.shaderParameters.y          = reader.readFloat();
+    states.shaderParameters.z          = reader.readFloat();
+    states.shaderParameters.w          = reader.readFloat();
+    return states;
+}
+
+// Fragment shader standing in for the shaders of a loaded command list
+constexpr auto placeholderShaderCode = "void main() { gl_FragColor = gl_Color; }";
+} // namespace CommandListImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CommandList::CommandList(const Vector2u& size) : m_size(size)
+{
+    initialize();
+
+    // From now on draws are recorded instead of being submitted to OpenGL
+    m_recording = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u CommandList::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandList::setActive(bool active)
+{
+    return !active;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::replay(RenderTarget& target)
+{
+    assert(&target != this && "A command list cannot be replayed onto itself");
+
+    // Make sure the draws merged by the batch are part of the recording
+    flush();
+
+    const View previousView = target.getView();
+    bool       viewChanged  = false;
+
+    m_order.resize(m_commands.size());
+    std::iota(m_order.begin(), m_order.end(), std::size_t{0});
+
+    if (m_sortingEnabled)
+        sortDraws();
+
+    for (const std::size_t index : m_order)
+    {
+        const Command& command = m_commands[index];
+
+        if (const auto* clear = std::get_if<ClearCommand>(&command))
+        {
+            if (clear->color && clear->stencilValue)
+                target.clear(*clear->color, *clear->stencilValue);
+            else if (clear->color)
+                target.clear(*clear->color);
+            else if (clear->stencilValue)
+                target.clearStencil(*clear->stencilValue);
+
+            if (clear->depth)
+                target.clearDepth(*clear->depth);
+        }
+        else if (const auto* view = std::get_if<ViewCommand>(&command))
+        {
+            target.setView(view->view);
+            viewChanged = true;
+        }
+        else if (const auto* vertices = std::get_if<VerticesCommand>(&command))
+        {
+            target.draw(m_vertices.data() + vertices->firstVertex,
+                        vertices->vertexCount,
+                        vertices->type,
+                        vertices->states);
+        }
+        else if (const auto* buffers = std::get_if<BuffersCommand>(&command))
+        {
+            const VertexBuffer& vertexBuffer = *buffers->vertexBuffer;
+
+            if (buffers->indexBuffer)
+                target.draw(vertexBuffer, *buffers->indexBuffer, buffers->first, buffers->count, buffers->states);
+            else
+                target.draw(vertexBuffer, buffers->first, buffers->count, buffers->states);
+        }
+    }
+
+    // Leave the view of the target as it was before the replay
+    if (viewChanged)
+        target.setView(previousView);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::reset()
+{
+    // Drop the pending batch along with the recorded commands
+    m_batch.vertices.clear();
+    m_commands.clear();
+    m_vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandList::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::setSortingEnabled(bool enabled)
+{
+    m_sortingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandList::isSortingEnabled() const
+{
+    return m_sortingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::setLayer(int layer)
+{
+    // Pending batched geometry belongs to the previous layer
+    flush();
+
+    m_layer = layer;
+}
+
+
+////////////////////////////////////////////////////////////
+int CommandList::getLayer() const
+{
+    return m_layer;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandList::saveToFile(const std::filesystem::path& filename)
+{
+    using namespace CommandListImpl;
+
+    // Make sure the draws merged by the batch are part of the capture
+    flush();
+
+    // Give an identifier to every resource referenced by the draws
+    ResourceTable<Texture>      textures;
+    ResourceTable<Shader>       shaders;
+    ResourceTable<VertexBuffer> vertexBuffers;
+    ResourceTable<IndexBuffer>  indexBuffers;
+
+    for (const Command& command : m_commands)
+    {
+        const RenderStates* states = nullptr;
+
+        if (const auto* vertices = std::get_if<VerticesCommand>(&command))
+        {
+            states = &vertices->states;
+        }
+        else if (const auto* buffers = std::get_if<BuffersCommand>(&command))
+        {
+            vertexBuffers.add(buffers->vertexBuffer);
+            indexBuffers.add(buffers->indexBuffer);
+            states = &buffers->states;
+        }
+
+        if (states)
+        {
+            textures.add(states->texture);
+            shaders.add(states->shader);
+        }
+    }
+
+    Writer writer;
+    writer.write32(fileMagic);
+    writer.write32(fileVersion);
+    writer.write32(m_size.x);
+    writer.write32(m_size.y);
+
+    writer.write64(textures.getResources().size());
+    for (const Texture* texture : textures.getResources())
+    {
+        writer.write32(texture->getSize().x);
+        writer.write32(texture->getSize().y);
+        writer.write8(texture->isSmooth() ? 1 : 0);
+        writer.write8(texture->isRepeated() ? 1 : 0);
+        writer.write8(texture->isSrgb() ? 1 : 0);
+    }
+
+    writer.write64(shaders.getResources().size());
+
+    writer.write64(vertexBuffers.getResources().size());
+    for (const VertexBuffer* vertexBuffer : vertexBuffers.getResources())
+    {
+        writer.write64(vertexBuffer->getVertexCount());
+        writer.writeEnum(vertexBuffer->getPrimitiveType());
+    }
+
+    writer.write64(indexBuffers.getResources().size());
+    for (const IndexBuffer* indexBuffer : indexBuffers.getResources())
+    {
+        writer.write64(indexBuffer->getIndexCount());
+        writer.writeEnum(indexBuffer->getType());
+    }
+
+    writer.write64(m_vertices.size());
+    for (const Vertex& vertex : m_vertices)
+    {
+        writeVector(writer, vertex.position);
+        writeColor(writer, vertex.color);
+        writeVector(writer, vertex.texCoords);
+    }
+
+    writer.write64(m_commands.size());
+    for (const Command& command : m_commands)
+    {
+        if (const auto* clear = std::get_if<ClearCommand>(&command))
+        {
+            writer.writeEnum(Tag::Clear);
+            writer.write8(static_cast<std::uint8_t>((clear->color ? 1 : 0) | (clear->stencilValue ? 2 : 0) |
+                                                    (clear->depth ? 4 : 0)));
+            writeColor(writer, clear->color.value_or(Color::Black));
+            writer.write32(clear->stencilValue.value_or(StencilValue(0)).value);
+            writer.writeFloat(clear->depth.value_or(1.f));
+        }
+        else if (const auto* view = std::get_if<ViewCommand>(&command))
+        {
+            writer.writeEnum(Tag::View);
+            writeVector(writer, view->view.getCenter());
+            writeVector(writer, view->view.getSize());
+            writer.writeFloat(view->view.getRotation().asDegrees());
+            writeRect(writer, view->view.getViewport());
+            writeRect(writer, view->view.getScissor());
+        }
+        else if (const auto* vertices = std::get_if<VerticesCommand>(&command))
+        {
+            writer.writeEnum(Tag::Vertices);
+            writer.write64(vertices->firstVertex);
+            writer.write64(vertices->vertexCount);
+            writer.writeEnum(vertices->type);
+            writeStates(writer, vertices->states, textures, shaders);
+            writer.write32(static_cast<std::uint32_t>(vertices->layer));
+        }
+        else if (const auto* buffers = std::get_if<BuffersCommand>(&command))
+        {
+            writer.writeEnum(Tag::Buffers);
+            writer.write32(vertexBuffers.getId(buffers->vertexBuffer));
+            writer.write32(indexBuffers.getId(buffers->indexBuffer));
+            writer.write64(buffers->first);
+            writer.write64(buffers->count);
+            writeStates(writer, buffers->states, textures, shaders);
+            writer.write32(static_cast<std::uint32_t>(buffers->layer));
+        }
+    }
+
+    const std::vector<std::uint8_t>& data = writer.getData();
+    std::ofstream                    file(filename, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+    {
+        err() << "Failed to save command list\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CommandList> CommandList::loadFromFile(const std::filesystem::path& filename)
+{
+    using namespace CommandListImpl;
+
+    std::ifstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to load command list\n"
+              << formatDebugPathInfo(filename) << "\nReason: Unable to open file" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    Reader                          reader(data);
+
+    const auto fail = [&filename](const char* reason)
+    {
+        err() << "Failed to load command list\n"
+              << formatDebugPathInfo(filename) << "\nReason: " << reason << std::endl;
+        return std::nullopt;
+    };
+
+    if ((reader.read32() != fileMagic) || (reader.read32() != fileVersion))
+        return fail("Not a command list file, or saved by an unsupported version of SFML");
+
+    const std::uint32_t width  = reader.read32();
+    const std::uint32_t height = reader.read32();
+    CommandList         commandList({width, height});
+
+    // Create the placeholders of the resources
+    const std::size_t textureCount = reader.readCount(11);
+    for (std::size_t i = 0; i < textureCount; ++i)
+    {
+        const std::uint32_t textureWidth  = reader.read32();
+        const std::uint32_t textureHeight = reader.read32();
+        const bool          smooth        = reader.read8() != 0;
+        const bool          repeated      = reader.read8() != 0;
+        const bool          sRgb          = reader.read8() != 0;
+
+        auto texture = Texture::create({textureWidth, textureHeight}, sRgb);
+        if (!texture)
+            return fail("Failed to create a placeholder texture");
+
+        std::vector<std::uint8_t> pixels(std::size_t{textureWidth} * textureHeight * 4, 255);
+        texture->update(pixels.data());
+        texture->setSmooth(smooth);
+        texture->setRepeated(repeated);
+        commandList.m_placeholderTextures.push_back(std::make_unique<Texture>(std::move(*texture)));
+    }
+
+    // Shaders are only needed to reproduce the program changes, they are skipped if not supported
+    const std::size_t shaderCount = reader.readCount(1);
+    for (std::size_t i = 0; i < shaderCount; ++i)
+    {
+        std::unique_ptr<Shader> placeholder;
+        if (Shader::isAvailable())
+        {
+            if (auto shader = Shader::loadFromMemory(placeholderShaderCode, Shader::Type::Fragment))
+                placeholder = std::make_unique<Shader>(std::move(*shader));
+        }
+
+        commandList.m_placeholderShaders.push_back(std::move(placeholder));
+    }
+
+    const std::size_t vertexBufferCount = reader.readCount(9);
+    for (std::size_t i = 0; i < vertexBufferCount; ++i)
+    {
+        const std::uint64_t vertexCount = reader.read64();
+        auto vertexBuffer = std::make_unique<VertexBuffer>(reader.readEnum(PrimitiveType::TriangleFan),
+                                                           VertexBuffer::Usage::Static);
+        if (reader.hasFailed() || !vertexBuffer->create(static_cast<std::size_t>(vertexCount)))
+            return fail("Failed to create a placeholder vertex buffer");
+
+        commandList.m_placeholderVertexBuffers.push_back(std::move(vertexBuffer));
+    }
+
+    const std::size_t indexBufferCount = reader.readCount(9);
+    for (std::size_t i = 0; i < indexBufferCount; ++i)
+    {
+        const std::uint64_t indexCount = reader.read64();
+        auto indexBuffer = std::make_unique<IndexBuffer>(reader.readEnum(IndexBuffer::Type::UInt32),
+                                                         IndexBuffer::Usage::Static);
+        if (reader.hasFailed() || !indexBuffer->create(static_cast<std::size_t>(indexCount)))
+            return fail("Failed to create a placeholder index buffer");
+
+        commandList.m_placeholderIndexBuffers.push_back(std::move(indexBuffer));
+    }
+
+    commandList.m_vertices.resize(reader.readCount(vertexSize));
+    for (Vertex& vertex : commandList.m_vertices)
+    {
+        vertex.position  = readVector(reader);
+        vertex.color     = readColor(reader);
+        vertex.texCoords = readVector(reader);
+    }
+
+    const auto& textures = commandList.m_placeholderTextures;
+    const auto& shaders  = commandList.m_placeholderShaders;
+
+    const std::size_t commandCount = reader.readCount(1);
+    commandList.m_commands.reserve(commandCount);
+    for (std::size_t i = 0; (i < commandCount) && !reader.hasFailed(); ++i)
+    {
+        switch (reader.readEnum(Tag::Buffers))
+        {
+            case Tag::Clear:
+            {
+                const std::uint8_t flags        = reader.read8();
+                const Color        color        = readColor(reader);
+                const StencilValue stencilValue = reader.read32();
+                const float        depth        = reader.readFloat();
+                if ((flags & 7) == 0)
+                    reader.fail();
+
+                commandList.m_commands.emplace_back(
+                    ClearCommand{(flags & 1) ? std::optional(color) : std::nullopt,
+                                 (flags & 2) ? std::optional(stencilValue) : std::nullopt,
+                                 (flags & 4) ? std::optional(depth) : std::nullopt});
+                break;
+            }
+            case Tag::View:
+            {
+                const Vector2f center = readVector(reader);
+                View           view(center, readVector(reader));
+                view.setRotation(degrees(reader.readFloat()));
+                view.setViewport(readRect(reader));
+                view.setScissor(readRect(reader));
+                commandList.m_commands.emplace_back(ViewCommand{view});
+                break;
+            }
+            case Tag::Vertices:
+            {
+                VerticesCommand command;
+                command.firstVertex = static_cast<std::size_t>(reader.read64());
+                command.vertexCount = static_cast<std::size_t>(reader.read64());
+                command.type        = reader.readEnum(PrimitiveType::TriangleFan);
+                command.states      = readStates(reader, textures, shaders);
+                command.layer       = static_cast<int>(static_cast<std::int32_t>(reader.read32()));
+
+                // The vertices must be part of the storage of the list
+                const std::size_t vertexCount = commandList.m_vertices.size();
+                if ((command.firstVertex > vertexCount) || (command.vertexCount > vertexCount - command.firstVertex))
+                    reader.fail();
+
+                commandList.m_commands.emplace_back(command);
+                break;
+            }
+            case Tag::Buffers:
+            {
+                BuffersCommand command;
+                command.vertexBuffer = findResource(reader, commandList.m_placeholderVertexBuffers);
+                command.indexBuffer  = findResource(reader, commandList.m_placeholderIndexBuffers);
+                command.first        = static_cast<std::size_t>(reader.read64());
+                command.count        = static_cast<std::size_t>(reader.read64());
+                command.states       = readStates(reader, textures, shaders);
+                command.layer        = static_cast<int>(static_cast<std::int32_t>(reader.read32()));
+
+                if (!command.vertexBuffer)
+                    reader.fail();
+
+                commandList.m_commands.emplace_back(command);
+                break;
+            }
+        }
+    }
+
+    if (reader.hasFailed() || !reader.isAtEnd())
+        return fail("The file is corrupted");
+
+    return commandList;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandList::activateForDrawing()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordClear(const std::optional<Color>&        color,
+                              const std::optional<StencilValue>& stencilValue,
+                              const std::optional<float>&        depth)
+{
+    m_commands.emplace_back(ClearCommand{color, stencilValue, depth});
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordView(const View& view)
+{
+    m_commands.emplace_back(ViewCommand{view});
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordVertices(const Vertex*       vertices,
+                                 std::size_t         vertexCount,
+                                 PrimitiveType       type,
+                                 const RenderStates& states)
+{
+    m_commands.emplace_back(VerticesCommand{m_vertices.size(), vertexCount, type, states, m_layer});
+    m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordBuffers(const VertexBuffer& vertexBuffer,
+                                const IndexBuffer*  indexBuffer,
+                                std::size_t         first,
+                                std::size_t         count,
+                                const RenderStates& states)
+{
+    m_commands.emplace_back(BuffersCommand{&vertexBuffer, indexBuffer, first, count, states, m_layer});
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::sortDraws()
+{
+    // Find the layer and the states of a draw command, clears and views have none
+    const auto getDraw = [this](std::size_t index) -> std::pair<int, const RenderStates*>
+    {
+        const Command& command = m_commands[index];
+
+        if (const auto* vertices = std::get_if<VerticesCommand>(&command))
+            return {vertices->layer, &vertices->states};
+
+        if (const auto* buffers = std::get_if<BuffersCommand>(&command))
+            return {buffers->layer, &buffers->states};
+
+        return {0, nullptr};
+    };
+
+    // Clears, views and stencil draws depend on the order of what surrounds them
+    const auto isBarrier = [&](std::size_t index)
+    {
+        const RenderStates* states = getDraw(index).second;
+        return !states || (states->stencilMode != StencilMode());
+    };
+
+    // Layer first, then the states that are the most expensive to change, then the depth
+    // so that equal opaque draws are submitted front to back and hidden pixels are skipped
+    const auto getSortKey = [&](std::size_t index)
+    {
+        const auto [layer, states] = getDraw(index);
+        const BlendMode& blendMode = states->blendMode;
+        const DepthMode& depthMode = states->depthMode;
+
+        return std::make_tuple(layer,
+                               reinterpret_cast<std::uintptr_t>(states->shader),
+                               reinterpret_cast<std::uintptr_t>(states->texture),
+                               states->coordinateType,
+                               blendMode.colorSrcFactor,
+                               blendMode.colorDstFactor,
+                               blendMode.colorEquation,
+                               blendMode.alphaSrcFactor,
+                               blendMode.alphaDstFactor,
+                               blendMode.alphaEquation,
+                               depthMode.depthComparison,
+                               depthMode.depthWrite,
+                               depthMode.depth);
+    };
+
+    // Sort each run of draws between two barriers, keeping the submission order of equal draws
+    auto begin = m_order.begin();
+    while (begin != m_order.end())
+    {
+        if (isBarrier(*begin))
+        {
+            ++begin;
+            continue;
+        }
+
+        const auto end = std::find_if(begin, m_order.end(), isBarrier);
+        std::stable_sort(begin,
+                         end,
+                         [&](std::size_t left, std::size_t right) { return getSortKey(left) < getSortKey(right); });
+        begin = end;
+    }
+}
+
+} // namespace sf
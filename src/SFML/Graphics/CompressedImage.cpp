@@ -0,0 +1,417 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CompressedImageImpl
+{
+using Format = sf::Texture::CompressedFormat;
+
+// Block layouts, in the order of the sf::Texture::CompressedFormat enumeration
+constexpr std::array<sf::priv::CompressedBlockInfo, 23> blockInfos = {{
+    {{4, 4}, 8},    // Bc1
+    {{4, 4}, 16},   // Bc2
+    {{4, 4}, 16},   // Bc3
+    {{4, 4}, 8},    // Bc4
+    {{4, 4}, 16},   // Bc5
+    {{4, 4}, 16},   // Bc7
+    {{4, 4}, 8},    // Etc2Rgb
+    {{4, 4}, 8},    // Etc2RgbA1
+    {{4, 4}, 16},   // Etc2Rgba
+    {{4, 4}, 16},   // Astc4x4
+    {{5, 4}, 16},   // Astc5x4
+    {{5, 5}, 16},   // Astc5x5
+    {{6, 5}, 16},   // Astc6x5
+    {{6, 6}, 16},   // Astc6x6
+    {{8, 5}, 16},   // Astc8x5
+    {{8, 6}, 16},   // Astc8x6
+    {{8, 8}, 16},   // Astc8x8
+    {{10, 5}, 16},  // Astc10x5
+    {{10, 6}, 16},  // Astc10x6
+    {{10, 8}, 16},  // Astc10x8
+    {{10, 10}, 16}, // Astc10x10
+    {{12, 10}, 16}, // Astc12x10
+    {{12, 12}, 16}  // Astc12x12
+}};
+
+// Format of the blocks along with their color space
+struct FormatDescription
+{
+    Format format;
+    bool   sRgb{};
+};
+
+// Read little endian integers from unaligned memory
+std::uint32_t readUint32(const std::uint8_t* bytes)
+{
+    return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8) |
+           (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+}
+
+std::uint64_t readUint64(const std::uint8_t* bytes)
+{
+    return static_cast<std::uint64_t>(readUint32(bytes)) | (static_cast<std::uint64_t>(readUint32(bytes + 4)) << 32);
+}
+
+constexpr std::uint32_t makeFourCC(char a, char b, char c, char d)
+{
+    return static_cast<std::uint32_t>(a) | (static_cast<std::uint32_t>(b) << 8) |
+           (static_cast<std::uint32_t>(c) << 16) | (static_cast<std::uint32_t>(d) << 24);
+}
+
+// Number of levels of a full mipmap chain
+std::size_t getFullLevelCount(sf::Vector2u size)
+{
+    std::size_t count = 1;
+    for (unsigned int largest = std::max(size.x, size.y); largest > 1; largest /= 2)
+        ++count;
+    return count;
+}
+
+// Size of the compressed blocks covering a level
+std::size_t getLevelByteSize(const sf::priv::CompressedBlockInfo& info, sf::Vector2u size)
+{
+    const std::size_t blocksX = (size.x + info.blockSize.x - 1) / info.blockSize.x;
+    const std::size_t blocksY = (size.y + info.blockSize.y - 1) / info.blockSize.y;
+    return blocksX * blocksY * info.blockBytes;
+}
+
+// Size of a mipmap level
+sf::Vector2u getLevelSize(sf::Vector2u size, std::size_t level)
+{
+    return {std::max(size.x >> level, 1u), std::max(size.y >> level, 1u)};
+}
+
+// Formats of DDS files, identified by their FourCC code
+std::optional<FormatDescription> getDdsFourCCFormat(std::uint32_t fourCC)
+{
+    switch (fourCC)
+    {
+        case makeFourCC('D', 'X', 'T', '1'):
+            return FormatDescription{Format::Bc1};
+        case makeFourCC('D', 'X', 'T', '2'):
+        case makeFourCC('D', 'X', 'T', '3'):
+            return FormatDescription{Format::Bc2};
+        case makeFourCC('D', 'X', 'T', '4'):
+        case makeFourCC('D', 'X', 'T', '5'):
+            return FormatDescription{Format::Bc3};
+        case makeFourCC('A', 'T', 'I', '1'):
+        case makeFourCC('B', 'C', '4', 'U'):
+            return FormatDescription{Format::Bc4};
+        case makeFourCC('A', 'T', 'I', '2'):
+        case makeFourCC('B', 'C', '5', 'U'):
+            return FormatDescription{Format::Bc5};
+        default:
+            return std::nullopt;
+    }
+}
+
+// Formats of DDS files with a DX10 header, identified by their DXGI_FORMAT value
+std::optional<FormatDescription> getDxgiFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        // clang-format off
+        case 71: return FormatDescription{Format::Bc1, false};
+        case 72: return FormatDescription{Format::Bc1, true};
+        case 74: return FormatDescription{Format::Bc2, false};
+        case 75: return FormatDescription{Format::Bc2, true};
+        case 77: return FormatDescription{Format::Bc3, false};
+        case 78: return FormatDescription{Format::Bc3, true};
+        case 80: return FormatDescription{Format::Bc4, false};
+        case 83: return FormatDescription{Format::Bc5, false};
+        case 98: return FormatDescription{Format::Bc7, false};
+        case 99: return FormatDescription{Format::Bc7, true};
+        default: return std::nullopt;
+        // clang-format on
+    }
+}
+
+// Formats of KTX2 files, identified by their VkFormat value
+std::optional<FormatDescription> getVkFormat(std::uint32_t vkFormat)
+{
+    // The ASTC formats are laid out as UNORM/SRGB pairs, in the same order as our enumeration
+    constexpr std::uint32_t firstAstc = 157;
+    constexpr std::uint32_t lastAstc  = 184;
+    if ((vkFormat >= firstAstc) && (vkFormat <= lastAstc))
+    {
+        const auto index = static_cast<int>(Format::Astc4x4) + static_cast<int>((vkFormat - firstAstc) / 2);
+        return FormatDescription{static_cast<Format>(index), ((vkFormat - firstAstc) % 2) == 1};
+    }
+
+    switch (vkFormat)
+    {
+        // clang-format off
+        case 131: // BC1_RGB_UNORM
+        case 133: return FormatDescription{Format::Bc1, false};
+        case 132: // BC1_RGB_SRGB
+        case 134: return FormatDescription{Format::Bc1, true};
+        case 135: return FormatDescription{Format::Bc2, false};
+        case 136: return FormatDescription{Format::Bc2, true};
+        case 137: return FormatDescription{Format::Bc3, false};
+        case 138: return FormatDescription{Format::Bc3, true};
+        case 139: return FormatDescription{Format::Bc4, false};
+        case 141: return FormatDescription{Format::Bc5, false};
+        case 145: return FormatDescription{Format::Bc7, false};
+        case 146: return FormatDescription{Format::Bc7, true};
+        case 147: return FormatDescription{Format::Etc2Rgb, false};
+        case 148: return FormatDescription{Format::Etc2Rgb, true};
+        case 149: return FormatDescription{Format::Etc2RgbA1, false};
+        case 150: return FormatDescription{Format::Etc2RgbA1, true};
+        case 151: return FormatDescription{Format::Etc2Rgba, false};
+        case 152: return FormatDescription{Format::Etc2Rgba, true};
+        default:  return std::nullopt;
+        // clang-format on
+    }
+}
+
+// Parse a DDS file, the signature has already been checked
+std::optional<sf::priv::CompressedImage> parseDds(const std::uint8_t* data, std::size_t size)
+{
+    constexpr std::size_t   headerOffset    = 4;
+    constexpr std::size_t   headerSize      = 124;
+    constexpr std::size_t   dx10HeaderSize  = 20;
+    constexpr std::uint32_t flagMipmapCount = 0x20000;
+    constexpr std::uint32_t flagDepth       = 0x800000;
+    constexpr std::uint32_t pixelFourCC     = 0x4;
+    constexpr std::uint32_t caps2Cubemap    = 0x200;
+    constexpr std::uint32_t caps2Volume     = 0x200000;
+
+    if ((size < headerOffset + headerSize) || (readUint32(data + headerOffset) != headerSize))
+    {
+        sf::err() << "Failed to load DDS file, the header is invalid" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::uint8_t* header      = data + headerOffset;
+    const std::uint32_t flags       = readUint32(header + 4);
+    const sf::Vector2u  imageSize   = {readUint32(header + 12), readUint32(header + 8)};
+    const std::uint32_t depth       = readUint32(header + 20);
+    const std::uint32_t mipmapCount = readUint32(header + 24);
+    const std::uint32_t pixelFlags  = readUint32(header + 76);
+    const std::uint32_t fourCC      = readUint32(header + 80);
+    const std::uint32_t caps2       = readUint32(header + 108);
+
+    if (((flags & flagDepth) && (depth > 1)) || (caps2 & (caps2Cubemap | caps2Volume)))
+    {
+        sf::err() << "Failed to load DDS file, only 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    if (!(pixelFlags & pixelFourCC))
+    {
+        sf::err() << "Failed to load DDS file, only block compressed formats are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    std::size_t                      offset = headerOffset + headerSize;
+    std::optional<FormatDescription> format;
+
+    if (fourCC == makeFourCC('D', 'X', '1', '0'))
+    {
+        constexpr std::uint32_t dimensionTexture2D = 3;
+        constexpr std::uint32_t miscTextureCube    = 0x4;
+
+        if (size < offset + dx10HeaderSize)
+        {
+            sf::err() << "Failed to load DDS file, the DX10 header is truncated" << std::endl;
+            return std::nullopt;
+        }
+
+        const std::uint8_t* dx10Header = data + offset;
+        if ((readUint32(dx10Header + 4) != dimensionTexture2D) || (readUint32(dx10Header + 8) & miscTextureCube) ||
+            (readUint32(dx10Header + 12) > 1))
+        {
+            sf::err() << "Failed to load DDS file, only 2D textures are supported" << std::endl;
+            return std::nullopt;
+        }
+
+        format = getDxgiFormat(readUint32(dx10Header));
+        offset += dx10HeaderSize;
+    }
+    else
+    {
+        format = getDdsFourCCFormat(fourCC);
+    }
+
+    if (!format)
+    {
+        sf::err() << "Failed to load DDS file, unsupported pixel format" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((imageSize.x == 0) || (imageSize.y == 0))
+    {
+        sf::err() << "Failed to load DDS file, invalid size (" << imageSize.x << "x" << imageSize.y << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    // Some writers store a zero level count, and we don't want to read more levels than a full chain
+    std::size_t levelCount = (flags & flagMipmapCount) ? std::max(mipmapCount, 1u) : 1;
+    levelCount             = std::min(levelCount, getFullLevelCount(imageSize));
+
+    // The levels are stored one after the other, starting with the largest
+    const sf::priv::CompressedBlockInfo info = sf::priv::getCompressedBlockInfo(format->format);
+    sf::priv::CompressedImage           image{format->format, format->sRgb, {}};
+
+    for (std::size_t i = 0; i < levelCount; ++i)
+    {
+        const sf::Vector2u levelSize = getLevelSize(imageSize, i);
+        const std::size_t  byteSize  = getLevelByteSize(info, levelSize);
+
+        if (size - offset < byteSize)
+        {
+            sf::err() << "Failed to load DDS file, the pixel data is truncated" << std::endl;
+            return std::nullopt;
+        }
+
+        image.levels.push_back({levelSize, data + offset, byteSize});
+        offset += byteSize;
+    }
+
+    return image;
+}
+
+// Parse a KTX2 file, the signature has already been checked
+std::optional<sf::priv::CompressedImage> parseKtx2(const std::uint8_t* data, std::size_t size)
+{
+    constexpr std::size_t levelIndexOffset = 80;
+    constexpr std::size_t levelIndexStride = 24;
+
+    if (size < levelIndexOffset)
+    {
+        sf::err() << "Failed to load KTX2 file, the header is truncated" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::uint32_t vkFormat         = readUint32(data + 12);
+    const sf::Vector2u  imageSize        = {readUint32(data + 20), readUint32(data + 24)};
+    const std::uint32_t depth            = readUint32(data + 28);
+    const std::uint32_t layerCount       = readUint32(data + 32);
+    const std::uint32_t faceCount        = readUint32(data + 36);
+    const std::uint32_t levelCount       = std::max(readUint32(data + 40), 1u);
+    const std::uint32_t supercompression = readUint32(data + 44);
+
+    if ((depth != 0) || (layerCount > 1) || (faceCount != 1))
+    {
+        sf::err() << "Failed to load KTX2 file, only 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    if (supercompression != 0)
+    {
+        sf::err() << "Failed to load KTX2 file, supercompressed files are not supported" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::optional<FormatDescription> format = getVkFormat(vkFormat);
+    if (!format)
+    {
+        sf::err() << "Failed to load KTX2 file, unsupported pixel format (VkFormat " << vkFormat << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((imageSize.x == 0) || (imageSize.y == 0) || (levelCount > getFullLevelCount(imageSize)))
+    {
+        sf::err() << "Failed to load KTX2 file, invalid size (" << imageSize.x << "x" << imageSize.y << ", "
+                  << levelCount << " levels)" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((size - levelIndexOffset) / levelIndexStride < levelCount)
+    {
+        sf::err() << "Failed to load KTX2 file, the level index is truncated" << std::endl;
+        return std::nullopt;
+    }
+
+    // The level index starts with the largest level, even though the data is stored smallest first
+    const sf::priv::CompressedBlockInfo info = sf::priv::getCompressedBlockInfo(format->format);
+    sf::priv::CompressedImage           image{format->format, format->sRgb, {}};
+
+    for (std::size_t i = 0; i < levelCount; ++i)
+    {
+        const std::uint8_t* entry      = data + levelIndexOffset + i * levelIndexStride;
+        const std::uint64_t byteOffset = readUint64(entry);
+        const std::uint64_t byteLength = readUint64(entry + 8);
+        const sf::Vector2u  levelSize  = getLevelSize(imageSize, i);
+        const std::size_t   byteSize   = getLevelByteSize(info, levelSize);
+
+        if ((byteOffset > size) || (byteLength > size - byteOffset) || (byteLength < byteSize))
+        {
+            sf::err() << "Failed to load KTX2 file, the pixel data of level " << i << " is truncated" << std::endl;
+            return std::nullopt;
+        }
+
+        image.levels.push_back({levelSize, data + byteOffset, byteSize});
+    }
+
+    return image;
+}
+} // namespace CompressedImageImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+CompressedBlockInfo getCompressedBlockInfo(Texture::CompressedFormat format)
+{
+    return CompressedImageImpl::blockInfos[static_cast<std::size_t>(format)];
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedImage> parseCompressedImage(const std::uint8_t* data, std::size_t size)
+{
+    static constexpr std::array<std::uint8_t, 4>  ddsSignature  = {'D', 'D', 'S', ' '};
+    static constexpr std::array<std::uint8_t, 12>
+        ktx2Signature = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+    if (data && (size >= ktx2Signature.size()) && (std::memcmp(data, ktx2Signature.data(), ktx2Signature.size()) == 0))
+        return CompressedImageImpl::parseKtx2(data, size);
+
+    if (data && (size >= ddsSignature.size()) && (std::memcmp(data, ddsSignature.data(), ddsSignature.size()) == 0))
+        return CompressedImageImpl::parseDds(data, size);
+
+    err() << "Failed to load compressed texture, the data is neither a KTX2 nor a DDS file" << std::endl;
+    return std::nullopt;
+}
+
+} // namespace sf::priv
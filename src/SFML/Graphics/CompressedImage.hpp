@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Layout of the blocks of a compressed format
+///
+////////////////////////////////////////////////////////////
+struct CompressedBlockInfo
+{
+    Vector2u    blockSize;  //!< Size of a block, in pixels
+    std::size_t blockBytes; //!< Size of a block, in bytes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Mipmap level of a compressed texture file
+///
+////////////////////////////////////////////////////////////
+struct CompressedLevel
+{
+    Vector2u            size;     //!< Size of the level, in pixels
+    const std::uint8_t* data{};   //!< Compressed blocks of the level, pointing into the file data
+    std::size_t         byteSize; //!< Size of the compressed blocks, in bytes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Contents of a compressed texture file
+///
+////////////////////////////////////////////////////////////
+struct CompressedImage
+{
+    Texture::CompressedFormat    format; //!< Format of the blocks
+    bool                         sRgb{}; //!< Are the pixels stored in the sRGB color space?
+    std::vector<CompressedLevel> levels; //!< Mipmap levels, starting with the full size image
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the block layout of a compressed format
+///
+/// \param format Compressed format
+///
+/// \return Layout of the blocks of the format
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] CompressedBlockInfo getCompressedBlockInfo(Texture::CompressedFormat format);
+
+////////////////////////////////////////////////////////////
+/// \brief Parse a KTX2 or DDS file in memory
+///
+/// The container is identified by its signature. Only plain
+/// 2D textures are supported: cube maps, arrays, volume
+/// textures and KTX2 supercompression are rejected. The
+/// returned levels point into \a data, which must outlive
+/// them.
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return Parsed file, or `std::nullopt` if the data is invalid or unsupported
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<CompressedImage> parseCompressedImage(const std::uint8_t* data, std::size_t size);
+
+} // namespace sf::priv
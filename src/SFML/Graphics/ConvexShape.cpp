@@ -27,6 +27,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/ConvexShape.hpp>
 
+#include <algorithm>
+
 #include <cassert>
 
 
@@ -70,4 +72,11 @@ Vector2f ConvexShape::getPoint(std::size_t index) const
     return m_points[index];
 }
 
+
+////////////////////////////////////////////////////////////
+void ConvexShape::getPoints(Vector2f* points) const
+{
+    std::copy(m_points.begin(), m_points.end(), points);
+}
+
 } // namespace sf
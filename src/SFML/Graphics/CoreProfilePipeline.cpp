@@ -0,0 +1,499 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreProfilePipeline.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(GL_MAJOR_VERSION)
+#define GL_MAJOR_VERSION 0x821B
+#endif
+
+#if !defined(GL_MINOR_VERSION)
+#define GL_MINOR_VERSION 0x821C
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CoreProfilePipelineImpl
+{
+// Vertex attribute locations, bound before the program is linked
+constexpr GLuint positionLocation  = 0;
+constexpr GLuint colorLocation     = 1;
+constexpr GLuint texCoordsLocation = 2;
+
+// Locations of the per-instance attributes, only read by instanced draws
+constexpr GLuint instanceRowLocation   = 3; // The three rows of the matrix use consecutive locations
+constexpr GLuint instanceColorLocation = 6;
+
+// Transforms the vertices like the fixed-function pipeline does with its matrix stacks,
+// instanced draws first apply the transform and color of their instance
+constexpr const char* vertexSource = R"(#version 150
+uniform mat4 sf_projection;
+uniform mat4 sf_modelView;
+uniform mat4 sf_textureMatrix;
+uniform bool sf_instanced;
+in vec2 sf_position;
+in vec4 sf_color;
+in vec2 sf_texCoords;
+in vec3 sf_instanceRow0;
+in vec3 sf_instanceRow1;
+in vec3 sf_instanceRow2;
+in vec4 sf_instanceColor;
+out vec4 sf_vertexColor;
+out vec2 sf_vertexTexCoords;
+void main()
+{
+    vec4 position = vec4(sf_position, 0.0, 1.0);
+    sf_vertexColor = sf_color;
+    if (sf_instanced)
+    {
+        vec3 point = vec3(sf_position, 1.0);
+        position = vec4(dot(sf_instanceRow0, point), dot(sf_instanceRow1, point), 0.0, dot(sf_instanceRow2, point));
+        sf_vertexColor *= sf_instanceColor;
+    }
+    gl_Position = sf_projection * sf_modelView * position;
+    sf_vertexTexCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;
+})";
+
+// Modulates the vertex color by the texture, if any, like GL_MODULATE does
+constexpr const char* fragmentSource = R"(#version 150
+uniform sampler2D sf_texture;
+uniform bool sf_textured;
+in vec4 sf_vertexColor;
+in vec2 sf_vertexTexCoords;
+out vec4 sf_fragColor;
+void main()
+{
+    sf_fragColor = sf_textured ? sf_vertexColor * texture(sf_texture, sf_vertexTexCoords) : sf_vertexColor;
+})";
+
+// clang-format off
+constexpr std::array<float, 16> identity = {1.f, 0.f, 0.f, 0.f,
+                                            0.f, 1.f, 0.f, 0.f,
+                                            0.f, 0.f, 1.f, 0.f,
+                                            0.f, 0.f, 0.f, 1.f};
+// clang-format on
+
+// Mutex to protect the context-pipeline map
+std::mutex& getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// What we know about the pipeline of a given context
+struct ContextPipeline
+{
+    std::weak_ptr<void>            lifetime;   //!< Expires when the context is destroyed
+    sf::priv::CoreProfilePipeline* pipeline{}; //!< Pipeline of the context, null if it has a fixed-function pipeline
+};
+
+// Map to find the pipeline owned by a given context
+using ContextPipelineMap = std::unordered_map<std::uint64_t, ContextPipeline>;
+ContextPipelineMap& getContextPipelineMap()
+{
+    static ContextPipelineMap contextPipelineMap;
+    return contextPipelineMap;
+}
+
+// Gives access to the registration of objects tied to the lifetime of a context
+struct UnsharedObjectRegistry : sf::GlResource
+{
+    static void add(std::shared_ptr<void> object)
+    {
+        registerUnsharedGlObject(std::move(object));
+    }
+};
+
+// Check whether the active context lacks the fixed-function pipeline
+bool isCoreProfile()
+{
+    if (!GLEXT_core_profile)
+        return false;
+
+    // Clear any pending error so that we can detect unsupported queries
+    while (glGetError() != GL_NO_ERROR)
+        ;
+
+    GLint majorVersion = 0;
+    GLint minorVersion = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+
+    // Contexts older than 3.0 don't support the query and are never core profile
+    if ((glGetError() == GL_INVALID_ENUM) || (majorVersion < 3) || ((majorVersion == 3) && (minorVersion < 2)))
+        return false;
+
+    GLint profileMask = 0;
+    glCheck(glGetIntegerv(GLEXT_core_GL_CONTEXT_PROFILE_MASK, &profileMask));
+
+    return (profileMask & GLEXT_core_GL_CONTEXT_CORE_PROFILE_BIT) != 0;
+}
+
+// Compile a shader of the built-in program, returns 0 on failure
+GLuint compileShader(GLenum type, const char* source)
+{
+    GLuint shader = 0;
+    glCheck(shader = GLEXT_core_glCreateShader(type));
+    glCheck(GLEXT_core_glShaderSource(shader, 1, &source, nullptr));
+    glCheck(GLEXT_core_glCompileShader(shader));
+
+    GLint success = 0;
+    glCheck(GLEXT_core_glGetShaderiv(shader, GLEXT_core_GL_COMPILE_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        GLint logLength = 0;
+        glCheck(GLEXT_core_glGetShaderiv(shader, GLEXT_core_GL_INFO_LOG_LENGTH, &logLength));
+
+        std::string log(static_cast<std::size_t>(std::max(logLength, 1)), '\0');
+        glCheck(GLEXT_core_glGetShaderInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+
+        sf::err() << "Failed to compile " << (type == GLEXT_core_GL_VERTEX_SHADER ? "vertex" : "fragment")
+                  << " shader of the core profile pipeline:" << '\n'
+                  << log.c_str() << std::endl;
+
+        glCheck(GLEXT_core_glDeleteShader(shader));
+        return 0;
+    }
+
+    return shader;
+}
+} // namespace CoreProfilePipelineImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+CoreProfilePipeline::CoreProfilePipeline() :
+m_projection(CoreProfilePipelineImpl::identity),
+m_modelView(CoreProfilePipelineImpl::identity),
+m_textureMatrix(CoreProfilePipelineImpl::identity)
+{
+    using namespace CoreProfilePipelineImpl;
+
+    const GLuint vertexShader   = compileShader(GLEXT_core_GL_VERTEX_SHADER, vertexSource);
+    const GLuint fragmentShader = compileShader(GLEXT_core_GL_FRAGMENT_SHADER, fragmentSource);
+
+    if (vertexShader && fragmentShader)
+    {
+        glCheck(m_program = GLEXT_core_glCreateProgram());
+        glCheck(GLEXT_core_glAttachShader(m_program, vertexShader));
+        glCheck(GLEXT_core_glAttachShader(m_program, fragmentShader));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, positionLocation, "sf_position"));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, colorLocation, "sf_color"));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, texCoordsLocation, "sf_texCoords"));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, instanceRowLocation + 0, "sf_instanceRow0"));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, instanceRowLocation + 1, "sf_instanceRow1"));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, instanceRowLocation + 2, "sf_instanceRow2"));
+        glCheck(GLEXT_core_glBindAttribLocation(m_program, instanceColorLocation, "sf_instanceColor"));
+        glCheck(GLEXT_core_glLinkProgram(m_program));
+
+        GLint success = 0;
+        glCheck(GLEXT_core_glGetProgramiv(m_program, GLEXT_core_GL_LINK_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            GLint logLength = 0;
+            glCheck(GLEXT_core_glGetProgramiv(m_program, GLEXT_core_GL_INFO_LOG_LENGTH, &logLength));
+
+            std::string log(static_cast<std::size_t>(std::max(logLength, 1)), '\0');
+            glCheck(GLEXT_core_glGetProgramInfoLog(m_program, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+
+            err() << "Failed to link the core profile pipeline:" << '\n' << log.c_str() << std::endl;
+
+            glCheck(GLEXT_core_glDeleteProgram(m_program));
+            m_program = 0;
+        }
+    }
+
+    // Attached shaders are kept alive by the program as long as it needs them
+    if (vertexShader)
+        glCheck(GLEXT_core_glDeleteShader(vertexShader));
+    if (fragmentShader)
+        glCheck(GLEXT_core_glDeleteShader(fragmentShader));
+
+    if (!m_program)
+        return;
+
+    glCheck(m_projectionLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_projection"));
+    glCheck(m_modelViewLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_modelView"));
+    glCheck(m_textureMatrixLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_textureMatrix"));
+    glCheck(m_texturedLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_textured"));
+    glCheck(m_instancedLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_instanced"));
+
+    GLint samplerLocation = -1;
+    glCheck(samplerLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_texture"));
+
+    // Uniforms start out zeroed, bring them in line with the cached values
+    glCheck(GLEXT_core_glUseProgram(m_program));
+    glCheck(GLEXT_core_glUniformMatrix4fv(m_projectionLocation, 1, GL_FALSE, m_projection.data()));
+    glCheck(GLEXT_core_glUniformMatrix4fv(m_modelViewLocation, 1, GL_FALSE, m_modelView.data()));
+    glCheck(GLEXT_core_glUniformMatrix4fv(m_textureMatrixLocation, 1, GL_FALSE, m_textureMatrix.data()));
+    glCheck(GLEXT_core_glUniform1i(m_texturedLocation, 0));
+    glCheck(GLEXT_core_glUniform1i(m_instancedLocation, 0));
+    glCheck(GLEXT_core_glUniform1i(samplerLocation, 0));
+
+    // Core profiles require a vertex array object to be bound when drawing
+    glCheck(GLEXT_core_glGenVertexArrays(1, &m_vertexArray));
+    glCheck(GLEXT_core_glBindVertexArray(m_vertexArray));
+    glCheck(GLEXT_core_glEnableVertexAttribArray(positionLocation));
+    glCheck(GLEXT_core_glEnableVertexAttribArray(colorLocation));
+    glCheck(GLEXT_core_glEnableVertexAttribArray(texCoordsLocation));
+}
+
+
+////////////////////////////////////////////////////////////
+CoreProfilePipeline::~CoreProfilePipeline()
+{
+    // Pipelines are only destroyed along with their context, which is active at this point
+    if (m_vertexArray)
+        glCheck(GLEXT_core_glDeleteVertexArrays(1, &m_vertexArray));
+
+    if (m_program)
+        glCheck(GLEXT_core_glDeleteProgram(m_program));
+}
+
+
+////////////////////////////////////////////////////////////
+CoreProfilePipeline* CoreProfilePipeline::getCurrent()
+{
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    if (!contextId)
+        return nullptr;
+
+    // Pipelines live as long as their context, each thread remembers the one of the context it used last
+    thread_local std::pair<std::uint64_t, CoreProfilePipeline*> lastPipeline;
+    if (lastPipeline.first == contextId)
+        return lastPipeline.second;
+
+    const std::lock_guard lock(CoreProfilePipelineImpl::getMutex());
+
+    auto& contextPipelineMap = CoreProfilePipelineImpl::getContextPipelineMap();
+
+    if (const auto it = contextPipelineMap.find(contextId); it != contextPipelineMap.end())
+    {
+        if (!it->second.lifetime.expired())
+        {
+            lastPipeline = {contextId, it->second.pipeline};
+            return lastPipeline.second;
+        }
+    }
+
+    // Forget about the pipelines of contexts that have been destroyed
+    for (auto it = contextPipelineMap.begin(); it != contextPipelineMap.end();)
+    {
+        if (it->second.lifetime.expired())
+            it = contextPipelineMap.erase(it);
+        else
+            ++it;
+    }
+
+    // Make sure that extensions are initialized
+    ensureExtensionsInit();
+
+    // Contexts providing the fixed-function pipeline only get a marker
+    // tied to their lifetime, so that the profile is queried only once
+    std::shared_ptr<void> lifetime;
+    CoreProfilePipeline*  result = nullptr;
+
+    if (CoreProfilePipelineImpl::isCoreProfile())
+    {
+        auto pipeline = std::make_shared<CoreProfilePipeline>();
+
+        if (pipeline->m_program)
+            result = pipeline.get();
+
+        lifetime = std::move(pipeline);
+    }
+    else
+    {
+        lifetime = std::make_shared<bool>();
+    }
+
+    contextPipelineMap[contextId] = {lifetime, result};
+
+    // Register the object with the current context so it is automatically destroyed
+    CoreProfilePipelineImpl::UnsharedObjectRegistry::add(std::move(lifetime));
+
+    lastPipeline = {contextId, result};
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::bind()
+{
+    glCheck(GLEXT_core_glUseProgram(m_program));
+    glCheck(GLEXT_core_glBindVertexArray(m_vertexArray));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setProjectionMatrix(const float* matrix)
+{
+    setMatrix(m_projectionLocation, m_projection, matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setModelViewMatrix(const float* matrix)
+{
+    setMatrix(m_modelViewLocation, m_modelView, matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setTextureMatrix(const float* matrix)
+{
+    setMatrix(m_textureMatrixLocation, m_textureMatrix, matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setTextureEnabled(bool enabled)
+{
+    if (enabled == m_textured)
+        return;
+
+    glCheck(GLEXT_core_glUniform1i(m_texturedLocation, enabled ? 1 : 0));
+    m_textured = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setVertexPointers(std::size_t offset)
+{
+    using namespace CoreProfilePipelineImpl;
+
+    // The array buffer is bound, so the pointers are offsets within it
+    const auto* data = reinterpret_cast<const std::byte*>(offset);
+
+    glCheck(GLEXT_core_glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), data + 0));
+    glCheck(GLEXT_core_glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), data + 8));
+    glCheck(GLEXT_core_glVertexAttribPointer(texCoordsLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), data + 12));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setVertexPointer(Attribute   attribute,
+                                           GLint       componentCount,
+                                           GLenum      type,
+                                           bool        normalized,
+                                           std::size_t stride,
+                                           std::size_t offset)
+{
+    using namespace CoreProfilePipelineImpl;
+
+    static constexpr GLuint locations[] = {positionLocation, colorLocation, texCoordsLocation};
+
+    glCheck(GLEXT_core_glVertexAttribPointer(locations[static_cast<std::size_t>(attribute)],
+                                             componentCount,
+                                             type,
+                                             normalized ? GL_TRUE : GL_FALSE,
+                                             static_cast<GLsizei>(stride),
+                                             reinterpret_cast<const void*>(offset)));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setInstancePointers(std::size_t offset)
+{
+    using namespace CoreProfilePipelineImpl;
+
+    // The array buffer is bound, so the pointers are offsets within it
+    const auto*       data   = reinterpret_cast<const std::byte*>(offset);
+    constexpr GLsizei stride = sizeof(Instance);
+
+    for (GLuint row = 0; row < 3; ++row)
+    {
+        const GLuint location = instanceRowLocation + row;
+        const auto*  rowData  = data + offsetof(Instance, rows) + sizeof(float) * 3 * row;
+        glCheck(GLEXT_core_glEnableVertexAttribArray(location));
+        glCheck(GLEXT_core_glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, stride, rowData));
+        glCheck(GLEXT_glVertexAttribDivisor(location, 1));
+    }
+
+    glCheck(GLEXT_core_glEnableVertexAttribArray(instanceColorLocation));
+    glCheck(GLEXT_core_glVertexAttribPointer(instanceColorLocation,
+                                             4,
+                                             GL_UNSIGNED_BYTE,
+                                             GL_TRUE,
+                                             stride,
+                                             data + offsetof(Instance, color)));
+    glCheck(GLEXT_glVertexAttribDivisor(instanceColorLocation, 1));
+
+    glCheck(GLEXT_core_glUniform1i(m_instancedLocation, 1));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::clearInstancePointers()
+{
+    using namespace CoreProfilePipelineImpl;
+
+    // Disabled arrays aren't read anymore, the buffer they point to can go away
+    for (GLuint location = instanceRowLocation; location <= instanceColorLocation; ++location)
+        glCheck(GLEXT_core_glDisableVertexAttribArray(location));
+
+    glCheck(GLEXT_core_glUniform1i(m_instancedLocation, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfilePipeline::setMatrix(GLint location, std::array<float, 16>& cache, const float* matrix)
+{
+    // Skip the upload if the uniform already holds the matrix
+    if (std::memcmp(cache.data(), matrix, sizeof(float) * cache.size()) == 0)
+        return;
+
+    glCheck(GLEXT_core_glUniformMatrix4fv(location, 1, GL_FALSE, matrix));
+    std::memcpy(cache.data(), matrix, sizeof(float) * cache.size());
+}
+
+} // namespace sf::priv
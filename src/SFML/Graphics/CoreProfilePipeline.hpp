@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <array>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Programmable replacement of the fixed-function pipeline
+///
+/// Core profile contexts don't provide the matrix stacks, the
+/// client-side vertex arrays nor the fixed-function shading
+/// used by sf::RenderTarget. When drawing to such a context,
+/// the render target uses a built-in GLSL program along with
+/// a vertex array object and passes its transforms as uniforms.
+///
+/// Every context owns its own pipeline, which is created the
+/// first time it is requested and destroyed along with the
+/// context.
+///
+////////////////////////////////////////////////////////////
+class CoreProfilePipeline
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertex attributes read by the built-in program
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Attribute
+    {
+        Position,
+        Color,
+        TexCoords
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Per-instance attributes of instanced draws
+    ///
+    /// The rows of the 3x3 matrix of the instance transform are
+    /// applied to the vertices before the model-view matrix,
+    /// and the color modulates the color of the vertices.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instance
+    {
+        std::array<float, 9> rows{}; //!< Rows of the matrix of the instance transform
+        Color                color;  //!< Color of the instance
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The program and vertex array are created in the
+    /// currently active context.
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreProfilePipeline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CoreProfilePipeline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreProfilePipeline(const CoreProfilePipeline&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreProfilePipeline& operator=(const CoreProfilePipeline&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pipeline of the currently active context
+    ///
+    /// \return Pointer to the pipeline, or a null pointer if the
+    ///         context provides the fixed-function pipeline
+    ///
+    ////////////////////////////////////////////////////////////
+    static CoreProfilePipeline* getCurrent();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the program and vertex array current
+    ///
+    ////////////////////////////////////////////////////////////
+    void bind();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the projection matrix
+    ///
+    /// \param matrix Column-major 4x4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProjectionMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the model-view matrix
+    ///
+    /// \param matrix Column-major 4x4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setModelViewMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the matrix applied to the texture coordinates
+    ///
+    /// \param matrix Column-major 4x4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable sampling of the bound texture
+    ///
+    /// \param enabled True to modulate the vertex colors by the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the vertex attributes to the bound array buffer
+    ///
+    /// \param offset Offset of the first sf::Vertex within the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexPointers(std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point a vertex attribute to the bound array buffer
+    ///
+    /// \param attribute      Attribute to set up
+    /// \param componentCount Number of components of the attribute
+    /// \param type           OpenGL type of the components
+    /// \param normalized     Are integer components mapped to [0, 1] or [-1, 1]?
+    /// \param stride         Size of a vertex, in bytes
+    /// \param offset         Offset of the attribute of the first vertex within the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexPointer(Attribute   attribute,
+                          GLint       componentCount,
+                          GLenum      type,
+                          bool        normalized,
+                          std::size_t stride,
+                          std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the instance attributes to the bound array buffer
+    ///
+    /// Until clearInstancePointers() is called, the vertices
+    /// are drawn with the transform and color of their instance.
+    ///
+    /// \param offset Offset of the first sf::priv::CoreProfilePipeline::Instance within the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstancePointers(std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Go back to drawing vertices without instance attributes
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearInstancePointers();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a matrix uniform if it changed
+    ///
+    /// \param location Location of the uniform
+    /// \param cache    Last value uploaded to the uniform
+    /// \param matrix   Column-major 4x4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMatrix(GLint location, std::array<float, 16>& cache, const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GLuint                m_program{};                 //!< OpenGL identifier of the program
+    GLuint                m_vertexArray{};             //!< OpenGL identifier of the vertex array object
+    GLint                 m_projectionLocation{-1};    //!< Location of the projection matrix uniform
+    GLint                 m_modelViewLocation{-1};     //!< Location of the model-view matrix uniform
+    GLint                 m_textureMatrixLocation{-1}; //!< Location of the texture matrix uniform
+    GLint                 m_texturedLocation{-1};      //!< Location of the texture switch uniform
+    GLint                 m_instancedLocation{-1};     //!< Location of the instancing switch uniform
+    std::array<float, 16> m_projection{};              //!< Last projection matrix uploaded
+    std::array<float, 16> m_modelView{};               //!< Last model-view matrix uploaded
+    std::array<float, 16> m_textureMatrix{};           //!< Last texture matrix uploaded
+    bool                  m_textured{};                //!< Last texture switch uploaded
+};
+
+} // namespace sf::priv
@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/DynamicResolution.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <string_view>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+namespace DynamicResolutionImpl
+{
+// Scales are multiples of this step, which limits the number of render textures of different sizes
+constexpr float scaleStep = 0.05f;
+
+// Ratio of the target GPU time under which the scale is raised again (avoids oscillating around the target)
+constexpr float headroom = 0.8f;
+
+// Fragment shader upscaling the scene with contrast adaptive sharpening
+constexpr std::string_view upscaleShaderSource = R"(
+uniform sampler2D texture;
+uniform vec2      texelSize;
+uniform float     sharpness;
+
+void main()
+{
+    vec2 position = gl_TexCoord[0].xy;
+    vec4 center   = texture2D(texture, position);
+    vec3 north    = texture2D(texture, position - vec2(0.0, texelSize.y)).rgb;
+    vec3 south    = texture2D(texture, position + vec2(0.0, texelSize.y)).rgb;
+    vec3 west     = texture2D(texture, position - vec2(texelSize.x, 0.0)).rgb;
+    vec3 east     = texture2D(texture, position + vec2(texelSize.x, 0.0)).rgb;
+
+    // Sharpen less where the local contrast is already high, to avoid ringing
+    vec3 minimum = min(center.rgb, min(min(north, south), min(west, east)));
+    vec3 maximum = max(center.rgb, max(max(north, south), max(west, east)));
+    vec3 amount  = sqrt(clamp(min(minimum, 1.0 - maximum) / max(maximum, 0.0001), 0.0, 1.0));
+    vec3 weight  = -amount * mix(0.0, 0.2, sharpness);
+    vec3 color   = (center.rgb + (north + south + west + east) * weight) / (1.0 + 4.0 * weight);
+
+    gl_FragColor = vec4(clamp(color, 0.0, 1.0), center.a) * gl_Color;
+}
+)";
+
+float quantize(float scale)
+{
+    return std::round(scale / scaleStep) * scaleStep;
+}
+} // namespace DynamicResolutionImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+DynamicResolution::DynamicResolution(RenderWindow& window) :
+m_window(window),
+m_profiler(window),
+m_adaptive(GpuProfiler::isAvailable())
+{
+    if (Shader::isAvailable())
+    {
+        m_upscaleShader = Shader::loadFromMemory(DynamicResolutionImpl::upscaleShaderSource, Shader::Type::Fragment);
+        if (m_upscaleShader)
+            m_upscaleShader->setUniform("texture", Shader::CurrentTexture);
+        else
+            err() << "Failed to create the dynamic resolution upscale shader" << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& DynamicResolution::beginFrame()
+{
+    assert(!m_inFrame && "DynamicResolution::beginFrame() The previous frame must be ended first");
+    m_inFrame = true;
+
+    m_profiler.beginScope("Frame");
+
+    if (m_scale < 1.f)
+    {
+        const Vector2f size = Vector2f(m_window.getSize()) * m_scale;
+        const Vector2u sceneSize(static_cast<unsigned int>(std::max(1L, std::lround(size.x))),
+                                 static_cast<unsigned int>(std::max(1L, std::lround(size.y))));
+
+        // The scene needs the same buffers as the window
+        const ContextSettings& windowSettings = m_window.getSettings();
+        ContextSettings        settings;
+        settings.depthBits   = windowSettings.depthBits;
+        settings.stencilBits = windowSettings.stencilBits;
+        settings.sRgbCapable = m_window.isSrgb();
+
+        m_scene = m_pool.acquire(sceneSize, settings);
+        if (m_scene)
+        {
+            m_scene->setSmooth(true);
+            m_scene->setView(m_window.getView());
+            return *m_scene;
+        }
+    }
+
+    return m_window;
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::endFrame()
+{
+    assert(m_inFrame && "DynamicResolution::endFrame() No frame was begun");
+    m_inFrame = false;
+
+    if (m_scene)
+    {
+        upscale();
+        m_pool.release(*m_scene);
+        m_scene = nullptr;
+    }
+
+    m_profiler.endScope();
+    m_profiler.endFrame();
+    m_pool.endFrame();
+
+    if (!m_profiler.getResults().empty())
+        m_lastGpuTime = m_profiler.getResults().front().gpuTime;
+
+    if (m_adaptive)
+        adaptScale();
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::setScale(float scale)
+{
+    const float clamped = std::clamp(scale, m_minScale, m_maxScale);
+    if (clamped != m_scale)
+        m_framesSinceChange = 0;
+
+    m_scale = clamped;
+}
+
+
+////////////////////////////////////////////////////////////
+float DynamicResolution::getScale() const
+{
+    return m_scale;
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::setScaleRange(float minimum, float maximum)
+{
+    assert(minimum > 0.f && minimum <= maximum && "DynamicResolution::setScaleRange() Invalid scale range");
+
+    m_maxScale = std::min(maximum, 1.f);
+    m_minScale = std::min(minimum, m_maxScale);
+    setScale(m_scale);
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::setTargetGpuTime(Time time)
+{
+    m_targetGpuTime = time;
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::setAdaptiveScalingEnabled(bool enabled)
+{
+    m_adaptive = enabled && GpuProfiler::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+bool DynamicResolution::isAdaptiveScalingEnabled() const
+{
+    return m_adaptive;
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::setSharpness(float sharpness)
+{
+    m_sharpness = std::clamp(sharpness, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+Time DynamicResolution::getLastGpuTime() const
+{
+    return m_lastGpuTime;
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::upscale()
+{
+    m_scene->display();
+
+    const Texture& texture   = m_scene->getTexture();
+    const Vector2f sceneSize = Vector2f(texture.getSize());
+
+    Sprite sprite(texture);
+    sprite.setScale(Vector2f(m_window.getSize()).cwiseDiv(sceneSize));
+
+    RenderStates states(BlendNone);
+    if (m_upscaleShader)
+    {
+        m_upscaleShader->setUniform("texelSize", Glsl::Vec2(1.f / sceneSize.x, 1.f / sceneSize.y));
+        m_upscaleShader->setUniform("sharpness", m_sharpness);
+        states.shader = &*m_upscaleShader;
+    }
+
+    // The scene covers the whole window, whatever the viewport of the current view
+    const View view = m_window.getView();
+    m_window.setView(m_window.getDefaultView());
+    m_window.draw(sprite, states);
+    m_window.setView(view);
+}
+
+
+////////////////////////////////////////////////////////////
+void DynamicResolution::adaptScale()
+{
+    // The measurements lag behind: wait until they reflect the last change
+    if (++m_framesSinceChange <= GpuProfiler::getMaxPendingFrames() + 1)
+        return;
+
+    if ((m_lastGpuTime <= Time::Zero) || (m_targetGpuTime <= Time::Zero))
+        return;
+
+    // The GPU time of a fill-bound scene is proportional to its number of pixels
+    const float ratio = m_targetGpuTime / m_lastGpuTime;
+    float       scale = m_scale;
+
+    if (ratio < 1.f)
+        scale = std::min(DynamicResolutionImpl::quantize(m_scale * std::sqrt(ratio)),
+                         m_scale - DynamicResolutionImpl::scaleStep);
+    else if (ratio * DynamicResolutionImpl::headroom > 1.f)
+        scale = std::min(DynamicResolutionImpl::quantize(m_scale * std::sqrt(ratio * DynamicResolutionImpl::headroom)),
+                         m_scale + DynamicResolutionImpl::scaleStep);
+
+    setScale(scale);
+}
+
+} // namespace sf
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ExecutionPolicy.hpp>
+#include <SFML/Graphics/ParallelFor.hpp>
+
+#include <SFML/System/Jobs.hpp>
+
+#include <algorithm>
+#include <thread>
+
+
+namespace
+{
+namespace ExecutionPolicyImpl
+{
+// Below this amount of bytes per range, the cost of starting a job outweighs the gain
+constexpr std::size_t minBytesPerRange = 1024 * 1024;
+} // namespace ExecutionPolicyImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void forEachRange(ExecutionPolicy                                      policy,
+                  std::size_t                                          itemCount,
+                  std::size_t                                          itemSize,
+                  const std::function<void(std::size_t, std::size_t)>& function)
+{
+    std::size_t rangeCount = 1;
+
+    if (policy == ExecutionPolicy::Parallel)
+    {
+        const std::size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const std::size_t maxRanges       = std::min(hardwareThreads, std::max(itemCount, std::size_t{1}));
+        const std::size_t worthyRanges    = itemCount * itemSize / ExecutionPolicyImpl::minBytesPerRange;
+        rangeCount                        = std::clamp(worthyRanges, std::size_t{1}, maxRanges);
+    }
+
+    if (rangeCount == 1)
+    {
+        if (itemCount > 0)
+            function(0, itemCount);
+        return;
+    }
+
+    // Spread the items evenly
+    const std::size_t itemsPerRange = (itemCount + rangeCount - 1) / rangeCount;
+    rangeCount                      = (itemCount + itemsPerRange - 1) / itemsPerRange;
+
+    const auto runRange = [&](std::size_t range)
+    {
+        const std::size_t begin = range * itemsPerRange;
+        function(begin, std::min(begin + itemsPerRange, itemCount));
+    };
+
+    runJobs(rangeCount, runRange);
+}
+
+} // namespace sf::priv
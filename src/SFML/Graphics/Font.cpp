@@ -26,13 +26,20 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/GlyphAtlas.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
 #endif
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/Jobs.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/ProfileZone.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <ft2build.h>
@@ -41,12 +48,29 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include FT_MODULE_H
 
+#ifdef SFML_USE_HARFBUZZ
+#include <hb-ft.h>
+#include <hb.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 
 
@@ -86,6 +110,381 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
+
+// Flags used to load the glyphs, hinting must be the same for rasterization and shaping
+constexpr FT_Int32 loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+
+// Strength of the emboldening of bold glyphs, which also widens their advance
+constexpr FT_Pos boldWeight = 1 << 6;
+
+// Padding left around glyphs, so that filtering doesn't pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Minimum number of glyphs for preloading to be worth spreading over worker threads
+constexpr std::size_t minGlyphsPerThread = 16;
+
+// Get the maximum size of a glyph page texture
+unsigned int getTextureSizeLimit(unsigned int maximumTextureSize)
+{
+    const unsigned int maximumSize = sf::Texture::getMaximumSize();
+    return maximumTextureSize ? std::min(maximumTextureSize, maximumSize) : maximumSize;
+}
+
+// Place a rasterized glyph at the given position of its page texture, given the top-left corner of its padding
+void moveGlyph(sf::Glyph& glyph, const sf::Vector2i& position)
+{
+    glyph.textureRect.left = position.x + static_cast<int>(glyphPadding);
+    glyph.textureRect.top  = position.y + static_cast<int>(glyphPadding);
+}
+
+// Reference character size of the glyphs rendered as distance fields
+constexpr unsigned int distanceFieldSize = 64;
+
+// Distance from the edge of a glyph, in pixels, covered by the values of a distance field
+// (this also bounds the thickness of the outlines derived from the distance fields)
+constexpr unsigned int distanceFieldSpread = 8;
+
+// Fragment shader rendering distance field glyphs, moving the edge outwards by the outline distance
+constexpr std::string_view distanceFieldShaderSource = R"(
+uniform sampler2D texture;
+uniform float outline;
+
+void main()
+{
+    float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+    float width    = fwidth(distance);
+    float edge     = 0.5 - outline;
+    float alpha    = smoothstep(edge - width, edge + width, distance);
+    gl_FragColor   = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Compute the squared distance of the cells of a line to the nearest seed, given the squared distances of the cells
+// (Felzenszwalb and Huttenlocher's distance transform of sampled functions)
+void transformLine(float*                    line,
+                   std::size_t               stride,
+                   std::size_t               count,
+                   std::vector<float>&       values,
+                   std::vector<float>&       bounds,
+                   std::vector<std::size_t>& parabolas)
+{
+    const auto square = [](std::size_t value) { return static_cast<float>(value * value); };
+
+    for (std::size_t i = 0; i < count; ++i)
+        values[i] = line[i * stride];
+
+    // Compute the lower envelope of the parabolas rooted at each cell
+    std::size_t k = 0;
+    parabolas[0]  = 0;
+    bounds[0]     = -std::numeric_limits<float>::infinity();
+    bounds[1]     = std::numeric_limits<float>::infinity();
+
+    for (std::size_t q = 1; q < count; ++q)
+    {
+        // The first bound is minus infinity, so this stops at the first parabola at the latest
+        float intersection = 0;
+        for (;;)
+        {
+            const std::size_t p = parabolas[k];
+            intersection = ((values[q] + square(q)) - (values[p] + square(p))) / (2 * static_cast<float>(q - p));
+            if (intersection > bounds[k])
+                break;
+            --k;
+        }
+
+        ++k;
+        parabolas[k]  = q;
+        bounds[k]     = intersection;
+        bounds[k + 1] = std::numeric_limits<float>::infinity();
+    }
+
+    // Sample the lower envelope
+    k = 0;
+    for (std::size_t q = 0; q < count; ++q)
+    {
+        while (bounds[k + 1] < static_cast<float>(q))
+            ++k;
+
+        const std::size_t p = parabolas[k];
+        line[q * stride]    = square(q > p ? q - p : p - q) + values[p];
+    }
+}
+
+// Compute the squared distance of every cell of a grid to the nearest cell of the given state
+std::vector<float> transformGrid(const std::vector<bool>& inside, bool seedState, const sf::Vector2u& size)
+{
+    // Distances are bounded by the size of the grid, which keeps the computations finite
+    const float infinity = static_cast<float>(std::uint64_t{size.x} * size.x + std::uint64_t{size.y} * size.y) + 1;
+
+    std::vector<float> distances(inside.size());
+    for (std::size_t i = 0; i < inside.size(); ++i)
+        distances[i] = (inside[i] == seedState) ? 0.f : infinity;
+
+    const std::size_t        length = std::max(size.x, size.y);
+    std::vector<float>       values(length);
+    std::vector<float>       bounds(length + 1);
+    std::vector<std::size_t> parabolas(length);
+
+    for (std::size_t x = 0; x < size.x; ++x)
+        transformLine(&distances[x], size.x, size.y, values, bounds, parabolas);
+
+    for (std::size_t y = 0; y < size.y; ++y)
+        transformLine(&distances[y * size.x], 1, size.x, values, bounds, parabolas);
+
+    return distances;
+}
+
+// Compute a distance field from the coverage of a rasterized glyph, extended by the spread on every side
+std::vector<std::uint8_t> computeDistanceField(const FT_Bitmap& bitmap)
+{
+    const unsigned int spread = distanceFieldSpread;
+    const sf::Vector2u size(bitmap.width + 2 * spread, bitmap.rows + 2 * spread);
+
+    // Threshold the coverage of the glyph
+    std::vector<bool> inside(std::size_t{size.x} * size.y);
+    for (unsigned int y = 0; y < bitmap.rows; ++y)
+    {
+        const std::uint8_t* row = bitmap.buffer + static_cast<std::ptrdiff_t>(y) * bitmap.pitch;
+        for (unsigned int x = 0; x < bitmap.width; ++x)
+        {
+            const bool filled = (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) ? (row[x / 8] & (1 << (7 - (x % 8)))) != 0
+                                                                          : row[x] >= 128;
+            inside[(x + spread) + (y + spread) * size.x] = filled;
+        }
+    }
+
+    const std::vector<float> distancesToInside  = transformGrid(inside, true, size);
+    const std::vector<float> distancesToOutside = transformGrid(inside, false, size);
+
+    // Map the signed distances to the edge, positive inside, to [0, 255] with the edge at 128
+    std::vector<std::uint8_t> distances(inside.size());
+    for (std::size_t i = 0; i < distances.size(); ++i)
+    {
+        const float distance = inside[i] ? std::sqrt(distancesToOutside[i]) - 0.5f
+                                         : 0.5f - std::sqrt(distancesToInside[i]);
+        const float value    = 128.f + distance / static_cast<float>(spread) * 128.f;
+        distances[i]         = static_cast<std::uint8_t>(std::clamp(value, 0.f, 255.f));
+    }
+
+    return distances;
+}
+
+// Rasterize the glyph of a code point with the current size of a face
+// The pixels are stored with a transparent padding around them, size is left to 0 if the glyph has no pixels
+bool rasterizeGlyph(FT_Library                 library,
+                    FT_Face                    face,
+                    FT_Stroker                 stroker,
+                    FT_UInt                    glyphIndex,
+                    bool                       bold,
+                    float                      outlineThickness,
+                    bool                       distanceField,
+                    sf::Glyph&                 glyph,
+                    std::vector<std::uint8_t>& pixelBuffer,
+                    sf::Vector2u&              size)
+{
+    // Load the glyph
+    FT_Int32 flags = loadFlags;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Glyph(face, glyphIndex, flags) != 0)
+        return false;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return false;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = boldWeight;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
+#if (FREETYPE_MAJOR > 2) || ((FREETYPE_MAJOR == 2) && (FREETYPE_MINOR >= 11))
+    const bool nativeDistanceField = distanceField && outline;
+    if (nativeDistanceField)
+    {
+        FT_Int spread = distanceFieldSpread;
+        FT_Property_Set(library, "sdf", "spread", &spread);
+        renderMode = FT_RENDER_MODE_SDF;
+    }
+#else
+    const bool nativeDistanceField = false;
+#endif
+    FT_Glyph_To_Bitmap(&glyphDesc, renderMode, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        if (outlineThickness != 0)
+            sf::err() << "Failed to outline glyph (no fallback available)" << std::endl;
+    }
+
+    // Compute the glyph's advance offset
+    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    size = {};
+
+    if ((bitmap.width > 0) && (bitmap.rows > 0))
+    {
+        // Describe the 8 bits gray levels or 1 bit monochrome values to extract
+        const std::uint8_t* pixels     = bitmap.buffer;
+        int                 pitch      = bitmap.pitch;
+        bool                monochrome = (bitmap.pixel_mode == FT_PIXEL_MODE_MONO);
+        sf::Vector2u        pixelsSize(bitmap.width, bitmap.rows);
+        sf::Vector2i        offset(bitmapGlyph->left, -bitmapGlyph->top);
+
+        // Compute the distance field from the coverage if FreeType couldn't render it directly
+        std::vector<std::uint8_t> distances;
+        if (distanceField && !nativeDistanceField)
+        {
+            const auto spread = static_cast<int>(distanceFieldSpread);
+
+            distances  = computeDistanceField(bitmap);
+            pixelsSize = {bitmap.width + 2 * distanceFieldSpread, bitmap.rows + 2 * distanceFieldSpread};
+            offset     = offset - sf::Vector2i(spread, spread);
+            pixels     = distances.data();
+            pitch      = static_cast<int>(pixelsSize.x);
+            monochrome = false;
+        }
+
+        const unsigned int padding = glyphPadding;
+        const unsigned int width   = pixelsSize.x + 2 * padding;
+        const unsigned int height  = pixelsSize.y + 2 * padding;
+
+        size = {width, height};
+
+        // Compute the glyph's bounding box and the size of its texture rectangle
+        glyph.textureRect   = sf::IntRect({0, 0}, sf::Vector2i(pixelsSize));
+        glyph.bounds.left   = static_cast<float>(offset.x);
+        glyph.bounds.top    = static_cast<float>(offset.y);
+        glyph.bounds.width  = static_cast<float>(pixelsSize.x);
+        glyph.bounds.height = static_cast<float>(pixelsSize.y);
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+
+        std::uint8_t* current = pixelBuffer.data();
+        std::uint8_t* end     = current + width * height * 4;
+
+        while (current != end)
+        {
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 0;
+        }
+
+        // Extract the glyph's pixels from the bitmap
+        if (monochrome)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = padding; y < height - padding; ++y)
+            {
+                for (unsigned int x = padding; x < width - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index = x + y * width;
+                    pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
+                }
+                pixels += pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bits gray levels
+            for (unsigned int y = padding; y < height - padding; ++y)
+            {
+                for (unsigned int x = padding; x < width - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index    = x + y * width;
+                    pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                }
+                pixels += pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return true;
+}
+
+// Set the character size of a face, if it isn't already the current one
+bool setFaceSize(FT_Face face, unsigned int characterSize)
+{
+    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
+    // only when necessary to avoid killing performances
+    const FT_UShort currentSize = face->size->metrics.x_ppem;
+
+    if (currentSize != characterSize)
+    {
+        const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
+
+        if (result == FT_Err_Invalid_Pixel_Size)
+        {
+            // In the case of bitmap fonts, resizing can
+            // fail if the requested size is not available
+            if (!FT_IS_SCALABLE(face))
+            {
+                sf::err() << "Failed to set bitmap font size to " << characterSize << '\n' << "Available sizes are: ";
+                for (int i = 0; i < face->num_fixed_sizes; ++i)
+                {
+                    const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
+                    sf::err() << size << " ";
+                }
+                sf::err() << std::endl;
+            }
+            else
+            {
+                sf::err() << "Failed to set font size to " << characterSize << std::endl;
+            }
+        }
+
+        return result == FT_Err_Ok;
+    }
+
+    return true;
+}
+
+// Get a new identifier for the glyphs and metrics of a font
+std::uint64_t getFontId()
+{
+    static std::atomic<std::uint64_t> id(1);
+    return id.fetch_add(1, std::memory_order_relaxed);
+}
 } // namespace
 
 
@@ -94,7 +493,10 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct Font::FontHandles
 {
-    FontHandles() = default;
+    FontHandles()
+    {
+        latinIndices.fill(unknownIndex);
+    }
 
     ~FontHandles()
     {
@@ -102,6 +504,14 @@ struct Font::FontHandles
         // The documentation of FreeType isn't clear on the matter, but the
         // implementation does explicitly check for null.
 
+#ifdef SFML_USE_HARFBUZZ
+        // The HarfBuzz font holds a reference to the face
+        if (shaper)
+            hb_font_destroy(shaper);
+#endif
+
+        // The clones and the face read the mapped file, which is unmapped after them
+        clones.clear();
         FT_Stroker_Done(stroker);
         FT_Done_Face(face);
         // `streamRec` doesn't need to be explicitly freed.
@@ -116,10 +526,149 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
+    // Library, face and stroker of their own, so that a thread can rasterize glyphs without synchronization
+    struct FaceClone
+    {
+        FaceClone() = default;
+
+        ~FaceClone()
+        {
+            FT_Stroker_Done(stroker);
+            FT_Done_Face(face);
+            FT_Done_FreeType(library);
+        }
+
+        FaceClone(const FaceClone&)            = delete;
+        FaceClone& operator=(const FaceClone&) = delete;
+
+        FT_Library library{}; //< Library owning the face and the stroker
+        FT_Face    face{};    //< Face opened on the font data
+        FT_Stroker stroker{}; //< Stroker outlining the glyphs
+    };
+
+    // Take an idle clone of the face, or open a new one; returns null if the font data can't be read by several faces
+    std::unique_ptr<FaceClone> acquireClone()
+    {
+        if (!openFace)
+            return nullptr;
+
+        {
+            const std::lock_guard lock(cloneMutex);
+            if (!clones.empty())
+            {
+                std::unique_ptr<FaceClone> clone = std::move(clones.back());
+                clones.pop_back();
+                return clone;
+            }
+        }
+
+        auto clone = std::make_unique<FaceClone>();
+        if ((FT_Init_FreeType(&clone->library) != 0) || (openFace(clone->library, &clone->face) != 0) ||
+            (FT_Select_Charmap(clone->face, FT_ENCODING_UNICODE) != 0) ||
+            (FT_Stroker_New(clone->library, &clone->stroker) != 0))
+            return nullptr;
+
+        return clone;
+    }
+
+    // Give a clone back, to be reused by the next preloading
+    void releaseClone(std::unique_ptr<FaceClone>&& clone)
+    {
+        const std::lock_guard lock(cloneMutex);
+        clones.push_back(std::move(clone));
+    }
+
+    static constexpr FT_UInt       unknownIndex   = std::numeric_limits<FT_UInt>::max();
+    static constexpr std::uint32_t emptyCodePoint = std::numeric_limits<std::uint32_t>::max();
+
+    struct CharIndex
+    {
+        std::uint32_t codePoint{emptyCodePoint}; //< Code point, or emptyCodePoint for a free slot
+        FT_UInt       index{};                   //< Index of the glyph in the face
+    };
+
+    static std::size_t hashCodePoint(std::uint32_t codePoint)
+    {
+        return static_cast<std::size_t>(codePoint * 2654435761u);
+    }
+
+    // The slot of the code point must be free
+    void insertCharIndex(const CharIndex& entry)
+    {
+        const std::size_t mask = otherIndices.size() - 1;
+        std::size_t       i    = hashCodePoint(entry.codePoint) & mask;
+        while (otherIndices[i].codePoint != emptyCodePoint)
+            i = (i + 1) & mask;
+
+        otherIndices[i] = entry;
+        ++otherCount;
+    }
+
+    // Get the index of the glyph of a code point in the face, querying FreeType only the first time
+    FT_UInt getCharIndex(std::uint32_t codePoint)
+    {
+        // Latin-1 characters, by far the most common, are looked up directly
+        if (codePoint < latinIndices.size())
+        {
+            if (latinIndices[codePoint] == unknownIndex)
+                latinIndices[codePoint] = FT_Get_Char_Index(face, codePoint);
+            return latinIndices[codePoint];
+        }
+
+        // Other characters are stored in an open addressing table with linear probing
+        if (!otherIndices.empty())
+        {
+            const std::size_t mask = otherIndices.size() - 1;
+            for (std::size_t i = hashCodePoint(codePoint) & mask;; i = (i + 1) & mask)
+            {
+                if (otherIndices[i].codePoint == codePoint)
+                    return otherIndices[i].index;
+                if (otherIndices[i].codePoint == emptyCodePoint)
+                    break;
+            }
+        }
+
+        const FT_UInt index = FT_Get_Char_Index(face, codePoint);
+
+        // Keep the table at most half full, so that probing sequences stay short
+        if ((otherCount + 1) * 2 > otherIndices.size())
+        {
+            std::vector<CharIndex> oldIndices(std::max<std::size_t>(otherIndices.size() * 2, 64));
+            oldIndices.swap(otherIndices);
+            otherCount = 0;
+            for (const CharIndex& entry : oldIndices)
+            {
+                if (entry.codePoint != emptyCodePoint)
+                    insertCharIndex(entry);
+            }
+        }
+
+        insertCharIndex({codePoint, index});
+        return index;
+    }
+
+    MappedFileInputStream                         file;           //< Mapped font file, if loaded from a file
+    FT_Library                                    library{};      //< Pointer to the internal library interface
+    FT_StreamRec                                  streamRec{};    //< Stream rec object describing an input stream
+    FT_Face                                       face{};         //< Pointer to the internal font face
+    FT_Stroker                                    stroker{};      //< Pointer to the stroker
+    std::function<FT_Error(FT_Library, FT_Face*)> openFace;       //< Opens another face on the font data, if possible
+    std::array<FT_UInt, 256>                      latinIndices{}; //< Glyph indices of the Latin-1 code points
+    std::vector<CharIndex>                        otherIndices;   //< Glyph indices of the other code points
+    std::size_t                                   otherCount{};   //< Number of code points in otherIndices
+    std::mutex                                    cloneMutex;     //< Mutex protecting the idle clones
+    std::vector<std::unique_ptr<FaceClone>>       clones;         //< Idle clones of the face, kept for reuse
+#ifdef SFML_USE_HARFBUZZ
+    hb_font_t* shaper{}; //< HarfBuzz font shaping with the face, created on first use
+#endif
+};
+
+
+////////////////////////////////////////////////////////////
+struct Font::DistanceFieldShader
+{
+    Shader shader;    //< Shader rendering distance field glyphs
+    float  outline{}; //< Value of the outline uniform, in distance field units
 };
 
 
@@ -127,6 +676,7 @@ struct Font::FontHandles
 Font::Font(std::shared_ptr<FontHandles>&& fontHandles, std::string&& familyName) : m_fontHandles(std::move(fontHandles))
 {
     m_info.family = std::move(familyName);
+    m_id          = getFontId();
 }
 
 
@@ -146,14 +696,26 @@ std::optional<Font> Font::loadFromFile(const std::filesystem::path& filename)
         return std::nullopt;
     }
 
-    // Load the new font face from the specified file
-    FT_Face face = nullptr;
-    if (FT_New_Face(fontHandles->library, filename.string().c_str(), 0, &face) != 0)
+    // Map the file, so that FreeType reads the glyphs straight from the operating system's file cache
+    // instead of issuing small reads through a stream
+    if (!fontHandles->file.open(filename))
+    {
+        err() << "Failed to load font (failed to open the file)\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    // Load the new font face from the mapped file
+    const auto* data = static_cast<const FT_Byte*>(fontHandles->file.getData());
+    const auto  size = static_cast<FT_Long>(fontHandles->file.getSize());
+    FT_Face     face = nullptr;
+    if (FT_New_Memory_Face(fontHandles->library, data, size, 0, &face) != 0)
     {
         err() << "Failed to load font (failed to create the font face)\n" << formatDebugPathInfo(filename) << std::endl;
         return std::nullopt;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->openFace = [data, size](FT_Library library, FT_Face* otherFace)
+    { return FT_New_Memory_Face(library, data, size, 0, otherFace); };
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -209,7 +771,15 @@ std::optional<Font> Font::loadFromMemory(const void* data, std::size_t sizeInByt
         err() << "Failed to load font from memory (failed to create the font face)" << std::endl;
         return std::nullopt;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->openFace = [data, sizeInBytes](FT_Library library, FT_Face* otherFace)
+    {
+        return FT_New_Memory_Face(library,
+                                  reinterpret_cast<const FT_Byte*>(data),
+                                  static_cast<FT_Long>(sizeInBytes),
+                                  0,
+                                  otherFace);
+    };
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -232,6 +802,13 @@ std::optional<Font> Font::loadFromMemory(const void* data, std::size_t sizeInByt
 ////////////////////////////////////////////////////////////
 std::optional<Font> Font::loadFromStream(InputStream& stream)
 {
+    // Streams that read from memory are handed to FreeType directly, instead of going through the read callback
+    if (const void* data = getStreamData(stream))
+    {
+        if (const std::int64_t size = stream.getSize(); size > 0)
+            return loadFromMemory(data, static_cast<std::size_t>(size));
+    }
+
     auto fontHandles = std::make_shared<FontHandles>();
 
     // Initialize FreeType
@@ -303,24 +880,243 @@ const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
 {
     assert(m_fontHandles);
 
+    return getGlyphFromIndex(m_fontHandles->getCharIndex(codePoint), characterSize, bold, outlineThickness);
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getGlyphFromIndex(std::uint32_t glyphIndex,
+                                     unsigned int  characterSize,
+                                     bool          bold,
+                                     float         outlineThickness) const
+{
+    updateGlyphAtlas();
+
+    if (!m_isDistanceField)
+        return getPageGlyph(glyphIndex, characterSize, bold, outlineThickness);
+
+    // Distance field glyphs are all rendered at the reference size, only their metrics are scaled
+    const std::uint64_t key = combine(outlineThickness, bold, glyphIndex);
+
+    if (const auto sizeIt = m_distanceFieldGlyphs.find(characterSize); sizeIt != m_distanceFieldGlyphs.end())
+    {
+        if (const auto it = sizeIt->second.find(key); it != sizeIt->second.end())
+            return it->second.glyph;
+    }
+
+    const float scale = static_cast<float>(characterSize) / static_cast<float>(distanceFieldSize);
+    Glyph glyph = getPageGlyph(glyphIndex, distanceFieldSize, bold, (scale > 0) ? outlineThickness / scale : 0);
+
+    glyph.advance *= scale;
+    glyph.bounds   = FloatRect(glyph.bounds.getPosition() * scale, glyph.bounds.getSize() * scale);
+    glyph.lsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.lsbDelta) * scale));
+    glyph.rsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.rsbDelta) * scale));
+
+    // Loading the glyph may have evicted glyphs from the page, and thus cleared the scaled glyphs
+    GlyphTable&  scaledGlyphs = m_distanceFieldGlyphs[characterSize];
+    const Glyph& scaledGlyph  = scaledGlyphs.emplace(key, CachedGlyph{glyph}).first->second.glyph;
+    updateMemoryUsage();
+    return scaledGlyph;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getPageGlyph(std::uint32_t glyphIndex,
+                                unsigned int  characterSize,
+                                bool          bold,
+                                float         outlineThickness) const
+{
     // Get the page corresponding to the character size
-    GlyphTable& glyphs = loadPage(characterSize).glyphs;
+    Page&       page   = loadPage(characterSize);
+    GlyphTable& glyphs = page.glyphs;
+
+    // Build the key by combining the glyph index, bold flag, and outline thickness
+    const std::uint64_t key = combine(outlineThickness, bold, glyphIndex);
+
+    // Search the glyph into the cache
+    if (const auto it = glyphs.find(key); it != glyphs.end())
+    {
+        // Found: mark it as used and return it
+        it->second.lastUse = ++page.useCount;
+        return it->second.glyph;
+    }
+    else
+    {
+        // Not found: we have to load it
+        const Glyph  glyph  = loadGlyph(glyphIndex, characterSize, bold, outlineThickness);
+        const Glyph& cached = glyphs.emplace(key, CachedGlyph{glyph, ++page.useCount}).first->second.glyph;
+        updateMemoryUsage();
+        return cached;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::preloadGlyphs(std::u32string_view characters,
+                         unsigned int        characterSize,
+                         bool                bold,
+                         float               outlineThickness) const
+{
+    assert(m_fontHandles);
+
+    // Distance field glyphs are all rendered at the reference size, their scaled metrics are computed on demand
+    if (m_isDistanceField)
+    {
+        outlineThickness = (characterSize > 0) ? outlineThickness * static_cast<float>(distanceFieldSize) /
+                                                     static_cast<float>(characterSize)
+                                               : 0;
+        characterSize    = distanceFieldSize;
+    }
+
+    if (!m_fontHandles->face || !setCurrentSize(characterSize))
+        return;
 
-    // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const std::uint64_t key = combine(outlineThickness, bold, FT_Get_Char_Index(m_fontHandles->face, codePoint));
+    updateGlyphAtlas();
+    Page&       page  = loadPage(characterSize);
+    GlyphAtlas& atlas = getPageAtlas(page);
+
+    // Gather the glyphs that are not loaded yet
+    struct PendingGlyph
+    {
+        std::uint64_t             key{};
+        FT_UInt                   glyphIndex{};
+        Glyph                     glyph;
+        Vector2u                  size;
+        std::vector<std::uint8_t> pixels;
+    };
+
+    std::vector<PendingGlyph>         pending;
+    std::unordered_set<std::uint64_t> pendingKeys;
+    for (const char32_t character : characters)
+    {
+        const FT_UInt       glyphIndex = m_fontHandles->getCharIndex(static_cast<std::uint32_t>(character));
+        const std::uint64_t key        = combine(outlineThickness, bold, glyphIndex);
+
+        if ((page.glyphs.find(key) == page.glyphs.end()) && pendingKeys.insert(key).second)
+            pending.push_back({key, glyphIndex, {}, {}, {}});
+    }
+
+    if (pending.empty())
+        return;
+
+    // Rasterize the glyphs, every job taking the next glyph not handled yet
+    std::atomic<std::size_t> nextGlyph{0};
+    const auto rasterizeGlyphs = [&](FT_Library library, FT_Face face, FT_Stroker stroker)
+    {
+        for (std::size_t i = nextGlyph++; i < pending.size(); i = nextGlyph++)
+        {
+            PendingGlyph& entry = pending[i];
+            if (!rasterizeGlyph(library,
+                                face,
+                                stroker,
+                                entry.glyphIndex,
+                                bold,
+                                outlineThickness,
+                                m_isDistanceField,
+                                entry.glyph,
+                                entry.pixels,
+                                entry.size))
+                entry.glyph = {};
+        }
+    };
+
+    // FreeType faces can't be shared between threads, so every job borrows a clone of the face,
+    // which is only possible if the font data can be read by several faces
+    std::size_t threadCount = 0;
+    if (m_fontHandles->openFace)
+        threadCount = std::min<std::size_t>(std::thread::hardware_concurrency(), pending.size() / minGlyphsPerThread);
+
+    // The first job uses the font's own face, which is safe since the calling thread waits for all of them
+    priv::runJobs(std::max(threadCount, std::size_t{1}),
+                  [&](std::size_t job)
+                  {
+                      if (job == 0)
+                      {
+                          rasterizeGlyphs(m_fontHandles->library, m_fontHandles->face, m_fontHandles->stroker);
+                          return;
+                      }
+
+                      // If anything fails, the other jobs take care of the glyphs
+                      std::unique_ptr<FontHandles::FaceClone> clone = m_fontHandles->acquireClone();
+                      if (!clone)
+                          return;
+
+                      if (setFaceSize(clone->face, characterSize))
+                          rasterizeGlyphs(clone->library, clone->face, clone->stroker);
+
+                      m_fontHandles->releaseClone(std::move(clone));
+                  });
+
+    // Lay the glyphs out in a single block, tallest first, so that they can be written with a single texture update
+    std::sort(pending.begin(),
+              pending.end(),
+              [](const PendingGlyph& left, const PendingGlyph& right) { return left.size.y > right.size.y; });
+
+    const unsigned int  maximumSize = getTextureSizeLimit(m_glyphAtlas ? atlas.m_maximumSize : m_maximumTextureSize);
+    priv::SkylinePacker layout({atlas.m_texture.getSize().x, maximumSize});
+    std::vector<Rect<unsigned int>> layoutRects;
+    Vector2u                        blockSize;
+    for (const PendingGlyph& entry : pending)
+    {
+        const std::optional<Rect<unsigned int>> rect = layout.insert(entry.size);
+        if (!rect)
+            break;
+
+        layoutRects.push_back(*rect);
+        blockSize.x = std::max(blockSize.x, rect->left + rect->width);
+        blockSize.y = std::max(blockSize.y, rect->top + rect->height);
+    }
+
+    std::optional<IntRect> block;
+    if ((layoutRects.size() == pending.size()) && (blockSize.x > 0) && (blockSize.y > 0))
+        block = findGlyphRect(page, blockSize);
+
+    if (block)
+    {
+        // Compose the block, filled with transparent white pixels between the glyphs
+        std::vector<std::uint8_t> blockPixels(static_cast<std::size_t>(blockSize.x) * blockSize.y * 4, 255);
+        for (std::size_t i = 3; i < blockPixels.size(); i += 4)
+            blockPixels[i] = 0;
+
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            const PendingGlyph&       entry = pending[i];
+            const Rect<unsigned int>& rect  = layoutRects[i];
+            for (unsigned int y = 0; y < entry.size.y; ++y)
+                std::memcpy(&blockPixels[((rect.top + y) * blockSize.x + rect.left) * 4],
+                            &entry.pixels[y * entry.size.x * 4],
+                            entry.size.x * 4);
+        }
+
+        atlas.m_texture.update(blockPixels.data(), blockSize, Vector2u(block->getPosition()));
+    }
+
+    for (std::size_t i = 0; i < pending.size(); ++i)
+    {
+        PendingGlyph& entry = pending[i];
+
+        if ((entry.size.x > 0) && (entry.size.y > 0))
+        {
+            if (block)
+            {
+                moveGlyph(entry.glyph, block->getPosition() + Vector2i(layoutRects[i].getPosition()));
+            }
+            else if (const std::optional<IntRect> rect = findGlyphRect(page, entry.size))
+            {
+                // The glyphs don't fit in a single block, write them one by one
+                moveGlyph(entry.glyph, rect->getPosition());
+                atlas.m_texture.update(entry.pixels.data(), entry.size, Vector2u(rect->getPosition()));
+            }
+            else
+            {
+                entry.glyph.textureRect = {};
+            }
+        }
 
-    // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
-    {
-        // Found: just return it
-        return it->second;
-    }
-    else
-    {
-        // Not found: we have to load it
-        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return glyphs.emplace(key, glyph).first->second;
+        page.glyphs.emplace(entry.key, CachedGlyph{entry.glyph, ++page.useCount});
     }
+
+    updateMemoryUsage();
 }
 
 
@@ -328,7 +1124,7 @@ const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
 bool Font::hasGlyph(std::uint32_t codePoint) const
 {
     assert(m_fontHandles);
-    return FT_Get_Char_Index(m_fontHandles->face, codePoint) != 0;
+    return m_fontHandles->getCharIndex(codePoint) != 0;
 }
 
 
@@ -341,13 +1137,29 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
     if (first == 0 || second == 0)
         return 0.f;
 
+    // Text geometry asks for the kerning of every pair of characters, so it is computed only once per pair
+    KerningTable&       kerning = m_kerningTables[(std::uint64_t{characterSize} << 1) | std::uint64_t{bold}];
+    const std::uint64_t key     = (std::uint64_t{first} << 32) | second;
+
+    if (const auto it = kerning.find(key); it != kerning.end())
+        return it->second;
+
+    const float value = kerning.emplace(key, loadKerning(first, second, characterSize, bold)).first->second;
+    updateMemoryUsage();
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::loadKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const
+{
     FT_Face face = m_fontHandles->face;
 
     if (face && setCurrentSize(characterSize))
     {
         // Convert the characters to indices
-        const FT_UInt index1 = FT_Get_Char_Index(face, first);
-        const FT_UInt index2 = FT_Get_Char_Index(face, second);
+        const FT_UInt index1 = m_fontHandles->getCharIndex(first);
+        const FT_UInt index2 = m_fontHandles->getCharIndex(second);
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
         const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
@@ -374,6 +1186,74 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::shape(std::u32string_view                       text,
+                 unsigned int                              characterSize,
+                 bool                                      bold,
+                 std::vector<TextLayoutCache::ShapedGlyph>& glyphs) const
+{
+    assert(m_fontHandles);
+
+    glyphs.clear();
+    glyphs.reserve(text.size());
+
+#ifdef SFML_USE_HARFBUZZ
+    if (m_fontHandles->face && setCurrentSize(characterSize))
+    {
+        FontHandles& handles = *m_fontHandles;
+        if (!handles.shaper)
+        {
+            handles.shaper = hb_ft_font_create_referenced(handles.face);
+            hb_ft_font_set_load_flags(handles.shaper, loadFlags);
+        }
+
+        // The size of the face may have changed since the last run
+        hb_ft_font_changed(handles.shaper);
+
+        hb_buffer_t* buffer = hb_buffer_create();
+        hb_buffer_add_utf32(buffer,
+                            reinterpret_cast<const std::uint32_t*>(text.data()),
+                            static_cast<int>(text.size()),
+                            0,
+                            static_cast<int>(text.size()));
+        hb_buffer_guess_segment_properties(buffer);
+        hb_shape(handles.shaper, buffer, nullptr, 0);
+
+        unsigned int               count     = 0;
+        const hb_glyph_info_t*     infos     = hb_buffer_get_glyph_infos(buffer, &count);
+        const hb_glyph_position_t* positions = hb_buffer_get_glyph_positions(buffer, &count);
+        const float                extra     = bold ? static_cast<float>(boldWeight) / float{1 << 6} : 0.f;
+
+        // Positions are in 26.6 fixed point, with the Y axis pointing up
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            glyphs.push_back({infos[i].codepoint,
+                              infos[i].cluster,
+                              {static_cast<float>(positions[i].x_offset) / float{1 << 6},
+                               -static_cast<float>(positions[i].y_offset) / float{1 << 6}},
+                              static_cast<float>(positions[i].x_advance) / float{1 << 6} + extra});
+        }
+
+        hb_buffer_destroy(buffer);
+        return;
+    }
+#endif
+
+    // Without a shaper, every character is its own glyph and pairs are spaced by the kerning
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        if (i > 0)
+            glyphs.back().advance += getKerning(text[i - 1], text[i], characterSize, bold);
+
+        const FT_UInt glyphIndex = m_fontHandles->getCharIndex(text[i]);
+        glyphs.push_back({static_cast<std::uint32_t>(glyphIndex),
+                          static_cast<std::uint32_t>(i),
+                          {},
+                          getGlyphFromIndex(glyphIndex, characterSize, bold).advance});
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 float Font::getLineSpacing(unsigned int characterSize) const
 {
@@ -439,7 +1319,10 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 const Texture& Font::getTexture(unsigned int characterSize) const
 {
-    return loadPage(characterSize).texture;
+    updateGlyphAtlas();
+
+    // All the character sizes share the same texture in distance field mode
+    return getPageAtlas(loadPage(m_isDistanceField ? distanceFieldSize : characterSize)).m_texture;
 }
 
 ////////////////////////////////////////////////////////////
@@ -449,9 +1332,11 @@ void Font::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
 
+        // A shared atlas has its own smooth filter
         for (auto& [key, page] : m_pages)
         {
-            page.texture.setSmooth(m_isSmooth);
+            if (page.atlas)
+                page.atlas->setSmooth(m_isSmooth || m_isDistanceField);
         }
     }
 }
@@ -464,324 +1349,338 @@ bool Font::isSmooth() const
 
 
 ////////////////////////////////////////////////////////////
-Font::Page& Font::loadPage(unsigned int characterSize) const
+void Font::setMaximumTextureSize(unsigned int size)
 {
-    auto page = Page::make(m_isSmooth);
-    assert(page && "Font::loadPage() Failed to load page");
-    return m_pages.try_emplace(characterSize, std::move(*page)).first->second;
+    m_maximumTextureSize = size;
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+unsigned int Font::getMaximumTextureSize() const
 {
-    // The glyph to return
-    Glyph glyph;
+    return m_maximumTextureSize;
+}
 
-    // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
-    if (!face)
-        return glyph;
 
-    // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
+////////////////////////////////////////////////////////////
+void Font::setGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas)
+{
+    if (atlas != m_glyphAtlas)
+    {
+        m_glyphAtlas      = std::move(atlas);
+        m_atlasGeneration = m_glyphAtlas ? m_glyphAtlas->m_generation : 0;
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
+        // The glyphs loaded so far are stored in the previous textures
+        m_pages.clear();
+        m_distanceFieldGlyphs.clear();
+        updateMemoryUsage();
+    }
+}
 
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
 
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
+////////////////////////////////////////////////////////////
+const std::shared_ptr<GlyphAtlas>& Font::getGlyphAtlas() const
+{
+    return m_glyphAtlas;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldEnabled(bool enabled)
+{
+    if (enabled != m_isDistanceField)
     {
-        if (bold)
+        m_isDistanceField = enabled;
+
+        // The glyphs loaded so far were rendered for the other mode
+        m_pages.clear();
+        m_distanceFieldGlyphs.clear();
+        m_kerningTables.clear();
+        m_id = getFontId();
+        updateMemoryUsage();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_isDistanceField;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* Font::getDistanceFieldShader() const
+{
+    if (!m_distanceFieldShaderLoaded)
+    {
+        m_distanceFieldShaderLoaded = true;
+
+        if (Shader::isAvailable())
         {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+            if (auto shader = Shader::loadFromMemory(distanceFieldShaderSource, Shader::Type::Fragment))
+            {
+                shader->setUniform("texture", Shader::CurrentTexture);
+                shader->setUniform("outline", 0.f);
+                m_distanceFieldShader = std::make_shared<DistanceFieldShader>(DistanceFieldShader{std::move(*shader)});
+            }
+            else
+            {
+                err() << "Failed to create the distance field font shader" << std::endl;
+            }
         }
+    }
 
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_fontHandles->stroker;
+    return m_distanceFieldShader ? &m_distanceFieldShader->shader : nullptr;
+}
 
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
+
+////////////////////////////////////////////////////////////
+const Shader* Font::getDistanceFieldShader(RenderTarget& target,
+                                           float         outlineThickness,
+                                           unsigned int  characterSize) const
+{
+    if (!getDistanceFieldShader())
+        return nullptr;
+
+    // The outline moves the edge of the glyphs outwards, up to just below the spread covered by the distance fields
+    const float thickness = (characterSize > 0) ? std::abs(outlineThickness) * static_cast<float>(distanceFieldSize) /
+                                                      static_cast<float>(characterSize)
+                                                : 0;
+    const float outline = std::min(thickness, static_cast<float>(distanceFieldSpread) - 1) /
+                          static_cast<float>(2 * distanceFieldSpread);
+
+    // Glyphs batched by the target must still be drawn with the previous value
+    if (outline != m_distanceFieldShader->outline)
+    {
+        target.flush();
+        m_distanceFieldShader->shader.setUniform("outline", outline);
+        m_distanceFieldShader->outline = outline;
     }
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+    return &m_distanceFieldShader->shader;
+}
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
+
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadPage(unsigned int characterSize) const
+{
+    if (const auto it = m_pages.find(characterSize); it != m_pages.end())
+        return it->second;
+
+    Page& page = m_pages[characterSize];
+
+    // Without a shared atlas, every page has its own texture
+    if (!m_glyphAtlas)
     {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+        page.atlas = GlyphAtlas::create();
+        assert(page.atlas && "Font::loadPage() Failed to load page");
 
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
+        // Distance fields must always be interpolated
+        page.atlas->setSmooth(m_isSmooth || m_isDistanceField);
     }
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+    return page;
+}
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
 
-    unsigned int width  = bitmap.width;
-    unsigned int height = bitmap.rows;
+////////////////////////////////////////////////////////////
+GlyphAtlas& Font::getPageAtlas(Page& page) const
+{
+    return m_glyphAtlas ? *m_glyphAtlas : *page.atlas;
+}
 
-    if ((width > 0) && (height > 0))
-    {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
 
-        width += 2 * padding;
-        height += 2 * padding;
+////////////////////////////////////////////////////////////
+void Font::updateGlyphAtlas() const
+{
+    if (!m_glyphAtlas || (m_atlasGeneration == m_glyphAtlas->m_generation))
+        return;
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
+    // The glyphs were removed from the atlas, they will be loaded again on demand
+    for (auto& [key, page] : m_pages)
+        page.glyphs.clear();
 
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, {width, height});
+    m_distanceFieldGlyphs.clear();
+    m_atlasGeneration = m_glyphAtlas->m_generation;
+    updateMemoryUsage();
+}
 
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.left += static_cast<int>(padding);
-        glyph.textureRect.top += static_cast<int>(padding);
-        glyph.textureRect.width -= static_cast<int>(2 * padding);
-        glyph.textureRect.height -= static_cast<int>(2 * padding);
 
-        // Compute the glyph's bounding box
-        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
-        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top);
-        glyph.bounds.width  = static_cast<float>(bitmap.width);
-        glyph.bounds.height = static_cast<float>(bitmap.rows);
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(std::uint32_t glyphIndex, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    SFML_PROFILE_ZONE("sf::Font::loadGlyph");
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+    // The glyph to return
+    Glyph glyph;
 
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + width * height * 4;
+    // Get our FT_Face
+    if (!m_fontHandles->face)
+        return glyph;
 
-        while (current != end)
-        {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
-        }
+    // Set the character size
+    if (!setCurrentSize(characterSize))
+        return glyph;
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
-        {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < height - padding; ++y)
-            {
-                for (unsigned int x = padding; x < width - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
-            }
-        }
-        else
+    Vector2u size;
+    if (!rasterizeGlyph(m_fontHandles->library,
+                        m_fontHandles->face,
+                        m_fontHandles->stroker,
+                        glyphIndex,
+                        bold,
+                        outlineThickness,
+                        m_isDistanceField,
+                        glyph,
+                        m_pixelBuffer,
+                        size))
+        return glyph;
+
+    if ((size.x > 0) && (size.y > 0))
+    {
+        // Get the glyphs page corresponding to the character size
+        Page& page = loadPage(characterSize);
+
+        // Find a good position for the new glyph into the texture
+        const std::optional<IntRect> rect = findGlyphRect(page, size);
+        if (!rect)
         {
-            // Pixels are 8 bits gray levels
-            for (unsigned int y = padding; y < height - padding; ++y)
-            {
-                for (unsigned int x = padding; x < width - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
-                }
-                pixels += bitmap.pitch;
-            }
+            glyph.textureRect = {};
+            return glyph;
         }
 
+        // Make sure the texture data is positioned in the center
+        // of the allocated texture rectangle
+        moveGlyph(glyph, rect->getPosition());
+
         // Write the pixels to the texture
-        const unsigned int x = static_cast<unsigned int>(glyph.textureRect.left) - padding;
-        const unsigned int y = static_cast<unsigned int>(glyph.textureRect.top) - padding;
-        const unsigned int w = static_cast<unsigned int>(glyph.textureRect.width) + 2 * padding;
-        const unsigned int h = static_cast<unsigned int>(glyph.textureRect.height) + 2 * padding;
-        page.texture.update(m_pixelBuffer.data(), {w, h}, {x, y});
+        getPageAtlas(page).m_texture.update(m_pixelBuffer.data(), size, Vector2u(rect->getPosition()));
     }
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
-
     // Done :)
     return glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
+std::optional<IntRect> Font::findGlyphRect(Page& page, const Vector2u& size) const
 {
-    // Find the line that fits well the glyph
-    Row*  row       = nullptr;
-    float bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
-    {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
+    GlyphAtlas&        atlas       = getPageAtlas(page);
+    const unsigned int maximumSize = getTextureSizeLimit(m_glyphAtlas ? atlas.m_maximumSize : m_maximumTextureSize);
 
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
+    // Find a place for the glyph in the atlas, growing it if possible
+    if (const std::optional<IntRect> rect = atlas.allocate(size, maximumSize))
+        return rect;
 
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
-            continue;
+    // The texture can't grow anymore: make room by dropping the glyphs that haven't been used for a while
+    evictGlyphs(page);
+    if (const std::optional<IntRect> rect = atlas.allocate(size, maximumSize))
+        return rect;
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
+    // Oops, we've reached the maximum texture size...
+    err() << "Failed to add a new character to the font: the maximum texture size has been reached" << std::endl;
+    return std::nullopt;
+}
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
-    }
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+////////////////////////////////////////////////////////////
+void Font::evictGlyphs(Page& page) const
+{
+    // The glyphs of the other fonts using a shared atlas can't be repacked, all of them are dropped instead
+    if (m_glyphAtlas)
     {
-        const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
-        {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
-            {
-                // Make the texture 2 times bigger
-                auto newTexture = sf::Texture::create(textureSize * 2u);
-                if (!newTexture)
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
+        m_glyphAtlas->clear();
+        updateGlyphAtlas();
+        return;
+    }
 
-                newTexture->setSmooth(m_isSmooth);
-                newTexture->update(page.texture);
-                page.texture.swap(*newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
-                      << std::endl;
-                return {{0, 0}, {2, 2}};
-            }
-        }
+    // Glyphs are about to move, the scaled copies of the distance field glyphs will be recreated
+    m_distanceFieldGlyphs.clear();
 
-        // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
-    }
+    // Sort the glyphs from the most to the least recently used
+    std::vector<GlyphTable::iterator> entries;
+    entries.reserve(page.glyphs.size());
+    for (auto it = page.glyphs.begin(); it != page.glyphs.end(); ++it)
+        entries.push_back(it);
 
-    // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const auto& left, const auto& right) { return left->second.lastUse > right->second.lastUse; });
 
-    // Update the row information
-    row->width += size.x;
+    // Repack the most recently used glyphs into a fresh texture, up to half of its area
+    GlyphAtlas&         atlas       = *page.atlas;
+    const Vector2u      textureSize = atlas.m_texture.getSize();
+    const Image         oldImage    = atlas.m_texture.copyToImage();
+    Image               image       = GlyphAtlas::makeImage(textureSize);
+    const std::uint64_t budget      = std::uint64_t{textureSize.x} * textureSize.y / 2;
 
-    return rect;
-}
+    atlas.resetPacker();
 
+    const auto padding = static_cast<int>(glyphPadding);
+    for (const auto& it : entries)
+    {
+        Glyph& glyph = it->second.glyph;
 
-////////////////////////////////////////////////////////////
-bool Font::setCurrentSize(unsigned int characterSize) const
-{
-    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
-    // only when necessary to avoid killing performances
+        // Glyphs without pixels (e.g. spaces) don't use any texture space
+        if ((glyph.textureRect.width <= 0) || (glyph.textureRect.height <= 0))
+            continue;
 
-    // m_fontHandles and m_fontHandles->face are checked to be non-null before calling this method
-    FT_Face         face        = m_fontHandles->face;
-    const FT_UShort currentSize = face->size->metrics.x_ppem;
+        const IntRect  sourceRect(glyph.textureRect.getPosition() - Vector2i(padding, padding),
+                                 glyph.textureRect.getSize() + Vector2i(padding, padding) * 2);
+        const Vector2u size(sourceRect.getSize());
 
-    if (currentSize != characterSize)
-    {
-        const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
+        std::optional<Rect<unsigned int>> rect;
+        if (atlas.m_packer.getUsedArea() + std::uint64_t{size.x} * size.y <= budget)
+            rect = atlas.m_packer.insert(size);
 
-        if (result == FT_Err_Invalid_Pixel_Size)
+        if (!rect || !image.copy(oldImage, rect->getPosition(), sourceRect))
         {
-            // In the case of bitmap fonts, resizing can
-            // fail if the requested size is not available
-            if (!FT_IS_SCALABLE(face))
-            {
-                err() << "Failed to set bitmap font size to " << characterSize << '\n' << "Available sizes are: ";
-                for (int i = 0; i < face->num_fixed_sizes; ++i)
-                {
-                    const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
-                    err() << size << " ";
-                }
-                err() << std::endl;
-            }
-            else
-            {
-                err() << "Failed to set font size to " << characterSize << std::endl;
-            }
+            page.glyphs.erase(it);
+            continue;
         }
 
-        return result == FT_Err_Ok;
+        glyph.textureRect.left = static_cast<int>(rect->left) + padding;
+        glyph.textureRect.top  = static_cast<int>(rect->top) + padding;
     }
 
-    return true;
+    // Replace the texture so that its users notice that the glyphs have moved
+    if (auto newTexture = Texture::loadFromImage(image))
+    {
+        newTexture->setSmooth(m_isSmooth || m_isDistanceField);
+        atlas.m_texture.swap(*newTexture);
+    }
+    else
+    {
+        err() << "Failed to create new page texture" << std::endl;
+        atlas.m_texture.update(image);
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
-std::optional<Font::Page> Font::Page::make(bool smooth)
+void Font::updateMemoryUsage() const
 {
-    // Make sure that the texture is initialized by default
-    Image image({128, 128}, Color::Transparent);
+    // Only the number of entries changes, so this is cheap enough to be done for every new glyph
+    std::uint64_t bytes = m_pixelBuffer.capacity();
 
-    // Reserve a 2x2 white square for texturing underlines
-    for (unsigned int x = 0; x < 2; ++x)
-        for (unsigned int y = 0; y < 2; ++y)
-            image.setPixel({x, y}, Color::White);
+    for (const auto& [characterSize, page] : m_pages)
+        bytes += sizeof(PageTable::value_type) + page.glyphs.size() * sizeof(GlyphTable::value_type);
 
-    // Create the texture
-    auto texture = sf::Texture::loadFromImage(image);
-    if (!texture)
-    {
-        err() << "Failed to load font page texture" << std::endl;
-        return std::nullopt;
-    }
+    for (const auto& [characterSize, glyphs] : m_distanceFieldGlyphs)
+        bytes += glyphs.size() * sizeof(GlyphTable::value_type);
+
+    for (const auto& [key, kerning] : m_kerningTables)
+        bytes += kerning.size() * sizeof(KerningTable::value_type);
 
-    texture->setSmooth(smooth);
-    return Page(std::move(*texture));
+    m_memoryCounter.setBytes(bytes);
 }
 
 
 ////////////////////////////////////////////////////////////
-Font::Page::Page(Texture&& theTexture) : texture(std::move(theTexture))
+bool Font::setCurrentSize(unsigned int characterSize) const
 {
+    // m_fontHandles and m_fontHandles->face are checked to be non-null before calling this method
+    return setFaceSize(m_fontHandles->face, characterSize);
 }
 
 } // namespace sf
@@ -0,0 +1,368 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameCapture.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+#include <cstring>
+
+
+namespace
+{
+namespace FrameCaptureImpl
+{
+// Copy rows of pixels read from the bottom up into an image
+sf::Image makeFrame(const void* source, const sf::Vector2u& size)
+{
+    std::vector<std::uint8_t> pixels(std::size_t{size.x} * size.y * 4);
+
+    const std::size_t pitch = std::size_t{size.x} * 4;
+    const auto*       src   = static_cast<const std::uint8_t*>(source);
+
+    for (std::size_t row = 0; row < size.y; ++row)
+        std::memcpy(pixels.data() + (size.y - 1 - row) * pitch, src + row * pitch, pitch);
+
+    return {size, pixels.data()};
+}
+} // namespace FrameCaptureImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FrameCapture::FrameCapture(std::size_t bufferCount) : m_slots(std::max<std::size_t>(bufferCount, 1))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::~FrameCapture()
+{
+    finish();
+
+    if (m_thread.joinable())
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+
+        m_condition.notify_all();
+        m_thread.join();
+    }
+
+    const TransientContextLock lock;
+
+    for (Slot& slot : m_slots)
+    {
+        if (slot.fence)
+            glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(slot.fence)));
+
+        if (slot.buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &slot.buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameCapture::capture(RenderTarget& target)
+{
+    collect(false);
+
+    Slot& slot = m_slots[m_next];
+    if (slot.pending)
+    {
+        ++m_dropped;
+        return false;
+    }
+
+    // Draw the batched geometry before reading the pixels
+    target.flush();
+
+    const Vector2u size = target.getSize();
+    if (size.x == 0 || size.y == 0 || !target.setActive(true))
+    {
+        err() << "Failed to capture render target" << std::endl;
+        ++m_dropped;
+        return false;
+    }
+
+    const auto width  = static_cast<GLsizei>(size.x);
+    const auto height = static_cast<GLsizei>(size.y);
+
+#ifndef SFML_OPENGL_ES
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object)
+    {
+        const std::size_t byteSize = std::size_t{size.x} * size.y * 4;
+
+        if (!slot.buffer)
+            glCheck(GLEXT_glGenBuffers(1, &slot.buffer));
+
+        if (slot.buffer)
+        {
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, slot.buffer));
+
+            // Only reallocate the storage when the target grows, buffers are reused from frame to frame
+            if (slot.capacity < byteSize)
+            {
+                glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                           static_cast<GLsizeiptrARB>(byteSize),
+                                           nullptr,
+                                           GLEXT_GL_STREAM_READ));
+                slot.capacity = byteSize;
+            }
+
+            glCheck(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+            if (GLEXT_sync)
+                glCheck(slot.fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+            // Submit the copy right away, so that it completes while the application goes on
+            glCheck(glFlush());
+
+            slot.size    = size;
+            slot.index   = m_captured++;
+            slot.pending = true;
+            m_next       = (m_next + 1) % m_slots.size();
+            return true;
+        }
+    }
+
+#endif // SFML_OPENGL_ES
+
+    // Pixel buffers are not supported, copy the pixels synchronously
+    std::vector<std::uint8_t> pixels(std::size_t{size.x} * size.y * 4);
+    glCheck(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+    deliver(FrameCaptureImpl::makeFrame(pixels.data(), size), m_captured++);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> FrameCapture::retrieveFrame()
+{
+    collect(false);
+
+    if (m_frames.empty())
+        return std::nullopt;
+
+    Image frame = std::move(m_frames.front());
+    m_frames.pop_front();
+    return frame;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::setEncoder(Encoder encoder)
+{
+    // Hand the frames captured so far to the current encoder
+    collect(true);
+
+    std::unique_lock lock(m_mutex);
+    waitForEncoder(lock);
+    m_encoder = std::move(encoder);
+
+    if (m_encoder && !m_thread.joinable())
+        m_thread = std::thread(&FrameCapture::run, this);
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::finish()
+{
+    collect(true);
+
+    std::unique_lock lock(m_mutex);
+    waitForEncoder(lock);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t FrameCapture::getCapturedFrameCount() const
+{
+    return m_captured;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t FrameCapture::getDroppedFrameCount() const
+{
+    return m_dropped;
+}
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::Encoder FrameCapture::createImageSequenceEncoder(const std::filesystem::path& directory,
+                                                               const std::string&           extension)
+{
+    return [directory, extension](const Image& frame, std::uint64_t index)
+    {
+        std::ostringstream filename;
+        filename << "frame_" << std::setfill('0') << std::setw(6) << index << '.' << extension;
+
+        // Errors are reported by saveToFile
+        (void)frame.saveToFile(directory / filename.str());
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::Encoder FrameCapture::createRawEncoder(std::ostream& stream)
+{
+    return [&stream](const Image& frame, std::uint64_t)
+    {
+        const Vector2u size = frame.getSize();
+        stream.write(reinterpret_cast<const char*>(frame.getPixelsPtr()),
+                     static_cast<std::streamsize>(std::size_t{size.x} * size.y * 4));
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::collect(bool wait)
+{
+    if (!m_slots[m_oldest].pending)
+        return;
+
+    const TransientContextLock lock;
+
+    while (m_slots[m_oldest].pending)
+    {
+        Slot& slot = m_slots[m_oldest];
+
+        if (slot.fence)
+        {
+            GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+            glCheck(result = GLEXT_glClientWaitSync(static_cast<GLEXT_GLsync>(slot.fence),
+                                                    GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                    0));
+
+            // Frames complete in order, the next ones can't be ready either
+            if ((result == GLEXT_GL_TIMEOUT_EXPIRED) && !wait)
+                return;
+
+            while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+                glCheck(result = GLEXT_glClientWaitSync(static_cast<GLEXT_GLsync>(slot.fence),
+                                                        GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                        1000000));
+
+            glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(slot.fence)));
+            slot.fence = nullptr;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, slot.buffer));
+
+        const void* source = nullptr;
+        glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+
+        if (source)
+        {
+            Image frame = FrameCaptureImpl::makeFrame(source, slot.size);
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+            deliver(std::move(frame), slot.index);
+        }
+        else
+        {
+            err() << "Failed to map pixel buffer to read captured frame" << std::endl;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        slot.pending = false;
+        m_oldest     = (m_oldest + 1) % m_slots.size();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::deliver(Image&& frame, std::uint64_t index)
+{
+    if (!m_encoder)
+    {
+        m_frames.push_back(std::move(frame));
+        return;
+    }
+
+    {
+        const std::lock_guard lock(m_mutex);
+        m_queue.emplace_back(std::move(frame), index);
+    }
+
+    m_condition.notify_all();
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::waitForEncoder(std::unique_lock<std::mutex>& lock)
+{
+    m_condition.wait(lock, [this] { return m_queue.empty() && !m_encoding; });
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::run()
+{
+    std::unique_lock lock(m_mutex);
+
+    for (;;)
+    {
+        m_condition.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+
+        if (m_queue.empty())
+            return;
+
+        auto [frame, index] = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_encoding = true;
+
+        // The encoder can't be replaced while a frame is being encoded, no need to keep the lock
+        lock.unlock();
+        m_encoder(frame, index);
+        lock.lock();
+
+        m_encoding = false;
+        m_condition.notify_all();
+    }
+}
+
+} // namespace sf
@@ -100,6 +100,8 @@ void glCheckError(const std::filesystem::path& file, unsigned int line, std::str
             }
         }
 
+        countGlError();
+
         // Log the error
         err() << "An internal OpenGL call failed in " << file.filename() << "(" << line << ")."
               << "\nExpression:\n   " << expression << "\nError description:\n   " << error << "\n   " << description << '\n'
@@ -38,23 +38,40 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 /// Let's define a macro to quickly check every OpenGL API call
 ////////////////////////////////////////////////////////////
-#ifdef SFML_DEBUG
-
-// In debug mode, perform a test on every OpenGL call
+// The test is only performed if sf::GlDiagnostics::Mode::CheckErrors is enabled,
+// which is the default in debug builds and costs almost nothing when it's not
 // The do-while loop is needed so that glCheck can be used as a single statement in if/else branches
-#define glCheck(expr)                                      \
-    do                                                     \
-    {                                                      \
-        expr;                                              \
-        sf::priv::glCheckError(__FILE__, __LINE__, #expr); \
+#define glCheck(expr)                                          \
+    do                                                         \
+    {                                                          \
+        expr;                                                  \
+        if (sf::priv::isGlErrorCheckEnabled())                 \
+            sf::priv::glCheckError(__FILE__, __LINE__, #expr); \
     } while (false)
 
-#else
+////////////////////////////////////////////////////////////
+/// \brief Tell whether glCheck has to check for OpenGL errors
+///
+/// \return True if the current diagnostics mode is CheckErrors
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isGlErrorCheckEnabled();
 
-// Else, we don't add any overhead
-#define glCheck(expr) (expr)
+////////////////////////////////////////////////////////////
+/// \brief Count an OpenGL error reported to sf::err()
+///
+////////////////////////////////////////////////////////////
+void countGlError();
 
-#endif
+////////////////////////////////////////////////////////////
+/// \brief Install or remove the debug output callback in the active context
+///
+/// Does nothing if the context is already set up for the
+/// current diagnostics mode, so it can be called on every
+/// activation. A context must be active.
+///
+////////////////////////////////////////////////////////////
+void updateGlDebugOutput();
 
 ////////////////////////////////////////////////////////////
 /// \brief Check the last OpenGL error
@@ -75,11 +75,24 @@ void extensionSanityCheck()
     check(GLEXT_blend_func_separate_dependencies);
     check(GLEXT_vertex_buffer_object_dependencies);
     check(GLEXT_shader_objects_dependencies);
+    check(GLEXT_vertex_shader_dependencies);
     check(GLEXT_blend_equation_separate_dependencies);
     check(GLEXT_framebuffer_object_dependencies);
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_map_buffer_range_dependencies);
+    check(GLEXT_sync_dependencies);
+    check(GLEXT_buffer_storage_dependencies);
+    check(GLEXT_uniform_buffer_object_dependencies);
+    check(GLEXT_invalidate_framebuffer_dependencies);
+    check(GLEXT_timer_query_dependencies);
+    check(GLEXT_get_program_binary_dependencies);
+    check(GLEXT_debug_dependencies);
+    check(GLEXT_transform_feedback_dependencies);
+    check(GLEXT_multi_draw_arrays_dependencies);
+    check(GLEXT_instancing_dependencies);
+    check(GLEXT_core_profile_dependencies);
 #endif
 }
 
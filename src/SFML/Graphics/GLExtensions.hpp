@@ -65,16 +65,17 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
@@ -172,6 +173,69 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
 
+// Core since 3.0 - EXT_map_buffer_range
+#define GLEXT_map_buffer_range      false
+#define GLEXT_GL_MAP_WRITE_BIT             0
+#define GLEXT_GL_MAP_PERSISTENT_BIT        0
+#define GLEXT_GL_MAP_COHERENT_BIT          0
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT  0
+#define GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT 0
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT    0
+#define GLEXT_glMapBufferRange \
+    glMapBufferRange // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUnmapBuffer \
+    glUnmapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync                          false
+#define GLEXT_GLsync                        GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    0
+#define GLEXT_GL_TIMEOUT_EXPIRED            0
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Extension - EXT_buffer_storage
+#define GLEXT_buffer_storage false
+#define GLEXT_glBufferStorage \
+    glBufferStorage // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - uniform buffer objects
+#define GLEXT_uniform_buffer_object          false
+#define GLEXT_GL_UNIFORM_BUFFER              0
+#define GLEXT_GL_INVALID_INDEX               0xFFFFFFFF
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS 0
+#define GLEXT_glGetUniformBlockIndex \
+    glGetUniformBlockIndex // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUniformBlockBinding \
+    glUniformBlockBinding // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glBindBufferBase \
+    glBindBufferBase // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - texture arrays
+#define GLEXT_texture_array               false
+#define GLEXT_GL_TEXTURE_2D_ARRAY         0
+#define GLEXT_GL_TEXTURE_BINDING_2D_ARRAY 0
+#define GLEXT_GL_MAX_ARRAY_TEXTURE_LAYERS 0
+#define GLEXT_glTexImage3D \
+    glTexImage3D // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glTexSubImage3D \
+    glTexSubImage3D // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object    false
+#define GLEXT_GL_PIXEL_PACK_BUFFER   0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER 0
+#define GLEXT_GL_STREAM_READ         0
+#define GLEXT_GL_READ_ONLY           0
+#define GLEXT_GL_WRITE_ONLY          0
+#define GLEXT_glMapBuffer \
+    glMapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 // Core since 3.0 - EXT_blend_minmax
 #define GLEXT_blend_minmax SF_GLAD_GL_EXT_blend_minmax
 // glBlendEquation is provided by OES_blend_subtract, see above
@@ -180,6 +244,131 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_EXT_blend_minmax_dependencies SF_GLAD_GL_EXT_blend_minmax, glBlendEquationEXT
 
+// Extension - EXT_disjoint_timer_query
+#define GLEXT_timer_query                 false
+#define GLEXT_GL_TIMESTAMP                0
+#define GLEXT_GL_QUERY_RESULT             0
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE   0
+#define GLEXT_glGenQueries \
+    glGenQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteQueries \
+    glDeleteQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glQueryCounter \
+    glQueryCounter // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectiv \
+    glGetQueryObjectiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectui64v \
+    glGetQueryObjectui64v // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.2 - KHR_debug
+#define GLEXT_debug                       false
+#define GLEXT_GL_DEBUG_SOURCE_APPLICATION 0
+#define GLEXT_glPushDebugGroup \
+    glPushDebugGroup // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glPopDebugGroup \
+    glPopDebugGroup // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_DEBUG_OUTPUT                0
+#define GLEXT_GL_DEBUG_OUTPUT_SYNCHRONOUS    0
+#define GLEXT_GL_DEBUG_TYPE_ERROR            0
+#define GLEXT_GL_DEBUG_SEVERITY_HIGH         0
+#define GLEXT_GL_DEBUG_SEVERITY_NOTIFICATION 0
+#define GLEXT_GL_DONT_CARE                   0
+#define GLEXT_glDebugMessageCallback \
+    glDebugMessageCallback // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDebugMessageControl \
+    glDebugMessageControl // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Extension - EXT_discard_framebuffer
+// The entry point is not part of our GLES 1 loader, discarding is never performed in GLES
+#define GLEXT_invalidate_framebuffer false
+#define GLEXT_glInvalidateFramebuffer \
+    glInvalidateFramebuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - transform feedback
+#define GLEXT_transform_feedback           false
+#define GLEXT_GL_TRANSFORM_FEEDBACK_BUFFER 0
+#define GLEXT_GL_INTERLEAVED_ATTRIBS       0
+#define GLEXT_GL_RASTERIZER_DISCARD        0
+#define GLEXT_glTransformFeedbackVaryings \
+    glTransformFeedbackVaryings // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glBeginTransformFeedback \
+    glBeginTransformFeedback // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glEndTransformFeedback \
+    glEndTransformFeedback // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Extension - EXT_multi_draw_arrays
+// The entry point is not part of our GLES 1 loader, the ranges of a multi-draw are drawn one by one in GLES
+#define GLEXT_multi_draw_arrays false
+#define GLEXT_glMultiDrawArrays \
+    glMultiDrawArrays // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.3 - ARB_draw_instanced / ARB_instanced_arrays
+// The entry points are not part of our GLES 1 loader, instances are expanded on the CPU in GLES
+#define GLEXT_instancing false
+#define GLEXT_glDrawArraysInstanced \
+    glDrawArraysInstanced // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribDivisor \
+    glVertexAttribDivisor // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - programmable pipeline of OpenGL ES 3
+// The entry points are not part of our GLES 1 loader, the fixed-function pipeline is always used in GLES
+#define GLEXT_core_profile                     false
+#define GLEXT_core_GL_VERTEX_SHADER            0
+#define GLEXT_core_GL_FRAGMENT_SHADER          0
+#define GLEXT_core_GL_COMPILE_STATUS           0
+#define GLEXT_core_GL_LINK_STATUS              0
+#define GLEXT_core_GL_INFO_LOG_LENGTH          0
+#define GLEXT_core_GL_CONTEXT_PROFILE_MASK     0
+#define GLEXT_core_GL_CONTEXT_CORE_PROFILE_BIT 0
+#define GLEXT_core_glCreateShader \
+    glCreateShader // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glShaderSource \
+    glShaderSource // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glCompileShader \
+    glCompileShader // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glGetShaderiv \
+    glGetShaderiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glGetShaderInfoLog \
+    glGetShaderInfoLog // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glDeleteShader \
+    glDeleteShader // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glCreateProgram \
+    glCreateProgram // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glAttachShader \
+    glAttachShader // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glBindAttribLocation \
+    glBindAttribLocation // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glLinkProgram \
+    glLinkProgram // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glGetProgramiv \
+    glGetProgramiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glGetProgramInfoLog \
+    glGetProgramInfoLog // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glDeleteProgram \
+    glDeleteProgram // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glUseProgram \
+    glUseProgram // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glGetUniformLocation \
+    glGetUniformLocation // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glUniform1i \
+    glUniform1i // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glUniformMatrix4fv \
+    glUniformMatrix4fv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glGenVertexArrays \
+    glGenVertexArrays // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glDeleteVertexArrays \
+    glDeleteVertexArrays // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glBindVertexArray \
+    glBindVertexArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glEnableVertexAttribArray \
+    glEnableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glVertexAttribPointer \
+    glVertexAttribPointer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glDisableVertexAttribArray \
+    glDisableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_core_glUniform4fv \
+    glUniform4fv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -231,6 +420,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
@@ -296,6 +486,15 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
 #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
 #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
+#define GLEXT_glGetAttribLocation                 glGetAttribLocationARB
+#define GLEXT_glVertexAttribPointer               glVertexAttribPointerARB
+#define GLEXT_glEnableVertexAttribArray           glEnableVertexAttribArrayARB
+#define GLEXT_glDisableVertexAttribArray          glDisableVertexAttribArrayARB
+#define GLEXT_glVertexAttrib4f                    glVertexAttrib4fARB
+
+#define GLEXT_vertex_shader_dependencies                                                                          \
+    SF_GLAD_GL_ARB_vertex_shader, glGetAttribLocationARB, glVertexAttribPointerARB, glEnableVertexAttribArrayARB, \
+        glDisableVertexAttribArrayARB, glVertexAttrib4fARB
 
 // Core since 2.0 - ARB_fragment_shader
 #define GLEXT_fragment_shader                     SF_GLAD_GL_ARB_fragment_shader
@@ -376,8 +575,210 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range         SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_GL_MAP_WRITE_BIT             GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_PERSISTENT_BIT        GL_MAP_PERSISTENT_BIT
+#define GLEXT_GL_MAP_COHERENT_BIT          GL_MAP_COHERENT_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT  GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT GL_MAP_INVALIDATE_BUFFER_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT    GL_MAP_UNSYNCHRONIZED_BIT
+#define GLEXT_glMapBufferRange             glMapBufferRange
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange
+
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_GLsync                        GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED            GL_TIMEOUT_EXPIRED
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
+// Core since 4.4 - ARB_buffer_storage
+#define GLEXT_buffer_storage           SF_GLAD_GL_ARB_buffer_storage
+#define GLEXT_glBufferStorage          glBufferStorage
+
+#define GLEXT_buffer_storage_dependencies SF_GLAD_GL_ARB_buffer_storage, glBufferStorage
+
+// Core since 3.1 - ARB_uniform_buffer_object
+#define GLEXT_uniform_buffer_object          SF_GLAD_GL_ARB_uniform_buffer_object
+#define GLEXT_GL_UNIFORM_BUFFER              GL_UNIFORM_BUFFER
+#define GLEXT_GL_INVALID_INDEX               GL_INVALID_INDEX
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS GL_MAX_UNIFORM_BUFFER_BINDINGS
+#define GLEXT_glGetUniformBlockIndex         glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding          glUniformBlockBinding
+#define GLEXT_glBindBufferBase               glBindBufferBase
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_ARB_uniform_buffer_object, glGetUniformBlockIndex, glUniformBlockBinding, glBindBufferBase
+
+// Core since 3.0 - EXT_texture_array
+#define GLEXT_texture_array               (SF_GLAD_GL_EXT_texture_array || SF_GLAD_GL_VERSION_3_0)
+#define GLEXT_GL_TEXTURE_2D_ARRAY         GL_TEXTURE_2D_ARRAY
+#define GLEXT_GL_TEXTURE_BINDING_2D_ARRAY GL_TEXTURE_BINDING_2D_ARRAY
+#define GLEXT_GL_MAX_ARRAY_TEXTURE_LAYERS GL_MAX_ARRAY_TEXTURE_LAYERS
+#define GLEXT_glTexImage3D                glTexImage3D
+#define GLEXT_glTexSubImage3D             glTexSubImage3D
+
+// Core since 2.1 - ARB_pixel_buffer_object
+// The extension only adds tokens to ARB_vertex_buffer_object, availability is checked with the core version
+#define GLEXT_pixel_buffer_object    SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER   GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER GL_PIXEL_UNPACK_BUFFER
+#define GLEXT_GL_STREAM_READ         GL_STREAM_READ_ARB
+
+// Core since 4.3 - ARB_invalidate_subdata
+#define GLEXT_invalidate_framebuffer  SF_GLAD_GL_ARB_invalidate_subdata
+#define GLEXT_glInvalidateFramebuffer glInvalidateFramebuffer
+
+#define GLEXT_invalidate_framebuffer_dependencies SF_GLAD_GL_ARB_invalidate_subdata, glInvalidateFramebuffer
+
+// Core since 3.3 - ARB_timer_query
+#define GLEXT_timer_query               SF_GLAD_GL_ARB_timer_query
+#define GLEXT_GL_TIMESTAMP              GL_TIMESTAMP
+#define GLEXT_GL_QUERY_RESULT           GL_QUERY_RESULT
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE GL_QUERY_RESULT_AVAILABLE
+#define GLEXT_glGenQueries              glGenQueries
+#define GLEXT_glDeleteQueries           glDeleteQueries
+#define GLEXT_glQueryCounter            glQueryCounter
+#define GLEXT_glGetQueryObjectiv        glGetQueryObjectiv
+#define GLEXT_glGetQueryObjectui64v     glGetQueryObjectui64v
+
+#define GLEXT_timer_query_dependencies \
+    SF_GLAD_GL_ARB_timer_query, glGenQueries, glDeleteQueries, glQueryCounter, glGetQueryObjectiv, glGetQueryObjectui64v
+
+// Core since 4.1 - ARB_get_program_binary
+#define GLEXT_get_program_binary                 SF_GLAD_GL_ARB_get_program_binary
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_GL_PROGRAM_BINARY_FORMATS          GL_PROGRAM_BINARY_FORMATS
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+
+#define GLEXT_get_program_binary_dependencies \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramiv, glGetProgramBinary, glProgramBinary, glProgramParameteri
+
+// KHR_parallel_shader_compile or ARB_parallel_shader_compile, detected with sf::Context::isExtensionAvailable
+#define GLEXT_GL_COMPLETION_STATUS 0x91B1
+
+// Core since 4.3 - KHR_debug
+#define GLEXT_debug                          SF_GLAD_GL_KHR_debug
+#define GLEXT_GL_DEBUG_SOURCE_APPLICATION    GL_DEBUG_SOURCE_APPLICATION
+#define GLEXT_glPushDebugGroup               glPushDebugGroup
+#define GLEXT_glPopDebugGroup                glPopDebugGroup
+#define GLEXT_GL_DEBUG_OUTPUT                GL_DEBUG_OUTPUT
+#define GLEXT_GL_DEBUG_OUTPUT_SYNCHRONOUS    GL_DEBUG_OUTPUT_SYNCHRONOUS
+#define GLEXT_GL_DEBUG_TYPE_ERROR            GL_DEBUG_TYPE_ERROR
+#define GLEXT_GL_DEBUG_SEVERITY_HIGH         GL_DEBUG_SEVERITY_HIGH
+#define GLEXT_GL_DEBUG_SEVERITY_NOTIFICATION GL_DEBUG_SEVERITY_NOTIFICATION
+#define GLEXT_GL_DONT_CARE                   GL_DONT_CARE
+#define GLEXT_glDebugMessageCallback         glDebugMessageCallback
+#define GLEXT_glDebugMessageControl          glDebugMessageControl
+
+#define GLEXT_debug_dependencies                                                                                       \
+    SF_GLAD_GL_KHR_debug, glPushDebugGroup, glPopDebugGroup, glDebugMessageCallback, glDebugMessageControl
+
+// Core since 3.0 - EXT_transform_feedback
+#define GLEXT_transform_feedback           SF_GLAD_GL_VERSION_3_0
+#define GLEXT_GL_TRANSFORM_FEEDBACK_BUFFER GL_TRANSFORM_FEEDBACK_BUFFER
+#define GLEXT_GL_INTERLEAVED_ATTRIBS       GL_INTERLEAVED_ATTRIBS
+#define GLEXT_GL_RASTERIZER_DISCARD        GL_RASTERIZER_DISCARD
+#define GLEXT_glTransformFeedbackVaryings  glTransformFeedbackVaryings
+#define GLEXT_glBeginTransformFeedback     glBeginTransformFeedback
+#define GLEXT_glEndTransformFeedback       glEndTransformFeedback
+
+#define GLEXT_transform_feedback_dependencies                                                                          \
+    SF_GLAD_GL_VERSION_3_0, glTransformFeedbackVaryings, glBeginTransformFeedback, glEndTransformFeedback,             \
+        glBindBufferBase
+
+// Core since 1.4 - EXT_multi_draw_arrays
+#define GLEXT_multi_draw_arrays SF_GLAD_GL_VERSION_1_4
+#define GLEXT_glMultiDrawArrays glMultiDrawArrays
+
+#define GLEXT_multi_draw_arrays_dependencies SF_GLAD_GL_VERSION_1_4, glMultiDrawArrays
+
+// Core since 3.3 - ARB_draw_instanced / ARB_instanced_arrays
+#define GLEXT_instancing            SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glDrawArraysInstanced glDrawArraysInstanced
+#define GLEXT_glVertexAttribDivisor glVertexAttribDivisor
+
+#define GLEXT_instancing_dependencies SF_GLAD_GL_VERSION_3_3, glDrawArraysInstanced, glVertexAttribDivisor
+
+// Core since 3.2 - programmable pipeline of core profile contexts
+// Only used when the context doesn't provide the fixed-function pipeline
+#define GLEXT_core_profile                     SF_GLAD_GL_VERSION_3_2
+#define GLEXT_core_GL_VERTEX_SHADER            GL_VERTEX_SHADER
+#define GLEXT_core_GL_FRAGMENT_SHADER          GL_FRAGMENT_SHADER
+#define GLEXT_core_GL_COMPILE_STATUS           GL_COMPILE_STATUS
+#define GLEXT_core_GL_LINK_STATUS              GL_LINK_STATUS
+#define GLEXT_core_GL_INFO_LOG_LENGTH          GL_INFO_LOG_LENGTH
+#define GLEXT_core_GL_CONTEXT_PROFILE_MASK     GL_CONTEXT_PROFILE_MASK
+#define GLEXT_core_GL_CONTEXT_CORE_PROFILE_BIT GL_CONTEXT_CORE_PROFILE_BIT
+#define GLEXT_core_glCreateShader              glCreateShader
+#define GLEXT_core_glShaderSource              glShaderSource
+#define GLEXT_core_glCompileShader             glCompileShader
+#define GLEXT_core_glGetShaderiv               glGetShaderiv
+#define GLEXT_core_glGetShaderInfoLog          glGetShaderInfoLog
+#define GLEXT_core_glDeleteShader              glDeleteShader
+#define GLEXT_core_glCreateProgram             glCreateProgram
+#define GLEXT_core_glAttachShader              glAttachShader
+#define GLEXT_core_glBindAttribLocation        glBindAttribLocation
+#define GLEXT_core_glLinkProgram               glLinkProgram
+#define GLEXT_core_glGetProgramiv              glGetProgramiv
+#define GLEXT_core_glGetProgramInfoLog         glGetProgramInfoLog
+#define GLEXT_core_glDeleteProgram             glDeleteProgram
+#define GLEXT_core_glUseProgram                glUseProgram
+#define GLEXT_core_glGetUniformLocation        glGetUniformLocation
+#define GLEXT_core_glUniform1i                 glUniform1i
+#define GLEXT_core_glUniformMatrix4fv          glUniformMatrix4fv
+#define GLEXT_core_glGenVertexArrays           glGenVertexArrays
+#define GLEXT_core_glDeleteVertexArrays        glDeleteVertexArrays
+#define GLEXT_core_glBindVertexArray           glBindVertexArray
+#define GLEXT_core_glEnableVertexAttribArray   glEnableVertexAttribArray
+#define GLEXT_core_glVertexAttribPointer       glVertexAttribPointer
+#define GLEXT_core_glDisableVertexAttribArray  glDisableVertexAttribArray
+#define GLEXT_core_glUniform4fv                glUniform4fv
+
+#define GLEXT_core_profile_dependencies                                                                                \
+    SF_GLAD_GL_VERSION_3_2, glCreateShader, glShaderSource, glCompileShader, glGetShaderiv, glGetShaderInfoLog,        \
+        glDeleteShader, glCreateProgram, glAttachShader, glBindAttribLocation, glLinkProgram, glGetProgramiv,          \
+        glGetProgramInfoLog, glDeleteProgram, glUseProgram, glGetUniformLocation, glUniform1i, glUniformMatrix4fv,     \
+        glGenVertexArrays, glDeleteVertexArrays, glBindVertexArray, glEnableVertexAttribArray, glVertexAttribPointer,  \
+        glDisableVertexAttribArray, glUniform4fv
+
 #endif
 
+// Compressed texture formats - EXT_texture_compression_s3tc, ARB_texture_compression_rgtc,
+// ARB_texture_compression_bptc, ARB_ES3_compatibility, KHR_texture_compression_astc_ldr
+// The tokens are the same in OpenGL and OpenGL ES, availability is checked at runtime
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1                 0x83F1
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3                 0x83F2
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5                 0x83F3
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1           0x8C4D
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3           0x8C4E
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5           0x8C4F
+#define GLEXT_GL_COMPRESSED_RED_RGTC1                      0x8DBB
+#define GLEXT_GL_COMPRESSED_RG_RGTC2                       0x8DBD
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM                0x8E8C
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM          0x8E8D
+#define GLEXT_GL_COMPRESSED_RGB8_ETC2                      0x9274
+#define GLEXT_GL_COMPRESSED_SRGB8_ETC2                     0x9275
+#define GLEXT_GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2  0x9276
+#define GLEXT_GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9277
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC                 0x9278
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC          0x9279
+// The other ASTC block sizes follow 4x4 in increasing order
+#define GLEXT_GL_COMPRESSED_RGBA_ASTC_4x4                  0x93B0
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4          0x93D0
+
 // OpenGL Versions
 #define GLEXT_GL_VERSION_1_0 SF_GLAD_GL_VERSION_1_0
 #define GLEXT_GL_VERSION_1_1 SF_GLAD_GL_VERSION_1_1
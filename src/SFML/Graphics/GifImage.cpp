@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GifImage.hpp>
+
+#include <SFML/System/Err.hpp>
+
+// stb_image only exposes whole animations, its frame by frame decoder is private;
+// a static copy limited to gif is compiled here to reach it without clashing with the one of Image.cpp
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_GIF
+#define STBI_NO_STDIO
+#include <stb_image.h>
+
+#include <array>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+namespace GifImageImpl
+{
+// Browsers display frames with a delay of less than 20 ms for 100 ms, and gif files are authored accordingly
+constexpr sf::Time minimumDelay   = sf::milliseconds(20);
+constexpr sf::Time substituteDelay = sf::milliseconds(100);
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getColorTableSize(std::uint8_t flags)
+{
+    return (flags & 0x80) ? 3 * (std::size_t{2} << (flags & 0x07)) : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int readUint16(const std::uint8_t* bytes)
+{
+    return bytes[0] | (static_cast<unsigned int>(bytes[1]) << 8);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool skipSubBlocks(const std::uint8_t* bytes, std::size_t size, std::size_t& position)
+{
+    while (position < size)
+    {
+        const std::uint8_t length = bytes[position++];
+        if (length == 0)
+            return true;
+
+        position += length;
+    }
+
+    return false;
+}
+} // namespace GifImageImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+struct GifDecoder::State
+{
+    ////////////////////////////////////////////////////////////
+    ~State()
+    {
+        reset();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void reset()
+    {
+        STBI_FREE(gif.out);
+        STBI_FREE(gif.background);
+        STBI_FREE(gif.history);
+        std::memset(&gif, 0, sizeof(gif));
+        stbi__start_mem(&context, data, static_cast<int>(size));
+        nextFrame = 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const stbi_uc*                           data{};       //!< Data of the file
+    std::size_t                              size{};       //!< Size of the data, in bytes
+    std::size_t                              frameCount{}; //!< Number of frames of the file
+    std::size_t                              nextFrame{};  //!< Index of the next frame to decode
+    stbi__context                            context{};    //!< Reading position of stb_image
+    stbi__gif                                gif{};        //!< Decoding state of stb_image
+    std::array<std::vector<std::uint8_t>, 2> history;      //!< Last two frames, to restore the previous one
+};
+
+
+////////////////////////////////////////////////////////////
+std::optional<GifInfo> readGifInfo(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    if (!bytes || (size < 13) || ((std::memcmp(bytes, "GIF87a", 6) != 0) && (std::memcmp(bytes, "GIF89a", 6) != 0)))
+        return std::nullopt;
+
+    GifInfo info;
+    info.size = {GifImageImpl::readUint16(bytes + 6), GifImageImpl::readUint16(bytes + 8)};
+    if ((info.size.x == 0) || (info.size.y == 0))
+        return std::nullopt;
+
+    // Walk through the blocks to count the frames, reading their delays from the graphic control extensions
+    std::size_t position = 13 + GifImageImpl::getColorTableSize(bytes[10]);
+    Time        delay;
+    while (position < size)
+    {
+        const std::uint8_t tag = bytes[position++];
+        if (tag == 0x21)
+        {
+            if (position >= size)
+                break;
+
+            const std::uint8_t label = bytes[position++];
+            if ((label == 0xF9) && (position + 5 <= size) && (bytes[position] == 4))
+                delay = milliseconds(10 * static_cast<std::int32_t>(GifImageImpl::readUint16(bytes + position + 2)));
+
+            if (!GifImageImpl::skipSubBlocks(bytes, size, position))
+                break;
+        }
+        else if (tag == 0x2C)
+        {
+            if (position + 10 > size)
+                break;
+
+            position += 9 + GifImageImpl::getColorTableSize(bytes[position + 8]) + 1;
+            if (!GifImageImpl::skipSubBlocks(bytes, size, position))
+                break;
+
+            info.delays.push_back(delay < GifImageImpl::minimumDelay ? GifImageImpl::substituteDelay : delay);
+            delay = Time::Zero;
+        }
+        else
+        {
+            // Trailer, or garbage after the last frame
+            break;
+        }
+    }
+
+    if (info.delays.empty())
+        return std::nullopt;
+
+    return info;
+}
+
+
+////////////////////////////////////////////////////////////
+GifDecoder::GifDecoder() = default;
+
+
+////////////////////////////////////////////////////////////
+GifDecoder::~GifDecoder() = default;
+
+
+////////////////////////////////////////////////////////////
+void GifDecoder::open(const void* data, std::size_t size, const GifInfo& info)
+{
+    if (!m_state)
+        m_state = std::make_unique<State>();
+
+    m_state->data       = static_cast<const stbi_uc*>(data);
+    m_state->size       = size;
+    m_state->frameCount = info.delays.size();
+    m_state->reset();
+
+    const std::size_t frameSize = std::size_t{info.size.x} * info.size.y * 4;
+    for (std::vector<std::uint8_t>& frame : m_state->history)
+        frame.resize(frameSize);
+}
+
+
+////////////////////////////////////////////////////////////
+void GifDecoder::rewind()
+{
+    m_state->reset();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t GifDecoder::getNextFrame() const
+{
+    return m_state->nextFrame;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GifDecoder::decode(std::uint8_t* pixels)
+{
+    State& state = *m_state;
+    if (state.nextFrame >= state.frameCount)
+        return false;
+
+    // The frame before the previous one is stored in the slot the new one replaces
+    std::vector<std::uint8_t>& slot     = state.history[state.nextFrame % 2];
+    stbi_uc*                   twoBack  = state.nextFrame >= 2 ? slot.data() : nullptr;
+    int                        channels = 0;
+    const stbi_uc* frame = stbi__gif_load_next(&state.context, &state.gif, &channels, STBI_rgb_alpha, twoBack);
+    if (!frame || (frame == reinterpret_cast<stbi_uc*>(&state.context)))
+    {
+        if (!frame)
+            err() << "Failed to decode gif frame. Reason: " << stbi_failure_reason() << std::endl;
+
+        // Don't leave the decoder in the middle of a frame
+        state.reset();
+        return false;
+    }
+
+    std::memcpy(slot.data(), frame, slot.size());
+    std::memcpy(pixels, frame, slot.size());
+    ++state.nextFrame;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GifDecoder::decode(std::size_t frame, std::uint8_t* pixels)
+{
+    if (frame < m_state->nextFrame)
+        rewind();
+
+    while (m_state->nextFrame <= frame)
+    {
+        if (!decode(pixels))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace sf::priv
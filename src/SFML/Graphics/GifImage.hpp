@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Size and frame delays of a gif file
+///
+////////////////////////////////////////////////////////////
+struct GifInfo
+{
+    Vector2u          size;   //!< Size of the frames, in pixels
+    std::vector<Time> delays; //!< Time each frame is displayed
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Read the size and the frame delays of a gif file
+///
+/// Only the structure of the file is parsed, the frames
+/// aren't decoded. Frames truncated at the end of the data
+/// are ignored.
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return Information about the file, or `std::nullopt` if it isn't a valid gif file
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<GifInfo> readGifInfo(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Incremental decoder of gif files
+///
+/// The frames of an animated gif are drawn on top of each
+/// other, so they can only be decoded sequentially; the
+/// decoder keeps the state needed to produce the next one.
+///
+////////////////////////////////////////////////////////////
+class GifDecoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    GifDecoder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~GifDecoder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    GifDecoder(const GifDecoder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    GifDecoder& operator=(const GifDecoder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start decoding a gif file
+    ///
+    /// The data must stay valid while the frames are decoded.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data, in bytes
+    /// \param info Information about the file, as returned by readGifInfo
+    ///
+    ////////////////////////////////////////////////////////////
+    void open(const void* data, std::size_t size, const GifInfo& info);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Go back to the first frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void rewind();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of the frame returned by the next call to decode
+    ///
+    /// \return Index of the next frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getNextFrame() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the next frame
+    ///
+    /// \param pixels Buffer receiving the 32-bit RGBA pixels of the frame
+    ///
+    /// \return True if the frame was decoded, false if there are no more frames or the file is invalid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool decode(std::uint8_t* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode a given frame
+    ///
+    /// The decoder rewinds if the frame was already passed,
+    /// and decodes all the frames before it otherwise.
+    ///
+    /// \param frame  Index of the frame to decode
+    /// \param pixels Buffer receiving the 32-bit RGBA pixels of the frame
+    ///
+    /// \return True if the frame was decoded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool decode(std::size_t frame, std::uint8_t* pixels);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct State;
+    std::unique_ptr<State> m_state; //!< State of stb_image's gif decoder
+};
+
+} // namespace sf::priv
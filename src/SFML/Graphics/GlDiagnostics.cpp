@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GlDiagnostics.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace GlDiagnosticsImpl
+{
+#ifdef SFML_DEBUG
+constexpr sf::GlDiagnostics::Mode defaultMode = sf::GlDiagnostics::Mode::CheckErrors;
+#else
+constexpr sf::GlDiagnostics::Mode defaultMode = sf::GlDiagnostics::Mode::None;
+#endif
+
+// Read by glCheck after every OpenGL call, so kept out of any lazily initialized object
+std::atomic<sf::GlDiagnostics::Mode> mode{defaultMode};
+std::atomic<std::uint64_t>           errorCount{};
+
+// Set once the callback has been installed in a context, until then no context has to be updated
+std::atomic<bool> debugOutputUsed{};
+
+// Contexts in which the debug output callback is currently installed
+struct DebugOutputContexts
+{
+    std::mutex                              mutex;
+    std::unordered_map<std::uint64_t, bool> enabled;
+};
+
+DebugOutputContexts& getDebugOutputContexts()
+{
+    static DebugOutputContexts contexts;
+    return contexts;
+}
+
+// Called by the driver, possibly from one of its own threads
+void GLAD_API_PTR debugMessageCallback(GLenum /* source */,
+                                       GLenum type,
+                                       GLuint /* id */,
+                                       GLenum severity,
+                                       GLsizei length,
+                                       const GLchar* message,
+                                       const void* /* userParam */)
+{
+    const std::string_view text(message, length < 0 ? std::char_traits<char>::length(message) : std::size_t(length));
+
+    if ((type == GLEXT_GL_DEBUG_TYPE_ERROR) || (severity == GLEXT_GL_DEBUG_SEVERITY_HIGH))
+    {
+        sf::priv::countGlError();
+        sf::err() << "OpenGL reported an error:\n   " << text << std::endl;
+    }
+    else
+    {
+        sf::err(sf::LogSeverity::Warning) << "OpenGL reported:\n   " << text << std::endl;
+    }
+}
+} // namespace GlDiagnosticsImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void GlDiagnostics::setMode(Mode mode)
+{
+    GlDiagnosticsImpl::mode = mode;
+
+    // Other contexts are updated when a render target is activated in them
+    if (Context::getActiveContextId() != 0)
+        priv::updateGlDebugOutput();
+}
+
+
+////////////////////////////////////////////////////////////
+GlDiagnostics::Mode GlDiagnostics::getMode()
+{
+    return GlDiagnosticsImpl::mode;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t GlDiagnostics::getErrorCount()
+{
+    return GlDiagnosticsImpl::errorCount;
+}
+
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+bool isGlErrorCheckEnabled()
+{
+    return GlDiagnosticsImpl::mode.load(std::memory_order_relaxed) == GlDiagnostics::Mode::CheckErrors;
+}
+
+
+////////////////////////////////////////////////////////////
+void countGlError()
+{
+    ++GlDiagnosticsImpl::errorCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void updateGlDebugOutput()
+{
+    const bool enable = GlDiagnostics::getMode() == GlDiagnostics::Mode::DebugOutput;
+
+    // Render targets call this function whenever they are activated, don't lock until it's needed
+    if (!enable && !GlDiagnosticsImpl::debugOutputUsed.load(std::memory_order_relaxed))
+        return;
+
+    if (enable)
+        GlDiagnosticsImpl::debugOutputUsed = true;
+
+    // Contexts start without the callback, only touch the ones that need to change
+    {
+        GlDiagnosticsImpl::DebugOutputContexts& contexts = GlDiagnosticsImpl::getDebugOutputContexts();
+        const std::lock_guard                   lock(contexts.mutex);
+
+        bool& enabled = contexts.enabled[Context::getActiveContextId()];
+        if (enabled == enable)
+            return;
+
+        enabled = enable;
+    }
+
+    // Make sure that extensions are initialized
+    ensureExtensionsInit();
+
+    if (!GLEXT_debug)
+    {
+        if (enable)
+            err(LogSeverity::Warning) << "OpenGL debug output is not supported, no error will be reported" << std::endl;
+
+        return;
+    }
+
+    if (enable)
+    {
+        // Report everything except notifications, which some drivers send for every buffer allocation
+        const GLenum dontCare     = GLEXT_GL_DONT_CARE;
+        const GLenum notification = GLEXT_GL_DEBUG_SEVERITY_NOTIFICATION;
+        glCheck(GLEXT_glDebugMessageControl(dontCare, dontCare, dontCare, 0, nullptr, GL_TRUE));
+        glCheck(GLEXT_glDebugMessageControl(dontCare, dontCare, notification, 0, nullptr, GL_FALSE));
+        glCheck(GLEXT_glDebugMessageCallback(GlDiagnosticsImpl::debugMessageCallback, nullptr));
+
+        // Let the driver report messages asynchronously, so that it never has to wait
+        glCheck(glDisable(GLEXT_GL_DEBUG_OUTPUT_SYNCHRONOUS));
+        glCheck(glEnable(GLEXT_GL_DEBUG_OUTPUT));
+    }
+    else
+    {
+        glCheck(glDisable(GLEXT_GL_DEBUG_OUTPUT));
+        glCheck(GLEXT_glDebugMessageCallback(nullptr, nullptr));
+    }
+}
+
+} // namespace priv
+} // namespace sf
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GlyphAtlas.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::optional<GlyphAtlas> GlyphAtlas::create(unsigned int maximumSize)
+{
+    auto texture = Texture::loadFromImage(makeImage({128, 128}));
+    if (!texture)
+    {
+        err() << "Failed to create glyph atlas texture" << std::endl;
+        return std::nullopt;
+    }
+
+    texture->setSmooth(true);
+    return GlyphAtlas(std::move(*texture), maximumSize);
+}
+
+
+////////////////////////////////////////////////////////////
+GlyphAtlas::GlyphAtlas(Texture&& texture, unsigned int maximumSize) :
+m_texture(std::move(texture)),
+m_packer(m_texture.getSize()),
+m_maximumSize(maximumSize)
+{
+    resetPacker();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& GlyphAtlas::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void GlyphAtlas::setSmooth(bool smooth)
+{
+    m_texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlyphAtlas::isSmooth() const
+{
+    return m_texture.isSmooth();
+}
+
+
+////////////////////////////////////////////////////////////
+void GlyphAtlas::setMaximumSize(unsigned int size)
+{
+    m_maximumSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GlyphAtlas::getMaximumSize() const
+{
+    return m_maximumSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void GlyphAtlas::clear()
+{
+    // Replace the texture so that its users notice that the glyphs are gone
+    if (auto texture = Texture::loadFromImage(makeImage(m_texture.getSize())))
+    {
+        texture->setSmooth(m_texture.isSmooth());
+        m_texture.swap(*texture);
+    }
+    else
+    {
+        err() << "Failed to create glyph atlas texture" << std::endl;
+        m_texture.update(makeImage(m_texture.getSize()));
+    }
+
+    resetPacker();
+    ++m_generation;
+}
+
+
+////////////////////////////////////////////////////////////
+Image GlyphAtlas::makeImage(const Vector2u& size)
+{
+    // Make sure that the texture is initialized by default
+    Image image(size, Color::Transparent);
+
+    // Reserve a 2x2 white square for texturing underlines
+    for (unsigned int x = 0; x < 2; ++x)
+        for (unsigned int y = 0; y < 2; ++y)
+            image.setPixel({x, y}, Color::White);
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IntRect> GlyphAtlas::allocate(const Vector2u& size, unsigned int maximumSize)
+{
+    for (;;)
+    {
+        // Find a place for the rectangle in the free space of the texture
+        if (const std::optional<Rect<unsigned int>> rect = m_packer.insert(size))
+            return IntRect(*rect);
+
+        // Not enough space: resize the texture if possible
+        const Vector2u textureSize = m_texture.getSize();
+        if ((textureSize.x * 2 > maximumSize) || (textureSize.y * 2 > maximumSize))
+            return std::nullopt;
+
+        // Make the texture 2 times bigger
+        auto newTexture = Texture::create(textureSize * 2u);
+        if (!newTexture)
+        {
+            err() << "Failed to create new glyph atlas texture" << std::endl;
+            return std::nullopt;
+        }
+
+        newTexture->setSmooth(m_texture.isSmooth());
+        newTexture->update(m_texture);
+        m_texture.swap(*newTexture);
+        m_packer.grow(m_texture.getSize());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GlyphAtlas::resetPacker()
+{
+    // Keep the white square used for underlines out of reach of the glyphs
+    m_packer.clear();
+    [[maybe_unused]] const auto whiteSquare = m_packer.insert({2, 2});
+}
+
+} // namespace sf
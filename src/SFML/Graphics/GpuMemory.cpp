@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GpuMemory.hpp>
+#include <SFML/Graphics/GpuMemoryTracker.hpp>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace GpuMemoryImpl
+{
+struct Tracker
+{
+    std::mutex                                                          mutex;
+    std::array<sf::GpuMemory::Statistics, sf::GpuMemory::CategoryCount> statistics;
+};
+
+Tracker& getTracker()
+{
+    static Tracker tracker;
+    return tracker;
+}
+} // namespace GpuMemoryImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+GpuMemory::Statistics GpuMemory::getStatistics(Category category)
+{
+    GpuMemoryImpl::Tracker& tracker = GpuMemoryImpl::getTracker();
+    const std::lock_guard   lock(tracker.mutex);
+
+    return tracker.statistics[static_cast<std::size_t>(category)];
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t GpuMemory::getTotalUsage()
+{
+    GpuMemoryImpl::Tracker& tracker = GpuMemoryImpl::getTracker();
+    const std::lock_guard   lock(tracker.mutex);
+
+    std::uint64_t total = 0;
+    for (const Statistics& statistics : tracker.statistics)
+        total += statistics.bytes;
+
+    return total;
+}
+
+
+////////////////////////////////////////////////////////////
+void priv::setGpuMemoryUsage(GpuMemory::Category category, std::uint64_t& usage, std::uint64_t bytes)
+{
+    if (usage == bytes)
+        return;
+
+    GpuMemoryImpl::Tracker& tracker = GpuMemoryImpl::getTracker();
+    const std::lock_guard   lock(tracker.mutex);
+
+    GpuMemory::Statistics& statistics = tracker.statistics[static_cast<std::size_t>(category)];
+    if (usage == 0)
+        ++statistics.resourceCount;
+    else if (bytes == 0)
+        --statistics.resourceCount;
+
+    statistics.bytes     = statistics.bytes - usage + bytes;
+    statistics.peakBytes = std::max(statistics.peakBytes, statistics.bytes);
+    usage                = bytes;
+}
+
+} // namespace sf
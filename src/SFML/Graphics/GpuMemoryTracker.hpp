@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GpuMemory.hpp>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Report a change of the memory used by a resource
+///
+/// \a usage holds the memory currently reported for the
+/// resource; it is set to \a bytes. Reporting 0 bytes
+/// releases the resource from the statistics.
+///
+/// \param category Category of the resource
+/// \param usage    Memory reported so far for the resource, in bytes
+/// \param bytes    New memory used by the resource, in bytes
+///
+////////////////////////////////////////////////////////////
+void setGpuMemoryUsage(GpuMemory::Category category, std::uint64_t& usage, std::uint64_t bytes);
+
+} // namespace sf::priv
@@ -0,0 +1,258 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuProfiler.hpp>
+
+#include <utility>
+
+#include <cassert>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+GpuProfiler::Scope::Scope(GpuProfiler& profiler, std::string name) : m_profiler(profiler)
+{
+    m_profiler.beginScope(std::move(name));
+}
+
+
+////////////////////////////////////////////////////////////
+GpuProfiler::Scope::~Scope()
+{
+    m_profiler.endScope();
+}
+
+
+////////////////////////////////////////////////////////////
+GpuProfiler::GpuProfiler(RenderTarget& target) : m_target(target)
+{
+    if (m_target.activateForDrawing())
+    {
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        m_timerQueries = GLEXT_timer_query != 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+GpuProfiler::~GpuProfiler()
+{
+    if (!m_timerQueries)
+        return;
+
+    // The query objects live in the context of the target
+    if (m_target.activateForDrawing())
+    {
+        recycleQueries(m_frame);
+        for (const auto& records : m_pending)
+            recycleQueries(records);
+
+        if (!m_freeQueries.empty())
+            glCheck(GLEXT_glDeleteQueries(static_cast<GLsizei>(m_freeQueries.size()), m_freeQueries.data()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool GpuProfiler::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_timer_query != 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::beginScope(std::string name)
+{
+    // This also submits the pending batched geometry and activates the target
+    m_target.pushDebugGroup(name);
+
+    Record record;
+    record.timings.name  = std::move(name);
+    record.timings.depth = static_cast<unsigned int>(m_openScopes.size());
+    record.beginQuery    = queryTimestamp();
+    record.cpuBegin      = m_clock.getElapsedTime();
+    record.statistics    = m_target.getStatistics();
+
+    m_openScopes.push_back(m_frame.size());
+    m_frame.push_back(std::move(record));
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::endScope()
+{
+    assert(!m_openScopes.empty() && "GpuProfiler::endScope() No scope was begun");
+
+    // This also submits the pending batched geometry and activates the target
+    m_target.popDebugGroup();
+
+    Record&                         record     = m_frame[m_openScopes.back()];
+    const RenderTarget::Statistics& statistics = m_target.getStatistics();
+
+    record.endQuery             = queryTimestamp();
+    record.timings.cpuTime      = m_clock.getElapsedTime() - record.cpuBegin;
+    record.timings.drawCalls    = statistics.drawCalls - record.statistics.drawCalls;
+    record.timings.vertices     = statistics.vertices - record.statistics.vertices;
+    record.timings.stateChanges = statistics.stateChanges - record.statistics.stateChanges;
+
+    m_openScopes.pop_back();
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::endFrame()
+{
+    assert(m_openScopes.empty() && "GpuProfiler::endFrame() All scopes must be ended before the end of the frame");
+
+    m_pending.push_back(std::move(m_frame));
+    m_frame.clear();
+
+    if (m_timerQueries && !m_target.activateForDrawing())
+        return;
+
+    collectResults();
+
+    // Never wait for the GPU, drop the frames that take too long to complete instead
+    while (m_pending.size() > getMaxPendingFrames())
+    {
+        recycleQueries(m_pending.front());
+        m_pending.pop_front();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<GpuProfiler::Timings>& GpuProfiler::getResults() const
+{
+    return m_results;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GpuProfiler::queryTimestamp()
+{
+    if (!m_timerQueries)
+        return 0;
+
+    GLuint query = 0;
+
+    if (m_freeQueries.empty())
+    {
+        glCheck(GLEXT_glGenQueries(1, &query));
+    }
+    else
+    {
+        query = m_freeQueries.back();
+        m_freeQueries.pop_back();
+    }
+
+    // The timestamp is recorded once the GPU has executed all the previous commands
+    glCheck(GLEXT_glQueryCounter(query, GLEXT_GL_TIMESTAMP));
+
+    return query;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::collectResults()
+{
+    while (!m_pending.empty())
+    {
+        std::vector<Record>& records = m_pending.front();
+
+        // Stop at the first frame that the GPU has not completed yet
+        for (const Record& record : records)
+        {
+            for (const unsigned int query : {record.beginQuery, record.endQuery})
+            {
+                if (!query)
+                    continue;
+
+                GLint available = GL_FALSE;
+                glCheck(GLEXT_glGetQueryObjectiv(query, GLEXT_GL_QUERY_RESULT_AVAILABLE, &available));
+
+                if (available == GL_FALSE)
+                    return;
+            }
+        }
+
+        m_results.clear();
+
+        for (Record& record : records)
+        {
+            if (record.beginQuery && record.endQuery)
+            {
+                GLuint64 begin = 0;
+                GLuint64 end   = 0;
+                glCheck(GLEXT_glGetQueryObjectui64v(record.beginQuery, GLEXT_GL_QUERY_RESULT, &begin));
+                glCheck(GLEXT_glGetQueryObjectui64v(record.endQuery, GLEXT_GL_QUERY_RESULT, &end));
+
+                // Timestamps are in nanoseconds
+                if (end > begin)
+                    record.timings.gpuTime = microseconds(static_cast<std::int64_t>((end - begin) / 1000));
+            }
+
+            m_results.push_back(std::move(record.timings));
+        }
+
+        recycleQueries(records);
+        m_pending.pop_front();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::recycleQueries(const std::vector<Record>& records)
+{
+    for (const Record& record : records)
+    {
+        if (record.beginQuery)
+            m_freeQueries.push_back(record.beginQuery);
+
+        if (record.endQuery)
+            m_freeQueries.push_back(record.endQuery);
+    }
+}
+
+} // namespace sf
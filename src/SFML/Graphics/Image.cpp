@@ -26,9 +26,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageKernels.hpp>
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <SFML/Graphics/QoiImage.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/Activity.hpp>
@@ -41,12 +45,16 @@
 #include <stb_image_write.h>
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include <cassert>
+#include <cmath>
 #include <cstring>
 
 
@@ -89,6 +97,212 @@ struct StbDeleter
     }
 };
 using StbPtr = std::unique_ptr<stbi_uc, StbDeleter>;
+
+// The png settings of stb_image_write are global variables, encoders changing them must not overlap
+std::mutex pngSettingsMutex;
+
+std::unique_lock<std::mutex> applyPngSettings(const sf::ImageSaveOptions& options)
+{
+    std::unique_lock lock(pngSettingsMutex);
+
+    stbi_write_png_compression_level = options.pngCompressionLevel;
+
+    switch (options.pngFilter)
+    {
+        case sf::ImageSaveOptions::PngFilter::Adaptive:
+            stbi_write_force_png_filter = -1;
+            break;
+        case sf::ImageSaveOptions::PngFilter::None:
+            stbi_write_force_png_filter = 0;
+            break;
+        case sf::ImageSaveOptions::PngFilter::Sub:
+            stbi_write_force_png_filter = 1;
+            break;
+        case sf::ImageSaveOptions::PngFilter::Up:
+            stbi_write_force_png_filter = 2;
+            break;
+        case sf::ImageSaveOptions::PngFilter::Average:
+            stbi_write_force_png_filter = 3;
+            break;
+        case sf::ImageSaveOptions::PngFilter::Paeth:
+            stbi_write_force_png_filter = 4;
+            break;
+    }
+
+    return lock;
+}
+
+// Decode a qoi file into a new pixel array
+std::optional<std::pair<sf::Vector2u, std::vector<std::uint8_t>>> decodeQoi(const void* data, std::size_t size)
+{
+    const auto imageSize = sf::priv::getQoiImageSize(data, size);
+    if (!imageSize)
+        return std::nullopt;
+
+    std::vector<std::uint8_t> pixels(std::size_t{imageSize->x} * imageSize->y * 4);
+    if (!sf::priv::decodeQoiImage(data, size, pixels.data()))
+        return std::nullopt;
+
+    return std::pair(*imageSize, std::move(pixels));
+}
+
+// Value of a resampling filter at a distance from its center, in filter units
+float filterWeight(sf::Image::ResamplingFilter filter, float x)
+{
+    switch (filter)
+    {
+        case sf::Image::ResamplingFilter::Box:
+            return (x >= -0.5f) && (x < 0.5f) ? 1.f : 0.f;
+        case sf::Image::ResamplingFilter::Bilinear:
+            return std::max(1.f - std::abs(x), 0.f);
+        case sf::Image::ResamplingFilter::Lanczos3:
+        {
+            if (std::abs(x) >= 3.f)
+                return 0.f;
+            if (std::abs(x) < 1e-5f)
+                return 1.f;
+
+            const float pi = 3.14159265358979f;
+            return 3.f * std::sin(pi * x) * std::sin(pi * x / 3.f) / (pi * pi * x * x);
+        }
+    }
+
+    return 0.f;
+}
+
+// Source pixels contributing to each destination pixel along one axis
+struct ResamplingWeights
+{
+    std::size_t              taps{};  // Number of source pixels per destination pixel
+    std::vector<std::size_t> firsts;  // First source pixel of each destination pixel
+    std::vector<float>       weights; // Normalized weights, taps per destination pixel
+};
+
+ResamplingWeights computeResamplingWeights(unsigned int                sourceSize,
+                                           unsigned int                size,
+                                           sf::Image::ResamplingFilter filter)
+{
+    ResamplingWeights result;
+    result.firsts.resize(size);
+
+    // Identical sizes only need a copy
+    if (sourceSize == size)
+    {
+        result.taps = 1;
+        result.weights.assign(size, 1.f);
+        for (unsigned int i = 0; i < size; ++i)
+            result.firsts[i] = i;
+        return result;
+    }
+
+    float radius = 1.f;
+    if (filter == sf::Image::ResamplingFilter::Box)
+        radius = 0.5f;
+    else if (filter == sf::Image::ResamplingFilter::Lanczos3)
+        radius = 3.f;
+
+    // When shrinking, the filter is widened to cover all the source pixels
+    const float scale       = static_cast<float>(sourceSize) / static_cast<float>(size);
+    const float filterScale = std::max(scale, 1.f);
+    const float support     = radius * filterScale;
+    result.taps = std::min(static_cast<std::size_t>(std::ceil(support * 2)) + 1, std::size_t{sourceSize});
+    result.weights.resize(std::size_t{size} * result.taps);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        // Keep all the taps inside the source, the ones out of the filter get a null weight
+        const float center = (static_cast<float>(i) + 0.5f) * scale;
+        const auto  first  = static_cast<std::size_t>(std::max(std::floor(center - support), 0.f));
+        result.firsts[i]   = std::min(first, sourceSize - result.taps);
+
+        float* weights = result.weights.data() + i * result.taps;
+        float  sum     = 0.f;
+        for (std::size_t j = 0; j < result.taps; ++j)
+        {
+            const float x = (static_cast<float>(result.firsts[i] + j) + 0.5f - center) / filterScale;
+            weights[j]    = filterWeight(filter, x);
+            sum += weights[j];
+        }
+
+        if (sum != 0.f)
+        {
+            for (std::size_t j = 0; j < result.taps; ++j)
+                weights[j] /= sum;
+        }
+        else
+        {
+            // No source pixel is covered by the filter, fall back to the nearest one
+            weights[std::min(static_cast<std::size_t>(center) - result.firsts[i], result.taps - 1)] = 1.f;
+        }
+    }
+
+    return result;
+}
+
+// Resample RGBA pixels with a separable filter, in premultiplied alpha
+std::vector<std::uint8_t> resamplePixels(const std::vector<std::uint8_t>& pixels,
+                                         sf::Vector2u                     sourceSize,
+                                         sf::Vector2u                     size,
+                                         sf::Image::ResamplingFilter      filter,
+                                         sf::ExecutionPolicy              policy)
+{
+    std::vector<std::uint8_t> result(std::size_t{size.x} * size.y * 4);
+    if (pixels.empty() || result.empty())
+        return result;
+
+    const ResamplingWeights horizontal = computeResamplingWeights(sourceSize.x, size.x, filter);
+    const ResamplingWeights vertical   = computeResamplingWeights(sourceSize.y, size.y, filter);
+
+    // Horizontal pass: each source row becomes a row of the intermediate image
+    std::vector<float> intermediate(std::size_t{size.x} * sourceSize.y * 4);
+    sf::priv::forEachRange(policy,
+                           sourceSize.y,
+                           std::size_t{sourceSize.x} * horizontal.taps * 4,
+                           [&](std::size_t begin, std::size_t end)
+                           {
+                               std::vector<float> row(std::size_t{sourceSize.x} * 4);
+                               for (std::size_t y = begin; y < end; ++y)
+                               {
+                                   sf::priv::premultiplyPixels(pixels.data() + y * sourceSize.x * 4,
+                                                               row.data(),
+                                                               sourceSize.x);
+                                   sf::priv::resamplePixels(row.data(),
+                                                            intermediate.data() + y * size.x * 4,
+                                                            size.x,
+                                                            horizontal.firsts.data(),
+                                                            horizontal.weights.data(),
+                                                            horizontal.taps);
+                               }
+                           });
+
+    // Vertical pass: each destination row is a weighted sum of intermediate rows
+    sf::priv::forEachRange(policy,
+                           size.y,
+                           std::size_t{size.x} * vertical.taps * 4,
+                           [&](std::size_t begin, std::size_t end)
+                           {
+                               std::vector<float> row(std::size_t{size.x} * 4);
+                               for (std::size_t y = begin; y < end; ++y)
+                               {
+                                   std::fill(row.begin(), row.end(), 0.f);
+                                   for (std::size_t j = 0; j < vertical.taps; ++j)
+                                   {
+                                       const float weight = vertical.weights[y * vertical.taps + j];
+                                       if (weight != 0.f)
+                                       {
+                                           const std::size_t source = vertical.firsts[y] + j;
+                                           sf::priv::accumulatePixels(intermediate.data() + source * size.x * 4,
+                                                                      row.data(),
+                                                                      size.x,
+                                                                      weight);
+                                       }
+                                   }
+                                   sf::priv::unpremultiplyPixels(row.data(), result.data() + y * size.x * 4, size.x);
+                               }
+                           });
+
+    return result;
+}
 } // namespace
 
 
@@ -174,11 +388,34 @@ std::optional<Image> Image::loadFromFile(const std::filesystem::path& filename)
 
 #endif
 
+    // Map the file, so that it is decoded straight from the operating system's file cache
+    MappedFileInputStream file;
+    if (!file.open(filename))
+    {
+        err() << "Failed to load image\n"
+              << formatDebugPathInfo(filename) << "\nReason: Unable to open file" << std::endl;
+        return std::nullopt;
+    }
+
+    // Qoi files are decoded by SFML
+    const auto fileSize = static_cast<std::size_t>(file.getSize());
+    if (priv::isQoiImage(file.getData(), fileSize))
+    {
+        if (auto decoded = decodeQoi(file.getData(), fileSize))
+            return Image(decoded->first, std::move(decoded->second));
+
+        err() << "Failed to load image\n"
+              << formatDebugPathInfo(filename) << "\nReason: Invalid or truncated qoi file" << std::endl;
+        return std::nullopt;
+    }
+
     // Load the image and get a pointer to the pixels in memory
-    int        width    = 0;
-    int        height   = 0;
-    int        channels = 0;
-    const auto ptr      = StbPtr(stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha));
+    int         width    = 0;
+    int         height   = 0;
+    int         channels = 0;
+    const auto* buffer   = static_cast<const unsigned char*>(file.getData());
+    const auto  ptr      = StbPtr(
+        stbi_load_from_memory(buffer, static_cast<int>(file.getSize()), &width, &height, &channels, STBI_rgb_alpha));
 
     if (ptr)
     {
@@ -201,6 +438,16 @@ std::optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
     // Check input parameters
     if (data && size)
     {
+        // Qoi files are decoded by SFML
+        if (priv::isQoiImage(data, size))
+        {
+            if (auto decoded = decodeQoi(data, size))
+                return Image(decoded->first, std::move(decoded->second));
+
+            err() << "Failed to load image from memory. Reason: Invalid or truncated qoi file" << std::endl;
+            return std::nullopt;
+        }
+
         // Load the image and get a pointer to the pixels in memory
         int         width    = 0;
         int         height   = 0;
@@ -232,6 +479,13 @@ std::optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
 ////////////////////////////////////////////////////////////
 std::optional<Image> Image::loadFromStream(InputStream& stream)
 {
+    // Streams that read from memory are decoded in place, without copying their contents
+    if (const void* data = getStreamData(stream))
+    {
+        if (const std::int64_t size = stream.getSize(); size > 0)
+            return loadFromMemory(data, static_cast<std::size_t>(size));
+    }
+
     // Make sure that the stream's reading position is at the beginning
     if (stream.seek(0) == -1)
     {
@@ -239,6 +493,30 @@ std::optional<Image> Image::loadFromStream(InputStream& stream)
         return std::nullopt;
     }
 
+    // Qoi files are decoded by SFML, from a copy of the whole stream
+    char magic[4]{};
+    if (stream.read(magic, sizeof(magic)) == sizeof(magic) && priv::isQoiImage(magic, sizeof(magic)))
+    {
+        if (const std::int64_t size = stream.getSize(); size > 0)
+        {
+            std::vector<std::uint8_t> data(static_cast<std::size_t>(size));
+            if (stream.seek(0) == 0 && stream.read(data.data(), size) == size)
+            {
+                if (auto decoded = decodeQoi(data.data(), data.size()))
+                    return Image(decoded->first, std::move(decoded->second));
+            }
+        }
+
+        err() << "Failed to load image from stream. Reason: Invalid or truncated qoi file" << std::endl;
+        return std::nullopt;
+    }
+
+    if (stream.seek(0) == -1)
+    {
+        err() << "Failed to seek image stream" << std::endl;
+        return std::nullopt;
+    }
+
     // Setup the stb_image callbacks
     stbi_io_callbacks callbacks;
     callbacks.read = read;
@@ -265,7 +543,101 @@ std::optional<Image> Image::loadFromStream(InputStream& stream)
 
 
 ////////////////////////////////////////////////////////////
-bool Image::saveToFile(const std::filesystem::path& filename) const
+std::optional<Vector2u> Image::getSizeFromMemory(const void* data, std::size_t size)
+{
+    // Check input parameters
+    if (!data || !size)
+    {
+        err() << "Failed to read image size from memory, no data provided" << std::endl;
+        return std::nullopt;
+    }
+
+    if (priv::isQoiImage(data, size))
+    {
+        if (const auto imageSize = priv::getQoiImageSize(data, size))
+            return imageSize;
+
+        err() << "Failed to read image size from memory. Reason: Invalid qoi header" << std::endl;
+        return std::nullopt;
+    }
+
+    // Parse the header of the file
+    int         width    = 0;
+    int         height   = 0;
+    int         channels = 0;
+    const auto* buffer   = static_cast<const unsigned char*>(data);
+    if (!stbi_info_from_memory(buffer, static_cast<int>(size), &width, &height, &channels))
+    {
+        err() << "Failed to read image size from memory. Reason: " << stbi_failure_reason() << std::endl;
+        return std::nullopt;
+    }
+
+    return Vector2u(Vector2i(width, height));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> Image::decodeFromMemory(const void*   data,
+                                                std::size_t   size,
+                                                std::uint8_t* pixels,
+                                                std::size_t   capacity)
+{
+    if (!pixels)
+    {
+        err() << "Failed to decode image from memory, no destination buffer provided" << std::endl;
+        return std::nullopt;
+    }
+
+    // Make sure the pixels fit before decoding anything
+    const auto imageSize = getSizeFromMemory(data, size);
+    if (!imageSize)
+        return std::nullopt;
+
+    const std::size_t byteSize = std::size_t{imageSize->x} * std::size_t{imageSize->y} * 4;
+    if (byteSize > capacity)
+    {
+        err() << "Failed to decode image from memory, the destination buffer is too small "
+              << "(" << capacity << " bytes, " << byteSize << " needed)" << std::endl;
+        return std::nullopt;
+    }
+
+    // Qoi files are decoded by SFML, into a copy first so that the buffer is left unchanged on failure
+    if (priv::isQoiImage(data, size))
+    {
+        if (auto decoded = decodeQoi(data, size))
+        {
+            std::memcpy(pixels, decoded->second.data(), byteSize);
+            return imageSize;
+        }
+
+        err() << "Failed to decode image from memory. Reason: Invalid or truncated qoi file" << std::endl;
+        return std::nullopt;
+    }
+
+    // Load the image and get a pointer to the pixels in memory
+    int         width    = 0;
+    int         height   = 0;
+    int         channels = 0;
+    const auto* buffer   = static_cast<const unsigned char*>(data);
+    const auto  ptr      = StbPtr(
+        stbi_load_from_memory(buffer, static_cast<int>(size), &width, &height, &channels, STBI_rgb_alpha));
+
+    if (!ptr)
+    {
+        // Error, failed to load the image
+        err() << "Failed to decode image from memory. Reason: " << stbi_failure_reason() << std::endl;
+        return std::nullopt;
+    }
+
+    // stb_image always allocates its own output, hand it over to the caller's buffer
+    std::memcpy(pixels, ptr.get(), byteSize);
+
+    return imageSize;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::saveToFile(const std::filesystem::path& filename, const ImageSaveOptions& options) const
 {
     // Make sure the image is not empty
     if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
@@ -291,13 +663,28 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
         else if (extension == ".png")
         {
             // PNG format
+            const auto lock = applyPngSettings(options);
             if (stbi_write_png(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
                 return true;
         }
         else if (extension == ".jpg" || extension == ".jpeg")
         {
             // JPG format
-            if (stbi_write_jpg(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data(), 90))
+            if (stbi_write_jpg(filename.string().c_str(),
+                               convertedSize.x,
+                               convertedSize.y,
+                               4,
+                               m_pixels.data(),
+                               options.jpgQuality))
+                return true;
+        }
+        else if (extension == ".qoi")
+        {
+            // QOI format
+            const std::vector<std::uint8_t> buffer = priv::encodeQoiImage(m_size, m_pixels.data());
+
+            std::ofstream file(filename, std::ios_base::binary | std::ios_base::trunc);
+            if (file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())))
                 return true;
         }
         else
@@ -312,7 +699,8 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
 
 
 ////////////////////////////////////////////////////////////
-std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view format) const
+std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view        format,
+                                                              const ImageSaveOptions& options) const
 {
     // Make sure the image is not empty
     if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
@@ -338,15 +726,27 @@ std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view fo
         else if (specified == "png")
         {
             // PNG format
+            const auto lock = applyPngSettings(options);
             if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
                 return buffer;
         }
         else if (specified == "jpg" || specified == "jpeg")
         {
             // JPG format
-            if (stbi_write_jpg_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 90))
+            if (stbi_write_jpg_to_func(bufferFromCallback,
+                                       &buffer,
+                                       convertedSize.x,
+                                       convertedSize.y,
+                                       4,
+                                       m_pixels.data(),
+                                       options.jpgQuality))
                 return buffer;
         }
+        else if (specified == "qoi")
+        {
+            // QOI format
+            return priv::encodeQoiImage(m_size, m_pixels.data());
+        }
     }
 
     err() << "Failed to save image with format " << std::quoted(format) << std::endl;
@@ -354,6 +754,24 @@ std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view fo
 }
 
 
+////////////////////////////////////////////////////////////
+std::future<bool> Image::saveToFileAsync(const std::filesystem::path& filename, const ImageSaveOptions& options) const
+{
+    return std::async(std::launch::async,
+                      [image = *this, filename, options] { return image.saveToFile(filename, options); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<std::vector<std::uint8_t>>> Image::saveToMemoryAsync(std::string_view        format,
+                                                                                const ImageSaveOptions& options) const
+{
+    return std::async(std::launch::async,
+                      [image = *this, format = std::string(format), options]
+                      { return image.saveToMemory(format, options); });
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Image::getSize() const
 {
@@ -362,26 +780,34 @@ Vector2u Image::getSize() const
 
 
 ////////////////////////////////////////////////////////////
-void Image::createMaskFromColor(const Color& color, std::uint8_t alpha)
+void Image::createMaskFromColor(const Color& color, std::uint8_t alpha, ExecutionPolicy policy)
 {
     // Make sure that the image is not empty
     if (!m_pixels.empty())
     {
         // Replace the alpha of the pixels that match the transparent color
-        std::uint8_t* ptr = m_pixels.data();
-        std::uint8_t* end = ptr + m_pixels.size();
-        while (ptr < end)
-        {
-            if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-                ptr[3] = alpha;
-            ptr += 4;
-        }
+        const std::size_t rowSize = static_cast<std::size_t>(m_size.x) * 4;
+
+        priv::forEachRange(policy,
+                           m_size.y,
+                           rowSize,
+                           [&](std::size_t begin, std::size_t end)
+                           {
+                               priv::maskPixels(m_pixels.data() + begin * rowSize,
+                                                (end - begin) * m_size.x,
+                                                color,
+                                                alpha);
+                           });
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard]] bool Image::copy(const Image& source, const Vector2u& dest, const IntRect& sourceRect, bool applyAlpha)
+[[nodiscard]] bool Image::copy(const Image&    source,
+                               const Vector2u& dest,
+                               const IntRect&  sourceRect,
+                               bool            applyAlpha,
+                               ExecutionPolicy policy)
 {
     // Make sure that both images are valid
     if (source.m_size.x == 0 || source.m_size.y == 0 || m_size.x == 0 || m_size.y == 0)
@@ -415,54 +841,31 @@ void Image::createMaskFromColor(const Color& color, std::uint8_t alpha)
     const Vector2u dstSize(std::min(m_size.x - dest.x, srcRect.width), std::min(m_size.y - dest.y, srcRect.height));
 
     // Precompute as much as possible
-    const std::size_t  pitch     = static_cast<std::size_t>(dstSize.x) * 4;
-    const unsigned int srcStride = source.m_size.x * 4;
-    const unsigned int dstStride = m_size.x * 4;
+    const std::size_t pitch     = static_cast<std::size_t>(dstSize.x) * 4;
+    const std::size_t srcStride = static_cast<std::size_t>(source.m_size.x) * 4;
+    const std::size_t dstStride = static_cast<std::size_t>(m_size.x) * 4;
 
     const std::uint8_t* srcPixels = source.m_pixels.data() + (srcRect.left + srcRect.top * source.m_size.x) * 4;
     std::uint8_t*       dstPixels = m_pixels.data() + (dest.x + dest.y * m_size.x) * 4;
 
-    // Copy the pixels
-    if (applyAlpha)
-    {
-        // Interpolation using alpha values, pixel by pixel (slower)
-        for (unsigned int i = 0; i < dstSize.y; ++i)
-        {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
-            {
-                // Get a direct pointer to the components of the current pixel
-                const std::uint8_t* src = srcPixels + j * 4;
-                std::uint8_t*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const std::uint8_t srcAlpha = src[3];
-                const std::uint8_t dstAlpha = dst[3];
-                const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
-            }
-
-            srcPixels += srcStride;
-            dstPixels += dstStride;
-        }
-    }
-    else
-    {
-        // Optimized copy ignoring alpha values, row by row (faster)
-        for (unsigned int i = 0; i < dstSize.y; ++i)
-        {
-            std::memcpy(dstPixels, srcPixels, pitch);
-            srcPixels += srcStride;
-            dstPixels += dstStride;
-        }
-    }
+    // Copy the pixels, row by row
+    priv::forEachRange(policy,
+                       dstSize.y,
+                       pitch,
+                       [&](std::size_t begin, std::size_t end)
+                       {
+                           for (std::size_t i = begin; i < end; ++i)
+                           {
+                               const std::uint8_t* src = srcPixels + i * srcStride;
+                               std::uint8_t*       dst = dstPixels + i * dstStride;
+
+                               // Interpolation using alpha values (slower) or plain copy ignoring them (faster)
+                               if (applyAlpha)
+                                   priv::blendPixels(src, dst, dstSize.x);
+                               else
+                                   std::memcpy(dst, src, pitch);
+                           }
+                       });
 
     return true;
 }
@@ -511,48 +914,95 @@ const std::uint8_t* Image::getPixelsPtr() const
 
 
 ////////////////////////////////////////////////////////////
-void Image::flipHorizontally()
+void Image::flipHorizontally(ExecutionPolicy policy)
 {
     if (!m_pixels.empty())
     {
-        const std::size_t rowSize = m_size.x * 4;
-
-        for (std::size_t y = 0; y < m_size.y; ++y)
-        {
-            auto left = m_pixels.begin() + static_cast<std::vector<std::uint8_t>::iterator::difference_type>(y * rowSize);
-            auto right = m_pixels.begin() +
-                         static_cast<std::vector<std::uint8_t>::iterator::difference_type>((y + 1) * rowSize - 4);
+        const std::size_t rowSize = static_cast<std::size_t>(m_size.x) * 4;
+
+        priv::forEachRange(policy,
+                           m_size.y,
+                           rowSize,
+                           [&](std::size_t begin, std::size_t end)
+                           {
+                               for (std::size_t y = begin; y < end; ++y)
+                                   priv::reversePixels(m_pixels.data() + y * rowSize, m_size.x);
+                           });
+    }
+}
 
-            for (std::size_t x = 0; x < m_size.x / 2; ++x)
-            {
-                std::swap_ranges(left, left + 4, right);
 
-                left += 4;
-                right -= 4;
-            }
-        }
+////////////////////////////////////////////////////////////
+void Image::flipVertically(ExecutionPolicy policy)
+{
+    if (!m_pixels.empty())
+    {
+        const std::size_t rowSize = static_cast<std::size_t>(m_size.x) * 4;
+
+        // Each range of rows of the top half is swapped with its mirror in the bottom half
+        priv::forEachRange(policy,
+                           m_size.y / 2,
+                           rowSize * 2,
+                           [&](std::size_t begin, std::size_t end)
+                           {
+                               for (std::size_t y = begin; y < end; ++y)
+                               {
+                                   std::uint8_t* top    = m_pixels.data() + y * rowSize;
+                                   std::uint8_t* bottom = m_pixels.data() + (m_size.y - 1 - y) * rowSize;
+                                   std::swap_ranges(top, top + rowSize, bottom);
+                               }
+                           });
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void Image::flipVertically()
+void Image::premultiplyAlpha(ExecutionPolicy policy)
 {
     if (!m_pixels.empty())
     {
-        const auto rowSize = static_cast<std::vector<std::uint8_t>::iterator::difference_type>(m_size.x * 4);
+        const std::size_t rowSize = static_cast<std::size_t>(m_size.x) * 4;
 
-        auto top    = m_pixels.begin();
-        auto bottom = m_pixels.end() - rowSize;
+        priv::forEachRange(policy,
+                           m_size.y,
+                           rowSize,
+                           [&](std::size_t begin, std::size_t end)
+                           { priv::premultiplyAlpha(m_pixels.data() + begin * rowSize, (end - begin) * m_size.x); });
+    }
+}
 
-        for (std::size_t y = 0; y < m_size.y / 2; ++y)
-        {
-            std::swap_ranges(top, top + rowSize, bottom);
 
-            top += rowSize;
-            bottom -= rowSize;
-        }
+////////////////////////////////////////////////////////////
+void Image::resize(const Vector2u& size, ResamplingFilter filter, ExecutionPolicy policy)
+{
+    if (size == m_size)
+        return;
+
+    std::vector<std::uint8_t> newPixels = resamplePixels(m_pixels, m_size, size, filter, policy);
+    m_size                              = newPixels.empty() ? Vector2u() : size;
+    m_pixels.swap(newPixels);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Image> Image::generateMipChain(ResamplingFilter filter, ExecutionPolicy policy) const
+{
+    std::vector<Image> levels;
+    if (m_pixels.empty())
+        return levels;
+
+    // Each level is computed from the previous one, which is cheaper and as good with a box filter
+    Vector2u size = m_size;
+    while (size.x > 1 || size.y > 1)
+    {
+        const Vector2u                   levelSize(std::max(size.x / 2, 1u), std::max(size.y / 2, 1u));
+        const std::vector<std::uint8_t>& source = levels.empty() ? m_pixels : levels.back().m_pixels;
+        std::vector<std::uint8_t>        pixels = resamplePixels(source, size, levelSize, filter, policy);
+        levels.push_back(Image(levelSize, std::move(pixels)));
+        size = levelSize;
     }
+
+    return levels;
 }
 
 } // namespace sf
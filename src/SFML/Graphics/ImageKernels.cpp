@@ -0,0 +1,564 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageKernels.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_IMAGE_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SFML_IMAGE_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+namespace ImageKernelsImpl
+{
+std::uint32_t loadPixel(const std::uint8_t* pixel)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, pixel, sizeof(value));
+    return value;
+}
+
+void storePixel(std::uint8_t* pixel, std::uint32_t value)
+{
+    std::memcpy(pixel, &value, sizeof(value));
+}
+
+std::uint8_t premultiply(std::uint8_t component, std::uint8_t alpha)
+{
+    // Exact rounding of component * alpha / 255, as computed by the vector versions
+    const unsigned int product = component * alpha + 128u;
+    return static_cast<std::uint8_t>((product + (product >> 8)) >> 8);
+}
+
+void blendPixel(const std::uint8_t* src, std::uint8_t* dst)
+{
+    // Interpolate RGBA components using the alpha values of the destination and source pixels
+    const std::uint8_t srcAlpha = src[3];
+    const std::uint8_t dstAlpha = dst[3];
+    const auto         outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+    dst[3] = outAlpha;
+
+    if (outAlpha)
+        for (int k = 0; k < 3; k++)
+            dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+    else
+        for (int k = 0; k < 3; k++)
+            dst[k] = src[k];
+}
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+////////////////////////////////////////////////////////////
+// Truncated quotient of integers stored as floats, given the reciprocal of the denominator.
+// The exact quotient is at most 255 and, when it is not an integer, its fractional part is
+// at least 1/255 away from 0 and 1, so a small bias absorbs the rounding errors of the
+// reciprocal and of the product: the result is the one of the integer division.
+__m128 divide(__m128 numerator, __m128 reciprocal)
+{
+    const __m128 bias = _mm_set1_ps(1.f / 1024.f);
+    return _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(numerator, reciprocal), bias)));
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+__m128 getComponent(__m128i pixels)
+{
+    return _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, Shift), _mm_set1_epi32(0xFF)));
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+__m128i setComponent(__m128 component)
+{
+    return _mm_slli_epi32(_mm_cvttps_epi32(component), Shift);
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+__m128i blendComponent(__m128i src,
+                       __m128i dst,
+                       __m128  srcAlpha,
+                       __m128  dstWeight,
+                       __m128  reciprocal,
+                       __m128  transparent)
+{
+    const __m128 srcColor  = getComponent<Shift>(src);
+    const __m128 dstColor  = getComponent<Shift>(dst);
+    const __m128 numerator = _mm_add_ps(_mm_mul_ps(srcColor, srcAlpha), _mm_mul_ps(dstColor, dstWeight));
+    const __m128 color     = divide(numerator, reciprocal);
+
+    // Fully transparent results take the source color
+    return setComponent<Shift>(_mm_or_ps(_mm_and_ps(transparent, srcColor), _mm_andnot_ps(transparent, color)));
+}
+
+////////////////////////////////////////////////////////////
+// Blend four pixels, each component of the four pixels being processed in its own register
+__m128i blendPixels(__m128i src, __m128i dst)
+{
+    const __m128 one = _mm_set1_ps(1.f);
+
+    const __m128 srcAlpha = getComponent<24>(src);
+    const __m128 dstAlpha = getComponent<24>(dst);
+    const __m128 product  = divide(_mm_mul_ps(srcAlpha, dstAlpha), _mm_set1_ps(1.f / 255.f));
+    const __m128 outAlpha = _mm_sub_ps(_mm_add_ps(srcAlpha, dstAlpha), product);
+
+    const __m128 reciprocal  = _mm_div_ps(one, _mm_max_ps(outAlpha, one));
+    const __m128 dstWeight   = _mm_sub_ps(outAlpha, srcAlpha);
+    const __m128 transparent = _mm_cmpeq_ps(outAlpha, _mm_setzero_ps());
+
+    return _mm_or_si128(_mm_or_si128(blendComponent<0>(src, dst, srcAlpha, dstWeight, reciprocal, transparent),
+                                     blendComponent<8>(src, dst, srcAlpha, dstWeight, reciprocal, transparent)),
+                        _mm_or_si128(blendComponent<16>(src, dst, srcAlpha, dstWeight, reciprocal, transparent),
+                                     setComponent<24>(outAlpha)));
+}
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+////////////////////////////////////////////////////////////
+// Truncated quotient of integers stored as floats, given the reciprocal of the denominator.
+// The exact quotient is at most 255 and, when it is not an integer, its fractional part is
+// at least 1/255 away from 0 and 1, so a small bias absorbs the rounding errors of the
+// reciprocal and of the product: the result is the one of the integer division.
+float32x4_t divide(float32x4_t numerator, float32x4_t reciprocal)
+{
+    return vcvtq_f32_u32(vcvtq_u32_f32(vaddq_f32(vmulq_f32(numerator, reciprocal), vdupq_n_f32(1.f / 1024.f))));
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+float32x4_t getComponent(uint32x4_t pixels)
+{
+    return vcvtq_f32_u32(vandq_u32(vshrq_n_u32(pixels, Shift), vdupq_n_u32(0xFF)));
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+uint32x4_t setComponent(float32x4_t component)
+{
+    return vshlq_n_u32(vcvtq_u32_f32(component), Shift);
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+uint32x4_t blendComponent(uint32x4_t  src,
+                          uint32x4_t  dst,
+                          float32x4_t srcAlpha,
+                          float32x4_t dstWeight,
+                          float32x4_t reciprocal,
+                          uint32x4_t  transparent)
+{
+    const float32x4_t srcColor  = getComponent<Shift>(src);
+    const float32x4_t dstColor  = getComponent<Shift>(dst);
+    const float32x4_t numerator = vaddq_f32(vmulq_f32(srcColor, srcAlpha), vmulq_f32(dstColor, dstWeight));
+    const float32x4_t color     = divide(numerator, reciprocal);
+
+    // Fully transparent results take the source color
+    return setComponent<Shift>(vbslq_f32(transparent, srcColor, color));
+}
+
+////////////////////////////////////////////////////////////
+// Blend four pixels, each component of the four pixels being processed in its own register
+uint32x4_t blendPixels(uint32x4_t src, uint32x4_t dst)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+
+    const float32x4_t srcAlpha = getComponent<24>(src);
+    const float32x4_t dstAlpha = getComponent<24>(dst);
+    const float32x4_t product  = divide(vmulq_f32(srcAlpha, dstAlpha), vdupq_n_f32(1.f / 255.f));
+    const float32x4_t outAlpha = vsubq_f32(vaddq_f32(srcAlpha, dstAlpha), product);
+
+    // Two Newton-Raphson steps bring the reciprocal estimate to single precision
+    const float32x4_t denominator = vmaxq_f32(outAlpha, one);
+    float32x4_t       reciprocal  = vrecpeq_f32(denominator);
+    reciprocal                    = vmulq_f32(vrecpsq_f32(denominator, reciprocal), reciprocal);
+    reciprocal                    = vmulq_f32(vrecpsq_f32(denominator, reciprocal), reciprocal);
+
+    const float32x4_t dstWeight   = vsubq_f32(outAlpha, srcAlpha);
+    const uint32x4_t  transparent = vceqq_f32(outAlpha, vdupq_n_f32(0.f));
+
+    return vorrq_u32(vorrq_u32(blendComponent<0>(src, dst, srcAlpha, dstWeight, reciprocal, transparent),
+                               blendComponent<8>(src, dst, srcAlpha, dstWeight, reciprocal, transparent)),
+                     vorrq_u32(blendComponent<16>(src, dst, srcAlpha, dstWeight, reciprocal, transparent),
+                               setComponent<24>(outAlpha)));
+}
+#endif
+} // namespace ImageKernelsImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void maskPixels(std::uint8_t* pixels, std::size_t count, const Color& color, std::uint8_t alpha)
+{
+    const std::uint8_t keyBytes[]    = {color.r, color.g, color.b, color.a};
+    const std::uint8_t maskedBytes[] = {color.r, color.g, color.b, alpha};
+    const auto         key           = ImageKernelsImpl::loadPixel(keyBytes);
+    const auto         masked        = ImageKernelsImpl::loadPixel(maskedBytes);
+
+    std::size_t i = 0;
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    const __m128i keys        = _mm_set1_epi32(static_cast<int>(key));
+    const __m128i replacement = _mm_set1_epi32(static_cast<int>(masked));
+
+    for (; i + 4 <= count; i += 4)
+    {
+        auto* const   ptr     = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i block   = _mm_loadu_si128(ptr);
+        const __m128i matches = _mm_cmpeq_epi32(block, keys);
+        _mm_storeu_si128(ptr, _mm_or_si128(_mm_and_si128(matches, replacement), _mm_andnot_si128(matches, block)));
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    const uint32x4_t keys        = vdupq_n_u32(key);
+    const uint32x4_t replacement = vdupq_n_u32(masked);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        std::uint8_t* const ptr     = pixels + i * 4;
+        const uint32x4_t    block   = vreinterpretq_u32_u8(vld1q_u8(ptr));
+        const uint32x4_t    matches = vceqq_u32(block, keys);
+        vst1q_u8(ptr, vreinterpretq_u8_u32(vbslq_u32(matches, replacement, block)));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        if (ImageKernelsImpl::loadPixel(pixels + i * 4) == key)
+            ImageKernelsImpl::storePixel(pixels + i * 4, masked);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t count)
+{
+    // Swap pixels from both ends towards the middle
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + count * 4;
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    while (right - left >= 8 * 4)
+    {
+        right -= 4 * 4;
+        const __m128i leftBlock  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+        const __m128i rightBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(left), _mm_shuffle_epi32(rightBlock, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(right), _mm_shuffle_epi32(leftBlock, _MM_SHUFFLE(0, 1, 2, 3)));
+        left += 4 * 4;
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    while (right - left >= 8 * 4)
+    {
+        right -= 4 * 4;
+        const uint32x4_t leftBlock  = vreinterpretq_u32_u8(vld1q_u8(left));
+        const uint32x4_t rightBlock = vreinterpretq_u32_u8(vld1q_u8(right));
+        const uint32x4_t leftSwap   = vrev64q_u32(leftBlock);
+        const uint32x4_t rightSwap  = vrev64q_u32(rightBlock);
+        vst1q_u8(left, vreinterpretq_u8_u32(vextq_u32(rightSwap, rightSwap, 2)));
+        vst1q_u8(right, vreinterpretq_u8_u32(vextq_u32(leftSwap, leftSwap, 2)));
+        left += 4 * 4;
+    }
+#endif
+
+    while (right - left >= 2 * 4)
+    {
+        right -= 4;
+        const auto leftPixel = ImageKernelsImpl::loadPixel(left);
+        ImageKernelsImpl::storePixel(left, ImageKernelsImpl::loadPixel(right));
+        ImageKernelsImpl::storePixel(right, leftPixel);
+        left += 4;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void blendPixels(const std::uint8_t* source, std::uint8_t* destination, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+        const __m128i dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), ImageKernelsImpl::blendPixels(src, dst));
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t src = vreinterpretq_u32_u8(vld1q_u8(source + i * 4));
+        const uint32x4_t dst = vreinterpretq_u32_u8(vld1q_u8(destination + i * 4));
+        vst1q_u8(destination + i * 4, vreinterpretq_u8_u32(ImageKernelsImpl::blendPixels(src, dst)));
+    }
+#endif
+
+    for (; i < count; ++i)
+        ImageKernelsImpl::blendPixel(source + i * 4, destination + i * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyAlpha(std::uint8_t* pixels, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    // Two pixels per 16-bit half, the alpha lanes are multiplied by 255 to keep the alpha unchanged
+    const __m128i zero      = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i opaque    = _mm_and_si128(alphaMask, _mm_set1_epi16(255));
+    const __m128i bias      = _mm_set1_epi16(128);
+
+    const auto premultiplyHalf = [&](__m128i components)
+    {
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(components, _MM_SHUFFLE(3, 3, 3, 3)),
+                                            _MM_SHUFFLE(3, 3, 3, 3));
+        alpha                 = _mm_or_si128(_mm_andnot_si128(alphaMask, alpha), opaque);
+        const __m128i product = _mm_add_epi16(_mm_mullo_epi16(components, alpha), bias);
+        return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+    };
+
+    for (; i + 4 <= count; i += 4)
+    {
+        auto* const   block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i bytes = _mm_loadu_si128(block);
+        const __m128i low   = premultiplyHalf(_mm_unpacklo_epi8(bytes, zero));
+        const __m128i high  = premultiplyHalf(_mm_unpackhi_epi8(bytes, zero));
+        _mm_storeu_si128(block, _mm_packus_epi16(low, high));
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    const auto premultiplyComponent = [](uint8x16_t component, uint8x16_t alpha)
+    {
+        // Exact rounding of component * alpha / 255
+        const uint16x8_t low  = vmull_u8(vget_low_u8(component), vget_low_u8(alpha));
+        const uint16x8_t high = vmull_u8(vget_high_u8(component), vget_high_u8(alpha));
+        return vcombine_u8(vrshrn_n_u16(vrsraq_n_u16(low, low, 8), 8), vrshrn_n_u16(vrsraq_n_u16(high, high, 8), 8));
+    };
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t block = vld4q_u8(pixels + i * 4);
+        block.val[0]       = premultiplyComponent(block.val[0], block.val[3]);
+        block.val[1]       = premultiplyComponent(block.val[1], block.val[3]);
+        block.val[2]       = premultiplyComponent(block.val[2], block.val[3]);
+        vst4q_u8(pixels + i * 4, block);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::uint8_t* pixel = pixels + i * 4;
+        for (std::size_t k = 0; k < 3; ++k)
+            pixel[k] = ImageKernelsImpl::premultiply(pixel[k], pixel[3]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyPixels(const std::uint8_t* source, float* destination, std::size_t count)
+{
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    // The color components are scaled by alpha / 255, alpha by 1
+    const __m128  colorScale = _mm_set_ps(0.f, 1.f / 255.f, 1.f / 255.f, 1.f / 255.f);
+    const __m128  alphaScale = _mm_set_ps(1.f, 0.f, 0.f, 0.f);
+    const __m128i zero       = _mm_setzero_si128();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const __m128i bytes  = _mm_cvtsi32_si128(static_cast<int>(ImageKernelsImpl::loadPixel(source + i * 4)));
+        const __m128  pixel  = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero));
+        const __m128  alpha  = _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128  factor = _mm_add_ps(_mm_mul_ps(alpha, colorScale), alphaScale);
+        _mm_storeu_ps(destination + i * 4, _mm_mul_ps(pixel, factor));
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    const float       scales[]   = {1.f / 255.f, 1.f / 255.f, 1.f / 255.f, 0.f};
+    const float       ones[]     = {0.f, 0.f, 0.f, 1.f};
+    const float32x4_t colorScale = vld1q_f32(scales);
+    const float32x4_t alphaScale = vld1q_f32(ones);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const uint8x8_t   bytes  = vreinterpret_u8_u32(vdup_n_u32(ImageKernelsImpl::loadPixel(source + i * 4)));
+        const float32x4_t pixel  = vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(bytes))));
+        const float32x4_t alpha  = vdupq_n_f32(vgetq_lane_f32(pixel, 3));
+        const float32x4_t factor = vaddq_f32(vmulq_f32(alpha, colorScale), alphaScale);
+        vst1q_f32(destination + i * 4, vmulq_f32(pixel, factor));
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float alpha = source[i * 4 + 3];
+        for (std::size_t k = 0; k < 3; ++k)
+            destination[i * 4 + k] = source[i * 4 + k] * alpha / 255.f;
+        destination[i * 4 + 3] = alpha;
+    }
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void unpremultiplyPixels(const float* source, std::uint8_t* destination, std::size_t count)
+{
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    const __m128 colorScale = _mm_set_ps(0.f, 255.f, 255.f, 255.f);
+    const __m128 alphaScale = _mm_set_ps(1.f, 0.f, 0.f, 0.f);
+    const __m128 half       = _mm_set1_ps(0.5f);
+    const __m128 maximum    = _mm_set1_ps(255.f);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const __m128 pixel       = _mm_loadu_ps(source + i * 4);
+        const __m128 alpha       = _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128 transparent = _mm_cmplt_ps(alpha, half);
+        const __m128 reciprocal  = _mm_div_ps(colorScale, _mm_max_ps(alpha, half));
+        const __m128 factor      = _mm_add_ps(reciprocal, alphaScale);
+        const __m128 result      = _mm_min_ps(_mm_max_ps(_mm_mul_ps(pixel, factor), _mm_setzero_ps()), maximum);
+
+        // Rounding to the nearest integer, before packing the components back to bytes
+        const __m128i integers = _mm_cvtps_epi32(_mm_andnot_ps(transparent, result));
+        const __m128i words    = _mm_packs_epi32(integers, integers);
+        ImageKernelsImpl::storePixel(destination + i * 4,
+                                     static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(words, words))));
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    const float       scales[]   = {255.f, 255.f, 255.f, 0.f};
+    const float       ones[]     = {0.f, 0.f, 0.f, 1.f};
+    const float32x4_t colorScale = vld1q_f32(scales);
+    const float32x4_t alphaScale = vld1q_f32(ones);
+    const float32x4_t half       = vdupq_n_f32(0.5f);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float32x4_t pixel = vld1q_f32(source + i * 4);
+        const float       alpha = vgetq_lane_f32(pixel, 3);
+
+        if (alpha < 0.5f)
+        {
+            ImageKernelsImpl::storePixel(destination + i * 4, 0);
+            continue;
+        }
+
+        const float32x4_t factor = vaddq_f32(vmulq_f32(colorScale, vdupq_n_f32(1.f / alpha)), alphaScale);
+        const float32x4_t result = vminq_f32(vmaxq_f32(vmulq_f32(pixel, factor), vdupq_n_f32(0.f)), vdupq_n_f32(255.f));
+
+        // Rounding to the nearest integer, before narrowing the components back to bytes
+        const uint16x4_t words = vmovn_u32(vcvtq_u32_f32(vaddq_f32(result, half)));
+        const uint8x8_t  bytes = vmovn_u16(vcombine_u16(words, words));
+        ImageKernelsImpl::storePixel(destination + i * 4, vget_lane_u32(vreinterpret_u32_u8(bytes), 0));
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float alpha = std::min(source[i * 4 + 3], 255.f);
+
+        if (alpha < 0.5f)
+        {
+            ImageKernelsImpl::storePixel(destination + i * 4, 0);
+            continue;
+        }
+
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            const float color      = std::clamp(source[i * 4 + k] * 255.f / alpha, 0.f, 255.f);
+            destination[i * 4 + k] = static_cast<std::uint8_t>(std::nearbyint(color));
+        }
+        destination[i * 4 + 3] = static_cast<std::uint8_t>(std::nearbyint(alpha));
+    }
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void resamplePixels(const float*       source,
+                    float*             destination,
+                    std::size_t        count,
+                    const std::size_t* firsts,
+                    const float*       weights,
+                    std::size_t        taps)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float* pixel  = source + firsts[i] * 4;
+        const float* weight = weights + i * taps;
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+        __m128 sum = _mm_setzero_ps();
+        for (std::size_t j = 0; j < taps; ++j)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weight[j]), _mm_loadu_ps(pixel + j * 4)));
+        _mm_storeu_ps(destination + i * 4, sum);
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+        float32x4_t sum = vdupq_n_f32(0.f);
+        for (std::size_t j = 0; j < taps; ++j)
+            sum = vmlaq_n_f32(sum, vld1q_f32(pixel + j * 4), weight[j]);
+        vst1q_f32(destination + i * 4, sum);
+#else
+        float sum[4] = {};
+        for (std::size_t j = 0; j < taps; ++j)
+            for (std::size_t k = 0; k < 4; ++k)
+                sum[k] += weight[j] * pixel[j * 4 + k];
+        std::copy(sum, sum + 4, destination + i * 4);
+#endif
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void accumulatePixels(const float* source, float* destination, std::size_t count, float weight)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+    const __m128 factor = _mm_set1_ps(weight);
+
+    for (; i < count; ++i)
+    {
+        const __m128 sum = _mm_add_ps(_mm_loadu_ps(destination + i * 4),
+                                      _mm_mul_ps(factor, _mm_loadu_ps(source + i * 4)));
+        _mm_storeu_ps(destination + i * 4, sum);
+    }
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+    for (; i < count; ++i)
+        vst1q_f32(destination + i * 4, vmlaq_n_f32(vld1q_f32(destination + i * 4), vld1q_f32(source + i * 4), weight));
+#endif
+
+    for (i *= 4; i < count * 4; ++i)
+        destination[i] += weight * source[i];
+}
+
+} // namespace sf::priv
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Replace the alpha of the pixels matching a color-key
+///
+/// \param pixels Array of RGBA pixels to modify
+/// \param count  Number of pixels in the array
+/// \param color  Color-key to look for
+/// \param alpha  Alpha value to assign to the matching pixels
+///
+////////////////////////////////////////////////////////////
+void maskPixels(std::uint8_t* pixels, std::size_t count, const Color& color, std::uint8_t alpha);
+
+////////////////////////////////////////////////////////////
+/// \brief Reverse the order of the pixels of a row
+///
+/// \param pixels Array of RGBA pixels to modify
+/// \param count  Number of pixels in the array
+///
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Blend source pixels over destination pixels
+///
+/// The result is exactly the one of the integer \b over
+/// operator documented in sf::Image::copy.
+///
+/// \param source      Array of RGBA pixels to blend
+/// \param destination Array of RGBA pixels to blend onto
+/// \param count       Number of pixels in both arrays
+///
+////////////////////////////////////////////////////////////
+void blendPixels(const std::uint8_t* source, std::uint8_t* destination, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Multiply the color components of pixels by their alpha
+///
+/// \param pixels Array of RGBA pixels to modify
+/// \param count  Number of pixels in the array
+///
+////////////////////////////////////////////////////////////
+void premultiplyAlpha(std::uint8_t* pixels, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert pixels to floating point components with premultiplied alpha
+///
+/// \param source      Array of RGBA pixels to convert
+/// \param destination Array receiving 4 components per pixel, in [0, 255]
+/// \param count       Number of pixels in both arrays
+///
+////////////////////////////////////////////////////////////
+void premultiplyPixels(const std::uint8_t* source, float* destination, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert floating point components with premultiplied alpha back to pixels
+///
+/// The components are rounded and clamped; pixels whose alpha
+/// rounds to 0 become transparent black.
+///
+/// \param source      Array of 4 components per pixel to convert
+/// \param destination Array of RGBA pixels receiving the result
+/// \param count       Number of pixels in both arrays
+///
+////////////////////////////////////////////////////////////
+void unpremultiplyPixels(const float* source, std::uint8_t* destination, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Resample a row of floating point pixels
+///
+/// Each destination pixel is the weighted sum of \a taps
+/// consecutive source pixels, starting at its entry in
+/// \a firsts; the weights of destination pixel \c i are
+/// stored from \c weights[i * taps].
+///
+/// \param source      Array of 4 components per pixel to read
+/// \param destination Array of 4 components per pixel receiving the result
+/// \param count       Number of destination pixels
+/// \param firsts      Index of the first source pixel of each destination pixel
+/// \param weights     Weights of the source pixels of each destination pixel
+/// \param taps        Number of source pixels per destination pixel
+///
+////////////////////////////////////////////////////////////
+void resamplePixels(const float*       source,
+                    float*             destination,
+                    std::size_t        count,
+                    const std::size_t* firsts,
+                    const float*       weights,
+                    std::size_t        taps);
+
+////////////////////////////////////////////////////////////
+/// \brief Add weighted floating point pixels to others
+///
+/// \param source      Array of 4 components per pixel to add
+/// \param destination Array of 4 components per pixel to add to
+/// \param count       Number of pixels in both arrays
+/// \param weight      Factor applied to the source components
+///
+////////////////////////////////////////////////////////////
+void accumulatePixels(const float* source, float* destination, std::size_t count, float weight);
+
+} // namespace sf::priv
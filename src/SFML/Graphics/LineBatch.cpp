@@ -0,0 +1,444 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/LineBatch.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace LineBatchImpl
+{
+// Miters longer than this many times the half thickness are shortened
+constexpr float miterLimit = 4.f;
+
+// The vertex shader passes the endpoints through, the geometry shader works in local coordinates
+constexpr std::string_view expansionVertexShader = R"(
+#version 150 compatibility
+
+out vec4 sf_endColor;
+out vec2 sf_neighbor;
+
+void main()
+{
+    gl_Position = gl_Vertex;
+    sf_endColor = gl_Color;
+    sf_neighbor = gl_MultiTexCoord0.xy;
+}
+)";
+
+// Expands each segment into a quad, mitered with the neighboring segments like in computeOffset()
+constexpr std::string_view expansionGeometryShader = R"(
+#version 150 compatibility
+
+layout(lines) in;
+layout(triangle_strip, max_vertices = 4) out;
+
+in vec4 sf_endColor[];
+in vec2 sf_neighbor[];
+
+out vec4  sf_color;
+out float sf_distance;
+
+uniform float sf_extent;
+
+const float miterLimit = 4.0;
+
+vec2 computeDirection(vec2 from, vec2 to, vec2 fallback)
+{
+    vec2 delta = to - from;
+    return (dot(delta, delta) > 0.0) ? normalize(delta) : fallback;
+}
+
+vec2 computeOffset(vec2 direction, vec2 neighborDirection)
+{
+    vec2 normal = vec2(-direction.y, direction.x);
+    vec2 sum    = direction + neighborDirection;
+    if (dot(sum, sum) < 0.000001)
+        return normal;
+
+    vec2 tangent = normalize(sum);
+    vec2 miter   = vec2(-tangent.y, tangent.x);
+    return miter / max(dot(miter, normal), 1.0 / miterLimit);
+}
+
+void corner(vec2 position, vec2 offset, float side, vec4 color)
+{
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(position + offset * side * sf_extent, 0.0, 1.0);
+    sf_color    = color;
+    sf_distance = side * sf_extent;
+    EmitVertex();
+}
+
+void main()
+{
+    vec2 start = gl_in[0].gl_Position.xy;
+    vec2 end   = gl_in[1].gl_Position.xy;
+    if (start == end)
+        return;
+
+    vec2 direction   = normalize(end - start);
+    vec2 startOffset = computeOffset(direction, computeDirection(sf_neighbor[0], start, direction));
+    vec2 endOffset   = computeOffset(direction, computeDirection(end, sf_neighbor[1], direction));
+
+    corner(start, startOffset, -1.0, sf_endColor[0]);
+    corner(start, startOffset, 1.0, sf_endColor[0]);
+    corner(end, endOffset, -1.0, sf_endColor[1]);
+    corner(end, endOffset, 1.0, sf_endColor[1]);
+    EndPrimitive();
+}
+)";
+
+// The coverage falls from 1 to 0 across the feather, which is centered on the edge of the line
+constexpr std::string_view expansionFragmentShader = R"(
+#version 150 compatibility
+
+in vec4  sf_color;
+in float sf_distance;
+
+uniform float sf_extent;
+uniform float sf_feather;
+
+void main()
+{
+    float coverage = (sf_feather > 0.0) ? clamp((sf_extent - abs(sf_distance)) / sf_feather, 0.0, 1.0) : 1.0;
+    gl_FragColor   = vec4(sf_color.rgb, sf_color.a * coverage);
+}
+)";
+
+// Direction from a point to another, or the fallback if both points are the same
+sf::Vector2f computeDirection(sf::Vector2f from, sf::Vector2f to, sf::Vector2f fallback)
+{
+    const sf::Vector2f delta = to - from;
+    return (delta != sf::Vector2f()) ? delta.normalized() : fallback;
+}
+
+// Offset of the corners at an end of a segment, from the center line to the left side for a half thickness of 1
+// The offset follows the bisector of the joint, so that the neighboring segment shares the same corners
+sf::Vector2f computeOffset(sf::Vector2f direction, sf::Vector2f neighborDirection)
+{
+    const sf::Vector2f normal = direction.perpendicular();
+    const sf::Vector2f sum    = direction + neighborDirection;
+    if (sum.lengthSq() < 0.000001f)
+        return normal;
+
+    const sf::Vector2f miter = sum.normalized().perpendicular();
+    return miter / std::max(miter.dot(normal), 1.f / miterLimit);
+}
+
+// Width of a pixel of the target in local units, assuming that the transform and the view scale both axes alike
+float computePixelWidth(const sf::RenderTarget& target, const sf::Transform& transform)
+{
+    // The view maps its area to [-1, 1], which the viewport then stretches to its size in pixels
+    const sf::View&   view     = target.getView();
+    const sf::IntRect viewport = target.getViewport(view);
+    const float*      matrix   = (view.getTransform() * transform).getMatrix();
+    const float       area     = (matrix[0] * matrix[5] - matrix[1] * matrix[4]) * static_cast<float>(viewport.width) *
+                           static_cast<float>(viewport.height) / 4.f;
+
+    return (area != 0.f) ? 1.f / std::sqrt(std::abs(area)) : 0.f;
+}
+} // namespace LineBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+LineBatch::LineBatch() : m_vertexBuffer(PrimitiveType::Lines, VertexBuffer::Usage::Stream)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::addLine(Vector2f start, Vector2f end, const Color& color)
+{
+    // Each endpoint stores the point beyond it in its texture coordinates, itself if there is none
+    m_endpoints.push_back({start, color, start});
+    m_endpoints.push_back({end, color, end});
+
+    m_trianglesFeather = -1.f;
+    m_bufferNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::addPolyline(const Vector2f* points, std::size_t pointCount, const Color& color, bool closed)
+{
+    if (!points || (pointCount < 2))
+        return;
+
+    const std::size_t segmentCount = closed ? pointCount : pointCount - 1;
+    m_endpoints.reserve(m_endpoints.size() + segmentCount * 2);
+
+    for (std::size_t i = 0; i < segmentCount; ++i)
+    {
+        const Vector2f& start    = points[i];
+        const Vector2f& end      = points[(i + 1) % pointCount];
+        const Vector2f& previous = (closed || (i > 0)) ? points[(i + pointCount - 1) % pointCount] : start;
+        const Vector2f& next     = (closed || (i + 2 < pointCount)) ? points[(i + 2) % pointCount] : end;
+
+        m_endpoints.push_back({start, color, previous});
+        m_endpoints.push_back({end, color, next});
+    }
+
+    m_trianglesFeather = -1.f;
+    m_bufferNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::clear()
+{
+    m_endpoints.clear();
+
+    m_trianglesFeather = -1.f;
+    m_bufferNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::reserve(std::size_t segmentCount)
+{
+    m_endpoints.reserve(segmentCount * 2);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t LineBatch::getSegmentCount() const
+{
+    return m_endpoints.size() / 2;
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::setThickness(float thickness)
+{
+    assert(thickness >= 0.f && "Negative thickness");
+
+    m_thickness        = thickness;
+    m_trianglesFeather = -1.f;
+}
+
+
+////////////////////////////////////////////////////////////
+float LineBatch::getThickness() const
+{
+    return m_thickness;
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::setSmooth(bool smooth)
+{
+    m_smooth = smooth;
+}
+
+
+////////////////////////////////////////////////////////////
+bool LineBatch::isSmooth() const
+{
+    return m_smooth;
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::setGpuExpansionEnabled(bool enabled)
+{
+    m_gpuExpansionEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool LineBatch::isGpuExpansionEnabled() const
+{
+    return m_gpuExpansionEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool LineBatch::isGpuExpansionAvailable()
+{
+    return VertexBuffer::isAvailable() && Shader::isGeometryAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_endpoints.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture = nullptr;
+    states.shader  = nullptr;
+
+    // Antialiased edges fade out over one pixel
+    const float feather = m_smooth ? LineBatchImpl::computePixelWidth(target, states.transform) : 0.f;
+
+    // The endpoints are drawn from a vertex buffer only: the vertices of client-side arrays may be
+    // pre-transformed by the target, which would separate them from their neighbors
+    if (m_gpuExpansionEnabled && isGpuExpansionAvailable())
+    {
+        states.shader = getExpansionShader(feather);
+        if (states.shader && updateBuffer())
+        {
+            target.draw(m_vertexBuffer, 0, m_endpoints.size(), states);
+            return;
+        }
+
+        states.shader = nullptr;
+    }
+
+    if (m_trianglesFeather != feather)
+        updateTriangles(feather);
+
+    target.draw(m_triangles.data(), m_triangles.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* LineBatch::getExpansionShader(float feather) const
+{
+    if (!m_shader)
+    {
+        // Don't try to compile the shader again every frame if it failed once
+        static bool failed = false;
+        if (failed)
+            return nullptr;
+
+        auto shader = Shader::loadFromMemory(LineBatchImpl::expansionVertexShader,
+                                             LineBatchImpl::expansionGeometryShader,
+                                             LineBatchImpl::expansionFragmentShader);
+        if (!shader)
+        {
+            err() << "Failed to create the shader expanding lines, they are expanded on the CPU instead" << std::endl;
+            failed = true;
+            return nullptr;
+        }
+
+        m_shader = std::make_shared<Shader>(std::move(*shader));
+    }
+
+    m_shader->setUniform("sf_extent", (m_thickness + feather) / 2.f);
+    m_shader->setUniform("sf_feather", feather);
+
+    return m_shader.get();
+}
+
+
+////////////////////////////////////////////////////////////
+void LineBatch::updateTriangles(float feather) const
+{
+    using LineBatchImpl::computeDirection;
+    using LineBatchImpl::computeOffset;
+
+    // Rows of vertices across the line, from the right edge to the left one: a single quad for aliased
+    // lines, three quads for smooth ones whose outer rows are transparent
+    const float halfThickness = m_thickness / 2.f;
+    const float extent        = halfThickness + feather / 2.f;
+    const float inner         = std::max(halfThickness - feather / 2.f, 0.f);
+    const float coverage      = (feather > 0.f) ? std::min(extent / feather, 1.f) : 1.f;
+
+    const std::array<float, 4> smoothRows  = {-extent, -inner, inner, extent};
+    const std::array<float, 2> aliasedRows = {-extent, extent};
+    const float*               rows        = (feather > 0.f) ? smoothRows.data() : aliasedRows.data();
+    const std::size_t          rowCount    = (feather > 0.f) ? smoothRows.size() : aliasedRows.size();
+
+    m_triangles.clear();
+    m_triangles.reserve(getSegmentCount() * (rowCount - 1) * 6);
+
+    for (std::size_t i = 0; i < m_endpoints.size(); i += 2)
+    {
+        const Vertex& start = m_endpoints[i];
+        const Vertex& end   = m_endpoints[i + 1];
+        if (start.position == end.position)
+            continue;
+
+        const Vector2f direction   = (end.position - start.position).normalized();
+        const Vector2f incoming    = computeDirection(start.texCoords, start.position, direction);
+        const Vector2f outgoing    = computeDirection(end.position, end.texCoords, direction);
+        const Vector2f startOffset = computeOffset(direction, incoming);
+        const Vector2f endOffset   = computeOffset(direction, outgoing);
+
+        const auto makeVertex = [&](const Vertex& endpoint, Vector2f offset, std::size_t row)
+        {
+            const bool outer = (feather > 0.f) && ((row == 0) || (row == rowCount - 1));
+            Color      color = endpoint.color;
+            color.a          = outer ? 0 : static_cast<std::uint8_t>(static_cast<float>(color.a) * coverage);
+            return Vertex{endpoint.position + offset * rows[row], color};
+        };
+
+        for (std::size_t row = 0; row + 1 < rowCount; ++row)
+        {
+            const Vertex a = makeVertex(start, startOffset, row);
+            const Vertex b = makeVertex(start, startOffset, row + 1);
+            const Vertex c = makeVertex(end, endOffset, row);
+            const Vertex d = makeVertex(end, endOffset, row + 1);
+
+            m_triangles.insert(m_triangles.end(), {a, b, c, c, b, d});
+        }
+    }
+
+    m_trianglesFeather = feather;
+}
+
+
+////////////////////////////////////////////////////////////
+bool LineBatch::updateBuffer() const
+{
+    if (!m_bufferNeedUpdate)
+        return true;
+
+    // Filling the whole buffer orphans its previous storage instead of waiting for the GPU
+    if (!m_vertexBuffer.getNativeHandle() && !m_vertexBuffer.create(m_endpoints.size()))
+        return false;
+
+    if (!m_vertexBuffer.update(m_endpoints.data(), m_endpoints.size(), 0))
+        return false;
+
+    m_bufferNeedUpdate = false;
+    return true;
+}
+
+} // namespace sf
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ExecutionPolicy.hpp>
+
+#include <functional>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Run a function over consecutive ranges of items
+///
+/// With the sequential policy, or when the work is too small
+/// to be worth spreading, \a function is called once for all
+/// the items. Otherwise the items are split into ranges that
+/// are processed concurrently, by the job scheduler if one is
+/// set or by the global thread pool otherwise, and this function returns once
+/// all of them are done.
+///
+/// \param policy    Execution policy requested by the caller
+/// \param itemCount Number of items to process
+/// \param itemSize  Amount of data processed per item, in bytes
+/// \param function  Function called with the first and past-the-end items of each range
+///
+////////////////////////////////////////////////////////////
+void forEachRange(ExecutionPolicy                                      policy,
+                  std::size_t                                          itemCount,
+                  std::size_t                                          itemSize,
+                  const std::function<void(std::size_t, std::size_t)>& function);
+
+} // namespace sf::priv
@@ -0,0 +1,781 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ParticleSystemImpl
+{
+// State of a particle, as stored in the vertex buffers
+struct Particle
+{
+    sf::Vector2f         position;
+    sf::Vector2f         velocity;
+    sf::Vector2f         life; // age and lifetime, in seconds
+    std::array<float, 4> color{};
+    sf::Vector2f         size; // only x is used, y pads the structure
+};
+
+static_assert(sizeof(Particle) == 48, "The particles must match the output of the simulation shader");
+
+// Parameters of the simulation, uploaded as a single array of vec4 at each update:
+// [0]      gravity, drag, elapsed time
+// [1]      seed, emitter count, attractor count, emitting
+// [2..21]  emitters: area, motion, lifetimes and sizes, start color, end color
+// [22..25] attractors: position, strength
+constexpr std::size_t globalParameterCount  = 2;
+constexpr std::size_t emitterParameterCount = 5;
+constexpr std::size_t attractorOffset = globalParameterCount + sf::ParticleSystem::MaxEmitters * emitterParameterCount;
+constexpr std::size_t parameterCount  = attractorOffset + sf::ParticleSystem::MaxAttractors;
+
+static_assert(attractorOffset == 22 && parameterCount == 26, "The parameters must match the simulation shader");
+
+// The particles of emitter e are the ones whose index modulo the number of emitters is e
+constexpr std::string_view simulationShaderSource = R"(
+#version 130
+
+in vec2 sf_position;
+in vec2 sf_velocity;
+in vec2 sf_life;
+
+out vec2 sf_outPosition;
+out vec2 sf_outVelocity;
+out vec2 sf_outLife;
+out vec4 sf_outColor;
+out vec2 sf_outSize;
+
+uniform vec4 sf_parameters[26];
+
+uint hash(uint x)
+{
+    x ^= x >> 16u;
+    x *= 0x7feb352du;
+    x ^= x >> 15u;
+    x *= 0x846ca68bu;
+    x ^= x >> 16u;
+    return x;
+}
+
+float random(inout uint state)
+{
+    state = hash(state);
+    return float(state >> 8u) / 16777216.0;
+}
+
+void main()
+{
+    vec4 forces = sf_parameters[0];
+    vec4 state  = sf_parameters[1];
+    float dt    = forces.w;
+
+    int  emitter   = 2 + (gl_VertexID % int(state.y)) * 5;
+    vec4 area      = sf_parameters[emitter];
+    vec4 motion    = sf_parameters[emitter + 1];
+    vec4 lifeSizes = sf_parameters[emitter + 2];
+
+    vec2 position = sf_position;
+    vec2 velocity = sf_velocity;
+    vec2 life     = sf_life;
+    bool wasAlive = (life.x >= 0.0) && (life.x < life.y);
+
+    life.x += dt;
+
+    if ((life.x >= life.y) && (life.x >= 0.0) && (state.w > 0.0))
+    {
+        // Spawn the particle again, keeping the remaining time if it just died
+        life.x = life.x - life.y;
+        if (!wasAlive && (life.x > dt))
+            life.x = 0.0;
+
+        uint seed     = hash(uint(gl_VertexID) ^ hash(uint(state.x)));
+        position      = area.xy + (vec2(random(seed), random(seed)) - 0.5) * area.zw;
+        float angle   = motion.x + (random(seed) - 0.5) * motion.y;
+        float speed   = mix(motion.z, motion.w, random(seed));
+        velocity      = vec2(cos(angle), sin(angle)) * speed;
+        life.y        = mix(lifeSizes.x, lifeSizes.y, random(seed));
+        position     += velocity * life.x;
+    }
+    else if (wasAlive)
+    {
+        vec2 acceleration = forces.xy;
+        for (int i = 0; i < int(state.z); ++i)
+        {
+            vec4  attractor = sf_parameters[22 + i];
+            vec2  offset    = attractor.xy - position;
+            float distance  = length(offset);
+            if (distance > 0.001)
+                acceleration += offset / distance * attractor.z;
+        }
+
+        velocity += acceleration * dt;
+        velocity *= exp(-forces.z * dt);
+        position += velocity * dt;
+    }
+
+    bool  alive = (life.x >= 0.0) && (life.x < life.y);
+    float ratio = (life.y > 0.0) ? clamp(life.x / life.y, 0.0, 1.0) : 1.0;
+
+    sf_outPosition = position;
+    sf_outVelocity = velocity;
+    sf_outLife     = life;
+    sf_outColor    = mix(sf_parameters[emitter + 3], sf_parameters[emitter + 4], ratio);
+    sf_outSize     = vec2(alive ? mix(lifeSizes.z, lifeSizes.w, ratio) : 0.0, 0.0);
+}
+)";
+
+constexpr std::string_view renderVertexShaderSource = R"(
+#version 150 compatibility
+
+out vec4  sf_right;
+out vec4  sf_down;
+out vec4  sf_particleColor;
+out float sf_size;
+
+void main()
+{
+    float halfSize   = gl_MultiTexCoord0.x * 0.5;
+    gl_Position      = gl_ModelViewProjectionMatrix * gl_Vertex;
+    sf_right         = gl_ModelViewProjectionMatrix * vec4(halfSize, 0.0, 0.0, 0.0);
+    sf_down          = gl_ModelViewProjectionMatrix * vec4(0.0, halfSize, 0.0, 0.0);
+    sf_particleColor = gl_Color;
+    sf_size          = gl_MultiTexCoord0.x;
+}
+)";
+
+constexpr std::string_view renderGeometryShaderSource = R"(
+#version 150 compatibility
+
+layout(points) in;
+layout(triangle_strip, max_vertices = 4) out;
+
+in vec4  sf_right[];
+in vec4  sf_down[];
+in vec4  sf_particleColor[];
+in float sf_size[];
+
+out vec4 sf_color;
+out vec2 sf_texCoords;
+
+uniform vec4 sf_textureRect;
+
+void corner(float x, float y)
+{
+    gl_Position  = gl_in[0].gl_Position + sf_right[0] * x + sf_down[0] * y;
+    sf_color     = sf_particleColor[0];
+    sf_texCoords = mix(sf_textureRect.xy, sf_textureRect.zw, vec2(x, y) * 0.5 + 0.5);
+    EmitVertex();
+}
+
+void main()
+{
+    // Dead particles have no size
+    if (sf_size[0] <= 0.0)
+        return;
+
+    corner(-1.0, -1.0);
+    corner(1.0, -1.0);
+    corner(-1.0, 1.0);
+    corner(1.0, 1.0);
+    EndPrimitive();
+}
+)";
+
+constexpr std::string_view renderFragmentShaderSource = R"(
+#version 150 compatibility
+
+in vec4 sf_color;
+in vec2 sf_texCoords;
+
+uniform sampler2D sf_texture;
+uniform bool      sf_textured;
+
+void main()
+{
+    gl_FragColor = sf_textured ? texture(sf_texture, sf_texCoords) * sf_color : sf_color;
+}
+)";
+
+// Compile a shader of the simulation program, returns 0 on failure
+GLuint compileShader(const std::string_view& source)
+{
+    const char* data   = source.data();
+    const GLint length = static_cast<GLint>(source.size());
+    GLuint      shader = 0;
+    glCheck(shader = GLEXT_core_glCreateShader(GLEXT_core_GL_VERTEX_SHADER));
+    glCheck(GLEXT_core_glShaderSource(shader, 1, &data, &length));
+    glCheck(GLEXT_core_glCompileShader(shader));
+
+    GLint success = 0;
+    glCheck(GLEXT_core_glGetShaderiv(shader, GLEXT_core_GL_COMPILE_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        GLint logLength = 0;
+        glCheck(GLEXT_core_glGetShaderiv(shader, GLEXT_core_GL_INFO_LOG_LENGTH, &logLength));
+
+        std::string log(static_cast<std::size_t>(std::max(logLength, 1)), '\0');
+        glCheck(GLEXT_core_glGetShaderInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+
+        sf::err() << "Failed to compile the simulation shader of the particle system:" << '\n'
+                  << log.c_str() << std::endl;
+
+        glCheck(GLEXT_core_glDeleteShader(shader));
+        return 0;
+    }
+
+    return shader;
+}
+
+// Link the simulation program, capturing its outputs with transform feedback, returns 0 on failure
+GLuint createSimulationProgram()
+{
+    const GLuint shader = compileShader(simulationShaderSource);
+    if (!shader)
+        return 0;
+
+    GLuint program = 0;
+    glCheck(program = GLEXT_core_glCreateProgram());
+    glCheck(GLEXT_core_glAttachShader(program, shader));
+    glCheck(GLEXT_core_glBindAttribLocation(program, 0, "sf_position"));
+    glCheck(GLEXT_core_glBindAttribLocation(program, 1, "sf_velocity"));
+    glCheck(GLEXT_core_glBindAttribLocation(program, 2, "sf_life"));
+
+    // The outputs are written in the order of the members of Particle
+    const char* const outputs[] = {"sf_outPosition", "sf_outVelocity", "sf_outLife", "sf_outColor", "sf_outSize"};
+    glCheck(GLEXT_glTransformFeedbackVaryings(program, 5, outputs, GLEXT_GL_INTERLEAVED_ATTRIBS));
+    glCheck(GLEXT_core_glLinkProgram(program));
+
+    // Attached shaders are kept alive by the program as long as it needs them
+    glCheck(GLEXT_core_glDeleteShader(shader));
+
+    GLint success = 0;
+    glCheck(GLEXT_core_glGetProgramiv(program, GLEXT_core_GL_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        GLint logLength = 0;
+        glCheck(GLEXT_core_glGetProgramiv(program, GLEXT_core_GL_INFO_LOG_LENGTH, &logLength));
+
+        std::string log(static_cast<std::size_t>(std::max(logLength, 1)), '\0');
+        glCheck(GLEXT_core_glGetProgramInfoLog(program, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+
+        sf::err() << "Failed to link the simulation program of the particle system:" << '\n'
+                  << log.c_str() << std::endl;
+
+        glCheck(GLEXT_core_glDeleteProgram(program));
+        return 0;
+    }
+
+    return program;
+}
+
+// Layout of the vertex buffers, the size of the particles is passed as the texture coordinates
+sf::VertexLayout particleLayout()
+{
+    using Type = sf::VertexLayout::Type;
+    return {sizeof(Particle),
+            {Type::Float, 2, offsetof(Particle, position), false},
+            {Type::Float, 4, offsetof(Particle, color), false},
+            {Type::Float, 2, offsetof(Particle, size), false}};
+}
+
+std::array<float, 4> toVec4(sf::Color color)
+{
+    return {color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f};
+}
+} // namespace ParticleSystemImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(unsigned int program, Shader&& renderShader) :
+m_program(program),
+m_renderShader(std::move(renderShader))
+{
+    const TransientContextLock lock;
+
+    glCheck(m_parametersLocation = GLEXT_core_glGetUniformLocation(m_program, "sf_parameters"));
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::~ParticleSystem()
+{
+    if (m_program)
+    {
+        const TransientContextLock lock;
+
+        glCheck(GLEXT_core_glDeleteProgram(m_program));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(ParticleSystem&& source) noexcept :
+Drawable(source),
+Transformable(source),
+m_current(source.m_current),
+m_particleCount(std::exchange(source.m_particleCount, 0U)),
+m_program(std::exchange(source.m_program, 0U)),
+m_parametersLocation(source.m_parametersLocation),
+m_renderShader(std::move(source.m_renderShader)),
+m_emitters(source.m_emitters),
+m_emitterCount(source.m_emitterCount),
+m_attractors(source.m_attractors),
+m_attractorCount(source.m_attractorCount),
+m_gravity(source.m_gravity),
+m_drag(source.m_drag),
+m_emitting(source.m_emitting),
+m_step(source.m_step),
+m_texture(source.m_texture),
+m_textureRect(source.m_textureRect)
+{
+    m_buffers[0].swap(source.m_buffers[0]);
+    m_buffers[1].swap(source.m_buffers[1]);
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem& ParticleSystem::operator=(ParticleSystem&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_program)
+    {
+        const TransientContextLock lock;
+
+        glCheck(GLEXT_core_glDeleteProgram(m_program));
+    }
+
+    Transformable::operator=(right);
+    m_buffers[0].swap(right.m_buffers[0]);
+    m_buffers[1].swap(right.m_buffers[1]);
+    m_current            = right.m_current;
+    m_particleCount      = std::exchange(right.m_particleCount, 0U);
+    m_program            = std::exchange(right.m_program, 0U);
+    m_parametersLocation = right.m_parametersLocation;
+    m_renderShader       = std::move(right.m_renderShader);
+    m_emitters           = right.m_emitters;
+    m_emitterCount       = right.m_emitterCount;
+    m_attractors         = right.m_attractors;
+    m_attractorCount     = right.m_attractorCount;
+    m_gravity            = right.m_gravity;
+    m_drag               = right.m_drag;
+    m_emitting           = right.m_emitting;
+    m_step               = right.m_step;
+    m_texture            = right.m_texture;
+    m_textureRect        = right.m_textureRect;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<ParticleSystem> ParticleSystem::create(std::size_t particleCount)
+{
+    if (!isAvailable())
+    {
+        err() << "Failed to create particle system, your system doesn't support it "
+              << "(you should test ParticleSystem::isAvailable() before trying to use the ParticleSystem class)"
+              << std::endl;
+        return std::nullopt;
+    }
+
+    if (particleCount == 0)
+    {
+        err() << "Failed to create particle system, it must contain at least one particle" << std::endl;
+        return std::nullopt;
+    }
+
+    auto renderShader = Shader::loadFromMemory(ParticleSystemImpl::renderVertexShaderSource,
+                                               ParticleSystemImpl::renderGeometryShaderSource,
+                                               ParticleSystemImpl::renderFragmentShaderSource);
+    if (!renderShader)
+    {
+        err() << "Failed to create the render shader of the particle system" << std::endl;
+        return std::nullopt;
+    }
+
+    const TransientContextLock lock;
+
+    const GLuint program = ParticleSystemImpl::createSimulationProgram();
+    if (!program)
+        return std::nullopt;
+
+    std::optional<ParticleSystem> particleSystem(ParticleSystem(program, std::move(*renderShader)));
+
+    for (VertexBuffer& buffer : particleSystem->m_buffers)
+    {
+        buffer.setPrimitiveType(PrimitiveType::Points);
+        buffer.setLayout(ParticleSystemImpl::particleLayout());
+        if (!buffer.create(particleCount))
+        {
+            err() << "Failed to create the vertex buffers of the particle system" << std::endl;
+            return std::nullopt;
+        }
+    }
+
+    particleSystem->m_particleCount = particleCount;
+    particleSystem->reset();
+    particleSystem->updateTextureUniforms();
+
+    return particleSystem;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_particleCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed)
+{
+    using namespace ParticleSystemImpl;
+
+    if (!m_program)
+        return;
+
+    // Gather the parameters, so that a single upload is needed
+    std::array<std::array<float, 4>, parameterCount> parameters{};
+    parameters[0] = {m_gravity.x, m_gravity.y, m_drag, elapsed.asSeconds()};
+    parameters[1] = {static_cast<float>(m_step++ & 0xFFFFFF),
+                     static_cast<float>(m_emitterCount),
+                     static_cast<float>(m_attractorCount),
+                     m_emitting ? 1.f : 0.f};
+
+    for (std::size_t i = 0; i < m_emitterCount; ++i)
+    {
+        const Emitter&    emitter = m_emitters[i];
+        const std::size_t offset  = globalParameterCount + i * emitterParameterCount;
+
+        parameters[offset]     = {emitter.position.x, emitter.position.y, emitter.size.x, emitter.size.y};
+        parameters[offset + 1] = {emitter.direction.asRadians(),
+                                  emitter.spread.asRadians(),
+                                  emitter.minSpeed,
+                                  emitter.maxSpeed};
+        parameters[offset + 2] = {emitter.minLifetime.asSeconds(),
+                                  emitter.maxLifetime.asSeconds(),
+                                  emitter.startSize,
+                                  emitter.endSize};
+        parameters[offset + 3] = toVec4(emitter.startColor);
+        parameters[offset + 4] = toVec4(emitter.endColor);
+    }
+
+    for (std::size_t i = 0; i < m_attractorCount; ++i)
+    {
+        const Attractor& attractor = m_attractors[i];
+        parameters[attractorOffset + i] = {attractor.position.x, attractor.position.y, attractor.strength, 0.f};
+    }
+
+    const TransientContextLock lock;
+
+    const VertexBuffer& source      = m_buffers[m_current];
+    const VertexBuffer& destination = m_buffers[1 - m_current];
+
+    glCheck(GLEXT_core_glUseProgram(m_program));
+    glCheck(GLEXT_core_glUniform4fv(m_parametersLocation,
+                                    static_cast<GLsizei>(parameters.size()),
+                                    parameters.data()->data()));
+
+    // Read the position, velocity and life of the current particles
+    VertexBuffer::bind(&source);
+    for (GLuint i = 0; i < 3; ++i)
+    {
+        const auto* offset = reinterpret_cast<const std::byte*>(i * sizeof(Vector2f));
+        glCheck(GLEXT_core_glEnableVertexAttribArray(i));
+        glCheck(GLEXT_core_glVertexAttribPointer(i, 2, GL_FLOAT, GL_FALSE, sizeof(Particle), offset));
+    }
+
+    // Write the next particles without rasterizing anything
+    glCheck(GLEXT_glBindBufferBase(GLEXT_GL_TRANSFORM_FEEDBACK_BUFFER, 0, destination.getNativeHandle()));
+    glCheck(glEnable(GLEXT_GL_RASTERIZER_DISCARD));
+    glCheck(GLEXT_glBeginTransformFeedback(GL_POINTS));
+    glCheck(glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(m_particleCount)));
+    glCheck(GLEXT_glEndTransformFeedback());
+    glCheck(glDisable(GLEXT_GL_RASTERIZER_DISCARD));
+    glCheck(GLEXT_glBindBufferBase(GLEXT_GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0));
+
+    for (GLuint i = 0; i < 3; ++i)
+        glCheck(GLEXT_core_glDisableVertexAttribArray(i));
+    VertexBuffer::bind(nullptr);
+    glCheck(GLEXT_core_glUseProgram(0));
+
+    m_current = 1 - m_current;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::reset()
+{
+    if (!m_program)
+        return;
+
+    // Particles start dead with a negative age, which sets when they spawn
+    std::vector<ParticleSystemImpl::Particle> particles(m_particleCount);
+    for (std::size_t i = 0; i < m_particleCount; ++i)
+    {
+        const float delay = m_emitters[i % m_emitterCount].maxLifetime.asSeconds() * static_cast<float>(i) /
+                            static_cast<float>(m_particleCount);
+        particles[i].life = {-delay, 0.f};
+    }
+
+    if (!m_buffers[m_current].update(particles.data(), particles.size(), 0))
+        err() << "Failed to reset the particles of the particle system" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setEmitting(bool emitting)
+{
+    m_emitting = emitting;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::isEmitting() const
+{
+    return m_emitting;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setEmitterCount(std::size_t count)
+{
+    assert(count >= 1 && count <= MaxEmitters && "Invalid number of emitters");
+
+    for (std::size_t i = m_emitterCount; i < count; ++i)
+        m_emitters[i] = Emitter();
+
+    m_emitterCount = count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getEmitterCount() const
+{
+    return m_emitterCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setEmitter(std::size_t index, const Emitter& emitter)
+{
+    assert(index < m_emitterCount && "Index is out of bounds");
+    m_emitters[index] = emitter;
+}
+
+
+////////////////////////////////////////////////////////////
+const ParticleSystem::Emitter& ParticleSystem::getEmitter(std::size_t index) const
+{
+    assert(index < m_emitterCount && "Index is out of bounds");
+    return m_emitters[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAttractorCount(std::size_t count)
+{
+    assert(count <= MaxAttractors && "Invalid number of attractors");
+
+    for (std::size_t i = m_attractorCount; i < count; ++i)
+        m_attractors[i] = Attractor();
+
+    m_attractorCount = count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getAttractorCount() const
+{
+    return m_attractorCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAttractor(std::size_t index, const Attractor& attractor)
+{
+    assert(index < m_attractorCount && "Index is out of bounds");
+    m_attractors[index] = attractor;
+}
+
+
+////////////////////////////////////////////////////////////
+const ParticleSystem::Attractor& ParticleSystem::getAttractor(std::size_t index) const
+{
+    assert(index < m_attractorCount && "Index is out of bounds");
+    return m_attractors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setGravity(Vector2f gravity)
+{
+    m_gravity = gravity;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getGravity() const
+{
+    return m_gravity;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setDrag(float drag)
+{
+    m_drag = drag;
+}
+
+
+////////////////////////////////////////////////////////////
+float ParticleSystem::getDrag() const
+{
+    return m_drag;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTexture(const Texture* texture, bool resetRect)
+{
+    if (texture)
+    {
+        // Recompute the texture area if requested, or if there was no texture & rect before
+        if (resetRect || (!m_texture && (m_textureRect == IntRect())))
+            m_textureRect = IntRect({0, 0}, Vector2i(texture->getSize()));
+    }
+
+    m_texture = texture;
+    updateTextureUniforms();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ParticleSystem::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTextureRect(const IntRect& rect)
+{
+    m_textureRect = rect;
+    updateTextureUniforms();
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& ParticleSystem::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::isAvailable()
+{
+    static const bool available = []
+    {
+        if (!VertexBuffer::isAvailable() || !Shader::isGeometryAvailable())
+            return false;
+
+        const TransientContextLock lock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_transform_feedback && GLEXT_core_profile;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, RenderStates states) const
+{
+    if (!m_program)
+        return;
+
+    states.transform *= getTransform();
+    states.texture = nullptr;
+    states.shader  = &m_renderShader;
+
+    target.draw(m_buffers[m_current], states);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateTextureUniforms()
+{
+    if (!m_texture)
+    {
+        m_renderShader.setUniform("sf_textured", false);
+        return;
+    }
+
+    const Vector2f size(m_texture->getSize());
+    const auto     rect = FloatRect(m_textureRect);
+    m_renderShader.setUniform("sf_textured", true);
+    m_renderShader.setUniform("sf_texture", *m_texture);
+    m_renderShader.setUniform("sf_textureRect",
+                              Glsl::Vec4(rect.left / size.x,
+                                         rect.top / size.y,
+                                         (rect.left + rect.width) / size.x,
+                                         (rect.top + rect.height) / size.y));
+}
+
+} // namespace sf
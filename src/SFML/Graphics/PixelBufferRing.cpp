@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/PixelBufferRing.hpp>
+
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PixelBufferRingImpl
+{
+// Mutex to protect the context-PixelBufferRing map
+std::mutex& getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Map to find the pixel buffer ring owned by a given context
+using ContextPixelBufferRingMap = std::unordered_map<std::uint64_t, std::weak_ptr<sf::priv::PixelBufferRing>>;
+ContextPixelBufferRingMap& getContextPixelBufferRingMap()
+{
+    static ContextPixelBufferRingMap contextPixelBufferRingMap;
+    return contextPixelBufferRingMap;
+}
+
+// Gives access to the registration of objects tied to the lifetime of a context
+struct UnsharedObjectRegistry : sf::GlResource
+{
+    static void add(std::shared_ptr<void> object)
+    {
+        registerUnsharedGlObject(std::move(object));
+    }
+};
+} // namespace PixelBufferRingImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+PixelBufferRing::PixelBufferRing()
+{
+    for (Slot& slot : m_slots)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &slot.buffer));
+
+        if (!slot.buffer)
+        {
+            err() << "Could not create pixel buffer, generation failed" << std::endl;
+            return;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+PixelBufferRing::~PixelBufferRing()
+{
+    // Pixel buffer rings are only destroyed along with their context, which is active at this point
+    for (const Slot& slot : m_slots)
+    {
+        if (slot.fence)
+            glCheck(GLEXT_glDeleteSync(slot.fence));
+
+        if (slot.buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &slot.buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+PixelBufferRing* PixelBufferRing::getCurrent()
+{
+    if (!GLEXT_vertex_buffer_object || !GLEXT_pixel_buffer_object)
+        return nullptr;
+
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    if (!contextId)
+        return nullptr;
+
+    // Rings live as long as their context, each thread remembers the one of the context it used last
+    thread_local std::pair<std::uint64_t, PixelBufferRing*> lastPixelBufferRing;
+    if (lastPixelBufferRing.first == contextId)
+        return lastPixelBufferRing.second;
+
+    const std::lock_guard lock(PixelBufferRingImpl::getMutex());
+
+    auto& contextPixelBufferRingMap = PixelBufferRingImpl::getContextPixelBufferRingMap();
+
+    if (const auto it = contextPixelBufferRingMap.find(contextId); it != contextPixelBufferRingMap.end())
+    {
+        if (const auto pixelBufferRing = it->second.lock())
+        {
+            lastPixelBufferRing = {contextId, pixelBufferRing.get()};
+            return lastPixelBufferRing.second;
+        }
+    }
+
+    // Forget about the rings of contexts that have been destroyed
+    for (auto it = contextPixelBufferRingMap.begin(); it != contextPixelBufferRingMap.end();)
+    {
+        if (it->second.expired())
+            it = contextPixelBufferRingMap.erase(it);
+        else
+            ++it;
+    }
+
+    auto pixelBufferRing = std::make_shared<PixelBufferRing>();
+
+    if (!pixelBufferRing->m_slots.back().buffer)
+        return nullptr;
+
+    auto* const result = pixelBufferRing.get();
+    contextPixelBufferRingMap.emplace(contextId, pixelBufferRing);
+
+    // Register the ring with the current context so it is automatically destroyed
+    PixelBufferRingImpl::UnsharedObjectRegistry::add(std::move(pixelBufferRing));
+
+    lastPixelBufferRing = {contextId, result};
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PixelBufferRing::write(const void* data, std::size_t size)
+{
+    if (!data || !size)
+        return false;
+
+    Slot& slot = m_slots[m_next];
+
+    // Wait until the GPU is done reading from the buffer we are about to overwrite,
+    // this only blocks if all the buffers of the ring are still in flight
+    if (slot.fence)
+    {
+        GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+
+        while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+            glCheck(result = GLEXT_glClientWaitSync(slot.fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1000000));
+
+        glCheck(GLEXT_glDeleteSync(slot.fence));
+        slot.fence = nullptr;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, slot.buffer));
+
+    // Grow the storage if needed; without fences, also orphan it so that
+    // the driver hands us fresh memory instead of waiting for pending uploads
+    if ((size > slot.capacity) || !GLEXT_sync)
+    {
+        slot.capacity = std::max(size, slot.capacity);
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(slot.capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+    }
+
+    void* destination = nullptr;
+    glCheck(destination = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, GLEXT_GL_WRITE_ONLY));
+
+    if (destination)
+    {
+        std::memcpy(destination, data, size);
+
+        GLboolean result = GL_FALSE;
+        glCheck(result = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER));
+
+        if (result == GL_TRUE)
+            return true;
+    }
+
+    // Mapping failed or the storage was lost while mapped, copy the pixels through the driver instead
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptrARB>(size), data));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PixelBufferRing::release()
+{
+    Slot& slot = m_slots[m_next];
+
+    // Fence the upload that reads from the buffer
+    if (GLEXT_sync)
+        glCheck(slot.fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+    m_next = (m_next + 1) % slotCount;
+}
+
+} // namespace sf::priv
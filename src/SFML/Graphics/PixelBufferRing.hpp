@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <array>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring of pixel buffers used to upload texture data asynchronously
+///
+/// Every context owns its own ring, which is created the
+/// first time it is requested and destroyed along with
+/// the context.
+///
+/// Pixels are copied into the next pixel buffer of the
+/// ring, from which OpenGL transfers them to the texture
+/// without blocking the caller. When ARB_sync is
+/// available, each buffer is guarded by a fence so that it
+/// is only overwritten once the GPU is done reading it;
+/// otherwise its storage is orphaned before every write.
+///
+////////////////////////////////////////////////////////////
+class PixelBufferRing
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The buffers are created in the currently active context.
+    ///
+    ////////////////////////////////////////////////////////////
+    PixelBufferRing();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PixelBufferRing();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PixelBufferRing(const PixelBufferRing&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PixelBufferRing& operator=(const PixelBufferRing&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pixel buffer ring of the currently active context
+    ///
+    /// \return Pointer to the ring, or a null pointer if
+    ///         pixel buffer objects are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    static PixelBufferRing* getCurrent();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy pixels into the next buffer of the ring
+    ///
+    /// On success the buffer is left bound to
+    /// GL_PIXEL_UNPACK_BUFFER, so that the pixel pointer of the
+    /// following texture upload is an offset in the buffer.
+    /// release() must be called once the upload is issued.
+    ///
+    /// \param data Pointer to the pixels to copy
+    /// \param size Size of the pixels, in bytes
+    ///
+    /// \return True if the pixels were copied into a buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool write(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Fence the buffer written last and unbind it
+    ///
+    ////////////////////////////////////////////////////////////
+    void release();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixel buffer of the ring
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        GLuint       buffer{};   //!< OpenGL identifier of the buffer
+        std::size_t  capacity{}; //!< Size of the buffer storage, in bytes
+        GLEXT_GLsync fence{};    //!< Fence guarding the uploads reading from the buffer
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member constants
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t slotCount = 3; //!< Number of buffers in the ring
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::array<Slot, slotCount> m_slots{}; //!< Buffers of the ring
+    std::size_t                 m_next{};  //!< Index of the buffer to write next
+};
+
+} // namespace sf::priv
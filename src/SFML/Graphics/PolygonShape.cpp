@@ -0,0 +1,569 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PolygonShape.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cassert>
+#include <cstddef>
+
+
+namespace
+{
+namespace PolygonShapeImpl
+{
+// Twice the signed area of a ring of points, positive when its convex vertices turn with a positive cross product
+template <typename Index>
+float computeDoubleArea(const std::vector<sf::Vector2f>& points, const std::vector<Index>& ring)
+{
+    float area = 0.f;
+    for (std::size_t i = 0; i < ring.size(); ++i)
+        area += points[ring[i]].cross(points[ring[(i + 1) % ring.size()]]);
+    return area;
+}
+
+
+bool isInTriangle(sf::Vector2f point, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c)
+{
+    return ((b - a).cross(point - a) >= 0.f) && ((c - b).cross(point - b) >= 0.f) && ((a - c).cross(point - c) >= 0.f);
+}
+
+
+// Same as isInTriangle, for triangles of any orientation
+bool isInAnyTriangle(sf::Vector2f point, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c)
+{
+    return (b - a).cross(c - a) >= 0.f ? isInTriangle(point, a, b, c) : isInTriangle(point, a, c, b);
+}
+
+
+// Tell whether a point is inside the corner of a ring of positive area at vertex b, between its edges ab and bc
+bool isInCorner(sf::Vector2f point, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c)
+{
+    const bool leftOfAB = (b - a).cross(point - a) > 0.f;
+    const bool leftOfBC = (c - b).cross(point - b) > 0.f;
+    return (b - a).cross(c - b) >= 0.f ? leftOfAB && leftOfBC : leftOfAB || leftOfBC;
+}
+
+
+// Connect a hole to the outer ring by a pair of edges, so that both can be triangulated as a single polygon
+// (David Eberly, "Triangulation by Ear Clipping")
+void mergeHole(const std::vector<sf::Vector2f>&  points,
+               std::vector<std::uint32_t>&        ring,
+               const std::vector<std::uint32_t>& hole)
+{
+    // Cast a ray towards +x from the rightmost vertex of the hole, and find the nearest edge it hits
+    const auto rightmost = static_cast<std::size_t>(
+        std::max_element(hole.begin(),
+                         hole.end(),
+                         [&points](std::uint32_t a, std::uint32_t b) { return points[a].x < points[b].x; }) -
+        hole.begin());
+    const sf::Vector2f origin = points[hole[rightmost]];
+
+    float       nearest = 0.f;
+    std::size_t bridge  = ring.size();
+    for (std::size_t i = 0; i < ring.size(); ++i)
+    {
+        const std::size_t  j   = (i + 1) % ring.size();
+        const sf::Vector2f a   = points[ring[i]];
+        const sf::Vector2f b   = points[ring[j]];
+        const bool         hit = bridge != ring.size();
+        if (a.y == origin.y)
+        {
+            // The ray hits a vertex, which is visible
+            if ((a.x >= origin.x) && (!hit || (a.x < nearest)))
+            {
+                nearest = a.x;
+                bridge  = i;
+            }
+        }
+        else if ((b.y != origin.y) && ((a.y < origin.y) != (b.y < origin.y)))
+        {
+            // The ray crosses an edge, whose endpoint with the largest x is the candidate for the bridge
+            const float x = a.x + (origin.y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if ((x >= origin.x) && (!hit || (x < nearest)))
+            {
+                nearest = x;
+                bridge  = a.x > b.x ? i : j;
+            }
+        }
+    }
+
+    // The hole isn't inside the polygon
+    if (bridge == ring.size())
+        return;
+
+    // The candidate is only visible if no reflex vertex lies in the triangle between the ray and the candidate;
+    // otherwise the reflex vertex making the smallest angle with the ray is
+    const sf::Vector2f intersection(nearest, origin.y);
+    const sf::Vector2f candidate = points[ring[bridge]];
+    if (candidate != intersection)
+    {
+        float bestCosine   = -1.f;
+        float bestDistance = 0.f;
+        for (std::size_t i = 0; i < ring.size(); ++i)
+        {
+            const sf::Vector2f point    = points[ring[i]];
+            const sf::Vector2f previous = points[ring[(i + ring.size() - 1) % ring.size()]];
+            const sf::Vector2f next     = points[ring[(i + 1) % ring.size()]];
+            if ((point == candidate) || ((point - previous).cross(next - point) >= 0.f) ||
+                !isInAnyTriangle(point, origin, intersection, candidate))
+                continue;
+
+            const float distance = (point - origin).length();
+            const float cosine   = distance > 0.f ? (point.x - origin.x) / distance : 1.f;
+            if ((cosine > bestCosine) || ((cosine == bestCosine) && (distance < bestDistance)))
+            {
+                bestCosine   = cosine;
+                bestDistance = distance;
+                bridge       = i;
+            }
+        }
+    }
+
+    // Earlier bridges duplicate vertices: connect to the copy whose corner the hole is in
+    for (std::size_t i = 0; i < ring.size(); ++i)
+    {
+        if ((ring[i] == ring[bridge]) && (i != bridge))
+        {
+            const sf::Vector2f point    = points[ring[i]];
+            const sf::Vector2f previous = points[ring[(i + ring.size() - 1) % ring.size()]];
+            const sf::Vector2f next     = points[ring[(i + 1) % ring.size()]];
+            if (isInCorner(origin, previous, point, next))
+                bridge = i;
+        }
+    }
+
+    // Splice the hole in after the bridge vertex, going around it and back to the bridge vertex
+    std::vector<std::uint32_t> splice;
+    splice.reserve(hole.size() + 2);
+    for (std::size_t i = 0; i <= hole.size(); ++i)
+        splice.push_back(hole[(rightmost + i) % hole.size()]);
+    splice.push_back(ring[bridge]);
+
+    ring.insert(ring.begin() + static_cast<std::ptrdiff_t>(bridge) + 1, splice.begin(), splice.end());
+}
+
+
+// Triangulate a simple polygon with a positive area by ear clipping
+void clipEars(const std::vector<sf::Vector2f>&  points,
+              const std::vector<std::uint32_t>& ring,
+              std::vector<std::uint32_t>&       indices)
+{
+    // The remaining vertices form a doubly linked list
+    std::vector<std::size_t> previous(ring.size());
+    std::vector<std::size_t> next(ring.size());
+    for (std::size_t i = 0; i < ring.size(); ++i)
+    {
+        previous[i] = (i + ring.size() - 1) % ring.size();
+        next[i]     = (i + 1) % ring.size();
+    }
+
+    const auto isEar = [&](std::size_t vertex)
+    {
+        const sf::Vector2f a = points[ring[previous[vertex]]];
+        const sf::Vector2f b = points[ring[vertex]];
+        const sf::Vector2f c = points[ring[next[vertex]]];
+        if ((b - a).cross(c - b) < 0.f)
+            return false;
+
+        // Only the vertices at other positions than the triangle can be in it (bridges duplicate vertices)
+        for (std::size_t i = next[next[vertex]]; i != previous[vertex]; i = next[i])
+        {
+            const sf::Vector2f point = points[ring[i]];
+            if ((point != a) && (point != b) && (point != c) && isInTriangle(point, a, b, c))
+                return false;
+        }
+
+        return true;
+    };
+
+    std::size_t vertex    = 0;
+    std::size_t remaining = ring.size();
+    std::size_t attempts  = 0;
+    while (remaining > 3)
+    {
+        // If no ear is left (the polygon isn't simple or has rounding issues), clip anyway to terminate
+        if (isEar(vertex) || (attempts >= remaining))
+        {
+            indices.push_back(ring[previous[vertex]]);
+            indices.push_back(ring[vertex]);
+            indices.push_back(ring[next[vertex]]);
+
+            next[previous[vertex]] = next[vertex];
+            previous[next[vertex]] = previous[vertex];
+            vertex                 = next[vertex];
+            --remaining;
+            attempts = 0;
+        }
+        else
+        {
+            vertex = next[vertex];
+            ++attempts;
+        }
+    }
+
+    indices.push_back(ring[previous[vertex]]);
+    indices.push_back(ring[vertex]);
+    indices.push_back(ring[next[vertex]]);
+}
+} // namespace PolygonShapeImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PolygonShape::PolygonShape(std::size_t pointCount) :
+m_vertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Static),
+m_indexBuffer(IndexBuffer::Type::UInt32, IndexBuffer::Usage::Static)
+{
+    setPointCount(pointCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPointCount(std::size_t count)
+{
+    m_points.resize(count);
+    m_triangulationNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getPointCount() const
+{
+    return m_points.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPoint(std::size_t index, const Vector2f& point)
+{
+    assert(index < m_points.size() && "Index is out of bounds");
+    m_points[index]           = point;
+    m_triangulationNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f PolygonShape::getPoint(std::size_t index) const
+{
+    assert(index < m_points.size() && "Index is out of bounds");
+    return m_points[index];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::addHole(std::vector<Vector2f> points)
+{
+    m_holes.push_back(std::move(points));
+    m_triangulationNeedUpdate = true;
+    return m_holes.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::clearHoles()
+{
+    m_holes.clear();
+    m_triangulationNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getHoleCount() const
+{
+    return m_holes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Vector2f>& PolygonShape::getHole(std::size_t index) const
+{
+    assert(index < m_holes.size() && "Index is out of bounds");
+    return m_holes[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTexture(const Texture* texture, bool resetRect)
+{
+    if (texture)
+    {
+        // Recompute the texture area if requested, or if there was no texture & rect before
+        if (resetRect || (!m_texture && (m_textureRect == IntRect())))
+            setTextureRect(IntRect({0, 0}, Vector2i(texture->getSize())));
+    }
+
+    // Assign the new texture
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* PolygonShape::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTextureRect(const IntRect& rect)
+{
+    m_textureRect        = rect;
+    m_verticesNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& PolygonShape::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setFillColor(const Color& color)
+{
+    m_fillColor          = color;
+    m_verticesNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& PolygonShape::getFillColor() const
+{
+    return m_fillColor;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<std::uint32_t>& PolygonShape::getTriangleIndices() const
+{
+    if (m_triangulationNeedUpdate)
+        updateTriangulation();
+
+    return m_indices;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getLocalBounds() const
+{
+    if (m_triangulationNeedUpdate)
+        updateTriangulation();
+
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_triangulationNeedUpdate)
+        updateTriangulation();
+
+    if (m_indices.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.coordinateType = CoordinateType::Pixels;
+
+    if (target.cull(m_bounds, states.transform))
+        return;
+
+    if (m_verticesNeedUpdate)
+        updateVertices();
+
+    states.texture = m_texture;
+
+    if (updateBuffers())
+        target.draw(m_vertexBuffer, m_indexBuffer, 0, m_indices.size(), states);
+    else
+        target.draw(m_triangles.data(), m_triangles.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateTriangulation() const
+{
+    m_triangulationNeedUpdate = false;
+    m_verticesNeedUpdate      = true;
+    m_indexBufferNeedUpdate   = true;
+    m_indices.clear();
+
+    // The bounds only depend on the outline, holes are inside it
+    m_bounds = {};
+    if (!m_points.empty())
+    {
+        Vector2f minimum = m_points[0];
+        Vector2f maximum = m_points[0];
+        for (const Vector2f& point : m_points)
+        {
+            minimum.x = std::min(minimum.x, point.x);
+            minimum.y = std::min(minimum.y, point.y);
+            maximum.x = std::max(maximum.x, point.x);
+            maximum.y = std::max(maximum.y, point.y);
+        }
+
+        m_bounds = FloatRect(minimum, maximum - minimum);
+    }
+
+    if (m_points.size() < 3)
+        return;
+
+    // Gather all the points, in the order of the vertices, and orient the outline with a positive area
+    std::vector<Vector2f> points = m_points;
+    for (const std::vector<Vector2f>& hole : m_holes)
+        points.insert(points.end(), hole.begin(), hole.end());
+
+    std::vector<std::uint32_t> ring(m_points.size());
+    for (std::size_t i = 0; i < ring.size(); ++i)
+        ring[i] = static_cast<std::uint32_t>(i);
+
+    if (PolygonShapeImpl::computeDoubleArea(points, ring) < 0.f)
+        std::reverse(ring.begin(), ring.end());
+
+    // Holes are oriented the other way, and merged from right to left so that each bridge only crosses the outline
+    std::vector<std::vector<std::uint32_t>> holes;
+    auto                                   first = static_cast<std::uint32_t>(m_points.size());
+    for (const std::vector<Vector2f>& hole : m_holes)
+    {
+        if (hole.size() >= 3)
+        {
+            std::vector<std::uint32_t>& indices = holes.emplace_back(hole.size());
+            for (std::size_t i = 0; i < hole.size(); ++i)
+                indices[i] = first + static_cast<std::uint32_t>(i);
+
+            if (PolygonShapeImpl::computeDoubleArea(points, indices) > 0.f)
+                std::reverse(indices.begin(), indices.end());
+        }
+
+        first += static_cast<std::uint32_t>(hole.size());
+    }
+
+    const auto maxX = [&points](const std::vector<std::uint32_t>& hole)
+    {
+        float x = points[hole[0]].x;
+        for (const std::uint32_t index : hole)
+            x = std::max(x, points[index].x);
+        return x;
+    };
+    std::sort(holes.begin(),
+              holes.end(),
+              [&maxX](const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b)
+              { return maxX(a) > maxX(b); });
+
+    for (const std::vector<std::uint32_t>& hole : holes)
+        PolygonShapeImpl::mergeHole(points, ring, hole);
+
+    m_indices.reserve((ring.size() - 2) * 3);
+    PolygonShapeImpl::clipEars(points, ring, m_indices);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateVertices() const
+{
+    m_verticesNeedUpdate = false;
+    m_buffersNeedUpdate  = true;
+    m_vertices.clear();
+
+    const auto addVertex = [this](const Vector2f& position)
+    {
+        // The texture is mapped onto the bounds of the outline, like for sf::Shape
+        const FloatRect textureRect(m_textureRect);
+        const float     xratio = m_bounds.width > 0 ? (position.x - m_bounds.left) / m_bounds.width : 0;
+        const float     yratio = m_bounds.height > 0 ? (position.y - m_bounds.top) / m_bounds.height : 0;
+        m_vertices.push_back(
+            {position, m_fillColor, textureRect.getPosition() + textureRect.getSize().cwiseMul({xratio, yratio})});
+    };
+
+    for (const Vector2f& point : m_points)
+        addVertex(point);
+
+    for (const std::vector<Vector2f>& hole : m_holes)
+    {
+        for (const Vector2f& point : hole)
+            addVertex(point);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool PolygonShape::updateBuffers() const
+{
+    if (!m_buffersNeedUpdate)
+        return m_useBuffers;
+
+    m_buffersNeedUpdate = false;
+    m_useBuffers        = false;
+
+    if (VertexBuffer::isAvailable() && IndexBuffer::isAvailable())
+    {
+        // The buffers are static: they are only uploaded again when the polygon changes, and are reallocated
+        // by update when they grow (the end of a buffer that shrank is simply not drawn)
+        m_useBuffers = (m_vertexBuffer.getNativeHandle() || m_vertexBuffer.create(m_vertices.size())) &&
+                       m_vertexBuffer.update(m_vertices.data(), m_vertices.size(), 0);
+
+        if (m_useBuffers && m_indexBufferNeedUpdate)
+        {
+            m_useBuffers = (m_indexBuffer.getNativeHandle() || m_indexBuffer.create(m_indices.size())) &&
+                           m_indexBuffer.update(m_indices.data(), m_indices.size());
+        }
+
+        m_indexBufferNeedUpdate = !m_useBuffers;
+    }
+
+    if (m_useBuffers)
+    {
+        m_triangles.clear();
+        return true;
+    }
+
+    // Fall back to drawing triangles from a client-side array
+    m_triangles.resize(m_indices.size());
+    for (std::size_t i = 0; i < m_indices.size(); ++i)
+        m_triangles[i] = m_vertices[m_indices[i]];
+
+    return false;
+}
+
+} // namespace sf
@@ -0,0 +1,441 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/PostProcessChain.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include <cassert>
+
+
+namespace
+{
+namespace PostProcessChainImpl
+{
+// Per-pixel stages fused in the final pass, in the order they are applied
+constexpr unsigned int bloomStage        = 1 << 0;
+constexpr unsigned int tonemappingStage  = 1 << 1;
+constexpr unsigned int colorGradingStage = 1 << 2;
+constexpr unsigned int vignetteStage     = 1 << 3;
+
+// Fragment shader of the separable gaussian blur, optionally keeping only the bright pixels
+constexpr std::string_view blurShaderSource = R"(
+uniform sampler2D texture;
+uniform vec2      direction;
+uniform float     threshold;
+
+vec3 sampleBright(vec2 position)
+{
+    vec3  color     = texture2D(texture, position).rgb;
+    float luminance = dot(color, vec3(0.2126, 0.7152, 0.0722));
+    return color * (max(luminance - threshold, 0.0) / max(luminance, 0.0001));
+}
+
+void main()
+{
+    vec2 position = gl_TexCoord[0].xy;
+    vec3 color    = sampleBright(position) * 0.227027;
+    color += (sampleBright(position + direction) + sampleBright(position - direction)) * 0.1945946;
+    color += (sampleBright(position + 2.0 * direction) + sampleBright(position - 2.0 * direction)) * 0.1216216;
+    color += (sampleBright(position + 3.0 * direction) + sampleBright(position - 3.0 * direction)) * 0.054054;
+    color += (sampleBright(position + 4.0 * direction) + sampleBright(position - 4.0 * direction)) * 0.016216;
+
+    gl_FragColor = vec4(color, texture2D(texture, position).a);
+}
+)";
+
+// Build the fragment shader applying the given per-pixel stages in a single pass
+std::string generateFusedShaderSource(unsigned int stages)
+{
+    std::string uniforms = "uniform sampler2D texture;\n"
+                           "uniform vec2 targetSize;\n";
+    std::string body;
+
+    // The bloom and the vignette are sampled from the position of the pixel, which doesn't depend on whether
+    // the textures are flipped
+    if (stages & bloomStage)
+    {
+        uniforms += "uniform sampler2D bloom;\n"
+                    "uniform float bloomIntensity;\n";
+        body += "    color.rgb += texture2D(bloom, screenPosition).rgb * bloomIntensity;\n";
+    }
+
+    // Approximation of the ACES filmic curve by Krzysztof Narkowicz
+    if (stages & tonemappingStage)
+    {
+        uniforms += "uniform float exposure;\n";
+        body += "    color.rgb *= exposure;\n"
+                "    color.rgb = clamp((color.rgb * (2.51 * color.rgb + 0.03)) /\n"
+                "                      (color.rgb * (2.43 * color.rgb + 0.59) + 0.14), 0.0, 1.0);\n";
+    }
+
+    if (stages & colorGradingStage)
+    {
+        uniforms += "uniform float brightness;\n"
+                    "uniform float contrast;\n"
+                    "uniform float saturation;\n"
+                    "uniform vec4 tint;\n";
+        body += "    color.rgb = (color.rgb - 0.5) * contrast + 0.5 + brightness;\n"
+                "    float luminance = dot(color.rgb, vec3(0.2126, 0.7152, 0.0722));\n"
+                "    color.rgb = clamp(mix(vec3(luminance), color.rgb, saturation), 0.0, 1.0) * tint.rgb;\n";
+    }
+
+    if (stages & vignetteStage)
+    {
+        uniforms += "uniform float vignetteIntensity;\n"
+                    "uniform float vignetteRadius;\n"
+                    "uniform float vignetteSoftness;\n";
+        body += "    float centerDistance = length(screenPosition - 0.5) * 1.4142136;\n"
+                "    float vignetteEdge = vignetteRadius - max(vignetteSoftness, 0.0001);\n"
+                "    float vignette = 1.0 - smoothstep(vignetteEdge, vignetteRadius, centerDistance);\n"
+                "    color.rgb *= mix(1.0, vignette, vignetteIntensity);\n";
+    }
+
+    return uniforms +
+           "\n"
+           "void main()\n"
+           "{\n"
+           "    vec2 screenPosition = gl_FragCoord.xy / targetSize;\n"
+           "    vec4 color = texture2D(texture, gl_TexCoord[0].xy);\n" +
+           body + "    gl_FragColor = color * gl_Color;\n}\n";
+}
+} // namespace PostProcessChainImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PostProcessChain::PostProcessChain() = default;
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::setBlur(const Blur& blur)
+{
+    m_blur = blur;
+}
+
+
+////////////////////////////////////////////////////////////
+const PostProcessChain::Blur& PostProcessChain::getBlur() const
+{
+    return m_blur;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::setBloom(const Bloom& bloom)
+{
+    m_bloom = bloom;
+}
+
+
+////////////////////////////////////////////////////////////
+const PostProcessChain::Bloom& PostProcessChain::getBloom() const
+{
+    return m_bloom;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::setTonemapping(const Tonemapping& tonemapping)
+{
+    m_tonemapping = tonemapping;
+}
+
+
+////////////////////////////////////////////////////////////
+const PostProcessChain::Tonemapping& PostProcessChain::getTonemapping() const
+{
+    return m_tonemapping;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::setColorGrading(const ColorGrading& colorGrading)
+{
+    m_colorGrading = colorGrading;
+}
+
+
+////////////////////////////////////////////////////////////
+const PostProcessChain::ColorGrading& PostProcessChain::getColorGrading() const
+{
+    return m_colorGrading;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::setVignette(const Vignette& vignette)
+{
+    m_vignette = vignette;
+}
+
+
+////////////////////////////////////////////////////////////
+const PostProcessChain::Vignette& PostProcessChain::getVignette() const
+{
+    return m_vignette;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* PostProcessChain::beginFrame(const Vector2u& size, const ContextSettings& settings)
+{
+    assert(!m_scene && "PostProcessChain::beginFrame() The previous frame must be ended first");
+
+    m_scene = m_pool.acquire(size, settings);
+    if (m_scene)
+        m_scene->setSmooth(true);
+
+    return m_scene;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::endFrame(RenderTarget& target)
+{
+    assert(m_scene && "PostProcessChain::endFrame() No frame was begun");
+
+    m_scene->display();
+    apply(m_scene->getTexture(), target);
+
+    m_pool.release(*m_scene);
+    m_scene = nullptr;
+    m_pool.endFrame();
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::apply(const Texture& source, RenderTarget& target)
+{
+    using namespace PostProcessChainImpl;
+
+    m_passCount = 0;
+
+    const bool blurActive  = m_blur.enabled && (m_blur.radius > 0.f);
+    const bool bloomActive = m_bloom.enabled && (m_bloom.intensity > 0.f);
+
+    // Stages that keep the colors unchanged are skipped
+    unsigned int stages = 0;
+    if (m_tonemapping.enabled)
+        stages |= tonemappingStage;
+    if (m_colorGrading.enabled &&
+        ((m_colorGrading.brightness != 0.f) || (m_colorGrading.contrast != 1.f) ||
+         (m_colorGrading.saturation != 1.f) || (m_colorGrading.tint != Color::White)))
+        stages |= colorGradingStage;
+    if (m_vignette.enabled && (m_vignette.intensity > 0.f))
+        stages |= vignetteStage;
+
+    const Texture* current = &source;
+    RenderTexture* blurred = nullptr;
+    RenderTexture* bloom   = nullptr;
+
+    if (Shader::isAvailable())
+    {
+        if (blurActive)
+        {
+            blurred = blur(*current, m_blur.radius, m_blur.downsample, 0.f);
+            if (blurred)
+                current = &blurred->getTexture();
+        }
+
+        if (bloomActive)
+        {
+            bloom = blur(*current, m_bloom.radius, m_bloom.downsample, m_bloom.threshold);
+            if (bloom)
+                stages |= bloomStage;
+        }
+    }
+
+    // All the per-pixel stages are applied while drawing to the target
+    Shader* shader = getFusedShader(stages);
+    if (shader)
+    {
+        shader->setUniform("targetSize", Glsl::Vec2(Vector2f(target.getSize())));
+
+        if (stages & bloomStage)
+        {
+            shader->setUniform("bloom", bloom->getTexture());
+            shader->setUniform("bloomIntensity", m_bloom.intensity);
+        }
+
+        if (stages & tonemappingStage)
+            shader->setUniform("exposure", m_tonemapping.exposure);
+
+        if (stages & colorGradingStage)
+        {
+            shader->setUniform("brightness", m_colorGrading.brightness);
+            shader->setUniform("contrast", m_colorGrading.contrast);
+            shader->setUniform("saturation", m_colorGrading.saturation);
+            shader->setUniform("tint", Glsl::Vec4(m_colorGrading.tint));
+        }
+
+        if (stages & vignetteStage)
+        {
+            shader->setUniform("vignetteIntensity", m_vignette.intensity);
+            shader->setUniform("vignetteRadius", m_vignette.radius);
+            shader->setUniform("vignetteSoftness", m_vignette.softness);
+        }
+    }
+
+    drawPass(*current, target, shader);
+
+    if (blurred)
+        m_pool.release(*blurred);
+
+    if (bloom)
+        m_pool.release(*bloom);
+
+    // Outside of frames, the unused render textures are trimmed after each call
+    if (!m_scene)
+        m_pool.endFrame();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int PostProcessChain::getPassCount() const
+{
+    return m_passCount;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* PostProcessChain::blur(const Texture& source, float radius, unsigned int downsample, float threshold)
+{
+    if (!m_blurShader && !m_blurShaderFailed)
+    {
+        m_blurShader = Shader::loadFromMemory(PostProcessChainImpl::blurShaderSource, Shader::Type::Fragment);
+        if (m_blurShader)
+        {
+            m_blurShader->setUniform("texture", Shader::CurrentTexture);
+        }
+        else
+        {
+            err() << "Failed to create the post-processing blur shader" << std::endl;
+            m_blurShaderFailed = true;
+        }
+    }
+
+    if (!m_blurShader)
+        return nullptr;
+
+    // Blurring a smaller texture is cheaper, and its bilinear filtering widens the blur for free
+    downsample = std::max(downsample, 1u);
+    const Vector2u size(std::max(source.getSize().x / downsample, 1u), std::max(source.getSize().y / downsample, 1u));
+
+    RenderTexture* horizontal = m_pool.acquire(size);
+    RenderTexture* vertical   = horizontal ? m_pool.acquire(size) : nullptr;
+    if (!vertical)
+    {
+        if (horizontal)
+            m_pool.release(*horizontal);
+
+        return nullptr;
+    }
+
+    horizontal->setSmooth(true);
+    vertical->setSmooth(true);
+
+    // The 9 taps of the kernel span the radius on each side
+    const Vector2f step = Vector2f(radius / 4.f, radius / 4.f).cwiseDiv(Vector2f(source.getSize()));
+
+    m_blurShader->setUniform("direction", Glsl::Vec2(step.x, 0.f));
+    m_blurShader->setUniform("threshold", threshold);
+    drawPass(source, *horizontal, &*m_blurShader);
+    horizontal->display();
+
+    m_blurShader->setUniform("direction", Glsl::Vec2(0.f, step.y));
+    m_blurShader->setUniform("threshold", 0.f);
+    drawPass(horizontal->getTexture(), *vertical, &*m_blurShader);
+    vertical->display();
+
+    m_pool.release(*horizontal);
+    return vertical;
+}
+
+
+////////////////////////////////////////////////////////////
+void PostProcessChain::drawPass(const Texture& source, RenderTarget& destination, const Shader* shader)
+{
+    Sprite sprite(source);
+    sprite.setScale(Vector2f(destination.getSize()).cwiseDiv(Vector2f(source.getSize())));
+
+    RenderStates states(BlendNone);
+    states.shader = shader;
+
+    // The pass covers the whole destination, whatever the viewport of its current view
+    const View view = destination.getView();
+    destination.setView(destination.getDefaultView());
+    destination.draw(sprite, states);
+
+    // Batched draws read the uniforms when they are flushed, so submit them before the uniforms change
+    destination.flush();
+    destination.setView(view);
+
+    ++m_passCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader* PostProcessChain::getFusedShader(unsigned int stages)
+{
+    if ((stages == 0) || !Shader::isAvailable())
+        return nullptr;
+
+    std::optional<Shader>& shader = m_fusedShaders[stages];
+    if (!shader && !(m_failedShaders & (1u << stages)))
+    {
+        const std::string source = PostProcessChainImpl::generateFusedShaderSource(stages);
+        shader                   = Shader::loadFromMemory(source, Shader::Type::Fragment);
+        if (shader)
+        {
+            shader->setUniform("texture", Shader::CurrentTexture);
+        }
+        else
+        {
+            err() << "Failed to create the post-processing shader" << std::endl;
+            m_failedShaders |= 1u << stages;
+        }
+    }
+
+    return shader ? &*shader : nullptr;
+}
+
+} // namespace sf
@@ -0,0 +1,348 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/QoiImage.hpp>
+
+#include <array>
+
+#include <cstring>
+
+
+namespace
+{
+namespace QoiImageImpl
+{
+// See https://qoiformat.org/qoi-specification.pdf
+constexpr std::uint8_t opIndex = 0x00; // 00xxxxxx
+constexpr std::uint8_t opDiff  = 0x40; // 01xxxxxx
+constexpr std::uint8_t opLuma  = 0x80; // 10xxxxxx
+constexpr std::uint8_t opRun   = 0xC0; // 11xxxxxx
+constexpr std::uint8_t opRgb   = 0xFE; // 11111110
+constexpr std::uint8_t opRgba  = 0xFF; // 11111111
+constexpr std::uint8_t opMask  = 0xC0; // 11000000
+
+constexpr std::size_t headerSize = 14;
+constexpr std::array<std::uint8_t, 8> endMarker{0, 0, 0, 0, 0, 0, 0, 1};
+
+// Same limit as the reference implementation, keeps the size computations far from overflowing
+constexpr std::uint64_t maxPixels = 400'000'000;
+
+struct Pixel
+{
+    std::uint8_t r{};
+    std::uint8_t g{};
+    std::uint8_t b{};
+    std::uint8_t a{};
+};
+
+bool operator==(const Pixel& left, const Pixel& right)
+{
+    return left.r == right.r && left.g == right.g && left.b == right.b && left.a == right.a;
+}
+
+std::size_t hash(const Pixel& pixel)
+{
+    return (pixel.r * 3u + pixel.g * 5u + pixel.b * 7u + pixel.a * 11u) % 64u;
+}
+
+std::uint32_t readBigEndian(const std::uint8_t* bytes)
+{
+    return std::uint32_t{bytes[0]} << 24 | std::uint32_t{bytes[1]} << 16 | std::uint32_t{bytes[2]} << 8 |
+           std::uint32_t{bytes[3]};
+}
+
+void writeBigEndian(std::vector<std::uint8_t>& buffer, std::uint32_t value)
+{
+    buffer.push_back(static_cast<std::uint8_t>(value >> 24));
+    buffer.push_back(static_cast<std::uint8_t>(value >> 16));
+    buffer.push_back(static_cast<std::uint8_t>(value >> 8));
+    buffer.push_back(static_cast<std::uint8_t>(value));
+}
+} // namespace QoiImageImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool isQoiImage(const void* data, std::size_t size)
+{
+    return data && size >= 4 && std::memcmp(data, "qoif", 4) == 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> getQoiImageSize(const void* data, std::size_t size)
+{
+    if (!isQoiImage(data, size) || size < QoiImageImpl::headerSize + QoiImageImpl::endMarker.size())
+        return std::nullopt;
+
+    const auto*   bytes    = static_cast<const std::uint8_t*>(data);
+    const Vector2u imageSize(QoiImageImpl::readBigEndian(bytes + 4), QoiImageImpl::readBigEndian(bytes + 8));
+    const std::uint8_t channels = bytes[12];
+    const std::uint8_t colorSpace = bytes[13];
+
+    if (imageSize.x == 0 || imageSize.y == 0 || std::uint64_t{imageSize.x} * imageSize.y > QoiImageImpl::maxPixels)
+        return std::nullopt;
+
+    if ((channels != 3 && channels != 4) || colorSpace > 1)
+        return std::nullopt;
+
+    return imageSize;
+}
+
+
+////////////////////////////////////////////////////////////
+bool QoiDecoder::open(const void* data, std::size_t size)
+{
+    if (!isQoiImage(data, size) || size < QoiImageImpl::headerSize + QoiImageImpl::endMarker.size())
+        return false;
+
+    const auto*        bytes      = static_cast<const std::uint8_t*>(data);
+    const Vector2u     imageSize(QoiImageImpl::readBigEndian(bytes + 4), QoiImageImpl::readBigEndian(bytes + 8));
+    const std::uint8_t channels   = bytes[12];
+    const std::uint8_t colorSpace = bytes[13];
+
+    if (imageSize.x == 0 || imageSize.y == 0 || (channels != 3 && channels != 4) || colorSpace > 1)
+        return false;
+
+    m_bytes     = bytes;
+    m_chunksEnd = size - QoiImageImpl::endMarker.size();
+    m_position  = QoiImageImpl::headerSize;
+    m_run       = 0;
+    m_size      = imageSize;
+    m_index     = {};
+    m_pixel     = {0, 0, 0, 255};
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u QoiDecoder::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool QoiDecoder::decode(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    if (!m_bytes)
+        return false;
+
+    // Work on local copies of the state, which the compiler can keep in registers
+    const std::uint8_t* bytes     = m_bytes;
+    const std::size_t   chunksEnd = m_chunksEnd;
+    std::size_t         position  = m_position;
+    std::size_t         run       = m_run;
+
+    const auto toPixel = [](const std::array<std::uint8_t, 4>& color)
+    { return QoiImageImpl::Pixel{color[0], color[1], color[2], color[3]}; };
+    const auto fromPixel = [](const QoiImageImpl::Pixel& color)
+    { return std::array<std::uint8_t, 4>{color.r, color.g, color.b, color.a}; };
+
+    std::array<QoiImageImpl::Pixel, 64> index;
+    for (std::size_t i = 0; i < index.size(); ++i)
+        index[i] = toPixel(m_index[i]);
+    QoiImageImpl::Pixel pixel = toPixel(m_pixel);
+
+    for (std::size_t i = 0; i < pixelCount; ++i)
+    {
+        if (run > 0)
+        {
+            --run;
+        }
+        else
+        {
+            if (position >= chunksEnd)
+                return false;
+
+            const std::uint8_t op = bytes[position++];
+
+            if (op == QoiImageImpl::opRgb || op == QoiImageImpl::opRgba)
+            {
+                const std::size_t length = op == QoiImageImpl::opRgb ? 3 : 4;
+                if (chunksEnd - position < length)
+                    return false;
+
+                pixel.r = bytes[position++];
+                pixel.g = bytes[position++];
+                pixel.b = bytes[position++];
+                if (op == QoiImageImpl::opRgba)
+                    pixel.a = bytes[position++];
+            }
+            else if ((op & QoiImageImpl::opMask) == QoiImageImpl::opIndex)
+            {
+                pixel = index[op];
+            }
+            else if ((op & QoiImageImpl::opMask) == QoiImageImpl::opDiff)
+            {
+                pixel.r = static_cast<std::uint8_t>(pixel.r + ((op >> 4) & 0x03) - 2);
+                pixel.g = static_cast<std::uint8_t>(pixel.g + ((op >> 2) & 0x03) - 2);
+                pixel.b = static_cast<std::uint8_t>(pixel.b + (op & 0x03) - 2);
+            }
+            else if ((op & QoiImageImpl::opMask) == QoiImageImpl::opLuma)
+            {
+                if (position >= chunksEnd)
+                    return false;
+
+                const std::uint8_t next       = bytes[position++];
+                const int          greenDelta = (op & 0x3F) - 32;
+                pixel.r = static_cast<std::uint8_t>(pixel.r + greenDelta - 8 + ((next >> 4) & 0x0F));
+                pixel.g = static_cast<std::uint8_t>(pixel.g + greenDelta);
+                pixel.b = static_cast<std::uint8_t>(pixel.b + greenDelta - 8 + (next & 0x0F));
+            }
+            else
+            {
+                run = op & 0x3F;
+            }
+
+            index[QoiImageImpl::hash(pixel)] = pixel;
+        }
+
+        std::uint8_t* destination = pixels + i * 4;
+        destination[0]            = pixel.r;
+        destination[1]            = pixel.g;
+        destination[2]            = pixel.b;
+        destination[3]            = pixel.a;
+    }
+
+    m_position = position;
+    m_run      = run;
+    m_pixel    = fromPixel(pixel);
+    for (std::size_t i = 0; i < index.size(); ++i)
+        m_index[i] = fromPixel(index[i]);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool decodeQoiImage(const void* data, std::size_t size, std::uint8_t* pixels)
+{
+    const auto imageSize = getQoiImageSize(data, size);
+    if (!imageSize)
+        return false;
+
+    QoiDecoder decoder;
+    return decoder.open(data, size) && decoder.decode(pixels, std::size_t{imageSize->x} * imageSize->y);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> encodeQoiImage(const Vector2u& size, const std::uint8_t* pixels)
+{
+    const std::size_t pixelCount = std::size_t{size.x} * size.y;
+
+    // Reserve the worst case once, the buffer is shrunk at the end
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(QoiImageImpl::headerSize + pixelCount * 5 + QoiImageImpl::endMarker.size());
+
+    buffer.insert(buffer.end(), {'q', 'o', 'i', 'f'});
+    QoiImageImpl::writeBigEndian(buffer, size.x);
+    QoiImageImpl::writeBigEndian(buffer, size.y);
+    buffer.push_back(4); // RGBA channels
+    buffer.push_back(0); // sRGB color space with linear alpha
+
+    std::array<QoiImageImpl::Pixel, 64> index{};
+    QoiImageImpl::Pixel                 previous{0, 0, 0, 255};
+    std::uint8_t                        run = 0;
+
+    for (std::size_t i = 0; i < pixelCount; ++i)
+    {
+        const std::uint8_t*       source = pixels + i * 4;
+        const QoiImageImpl::Pixel pixel{source[0], source[1], source[2], source[3]};
+
+        if (pixel == previous)
+        {
+            ++run;
+            if (run == 62 || i + 1 == pixelCount)
+            {
+                buffer.push_back(static_cast<std::uint8_t>(QoiImageImpl::opRun | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0)
+        {
+            buffer.push_back(static_cast<std::uint8_t>(QoiImageImpl::opRun | (run - 1)));
+            run = 0;
+        }
+
+        const std::size_t position = QoiImageImpl::hash(pixel);
+
+        if (index[position] == pixel)
+        {
+            buffer.push_back(static_cast<std::uint8_t>(QoiImageImpl::opIndex | position));
+        }
+        else
+        {
+            index[position] = pixel;
+
+            if (pixel.a == previous.a)
+            {
+                // Differences wrap around, as in the decoder
+                const auto redDelta   = static_cast<std::int8_t>(pixel.r - previous.r);
+                const auto greenDelta = static_cast<std::int8_t>(pixel.g - previous.g);
+                const auto blueDelta  = static_cast<std::int8_t>(pixel.b - previous.b);
+                const auto redGreen   = static_cast<std::int8_t>(redDelta - greenDelta);
+                const auto blueGreen  = static_cast<std::int8_t>(blueDelta - greenDelta);
+
+                if (redDelta >= -2 && redDelta <= 1 && greenDelta >= -2 && greenDelta <= 1 && blueDelta >= -2 &&
+                    blueDelta <= 1)
+                {
+                    buffer.push_back(static_cast<std::uint8_t>(
+                        QoiImageImpl::opDiff | (redDelta + 2) << 4 | (greenDelta + 2) << 2 | (blueDelta + 2)));
+                }
+                else if (greenDelta >= -32 && greenDelta <= 31 && redGreen >= -8 && redGreen <= 7 && blueGreen >= -8 &&
+                         blueGreen <= 7)
+                {
+                    buffer.push_back(static_cast<std::uint8_t>(QoiImageImpl::opLuma | (greenDelta + 32)));
+                    buffer.push_back(static_cast<std::uint8_t>((redGreen + 8) << 4 | (blueGreen + 8)));
+                }
+                else
+                {
+                    buffer.insert(buffer.end(), {QoiImageImpl::opRgb, pixel.r, pixel.g, pixel.b});
+                }
+            }
+            else
+            {
+                buffer.insert(buffer.end(), {QoiImageImpl::opRgba, pixel.r, pixel.g, pixel.b, pixel.a});
+            }
+        }
+
+        previous = pixel;
+    }
+
+    buffer.insert(buffer.end(), QoiImageImpl::endMarker.begin(), QoiImageImpl::endMarker.end());
+    buffer.shrink_to_fit();
+    return buffer;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Check whether some data starts with a qoi file header
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return True if the data looks like a qoi file
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isQoiImage(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Read the size of a qoi image from its header
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return Size of the image in pixels, or `std::nullopt` if the header is invalid
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<Vector2u> getQoiImageSize(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Incremental decoder of qoi files
+///
+/// Qoi files can only be decoded sequentially, but the pixels
+/// can be retrieved a few rows at a time, so that images too
+/// large to fit in memory can be processed in bands.
+///
+////////////////////////////////////////////////////////////
+class QoiDecoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start decoding a qoi file
+    ///
+    /// Unlike getQoiImageSize, the total number of pixels of
+    /// the image is not limited. The data must stay valid while
+    /// the pixels are decoded.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return True if the header is valid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the image being decoded
+    ///
+    /// \return Size of the image in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the next pixels of the image
+    ///
+    /// \param pixels     Buffer receiving the 32-bit RGBA pixels
+    /// \param pixelCount Number of pixels to decode
+    ///
+    /// \return True if the pixels were decoded, false if the file is truncated or invalid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool decode(std::uint8_t* pixels, std::size_t pixelCount);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::uint8_t*                         m_bytes{};     //!< Data of the file
+    std::size_t                                 m_chunksEnd{}; //!< Offset of the end marker
+    std::size_t                                 m_position{};  //!< Offset of the next chunk
+    std::size_t                                 m_run{};       //!< Remaining repetitions of the current pixel
+    Vector2u                                    m_size;        //!< Size of the image
+    std::array<std::array<std::uint8_t, 4>, 64> m_index{};     //!< Recently seen pixels
+    std::array<std::uint8_t, 4>                 m_pixel{};     //!< Last decoded pixel
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Decode a qoi file into 32-bit RGBA pixels
+///
+/// \param data   Pointer to the file data in memory
+/// \param size   Size of the data, in bytes
+/// \param pixels Buffer receiving the pixels, large enough for the size returned by getQoiImageSize
+///
+/// \return True if the whole image was decoded
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool decodeQoiImage(const void* data, std::size_t size, std::uint8_t* pixels);
+
+////////////////////////////////////////////////////////////
+/// \brief Encode 32-bit RGBA pixels to a qoi file
+///
+/// \param size   Size of the image, in pixels
+/// \param pixels Pixels of the image
+///
+/// \return Contents of the qoi file
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::uint8_t> encodeQoiImage(const Vector2u& size, const std::uint8_t* pixels);
+
+} // namespace sf::priv
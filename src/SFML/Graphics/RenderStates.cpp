@@ -60,6 +60,12 @@ RenderStates::RenderStates(const StencilMode& theStencilMode) : stencilMode(theS
 }
 
 
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates(const DepthMode& theDepthMode) : depthMode(theDepthMode)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 RenderStates::RenderStates(const Texture* theTexture) : texture(theTexture)
 {
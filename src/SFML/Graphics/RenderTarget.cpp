@@ -25,26 +25,43 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/CoreProfilePipeline.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/StreamBuffer.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TransformKernels.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 
 #include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <unordered_map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 
 namespace
@@ -52,36 +69,93 @@ namespace
 // A nested named namespace is used here to allow unity builds of SFML.
 namespace RenderTargetImpl
 {
-// Mutex to protect ID generation and our context-RenderTarget-map
-std::recursive_mutex& getMutex()
-{
-    static std::recursive_mutex mutex;
-    return mutex;
-}
-
 // Unique identifier, used for identifying RenderTargets when
 // tracking the currently active RenderTarget within a given context
 std::uint64_t getUniqueId()
 {
-    const std::lock_guard lock(getMutex());
-    static std::uint64_t  id = 1; // start at 1, zero is "no RenderTarget"
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no RenderTarget"
     return id++;
 }
 
-// Map to help us detect whether a different RenderTarget
-// has been activated within a single context
-using ContextRenderTargetMap = std::unordered_map<std::uint64_t, std::uint64_t>;
-ContextRenderTargetMap& getContextRenderTargetMap()
+// What we track about a context, tied to its lifetime
+struct ContextState
+{
+    std::uint64_t renderTargetId{}; // RenderTarget whose states are set in the context, zero if none
+};
+
+// Mutex to protect the context-state map
+std::mutex& getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Map to find the state of a given context when it's activated on a new thread
+using ContextStateMap = std::unordered_map<std::uint64_t, std::weak_ptr<ContextState>>;
+ContextStateMap& getContextStateMap()
+{
+    static ContextStateMap contextStateMap;
+    return contextStateMap;
+}
+
+// Gives access to the registration of objects tied to the lifetime of a context
+struct UnsharedObjectRegistry : sf::GlResource
+{
+    static void add(std::shared_ptr<void> object)
+    {
+        registerUnsharedGlObject(std::move(object));
+    }
+};
+
+// Get the state of the current context, or null if there's no active context
+ContextState* getContextState()
 {
-    static ContextRenderTargetMap contextRenderTargetMap;
-    return contextRenderTargetMap;
+    const std::uint64_t contextId = sf::Context::getActiveContextId();
+
+    if (!contextId)
+        return nullptr;
+
+    // A context is only active on one thread at a time, so each thread remembers the state of the context
+    // it used last and accesses it without locking; threads rendering with their own context never lock
+    thread_local std::pair<std::uint64_t, ContextState*> lastState;
+    if (lastState.first == contextId)
+        return lastState.second;
+
+    const std::lock_guard lock(getMutex());
+
+    auto&                         contextStateMap = getContextStateMap();
+    std::shared_ptr<ContextState> state;
+
+    if (const auto it = contextStateMap.find(contextId); it != contextStateMap.end())
+        state = it->second.lock();
+
+    if (!state)
+    {
+        // Forget about the states of contexts that have been destroyed
+        for (auto it = contextStateMap.begin(); it != contextStateMap.end();)
+        {
+            if (it->second.expired())
+                it = contextStateMap.erase(it);
+            else
+                ++it;
+        }
+
+        state                      = std::make_shared<ContextState>();
+        contextStateMap[contextId] = state;
+
+        // Register the state with the current context so it is automatically destroyed
+        UnsharedObjectRegistry::add(state);
+    }
+
+    lastState = {contextId, state.get()};
+    return lastState.second;
 }
 
 // Check if a RenderTarget with the given ID is active in the current context
 bool isActive(std::uint64_t id)
 {
-    const auto it = getContextRenderTargetMap().find(sf::Context::getActiveContextId());
-    return (it != getContextRenderTargetMap().end()) && (it->second == id);
+    const ContextState* state = getContextState();
+    return state && (state->renderTargetId == id);
 }
 
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
@@ -169,6 +243,29 @@ std::uint32_t stencilOperationToGlConstant(sf::StencilUpdateOperation operation)
 }
 
 
+// Convert a DepthComparison constant to the corresponding OpenGL constant.
+GLenum depthFunctionToGlConstant(sf::DepthComparison comparison)
+{
+    // clang-format off
+    switch (comparison)
+    {
+        case sf::DepthComparison::Never:        return GL_NEVER;
+        case sf::DepthComparison::Less:         return GL_LESS;
+        case sf::DepthComparison::LessEqual:    return GL_LEQUAL;
+        case sf::DepthComparison::Greater:      return GL_GREATER;
+        case sf::DepthComparison::GreaterEqual: return GL_GEQUAL;
+        case sf::DepthComparison::Equal:        return GL_EQUAL;
+        case sf::DepthComparison::NotEqual:     return GL_NOTEQUAL;
+        case sf::DepthComparison::Always:       return GL_ALWAYS;
+    }
+    // clang-format on
+
+    sf::err() << "Invalid value for sf::DepthComparison! Fallback to sf::DepthComparison::Always." << std::endl;
+    assert(false);
+    return GL_ALWAYS;
+}
+
+
 // Convert a Comparison constant to the corresponding OpenGL constant.
 std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
 {
@@ -190,6 +287,243 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Convert an sf::PrimitiveType to its OpenGL equivalent
+GLenum primitiveTypeToGlEnum(sf::PrimitiveType type)
+{
+    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[static_cast<std::size_t>(type)];
+}
+
+
+// Convert an sf::VertexLayout::Type to its OpenGL equivalent
+GLenum vertexLayoutTypeToGlEnum(sf::VertexLayout::Type type)
+{
+    static constexpr GLenum types[] = {GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT, GL_FLOAT};
+    return types[static_cast<std::size_t>(type)];
+}
+
+
+// Maximum number of vertices kept in the batch before it is forcibly flushed, so
+// that a full batch fits in a single region of the stream buffer, along with the
+// shader parameters of each vertex when the draws of the batch disagree on them
+constexpr std::size_t getMaxBatchVertexCount(bool perVertexParameters)
+{
+    const std::size_t stride = sizeof(sf::Vertex) + (perVertexParameters ? sizeof(sf::Glsl::Vec4) : 0);
+    return sf::priv::StreamBuffer::regionSize / stride;
+}
+
+
+// Maximum number of vertices of a draw that is batched, batching a strip or a fan triples its
+// vertices at most and the draws of the batch may end up disagreeing on the shader parameters
+constexpr std::size_t maxBatchedDrawVertexCount = getMaxBatchVertexCount(true) / 3;
+
+
+// Get the list primitive type that a given primitive type is batched as
+sf::PrimitiveType getBatchPrimitiveType(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return sf::PrimitiveType::Points;
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        case sf::PrimitiveType::Triangles:
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+            return sf::PrimitiveType::Triangles;
+    }
+
+    assert(false);
+    return sf::PrimitiveType::Triangles;
+}
+
+
+// Append transformed primitives to a list of vertices, converting strips and fans to their list equivalent
+void appendAsList(std::vector<sf::Vertex>& target,
+                  const sf::Vertex*        vertices,
+                  std::size_t              vertexCount,
+                  sf::PrimitiveType        type,
+                  const sf::Transform&     transform,
+                  const sf::Color&         color)
+{
+    const std::size_t first  = target.size();
+    const auto        append = [&target, vertices, &color](std::size_t index)
+    {
+        const sf::Vertex& vertex = vertices[index];
+        target.push_back({vertex.position, vertex.color * color, vertex.texCoords});
+    };
+
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::Triangles:
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                append(i);
+            break;
+        case sf::PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                append(i - 1);
+                append(i);
+            }
+            break;
+        case sf::PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(i - 2);
+                append(i - 1);
+                append(i);
+            }
+            break;
+        case sf::PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(0);
+                append(i - 1);
+                append(i);
+            }
+            break;
+    }
+
+    // Transform all the appended positions at once
+    sf::priv::transformPoints(transform,
+                              reinterpret_cast<const std::byte*>(target.data() + first) + offsetof(sf::Vertex, position),
+                              reinterpret_cast<std::byte*>(target.data() + first) + offsetof(sf::Vertex, position),
+                              target.size() - first,
+                              sizeof(sf::Vertex));
+}
+
+
+// Check if two sets of render states can be drawn within the same batch
+// The transform is not compared since batched vertices are pre-transformed
+bool canBatch(const sf::RenderStates& lhs, const sf::RenderStates& rhs)
+{
+    return (lhs.texture == rhs.texture) && (lhs.shader == rhs.shader) && (lhs.coordinateType == rhs.coordinateType) &&
+           (lhs.blendMode == rhs.blendMode) && (lhs.stencilMode == rhs.stencilMode) &&
+           (lhs.depthMode == rhs.depthMode);
+}
+
+
+// Check if two sets of shader parameters are equal
+bool sameParameters(const sf::Glsl::Vec4& lhs, const sf::Glsl::Vec4& rhs)
+{
+    return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z) && (lhs.w == rhs.w);
+}
+
+
+// Name of the vertex attribute that shaders read their parameters from
+const std::string parametersAttribute = "sf_parameters";
+
+
+// Feed the shader parameters attribute, from an array of one set per vertex or with a constant
+// Return true if the array was enabled, and must thus be disabled after drawing
+bool setParameters(int location, const sf::Glsl::Vec4& constant, const void* array)
+{
+#ifndef SFML_OPENGL_ES
+    if (location < 0)
+        return false;
+
+    const auto index = static_cast<GLuint>(location);
+    if (array)
+    {
+        glCheck(GLEXT_glEnableVertexAttribArray(index));
+        glCheck(GLEXT_glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, sizeof(sf::Glsl::Vec4), array));
+        return true;
+    }
+
+    glCheck(GLEXT_glVertexAttrib4f(index, constant.x, constant.y, constant.z, constant.w));
+#else
+    (void)location;
+    (void)constant;
+    (void)array;
+#endif
+
+    return false;
+}
+
+
+// Vertex shader drawing instances in contexts with a fixed-function pipeline,
+// core profile contexts use the built-in program of their pipeline instead
+constexpr std::string_view instancingVertexShader = R"(
+#version 120
+
+attribute vec3 sf_instanceRow0;
+attribute vec3 sf_instanceRow1;
+attribute vec3 sf_instanceRow2;
+attribute vec4 sf_instanceColor;
+
+void main()
+{
+    vec3 point    = vec3(gl_Vertex.xy, 1.0);
+    vec4 position = vec4(dot(sf_instanceRow0, point), dot(sf_instanceRow1, point), 0.0, dot(sf_instanceRow2, point));
+
+    gl_Position    = gl_ModelViewProjectionMatrix * position;
+    gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;
+    gl_FrontColor  = gl_Color * sf_instanceColor;
+}
+)";
+
+// Fragment shader drawing instances, modulates the vertex color by the texture like GL_MODULATE does
+constexpr std::string_view instancingFragmentShader = R"(
+#version 120
+
+uniform sampler2D sf_texture;
+uniform bool      sf_textured;
+
+void main()
+{
+    gl_FragColor = sf_textured ? gl_Color * texture2D(sf_texture, gl_TexCoord[0].xy) : gl_Color;
+}
+)";
+
+// Names of the per-instance attributes of the instancing shader, the color comes last
+constexpr std::array<const char*, 4> instanceAttributes = {"sf_instanceRow0",
+                                                           "sf_instanceRow1",
+                                                           "sf_instanceRow2",
+                                                           "sf_instanceColor"};
+
+
+// Append the transform and color of every instance to the data streamed for an instanced draw
+void appendInstances(std::vector<std::byte>& data,
+                     const sf::Transform*    transforms,
+                     const sf::Color*        colors,
+                     std::size_t             instanceCount)
+{
+    using Instance = sf::priv::CoreProfilePipeline::Instance;
+
+    const std::size_t first = data.size();
+    data.resize(first + sizeof(Instance) * instanceCount);
+
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        // Rows of the 3x3 matrix, taken from the 4x4 column-major matrix of the transform
+        const float*   m = transforms[i].getMatrix();
+        const Instance instance{{m[0], m[4], m[12], m[1], m[5], m[13], m[3], m[7], m[15]},
+                                colors ? colors[i] : sf::Color::White};
+
+        std::memcpy(data.data() + first + sizeof(Instance) * i, &instance, sizeof(Instance));
+    }
+}
+
+
+// Check whether the vertices of a buffer are laid out like sf::Vertex, and can thus be read back as such
+bool isVertexLayout(const sf::VertexLayout& layout)
+{
+    const sf::VertexLayout vertexLayout;
+
+    const auto same = [](const sf::VertexLayout::Attribute& lhs, const sf::VertexLayout::Attribute& rhs)
+    {
+        return (lhs.type == rhs.type) && (lhs.componentCount == rhs.componentCount) && (lhs.offset == rhs.offset) &&
+               (lhs.normalized == rhs.normalized);
+    };
+
+    return (layout.getStride() == vertexLayout.getStride()) && same(layout.getPosition(), vertexLayout.getPosition()) &&
+           same(layout.getColor(), vertexLayout.getColor()) && same(layout.getTexCoords(), vertexLayout.getTexCoords());
+}
 } // namespace RenderTargetImpl
 } // namespace
 
@@ -199,7 +533,15 @@ namespace sf
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    flush();
+
+    if (m_recording)
+    {
+        static_cast<CommandList&>(*this).recordClear(color, std::nullopt, std::nullopt);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
@@ -207,9 +549,13 @@ void RenderTarget::clear(const Color& color)
         // Apply the view (scissor testing can affect clearing)
         if (!m_cache.enable || m_cache.viewChanged)
             applyCurrentView();
+        else if (m_cache.clipChanged)
+            applyScissor();
 
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
         glCheck(glClear(GL_COLOR_BUFFER_BIT));
+
+        onDraw(m_cache.clearRegion);
     }
 }
 
@@ -217,7 +563,15 @@ void RenderTarget::clear(const Color& color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    flush();
+
+    if (m_recording)
+    {
+        static_cast<CommandList&>(*this).recordClear(std::nullopt, stencilValue, std::nullopt);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
@@ -225,6 +579,8 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
         // Apply the view (scissor testing can affect clearing)
         if (!m_cache.enable || m_cache.viewChanged)
             applyCurrentView();
+        else if (m_cache.clipChanged)
+            applyScissor();
 
         glCheck(glClearStencil(static_cast<int>(stencilValue.value)));
         glCheck(glClear(GL_STENCIL_BUFFER_BIT));
@@ -235,7 +591,15 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color, StencilValue stencilValue)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    flush();
+
+    if (m_recording)
+    {
+        static_cast<CommandList&>(*this).recordClear(color, stencilValue, std::nullopt);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
@@ -243,10 +607,52 @@ void RenderTarget::clear(const Color& color, StencilValue stencilValue)
         // Apply the view (scissor testing can affect clearing)
         if (!m_cache.enable || m_cache.viewChanged)
             applyCurrentView();
+        else if (m_cache.clipChanged)
+            applyScissor();
 
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
         glCheck(glClearStencil(static_cast<int>(stencilValue.value)));
         glCheck(glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
+
+        onDraw(m_cache.clearRegion);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::clearDepth(float depth)
+{
+    flush();
+
+    if (m_recording)
+    {
+        static_cast<CommandList&>(*this).recordClear(std::nullopt, std::nullopt, depth);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
+    {
+        // Unbind texture to fix RenderTexture preventing clear
+        applyTexture(nullptr);
+
+        // Apply the view (scissor testing can affect clearing)
+        if (!m_cache.enable || m_cache.viewChanged)
+            applyCurrentView();
+        else if (m_cache.clipChanged)
+            applyScissor();
+
+        // glClear only touches the depth buffer while depth writes are enabled
+        const float clearValue = (std::clamp(depth, -1.f, 1.f) + 1.f) / 2.f;
+        glCheck(glDepthMask(GL_TRUE));
+#ifdef SFML_OPENGL_ES
+        glCheck(glClearDepthf(clearValue));
+#else
+        glCheck(glClearDepth(static_cast<GLdouble>(clearValue)));
+#endif
+        glCheck(glClear(GL_DEPTH_BUFFER_BIT));
+
+        if (m_cache.depthEnabled && !m_cache.lastDepthMode.depthWrite)
+            glCheck(glDepthMask(GL_FALSE));
     }
 }
 
@@ -254,8 +660,15 @@ void RenderTarget::clear(const Color& color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending batched geometry has to be drawn with the view it was submitted with
+    flush();
+
     m_view              = view;
+    m_visibleArea       = view.getVisibleArea();
     m_cache.viewChanged = true;
+
+    if (m_recording)
+        static_cast<CommandList&>(*this).recordView(view);
 }
 
 
@@ -328,143 +741,1085 @@ Vector2i RenderTarget::mapCoordsToPixel(const Vector2f& point, const View& view)
     // First, transform the point by the view matrix
     const Vector2f normalized = view.getTransform().transformPoint(point);
 
-    // Then convert to viewport coordinates
-    const FloatRect viewport = FloatRect(getViewport(view));
-    return Vector2i((normalized.cwiseMul({1, -1}) + sf::Vector2f(1, 1)).cwiseDiv({2, 2}).cwiseMul(viewport.getSize()) +
-                    viewport.getPosition());
-}
+    // Then convert to viewport coordinates
+    const FloatRect viewport = FloatRect(getViewport(view));
+    return Vector2i((normalized.cwiseMul({1, -1}) + sf::Vector2f(1, 1)).cwiseDiv({2, 2}).cwiseMul(viewport.getSize()) +
+                    viewport.getPosition());
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
+{
+    drawable.draw(*this, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    SFML_PROFILE_ZONE("sf::RenderTarget::draw");
+
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    // Draws too large to benefit from batching are submitted directly
+    if (m_batch.enabled && (vertexCount <= RenderTargetImpl::maxBatchedDrawVertexCount))
+    {
+        batchVertices(vertices, vertexCount, type, states);
+    }
+    else
+    {
+        flush();
+        drawVertices(vertices, vertexCount, type, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*       vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const Transform*    transforms,
+                        const Color*        colors,
+                        std::size_t         instanceCount,
+                        const RenderStates& states)
+{
+    SFML_PROFILE_ZONE("sf::RenderTarget::draw");
+
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !transforms || (instanceCount == 0))
+        return;
+
+    // Let the batch merge the instances with the surrounding draws
+    if (m_batch.enabled && (vertexCount <= RenderTargetImpl::maxBatchedDrawVertexCount))
+    {
+        RenderStates instanceStates = states;
+
+        for (std::size_t i = 0; i < instanceCount; ++i)
+        {
+            instanceStates.transform = states.transform * transforms[i];
+            batchVertices(vertices, vertexCount, type, instanceStates, colors ? colors[i] : Color::White);
+        }
+
+        return;
+    }
+
+    // Submit all the instances with a single instanced draw call if possible
+    if (drawInstances(nullptr, vertices, vertexCount, type, transforms, colors, instanceCount, states))
+        return;
+
+    flush();
+
+    // Expand all the instances into a single list of pre-transformed primitives
+    m_instanceVertices.clear();
+
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        RenderTargetImpl::appendAsList(m_instanceVertices,
+                                       vertices,
+                                       vertexCount,
+                                       type,
+                                       states.transform * transforms[i],
+                                       colors ? colors[i] : Color::White);
+    }
+
+    RenderStates listStates = states;
+    listStates.transform    = Transform::Identity;
+
+    drawVertices(m_instanceVertices.data(),
+                 m_instanceVertices.size(),
+                 RenderTargetImpl::getBatchPrimitiveType(type),
+                 listStates);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const Transform*    transforms,
+                        const Color*        colors,
+                        std::size_t         instanceCount,
+                        const RenderStates& states)
+{
+    SFML_PROFILE_ZONE("sf::RenderTarget::draw");
+
+    // VertexBuffer not supported? Command lists don't need it until they are replayed
+    if (!m_recording && !VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    const std::size_t vertexCount = vertexBuffer.getVertexCount();
+
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle() || !transforms || (instanceCount == 0))
+        return;
+
+    // Submit all the instances with a single instanced draw call if possible
+    if (drawInstances(&vertexBuffer,
+                      nullptr,
+                      vertexCount,
+                      vertexBuffer.getPrimitiveType(),
+                      transforms,
+                      colors,
+                      instanceCount,
+                      states))
+        return;
+
+#ifndef SFML_OPENGL_ES
+    // Otherwise read the vertices back to expand the instances on the CPU, if they are plain sf::Vertex
+    if (!m_recording && RenderTargetImpl::isVertexLayout(vertexBuffer.getLayout()) &&
+        (RenderTargetImpl::isActive(m_id) || activateForDrawing()))
+    {
+        m_instanceSource.resize(vertexCount);
+
+        VertexBuffer::bind(&vertexBuffer);
+
+        const void* source = nullptr;
+        glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
+
+        if (source)
+        {
+            std::memcpy(m_instanceSource.data(), source, sizeof(Vertex) * vertexCount);
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+        }
+
+        VertexBuffer::bind(nullptr);
+
+        if (source)
+        {
+            draw(m_instanceSource.data(),
+                 vertexCount,
+                 vertexBuffer.getPrimitiveType(),
+                 transforms,
+                 colors,
+                 instanceCount,
+                 states);
+            return;
+        }
+    }
+#endif
+
+    // Vertices that can't be expanded are drawn once per instance, keeping their own colors
+    const VertexRange range{0, vertexCount};
+    RenderStates      instanceStates = states;
+
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        instanceStates.transform = states.transform * transforms[i];
+        drawBuffers(vertexBuffer, nullptr, &range, 1, instanceStates);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isInstancingAvailable()
+{
+    // Checking for vertex buffers makes sure that extensions are initialized
+    static const bool available = VertexBuffer::isAvailable() && (GLEXT_instancing != 0);
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    SFML_PROFILE_ZONE("sf::RenderTarget::draw");
+
+    // VertexBuffer not supported? Command lists don't need it until they are replayed
+    if (!m_recording && !VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstVertex > vertexBuffer.getVertexCount())
+        return;
+
+    // Clamp vertexCount to something that makes sense
+    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle())
+        return;
+
+    const VertexRange range{firstVertex, vertexCount};
+    drawBuffers(vertexBuffer, nullptr, &range, 1, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawMulti(const VertexBuffer& vertexBuffer,
+                             const VertexRange*  ranges,
+                             std::size_t         rangeCount,
+                             const RenderStates& states)
+{
+    SFML_PROFILE_ZONE("sf::RenderTarget::drawMulti");
+
+    // VertexBuffer not supported? Command lists don't need it until they are replayed
+    if (!m_recording && !VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    if (!vertexBuffer.getNativeHandle())
+        return;
+
+    // Clamp the ranges to the vertex buffer and skip the empty ones
+    const std::size_t vertexCount = vertexBuffer.getVertexCount();
+    m_multiDrawRanges.clear();
+    for (std::size_t i = 0; i < rangeCount; ++i)
+    {
+        VertexRange range = ranges[i];
+        if (range.first >= vertexCount)
+            continue;
+
+        range.count = std::min(range.count, vertexCount - range.first);
+        if (range.count)
+            m_multiDrawRanges.push_back(range);
+    }
+
+    // Nothing to draw?
+    if (m_multiDrawRanges.empty())
+        return;
+
+    drawBuffers(vertexBuffer, nullptr, m_multiDrawRanges.data(), m_multiDrawRanges.size(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    SFML_PROFILE_ZONE("sf::RenderTarget::draw");
+
+    // VertexBuffer not supported? Command lists don't need it until they are replayed
+    if (!m_recording && !VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    const VertexRange range{firstIndex, indexCount};
+    drawBuffers(vertexBuffer, &indexBuffer, &range, 1, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    if (m_batch.vertices.empty())
+        return;
+
+    // Take the pending vertices out of the batch first, since drawing
+    // them may end up calling flush() again (e.g. through setView())
+    std::vector<Vertex>     vertices;
+    std::vector<Glsl::Vec4> parameters;
+    vertices.swap(m_batch.vertices);
+    parameters.swap(m_batch.parameters);
+
+    drawVertices(vertices.data(),
+                 vertices.size(),
+                 m_batch.type,
+                 m_batch.states,
+                 parameters.empty() ? nullptr : parameters.data());
+
+    // Give the storage back to the batch so that it doesn't have to be reallocated
+    vertices.clear();
+    parameters.clear();
+    m_batch.vertices.swap(vertices);
+    m_batch.parameters.swap(parameters);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::pushClipRect(const FloatRect& rect, const Transform& transform)
+{
+    const Vector2i     size(getSize());
+    const IntRect      parentScissor = m_clipStack.empty() ? IntRect({0, 0}, size) : m_clipStack.back().scissor;
+    const unsigned int parentDepth   = m_clipStack.empty() ? 0 : m_clipStack.back().stencilDepth;
+
+    // Find the corners of the rectangle in the scene, then in pixels, in triangle strip order
+    const std::array<Vector2f, 4> corners = {rect.getPosition(),
+                                             rect.getPosition() + Vector2f(rect.width, 0),
+                                             rect.getPosition() + Vector2f(0, rect.height),
+                                             rect.getPosition() + rect.getSize()};
+    const FloatRect               viewport(getViewport(m_view));
+    std::array<Vector2f, 4>       pixels;
+    ClipRect                      clip;
+    for (std::size_t i = 0; i < corners.size(); ++i)
+    {
+        clip.vertices[i].position = transform.transformPoint(corners[i]);
+
+        const Vector2f normalized = m_view.getTransform().transformPoint(clip.vertices[i].position);
+        pixels[i] = (normalized.cwiseMul({1, -1}) + Vector2f(1, 1)).cwiseDiv({2, 2}).cwiseMul(viewport.getSize()) +
+                    viewport.getPosition();
+    }
+
+    // Quarter turns keep the edges aligned with the pixel grid
+    const auto equal       = [](float a, float b) { return std::abs(a - b) < 0.001f; };
+    const bool axisAligned = (equal(pixels[0].y, pixels[1].y) && equal(pixels[0].x, pixels[2].x) &&
+                              equal(pixels[3].y, pixels[2].y) && equal(pixels[3].x, pixels[1].x)) ||
+                             (equal(pixels[0].x, pixels[1].x) && equal(pixels[0].y, pixels[2].y) &&
+                              equal(pixels[3].x, pixels[2].x) && equal(pixels[3].y, pixels[1].y));
+
+    // Either way, the scissor rectangle bounds the clip
+    Vector2f minimum = pixels[0];
+    Vector2f maximum = pixels[0];
+    for (const Vector2f& pixel : pixels)
+    {
+        minimum = {std::min(minimum.x, pixel.x), std::min(minimum.y, pixel.y)};
+        maximum = {std::max(maximum.x, pixel.x), std::max(maximum.y, pixel.y)};
+    }
+
+    const Vector2i topLeft(static_cast<int>(std::lround(minimum.x)), static_cast<int>(std::lround(minimum.y)));
+    const Vector2i bottomRight(static_cast<int>(std::lround(maximum.x)), static_cast<int>(std::lround(maximum.y)));
+    clip.scissor      = IntRect(topLeft, bottomRight - topLeft).findIntersection(parentScissor).value_or(IntRect());
+    clip.stencil      = !axisAligned;
+    clip.stencilDepth = parentDepth + (clip.stencil ? 1 : 0);
+    clip.view         = m_view;
+
+    // The pending geometry only has to be submitted if the clipping area changes
+    if (clip.stencil || (clip.scissor != parentScissor))
+    {
+        flush();
+        m_cache.clipChanged = true;
+    }
+
+    m_clipStack.push_back(clip);
+
+    // Mark the pixels inside the enclosing clips and the shape
+    if (clip.stencil && !m_recording)
+        drawClipShape(clip.vertices, clip.view, parentDepth, StencilUpdateOperation::Increment);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::popClipRect()
+{
+    if (m_clipStack.empty())
+    {
+        err() << "Failed to pop clip rectangle, none was pushed" << std::endl;
+        return;
+    }
+
+    const ClipRect clip          = m_clipStack.back();
+    const IntRect  parentScissor = (m_clipStack.size() > 1) ? m_clipStack[m_clipStack.size() - 2].scissor
+                                                            : IntRect({0, 0}, Vector2i(getSize()));
+
+    if (clip.stencil || (clip.scissor != parentScissor))
+    {
+        flush();
+        m_cache.clipChanged = true;
+    }
+
+    m_clipStack.pop_back();
+
+    // Give the pixels of the shape their previous stencil value back
+    if (clip.stencil && !m_recording)
+        drawClipShape(clip.vertices, clip.view, clip.stencilDepth, StencilUpdateOperation::Decrement);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setCullingEnabled(bool enabled)
+{
+    m_cullingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCullingEnabled() const
+{
+    return m_cullingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::cull(const FloatRect& bounds, const Transform& transform)
+{
+    if (!m_cullingEnabled)
+        return false;
+
+    // Flat geometry, like a horizontal line, has no area but is visible when it touches the view
+    const FloatRect rect = transform.transformRect(bounds);
+    if ((rect.left <= m_visibleArea.left + m_visibleArea.width) && (rect.left + rect.width >= m_visibleArea.left) &&
+        (rect.top <= m_visibleArea.top + m_visibleArea.height) && (rect.top + rect.height >= m_visibleArea.top))
+        return false;
+
+    ++m_statistics.culledDraws;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::Statistics& RenderTarget::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::pushDebugGroup(const std::string& name)
+{
+    // Pending batched geometry belongs outside of the group
+    flush();
+
+    if (!m_recording && (RenderTargetImpl::isActive(m_id) || activateForDrawing()))
+    {
+        priv::ensureExtensionsInit();
+
+        if (GLEXT_debug)
+            glCheck(GLEXT_glPushDebugGroup(GLEXT_GL_DEBUG_SOURCE_APPLICATION, 0, -1, name.c_str()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::popDebugGroup()
+{
+    // Pending batched geometry belongs inside of the group
+    flush();
+
+    if (!m_recording && (RenderTargetImpl::isActive(m_id) || activateForDrawing()))
+    {
+        if (GLEXT_debug)
+            glCheck(GLEXT_glPopDebugGroup());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex*       vertices,
+                                std::size_t         vertexCount,
+                                PrimitiveType       type,
+                                const RenderStates& states,
+                                const Glsl::Vec4*   parameters)
+{
+    if (m_recording)
+    {
+        // Command lists only record the parameters of the draws, which are never batched with different ones
+        assert(!parameters && "Batched shader parameters cannot be recorded");
+        static_cast<CommandList&>(*this).recordVertices(vertices, vertexCount, type, states);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
+    {
+        // Check if the vertex count is low enough so that we can pre-transform them
+        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
+
+        if (useVertexCache)
+        {
+            // Pre-transform the vertices and store them into the vertex cache
+            auto* cache = reinterpret_cast<std::byte*>(m_cache.vertexCache.data()) + offsetof(Vertex, position);
+            std::copy(vertices, vertices + vertexCount, m_cache.vertexCache.data());
+            priv::transformPoints(states.transform, cache, cache, vertexCount, sizeof(Vertex));
+        }
+
+        setupDraw(useVertexCache, states);
+
+        // Check if texture coordinates array is needed, and update client state accordingly
+        const bool enableTexCoordsArray = (states.texture || states.shader);
+        if (!m_cache.corePipeline && (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled)))
+        {
+            if (enableTexCoordsArray)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            else
+                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
+        // Shaders declaring the parameters attribute get those of the draw, or those of each batched vertex
+        int parametersLocation = -1;
+        if (!m_cache.corePipeline && states.shader)
+            parametersLocation = states.shader->getAttributeLocation(RenderTargetImpl::parametersAttribute);
+
+        const bool perVertexParameters = parameters && (parametersLocation >= 0);
+
+        // Stream the vertices through a buffer object if possible, this spares
+        // the driver the implicit copy and synchronization of client-side arrays
+        std::optional<std::size_t> streamOffset;
+        if (auto* streamBuffer = priv::StreamBuffer::getCurrent())
+        {
+            const Vertex* source = useVertexCache ? m_cache.vertexCache.data() : vertices;
+
+            if (perVertexParameters)
+            {
+                // The parameters follow the vertices within a single write, since
+                // a second one could orphan the storage holding the vertices
+                const std::size_t verticesSize = sizeof(Vertex) * vertexCount;
+                m_streamScratch.resize(verticesSize + sizeof(Glsl::Vec4) * vertexCount);
+                std::memcpy(m_streamScratch.data(), source, verticesSize);
+                std::memcpy(m_streamScratch.data() + verticesSize, parameters, sizeof(Glsl::Vec4) * vertexCount);
+                streamOffset = streamBuffer->write(m_streamScratch.data(), m_streamScratch.size());
+            }
+            else
+            {
+                streamOffset = streamBuffer->write(source, sizeof(Vertex) * vertexCount);
+            }
+        }
+
+        bool parametersArrayEnabled = false;
+
+        if (streamOffset)
+        {
+            if (m_cache.corePipeline)
+            {
+                m_cache.corePipeline->setVertexPointers(*streamOffset);
+            }
+            else
+            {
+                // The stream buffer is bound, so the pointers are offsets within it
+                const auto* data = reinterpret_cast<const std::byte*>(*streamOffset);
+
+                glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+                glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+                if (enableTexCoordsArray)
+                    glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+
+                parametersArrayEnabled = RenderTargetImpl::setParameters(parametersLocation,
+                                                                         states.shaderParameters,
+                                                                         perVertexParameters
+                                                                             ? data + sizeof(Vertex) * vertexCount
+                                                                             : nullptr);
+            }
+
+            drawPrimitives(type, 0, vertexCount);
+
+            VertexBuffer::bind(nullptr);
+        }
+        else if (m_cache.corePipeline)
+        {
+            // Core profile contexts can't source vertices from client memory, streaming
+            // only fails there when no buffer object can be created, for any draw
+            static bool warned = false;
+
+            if (!warned)
+            {
+                err() << "Failed to stream vertices to a core profile context, nothing will be drawn" << std::endl;
+                warned = true;
+            }
+        }
+        else
+        {
+            // If we switch between non-cache and cache mode or enable texture
+            // coordinates we need to set up the pointers to the vertices' components
+            if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+            {
+                const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+                // If we pre-transform the vertices, we must use our internal vertex cache
+                if (useVertexCache)
+                    data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+                glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+                glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+                if (enableTexCoordsArray)
+                    glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            }
+            else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+            {
+                // If we enter this block, we are already using our internal vertex cache
+                const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            }
+
+            parametersArrayEnabled = RenderTargetImpl::setParameters(parametersLocation,
+                                                                     states.shaderParameters,
+                                                                     perVertexParameters ? parameters : nullptr);
+
+            drawPrimitives(type, 0, vertexCount);
+        }
+
+#ifndef SFML_OPENGL_ES
+        // The array left enabled would be read by the next draws, which don't provide it
+        if (parametersArrayEnabled)
+            glCheck(GLEXT_glDisableVertexAttribArray(static_cast<GLuint>(parametersLocation)));
+#endif
+
+        cleanupDraw(states);
+
+        if (!states.stencilMode.stencilOnly)
+            onDraw(m_cache.drawRegion);
+
+        // Update the cache, streamed vertices leave the pointers referring to the stream buffer
+        m_cache.useVertexCache        = useVertexCache && !streamOffset;
+        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawBuffers(const VertexBuffer& vertexBuffer,
+                               const IndexBuffer*  indexBuffer,
+                               const VertexRange*  ranges,
+                               std::size_t         rangeCount,
+                               const RenderStates& states)
+{
+    // Preserve the drawing order of any pending batched geometry
+    flush();
+
+    if (m_recording)
+    {
+        auto& commandList = static_cast<CommandList&>(*this);
+        for (std::size_t i = 0; i < rangeCount; ++i)
+            commandList.recordBuffers(vertexBuffer, indexBuffer, ranges[i].first, ranges[i].count, states);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
+    {
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // The pointers are offsets within the vertex buffer, laid out as it describes
+        const VertexLayout& layout = vertexBuffer.getLayout();
+        setVertexPointers(layout, 0);
+
+#ifndef SFML_OPENGL_ES
+        // Additional attributes feed the variables of the same name in the user shader,
+        // which core profile contexts don't use
+        std::vector<GLuint> attributeLocations;
+        if (!m_cache.corePipeline && states.shader)
+        {
+            for (const VertexLayout::CustomAttribute& custom : layout.getCustomAttributes())
+            {
+                const int location = states.shader->getAttributeLocation(custom.name);
+                if (location < 0)
+                    continue;
+
+                const VertexLayout::Attribute& format = custom.attribute;
+                glCheck(GLEXT_glEnableVertexAttribArray(static_cast<GLuint>(location)));
+                glCheck(GLEXT_glVertexAttribPointer(static_cast<GLuint>(location),
+                                                    static_cast<GLint>(format.componentCount),
+                                                    RenderTargetImpl::vertexLayoutTypeToGlEnum(format.type),
+                                                    format.normalized ? GL_TRUE : GL_FALSE,
+                                                    static_cast<GLsizei>(layout.getStride()),
+                                                    reinterpret_cast<const void*>(format.offset)));
+                attributeLocations.push_back(static_cast<GLuint>(location));
+            }
+
+            RenderTargetImpl::setParameters(states.shader->getAttributeLocation(RenderTargetImpl::parametersAttribute),
+                                            states.shaderParameters,
+                                            nullptr);
+        }
+#endif
+
+        if (indexBuffer)
+        {
+            const bool wide   = indexBuffer->getType() == IndexBuffer::Type::UInt32;
+            const auto offset = ranges->first * (wide ? sizeof(std::uint32_t) : sizeof(std::uint16_t));
+
+            IndexBuffer::bind(indexBuffer);
+
+            glCheck(glDrawElements(RenderTargetImpl::primitiveTypeToGlEnum(vertexBuffer.getPrimitiveType()),
+                                   static_cast<GLsizei>(ranges->count),
+                                   wide ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT,
+                                   reinterpret_cast<const void*>(offset)));
+
+            ++m_statistics.drawCalls;
+            m_statistics.vertices += ranges->count;
+
+            IndexBuffer::bind(nullptr);
+        }
+        else if ((rangeCount > 1) && GLEXT_multi_draw_arrays)
+        {
+            m_multiDrawFirsts.clear();
+            m_multiDrawCounts.clear();
+            for (std::size_t i = 0; i < rangeCount; ++i)
+            {
+                m_multiDrawFirsts.push_back(static_cast<GLint>(ranges[i].first));
+                m_multiDrawCounts.push_back(static_cast<GLsizei>(ranges[i].count));
+                m_statistics.vertices += ranges[i].count;
+            }
+
+            glCheck(GLEXT_glMultiDrawArrays(RenderTargetImpl::primitiveTypeToGlEnum(vertexBuffer.getPrimitiveType()),
+                                            m_multiDrawFirsts.data(),
+                                            m_multiDrawCounts.data(),
+                                            static_cast<GLsizei>(rangeCount)));
+
+            ++m_statistics.drawCalls;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < rangeCount; ++i)
+                drawPrimitives(vertexBuffer.getPrimitiveType(), ranges[i].first, ranges[i].count);
+        }
+
+#ifndef SFML_OPENGL_ES
+        // Arrays left enabled would be read by the next draws, which don't provide them
+        for (const GLuint location : attributeLocations)
+            glCheck(GLEXT_glDisableVertexAttribArray(location));
+#endif
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        if (!states.stencilMode.stencilOnly)
+            onDraw(m_cache.drawRegion);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::drawInstances(const VertexBuffer* vertexBuffer,
+                                 const Vertex*       vertices,
+                                 std::size_t         vertexCount,
+                                 PrimitiveType       type,
+                                 const Transform*    transforms,
+                                 const Color*        colors,
+                                 std::size_t         instanceCount,
+                                 const RenderStates& states)
+{
+#ifdef SFML_OPENGL_ES
+
+    (void)vertexBuffer;
+    (void)vertices;
+    (void)vertexCount;
+    (void)type;
+    (void)transforms;
+    (void)colors;
+    (void)instanceCount;
+    (void)states;
+
+    return false;
+
+#else
+
+    // Our own program replaces the user shader, and command lists only record plain draws
+    if (m_recording || states.shader || !isInstancingAvailable())
+        return false;
+
+    // Preserve the drawing order of any pending batched geometry
+    flush();
+
+    if (!RenderTargetImpl::isActive(m_id) && !activateForDrawing())
+        return false;
+
+    auto* streamBuffer = priv::StreamBuffer::getCurrent();
+    if (!streamBuffer)
+        return false;
+
+    // Core profile contexts draw the instances with the program of their pipeline, the others with a built-in shader
+    priv::CoreProfilePipeline* corePipeline = priv::CoreProfilePipeline::getCurrent();
+    Shader*                    shader       = nullptr;
+
+    if (!corePipeline)
+    {
+        shader = getInstancingShader();
+        if (!shader)
+            return false;
+
+        shader->setUniform("sf_textured", states.texture != nullptr);
+    }
+
+    RenderStates instanceStates = states;
+    instanceStates.shader       = shader;
+
+    setupDraw(false, instanceStates);
+
+    // The instances follow the streamed vertices within a single write, since
+    // a second one could orphan the storage holding the vertices
+    m_streamScratch.clear();
+    if (!vertexBuffer)
+        m_streamScratch.insert(m_streamScratch.end(),
+                               reinterpret_cast<const std::byte*>(vertices),
+                               reinterpret_cast<const std::byte*>(vertices + vertexCount));
 
+    const std::size_t instancesOffset = m_streamScratch.size();
+    RenderTargetImpl::appendInstances(m_streamScratch, transforms, colors, instanceCount);
 
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
-{
-    drawable.draw(*this, states);
-}
+    const std::optional<std::size_t> streamOffset = streamBuffer->write(m_streamScratch.data(), m_streamScratch.size());
+    if (!streamOffset)
+    {
+        cleanupDraw(instanceStates);
+        return false;
+    }
 
+    // The stream buffer is bound, so the instance pointers are offsets within it
+    using Instance = priv::CoreProfilePipeline::Instance;
 
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
-{
-    // Nothing to draw?
-    if (!vertices || (vertexCount == 0))
-        return;
+    const std::size_t     instanceOffset = *streamOffset + instancesOffset;
+    std::array<GLuint, 4> instanceLocations{};
+    std::size_t           instanceLocationCount = 0;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (corePipeline)
     {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
+        corePipeline->setInstancePointers(instanceOffset);
+    }
+    else
+    {
+        const auto* data = reinterpret_cast<const std::byte*>(instanceOffset);
 
-        if (useVertexCache)
+        for (std::size_t i = 0; i < RenderTargetImpl::instanceAttributes.size(); ++i)
         {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
+            const int location = shader->getAttributeLocation(RenderTargetImpl::instanceAttributes[i]);
+            if (location < 0)
+                continue;
+
+            const auto index   = static_cast<GLuint>(location);
+            const bool isColor = (i == RenderTargetImpl::instanceAttributes.size() - 1);
+
+            glCheck(GLEXT_glEnableVertexAttribArray(index));
+            glCheck(GLEXT_glVertexAttribPointer(index,
+                                                isColor ? 4 : 3,
+                                                isColor ? GL_UNSIGNED_BYTE : GL_FLOAT,
+                                                isColor ? GL_TRUE : GL_FALSE,
+                                                sizeof(Instance),
+                                                isColor ? data + offsetof(Instance, color)
+                                                        : data + offsetof(Instance, rows) + sizeof(float) * 3 * i));
+            glCheck(GLEXT_glVertexAttribDivisor(index, 1));
+            instanceLocations[instanceLocationCount++] = index;
         }
+    }
 
-        setupDraw(useVertexCache, states);
+    // The vertices are either read from their own buffer or streamed ahead of the instances
+    if (vertexBuffer)
+    {
+        VertexBuffer::bind(vertexBuffer);
+        setVertexPointers(vertexBuffer->getLayout(), 0);
+    }
+    else
+    {
+        setVertexPointers(VertexLayout(), *streamOffset);
+    }
 
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+    glCheck(GLEXT_glDrawArraysInstanced(RenderTargetImpl::primitiveTypeToGlEnum(type),
+                                        0,
+                                        static_cast<GLsizei>(vertexCount),
+                                        static_cast<GLsizei>(instanceCount)));
+
+    ++m_statistics.drawCalls;
+    m_statistics.vertices += vertexCount * instanceCount;
+
+    // Instance arrays left enabled would be read by the next draws, which don't provide them
+    if (corePipeline)
+    {
+        corePipeline->clearInstancePointers();
+    }
+    else
+    {
+        for (std::size_t i = 0; i < instanceLocationCount; ++i)
         {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+            glCheck(GLEXT_glVertexAttribDivisor(instanceLocations[i], 0));
+            glCheck(GLEXT_glDisableVertexAttribArray(instanceLocations[i]));
         }
+    }
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
-        {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+    VertexBuffer::bind(nullptr);
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    cleanupDraw(instanceStates);
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    if (!states.stencilMode.stencilOnly)
+        onDraw(m_cache.drawRegion);
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
+    // Update the cache
+    m_cache.useVertexCache        = false;
+    m_cache.texCoordsArrayEnabled = true;
 
-        drawPrimitives(type, 0, vertexCount);
-        cleanupDraw(states);
+    return true;
 
-        // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
-    }
+#endif // SFML_OPENGL_ES
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+Shader* RenderTarget::getInstancingShader()
 {
-    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
-}
+    if (!m_instancingShader)
+    {
+        // Don't try to compile the shader again for every draw if it failed once
+        static bool failed = false;
+        if (failed)
+            return nullptr;
 
+        std::optional<Shader> shader = Shader::loadFromMemory(RenderTargetImpl::instancingVertexShader,
+                                                              RenderTargetImpl::instancingFragmentShader);
 
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
-{
-    // VertexBuffer not supported?
-    if (!VertexBuffer::isAvailable())
-    {
-        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
-        return;
+        if (!shader)
+        {
+            err() << "Failed to create the shader drawing instances, they are expanded on the CPU instead" << std::endl;
+            failed = true;
+            return nullptr;
+        }
+
+        shader->setUniform("sf_texture", Shader::CurrentTexture);
+        m_instancingShader = std::make_shared<Shader>(std::move(*shader));
     }
 
-    // Sanity check
-    if (firstVertex > vertexBuffer.getVertexCount())
-        return;
+    return m_instancingShader.get();
+}
 
-    // Clamp vertexCount to something that makes sense
-    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
 
-    // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
-        return;
+////////////////////////////////////////////////////////////
+void RenderTarget::setVertexPointers(const VertexLayout& layout, std::size_t offset)
+{
+    const VertexLayout::Attribute& position  = layout.getPosition();
+    const VertexLayout::Attribute& color     = layout.getColor();
+    const VertexLayout::Attribute& texCoords = layout.getTexCoords();
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (m_cache.corePipeline)
+    {
+        const auto setVertexPointer = [&](priv::CoreProfilePipeline::Attribute attribute,
+                                          const VertexLayout::Attribute&       format)
+        {
+            m_cache.corePipeline->setVertexPointer(attribute,
+                                                   static_cast<GLint>(format.componentCount),
+                                                   RenderTargetImpl::vertexLayoutTypeToGlEnum(format.type),
+                                                   format.normalized,
+                                                   layout.getStride(),
+                                                   offset + format.offset);
+        };
+
+        setVertexPointer(priv::CoreProfilePipeline::Attribute::Position, position);
+        setVertexPointer(priv::CoreProfilePipeline::Attribute::Color, color);
+        setVertexPointer(priv::CoreProfilePipeline::Attribute::TexCoords, texCoords);
+    }
+    else
     {
-        setupDraw(false, states);
-
-        // Bind vertex buffer
-        VertexBuffer::bind(&vertexBuffer);
-
         // Always enable texture coordinates
         if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
             glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
 
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+        const auto stride = static_cast<GLsizei>(layout.getStride());
+
+        glCheck(glVertexPointer(2,
+                                RenderTargetImpl::vertexLayoutTypeToGlEnum(position.type),
+                                stride,
+                                reinterpret_cast<const void*>(offset + position.offset)));
+        glCheck(glColorPointer(4,
+                               RenderTargetImpl::vertexLayoutTypeToGlEnum(color.type),
+                               stride,
+                               reinterpret_cast<const void*>(offset + color.offset)));
+        glCheck(glTexCoordPointer(2,
+                                  RenderTargetImpl::vertexLayoutTypeToGlEnum(texCoords.type),
+                                  stride,
+                                  reinterpret_cast<const void*>(offset + texCoords.offset)));
+    }
+}
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
 
-        // Unbind vertex buffer
-        VertexBuffer::bind(nullptr);
+////////////////////////////////////////////////////////////
+void RenderTarget::batchVertices(const Vertex*       vertices,
+                                 std::size_t         vertexCount,
+                                 PrimitiveType       type,
+                                 const RenderStates& states,
+                                 const Color&        color)
+{
+    const PrimitiveType batchType      = RenderTargetImpl::getBatchPrimitiveType(type);
+    const bool          sameParameters = RenderTargetImpl::sameParameters(states.shaderParameters,
+                                                                 m_batch.states.shaderParameters);
+
+    // Submit the pending batch if the new primitives can't be merged into it
+    // (command lists record the shader parameters of whole draws, not those of each vertex)
+    if (!m_batch.vertices.empty() &&
+        ((batchType != m_batch.type) || !RenderTargetImpl::canBatch(states, m_batch.states) ||
+         (m_recording && !sameParameters) ||
+         (m_batch.vertices.size() + vertexCount * 3 >
+          RenderTargetImpl::getMaxBatchVertexCount(!m_batch.parameters.empty() || !sameParameters))))
+        flush();
+
+    if (m_batch.vertices.empty())
+    {
+        m_batch.type             = batchType;
+        m_batch.states           = states;
+        m_batch.states.transform = Transform::Identity;
+    }
 
-        cleanupDraw(states);
+    const std::size_t first = m_batch.vertices.size();
+    RenderTargetImpl::appendAsList(m_batch.vertices, vertices, vertexCount, type, states.transform, color);
 
-        // Update the cache
-        m_cache.useVertexCache        = false;
-        m_cache.texCoordsArrayEnabled = true;
-    }
+    // The parameters of each vertex are only stored once the draws of the batch disagree on them
+    if (m_batch.parameters.empty() &&
+        !RenderTargetImpl::sameParameters(states.shaderParameters, m_batch.states.shaderParameters))
+        m_batch.parameters.assign(first, m_batch.states.shaderParameters);
+
+    if (!m_batch.parameters.empty())
+        m_batch.parameters.resize(m_batch.vertices.size(), states.shaderParameters);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawClipShape(const std::array<Vertex, 4>& vertices,
+                                 const View&                  view,
+                                 StencilValue                 reference,
+                                 StencilUpdateOperation       operation)
+{
+    RenderStates states;
+    states.stencilMode = StencilMode{StencilComparison::Equal, operation, reference, ~0u, true};
+
+    // The shape has to be drawn with the view it was defined with
+    const View currentView = m_view;
+    const bool viewChanged = (view.getTransform() != m_view.getTransform()) ||
+                             (view.getViewport() != m_view.getViewport()) || (view.getScissor() != m_view.getScissor());
+    if (viewChanged)
+        setView(view);
+
+    m_drawingClip = true;
+    drawVertices(vertices.data(), vertices.size(), PrimitiveType::TriangleStrip, states);
+    m_drawingClip = false;
+
+    if (viewChanged)
+        setView(currentView);
 }
 
 
@@ -479,35 +1834,36 @@ bool RenderTarget::isSrgb() const
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
-    // Mark this RenderTarget as active or no longer active in the tracking map
-    const std::lock_guard lock(RenderTargetImpl::getMutex());
-
-    const std::uint64_t contextId = Context::getActiveContextId();
+    RenderTargetImpl::ContextState* state = RenderTargetImpl::getContextState();
 
-    using RenderTargetImpl::getContextRenderTargetMap;
-    auto&      contextRenderTargetMap = getContextRenderTargetMap();
-    const auto it                     = contextRenderTargetMap.find(contextId);
+    // Nothing to track without a context, or if this RenderTarget is already the active one in the current context
+    if (!state || (active && (state->renderTargetId == m_id)))
+        return true;
 
+    // Mark this RenderTarget as active or no longer active in the state of the context
     if (active)
     {
-        if (it == contextRenderTargetMap.end())
+        if (!state->renderTargetId)
         {
-            contextRenderTargetMap[contextId] = m_id;
+            state->renderTargetId = m_id;
 
             m_cache.glStatesSet = false;
             m_cache.enable      = false;
         }
-        else if (it->second != m_id)
+        else
         {
-            it->second = m_id;
+            state->renderTargetId = m_id;
 
             m_cache.enable = false;
+            ++m_statistics.targetSwitches;
         }
+
+        // Install or remove the debug output callback if the diagnostics mode changed
+        priv::updateGlDebugOutput();
     }
     else
     {
-        if (it != contextRenderTargetMap.end())
-            contextRenderTargetMap.erase(it);
+        state->renderTargetId = 0;
 
         m_cache.enable = false;
     }
@@ -519,7 +1875,13 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    flush();
+
+    // Command lists have no OpenGL states to save
+    if (m_recording)
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
     {
 #ifdef SFML_DEBUG
         // make sure that the user didn't leave an unchecked OpenGL error
@@ -531,16 +1893,20 @@ void RenderTarget::pushGLStates()
         }
 #endif
 
+        // Core profile contexts have neither attribute nor matrix stacks
+        if (!priv::CoreProfilePipeline::getCurrent())
+        {
 #ifndef SFML_OPENGL_ES
-        glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
-        glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
+            glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
+            glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
 #endif
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPushMatrix());
+        }
     }
 
     resetGLStates();
@@ -550,18 +1916,31 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    flush();
+
+    // Command lists have no OpenGL states to restore
+    if (m_recording)
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
     {
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPopMatrix());
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPopMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPopMatrix());
+        // Core profile contexts have neither attribute nor matrix stacks
+        if (!priv::CoreProfilePipeline::getCurrent())
+        {
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPopMatrix());
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPopMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPopMatrix());
 #ifndef SFML_OPENGL_ES
-        glCheck(glPopClientAttrib());
-        glCheck(glPopAttrib());
+            glCheck(glPopClientAttrib());
+            glCheck(glPopAttrib());
 #endif
+        }
+
+        // The OpenGL code since pushGLStates() may have drawn anywhere
+        onDraw(IntRect({0, 0}, Vector2i(getSize())));
     }
 }
 
@@ -569,6 +1948,12 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    flush();
+
+    // Command lists have no OpenGL states to reset
+    if (m_recording)
+        return;
+
     // Check here to make sure a context change does not happen after activate(true)
     const bool shaderAvailable       = Shader::isAvailable();
     const bool vertexBufferAvailable = VertexBuffer::isAvailable();
@@ -582,40 +1967,59 @@ void RenderTarget::resetGLStates()
     }
 #endif
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (RenderTargetImpl::isActive(m_id) || activateForDrawing())
     {
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
 
+        // Core profile contexts are drawn to through our own programmable pipeline
+        m_cache.corePipeline = priv::CoreProfilePipeline::getCurrent();
+
         // Make sure that the texture unit which is active is the number 0
         if (GLEXT_multitexture)
         {
-            glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
+            if (!m_cache.corePipeline)
+                glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
             glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
         }
 
         // Define the default OpenGL states
         glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
         glCheck(glDisable(GL_STENCIL_TEST));
         glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
+        glCheck(glDepthMask(GL_TRUE));
         glCheck(glDisable(GL_SCISSOR_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
         glCheck(glEnable(GL_BLEND));
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glLoadIdentity());
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
         glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+
+        if (m_cache.corePipeline)
+        {
+            m_cache.corePipeline->bind();
+            m_cache.corePipeline->setModelViewMatrix(Transform::Identity.getMatrix());
+        }
+        else
+        {
+            glCheck(glDisable(GL_LIGHTING));
+            glCheck(glDisable(GL_ALPHA_TEST));
+            glCheck(glEnable(GL_TEXTURE_2D));
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glLoadIdentity());
+            glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+            glCheck(glEnableClientState(GL_COLOR_ARRAY));
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
         m_cache.scissorEnabled = false;
         m_cache.stencilEnabled = false;
+        m_cache.depthEnabled   = false;
+        m_cache.lastTransform  = Transform::Identity;
+        m_cache.lastDepth      = 0.f;
         m_cache.glStatesSet    = true;
 
         // Apply the default SFML states
         applyBlendMode(BlendAlpha);
         applyStencilMode(StencilMode());
+        applyDepthMode(DepthMode());
         applyTexture(nullptr);
         if (shaderAvailable)
             applyShader(nullptr);
@@ -635,12 +2039,27 @@ void RenderTarget::resetGLStates()
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::activateForDrawing()
+{
+    return setActive(true);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::onDraw(const IntRect& /* region */)
+{
+    // Nothing to do by default
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::initialize()
 {
     // Setup the default and current views
     m_defaultView = View(FloatRect({0, 0}, Vector2f(getSize())));
     m_view        = m_defaultView;
+    m_visibleArea = m_view.getVisibleArea();
 
     // Set GL states only on first draw, so that we don't pollute user's states
     m_cache.glStatesSet = false;
@@ -654,13 +2073,51 @@ void RenderTarget::initialize()
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
+    ++m_statistics.stateChanges;
+
     // Set the viewport
     const IntRect viewport    = getViewport(m_view);
     const int     viewportTop = static_cast<int>(getSize().y) - (viewport.top + viewport.height);
     glCheck(glViewport(viewport.left, viewportTop, viewport.width, viewport.height));
 
+    applyScissor();
+
+    // Set the projection matrix
+    if (m_cache.corePipeline)
+    {
+        m_cache.corePipeline->setProjectionMatrix(m_view.getTransform().getMatrix());
+    }
+    else
+    {
+        glCheck(glMatrixMode(GL_PROJECTION));
+        glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+
+        // Go back to model-view mode
+        glCheck(glMatrixMode(GL_MODELVIEW));
+    }
+
+    m_cache.viewChanged = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::applyScissor()
+{
+    const Vector2i size(getSize());
+
+    // The scissor rectangle of the view is combined with the one of the clip rectangles
+    IntRect pixelScissor = getScissor(m_view);
+    if (!m_clipStack.empty())
+        pixelScissor = pixelScissor.findIntersection(m_clipStack.back().scissor).value_or(IntRect());
+
+    // Drawing is clipped to the viewport, clearing is only affected by the scissor rectangle
+    const IntRect viewport    = getViewport(m_view);
+    const int     viewportTop = size.y - (viewport.top + viewport.height);
+    m_cache.drawRegion        = IntRect({viewport.left, viewportTop}, {viewport.width, viewport.height});
+    m_cache.clearRegion       = IntRect({0, 0}, size);
+
     // Set the scissor rectangle and enable/disable scissor testing
-    if (m_view.getScissor() == FloatRect({0, 0}, {1, 1}))
+    if (pixelScissor == IntRect({0, 0}, size))
     {
         if (m_cache.scissorEnabled)
         {
@@ -670,10 +2127,12 @@ void RenderTarget::applyCurrentView()
     }
     else
     {
-        const IntRect pixelScissor = getScissor(m_view);
-        const int     scissorTop   = static_cast<int>(getSize().y) - (pixelScissor.top + pixelScissor.height);
+        const int scissorTop = size.y - (pixelScissor.top + pixelScissor.height);
         glCheck(glScissor(pixelScissor.left, scissorTop, pixelScissor.width, pixelScissor.height));
 
+        m_cache.clearRegion = IntRect({pixelScissor.left, scissorTop}, {pixelScissor.width, pixelScissor.height});
+        m_cache.drawRegion  = m_cache.drawRegion.findIntersection(m_cache.clearRegion).value_or(IntRect());
+
         if (!m_cache.scissorEnabled)
         {
             glCheck(glEnable(GL_SCISSOR_TEST));
@@ -681,14 +2140,7 @@ void RenderTarget::applyCurrentView()
         }
     }
 
-    // Set the projection matrix
-    glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
-
-    // Go back to model-view mode
-    glCheck(glMatrixMode(GL_MODELVIEW));
-
-    m_cache.viewChanged = false;
+    m_cache.clipChanged = false;
 }
 
 
@@ -697,6 +2149,8 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
 {
     using RenderTargetImpl::equationToGlConstant;
     using RenderTargetImpl::factorToGlConstant;
+    ++m_statistics.stateChanges;
+
 
     // Apply the blend mode, falling back to the non-separate versions if necessary
     if (GLEXT_blend_func_separate)
@@ -750,6 +2204,8 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
 {
     using RenderTargetImpl::stencilFunctionToGlConstant;
     using RenderTargetImpl::stencilOperationToGlConstant;
+    ++m_statistics.stateChanges;
+
 
     // Fast path if we have a default (disabled) stencil mode
     if (mode == StencilMode())
@@ -783,21 +2239,88 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::applyTransform(const Transform& transform)
+void RenderTarget::applyDepthMode(const DepthMode& mode)
+{
+    using RenderTargetImpl::depthFunctionToGlConstant;
+    ++m_statistics.stateChanges;
+
+    // Fast path if we have a disabled depth mode, whatever its depth
+    if ((mode.depthComparison == DepthComparison::Always) && !mode.depthWrite)
+    {
+        if (m_cache.depthEnabled)
+        {
+            glCheck(glDisable(GL_DEPTH_TEST));
+            m_cache.depthEnabled = false;
+        }
+    }
+    else
+    {
+        if (!m_cache.depthEnabled)
+            glCheck(glEnable(GL_DEPTH_TEST));
+
+        glCheck(glDepthFunc(depthFunctionToGlConstant(mode.depthComparison)));
+        glCheck(glDepthMask(mode.depthWrite ? GL_TRUE : GL_FALSE));
+
+        m_cache.depthEnabled = true;
+    }
+
+    m_cache.lastDepthMode = mode;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::applyTransform(const Transform& transform, float depth)
 {
+    ++m_statistics.stateChanges;
+
+    // The depth of the draw is the z translation of the model-view matrix,
+    // since neither the 2D transforms nor the projection of the view touch z
+    const float* matrix = transform.getMatrix();
+    float        translated[16];
+    if (depth != 0.f)
+    {
+        std::copy(matrix, matrix + 16, translated);
+        translated[14] = depth;
+        matrix         = translated;
+    }
+
+    m_cache.lastTransform = transform;
+    m_cache.lastDepth     = depth;
+
+    if (m_cache.corePipeline)
+    {
+        m_cache.corePipeline->setModelViewMatrix(matrix);
+        return;
+    }
+
     // No need to call glMatrixMode(GL_MODELVIEW), it is always the
     // current mode (for optimization purpose, since it's the most used)
-    if (transform == Transform::Identity)
+    if ((transform == Transform::Identity) && (depth == 0.f))
         glCheck(glLoadIdentity());
     else
-        glCheck(glLoadMatrixf(transform.getMatrix()));
+        glCheck(glLoadMatrixf(matrix));
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinateType)
 {
-    Texture::bind(texture, coordinateType);
+    ++m_statistics.stateChanges;
+
+    if (m_cache.corePipeline)
+    {
+        // There is no texture matrix in core profile contexts, our program applies it instead
+        const bool textured = texture && texture->m_texture;
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, textured ? texture->m_texture : 0));
+        m_cache.corePipeline->setTextureMatrix(textured ? texture->getTextureMatrix(coordinateType).data()
+                                                        : Transform::Identity.getMatrix());
+        m_cache.corePipeline->setTextureEnabled(textured);
+    }
+    else
+    {
+        Texture::bind(texture, coordinateType);
+    }
 
     m_cache.lastTextureId      = texture ? texture->m_cacheId : 0;
     m_cache.lastCoordinateType = coordinateType;
@@ -807,13 +2330,34 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyShader(const Shader* shader)
 {
+    ++m_statistics.stateChanges;
+
+    // Binding a shader would replace our own program in core profile contexts
+    if (m_cache.corePipeline)
+    {
+        static bool warned = false;
+
+        if (shader && !warned)
+        {
+            err() << "Shaders are not supported when drawing to a core profile context, the shader is ignored"
+                  << std::endl;
+            warned = true;
+        }
+
+        return;
+    }
+
     Shader::bind(shader);
+
+    m_cache.shaderBound = (shader != nullptr);
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 {
+    SFML_PROFILE_ZONE("sf::RenderTarget::setupDraw");
+
     // GL_FRAMEBUFFER_SRGB is not available on OpenGL ES
     // If a framebuffer supports sRGB, it will always be enabled on OpenGL ES
 #ifndef SFML_OPENGL_ES
@@ -832,31 +2376,70 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     if (!m_cache.glStatesSet)
         resetGLStates();
 
-    if (useVertexCache)
+    // Rebind our program in core profile contexts, user code may have replaced it
+    if (!m_cache.enable)
     {
-        // Since vertices are transformed, we must use an identity transform to render them
-        if (!m_cache.enable || !m_cache.useVertexCache)
-            glCheck(glLoadIdentity());
+        m_cache.corePipeline = priv::CoreProfilePipeline::getCurrent();
+
+        if (m_cache.corePipeline)
+            m_cache.corePipeline->bind();
     }
+
+    // Since pre-transformed vertices are rendered with an identity transform,
+    // the transform only has to change when switching to or from the vertex cache
+    const Transform& transform = useVertexCache ? Transform::Identity : states.transform;
+    const float      depth     = states.depthMode.depth;
+    if (!m_cache.enable || (transform != m_cache.lastTransform) || (depth != m_cache.lastDepth))
+        applyTransform(transform, depth);
     else
-    {
-        applyTransform(states.transform);
-    }
+        ++m_statistics.redundantStateChanges;
 
     // Apply the view
     if (!m_cache.enable || m_cache.viewChanged)
+    {
         applyCurrentView();
+    }
+    else if (m_cache.clipChanged)
+    {
+        ++m_statistics.stateChanges;
+        applyScissor();
+    }
+    else
+    {
+        ++m_statistics.redundantStateChanges;
+    }
 
     // Apply the blend mode
     if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
         applyBlendMode(states.blendMode);
+    else
+        ++m_statistics.redundantStateChanges;
+
+    // Within a stencil clip, only the pixels inside all the clip shapes are drawn
+    StencilMode stencilMode = states.stencilMode;
+    if (!m_drawingClip && !m_clipStack.empty() && m_clipStack.back().stencilDepth)
+        stencilMode = StencilMode{StencilComparison::Equal,
+                                  StencilUpdateOperation::Keep,
+                                  m_clipStack.back().stencilDepth,
+                                  ~0u,
+                                  false};
 
     // Apply the stencil mode
-    if (!m_cache.enable || (states.stencilMode != m_cache.lastStencilMode))
-        applyStencilMode(states.stencilMode);
+    if (!m_cache.enable || (stencilMode != m_cache.lastStencilMode))
+        applyStencilMode(stencilMode);
+    else
+        ++m_statistics.redundantStateChanges;
+
+    // Apply the depth mode, the depth itself is part of the transform
+    const DepthMode& depthMode = states.depthMode;
+    if (!m_cache.enable || (depthMode.depthComparison != m_cache.lastDepthMode.depthComparison) ||
+        (depthMode.depthWrite != m_cache.lastDepthMode.depthWrite))
+        applyDepthMode(depthMode);
+    else
+        ++m_statistics.redundantStateChanges;
 
     // Mask the color buffer off if necessary
-    if (states.stencilMode.stencilOnly)
+    if (stencilMode.stencilOnly)
         glCheck(glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE));
 
     // Apply the texture
@@ -875,11 +2458,18 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
         if (textureId != m_cache.lastTextureId || states.coordinateType != m_cache.lastCoordinateType)
             applyTexture(states.texture, states.coordinateType);
+        else
+            ++m_statistics.redundantStateChanges;
     }
 
-    // Apply the shader
+    // Apply the shader, it is always rebound since its textures and uniforms may have changed
+    // A shader left bound by a previous draw is only unbound when a draw doesn't use any
     if (states.shader)
         applyShader(states.shader);
+    else if ((!m_cache.enable || m_cache.shaderBound) && Shader::isAvailable())
+        applyShader(nullptr);
+    else
+        ++m_statistics.redundantStateChanges;
 }
 
 
@@ -887,21 +2477,19 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum            mode = modes[static_cast<std::size_t>(type)];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlEnum(type);
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+
+    ++m_statistics.drawCalls;
+    m_statistics.vertices += vertexCount;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
-    // Unbind the shader, if any
-    if (states.shader)
-        applyShader(nullptr);
-
     // If the texture we used to draw belonged to a RenderTexture, then forcibly unbind that texture.
     // This prevents a bug where some drivers do not clear RenderTextures properly.
     if (states.texture && states.texture->m_fboAttachment)
@@ -932,7 +2520,8 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   lead, in worst case, to changing it every 4 vertices.
 //   To avoid that, when the vertex count is low enough, we
 //   pre-transform them and therefore use an identity transform
-//   to render them.
+//   to render them. The last transform is remembered as well, so
+//   consecutive draws sharing a transform don't reload it.
 //
 // * Blending mode
 //   Since it overloads the == operator, we can easily check
@@ -949,8 +2538,15 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 // * Shader
 //   Shaders are very hard to optimize, because they have
 //   parameters that can be hard (if not impossible) to track,
-//   like matrices or textures. The only optimization that we
-//   do is that we avoid setting a null shader if there was
-//   already none for the previous draw.
+//   like matrices or textures. A shader is therefore rebound
+//   for every draw that uses it, but it is left bound after
+//   the draw and only unbound by the next draw without shader.
+//
+// * Batching
+//   When enabled, consecutive vertex draws sharing the same
+//   states (except for the transform) are pre-transformed on
+//   the CPU like the vertex cache does, and accumulated until
+//   a state change forces them to be submitted as a single
+//   draw call.
 //
 ////////////////////////////////////////////////////////////
@@ -71,8 +71,11 @@ std::optional<RenderTexture> RenderTexture::create(const Vector2u& size, const C
         // Use frame-buffer object (FBO)
         renderTexture.m_impl = std::make_unique<priv::RenderTextureImplFBO>();
 
-        // Mark the texture as being a framebuffer object attachment
+        // Mark the texture as being a framebuffer object attachment, its memory now belongs to the render texture
+        const std::uint64_t memoryUsage = renderTexture.m_texture.m_memoryUsage;
+        renderTexture.m_texture.setMemoryUsage(0);
         renderTexture.m_texture.m_fboAttachment = true;
+        renderTexture.m_texture.setMemoryUsage(memoryUsage);
     }
     else
     {
@@ -134,6 +137,20 @@ bool RenderTexture::isRepeated() const
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTexture::setPremultipliedAlpha(bool premultiplied)
+{
+    m_texture.setPremultipliedAlpha(premultiplied);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexture::isPremultipliedAlpha() const
+{
+    return m_texture.isPremultipliedAlpha();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTexture::generateMipmap()
 {
@@ -144,17 +161,30 @@ bool RenderTexture::generateMipmap()
 ////////////////////////////////////////////////////////////
 bool RenderTexture::setActive(bool active)
 {
-    // Update RenderTarget tracking
-    if (m_impl->activate(active))
-        return RenderTarget::setActive(active);
+    if (!active)
+    {
+        // Update RenderTarget tracking
+        if (m_impl->activate(false))
+            return RenderTarget::setActive(false);
 
-    return false;
+        return false;
+    }
+
+    if (!activateForDrawing())
+        return false;
+
+    // Direct OpenGL rendering may follow, we can't know what it will touch
+    m_impl->markDirty(IntRect({0, 0}, Vector2i(getSize())));
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTexture::display()
 {
+    // Submit any pending batched geometry before updating the texture
+    flush();
+
     if (priv::RenderTextureImplFBO::isAvailable())
     {
         // Perform a RenderTarget-only activation if we are using FBOs
@@ -175,6 +205,17 @@ void RenderTexture::display()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTexture::discardDepthStencil()
+{
+    // Pending batched geometry may still need the depth and stencil values
+    flush();
+
+    if (activateForDrawing())
+        m_impl->discardDepthStencil();
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u RenderTexture::getSize() const
 {
@@ -196,6 +237,24 @@ const Texture& RenderTexture::getTexture() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTexture::activateForDrawing()
+{
+    // Update RenderTarget tracking
+    if (m_impl->activate(true))
+        return RenderTarget::setActive(true);
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexture::onDraw(const IntRect& region)
+{
+    m_impl->markDirty(region);
+}
+
+
 ////////////////////////////////////////////////////////////
 RenderTexture::RenderTexture(Texture&& texture) : m_texture(std::move(texture))
 {
@@ -27,6 +27,8 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Rect.hpp>
+
 #include <SFML/System/Vector2.hpp>
 
 
@@ -108,6 +110,26 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual void updateTexture(unsigned int textureId) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify that an area of the render texture was drawn to
+    ///
+    /// \param region Modified area, in OpenGL window coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void markDirty(const IntRect& /* region */)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Let the driver drop the depth and stencil contents
+    ///
+    /// The render texture must be active when calling this function.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void discardDepthStencil()
+    {
+    }
 };
 
 } // namespace priv
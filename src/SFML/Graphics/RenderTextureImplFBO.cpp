@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuMemoryTracker.hpp>
 #include <SFML/Graphics/RenderTextureImplFBO.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -34,10 +35,32 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <utility>
 
 
+namespace
+{
+namespace RenderTextureImplFBOImpl
+{
+// Forget the frame buffers of contexts that have been destroyed, they
+// were deleted with their context but their entries would otherwise
+// pile up when contexts come and go (e.g. with short-lived threads)
+template <typename FrameBufferObjectMap>
+void removeExpiredFrameBuffers(FrameBufferObjectMap& frameBuffers)
+{
+    for (auto it = frameBuffers.begin(); it != frameBuffers.end();)
+    {
+        if (it->second.expired())
+            it = frameBuffers.erase(it);
+        else
+            ++it;
+    }
+}
+} // namespace RenderTextureImplFBOImpl
+} // namespace
+
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
@@ -66,6 +89,8 @@ RenderTextureImplFBO::RenderTextureImplFBO() = default;
 ////////////////////////////////////////////////////////////
 RenderTextureImplFBO::~RenderTextureImplFBO()
 {
+    priv::setGpuMemoryUsage(GpuMemory::Category::RenderTexture, m_memoryUsage, 0);
+
     const TransientContextLock contextLock;
 
     // Destroy the color buffer
@@ -347,6 +372,11 @@ bool RenderTextureImplFBO::create(const Vector2u& size, unsigned int textureId,
         }
     }
 
+    // Report the memory of the attachments: 4 bytes per sample for color and depth, 1 for stencil alone
+    const std::uint64_t sampleCount    = std::uint64_t{size.x} * size.y * std::max(settings.antialiasingLevel, 1u);
+    const std::uint64_t bytesPerSample = (m_colorBuffer ? 4u : 0u) + (m_depth ? 4u : (m_stencil ? 1u : 0u));
+    priv::setGpuMemoryUsage(GpuMemory::Category::RenderTexture, m_memoryUsage, sampleCount * bytesPerSample);
+
     // Save our texture ID in order to be able to attach it to an FBO at any time
     m_textureId = textureId;
 
@@ -396,6 +426,9 @@ bool RenderTextureImplFBO::create(const Vector2u& size, unsigned int textureId,
 ////////////////////////////////////////////////////////////
 bool RenderTextureImplFBO::createFrameBuffer()
 {
+    RenderTextureImplFBOImpl::removeExpiredFrameBuffers(m_frameBuffers);
+    RenderTextureImplFBOImpl::removeExpiredFrameBuffers(m_multisampleFrameBuffers);
+
     // Create the framebuffer object
     auto frameBuffer = std::make_shared<FrameBufferObject>();
 
@@ -601,8 +634,11 @@ void RenderTextureImplFBO::updateTexture(unsigned int)
 
     // In case of multisampling, make sure both FBOs
     // are already available within the current context
-    if (m_multisample && m_size.x && m_size.y && activate(true))
+    // Nothing has to be resolved if nothing was drawn since the last time
+    if (m_multisample && m_dirtyRegion && activate(true))
     {
+        const IntRect region = *m_dirtyRegion;
+
         const std::uint64_t contextId = Context::getActiveContextId();
 
         const auto frameBufferIt = m_frameBuffers.find(contextId);
@@ -625,14 +661,15 @@ void RenderTextureImplFBO::updateTexture(unsigned int)
 
                 // Set up the blit target (draw framebuffer) and blit (from the read framebuffer, our multisample FBO)
                 glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, frameBuffer->object));
-                glCheck(GLEXT_glBlitFramebuffer(0,
-                                                0,
-                                                static_cast<GLint>(m_size.x),
-                                                static_cast<GLint>(m_size.y),
-                                                0,
-                                                0,
-                                                static_cast<GLint>(m_size.x),
-                                                static_cast<GLint>(m_size.y),
+                // Only the area drawn since the last resolve has to be copied
+                glCheck(GLEXT_glBlitFramebuffer(region.left,
+                                                region.top,
+                                                region.left + region.width,
+                                                region.top + region.height,
+                                                region.left,
+                                                region.top,
+                                                region.left + region.width,
+                                                region.top + region.height,
                                                 GL_COLOR_BUFFER_BIT,
                                                 GL_NEAREST));
                 glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, multiSampleFrameBuffer->object));
@@ -640,6 +677,8 @@ void RenderTextureImplFBO::updateTexture(unsigned int)
                 // Re-enable scissor testing if it was previously enabled
                 if (scissorEnabled == GL_TRUE)
                     glCheck(glEnable(GL_SCISSOR_TEST));
+
+                m_dirtyRegion.reset();
             }
         }
     }
@@ -647,4 +686,45 @@ void RenderTextureImplFBO::updateTexture(unsigned int)
 #endif // SFML_OPENGL_ES
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderTextureImplFBO::markDirty(const IntRect& region)
+{
+    // Only the multisample resolve needs to know what was drawn
+    if (!m_multisample)
+        return;
+
+    // Clip the region to the attachments, the viewport may extend beyond them
+    const auto clipped = region.findIntersection(IntRect({0, 0}, Vector2i(m_size)));
+    if (!clipped)
+        return;
+
+    if (!m_dirtyRegion)
+    {
+        m_dirtyRegion = clipped;
+        return;
+    }
+
+    // Grow the dirty region to the bounding rectangle of both areas
+    const int left   = std::min(m_dirtyRegion->left, clipped->left);
+    const int top    = std::min(m_dirtyRegion->top, clipped->top);
+    const int right  = std::max(m_dirtyRegion->left + m_dirtyRegion->width, clipped->left + clipped->width);
+    const int bottom = std::max(m_dirtyRegion->top + m_dirtyRegion->height, clipped->top + clipped->height);
+
+    m_dirtyRegion = IntRect({left, top}, {right - left, bottom - top});
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTextureImplFBO::discardDepthStencil()
+{
+    if ((!m_depth && !m_stencil) || !GLEXT_invalidate_framebuffer)
+        return;
+
+    // The render texture is active, so the frame buffer we draw to is bound
+    // Attachments that the frame buffer doesn't have are simply ignored
+    const GLenum attachments[] = {GLEXT_GL_DEPTH_ATTACHMENT, GLEXT_GL_STENCIL_ATTACHMENT};
+    glCheck(GLEXT_glInvalidateFramebuffer(GLEXT_GL_FRAMEBUFFER, 2, attachments));
+}
+
 } // namespace sf::priv
@@ -34,6 +34,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include <cstdint>
@@ -138,6 +139,20 @@ private:
     ////////////////////////////////////////////////////////////
     void updateTexture(unsigned textureId) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify that an area of the render texture was drawn to
+    ///
+    /// \param region Modified area, in OpenGL window coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void markDirty(const IntRect& region) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Let the driver drop the depth and stencil contents
+    ///
+    ////////////////////////////////////////////////////////////
+    void discardDepthStencil() override;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -156,6 +171,8 @@ private:
     bool                     m_depth{};              //!< Whether we have depth attachment
     bool                     m_stencil{};            //!< Whether we have stencil attachment
     bool                     m_sRgb{};               //!< Whether we need to encode drawn pixels into sRGB color space
+    std::optional<IntRect>   m_dirtyRegion;          //!< Area of the multisample frame buffer drawn since the last resolve
+    std::uint64_t            m_memoryUsage{};        //!< Video memory used by the attachments, in bytes
 };
 
 } // namespace priv
@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+
+
+namespace
+{
+namespace RenderTexturePoolImpl
+{
+bool haveSameSettings(const sf::ContextSettings& left, const sf::ContextSettings& right)
+{
+    return left.depthBits == right.depthBits && left.stencilBits == right.stencilBits &&
+           left.antialiasingLevel == right.antialiasingLevel && left.majorVersion == right.majorVersion &&
+           left.minorVersion == right.minorVersion && left.attributeFlags == right.attributeFlags &&
+           left.sRgbCapable == right.sRgbCapable;
+}
+} // namespace RenderTexturePoolImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool(RenderTexturePool&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool& RenderTexturePool::operator=(RenderTexturePool&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(const Vector2u& size, const ContextSettings& settings)
+{
+    // Reuse a free render texture with the same properties
+    for (Entry& entry : m_entries)
+    {
+        if (!entry.acquired && entry.renderTexture->getSize() == size &&
+            RenderTexturePoolImpl::haveSameSettings(entry.settings, settings))
+        {
+            // Restore the state of a newly created render texture
+            RenderTexture& renderTexture = *entry.renderTexture;
+            renderTexture.setSmooth(false);
+            renderTexture.setRepeated(false);
+            renderTexture.setView(renderTexture.getDefaultView());
+
+            entry.acquired  = true;
+            entry.lastFrame = m_frame;
+            return &renderTexture;
+        }
+    }
+
+    // None available, create a new one
+    auto renderTexture = RenderTexture::create(size, settings);
+    if (!renderTexture)
+        return nullptr;
+
+    Entry& entry        = m_entries.emplace_back();
+    entry.renderTexture = std::make_unique<RenderTexture>(std::move(*renderTexture));
+    entry.settings      = settings;
+    entry.lastFrame     = m_frame;
+    entry.acquired      = true;
+    return entry.renderTexture.get();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(const RenderTexture& renderTexture)
+{
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry) { return entry.renderTexture.get() == &renderTexture; });
+
+    assert(it != m_entries.end() && "RenderTexturePool::release() render texture does not belong to this pool");
+    assert(it->acquired && "RenderTexturePool::release() render texture is not acquired");
+
+    it->acquired = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::endFrame()
+{
+    for (Entry& entry : m_entries)
+        entry.acquired = false;
+
+    // Destroy the render textures that have not been needed for a while
+    const auto isStale = [this](const Entry& entry) { return m_frame - entry.lastFrame > m_maxUnusedFrames; };
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), isStale), m_entries.end());
+
+    ++m_frame;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::setMaxUnusedFrames(unsigned int frames)
+{
+    m_maxUnusedFrames = frames;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTexturePool::getMaxUnusedFrames() const
+{
+    return m_maxUnusedFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::clear()
+{
+    const auto isFree = [](const Entry& entry) { return !entry.acquired; };
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), isFree), m_entries.end());
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getTextureCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getAcquiredCount() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return entry.acquired; }));
+}
+
+} // namespace sf
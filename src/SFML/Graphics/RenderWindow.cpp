@@ -103,6 +103,30 @@ bool RenderWindow::setActive(bool active)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderWindow::display(const std::vector<IntRect>& damage)
+{
+    for (const IntRect& rect : damage)
+        addDamage(rect.getPosition(), rect.getSize());
+
+    display();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderWindow::setDamageTrackingEnabled(bool enabled)
+{
+    m_damageTracking = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderWindow::isDamageTrackingEnabled() const
+{
+    return m_damageTracking;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderWindow::onCreate()
 {
@@ -118,6 +142,14 @@ void RenderWindow::onCreate()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderWindow::onDisplay()
+{
+    // Submit any pending batched geometry before swapping the buffers
+    flush();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderWindow::onResize()
 {
@@ -125,4 +157,16 @@ void RenderWindow::onResize()
     setView(getView());
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onDraw(const IntRect& region)
+{
+    if (!m_damageTracking)
+        return;
+
+    // The region is given with the origin at the bottom-left corner of the window
+    const int top = static_cast<int>(getSize().y) - (region.top + region.height);
+    addDamage({region.left, top}, region.getSize());
+}
+
 } // namespace sf
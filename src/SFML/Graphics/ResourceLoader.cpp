@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/ResourceLoader.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ResourceLoader::ResourceLoader() : ResourceLoader(std::thread::hardware_concurrency())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ResourceLoader::ResourceLoader(unsigned int threadCount)
+{
+    threadCount = std::max(threadCount, 1u);
+
+    m_threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_threads.emplace_back(&ResourceLoader::run, this);
+}
+
+
+////////////////////////////////////////////////////////////
+ResourceLoader::~ResourceLoader()
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_condition.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Image>> ResourceLoader::loadImage(const std::filesystem::path& filename)
+{
+    return submit<std::optional<Image>>([filename] { return Image::loadFromFile(filename); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Texture>> ResourceLoader::loadTexture(const std::filesystem::path& filename, bool sRgb)
+{
+    return submit<std::optional<Texture>>(
+        [filename, sRgb]
+        {
+            auto texture = Texture::loadFromFile(filename, sRgb);
+
+            // Make sure the upload is complete before the texture is used in another context
+            glCheck(glFinish());
+
+            return texture;
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Font>> ResourceLoader::loadFont(const std::filesystem::path& filename)
+{
+    return submit<std::optional<Font>>([filename] { return Font::loadFromFile(filename); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<Shader>> ResourceLoader::loadShader(const std::filesystem::path& vertexShaderFilename,
+                                                              const std::filesystem::path& fragmentShaderFilename)
+{
+    return submit<std::optional<Shader>>(
+        [vertexShaderFilename, fragmentShaderFilename]
+        {
+            auto shader = Shader::loadFromFile(vertexShaderFilename, fragmentShaderFilename);
+
+            // Make sure the program is linked before it is used in another context
+            glCheck(glFinish());
+
+            return shader;
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<void> ResourceLoader::enqueue(std::function<void()> job)
+{
+    return submit<void>(std::move(job));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ResourceLoader::getThreadCount() const
+{
+    return m_threads.size();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::future<T> ResourceLoader::submit(std::function<T()> job)
+{
+    // std::function requires a copyable target, hence the shared task
+    auto task   = std::make_shared<std::packaged_task<T()>>(std::move(job));
+    auto future = task->get_future();
+
+    {
+        const std::lock_guard lock(m_mutex);
+        m_jobs.emplace_back([task] { (*task)(); });
+    }
+
+    m_condition.notify_one();
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+void ResourceLoader::run()
+{
+    // Keep a shared context active for the whole life of the thread, so
+    // that the resources don't have to activate a transient one each time
+    const Context context;
+
+    for (;;)
+    {
+        std::function<void()> job;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+
+            if (m_jobs.empty())
+                return;
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        job();
+    }
+}
+
+} // namespace sf
@@ -30,7 +30,10 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
+#include <SFML/Window/Context.hpp>
 #include <SFML/Window/GlResource.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -39,15 +42,28 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <mutex>
 #include <ostream>
+#include <sstream>
+#include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 #include <cassert>
 #include <cstdint>
 
+namespace
+{
+// State of the program binary cache, shared by all the shaders
+std::mutex            binaryCacheMutex;
+std::filesystem::path binaryCacheDirectory;
+} // namespace
+
 #ifndef SFML_OPENGL_ES
 
 #if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
@@ -78,6 +94,20 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
+// Retrieve the maximum number of uniform buffer binding points available
+std::size_t getMaxUniformBufferBindings()
+{
+    static const GLint maxBindings = []
+    {
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS, &value));
+
+        return value;
+    }();
+
+    return static_cast<std::size_t>(maxBindings);
+}
+
 // Read the contents of a file into an array of char
 bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
 {
@@ -170,6 +200,145 @@ std::vector<float> flatten(const sf::Glsl::Vec4* vectorArray, std::size_t length
 
     return contiguous;
 }
+
+// Compute the FNV-1a hash of a string, continuing from a previous hash
+std::uint64_t hashString(std::string_view string, std::uint64_t hash = 14695981039346656037u)
+{
+    for (const char character : string)
+    {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211u;
+    }
+
+    return hash;
+}
+
+// Build the path of the cache file storing the binary of a program, empty if the cache can't be used
+std::filesystem::path getBinaryCacheFilename(std::string_view vertexShaderCode,
+                                             std::string_view geometryShaderCode,
+                                             std::string_view fragmentShaderCode)
+{
+    std::filesystem::path directory;
+    {
+        const std::lock_guard lock(binaryCacheMutex);
+        directory = binaryCacheDirectory;
+    }
+
+    if (directory.empty() || !GLEXT_get_program_binary)
+        return {};
+
+    // Programs can't be retrieved if the driver doesn't support any binary format
+    GLint formatCount = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+    if (formatCount <= 0)
+        return {};
+
+    // Binaries are only valid for the driver that produced them
+    const auto getString = [](GLenum name)
+    {
+        const GLubyte* string = nullptr;
+        glCheck(string = glGetString(name));
+        return string ? std::string_view(reinterpret_cast<const char*>(string)) : std::string_view();
+    };
+
+    std::uint64_t hash = 14695981039346656037u;
+    for (const std::string_view part : {getString(GL_VENDOR), getString(GL_RENDERER), getString(GL_VERSION)})
+        hash = hashString(std::string_view("\0", 1), hashString(part, hash));
+
+    // Mark the presence of every stage, so that moving code from one stage to another changes the key
+    for (const std::string_view code : {vertexShaderCode, geometryShaderCode, fragmentShaderCode})
+        hash = hashString(code, hashString(code.data() ? "+" : "-", hash));
+
+    std::ostringstream filename;
+    filename << std::hex << std::setfill('0') << std::setw(16) << hash << ".bin";
+    return directory / filename.str();
+}
+
+// Magic number at the beginning of the program binary cache files
+constexpr std::uint32_t binaryCacheMagic = 0x53465042;
+
+// Create a program from a cached binary, returns 0 if there's no usable binary
+GLEXT_GLhandle loadProgramBinary(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios_base::binary);
+    if (!file)
+        return {};
+
+    std::uint32_t magic  = 0;
+    GLenum        format = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!file.eof() || magic != binaryCacheMagic || binary.empty())
+        return {};
+
+    // Giving an unknown format to glProgramBinary is an error, filter it beforehand
+    GLint formatCount = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+    std::vector<GLint> formats(static_cast<std::size_t>(std::max(formatCount, 0)));
+    if (!formats.empty())
+        glCheck(glGetIntegerv(GLEXT_GL_PROGRAM_BINARY_FORMATS, formats.data()));
+    if (std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) == formats.end())
+        return {};
+
+    GLEXT_GLhandle program{};
+    glCheck(program = GLEXT_glCreateProgramObject());
+    glCheck(GLEXT_glProgramBinary(castFromGlHandle(program),
+                                  format,
+                                  binary.data(),
+                                  static_cast<GLsizei>(binary.size())));
+
+    // The driver may reject a binary at any time (e.g. after an update), in which case we compile again
+    GLint success = 0;
+    glCheck(GLEXT_glGetObjectParameteriv(program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        glCheck(GLEXT_glDeleteObject(program));
+        return {};
+    }
+
+    return program;
+}
+
+// Save the binary of a linked program to the cache
+void saveProgramBinary(GLEXT_GLhandle program, const std::filesystem::path& filename)
+{
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            format = 0;
+    glCheck(GLEXT_glGetProgramBinary(castFromGlHandle(program), length, &length, &format, binary.data()));
+    binary.resize(static_cast<std::size_t>(length));
+
+    std::error_code error;
+    std::filesystem::create_directories(filename.parent_path(), error);
+
+    // Write to a temporary file first, so that other processes never read a partial binary
+    std::filesystem::path temporary = filename;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios_base::binary | std::ios_base::trunc);
+        file.write(reinterpret_cast<const char*>(&binaryCacheMagic), sizeof(binaryCacheMagic));
+        file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+        file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+        if (!file)
+        {
+            sf::err() << "Failed to write shader binary cache file\n"
+                      << sf::formatDebugPathInfo(temporary) << std::endl;
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporary, filename, error);
+    if (error)
+    {
+        sf::err() << "Failed to write shader binary cache file\n" << sf::formatDebugPathInfo(filename) << std::endl;
+        std::filesystem::remove(temporary, error);
+    }
+}
 } // namespace
 
 
@@ -182,8 +351,12 @@ struct Shader::UniformBinder
     /// \brief Constructor: set up state before uniform is set
     ///
     ////////////////////////////////////////////////////////////
-    UniformBinder(Shader& shader, const std::string& name) : currentProgram(castToGlHandle(shader.m_shaderProgram))
+    UniformBinder(Shader& shader, const std::string& name)
     {
+        // Uniforms can only be located once the program is linked
+        shader.finishCompilation();
+        currentProgram = castToGlHandle(shader.m_shaderProgram);
+
         if (currentProgram)
         {
             // Enable program object
@@ -219,10 +392,10 @@ struct Shader::UniformBinder
     ////////////////////////////////////////////////////////////
     UniformBinder& operator=(const UniformBinder&) = delete;
 
-    TransientContextLock lock;           //!< Lock to keep context active while uniform is bound
-    GLEXT_GLhandle       savedProgram{}; //!< Handle to the previously active program object
-    GLEXT_GLhandle       currentProgram; //!< Handle to the program object of the modified sf::Shader instance
-    GLint                location{-1};   //!< Uniform location, used by the surrounding sf::Shader code
+    TransientContextLock lock;             //!< Lock to keep context active while uniform is bound
+    GLEXT_GLhandle       savedProgram{};   //!< Handle to the previously active program object
+    GLEXT_GLhandle       currentProgram{}; //!< Handle to the program object of the modified sf::Shader instance
+    GLint                location{-1};     //!< Uniform location, used by the surrounding sf::Shader code
 };
 
 
@@ -231,6 +404,16 @@ Shader::~Shader()
 {
     const TransientContextLock lock;
 
+    // Destroy the shaders of a compilation still running
+    if (m_pendingCompilation)
+    {
+        for (const unsigned int shader : m_pendingCompilation->shaders)
+        {
+            if (shader)
+                glCheck(GLEXT_glDeleteObject(castToGlHandle(shader)));
+        }
+    }
+
     // Destroy effect program
     if (m_shaderProgram)
         glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
@@ -241,7 +424,14 @@ Shader::Shader(Shader&& source) noexcept :
 m_shaderProgram(std::exchange(source.m_shaderProgram, 0U)),
 m_currentTexture(std::exchange(source.m_currentTexture, -1)),
 m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
+m_textureArrays(std::move(source.m_textureArrays)),
+m_uniforms(std::move(source.m_uniforms)),
+m_attributes(std::move(source.m_attributes)),
+m_deferredUniforms(std::move(source.m_deferredUniforms)),
+m_pendingUniforms(std::move(source.m_pendingUniforms)),
+m_uniformBlocks(std::move(source.m_uniformBlocks)),
+m_pendingCompilation(std::exchange(source.m_pendingCompilation, std::nullopt)),
+m_memoryCounter(std::move(source.m_memoryCounter))
 {
 }
 
@@ -255,17 +445,25 @@ Shader& Shader::operator=(Shader&& right) noexcept
     }
     // Explicit scope for RAII
     {
-        // Destroy effect program
+        // Destroy effect program, which may have failed to compile in the background
         const TransientContextLock lock;
-        assert(m_shaderProgram);
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+        finishCompilation();
+        if (m_shaderProgram)
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
     }
 
     // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0U);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
+    m_shaderProgram      = std::exchange(right.m_shaderProgram, 0U);
+    m_currentTexture     = std::exchange(right.m_currentTexture, -1);
+    m_textures           = std::move(right.m_textures);
+    m_textureArrays      = std::move(right.m_textureArrays);
+    m_uniforms           = std::move(right.m_uniforms);
+    m_attributes         = std::move(right.m_attributes);
+    m_deferredUniforms   = std::move(right.m_deferredUniforms);
+    m_pendingUniforms    = std::move(right.m_pendingUniforms);
+    m_uniformBlocks      = std::move(right.m_uniformBlocks);
+    m_pendingCompilation = std::exchange(right.m_pendingCompilation, std::nullopt);
+    m_memoryCounter      = std::move(right.m_memoryCounter);
     return *this;
 }
 
@@ -380,6 +578,37 @@ std::optional<Shader> Shader::loadFromMemory(std::string_view vertexShader,
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::loadFromMemoryAsync(std::string_view shader, Type type)
+{
+    // Start compiling the shader program
+    if (type == Type::Vertex)
+        return compileAsync(shader, {}, {});
+    else if (type == Type::Geometry)
+        return compileAsync({}, shader, {});
+    else
+        return compileAsync({}, {}, shader);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::loadFromMemoryAsync(std::string_view vertexShader, std::string_view fragmentShader)
+{
+    // Start compiling the shader program
+    return compileAsync(vertexShader, {}, fragmentShader);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::loadFromMemoryAsync(std::string_view vertexShader,
+                                                  std::string_view geometryShader,
+                                                  std::string_view fragmentShader)
+{
+    // Start compiling the shader program
+    return compileAsync(vertexShader, geometryShader, fragmentShader);
+}
+
+
 ////////////////////////////////////////////////////////////
 std::optional<Shader> Shader::loadFromStream(InputStream& stream, Type type)
 {
@@ -580,9 +809,11 @@ void Shader::setUniform(const std::string& name, const Glsl::Mat4& matrix)
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Texture& texture)
 {
-    assert(m_shaderProgram);
-
     const TransientContextLock lock;
+    finishCompilation();
+
+    if (!m_shaderProgram)
+        return;
 
     // Find the location of the variable in the shader
     const int location = getUniformLocation(name);
@@ -593,7 +824,7 @@ void Shader::setUniform(const std::string& name, const Texture& texture)
         if (it == m_textures.end())
         {
             // New entry, make sure there are enough texture units
-            if (m_textures.size() + 1 >= getMaxTextureUnits())
+            if (m_textures.size() + m_textureArrays.size() + 1 >= getMaxTextureUnits())
             {
                 err() << "Impossible to use texture " << std::quoted(name)
                       << " for shader: all available texture units are used" << std::endl;
@@ -601,6 +832,7 @@ void Shader::setUniform(const std::string& name, const Texture& texture)
             }
 
             m_textures[location] = &texture;
+            updateMemoryUsage();
         }
         else
         {
@@ -612,11 +844,50 @@ void Shader::setUniform(const std::string& name, const Texture& texture)
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, CurrentTextureType)
+void Shader::setUniform(const std::string& name, const TextureArray& textureArray)
 {
-    assert(m_shaderProgram);
+    const TransientContextLock lock;
+    finishCompilation();
+
+    if (!m_shaderProgram)
+        return;
+
+    // Find the location of the variable in the shader
+    const int location = getUniformLocation(name);
+    if (location != -1)
+    {
+        // Store the location -> texture array mapping
+        const auto it = m_textureArrays.find(location);
+        if (it == m_textureArrays.end())
+        {
+            // New entry, make sure there are enough texture units
+            if (m_textures.size() + m_textureArrays.size() + 1 >= getMaxTextureUnits())
+            {
+                err() << "Impossible to use texture array " << std::quoted(name)
+                      << " for shader: all available texture units are used" << std::endl;
+                return;
+            }
+
+            m_textureArrays[location] = &textureArray;
+            updateMemoryUsage();
+        }
+        else
+        {
+            // Location already used, just replace the texture array
+            it->second = &textureArray;
+        }
+    }
+}
+
 
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, CurrentTextureType)
+{
     const TransientContextLock lock;
+    finishCompilation();
+
+    if (!m_shaderProgram)
+        return;
 
     // Find the location of the variable in the shader
     m_currentTexture = getUniformLocation(name);
@@ -695,13 +966,256 @@ void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixAr
 }
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(const std::string& name)
+{
+    const TransientContextLock lock;
+    finishCompilation();
+
+    if (!m_shaderProgram)
+        return {};
+
+    const int location = getUniformLocation(name);
+    if (location == -1)
+        return {};
+
+    // Reuse the slot of the uniform if a handle was already requested for it
+    const auto it = std::find_if(m_deferredUniforms.begin(),
+                                 m_deferredUniforms.end(),
+                                 [location](const DeferredUniform& uniform) { return uniform.location == location; });
+    if (it != m_deferredUniforms.end())
+        return UniformHandle(static_cast<std::size_t>(it - m_deferredUniforms.begin()));
+
+    m_deferredUniforms.emplace_back().location = location;
+    updateMemoryUsage();
+    return UniformHandle(m_deferredUniforms.size() - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, float x)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type      = DeferredType::Float;
+        uniform->floats[0] = x;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec2& v)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type   = DeferredType::Vec2;
+        uniform->floats = {v.x, v.y};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec3& v)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type   = DeferredType::Vec3;
+        uniform->floats = {v.x, v.y, v.z};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec4& v)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type   = DeferredType::Vec4;
+        uniform->floats = {v.x, v.y, v.z, v.w};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, int x)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type    = DeferredType::Int;
+        uniform->ints[0] = x;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec2& v)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type = DeferredType::Ivec2;
+        uniform->ints = {v.x, v.y};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec3& v)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type = DeferredType::Ivec3;
+        uniform->ints = {v.x, v.y, v.z};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec4& v)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type = DeferredType::Ivec4;
+        uniform->ints = {v.x, v.y, v.z, v.w};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, bool x)
+{
+    setUniform(handle, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec2& v)
+{
+    setUniform(handle, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec3& v)
+{
+    setUniform(handle, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec4& v)
+{
+    setUniform(handle, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat3& matrix)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type = DeferredType::Mat3;
+        std::copy(std::begin(matrix.array), std::end(matrix.array), uniform->floats.begin());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat4& matrix)
+{
+    if (DeferredUniform* uniform = getPendingUniform(handle))
+    {
+        uniform->type = DeferredType::Mat4;
+        std::copy(std::begin(matrix.array), std::end(matrix.array), uniform->floats.begin());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    finishCompilation();
+
+    if (!m_shaderProgram)
+        return false;
+
+    // Make sure that we can use uniform buffers
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Failed to set uniform block: your system doesn't support uniform buffers "
+              << "(you should test UniformBuffer::isAvailable() before trying to use the UniformBuffer class)"
+              << std::endl;
+        return false;
+    }
+
+    const TransientContextLock lock;
+
+    // Find the index of the block in the shader
+    GLuint index = GLEXT_GL_INVALID_INDEX;
+    glCheck(index = GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (index == GLEXT_GL_INVALID_INDEX)
+    {
+        err(LogSeverity::Warning) << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+        return false;
+    }
+
+    // Keep the binding point of the block if a buffer was already attached to it
+    const auto it = std::find_if(m_uniformBlocks.begin(),
+                                 m_uniformBlocks.end(),
+                                 [index](const UniformBlock& block) { return block.index == index; });
+    if (it != m_uniformBlocks.end())
+    {
+        it->buffer = &buffer;
+        return true;
+    }
+
+    // New entry, make sure there are enough binding points
+    if (m_uniformBlocks.size() >= getMaxUniformBufferBindings())
+    {
+        err() << "Impossible to use uniform block " << std::quoted(name)
+              << " for shader: all available binding points are used" << std::endl;
+        return false;
+    }
+
+    // The binding point of the block is its position in the table
+    glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, index, static_cast<GLuint>(m_uniformBlocks.size())));
+    m_uniformBlocks.push_back({index, &buffer});
+    updateMemoryUsage();
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
+    finishCompilation();
+
     return m_shaderProgram;
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::isReady() const
+{
+    if (!m_pendingCompilation)
+        return true;
+
+    // Without parallel compilation, querying the status of the program is all we can do
+    if (isParallelCompilationAvailable())
+    {
+        const TransientContextLock lock;
+
+        GLint completed = GL_FALSE;
+        glCheck(GLEXT_glGetObjectParameteriv(castToGlHandle(m_shaderProgram), GLEXT_GL_COMPLETION_STATUS, &completed));
+        if (completed == GL_FALSE)
+            return false;
+    }
+
+    finishCompilation();
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::bind(const Shader* shader)
 {
@@ -715,6 +1229,9 @@ void Shader::bind(const Shader* shader)
         return;
     }
 
+    if (shader)
+        shader->finishCompilation();
+
     if (shader && shader->m_shaderProgram)
     {
         // Enable the program
@@ -726,6 +1243,10 @@ void Shader::bind(const Shader* shader)
         // Bind the current texture
         if (shader->m_currentTexture != -1)
             glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
+
+        // Upload the values set through handles and bind the uniform buffers
+        shader->uploadDeferredUniforms();
+        shader->bindUniformBlocks();
     }
     else
     {
@@ -771,7 +1292,22 @@ bool Shader::isGeometryAvailable()
 
 
 ////////////////////////////////////////////////////////////
-Shader::Shader(unsigned int shaderProgram) : m_shaderProgram(shaderProgram)
+bool Shader::isParallelCompilationAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        return isAvailable() && (Context::isExtensionAvailable("GL_KHR_parallel_shader_compile") ||
+                                 Context::isExtensionAvailable("GL_ARB_parallel_shader_compile"));
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(unsigned int shaderProgram) : m_shaderProgram(shaderProgram)
 {
 }
 
@@ -799,6 +1335,19 @@ std::optional<Shader> Shader::compile(std::string_view vertexShaderCode,
         return std::nullopt;
     }
 
+    // Reuse the program linked in a previous run if possible
+    const std::filesystem::path cacheFilename = getBinaryCacheFilename(vertexShaderCode,
+                                                                       geometryShaderCode,
+                                                                       fragmentShaderCode);
+    if (!cacheFilename.empty())
+    {
+        if (const GLEXT_GLhandle cachedProgram = loadProgramBinary(cacheFilename))
+        {
+            glCheck(glFlush());
+            return Shader(castFromGlHandle(cachedProgram));
+        }
+    }
+
     // Create the program
     GLEXT_GLhandle shaderProgram{};
     glCheck(shaderProgram = GLEXT_glCreateProgramObject());
@@ -889,6 +1438,12 @@ std::optional<Shader> Shader::compile(std::string_view vertexShaderCode,
         glCheck(GLEXT_glDeleteObject(fragmentShader));
     }
 
+    // Ask the driver to keep the binary around if we are going to save it
+    if (!cacheFilename.empty())
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -904,6 +1459,9 @@ std::optional<Shader> Shader::compile(std::string_view vertexShaderCode,
         return std::nullopt;
     }
 
+    if (!cacheFilename.empty())
+        saveProgramBinary(shaderProgram, cacheFilename);
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
@@ -912,6 +1470,143 @@ std::optional<Shader> Shader::compile(std::string_view vertexShaderCode,
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::compileAsync(std::string_view vertexShaderCode,
+                                           std::string_view geometryShaderCode,
+                                           std::string_view fragmentShaderCode)
+{
+    const TransientContextLock lock;
+
+    // First make sure that we can use shaders
+    if (!isAvailable())
+    {
+        err() << "Failed to create a shader: your system doesn't support shaders "
+              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
+        return std::nullopt;
+    }
+
+    // Make sure we can use geometry shaders
+    if (geometryShaderCode.data() && !isGeometryAvailable())
+    {
+        err() << "Failed to create a shader: your system doesn't support geometry shaders "
+              << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)" << std::endl;
+        return std::nullopt;
+    }
+
+    // A cached program is ready right away
+    PendingCompilation pending;
+    pending.cacheFilename = getBinaryCacheFilename(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    if (!pending.cacheFilename.empty())
+    {
+        if (const GLEXT_GLhandle cachedProgram = loadProgramBinary(pending.cacheFilename))
+        {
+            glCheck(glFlush());
+            return Shader(castFromGlHandle(cachedProgram));
+        }
+    }
+
+    // Create the program
+    GLEXT_GLhandle shaderProgram{};
+    glCheck(shaderProgram = GLEXT_glCreateProgramObject());
+
+    // Issue the compilation of all the stages, their status is checked later by finishCompilation
+    const std::array<std::pair<std::string_view, GLenum>, 3> stages{{{vertexShaderCode, GLEXT_GL_VERTEX_SHADER},
+                                                                     {geometryShaderCode, GLEXT_GL_GEOMETRY_SHADER},
+                                                                     {fragmentShaderCode, GLEXT_GL_FRAGMENT_SHADER}}};
+    for (std::size_t i = 0; i < stages.size(); ++i)
+    {
+        const auto [code, type] = stages[i];
+        if (!code.data())
+            continue;
+
+        GLEXT_GLhandle shader{};
+        glCheck(shader = GLEXT_glCreateShaderObject(type));
+        const GLcharARB* sourceCode       = code.data();
+        const auto       sourceCodeLength = static_cast<GLint>(code.length());
+        glCheck(GLEXT_glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
+        glCheck(GLEXT_glCompileShader(shader));
+        glCheck(GLEXT_glAttachObject(shaderProgram, shader));
+        pending.shaders[i] = castFromGlHandle(shader);
+    }
+
+    // Ask the driver to keep the binary around if we are going to save it
+    if (!pending.cacheFilename.empty())
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
+
+    // Linking a program whose shaders failed to compile just fails, which finishCompilation reports
+    glCheck(GLEXT_glLinkProgram(shaderProgram));
+
+    // Submit the commands right away, so that the driver starts working on them
+    glCheck(glFlush());
+
+    auto shader = std::make_optional(Shader(castFromGlHandle(shaderProgram)));
+    shader->m_pendingCompilation = std::move(pending);
+    return shader;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::finishCompilation() const
+{
+    if (!m_pendingCompilation)
+        return;
+
+    const TransientContextLock lock;
+
+    const PendingCompilation pending = std::move(*m_pendingCompilation);
+    m_pendingCompilation.reset();
+
+    // Report the first stage that failed to compile, the shaders are not needed anymore either way
+    static constexpr std::array<const char*, 3> stageNames{"vertex", "geometry", "fragment"};
+    bool                                         success = true;
+    for (std::size_t i = 0; i < pending.shaders.size(); ++i)
+    {
+        const GLEXT_GLhandle shader = castToGlHandle(pending.shaders[i]);
+        if (!shader)
+            continue;
+
+        GLint compiled = GL_FALSE;
+        glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &compiled));
+        if (success && (compiled == GL_FALSE))
+        {
+            char log[1024];
+            glCheck(GLEXT_glGetInfoLog(shader, sizeof(log), nullptr, log));
+            err() << "Failed to compile " << stageNames[i] << " shader:" << '\n' << log << std::endl;
+            success = false;
+        }
+
+        glCheck(GLEXT_glDeleteObject(shader));
+    }
+
+    // Check the link log
+    const GLEXT_GLhandle shaderProgram = castToGlHandle(m_shaderProgram);
+    if (success)
+    {
+        GLint linked = GL_FALSE;
+        glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &linked));
+        if (linked == GL_FALSE)
+        {
+            char log[1024];
+            glCheck(GLEXT_glGetInfoLog(shaderProgram, sizeof(log), nullptr, log));
+            err() << "Failed to link shader:" << '\n' << log << std::endl;
+            success = false;
+        }
+    }
+
+    if (!success)
+    {
+        glCheck(GLEXT_glDeleteObject(shaderProgram));
+        m_shaderProgram = 0;
+        return;
+    }
+
+    if (!pending.cacheFilename.empty())
+        saveProgramBinary(shaderProgram, pending.cacheFilename);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::bindTextures() const
 {
@@ -925,6 +1620,17 @@ void Shader::bindTextures() const
         ++it;
     }
 
+    // Texture arrays use the units following the ones of the textures
+    auto arrayIt = m_textureArrays.begin();
+    for (std::size_t i = 0; i < m_textureArrays.size(); ++i)
+    {
+        const auto index = static_cast<GLsizei>(m_textures.size() + i + 1);
+        glCheck(GLEXT_glUniform1i(arrayIt->first, index));
+        glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0 + static_cast<GLenum>(index)));
+        TextureArray::bind(arrayIt->second);
+        ++arrayIt;
+    }
+
     // Make sure that the texture unit which is left active is the number 0
     glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
 }
@@ -944,14 +1650,132 @@ int Shader::getUniformLocation(const std::string& name)
         // Not in cache, request the location from OpenGL
         const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), name.c_str());
         m_uniforms.emplace(name, location);
+        updateMemoryUsage();
 
         if (location == -1)
-            err() << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
+            err(LogSeverity::Warning) << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
 
         return location;
     }
 }
 
+
+////////////////////////////////////////////////////////////
+int Shader::getAttributeLocation(const std::string& name) const
+{
+    if (const auto it = m_attributes.find(name); it != m_attributes.end())
+        return it->second;
+
+    // Attributes that the shader doesn't declare are silently ignored, a layout may serve several shaders
+    int location = -1;
+    glCheck(location = GLEXT_glGetAttribLocation(castToGlHandle(m_shaderProgram), name.c_str()));
+    m_attributes.emplace(name, location);
+    updateMemoryUsage();
+
+    return location;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::DeferredUniform* Shader::getPendingUniform(UniformHandle handle)
+{
+    if (!handle.isValid())
+        return nullptr;
+
+    assert(handle.m_slot < m_deferredUniforms.size() && "Uniform handle doesn't belong to this shader");
+
+    DeferredUniform& uniform = m_deferredUniforms[handle.m_slot];
+    if (!uniform.pending)
+    {
+        uniform.pending = true;
+        m_pendingUniforms.push_back(handle.m_slot);
+    }
+
+    return &uniform;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadDeferredUniforms() const
+{
+    for (const std::size_t slot : m_pendingUniforms)
+    {
+        DeferredUniform& uniform = m_deferredUniforms[slot];
+        const auto&      f       = uniform.floats;
+        const auto&      i       = uniform.ints;
+
+        switch (uniform.type)
+        {
+            case DeferredType::Float:
+                glCheck(GLEXT_glUniform1f(uniform.location, f[0]));
+                break;
+            case DeferredType::Vec2:
+                glCheck(GLEXT_glUniform2f(uniform.location, f[0], f[1]));
+                break;
+            case DeferredType::Vec3:
+                glCheck(GLEXT_glUniform3f(uniform.location, f[0], f[1], f[2]));
+                break;
+            case DeferredType::Vec4:
+                glCheck(GLEXT_glUniform4f(uniform.location, f[0], f[1], f[2], f[3]));
+                break;
+            case DeferredType::Int:
+                glCheck(GLEXT_glUniform1i(uniform.location, i[0]));
+                break;
+            case DeferredType::Ivec2:
+                glCheck(GLEXT_glUniform2i(uniform.location, i[0], i[1]));
+                break;
+            case DeferredType::Ivec3:
+                glCheck(GLEXT_glUniform3i(uniform.location, i[0], i[1], i[2]));
+                break;
+            case DeferredType::Ivec4:
+                glCheck(GLEXT_glUniform4i(uniform.location, i[0], i[1], i[2], i[3]));
+                break;
+            case DeferredType::Mat3:
+                glCheck(GLEXT_glUniformMatrix3fv(uniform.location, 1, GL_FALSE, f.data()));
+                break;
+            case DeferredType::Mat4:
+                glCheck(GLEXT_glUniformMatrix4fv(uniform.location, 1, GL_FALSE, f.data()));
+                break;
+        }
+
+        uniform.pending = false;
+    }
+
+    m_pendingUniforms.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    for (std::size_t i = 0; i < m_uniformBlocks.size(); ++i)
+    {
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER,
+                                       static_cast<GLuint>(i),
+                                       m_uniformBlocks[i].buffer->getNativeHandle()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::updateMemoryUsage() const
+{
+    // The names of the uniforms are counted too, the rest only depends on the number of entries
+    std::uint64_t bytes = m_textures.size() * sizeof(TextureTable::value_type) +
+                          m_textureArrays.size() * sizeof(TextureArrayTable::value_type) +
+                          m_deferredUniforms.capacity() * sizeof(DeferredUniform) +
+                          m_pendingUniforms.capacity() * sizeof(std::size_t) +
+                          m_uniformBlocks.capacity() * sizeof(UniformBlock);
+
+    for (const auto& entry : m_uniforms)
+        bytes += sizeof(UniformTable::value_type) + entry.first.size();
+
+    for (const auto& entry : m_attributes)
+        bytes += sizeof(UniformTable::value_type) + entry.first.size();
+
+    m_memoryCounter.setBytes(bytes);
+}
+
 } // namespace sf
 
 #else // SFML_OPENGL_ES
@@ -1042,6 +1866,30 @@ std::optional<Shader> Shader::loadFromStream(InputStream& /* vertexShaderStream
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::loadFromMemoryAsync(std::string_view /* shader */, Type /* type */)
+{
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::loadFromMemoryAsync(std::string_view /* vertexShader */,
+                                                  std::string_view /* fragmentShader */)
+{
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader> Shader::loadFromMemoryAsync(std::string_view /* vertexShader */,
+                                                  std::string_view /* geometryShader */,
+                                                  std::string_view /* fragmentShader */)
+{
+    return std::nullopt;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& /* name */, float)
 {
@@ -1132,6 +1980,12 @@ void Shader::setUniform(const std::string& /* name */, const Texture& /* texture
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& /* name */, const TextureArray& /* textureArray */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& /* name */, CurrentTextureType)
 {
@@ -1174,6 +2028,104 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(const std::string& /* name */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, float /* x */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec2& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec3& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec4& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, int /* x */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec2& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec3& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec4& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, bool /* x */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec2& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec3& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec4& /* vector */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1181,6 +2133,13 @@ unsigned int Shader::getNativeHandle() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::isReady() const
+{
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::bind(const Shader* /* shader */)
 {
@@ -1201,6 +2160,13 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::isParallelCompilationAvailable()
+{
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 Shader::Shader(unsigned int shaderProgram) : m_shaderProgram(shaderProgram)
 {
@@ -1221,6 +2187,46 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+int Shader::getAttributeLocation(const std::string& /* name */) const
+{
+    return -1;
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& directory)
+{
+    const std::lock_guard lock(binaryCacheMutex);
+    binaryCacheDirectory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    const std::lock_guard lock(binaryCacheMutex);
+    return binaryCacheDirectory;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::UniformHandle::isValid() const
+{
+    return m_slot != invalidSlot;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle::UniformHandle(std::size_t slot) : m_slot(slot)
+{
+}
+
+} // namespace sf
@@ -75,8 +75,8 @@ const Texture* Shape::getTexture() const
 ////////////////////////////////////////////////////////////
 void Shape::setTextureRect(const IntRect& rect)
 {
-    m_textureRect = rect;
-    updateTexCoords();
+    m_textureRect         = rect;
+    m_texCoordsNeedUpdate = true;
 }
 
 
@@ -90,8 +90,8 @@ const IntRect& Shape::getTextureRect() const
 ////////////////////////////////////////////////////////////
 void Shape::setFillColor(const Color& color)
 {
-    m_fillColor = color;
-    updateFillColors();
+    m_fillColor            = color;
+    m_fillColorsNeedUpdate = true;
 }
 
 
@@ -105,8 +105,8 @@ const Color& Shape::getFillColor() const
 ////////////////////////////////////////////////////////////
 void Shape::setOutlineColor(const Color& color)
 {
-    m_outlineColor = color;
-    updateOutlineColors();
+    m_outlineColor            = color;
+    m_outlineColorsNeedUpdate = true;
 }
 
 
@@ -120,8 +120,9 @@ const Color& Shape::getOutlineColor() const
 ////////////////////////////////////////////////////////////
 void Shape::setOutlineThickness(float thickness)
 {
-    m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    // Only the outline depends on the thickness, the fill is unchanged
+    m_outlineThickness  = thickness;
+    m_outlineNeedUpdate = true;
 }
 
 
@@ -132,6 +133,15 @@ float Shape::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shape::getPoints(Vector2f* points) const
+{
+    const std::size_t count = getPointCount();
+    for (std::size_t i = 0; i < count; ++i)
+        points[i] = getPoint(i);
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2f Shape::getGeometricCenter() const
 {
@@ -185,6 +195,7 @@ Vector2f Shape::getGeometricCenter() const
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
+    ensureGeometryUpdate();
     return m_bounds;
 }
 
@@ -199,37 +210,7 @@ FloatRect Shape::getGlobalBounds() const
 ////////////////////////////////////////////////////////////
 void Shape::update()
 {
-    // Get the total number of points of the shape
-    const std::size_t count = getPointCount();
-    if (count < 3)
-    {
-        m_vertices.resize(0);
-        m_outlineVertices.resize(0);
-        return;
-    }
-
-    m_vertices.resize(count + 2); // + 2 for center and repeated first point
-
-    // Position
-    for (std::size_t i = 0; i < count; ++i)
-        m_vertices[i + 1].position = getPoint(i);
-    m_vertices[count + 1].position = m_vertices[1].position;
-
-    // Update the bounding rectangle
-    m_vertices[0]  = m_vertices[1]; // so that the result of getBounds() is correct
-    m_insideBounds = m_vertices.getBounds();
-
-    // Compute the center and make it the first vertex
-    m_vertices[0].position = m_insideBounds.getCenter();
-
-    // Color
-    updateFillColors();
-
-    // Texture coordinates
-    updateTexCoords();
-
-    // Outline
-    updateOutline();
+    m_fillNeedUpdate = true;
 }
 
 
@@ -239,6 +220,11 @@ void Shape::draw(RenderTarget& target, RenderStates states) const
     states.transform *= getTransform();
     states.coordinateType = CoordinateType::Pixels;
 
+    ensureGeometryUpdate();
+
+    if (target.cull(m_bounds, states.transform))
+        return;
+
     // Render the inside
     states.texture = m_texture;
     target.draw(m_vertices, states);
@@ -253,16 +239,81 @@ void Shape::draw(RenderTarget& target, RenderStates states) const
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateFillColors()
+void Shape::ensureGeometryUpdate() const
+{
+    // The outline and the texture coordinates depend on the fill, the colors only on the vertex count
+    if (m_fillNeedUpdate)
+        updateFill();
+
+    if (m_outlineNeedUpdate)
+        updateOutline();
+
+    if (m_fillColorsNeedUpdate)
+        updateFillColors();
+
+    if (m_texCoordsNeedUpdate)
+        updateTexCoords();
+
+    if (m_outlineColorsNeedUpdate)
+        updateOutlineColors();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateFill() const
+{
+    m_fillNeedUpdate      = false;
+    m_texCoordsNeedUpdate = true;
+    m_outlineNeedUpdate   = true;
+
+    // Get the total number of points of the shape
+    const std::size_t count = getPointCount();
+    if (count < 3)
+    {
+        m_vertices.clear();
+        m_insideBounds = {};
+        return;
+    }
+
+    // Fetch all the points at once
+    m_points.resize(count);
+    getPoints(m_points.data());
+
+    if (m_vertices.getVertexCount() != count + 2) // + 2 for center and repeated first point
+    {
+        m_vertices.resize(count + 2);
+        m_fillColorsNeedUpdate = true;
+    }
+
+    // Position
+    for (std::size_t i = 0; i < count; ++i)
+        m_vertices[i + 1].position = m_points[i];
+    m_vertices[count + 1].position = m_vertices[1].position;
+
+    // Update the bounding rectangle
+    m_vertices[0].position = m_vertices[1].position; // so that the result of getBounds() is correct
+    m_insideBounds         = m_vertices.getBounds();
+
+    // Compute the center and make it the first vertex
+    m_vertices[0].position = m_insideBounds.getCenter();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateFillColors() const
 {
+    m_fillColorsNeedUpdate = false;
+
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
         m_vertices[i].color = m_fillColor;
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateTexCoords()
+void Shape::updateTexCoords() const
 {
+    m_texCoordsNeedUpdate = false;
+
     const FloatRect convertedTextureRect(m_textureRect);
 
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
@@ -280,10 +331,12 @@ void Shape::updateTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::updateOutline() const
 {
+    m_outlineNeedUpdate = false;
+
     // Return if there is no outline
-    if (m_outlineThickness == 0.f)
+    if ((m_outlineThickness == 0.f) || (m_vertices.getVertexCount() == 0))
     {
         m_outlineVertices.clear();
         m_bounds = m_insideBounds;
@@ -291,26 +344,35 @@ void Shape::updateOutline()
     }
 
     const std::size_t count = m_vertices.getVertexCount() - 2;
-    m_outlineVertices.resize((count + 1) * 2);
+    if (m_outlineVertices.getVertexCount() != (count + 1) * 2)
+    {
+        m_outlineVertices.resize((count + 1) * 2);
+        m_outlineColorsNeedUpdate = true;
+    }
+
+    const Vector2f center = m_vertices[0].position;
+
+    // Each segment is shared by two consecutive points, so its normal is computed only once
+    Vector2f nextNormal = computeNormal(m_vertices[count].position, m_vertices[1].position);
 
     for (std::size_t i = 0; i < count; ++i)
     {
         const std::size_t index = i + 1;
 
         // Get the two segments shared by the current point
-        const Vector2f p0 = (i == 0) ? m_vertices[count].position : m_vertices[index - 1].position;
         const Vector2f p1 = m_vertices[index].position;
         const Vector2f p2 = m_vertices[index + 1].position;
 
-        // Compute their normal
-        Vector2f n1 = computeNormal(p0, p1);
+        // Get their normal
+        Vector2f n1 = nextNormal;
         Vector2f n2 = computeNormal(p1, p2);
+        nextNormal  = n2;
 
         // Make sure that the normals point towards the outside of the shape
         // (this depends on the order in which the points were defined)
-        if (n1.dot(m_vertices[0].position - p1) > 0)
+        if (n1.dot(center - p1) > 0)
             n1 = -n1;
-        if (n2.dot(m_vertices[0].position - p1) > 0)
+        if (n2.dot(center - p1) > 0)
             n2 = -n2;
 
         // Combine them to get the extrusion direction
@@ -326,17 +388,16 @@ void Shape::updateOutline()
     m_outlineVertices[count * 2 + 0].position = m_outlineVertices[0].position;
     m_outlineVertices[count * 2 + 1].position = m_outlineVertices[1].position;
 
-    // Update outline colors
-    updateOutlineColors();
-
     // Update the shape's bounds
     m_bounds = m_outlineVertices.getBounds();
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineColors()
+void Shape::updateOutlineColors() const
 {
+    m_outlineColorsNeedUpdate = false;
+
     for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
         m_outlineVertices[i].color = m_outlineColor;
 }
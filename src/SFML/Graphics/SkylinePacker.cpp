@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SkylinePacker.hpp>
+
+#include <algorithm>
+#include <limits>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+SkylinePacker::SkylinePacker(const Vector2u& size) : m_size(size)
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Rect<unsigned int>> SkylinePacker::insert(const Vector2u& size)
+{
+    if ((size.x == 0) || (size.y == 0))
+        return Rect<unsigned int>({0, 0}, size);
+
+    // Find the segment where the rectangle's top edge would be the lowest,
+    // preferring narrower segments to keep wide gaps available for wide rectangles
+    std::size_t  bestIndex  = m_skyline.size();
+    unsigned int bestTop    = 0;
+    unsigned int bestBottom = std::numeric_limits<unsigned int>::max();
+    unsigned int bestWidth  = std::numeric_limits<unsigned int>::max();
+
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+        const std::optional<unsigned int> top = fit(i, size);
+        if (!top)
+            continue;
+
+        const unsigned int bottom = *top + size.y;
+        if ((bottom < bestBottom) || ((bottom == bestBottom) && (m_skyline[i].width < bestWidth)))
+        {
+            bestIndex  = i;
+            bestTop    = *top;
+            bestBottom = bottom;
+            bestWidth  = m_skyline[i].width;
+        }
+    }
+
+    if (bestIndex == m_skyline.size())
+        return std::nullopt;
+
+    // Raise the skyline over the new rectangle
+    const Segment segment{m_skyline[bestIndex].x, bestBottom, size.x};
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), segment);
+
+    // Shrink or remove the segments now covered by the new one
+    const unsigned int right = segment.x + segment.width;
+    for (std::size_t i = bestIndex + 1; i < m_skyline.size();)
+    {
+        Segment& next = m_skyline[i];
+        if (next.x >= right)
+            break;
+
+        const unsigned int overlap = right - next.x;
+        if (next.width > overlap)
+        {
+            next.x += overlap;
+            next.width -= overlap;
+            break;
+        }
+
+        m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    // Merge neighboring segments of the same height
+    for (std::size_t i = 1; i < m_skyline.size();)
+    {
+        if (m_skyline[i - 1].y == m_skyline[i].y)
+        {
+            m_skyline[i - 1].width += m_skyline[i].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    m_usedArea += std::uint64_t{size.x} * size.y;
+
+    return Rect<unsigned int>({segment.x, bestTop}, size);
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::grow(const Vector2u& size)
+{
+    if (size.x > m_size.x)
+    {
+        const unsigned int extra = size.x - m_size.x;
+
+        // The new columns are empty, extend the skyline at ground level
+        if (m_skyline.back().y == 0)
+            m_skyline.back().width += extra;
+        else
+            m_skyline.push_back({m_size.x, 0, extra});
+
+        m_size.x = size.x;
+    }
+
+    m_size.y = std::max(m_size.y, size.y);
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::clear()
+{
+    m_skyline.assign(1, {0, 0, m_size.x});
+    m_usedArea = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SkylinePacker::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SkylinePacker::getUsedArea() const
+{
+    return m_usedArea;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<unsigned int> SkylinePacker::fit(std::size_t index, const Vector2u& size) const
+{
+    if (size.x > m_size.x - m_skyline[index].x)
+        return std::nullopt;
+
+    // The rectangle rests on the highest segment it spans
+    unsigned int top       = 0;
+    unsigned int remaining = size.x;
+    for (std::size_t i = index; remaining > 0; ++i)
+    {
+        top = std::max(top, m_skyline[i].y);
+        if (size.y > m_size.y - top)
+            return std::nullopt;
+
+        remaining -= std::min(remaining, m_skyline[i].width);
+    }
+
+    return top;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,348 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SpatialGrid.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpatialGridImpl
+{
+// Items covering more cells than this are not stored in the cells
+constexpr std::uint64_t maxCellsPerItem = 1024;
+
+// Get the number of cells of a range
+std::uint64_t getCellCount(const sf::Vector2i& firstCell, const sf::Vector2i& lastCell)
+{
+    return static_cast<std::uint64_t>(std::int64_t{lastCell.x} - firstCell.x + 1) *
+           static_cast<std::uint64_t>(std::int64_t{lastCell.y} - firstCell.y + 1);
+}
+
+// Pack the coordinates of a cell into the key of the cell map
+std::uint64_t makeKey(const sf::Vector2i& cell)
+{
+    return (std::uint64_t{static_cast<std::uint32_t>(cell.x)} << 32) | static_cast<std::uint32_t>(cell.y);
+}
+
+// Unpack the coordinates of a cell from its key
+sf::Vector2i getCoordinates(std::uint64_t key)
+{
+    return {static_cast<std::int32_t>(static_cast<std::uint32_t>(key >> 32)),
+            static_cast<std::int32_t>(static_cast<std::uint32_t>(key))};
+}
+
+// Get the minimum and maximum corners of a rectangle that may have negative dimensions
+std::pair<sf::Vector2f, sf::Vector2f> getCorners(const sf::FloatRect& rect)
+{
+    const sf::Vector2f position = rect.getPosition();
+    const sf::Vector2f opposite = position + rect.getSize();
+    return {{std::min(position.x, opposite.x), std::min(position.y, opposite.y)},
+            {std::max(position.x, opposite.x), std::max(position.y, opposite.y)}};
+}
+
+// Tell whether a cell is in a range of cells
+bool isInRange(const sf::Vector2i& cell, const sf::Vector2i& firstCell, const sf::Vector2i& lastCell)
+{
+    return (cell.x >= firstCell.x) && (cell.x <= lastCell.x) && (cell.y >= firstCell.y) && (cell.y <= lastCell.y);
+}
+} // namespace SpatialGridImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpatialGrid::SpatialGrid(float cellSize) : m_cellSize(cellSize)
+{
+    assert(cellSize > 0.f && "Cell size must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+SpatialGrid::Handle SpatialGrid::insert(const FloatRect& bounds)
+{
+    Handle handle = m_items.size();
+
+    if (!m_freeHandles.empty())
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+    else
+    {
+        m_items.emplace_back();
+    }
+
+    const auto [min, max] = SpatialGridImpl::getCorners(bounds);
+
+    Item& item     = m_items[handle];
+    item.bounds    = bounds;
+    item.firstCell = getCell(min);
+    item.lastCell  = getCell(max);
+    item.alive     = true;
+
+    link(handle);
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::update(Handle handle, const FloatRect& bounds)
+{
+    assert(handle < m_items.size() && m_items[handle].alive && "Handle doesn't identify an item of the grid");
+
+    Item& item  = m_items[handle];
+    item.bounds = bounds;
+
+    const auto [min, max]    = SpatialGridImpl::getCorners(bounds);
+    const Vector2i firstCell = getCell(min);
+    const Vector2i lastCell  = getCell(max);
+
+    // Most updates keep the item inside the same cells
+    if ((firstCell == item.firstCell) && (lastCell == item.lastCell))
+        return;
+
+    // Large items are not stored in their cells, relink them entirely
+    if (item.large || (SpatialGridImpl::getCellCount(firstCell, lastCell) > SpatialGridImpl::maxCellsPerItem))
+    {
+        unlink(handle);
+        item.firstCell = firstCell;
+        item.lastCell  = lastCell;
+        link(handle);
+        return;
+    }
+
+    // Only touch the cells that the item leaves or enters
+    for (int y = item.firstCell.y; y <= item.lastCell.y; ++y)
+    {
+        for (int x = item.firstCell.x; x <= item.lastCell.x; ++x)
+        {
+            if (!SpatialGridImpl::isInRange({x, y}, firstCell, lastCell))
+                updateCells(handle, {x, y}, {x, y}, false);
+        }
+    }
+
+    for (int y = firstCell.y; y <= lastCell.y; ++y)
+    {
+        for (int x = firstCell.x; x <= lastCell.x; ++x)
+        {
+            if (!SpatialGridImpl::isInRange({x, y}, item.firstCell, item.lastCell))
+                updateCells(handle, {x, y}, {x, y}, true);
+        }
+    }
+
+    item.firstCell = firstCell;
+    item.lastCell  = lastCell;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::remove(Handle handle)
+{
+    assert(handle < m_items.size() && m_items[handle].alive && "Handle doesn't identify an item of the grid");
+
+    unlink(handle);
+    m_items[handle].alive = false;
+
+    m_freeHandles.push_back(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::clear()
+{
+    m_items.clear();
+    m_freeHandles.clear();
+    m_largeItems.clear();
+    m_cells.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+const FloatRect& SpatialGrid::getBounds(Handle handle) const
+{
+    assert(handle < m_items.size() && m_items[handle].alive && "Handle doesn't identify an item of the grid");
+
+    return m_items[handle].bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::getItemCount() const
+{
+    return m_items.size() - m_freeHandles.size();
+}
+
+
+////////////////////////////////////////////////////////////
+float SpatialGrid::getCellSize() const
+{
+    return m_cellSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::query(const FloatRect& area, std::vector<Handle>& result) const
+{
+    // Items overlapping several cells of the area must only be reported once
+    ++m_queryStamp;
+
+    const auto [min, max]    = SpatialGridImpl::getCorners(area);
+    const Vector2i firstCell = getCell(min);
+    const Vector2i lastCell  = getCell(max);
+
+    const auto visit = [&](const std::vector<Handle>& handles)
+    {
+        for (const Handle handle : handles)
+        {
+            const Item& item = m_items[handle];
+            if (item.queryStamp == m_queryStamp)
+                continue;
+
+            item.queryStamp = m_queryStamp;
+
+            // Cells are coarse, check the bounds of the item against the area itself
+            const auto [itemMin, itemMax] = SpatialGridImpl::getCorners(item.bounds);
+            if ((itemMin.x <= max.x) && (itemMax.x >= min.x) && (itemMin.y <= max.y) && (itemMax.y >= min.y))
+                result.push_back(handle);
+        }
+    };
+
+    visit(m_largeItems);
+
+    // When the area covers more cells than are populated, walk the populated cells instead
+    if (SpatialGridImpl::getCellCount(firstCell, lastCell) > m_cells.size())
+    {
+        for (const auto& [key, handles] : m_cells)
+        {
+            if (SpatialGridImpl::isInRange(SpatialGridImpl::getCoordinates(key), firstCell, lastCell))
+                visit(handles);
+        }
+
+        return;
+    }
+
+    for (int y = firstCell.y; y <= lastCell.y; ++y)
+    {
+        for (int x = firstCell.x; x <= lastCell.x; ++x)
+        {
+            if (const auto it = m_cells.find(SpatialGridImpl::makeKey({x, y})); it != m_cells.end())
+                visit(it->second);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::query(const View& view, std::vector<Handle>& result) const
+{
+    query(view.getVisibleArea(), result);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i SpatialGrid::getCell(const Vector2f& point) const
+{
+    // Clamp to keep far away (or infinite) coordinates representable, they end up in the border cells
+    const auto toCell = [this](float coordinate)
+    {
+        constexpr float limit = 1 << 30;
+        return static_cast<int>(std::clamp(std::floor(coordinate / m_cellSize), -limit, limit));
+    };
+
+    return {toCell(point.x), toCell(point.y)};
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::link(Handle handle)
+{
+    Item& item = m_items[handle];
+    item.large = SpatialGridImpl::getCellCount(item.firstCell, item.lastCell) > SpatialGridImpl::maxCellsPerItem;
+
+    if (item.large)
+        m_largeItems.push_back(handle);
+    else
+        updateCells(handle, item.firstCell, item.lastCell, true);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::unlink(Handle handle)
+{
+    const Item& item = m_items[handle];
+
+    if (item.large)
+        m_largeItems.erase(std::find(m_largeItems.begin(), m_largeItems.end(), handle));
+    else
+        updateCells(handle, item.firstCell, item.lastCell, false);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::updateCells(Handle handle, const Vector2i& firstCell, const Vector2i& lastCell, bool add)
+{
+    for (int y = firstCell.y; y <= lastCell.y; ++y)
+    {
+        for (int x = firstCell.x; x <= lastCell.x; ++x)
+        {
+            const std::uint64_t key = SpatialGridImpl::makeKey({x, y});
+
+            if (add)
+            {
+                m_cells[key].push_back(handle);
+                continue;
+            }
+
+            const auto it = m_cells.find(key);
+            assert(it != m_cells.end() && "Item is missing from a cell it overlaps");
+
+            // Order within a cell doesn't matter, swap the handle with the last one to remove it
+            std::vector<Handle>& handles = it->second;
+            const auto           found   = std::find(handles.begin(), handles.end(), handle);
+            assert(found != handles.end() && "Item is missing from a cell it overlaps");
+            *found = handles.back();
+            handles.pop_back();
+
+            // Only populated cells are kept, so that queries of large areas stay cheap
+            if (handles.empty())
+                m_cells.erase(it);
+        }
+    }
+}
+
+} // namespace sf
@@ -29,7 +29,10 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <array>
+
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 
 
@@ -129,8 +132,39 @@ FloatRect Sprite::getGlobalBounds() const
 void Sprite::draw(RenderTarget& target, RenderStates states) const
 {
     states.transform *= getTransform();
+    if (target.cull(getLocalBounds(), states.transform))
+        return;
+
     states.texture        = m_texture;
     states.coordinateType = CoordinateType::Pixels;
+
+    if (!m_texture->isPremultipliedAlpha())
+    {
+        // BlendAlpha is the equivalent of BlendPremultipliedAlpha for a straight texture
+        if (states.blendMode == BlendPremultipliedAlpha)
+            states.blendMode = BlendAlpha;
+    }
+    else
+    {
+        if (states.blendMode == BlendAlpha)
+            states.blendMode = BlendPremultipliedAlpha;
+
+        // The color modulating a premultiplied texture must be premultiplied too
+        const Color color = getColor();
+        if (color.a != 255)
+        {
+            const auto premultiply = [&](std::uint8_t component)
+            { return static_cast<std::uint8_t>((component * color.a + 127) / 255); };
+
+            std::array<Vertex, 4> vertices = m_vertices;
+            for (Vertex& vertex : vertices)
+                vertex.color = Color(premultiply(color.r), premultiply(color.g), premultiply(color.b), color.a);
+
+            target.draw(vertices.data(), vertices.size(), PrimitiveType::TriangleStrip, states);
+            return;
+        }
+    }
+
     target.draw(m_vertices.data(), m_vertices.size(), PrimitiveType::TriangleStrip, states);
 }
 
@@ -0,0 +1,707 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+
+
+namespace
+{
+namespace SpriteBatchImpl
+{
+// Cosine and sine of the opposite of the angle, like in Transformable::getTransform()
+sf::Vector2f computeDirection(sf::Angle angle)
+{
+    const float radians = -angle.asRadians();
+    return {std::cos(radians), std::sin(radians)};
+}
+
+// The layer of a texture array sprite is encoded in its horizontal texture coordinate: the layers are laid
+// side by side with a one pixel gap, so that the coordinates of a layer never reach the next one
+float getLayerStride(const sf::TextureArray& textureArray)
+{
+    return static_cast<float>(textureArray.getSize().x + 1);
+}
+
+// Vertex shader decoding the layer of texture array sprites
+constexpr std::string_view textureArrayVertexShader = R"(
+#version 120
+
+uniform vec2 sf_layerSize;
+
+varying vec3 sf_layerTexCoords;
+
+void main()
+{
+    float stride = sf_layerSize.x + 1.0;
+    float layer  = floor(gl_MultiTexCoord0.x / stride);
+
+    sf_layerTexCoords = vec3((gl_MultiTexCoord0.x - layer * stride) / sf_layerSize.x,
+                             gl_MultiTexCoord0.y / sf_layerSize.y,
+                             layer);
+
+    gl_Position   = gl_ModelViewProjectionMatrix * gl_Vertex;
+    gl_FrontColor = gl_Color;
+}
+)";
+
+// Fragment shader sampling the layer of texture array sprites
+constexpr std::string_view textureArrayFragmentShader = R"(
+#version 120
+#extension GL_EXT_texture_array : require
+
+uniform sampler2DArray sf_layers;
+
+varying vec3 sf_layerTexCoords;
+
+void main()
+{
+    gl_FragColor = gl_Color * texture2DArray(sf_layers, sf_layerTexCoords);
+}
+)";
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch() :
+m_vertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Stream),
+m_indexBuffer(IndexBuffer::Type::UInt32, IndexBuffer::Usage::Static)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Texture& texture)
+{
+    return add(texture, IntRect({0, 0}, Vector2i(texture.getSize())));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Texture& texture, const IntRect& textureRect)
+{
+    m_textures.push_back(&texture);
+    m_textureArrays.push_back(nullptr);
+    m_layers.push_back(0);
+    m_textureRects.push_back(textureRect);
+    m_positions.emplace_back(0.f, 0.f);
+    m_origins.emplace_back(0.f, 0.f);
+    m_scales.emplace_back(1.f, 1.f);
+    m_rotations.push_back(Angle::Zero);
+    m_directions.emplace_back(1.f, 0.f);
+    m_colors.push_back(Color::White);
+    m_parentTransforms.emplace_back();
+
+    m_geometryNeedUpdate = true;
+
+    return m_textures.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Sprite& sprite)
+{
+    const std::size_t index = add(sprite.getTexture(), sprite.getTextureRect());
+
+    m_positions[index]  = sprite.getPosition();
+    m_origins[index]    = sprite.getOrigin();
+    m_scales[index]     = sprite.getScale();
+    m_rotations[index]  = sprite.getRotation();
+    m_directions[index] = SpriteBatchImpl::computeDirection(sprite.getRotation());
+    m_colors[index]     = sprite.getColor();
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const TextureArray& textureArray, unsigned int layer)
+{
+    return add(textureArray, layer, IntRect({0, 0}, Vector2i(textureArray.getSize())));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const TextureArray& textureArray, unsigned int layer, const IntRect& textureRect)
+{
+    // Start from a regular sprite, then replace its texture
+    m_textures.push_back(nullptr);
+    m_textureArrays.push_back(nullptr);
+    m_layers.push_back(0);
+    m_textureRects.push_back(textureRect);
+    m_positions.emplace_back(0.f, 0.f);
+    m_origins.emplace_back(0.f, 0.f);
+    m_scales.emplace_back(1.f, 1.f);
+    m_rotations.push_back(Angle::Zero);
+    m_directions.emplace_back(1.f, 0.f);
+    m_colors.push_back(Color::White);
+    m_parentTransforms.emplace_back();
+
+    const std::size_t index = m_textures.size() - 1;
+    setTextureArray(index, textureArray, layer);
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::remove(std::size_t index)
+{
+    assert(index < m_textures.size() && "Index is out of bounds");
+
+    // Move the last sprite into the gap
+    const std::size_t last = m_textures.size() - 1;
+    m_textures[index]      = m_textures[last];
+    m_textureArrays[index] = m_textureArrays[last];
+    m_layers[index]        = m_layers[last];
+    m_textureRects[index]  = m_textureRects[last];
+    m_positions[index]     = m_positions[last];
+    m_origins[index]       = m_origins[last];
+    m_scales[index]        = m_scales[last];
+    m_rotations[index]     = m_rotations[last];
+    m_directions[index]    = m_directions[last];
+    m_colors[index]        = m_colors[last];
+    m_parentTransforms[index] = m_parentTransforms[last];
+
+    m_textures.pop_back();
+    m_textureArrays.pop_back();
+    m_layers.pop_back();
+    m_textureRects.pop_back();
+    m_positions.pop_back();
+    m_origins.pop_back();
+    m_scales.pop_back();
+    m_rotations.pop_back();
+    m_directions.pop_back();
+    m_colors.pop_back();
+    m_parentTransforms.pop_back();
+
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    m_textures.clear();
+    m_textureArrays.clear();
+    m_layers.clear();
+    m_textureRects.clear();
+    m_positions.clear();
+    m_origins.clear();
+    m_scales.clear();
+    m_rotations.clear();
+    m_directions.clear();
+    m_colors.clear();
+    m_parentTransforms.clear();
+
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::reserve(std::size_t spriteCount)
+{
+    m_textures.reserve(spriteCount);
+    m_textureArrays.reserve(spriteCount);
+    m_layers.reserve(spriteCount);
+    m_textureRects.reserve(spriteCount);
+    m_positions.reserve(spriteCount);
+    m_origins.reserve(spriteCount);
+    m_scales.reserve(spriteCount);
+    m_rotations.reserve(spriteCount);
+    m_directions.reserve(spriteCount);
+    m_colors.reserve(spriteCount);
+    m_parentTransforms.reserve(spriteCount);
+    m_vertices.reserve(spriteCount * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getSpriteCount() const
+{
+    return m_textures.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTexture(std::size_t index, const Texture& texture)
+{
+    assert(index < m_textures.size() && "Index is out of bounds");
+    m_textures[index]      = &texture;
+    m_textureArrays[index] = nullptr;
+    m_layers[index]        = 0;
+    m_geometryNeedUpdate   = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& SpriteBatch::getTexture(std::size_t index) const
+{
+    assert(index < m_textures.size() && "Index is out of bounds");
+    assert(m_textures[index] && "SpriteBatch::getTexture() The sprite displays a texture array");
+    return *m_textures[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTextureArray(std::size_t index, const TextureArray& textureArray, unsigned int layer)
+{
+    assert(index < m_textures.size() && "Index is out of bounds");
+    assert(layer < textureArray.getLayerCount() && "SpriteBatch::setTextureArray() Layer is out of bounds");
+    m_textures[index]      = nullptr;
+    m_textureArrays[index] = &textureArray;
+    m_layers[index]        = layer;
+    m_geometryNeedUpdate   = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const TextureArray* SpriteBatch::getTextureArray(std::size_t index) const
+{
+    assert(index < m_textureArrays.size() && "Index is out of bounds");
+    return m_textureArrays[index];
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SpriteBatch::getLayer(std::size_t index) const
+{
+    assert(index < m_layers.size() && "Index is out of bounds");
+    return m_layers[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTextureRect(std::size_t index, const IntRect& textureRect)
+{
+    assert(index < m_textureRects.size() && "Index is out of bounds");
+    m_textureRects[index] = textureRect;
+    m_geometryNeedUpdate  = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& SpriteBatch::getTextureRect(std::size_t index) const
+{
+    assert(index < m_textureRects.size() && "Index is out of bounds");
+    return m_textureRects[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setPosition(std::size_t index, const Vector2f& position)
+{
+    assert(index < m_positions.size() && "Index is out of bounds");
+    m_positions[index]   = position;
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& SpriteBatch::getPosition(std::size_t index) const
+{
+    assert(index < m_positions.size() && "Index is out of bounds");
+    return m_positions[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setOrigin(std::size_t index, const Vector2f& origin)
+{
+    assert(index < m_origins.size() && "Index is out of bounds");
+    m_origins[index]     = origin;
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& SpriteBatch::getOrigin(std::size_t index) const
+{
+    assert(index < m_origins.size() && "Index is out of bounds");
+    return m_origins[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setScale(std::size_t index, const Vector2f& factors)
+{
+    assert(index < m_scales.size() && "Index is out of bounds");
+    m_scales[index]      = factors;
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& SpriteBatch::getScale(std::size_t index) const
+{
+    assert(index < m_scales.size() && "Index is out of bounds");
+    return m_scales[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setRotation(std::size_t index, Angle angle)
+{
+    assert(index < m_rotations.size() && "Index is out of bounds");
+    m_rotations[index]   = angle.wrapUnsigned();
+    m_directions[index]  = SpriteBatchImpl::computeDirection(m_rotations[index]);
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Angle SpriteBatch::getRotation(std::size_t index) const
+{
+    assert(index < m_rotations.size() && "Index is out of bounds");
+    return m_rotations[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setColor(std::size_t index, const Color& color)
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+    m_colors[index]      = color;
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& SpriteBatch::getColor(std::size_t index) const
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+    return m_colors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setParentTransform(std::size_t index, const Transform& transform)
+{
+    assert(index < m_parentTransforms.size() && "Index is out of bounds");
+    m_parentTransforms[index] = transform;
+    m_geometryNeedUpdate      = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& SpriteBatch::getParentTransform(std::size_t index) const
+{
+    assert(index < m_parentTransforms.size() && "Index is out of bounds");
+    return m_parentTransforms[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setExecutionPolicy(ExecutionPolicy policy)
+{
+    m_executionPolicy = policy;
+}
+
+
+////////////////////////////////////////////////////////////
+ExecutionPolicy SpriteBatch::getExecutionPolicy() const
+{
+    return m_executionPolicy;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_textures.empty())
+        return;
+
+    if (m_geometryNeedUpdate)
+        updateGeometry();
+
+    states.transform *= getTransform();
+    states.coordinateType = CoordinateType::Pixels;
+
+    const bool    useBuffers = updateBuffers();
+    const Shader* userShader = states.shader;
+
+    for (const Group& group : m_groups)
+    {
+        states.texture = group.texture;
+        states.shader  = userShader;
+
+        // Texture arrays are sampled by the shader, the layer is decoded from the texture coordinates
+        if (group.textureArray && !userShader)
+        {
+            // Batched draws read the uniforms when they are flushed, so submit them before the uniforms change
+            target.flush();
+
+            states.shader = getTextureArrayShader(*group.textureArray);
+            if (!states.shader)
+                continue;
+        }
+
+        if (useBuffers)
+        {
+            target.draw(m_vertexBuffer, m_indexBuffer, group.firstSprite * 6, group.spriteCount * 6, states);
+        }
+        else
+        {
+            target.draw(m_triangles.data() + group.firstSprite * 6,
+                        group.spriteCount * 6,
+                        PrimitiveType::Triangles,
+                        states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::updateGeometry() const
+{
+    const std::size_t count = m_textures.size();
+
+    // Group the sprites by texture, in order of first appearance
+    // Consecutive sprites usually share their texture, so remember the last group found
+    std::vector<std::size_t> groupIndices(count);
+    m_groups.clear();
+
+    const auto isInGroup = [this](const Group& group, std::size_t i)
+    { return group.texture == m_textures[i] && group.textureArray == m_textureArrays[i]; };
+
+    std::size_t lastGroup = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (m_groups.empty() || !isInGroup(m_groups[lastGroup], i))
+        {
+            const auto it = std::find_if(m_groups.begin(),
+                                         m_groups.end(),
+                                         [&isInGroup, i](const Group& group) { return isInGroup(group, i); });
+
+            lastGroup = static_cast<std::size_t>(it - m_groups.begin());
+            if (it == m_groups.end())
+                m_groups.push_back({m_textures[i], m_textureArrays[i], 0, 0});
+        }
+
+        groupIndices[i] = lastGroup;
+        ++m_groups[lastGroup].spriteCount;
+    }
+
+    // Each group starts where the previous one ends, the slots are then filled in order
+    std::vector<std::size_t> slots(m_groups.size());
+    std::size_t              first = 0;
+    for (std::size_t g = 0; g < m_groups.size(); ++g)
+    {
+        m_groups[g].firstSprite = first;
+        slots[g]                = first;
+        first += m_groups[g].spriteCount;
+    }
+
+    // Turn the group of each sprite into its place in the vertex array
+    std::vector<std::size_t>& destinations = groupIndices;
+    for (std::size_t& destination : destinations)
+        destination = slots[destination]++;
+
+    m_vertices.resize(count * 4);
+
+    // Each sprite writes its own quad, so ranges of sprites can be computed concurrently
+    const auto computeQuads = [this, &destinations](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const IntRect&  rect      = m_textureRects[i];
+            const Vector2f& position  = m_positions[i];
+            const Vector2f& origin    = m_origins[i];
+            const Vector2f& scale     = m_scales[i];
+            const Vector2f& direction = m_directions[i];
+            const Color     color     = m_colors[i];
+
+            // Same computation as Transformable::getTransform()
+            const float sxc = scale.x * direction.x;
+            const float syc = scale.y * direction.x;
+            const float sxs = scale.x * direction.y;
+            const float sys = scale.y * direction.y;
+            const float tx  = -origin.x * sxc - origin.y * sys + position.x;
+            const float ty  = origin.x * sxs - origin.y * syc + position.y;
+
+            // Combined with the parent transform, then applied to the corners of the sprite
+            const float* parent = m_parentTransforms[i].getMatrix();
+            const float  a      = parent[0] * sxc - parent[4] * sxs;
+            const float  b      = parent[0] * sys + parent[4] * syc;
+            const float  c      = parent[0] * tx + parent[4] * ty + parent[12];
+            const float  d      = parent[1] * sxc - parent[5] * sxs;
+            const float  e      = parent[1] * sys + parent[5] * syc;
+            const float  f      = parent[1] * tx + parent[5] * ty + parent[13];
+
+            const auto width  = static_cast<float>(std::abs(rect.width));
+            const auto height = static_cast<float>(std::abs(rect.height));
+
+            // Texture array sprites are shifted to their layer
+            const float layerOffset = m_textureArrays[i] ? static_cast<float>(m_layers[i]) *
+                                                               SpriteBatchImpl::getLayerStride(*m_textureArrays[i])
+                                                         : 0.f;
+
+            const auto left   = static_cast<float>(rect.left) + layerOffset;
+            const auto top    = static_cast<float>(rect.top);
+            const auto right  = left + static_cast<float>(rect.width);
+            const auto bottom = top + static_cast<float>(rect.height);
+
+            Vertex* quad = m_vertices.data() + destinations[i] * 4;
+
+            quad[0] = {{c, f}, color, {left, top}};
+            quad[1] = {{b * height + c, e * height + f}, color, {left, bottom}};
+            quad[2] = {{a * width + c, d * width + f}, color, {right, top}};
+            quad[3] = {{a * width + b * height + c, d * width + e * height + f}, color, {right, bottom}};
+        }
+    };
+
+    priv::forEachRange(m_executionPolicy, count, 4 * sizeof(Vertex), computeQuads);
+
+    m_geometryNeedUpdate = false;
+    m_buffersNeedUpdate  = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* SpriteBatch::getTextureArrayShader(const TextureArray& textureArray) const
+{
+    if (!m_textureArrayShader)
+    {
+        // Don't try to compile the shader again every frame if it failed once
+        static bool failed = false;
+        if (failed)
+            return nullptr;
+
+        std::optional<Shader> shader;
+        if (Shader::isAvailable() && TextureArray::isAvailable())
+            shader = Shader::loadFromMemory(SpriteBatchImpl::textureArrayVertexShader,
+                                            SpriteBatchImpl::textureArrayFragmentShader);
+
+        if (!shader)
+        {
+            err() << "Failed to create the shader drawing texture arrays, their sprites are not drawn" << std::endl;
+            failed = true;
+            return nullptr;
+        }
+
+        m_textureArrayShader = std::make_shared<Shader>(std::move(*shader));
+    }
+
+    const Vector2u size = textureArray.getSize();
+    m_textureArrayShader->setUniform("sf_layers", textureArray);
+    m_textureArrayShader->setUniform("sf_layerSize", Glsl::Vec2(Vector2f(size)));
+
+    return m_textureArrayShader.get();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpriteBatch::updateBuffers() const
+{
+    if (!m_buffersNeedUpdate)
+        return m_useBuffers;
+
+    m_buffersNeedUpdate = false;
+    m_useBuffers        = uploadBuffers();
+
+    if (m_useBuffers)
+        return true;
+
+    // Fall back to drawing triangles from client-side arrays
+    const std::size_t quadCount = m_textures.size();
+    m_triangles.resize(quadCount * 6);
+    for (std::size_t i = 0; i < quadCount; ++i)
+    {
+        const Vertex* quad      = m_vertices.data() + i * 4;
+        Vertex*       triangles = m_triangles.data() + i * 6;
+        triangles[0]            = quad[0];
+        triangles[1]            = quad[1];
+        triangles[2]            = quad[2];
+        triangles[3]            = quad[2];
+        triangles[4]            = quad[1];
+        triangles[5]            = quad[3];
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpriteBatch::uploadBuffers() const
+{
+    if (!VertexBuffer::isAvailable() || !IndexBuffer::isAvailable())
+        return false;
+
+    // The indices only depend on the number of quads, grow them geometrically
+    const std::size_t quadCount = m_textures.size();
+    if (m_indexBuffer.getIndexCount() < quadCount * 6)
+    {
+        std::size_t capacity = std::max<std::size_t>(m_indexBuffer.getIndexCount() / 6, 64);
+        while (capacity < quadCount)
+            capacity *= 2;
+
+        std::vector<std::uint32_t> indices(capacity * 6);
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            const auto vertex  = static_cast<std::uint32_t>(i * 4);
+            indices[i * 6 + 0] = vertex + 0;
+            indices[i * 6 + 1] = vertex + 1;
+            indices[i * 6 + 2] = vertex + 2;
+            indices[i * 6 + 3] = vertex + 2;
+            indices[i * 6 + 4] = vertex + 1;
+            indices[i * 6 + 5] = vertex + 3;
+        }
+
+        if (!m_indexBuffer.create(indices.size()) || !m_indexBuffer.update(indices.data(), indices.size()))
+            return false;
+    }
+
+    // Filling the whole buffer orphans its previous storage instead of waiting for the GPU
+    if (!m_vertexBuffer.getNativeHandle() && !m_vertexBuffer.create(m_vertices.size()))
+        return false;
+
+    return m_vertexBuffer.update(m_vertices.data(), m_vertices.size(), 0);
+}
+
+} // namespace sf
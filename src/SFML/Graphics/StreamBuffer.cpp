@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/StreamBuffer.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace StreamBufferImpl
+{
+// Mutex to protect the context-StreamBuffer map
+std::mutex& getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Map to find the stream buffer owned by a given context
+using ContextStreamBufferMap = std::unordered_map<std::uint64_t, std::weak_ptr<sf::priv::StreamBuffer>>;
+ContextStreamBufferMap& getContextStreamBufferMap()
+{
+    static ContextStreamBufferMap contextStreamBufferMap;
+    return contextStreamBufferMap;
+}
+
+// Gives access to the registration of objects tied to the lifetime of a context
+struct UnsharedObjectRegistry : sf::GlResource
+{
+    static void add(std::shared_ptr<void> object)
+    {
+        registerUnsharedGlObject(std::move(object));
+    }
+};
+} // namespace StreamBufferImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+StreamBuffer::StreamBuffer()
+{
+    glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create stream buffer, generation failed" << std::endl;
+        return;
+    }
+
+    // Each region of a persistently mapped buffer gets an equal share of the storage
+    m_capacity = regionSize * regionCount;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Prefer an immutable, persistently mapped storage if it is supported
+    if (GLEXT_buffer_storage && GLEXT_map_buffer_range && GLEXT_sync)
+    {
+        const GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_PERSISTENT_BIT | GLEXT_GL_MAP_COHERENT_BIT;
+
+        glCheck(GLEXT_glBufferStorage(GLEXT_GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_capacity), nullptr, flags));
+        glCheck(m_mapping = static_cast<std::byte*>(
+                    GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(m_capacity), flags)));
+
+        // The storage is immutable, so we have to start over with a new buffer if mapping failed
+        if (!m_mapping)
+        {
+            glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+            glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+        }
+    }
+
+    if (!m_mapping)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(m_capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+StreamBuffer::~StreamBuffer()
+{
+    // Stream buffers are only destroyed along with their context, which is active at this point
+    for (const GLEXT_GLsync fence : m_fences)
+    {
+        if (fence)
+            glCheck(GLEXT_glDeleteSync(fence));
+    }
+
+    if (m_buffer)
+    {
+        // Deleting the buffer implicitly unmaps it
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+
+    if (m_overflowBuffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_overflowBuffer));
+}
+
+
+////////////////////////////////////////////////////////////
+StreamBuffer* StreamBuffer::getCurrent()
+{
+    if (!VertexBuffer::isAvailable())
+        return nullptr;
+
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    if (!contextId)
+        return nullptr;
+
+    // A context is only active on one thread at a time and its stream buffer lives as long as
+    // the context, so each thread remembers the one it used last and finds it without locking
+    thread_local std::pair<std::uint64_t, StreamBuffer*> lastStreamBuffer;
+    if (lastStreamBuffer.first == contextId)
+        return lastStreamBuffer.second;
+
+    const std::lock_guard lock(StreamBufferImpl::getMutex());
+
+    auto& contextStreamBufferMap = StreamBufferImpl::getContextStreamBufferMap();
+
+    if (const auto it = contextStreamBufferMap.find(contextId); it != contextStreamBufferMap.end())
+    {
+        if (const auto streamBuffer = it->second.lock())
+        {
+            lastStreamBuffer = {contextId, streamBuffer.get()};
+            return lastStreamBuffer.second;
+        }
+    }
+
+    // Forget about the stream buffers of contexts that have been destroyed
+    for (auto it = contextStreamBufferMap.begin(); it != contextStreamBufferMap.end();)
+    {
+        if (it->second.expired())
+            it = contextStreamBufferMap.erase(it);
+        else
+            ++it;
+    }
+
+    auto streamBuffer = std::make_shared<StreamBuffer>();
+
+    if (!streamBuffer->m_buffer)
+        return nullptr;
+
+    auto* const result = streamBuffer.get();
+    contextStreamBufferMap.emplace(contextId, streamBuffer);
+
+    // Register the buffer with the current context so it is automatically destroyed
+    StreamBufferImpl::UnsharedObjectRegistry::add(std::move(streamBuffer));
+
+    lastStreamBuffer = {contextId, result};
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> StreamBuffer::write(const void* data, std::size_t size)
+{
+    if (!m_buffer || !data || !size)
+        return std::nullopt;
+
+    // Data can't be split across regions, it goes to a separate buffer instead
+    if (m_mapping && (size > regionSize))
+        return writeOverflow(data, size);
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    if (m_mapping)
+    {
+        // Data reaching past the end of the current region goes to the start of the next one,
+        // which also happens when the previous data ended exactly at the end of the region
+        if (m_offset + size > (m_region + 1) * regionSize)
+            advanceRegion();
+
+        std::memcpy(m_mapping + m_offset, data, size);
+    }
+    else
+    {
+        // Data larger than the buffer requires growing the storage,
+        // moving to the end forces it to be reallocated right below
+        if (size > m_capacity)
+        {
+            m_capacity = size;
+            m_offset   = m_capacity;
+        }
+
+        // Orphan the storage when it is full, this lets the driver hand us
+        // fresh memory instead of waiting for pending draws to complete
+        if (m_offset + size > m_capacity)
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                       static_cast<GLsizeiptrARB>(m_capacity),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_DRAW));
+            m_offset = 0;
+        }
+
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(m_offset),
+                                      static_cast<GLsizeiptrARB>(size),
+                                      data));
+    }
+
+    const std::size_t offset = m_offset;
+    m_offset += size;
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> StreamBuffer::writeOverflow(const void* data, std::size_t size)
+{
+    if (!m_overflowBuffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &m_overflowBuffer));
+
+        // Nothing is bound, so that the client-side arrays the caller falls back to aren't read from a buffer
+        if (!m_overflowBuffer)
+            return std::nullopt;
+    }
+
+    // Each write orphans the storage, this lets the driver hand us
+    // fresh memory instead of waiting for pending draws to complete
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_overflowBuffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER, static_cast<GLsizeiptrARB>(size), data, GLEXT_GL_STREAM_DRAW));
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamBuffer::advanceRegion()
+{
+    const std::size_t nextRegion  = (m_region + 1) % regionCount;
+    GLEXT_GLsync&     currentSync = m_fences[m_region];
+    GLEXT_GLsync&     nextSync    = m_fences[nextRegion];
+
+    // Fence the commands that read from the region we are leaving
+    if (currentSync)
+        glCheck(GLEXT_glDeleteSync(currentSync));
+
+    glCheck(currentSync = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    // Wait until the GPU is done reading from the region we are entering
+    if (nextSync)
+    {
+        GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+
+        while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+            glCheck(result = GLEXT_glClientWaitSync(nextSync, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1000000));
+
+        glCheck(GLEXT_glDeleteSync(nextSync));
+        nextSync = nullptr;
+    }
+
+    m_region = nextRegion;
+    m_offset = nextRegion * regionSize;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <array>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring buffer used to stream immediate-mode vertex data to the GPU
+///
+/// Every context owns its own stream buffer, which is created
+/// the first time it is requested and destroyed along with
+/// the context.
+///
+/// When ARB_buffer_storage is available, the buffer is
+/// persistently mapped and split into regions which are
+/// guarded by fences. Data larger than a region is written
+/// to a separate buffer, orphaned for every write. Otherwise
+/// the buffer storage is orphaned with glBufferData whenever
+/// it wraps around.
+///
+////////////////////////////////////////////////////////////
+class StreamBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    // Member constants
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t regionSize = 1024 * 1024; //!< Size of a region of a mapped buffer, in bytes
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The buffer is created in the currently active context.
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~StreamBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamBuffer(const StreamBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the stream buffer of the currently active context
+    ///
+    /// \return Pointer to the stream buffer, or a null pointer
+    ///         if vertex buffer objects are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    static StreamBuffer* getCurrent();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy data into the buffer
+    ///
+    /// The buffer holding the data is left bound to
+    /// GL_ARRAY_BUFFER so that vertex pointers can be set up
+    /// relative to the returned offset. No buffer is bound
+    /// when the data could not be streamed.
+    ///
+    /// \param data Pointer to the data to copy
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return Offset of the data within the buffer, in bytes,
+    ///         or an empty optional if the data could not be streamed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> write(const void* data, std::size_t size);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy data larger than a region of a persistently mapped buffer
+    ///
+    /// \param data Pointer to the data to copy
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return Offset of the data within the overflow buffer, in bytes,
+    ///         or an empty optional if the data could not be streamed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> writeOverflow(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move to the start of the next region of a persistently mapped buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void advanceRegion();
+
+    ////////////////////////////////////////////////////////////
+    // Member constants
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t regionCount = 3; //!< Number of fenced regions of a persistently mapped buffer
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GLuint                                m_buffer{};         //!< OpenGL identifier of the buffer
+    std::size_t                           m_capacity{};       //!< Size of the buffer storage, in bytes
+    std::size_t                           m_offset{};         //!< Offset at which the next data will be written
+    std::size_t                           m_region{};         //!< Region of the persistent mapping being written
+    std::byte*                            m_mapping{};        //!< Persistent mapping of the buffer storage, if any
+    std::array<GLEXT_GLsync, regionCount> m_fences{};         //!< Fences guarding each region of the persistent mapping
+    GLuint                                m_overflowBuffer{}; //!< Buffer receiving data larger than a region
+};
+
+} // namespace sf::priv
@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Glsl.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/StreamingTexture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
+
+#include <array>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+#include <cassert>
+#include <cstring>
+
+
+namespace
+{
+namespace StreamingTextureImpl
+{
+// Fragment shader converting the planes to RGB, the samples are packed 4 per texel
+// and fetched without filtering, the texture coordinates are the pixel coordinates
+constexpr std::string_view conversionShaderSource = R"(
+uniform sampler2D luma;
+uniform sampler2D chromaU;
+uniform sampler2D chromaV;
+uniform vec2      lumaSize;
+uniform vec2      chromaSize;
+uniform bool      interleaved;
+uniform mat3      yuvToRgb;
+uniform vec3      offset;
+
+float fetch(sampler2D plane, vec2 size, float index, float row)
+{
+    float texel     = floor(index / 4.0);
+    float component = index - texel * 4.0;
+    vec4  samples   = texture2D(plane, (vec2(texel, row) + 0.5) / size);
+    return component < 0.5 ? samples.r : component < 1.5 ? samples.g : component < 2.5 ? samples.b : samples.a;
+}
+
+void main()
+{
+    vec2 pixel  = floor(gl_TexCoord[0].xy);
+    vec2 chroma = floor(pixel / 2.0);
+
+    vec3 yuv;
+    yuv.x = fetch(luma, lumaSize, pixel.x, pixel.y);
+    if (interleaved)
+    {
+        yuv.y = fetch(chromaU, chromaSize, chroma.x * 2.0, chroma.y);
+        yuv.z = fetch(chromaU, chromaSize, chroma.x * 2.0 + 1.0, chroma.y);
+    }
+    else
+    {
+        yuv.y = fetch(chromaU, chromaSize, chroma.x, chroma.y);
+        yuv.z = fetch(chromaV, chromaSize, chroma.x, chroma.y);
+    }
+
+    gl_FragColor = vec4(clamp(yuvToRgb * (yuv - offset), 0.0, 1.0), 1.0);
+}
+)";
+
+// Size of the samples of a plane: bytes per row and number of rows
+sf::Vector2u getPlaneSize(const sf::Vector2u& size, sf::StreamingTexture::Format format, std::size_t plane)
+{
+    if (plane == 0)
+        return size;
+
+    const sf::Vector2u chromaSize((size.x + 1) / 2, (size.y + 1) / 2);
+    if (format == sf::StreamingTexture::Format::NV12)
+        return {chromaSize.x * 2, chromaSize.y};
+
+    return chromaSize;
+}
+} // namespace StreamingTextureImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+StreamingTexture::StreamingTexture(RenderTexture&&        target,
+                                   Shader&&               shader,
+                                   std::vector<Texture>&& planes,
+                                   const Vector2u&        size,
+                                   Format                 format) :
+m_target(std::move(target)),
+m_shader(std::move(shader)),
+m_planes(std::move(planes)),
+m_size(size),
+m_format(format)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<StreamingTexture> StreamingTexture::create(const Vector2u& size, Format format)
+{
+    if (size.x == 0 || size.y == 0)
+    {
+        err() << "Failed to create streaming texture, invalid size (" << size.x << "x" << size.y << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    if (!Shader::isAvailable())
+    {
+        err() << "Failed to create streaming texture, shaders are not available" << std::endl;
+        return std::nullopt;
+    }
+
+    auto shader = Shader::loadFromMemory(StreamingTextureImpl::conversionShaderSource, Shader::Type::Fragment);
+    if (!shader)
+    {
+        err() << "Failed to create streaming texture, failed to compile the conversion shader" << std::endl;
+        return std::nullopt;
+    }
+
+    auto target = RenderTexture::create(size);
+    if (!target)
+    {
+        err() << "Failed to create streaming texture, failed to create the render texture" << std::endl;
+        return std::nullopt;
+    }
+
+    target->clear(Color::Black);
+    target->display();
+
+    // Each RGBA texel holds 4 consecutive samples of a row
+    std::vector<Texture> planes;
+    const std::size_t    planeCount = format == Format::NV12 ? 2 : 3;
+    for (std::size_t i = 0; i < planeCount; ++i)
+    {
+        const Vector2u planeSize = StreamingTextureImpl::getPlaneSize(size, format, i);
+        auto           texture   = Texture::create({(planeSize.x + 3) / 4, planeSize.y});
+        if (!texture)
+        {
+            err() << "Failed to create streaming texture, failed to create the textures of the planes" << std::endl;
+            return std::nullopt;
+        }
+
+        planes.push_back(std::move(*texture));
+    }
+
+    return StreamingTexture(std::move(*target), std::move(*shader), std::move(planes), size, format);
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::update(const Plane* planes)
+{
+    SFML_PROFILE_ZONE("sf::StreamingTexture::update");
+
+    assert(planes && "StreamingTexture::update() Planes must not be null");
+
+    // Upload the samples of the planes
+    for (std::size_t i = 0; i < m_planes.size(); ++i)
+    {
+        const Vector2u    planeSize   = StreamingTextureImpl::getPlaneSize(m_size, m_format, i);
+        const Vector2u    texelSize   = m_planes[i].getSize();
+        const std::size_t packedPitch = std::size_t{texelSize.x} * 4;
+
+        assert(planes[i].data && "StreamingTexture::update() The data of a plane must not be null");
+        assert(planes[i].rowPitch >= planeSize.x && "StreamingTexture::update() Row pitch is smaller than a row");
+
+        // Rows can be uploaded as they are only if they are contiguous and made of whole texels
+        const std::uint8_t* samples = planes[i].data;
+        if (planes[i].rowPitch != packedPitch || planeSize.x != packedPitch)
+        {
+            m_staging.resize(packedPitch * texelSize.y);
+            for (unsigned int row = 0; row < planeSize.y; ++row)
+                std::memcpy(m_staging.data() + row * packedPitch, samples + row * planes[i].rowPitch, planeSize.x);
+            samples = m_staging.data();
+        }
+
+        m_planes[i].updateAsync(samples, texelSize, {0, 0});
+    }
+
+    // Offsets and scales of the samples, then coefficients of ITU-R BT.601 or BT.709
+    const float lumaOffset   = m_fullRange ? 0.f : 16.f / 255.f;
+    const float lumaScale    = m_fullRange ? 1.f : 255.f / 219.f;
+    const float chromaOffset = 128.f / 255.f;
+    const float chromaScale  = m_fullRange ? 1.f : 255.f / 224.f;
+
+    const bool  bt709 = m_colorSpace == ColorSpace::Bt709;
+    const float rv    = (bt709 ? 1.5748f : 1.402f) * chromaScale;
+    const float gu    = (bt709 ? -0.187324f : -0.344136f) * chromaScale;
+    const float gv    = (bt709 ? -0.468124f : -0.714136f) * chromaScale;
+    const float bu    = (bt709 ? 1.8556f : 1.772f) * chromaScale;
+
+    // Column-major, like GLSL expects
+    const std::array<float, 9> matrix = {lumaScale, lumaScale, lumaScale, 0.f, gu, bu, rv, gv, 0.f};
+
+    m_shader.setUniform("luma", m_planes[0]);
+    m_shader.setUniform("chromaU", m_planes[1]);
+    m_shader.setUniform("chromaV", m_planes.back());
+    m_shader.setUniform("lumaSize", Glsl::Vec2(m_planes[0].getSize()));
+    m_shader.setUniform("chromaSize", Glsl::Vec2(m_planes[1].getSize()));
+    m_shader.setUniform("interleaved", m_format == Format::NV12);
+    m_shader.setUniform("yuvToRgb", Glsl::Mat3(matrix.data()));
+    m_shader.setUniform("offset", Glsl::Vec3(lumaOffset, chromaOffset, chromaOffset));
+
+    // Convert the planes, the texture coordinates are the pixel coordinates
+    const Vector2f size(m_size);
+    const std::array quad = {Vertex{{0.f, 0.f}, Color::White, {0.f, 0.f}},
+                             Vertex{{0.f, size.y}, Color::White, {0.f, size.y}},
+                             Vertex{{size.x, 0.f}, Color::White, {size.x, 0.f}},
+                             Vertex{size, Color::White, size}};
+
+    RenderStates states;
+    states.shader    = &m_shader;
+    states.blendMode = BlendNone;
+    m_target.draw(quad.data(), quad.size(), PrimitiveType::TriangleStrip, states);
+    m_target.display();
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::setColorSpace(ColorSpace colorSpace, bool fullRange)
+{
+    m_colorSpace = colorSpace;
+    m_fullRange  = fullRange;
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingTexture::ColorSpace StreamingTexture::getColorSpace() const
+{
+    return m_colorSpace;
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamingTexture::isFullRange() const
+{
+    return m_fullRange;
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingTexture::Format StreamingTexture::getFormat() const
+{
+    return m_format;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u StreamingTexture::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& StreamingTexture::getTexture() const
+{
+    return m_target.getTexture();
+}
+
+} // namespace sf
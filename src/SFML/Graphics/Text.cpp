@@ -28,10 +28,16 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/TextLayoutCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <SFML/System/ProfileZone.hpp>
+
 #include <algorithm>
+#include <limits>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <cmath>
 #include <cstddef>
@@ -82,6 +88,36 @@ void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Co
     vertices.append({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
     vertices.append({{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}});
 }
+
+// Replace a range of vertices, and move the vertices that follow it vertically
+void replaceVertices(sf::VertexArray&       vertices,
+                     std::size_t            first,
+                     std::size_t            count,
+                     const sf::VertexArray& replacement,
+                     float                  offset)
+{
+    // Overwrite the vertices in place if nothing else has to move
+    if ((replacement.getVertexCount() == count) && (offset == 0))
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            vertices[first + i] = replacement[i];
+        return;
+    }
+
+    std::vector<sf::Vertex> following;
+    following.reserve(vertices.getVertexCount() - first - count);
+    for (std::size_t i = first + count; i < vertices.getVertexCount(); ++i)
+    {
+        following.push_back(vertices[i]);
+        following.back().position.y += offset;
+    }
+
+    vertices.resize(first);
+    for (std::size_t i = 0; i < replacement.getVertexCount(); ++i)
+        vertices.append(replacement[i]);
+    for (const sf::Vertex& vertex : following)
+        vertices.append(vertex);
+}
 } // namespace
 
 
@@ -98,11 +134,64 @@ m_characterSize(characterSize)
 
 ////////////////////////////////////////////////////////////
 void Text::setString(const String& string)
+{
+    // The geometry is still built from m_string, a pending UTF-8 string can simply be dropped
+    m_hasUtf8String     = false;
+    m_utf8StringPending = false;
+    updateString(string);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setString(Utf8View string)
+{
+    if (m_hasUtf8String && (string == Utf8View(m_utf8String)))
+        return;
+
+    m_utf8String.assign(string.getBytes());
+    m_hasUtf8String     = true;
+    m_utf8StringPending = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateString(const String& string) const
 {
     if (m_string != string)
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        // Keep track of the characters that didn't change, to only rebuild the lines that did
+        const std::size_t oldSize = m_string.getSize();
+        const std::size_t newSize = string.getSize();
+        const std::size_t minSize = std::min(oldSize, newSize);
+
+        std::size_t prefix = 0;
+        while ((prefix < minSize) && (m_string[prefix] == string[prefix]))
+            ++prefix;
+
+        std::size_t suffix = 0;
+        while ((prefix + suffix < minSize) && (m_string[oldSize - suffix - 1] == string[newSize - suffix - 1]))
+            ++suffix;
+
+        if (m_stringNeedUpdate)
+        {
+            // Combine with the changes made since the last update, the geometry is still built for an older string
+            std::size_t geometrySize = 0;
+            for (const Line& line : m_lines)
+                geometrySize += line.characterCount;
+
+            m_unchangedPrefix = std::min(m_unchangedPrefix, prefix);
+            const std::size_t maxSuffix = std::min(geometrySize, newSize) - m_unchangedPrefix;
+
+            m_unchangedSuffix = std::min({m_unchangedSuffix, suffix, maxSuffix});
+        }
+        else
+        {
+            m_unchangedPrefix = prefix;
+            m_unchangedSuffix = suffix;
+        }
+
+        m_string           = string;
+        m_stringNeedUpdate = true;
     }
 }
 
@@ -209,9 +298,21 @@ void Text::setOutlineThickness(float thickness)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setLayoutCache(TextLayoutCache* layoutCache)
+{
+    if (layoutCache != m_layoutCache)
+    {
+        m_layoutCache        = layoutCache;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 const String& Text::getString() const
 {
+    ensureStringDecoded();
     return m_string;
 }
 
@@ -272,9 +373,18 @@ float Text::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+TextLayoutCache* Text::getLayoutCache() const
+{
+    return m_layoutCache;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
+    ensureStringDecoded();
+
     // Adjust the index if it's out of range
     index = std::min(index, m_string.getSize());
 
@@ -344,12 +454,31 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     ensureGeometryUpdate();
 
     states.transform *= getTransform();
+    if (target.cull(m_bounds, states.transform))
+        return;
+
     states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    // Glyphs are straight white pixels, for which BlendAlpha is the equivalent of BlendPremultipliedAlpha
+    if (states.blendMode == BlendPremultipliedAlpha)
+        states.blendMode = BlendAlpha;
+
+    // Distance field glyphs need a shader to be turned into sharp edges, unless a custom one is provided
+    const bool distanceFieldShader = !states.shader && m_font->isDistanceFieldEnabled();
+
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
+    {
+        // The built-in shader dilates the fill glyphs the outline is made of
+        if (distanceFieldShader)
+            states.shader = m_font->getDistanceFieldShader(target, m_outlineThickness, m_characterSize);
+
         target.draw(m_outlineVertices, states);
+    }
+
+    if (distanceFieldShader)
+        states.shader = m_font->getDistanceFieldShader(target, 0, m_characterSize);
 
     target.draw(m_vertices, states);
 }
@@ -358,25 +487,89 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
-        return;
+    SFML_PROFILE_ZONE("sf::Text::ensureGeometryUpdate");
 
-    // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    ensureStringDecoded();
 
-    // Mark geometry as updated
-    m_geometryNeedUpdate = false;
+    // If the font texture has changed, the glyphs may have moved within it: rebuild everything
+    const std::uint64_t fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    if (fontTextureId != m_fontTextureId)
+    {
+        // Save the current fonts texture id
+        m_fontTextureId      = fontTextureId;
+        m_geometryNeedUpdate = true;
+    }
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
+    if (m_geometryNeedUpdate)
+    {
+        // Mark geometry as updated
+        m_geometryNeedUpdate = false;
+        m_stringNeedUpdate   = false;
+
+        // Rebuild the whole geometry
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_lines.clear();
+        buildLines(0, m_string.getSize(), 0, m_vertices, m_outlineVertices, m_lines);
+    }
+    else if (m_stringNeedUpdate)
+    {
+        // Only rebuild the lines that changed
+        m_stringNeedUpdate = false;
+        updateChangedLines();
+    }
+    else
+    {
+        // Do nothing, if geometry has not changed and the font texture has not changed
+        return;
+    }
 
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_bounds = FloatRect();
         return;
+    }
+
+    // Combine the bounds of the lines
+    auto  minX = static_cast<float>(m_characterSize);
+    auto  minY = static_cast<float>(m_characterSize);
+    float maxX = 0.f;
+    float maxY = 0.f;
+    for (const Line& line : m_lines)
+    {
+        minX = std::min(minX, line.minX);
+        minY = std::min(minY, line.minY);
+        maxX = std::max(maxX, line.maxX);
+        maxY = std::max(maxY, line.maxY);
+    }
+
+    // If we're using outline, update the current bounds
+    if (m_outlineThickness != 0)
+    {
+        const float outline = std::abs(std::ceil(m_outlineThickness));
+        minX -= outline;
+        maxX += outline;
+        minY -= outline;
+        maxY += outline;
+    }
+
+    // Update the bounding rectangle
+    m_bounds.left   = minX;
+    m_bounds.top    = minY;
+    m_bounds.width  = maxX - minX;
+    m_bounds.height = maxY - minY;
+}
+
 
+////////////////////////////////////////////////////////////
+void Text::buildLines(std::size_t        begin,
+                      std::size_t        end,
+                      std::size_t        firstLine,
+                      VertexArray&       vertices,
+                      VertexArray&       outlineVertices,
+                      std::vector<Line>& lines) const
+{
     // Compute values related to the text style
     const bool  isBold             = m_style & Bold;
     const bool  isUnderlined       = m_style & Underlined;
@@ -385,6 +578,9 @@ void Text::ensureGeometryUpdate() const
     const float underlineOffset    = m_font->getUnderlinePosition(m_characterSize);
     const float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
 
+    // Distance field outlines are drawn by dilating the fill glyphs, which thus don't need to be stroked
+    const float glyphOutlineThickness = m_font->isDistanceFieldEnabled() ? 0.f : m_outlineThickness;
+
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
@@ -396,49 +592,143 @@ void Text::ensureGeometryUpdate() const
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
     float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
+    float       y           = static_cast<float>(m_characterSize) + static_cast<float>(firstLine) * lineSpacing;
 
-    // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
-    std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+    // Lines after the first one start right after a new line
+    std::uint32_t prevChar = (firstLine > 0) ? U'\n' : 0;
+
+    // Start a new line, with empty bounds and geometry
+    const auto startLine = [&]
     {
-        // Skip the \r char to avoid weird graphical issues
-        if (curChar == U'\r')
-            continue;
+        Line& line = lines.emplace_back();
+        line.minX  = std::numeric_limits<float>::max();
+        line.minY  = std::numeric_limits<float>::max();
+        line.maxX  = std::numeric_limits<float>::lowest();
+        line.maxY  = std::numeric_limits<float>::lowest();
+    };
+
+    // Add the underline and strike through lines of the current line, if any
+    const auto addLines = [&]
+    {
+        if (isUnderlined)
+        {
+            addLine(vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
-        // Apply the kerning offset
-        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            if (m_outlineThickness != 0)
+                addLine(outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+        }
 
-        // If we're using the underlined style and there's a new line, draw a line
-        if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
+        if (isStrikeThrough)
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+            addLine(vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+                addLine(outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
         }
+    };
+
+    // Add the quad of a glyph and grow the bounds of the current line
+    const auto addGlyph = [&](Vector2f position, const Glyph& glyph)
+    {
+        addGlyphQuad(vertices, position, m_fillColor, glyph, italicShear);
+
+        const float left   = glyph.bounds.left;
+        const float top    = glyph.bounds.top;
+        const float right  = glyph.bounds.left + glyph.bounds.width;
+        const float bottom = glyph.bounds.top + glyph.bounds.height;
+
+        Line& line = lines.back();
+        line.minX  = std::min(line.minX, position.x + left - italicShear * bottom);
+        line.maxX  = std::max(line.maxX, position.x + right - italicShear * top);
+        line.minY  = std::min(line.minY, position.y + top);
+        line.maxY  = std::max(line.maxY, position.y + bottom);
+    };
 
-        // If we're using the strike through style and there's a new line, draw a line across all characters
-        if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
+    // Add the glyphs of a run shaped by the layout cache
+    const auto addRun = [&](std::size_t runBegin, std::size_t runEnd)
+    {
+        const std::u32string_view run(m_string.getData() + runBegin, runEnd - runBegin);
+        for (const TextLayoutCache::ShapedGlyph& shaped : m_layoutCache->shape(*m_font, run, m_characterSize, isBold))
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+            const Vector2f position(x + shaped.offset.x, y + shaped.offset.y);
 
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            // Glyphs without pixels, such as spaces, only extend the bounds
+            const Glyph& glyph = m_font->getGlyphFromIndex(shaped.glyphIndex, m_characterSize, isBold);
+            if ((glyph.bounds.width == 0) || (glyph.bounds.height == 0))
+            {
+                Line& line = lines.back();
+                line.minX  = std::min(line.minX, x);
+                line.minY  = std::min(line.minY, y);
+                line.maxX  = std::max(line.maxX, x + shaped.advance + letterSpacing);
+                line.maxY  = std::max(line.maxY, y);
+            }
+            else
+            {
+                if (m_outlineThickness != 0)
+                {
+                    const Glyph& outlineGlyph = m_font->getGlyphFromIndex(shaped.glyphIndex,
+                                                                          m_characterSize,
+                                                                          isBold,
+                                                                          glyphOutlineThickness);
+                    addGlyphQuad(outlineVertices, position, m_outlineColor, outlineGlyph, italicShear);
+                }
+
+                // Loading the outline glyph may have evicted the fill glyph, get it again
+                addGlyph(position, m_font->getGlyphFromIndex(shaped.glyphIndex, m_characterSize, isBold));
+            }
+
+            x += shaped.advance + letterSpacing;
+        }
+    };
+
+    // Create one quad for each character
+    const std::size_t firstVertex        = vertices.getVertexCount();
+    const std::size_t firstOutlineVertex = outlineVertices.getVertexCount();
+    std::size_t       lineVertex         = firstVertex;
+    std::size_t       lineOutlineVertex  = firstOutlineVertex;
+    startLine();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const std::uint32_t curChar = m_string[i];
+
+        // With a layout cache, the characters up to the next new line or tabulation are shaped as one run
+        if (m_layoutCache && (curChar != U'\r') && (curChar != U'\n') && (curChar != U'\t'))
+        {
+            std::size_t runEnd = i + 1;
+            while ((runEnd < end) && (m_string[runEnd] != U'\r') && (m_string[runEnd] != U'\n') &&
+                   (m_string[runEnd] != U'\t'))
+                ++runEnd;
+
+            addRun(i, runEnd);
+            lines.back().characterCount += runEnd - i;
+            prevChar = m_string[runEnd - 1];
+            i        = runEnd - 1;
+            continue;
         }
 
+        ++lines.back().characterCount;
+
+        // Skip the \r char to avoid weird graphical issues
+        if (curChar == U'\r')
+            continue;
+
+        // Apply the kerning offset
+        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+
+        // If we're using the underlined or strike through style and there's a new line, draw the lines
+        if (curChar == U'\n' && prevChar != U'\n')
+            addLines();
+
         prevChar = curChar;
 
         // Handle special characters
         if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
         {
+            Line& line = lines.back();
+
             // Update the current bounds (min coordinates)
-            minX = std::min(minX, x);
-            minY = std::min(minY, y);
+            line.minX = std::min(line.minX, x);
+            line.minY = std::min(line.minY, y);
 
             switch (curChar)
             {
@@ -455,8 +745,18 @@ void Text::ensureGeometryUpdate() const
             }
 
             // Update the current bounds (max coordinates)
-            maxX = std::max(maxX, x);
-            maxY = std::max(maxY, y);
+            line.maxX = std::max(line.maxX, x);
+            line.maxY = std::max(line.maxY, y);
+
+            // The line is complete, start the next one
+            if (curChar == U'\n')
+            {
+                line.vertexCount        = vertices.getVertexCount() - lineVertex;
+                line.outlineVertexCount = outlineVertices.getVertexCount() - lineOutlineVertex;
+                lineVertex              = vertices.getVertexCount();
+                lineOutlineVertex       = outlineVertices.getVertexCount();
+                startLine();
+            }
 
             // Next glyph, no need to create a quad for whitespace
             continue;
@@ -465,66 +765,108 @@ void Text::ensureGeometryUpdate() const
         // Apply the outline
         if (m_outlineThickness != 0)
         {
-            const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
+            const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, glyphOutlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            addGlyphQuad(outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
         }
 
-        // Extract the current glyph's description
+        // Extract the current glyph's description and add it to the vertices
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
-
-        // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
-
-        // Update the current bounds
-        const float left   = glyph.bounds.left;
-        const float top    = glyph.bounds.top;
-        const float right  = glyph.bounds.left + glyph.bounds.width;
-        const float bottom = glyph.bounds.top + glyph.bounds.height;
-
-        minX = std::min(minX, x + left - italicShear * bottom);
-        maxX = std::max(maxX, x + right - italicShear * top);
-        minY = std::min(minY, y + top);
-        maxY = std::max(maxY, y + bottom);
+        addGlyph(Vector2f(x, y), glyph);
 
         // Advance to the next character
         x += glyph.advance + letterSpacing;
     }
 
-    // If we're using outline, update the current bounds
-    if (m_outlineThickness != 0)
+    // If we're using the underlined or strike through style, add the last lines across all characters
+    if (x > 0)
+        addLines();
+
+    lines.back().vertexCount        = vertices.getVertexCount() - lineVertex;
+    lines.back().outlineVertexCount = outlineVertices.getVertexCount() - lineOutlineVertex;
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateChangedLines() const
+{
+    std::size_t geometrySize = 0;
+    for (const Line& line : m_lines)
+        geometrySize += line.characterCount;
+
+    // Find the first line containing a changed character
+    std::size_t first              = 0;
+    std::size_t firstCharacter     = 0;
+    std::size_t firstVertex        = 0;
+    std::size_t firstOutlineVertex = 0;
+    while ((first + 1 < m_lines.size()) && (firstCharacter + m_lines[first].characterCount <= m_unchangedPrefix))
     {
-        const float outline = std::abs(std::ceil(m_outlineThickness));
-        minX -= outline;
-        maxX += outline;
-        minY -= outline;
-        maxY += outline;
+        firstCharacter += m_lines[first].characterCount;
+        firstVertex += m_lines[first].vertexCount;
+        firstOutlineVertex += m_lines[first].outlineVertexCount;
+        ++first;
     }
 
-    // If we're using the underlined style, add the last line
-    if (isUnderlined && (x > 0))
+    // Find the last lines that are unchanged, including the new line before them
+    std::size_t last               = m_lines.size();
+    std::size_t lastCharacter      = geometrySize;
+    std::size_t vertexCount        = m_vertices.getVertexCount() - firstVertex;
+    std::size_t outlineVertexCount = m_outlineVertices.getVertexCount() - firstOutlineVertex;
+    while (last > first + 1)
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
-
-        if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+        const std::size_t lineStart = lastCharacter - m_lines[last - 1].characterCount;
+        if (lineStart <= geometrySize - m_unchangedSuffix)
+            break;
+
+        --last;
+        lastCharacter -= m_lines[last].characterCount;
+        vertexCount -= m_lines[last].vertexCount;
+        outlineVertexCount -= m_lines[last].outlineVertexCount;
     }
 
-    // If we're using the strike through style, add the last line across all characters
-    if (isStrikeThrough && (x > 0))
-    {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+    // Build the changed lines
+    VertexArray       vertices(PrimitiveType::Triangles);
+    VertexArray       outlineVertices(PrimitiveType::Triangles);
+    std::vector<Line> lines;
+    buildLines(firstCharacter,
+               m_string.getSize() - (geometrySize - lastCharacter),
+               first,
+               vertices,
+               outlineVertices,
+               lines);
+
+    // The rebuilt range ends with a new line if lines are kept after it, the empty line that follows is one of them
+    if (last < m_lines.size())
+        lines.pop_back();
+
+    // Replace the old lines, and move the unchanged ones that follow if the number of lines changed
+    const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
+    const float offset      = (static_cast<float>(first + lines.size()) - static_cast<float>(last)) * lineSpacing;
 
-        if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+    replaceVertices(m_vertices, firstVertex, vertexCount, vertices, offset);
+    replaceVertices(m_outlineVertices, firstOutlineVertex, outlineVertexCount, outlineVertices, offset);
+
+    for (auto it = m_lines.begin() + static_cast<std::ptrdiff_t>(last); it != m_lines.end(); ++it)
+    {
+        it->minY += offset;
+        it->maxY += offset;
     }
 
-    // Update the bounding rectangle
-    m_bounds.left   = minX;
-    m_bounds.top    = minY;
-    m_bounds.width  = maxX - minX;
-    m_bounds.height = maxY - minY;
+    const auto firstLine = m_lines.begin() + static_cast<std::ptrdiff_t>(first);
+    const auto lastLine  = m_lines.begin() + static_cast<std::ptrdiff_t>(last);
+    m_lines.insert(m_lines.erase(firstLine, lastLine), lines.begin(), lines.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::ensureStringDecoded() const
+{
+    if (m_utf8StringPending)
+    {
+        m_utf8StringPending = false;
+        updateString(Utf8View(m_utf8String).toString());
+    }
 }
 
 } // namespace sf
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/TextLayoutCache.hpp>
+
+#include <functional>
+#include <iterator>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextLayoutCacheImpl
+{
+// Combine the hash of the characters with the rest of the key of a run
+std::size_t hashRun(std::uint64_t fontId, unsigned int characterSize, bool bold, std::u32string_view text)
+{
+    std::size_t hash = std::hash<std::u32string_view>{}(text);
+    for (const std::uint64_t value : {fontId, std::uint64_t{characterSize}, std::uint64_t{bold}})
+        hash ^= std::hash<std::uint64_t>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+} // namespace TextLayoutCacheImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextLayoutCache::TextLayoutCache(std::size_t memoryBudget) : m_memoryBudget(memoryBudget)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextLayoutCache::isShapingAvailable()
+{
+#ifdef SFML_USE_HARFBUZZ
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<TextLayoutCache::ShapedGlyph>& TextLayoutCache::shape(const Font&         font,
+                                                                       std::u32string_view text,
+                                                                       unsigned int        characterSize,
+                                                                       bool                bold)
+{
+    const std::size_t hash = TextLayoutCacheImpl::hashRun(font.m_id, characterSize, bold, text);
+
+    // Look for the run in the cache, and make it the most recently used one
+    const auto [first, last] = m_index.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        const Run& run = *it->second;
+        if (run.fontId == font.m_id && run.characterSize == characterSize && run.bold == bold && run.text == text)
+        {
+            m_runs.splice(m_runs.begin(), m_runs, it->second);
+            return run.glyphs;
+        }
+    }
+
+    // Shape the new run
+    Run& run          = m_runs.emplace_front();
+    run.fontId        = font.m_id;
+    run.characterSize = characterSize;
+    run.bold          = bold;
+    run.text          = text;
+    run.hash          = hash;
+    font.shape(text, characterSize, bold, run.glyphs);
+
+    // The overhead of the list node and the index entry is counted as well
+    run.memoryUsage = sizeof(Run) + sizeof(void*) * 6 + run.text.capacity() * sizeof(char32_t) +
+                      run.glyphs.capacity() * sizeof(ShapedGlyph);
+    m_memoryUsage += run.memoryUsage;
+    m_index.emplace(hash, m_runs.begin());
+
+    trim();
+    return run.glyphs;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayoutCache::setMemoryBudget(std::size_t memoryBudget)
+{
+    m_memoryBudget = memoryBudget;
+    trim();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextLayoutCache::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextLayoutCache::getMemoryUsage() const
+{
+    return m_memoryUsage;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextLayoutCache::getRunCount() const
+{
+    return m_runs.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayoutCache::clear()
+{
+    m_runs.clear();
+    m_index.clear();
+    m_memoryUsage = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayoutCache::trim()
+{
+    while (m_memoryUsage > m_memoryBudget && m_runs.size() > 1)
+    {
+        const auto lastRun       = std::prev(m_runs.end());
+        const auto [first, last]   = m_index.equal_range(lastRun->hash);
+        for (auto it = first; it != last; ++it)
+        {
+            if (it->second == lastRun)
+            {
+                m_index.erase(it);
+                break;
+            }
+        }
+
+        m_memoryUsage -= lastRun->memoryUsage;
+        m_runs.erase(lastRun);
+    }
+}
+
+} // namespace sf
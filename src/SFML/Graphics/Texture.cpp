@@ -25,22 +25,32 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuMemoryTracker.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PixelBufferRing.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/Window.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/ProfileZone.hpp>
+#include <SFML/System/Utils.hpp>
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <fstream>
 #include <ostream>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -59,6 +69,95 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+// Upload a block of RGBA pixels whose rows are rowPitch bytes apart to the bound texture
+void uploadPixels(const std::uint8_t* pixels, std::size_t rowPitch, const sf::Vector2u& size, const sf::Vector2u& dest)
+{
+    const std::size_t rowLength = rowPitch / 4;
+
+#ifndef SFML_OPENGL_ES
+
+    // Let OpenGL skip the end of each source row, so that the whole block is uploaded in a single call
+    if (rowLength != size.x)
+        glCheck(glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(rowLength)));
+
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            static_cast<GLint>(dest.x),
+                            static_cast<GLint>(dest.y),
+                            static_cast<GLsizei>(size.x),
+                            static_cast<GLsizei>(size.y),
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            pixels));
+
+    if (rowLength != size.x)
+        glCheck(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+
+#else
+
+    // OpenGL ES 1 can't unpack strided rows, upload them one by one if they aren't contiguous
+    const unsigned int uploadCount   = (rowLength == size.x) ? 1 : size.y;
+    const unsigned int rowsPerUpload = (rowLength == size.x) ? size.y : 1;
+
+    for (unsigned int i = 0; i < uploadCount; ++i)
+    {
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                0,
+                                static_cast<GLint>(dest.x),
+                                static_cast<GLint>(dest.y + i),
+                                static_cast<GLsizei>(size.x),
+                                static_cast<GLsizei>(rowsPerUpload),
+                                GL_RGBA,
+                                GL_UNSIGNED_BYTE,
+                                pixels + i * rowPitch));
+    }
+
+#endif // SFML_OPENGL_ES
+}
+
+// OpenGL internal format of a compressed format
+GLenum getCompressedInternalFormat(sf::Texture::CompressedFormat format, bool sRgb)
+{
+    using Format = sf::Texture::CompressedFormat;
+
+    switch (format)
+    {
+        case Format::Bc1:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1;
+        case Format::Bc2:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3;
+        case Format::Bc3:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5;
+        case Format::Bc4:
+            return GLEXT_GL_COMPRESSED_RED_RGTC1;
+        case Format::Bc5:
+            return GLEXT_GL_COMPRESSED_RG_RGTC2;
+        case Format::Bc7:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case Format::Etc2Rgb:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ETC2 : GLEXT_GL_COMPRESSED_RGB8_ETC2;
+        case Format::Etc2RgbA1:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2
+                        : GLEXT_GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2;
+        case Format::Etc2Rgba:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC;
+        default:
+        {
+            // The ASTC tokens are laid out in the same order as our enumeration
+            const auto offset = static_cast<GLenum>(format) - static_cast<GLenum>(Format::Astc4x4);
+            return (sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4 : GLEXT_GL_COMPRESSED_RGBA_ASTC_4x4) + offset;
+        }
+    }
+}
+
+// Check whether a compressed format is one of the S3TC formats, whose sRGB variants need EXT_texture_sRGB
+bool isS3tcFormat(sf::Texture::CompressedFormat format)
+{
+    using Format = sf::Texture::CompressedFormat;
+
+    return (format == Format::Bc1) || (format == Format::Bc2) || (format == Format::Bc3);
+}
 } // namespace TextureImpl
 } // namespace
 
@@ -88,6 +187,7 @@ m_cacheId(TextureImpl::getUniqueId())
     {
         *this = std::move(*texture);
         update(copy);
+        m_premultiplied = copy.m_premultiplied;
     }
     else
     {
@@ -102,6 +202,8 @@ Texture::~Texture()
     // Destroy the OpenGL texture
     if (m_texture)
     {
+        setMemoryUsage(0);
+
         const TransientContextLock lock;
 
         const GLuint texture = m_texture;
@@ -116,9 +218,13 @@ m_actualSize(std::exchange(right.m_actualSize, {})),
 m_texture(std::exchange(right.m_texture, 0)),
 m_isSmooth(std::exchange(right.m_isSmooth, false)),
 m_sRgb(std::exchange(right.m_sRgb, false)),
+m_premultiplied(std::exchange(right.m_premultiplied, false)),
 m_isRepeated(std::exchange(right.m_isRepeated, false)),
 m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
-m_cacheId(std::exchange(right.m_cacheId, 0))
+m_hasMipmap(std::exchange(right.m_hasMipmap, false)),
+m_cacheId(std::exchange(right.m_cacheId, 0)),
+m_memoryUsage(std::exchange(right.m_memoryUsage, 0)),
+m_compressedFormat(std::exchange(right.m_compressedFormat, std::nullopt))
 {
 }
 
@@ -134,6 +240,8 @@ Texture& Texture::operator=(Texture&& right) noexcept
     // Destroy the OpenGL texture
     if (m_texture)
     {
+        setMemoryUsage(0);
+
         const TransientContextLock lock;
 
         const GLuint texture = m_texture;
@@ -141,14 +249,18 @@ Texture& Texture::operator=(Texture&& right) noexcept
     }
 
     // Move old to new.
-    m_size          = std::exchange(right.m_size, {});
-    m_actualSize    = std::exchange(right.m_actualSize, {});
-    m_texture       = std::exchange(right.m_texture, 0);
-    m_isSmooth      = std::exchange(right.m_isSmooth, false);
-    m_sRgb          = std::exchange(right.m_sRgb, false);
-    m_isRepeated    = std::exchange(right.m_isRepeated, false);
-    m_fboAttachment = std::exchange(right.m_fboAttachment, false);
-    m_cacheId       = std::exchange(right.m_cacheId, 0);
+    m_size             = std::exchange(right.m_size, {});
+    m_actualSize       = std::exchange(right.m_actualSize, {});
+    m_texture          = std::exchange(right.m_texture, 0);
+    m_isSmooth         = std::exchange(right.m_isSmooth, false);
+    m_sRgb             = std::exchange(right.m_sRgb, false);
+    m_premultiplied    = std::exchange(right.m_premultiplied, false);
+    m_isRepeated       = std::exchange(right.m_isRepeated, false);
+    m_fboAttachment    = std::exchange(right.m_fboAttachment, false);
+    m_hasMipmap        = std::exchange(right.m_hasMipmap, false);
+    m_cacheId          = std::exchange(right.m_cacheId, 0);
+    m_memoryUsage      = std::exchange(right.m_memoryUsage, 0);
+    m_compressedFormat = std::exchange(right.m_compressedFormat, std::nullopt);
     return *this;
 }
 
@@ -252,6 +364,7 @@ std::optional<Texture> Texture::create(const Vector2u& size, bool sRgb)
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
     texture.m_cacheId = TextureImpl::getUniqueId();
+    texture.setMemoryUsage(std::uint64_t{4} * actualSize.x * actualSize.y);
 
     texture.m_hasMipmap = false;
 
@@ -322,29 +435,12 @@ std::optional<Texture> Texture::loadFromImage(const Image& image, bool sRgb, con
         rectangle.width   = std::min(rectangle.width, width - rectangle.left);
         rectangle.height  = std::min(rectangle.height, height - rectangle.top);
 
-        // Create the texture and upload the pixels
+        // Create the texture and upload the pixels, reading the rows of the area straight from the image
         if (auto texture = sf::Texture::create(Vector2u(rectangle.getSize()), sRgb))
         {
-            const TransientContextLock lock;
-
-            // Make sure that the current texture binding will be preserved
-            const priv::TextureSaver save;
-
-            // Copy the pixels to the texture, row by row
-            const std::uint8_t* pixels = image.getPixelsPtr() + 4 * (rectangle.left + (width * rectangle.top));
-            glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
-            for (int i = 0; i < rectangle.height; ++i)
-            {
-                glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, i, rectangle.width, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-                pixels += 4 * width;
-            }
-
-            glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-            texture->m_hasMipmap = false;
-
-            // Force an OpenGL flush, so that the texture will appear updated
-            // in all contexts immediately (solves problems in multi-threaded apps)
-            glCheck(glFlush());
+            const std::size_t   rowPitch = 4 * static_cast<std::size_t>(width);
+            const std::uint8_t* pixels   = image.getPixelsPtr() + 4 * (rectangle.left + (width * rectangle.top));
+            texture->update(pixels, rowPitch, Vector2u(rectangle.getSize()), {0, 0});
 
             return texture;
         }
@@ -356,6 +452,175 @@ std::optional<Texture> Texture::loadFromImage(const Image& image, bool sRgb, con
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Texture> Texture::loadCompressedFromFile(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to open compressed texture file\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    const std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return loadCompressedFromMemory(buffer.data(), buffer.size());
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Texture> Texture::loadCompressedFromStream(InputStream& stream)
+{
+    const std::int64_t size = stream.getSize();
+    if (size <= 0)
+    {
+        err() << "Failed to load compressed texture, the stream is empty" << std::endl;
+        return std::nullopt;
+    }
+
+    if (stream.seek(0) == -1)
+    {
+        err() << "Failed to seek compressed texture stream" << std::endl;
+        return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> buffer(static_cast<std::size_t>(size));
+    if (stream.read(buffer.data(), size) != size)
+    {
+        err() << "Failed to read compressed texture stream" << std::endl;
+        return std::nullopt;
+    }
+
+    return loadCompressedFromMemory(buffer.data(), buffer.size());
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Texture> Texture::loadCompressedFromMemory(const void* data, std::size_t size)
+{
+    const auto image = priv::parseCompressedImage(static_cast<const std::uint8_t*>(data), size);
+    if (!image)
+        return std::nullopt;
+
+    return loadCompressedImage(*image, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Texture> Texture::loadCompressedImage(const priv::CompressedImage& image, std::size_t firstLevel)
+{
+    assert(firstLevel < image.levels.size() && "Level index is out of bounds");
+
+    if (!isCompressedFormatAvailable(image.format))
+    {
+        err() << "Failed to load compressed texture, its format is not supported by the graphics card" << std::endl;
+        return std::nullopt;
+    }
+
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    // Compressed blocks cannot be padded, so the texture must have the exact size of the image
+    const Vector2u imageSize = image.levels.front().size;
+    if ((getValidSize(imageSize.x) != imageSize.x) || (getValidSize(imageSize.y) != imageSize.y))
+    {
+        err() << "Failed to load compressed texture, non power of two textures are not supported "
+              << "(" << imageSize.x << "x" << imageSize.y << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    // Check the maximum texture size
+    const unsigned int maxSize = getMaximumSize();
+    if ((imageSize.x > maxSize) || (imageSize.y > maxSize))
+    {
+        err() << "Failed to load compressed texture, its size is too high "
+              << "(" << imageSize.x << "x" << imageSize.y << ", "
+              << "maximum is " << maxSize << "x" << maxSize << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    // The sRGB variants of the S3TC formats are provided by EXT_texture_sRGB
+    bool sRgb = image.sRgb;
+    if (sRgb && TextureImpl::isS3tcFormat(image.format) && !GLEXT_texture_sRGB)
+    {
+        err() << "OpenGL extension EXT_texture_sRGB unavailable" << '\n'
+              << "Automatic sRGB to linear conversion disabled" << std::endl;
+        sRgb = false;
+    }
+
+    // Create the OpenGL texture
+    GLuint glTexture = 0;
+    glCheck(glGenTextures(1, &glTexture));
+    assert(glTexture);
+
+    Texture texture(imageSize, imageSize, glTexture, sRgb);
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    std::size_t levelCount = image.levels.size();
+
+#ifdef SFML_OPENGL_ES
+
+    // OpenGL ES 1 can't limit the sampled levels, a partial mipmap chain would leave the texture incomplete
+    if (image.levels.back().size != Vector2u(1, 1))
+        levelCount = 1;
+
+    // For the same reason, sampling can't start at a smaller level
+    firstLevel = 0;
+
+#endif
+
+    // Upload the blocks of every level as they are
+    const GLenum  internalFormat = TextureImpl::getCompressedInternalFormat(image.format, sRgb);
+    std::uint64_t memoryUsage    = 0;
+    glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+    for (std::size_t i = firstLevel; i < levelCount; ++i)
+    {
+        const priv::CompressedLevel& level = image.levels[i];
+        glCheck(glCompressedTexImage2D(GL_TEXTURE_2D,
+                                       static_cast<GLint>(i),
+                                       internalFormat,
+                                       static_cast<GLsizei>(level.size.x),
+                                       static_cast<GLsizei>(level.size.y),
+                                       0,
+                                       static_cast<GLsizei>(level.byteSize),
+                                       level.data));
+        memoryUsage += level.byteSize;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    // Only sample the levels that were uploaded
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(firstLevel)));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levelCount - 1)));
+
+    static const bool textureEdgeClamp = GLEXT_texture_edge_clamp || GLEXT_GL_VERSION_1_2 ||
+                                         Context::isExtensionAvailable("GL_EXT_texture_edge_clamp");
+    const GLint textureWrapParam = textureEdgeClamp ? GLEXT_GL_CLAMP_TO_EDGE : GLEXT_GL_CLAMP;
+#else
+    const GLint textureWrapParam = GLEXT_GL_CLAMP_TO_EDGE;
+#endif
+
+    texture.m_hasMipmap        = levelCount - firstLevel > 1;
+    texture.m_compressedFormat = image.format;
+    texture.setMemoryUsage(memoryUsage);
+
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    glCheck(glTexParameteri(GL_TEXTURE_2D,
+                            GL_TEXTURE_MIN_FILTER,
+                            texture.m_hasMipmap ? GL_NEAREST_MIPMAP_LINEAR : GL_NEAREST));
+
+    // Force an OpenGL flush, so that the texture will appear in all contexts immediately
+    glCheck(glFlush());
+
+    return texture;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Texture::getSize() const
 {
@@ -462,6 +727,60 @@ Image Texture::copyToImage() const
 }
 
 
+////////////////////////////////////////////////////////////
+TextureReadback Texture::copyToImageAsync() const
+{
+    // Easy case: empty texture
+    assert(m_texture && "Texture::copyToImageAsync Cannot copy empty texture to image");
+
+#ifndef SFML_OPENGL_ES
+
+    {
+        const TransientContextLock lock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object)
+        {
+            // Make sure that the current texture binding will be preserved
+            const priv::TextureSaver save;
+
+            GLuint buffer = 0;
+            glCheck(GLEXT_glGenBuffers(1, &buffer));
+
+            if (buffer)
+            {
+                // Let the GPU copy the whole storage to a pixel buffer, padding and flipping
+                // are dealt with when the pixels are read back from the buffer
+                glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, buffer));
+                glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                           static_cast<GLsizeiptrARB>(m_actualSize.x * m_actualSize.y * 4),
+                                           nullptr,
+                                           GLEXT_GL_STREAM_READ));
+                glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+                glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+                glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+                GLEXT_GLsync fence{};
+                if (GLEXT_sync)
+                    glCheck(fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+                // Submit the copy right away, so that it completes while the application goes on
+                glCheck(glFlush());
+
+                return {buffer, fence, m_size, m_actualSize, m_pixelsFlipped};
+            }
+        }
+    }
+
+#endif // SFML_OPENGL_ES
+
+    // Pixel buffers are not supported, copy the pixels synchronously
+    return TextureReadback(copyToImage());
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels)
 {
@@ -473,8 +792,20 @@ void Texture::update(const std::uint8_t* pixels)
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest)
 {
+    update(pixels, 4 * std::size_t{size.x}, size, dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(const std::uint8_t* pixels, std::size_t rowPitch, const Vector2u& size, const Vector2u& dest)
+{
+    SFML_PROFILE_ZONE("sf::Texture::update");
+
+    assert(!m_compressedFormat && "Cannot update the pixels of a compressed texture");
     assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+    assert(rowPitch >= 4 * std::size_t{size.x} && "Row pitch is smaller than a row of pixels");
+    assert(rowPitch % 4 == 0 && "Row pitch is not a whole number of pixels");
 
     if (pixels && m_texture)
     {
@@ -485,15 +816,7 @@ void Texture::update(const std::uint8_t* pixels, const Vector2u& size, const Vec
 
         // Copy pixels from the given array to the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-        glCheck(glTexSubImage2D(GL_TEXTURE_2D,
-                                0,
-                                static_cast<GLint>(dest.x),
-                                static_cast<GLint>(dest.y),
-                                static_cast<GLsizei>(size.x),
-                                static_cast<GLsizei>(size.y),
-                                GL_RGBA,
-                                GL_UNSIGNED_BYTE,
-                                pixels));
+        TextureImpl::uploadPixels(pixels, rowPitch, size, dest);
         glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
         m_hasMipmap     = false;
         m_pixelsFlipped = false;
@@ -506,6 +829,46 @@ void Texture::update(const std::uint8_t* pixels, const Vector2u& size, const Vec
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::updateAsync(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest)
+{
+    SFML_PROFILE_ZONE("sf::Texture::updateAsync");
+
+    assert(!m_compressedFormat && "Cannot update the pixels of a compressed texture");
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    if (pixels && m_texture)
+    {
+        const TransientContextLock lock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        // Stage the pixels in a pixel buffer, or fall back to a synchronous update if we can't
+        priv::PixelBufferRing* pixelBufferRing = priv::PixelBufferRing::getCurrent();
+        if (!pixelBufferRing || !pixelBufferRing->write(pixels, std::size_t{size.x} * size.y * 4))
+        {
+            update(pixels, size, dest);
+            return;
+        }
+
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        // Transfer the pixels from the pixel buffer bound to GL_PIXEL_UNPACK_BUFFER to the texture
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        TextureImpl::uploadPixels(nullptr, std::size_t{size.x} * 4, size, dest);
+        pixelBufferRing->release();
+
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        m_hasMipmap     = false;
+        m_pixelsFlipped = false;
+        m_cacheId       = TextureImpl::getUniqueId();
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const Texture& texture)
 {
@@ -517,6 +880,9 @@ void Texture::update(const Texture& texture)
 ////////////////////////////////////////////////////////////
 void Texture::update(const Texture& texture, const Vector2u& dest)
 {
+    SFML_PROFILE_ZONE("sf::Texture::update");
+
+    assert(!m_compressedFormat && "Cannot update the pixels of a compressed texture");
     assert(dest.x + texture.m_size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + texture.m_size.y <= m_size.y && "Destination y coordinate is outside of texture");
 
@@ -532,7 +898,8 @@ void Texture::update(const Texture& texture, const Vector2u& dest)
         priv::ensureExtensionsInit();
     }
 
-    if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit)
+    // Compressed textures can't be attached to a frame buffer, they are read back instead
+    if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit && !texture.m_compressedFormat)
     {
         const TransientContextLock lock;
 
@@ -662,6 +1029,9 @@ void Texture::update(const Window& window)
 ////////////////////////////////////////////////////////////
 void Texture::update(const Window& window, const Vector2u& dest)
 {
+    SFML_PROFILE_ZONE("sf::Texture::update");
+
+    assert(!m_compressedFormat && "Cannot update the pixels of a compressed texture");
     assert(dest.x + window.getSize().x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + window.getSize().y <= m_size.y && "Destination y coordinate is outside of texture");
 
@@ -740,6 +1110,20 @@ bool Texture::isSrgb() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::setPremultipliedAlpha(bool premultiplied)
+{
+    m_premultiplied = premultiplied;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isPremultipliedAlpha() const
+{
+    return m_premultiplied;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::setRepeated(bool repeated)
 {
@@ -795,7 +1179,8 @@ bool Texture::isRepeated() const
 ////////////////////////////////////////////////////////////
 bool Texture::generateMipmap()
 {
-    if (!m_texture)
+    // Mipmaps of compressed textures can only be loaded from their file
+    if (!m_texture || m_compressedFormat)
         return false;
 
     const TransientContextLock lock;
@@ -815,6 +1200,84 @@ bool Texture::generateMipmap()
                             GL_TEXTURE_MIN_FILTER,
                             m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
 
+    // Each level is a quarter of the previous one, down to 1x1
+    std::uint64_t memoryUsage = 0;
+    for (Vector2u size = m_actualSize;; size = {std::max(size.x / 2, 1u), std::max(size.y / 2, 1u)})
+    {
+        memoryUsage += std::uint64_t{4} * size.x * size.y;
+        if (size == Vector2u(1, 1))
+            break;
+    }
+    setMemoryUsage(memoryUsage);
+
+    m_hasMipmap = true;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::setMipmap(const std::vector<Image>& levels)
+{
+    if (!m_texture)
+    {
+        err() << "Failed to set texture mipmap, the texture is not created" << std::endl;
+        return false;
+    }
+
+    if (m_compressedFormat || m_actualSize != m_size)
+    {
+        err() << "Failed to set texture mipmap, it is only supported by uncompressed textures of their exact size"
+              << std::endl;
+        return false;
+    }
+
+    // Check the whole chain before uploading anything
+    Vector2u size = m_size;
+    for (const Image& level : levels)
+    {
+        size = {std::max(size.x / 2, 1u), std::max(size.y / 2, 1u)};
+        if (level.getSize() != size)
+        {
+            err() << "Failed to set texture mipmap, level of size " << level.getSize().x << "x" << level.getSize().y
+                  << " should be " << size.x << "x" << size.y << std::endl;
+            return false;
+        }
+    }
+
+    if (size != Vector2u(1, 1))
+    {
+        err() << "Failed to set texture mipmap, the last level must be 1x1" << std::endl;
+        return false;
+    }
+
+    const TransientContextLock lock;
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    for (std::size_t i = 0; i < levels.size(); ++i)
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             static_cast<GLint>(i + 1),
+                             (m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                             static_cast<GLsizei>(levels[i].getSize().x),
+                             static_cast<GLsizei>(levels[i].getSize().y),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             levels[i].getPixelsPtr()));
+    }
+    glCheck(glTexParameteri(GL_TEXTURE_2D,
+                            GL_TEXTURE_MIN_FILTER,
+                            m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+
+    std::uint64_t memoryUsage = std::uint64_t{4} * m_size.x * m_size.y;
+    for (const Image& level : levels)
+        memoryUsage += std::uint64_t{4} * level.getSize().x * level.getSize().y;
+    setMemoryUsage(memoryUsage);
+
     m_hasMipmap = true;
 
     return true;
@@ -849,41 +1312,9 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
         // Bind the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
 
-        // Check if we need to define a special texture matrix
-        if ((coordinateType == CoordinateType::Pixels) || texture->m_pixelsFlipped)
-        {
-            // clang-format off
-            std::array matrix = {1.f, 0.f, 0.f, 0.f,
-                                 0.f, 1.f, 0.f, 0.f,
-                                 0.f, 0.f, 1.f, 0.f,
-                                 0.f, 0.f, 0.f, 1.f};
-            // clang-format on
-
-            // If non-normalized coordinates (= pixels) are requested, we need to
-            // setup scale factors that convert the range [0 .. size] to [0 .. 1]
-            if (coordinateType == CoordinateType::Pixels)
-            {
-                matrix[0] = 1.f / static_cast<float>(texture->m_actualSize.x);
-                matrix[5] = 1.f / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // If pixels are flipped we must invert the Y axis
-            if (texture->m_pixelsFlipped)
-            {
-                matrix[5]  = -matrix[5];
-                matrix[13] = static_cast<float>(texture->m_size.y) / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // Load the matrix
-            glCheck(glMatrixMode(GL_TEXTURE));
-            glCheck(glLoadMatrixf(matrix.data()));
-        }
-        else
-        {
-            // Reset the texture matrix
-            glCheck(glMatrixMode(GL_TEXTURE));
-            glCheck(glLoadIdentity());
-        }
+        // Load the texture matrix
+        glCheck(glMatrixMode(GL_TEXTURE));
+        glCheck(glLoadMatrixf(texture->getTextureMatrix(coordinateType).data()));
 
         // Go back to model-view mode (sf::RenderTarget relies on it)
         glCheck(glMatrixMode(GL_MODELVIEW));
@@ -903,6 +1334,35 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
 }
 
 
+////////////////////////////////////////////////////////////
+std::array<float, 16> Texture::getTextureMatrix(CoordinateType coordinateType) const
+{
+    // clang-format off
+    std::array matrix = {1.f, 0.f, 0.f, 0.f,
+                         0.f, 1.f, 0.f, 0.f,
+                         0.f, 0.f, 1.f, 0.f,
+                         0.f, 0.f, 0.f, 1.f};
+    // clang-format on
+
+    // If non-normalized coordinates (= pixels) are requested, we need to
+    // setup scale factors that convert the range [0 .. size] to [0 .. 1]
+    if (coordinateType == CoordinateType::Pixels)
+    {
+        matrix[0] = 1.f / static_cast<float>(m_actualSize.x);
+        matrix[5] = 1.f / static_cast<float>(m_actualSize.y);
+    }
+
+    // If pixels are flipped we must invert the Y axis
+    if (m_pixelsFlipped)
+    {
+        matrix[5]  = -matrix[5];
+        matrix[13] = static_cast<float>(m_size.y) / static_cast<float>(m_actualSize.y);
+    }
+
+    return matrix;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Texture::getMaximumSize()
 {
@@ -924,6 +1384,76 @@ unsigned int Texture::getMaximumSize()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::isCompressedFormatAvailable(CompressedFormat format)
+{
+    static const auto availability = []
+    {
+        const TransientContextLock transientLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        const auto hasExtension = [](std::string_view name) { return Context::isExtensionAvailable(name); };
+
+        const bool s3tc = hasExtension("GL_EXT_texture_compression_s3tc");
+        const bool dxt1 = s3tc || hasExtension("GL_EXT_texture_compression_dxt1");
+        const bool rgtc = GLEXT_GL_VERSION_3_0 || hasExtension("GL_ARB_texture_compression_rgtc") ||
+                          hasExtension("GL_EXT_texture_compression_rgtc");
+        const bool bptc = GLEXT_GL_VERSION_4_2 || hasExtension("GL_ARB_texture_compression_bptc") ||
+                          hasExtension("GL_EXT_texture_compression_bptc");
+        const bool etc2 = GLEXT_GL_VERSION_4_3 || hasExtension("GL_ARB_ES3_compatibility");
+        const bool astc = hasExtension("GL_KHR_texture_compression_astc_ldr");
+
+        // Drivers also list the formats they accept without exposing the matching extension
+        GLint formatCount = 0;
+        glCheck(glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatCount));
+        std::vector<GLint> formats(static_cast<std::size_t>(std::max(formatCount, 0)));
+        if (!formats.empty())
+            glCheck(glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data()));
+
+        std::array<bool, static_cast<std::size_t>(CompressedFormat::Astc12x12) + 1> result{};
+        for (std::size_t i = 0; i < result.size(); ++i)
+        {
+            const auto candidate = static_cast<CompressedFormat>(i);
+            const auto token     = static_cast<GLint>(TextureImpl::getCompressedInternalFormat(candidate, false));
+
+            switch (candidate)
+            {
+                case CompressedFormat::Bc1:
+                    result[i] = dxt1;
+                    break;
+                case CompressedFormat::Bc2:
+                case CompressedFormat::Bc3:
+                    result[i] = s3tc;
+                    break;
+                case CompressedFormat::Bc4:
+                case CompressedFormat::Bc5:
+                    result[i] = rgtc;
+                    break;
+                case CompressedFormat::Bc7:
+                    result[i] = bptc;
+                    break;
+                case CompressedFormat::Etc2Rgb:
+                case CompressedFormat::Etc2RgbA1:
+                case CompressedFormat::Etc2Rgba:
+                    result[i] = etc2;
+                    break;
+                default:
+                    result[i] = astc;
+                    break;
+            }
+
+            result[i] = result[i] || (std::find(formats.begin(), formats.end(), token) != formats.end());
+        }
+
+        return result;
+    }();
+
+    return availability[static_cast<std::size_t>(format)];
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture& Texture::operator=(const Texture& right)
 {
@@ -935,6 +1465,13 @@ Texture& Texture::operator=(const Texture& right)
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Texture::CompressedFormat> Texture::getCompressedFormat() const
+{
+    return m_compressedFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::swap(Texture& right) noexcept
 {
@@ -943,10 +1480,13 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_texture, right.m_texture);
     std::swap(m_isSmooth, right.m_isSmooth);
     std::swap(m_sRgb, right.m_sRgb);
+    std::swap(m_premultiplied, right.m_premultiplied);
     std::swap(m_isRepeated, right.m_isRepeated);
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_memoryUsage, right.m_memoryUsage);
+    std::swap(m_compressedFormat, right.m_compressedFormat);
 
     m_cacheId       = TextureImpl::getUniqueId();
     right.m_cacheId = TextureImpl::getUniqueId();
@@ -980,6 +1520,16 @@ unsigned int Texture::getValidSize(unsigned int size)
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::setMemoryUsage(std::uint64_t bytes)
+{
+    // Textures attached to a framebuffer object belong to a render texture
+    const GpuMemory::Category category = m_fboAttachment ? GpuMemory::Category::RenderTexture
+                                                         : GpuMemory::Category::Texture;
+    priv::setGpuMemoryUsage(category, m_memoryUsage, bytes);
+}
+
+
 ////////////////////////////////////////////////////////////
 void swap(Texture& left, Texture& right) noexcept
 {
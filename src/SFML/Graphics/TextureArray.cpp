@@ -0,0 +1,366 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuMemoryTracker.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureArrayImpl
+{
+// Save and restore the texture array binding, like sf::priv::TextureSaver does for 2D textures
+class BindingSaver
+{
+public:
+    BindingSaver()
+    {
+        glCheck(glGetIntegerv(GLEXT_GL_TEXTURE_BINDING_2D_ARRAY, &m_binding));
+    }
+
+    ~BindingSaver()
+    {
+        glCheck(glBindTexture(GLEXT_GL_TEXTURE_2D_ARRAY, static_cast<GLuint>(m_binding)));
+    }
+
+    BindingSaver(const BindingSaver&)            = delete;
+    BindingSaver& operator=(const BindingSaver&) = delete;
+
+private:
+    GLint m_binding{};
+};
+} // namespace TextureArrayImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureArray::TextureArray(const Vector2u& size, unsigned int layerCount, unsigned int texture, bool sRgb) :
+m_size(size),
+m_layerCount(layerCount),
+m_texture(texture),
+m_sRgb(sRgb)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray::~TextureArray()
+{
+    if (m_texture)
+    {
+        priv::setGpuMemoryUsage(GpuMemory::Category::Texture, m_memoryUsage, 0);
+
+        const TransientContextLock lock;
+
+        const GLuint texture = m_texture;
+        glCheck(glDeleteTextures(1, &texture));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray::TextureArray(TextureArray&& source) noexcept :
+m_size(std::exchange(source.m_size, {})),
+m_layerCount(std::exchange(source.m_layerCount, 0U)),
+m_texture(std::exchange(source.m_texture, 0U)),
+m_isSmooth(std::exchange(source.m_isSmooth, false)),
+m_sRgb(std::exchange(source.m_sRgb, false)),
+m_memoryUsage(std::exchange(source.m_memoryUsage, 0))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray& TextureArray::operator=(TextureArray&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_texture)
+    {
+        priv::setGpuMemoryUsage(GpuMemory::Category::Texture, m_memoryUsage, 0);
+
+        const TransientContextLock lock;
+
+        const GLuint texture = m_texture;
+        glCheck(glDeleteTextures(1, &texture));
+    }
+
+    m_size        = std::exchange(right.m_size, {});
+    m_layerCount  = std::exchange(right.m_layerCount, 0U);
+    m_texture     = std::exchange(right.m_texture, 0U);
+    m_isSmooth    = std::exchange(right.m_isSmooth, false);
+    m_sRgb        = std::exchange(right.m_sRgb, false);
+    m_memoryUsage = std::exchange(right.m_memoryUsage, 0);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureArray> TextureArray::create(const Vector2u& size, unsigned int layerCount, bool sRgb)
+{
+    if (!isAvailable())
+    {
+        err() << "Failed to create texture array: your system doesn't support texture arrays "
+              << "(you should test TextureArray::isAvailable() before trying to use the TextureArray class)"
+              << std::endl;
+        return std::nullopt;
+    }
+
+    // Check if texture parameters are valid before creating it
+    if ((size.x == 0) || (size.y == 0) || (layerCount == 0))
+    {
+        err() << "Failed to create texture array, invalid size (" << size.x << "x" << size.y << "x" << layerCount
+              << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    const unsigned int maxSize       = Texture::getMaximumSize();
+    const unsigned int maxLayerCount = getMaximumLayerCount();
+    if ((size.x > maxSize) || (size.y > maxSize) || (layerCount > maxLayerCount))
+    {
+        err() << "Failed to create texture array, its size is too high "
+              << "(" << size.x << "x" << size.y << "x" << layerCount << ", "
+              << "maximum is " << maxSize << "x" << maxSize << "x" << maxLayerCount << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    const TransientContextLock lock;
+
+    // Create the OpenGL texture
+    GLuint glTexture = 0;
+    glCheck(glGenTextures(1, &glTexture));
+    assert(glTexture);
+
+    TextureArray textureArray(size, layerCount, glTexture, sRgb && GLEXT_texture_sRGB);
+
+    // Make sure that the current texture array binding will be preserved
+    const TextureArrayImpl::BindingSaver save;
+
+    // Allocate the storage of all the layers at once
+    glCheck(glBindTexture(GLEXT_GL_TEXTURE_2D_ARRAY, glTexture));
+    glCheck(GLEXT_glTexImage3D(GLEXT_GL_TEXTURE_2D_ARRAY,
+                               0,
+                               (textureArray.m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                               static_cast<GLsizei>(size.x),
+                               static_cast<GLsizei>(size.y),
+                               static_cast<GLsizei>(layerCount),
+                               0,
+                               GL_RGBA,
+                               GL_UNSIGNED_BYTE,
+                               nullptr));
+    glCheck(glTexParameteri(GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GLEXT_GL_CLAMP_TO_EDGE));
+    glCheck(glTexParameteri(GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GLEXT_GL_CLAMP_TO_EDGE));
+    glCheck(glTexParameteri(GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    glCheck(glTexParameteri(GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    priv::setGpuMemoryUsage(GpuMemory::Category::Texture,
+                            textureArray.m_memoryUsage,
+                            std::uint64_t{4} * size.x * size.y * layerCount);
+
+    return textureArray;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureArray::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getLayerCount() const
+{
+    return m_layerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(const std::uint8_t* pixels, unsigned int layer)
+{
+    update(pixels, m_size, {0, 0}, layer);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest, unsigned int layer)
+{
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture array");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture array");
+    assert(layer < m_layerCount && "Layer is outside of texture array");
+
+    if (pixels && m_texture)
+    {
+        const TransientContextLock lock;
+
+        // Make sure that the current texture array binding will be preserved
+        const TextureArrayImpl::BindingSaver save;
+
+        // Copy pixels from the given array to the layer
+        glCheck(glBindTexture(GLEXT_GL_TEXTURE_2D_ARRAY, m_texture));
+        glCheck(GLEXT_glTexSubImage3D(GLEXT_GL_TEXTURE_2D_ARRAY,
+                                      0,
+                                      static_cast<GLint>(dest.x),
+                                      static_cast<GLint>(dest.y),
+                                      static_cast<GLint>(layer),
+                                      static_cast<GLsizei>(size.x),
+                                      static_cast<GLsizei>(size.y),
+                                      1,
+                                      GL_RGBA,
+                                      GL_UNSIGNED_BYTE,
+                                      pixels));
+
+        // Force an OpenGL flush, so that the texture data will appear updated
+        // in all contexts immediately (solves problems in multi-threaded apps)
+        glCheck(glFlush());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(const Image& image, unsigned int layer)
+{
+    update(image, {0, 0}, layer);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(const Image& image, const Vector2u& dest, unsigned int layer)
+{
+    update(image.getPixelsPtr(), image.getSize(), dest, layer);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::setSmooth(bool smooth)
+{
+    if (smooth != m_isSmooth)
+    {
+        m_isSmooth = smooth;
+
+        if (m_texture)
+        {
+            const TransientContextLock lock;
+
+            // Make sure that the current texture array binding will be preserved
+            const TextureArrayImpl::BindingSaver save;
+
+            const GLint filter = m_isSmooth ? GL_LINEAR : GL_NEAREST;
+            glCheck(glBindTexture(GLEXT_GL_TEXTURE_2D_ARRAY, m_texture));
+            glCheck(glTexParameteri(GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, filter));
+            glCheck(glTexParameteri(GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, filter));
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::isSrgb() const
+{
+    return m_sRgb;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getNativeHandle() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::bind(const TextureArray* textureArray)
+{
+    if (!isAvailable())
+        return;
+
+    const TransientContextLock lock;
+
+    glCheck(glBindTexture(GLEXT_GL_TEXTURE_2D_ARRAY, textureArray ? textureArray->m_texture : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock lock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return static_cast<bool>(GLEXT_texture_array);
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getMaximumLayerCount()
+{
+    static const unsigned int maxLayerCount = []
+    {
+        if (!isAvailable())
+            return 0U;
+
+        const TransientContextLock lock;
+
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_ARRAY_TEXTURE_LAYERS, &value));
+
+        return static_cast<unsigned int>(value);
+    }();
+
+    return maxLayerCount;
+}
+
+} // namespace sf
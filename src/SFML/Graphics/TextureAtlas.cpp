@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureAtlas::Page
+{
+    Texture             texture; //!< Texture holding the pixels of the images
+    priv::SkylinePacker packer;  //!< Packer keeping track of the free space of the texture
+};
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(const Vector2u& pageSize, unsigned int padding) : m_pageSize(pageSize), m_padding(padding)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(const TextureAtlas&) = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas& TextureAtlas::operator=(const TextureAtlas&) = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas& TextureAtlas::operator=(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureAtlas::Region> TextureAtlas::add(const Image& image)
+{
+    const Vector2u imageSize    = image.getSize();
+    const Vector2u reservedSize = imageSize + Vector2u(m_padding, m_padding) * 2u;
+
+    if ((reservedSize.x > m_pageSize.x) || (reservedSize.y > m_pageSize.y))
+    {
+        err() << "Failed to add image to texture atlas: image is larger than a page\n"
+              << "Image size: " << imageSize.x << "x" << imageSize.y << '\n'
+              << "Page size: " << m_pageSize.x << "x" << m_pageSize.y << std::endl;
+        return std::nullopt;
+    }
+
+    // Look for a page with enough free space left
+    std::size_t                       pageIndex = 0;
+    std::optional<Rect<unsigned int>> reserved;
+    for (; (pageIndex < m_pages.size()) && !reserved; ++pageIndex)
+        reserved = m_pages[pageIndex].packer.insert(reservedSize);
+
+    if (reserved)
+    {
+        --pageIndex;
+    }
+    else
+    {
+        // All the pages are full, start a new one, making sure that the padding is initialized
+        auto texture = Texture::loadFromImage(Image(m_pageSize, Color::Transparent));
+        if (!texture)
+        {
+            err() << "Failed to create texture atlas page" << std::endl;
+            return std::nullopt;
+        }
+
+        texture->setSmooth(m_isSmooth);
+        m_pages.push_back({std::move(*texture), priv::SkylinePacker(m_pageSize)});
+
+        reserved = m_pages.back().packer.insert(reservedSize);
+        assert(reserved && "Empty atlas page should fit any image smaller than the page");
+    }
+
+    const Vector2u position = reserved->getPosition() + Vector2u(m_padding, m_padding);
+    m_pages[pageIndex].texture.update(image, position);
+
+    m_usedArea += std::uint64_t{imageSize.x} * imageSize.y;
+
+    return Region{pageIndex, IntRect(Rect<unsigned int>(position, imageSize))};
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::clear()
+{
+    m_pages.clear();
+    m_usedArea = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(std::size_t page) const
+{
+    assert(page < m_pages.size() && "Index is out of bounds");
+    return m_pages[page].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureAtlas::getPageSize() const
+{
+    return m_pageSize;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextureAtlas::getEfficiency() const
+{
+    if (m_pages.empty())
+        return 0.f;
+
+    const auto pageArea = static_cast<double>(m_pageSize.x) * static_cast<double>(m_pageSize.y);
+    return static_cast<float>(static_cast<double>(m_usedArea) / (pageArea * static_cast<double>(m_pages.size())));
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (Page& page : m_pages)
+        page.texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+} // namespace sf
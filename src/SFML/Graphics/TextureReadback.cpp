@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureReadback::~TextureReadback()
+{
+    destroy();
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(TextureReadback&& source) noexcept :
+m_image(std::move(source.m_image)),
+m_buffer(std::exchange(source.m_buffer, 0U)),
+m_fence(std::exchange(source.m_fence, nullptr)),
+m_size(source.m_size),
+m_actualSize(source.m_actualSize),
+m_pixelsFlipped(source.m_pixelsFlipped)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback& TextureReadback::operator=(TextureReadback&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    destroy();
+
+    m_image         = std::move(right.m_image);
+    m_buffer        = std::exchange(right.m_buffer, 0U);
+    m_fence         = std::exchange(right.m_fence, nullptr);
+    m_size          = right.m_size;
+    m_actualSize    = right.m_actualSize;
+    m_pixelsFlipped = right.m_pixelsFlipped;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isReady() const
+{
+    if (m_image || !m_fence)
+        return true;
+
+    const TransientContextLock lock;
+
+    // Poll the fence without waiting
+    GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+    glCheck(result = GLEXT_glClientWaitSync(static_cast<GLEXT_GLsync>(m_fence), 0, 0));
+
+    return result != GLEXT_GL_TIMEOUT_EXPIRED;
+}
+
+
+////////////////////////////////////////////////////////////
+const Image& TextureReadback::getImage()
+{
+    if (m_image)
+        return *m_image;
+
+    std::vector<std::uint8_t> pixels(m_size.x * m_size.y * 4);
+
+    {
+        const TransientContextLock lock;
+
+        // Wait until the GPU is done filling the pixel buffer
+        if (m_fence)
+        {
+            GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+
+            while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+                glCheck(result = GLEXT_glClientWaitSync(static_cast<GLEXT_GLsync>(m_fence),
+                                                        GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                        1000000));
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, m_buffer));
+
+        const void* source = nullptr;
+        glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+
+        if (source)
+        {
+            // Copy the useful pixels, skipping the padding and handling the case where they are flipped vertically
+            const auto*       src      = static_cast<const std::uint8_t*>(source);
+            std::uint8_t*     dst      = pixels.data();
+            auto              srcPitch = static_cast<std::ptrdiff_t>(m_actualSize.x * 4);
+            const std::size_t dstPitch = m_size.x * 4;
+
+            if (m_pixelsFlipped)
+            {
+                src += srcPitch * static_cast<std::ptrdiff_t>(m_size.y - 1);
+                srcPitch = -srcPitch;
+            }
+
+            for (unsigned int i = 0; i < m_size.y; ++i)
+            {
+                std::memcpy(dst, src, dstPitch);
+                src += srcPitch;
+                dst += dstPitch;
+            }
+
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+        }
+        else
+        {
+            err() << "Failed to map pixel buffer to read texture pixels" << std::endl;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+    }
+
+    destroy();
+
+    return m_image.emplace(m_size, pixels.data());
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(Image image) : m_image(std::move(image)), m_size(m_image->getSize())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(unsigned int    buffer,
+                                 void*           fence,
+                                 const Vector2u& size,
+                                 const Vector2u& actualSize,
+                                 bool            pixelsFlipped) :
+m_buffer(buffer),
+m_fence(fence),
+m_size(size),
+m_actualSize(actualSize),
+m_pixelsFlipped(pixelsFlipped)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureReadback::destroy()
+{
+    if (!m_buffer && !m_fence)
+        return;
+
+    const TransientContextLock lock;
+
+    if (m_fence)
+        glCheck(GLEXT_glDeleteSync(static_cast<GLEXT_GLsync>(std::exchange(m_fence, nullptr))));
+
+    if (m_buffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+
+    m_buffer = 0;
+}
+
+} // namespace sf
@@ -0,0 +1,382 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureStreamer.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureStreamer::Entry
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory used by a level and all the smaller ones
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getMemoryUsage(std::size_t level) const
+    {
+        std::uint64_t memoryUsage = 0;
+        for (std::size_t i = level; i < image.levels.size(); ++i)
+            memoryUsage += image.levels[i].byteSize;
+        return memoryUsage;
+    }
+
+    std::vector<std::uint8_t> data;            //!< Contents of the file, kept to upload the levels later
+    priv::CompressedImage     image;           //!< Levels of the file, pointing into the data
+    std::optional<Texture>    texture;         //!< Texture holding the resident levels
+    std::size_t               baseLevel{};     //!< Largest of the levels that always stay in memory
+    std::size_t               residentLevel{}; //!< Largest level in memory
+    std::size_t               wantedLevel{};   //!< Level requested last
+    std::size_t               targetLevel{};   //!< Level chosen by the current update
+    std::uint64_t             lastRequest{};   //!< Number of updates done when the texture was requested last
+};
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::TextureStreamer(std::uint64_t memoryBudget) : m_memoryBudget(memoryBudget)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::TextureStreamer(TextureStreamer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer& TextureStreamer::operator=(TextureStreamer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureStreamer::Handle> TextureStreamer::loadFromFile(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to open streamed texture file\n" << formatDebugPathInfo(filename) << std::endl;
+        return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return add(std::move(data));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureStreamer::Handle> TextureStreamer::loadFromMemory(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    return add(std::vector<std::uint8_t>(bytes, bytes + size));
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::remove(Handle handle)
+{
+    assert(contains(handle) && "Texture is not in the streamer");
+
+    m_entries[handle].reset();
+    m_freeHandles.push_back(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::contains(Handle handle) const
+{
+    return (handle < m_entries.size()) && m_entries[handle];
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureStreamer::getTexture(Handle handle) const
+{
+    return *getEntry(handle).texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::request(Handle handle, const Vector2f& displaySize)
+{
+    Entry& entry = getEntry(handle);
+
+    // Select the smallest level that is at least as large as the texture on screen
+    std::size_t level = 0;
+    while (level < entry.baseLevel)
+    {
+        const Vector2u nextSize = entry.image.levels[level + 1].size;
+        if ((static_cast<float>(nextSize.x) < displaySize.x) || (static_cast<float>(nextSize.y) < displaySize.y))
+            break;
+        ++level;
+    }
+
+    entry.wantedLevel = level;
+    entry.lastRequest = m_updateCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::update()
+{
+    // Give the memory to the textures that were requested most recently first
+    std::vector<Entry*> entries;
+    entries.reserve(m_entries.size());
+    for (const std::unique_ptr<Entry>& entry : m_entries)
+    {
+        if (entry)
+            entries.push_back(entry.get());
+    }
+
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [](const Entry* left, const Entry* right) { return left->lastRequest > right->lastRequest; });
+
+    // The base levels always stay in memory
+    std::uint64_t memoryUsage = 0;
+    for (const Entry* entry : entries)
+        memoryUsage += entry->getMemoryUsage(entry->baseLevel);
+
+    // Each texture gets the level it wants, or the largest one that still fits in the budget
+    for (Entry* entry : entries)
+    {
+        const std::uint64_t baseUsage = entry->getMemoryUsage(entry->baseLevel);
+
+        entry->targetLevel = entry->baseLevel;
+        for (std::size_t level = entry->wantedLevel; level < entry->baseLevel; ++level)
+        {
+            const std::uint64_t extraUsage = entry->getMemoryUsage(level) - baseUsage;
+            if (memoryUsage + extraUsage <= m_memoryBudget)
+            {
+                entry->targetLevel = level;
+                memoryUsage += extraUsage;
+                break;
+            }
+        }
+    }
+
+    // Evict the levels that are no longer needed first, to make room for the new ones
+    for (Entry* entry : entries)
+    {
+        if (entry->targetLevel > entry->residentLevel)
+            setResidentLevel(*entry, entry->targetLevel);
+    }
+
+    // Upload the larger levels, until the limit of this update is reached
+    std::uint64_t uploadSize = 0;
+    for (Entry* entry : entries)
+    {
+        if (entry->targetLevel >= entry->residentLevel)
+            continue;
+
+        const std::uint64_t size = entry->getMemoryUsage(entry->targetLevel);
+        if ((uploadSize > 0) && (uploadSize + size > m_uploadLimit))
+            break;
+
+        if (setResidentLevel(*entry, entry->targetLevel))
+            uploadSize += size;
+    }
+
+    ++m_updateCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getResidentLevel(Handle handle) const
+{
+    return getEntry(handle).residentLevel;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setMemoryBudget(std::uint64_t memoryBudget)
+{
+    m_memoryBudget = memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t TextureStreamer::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t TextureStreamer::getMemoryUsage() const
+{
+    std::uint64_t memoryUsage = 0;
+    for (const std::unique_ptr<Entry>& entry : m_entries)
+    {
+        if (entry)
+            memoryUsage += entry->getMemoryUsage(entry->residentLevel);
+    }
+
+    return memoryUsage;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setUploadLimit(std::uint64_t uploadLimit)
+{
+    m_uploadLimit = uploadLimit;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t TextureStreamer::getUploadLimit() const
+{
+    return m_uploadLimit;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setBaseSize(unsigned int baseSize)
+{
+    m_baseSize = baseSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureStreamer::getBaseSize() const
+{
+    return m_baseSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (const std::unique_ptr<Entry>& entry : m_entries)
+    {
+        if (entry)
+            entry->texture->setSmooth(smooth);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureStreamer::Handle> TextureStreamer::add(std::vector<std::uint8_t>&& data)
+{
+    auto entry  = std::make_unique<Entry>();
+    entry->data = std::move(data);
+
+    auto image = priv::parseCompressedImage(entry->data.data(), entry->data.size());
+    if (!image)
+        return std::nullopt;
+
+    entry->image = std::move(*image);
+
+#ifndef SFML_OPENGL_ES
+
+    // The base levels are the ones that fit in the base size, or at least the smallest one
+    const std::vector<priv::CompressedLevel>& levels = entry->image.levels;
+    entry->baseLevel                                 = levels.size() - 1;
+    while ((entry->baseLevel > 0) && (levels[entry->baseLevel - 1].size.x <= m_baseSize) &&
+           (levels[entry->baseLevel - 1].size.y <= m_baseSize))
+        --entry->baseLevel;
+
+#else
+
+    // OpenGL ES can't skip levels, textures are always fully loaded
+    entry->baseLevel = 0;
+
+#endif
+
+    entry->wantedLevel = entry->baseLevel;
+    entry->lastRequest = m_updateCount;
+    if (!setResidentLevel(*entry, entry->baseLevel))
+        return std::nullopt;
+
+    Handle handle = m_entries.size();
+    if (!m_freeHandles.empty())
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+        m_entries[handle] = std::move(entry);
+    }
+    else
+    {
+        m_entries.push_back(std::move(entry));
+    }
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::Entry& TextureStreamer::getEntry(Handle handle) const
+{
+    assert(contains(handle) && "Texture is not in the streamer");
+    return *m_entries[handle];
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::setResidentLevel(Entry& entry, std::size_t level) const
+{
+    auto texture = Texture::loadCompressedImage(entry.image, level);
+    if (!texture)
+        return false;
+
+    texture->setSmooth(m_isSmooth);
+
+    // Keep the same texture object, so that the sprites using it don't have to be updated
+    if (entry.texture)
+        *entry.texture = std::move(*texture);
+    else
+        entry.texture = std::move(texture);
+
+    entry.residentLevel = level;
+    return true;
+}
+
+} // namespace sf
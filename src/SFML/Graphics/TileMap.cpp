@@ -0,0 +1,308 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TileMapImpl
+{
+// Number of vertices used to draw a tile (two triangles)
+constexpr std::size_t verticesPerTile = 6;
+
+// Get the range of tiles (or chunks) covered by an interval, clamped to [0, count)
+std::pair<unsigned int, unsigned int> getRange(float begin, float end, float unit, unsigned int count)
+{
+    const float first = std::clamp(std::floor(begin / unit), 0.f, static_cast<float>(count));
+    const float last  = std::clamp(std::ceil(end / unit), 0.f, static_cast<float>(count));
+    return {static_cast<unsigned int>(first), static_cast<unsigned int>(last)};
+}
+} // namespace TileMapImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Texture& tileset, const Vector2u& tileSize, const Vector2u& mapSize, unsigned int chunkSize) :
+m_tileset(&tileset),
+m_tileSize(tileSize),
+m_mapSize(mapSize),
+m_chunkSize(chunkSize),
+m_chunkCount((mapSize.x + chunkSize - 1) / chunkSize, (mapSize.y + chunkSize - 1) / chunkSize),
+m_tiles(std::size_t{mapSize.x} * mapSize.y, EmptyTile)
+{
+    assert(tileSize.x > 0 && tileSize.y > 0 && "Tile size must be positive");
+    assert(chunkSize > 0 && "Chunk size must be positive");
+
+    m_chunks.resize(std::size_t{m_chunkCount.x} * m_chunkCount.y);
+
+    for (unsigned int y = 0; y < m_chunkCount.y; ++y)
+    {
+        for (unsigned int x = 0; x < m_chunkCount.x; ++x)
+        {
+            Chunk& chunk    = m_chunks[std::size_t{y} * m_chunkCount.x + x];
+            chunk.firstTile = {x * chunkSize, y * chunkSize};
+            chunk.size      = {std::min(chunkSize, mapSize.x - chunk.firstTile.x),
+                               std::min(chunkSize, mapSize.y - chunk.firstTile.y)};
+            chunk.vertices.resize(std::size_t{chunk.size.x} * chunk.size.y * TileMapImpl::verticesPerTile);
+            chunk.vertexBuffer = VertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Static);
+
+            // Empty tiles are degenerate triangles, the whole chunk is uploaded on first draw
+            chunk.dirtyEnd = chunk.vertices.size();
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(const Vector2u& position, std::uint32_t tile)
+{
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "Tile position is out of bounds");
+
+    std::uint32_t& current = m_tiles[std::size_t{position.y} * m_mapSize.x + position.x];
+    if (current == tile)
+        return;
+
+    // Chunks without any tile are not drawn at all
+    Chunk& chunk = m_chunks[getChunkIndex(position)];
+    if (current == EmptyTile)
+        ++chunk.tileCount;
+    else if (tile == EmptyTile)
+        --chunk.tileCount;
+
+    current = tile;
+    updateTileVertices(position);
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTiles(const std::uint32_t* tiles)
+{
+    assert(tiles && "Tiles must not be a null pointer");
+
+    for (unsigned int y = 0; y < m_mapSize.y; ++y)
+    {
+        for (unsigned int x = 0; x < m_mapSize.x; ++x)
+            setTile({x, y}, tiles[std::size_t{y} * m_mapSize.x + x]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t TileMap::getTile(const Vector2u& position) const
+{
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "Tile position is out of bounds");
+
+    return m_tiles[std::size_t{position.y} * m_mapSize.x + position.x];
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TileMap::getTileset() const
+{
+    return *m_tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getMapSize() const
+{
+    return m_mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getChunkCount() const
+{
+    return m_chunks.size();
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return {{0.f, 0.f}, Vector2f(m_mapSize.cwiseMul(m_tileSize))};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    states.transform *= getTransform();
+    states.texture        = m_tileset;
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Bring the visible area of the view into the local coordinates of the map
+    const FloatRect visibleArea = states.transform.getInverse().transformRect(target.getView().getVisibleArea());
+
+    const Vector2f chunkSize(m_tileSize * m_chunkSize);
+    const auto [firstX, lastX] = TileMapImpl::getRange(visibleArea.left,
+                                                       visibleArea.left + visibleArea.width,
+                                                       chunkSize.x,
+                                                       m_chunkCount.x);
+    const auto [firstY, lastY] = TileMapImpl::getRange(visibleArea.top,
+                                                       visibleArea.top + visibleArea.height,
+                                                       chunkSize.y,
+                                                       m_chunkCount.y);
+
+    for (unsigned int y = firstY; y < lastY; ++y)
+    {
+        for (unsigned int x = firstX; x < lastX; ++x)
+        {
+            Chunk& chunk = m_chunks[std::size_t{y} * m_chunkCount.x + x];
+            if (chunk.tileCount == 0)
+                continue;
+
+            if (chunk.dirtyBegin < chunk.dirtyEnd)
+                uploadChunk(chunk);
+
+            if (chunk.useBuffer)
+                target.draw(chunk.vertexBuffer, states);
+            else
+                target.draw(chunk.vertices.data(), chunk.vertices.size(), PrimitiveType::Triangles, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getChunkIndex(const Vector2u& position) const
+{
+    return std::size_t{position.y / m_chunkSize} * m_chunkCount.x + position.x / m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateTileVertices(const Vector2u& position)
+{
+    Chunk&            chunk  = m_chunks[getChunkIndex(position)];
+    const Vector2u    local  = position - chunk.firstTile;
+    const std::size_t offset = (std::size_t{local.y} * chunk.size.x + local.x) * TileMapImpl::verticesPerTile;
+    Vertex*           tile   = chunk.vertices.data() + offset;
+
+    const std::uint32_t index       = m_tiles[std::size_t{position.y} * m_mapSize.x + position.x];
+    const unsigned int  tilesPerRow = m_tileset->getSize().x / m_tileSize.x;
+
+    if ((index == EmptyTile) || (tilesPerRow == 0))
+    {
+        // Degenerate triangles don't produce any fragment
+        std::fill(tile, tile + TileMapImpl::verticesPerTile, Vertex());
+    }
+    else
+    {
+        const Vector2f size(m_tileSize);
+        const Vector2f topLeft    = Vector2f(position).cwiseMul(size);
+        const Vector2f texTopLeft = Vector2f(Vector2u(index % tilesPerRow, index / tilesPerRow)).cwiseMul(size);
+
+        const Vertex corners[] = {{topLeft, Color::White, texTopLeft},
+                                  {topLeft + Vector2f(size.x, 0), Color::White, texTopLeft + Vector2f(size.x, 0)},
+                                  {topLeft + Vector2f(0, size.y), Color::White, texTopLeft + Vector2f(0, size.y)},
+                                  {topLeft + size, Color::White, texTopLeft + size}};
+
+        tile[0] = corners[0];
+        tile[1] = corners[1];
+        tile[2] = corners[2];
+        tile[3] = corners[2];
+        tile[4] = corners[1];
+        tile[5] = corners[3];
+    }
+
+    // Grow the range of vertices to upload on the next draw
+    if (chunk.dirtyBegin < chunk.dirtyEnd)
+    {
+        chunk.dirtyBegin = std::min(chunk.dirtyBegin, offset);
+        chunk.dirtyEnd   = std::max(chunk.dirtyEnd, offset + TileMapImpl::verticesPerTile);
+    }
+    else
+    {
+        chunk.dirtyBegin = offset;
+        chunk.dirtyEnd   = offset + TileMapImpl::verticesPerTile;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::uploadChunk(Chunk& chunk)
+{
+    const std::size_t begin = chunk.dirtyBegin;
+    const std::size_t end   = chunk.dirtyEnd;
+    chunk.dirtyBegin        = 0;
+    chunk.dirtyEnd          = 0;
+
+    if (!VertexBuffer::isAvailable())
+    {
+        chunk.useBuffer = false;
+        return;
+    }
+
+    // The first upload creates the buffer, the next ones only patch the modified tiles
+    if (chunk.vertexBuffer.getVertexCount() != chunk.vertices.size())
+    {
+        chunk.useBuffer = chunk.vertexBuffer.create(chunk.vertices.size()) &&
+                          chunk.vertexBuffer.update(chunk.vertices.data());
+        return;
+    }
+
+    chunk.useBuffer = chunk.vertexBuffer.update(chunk.vertices.data() + begin,
+                                                end - begin,
+                                                static_cast<unsigned int>(begin));
+}
+
+} // namespace sf
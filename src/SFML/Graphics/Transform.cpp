@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/TransformKernels.hpp>
 
 #include <SFML/System/Angle.hpp>
 
@@ -67,4 +68,15 @@ Transform& Transform::rotate(Angle angle, const Vector2f& center)
     return combine(rotation);
 }
 
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, Vector2f* output, std::size_t count) const
+{
+    priv::transformPoints(*this,
+                          reinterpret_cast<const std::byte*>(points),
+                          reinterpret_cast<std::byte*>(output),
+                          count,
+                          sizeof(Vector2f));
+}
+
 } // namespace sf
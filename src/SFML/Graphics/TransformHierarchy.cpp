@@ -0,0 +1,495 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TransformHierarchy.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+namespace TransformHierarchyImpl
+{
+// Flags telling what has to be recomputed for a slot
+constexpr std::uint8_t localDirty = 1; // The local transform or bounds changed
+constexpr std::uint8_t worldDirty = 2; // The world transform changed, and so do the ones of the descendants
+
+// Same computation as Transformable::getTransform()
+sf::Transform computeTransform(const sf::Vector2f& position,
+                               const sf::Vector2f& origin,
+                               const sf::Vector2f& scale,
+                               sf::Angle           rotation)
+{
+    const float angle  = -rotation.asRadians();
+    const float cosine = std::cos(angle);
+    const float sine   = std::sin(angle);
+    const float sxc    = scale.x * cosine;
+    const float syc    = scale.y * cosine;
+    const float sxs    = scale.x * sine;
+    const float sys    = scale.y * sine;
+    const float tx     = -origin.x * sxc - origin.y * sys + position.x;
+    const float ty     = origin.x * sxs - origin.y * syc + position.y;
+
+    // clang-format off
+    return sf::Transform( sxc, sys, tx,
+                         -sxs, syc, ty,
+                          0.f, 0.f, 1.f);
+    // clang-format on
+}
+} // namespace TransformHierarchyImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TransformHierarchy::TransformHierarchy(float cellSize) : m_grid(cellSize)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TransformHierarchy::Node TransformHierarchy::add(Node parent)
+{
+    assert((parent == NoParent || contains(parent)) && "Parent is not in the hierarchy");
+
+    Node node = m_slots.size();
+    if (!m_freeNodes.empty())
+    {
+        node = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        m_slots.push_back(None);
+    }
+
+    // Nodes are added after all the existing ones, so after their parent
+    m_slots[node] = m_nodes.size();
+    m_nodes.push_back(node);
+    m_parents.push_back((parent == NoParent) ? None : m_slots[parent]);
+    m_positions.emplace_back();
+    m_origins.emplace_back();
+    m_scales.emplace_back(1.f, 1.f);
+    m_rotations.push_back(Angle::Zero);
+    m_bounds.emplace_back();
+    m_locals.emplace_back();
+    m_worlds.emplace_back();
+    m_dirty.push_back(TransformHierarchyImpl::localDirty);
+    m_gridHandles.push_back(None);
+    m_needUpdate = true;
+
+    return node;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::remove(Node node)
+{
+    reorder(markSubtree(getSlot(node)), true);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::clear()
+{
+    m_slots.clear();
+    m_freeNodes.clear();
+    m_nodes.clear();
+    m_parents.clear();
+    m_positions.clear();
+    m_origins.clear();
+    m_scales.clear();
+    m_rotations.clear();
+    m_bounds.clear();
+    m_locals.clear();
+    m_worlds.clear();
+    m_dirty.clear();
+    m_gridHandles.clear();
+    m_gridNodes.clear();
+    m_changedNodes.clear();
+    m_grid.clear();
+    m_needUpdate = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::reserve(std::size_t nodeCount)
+{
+    m_slots.reserve(nodeCount);
+    m_nodes.reserve(nodeCount);
+    m_parents.reserve(nodeCount);
+    m_positions.reserve(nodeCount);
+    m_origins.reserve(nodeCount);
+    m_scales.reserve(nodeCount);
+    m_rotations.reserve(nodeCount);
+    m_bounds.reserve(nodeCount);
+    m_locals.reserve(nodeCount);
+    m_worlds.reserve(nodeCount);
+    m_dirty.reserve(nodeCount);
+    m_gridHandles.reserve(nodeCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformHierarchy::getNodeCount() const
+{
+    return m_nodes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TransformHierarchy::contains(Node node) const
+{
+    return (node < m_slots.size()) && (m_slots[node] != None);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::setParent(Node node, Node parent)
+{
+    assert((parent == NoParent || contains(parent)) && "Parent is not in the hierarchy");
+    assert((parent != node) && "A node can't be its own parent");
+
+    std::size_t slot = getSlot(node);
+
+    // The order stays valid if the new parent comes before the node, otherwise the subtree is moved to the end
+    if ((parent != NoParent) && (m_slots[parent] > slot))
+    {
+        const std::vector<bool> subtree = markSubtree(slot);
+        assert(!subtree[m_slots[parent]] && "A node can't be attached to one of its descendants");
+        reorder(subtree, false);
+        slot = m_slots[node];
+    }
+
+    m_parents[slot] = (parent == NoParent) ? None : m_slots[parent];
+    m_dirty[slot] |= TransformHierarchyImpl::worldDirty;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+TransformHierarchy::Node TransformHierarchy::getParent(Node node) const
+{
+    const std::size_t parent = m_parents[getSlot(node)];
+    return (parent == None) ? NoParent : m_nodes[parent];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::setPosition(Node node, const Vector2f& position)
+{
+    const std::size_t slot = getSlot(node);
+    m_positions[slot]      = position;
+    invalidate(slot);
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& TransformHierarchy::getPosition(Node node) const
+{
+    return m_positions[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::setRotation(Node node, Angle angle)
+{
+    const std::size_t slot = getSlot(node);
+    m_rotations[slot]      = angle.wrapUnsigned();
+    invalidate(slot);
+}
+
+
+////////////////////////////////////////////////////////////
+Angle TransformHierarchy::getRotation(Node node) const
+{
+    return m_rotations[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::setScale(Node node, const Vector2f& factors)
+{
+    const std::size_t slot = getSlot(node);
+    m_scales[slot]         = factors;
+    invalidate(slot);
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& TransformHierarchy::getScale(Node node) const
+{
+    return m_scales[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::setOrigin(Node node, const Vector2f& origin)
+{
+    const std::size_t slot = getSlot(node);
+    m_origins[slot]        = origin;
+    invalidate(slot);
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& TransformHierarchy::getOrigin(Node node) const
+{
+    return m_origins[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::setLocalBounds(Node node, const FloatRect& bounds)
+{
+    const std::size_t slot = getSlot(node);
+    m_bounds[slot]         = bounds;
+    invalidate(slot);
+}
+
+
+////////////////////////////////////////////////////////////
+const FloatRect& TransformHierarchy::getLocalBounds(Node node) const
+{
+    return m_bounds[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& TransformHierarchy::getLocalTransform(Node node) const
+{
+    update();
+    return m_locals[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& TransformHierarchy::getWorldTransform(Node node) const
+{
+    update();
+    return m_worlds[getSlot(node)];
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TransformHierarchy::getWorldBounds(Node node) const
+{
+    update();
+    const std::size_t slot = getSlot(node);
+    return m_worlds[slot].transformRect(m_bounds[slot]);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::update() const
+{
+    using namespace TransformHierarchyImpl;
+
+    if (!m_needUpdate)
+        return;
+
+    m_changedNodes.clear();
+
+    // Parents come before their children, so a single pass sees the changes of the ancestors of every node
+    for (std::size_t slot = 0; slot < m_nodes.size(); ++slot)
+    {
+        const std::size_t parent = m_parents[slot];
+        std::uint8_t      flags  = m_dirty[slot];
+        if ((parent != None) && (m_dirty[parent] & worldDirty))
+            flags |= worldDirty;
+
+        if (flags == 0)
+            continue;
+
+        if (flags & localDirty)
+        {
+            m_locals[slot] = computeTransform(m_positions[slot], m_origins[slot], m_scales[slot], m_rotations[slot]);
+            flags |= worldDirty;
+        }
+
+        m_worlds[slot] = (parent != None) ? m_worlds[parent] * m_locals[slot] : m_locals[slot];
+        m_dirty[slot]  = flags;
+        m_changedNodes.push_back(m_nodes[slot]);
+
+        // Keep the grid in sync with the world bounds
+        const FloatRect& bounds = m_bounds[slot];
+        std::size_t&     handle = m_gridHandles[slot];
+        if ((bounds.width == 0) || (bounds.height == 0))
+        {
+            if (handle != None)
+                m_grid.remove(handle);
+            handle = None;
+        }
+        else if (handle == None)
+        {
+            handle = m_grid.insert(m_worlds[slot].transformRect(bounds));
+            m_gridNodes.resize(std::max(m_gridNodes.size(), handle + 1));
+            m_gridNodes[handle] = m_nodes[slot];
+        }
+        else
+        {
+            m_grid.update(handle, m_worlds[slot].transformRect(bounds));
+        }
+    }
+
+    std::fill(m_dirty.begin(), m_dirty.end(), std::uint8_t{0});
+    m_needUpdate = false;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<TransformHierarchy::Node>& TransformHierarchy::getChangedNodes() const
+{
+    return m_changedNodes;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::query(const FloatRect& area, std::vector<Node>& result) const
+{
+    update();
+
+    m_queryHandles.clear();
+    m_grid.query(area, m_queryHandles);
+    for (const SpatialGrid::Handle handle : m_queryHandles)
+        result.push_back(m_gridNodes[handle]);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::query(const View& view, std::vector<Node>& result) const
+{
+    query(view.getVisibleArea(), result);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformHierarchy::getSlot(Node node) const
+{
+    assert(contains(node) && "Node is not in the hierarchy");
+    return m_slots[node];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::invalidate(std::size_t slot)
+{
+    m_dirty[slot] |= TransformHierarchyImpl::localDirty;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformHierarchy::reorder(const std::vector<bool>& subtree, bool destroy)
+{
+    const std::size_t count = m_nodes.size();
+
+    // Compute the new order of the slots
+    std::vector<std::size_t> order;
+    order.reserve(count);
+    for (std::size_t slot = 0; slot < count; ++slot)
+    {
+        if (!subtree[slot])
+            order.push_back(slot);
+    }
+
+    for (std::size_t slot = 0; slot < count; ++slot)
+    {
+        if (!subtree[slot])
+            continue;
+
+        if (!destroy)
+        {
+            order.push_back(slot);
+            continue;
+        }
+
+        // Remove the destroyed slot from the grid and free its node
+        if (m_gridHandles[slot] != None)
+            m_grid.remove(m_gridHandles[slot]);
+        m_slots[m_nodes[slot]] = None;
+        m_freeNodes.push_back(m_nodes[slot]);
+    }
+
+    std::vector<std::size_t> newSlots(count, None);
+    for (std::size_t i = 0; i < order.size(); ++i)
+        newSlots[order[i]] = i;
+
+    const auto permute = [&order](auto& values)
+    {
+        std::remove_reference_t<decltype(values)> result;
+        result.reserve(order.size());
+        for (const std::size_t slot : order)
+            result.push_back(values[slot]);
+        values.swap(result);
+    };
+
+    permute(m_nodes);
+    permute(m_parents);
+    permute(m_positions);
+    permute(m_origins);
+    permute(m_scales);
+    permute(m_rotations);
+    permute(m_bounds);
+    permute(m_locals);
+    permute(m_worlds);
+    permute(m_dirty);
+    permute(m_gridHandles);
+
+    // Parents of the destroyed slots are destroyed too, so the parents of the remaining slots all have a new slot
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        if (m_parents[i] != None)
+            m_parents[i] = newSlots[m_parents[i]];
+        m_slots[m_nodes[i]] = i;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<bool> TransformHierarchy::markSubtree(std::size_t slot) const
+{
+    // Descendants come after the node, and after their own parent
+    std::vector<bool> subtree(m_nodes.size(), false);
+    subtree[slot] = true;
+    for (std::size_t i = slot + 1; i < m_nodes.size(); ++i)
+    {
+        if ((m_parents[i] != None) && subtree[m_parents[i]])
+            subtree[i] = true;
+    }
+
+    return subtree;
+}
+
+} // namespace sf
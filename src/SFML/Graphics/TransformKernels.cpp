@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/TransformKernels.hpp>
+
+#include <array>
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_TRANSFORM_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SFML_TRANSFORM_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void transformPoints(const Transform& transform,
+                     const std::byte* points,
+                     std::byte*       output,
+                     std::size_t      count,
+                     std::size_t      stride)
+{
+    // Only the 2D affine part of the 4x4 matrix is relevant to 2D points
+    const float* matrix = transform.getMatrix();
+    const float  a      = matrix[0];
+    const float  b      = matrix[1];
+    const float  c      = matrix[4];
+    const float  d      = matrix[5];
+    const float  tx     = matrix[12];
+    const float  ty     = matrix[13];
+
+    std::size_t i = 0;
+
+#if defined(SFML_TRANSFORM_KERNELS_SSE2)
+    // Two points per iteration: [x0 y0 x1 y1] is multiplied by the columns of the matrix
+    // repeated twice, with the same order of operations as transformPoint
+    const __m128 column0     = _mm_setr_ps(a, b, a, b);
+    const __m128 column1     = _mm_setr_ps(c, d, c, d);
+    const __m128 translation = _mm_setr_ps(tx, ty, tx, ty);
+
+    const auto transformPair = [&](__m128 pair)
+    {
+        const __m128 x = _mm_shuffle_ps(pair, pair, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 y = _mm_shuffle_ps(pair, pair, _MM_SHUFFLE(3, 3, 1, 1));
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)), translation);
+    };
+
+    if (stride == 2 * sizeof(float))
+    {
+        // Packed points: load and store both points at once
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128 pair = _mm_loadu_ps(reinterpret_cast<const float*>(points + i * stride));
+            _mm_storeu_ps(reinterpret_cast<float*>(output + i * stride), transformPair(pair));
+        }
+    }
+    else
+    {
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128 pair = _mm_setzero_ps();
+            pair        = _mm_loadl_pi(pair, reinterpret_cast<const __m64*>(points + i * stride));
+            pair        = _mm_loadh_pi(pair, reinterpret_cast<const __m64*>(points + (i + 1) * stride));
+
+            const __m128 result = transformPair(pair);
+            _mm_storel_pi(reinterpret_cast<__m64*>(output + i * stride), result);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(output + (i + 1) * stride), result);
+        }
+    }
+#elif defined(SFML_TRANSFORM_KERNELS_NEON)
+    const float32x2_t column0     = vset_lane_f32(b, vdup_n_f32(a), 1);
+    const float32x2_t column1     = vset_lane_f32(d, vdup_n_f32(c), 1);
+    const float32x2_t translation = vset_lane_f32(ty, vdup_n_f32(tx), 1);
+
+    for (; i < count; ++i)
+    {
+        std::array<float, 2> coordinates{};
+        std::memcpy(coordinates.data(), points + i * stride, sizeof(coordinates));
+
+        const float32x2_t product = vadd_f32(vmul_n_f32(column0, coordinates[0]), vmul_n_f32(column1, coordinates[1]));
+        vst1_f32(coordinates.data(), vadd_f32(product, translation));
+
+        std::memcpy(output + i * stride, coordinates.data(), sizeof(coordinates));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::array<float, 2> coordinates{};
+        std::memcpy(coordinates.data(), points + i * stride, sizeof(coordinates));
+
+        const float x  = coordinates[0];
+        const float y  = coordinates[1];
+        coordinates[0] = a * x + c * y + tx;
+        coordinates[1] = b * x + d * y + ty;
+
+        std::memcpy(output + i * stride, coordinates.data(), sizeof(coordinates));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void computeTransforms(const TransformComponents& components,
+                       std::size_t                begin,
+                       std::size_t                end,
+                       std::byte*                 output,
+                       std::size_t                stride)
+{
+    std::size_t i = begin;
+
+#if defined(SFML_TRANSFORM_KERNELS_SSE2)
+    // Four transforms per iteration, with the same order of operations as the scalar loop
+    const __m128 signMask = _mm_set1_ps(-0.f);
+
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128 positionX = _mm_loadu_ps(components.positionsX + i);
+        const __m128 positionY = _mm_loadu_ps(components.positionsY + i);
+        const __m128 originX   = _mm_loadu_ps(components.originsX + i);
+        const __m128 originY   = _mm_loadu_ps(components.originsY + i);
+        const __m128 scaleX    = _mm_loadu_ps(components.scalesX + i);
+        const __m128 scaleY    = _mm_loadu_ps(components.scalesY + i);
+        const __m128 cosine    = _mm_loadu_ps(components.cosines + i);
+        const __m128 sine      = _mm_loadu_ps(components.sines + i);
+
+        const __m128 sxc = _mm_mul_ps(scaleX, cosine);
+        const __m128 syc = _mm_mul_ps(scaleY, cosine);
+        const __m128 sxs = _mm_mul_ps(scaleX, sine);
+        const __m128 sys = _mm_mul_ps(scaleY, sine);
+        const __m128 nox = _mm_xor_ps(originX, signMask);
+        const __m128 tx  = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(nox, sxc), _mm_mul_ps(originY, sys)), positionX);
+        const __m128 ty  = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(originX, sxs), _mm_mul_ps(originY, syc)), positionY);
+
+        // Transpose the first two columns to get [a b c d] per transform, and interleave the translations
+        __m128 column0 = sxc;
+        __m128 column1 = _mm_xor_ps(sxs, signMask);
+        __m128 column2 = sys;
+        __m128 column3 = syc;
+        _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+        const __m128 translations01 = _mm_unpacklo_ps(tx, ty);
+        const __m128 translations23 = _mm_unpackhi_ps(tx, ty);
+
+        std::byte* matrix = output + (i - begin) * stride;
+        _mm_storeu_ps(reinterpret_cast<float*>(matrix), column0);
+        _mm_storel_pi(reinterpret_cast<__m64*>(matrix + 4 * sizeof(float)), translations01);
+        matrix += stride;
+        _mm_storeu_ps(reinterpret_cast<float*>(matrix), column1);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(matrix + 4 * sizeof(float)), translations01);
+        matrix += stride;
+        _mm_storeu_ps(reinterpret_cast<float*>(matrix), column2);
+        _mm_storel_pi(reinterpret_cast<__m64*>(matrix + 4 * sizeof(float)), translations23);
+        matrix += stride;
+        _mm_storeu_ps(reinterpret_cast<float*>(matrix), column3);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(matrix + 4 * sizeof(float)), translations23);
+    }
+#elif defined(SFML_TRANSFORM_KERNELS_NEON)
+    for (; i + 4 <= end; i += 4)
+    {
+        const float32x4_t positionX = vld1q_f32(components.positionsX + i);
+        const float32x4_t positionY = vld1q_f32(components.positionsY + i);
+        const float32x4_t originX   = vld1q_f32(components.originsX + i);
+        const float32x4_t originY   = vld1q_f32(components.originsY + i);
+        const float32x4_t scaleX    = vld1q_f32(components.scalesX + i);
+        const float32x4_t scaleY    = vld1q_f32(components.scalesY + i);
+        const float32x4_t cosine    = vld1q_f32(components.cosines + i);
+        const float32x4_t sine      = vld1q_f32(components.sines + i);
+
+        const float32x4_t sxc = vmulq_f32(scaleX, cosine);
+        const float32x4_t syc = vmulq_f32(scaleY, cosine);
+        const float32x4_t sxs = vmulq_f32(scaleX, sine);
+        const float32x4_t sys = vmulq_f32(scaleY, sine);
+        const float32x4_t tx  = vaddq_f32(vsubq_f32(vmulq_f32(vnegq_f32(originX), sxc), vmulq_f32(originY, sys)),
+                                         positionX);
+        const float32x4_t ty  = vaddq_f32(vsubq_f32(vmulq_f32(originX, sxs), vmulq_f32(originY, syc)), positionY);
+
+        // Store the columns and scatter them transform by transform
+        std::array<std::array<float, 4>, 6> columns{};
+        vst1q_f32(columns[0].data(), sxc);
+        vst1q_f32(columns[1].data(), vnegq_f32(sxs));
+        vst1q_f32(columns[2].data(), sys);
+        vst1q_f32(columns[3].data(), syc);
+        vst1q_f32(columns[4].data(), tx);
+        vst1q_f32(columns[5].data(), ty);
+
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            const std::array<float, 6> matrix{columns[0][j],
+                                              columns[1][j],
+                                              columns[2][j],
+                                              columns[3][j],
+                                              columns[4][j],
+                                              columns[5][j]};
+            std::memcpy(output + (i + j - begin) * stride, matrix.data(), sizeof(matrix));
+        }
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        const float sxc = components.scalesX[i] * components.cosines[i];
+        const float syc = components.scalesY[i] * components.cosines[i];
+        const float sxs = components.scalesX[i] * components.sines[i];
+        const float sys = components.scalesY[i] * components.sines[i];
+        const float tx  = -components.originsX[i] * sxc - components.originsY[i] * sys + components.positionsX[i];
+        const float ty  = components.originsX[i] * sxs - components.originsY[i] * syc + components.positionsY[i];
+
+        const std::array<float, 6> matrix{sxc, -sxs, sys, syc, tx, ty};
+        std::memcpy(output + (i - begin) * stride, matrix.data(), sizeof(matrix));
+    }
+}
+
+} // namespace sf::priv
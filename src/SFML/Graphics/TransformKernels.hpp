@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+namespace sf
+{
+class Transform;
+}
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Transform 2D points stored at a regular interval
+///
+/// This allows transforming the positions of an array of
+/// vertices without touching their other attributes. Each
+/// point is two consecutive floats; \a output may be the same
+/// memory as \a points.
+///
+/// \param transform Transform to apply
+/// \param points    Address of the first point to transform
+/// \param output    Address receiving the first transformed point
+/// \param count     Number of points to transform
+/// \param stride    Distance between two consecutive points, in bytes
+///
+////////////////////////////////////////////////////////////
+void transformPoints(const Transform& transform,
+                     const std::byte* points,
+                     std::byte*       output,
+                     std::size_t      count,
+                     std::size_t      stride);
+
+////////////////////////////////////////////////////////////
+/// \brief Components of transforms stored in separate arrays
+///
+////////////////////////////////////////////////////////////
+struct TransformComponents
+{
+    const float* positionsX{}; //!< Horizontal position of each transform
+    const float* positionsY{}; //!< Vertical position of each transform
+    const float* originsX{};   //!< Horizontal origin of each transform
+    const float* originsY{};   //!< Vertical origin of each transform
+    const float* scalesX{};    //!< Horizontal scale factor of each transform
+    const float* scalesY{};    //!< Vertical scale factor of each transform
+    const float* cosines{};    //!< Cosine of the opposite of each rotation
+    const float* sines{};      //!< Sine of the opposite of each rotation
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the affine matrices of a range of transforms
+///
+/// The computation is the same as sf::Transformable::getTransform.
+/// Each matrix is written as 6 floats, its three columns
+/// a b, c d and tx ty, at \a output + (index - \a begin) * \a stride.
+///
+/// \param components Components of the transforms
+/// \param begin      Index of the first transform to compute
+/// \param end        Index past the last transform to compute
+/// \param output     Address receiving the matrix of index \a begin
+/// \param stride     Distance between two consecutive matrices, in bytes
+///
+////////////////////////////////////////////////////////////
+void computeTransforms(const TransformComponents& components,
+                       std::size_t                begin,
+                       std::size_t                end,
+                       std::byte*                 output,
+                       std::size_t                stride);
+
+} // namespace sf::priv
@@ -0,0 +1,333 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParallelFor.hpp>
+#include <SFML/Graphics/TransformKernels.hpp>
+#include <SFML/Graphics/TransformPool.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TransformPool::Handle TransformPool::add()
+{
+    Handle handle = m_indices.size();
+    if (!m_freeHandles.empty())
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+    else
+    {
+        m_indices.push_back(None);
+    }
+
+    m_indices[handle] = m_handles.size();
+    m_handles.push_back(handle);
+    m_positionsX.push_back(0.f);
+    m_positionsY.push_back(0.f);
+    m_originsX.push_back(0.f);
+    m_originsY.push_back(0.f);
+    m_scalesX.push_back(1.f);
+    m_scalesY.push_back(1.f);
+    m_cosines.push_back(1.f);
+    m_sines.push_back(0.f);
+    m_rotations.push_back(Angle::Zero);
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::remove(Handle handle)
+{
+    const std::size_t index = getSlot(handle);
+    const std::size_t last  = m_handles.size() - 1;
+
+    // Move the last transform into the hole to keep the arrays contiguous
+    const auto moveLast = [index](auto& values)
+    {
+        values[index] = values.back();
+        values.pop_back();
+    };
+
+    moveLast(m_handles);
+    moveLast(m_positionsX);
+    moveLast(m_positionsY);
+    moveLast(m_originsX);
+    moveLast(m_originsY);
+    moveLast(m_scalesX);
+    moveLast(m_scalesY);
+    moveLast(m_cosines);
+    moveLast(m_sines);
+    moveLast(m_rotations);
+
+    if (index != last)
+        m_indices[m_handles[index]] = index;
+    m_indices[handle] = None;
+    m_freeHandles.push_back(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::clear()
+{
+    m_indices.clear();
+    m_freeHandles.clear();
+    m_handles.clear();
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_originsX.clear();
+    m_originsY.clear();
+    m_scalesX.clear();
+    m_scalesY.clear();
+    m_cosines.clear();
+    m_sines.clear();
+    m_rotations.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::reserve(std::size_t count)
+{
+    m_indices.reserve(count);
+    m_handles.reserve(count);
+    m_positionsX.reserve(count);
+    m_positionsY.reserve(count);
+    m_originsX.reserve(count);
+    m_originsY.reserve(count);
+    m_scalesX.reserve(count);
+    m_scalesY.reserve(count);
+    m_cosines.reserve(count);
+    m_sines.reserve(count);
+    m_rotations.reserve(count);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformPool::getSize() const
+{
+    return m_handles.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TransformPool::contains(Handle handle) const
+{
+    return (handle < m_indices.size()) && (m_indices[handle] != None);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformPool::getIndex(Handle handle) const
+{
+    return getSlot(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+TransformPool::Handle TransformPool::getHandle(std::size_t index) const
+{
+    assert(index < m_handles.size() && "Index is out of range");
+    return m_handles[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::setPosition(Handle handle, const Vector2f& position)
+{
+    const std::size_t index = getSlot(handle);
+    m_positionsX[index]     = position.x;
+    m_positionsY[index]     = position.y;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f TransformPool::getPosition(Handle handle) const
+{
+    const std::size_t index = getSlot(handle);
+    return {m_positionsX[index], m_positionsY[index]};
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::setRotation(Handle handle, Angle angle)
+{
+    const std::size_t index = getSlot(handle);
+    m_rotations[index]      = angle.wrapUnsigned();
+
+    const float radians = -m_rotations[index].asRadians();
+    m_cosines[index]    = std::cos(radians);
+    m_sines[index]      = std::sin(radians);
+}
+
+
+////////////////////////////////////////////////////////////
+Angle TransformPool::getRotation(Handle handle) const
+{
+    return m_rotations[getSlot(handle)];
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::setScale(Handle handle, const Vector2f& factors)
+{
+    const std::size_t index = getSlot(handle);
+    m_scalesX[index]        = factors.x;
+    m_scalesY[index]        = factors.y;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f TransformPool::getScale(Handle handle) const
+{
+    const std::size_t index = getSlot(handle);
+    return {m_scalesX[index], m_scalesY[index]};
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::setOrigin(Handle handle, const Vector2f& origin)
+{
+    const std::size_t index = getSlot(handle);
+    m_originsX[index]       = origin.x;
+    m_originsY[index]       = origin.y;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f TransformPool::getOrigin(Handle handle) const
+{
+    const std::size_t index = getSlot(handle);
+    return {m_originsX[index], m_originsY[index]};
+}
+
+
+////////////////////////////////////////////////////////////
+Transform TransformPool::getTransform(Handle handle) const
+{
+    const priv::TransformComponents components{m_positionsX.data(),
+                                               m_positionsY.data(),
+                                               m_originsX.data(),
+                                               m_originsY.data(),
+                                               m_scalesX.data(),
+                                               m_scalesY.data(),
+                                               m_cosines.data(),
+                                               m_sines.data()};
+
+    const std::size_t             index = getSlot(handle);
+    std::array<float, MatrixSize> matrix{};
+    priv::computeTransforms(components, index, index + 1, reinterpret_cast<std::byte*>(matrix.data()), sizeof(matrix));
+
+    // clang-format off
+    return {matrix[0], matrix[2], matrix[4],
+            matrix[1], matrix[3], matrix[5],
+            0.f,       0.f,       1.f};
+    // clang-format on
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::computeAll(std::byte* output, std::size_t stride, ExecutionPolicy policy) const
+{
+    assert(stride >= MatrixSize * sizeof(float) && "Stride is smaller than a matrix");
+
+    const priv::TransformComponents components{m_positionsX.data(),
+                                               m_positionsY.data(),
+                                               m_originsX.data(),
+                                               m_originsY.data(),
+                                               m_scalesX.data(),
+                                               m_scalesY.data(),
+                                               m_cosines.data(),
+                                               m_sines.data()};
+
+    priv::forEachRange(policy,
+                       m_handles.size(),
+                       stride,
+                       [&](std::size_t begin, std::size_t end)
+                       { priv::computeTransforms(components, begin, end, output + begin * stride, stride); });
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformPool::computeAll(std::vector<Transform>& output, ExecutionPolicy policy) const
+{
+    output.resize(m_handles.size());
+
+    const priv::TransformComponents components{m_positionsX.data(),
+                                               m_positionsY.data(),
+                                               m_originsX.data(),
+                                               m_originsY.data(),
+                                               m_scalesX.data(),
+                                               m_scalesY.data(),
+                                               m_cosines.data(),
+                                               m_sines.data()};
+
+    priv::forEachRange(policy,
+                       m_handles.size(),
+                       sizeof(Transform),
+                       [&](std::size_t begin, std::size_t end)
+                       {
+                           // Compute the matrices by small batches, then expand them to 4x4
+                           constexpr std::size_t                     batchSize = 64;
+                           std::array<float, batchSize * MatrixSize> matrices{};
+                           auto* const batch = reinterpret_cast<std::byte*>(matrices.data());
+                           for (std::size_t first = begin; first < end; first += batchSize)
+                           {
+                               const std::size_t last = std::min(first + batchSize, end);
+                               priv::computeTransforms(components, first, last, batch, MatrixSize * sizeof(float));
+
+                               for (std::size_t i = first; i < last; ++i)
+                               {
+                                   const float* matrix = matrices.data() + (i - first) * MatrixSize;
+                                   // clang-format off
+                                   output[i] = Transform(matrix[0], matrix[2], matrix[4],
+                                                         matrix[1], matrix[3], matrix[5],
+                                                         0.f,       0.f,       1.f);
+                                   // clang-format on
+                               }
+                           }
+                       });
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformPool::getSlot(Handle handle) const
+{
+    assert(contains(handle) && "Handle is not in the pool");
+    return m_indices[handle];
+}
+
+} // namespace sf
@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace UniformBufferImpl
+{
+GLenum usageToGlEnum(sf::UniformBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::UniformBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::UniformBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+} // namespace UniformBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(UniformBuffer&& source) noexcept :
+m_buffer(std::exchange(source.m_buffer, 0U)),
+m_size(std::exchange(source.m_size, 0U)),
+m_usage(source.m_usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(UniformBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    UniformBuffer temp(std::move(right));
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::create(std::size_t size)
+{
+    if (!isAvailable())
+        return false;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create uniform buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                               static_cast<GLsizeiptrARB>(size),
+                               nullptr,
+                               UniformBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    m_size = size;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t size, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!data)
+        return false;
+
+    if (offset + size > m_size)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+
+    // Orphan the buffer if it is overwritten entirely
+    if (size == m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                                   static_cast<GLsizeiptrARB>(m_size),
+                                   nullptr,
+                                   UniformBufferImpl::usageToGlEnum(m_usage)));
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_UNIFORM_BUFFER,
+                                  static_cast<GLintptrARB>(offset),
+                                  static_cast<GLsizeiptrARB>(size),
+                                  data));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::swap(UniformBuffer& right) noexcept
+{
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_size, right.m_size);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::Usage UniformBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return Shader::isAvailable() && VertexBuffer::isAvailable() && GLEXT_uniform_buffer_object;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(UniformBuffer& left, UniformBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
@@ -25,12 +25,53 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParallelFor.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 
+#include <algorithm>
+
 #include <cassert>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+void computeBounds(const sf::Vertex* vertices, std::size_t vertexCount, sf::Vector2f& min, sf::Vector2f& max)
+{
+    min = vertices[0].position;
+    max = vertices[0].position;
+
+    for (std::size_t i = 1; i < vertexCount; ++i)
+    {
+        const sf::Vector2f position = vertices[i].position;
+
+        // Update left and right
+        if (position.x < min.x)
+            min.x = position.x;
+        else if (position.x > max.x)
+            max.x = position.x;
+
+        // Update top and bottom
+        if (position.y < min.y)
+            min.y = position.y;
+        else if (position.y > max.y)
+            max.y = position.y;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void extendBounds(sf::Vector2f position, sf::Vector2f& min, sf::Vector2f& max)
+{
+    min.x = std::min(min.x, position.x);
+    min.y = std::min(min.y, position.y);
+    max.x = std::max(max.x, position.x);
+    max.y = std::max(max.y, position.y);
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -50,6 +91,9 @@ std::size_t VertexArray::getVertexCount() const
 Vertex& VertexArray::operator[](std::size_t index)
 {
     assert(index < m_vertices.size() && "Index is out of bounds");
+
+    // The caller may modify the position of the vertex
+    invalidateBounds(index);
     return m_vertices[index];
 }
 
@@ -66,13 +110,31 @@ const Vertex& VertexArray::operator[](std::size_t index) const
 void VertexArray::clear()
 {
     m_vertices.clear();
+    m_bounds.valid = false;
+    m_chunkBounds.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
 void VertexArray::resize(std::size_t vertexCount)
 {
+    const std::size_t previousCount = m_vertices.size();
     m_vertices.resize(vertexCount);
+
+    // New vertices are at the origin, removed ones may have defined the bounds
+    if (vertexCount < previousCount || previousCount == 0)
+        m_bounds.valid = false;
+    else if (vertexCount > previousCount && m_bounds.valid)
+        extendBounds(Vertex{}.position, m_bounds.min, m_bounds.max);
+
+    if (m_chunkSize)
+    {
+        // New chunks are computed on demand, like the one where the size changed
+        const std::size_t boundary = std::min(previousCount, vertexCount) / m_chunkSize;
+        m_chunkBounds.resize(getChunkCount());
+        if (boundary < m_chunkBounds.size())
+            m_chunkBounds[boundary].valid = false;
+    }
 }
 
 
@@ -80,6 +142,41 @@ void VertexArray::resize(std::size_t vertexCount)
 void VertexArray::append(const Vertex& vertex)
 {
     m_vertices.push_back(vertex);
+
+    if (m_vertices.size() == 1)
+        m_bounds = {vertex.position, vertex.position, true};
+    else if (m_bounds.valid)
+        extendBounds(vertex.position, m_bounds.min, m_bounds.max);
+
+    if (m_chunkSize)
+    {
+        const std::size_t chunk = (m_vertices.size() - 1) / m_chunkSize;
+        if (chunk == m_chunkBounds.size())
+            m_chunkBounds.push_back({vertex.position, vertex.position, true});
+        else if (m_chunkBounds[chunk].valid)
+            extendBounds(vertex.position, m_chunkBounds[chunk].min, m_chunkBounds[chunk].max);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexArray::generate(std::size_t                                      instanceCount,
+                           std::size_t                                      verticesPerInstance,
+                           const std::function<void(std::size_t, Vertex*)>& generator,
+                           ExecutionPolicy                                  policy)
+{
+    m_vertices.resize(instanceCount * verticesPerInstance);
+    m_bounds.valid = false;
+    m_chunkBounds.assign(getChunkCount(), Bounds{});
+
+    priv::forEachRange(policy,
+                       instanceCount,
+                       verticesPerInstance * sizeof(Vertex),
+                       [&](std::size_t begin, std::size_t end)
+                       {
+                           for (std::size_t i = begin; i < end; ++i)
+                               generator(i, m_vertices.data() + i * verticesPerInstance);
+                       });
 }
 
 
@@ -100,45 +197,98 @@ PrimitiveType VertexArray::getPrimitiveType() const
 ////////////////////////////////////////////////////////////
 FloatRect VertexArray::getBounds() const
 {
-    if (!m_vertices.empty())
+    // Array is empty
+    if (m_vertices.empty())
+        return {};
+
+    if (!m_bounds.valid)
     {
-        float left   = m_vertices[0].position.x;
-        float top    = m_vertices[0].position.y;
-        float right  = m_vertices[0].position.x;
-        float bottom = m_vertices[0].position.y;
-
-        for (std::size_t i = 1; i < m_vertices.size(); ++i)
-        {
-            const Vector2f position = m_vertices[i].position;
-
-            // Update left and right
-            if (position.x < left)
-                left = position.x;
-            else if (position.x > right)
-                right = position.x;
-
-            // Update top and bottom
-            if (position.y < top)
-                top = position.y;
-            else if (position.y > bottom)
-                bottom = position.y;
-        }
-
-        return {{left, top}, {right - left, bottom - top}};
+        computeBounds(m_vertices.data(), m_vertices.size(), m_bounds.min, m_bounds.max);
+        m_bounds.valid = true;
     }
-    else
+
+    return {m_bounds.min, m_bounds.max - m_bounds.min};
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexArray::setChunkSize(std::size_t vertexCount)
+{
+    m_chunkSize = vertexCount;
+    m_chunkBounds.assign(getChunkCount(), Bounds{});
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexArray::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexArray::getChunkCount() const
+{
+    return m_chunkSize ? (m_vertices.size() + m_chunkSize - 1) / m_chunkSize : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect VertexArray::getChunkBounds(std::size_t chunk) const
+{
+    assert(chunk < m_chunkBounds.size() && "Chunk is out of bounds");
+
+    Bounds& bounds = m_chunkBounds[chunk];
+    if (!bounds.valid)
     {
-        // Array is empty
-        return {};
+        const std::size_t first = chunk * m_chunkSize;
+        const std::size_t count = std::min(m_chunkSize, m_vertices.size() - first);
+        computeBounds(m_vertices.data() + first, count, bounds.min, bounds.max);
+        bounds.valid = true;
     }
+
+    return {bounds.min, bounds.max - bounds.min};
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexArray::invalidateBounds(std::size_t index)
+{
+    m_bounds.valid = false;
+    if (m_chunkSize)
+        m_chunkBounds[index / m_chunkSize].valid = false;
 }
 
 
 ////////////////////////////////////////////////////////////
 void VertexArray::draw(RenderTarget& target, RenderStates states) const
 {
-    if (!m_vertices.empty())
+    if (m_vertices.empty())
+        return;
+
+    // Chunks can only be skipped when their primitives don't depend on the other vertices
+    const bool independentPrimitives = (m_primitiveType == PrimitiveType::Points) ||
+                                       (m_primitiveType == PrimitiveType::Lines) ||
+                                       (m_primitiveType == PrimitiveType::Triangles);
+    if (!m_chunkSize || !independentPrimitives || !target.isCullingEnabled())
+    {
         target.draw(m_vertices.data(), m_vertices.size(), m_primitiveType, states);
+        return;
+    }
+
+    // Draw the consecutive visible chunks together
+    const std::size_t chunkCount = getChunkCount();
+    std::size_t       runBegin   = 0;
+    for (std::size_t chunk = 0; chunk <= chunkCount; ++chunk)
+    {
+        if (chunk < chunkCount && !target.cull(getChunkBounds(chunk), states.transform))
+            continue;
+
+        const std::size_t runEnd = std::min(chunk * m_chunkSize, m_vertices.size());
+        if (runEnd > runBegin)
+            target.draw(m_vertices.data() + runBegin, runEnd - runBegin, m_primitiveType, states);
+        runBegin = runEnd + m_chunkSize;
+    }
 }
 
 } // namespace sf
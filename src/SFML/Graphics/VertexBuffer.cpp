@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuMemoryTracker.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
@@ -36,6 +37,7 @@
 #include <ostream>
 #include <utility>
 
+#include <cassert>
 #include <cstddef>
 #include <cstring>
 
@@ -85,7 +87,8 @@ VertexBuffer::VertexBuffer(PrimitiveType type, Usage usage) : m_primitiveType(ty
 VertexBuffer::VertexBuffer(const VertexBuffer& copy) :
 GlResource(copy),
 m_primitiveType(copy.m_primitiveType),
-m_usage(copy.m_usage)
+m_usage(copy.m_usage),
+m_layout(copy.m_layout)
 {
     if (copy.m_buffer && copy.m_size)
     {
@@ -106,6 +109,8 @@ VertexBuffer::~VertexBuffer()
 {
     if (m_buffer)
     {
+        priv::setGpuMemoryUsage(GpuMemory::Category::VertexBuffer, m_memoryUsage, 0);
+
         const TransientContextLock contextLock;
 
         glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
@@ -116,6 +121,8 @@ VertexBuffer::~VertexBuffer()
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::create(std::size_t vertexCount)
 {
+    assert(!m_mapped && "Vertex buffer must be unmapped before being created again");
+
     if (!isAvailable())
         return false;
 
@@ -132,12 +139,13 @@ bool VertexBuffer::create(std::size_t vertexCount)
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                               static_cast<GLsizeiptrARB>(m_layout.getStride() * vertexCount),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
     m_size = vertexCount;
+    priv::setGpuMemoryUsage(GpuMemory::Category::VertexBuffer, m_memoryUsage, m_layout.getStride() * vertexCount);
 
     return true;
 }
@@ -160,6 +168,17 @@ bool VertexBuffer::update(const Vertex* vertices)
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset)
 {
+    assert(m_layout.isDefault() && "Vertex buffer must use the default layout to be updated from sf::Vertex instances");
+
+    return update(static_cast<const void*>(vertices), vertexCount, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const void* vertices, std::size_t vertexCount, unsigned int offset)
+{
+    assert(!m_mapped && "Vertex buffer must be unmapped before being updated");
+
     // Sanity checks
     if (!m_buffer)
         return false;
@@ -172,22 +191,25 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     const TransientContextLock contextLock;
 
+    const std::size_t stride = m_layout.getStride();
+
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
 
     // Check if we need to resize or orphan the buffer
     if (vertexCount >= m_size)
     {
         glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                   static_cast<GLsizeiptrARB>(stride * vertexCount),
                                    nullptr,
                                    VertexBufferImpl::usageToGlEnum(m_usage)));
 
         m_size = vertexCount;
+        priv::setGpuMemoryUsage(GpuMemory::Category::VertexBuffer, m_memoryUsage, stride * vertexCount);
     }
 
     glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                  static_cast<GLintptrARB>(stride * offset),
+                                  static_cast<GLsizeiptrARB>(stride * vertexCount),
                                   vertices));
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
@@ -210,6 +232,8 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     const TransientContextLock contextLock;
 
+    const std::size_t size = vertexBuffer.m_layout.getStride() * vertexBuffer.m_size;
+
     // Make sure that extensions are initialized
     sf::priv::ensureExtensionsInit();
 
@@ -222,7 +246,7 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
                                           GLEXT_GL_COPY_WRITE_BUFFER,
                                           0,
                                           0,
-                                          static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
+                                          static_cast<GLsizeiptr>(size)));
 
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
@@ -232,9 +256,10 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
+                               static_cast<GLsizeiptrARB>(size),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
+    priv::setGpuMemoryUsage(GpuMemory::Category::VertexBuffer, m_memoryUsage, size);
 
     void* destination = nullptr;
     glCheck(destination = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_WRITE_ONLY));
@@ -244,7 +269,7 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     void* source = nullptr;
     glCheck(source = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
 
-    std::memcpy(destination, source, sizeof(Vertex) * vertexBuffer.m_size);
+    std::memcpy(destination, source, size);
 
     GLboolean sourceResult = GL_FALSE;
     glCheck(sourceResult = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
@@ -262,6 +287,115 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 }
 
 
+////////////////////////////////////////////////////////////
+Vertex* VertexBuffer::map([[maybe_unused]] std::size_t offset,
+                          [[maybe_unused]] std::size_t vertexCount,
+                          [[maybe_unused]] MapMode     mode)
+{
+#ifdef SFML_OPENGL_ES
+
+    return nullptr;
+
+#else
+
+    assert(m_layout.isDefault() && "Vertex buffer must use the default layout to be mapped");
+
+    if (!m_buffer || m_mapped || !vertexCount || (offset + vertexCount > m_size))
+        return nullptr;
+
+    const TransientContextLock contextLock;
+
+    // Make sure that extensions are initialized
+    sf::priv::ensureExtensionsInit();
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    const bool wholeBuffer = (vertexCount == m_size);
+    void*      mapping     = nullptr;
+
+    if (GLEXT_map_buffer_range)
+    {
+        GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT;
+
+        if (mode == MapMode::Discard)
+            flags |= wholeBuffer ? GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT : GLEXT_GL_MAP_INVALIDATE_RANGE_BIT;
+        else if (mode == MapMode::Unsynchronized)
+            flags |= GLEXT_GL_MAP_UNSYNCHRONIZED_BIT;
+
+        glCheck(mapping = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                 static_cast<GLintptr>(sizeof(Vertex) * offset),
+                                                 static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                                                 flags));
+    }
+    else
+    {
+        // Without ranges the whole buffer is mapped, orphaning it is the only way not to wait for the GPU
+        if ((mode == MapMode::Discard) && wholeBuffer)
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                       static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_size),
+                                       nullptr,
+                                       VertexBufferImpl::usageToGlEnum(m_usage)));
+        }
+
+        glCheck(mapping = GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_WRITE_ONLY));
+
+        if (mapping)
+            mapping = static_cast<Vertex*>(mapping) + offset;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    if (!mapping)
+    {
+        err() << "Failed to map vertex buffer" << std::endl;
+        return nullptr;
+    }
+
+    m_mapped = true;
+
+    return static_cast<Vertex*>(mapping);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::unmap()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!m_mapped)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    GLboolean result = GL_FALSE;
+    glCheck(result = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    m_mapped = false;
+
+    return result == GL_TRUE;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::isMapped() const
+{
+    return m_mapped;
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 {
@@ -280,6 +414,9 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_mapped, right.m_mapped);
+    std::swap(m_layout, right.m_layout);
+    std::swap(m_memoryUsage, right.m_memoryUsage);
 }
 
 
@@ -316,6 +453,24 @@ PrimitiveType VertexBuffer::getPrimitiveType() const
 }
 
 
+////////////////////////////////////////////////////////////
+void VertexBuffer::setLayout(const VertexLayout& layout)
+{
+    assert(!m_mapped && "Vertex buffer must be unmapped before its layout is changed");
+
+    // The allocated memory doesn't change, only the number of vertices that it holds
+    m_size   = m_size * m_layout.getStride() / layout.getStride();
+    m_layout = layout;
+}
+
+
+////////////////////////////////////////////////////////////
+const VertexLayout& VertexBuffer::getLayout() const
+{
+    return m_layout;
+}
+
+
 ////////////////////////////////////////////////////////////
 void VertexBuffer::setUsage(Usage usage)
 {
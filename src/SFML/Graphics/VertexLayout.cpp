@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
+
+#include <utility>
+
+#include <cassert>
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace VertexLayoutImpl
+{
+// Position and texture coordinates are 2D vectors of shorts or floats, like the fixed-function pipeline accepts
+[[maybe_unused]] bool isValidVector(const sf::VertexLayout::Attribute& attribute)
+{
+    using Type = sf::VertexLayout::Type;
+    return (attribute.componentCount == 2) && !attribute.normalized &&
+           ((attribute.type == Type::Int16) || (attribute.type == Type::Float));
+}
+
+// Colors are either normalized bytes or floats
+[[maybe_unused]] bool isValidColor(const sf::VertexLayout::Attribute& attribute)
+{
+    using Type = sf::VertexLayout::Type;
+    return (attribute.componentCount == 4) && ((attribute.type == Type::UInt8 && attribute.normalized) ||
+                                               (attribute.type == Type::Float && !attribute.normalized));
+}
+
+// The components of an attribute must lie within the vertex
+[[maybe_unused]] bool fitsInVertex(const sf::VertexLayout::Attribute& attribute, std::size_t stride)
+{
+    return attribute.offset + attribute.componentCount * sf::VertexLayout::getTypeSize(attribute.type) <= stride;
+}
+} // namespace VertexLayoutImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+VertexLayout::VertexLayout() :
+m_stride(sizeof(Vertex)),
+m_position{Type::Float, 2, offsetof(Vertex, position), false},
+m_color{Type::UInt8, 4, offsetof(Vertex, color), true},
+m_texCoords{Type::Float, 2, offsetof(Vertex, texCoords), false}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VertexLayout::VertexLayout(std::size_t      stride,
+                           const Attribute& position,
+                           const Attribute& color,
+                           const Attribute& texCoords) :
+m_stride(stride),
+m_position(position),
+m_color(color),
+m_texCoords(texCoords)
+{
+    assert(VertexLayoutImpl::isValidVector(position) && "VertexLayout::VertexLayout() Invalid position format");
+    assert(VertexLayoutImpl::isValidColor(color) && "VertexLayout::VertexLayout() Invalid color format");
+    assert(VertexLayoutImpl::isValidVector(texCoords) &&
+           "VertexLayout::VertexLayout() Invalid texture coordinates format");
+    assert(VertexLayoutImpl::fitsInVertex(position, stride) && VertexLayoutImpl::fitsInVertex(color, stride) &&
+           VertexLayoutImpl::fitsInVertex(texCoords, stride) &&
+           "VertexLayout::VertexLayout() Attribute exceeds the stride");
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexLayout::addAttribute(std::string name, const Attribute& attribute)
+{
+    assert((attribute.componentCount >= 1) && (attribute.componentCount <= 4) &&
+           "VertexLayout::addAttribute() Attributes have 1 to 4 components");
+    assert(VertexLayoutImpl::fitsInVertex(attribute, m_stride) &&
+           "VertexLayout::addAttribute() Attribute exceeds the stride");
+
+    m_customAttributes.push_back({std::move(name), attribute});
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexLayout::getStride() const
+{
+    return m_stride;
+}
+
+
+////////////////////////////////////////////////////////////
+const VertexLayout::Attribute& VertexLayout::getPosition() const
+{
+    return m_position;
+}
+
+
+////////////////////////////////////////////////////////////
+const VertexLayout::Attribute& VertexLayout::getColor() const
+{
+    return m_color;
+}
+
+
+////////////////////////////////////////////////////////////
+const VertexLayout::Attribute& VertexLayout::getTexCoords() const
+{
+    return m_texCoords;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<VertexLayout::CustomAttribute>& VertexLayout::getCustomAttributes() const
+{
+    return m_customAttributes;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexLayout::isDefault() const
+{
+    const auto isSame = [](const Attribute& left, const Attribute& right)
+    {
+        return (left.type == right.type) && (left.componentCount == right.componentCount) &&
+               (left.offset == right.offset) && (left.normalized == right.normalized);
+    };
+
+    static const VertexLayout defaultLayout;
+    return (m_stride == defaultLayout.m_stride) && isSame(m_position, defaultLayout.m_position) &&
+           isSame(m_color, defaultLayout.m_color) && isSame(m_texCoords, defaultLayout.m_texCoords) &&
+           m_customAttributes.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexLayout::getTypeSize(Type type)
+{
+    switch (type)
+    {
+        case Type::Int8:
+        case Type::UInt8:
+            return 1;
+        case Type::Int16:
+        case Type::UInt16:
+            return 2;
+        case Type::Float:
+            return 4;
+    }
+
+    return 0;
+}
+
+} // namespace sf
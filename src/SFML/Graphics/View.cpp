@@ -183,6 +183,14 @@ const Transform& View::getTransform() const
 }
 
 
+////////////////////////////////////////////////////////////
+FloatRect View::getVisibleArea() const
+{
+    // The inverse projection maps the normalized device coordinates back to the scene
+    return getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+}
+
+
 ////////////////////////////////////////////////////////////
 const Transform& View::getInverseTransform() const
 {
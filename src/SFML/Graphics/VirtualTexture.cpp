@@ -0,0 +1,837 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/QoiImage.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/VirtualTexture.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+namespace VirtualTextureImpl
+{
+// Timestamp of the tiles that are never evicted from the cache
+constexpr std::uint64_t pinned = std::numeric_limits<std::uint64_t>::max();
+
+// Size of a level of the pyramid, each level being half the size of the previous one, rounded up
+sf::Vector2u getLevelSize(sf::Vector2u size, unsigned int level)
+{
+    return {((size.x - 1) >> level) + 1, ((size.y - 1) >> level) + 1};
+}
+
+
+// Number of tiles a level of the pyramid is made of
+sf::Vector2u getTileCount(sf::Vector2u size, unsigned int level, unsigned int tileSize)
+{
+    const sf::Vector2u levelSize = getLevelSize(size, level);
+    return {(levelSize.x + tileSize - 1) / tileSize, (levelSize.y + tileSize - 1) / tileSize};
+}
+
+
+// Number of levels of the pyramid, down to a level made of a single tile
+unsigned int getLevelCount(sf::Vector2u size, unsigned int tileSize)
+{
+    unsigned int levelCount = 1;
+    while (getTileCount(size, levelCount - 1, tileSize) != sf::Vector2u(1, 1))
+        ++levelCount;
+
+    return levelCount;
+}
+
+
+// Identifier of a tile of the pyramid
+std::uint64_t getTileKey(unsigned int level, sf::Vector2u tile)
+{
+    return (std::uint64_t{level} << 56) | (std::uint64_t{tile.y} << 28) | tile.x;
+}
+
+
+// Path of a tile of the pyramid
+std::filesystem::path getTilePath(const std::filesystem::path& directory, std::uint64_t key)
+{
+    const auto level = static_cast<unsigned int>(key >> 56);
+    const auto y     = static_cast<unsigned int>((key >> 28) & 0xFFFFFFF);
+    const auto x     = static_cast<unsigned int>(key & 0xFFFFFFF);
+    return directory / std::to_string(level) / (std::to_string(x) + '_' + std::to_string(y) + ".qoi");
+}
+
+
+// Path of the file describing the pyramid
+std::filesystem::path getManifestPath(const std::filesystem::path& directory)
+{
+    return directory / "pyramid.txt";
+}
+
+
+// Level of the pyramid being built, which receives the rows of its image one at a time
+struct PyramidLevel
+{
+    sf::Vector2u              size;           //!< Size of the level, in pixels
+    std::vector<std::uint8_t> band;           //!< Rows of the current row of tiles
+    unsigned int              bandRows{};     //!< Number of rows in the band
+    unsigned int              tileRow{};      //!< Index of the current row of tiles
+    std::vector<std::uint8_t> pendingRow;     //!< Even row waiting for the next one to be downsampled
+    bool                      hasPending{};   //!< Is there a row in pendingRow?
+    unsigned int              receivedRows{}; //!< Number of rows received so far
+};
+
+
+// Context of the construction of a pyramid
+struct PyramidBuilder
+{
+    std::filesystem::path     directory; //!< Directory the tiles are written to
+    unsigned int              tileSize;  //!< Size of the tiles
+    std::vector<PyramidLevel> levels;    //!< Levels of the pyramid
+
+    // Write the full tiles of the band of a level
+    [[nodiscard]] bool writeBand(unsigned int level)
+    {
+        PyramidLevel& current = levels[level];
+        for (unsigned int x = 0; x * tileSize < current.size.x; ++x)
+        {
+            const unsigned int        width = std::min(tileSize, current.size.x - x * tileSize);
+            std::vector<std::uint8_t> pixels(std::size_t{width} * current.bandRows * 4);
+            for (unsigned int y = 0; y < current.bandRows; ++y)
+                std::memcpy(pixels.data() + std::size_t{y} * width * 4,
+                            current.band.data() + (std::size_t{y} * current.size.x + x * tileSize) * 4,
+                            std::size_t{width} * 4);
+
+            const sf::Image tile({width, current.bandRows}, pixels.data());
+            if (!tile.saveToFile(getTilePath(directory, getTileKey(level, {x, current.tileRow}))))
+                return false;
+        }
+
+        current.bandRows = 0;
+        ++current.tileRow;
+        return true;
+    }
+
+    // Add the next row of the image of a level, and propagate it to the following levels
+    [[nodiscard]] bool addRow(unsigned int level, const std::uint8_t* row)
+    {
+        PyramidLevel& current = levels[level];
+        std::memcpy(current.band.data() + std::size_t{current.bandRows} * current.size.x * 4,
+                    row,
+                    std::size_t{current.size.x} * 4);
+        ++current.bandRows;
+        ++current.receivedRows;
+
+        const bool isLastRow = current.receivedRows == current.size.y;
+        if (((current.bandRows == tileSize) || isLastRow) && !writeBand(level))
+            return false;
+
+        if (level + 1 == levels.size())
+            return true;
+
+        // Rows are downsampled in pairs, the last row of an image of odd height being paired with itself
+        if (!current.hasPending)
+        {
+            current.pendingRow.assign(row, row + std::size_t{current.size.x} * 4);
+            current.hasPending = true;
+            if (!isLastRow)
+                return true;
+        }
+
+        const std::uint8_t* first  = current.pendingRow.data();
+        const std::uint8_t* second = isLastRow && (current.size.y % 2 == 1) ? first : row;
+        current.hasPending         = false;
+
+        const unsigned int        width = levels[level + 1].size.x;
+        std::vector<std::uint8_t> downsampled(std::size_t{width} * 4);
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            const std::size_t left  = std::size_t{x} * 2 * 4;
+            const std::size_t right = std::size_t{std::min(x * 2 + 1, current.size.x - 1)} * 4;
+            for (std::size_t c = 0; c < 4; ++c)
+            {
+                const unsigned int sum = unsigned{first[left + c]} + first[right + c] + second[left + c] +
+                                         second[right + c];
+                downsampled[std::size_t{x} * 4 + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+            }
+        }
+
+        return addRow(level + 1, downsampled.data());
+    }
+};
+} // namespace VirtualTextureImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct VirtualTexture::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Slot of the cache texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        std::uint64_t key{};      //!< Tile stored in the slot
+        std::uint64_t lastUsed{}; //!< Frame the tile was last drawn, or pinned
+        bool          used{};     //!< Does the slot hold a tile?
+    };
+
+    using DecodedTile = std::pair<std::uint64_t, std::optional<Image>>;
+
+    ////////////////////////////////////////////////////////////
+    ~Impl()
+    {
+        stopWorker();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void stopWorker()
+    {
+        if (!worker.joinable())
+            return;
+
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        condition.notify_all();
+        worker.join();
+
+        requests.clear();
+        decoded.clear();
+        loadingKey.reset();
+        stopping = false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void run()
+    {
+        for (;;)
+        {
+            std::uint64_t key = 0;
+
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this] { return stopping || !requests.empty(); });
+
+                if (stopping)
+                    return;
+
+                // The requests are sorted by priority
+                key = requests.front();
+                requests.erase(requests.begin());
+                loadingKey = key;
+            }
+
+            auto image = Image::loadFromFile(VirtualTextureImpl::getTilePath(directory, key));
+
+            const std::lock_guard lock(mutex);
+            decoded.emplace_back(key, std::move(image));
+            loadingKey.reset();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool createCache()
+    {
+        resident.clear();
+        slots.clear();
+        cache.reset();
+
+        // Each slot has a border of 1 pixel replicating the edges of its tile, so that smoothing doesn't bleed
+        const unsigned int slotSize    = tileSize + 2;
+        const unsigned int maxSlots    = std::max(Texture::getMaximumSize() / slotSize, 1u);
+        const auto         wanted      = static_cast<unsigned int>(std::min<std::size_t>(cacheCapacity, 1u << 20));
+        const unsigned int columns     = std::min(static_cast<unsigned int>(std::ceil(std::sqrt(wanted))), maxSlots);
+        const unsigned int rows        = std::min((wanted + columns - 1) / columns, maxSlots);
+        const std::size_t  actualCount = std::min<std::size_t>(cacheCapacity, std::size_t{columns} * rows);
+
+        cache = Texture::create({columns * slotSize, rows * slotSize});
+        if (!cache)
+        {
+            err() << "Failed to create the cache texture of a virtual texture" << std::endl;
+            return false;
+        }
+
+        cache->setSmooth(smooth);
+        slotColumns = columns;
+        slots.resize(actualCount);
+
+        // The coarsest level is always available to replace the missing tiles
+        upload(0, VirtualTextureImpl::getTileKey(levelCount - 1, {0, 0}), *root);
+        slots[0].lastUsed = VirtualTextureImpl::pinned;
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    Vector2u getSlotOrigin(std::size_t slot) const
+    {
+        const auto column = static_cast<unsigned int>(slot % slotColumns);
+        const auto row    = static_cast<unsigned int>(slot / slotColumns);
+        return {column * (tileSize + 2) + 1, row * (tileSize + 2) + 1};
+    }
+
+    ////////////////////////////////////////////////////////////
+    void upload(std::size_t slot, std::uint64_t key, const Image& image)
+    {
+        // Replicate the edges of the tile into the border of its slot
+        const Vector2u            extent = image.getSize();
+        const std::uint8_t*       src  = image.getPixelsPtr();
+        std::vector<std::uint8_t> padded(std::size_t{extent.x + 2} * (extent.y + 2) * 4);
+        for (unsigned int y = 0; y < extent.y + 2; ++y)
+        {
+            const unsigned int srcY = std::clamp(y, 1u, extent.y) - 1;
+            for (unsigned int x = 0; x < extent.x + 2; ++x)
+            {
+                const unsigned int srcX = std::clamp(x, 1u, extent.x) - 1;
+                std::memcpy(padded.data() + (std::size_t{y} * (extent.x + 2) + x) * 4,
+                            src + (std::size_t{srcY} * extent.x + srcX) * 4,
+                            4);
+            }
+        }
+
+        cache->update(padded.data(), extent + Vector2u(2, 2), getSlotOrigin(slot) - Vector2u(1, 1));
+
+        if (slots[slot].used)
+            resident.erase(slots[slot].key);
+
+        slots[slot] = {key, frame, true};
+        resident[key] = slot;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::filesystem::path                          directory;          //!< Directory of the pyramid
+    Vector2u                                       size;               //!< Size of the full resolution image
+    unsigned int                                   tileSize{};         //!< Size of the tiles
+    unsigned int                                   levelCount{};       //!< Number of levels of the pyramid
+    std::size_t                                    cacheCapacity{144}; //!< Requested number of slots
+    std::size_t                                    uploadLimit{4};     //!< Maximum number of uploads per draw
+    bool                                           smooth{true};       //!< Smooth the cache texture?
+    std::optional<Image>                           root;               //!< Single tile of the coarsest level
+    std::optional<Texture>                         cache;              //!< Texture holding the resident tiles
+    unsigned int                                   slotColumns{1};     //!< Number of slots per row of the cache
+    std::vector<Slot>                              slots;              //!< Slots of the cache
+    std::unordered_map<std::uint64_t, std::size_t> resident;           //!< Slot of each resident tile
+    std::unordered_set<std::uint64_t>              failed;             //!< Tiles that couldn't be loaded
+    std::uint64_t                                  frame{};            //!< Number of draws so far
+    std::size_t                                    pendingCount{};     //!< Tiles missing from the last draw
+    std::vector<Vertex>                            vertices;           //!< Triangles of the last draw
+
+    std::mutex                   mutex;      //!< Mutex protecting the members below it
+    std::condition_variable      condition;  //!< Wakes the worker up when tiles are requested
+    bool                         stopping{}; //!< Should the worker stop?
+    std::vector<std::uint64_t>   requests;   //!< Tiles to load, by decreasing priority
+    std::optional<std::uint64_t> loadingKey; //!< Tile being loaded by the worker
+    std::vector<DecodedTile>     decoded;    //!< Loaded tiles waiting to be uploaded
+    std::thread                  worker;     //!< Thread loading the requested tiles
+};
+
+
+////////////////////////////////////////////////////////////
+bool VirtualTexture::buildPyramid(const std::filesystem::path& imageFilename,
+                                  const std::filesystem::path& directory,
+                                  unsigned int                 tileSize)
+{
+    if (tileSize == 0)
+    {
+        err() << "Failed to build image pyramid: the tile size must not be 0" << std::endl;
+        return false;
+    }
+
+    // Qoi images are decoded incrementally, so that they never have to be loaded whole in memory
+    MappedFileInputStream file;
+    priv::QoiDecoder      decoder;
+    std::optional<Image>  image;
+    Vector2u              size;
+    if (!file.open(imageFilename))
+    {
+        err() << "Failed to build image pyramid\n"
+              << formatDebugPathInfo(imageFilename) << "\nReason: Unable to open file" << std::endl;
+        return false;
+    }
+
+    const auto fileSize = static_cast<std::size_t>(file.getSize());
+    if (priv::isQoiImage(file.getData(), fileSize))
+    {
+        if (!decoder.open(file.getData(), fileSize))
+        {
+            err() << "Failed to build image pyramid\n"
+                  << formatDebugPathInfo(imageFilename) << "\nReason: Invalid qoi file" << std::endl;
+            return false;
+        }
+
+        size = decoder.getSize();
+    }
+    else
+    {
+        image = Image::loadFromFile(imageFilename);
+        if (!image)
+            return false;
+
+        size = image->getSize();
+    }
+
+    if ((size.x == 0) || (size.y == 0) || (size.x >= (1u << 28)) || (size.y >= (1u << 28)))
+    {
+        err() << "Failed to build image pyramid\n"
+              << formatDebugPathInfo(imageFilename) << "\nReason: Unsupported image size" << std::endl;
+        return false;
+    }
+
+    VirtualTextureImpl::PyramidBuilder builder{directory, tileSize, {}};
+    const unsigned int                 levelCount = VirtualTextureImpl::getLevelCount(size, tileSize);
+    builder.levels.resize(levelCount);
+    for (unsigned int level = 0; level < levelCount; ++level)
+    {
+        VirtualTextureImpl::PyramidLevel& current = builder.levels[level];
+        current.size                              = VirtualTextureImpl::getLevelSize(size, level);
+        current.band.resize(std::size_t{current.size.x} * std::min(current.size.y, tileSize) * 4);
+
+        std::error_code error;
+        std::filesystem::create_directories(directory / std::to_string(level), error);
+        if (error)
+        {
+            err() << "Failed to build image pyramid\n"
+                  << formatDebugPathInfo(directory) << "\nReason: " << error.message() << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<std::uint8_t> row(image ? 0 : std::size_t{size.x} * 4);
+    for (unsigned int y = 0; y < size.y; ++y)
+    {
+        const std::uint8_t* pixels = nullptr;
+        if (image)
+        {
+            pixels = image->getPixelsPtr() + std::size_t{y} * size.x * 4;
+        }
+        else
+        {
+            if (!decoder.decode(row.data(), size.x))
+            {
+                err() << "Failed to build image pyramid\n"
+                      << formatDebugPathInfo(imageFilename) << "\nReason: Truncated qoi file" << std::endl;
+                return false;
+            }
+
+            pixels = row.data();
+        }
+
+        if (!builder.addRow(0, pixels))
+            return false;
+    }
+
+    // The manifest is written last, so that an incomplete pyramid can't be opened
+    std::ofstream manifest(VirtualTextureImpl::getManifestPath(directory));
+    manifest << "sfml-pyramid 1\n" << size.x << ' ' << size.y << ' ' << tileSize << ' ' << levelCount << '\n';
+    if (!manifest.flush())
+    {
+        err() << "Failed to build image pyramid\n"
+              << formatDebugPathInfo(VirtualTextureImpl::getManifestPath(directory))
+              << "\nReason: Unable to write file" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+VirtualTexture::VirtualTexture() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VirtualTexture::~VirtualTexture() = default;
+
+
+////////////////////////////////////////////////////////////
+bool VirtualTexture::open(const std::filesystem::path& directory)
+{
+    m_impl->stopWorker();
+    m_impl->root.reset();
+    m_impl->cache.reset();
+    m_impl->slots.clear();
+    m_impl->resident.clear();
+    m_impl->failed.clear();
+    m_impl->vertices.clear();
+    m_impl->pendingCount = 0;
+    m_impl->size         = {};
+
+    std::ifstream manifest(VirtualTextureImpl::getManifestPath(directory));
+    std::string   magic;
+    unsigned int  version    = 0;
+    Vector2u      size;
+    unsigned int  tileSize   = 0;
+    unsigned int  levelCount = 0;
+    manifest >> magic >> version >> size.x >> size.y >> tileSize >> levelCount;
+    if (!manifest || (magic != "sfml-pyramid") || (version != 1) || (size.x == 0) || (size.y == 0) ||
+        (size.x >= (1u << 28)) || (size.y >= (1u << 28)) || (tileSize == 0) ||
+        (levelCount != VirtualTextureImpl::getLevelCount(size, tileSize)))
+    {
+        err() << "Failed to open image pyramid\n"
+              << formatDebugPathInfo(VirtualTextureImpl::getManifestPath(directory))
+              << "\nReason: Missing or invalid manifest" << std::endl;
+        return false;
+    }
+
+    // The coarsest level is loaded right away, so that something can always be drawn
+    const std::uint64_t rootKey = VirtualTextureImpl::getTileKey(levelCount - 1, {0, 0});
+    auto                root    = Image::loadFromFile(VirtualTextureImpl::getTilePath(directory, rootKey));
+    if (!root || (root->getSize() != VirtualTextureImpl::getLevelSize(size, levelCount - 1)))
+    {
+        err() << "Failed to open image pyramid\n"
+              << formatDebugPathInfo(VirtualTextureImpl::getTilePath(directory, rootKey))
+              << "\nReason: Missing or invalid tile" << std::endl;
+        return false;
+    }
+
+    m_impl->directory  = directory;
+    m_impl->tileSize   = tileSize;
+    m_impl->levelCount = levelCount;
+    m_impl->root       = std::move(root);
+    if (!m_impl->createCache())
+    {
+        m_impl->root.reset();
+        return false;
+    }
+
+    m_impl->size   = size;
+    m_impl->worker = std::thread(&Impl::run, m_impl.get());
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u VirtualTexture::getSize() const
+{
+    return m_impl->size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VirtualTexture::getTileSize() const
+{
+    return m_impl->tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VirtualTexture::getLevelCount() const
+{
+    return m_impl->levelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void VirtualTexture::setCacheCapacity(std::size_t tileCount)
+{
+    m_impl->cacheCapacity = std::max<std::size_t>(tileCount, 2);
+
+    if (m_impl->cache && !m_impl->createCache())
+        m_impl->size = {};
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VirtualTexture::getCacheCapacity() const
+{
+    return m_impl->cache ? m_impl->slots.size() : m_impl->cacheCapacity;
+}
+
+
+////////////////////////////////////////////////////////////
+void VirtualTexture::setUploadLimit(std::size_t tileCount)
+{
+    m_impl->uploadLimit = std::max<std::size_t>(tileCount, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VirtualTexture::getUploadLimit() const
+{
+    return m_impl->uploadLimit;
+}
+
+
+////////////////////////////////////////////////////////////
+void VirtualTexture::setSmooth(bool smooth)
+{
+    m_impl->smooth = smooth;
+
+    if (m_impl->cache)
+        m_impl->cache->setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VirtualTexture::isSmooth() const
+{
+    return m_impl->smooth;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VirtualTexture::getResidentTileCount() const
+{
+    return m_impl->resident.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VirtualTexture::getPendingTileCount() const
+{
+    return m_impl->pendingCount;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect VirtualTexture::getLocalBounds() const
+{
+    return {{0.f, 0.f}, Vector2f(m_impl->size)};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect VirtualTexture::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void VirtualTexture::draw(RenderTarget& target, RenderStates states) const
+{
+    Impl& impl = *m_impl;
+    if (impl.size == Vector2u())
+        return;
+
+    states.transform *= getTransform();
+    ++impl.frame;
+
+    // Find how many pixels of the target a pixel of the image covers, to select the level to display
+    const View&     view     = target.getView();
+    const Transform toNdc    = view.getTransform() * states.transform;
+    const IntRect   pixels   = target.getViewport(view);
+    const auto      viewport = Vector2f(Vector2i(pixels.width, pixels.height));
+    const float*    matrix   = toNdc.getMatrix();
+    const float     scaleX   = std::hypot(matrix[0] * viewport.x / 2.f, matrix[1] * viewport.y / 2.f);
+    const float     scaleY   = std::hypot(matrix[4] * viewport.x / 2.f, matrix[5] * viewport.y / 2.f);
+    const float     scale    = std::max(scaleX, scaleY);
+    const int       maxLevel = static_cast<int>(impl.levelCount) - 1;
+    const int       wanted   = scale > 0.f ? static_cast<int>(std::floor(std::log2(1.f / scale))) : maxLevel;
+    auto            level    = static_cast<unsigned int>(std::clamp(wanted, 0, maxLevel));
+
+    // Find the part of the image that is visible through the viewport
+    const Transform fromNdc = toNdc.getInverse();
+    Vector2f        minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector2f        maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+    for (const Vector2f corner : {Vector2f(-1.f, -1.f), Vector2f(1.f, -1.f), Vector2f(-1.f, 1.f), Vector2f(1.f, 1.f)})
+    {
+        const Vector2f point = fromNdc.transformPoint(corner);
+        minimum              = {std::min(minimum.x, point.x), std::min(minimum.y, point.y)};
+        maximum              = {std::max(maximum.x, point.x), std::max(maximum.y, point.y)};
+    }
+
+    const auto imageSize = Vector2f(impl.size);
+    minimum              = {std::max(minimum.x, 0.f), std::max(minimum.y, 0.f)};
+    maximum              = {std::min(maximum.x, imageSize.x), std::min(maximum.y, imageSize.y)};
+    if ((minimum.x >= maximum.x) || (minimum.y >= maximum.y))
+    {
+        impl.pendingCount = 0;
+        return;
+    }
+
+    // Select a coarser level if the visible tiles wouldn't fit in the cache
+    Vector2u firstTile;
+    Vector2u lastTile;
+    for (;; ++level)
+    {
+        const float    tileExtent = static_cast<float>(impl.tileSize) * static_cast<float>(1u << level);
+        const Vector2u tileCount  = VirtualTextureImpl::getTileCount(impl.size, level, impl.tileSize);
+        lastTile  = {std::min(static_cast<unsigned int>(std::ceil(maximum.x / tileExtent)), tileCount.x) - 1,
+                     std::min(static_cast<unsigned int>(std::ceil(maximum.y / tileExtent)), tileCount.y) - 1};
+        firstTile = {std::min(static_cast<unsigned int>(minimum.x / tileExtent), lastTile.x),
+                     std::min(static_cast<unsigned int>(minimum.y / tileExtent), lastTile.y)};
+
+        const std::size_t visibleCount = std::size_t{lastTile.x - firstTile.x + 1} * (lastTile.y - firstTile.y + 1);
+        if ((level + 1 == impl.levelCount) || (visibleCount < impl.slots.size()))
+            break;
+    }
+
+    // Keep the visible tiles that are already resident from being evicted by the uploads
+    for (unsigned int y = firstTile.y; y <= lastTile.y; ++y)
+    {
+        for (unsigned int x = firstTile.x; x <= lastTile.x; ++x)
+        {
+            const auto it = impl.resident.find(VirtualTextureImpl::getTileKey(level, {x, y}));
+            if ((it != impl.resident.end()) && (impl.slots[it->second].lastUsed != VirtualTextureImpl::pinned))
+                impl.slots[it->second].lastUsed = impl.frame;
+        }
+    }
+
+    // Upload the tiles loaded by the worker since the last draw into the least recently used slots
+    std::vector<Impl::DecodedTile> loaded;
+    {
+        const std::lock_guard lock(impl.mutex);
+        const std::size_t     count = std::min(impl.uploadLimit, impl.decoded.size());
+        loaded.assign(std::make_move_iterator(impl.decoded.begin()),
+                      std::make_move_iterator(impl.decoded.begin() + static_cast<std::ptrdiff_t>(count)));
+        impl.decoded.erase(impl.decoded.begin(), impl.decoded.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+
+    for (auto& [key, image] : loaded)
+    {
+        if (!image)
+        {
+            impl.failed.insert(key);
+            continue;
+        }
+
+        if (impl.resident.count(key) != 0)
+            continue;
+
+        const auto slot = std::min_element(impl.slots.begin(),
+                                           impl.slots.end(),
+                                           [](const Impl::Slot& left, const Impl::Slot& right)
+                                           { return left.lastUsed < right.lastUsed; });
+        if (slot->lastUsed >= impl.frame)
+            break;
+
+        impl.upload(static_cast<std::size_t>(slot - impl.slots.begin()), key, *image);
+    }
+
+    // Build the triangles of the visible tiles, replacing the missing ones by their closest resident ancestor
+    const float                tileExtent = static_cast<float>(impl.tileSize) * static_cast<float>(1u << level);
+    const Vector2f             center     = (minimum + maximum) / 2.f;
+    std::vector<std::uint64_t> missing;
+    impl.vertices.clear();
+    for (unsigned int y = firstTile.y; y <= lastTile.y; ++y)
+    {
+        for (unsigned int x = firstTile.x; x <= lastTile.x; ++x)
+        {
+            const Vector2f topLeft(static_cast<float>(x) * tileExtent, static_cast<float>(y) * tileExtent);
+            const Vector2f bottomRight(std::min(topLeft.x + tileExtent, imageSize.x),
+                                       std::min(topLeft.y + tileExtent, imageSize.y));
+
+            const std::uint64_t key = VirtualTextureImpl::getTileKey(level, {x, y});
+            if ((impl.resident.count(key) == 0) && (impl.failed.count(key) == 0))
+                missing.push_back(key);
+
+            for (unsigned int ancestor = level; ancestor < impl.levelCount; ++ancestor)
+            {
+                const unsigned int shift = ancestor - level;
+                const Vector2u     tile(x >> shift, y >> shift);
+                const auto         it = impl.resident.find(VirtualTextureImpl::getTileKey(ancestor, tile));
+                if (it == impl.resident.end())
+                    continue;
+
+                Impl::Slot& slot = impl.slots[it->second];
+                if (slot.lastUsed != VirtualTextureImpl::pinned)
+                    slot.lastUsed = impl.frame;
+
+                // Texture coordinates of the area of the tile in the level of the resident tile
+                const Vector2f origin         = Vector2f(impl.getSlotOrigin(it->second));
+                const Vector2f offset         = origin - Vector2f(tile * impl.tileSize);
+                const float    levelScale     = 1.f / static_cast<float>(1u << ancestor);
+                const Vector2f texTopLeft     = offset + topLeft * levelScale;
+                const Vector2f texBottomRight = offset + bottomRight * levelScale;
+
+                const Vertex quad[] = {{topLeft, Color::White, texTopLeft},
+                                       {{bottomRight.x, topLeft.y}, Color::White, {texBottomRight.x, texTopLeft.y}},
+                                       {{topLeft.x, bottomRight.y}, Color::White, {texTopLeft.x, texBottomRight.y}},
+                                       {bottomRight, Color::White, texBottomRight}};
+                impl.vertices.insert(impl.vertices.end(), {quad[0], quad[1], quad[2], quad[2], quad[1], quad[3]});
+                break;
+            }
+        }
+    }
+
+    // Request the missing tiles, the closest to the center of the view first
+    const auto distanceToCenter = [&](std::uint64_t key)
+    {
+        const Vector2f tile(static_cast<float>(key & 0xFFFFFFF), static_cast<float>((key >> 28) & 0xFFFFFFF));
+        return (tile * tileExtent + Vector2f(tileExtent, tileExtent) / 2.f - center).lengthSq();
+    };
+    std::sort(missing.begin(),
+              missing.end(),
+              [&](std::uint64_t left, std::uint64_t right)
+              { return distanceToCenter(left) < distanceToCenter(right); });
+
+    {
+        const std::lock_guard lock(impl.mutex);
+        std::unordered_set<std::uint64_t> queued;
+        if (impl.loadingKey)
+            queued.insert(*impl.loadingKey);
+        for (const auto& entry : impl.decoded)
+            queued.insert(entry.first);
+
+        impl.requests.clear();
+        for (const std::uint64_t key : missing)
+            if (queued.count(key) == 0)
+                impl.requests.push_back(key);
+    }
+
+    impl.condition.notify_one();
+    impl.pendingCount = missing.size();
+
+    states.texture        = &*impl.cache;
+    states.coordinateType = CoordinateType::Pixels;
+    target.draw(impl.vertices.data(), impl.vertices.size(), PrimitiveType::Triangles, states);
+}
+
+} // namespace sf
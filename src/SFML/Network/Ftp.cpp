@@ -40,6 +40,16 @@
 #include <cstddef>
 #include <cstdint>
 
+#if defined(SFML_SYSTEM_LINUX)
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#endif
+
 
 namespace sf
 {
@@ -68,6 +78,9 @@ public:
     ////////////////////////////////////////////////////////////
     void send(std::istream& stream);
 
+    ////////////////////////////////////////////////////////////
+    void send(const std::filesystem::path& path, std::uint64_t offset);
+
     ////////////////////////////////////////////////////////////
     void receive(std::ostream& stream);
 
@@ -287,18 +300,96 @@ Ftp::Response Ftp::deleteFile(const std::filesystem::path& name)
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::filesystem::path& localPath, TransferMode mode)
 {
+    return receiveFile(remoteFile, localPath, mode, false);
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
+                          const std::filesystem::path& remotePath,
+                          TransferMode                 mode,
+                          bool                         append)
+{
+    return sendFile(localFile, remotePath, mode, append, false);
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::resumeDownload(const std::filesystem::path& remoteFile,
+                                  const std::filesystem::path& localPath,
+                                  TransferMode                 mode)
+{
+    return receiveFile(remoteFile, localPath, mode, true);
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::resumeUpload(const std::filesystem::path& localFile,
+                                const std::filesystem::path& remotePath,
+                                TransferMode                 mode)
+{
+    return sendFile(localFile, remotePath, mode, true, true);
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::setTransferBufferSize(std::size_t size)
+{
+    m_transferBufferSize = std::max<std::size_t>(size, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::sendCommand(const std::string& command, const std::string& parameter)
+{
+    // Build the command string
+    const std::string commandStr = parameter.empty() ? command + "\r\n" : command + " " + parameter + "\r\n";
+
+    // Send it to the server
+    if (m_commandSocket.send(commandStr.c_str(), commandStr.length()) != Socket::Status::Done)
+        return Response(Response::Status::ConnectionClosed);
+
+    // Get the response
+    return getResponse();
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::receiveFile(const std::filesystem::path& remoteFile,
+                               const std::filesystem::path& localPath,
+                               TransferMode                 mode,
+                               bool                         resume)
+{
+    // When resuming, only download what the local file doesn't contain yet
+    const std::filesystem::path filepath = localPath / remoteFile.filename();
+    std::uintmax_t              offset   = 0;
+    if (resume)
+    {
+        std::error_code error;
+        if (const std::uintmax_t size = std::filesystem::file_size(filepath, error); !error)
+            offset = size;
+    }
+
     // Open a data channel using the given transfer mode
     DataChannel data(*this);
     Response    response = data.open(mode);
     if (response.isOk())
     {
+        // Tell the server where to start the transfer
+        if (offset > 0)
+        {
+            response = sendCommand("REST", std::to_string(offset));
+            if (!response.isOk())
+                return response;
+        }
+
         // Tell the server to start the transfer
         response = sendCommand("RETR", remoteFile.string());
         if (response.isOk())
         {
-            // Create the file and truncate it if necessary
-            const std::filesystem::path filepath = localPath / remoteFile.filename();
-            std::ofstream               file(filepath, std::ios_base::binary | std::ios_base::trunc);
+            // Create the file and truncate it if necessary, or complete it
+            const std::ios_base::openmode openMode = (offset > 0) ? std::ios_base::app : std::ios_base::trunc;
+            std::ofstream                 file(filepath, std::ios_base::binary | openMode);
             if (!file)
                 return Response(Response::Status::InvalidFile);
 
@@ -311,8 +402,8 @@ Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::
             // Get the response from the server
             response = getResponse();
 
-            // If the download was unsuccessful, delete the partial file
-            if (!response.isOk())
+            // If the download was unsuccessful, delete the partial file (unless it can be resumed)
+            if (!response.isOk() && !resume)
                 std::filesystem::remove(filepath);
         }
     }
@@ -322,27 +413,43 @@ Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::
 
 
 ////////////////////////////////////////////////////////////
-Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
-                          const std::filesystem::path& remotePath,
-                          TransferMode                 mode,
-                          bool                         append)
+Ftp::Response Ftp::sendFile(const std::filesystem::path& localFile,
+                            const std::filesystem::path& remotePath,
+                            TransferMode                 mode,
+                            bool                         append,
+                            bool                         resume)
 {
-    // Get the contents of the file to send
-    std::ifstream file(localFile, std::ios_base::binary);
-    if (!file)
+    // Make sure that the file to send can be read
+    std::error_code      error;
+    const std::uintmax_t size = std::filesystem::file_size(localFile, error);
+    if (error || !std::ifstream(localFile, std::ios_base::binary))
         return Response(Response::Status::InvalidFile);
 
+    // When resuming, only upload what the remote file doesn't contain yet
+    const std::string remoteFile = (remotePath / localFile.filename()).string();
+    std::uintmax_t    offset     = 0;
+    if (resume)
+    {
+        const Response sizeResponse = sendCommand("SIZE", remoteFile);
+        if (sizeResponse.isOk())
+        {
+            std::istringstream in(sizeResponse.getMessage());
+            if (!(in >> offset) || (offset > size))
+                offset = 0;
+        }
+    }
+
     // Open a data channel using the given transfer mode
     DataChannel data(*this);
     Response    response = data.open(mode);
     if (response.isOk())
     {
         // Tell the server to start the transfer
-        response = sendCommand(append ? "APPE" : "STOR", (remotePath / localFile.filename()).string());
+        response = sendCommand(append ? "APPE" : "STOR", remoteFile);
         if (response.isOk())
         {
             // Send the file data
-            data.send(file);
+            data.send(localFile, offset);
 
             // Get the response from the server
             response = getResponse();
@@ -353,21 +460,6 @@ Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
 }
 
 
-////////////////////////////////////////////////////////////
-Ftp::Response Ftp::sendCommand(const std::string& command, const std::string& parameter)
-{
-    // Build the command string
-    const std::string commandStr = parameter.empty() ? command + "\r\n" : command + " " + parameter + "\r\n";
-
-    // Send it to the server
-    if (m_commandSocket.send(commandStr.c_str(), commandStr.length()) != Socket::Status::Done)
-        return Response(Response::Status::ConnectionClosed);
-
-    // Get the response
-    return getResponse();
-}
-
-
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::getResponse()
 {
@@ -585,12 +677,12 @@ Ftp::Response Ftp::DataChannel::open(Ftp::TransferMode mode)
 ////////////////////////////////////////////////////////////
 void Ftp::DataChannel::receive(std::ostream& stream)
 {
-    // Receive data
-    char        buffer[1024];
-    std::size_t received = 0;
-    while (m_dataSocket.receive(buffer, sizeof(buffer), received) == Socket::Status::Done)
+    // Receive data, with a buffer large enough to be written directly to the stream's destination
+    std::vector<char> buffer(m_ftp.m_transferBufferSize);
+    std::size_t       received = 0;
+    while (m_dataSocket.receive(buffer.data(), buffer.size(), received) == Socket::Status::Done)
     {
-        stream.write(buffer, static_cast<std::streamsize>(received));
+        stream.write(buffer.data(), static_cast<std::streamsize>(received));
 
         if (!stream.good())
         {
@@ -608,13 +700,13 @@ void Ftp::DataChannel::receive(std::ostream& stream)
 void Ftp::DataChannel::send(std::istream& stream)
 {
     // Send data
-    char        buffer[1024];
-    std::size_t count = 0;
+    std::vector<char> buffer(m_ftp.m_transferBufferSize);
+    std::size_t       count = 0;
 
     for (;;)
     {
         // read some data from the stream
-        stream.read(buffer, sizeof(buffer));
+        stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
         if (!stream.good() && !stream.eof())
         {
@@ -627,7 +719,7 @@ void Ftp::DataChannel::send(std::istream& stream)
         if (count > 0)
         {
             // we could read more data from the stream: send them
-            if (m_dataSocket.send(buffer, count) != Socket::Status::Done)
+            if (m_dataSocket.send(buffer.data(), count) != Socket::Status::Done)
                 break;
         }
         else
@@ -641,4 +733,59 @@ void Ftp::DataChannel::send(std::istream& stream)
     m_dataSocket.disconnect();
 }
 
+
+////////////////////////////////////////////////////////////
+void Ftp::DataChannel::send(const std::filesystem::path& path, std::uint64_t offset)
+{
+#if defined(SFML_SYSTEM_LINUX)
+    // Let the kernel copy the file to the socket, without going through user space
+    if (const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); file != -1)
+    {
+        // Unlike send, sendfile can't be told not to raise SIGPIPE if the server closes the connection
+        sigset_t pipeSignal;
+        sigset_t previousMask;
+        sigemptyset(&pipeSignal);
+        sigaddset(&pipeSignal, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousMask);
+
+        // Largest size accepted by a single call
+        constexpr std::size_t maxSendSize = 0x7ffff000;
+
+        auto    position = static_cast<off_t>(offset);
+        ssize_t sent     = 0;
+        int     error    = 0;
+        do
+        {
+            sent  = sendfile(m_dataSocket.getNativeHandle(), file, &position, maxSendSize);
+            error = (sent < 0) ? errno : 0;
+        } while ((sent > 0) || (error == EINTR));
+
+        // Discard the SIGPIPE raised by a closed connection, unless the thread was already blocking it
+        if ((error == EPIPE) && !sigismember(&previousMask, SIGPIPE))
+        {
+            const timespec noWait{};
+            sigtimedwait(&pipeSignal, nullptr, &noWait);
+        }
+
+        pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+        ::close(file);
+
+        // Some files (like pipes) can't be sent this way, they are sent by the generic code below
+        const bool isSupported = (error != EINVAL) && (error != ENOSYS);
+        if (isSupported || (position != static_cast<off_t>(offset)))
+        {
+            if (error != 0)
+                err() << "FTP Error: Sending the file has failed" << std::endl;
+
+            m_dataSocket.disconnect();
+            return;
+        }
+    }
+#endif
+
+    std::ifstream stream(path, std::ios_base::binary);
+    stream.seekg(static_cast<std::streamoff>(offset));
+    send(stream);
+}
+
 } // namespace sf
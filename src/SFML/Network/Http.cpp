@@ -26,21 +26,267 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Http.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TlsSocket.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <algorithm>
-#include <iterator>
+#include <array>
+#include <chrono>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <sstream>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <cctype>
 #include <cstddef>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Idle connections kept alive after a response, shared by all the HTTP clients
+class ConnectionPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    static ConnectionPool& getInstance()
+    {
+        static ConnectionPool instance;
+        return instance;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<sf::TcpSocket> take(const sf::IpAddress& address, unsigned short port, bool isSecure)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        // Servers close idle connections after a while, don't reuse the old ones
+        const Clock::time_point now = Clock::now();
+        m_connections.erase(std::remove_if(m_connections.begin(),
+                                           m_connections.end(),
+                                           [now](const Connection& connection) { return now >= connection.expiration; }),
+                            m_connections.end());
+
+        // Take the most recently used connection to the host
+        for (auto it = m_connections.rbegin(); it != m_connections.rend(); ++it)
+        {
+            if ((it->address == address) && (it->port == port) && (it->isSecure == isSecure))
+            {
+                std::unique_ptr<sf::TcpSocket> socket = std::move(it->socket);
+                m_connections.erase(std::next(it).base());
+                return socket;
+            }
+        }
+
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void give(const sf::IpAddress& address, unsigned short port, bool isSecure, std::unique_ptr<sf::TcpSocket> socket)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        // Drop the oldest connection to the host if it already has too many idle ones
+        const auto isSameHost = [&](const Connection& connection)
+        {
+            return (connection.address == address) && (connection.port == port) && (connection.isSecure == isSecure);
+        };
+        if (static_cast<std::size_t>(std::count_if(m_connections.begin(), m_connections.end(), isSameHost)) >=
+            maxConnectionsPerHost)
+            m_connections.erase(std::find_if(m_connections.begin(), m_connections.end(), isSameHost));
+
+        m_connections.push_back({address, port, isSecure, std::move(socket), Clock::now() + std::chrono::seconds(30)});
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Connection
+    {
+        sf::IpAddress                  address;    //!< Address of the host
+        unsigned short                 port;       //!< Port of the host
+        bool                           isSecure;   //!< Is the connection encrypted with TLS?
+        std::unique_ptr<sf::TcpSocket> socket;     //!< Connected socket (a sf::TlsSocket if secure)
+        Clock::time_point              expiration; //!< Time after which the connection is not reused anymore
+    };
+
+    static constexpr std::size_t maxConnectionsPerHost{4};
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex              m_mutex;       //!< Mutex protecting the connections
+    std::vector<Connection> m_connections; //!< Idle connections, from the oldest to the most recently used
+};
+
+
+////////////////////////////////////////////////////////////
+// Buffered reading of a response from a connected socket
+class ResponseReader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    explicit ResponseReader(sf::TcpSocket& connection) : m_connection(connection)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool hasReceived() const
+    {
+        return m_hasReceived;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool readLine(std::string& line)
+    {
+        while (true)
+        {
+            if (const std::size_t end = m_buffer.find('\n', m_position); end != std::string::npos)
+            {
+                line.assign(m_buffer, m_position, end - m_position);
+                m_position = end + 1;
+
+                // Remove any trailing \r
+                if (!line.empty() && (line.back() == '\r'))
+                    line.pop_back();
+
+                return true;
+            }
+
+            if ((m_buffer.size() - m_position > maxHeaderSize) || !fill())
+                return false;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool readHeader(std::string& header)
+    {
+        // The header ends with an empty line
+        header.clear();
+        std::string line;
+        while (readLine(line))
+        {
+            if (line.empty())
+                return true;
+
+            if (header.size() + line.size() > maxHeaderSize)
+                return false;
+
+            header += line;
+            header += '\n';
+        }
+
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool readBody(std::optional<std::size_t> size, const sf::Http::BodyCallback& bodyCallback)
+    {
+        // Without a size, the body ends when the server closes the connection
+        std::size_t remaining = size.value_or(std::numeric_limits<std::size_t>::max());
+        while (remaining > 0)
+        {
+            if ((m_position == m_buffer.size()) && !fill())
+                return !size.has_value();
+
+            const std::size_t count = std::min(remaining, m_buffer.size() - m_position);
+            if (!bodyCallback(m_buffer.data() + m_position, count))
+                return false;
+
+            m_position += count;
+            remaining -= count;
+        }
+
+        return true;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    bool fill()
+    {
+        if (m_position == m_buffer.size())
+        {
+            m_buffer.clear();
+            m_position = 0;
+        }
+
+        std::array<char, 16384> chunk{};
+        std::size_t             received = 0;
+        if (m_connection.receive(chunk.data(), chunk.size(), received) != sf::Socket::Status::Done)
+            return false;
+
+        m_buffer.append(chunk.data(), received);
+        m_hasReceived = true;
+        return true;
+    }
+
+    static constexpr std::size_t maxHeaderSize{65536};
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    sf::TcpSocket& m_connection;    //!< Socket connected to the server
+    std::string    m_buffer;        //!< Data received but not read yet, starting at m_position
+    std::size_t    m_position{};    //!< Position of the next byte to read in m_buffer
+    bool           m_hasReceived{}; //!< Did the server send anything?
+};
+
+////////////////////////////////////////////////////////////
+// Receive the body of a response, and tell whether the connection can be used for the next response
+bool receiveBody(ResponseReader&               reader,
+                 const sf::Http::Response&     response,
+                 bool                          isHeadRequest,
+                 const sf::Http::BodyCallback& bodyCallback,
+                 std::string&                  trailers)
+{
+    // Some responses never have a body
+    const auto status = response.getStatus();
+    if (isHeadRequest || (status == sf::Http::Response::Status::NoContent) ||
+        (status == sf::Http::Response::Status::NotModified))
+        return true;
+
+    if (sf::toLower(response.getField("transfer-encoding")) == "chunked")
+    {
+        // Read all chunks, until the last one which has a size of 0
+        std::string line;
+        while (reader.readLine(line))
+        {
+            // The chunk size may be followed by a chunk-extension, which is ignored
+            std::istringstream in(line);
+            std::size_t        length = 0;
+            if (!(in >> std::hex >> length))
+                return false;
+
+            // The last chunk is followed by the trailers (if present)
+            if (length == 0)
+                return reader.readHeader(trailers);
+
+            if (!reader.readBody(length, bodyCallback) || !reader.readLine(line))
+                return false;
+        }
+
+        return false;
+    }
+
+    std::istringstream in(response.getField("content-length"));
+    std::size_t        length = 0;
+    if (in >> length)
+        return reader.readBody(length, bodyCallback);
+
+    // Without a length, the body ends when the server closes the connection
+    reader.readBody(std::nullopt, bodyCallback);
+    return false;
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -186,9 +432,9 @@ const std::string& Http::Response::getBody() const
 
 
 ////////////////////////////////////////////////////////////
-void Http::Response::parse(const std::string& data)
+void Http::Response::parseHeader(const std::string& header)
 {
-    std::istringstream in(data);
+    std::istringstream in(header);
 
     // Extract the HTTP version from the first line
     std::string version;
@@ -226,42 +472,6 @@ void Http::Response::parse(const std::string& data)
 
     // Parse the other lines, which contain fields, one by one
     parseFields(in);
-
-    m_body.clear();
-
-    // Determine whether the transfer is chunked
-    if (toLower(getField("transfer-encoding")) != "chunked")
-    {
-        // Not chunked - just read everything at once
-        std::copy(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>(), std::back_inserter(m_body));
-    }
-    else
-    {
-        // Chunked - have to read chunk by chunk
-        std::size_t length = 0;
-
-        // Read all chunks, identified by a chunk-size not being 0
-        while (in >> std::hex >> length)
-        {
-            // Drop the rest of the line (chunk-extension)
-            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-            // Copy the actual content data
-            std::istreambuf_iterator<char>       it(in);
-            const std::istreambuf_iterator<char> itEnd;
-            for (std::size_t i = 0; ((i < length) && (it != itEnd)); ++i)
-            {
-                m_body.push_back(*it);
-                ++it; // Iterate in separate expression to work around false positive -Wnull-dereference warning in GCC 12.1.0
-            }
-        }
-
-        // Drop the rest of the line (chunk-extension)
-        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-        // Read all trailers (if present)
-        parseFields(in);
-    }
 }
 
 
@@ -305,19 +515,31 @@ void Http::setHost(const std::string& host, unsigned short port)
         // HTTP protocol
         m_hostName = host.substr(7);
         m_port     = (port != 0 ? port : 80);
+        m_isSecure = false;
     }
     else if (toLower(host.substr(0, 8)) == "https://")
     {
-        // HTTPS protocol -- unsupported (requires encryption and certificates and stuff...)
-        err() << "HTTPS protocol is not supported by sf::Http" << std::endl;
-        m_hostName.clear();
-        m_port = 0;
+        // HTTPS protocol -- requires a TLS backend
+        if (TlsSocket::isAvailable())
+        {
+            m_hostName = host.substr(8);
+            m_port     = (port != 0 ? port : 443);
+            m_isSecure = true;
+        }
+        else
+        {
+            err() << "HTTPS protocol is not supported by sf::Http: SFML was built without TLS support" << std::endl;
+            m_hostName.clear();
+            m_port     = 0;
+            m_isSecure = false;
+        }
     }
     else
     {
         // Undefined protocol - use HTTP
         m_hostName = host;
         m_port     = (port != 0 ? port : 80);
+        m_isSecure = false;
     }
 
     // Remove any trailing '/' from the host name
@@ -330,6 +552,23 @@ void Http::setHost(const std::string& host, unsigned short port)
 
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
+{
+    std::string body;
+    const auto  appendToBody = [&body](const char* data, std::size_t size)
+    {
+        body.append(data, size);
+        return true;
+    };
+
+    Response received = sendRequest(request, appendToBody, timeout);
+    received.m_body   = std::move(body);
+
+    return received;
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Http::Request& request, const BodyCallback& bodyCallback, Time timeout)
 {
     // First make sure that the request is valid -- add missing mandatory fields
     Request toSend(request);
@@ -355,44 +594,104 @@ Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
     {
         toSend.setField("Content-Type", "application/x-www-form-urlencoded");
     }
-    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
-    {
-        toSend.setField("Connection", "close");
-    }
 
     // Prepare the response
     Response received;
+    if (!m_host.has_value())
+        return received;
+
+    // Convert the request to string
+    const std::string requestStr = toSend.prepare();
+
+    // Requests without side effects are safe to replay, so they can be sent
+    // with the TLS handshake of a resumed session (0-RTT)
+    const bool isIdempotent = (toSend.m_method == Request::Method::Get) || (toSend.m_method == Request::Method::Head);
 
-    // Connect the socket to the host
-    if (m_connection.connect(m_host.value(), m_port, timeout) == Socket::Status::Done)
+    // Reuse an idle connection to the host if there is one
+    std::unique_ptr<TcpSocket> connection = ConnectionPool::getInstance().take(*m_host, m_port, m_isSecure);
+    bool                       canRetry   = connection != nullptr;
+    while (true)
     {
-        // Convert the request to string and send it through the connected socket
-        const std::string requestStr = toSend.prepare();
+        // Connect the socket to the host
+        bool isSent = false;
+        if (!connection)
+        {
+            if (m_isSecure)
+            {
+                auto                   tlsSocket = std::make_unique<TlsSocket>();
+                const std::string_view earlyData = isIdempotent ? std::string_view(requestStr) : std::string_view();
+                if (tlsSocket->connect(*m_host, m_port, m_hostName, timeout, earlyData) != Socket::Status::Done)
+                    return received;
+
+                isSent     = isIdempotent;
+                connection = std::move(tlsSocket);
+            }
+            else
+            {
+                connection = std::make_unique<TcpSocket>();
+                if (connection->connect(*m_host, m_port, timeout) != Socket::Status::Done)
+                    return received;
+            }
+        }
 
-        if (!requestStr.empty())
+        // Send the request through the connected socket, and wait for the server's response
+        ResponseReader reader(*connection);
+        std::string    header;
+        if (!isSent)
+            isSent = connection->send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done;
+        if (isSent && reader.readHeader(header))
         {
-            // Send it through the socket
-            if (m_connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
+            received.parseHeader(header);
+
+            // Skip the informational responses (like "100 Continue")
+            while ((static_cast<int>(received.m_status) / 100 == 1) && reader.readHeader(header))
             {
-                // Wait for the server's response
-                std::string receivedStr;
-                std::size_t size = 0;
-                char        buffer[1024];
-                while (m_connection.receive(buffer, sizeof(buffer), size) == Socket::Status::Done)
-                {
-                    receivedStr.append(buffer, buffer + size);
-                }
-
-                // Build the Response object from the received data
-                received.parse(receivedStr);
+                received = Response();
+                received.parseHeader(header);
             }
+
+            if (received.m_status == Response::Status::InvalidResponse)
+                return received;
+
+            // Receive the body, then the trailers that may follow it
+            std::string trailers;
+            const bool  isComplete = receiveBody(reader,
+                                                 received,
+                                                 toSend.m_method == Request::Method::Head,
+                                                 bodyCallback,
+                                                 trailers);
+            std::istringstream in(trailers);
+            received.parseFields(in);
+
+            // Keep the connection alive if both sides agree to (the default since HTTP/1.1)
+            const std::string clientOption = toLower(toSend.m_fields["connection"]);
+            const std::string serverOption = toLower(received.getField("connection"));
+            const bool        clientAgrees = (toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11)
+                                                 ? (clientOption != "close")
+                                                 : (clientOption == "keep-alive");
+            const bool        serverAgrees = (received.m_majorVersion * 10 + received.m_minorVersion >= 11)
+                                                 ? (serverOption != "close")
+                                                 : (serverOption == "keep-alive");
+            if (isComplete && clientAgrees && serverAgrees)
+                ConnectionPool::getInstance().give(*m_host, m_port, m_isSecure, std::move(connection));
+
+            return received;
         }
 
-        // Close the connection
-        m_connection.disconnect();
-    }
+        // The server may have closed the idle connection before receiving the request: try again with a new one
+        if (canRetry && !reader.hasReceived())
+        {
+            canRetry = false;
+            connection.reset();
+            continue;
+        }
 
-    return received;
+        if (isSent)
+            received.m_status = Response::Status::InvalidResponse;
+
+        return received;
+    }
 }
 
+
 } // namespace sf
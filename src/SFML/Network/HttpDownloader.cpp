@@ -0,0 +1,457 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Http.hpp>
+#include <SFML/Network/HttpDownloader.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace HttpDownloaderImpl
+{
+// Maximum number of times a range is requested before giving up
+constexpr int maxAttempts = 3;
+
+// Parameters of the 64-bit FNV-1a hash
+constexpr std::uint64_t hashOffset = 14695981039346656037u;
+constexpr std::uint64_t hashPrime  = 1099511628211u;
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t updateHash(std::uint64_t hash, const char* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= hashPrime;
+    }
+
+    return hash;
+}
+
+
+////////////////////////////////////////////////////////////
+// Progress of a download, saved next to the file to resume it
+struct ResumeState
+{
+    std::uint64_t size{};      //!< Size of the file
+    std::size_t   chunkSize{}; //!< Size of the chunks
+    std::string   validator;   //!< ETag or modification date of the file on the server
+    std::string   chunks;      //!< '1' for each complete chunk, '0' for the others
+};
+
+
+////////////////////////////////////////////////////////////
+std::optional<ResumeState> loadResumeState(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::string   magic;
+    ResumeState   state;
+    if (!std::getline(file, magic) || (magic != "SFML download 1") || !(file >> state.size >> state.chunkSize) ||
+        !file.ignore() || !std::getline(file, state.validator) || !std::getline(file, state.chunks))
+        return std::nullopt;
+
+    return state;
+}
+
+
+////////////////////////////////////////////////////////////
+void saveResumeState(const std::filesystem::path& path, const ResumeState& state)
+{
+    std::ofstream file(path, std::ios::trunc);
+    file << "SFML download 1\n" << state.size << ' ' << state.chunkSize << '\n';
+    file << state.validator << '\n' << state.chunks << '\n';
+
+    if (!file)
+        sf::err() << "Failed to save the progress of a download\n" << sf::formatDebugPathInfo(path) << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+// Download of a file, shared by the threads of the connections
+class Download
+{
+public:
+    ////////////////////////////////////////////////////////////
+    Download(std::string                                 uri,
+             std::filesystem::path                       resumePath,
+             ResumeState                                 state,
+             bool                                        isRanged,
+             const std::vector<std::uint64_t>&           hashes,
+             const sf::HttpDownloader::ProgressCallback& progressCallback) :
+    m_uri(std::move(uri)),
+    m_resumePath(std::move(resumePath)),
+    m_state(std::move(state)),
+    m_isRanged(isRanged),
+    m_hashes(hashes),
+    m_progressCallback(progressCallback)
+    {
+        for (std::size_t chunk = 0; chunk < m_state.chunks.size(); ++chunk)
+        {
+            if (m_state.chunks[chunk] == '1')
+                m_downloaded += getChunkEnd(chunk) - getChunkBegin(chunk);
+            else
+                m_pending.push_back(chunk);
+        }
+
+        // Take the chunks from the beginning of the file first
+        std::reverse(m_pending.begin(), m_pending.end());
+    }
+
+    ////////////////////////////////////////////////////////////
+    void run(sf::Http& http, std::fstream& file, sf::Time timeout)
+    {
+        if (!m_isRanged)
+        {
+            // The server can only send the whole file
+            fetchWithRetries(http, file, 0, m_state.size, timeout);
+            return;
+        }
+
+        std::size_t chunk = 0;
+        while (takeChunk(chunk))
+        {
+            if (fetchWithRetries(http, file, getChunkBegin(chunk), getChunkEnd(chunk), timeout))
+                complete(chunk);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isComplete() const
+    {
+        return m_state.chunks.find('0') == std::string::npos;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasChanged() const
+    {
+        return m_changed;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getChunkBegin(std::size_t chunk) const
+    {
+        return std::uint64_t{chunk} * m_state.chunkSize;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getChunkEnd(std::size_t chunk) const
+    {
+        return std::min(getChunkBegin(chunk) + m_state.chunkSize, m_state.size);
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool takeChunk(std::size_t& chunk)
+    {
+        const std::lock_guard lock(m_mutex);
+        if (m_stopped || m_pending.empty())
+            return false;
+
+        chunk = m_pending.back();
+        m_pending.pop_back();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void complete(std::size_t chunk)
+    {
+        const std::lock_guard lock(m_mutex);
+        m_state.chunks[chunk] = '1';
+        m_downloaded += getChunkEnd(chunk) - getChunkBegin(chunk);
+
+        // Only ranged downloads can be resumed
+        if (m_isRanged && !m_state.validator.empty())
+            saveResumeState(m_resumePath, m_state);
+
+        if (m_progressCallback && !m_progressCallback(m_downloaded, m_state.size))
+            m_stopped = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool fetchWithRetries(sf::Http& http, std::fstream& file, std::uint64_t begin, std::uint64_t end, sf::Time timeout)
+    {
+        for (int attempt = 0; (attempt < maxAttempts) && !m_stopped; ++attempt)
+        {
+            if (fetch(http, file, begin, end, timeout))
+                return true;
+        }
+
+        if (!m_stopped)
+        {
+            sf::err() << "Failed to download bytes " << begin << " to " << end << " of " << m_uri << std::endl;
+            m_stopped = true;
+        }
+
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool fetch(sf::Http& http, std::fstream& file, std::uint64_t begin, std::uint64_t end, sf::Time timeout)
+    {
+        sf::Http::Request request(m_uri);
+        request.setHttpVersion(1, 1);
+        if (m_isRanged)
+        {
+            // If-Range makes the server send the whole file instead if it changed since the download started
+            request.setField("Range", "bytes=" + std::to_string(begin) + "-" + std::to_string(end - 1));
+            if (!m_state.validator.empty())
+                request.setField("If-Range", m_state.validator);
+        }
+
+        file.clear();
+        file.seekp(static_cast<std::streamoff>(begin));
+
+        // The body is written in place as it arrives. The status of the response isn't known yet,
+        // but the range isn't marked as complete until it is checked, so anything else that
+        // could be written here (like an error page) is overwritten by the next attempt
+        std::uint64_t position = begin;
+        std::uint64_t hash     = hashOffset;
+        bool          valid    = true;
+        const auto    write    = [&](const char* data, std::size_t size)
+        {
+            // A server ignoring the range sends more than requested, don't write past it
+            if (m_stopped || (size > end - position) || !file.write(data, static_cast<std::streamsize>(size)))
+                return false;
+
+            while (size > 0)
+            {
+                const auto          chunk    = static_cast<std::size_t>(position / m_state.chunkSize);
+                const std::uint64_t chunkEnd = getChunkEnd(chunk);
+                const std::size_t   count    = std::min(size, static_cast<std::size_t>(chunkEnd - position));
+
+                hash = updateHash(hash, data, count);
+                position += count;
+                data += count;
+                size -= count;
+
+                if (position == chunkEnd)
+                {
+                    if (!m_hashes.empty() && (hash != m_hashes[chunk]))
+                    {
+                        sf::err() << "Chunk " << chunk << " of " << m_uri << " doesn't match its hash" << std::endl;
+                        valid = false;
+                        return false;
+                    }
+
+                    // Without ranges, the whole file comes in a single response
+                    if (!m_isRanged)
+                        complete(chunk);
+
+                    hash = hashOffset;
+                }
+            }
+
+            return true;
+        };
+
+        const sf::Http::Response response = http.sendRequest(request, write, timeout);
+        file.flush();
+
+        // A full response to a ranged request means that the file changed on the server
+        if (m_isRanged && (response.getStatus() == sf::Http::Response::Status::Ok))
+        {
+            sf::err() << "Failed to download " << m_uri << " (the file changed on the server)" << std::endl;
+            m_changed = true;
+            m_stopped = true;
+            return false;
+        }
+
+        const auto expected = m_isRanged ? sf::Http::Response::Status::PartialContent : sf::Http::Response::Status::Ok;
+        return valid && file && (response.getStatus() == expected) && (position == end);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::string                           m_uri;              //!< URI of the file
+    const std::filesystem::path                 m_resumePath;       //!< Path of the file saving the progress
+    ResumeState                                 m_state;            //!< Progress of the download
+    const bool                                  m_isRanged;         //!< Can chunks be requested separately?
+    const std::vector<std::uint64_t>&           m_hashes;           //!< Expected hash of each chunk, if any
+    const sf::HttpDownloader::ProgressCallback& m_progressCallback; //!< Function receiving the progress
+    std::mutex                                  m_mutex;            //!< Mutex protecting the progress
+    std::vector<std::size_t>                    m_pending;          //!< Chunks not taken yet, the next one last
+    std::uint64_t                               m_downloaded{};     //!< Number of bytes of the complete chunks
+    std::atomic<bool>                           m_stopped{};        //!< Was the download cancelled or did it fail?
+    std::atomic<bool>                           m_changed{};        //!< Did the file change on the server?
+};
+} // namespace HttpDownloaderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+HttpDownloader::HttpDownloader(std::string host, unsigned short port) : m_host(std::move(host)), m_port(port)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void HttpDownloader::setConnectionCount(std::size_t count)
+{
+    m_connectionCount = std::max(count, std::size_t{1});
+}
+
+
+////////////////////////////////////////////////////////////
+void HttpDownloader::setChunkSize(std::size_t size)
+{
+    m_chunkSize = std::max(size, std::size_t{1});
+}
+
+
+////////////////////////////////////////////////////////////
+void HttpDownloader::setChunkHashes(std::vector<std::uint64_t> hashes)
+{
+    m_chunkHashes = std::move(hashes);
+}
+
+
+////////////////////////////////////////////////////////////
+void HttpDownloader::setTimeout(Time timeout)
+{
+    m_timeout = timeout;
+}
+
+
+////////////////////////////////////////////////////////////
+bool HttpDownloader::download(const std::string&           uri,
+                              const std::filesystem::path& filename,
+                              const ProgressCallback&      progressCallback)
+{
+    using namespace HttpDownloaderImpl;
+
+    // Ask for the size of the file, whether it can be downloaded in chunks, and its version
+    Http          http(m_host, m_port);
+    Http::Request request(uri, Http::Request::Method::Head);
+    request.setHttpVersion(1, 1);
+    const Http::Response response = http.sendRequest(request, m_timeout);
+
+    std::uint64_t      size = 0;
+    std::istringstream in(response.getField("content-length"));
+    if ((response.getStatus() != Http::Response::Status::Ok) || !(in >> size))
+    {
+        err() << "Failed to download " << uri << " (status " << static_cast<int>(response.getStatus())
+              << ", the server must send the size of the file)" << std::endl;
+        return false;
+    }
+
+    const bool        isRanged   = toLower(response.getField("accept-ranges")) == "bytes";
+    const std::string validator  = !response.getField("etag").empty() ? response.getField("etag")
+                                                                      : response.getField("last-modified");
+    const auto        chunkCount = static_cast<std::size_t>((size + m_chunkSize - 1) / m_chunkSize);
+
+    if (!m_chunkHashes.empty() && (m_chunkHashes.size() != chunkCount))
+    {
+        err() << "Failed to download " << uri << " (expected " << m_chunkHashes.size() << " chunk hashes, the file has "
+              << chunkCount << " chunks)" << std::endl;
+        return false;
+    }
+
+    // Resume the previous download if it was for the same version of the file
+    std::filesystem::path resumePath = filename;
+    resumePath += ".resume";
+    std::optional<ResumeState> state = loadResumeState(resumePath);
+    std::error_code            error;
+    if (!state || !isRanged || validator.empty() || (state->size != size) || (state->chunkSize != m_chunkSize) ||
+        (state->validator != validator) || (state->chunks.size() != chunkCount) ||
+        (std::filesystem::file_size(filename, error) != size))
+    {
+        // Allocate the whole file up front, the chunks are written in place
+        state = ResumeState{size, m_chunkSize, validator, std::string(chunkCount, '0')};
+        if (!std::ofstream(filename, std::ios::binary | std::ios::trunc))
+        {
+            err() << "Failed to create the file of a download\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        std::filesystem::resize_file(filename, size, error);
+        if (error)
+        {
+            err() << "Failed to allocate the file of a download\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        if (isRanged && !validator.empty())
+            saveResumeState(resumePath, *state);
+    }
+
+    Download download(uri, resumePath, std::move(*state), isRanged, m_chunkHashes, progressCallback);
+
+    // Each connection has its own client and its own file stream, writing at the position of its chunks
+    const std::size_t        connectionCount = isRanged ? std::min(m_connectionCount, chunkCount) : std::size_t{1};
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < connectionCount; ++i)
+    {
+        threads.emplace_back(
+            [this, &download, &filename]
+            {
+                Http         connection(m_host, m_port);
+                std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+                if (file)
+                    download.run(connection, file, m_timeout);
+            });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Start from scratch next time if the file changed
+    if (download.hasChanged())
+        std::filesystem::remove(resumePath, error);
+
+    if (!download.isComplete())
+        return false;
+
+    std::filesystem::remove(resumePath, error);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t HttpDownloader::computeHash(const void* data, std::size_t size)
+{
+    return HttpDownloaderImpl::updateHash(HttpDownloaderImpl::hashOffset, static_cast<const char*>(data), size);
+}
+
+} // namespace sf
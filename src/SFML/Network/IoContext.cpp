@@ -0,0 +1,595 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/IoContext.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace IoContextImpl
+{
+// Maximum number of operations completed on a socket before letting other handlers run
+constexpr std::size_t maxCompletionsPerTurn = 16;
+} // namespace IoContextImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct IoContext::Impl
+{
+    // Attempt of an operation, which calls its handler and returns true once the operation is over
+    using Operation = std::function<bool()>;
+
+    // Task run by the loop, which returns the number of user handlers that it called
+    using Task = std::function<std::size_t()>;
+
+    struct SocketState
+    {
+        std::deque<Operation> receives;         //!< Pending receptions and connection acceptations, in order
+        std::deque<Operation> sends;            //!< Pending sends, in order
+        bool                  receiveReady{};   //!< Might a reception succeed without blocking?
+        bool                  sendReady{};      //!< Might a send succeed without blocking?
+        bool                  receiveWatched{}; //!< Is the poller waiting for the socket to be ready to receive?
+        bool                  sendWatched{};    //!< Is the poller waiting for the socket to be ready to send?
+        bool                  scheduled{};      //!< Is a task processing the socket queued or running?
+    };
+
+    Impl()
+    {
+        if (wakeReceiver.bind(Socket::AnyPort, IpAddress::LocalHost) != Socket::Status::Done)
+            err() << "Failed to bind the wake-up socket of an I/O context" << std::endl;
+
+        wakeReceiver.setBlocking(false);
+        wakeSender.setBlocking(false);
+
+        // Sockets always stop being watched before they can be closed, so io_uring can be used to wait
+        selector.enableIoUring();
+        selector.add(wakeReceiver);
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t outstandingWork() const
+    {
+        return pendingOperations + tasks.size() + runningTasks + timers.getTimerCount();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void wakePoller()
+    {
+        // Interrupt the thread waiting on the selector; the mutex must be locked
+        if (!polling || wakePending)
+            return;
+
+        const char signal = 0;
+        wakePending = wakeSender.send(&signal, sizeof(signal), IpAddress::LocalHost, wakeReceiver.getLocalPort()) ==
+                      Socket::Status::Done;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void enqueue(Task task)
+    {
+        // The mutex must be locked
+        tasks.push_back(std::move(task));
+        condition.notify_one();
+        wakePoller();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void schedule(Socket& socket, SocketState& state)
+    {
+        // The mutex must be locked
+        state.scheduled = true;
+        enqueue([this, &socket] { return process(socket); });
+    }
+
+    ////////////////////////////////////////////////////////////
+    void start(Socket& socket, bool receive, Operation operation)
+    {
+        const std::lock_guard lock(mutex);
+
+        const auto [it, inserted] = sockets.try_emplace(&socket);
+        if (inserted)
+            socket.setBlocking(false);
+
+        SocketState& state = it->second;
+        ++pendingOperations;
+
+        // Try the operation right away, unless the poller already knows that it would block
+        if (receive)
+        {
+            state.receives.push_back(std::move(operation));
+            if (!state.receiveWatched)
+                state.receiveReady = true;
+        }
+        else
+        {
+            state.sends.push_back(std::move(operation));
+            if (!state.sendWatched)
+                state.sendReady = true;
+        }
+
+        if (!state.scheduled && (state.receiveReady || state.sendReady))
+            schedule(socket, state);
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t process(Socket& socket)
+    {
+        // There is at most one task processing a given socket at any time, so that
+        // its handlers are serialized; the state can't be erased while it is scheduled
+        std::unique_lock lock(mutex);
+        SocketState&     state     = sockets[&socket];
+        std::size_t      completed = 0;
+
+        while (completed < IoContextImpl::maxCompletionsPerTurn)
+        {
+            std::deque<Operation>* queue = nullptr;
+            bool*                  ready = nullptr;
+
+            if (state.receiveReady && !state.receives.empty())
+            {
+                queue = &state.receives;
+                ready = &state.receiveReady;
+            }
+            else if (state.sendReady && !state.sends.empty())
+            {
+                queue = &state.sends;
+                ready = &state.sendReady;
+            }
+            else
+            {
+                break;
+            }
+
+            Operation operation = std::move(queue->front());
+            queue->pop_front();
+
+            lock.unlock();
+            const bool done = operation();
+            lock.lock();
+
+            if (done)
+            {
+                --pendingOperations;
+                ++completed;
+            }
+            else
+            {
+                queue->push_front(std::move(operation));
+                *ready = false;
+            }
+        }
+
+        // Let other sockets run if this one still has work that can progress
+        if ((state.receiveReady && !state.receives.empty()) || (state.sendReady && !state.sends.empty()))
+        {
+            enqueue([this, &socket] { return process(socket); });
+            return completed;
+        }
+
+        state.scheduled = false;
+
+        // Hand the operations that would block to the poller
+        bool watch = false;
+        if (!state.receives.empty() && !state.receiveReady && !state.receiveWatched)
+            state.receiveWatched = watch = true;
+        if (!state.sends.empty() && !state.sendReady && !state.sendWatched)
+            state.sendWatched = watch = true;
+
+        if (watch)
+        {
+            dirtySockets.push_back(&socket);
+            wakePoller();
+        }
+
+        // Forget the socket once it is idle, it may be destroyed from now on
+        if (state.receives.empty() && state.sends.empty() && !state.receiveWatched && !state.sendWatched)
+            sockets.erase(&socket);
+
+        return completed;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void pollSockets(std::unique_lock<std::mutex>& lock, std::optional<Time> timeout)
+    {
+        // Only one thread at a time plays the role of the poller, which is the only one to touch the selector
+        polling = true;
+
+        for (Socket* socket : dirtySockets)
+        {
+            const auto it = sockets.find(socket);
+            if ((it != sockets.end()) && (it->second.receiveWatched || it->second.sendWatched))
+                selector.watch(*socket, it->second.receiveWatched, it->second.sendWatched);
+        }
+        dirtySockets.clear();
+
+        lock.unlock();
+        const bool ready = selector.waitFor(timeout);
+        lock.lock();
+
+        polling = false;
+
+        if (!ready)
+            return;
+
+        for (Socket* socket : selector.getReadySockets())
+        {
+            if (socket == &wakeReceiver)
+            {
+                char                     buffer[16];
+                std::size_t              received = 0;
+                std::optional<IpAddress> sender;
+                unsigned short           port = 0;
+                while (wakeReceiver.receive(buffer, sizeof(buffer), received, sender, port) == Socket::Status::Done)
+                {
+                }
+                wakePending = false;
+                continue;
+            }
+
+            const auto it = sockets.find(socket);
+            if ((it == sockets.end()) || !(it->second.receiveWatched || it->second.sendWatched))
+                continue;
+
+            // Stop watching the socket while its operations are processed: it must not
+            // be referenced by the selector once it has no more pending operations
+            SocketState& state = it->second;
+            selector.watch(*socket, false, false);
+            state.receiveWatched = state.sendWatched = false;
+            state.receiveReady = state.sendReady = true;
+
+            if (!state.scheduled)
+                schedule(*socket, state);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t run(bool block)
+    {
+        std::size_t      count  = 0;
+        bool             polled = false;
+        std::unique_lock lock(mutex);
+
+        while (!stopped)
+        {
+            if (!tasks.empty())
+            {
+                Task task = std::move(tasks.front());
+                tasks.pop_front();
+                ++runningTasks;
+
+                lock.unlock();
+                count += task();
+                lock.lock();
+
+                --runningTasks;
+
+                // Let the other threads return if this was the last piece of work
+                if (outstandingWork() == 0)
+                {
+                    condition.notify_all();
+                    wakePoller();
+                }
+
+                continue;
+            }
+
+            // Queue the handlers of the timers that expired
+            if (timers.expire() > 0)
+                continue;
+
+            if (outstandingWork() == 0)
+                break;
+
+            if (!polling && (block || !polled))
+            {
+                pollSockets(lock, block ? timers.getTimeUntilNextExpiry() : std::optional<Time>(Time::Zero));
+                polled = true;
+                continue;
+            }
+
+            if (!block)
+                break;
+
+            condition.wait(lock);
+        }
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable std::mutex                       mutex;               //!< Mutex protecting all the members
+    std::condition_variable                  condition;           //!< Signals new tasks to the idle threads
+    std::deque<Task>                         tasks;               //!< Tasks ready to be run
+    std::unordered_map<Socket*, SocketState> sockets;             //!< Sockets that have pending operations
+    TimerWheel                               timers;              //!< Timers started by asyncWait
+    std::vector<Socket*>                     dirtySockets;        //!< Sockets waiting to be watched by the poller
+    std::size_t                              pendingOperations{}; //!< Number of operations not completed yet
+    std::size_t                              runningTasks{};      //!< Number of tasks currently running
+    bool                                     polling{};           //!< Is a thread waiting on the selector?
+    bool                                     wakePending{};       //!< Was a wake-up signal sent but not received yet?
+    bool                                     stopped{};           //!< Was stop called?
+    SocketSelector                           selector;            //!< Selector watching the sockets that would block
+    UdpSocket                                wakeReceiver;        //!< Socket interrupting the wait of the poller
+    UdpSocket                                wakeSender;          //!< Socket used to signal the wake-up socket
+};
+
+
+////////////////////////////////////////////////////////////
+IoContext::IoContext() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IoContext::~IoContext() = default;
+
+
+////////////////////////////////////////////////////////////
+void IoContext::post(std::function<void()> handler)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->enqueue(
+        [handler = std::move(handler)]
+        {
+            handler();
+            return std::size_t{1};
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncAccept(TcpListener& listener, TcpSocket& socket, StatusHandler handler)
+{
+    m_impl->start(listener,
+                  true,
+                  [&listener, &socket, handler = std::move(handler)]
+                  {
+                      const Socket::Status status = listener.accept(socket);
+                      if (status == Socket::Status::NotReady)
+                          return false;
+
+                      handler(status);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncSend(TcpSocket& socket, const void* data, std::size_t size, TransferHandler handler)
+{
+    m_impl->start(socket,
+                  false,
+                  [&socket, data, size, total = std::size_t{0}, handler = std::move(handler)]() mutable
+                  {
+                      std::size_t          sent   = 0;
+                      const Socket::Status status = socket.send(static_cast<const std::byte*>(data) + total,
+                                                                size - total,
+                                                                sent);
+                      total += sent;
+
+                      // Keep the operation going until everything is sent
+                      if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+                          return false;
+
+                      handler(status, total);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncReceive(TcpSocket& socket, void* data, std::size_t size, TransferHandler handler)
+{
+    m_impl->start(socket,
+                  true,
+                  [&socket, data, size, handler = std::move(handler)]
+                  {
+                      std::size_t          received = 0;
+                      const Socket::Status status   = socket.receive(data, size, received);
+                      if (status == Socket::Status::NotReady)
+                          return false;
+
+                      handler(status, received);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncSend(TcpSocket& socket, Packet& packet, StatusHandler handler)
+{
+    m_impl->start(socket,
+                  false,
+                  [&socket, &packet, handler = std::move(handler)]
+                  {
+                      // The socket keeps track of the part of the packet that was already sent
+                      const Socket::Status status = socket.send(packet);
+                      if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+                          return false;
+
+                      handler(status);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncReceive(TcpSocket& socket, Packet& packet, StatusHandler handler)
+{
+    m_impl->start(socket,
+                  true,
+                  [&socket, &packet, handler = std::move(handler)]
+                  {
+                      // The socket keeps track of the part of the packet that was already received
+                      const Socket::Status status = socket.receive(packet);
+                      if (status == Socket::Status::NotReady)
+                          return false;
+
+                      handler(status);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncSend(UdpSocket&       socket,
+                          const void*      data,
+                          std::size_t      size,
+                          const IpAddress& remoteAddress,
+                          unsigned short   remotePort,
+                          TransferHandler  handler)
+{
+    m_impl->start(socket,
+                  false,
+                  [&socket, data, size, remoteAddress, remotePort, handler = std::move(handler)]
+                  {
+                      const Socket::Status status = socket.send(data, size, remoteAddress, remotePort);
+                      if (status == Socket::Status::NotReady)
+                          return false;
+
+                      handler(status, status == Socket::Status::Done ? size : 0);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncReceive(UdpSocket& socket, void* data, std::size_t size, DatagramHandler handler)
+{
+    m_impl->start(socket,
+                  true,
+                  [&socket, data, size, handler = std::move(handler)]
+                  {
+                      std::size_t              received = 0;
+                      std::optional<IpAddress> remoteAddress;
+                      unsigned short           remotePort = 0;
+                      const Socket::Status     status = socket.receive(data, size, received, remoteAddress, remotePort);
+                      if (status == Socket::Status::NotReady)
+                          return false;
+
+                      handler(status, received, remoteAddress, remotePort);
+                      return true;
+                  });
+}
+
+
+////////////////////////////////////////////////////////////
+TimerWheel::Id IoContext::asyncWait(Time delay, std::function<void()> handler)
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    // The wheel is expired by the loop with the mutex locked, so the handler is run as a separate task
+    auto expired = [impl = m_impl.get(), handler = std::move(handler)]() mutable
+    {
+        impl->enqueue(
+            [handler = std::move(handler)]
+            {
+                handler();
+                return std::size_t{1};
+            });
+    };
+
+    const TimerWheel::Id timer = m_impl->timers.schedule(delay, std::move(expired));
+
+    // The new timer may expire before the end of the current wait
+    m_impl->wakePoller();
+    return timer;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IoContext::cancelWait(TimerWheel::Id timer)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->timers.cancel(timer);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IoContext::run()
+{
+    return m_impl->run(true);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IoContext::poll()
+{
+    return m_impl->run(false);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::stop()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->stopped = true;
+    m_impl->condition.notify_all();
+    m_impl->wakePoller();
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::restart()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->stopped = false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IoContext::isStopped() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->stopped;
+}
+
+} // namespace sf
@@ -29,18 +29,270 @@
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <istream>
+#include <mutex>
 #include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
+#include <cassert>
 #include <cstring>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Cache of the host names resolved recently, and pool of threads resolving them in the background
+class Resolver
+{
+public:
+    ////////////////////////////////////////////////////////////
+    static Resolver& getInstance()
+    {
+        // The instance is never destroyed: detached threads blocked in
+        // the system resolver may still use it when the program exits
+        static Resolver& instance = *new Resolver;
+        return instance;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::optional<sf::IpAddress> find(const std::string& host)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        const auto it = m_cache.find(host);
+        if (it == m_cache.end())
+            return std::nullopt;
+
+        if (Clock::now() >= it->second.expiration)
+        {
+            m_cache.erase(it);
+            return std::nullopt;
+        }
+
+        return it->second.address;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void store(const std::string& host, sf::IpAddress address)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        if (m_duration <= Clock::duration::zero())
+            return;
+
+        // Keep the cache small by dropping the expired entries whenever it grows
+        if (m_cache.size() >= maxCacheSize)
+        {
+            const Clock::time_point now = Clock::now();
+            for (auto it = m_cache.begin(); it != m_cache.end();)
+                it = (now >= it->second.expiration) ? m_cache.erase(it) : std::next(it);
+
+            if (m_cache.size() >= maxCacheSize)
+                m_cache.clear();
+        }
+
+        m_cache.insert_or_assign(host, Entry{address, Clock::now() + m_duration});
+    }
+
+    ////////////////////////////////////////////////////////////
+    void setDuration(sf::Time duration)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        m_duration = duration.toDuration();
+        if (m_duration <= Clock::duration::zero())
+            m_cache.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::future<std::optional<sf::IpAddress>> enqueue(std::string host)
+    {
+        std::promise<std::optional<sf::IpAddress>> promise;
+        auto                                       future = promise.get_future();
+
+        const std::lock_guard lock(m_mutex);
+        m_requests.emplace_back(std::move(host), std::move(promise));
+
+        // Start a new thread if all the existing ones are busy
+        if ((m_idleThreads == 0) && (m_threadCount < maxThreadCount))
+        {
+            ++m_threadCount;
+            std::thread(&Resolver::work, this).detach();
+        }
+        else
+        {
+            m_condition.notify_one();
+        }
+
+        return future;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        sf::IpAddress     address;    //!< Resolved address
+        Clock::time_point expiration; //!< Time after which the address must be resolved again
+    };
+
+    using Request = std::pair<std::string, std::promise<std::optional<sf::IpAddress>>>;
+
+    static constexpr std::size_t maxThreadCount = 4;   // Maximum number of resolutions running at once
+    static constexpr std::size_t maxCacheSize   = 256; // Number of entries above which the cache is trimmed
+
+    ////////////////////////////////////////////////////////////
+    void work()
+    {
+        std::unique_lock lock(m_mutex);
+
+        while (true)
+        {
+            // Threads exit after being idle for a while, to be started again on demand
+            ++m_idleThreads;
+            const bool hasRequest = m_condition.wait_for(lock,
+                                                         std::chrono::seconds(10),
+                                                         [this] { return !m_requests.empty(); });
+            --m_idleThreads;
+
+            if (!hasRequest)
+            {
+                --m_threadCount;
+                return;
+            }
+
+            Request request = std::move(m_requests.front());
+            m_requests.pop_front();
+
+            lock.unlock();
+            request.second.set_value(sf::IpAddress::resolve(request.first));
+            lock.lock();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex                             m_mutex;                              //!< Mutex protecting the members
+    std::condition_variable                m_condition;                          //!< Signals requests to idle threads
+    std::deque<Request>                    m_requests;                           //!< Host names to resolve
+    std::unordered_map<std::string, Entry> m_cache;                              //!< Addresses resolved recently
+    Clock::duration                        m_duration{std::chrono::seconds(30)}; //!< Lifetime of cached addresses
+    std::size_t                            m_threadCount{};                      //!< Number of resolver threads
+    std::size_t                            m_idleThreads{};                      //!< Number of idle threads
+};
+
+
+////////////////////////////////////////////////////////////
+// Look an address up with the system resolver, preferring IPv4 results
+std::optional<sf::IpAddress> lookUp(const char* host, int family, int flags)
+{
+    addrinfo hints{}; // Zero-initialize
+    hints.ai_family = family;
+    hints.ai_flags  = flags;
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(host, nullptr, &hints, &result) != 0 || result == nullptr)
+        return std::nullopt;
+
+    // IPv4 addresses can be reached by every socket, IPv6 ones only by the dual-stack sockets
+    const addrinfo* chosen = result;
+    for (const addrinfo* info = result; info != nullptr; info = info->ai_next)
+    {
+        if (info->ai_family == AF_INET)
+        {
+            chosen = info;
+            break;
+        }
+    }
+
+    sockaddr_storage address{};
+    std::memcpy(&address, chosen->ai_addr, std::min(sizeof(address), static_cast<std::size_t>(chosen->ai_addrlen)));
+    freeaddrinfo(result);
+
+    return sf::priv::SocketImpl::getAddress(address);
+}
+
+
+////////////////////////////////////////////////////////////
+// Format an IPv6 address as recommended by RFC 5952 (lowercase, longest run of zeros replaced by "::")
+std::string formatIpV6(const std::array<std::uint8_t, 16>& bytes)
+{
+    // IPv4-mapped addresses end with a decimal IPv4 address
+    static constexpr std::array<std::uint8_t, 12> mappedPrefix{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+    if (std::equal(mappedPrefix.begin(), mappedPrefix.end(), bytes.begin()))
+        return "::ffff:" + sf::IpAddress(bytes[12], bytes[13], bytes[14], bytes[15]).toString();
+
+    std::array<unsigned int, 8> groups{};
+    for (std::size_t i = 0; i < groups.size(); ++i)
+        groups[i] = static_cast<unsigned int>((bytes[i * 2] << 8) | bytes[i * 2 + 1]);
+
+    // Find the longest run of at least two zero groups
+    std::size_t zerosBegin  = groups.size();
+    std::size_t zerosLength = 1;
+    for (std::size_t i = 0; i < groups.size();)
+    {
+        std::size_t end = i;
+        while (end < groups.size() && groups[end] == 0)
+            ++end;
+
+        if (end - i > zerosLength)
+        {
+            zerosBegin  = i;
+            zerosLength = end - i;
+        }
+
+        i = std::max(end, i + 1);
+    }
+
+    static constexpr char digits[] = "0123456789abcdef";
+
+    std::string result;
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        if (i == zerosBegin)
+        {
+            result += "::";
+            i += zerosLength - 1;
+            continue;
+        }
+
+        if (!result.empty() && result.back() != ':')
+            result += ':';
+
+        // Leading zeros are omitted
+        bool started = false;
+        for (int shift = 12; shift >= 0; shift -= 4)
+        {
+            const unsigned int digit = (groups[i] >> shift) & 0xf;
+            if (digit != 0 || started || shift == 0)
+            {
+                result += digits[digit];
+                started = true;
+            }
+        }
+    }
+
+    return result;
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 const IpAddress IpAddress::Any(0, 0, 0, 0);
 const IpAddress IpAddress::LocalHost(127, 0, 0, 1);
 const IpAddress IpAddress::Broadcast(255, 255, 255, 255);
+const IpAddress IpAddress::AnyV6(std::array<std::uint8_t, 16>{});
+const IpAddress IpAddress::LocalHostV6(std::array<std::uint8_t, 16>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
 
 
 ////////////////////////////////////////////////////////////
@@ -65,44 +317,85 @@ std::optional<IpAddress> IpAddress::resolve(std::string_view address)
     if (const std::uint32_t ip = inet_addr(address.data()); ip != INADDR_NONE)
         return IpAddress(ntohl(ip));
 
-    // Not a valid address, try to convert it as a host name
-    addrinfo hints{}; // Zero-initialize
-    hints.ai_family = AF_INET;
+    // Try to convert the address as a hexadecimal IPv6 representation ("xxxx:xxxx::xxxx")
+    const std::string host(address);
+    if (host.find(':') != std::string::npos)
+        return lookUp(host.c_str(), AF_INET6, AI_NUMERICHOST);
 
-    addrinfo* result = nullptr;
-    if (getaddrinfo(address.data(), nullptr, &hints, &result) == 0 && result != nullptr)
-    {
-        sockaddr_in sin{};
-        std::memcpy(&sin, result->ai_addr, sizeof(*result->ai_addr));
+    // Not a valid address, try to convert it as a host name, unless it was resolved recently
+    if (const std::optional<IpAddress> cached = Resolver::getInstance().find(host))
+        return cached;
 
-        const std::uint32_t ip = sin.sin_addr.s_addr;
-        freeaddrinfo(result);
+    const std::optional<IpAddress> resolved = lookUp(host.c_str(), AF_UNSPEC, 0);
+    if (resolved)
+        Resolver::getInstance().store(host, *resolved);
 
-        return IpAddress(ntohl(ip));
+    return resolved;
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<IpAddress>> IpAddress::resolveAsync(std::string address)
+{
+    // Numeric addresses and cached host names don't need to wait for the resolver
+    const bool isNumeric = (address == "255.255.255.255") || (inet_addr(address.c_str()) != INADDR_NONE) ||
+                           (address.find(':') != std::string::npos);
+    if (address.empty() || isNumeric || Resolver::getInstance().find(address))
+    {
+        std::promise<std::optional<IpAddress>> promise;
+        promise.set_value(resolve(address));
+        return promise.get_future();
     }
 
-    return std::nullopt;
+    return Resolver::getInstance().enqueue(std::move(address));
+}
+
+
+////////////////////////////////////////////////////////////
+void IpAddress::setResolveCacheDuration(Time duration)
+{
+    Resolver::getInstance().setDuration(duration);
 }
 
 
 ////////////////////////////////////////////////////////////
 IpAddress::IpAddress(std::uint8_t byte0, std::uint8_t byte1, std::uint8_t byte2, std::uint8_t byte3) :
-m_address(htonl(static_cast<std::uint32_t>((byte0 << 24) | (byte1 << 16) | (byte2 << 8) | byte3)))
+m_bytes{byte0, byte1, byte2, byte3}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IpAddress::IpAddress(std::uint32_t address) :
+IpAddress(static_cast<std::uint8_t>(address >> 24),
+          static_cast<std::uint8_t>(address >> 16),
+          static_cast<std::uint8_t>(address >> 8),
+          static_cast<std::uint8_t>(address))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IpAddress::IpAddress(const std::array<std::uint8_t, 16>& bytes) : m_bytes(bytes), m_type(Type::V6)
 {
 }
 
 
 ////////////////////////////////////////////////////////////
-IpAddress::IpAddress(std::uint32_t address) : m_address(htonl(address))
+IpAddress::Type IpAddress::getType() const
 {
+    return m_type;
 }
 
 
 ////////////////////////////////////////////////////////////
 std::string IpAddress::toString() const
 {
+    if (m_type == Type::V6)
+        return formatIpV6(m_bytes);
+
     in_addr address{};
-    address.s_addr = m_address;
+    std::memcpy(&address.s_addr, m_bytes.data(), sizeof(address.s_addr));
 
     return inet_ntoa(address);
 }
@@ -111,7 +404,19 @@ std::string IpAddress::toString() const
 ////////////////////////////////////////////////////////////
 std::uint32_t IpAddress::toInteger() const
 {
-    return ntohl(m_address);
+    assert(m_type == Type::V4 && "IpAddress::toInteger() cannot be called on an IPv6 address");
+
+    return static_cast<std::uint32_t>((m_bytes[0] << 24) | (m_bytes[1] << 16) | (m_bytes[2] << 8) | m_bytes[3]);
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<std::uint8_t, 16> IpAddress::toBytes() const
+{
+    if (m_type == Type::V6)
+        return m_bytes;
+
+    return {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, m_bytes[0], m_bytes[1], m_bytes[2], m_bytes[3]};
 }
 
 
@@ -188,7 +493,18 @@ bool operator!=(const IpAddress& left, const IpAddress& right)
 ////////////////////////////////////////////////////////////
 bool operator<(const IpAddress& left, const IpAddress& right)
 {
-    return left.m_address < right.m_address;
+    if (left.m_type != right.m_type)
+        return left.m_type < right.m_type;
+
+    if (left.m_type == IpAddress::Type::V6)
+        return left.m_bytes < right.m_bytes;
+
+    // IPv4 addresses keep the historical order of their network representation
+    std::uint32_t leftAddress  = 0;
+    std::uint32_t rightAddress = 0;
+    std::memcpy(&leftAddress, left.m_bytes.data(), sizeof(leftAddress));
+    std::memcpy(&rightAddress, right.m_bytes.data(), sizeof(rightAddress));
+    return leftAddress < rightAddress;
 }
 
 
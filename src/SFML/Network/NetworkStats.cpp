@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/NetworkStats.hpp>
+#include <SFML/Network/NetworkStatsImpl.hpp>
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace NetworkStatsImpl
+{
+////////////////////////////////////////////////////////////
+// Global counters, updated concurrently by the sockets of all the threads
+struct GlobalStats
+{
+    std::atomic<std::uint64_t> bytesSent{};
+    std::atomic<std::uint64_t> bytesReceived{};
+    std::atomic<std::uint64_t> packetsSent{};
+    std::atomic<std::uint64_t> packetsReceived{};
+    std::atomic<std::uint64_t> systemCalls{};
+    std::atomic<std::uint64_t> partialSends{};
+    std::atomic<std::int64_t>  selectorWaitTime{}; // In microseconds
+    std::array<std::atomic<std::uint64_t>, sf::NetworkStats::LatencyBucketCount> receiveLatency{};
+};
+
+std::atomic<bool> enabled{false};
+GlobalStats       globalStats;
+} // namespace NetworkStatsImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void NetworkStats::setEnabled(bool isEnabled)
+{
+    NetworkStatsImpl::enabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool NetworkStats::isEnabled()
+{
+    return NetworkStatsImpl::enabled.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+NetworkStats NetworkStats::getGlobal()
+{
+    using namespace NetworkStatsImpl;
+
+    NetworkStats stats;
+    stats.bytesSent        = globalStats.bytesSent.load(std::memory_order_relaxed);
+    stats.bytesReceived    = globalStats.bytesReceived.load(std::memory_order_relaxed);
+    stats.packetsSent      = globalStats.packetsSent.load(std::memory_order_relaxed);
+    stats.packetsReceived  = globalStats.packetsReceived.load(std::memory_order_relaxed);
+    stats.systemCalls      = globalStats.systemCalls.load(std::memory_order_relaxed);
+    stats.partialSends     = globalStats.partialSends.load(std::memory_order_relaxed);
+    stats.selectorWaitTime = microseconds(globalStats.selectorWaitTime.load(std::memory_order_relaxed));
+    for (std::size_t i = 0; i < LatencyBucketCount; ++i)
+        stats.receiveLatency[i] = globalStats.receiveLatency[i].load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkStats::resetGlobal()
+{
+    using namespace NetworkStatsImpl;
+
+    globalStats.bytesSent.store(0, std::memory_order_relaxed);
+    globalStats.bytesReceived.store(0, std::memory_order_relaxed);
+    globalStats.packetsSent.store(0, std::memory_order_relaxed);
+    globalStats.packetsReceived.store(0, std::memory_order_relaxed);
+    globalStats.systemCalls.store(0, std::memory_order_relaxed);
+    globalStats.partialSends.store(0, std::memory_order_relaxed);
+    globalStats.selectorWaitTime.store(0, std::memory_order_relaxed);
+    for (std::atomic<std::uint64_t>& bucket : globalStats.receiveLatency)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t NetworkStats::getLatencyBucket(Time latency)
+{
+    // The bucket is the index of the highest bit set in the number of microseconds
+    std::size_t        bucket = 0;
+    const std::int64_t value  = latency.asMicroseconds();
+    for (std::int64_t bound = 2; (bucket + 1 < LatencyBucketCount) && (value >= bound); bound *= 2)
+        ++bucket;
+
+    return bucket;
+}
+
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void addGlobalSend(std::uint64_t bytes, std::uint64_t packets, std::uint64_t systemCalls)
+{
+    using namespace NetworkStatsImpl;
+
+    globalStats.bytesSent.fetch_add(bytes, std::memory_order_relaxed);
+    globalStats.packetsSent.fetch_add(packets, std::memory_order_relaxed);
+    globalStats.systemCalls.fetch_add(systemCalls, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void addGlobalReceive(std::uint64_t bytes, std::uint64_t packets, std::uint64_t systemCalls)
+{
+    using namespace NetworkStatsImpl;
+
+    globalStats.bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+    globalStats.packetsReceived.fetch_add(packets, std::memory_order_relaxed);
+    globalStats.systemCalls.fetch_add(systemCalls, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void addGlobalPartialSend()
+{
+    NetworkStatsImpl::globalStats.partialSends.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void addGlobalReceiveLatency(std::size_t bucket)
+{
+    NetworkStatsImpl::globalStats.receiveLatency[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void addGlobalSelectorWait(Time duration)
+{
+    NetworkStatsImpl::globalStats.selectorWaitTime.fetch_add(duration.asMicroseconds(), std::memory_order_relaxed);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Add sent data to the global statistics
+///
+/// \param bytes       Number of bytes sent
+/// \param packets     Number of packets or datagrams sent
+/// \param systemCalls Number of system calls made
+///
+////////////////////////////////////////////////////////////
+void addGlobalSend(std::uint64_t bytes, std::uint64_t packets, std::uint64_t systemCalls);
+
+////////////////////////////////////////////////////////////
+/// \brief Add received data to the global statistics
+///
+/// \param bytes       Number of bytes received
+/// \param packets     Number of packets or datagrams received
+/// \param systemCalls Number of system calls made
+///
+////////////////////////////////////////////////////////////
+void addGlobalReceive(std::uint64_t bytes, std::uint64_t packets, std::uint64_t systemCalls);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a partial send to the global statistics
+///
+////////////////////////////////////////////////////////////
+void addGlobalPartialSend();
+
+////////////////////////////////////////////////////////////
+/// \brief Add a packet reception latency to the global statistics
+///
+/// \param bucket Bucket of the latency histogram
+///
+////////////////////////////////////////////////////////////
+void addGlobalReceiveLatency(std::size_t bucket);
+
+////////////////////////////////////////////////////////////
+/// \brief Add time spent waiting in a selector to the global statistics
+///
+/// \param duration Time spent waiting
+///
+////////////////////////////////////////////////////////////
+void addGlobalSelectorWait(Time duration);
+
+} // namespace sf::priv
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Null/TlsSocketImpl.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool TlsSocketImpl::isAvailable()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocketImpl::connect(SocketHandle /* handle */,
+                                      const std::string& /* hostName */,
+                                      unsigned short /* port */,
+                                      bool /* verifyPeer */,
+                                      Time /* timeout */,
+                                      std::string_view /* earlyData */)
+{
+    err() << "Failed to establish TLS session (SFML was built without TLS support, see SFML_USE_OPENSSL)"
+          << std::endl;
+    return Socket::Status::Error;
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSocketImpl::shutdown()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocketImpl::send(const void* /* data */, std::size_t /* size */, std::size_t& sent)
+{
+    sent = 0;
+    return Socket::Status::Error;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocketImpl::receive(void* /* data */, std::size_t /* size */, std::size_t& received)
+{
+    received = 0;
+    return Socket::Status::Error;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSocketImpl::isSessionReused() const
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSocketImpl::isEarlyDataAccepted() const
+{
+    return false;
+}
+
+} // namespace sf::priv
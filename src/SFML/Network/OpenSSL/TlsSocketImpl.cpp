@@ -0,0 +1,530 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/OpenSSL/TlsSocketImpl.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+#include <climits>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TlsSocketImplImpl
+{
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD) || defined(SFML_SYSTEM_OPENBSD) || \
+    defined(SFML_SYSTEM_NETBSD)
+constexpr int sendFlags = MSG_NOSIGNAL;
+#else
+constexpr int sendFlags = 0;
+#endif
+
+////////////////////////////////////////////////////////////
+// Transport of the encrypted data: a plain socket BIO would write() to the socket and raise SIGPIPE
+int writeSocket(BIO* bio, const char* data, int size)
+{
+    const sf::SocketHandle handle = *static_cast<sf::SocketHandle*>(BIO_get_data(bio));
+    BIO_clear_retry_flags(bio);
+
+    const auto result = static_cast<int>(
+        ::send(handle, data, static_cast<sf::priv::SocketImpl::Size>(size), sendFlags));
+    if ((result < 0) && (sf::priv::SocketImpl::getErrorStatus() == sf::Socket::Status::NotReady))
+        BIO_set_retry_write(bio);
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+int readSocket(BIO* bio, char* data, int size)
+{
+    const sf::SocketHandle handle = *static_cast<sf::SocketHandle*>(BIO_get_data(bio));
+    BIO_clear_retry_flags(bio);
+
+    const auto result = static_cast<int>(recv(handle, data, static_cast<sf::priv::SocketImpl::Size>(size), 0));
+    if ((result < 0) && (sf::priv::SocketImpl::getErrorStatus() == sf::Socket::Status::NotReady))
+        BIO_set_retry_read(bio);
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+long controlSocket(BIO* /* bio */, int command, long /* number */, void* /* pointer */)
+{
+    // The socket doesn't buffer anything
+    return (command == BIO_CTRL_FLUSH) ? 1 : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+BIO_METHOD* getSocketMethod()
+{
+    static const std::unique_ptr<BIO_METHOD, decltype(&BIO_meth_free)> method(
+        []
+        {
+            BIO_METHOD* socketMethod = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "sfml-socket");
+            BIO_meth_set_write(socketMethod, &writeSocket);
+            BIO_meth_set_read(socketMethod, &readSocket);
+            BIO_meth_set_ctrl(socketMethod, &controlSocket);
+            return socketMethod;
+        }(),
+        &BIO_meth_free);
+
+    return method.get();
+}
+
+
+////////////////////////////////////////////////////////////
+// Sessions kept to be resumed by the next connections, by host name and port
+class SessionCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    static SessionCache& getInstance()
+    {
+        static SessionCache instance;
+        return instance;
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~SessionCache()
+    {
+        for (const auto& [key, session] : m_sessions)
+            SSL_SESSION_free(session);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Take a session to resume, the caller owns a reference to it
+    SSL_SESSION* take(const std::string& key)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        const auto it = m_sessions.find(key);
+        if (it == m_sessions.end())
+            return nullptr;
+
+        // TLS 1.3 tickets should be used only once, the server sends new ones on each connection
+        SSL_SESSION* session = it->second;
+        if (SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION)
+            m_sessions.erase(it);
+        else
+            SSL_SESSION_up_ref(session);
+
+        return session;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Store a session, taking ownership of the given reference
+    void give(const std::string& key, SSL_SESSION* session)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        SSL_SESSION*& stored = m_sessions[key];
+        if (stored)
+            SSL_SESSION_free(stored);
+
+        stored = session;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex                          m_mutex;    //!< Mutex protecting the sessions
+    std::map<std::string, SSL_SESSION*> m_sessions; //!< Resumable sessions, by host name and port
+};
+
+
+////////////////////////////////////////////////////////////
+// Index of the session key in the application data of the OpenSSL connections
+int getSessionKeyIndex()
+{
+    static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+int onNewSession(SSL* ssl, SSL_SESSION* session)
+{
+    const auto* key = static_cast<const std::string*>(SSL_get_ex_data(ssl, getSessionKeyIndex()));
+    if (!key || !SSL_SESSION_is_resumable(session))
+        return 0;
+
+    SessionCache::getInstance().give(*key, session);
+    return 1;
+}
+
+
+////////////////////////////////////////////////////////////
+SSL_CTX* getContext()
+{
+    static const std::unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)> context(
+        []
+        {
+            SSL_CTX* clientContext = SSL_CTX_new(TLS_client_method());
+            if (!clientContext)
+                return clientContext;
+
+            SSL_CTX_set_min_proto_version(clientContext, TLS1_2_VERSION);
+            SSL_CTX_set_default_verify_paths(clientContext);
+            SSL_CTX_set_mode(clientContext, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
+            // Many servers close the connection without notifying the end of the session
+#if defined(SSL_OP_IGNORE_UNEXPECTED_EOF)
+            SSL_CTX_set_options(clientContext, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+
+            // Keep the sessions in our own cache, which survives the connections
+            SSL_CTX_set_session_cache_mode(clientContext, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+            SSL_CTX_sess_set_new_cb(clientContext, &onNewSession);
+            return clientContext;
+        }(),
+        &SSL_CTX_free);
+
+    return context.get();
+}
+
+
+////////////////////////////////////////////////////////////
+// Tell whether a host name is an IP address literal
+bool isAddressLiteral(const std::string& hostName)
+{
+    return (hostName.find(':') != std::string::npos) ||
+           std::all_of(hostName.begin(), hostName.end(), [](char c) { return ((c >= '0') && (c <= '9')) || (c == '.'); });
+}
+
+
+////////////////////////////////////////////////////////////
+// Print the errors queued by OpenSSL
+void printErrors(const char* operation)
+{
+    sf::err() << "Failed to " << operation << " (TLS error";
+    while (const unsigned long error = ERR_get_error())
+    {
+        char description[256];
+        ERR_error_string_n(error, description, sizeof(description));
+        sf::err() << ", " << description;
+    }
+    sf::err() << ")" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Socket::Status getStatus(SSL* ssl, int result)
+{
+    switch (SSL_get_error(ssl, result))
+    {
+        case SSL_ERROR_WANT_READ:
+        case SSL_ERROR_WANT_WRITE:
+            return sf::Socket::Status::NotReady;
+
+        case SSL_ERROR_ZERO_RETURN:
+            return sf::Socket::Status::Disconnected;
+
+        case SSL_ERROR_SYSCALL:
+        {
+            // A system error without any errno means that the peer closed the connection
+            const sf::Socket::Status status = sf::priv::SocketImpl::getErrorStatus();
+            ERR_clear_error();
+            return (status == sf::Socket::Status::Error) ? sf::Socket::Status::Disconnected : status;
+        }
+
+        default:
+            printErrors("process TLS data");
+            return sf::Socket::Status::Error;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Wait until the socket is ready for what OpenSSL wants, return false on timeout
+bool waitForSocket(SSL* ssl, sf::SocketHandle handle, int result, const sf::Clock& clock, sf::Time timeout)
+{
+    fd_set selector;
+    FD_ZERO(&selector);
+    FD_SET(handle, &selector);
+
+    timeval  time{};
+    timeval* timePointer = nullptr;
+    if (timeout > sf::Time::Zero)
+    {
+        const sf::Time remaining = timeout - clock.getElapsedTime();
+        if (remaining <= sf::Time::Zero)
+            return false;
+
+        time.tv_sec  = static_cast<long>(remaining.asMicroseconds() / 1000000);
+        time.tv_usec = static_cast<int>(remaining.asMicroseconds() % 1000000);
+        timePointer  = &time;
+    }
+
+    const bool wantsWrite = SSL_get_error(ssl, result) == SSL_ERROR_WANT_WRITE;
+    return select(static_cast<int>(handle + 1),
+                  wantsWrite ? nullptr : &selector,
+                  wantsWrite ? &selector : nullptr,
+                  nullptr,
+                  timePointer) > 0;
+}
+} // namespace TlsSocketImplImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool TlsSocketImpl::isAvailable()
+{
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSocketImpl::~TlsSocketImpl()
+{
+    if (m_ssl)
+        SSL_free(m_ssl);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocketImpl::connect(SocketHandle       handle,
+                                      const std::string& hostName,
+                                      unsigned short     port,
+                                      bool               verifyPeer,
+                                      Time               timeout,
+                                      std::string_view   earlyData)
+{
+    using namespace TlsSocketImplImpl;
+
+    SSL_CTX* context = getContext();
+    if (!context)
+    {
+        printErrors("create TLS context");
+        return Socket::Status::Error;
+    }
+
+    if (m_ssl)
+        SSL_free(m_ssl);
+
+    m_ssl               = SSL_new(context);
+    m_handle            = handle;
+    m_sessionKey        = hostName + ':' + std::to_string(port);
+    m_earlyDataAccepted = false;
+
+    // Send and receive through the socket
+    BIO* bio = BIO_new(getSocketMethod());
+    BIO_set_data(bio, &m_handle);
+    BIO_set_init(bio, 1);
+    SSL_set_bio(m_ssl, bio, bio);
+    SSL_set_ex_data(m_ssl, getSessionKeyIndex(), &m_sessionKey);
+
+    // Check that the certificate was issued to the server
+    SSL_set_verify(m_ssl, verifyPeer ? SSL_VERIFY_PEER : SSL_VERIFY_NONE, nullptr);
+    if (isAddressLiteral(hostName))
+    {
+        X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(m_ssl), hostName.c_str());
+    }
+    else
+    {
+        // Same as SSL_set_tlsext_host_name, without its C-style cast
+        SSL_ctrl(m_ssl, SSL_CTRL_SET_TLSEXT_HOSTNAME, TLSEXT_NAMETYPE_host_name, const_cast<char*>(hostName.c_str()));
+        SSL_set1_host(m_ssl, hostName.c_str());
+    }
+
+    // Resume the last session established with the server, if any
+    bool canSendEarlyData = false;
+    if (SSL_SESSION* session = SessionCache::getInstance().take(m_sessionKey))
+    {
+        canSendEarlyData = SSL_SESSION_get_max_early_data(session) > 0;
+        SSL_set_session(m_ssl, session);
+        SSL_SESSION_free(session);
+    }
+
+    const Clock clock;
+    std::size_t earlyDataSent = 0;
+
+    // Send the early data with the first flight of the handshake, if the session allows it
+    if (canSendEarlyData && !earlyData.empty())
+    {
+        while (earlyDataSent < earlyData.size())
+        {
+            std::size_t written = 0;
+            const int   result  = SSL_write_early_data(m_ssl,
+                                                    earlyData.data() + earlyDataSent,
+                                                    earlyData.size() - earlyDataSent,
+                                                    &written);
+            if (result > 0)
+            {
+                earlyDataSent += written;
+            }
+            else if ((getStatus(m_ssl, result) != Socket::Status::NotReady) ||
+                     !waitForSocket(m_ssl, m_handle, result, clock, timeout))
+            {
+                return Socket::Status::Error;
+            }
+        }
+    }
+
+    // Complete the handshake
+    while (true)
+    {
+        const int result = SSL_connect(m_ssl);
+        if (result == 1)
+            break;
+
+        if (SSL_get_error(m_ssl, result) == SSL_ERROR_SSL)
+        {
+            const long verifyResult = SSL_get_verify_result(m_ssl);
+            if (verifyResult != X509_V_OK)
+                err() << "Failed to verify the certificate of " << hostName << " ("
+                      << X509_verify_cert_error_string(verifyResult) << ")" << std::endl;
+            printErrors("perform the TLS handshake");
+            return Socket::Status::Error;
+        }
+
+        const Socket::Status status = getStatus(m_ssl, result);
+        if (status != Socket::Status::NotReady)
+            return status;
+
+        if (!waitForSocket(m_ssl, m_handle, result, clock, timeout))
+        {
+            err() << "Failed to perform the TLS handshake with " << hostName << " (timeout)" << std::endl;
+            return Socket::Status::Error;
+        }
+    }
+
+    // Send the early data now if the server didn't accept it with the handshake
+    m_earlyDataAccepted = (earlyDataSent > 0) && (SSL_get_early_data_status(m_ssl) == SSL_EARLY_DATA_ACCEPTED);
+    std::size_t position = m_earlyDataAccepted ? earlyData.size() : 0;
+    while (position < earlyData.size())
+    {
+        std::size_t          sent   = 0;
+        const Socket::Status status = send(earlyData.data() + position, earlyData.size() - position, sent);
+        position += sent;
+
+        if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+        {
+            if (!waitForSocket(m_ssl, m_handle, -1, clock, timeout))
+                return Socket::Status::Error;
+        }
+        else if (status != Socket::Status::Done)
+        {
+            return status;
+        }
+    }
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSocketImpl::shutdown()
+{
+    if (m_ssl)
+    {
+        // Notify the server, without waiting for its answer
+        SSL_shutdown(m_ssl);
+        ERR_clear_error();
+        SSL_free(m_ssl);
+        m_ssl = nullptr;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocketImpl::send(const void* data, std::size_t size, std::size_t& sent)
+{
+    using namespace TlsSocketImplImpl;
+
+    sent = 0;
+    if (!m_ssl)
+        return Socket::Status::Disconnected;
+
+    // Loop until every byte has been sent
+    while (sent < size)
+    {
+        std::size_t written = 0;
+        const int   result  = SSL_write_ex(m_ssl, static_cast<const char*>(data) + sent, size - sent, &written);
+        if (result <= 0)
+        {
+            const Socket::Status status = getStatus(m_ssl, result);
+            return ((status == Socket::Status::NotReady) && (sent > 0)) ? Socket::Status::Partial : status;
+        }
+
+        sent += written;
+    }
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocketImpl::receive(void* data, std::size_t size, std::size_t& received)
+{
+    using namespace TlsSocketImplImpl;
+
+    received = 0;
+    if (!m_ssl)
+        return Socket::Status::Disconnected;
+
+    const int result = SSL_read_ex(m_ssl, data, size, &received);
+    if (result <= 0)
+        return getStatus(m_ssl, result);
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSocketImpl::isSessionReused() const
+{
+    return m_ssl && SSL_session_reused(m_ssl);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSocketImpl::isEarlyDataAccepted() const
+{
+    return m_earlyDataAccepted;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Socket.hpp>
+#include <SFML/Network/SocketHandle.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+
+using SSL = struct ssl_st;
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief TLS session of a socket, implemented with OpenSSL
+///
+////////////////////////////////////////////////////////////
+class TlsSocketImpl
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether TLS is supported
+    ///
+    /// \return True
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSocketImpl() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TlsSocketImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSocketImpl(const TlsSocketImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSocketImpl& operator=(const TlsSocketImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Perform the TLS handshake over a connected socket
+    ///
+    /// \param handle     Handle of the connected socket, in non-blocking mode
+    /// \param hostName   Name of the server
+    /// \param port       Port of the server
+    /// \param verifyPeer Verify the certificate of the server?
+    /// \param timeout    Maximum time to wait, or zero to wait forever
+    /// \param earlyData  Data to send as soon as possible
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    Socket::Status connect(SocketHandle       handle,
+                           const std::string& hostName,
+                           unsigned short     port,
+                           bool               verifyPeer,
+                           Time               timeout,
+                           std::string_view   earlyData);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the closing alert of the session
+    ///
+    ////////////////////////////////////////////////////////////
+    void shutdown();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encrypt and send data
+    ///
+    /// \param data Pointer to the sequence of bytes to send
+    /// \param size Number of bytes to send
+    /// \param sent The number of bytes sent will be written here
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    Socket::Status send(const void* data, std::size_t size, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive and decrypt data
+    ///
+    /// \param data     Pointer to the array to fill with the received bytes
+    /// \param size     Maximum number of bytes that can be received
+    /// \param received This variable is filled with the actual number of bytes received
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    Socket::Status receive(void* data, std::size_t size, std::size_t& received);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the session was resumed
+    ///
+    /// \return True if a cached session was resumed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSessionReused() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the server accepted the early data
+    ///
+    /// \return True if the early data was sent with the handshake
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isEarlyDataAccepted() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SSL*         m_ssl{};               //!< OpenSSL connection
+    SocketHandle m_handle{};            //!< Handle of the underlying socket
+    std::string  m_sessionKey;          //!< Key of the session in the session cache
+    bool         m_earlyDataAccepted{}; //!< Was the early data accepted by the server?
+};
+
+} // namespace sf::priv
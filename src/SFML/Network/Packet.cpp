@@ -26,17 +26,72 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketEncoding.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Lz4.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+#include <utility>
 
 #include <cstring>
 #include <cwchar>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Append values to a buffer in network byte order (big endian), as values of type T
+template <typename T, typename U, typename Buffer>
+void appendBigEndian(Buffer& buffer, const U* values, std::size_t count)
+{
+    static_assert(std::is_unsigned_v<T> && (sizeof(U) <= sizeof(T)));
+
+    const std::size_t offset = buffer.size();
+    buffer.resize(offset + count * sizeof(T));
+
+    std::byte* bytes = buffer.data() + offset;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto value = static_cast<T>(values[i]);
+        for (std::size_t j = 0; j < sizeof(T); ++j)
+            *bytes++ = static_cast<std::byte>(value >> (8 * (sizeof(T) - 1 - j)));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Append an unsigned integer to a buffer with a variable-length encoding
+template <typename Buffer>
+void appendVarUIntTo(Buffer& buffer, std::uint64_t value)
+{
+    // Write 7 bits per byte, the most significant bit telling whether more bytes follow
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<std::byte>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<std::byte>(value));
+}
+
+
+////////////////////////////////////////////////////////////
+// First byte of the data sent by a compressed packet
+enum class CompressionMethod : unsigned char
+{
+    Stored, // The data is not compressed, because it couldn't be made smaller
+    Lz4     // The data is the decompressed size followed by an LZ4 block
+};
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -47,6 +102,7 @@ void Packet::append(const void* data, std::size_t sizeInBytes)
         const auto* begin = reinterpret_cast<const std::byte*>(data);
         const auto* end   = begin + sizeInBytes;
         m_data.insert(m_data.end(), begin, end);
+        updateMemoryUsage();
     }
 }
 
@@ -67,6 +123,61 @@ void Packet::clear()
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::reserve(std::size_t sizeInBytes)
+{
+    m_data.reserve(sizeInBytes);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Packet::getCapacity() const
+{
+    return m_data.capacity();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::updateMemoryUsage()
+{
+    m_memoryCounter.setBytes(m_data.capacity() + m_sendBuffer.capacity());
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::setCompression(Compression compression)
+{
+    m_compression = compression;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Compression Packet::getCompression() const
+{
+    return m_compression;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::encodeDelta(const Packet& reference)
+{
+    // Exclusive or is its own inverse, so encoding and decoding are the same operation
+    const std::size_t commonSize = std::min(m_data.size(), reference.m_data.size());
+    for (std::size_t i = 0; i < commonSize; ++i)
+        m_data[i] ^= reference.m_data[i];
+
+    m_readPos = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::decodeDelta(const Packet& reference)
+{
+    encodeDelta(reference);
+}
+
+
 ////////////////////////////////////////////////////////////
 const void* Packet::getData() const
 {
@@ -328,12 +439,9 @@ Packet& Packet::operator>>(std::wstring& data)
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
         // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<wchar_t>(character);
-        }
+        data.resize(length);
+        priv::readBigEndian<std::uint32_t>(&m_data[m_readPos], data.data(), length);
+        m_readPos += length * sizeof(std::uint32_t);
     }
 
     return *this;
@@ -351,12 +459,10 @@ Packet& Packet::operator>>(String& data)
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
         // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<char32_t>(character);
-        }
+        std::u32string characters(length, U'\0');
+        priv::readBigEndian<std::uint32_t>(&m_data[m_readPos], characters.data(), length);
+        data = String(std::move(characters));
+        m_readPos += length * sizeof(std::uint32_t);
     }
 
     return *this;
@@ -533,8 +639,9 @@ Packet& Packet::operator<<(const std::wstring& data)
     // Then insert characters
     if (length > 0)
     {
-        for (const wchar_t c : data)
-            *this << static_cast<std::uint32_t>(c);
+        // wchar_t is either 16 or 32-bit depending on the platform, characters are always sent as 32-bit
+        appendBigEndian<std::uint32_t>(m_data, data.data(), length);
+        updateMemoryUsage();
     }
 
     return *this;
@@ -551,14 +658,248 @@ Packet& Packet::operator<<(const String& data)
     // Then insert characters
     if (length > 0)
     {
-        for (const unsigned int datum : data)
-            *this << datum;
+        appendBigEndian<std::uint32_t>(m_data, data.getData(), length);
+        updateMemoryUsage();
     }
 
     return *this;
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const std::int16_t* data, std::size_t count)
+{
+    appendBigEndian<std::uint16_t>(m_data, data, count);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const std::uint16_t* data, std::size_t count)
+{
+    appendBigEndian<std::uint16_t>(m_data, data, count);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const std::int32_t* data, std::size_t count)
+{
+    appendBigEndian<std::uint32_t>(m_data, data, count);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const std::uint32_t* data, std::size_t count)
+{
+    appendBigEndian<std::uint32_t>(m_data, data, count);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const std::int64_t* data, std::size_t count)
+{
+    appendBigEndian<std::uint64_t>(m_data, data, count);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const std::uint64_t* data, std::size_t count)
+{
+    appendBigEndian<std::uint64_t>(m_data, data, count);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const float* data, std::size_t count)
+{
+    append(data, count * sizeof(float));
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const double* data, std::size_t count)
+{
+    append(data, count * sizeof(double));
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(std::int16_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::int16_t)))
+    {
+        priv::readBigEndian<std::uint16_t>(m_data.data() + m_readPos, data, count);
+        m_readPos += count * sizeof(std::int16_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(std::uint16_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::uint16_t)))
+    {
+        priv::readBigEndian<std::uint16_t>(m_data.data() + m_readPos, data, count);
+        m_readPos += count * sizeof(std::uint16_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(std::int32_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::int32_t)))
+    {
+        priv::readBigEndian<std::uint32_t>(m_data.data() + m_readPos, data, count);
+        m_readPos += count * sizeof(std::int32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(std::uint32_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::uint32_t)))
+    {
+        priv::readBigEndian<std::uint32_t>(m_data.data() + m_readPos, data, count);
+        m_readPos += count * sizeof(std::uint32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(std::int64_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::int64_t)))
+    {
+        priv::readBigEndian<std::uint64_t>(m_data.data() + m_readPos, data, count);
+        m_readPos += count * sizeof(std::int64_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(std::uint64_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::uint64_t)))
+    {
+        priv::readBigEndian<std::uint64_t>(m_data.data() + m_readPos, data, count);
+        m_readPos += count * sizeof(std::uint64_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(float* data, std::size_t count)
+{
+    if ((count > 0) && checkSize(count * sizeof(float)))
+    {
+        std::memcpy(data, &m_data[m_readPos], count * sizeof(float));
+        m_readPos += count * sizeof(float);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractArray(double* data, std::size_t count)
+{
+    if ((count > 0) && checkSize(count * sizeof(double)))
+    {
+        std::memcpy(data, &m_data[m_readPos], count * sizeof(double));
+        m_readPos += count * sizeof(double);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendVarUInt(std::uint64_t data)
+{
+    appendVarUIntTo(m_data, data);
+    updateMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendVarInt(std::int64_t data)
+{
+    // Zigzag encoding maps 0, -1, 1, -2, 2... to 0, 1, 2, 3, 4...
+    const auto value = static_cast<std::uint64_t>(data);
+    appendVarUInt((value << 1) ^ (data < 0 ? ~std::uint64_t{0} : std::uint64_t{0}));
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractVarUInt(std::uint64_t& data)
+{
+    m_isValid = m_isValid && priv::readVarUInt(m_data.data(), m_data.size(), m_readPos, data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractVarInt(std::int64_t& data)
+{
+    std::uint64_t value = 0;
+    if (extractVarUInt(value))
+        data = static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::appendUtf8(const String& data)
+{
+    const U8String utf8 = data.toUtf8();
+    appendVarUInt(utf8.size());
+    append(utf8.data(), utf8.size());
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractUtf8(String& data)
+{
+    std::uint64_t size = 0;
+    if (!extractVarUInt(size))
+        return *this;
+
+    // Compare with the remaining size directly, so that a bogus size can't overflow the read position
+    const std::size_t remaining = m_data.size() - m_readPos;
+    if ((size > remaining) || !priv::isValidUtf8(m_data.data() + m_readPos, static_cast<std::size_t>(size)))
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    const auto* begin = reinterpret_cast<const std::uint8_t*>(m_data.data() + m_readPos);
+    data              = String::fromUtf8(begin, begin + size);
+    m_readPos += static_cast<std::size_t>(size);
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
@@ -571,15 +912,77 @@ bool Packet::checkSize(std::size_t size)
 ////////////////////////////////////////////////////////////
 const void* Packet::onSend(std::size_t& size)
 {
-    size = getDataSize();
-    return getData();
+    if (m_compression == Compression::None)
+    {
+        size = getDataSize();
+        return getData();
+    }
+
+    // A partial send is resumed with the data compressed by the first call
+    if (m_sendPos == 0)
+    {
+        m_sendBuffer.clear();
+        m_sendBuffer.push_back(static_cast<std::byte>(CompressionMethod::Lz4));
+        appendVarUIntTo(m_sendBuffer, m_data.size());
+
+        const std::size_t headerSize = m_sendBuffer.size();
+        m_sendBuffer.resize(headerSize + priv::lz4CompressBound(m_data.size()));
+
+        std::byte* const compressed = m_sendBuffer.data() + headerSize;
+        m_sendBuffer.resize(headerSize + priv::lz4Compress(m_data.data(), m_data.size(), compressed));
+
+        // Send the data as is if compression doesn't help
+        if (m_sendBuffer.size() > m_data.size())
+        {
+            m_sendBuffer.assign(1, static_cast<std::byte>(CompressionMethod::Stored));
+            m_sendBuffer.insert(m_sendBuffer.end(), m_data.begin(), m_data.end());
+        }
+
+        updateMemoryUsage();
+    }
+
+    size = m_sendBuffer.size();
+    return m_sendBuffer.data();
 }
 
 
 ////////////////////////////////////////////////////////////
 void Packet::onReceive(const void* data, std::size_t size)
 {
-    append(data, size);
+    if (m_compression == Compression::None)
+    {
+        append(data, size);
+        return;
+    }
+
+    const auto* bytes = static_cast<const std::byte*>(data);
+    if (size > 0)
+    {
+        const auto method = static_cast<CompressionMethod>(bytes[0]);
+        if (method == CompressionMethod::Stored)
+        {
+            append(bytes + 1, size - 1);
+            return;
+        }
+
+        // LZ4 can't expand data by more than 255 times, reject bogus sizes before allocating
+        std::size_t   position         = 1;
+        std::uint64_t decompressedSize = 0;
+        if ((method == CompressionMethod::Lz4) && priv::readVarUInt(bytes, size, position, decompressedSize) &&
+            (decompressedSize <= (size - position) * 255))
+        {
+            const std::size_t offset = m_data.size();
+            m_data.resize(offset + static_cast<std::size_t>(decompressedSize));
+            updateMemoryUsage();
+            if (priv::lz4Decompress(bytes + position, size - position, m_data.data() + offset, m_data.size() - offset))
+                return;
+
+            m_data.resize(offset);
+        }
+    }
+
+    err() << "Failed to decompress a received packet" << std::endl;
+    m_isValid = false;
 }
 
 } // namespace sf
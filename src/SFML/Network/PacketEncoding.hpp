@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Read values stored in network byte order (big endian) as values of type T
+///
+/// \param bytes  Bytes to read, at least count * sizeof(T)
+/// \param values Array to fill
+/// \param count  Number of values to read
+///
+////////////////////////////////////////////////////////////
+template <typename T, typename U>
+void readBigEndian(const std::byte* bytes, U* values, std::size_t count)
+{
+    static_assert(std::is_unsigned_v<T> && (sizeof(U) <= sizeof(T)));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        T value = 0;
+        for (std::size_t j = 0; j < sizeof(T); ++j)
+            value = static_cast<T>((value << 8) | std::to_integer<T>(*bytes++));
+
+        values[i] = static_cast<U>(value);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Read an unsigned integer with a variable-length encoding
+///
+/// The position is only updated on success.
+///
+/// \param data     Bytes to read from
+/// \param size     Number of bytes in \a data
+/// \param position Offset of the integer in \a data, moved past it on success
+/// \param value    Variable to fill
+///
+/// \return True if a complete integer was read
+///
+////////////////////////////////////////////////////////////
+inline bool readVarUInt(const std::byte* data, std::size_t size, std::size_t& position, std::uint64_t& value)
+{
+    std::uint64_t result = 0;
+    for (std::size_t i = position, shift = 0; (i < size) && (shift < 64); ++i, shift += 7)
+    {
+        const auto byte = std::to_integer<std::uint64_t>(data[i]);
+
+        // The 10th byte only holds the 64th bit, anything above would overflow
+        if ((shift == 63) && (byte > 0x01))
+            return false;
+
+        result |= (byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            value    = result;
+            position = i + 1;
+            return true;
+        }
+    }
+
+    // Either the data ends too early, or it is longer than 10 bytes
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Check that bytes are well-formed UTF-8
+///
+/// Overlong encodings, surrogates, code points above U+10FFFF
+/// and truncated sequences are rejected.
+///
+/// \param data Bytes to check
+/// \param size Number of bytes in \a data
+///
+/// \return True if \a data is well-formed UTF-8
+///
+////////////////////////////////////////////////////////////
+inline bool isValidUtf8(const std::byte* data, std::size_t size)
+{
+    std::size_t i = 0;
+    while (i < size)
+    {
+        const auto lead = std::to_integer<std::uint8_t>(data[i++]);
+        if (lead < 0x80)
+            continue;
+
+        // The range of the second byte excludes the overlong encodings, the surrogates and the values above U+10FFFF
+        std::size_t  trailing = 0;
+        std::uint8_t low      = 0x80;
+        std::uint8_t high     = 0xBF;
+        if ((lead >= 0xC2) && (lead <= 0xDF))
+        {
+            trailing = 1;
+        }
+        else if ((lead >= 0xE0) && (lead <= 0xEF))
+        {
+            trailing = 2;
+            low      = lead == 0xE0 ? 0xA0 : 0x80;
+            high     = lead == 0xED ? 0x9F : 0xBF;
+        }
+        else if ((lead >= 0xF0) && (lead <= 0xF4))
+        {
+            trailing = 3;
+            low      = lead == 0xF0 ? 0x90 : 0x80;
+            high     = lead == 0xF4 ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (size - i < trailing)
+            return false;
+
+        for (std::size_t j = 0; j < trailing; ++j, ++i)
+        {
+            const auto byte = std::to_integer<std::uint8_t>(data[i]);
+            if ((byte < low) || (byte > high))
+                return false;
+
+            low  = 0x80;
+            high = 0xBF;
+        }
+    }
+
+    return true;
+}
+
+} // namespace sf::priv
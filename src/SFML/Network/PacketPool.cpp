@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/PacketPool.hpp>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void PacketPool::Recycler::operator()(Packet* packet) const
+{
+    assert(pool && "PacketPool::Recycler::operator() Packet doesn't belong to a pool");
+    pool->release(packet);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketPool::PacketPool(std::size_t packetCapacity, std::size_t maxPacketCount) :
+m_packetCapacity(packetCapacity),
+m_maxPacketCount(maxPacketCount)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PacketPool::Handle PacketPool::acquire()
+{
+    std::unique_ptr<Packet> packet;
+
+    {
+        const std::lock_guard lock(m_mutex);
+        if (!m_freePackets.empty())
+        {
+            packet = std::move(m_freePackets.back());
+            m_freePackets.pop_back();
+        }
+    }
+
+    if (!packet)
+    {
+        packet = std::make_unique<Packet>();
+        packet->reserve(m_packetCapacity);
+    }
+
+    return Handle(packet.release(), Recycler{this});
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketPool::preallocate(std::size_t count)
+{
+    const std::lock_guard lock(m_mutex);
+
+    m_freePackets.reserve(count);
+    while (m_freePackets.size() < count)
+    {
+        auto& packet = m_freePackets.emplace_back(std::make_unique<Packet>());
+        packet->reserve(m_packetCapacity);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketPool::getFreeCount() const
+{
+    const std::lock_guard lock(m_mutex);
+    return m_freePackets.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketPool::release(Packet* packet)
+{
+    std::unique_ptr<Packet> owned(packet);
+
+    // Reset the packet, but keep its storage for the next user
+    owned->clear();
+    owned->m_sendPos = 0;
+
+    const std::lock_guard lock(m_mutex);
+    if (m_freePackets.size() < m_maxPacketCount)
+        m_freePackets.push_back(std::move(owned));
+}
+
+} // namespace sf
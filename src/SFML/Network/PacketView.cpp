@@ -0,0 +1,438 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketEncoding.hpp>
+#include <SFML/Network/PacketView.hpp>
+
+#include <SFML/System/String.hpp>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PacketView::PacketView(const void* data, std::size_t sizeInBytes) :
+m_data(static_cast<const std::byte*>(data)),
+m_size(data ? sizeInBytes : 0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView::PacketView(const Packet& packet) : PacketView(packet.getData(), packet.getDataSize())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketView::getReadPosition() const
+{
+    return m_readPos;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* PacketView::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketView::getDataSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketView::endOfPacket() const
+{
+    return m_readPos >= m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView::operator bool() const
+{
+    return m_isValid;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(bool& data)
+{
+    std::uint8_t value = 0;
+    if (*this >> value)
+        data = (value != 0);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int8_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint8_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int16_t& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint16_t& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int32_t& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint32_t& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int64_t& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint64_t& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(float& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(double& data)
+{
+    return extractArray(&data, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(char* data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    if ((length > 0) && checkSize(length))
+    {
+        // Then extract characters
+        std::memcpy(data, m_data + m_readPos, length);
+        data[length] = '\0';
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::string& data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(length))
+    {
+        // Then extract characters
+        data.assign(reinterpret_cast<const char*>(m_data + m_readPos), length);
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(wchar_t* data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    if ((length > 0) && checkSize(std::size_t{length} * sizeof(std::uint32_t)))
+    {
+        // Then extract characters
+        priv::readBigEndian<std::uint32_t>(m_data + m_readPos, data, length);
+        data[length] = L'\0';
+        m_readPos += length * sizeof(std::uint32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::wstring& data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(std::size_t{length} * sizeof(std::uint32_t)))
+    {
+        // Then extract characters
+        data.resize(length);
+        priv::readBigEndian<std::uint32_t>(m_data + m_readPos, data.data(), length);
+        m_readPos += length * sizeof(std::uint32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(String& data)
+{
+    // First extract the string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(std::size_t{length} * sizeof(std::uint32_t)))
+    {
+        // Then extract characters
+        std::u32string characters(length, U'\0');
+        priv::readBigEndian<std::uint32_t>(m_data + m_readPos, characters.data(), length);
+        data = String(std::move(characters));
+        m_readPos += length * sizeof(std::uint32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(std::int16_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::int16_t)))
+    {
+        priv::readBigEndian<std::uint16_t>(m_data + m_readPos, data, count);
+        m_readPos += count * sizeof(std::int16_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(std::uint16_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::uint16_t)))
+    {
+        priv::readBigEndian<std::uint16_t>(m_data + m_readPos, data, count);
+        m_readPos += count * sizeof(std::uint16_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(std::int32_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::int32_t)))
+    {
+        priv::readBigEndian<std::uint32_t>(m_data + m_readPos, data, count);
+        m_readPos += count * sizeof(std::int32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(std::uint32_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::uint32_t)))
+    {
+        priv::readBigEndian<std::uint32_t>(m_data + m_readPos, data, count);
+        m_readPos += count * sizeof(std::uint32_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(std::int64_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::int64_t)))
+    {
+        priv::readBigEndian<std::uint64_t>(m_data + m_readPos, data, count);
+        m_readPos += count * sizeof(std::int64_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(std::uint64_t* data, std::size_t count)
+{
+    if (checkSize(count * sizeof(std::uint64_t)))
+    {
+        priv::readBigEndian<std::uint64_t>(m_data + m_readPos, data, count);
+        m_readPos += count * sizeof(std::uint64_t);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(float* data, std::size_t count)
+{
+    if ((count > 0) && checkSize(count * sizeof(float)))
+    {
+        std::memcpy(data, m_data + m_readPos, count * sizeof(float));
+        m_readPos += count * sizeof(float);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractArray(double* data, std::size_t count)
+{
+    if ((count > 0) && checkSize(count * sizeof(double)))
+    {
+        std::memcpy(data, m_data + m_readPos, count * sizeof(double));
+        m_readPos += count * sizeof(double);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractVarUInt(std::uint64_t& data)
+{
+    m_isValid = m_isValid && priv::readVarUInt(m_data, m_size, m_readPos, data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractVarInt(std::int64_t& data)
+{
+    std::uint64_t value = 0;
+    if (extractVarUInt(value))
+        data = static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractUtf8(String& data)
+{
+    std::uint64_t size = 0;
+    if (!extractVarUInt(size))
+        return *this;
+
+    // Compare with the remaining size directly, so that a bogus size can't overflow the read position
+    const std::size_t remaining = m_size - m_readPos;
+    if ((size > remaining) || !priv::isValidUtf8(m_data + m_readPos, static_cast<std::size_t>(size)))
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    const auto* begin = reinterpret_cast<const std::uint8_t*>(m_data + m_readPos);
+    data              = String::fromUtf8(begin, begin + size);
+    m_readPos += static_cast<std::size_t>(size);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketView::checkSize(std::size_t size)
+{
+    // Compare with the remaining size, so that a bogus size can't overflow the read position
+    m_isValid = m_isValid && (size <= m_size - m_readPos);
+
+    return m_isValid;
+}
+
+} // namespace sf
@@ -0,0 +1,624 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/ReliableUdpChannel.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ReliableUdpChannelImpl
+{
+// Byte identifying the datagrams of the protocol
+constexpr std::uint8_t protocolId = 0xC5;
+
+// Datagram header: protocol id, flags, sequence, ack, ack bits
+constexpr std::size_t headerSize = 1 + 1 + 2 + 2 + 4;
+
+// Flag telling that the ack fields of the header are meaningful
+constexpr std::uint8_t hasAckFlag = 0x01;
+
+// Fragment header: lane, message id, fragment index, fragment count, size
+constexpr std::size_t fragmentHeaderSize = 1 + 2 + 2 + 2 + 2;
+
+// Smallest datagram size accepted by setMaxDatagramSize
+constexpr std::size_t minDatagramSize = 64;
+
+// Number of datagrams acknowledged after a missing one before it is considered lost
+constexpr std::uint16_t lossThreshold = 3;
+
+// Bounds of the retransmission timeout
+constexpr sf::Time initialTimeout = sf::milliseconds(200);
+constexpr sf::Time minTimeout     = sf::milliseconds(50);
+constexpr sf::Time maxTimeout     = sf::seconds(2);
+
+// Time after which an incomplete unreliable message is abandoned
+constexpr sf::Time partialMessageTimeout = sf::seconds(1);
+
+// Number of datagrams allowed in flight before any acknowledgment
+constexpr std::size_t initialWindow = 10;
+
+
+////////////////////////////////////////////////////////////
+// Tell whether a 16-bit sequence number is more recent than another one, with wrapping
+bool isMoreRecent(std::uint16_t left, std::uint16_t right)
+{
+    return (left != right) && (static_cast<std::uint16_t>(left - right) < 0x8000);
+}
+
+
+////////////////////////////////////////////////////////////
+void writeUint16(std::vector<char>& buffer, std::uint16_t value)
+{
+    buffer.push_back(static_cast<char>(value >> 8));
+    buffer.push_back(static_cast<char>(value & 0xFF));
+}
+
+
+////////////////////////////////////////////////////////////
+void writeUint32(std::vector<char>& buffer, std::uint32_t value)
+{
+    writeUint16(buffer, static_cast<std::uint16_t>(value >> 16));
+    writeUint16(buffer, static_cast<std::uint16_t>(value & 0xFFFF));
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint16_t readUint16(const unsigned char* data)
+{
+    return static_cast<std::uint16_t>((data[0] << 8) | data[1]);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t readUint32(const unsigned char* data)
+{
+    return (std::uint32_t{readUint16(data)} << 16) | readUint16(data + 2);
+}
+
+
+////////////////////////////////////////////////////////////
+// Key of a message being reassembled
+std::uint32_t getMessageKey(sf::ReliableUdpChannel::Lane lane, std::uint16_t messageId)
+{
+    return (static_cast<std::uint32_t>(lane) << 16) | messageId;
+}
+} // namespace ReliableUdpChannelImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ReliableUdpChannel::ReliableUdpChannel(UdpSocket& socket, const IpAddress& remoteAddress, unsigned short remotePort) :
+m_socket(&socket),
+m_remoteAddress(remoteAddress),
+m_remotePort(remotePort),
+m_maxDatagramSize(DefaultMaxDatagramSize),
+m_slowStartThreshold(std::numeric_limits<std::size_t>::max())
+{
+    using namespace ReliableUdpChannelImpl;
+
+    m_statistics.retransmissionTimeout = initialTimeout;
+    m_statistics.congestionWindow      = initialWindow * m_maxDatagramSize;
+}
+
+
+////////////////////////////////////////////////////////////
+const IpAddress& ReliableUdpChannel::getRemoteAddress() const
+{
+    return m_remoteAddress;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short ReliableUdpChannel::getRemotePort() const
+{
+    return m_remotePort;
+}
+
+
+////////////////////////////////////////////////////////////
+void ReliableUdpChannel::setMaxDatagramSize(std::size_t size)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    m_maxDatagramSize = std::clamp(size, minDatagramSize, UdpSocket::MaxDatagramSize);
+
+    // Keep room for at least two datagrams in flight
+    m_statistics.congestionWindow = std::max(m_statistics.congestionWindow, 2 * m_maxDatagramSize);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ReliableUdpChannel::getMaxDatagramSize() const
+{
+    return m_maxDatagramSize;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ReliableUdpChannel::send(Lane lane, const void* data, std::size_t size)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    // Split the message into fragments that fit in a datagram
+    const std::size_t maxFragmentSize = m_maxDatagramSize - headerSize - fragmentHeaderSize;
+    const std::size_t count           = std::max<std::size_t>((size + maxFragmentSize - 1) / maxFragmentSize, 1);
+    if (count > std::numeric_limits<std::uint16_t>::max())
+    {
+        err() << "Failed to send message on reliable UDP channel (message is too large: " << size << " bytes)"
+              << std::endl;
+        return false;
+    }
+
+    std::uint16_t& messageId = m_nextMessageIds[static_cast<std::size_t>(lane)];
+    const auto*    bytes     = static_cast<const char*>(data);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Fragment& fragment = m_sendQueue.emplace_back();
+        fragment.lane      = lane;
+        fragment.messageId = messageId;
+        fragment.index     = static_cast<std::uint16_t>(i);
+        fragment.count     = static_cast<std::uint16_t>(count);
+
+        const std::size_t offset = i * maxFragmentSize;
+        fragment.data.assign(bytes + offset, bytes + std::min(offset + maxFragmentSize, size));
+    }
+
+    ++messageId;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ReliableUdpChannel::send(Lane lane, Packet& packet)
+{
+    // Use the same data as UdpSocket would, so that derived packets can transform it
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    return send(lane, data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status ReliableUdpChannel::flush()
+{
+    using namespace ReliableUdpChannelImpl;
+
+    const Time now = m_clock.getElapsedTime();
+    detectLosses(now);
+
+    // Abandon the unreliable messages that will never be complete
+    for (auto it = m_incoming.begin(); it != m_incoming.end();)
+    {
+        const bool reliable = (it->first >> 16) == static_cast<std::uint32_t>(Lane::ReliableOrdered);
+        if (!reliable && (now - it->second.firstArrival > partialMessageTimeout))
+            it = m_incoming.erase(it);
+        else
+            ++it;
+    }
+
+    // Pack the fragments into datagrams, lost reliable fragments first, as long as the congestion window allows it
+    std::size_t datagramCount = 0;
+    while ((!m_resendQueue.empty() || !m_sendQueue.empty()) &&
+           (m_statistics.bytesInFlight + m_maxDatagramSize <= m_statistics.congestionWindow))
+    {
+        if (m_outgoing.size() <= datagramCount)
+            m_outgoing.emplace_back();
+
+        std::vector<char>& datagram = m_outgoing[datagramCount++];
+        SentDatagram       sent;
+        sent.sequence = writeHeader(datagram);
+        sent.sendTime = now;
+
+        for (std::deque<Fragment>* queue : {&m_resendQueue, &m_sendQueue})
+        {
+            // A fragment queued before the maximum size was reduced may be too large, send it alone anyway
+            while (!queue->empty() &&
+                   ((datagram.size() + fragmentHeaderSize + queue->front().data.size() <= m_maxDatagramSize) ||
+                    (datagram.size() == headerSize)))
+            {
+                Fragment& fragment = queue->front();
+                datagram.push_back(static_cast<char>(fragment.lane));
+                writeUint16(datagram, fragment.messageId);
+                writeUint16(datagram, fragment.index);
+                writeUint16(datagram, fragment.count);
+                writeUint16(datagram, static_cast<std::uint16_t>(fragment.data.size()));
+                datagram.insert(datagram.end(), fragment.data.begin(), fragment.data.end());
+
+                if (fragment.lane == Lane::ReliableOrdered)
+                    sent.reliableFragments.push_back(std::move(fragment));
+                queue->pop_front();
+            }
+        }
+
+        sent.size = datagram.size();
+        m_statistics.bytesInFlight += sent.size;
+        m_inFlight.push_back(std::move(sent));
+    }
+
+    // Unreliable messages that didn't fit in the window are outdated by the next flush
+    const auto end = std::remove_if(m_sendQueue.begin(),
+                                    m_sendQueue.end(),
+                                    [](const Fragment& fragment) { return fragment.lane != Lane::ReliableOrdered; });
+    for (auto it = end; it != m_sendQueue.end(); ++it)
+    {
+        if (it->index == 0)
+            ++m_statistics.messagesDropped;
+    }
+    m_sendQueue.erase(end, m_sendQueue.end());
+
+    // Acknowledge the received data even when there is nothing else to send
+    if ((datagramCount == 0) && m_ackPending)
+    {
+        if (m_outgoing.empty())
+            m_outgoing.emplace_back();
+
+        writeHeader(m_outgoing[datagramCount++]);
+    }
+
+    if (datagramCount == 0)
+        return Socket::Status::Done;
+
+    // Send everything in a single batch
+    std::vector<UdpSocket::Datagram> datagrams(datagramCount);
+    for (std::size_t i = 0; i < datagramCount; ++i)
+        datagrams[i] = {m_outgoing[i].data(), m_outgoing[i].size(), 0, m_remoteAddress, m_remotePort};
+
+    std::size_t          sent   = 0;
+    const Socket::Status status = m_socket->sendBatch(datagrams.data(), datagrams.size(), sent);
+
+    // Datagrams that couldn't be sent are handled like lost ones
+    m_statistics.datagramsSent += sent;
+    m_ackPending = false;
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ReliableUdpChannel::processDatagram(const void* data, std::size_t size)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    if ((size < headerSize) || (bytes[0] != protocolId))
+        return false;
+
+    // Parse all the fragments first, so that a malformed datagram is ignored entirely
+    std::vector<Fragment> fragments;
+    for (std::size_t offset = headerSize; offset < size;)
+    {
+        if (size - offset < fragmentHeaderSize)
+            return false;
+
+        const unsigned char* header = bytes + offset;
+        Fragment             fragment;
+        fragment.lane                  = static_cast<Lane>(header[0]);
+        fragment.messageId             = readUint16(header + 1);
+        fragment.index                 = readUint16(header + 3);
+        fragment.count                 = readUint16(header + 5);
+        const std::size_t fragmentSize = readUint16(header + 7);
+        offset += fragmentHeaderSize;
+
+        if ((header[0] > static_cast<unsigned char>(Lane::ReliableOrdered)) || (fragment.index >= fragment.count) ||
+            (size - offset < fragmentSize))
+            return false;
+
+        fragment.data.assign(bytes + offset, bytes + offset + fragmentSize);
+        fragments.push_back(std::move(fragment));
+        offset += fragmentSize;
+    }
+
+    const Time          now      = m_clock.getElapsedTime();
+    const std::uint16_t sequence = readUint16(bytes + 2);
+    ++m_statistics.datagramsReceived;
+    if (bytes[1] & hasAckFlag)
+        processAcks(readUint16(bytes + 4), readUint32(bytes + 6), now);
+
+    // Record the datagram so that the peer gets it acknowledged, and ignore duplicates
+    bool duplicate = false;
+    if (!m_hasReceived || isMoreRecent(sequence, m_remoteSequence))
+    {
+        const auto shift = static_cast<std::uint16_t>(sequence - m_remoteSequence);
+        if (!m_hasReceived || (shift > 32))
+            m_receivedBits = 0;
+        else if (shift == 32)
+            m_receivedBits = 1u << 31;
+        else
+            m_receivedBits = (m_receivedBits << shift) | (1u << (shift - 1));
+
+        m_remoteSequence = sequence;
+        m_hasReceived    = true;
+    }
+    else
+    {
+        const auto distance = static_cast<std::uint16_t>(m_remoteSequence - sequence);
+        if (distance == 0)
+        {
+            duplicate = true;
+        }
+        else if (distance <= 32)
+        {
+            const std::uint32_t bit = 1u << (distance - 1);
+            duplicate               = (m_receivedBits & bit) != 0;
+            m_receivedBits |= bit;
+        }
+    }
+
+    if (duplicate || fragments.empty())
+        return true;
+
+    for (Fragment& fragment : fragments)
+        processFragment(std::move(fragment), now);
+
+    m_ackPending = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ReliableUdpChannel::receive(Packet& packet)
+{
+    packet.clear();
+    if (m_delivered.empty())
+        return false;
+
+    const std::vector<char>& message = m_delivered.front();
+    if (!message.empty())
+        packet.onReceive(message.data(), message.size());
+
+    m_delivered.pop_front();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+ReliableUdpChannel::Statistics ReliableUdpChannel::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void ReliableUdpChannel::processAcks(std::uint16_t ack, std::uint32_t ackBits, Time now)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    std::optional<std::uint16_t> largestAcked;
+    for (auto it = m_inFlight.begin(); it != m_inFlight.end();)
+    {
+        const auto distance = static_cast<std::uint16_t>(ack - it->sequence);
+        const bool acked    = (distance == 0) || ((distance <= 32) && ((ackBits >> (distance - 1)) & 1u));
+        if (!acked)
+        {
+            ++it;
+            continue;
+        }
+
+        // Update the round-trip time estimate (RFC 6298)
+        const Time sample = now - it->sendTime;
+        if (!m_hasRoundTripTime)
+        {
+            m_statistics.roundTripTime         = sample;
+            m_statistics.roundTripTimeVariance = sample / std::int64_t{2};
+            m_hasRoundTripTime                 = true;
+        }
+        else
+        {
+            const Time error = (sample > m_statistics.roundTripTime) ? sample - m_statistics.roundTripTime
+                                                                     : m_statistics.roundTripTime - sample;
+            m_statistics.roundTripTimeVariance = (m_statistics.roundTripTimeVariance * std::int64_t{3} + error) /
+                                                 std::int64_t{4};
+            m_statistics.roundTripTime = (m_statistics.roundTripTime * std::int64_t{7} + sample) / std::int64_t{8};
+        }
+        m_statistics.retransmissionTimeout = std::clamp(m_statistics.roundTripTime +
+                                                            m_statistics.roundTripTimeVariance * std::int64_t{4},
+                                                        minTimeout,
+                                                        maxTimeout);
+
+        // Grow the congestion window: exponentially during the slow start, then linearly
+        if (m_statistics.congestionWindow < m_slowStartThreshold)
+            m_statistics.congestionWindow += it->size;
+        else
+            m_statistics.congestionWindow += std::max<std::size_t>(m_maxDatagramSize * it->size /
+                                                                       m_statistics.congestionWindow,
+                                                                   1);
+
+        if (!largestAcked || isMoreRecent(it->sequence, *largestAcked))
+            largestAcked = it->sequence;
+
+        m_statistics.bytesInFlight -= it->size;
+        it = m_inFlight.erase(it);
+    }
+
+    // Datagrams sent long enough before an acknowledged one are lost
+    if (largestAcked)
+    {
+        for (auto it = m_inFlight.begin(); it != m_inFlight.end();)
+        {
+            if (static_cast<std::uint16_t>(*largestAcked - it->sequence) < lossThreshold ||
+                !isMoreRecent(*largestAcked, it->sequence))
+            {
+                ++it;
+                continue;
+            }
+
+            // Send the reliable fragments again, and slow down once per round trip
+            ++m_statistics.datagramsLost;
+            m_statistics.bytesInFlight -= it->size;
+            for (Fragment& fragment : it->reliableFragments)
+                m_resendQueue.push_back(std::move(fragment));
+
+            if (!m_inRecovery || isMoreRecent(it->sequence, m_recoverySequence))
+            {
+                m_slowStartThreshold          = std::max(m_statistics.congestionWindow / 2, 2 * m_maxDatagramSize);
+                m_statistics.congestionWindow = m_slowStartThreshold;
+                m_recoverySequence            = static_cast<std::uint16_t>(m_localSequence - 1);
+                m_inRecovery                  = true;
+            }
+
+            it = m_inFlight.erase(it);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ReliableUdpChannel::detectLosses(Time now)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    bool timedOut = false;
+    for (auto it = m_inFlight.begin(); it != m_inFlight.end();)
+    {
+        if (now - it->sendTime < m_statistics.retransmissionTimeout)
+        {
+            ++it;
+            continue;
+        }
+
+        ++m_statistics.datagramsLost;
+        m_statistics.bytesInFlight -= it->size;
+        for (Fragment& fragment : it->reliableFragments)
+            m_resendQueue.push_back(std::move(fragment));
+
+        it       = m_inFlight.erase(it);
+        timedOut = true;
+    }
+
+    // Back off, as the network may be congested or the peer gone
+    if (timedOut)
+    {
+        m_statistics.retransmissionTimeout = std::min(m_statistics.retransmissionTimeout * std::int64_t{2},
+                                                      maxTimeout);
+        m_slowStartThreshold          = std::max(m_statistics.congestionWindow / 2, 2 * m_maxDatagramSize);
+        m_statistics.congestionWindow = m_slowStartThreshold;
+        m_recoverySequence            = static_cast<std::uint16_t>(m_localSequence - 1);
+        m_inRecovery                  = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ReliableUdpChannel::processFragment(Fragment&& fragment, Time now)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    // Drop the fragments of messages that can't be delivered anymore
+    if ((fragment.lane == Lane::ReliableOrdered) &&
+        (static_cast<std::uint16_t>(fragment.messageId - m_nextReliableId) >= 0x8000))
+        return;
+
+    if ((fragment.lane == Lane::UnreliableSequenced) && m_hasSequenced &&
+        !isMoreRecent(fragment.messageId, m_lastSequencedId))
+        return;
+
+    // Store the fragment with the other ones of its message
+    const std::uint32_t key     = getMessageKey(fragment.lane, fragment.messageId);
+    IncomingMessage&    message = m_incoming[key];
+    if (message.fragments.empty())
+    {
+        message.fragments.resize(fragment.count);
+        message.received.resize(fragment.count);
+        message.remaining    = fragment.count;
+        message.firstArrival = now;
+    }
+
+    if ((message.fragments.size() != fragment.count) || message.received[fragment.index])
+        return;
+
+    message.fragments[fragment.index] = std::move(fragment.data);
+    message.received[fragment.index]  = true;
+    if (--message.remaining > 0)
+        return;
+
+    // Deliver the completed messages
+    const auto deliver = [this](IncomingMessage& complete)
+    {
+        std::vector<char>& data = m_delivered.emplace_back(std::move(complete.fragments[0]));
+        for (std::size_t i = 1; i < complete.fragments.size(); ++i)
+            data.insert(data.end(), complete.fragments[i].begin(), complete.fragments[i].end());
+    };
+
+    switch (fragment.lane)
+    {
+        case Lane::Unreliable:
+            deliver(message);
+            m_incoming.erase(key);
+            break;
+
+        case Lane::UnreliableSequenced:
+            deliver(message);
+            m_incoming.erase(key);
+            m_lastSequencedId = fragment.messageId;
+            m_hasSequenced    = true;
+            break;
+
+        case Lane::ReliableOrdered:
+            // Deliver all the messages that were waiting for this one
+            for (auto it = m_incoming.find(getMessageKey(Lane::ReliableOrdered, m_nextReliableId));
+                 (it != m_incoming.end()) && (it->second.remaining == 0) && !it->second.fragments.empty();
+                 it = m_incoming.find(getMessageKey(Lane::ReliableOrdered, m_nextReliableId)))
+            {
+                deliver(it->second);
+                m_incoming.erase(it);
+                ++m_nextReliableId;
+            }
+            break;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint16_t ReliableUdpChannel::writeHeader(std::vector<char>& datagram)
+{
+    using namespace ReliableUdpChannelImpl;
+
+    const std::uint16_t sequence = m_localSequence++;
+
+    datagram.clear();
+    datagram.push_back(static_cast<char>(protocolId));
+    datagram.push_back(static_cast<char>(m_hasReceived ? hasAckFlag : 0));
+    writeUint16(datagram, sequence);
+    writeUint16(datagram, m_remoteSequence);
+    writeUint32(datagram, m_receivedBits);
+    return sequence;
+}
+
+} // namespace sf
@@ -25,15 +25,73 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/NetworkStatsImpl.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <memory>
 #include <ostream>
 #include <utility>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+const char* getOptionLabel(sf::Socket::Option option)
+{
+    switch (option)
+    {
+        case sf::Socket::Option::SendBufferSize:
+            return "SendBufferSize";
+        case sf::Socket::Option::ReceiveBufferSize:
+            return "ReceiveBufferSize";
+        case sf::Socket::Option::NoDelay:
+            return "NoDelay";
+        case sf::Socket::Option::QuickAck:
+            return "QuickAck";
+        case sf::Socket::Option::NotSentLowWatermark:
+            return "NotSentLowWatermark";
+        case sf::Socket::Option::BusyPoll:
+            return "BusyPoll";
+        case sf::Socket::Option::TypeOfService:
+            return "TypeOfService";
+        case sf::Socket::Option::Timestamp:
+            return "Timestamp";
+        case sf::Socket::Option::MulticastTtl:
+            return "MulticastTtl";
+        case sf::Socket::Option::MulticastLoopback:
+            return "MulticastLoopback";
+    }
+
+    return "unknown";
+}
+
+
+////////////////////////////////////////////////////////////
+bool applyOption(sf::SocketHandle handle, sf::IpAddress::Type addressType, sf::Socket::Option option, int value)
+{
+    const auto name = sf::priv::SocketImpl::getOptionName(option, addressType);
+    if (!name)
+    {
+        sf::err() << "Socket option \"" << getOptionLabel(option) << "\" is not supported on this platform"
+                  << std::endl;
+        return false;
+    }
+
+    if (setsockopt(handle, name->level, name->name, reinterpret_cast<char*>(&value), sizeof(value)) == -1)
+    {
+        sf::err() << "Failed to set socket option \"" << getOptionLabel(option) << "\" to " << value << std::endl;
+        return false;
+    }
+
+    return true;
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -54,7 +112,11 @@ Socket::~Socket()
 Socket::Socket(Socket&& socket) noexcept :
 m_type(socket.m_type),
 m_socket(std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket())),
-m_isBlocking(socket.m_isBlocking)
+m_isBlocking(socket.m_isBlocking),
+m_addressType(socket.m_addressType),
+m_options(std::move(socket.m_options)),
+m_stats(std::move(socket.m_stats)),
+m_partialSendCallback(std::move(socket.m_partialSendCallback))
 {
 }
 
@@ -67,9 +129,14 @@ Socket& Socket::operator=(Socket&& socket) noexcept
 
     close();
 
-    m_type       = socket.m_type;
-    m_socket     = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
-    m_isBlocking = socket.m_isBlocking;
+    m_type        = socket.m_type;
+    m_socket      = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
+    m_isBlocking  = socket.m_isBlocking;
+    m_addressType = socket.m_addressType;
+    m_options     = std::move(socket.m_options);
+    m_stats       = std::move(socket.m_stats);
+
+    m_partialSendCallback = std::move(socket.m_partialSendCallback);
     return *this;
 }
 
@@ -92,6 +159,82 @@ bool Socket::isBlocking() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Socket::setOption(Option option, int value)
+{
+    // Remember the option, so that it is applied again whenever the socket is created
+    const auto it = std::find_if(m_options.begin(), m_options.end(), [option](const auto& entry) {
+        return entry.first == option;
+    });
+    if (it != m_options.end())
+        it->second = value;
+    else
+        m_options.emplace_back(option, value);
+
+    // Apply it right now if the socket is already created
+    if (m_socket != priv::SocketImpl::invalidSocket())
+        return applyOption(m_socket, m_addressType, option, value);
+
+    if (!priv::SocketImpl::getOptionName(option, m_addressType))
+    {
+        err() << "Socket option \"" << getOptionLabel(option) << "\" is not supported on this platform" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<int> Socket::getOption(Option option) const
+{
+    // Read the option from the system socket if it exists
+    if (m_socket != priv::SocketImpl::invalidSocket())
+    {
+        const auto name = priv::SocketImpl::getOptionName(option, m_addressType);
+        if (!name)
+            return std::nullopt;
+
+        int                          value = 0;
+        priv::SocketImpl::AddrLength size  = sizeof(value);
+        if (getsockopt(m_socket, name->level, name->name, reinterpret_cast<char*>(&value), &size) == -1)
+            return std::nullopt;
+
+        return value;
+    }
+
+    // Otherwise return the value that will be applied when it gets created
+    const auto it = std::find_if(m_options.begin(), m_options.end(), [option](const auto& entry) {
+        return entry.first == option;
+    });
+    if (it == m_options.end())
+        return std::nullopt;
+
+    return it->second;
+}
+
+
+////////////////////////////////////////////////////////////
+NetworkStats Socket::getStats() const
+{
+    return m_stats ? *m_stats : NetworkStats();
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::resetStats()
+{
+    m_stats.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setPartialSendCallback(PartialSendCallback callback)
+{
+    m_partialSendCallback = std::move(callback);
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle Socket::getNativeHandle() const
 {
@@ -100,12 +243,20 @@ SocketHandle Socket::getNativeHandle() const
 
 
 ////////////////////////////////////////////////////////////
-void Socket::create()
+IpAddress::Type Socket::getAddressType() const
+{
+    return m_addressType;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::create(IpAddress::Type addressType)
 {
     // Don't create the socket if it already exists
     if (m_socket == priv::SocketImpl::invalidSocket())
     {
-        const SocketHandle handle = socket(PF_INET, m_type == Type::Tcp ? SOCK_STREAM : SOCK_DGRAM, 0);
+        const int          family = (addressType == IpAddress::Type::V6) ? PF_INET6 : PF_INET;
+        const SocketHandle handle = socket(family, m_type == Type::Tcp ? SOCK_STREAM : SOCK_DGRAM, 0);
 
         if (handle == priv::SocketImpl::invalidSocket())
         {
@@ -113,6 +264,18 @@ void Socket::create()
             return;
         }
 
+        if (addressType == IpAddress::Type::V6)
+        {
+            // Make the socket dual-stack, so that it also talks to IPv4 peers
+            int no = 0;
+            if (setsockopt(handle, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char*>(&no), sizeof(no)) == -1)
+            {
+                err() << "Failed to set socket option \"IPV6_V6ONLY\" ; "
+                      << "the socket will only reach IPv6 addresses" << std::endl;
+            }
+        }
+
+        m_addressType = addressType;
         create(handle);
     }
 }
@@ -127,6 +290,12 @@ void Socket::create(SocketHandle handle)
         // Assign the new handle
         m_socket = handle;
 
+        // Find out which addresses the socket handles (accepted sockets inherit them from their listener)
+        sockaddr_storage             address{};
+        priv::SocketImpl::AddrLength size = sizeof(address);
+        if (getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &size) != -1)
+            m_addressType = (address.ss_family == AF_INET6) ? IpAddress::Type::V6 : IpAddress::Type::V4;
+
         // Set the current blocking state
         setBlocking(m_isBlocking);
 
@@ -157,6 +326,10 @@ void Socket::create(SocketHandle handle)
                 err() << "Failed to enable broadcast on UDP socket" << std::endl;
             }
         }
+
+        // Apply the options set by the user
+        for (const auto& [option, value] : m_options)
+            applyOption(m_socket, m_addressType, option, value);
     }
 }
 
@@ -172,4 +345,68 @@ void Socket::close()
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Socket::recordSend(std::size_t bytes, std::size_t packets, std::size_t systemCalls)
+{
+    if (!NetworkStats::isEnabled())
+        return;
+
+    if (!m_stats)
+        m_stats = std::make_unique<NetworkStats>();
+
+    m_stats->bytesSent += bytes;
+    m_stats->packetsSent += packets;
+    m_stats->systemCalls += systemCalls;
+    priv::addGlobalSend(bytes, packets, systemCalls);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::recordReceive(std::size_t bytes, std::size_t packets, std::size_t systemCalls)
+{
+    if (!NetworkStats::isEnabled())
+        return;
+
+    if (!m_stats)
+        m_stats = std::make_unique<NetworkStats>();
+
+    m_stats->bytesReceived += bytes;
+    m_stats->packetsReceived += packets;
+    m_stats->systemCalls += systemCalls;
+    priv::addGlobalReceive(bytes, packets, systemCalls);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::recordPartialSend(std::size_t sent, std::size_t size)
+{
+    if (NetworkStats::isEnabled())
+    {
+        if (!m_stats)
+            m_stats = std::make_unique<NetworkStats>();
+
+        ++m_stats->partialSends;
+        priv::addGlobalPartialSend();
+    }
+
+    if (m_partialSendCallback)
+        m_partialSendCallback(sent, size);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::recordReceiveLatency(Time latency)
+{
+    if (!NetworkStats::isEnabled())
+        return;
+
+    if (!m_stats)
+        m_stats = std::make_unique<NetworkStats>();
+
+    const std::size_t bucket = NetworkStats::getLatencyBucket(latency);
+    ++m_stats->receiveLatency[bucket];
+    priv::addGlobalReceiveLatency(bucket);
+}
+
 } // namespace sf
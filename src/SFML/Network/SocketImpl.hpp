@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketHandle.hpp>
 
@@ -51,6 +52,8 @@
 
 #endif
 
+#include <optional>
+
 #include <cstdint>
 
 
@@ -75,6 +78,16 @@ public:
     using Size       = std::size_t;
 #endif
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Level and name identifying a system socket option
+    ///
+    ////////////////////////////////////////////////////////////
+    struct OptionName
+    {
+        int level{}; //!< Protocol level of the option (SOL_SOCKET, IPPROTO_TCP, ...)
+        int name{};  //!< Name of the option at this level
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
     ///
@@ -86,6 +99,47 @@ public:
     ////////////////////////////////////////////////////////////
     static sockaddr_in createAddress(std::uint32_t address, unsigned short port);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an internal address usable by a socket of the given type
+    ///
+    /// IPv4 addresses are converted to their IPv4-mapped form
+    /// when used with a dual-stack (IPv6) socket.
+    ///
+    /// \param address    Target address
+    /// \param port       Target port
+    /// \param socketType Type of the addresses handled by the socket
+    /// \param result     Address ready to be used by socket functions
+    ///
+    /// \return Size of \a result, or 0 if the socket can't reach \a address
+    ///
+    ////////////////////////////////////////////////////////////
+    static AddrLength createAddress(const IpAddress&  address,
+                                    unsigned short    port,
+                                    IpAddress::Type   socketType,
+                                    sockaddr_storage& result);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract the IP address of an internal address
+    ///
+    /// IPv4-mapped addresses are converted back to IPv4.
+    ///
+    /// \param address Address filled by a socket function
+    ///
+    /// \return IP address stored in \a address
+    ///
+    ////////////////////////////////////////////////////////////
+    static IpAddress getAddress(const sockaddr_storage& address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract the port of an internal address
+    ///
+    /// \param address Address filled by a socket function
+    ///
+    /// \return Port stored in \a address
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned short getPort(const sockaddr_storage& address);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the value of the invalid socket
     ///
@@ -111,6 +165,17 @@ public:
     ////////////////////////////////////////////////////////////
     static void setBlocking(SocketHandle sock, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the system option matching a socket option
+    ///
+    /// \param option      Socket option
+    /// \param addressType Type of the addresses handled by the socket
+    ///
+    /// \return Level and name of the system option, or `std::nullopt` if the platform doesn't provide it
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::optional<OptionName> getOptionName(Socket::Option option, IpAddress::Type addressType);
+
     ////////////////////////////////////////////////////////////
     /// Get the last socket error status
     ///
@@ -22,18 +22,53 @@
 //
 ////////////////////////////////////////////////////////////
 
+
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+// Winsock's select() isn't limited by the value of the handles, only by the capacity of fd_set,
+// which can be raised as long as it is defined before winsock2.h is included
+#define FD_SETSIZE 16384
+#endif
+
+#include <SFML/Network/NetworkStats.hpp>
+#include <SFML/Network/NetworkStatsImpl.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 
+#if defined(SFML_SYSTEM_LINUX)
+#include <SFML/Network/Unix/IoUringPoller.hpp>
+#endif
+
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_SOCKET_SELECTOR_EPOLL
+#include <sys/epoll.h>
+#elif !defined(SFML_SYSTEM_WINDOWS)
+#define SFML_SOCKET_SELECTOR_KQUEUE
+#include <sys/event.h>
+#include <sys/time.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
+
+#include <cerrno>
+#include <cstdint>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
@@ -45,144 +80,467 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
-    fd_set allSockets{};   //!< Set containing all the sockets handles
-    fd_set socketsReady{}; //!< Set containing handles of the sockets that are ready
-    int    maxSocket{};    //!< Maximum socket handle
-    int    socketCount{};  //!< Number of socket handles
+    ////////////////////////////////////////////////////////////
+    /// \brief Readiness that a socket is watched for
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Interest
+    {
+        bool receive{}; //!< Watch the socket for data to receive
+        bool send{};    //!< Watch the socket for room to send data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Socket of the selector
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Socket*  socket{}; //!< Socket, as it was added
+        Interest interest; //!< Readiness that the socket is watched for
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the system object watching the sockets
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketSelectorImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Watch the same sockets as another selector
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketSelectorImpl(const SocketSelectorImpl& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketSelectorImpl& operator=(const SocketSelectorImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the system object watching the sockets
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SocketSelectorImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the readiness that a socket is watched for
+    ///
+    /// \param handle   Handle of the socket
+    /// \param previous Readiness that the socket is currently watched for, nothing if it is not watched yet
+    /// \param interest Readiness to watch the socket for, nothing to stop watching it
+    ///
+    /// \return True if the socket is watched as requested
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool watch(SocketHandle handle, Interest previous, Interest interest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for sockets to become ready, and fill the ready handles
+    ///
+    /// \param timeout Maximum time to wait, `std::nullopt` to wait indefinitely
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForEvents(std::optional<Time> timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the readiness that a socket is watched for
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInterest(Socket& socket, Interest interest);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unordered_map<SocketHandle, Entry> sockets;          //!< Sockets in the selector
+    std::unordered_set<SocketHandle>        readyHandles;     //!< Handles of the sockets that are ready to receive
+    std::unordered_set<SocketHandle>        sendReadyHandles; //!< Handles of the sockets that are ready to send
+    std::vector<Socket*>                    readySockets;     //!< Sockets that are ready
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+    int                      epoll{-1}; //!< epoll instance watching the sockets
+    std::vector<epoll_event> events;    //!< Events of the sockets that are ready
+#if defined(SFML_SYSTEM_LINUX)
+    std::unique_ptr<priv::IoUringPoller>    ring;       //!< io_uring poller used instead of epoll, if enabled
+    std::vector<priv::IoUringPoller::Event> ringEvents; //!< Events of the sockets that are ready, from the ring
+#endif
+#elif defined(SFML_SOCKET_SELECTOR_KQUEUE)
+    int                        queue{-1}; //!< Kernel queue watching the sockets
+    std::vector<struct kevent> events;    //!< Events of the sockets that are ready
+#else
+    fd_set allSockets{};       //!< Set containing the handles of the sockets watched for receiving
+    fd_set socketsReady{};     //!< Set containing handles of the sockets that are ready to receive
+    fd_set sendSockets{};      //!< Set containing the handles of the sockets watched for sending
+    fd_set sendSocketsReady{}; //!< Set containing handles of the sockets that are ready to send
+#endif
 };
 
 
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+
 ////////////////////////////////////////////////////////////
-SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl() : epoll(epoll_create1(EPOLL_CLOEXEC))
 {
-    clear();
+    if (epoll < 0)
+        err() << "Failed to create the epoll instance of the socket selector" << std::endl;
 }
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector::~SocketSelector() = default;
+SocketSelector::SocketSelectorImpl::~SocketSelectorImpl()
+{
+    if (epoll >= 0)
+        ::close(epoll);
+}
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector::SocketSelector(const SocketSelector& copy) : m_impl(std::make_unique<SocketSelectorImpl>(*copy.m_impl))
+bool SocketSelector::SocketSelectorImpl::watch(SocketHandle handle, Interest previous, Interest interest)
 {
+#if defined(SFML_SYSTEM_LINUX)
+    // The change is submitted with the next wait, along with the others
+    if (ring)
+    {
+        ring->watch(handle, interest.receive, interest.send);
+        return true;
+    }
+#endif
+
+    // Closed handles are already removed from epoll, there is nothing to report
+    if (!interest.receive && !interest.send)
+    {
+        epoll_ctl(epoll, EPOLL_CTL_DEL, handle, nullptr);
+        return true;
+    }
+
+    epoll_event event{};
+    event.events  = (interest.receive ? EPOLLIN : 0u) | (interest.send ? EPOLLOUT : 0u);
+    event.data.fd = handle;
+
+    // A handle that was closed and reused without being removed may be known
+    // to the selector but no longer watched by epoll, and the other way around
+    const bool watched   = previous.receive || previous.send;
+    const int  operation = watched ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (epoll_ctl(epoll, operation, handle, &event) == 0)
+        return true;
+
+    const int fallback = watched ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    return ((errno == ENOENT) || (errno == EEXIST)) && (epoll_ctl(epoll, fallback, handle, &event) == 0);
 }
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector& SocketSelector::operator=(const SocketSelector& right)
+void SocketSelector::SocketSelectorImpl::waitForEvents(std::optional<Time> timeout)
 {
-    SocketSelector temp(right);
-    std::swap(m_impl, temp.m_impl);
-    return *this;
+#if defined(SFML_SYSTEM_LINUX)
+    if (ring)
+    {
+        ringEvents.clear();
+        ring->wait(timeout, ringEvents);
+        for (const priv::IoUringPoller::Event& event : ringEvents)
+        {
+            if (event.receive)
+                readyHandles.insert(event.handle);
+            if (event.send)
+                sendReadyHandles.insert(event.handle);
+        }
+        return;
+    }
+#endif
+
+    // epoll has a resolution of a millisecond, round up so that short timeouts don't turn into a busy loop
+    int milliseconds = -1;
+    if (timeout)
+    {
+        const auto microseconds = std::max(timeout->asMicroseconds(), std::int64_t{0});
+        milliseconds            = static_cast<int>(
+            std::min<std::int64_t>((microseconds + 999) / 1000, std::numeric_limits<int>::max()));
+    }
+
+    events.resize(std::max<std::size_t>(sockets.size(), 1));
+    const int count = epoll_wait(epoll, events.data(), static_cast<int>(events.size()), milliseconds);
+
+    // Errors and hang-ups are reported as readiness, so that the next operation reports them
+    for (int i = 0; i < count; ++i)
+    {
+        const epoll_event& event = events[static_cast<std::size_t>(i)];
+        if (event.events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            readyHandles.insert(event.data.fd);
+        if (event.events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+            sendReadyHandles.insert(event.data.fd);
+    }
 }
 
+#elif defined(SFML_SOCKET_SELECTOR_KQUEUE)
 
 ////////////////////////////////////////////////////////////
-SocketSelector::SocketSelector(SocketSelector&&) noexcept = default;
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl() : queue(kqueue())
+{
+    if (queue < 0)
+        err() << "Failed to create the kernel queue of the socket selector" << std::endl;
+}
 
 
-////////////////////////////////////////////////////////////]
-SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::~SocketSelectorImpl()
+{
+    if (queue >= 0)
+        ::close(queue);
+}
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::add(Socket& socket)
+bool SocketSelector::SocketSelectorImpl::watch(SocketHandle handle, Interest previous, Interest interest)
 {
-    const SocketHandle handle = socket.getNativeHandle();
-    if (handle != priv::SocketImpl::invalidSocket())
+    // Adding a filter that already exists only modifies it, and only filters that exist are deleted
+    std::array<struct kevent, 2> changes{};
+    int                          changeCount = 0;
+    const auto                   change      = [&](bool was, bool is, std::int16_t filter)
     {
+        if (is || was)
+            EV_SET(&changes[static_cast<std::size_t>(changeCount++)],
+                   static_cast<uintptr_t>(handle),
+                   filter,
+                   is ? EV_ADD : EV_DELETE,
+                   0,
+                   0,
+                   nullptr);
+    };
+    change(previous.receive, interest.receive, EVFILT_READ);
+    change(previous.send, interest.send, EVFILT_WRITE);
+
+    // Closed handles are already removed from the queue, so failing to delete them is not an error
+    const bool applied = kevent(queue, changes.data(), changeCount, nullptr, 0, nullptr) == 0;
+    return applied || (!interest.receive && !interest.send);
+}
 
-#if defined(SFML_SYSTEM_WINDOWS)
 
-        if (m_impl->socketCount >= FD_SETSIZE)
-        {
-            err() << "The socket can't be added to the selector because the "
-                  << "selector is full. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
-            return;
-        }
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::waitForEvents(std::optional<Time> timeout)
+{
+    const auto microseconds = std::max(timeout.value_or(Time::Zero).asMicroseconds(), std::int64_t{0});
+    timespec   time{};
+    time.tv_sec  = static_cast<time_t>(microseconds / 1000000);
+    time.tv_nsec = static_cast<long>(microseconds % 1000000 * 1000);
+
+    events.resize(std::max<std::size_t>(sockets.size() * 2, 1));
+    const int count = kevent(queue,
+                             nullptr,
+                             0,
+                             events.data(),
+                             static_cast<int>(events.size()),
+                             timeout ? &time : nullptr);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const struct kevent& event  = events[static_cast<std::size_t>(i)];
+        const auto           handle = static_cast<SocketHandle>(event.ident);
+        if (event.filter == EVFILT_READ)
+            readyHandles.insert(handle);
+        else if (event.filter == EVFILT_WRITE)
+            sendReadyHandles.insert(handle);
+    }
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl()
+{
+    FD_ZERO(&allSockets);
+    FD_ZERO(&socketsReady);
+    FD_ZERO(&sendSockets);
+    FD_ZERO(&sendSocketsReady);
+}
 
-        if (FD_ISSET(handle, &m_impl->allSockets))
-            return;
 
-        ++m_impl->socketCount;
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::~SocketSelectorImpl() = default;
 
-#else
 
-        if (handle >= FD_SETSIZE)
+////////////////////////////////////////////////////////////
+bool SocketSelector::SocketSelectorImpl::watch(SocketHandle handle, Interest previous, Interest interest)
+{
+    const auto update = [handle](fd_set& set, bool was, bool is)
+    {
+        if (was && !is)
+        {
+            FD_CLR(handle, &set);
+        }
+        else if (is && !was)
         {
-            err() << "The socket can't be added to the selector because its "
-                  << "ID is too high. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
-            return;
+            if (set.fd_count >= FD_SETSIZE)
+            {
+                err() << "The socket can't be added to the selector because the "
+                      << "selector is full (" << FD_SETSIZE << " sockets)" << std::endl;
+                return false;
+            }
+
+            FD_SET(handle, &set);
         }
 
-        // SocketHandle is an int in POSIX
-        if (m_impl->maxSocket < handle)
-            m_impl->maxSocket = handle;
+        return true;
+    };
+
+    return update(allSockets, previous.receive, interest.receive) && update(sendSockets, previous.send, interest.send);
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::waitForEvents(std::optional<Time> timeout)
+{
+    // Setup the timeout
+    const Time waitTime = timeout.value_or(Time::Zero);
+    timeval    time{};
+    time.tv_sec  = static_cast<long>(waitTime.asMicroseconds() / 1000000);
+    time.tv_usec = static_cast<int>(waitTime.asMicroseconds() % 1000000);
+
+    // Initialize the sets that will contain the sockets that are ready, only
+    // copying the handles in use since the sets are large
+    const auto copySet = [](const fd_set& source, fd_set& destination)
+    {
+        destination.fd_count = source.fd_count;
+        std::copy_n(source.fd_array, source.fd_count, destination.fd_array);
+    };
+    copySet(allSockets, socketsReady);
+    copySet(sendSockets, sendSocketsReady);
+
+    // Wait until one of the sockets is ready, or timeout is reached
+    // The first parameter is ignored on Windows
+    const int count = select(0,
+                             &socketsReady,
+                             sendSockets.fd_count > 0 ? &sendSocketsReady : nullptr,
+                             nullptr,
+                             timeout ? &time : nullptr);
+
+    // On Windows, select() packs the ready handles at the beginning of the sets
+    if (count > 0)
+    {
+        readyHandles.insert(socketsReady.fd_array, socketsReady.fd_array + socketsReady.fd_count);
+        if (sendSockets.fd_count > 0)
+            sendReadyHandles.insert(sendSocketsReady.fd_array, sendSocketsReady.fd_array + sendSocketsReady.fd_count);
+    }
+}
 
 #endif
 
-        FD_SET(handle, &m_impl->allSockets);
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl(const SocketSelectorImpl& copy) : SocketSelectorImpl()
+{
+    for (const auto& [handle, entry] : copy.sockets)
+    {
+        if (watch(handle, {}, entry.interest))
+            sockets.emplace(handle, entry);
     }
+
+    readyHandles     = copy.readyHandles;
+    sendReadyHandles = copy.sendReadyHandles;
+    readySockets     = copy.readySockets;
 }
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::remove(Socket& socket)
+void SocketSelector::SocketSelectorImpl::setInterest(Socket& socket, Interest interest)
 {
     const SocketHandle handle = socket.getNativeHandle();
-    if (handle != priv::SocketImpl::invalidSocket())
+    if (handle == priv::SocketImpl::invalidSocket())
+        return;
+
+    const auto it = sockets.find(handle);
+    if (it == sockets.end())
     {
+        // Adding a socket with no interest has no effect
+        if ((interest.receive || interest.send) && watch(handle, {}, interest))
+            sockets.emplace(handle, Entry{&socket, interest});
+        return;
+    }
 
-#if defined(SFML_SYSTEM_WINDOWS)
+    if (!watch(handle, it->second.interest, interest))
+        return;
+
+    // Stopping to watch a socket removes it, along with its readiness
+    if (!interest.receive && !interest.send)
+    {
+        const auto removed = std::remove(readySockets.begin(), readySockets.end(), it->second.socket);
+        readySockets.erase(removed, readySockets.end());
+        readyHandles.erase(handle);
+        sendReadyHandles.erase(handle);
+        sockets.erase(it);
+        return;
+    }
 
-        if (!FD_ISSET(handle, &m_impl->allSockets))
-            return;
+    // Adding a socket again updates its address, in case it was moved
+    it->second = {&socket, interest};
+}
 
-        --m_impl->socketCount;
 
-#else
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
+{
+}
 
-        if (handle >= FD_SETSIZE)
-            return;
 
-#endif
+////////////////////////////////////////////////////////////
+SocketSelector::~SocketSelector() = default;
 
-        FD_CLR(handle, &m_impl->allSockets);
-        FD_CLR(handle, &m_impl->socketsReady);
-    }
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector(const SocketSelector& copy) : m_impl(std::make_unique<SocketSelectorImpl>(*copy.m_impl))
+{
 }
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::clear()
+SocketSelector& SocketSelector::operator=(const SocketSelector& right)
 {
-    FD_ZERO(&m_impl->allSockets);
-    FD_ZERO(&m_impl->socketsReady);
+    SocketSelector temp(right);
+    std::swap(m_impl, temp.m_impl);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector(SocketSelector&&) noexcept = default;
 
-    m_impl->maxSocket   = 0;
-    m_impl->socketCount = 0;
+
+////////////////////////////////////////////////////////////]
+SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::add(Socket& socket)
+{
+    const auto it   = m_impl->sockets.find(socket.getNativeHandle());
+    const bool send = (it != m_impl->sockets.end()) && it->second.interest.send;
+    m_impl->setInterest(socket, {true, send});
 }
 
 
 ////////////////////////////////////////////////////////////
-bool SocketSelector::wait(Time timeout)
+void SocketSelector::remove(Socket& socket)
 {
-    // Setup the timeout
-    timeval time{};
-    time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
-    time.tv_usec = static_cast<int>(timeout.asMicroseconds() % 1000000);
+    m_impl->setInterest(socket, {});
+}
 
-    // Initialize the set that will contain the sockets that are ready
-    m_impl->socketsReady = m_impl->allSockets;
 
-    // Wait until one of the sockets is ready for reading, or timeout is reached
-    // The first parameter is ignored on Windows
-    const int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, nullptr, nullptr, timeout != Time::Zero ? &time : nullptr);
+////////////////////////////////////////////////////////////
+void SocketSelector::clear()
+{
+    for (const auto& [handle, entry] : m_impl->sockets)
+        (void)m_impl->watch(handle, entry.interest, {});
+
+    m_impl->sockets.clear();
+    m_impl->readyHandles.clear();
+    m_impl->sendReadyHandles.clear();
+    m_impl->readySockets.clear();
+}
+
 
-    return count > 0;
+////////////////////////////////////////////////////////////
+bool SocketSelector::wait(Time timeout)
+{
+    return waitFor(timeout != Time::Zero ? std::optional(timeout) : std::nullopt);
 }
 
 
@@ -191,17 +549,81 @@ bool SocketSelector::isReady(Socket& socket) const
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
-    {
+        return m_impl->readyHandles.count(handle) != 0;
 
-#if !defined(SFML_SYSTEM_WINDOWS)
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Socket*>& SocketSelector::getReadySockets() const
+{
+    return m_impl->readySockets;
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::watch(Socket& socket, bool receive, bool send)
+{
+    m_impl->setInterest(socket, {receive, send});
+}
 
-        if (handle >= FD_SETSIZE)
-            return false;
 
+////////////////////////////////////////////////////////////
+void SocketSelector::enableIoUring()
+{
+#if defined(SFML_SYSTEM_LINUX)
+    if (m_impl->sockets.empty() && !m_impl->ring)
+        m_impl->ring = priv::IoUringPoller::create();
 #endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::waitFor(std::optional<Time> timeout)
+{
+    m_impl->readyHandles.clear();
+    m_impl->sendReadyHandles.clear();
+    m_impl->readySockets.clear();
 
-        return FD_ISSET(handle, &m_impl->socketsReady) != 0;
+    // Wait until one of the sockets is ready, or timeout is reached
+    if (NetworkStats::isEnabled())
+    {
+        const Clock clock;
+        m_impl->waitForEvents(timeout);
+        priv::addGlobalSelectorWait(clock.getElapsedTime());
     }
+    else
+    {
+        m_impl->waitForEvents(timeout);
+    }
+
+    // Gather the sockets that are ready, so that they can be visited without testing all the others
+    const auto addReadySocket = [this](SocketHandle handle)
+    {
+        if (const auto it = m_impl->sockets.find(handle); it != m_impl->sockets.end())
+            m_impl->readySockets.push_back(it->second.socket);
+    };
+
+    m_impl->readySockets.reserve(m_impl->readyHandles.size() + m_impl->sendReadyHandles.size());
+    for (const SocketHandle handle : m_impl->readyHandles)
+        addReadySocket(handle);
+    for (const SocketHandle handle : m_impl->sendReadyHandles)
+    {
+        if (m_impl->readyHandles.count(handle) == 0)
+            addReadySocket(handle);
+    }
+
+    return !m_impl->readySockets.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::isReadyToSend(Socket& socket) const
+{
+    const SocketHandle handle = socket.getNativeHandle();
+    if (handle != priv::SocketImpl::invalidSocket())
+        return m_impl->sendReadyHandles.count(handle) != 0;
 
     return false;
 }
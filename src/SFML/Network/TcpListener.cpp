@@ -33,6 +33,48 @@
 
 #include <ostream>
 
+#if !defined(SFML_SYSTEM_WINDOWS)
+#include <fcntl.h>
+#include <poll.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Accept a pending connection, without letting the new socket be inherited by child processes
+sf::SocketHandle acceptConnection(sf::SocketHandle listener)
+{
+#if defined(SFML_SYSTEM_LINUX)
+    return accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+#else
+    const sf::SocketHandle handle = ::accept(listener, nullptr, nullptr);
+#if !defined(SFML_SYSTEM_WINDOWS)
+    if (handle != sf::priv::SocketImpl::invalidSocket())
+        fcntl(handle, F_SETFD, FD_CLOEXEC);
+#endif
+    return handle;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+// Check, without waiting, whether a connection is ready to be accepted
+bool hasPendingConnection(sf::SocketHandle listener)
+{
+#if defined(SFML_SYSTEM_WINDOWS)
+    fd_set selector;
+    FD_ZERO(&selector);
+    FD_SET(listener, &selector);
+    timeval noWait{};
+    return select(0, &selector, nullptr, nullptr, &noWait) > 0;
+#else
+    pollfd descriptor{listener, POLLIN, 0};
+    return poll(&descriptor, 1, 0) > 0;
+#endif
+}
+} // namespace
+
 
 namespace sf
 {
@@ -48,11 +90,11 @@ unsigned short TcpListener::getLocalPort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the local end of the socket
-        sockaddr_in                  address{};
+        sockaddr_storage             address{};
         priv::SocketImpl::AddrLength size = sizeof(address);
         if (getsockname(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(address);
         }
     }
 
@@ -68,15 +110,32 @@ Socket::Status TcpListener::listen(unsigned short port, const IpAddress& address
     close();
 
     // Create the internal socket if it doesn't exist
-    create();
+    create(address.getType());
 
     // Check if the address is valid
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
+    // Let the other listeners with the same option share the port
+    if (m_reusePort)
+    {
+#if defined(SO_REUSEPORT)
+        int yes = 1;
+        if (setsockopt(getNativeHandle(), SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&yes), sizeof(yes)) == -1)
+        {
+            err() << "Failed to set socket option \"SO_REUSEPORT\" on listener socket" << std::endl;
+            return Status::Error;
+        }
+#else
+        err() << "Sharing a port between listeners is not supported on this platform" << std::endl;
+        return Status::Error;
+#endif
+    }
+
     // Bind the socket to the specified port
-    sockaddr_in addr = priv::SocketImpl::createAddress(address.toInteger(), port);
-    if (bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1)
+    sockaddr_storage                   addr{};
+    const priv::SocketImpl::AddrLength size = priv::SocketImpl::createAddress(address, port, getAddressType(), addr);
+    if (bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), size) == -1)
     {
         // Not likely to happen, but...
         err() << "Failed to bind listener socket to port " << port << std::endl;
@@ -95,6 +154,20 @@ Socket::Status TcpListener::listen(unsigned short port, const IpAddress& address
 }
 
 
+////////////////////////////////////////////////////////////
+void TcpListener::setReusePort(bool reusePort)
+{
+    m_reusePort = reusePort;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpListener::getReusePort() const
+{
+    return m_reusePort;
+}
+
+
 ////////////////////////////////////////////////////////////
 void TcpListener::close()
 {
@@ -114,9 +187,7 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     }
 
     // Accept a new connection
-    sockaddr_in                  address{};
-    priv::SocketImpl::AddrLength length = sizeof(address);
-    const SocketHandle           remote = ::accept(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &length);
+    const SocketHandle remote = acceptConnection(getNativeHandle());
 
     // Check for errors
     if (remote == priv::SocketImpl::invalidSocket())
@@ -129,4 +200,43 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     return Status::Done;
 }
 
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpListener::acceptBatch(TcpSocket* sockets, std::size_t count, std::size_t& accepted)
+{
+    // First clear the variables to fill
+    accepted = 0;
+
+    // Make sure that we're listening
+    if (getNativeHandle() == priv::SocketImpl::invalidSocket())
+    {
+        err() << "Failed to accept new connections, the socket is not listening" << std::endl;
+        return Status::Error;
+    }
+
+    while (accepted < count)
+    {
+        // After the first connection, a blocking listener only goes on while more connections are pending
+        if ((accepted > 0) && isBlocking() && !hasPendingConnection(getNativeHandle()))
+            break;
+
+        const SocketHandle remote = acceptConnection(getNativeHandle());
+
+        // Check for errors, reporting the connections accepted so far if there are some
+        if (remote == priv::SocketImpl::invalidSocket())
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+            return (accepted > 0) ? Status::Done : status;
+        }
+
+        // Initialize the new connected socket
+        sockets[accepted].close();
+        sockets[accepted].create(remote);
+        ++accepted;
+    }
+
+    return Status::Done;
+}
+
 } // namespace sf
@@ -26,17 +26,18 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/NetworkStats.hpp>
 #include <SFML/Network/Packet.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/TcpSocket.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
 
 #include <algorithm>
-#include <array>
 #include <ostream>
-
-#include <cstring>
+#include <typeinfo>
+#include <utility>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
@@ -67,11 +68,11 @@ unsigned short TcpSocket::getLocalPort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the local end of the socket
-        sockaddr_in                  address{};
+        sockaddr_storage             address{};
         priv::SocketImpl::AddrLength size = sizeof(address);
         if (getsockname(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(address);
         }
     }
 
@@ -86,11 +87,11 @@ std::optional<IpAddress> TcpSocket::getRemoteAddress() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the remote end of the socket
-        sockaddr_in                  address{};
+        sockaddr_storage             address{};
         priv::SocketImpl::AddrLength size = sizeof(address);
         if (getpeername(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
         {
-            return IpAddress(ntohl(address.sin_addr.s_addr));
+            return priv::SocketImpl::getAddress(address);
         }
     }
 
@@ -105,11 +106,11 @@ unsigned short TcpSocket::getRemotePort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the remote end of the socket
-        sockaddr_in                  address{};
+        sockaddr_storage             address{};
         priv::SocketImpl::AddrLength size = sizeof(address);
         if (getpeername(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(address);
         }
     }
 
@@ -125,17 +126,21 @@ Socket::Status TcpSocket::connect(const IpAddress& remoteAddress, unsigned short
     disconnect();
 
     // Create the internal socket if it doesn't exist
-    create();
+    create(remoteAddress.getType());
 
     // Create the remote address
-    sockaddr_in address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
+    sockaddr_storage                   address{};
+    const priv::SocketImpl::AddrLength size = priv::SocketImpl::createAddress(remoteAddress,
+                                                                              remotePort,
+                                                                              getAddressType(),
+                                                                              address);
 
     if (timeout <= Time::Zero)
     {
         // ----- We're not using a timeout: just try to connect -----
 
         // Connect the socket
-        if (::connect(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1)
+        if (::connect(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), size) == -1)
             return priv::SocketImpl::getErrorStatus();
 
         // Connection succeeded
@@ -153,7 +158,7 @@ Socket::Status TcpSocket::connect(const IpAddress& remoteAddress, unsigned short
             setBlocking(false);
 
         // Try to connect to the remote address
-        if (::connect(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), sizeof(address)) >= 0)
+        if (::connect(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), size) >= 0)
         {
             // We got instantly connected! (it may no happen a lot...)
             setBlocking(blocking);
@@ -219,6 +224,11 @@ void TcpSocket::disconnect()
 
     // Reset the pending packet data
     m_pendingPacket = PendingPacket();
+
+    // Drop the queued packets, they can't be sent anymore
+    m_sendQueue.clear();
+    m_queuedPackets = 0;
+    updateMemoryUsage();
 }
 
 
@@ -237,6 +247,8 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size)
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t& sent)
 {
+    SFML_PROFILE_ZONE("sf::TcpSocket::send");
+
     // Check the parameters
     if (!data || (size == 0))
     {
@@ -245,7 +257,8 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
     }
 
     // Loop until every byte has been sent
-    int result = 0;
+    int         result      = 0;
+    std::size_t systemCalls = 0;
     for (sent = 0; sent < size; sent += static_cast<std::size_t>(result))
     {
 #pragma GCC diagnostic push
@@ -256,19 +269,26 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
                                          static_cast<priv::SocketImpl::Size>(size - sent),
                                          flags));
 #pragma GCC diagnostic pop
+        ++systemCalls;
 
         // Check for errors
         if (result < 0)
         {
             const Status status = priv::SocketImpl::getErrorStatus();
+            recordSend(sent, 0, systemCalls);
 
             if ((status == Status::NotReady) && sent)
+            {
+                recordPartialSend(sent, size);
                 return Status::Partial;
+            }
 
             return status;
         }
     }
 
+    recordSend(size, 0, systemCalls);
+
     return Status::Done;
 }
 
@@ -276,6 +296,8 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& received)
 {
+    SFML_PROFILE_ZONE("sf::TcpSocket::receive");
+
     // First clear the variables to fill
     received = 0;
 
@@ -297,15 +319,19 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
     if (sizeReceived > 0)
     {
         received = static_cast<std::size_t>(sizeReceived);
+        recordReceive(received, 0, 1);
         return Status::Done;
     }
     else if (sizeReceived == 0)
     {
+        recordReceive(0, 0, 1);
         return Socket::Status::Disconnected;
     }
     else
     {
-        return priv::SocketImpl::getErrorStatus();
+        const Status status = priv::SocketImpl::getErrorStatus();
+        recordReceive(0, 0, 1);
+        return status;
     }
 }
 
@@ -313,121 +339,255 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(Packet& packet)
 {
+    SFML_PROFILE_ZONE("sf::TcpSocket::send");
+
     // TCP is a stream protocol, it doesn't preserve messages boundaries.
     // This means that we have to send the packet size first, so that the
     // receiver knows the actual end of the packet in the data stream.
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
+    // The size and the data are sent together with a single gathering call,
+    // so that they don't have to be copied into a common block first, and so
+    // that a partial send can be resumed from the exact byte where it stopped.
 
     // Get the data to send from the packet
     std::size_t size = 0;
     const void* data = packet.onSend(size);
 
     // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    const std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    const std::size_t   totalSize  = sizeof(packetSize) + size;
+    const std::size_t   startPos   = packet.m_sendPos;
+    std::size_t         systemCalls{};
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
+    // Send the remaining part of the size and the data, until everything is sent
+    while (packet.m_sendPos < totalSize)
+    {
+        const std::byte* first     = nullptr;
+        std::size_t      firstSize = 0;
+        std::size_t      dataSent  = 0;
+        if (packet.m_sendPos < sizeof(packetSize))
+        {
+            first     = reinterpret_cast<const std::byte*>(&packetSize) + packet.m_sendPos;
+            firstSize = sizeof(packetSize) - packet.m_sendPos;
+        }
+        else
+        {
+            dataSent = packet.m_sendPos - sizeof(packetSize);
+        }
 
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+        const std::byte*  second     = static_cast<const std::byte*>(data) + dataSent;
+        const std::size_t secondSize = size - dataSent;
+        long              result     = 0;
+
+#if defined(SFML_SYSTEM_WINDOWS)
+        WSABUF buffers[2];
+        DWORD  bufferCount = 0;
+        if (firstSize > 0)
+            buffers[bufferCount++] = {static_cast<ULONG>(firstSize),
+                                      reinterpret_cast<char*>(const_cast<std::byte*>(first))};
+        if (secondSize > 0)
+            buffers[bufferCount++] = {static_cast<ULONG>(secondSize),
+                                      reinterpret_cast<char*>(const_cast<std::byte*>(second))};
+
+        DWORD sentBytes = 0;
+        if (WSASend(getNativeHandle(), buffers, bufferCount, &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            result = -1;
+        else
+            result = static_cast<long>(sentBytes);
+#else
+        iovec       buffers[2];
+        std::size_t bufferCount = 0;
+        if (firstSize > 0)
+            buffers[bufferCount++] = {const_cast<std::byte*>(first), firstSize};
+        if (secondSize > 0)
+            buffers[bufferCount++] = {const_cast<std::byte*>(second), secondSize};
+
+        msghdr message{};
+        message.msg_iov    = buffers;
+        message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(bufferCount);
+        result             = static_cast<long>(sendmsg(getNativeHandle(), &message, flags));
+#endif
+        ++systemCalls;
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
-    std::size_t  sent   = 0;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+        // Check for errors, and record the location to resume from in case of a partial send
+        if (result < 0)
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+            recordSend(packet.m_sendPos - startPos, 0, systemCalls);
 
-    // In the case of a partial send, record the location to resume from
-    if (status == Status::Partial)
-    {
-        packet.m_sendPos += sent;
-    }
-    else if (status == Status::Done)
-    {
-        packet.m_sendPos = 0;
+            // A retry that couldn't send anything reports the socket status, like a plain send
+            if ((status == Status::NotReady) && (packet.m_sendPos > startPos))
+            {
+                recordPartialSend(packet.m_sendPos, totalSize);
+                return Status::Partial;
+            }
+
+            return status;
+        }
+
+        packet.m_sendPos += static_cast<std::size_t>(result);
     }
 
-    return status;
+    recordSend(totalSize - startPos, 1, systemCalls);
+    packet.m_sendPos = 0;
+
+    return Status::Done;
 }
 
 
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::receive(Packet& packet)
 {
+    SFML_PROFILE_ZONE("sf::TcpSocket::receive");
+
     // First clear the variables to fill
     packet.clear();
 
     // We start by getting the size of the incoming packet
-    std::uint32_t packetSize = 0;
-    std::size_t   received   = 0;
-    if (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
+    std::size_t received = 0;
+
+    // Loop until we've received the entire size of the packet
+    // (even a 4 byte variable may be received in more than one call)
+    while (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
     {
-        // Loop until we've received the entire size of the packet
-        // (even a 4 byte variable may be received in more than one call)
-        while (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
-        {
-            char*        data   = reinterpret_cast<char*>(&m_pendingPacket.size) + m_pendingPacket.sizeReceived;
-            const Status status = receive(data, sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived, received);
-            m_pendingPacket.sizeReceived += received;
+        char*        data   = reinterpret_cast<char*>(&m_pendingPacket.size) + m_pendingPacket.sizeReceived;
+        const Status status = receive(data, sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived, received);
 
-            if (status != Status::Done)
-                return status;
-        }
+        // Start measuring the latency of the packet when its first byte arrives
+        if ((m_pendingPacket.sizeReceived == 0) && (received > 0) && NetworkStats::isEnabled())
+            m_pendingPacket.clock.restart();
 
-        // The packet size has been fully received
-        packetSize = ntohl(m_pendingPacket.size);
-    }
-    else
-    {
-        // The packet size has already been received in a previous call
-        packetSize = ntohl(m_pendingPacket.size);
-    }
+        m_pendingPacket.sizeReceived += received;
 
-    // Loop until we receive all the packet data
-    std::array<char, 1024> buffer{};
-    while (m_pendingPacket.data.size() < packetSize)
-    {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.data.size(), sizeof(buffer));
-        const Status      status    = receive(buffer.data(), sizeToGet, received);
         if (status != Status::Done)
             return status;
+    }
 
-        // Append it into the packet
-        if (received > 0)
+    const std::size_t packetSize = ntohl(m_pendingPacket.size);
+
+    // Loop until we receive all the packet data, directly into the pending buffer.
+    // The buffer grows geometrically rather than to the announced size at once,
+    // so that a bogus size can't make us allocate gigabytes before any data arrives
+    while (m_pendingPacket.dataReceived < packetSize)
+    {
+        PendingPacket::Buffer& data = m_pendingPacket.data;
+        if (m_pendingPacket.dataReceived == data.size())
         {
-            m_pendingPacket.data.resize(m_pendingPacket.data.size() + received);
-            std::byte* begin = m_pendingPacket.data.data() + m_pendingPacket.data.size() - received;
-            std::memcpy(begin, buffer.data(), received);
+            data.resize(std::min(packetSize, std::max(data.size() * 2, std::size_t{64 * 1024})));
+            updateMemoryUsage();
         }
+
+        const Status status = receive(data.data() + m_pendingPacket.dataReceived,
+                                      data.size() - m_pendingPacket.dataReceived,
+                                      received);
+        if (status != Status::Done)
+            return status;
+
+        m_pendingPacket.dataReceived += received;
     }
 
-    // We have received all the packet data: we can copy it to the user packet
-    if (!m_pendingPacket.data.empty())
-        packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
+    // We have received all the packet data: we can give it to the user packet.
+    // A plain packet just takes the buffer, others may need to transform it
+    m_pendingPacket.data.resize(packetSize);
+    if ((typeid(packet) == typeid(Packet)) && (packet.m_compression == Packet::Compression::None))
+    {
+        std::swap(packet.m_data, m_pendingPacket.data);
+        packet.updateMemoryUsage();
+    }
+    else if (packetSize > 0)
+    {
+        packet.onReceive(m_pendingPacket.data.data(), packetSize);
+    }
 
-    // Clear the pending packet data
-    m_pendingPacket = PendingPacket();
+    updateMemoryUsage();
+    recordReceive(0, 1, 0);
+    recordReceiveLatency(m_pendingPacket.clock.getElapsedTime());
+
+    // Clear the pending packet data, keeping the buffer to receive the next packet
+    m_pendingPacket.size         = 0;
+    m_pendingPacket.sizeReceived = 0;
+    m_pendingPacket.dataReceived = 0;
+    m_pendingPacket.data.clear();
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::queue(Packet& packet)
+{
+    SFML_PROFILE_ZONE("sf::TcpSocket::queue");
+
+    // Append the packet with the same format as send(Packet&): its size, then its data
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    const std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    const auto*         sizeBytes  = reinterpret_cast<const std::byte*>(&packetSize);
+    m_sendQueue.insert(m_sendQueue.end(), sizeBytes, sizeBytes + sizeof(packetSize));
+
+    if (size > 0)
+    {
+        const auto* bytes = static_cast<const std::byte*>(data);
+        m_sendQueue.insert(m_sendQueue.end(), bytes, bytes + size);
+    }
+
+    ++m_queuedPackets;
+    updateMemoryUsage();
+
+    if ((m_sendQueueFlushSize > 0) && (m_sendQueue.size() >= m_sendQueueFlushSize))
+        return flush();
 
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::flush()
+{
+    SFML_PROFILE_ZONE("sf::TcpSocket::flush");
+
+    if (m_sendQueue.empty())
+        return Status::Done;
+
+    // The whole queue is contiguous, so it usually goes out with a single system call
+    std::size_t  sent   = 0;
+    const Status status = send(m_sendQueue.data(), m_sendQueue.size(), sent);
+
+    if (status == Status::Done)
+    {
+        recordSend(0, m_queuedPackets, 0);
+        m_sendQueue.clear();
+        m_queuedPackets = 0;
+    }
+    else
+    {
+        // Keep what wasn't sent at the front of the queue, so that the next flush resumes from there
+        m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + static_cast<std::ptrdiff_t>(sent));
+    }
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::setSendQueueFlushSize(std::size_t size)
+{
+    m_sendQueueFlushSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocket::getQueuedSize() const
+{
+    return m_sendQueue.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::updateMemoryUsage()
+{
+    m_memoryCounter.setBytes(m_pendingPacket.data.capacity() + m_sendQueue.capacity());
+}
+
 } // namespace sf
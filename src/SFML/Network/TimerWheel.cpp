@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/TimerWheel.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TimerWheel::TimerWheel(Time resolution) : m_resolution(std::max(resolution, microseconds(1))), m_nodes(firstTimer)
+{
+    // Each list is circular, with an empty list pointing to itself
+    for (std::uint32_t i = 0; i < firstTimer; ++i)
+        m_nodes[i].previous = m_nodes[i].next = i;
+}
+
+
+////////////////////////////////////////////////////////////
+TimerWheel::Id TimerWheel::schedule(Time delay, Handler handler)
+{
+    std::uint32_t index = m_freeNodes;
+    if (index != 0)
+    {
+        m_freeNodes = m_nodes[index].next;
+    }
+    else
+    {
+        index = static_cast<std::uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    // Round the expiration time up, so that the timer never expires early
+    const std::int64_t resolution = m_resolution.asMicroseconds();
+    const std::int64_t expiry     = (m_clock.getElapsedTime() + std::max(delay, Time::Zero)).asMicroseconds();
+
+    Node& node   = m_nodes[index];
+    node.expiry  = static_cast<std::uint64_t>((expiry + resolution - 1) / resolution);
+    node.handler = std::move(handler);
+    node.active  = true;
+
+    insert(index);
+    ++m_timerCount;
+
+    return (Id{node.generation} << 32) | index;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TimerWheel::cancel(Id id)
+{
+    const auto index      = static_cast<std::uint32_t>(id & 0xFFFFFFFF);
+    const auto generation = static_cast<std::uint32_t>(id >> 32);
+    if ((index < firstTimer) || (index >= m_nodes.size()))
+        return false;
+
+    const Node& node = m_nodes[index];
+    if (!node.active || (node.generation != generation))
+        return false;
+
+    unlink(index);
+    release(index);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TimerWheel::expire()
+{
+    const std::uint64_t currentTick = getCurrentTick();
+    std::size_t         count       = 0;
+
+    while (m_nextTick <= currentTick)
+    {
+        const std::uint64_t tick = m_nextTick;
+
+        if (m_timerCount == 0)
+        {
+            m_nextTick = currentTick + 1;
+            break;
+        }
+
+        // Jump over the empty slots of the first level, up to the next slot where timers can move down
+        if ((m_firstLevelCount == 0) && ((tick & (slotCount - 1)) != 0))
+        {
+            m_nextTick = std::min(currentTick + 1, (tick | (slotCount - 1)) + 1);
+            continue;
+        }
+
+        // When a level has gone round a slot of the level above, the timers of the next slot
+        // of the level above are due within that round: move them down to the levels below
+        for (std::size_t level = levelCount - 1; level > 0; --level)
+        {
+            const std::size_t shift = levelBits * level;
+            if ((tick & ((std::uint64_t{1} << shift) - 1)) != 0)
+                continue;
+
+            const auto list = static_cast<std::uint32_t>(level * slotCount + ((tick >> shift) & (slotCount - 1)));
+            while (!isEmpty(list))
+            {
+                const std::uint32_t index = m_nodes[list].next;
+                unlink(index);
+                insert(index);
+            }
+        }
+
+        m_nextTick = tick + 1;
+
+        // Move the expired timers to their own list first, so that handlers scheduling new timers don't see them
+        const auto slot = static_cast<std::uint32_t>(tick & (slotCount - 1));
+        while (!isEmpty(slot))
+        {
+            const std::uint32_t index = m_nodes[slot].next;
+            unlink(index);
+            link(dueList, index);
+        }
+
+        // The handlers may cancel the other expired timers, or make the nodes move in memory
+        while (!isEmpty(dueList))
+        {
+            const std::uint32_t index = m_nodes[dueList].next;
+            unlink(index);
+
+            const Handler handler = std::move(m_nodes[index].handler);
+            release(index);
+
+            handler();
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Time> TimerWheel::getTimeUntilNextExpiry() const
+{
+    if (m_timerCount == 0)
+        return std::nullopt;
+
+    // The timers of the first level are all due within one round of it
+    std::uint64_t nextTick = std::numeric_limits<std::uint64_t>::max();
+    if (m_firstLevelCount > 0)
+    {
+        for (std::uint64_t tick = m_nextTick; tick < m_nextTick + slotCount; ++tick)
+        {
+            if (!isEmpty(static_cast<std::uint32_t>(tick & (slotCount - 1))))
+            {
+                nextTick = tick;
+                break;
+            }
+        }
+    }
+
+    // The timers of the other levels must be moved down first, which happens when the level below completes a round
+    for (std::size_t level = 1; level < levelCount; ++level)
+    {
+        const std::size_t   shift = levelBits * level;
+        const std::uint64_t round = std::uint64_t{1} << shift;
+        std::uint64_t       tick  = (m_nextTick + round - 1) & ~(round - 1);
+
+        for (std::size_t i = 0; (i < slotCount) && (tick < nextTick); ++i, tick += round)
+        {
+            if (!isEmpty(static_cast<std::uint32_t>(level * slotCount + ((tick >> shift) & (slotCount - 1)))))
+            {
+                nextTick = tick;
+                break;
+            }
+        }
+    }
+
+    const std::int64_t expiry = static_cast<std::int64_t>(nextTick) * m_resolution.asMicroseconds();
+    return std::max(microseconds(expiry) - m_clock.getElapsedTime(), Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TimerWheel::getTimerCount() const
+{
+    return m_timerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t TimerWheel::getCurrentTick() const
+{
+    return static_cast<std::uint64_t>(m_clock.getElapsedTime().asMicroseconds() / m_resolution.asMicroseconds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TimerWheel::insert(std::uint32_t index)
+{
+    // Timers that are already due go in the slot processed next
+    const std::uint64_t expiry = std::max(m_nodes[index].expiry, m_nextTick);
+    const std::uint64_t delay  = expiry - m_nextTick;
+
+    // Each level has slots big enough to cover a whole round of the level below
+    std::size_t level = 0;
+    while ((level + 1 < levelCount) && (delay >> (levelBits * (level + 1))) != 0)
+        ++level;
+
+    // Timers beyond the last level wait in its furthest slot, and are inserted again when it is reached
+    std::uint64_t slotTick = expiry;
+    if ((delay >> (levelBits * levelCount)) != 0)
+        slotTick = m_nextTick + (std::uint64_t{1} << (levelBits * levelCount)) - 1;
+
+    const std::uint64_t slot = (slotTick >> (levelBits * level)) & (slotCount - 1);
+    link(static_cast<std::uint32_t>(level * slotCount + slot), index);
+}
+
+
+////////////////////////////////////////////////////////////
+void TimerWheel::link(std::uint32_t list, std::uint32_t index)
+{
+    Node&               node     = m_nodes[index];
+    const std::uint32_t previous = m_nodes[list].previous;
+
+    node.list              = list;
+    node.previous          = previous;
+    node.next              = list;
+    m_nodes[previous].next = index;
+    m_nodes[list].previous = index;
+
+    if (list < slotCount)
+        ++m_firstLevelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void TimerWheel::unlink(std::uint32_t index)
+{
+    const Node& node            = m_nodes[index];
+    m_nodes[node.previous].next = node.next;
+    m_nodes[node.next].previous = node.previous;
+
+    if (node.list < slotCount)
+        --m_firstLevelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void TimerWheel::release(std::uint32_t index)
+{
+    Node& node   = m_nodes[index];
+    node.handler = nullptr;
+    node.active  = false;
+    ++node.generation;
+
+    node.next   = m_freeNodes;
+    m_freeNodes = index;
+    --m_timerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TimerWheel::isEmpty(std::uint32_t list) const
+{
+    return m_nodes[list].next == list;
+}
+
+} // namespace sf
@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+#include <SFML/Network/TlsSocket.hpp>
+#include <SFML/Network/TlsSocketImpl.hpp>
+
+#include <SFML/System/ProfileZone.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+bool TlsSocket::isAvailable()
+{
+    return priv::TlsSocketImpl::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSocket::TlsSocket() = default;
+
+
+////////////////////////////////////////////////////////////
+TlsSocket::~TlsSocket()
+{
+    // Close the session before the socket
+    disconnect();
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSocket::TlsSocket(TlsSocket&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TlsSocket& TlsSocket::operator=(TlsSocket&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void TlsSocket::setVerifyPeer(bool verify)
+{
+    m_verifyPeer = verify;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocket::connect(const IpAddress&   remoteAddress,
+                                  unsigned short     remotePort,
+                                  const std::string& hostName,
+                                  Time               timeout,
+                                  std::string_view   earlyData)
+{
+    // The handshake is always performed in blocking mode
+    const bool blocking = isBlocking();
+    setBlocking(true);
+
+    Status status = TcpSocket::connect(remoteAddress, remotePort, timeout);
+    if (status == Status::Done)
+    {
+        // The handshake waits for the socket itself, so that it can respect the timeout
+        setBlocking(false);
+        m_impl = std::make_unique<priv::TlsSocketImpl>();
+        status = m_impl->connect(getNativeHandle(), hostName, remotePort, m_verifyPeer, timeout, earlyData);
+    }
+
+    setBlocking(blocking);
+
+    if (status != Status::Done)
+        disconnect();
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSocket::disconnect()
+{
+    if (m_impl)
+    {
+        m_impl->shutdown();
+        m_impl.reset();
+    }
+
+    m_packetBuffer.clear();
+    TcpSocket::disconnect();
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocket::send(const void* data, std::size_t size, std::size_t& sent)
+{
+    SFML_PROFILE_ZONE("sf::TlsSocket::send");
+
+    sent = 0;
+    if (!m_impl)
+        return Status::Disconnected;
+
+    const Status status = m_impl->send(data, size, sent);
+    recordSend(sent, 0, 0);
+    if (status == Status::Partial)
+        recordPartialSend(sent, size);
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocket::receive(void* data, std::size_t size, std::size_t& received)
+{
+    SFML_PROFILE_ZONE("sf::TlsSocket::receive");
+
+    received = 0;
+    if (!m_impl)
+        return Status::Disconnected;
+
+    const Status status = m_impl->receive(data, size, received);
+    recordReceive(received, 0, 0);
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TlsSocket::send(Packet& packet)
+{
+    SFML_PROFILE_ZONE("sf::TlsSocket::send");
+
+    if (!m_impl)
+        return Status::Disconnected;
+
+    // Like TcpSocket, send the size of the packet before its data; both are
+    // copied into a common block so that they are encrypted in a single record
+    if (packet.m_sendPos == 0)
+    {
+        std::size_t size = 0;
+        const void* data = packet.onSend(size);
+
+        const std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+        m_packetBuffer.resize(sizeof(packetSize) + size);
+        std::memcpy(m_packetBuffer.data(), &packetSize, sizeof(packetSize));
+        if (size > 0)
+            std::memcpy(m_packetBuffer.data() + sizeof(packetSize), data, size);
+    }
+
+    // Send the part that wasn't sent yet, and record the location to resume from in case of a partial send
+    std::size_t  sent   = 0;
+    const Status status = m_impl->send(m_packetBuffer.data() + packet.m_sendPos,
+                                       m_packetBuffer.size() - packet.m_sendPos,
+                                       sent);
+    packet.m_sendPos += sent;
+    recordSend(sent, status == Status::Done ? 1 : 0, 0);
+
+    if (status == Status::Done)
+    {
+        packet.m_sendPos = 0;
+    }
+    else if (((status == Status::NotReady) || (status == Status::Partial)) && (packet.m_sendPos > 0))
+    {
+        recordPartialSend(packet.m_sendPos, m_packetBuffer.size());
+        return Status::Partial;
+    }
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSocket::isSessionReused() const
+{
+    return m_impl && m_impl->isSessionReused();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSocket::isEarlyDataAccepted() const
+{
+    return m_impl && m_impl->isEarlyDataAccepted();
+}
+
+} // namespace sf
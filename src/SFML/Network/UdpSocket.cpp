@@ -31,10 +31,34 @@
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+#include <sys/ioctl.h>
+#endif
+
+
+namespace
+{
+// Maximum number of datagrams handed to the system in a single batch call
+constexpr std::size_t maxBatchSize = 64;
+
+#if defined(SFML_SYSTEM_LINUX)
+// Room for the ancillary data of a received datagram (its reception timestamp)
+struct ControlBuffer
+{
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(timespec))> data;
+};
+#endif
+} // namespace
 
 
 namespace sf
@@ -51,11 +75,11 @@ unsigned short UdpSocket::getLocalPort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the local end of the socket
-        sockaddr_in                  address{};
+        sockaddr_storage             address{};
         priv::SocketImpl::AddrLength size = sizeof(address);
         if (getsockname(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(address);
         }
     }
 
@@ -71,15 +95,16 @@ Socket::Status UdpSocket::bind(unsigned short port, const IpAddress& address)
     close();
 
     // Create the internal socket if it doesn't exist
-    create();
+    create(address.getType());
 
     // Check if the address is valid
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
     // Bind the socket
-    sockaddr_in addr = priv::SocketImpl::createAddress(address.toInteger(), port);
-    if (::bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1)
+    sockaddr_storage                   addr{};
+    const priv::SocketImpl::AddrLength size = priv::SocketImpl::createAddress(address, port, getAddressType(), addr);
+    if (::bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), size) == -1)
     {
         err() << "Failed to bind socket to port " << port << std::endl;
         return Status::Error;
@@ -100,8 +125,10 @@ void UdpSocket::unbind()
 ////////////////////////////////////////////////////////////
 Socket::Status UdpSocket::send(const void* data, std::size_t size, const IpAddress& remoteAddress, unsigned short remotePort)
 {
+    SFML_PROFILE_ZONE("sf::UdpSocket::send");
+
     // Create the internal socket if it doesn't exist
-    create();
+    create(remoteAddress.getType());
 
     // Make sure that all the data will fit in one datagram
     if (size > MaxDatagramSize)
@@ -112,7 +139,16 @@ Socket::Status UdpSocket::send(const void* data, std::size_t size, const IpAddre
     }
 
     // Build the target address
-    sockaddr_in address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
+    sockaddr_storage                   address{};
+    const priv::SocketImpl::AddrLength addressSize = priv::SocketImpl::createAddress(remoteAddress,
+                                                                                     remotePort,
+                                                                                     getAddressType(),
+                                                                                     address);
+    if (addressSize == 0)
+    {
+        err() << "Cannot send data to the IPv6 address " << remoteAddress << " from an IPv4 socket" << std::endl;
+        return Status::Error;
+    }
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuseless-cast"
@@ -123,12 +159,18 @@ Socket::Status UdpSocket::send(const void* data, std::size_t size, const IpAddre
                static_cast<priv::SocketImpl::Size>(size),
                0,
                reinterpret_cast<sockaddr*>(&address),
-               sizeof(address)));
+               addressSize));
 #pragma GCC diagnostic pop
 
     // Check for errors
     if (sent < 0)
-        return priv::SocketImpl::getErrorStatus();
+    {
+        const Status status = priv::SocketImpl::getErrorStatus();
+        recordSend(0, 0, 1);
+        return status;
+    }
+
+    recordSend(size, 1, 1);
 
     return Status::Done;
 }
@@ -141,6 +183,8 @@ Socket::Status UdpSocket::receive(void*                     data,
                                   std::optional<IpAddress>& remoteAddress,
                                   unsigned short&           remotePort)
 {
+    SFML_PROFILE_ZONE("sf::UdpSocket::receive");
+
     // First clear the variables to fill
     received      = 0;
     remoteAddress = std::nullopt;
@@ -154,7 +198,7 @@ Socket::Status UdpSocket::receive(void*                     data,
     }
 
     // Data that will be filled with the other computer's address
-    sockaddr_in address = priv::SocketImpl::createAddress(INADDR_ANY, 0);
+    sockaddr_storage address{};
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuseless-cast"
@@ -171,12 +215,17 @@ Socket::Status UdpSocket::receive(void*                     data,
 
     // Check for errors
     if (sizeReceived < 0)
-        return priv::SocketImpl::getErrorStatus();
+    {
+        const Status status = priv::SocketImpl::getErrorStatus();
+        recordReceive(0, 0, 1);
+        return status;
+    }
 
     // Fill the sender information
     received      = static_cast<std::size_t>(sizeReceived);
-    remoteAddress = IpAddress(ntohl(address.sin_addr.s_addr));
-    remotePort    = ntohs(address.sin_port);
+    recordReceive(received, 1, 1);
+    remoteAddress = priv::SocketImpl::getAddress(address);
+    remotePort    = priv::SocketImpl::getPort(address);
 
     return Status::Done;
 }
@@ -185,6 +234,8 @@ Socket::Status UdpSocket::receive(void*                     data,
 ////////////////////////////////////////////////////////////
 Socket::Status UdpSocket::send(Packet& packet, const IpAddress& remoteAddress, unsigned short remotePort)
 {
+    SFML_PROFILE_ZONE("sf::UdpSocket::send");
+
     // UDP is a datagram-oriented protocol (as opposed to TCP which is a stream protocol).
     // Sending one datagram is almost safe: it may be lost but if it's received, then its data
     // is guaranteed to be ok. However, splitting a packet into multiple datagrams would be highly
@@ -205,6 +256,8 @@ Socket::Status UdpSocket::send(Packet& packet, const IpAddress& remoteAddress, u
 ////////////////////////////////////////////////////////////
 Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort)
 {
+    SFML_PROFILE_ZONE("sf::UdpSocket::receive");
+
     // See the detailed comment in send(Packet) above.
 
     // Receive the datagram
@@ -220,4 +273,365 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::sendBatch(const Datagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    SFML_PROFILE_ZONE("sf::UdpSocket::sendBatch");
+
+    // First clear the variables to fill
+    sent = 0;
+
+    // Create the internal socket if it doesn't exist, dual-stack if it has to reach IPv6 addresses
+    const bool hasIpV6 = std::any_of(datagrams,
+                                     datagrams + count,
+                                     [](const Datagram& datagram)
+                                     { return datagram.remoteAddress.getType() == IpAddress::Type::V6; });
+    create(hasIpV6 ? IpAddress::Type::V6 : IpAddress::Type::V4);
+
+    // Make sure that every datagram is valid before sending any of them
+    if (hasIpV6 && (getAddressType() == IpAddress::Type::V4))
+    {
+        err() << "Cannot send data to an IPv6 address from an IPv4 socket" << std::endl;
+        return Status::Error;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > MaxDatagramSize)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+#if defined(SFML_SYSTEM_LINUX)
+    // Send the datagrams by chunks, with a single system call per chunk
+    while (sent < count)
+    {
+        const std::size_t                          chunkSize = std::min(count - sent, maxBatchSize);
+        std::array<mmsghdr, maxBatchSize>          messages{};
+        std::array<iovec, maxBatchSize>            buffers{};
+        std::array<sockaddr_storage, maxBatchSize> addresses{};
+
+        for (std::size_t i = 0; i < chunkSize; ++i)
+        {
+            const Datagram& datagram = datagrams[sent + i];
+            buffers[i]               = {datagram.data, datagram.size};
+
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = priv::SocketImpl::createAddress(datagram.remoteAddress,
+                                                                              datagram.remotePort,
+                                                                              getAddressType(),
+                                                                              addresses[i]);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int result = sendmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(chunkSize), 0);
+
+        // Check for errors
+        if (result < 0)
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+            recordSend(0, 0, 1);
+
+            if ((status == Status::NotReady) && (sent > 0))
+            {
+                recordPartialSend(sent, count);
+                return Status::Partial;
+            }
+
+            return status;
+        }
+
+        std::size_t bytes = 0;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+            bytes += datagrams[sent + i].size;
+        recordSend(bytes, static_cast<std::size_t>(result), 1);
+
+        sent += static_cast<std::size_t>(result);
+    }
+#else
+    // Fall back to one system call per datagram
+    for (; sent < count; ++sent)
+    {
+        const Datagram& datagram = datagrams[sent];
+        const Status    status   = send(datagram.data, datagram.size, datagram.remoteAddress, datagram.remotePort);
+        if ((status == Status::NotReady) && (sent > 0))
+        {
+            recordPartialSend(sent, count);
+            return Status::Partial;
+        }
+
+        if (status != Status::Done)
+            return status;
+    }
+#endif
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receiveBatch(Datagram* datagrams, std::size_t count, std::size_t& received)
+{
+    SFML_PROFILE_ZONE("sf::UdpSocket::receiveBatch");
+
+    // First clear the variables to fill
+    received = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (!datagrams[i].data)
+        {
+            err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+            return Status::Error;
+        }
+
+        datagrams[i].received      = 0;
+        datagrams[i].remoteAddress = IpAddress::Any;
+        datagrams[i].remotePort    = 0;
+        datagrams[i].timestamp     = Time::Zero;
+    }
+
+#if defined(SFML_SYSTEM_LINUX)
+    // Receive the datagrams by chunks, with a single system call per chunk
+    while (received < count)
+    {
+        const std::size_t                          chunkSize = std::min(count - received, maxBatchSize);
+        std::array<mmsghdr, maxBatchSize>          messages{};
+        std::array<iovec, maxBatchSize>            buffers{};
+        std::array<sockaddr_storage, maxBatchSize> addresses{};
+        std::array<ControlBuffer, maxBatchSize>    controls{};
+
+        for (std::size_t i = 0; i < chunkSize; ++i)
+        {
+            Datagram& datagram                 = datagrams[received + i];
+            buffers[i]                         = {datagram.data, datagram.size};
+            messages[i].msg_hdr.msg_name       = &addresses[i];
+            messages[i].msg_hdr.msg_namelen    = sizeof(addresses[i]);
+            messages[i].msg_hdr.msg_iov        = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen     = 1;
+            messages[i].msg_hdr.msg_control    = controls[i].data.data();
+            messages[i].msg_hdr.msg_controllen = controls[i].data.size();
+        }
+
+        // Only the very first datagram may be waited for
+        const int flags  = (received == 0) ? MSG_WAITFORONE : MSG_DONTWAIT;
+        const int result = recvmmsg(getNativeHandle(),
+                                    messages.data(),
+                                    static_cast<unsigned int>(chunkSize),
+                                    flags,
+                                    nullptr);
+
+        // Check for errors
+        if (result < 0)
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+            recordReceive(0, 0, 1);
+
+            return ((status == Status::NotReady) && (received > 0)) ? Status::Done : status;
+        }
+
+        // Fill the sender information
+        std::size_t bytes = 0;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            Datagram& datagram     = datagrams[received + i];
+            datagram.received      = messages[i].msg_len;
+            datagram.remoteAddress = priv::SocketImpl::getAddress(addresses[i]);
+            datagram.remotePort    = priv::SocketImpl::getPort(addresses[i]);
+
+            // Extract the reception timestamp, if the socket records them
+            for (cmsghdr* control = CMSG_FIRSTHDR(&messages[i].msg_hdr); control;
+                 control          = CMSG_NXTHDR(&messages[i].msg_hdr, control))
+            {
+                if ((control->cmsg_level == SOL_SOCKET) && (control->cmsg_type == SCM_TIMESTAMPNS))
+                {
+                    timespec time{};
+                    std::memcpy(&time, CMSG_DATA(control), sizeof(time));
+                    datagram.timestamp = microseconds(std::int64_t{time.tv_sec} * 1'000'000 + time.tv_nsec / 1'000);
+                }
+            }
+
+            bytes += datagram.received;
+        }
+
+        recordReceive(bytes, static_cast<std::size_t>(result), 1);
+
+        received += static_cast<std::size_t>(result);
+        if (static_cast<std::size_t>(result) < chunkSize)
+            break;
+    }
+#else
+    // Fall back to one system call per datagram
+    for (; received < count; ++received)
+    {
+        // After the first datagram, a blocking socket only goes on while more data is already queued
+        if ((received > 0) && isBlocking())
+        {
+#if defined(SFML_SYSTEM_WINDOWS)
+            u_long pending = 0;
+            if ((ioctlsocket(getNativeHandle(), FIONREAD, &pending) != 0) || (pending == 0))
+                break;
+#else
+            int pending = 0;
+            if ((ioctl(getNativeHandle(), FIONREAD, &pending) != 0) || (pending == 0))
+                break;
+#endif
+        }
+
+        Datagram&                datagram = datagrams[received];
+        std::optional<IpAddress> remoteAddress;
+        const Status             status = receive(datagram.data,
+                                                  datagram.size,
+                                                  datagram.received,
+                                                  remoteAddress,
+                                                  datagram.remotePort);
+        if (status != Status::Done)
+            return ((status == Status::NotReady) && (received > 0)) ? Status::Done : status;
+
+        datagram.remoteAddress = *remoteAddress;
+    }
+#endif
+
+    return Status::Done;
+}
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::sendToAll(const void*        data,
+                                    std::size_t        size,
+                                    const Destination* destinations,
+                                    std::size_t        count,
+                                    std::size_t&       sent)
+{
+    SFML_PROFILE_ZONE("sf::UdpSocket::sendToAll");
+
+    // Every datagram points to the same bytes, only the destinations are copied
+    m_fanOut.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Datagram& datagram     = m_fanOut[i];
+        datagram.data          = const_cast<void*>(data);
+        datagram.size          = size;
+        datagram.remoteAddress = destinations[i].address;
+        datagram.remotePort    = destinations[i].port;
+    }
+
+    return sendBatch(m_fanOut.data(), count, sent);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::sendToAll(Packet&            packet,
+                                    const Destination* destinations,
+                                    std::size_t        count,
+                                    std::size_t&       sent)
+{
+    // See the detailed comment in send(Packet) above.
+
+    // Get the data to send from the packet, once for all the destinations
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    return sendToAll(data, size, destinations, count, sent);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpSocket::joinMulticastGroup(const IpAddress& group, const IpAddress& interfaceAddress)
+{
+    return setMembership(group, interfaceAddress, true);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpSocket::leaveMulticastGroup(const IpAddress& group, const IpAddress& interfaceAddress)
+{
+    return setMembership(group, interfaceAddress, false);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpSocket::setMulticastInterface(const IpAddress& interfaceAddress)
+{
+    // Create the internal socket if it doesn't exist
+    create(IpAddress::Type::V4);
+
+    if (interfaceAddress.getType() != IpAddress::Type::V4)
+    {
+        err() << "Failed to set the multicast interface (only IPv4 interfaces are supported)" << std::endl;
+        return false;
+    }
+
+    in_addr address{};
+    address.s_addr = htonl(interfaceAddress.toInteger());
+    if (setsockopt(getNativeHandle(),
+                   IPPROTO_IP,
+                   IP_MULTICAST_IF,
+                   reinterpret_cast<char*>(&address),
+                   sizeof(address)) == -1)
+    {
+        err() << "Failed to set the multicast interface to " << interfaceAddress << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpSocket::setMembership(const IpAddress& group, const IpAddress& interfaceAddress, bool join)
+{
+    // Create the internal socket if it doesn't exist
+    create(group.getType());
+
+    if ((group.getType() == IpAddress::Type::V6) && (getAddressType() == IpAddress::Type::V4))
+    {
+        err() << "Cannot join the IPv6 multicast group " << group << " with an IPv4 socket" << std::endl;
+        return false;
+    }
+
+    int result = -1;
+    if (group.getType() == IpAddress::Type::V6)
+    {
+        const auto bytes = group.toBytes();
+        ipv6_mreq  request{};
+        std::memcpy(&request.ipv6mr_multiaddr, bytes.data(), bytes.size());
+        request.ipv6mr_interface = 0;
+
+        result = setsockopt(getNativeHandle(),
+                            IPPROTO_IPV6,
+                            join ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP,
+                            reinterpret_cast<char*>(&request),
+                            sizeof(request));
+    }
+    else
+    {
+        if (interfaceAddress.getType() != IpAddress::Type::V4)
+        {
+            err() << "Cannot use an IPv6 interface for the IPv4 multicast group " << group << std::endl;
+            return false;
+        }
+
+        ip_mreq request{};
+        request.imr_multiaddr.s_addr = htonl(group.toInteger());
+        request.imr_interface.s_addr = htonl(interfaceAddress.toInteger());
+
+        result = setsockopt(getNativeHandle(),
+                            IPPROTO_IP,
+                            join ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP,
+                            reinterpret_cast<char*>(&request),
+                            sizeof(request));
+    }
+
+    if (result == -1)
+    {
+        err() << "Failed to " << (join ? "join" : "leave") << " the multicast group " << group << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace sf
@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Unix/IoUringPoller.hpp>
+
+#include <algorithm>
+
+#include <cerrno>
+#include <cstring>
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace IoUringPollerImpl
+{
+// Number of entries of the submission ring, more changes are submitted early
+constexpr unsigned ringEntries = 256;
+
+void* map(int ring, std::size_t size, off_t offset)
+{
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, offset);
+    return address == MAP_FAILED ? nullptr : address;
+}
+
+int enter(int ring, unsigned toSubmit, unsigned minComplete, unsigned flags, const void* argument, std::size_t size)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, argument, size));
+}
+} // namespace IoUringPollerImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::unique_ptr<IoUringPoller> IoUringPoller::create()
+{
+    std::unique_ptr<IoUringPoller> poller(new IoUringPoller);
+    if (!poller->setup())
+        return nullptr;
+
+    return poller;
+}
+
+
+////////////////////////////////////////////////////////////
+IoUringPoller::~IoUringPoller()
+{
+    // Closing the ring cancels the polls that are still armed
+    if (m_sqes)
+        ::munmap(m_sqes, m_sqesSize);
+    if (m_cqRing && (m_cqRing != m_sqRing))
+        ::munmap(m_cqRing, m_cqRingSize);
+    if (m_sqRing)
+        ::munmap(m_sqRing, m_sqRingSize);
+    if (m_ring != -1)
+        ::close(m_ring);
+}
+
+
+////////////////////////////////////////////////////////////
+bool IoUringPoller::setup()
+{
+    using namespace IoUringPollerImpl;
+
+    io_uring_params parameters{};
+    m_ring = static_cast<int>(::syscall(__NR_io_uring_setup, ringEntries, &parameters));
+    if (m_ring == -1)
+        return false;
+
+    // Waiting with a timeout needs Linux 5.11, older kernels use epoll instead
+    const unsigned required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((parameters.features & required) != required)
+        return false;
+
+    m_sqRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+    m_cqRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+    m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+    m_sqesSize                  = parameters.sq_entries * sizeof(io_uring_sqe);
+
+    m_sqRing = map(m_ring, m_sqRingSize, IORING_OFF_SQ_RING);
+    m_cqRing = m_sqRing;
+    m_sqes   = static_cast<io_uring_sqe*>(map(m_ring, m_sqesSize, IORING_OFF_SQES));
+    if (!m_sqRing || !m_sqes)
+        return false;
+
+    auto* const ring = static_cast<std::byte*>(m_sqRing);
+    m_sqHead         = reinterpret_cast<unsigned*>(ring + parameters.sq_off.head);
+    m_sqTail         = reinterpret_cast<unsigned*>(ring + parameters.sq_off.tail);
+    m_sqMask         = *reinterpret_cast<unsigned*>(ring + parameters.sq_off.ring_mask);
+    m_sqEntries      = parameters.sq_entries;
+    m_sqArray        = reinterpret_cast<unsigned*>(ring + parameters.sq_off.array);
+    m_cqHead         = reinterpret_cast<unsigned*>(ring + parameters.cq_off.head);
+    m_cqTail         = reinterpret_cast<unsigned*>(ring + parameters.cq_off.tail);
+    m_cqMask         = *reinterpret_cast<unsigned*>(ring + parameters.cq_off.ring_mask);
+    m_cqes           = reinterpret_cast<io_uring_cqe*>(ring + parameters.cq_off.cqes);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+io_uring_sqe& IoUringPoller::getEntry()
+{
+    using namespace IoUringPollerImpl;
+
+    // Make room by submitting the queued entries; completions are kept by the kernel until the next wait
+    if (m_queued == m_sqEntries)
+    {
+        while ((enter(m_ring, m_queued, 0, 0, nullptr, 0) == -1) && (errno == EINTR))
+        {
+        }
+        m_queued = *m_sqTail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+    }
+
+    const unsigned tail  = *m_sqTail;
+    const unsigned index = tail & m_sqMask;
+
+    io_uring_sqe& entry = m_sqes[index];
+    std::memset(&entry, 0, sizeof(entry));
+
+    m_sqArray[index] = index;
+    __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+    ++m_queued;
+
+    return entry;
+}
+
+
+////////////////////////////////////////////////////////////
+void IoUringPoller::arm(SocketHandle handle, Poll& poll)
+{
+    poll.id    = m_nextId++;
+    poll.armed = true;
+    m_armed.emplace(poll.id, handle);
+
+    io_uring_sqe& entry = getEntry();
+    entry.opcode        = IORING_OP_POLL_ADD;
+    entry.fd            = handle;
+    entry.poll32_events = poll.mask;
+    entry.user_data     = poll.id;
+}
+
+
+////////////////////////////////////////////////////////////
+void IoUringPoller::cancel(Poll& poll)
+{
+    // The completions of the cancelled poll and of the cancellation itself are ignored
+    m_armed.erase(poll.id);
+    poll.armed = false;
+
+    io_uring_sqe& entry = getEntry();
+    entry.opcode        = IORING_OP_POLL_REMOVE;
+    entry.addr          = poll.id;
+    entry.user_data     = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void IoUringPoller::watch(SocketHandle handle, bool receive, bool send)
+{
+    const unsigned mask = (receive ? POLLIN : 0u) | (send ? POLLOUT : 0u);
+
+    const auto it = m_polls.find(handle);
+    if (it == m_polls.end())
+    {
+        if (mask != 0)
+        {
+            m_polls.emplace(handle, Poll{0, mask, false});
+            m_rearm.push_back(handle);
+        }
+        return;
+    }
+
+    Poll& poll = it->second;
+    if (poll.mask == mask)
+        return;
+
+    if (poll.armed)
+        cancel(poll);
+
+    if (mask == 0)
+    {
+        m_polls.erase(it);
+        return;
+    }
+
+    poll.mask = mask;
+    m_rearm.push_back(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoUringPoller::wait(std::optional<Time> timeout, std::vector<Event>& events)
+{
+    using namespace IoUringPollerImpl;
+
+    // Arm the polls of the new sockets and of the ones that fired, so they report their readiness as long as it lasts
+    for (const SocketHandle handle : m_rearm)
+    {
+        const auto it = m_polls.find(handle);
+        if ((it != m_polls.end()) && !it->second.armed)
+            arm(handle, it->second);
+    }
+    m_rearm.clear();
+
+    // Submit all the changes and wait in a single call
+    __kernel_timespec time{};
+    if (timeout)
+    {
+        const auto nanoseconds = std::max(timeout->asMicroseconds(), std::int64_t{0}) * 1000;
+        time.tv_sec            = nanoseconds / 1'000'000'000;
+        time.tv_nsec           = nanoseconds % 1'000'000'000;
+    }
+
+    io_uring_getevents_arg argument{};
+    argument.ts = timeout ? reinterpret_cast<std::uintptr_t>(&time) : 0;
+
+    const unsigned minComplete = (timeout && (*timeout <= Time::Zero)) ? 0 : 1;
+    const int      result      = enter(m_ring,
+                             m_queued,
+                             minComplete,
+                             IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                             &argument,
+                             sizeof(argument));
+
+    // The entries are consumed even when the wait itself is interrupted or times out
+    m_queued = *m_sqTail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+
+    if ((result == -1) && (errno != EINTR) && (errno != ETIME) && (errno != EBUSY))
+        return;
+
+    unsigned       head = *m_cqHead;
+    const unsigned tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head)
+    {
+        const io_uring_cqe& completion = m_cqes[head & m_cqMask];
+
+        const auto it = m_armed.find(completion.user_data);
+        if (it == m_armed.end())
+            continue;
+
+        const SocketHandle handle = it->second;
+        m_armed.erase(it);
+
+        Poll& poll = m_polls[handle];
+        poll.armed = false;
+        m_rearm.push_back(handle);
+
+        // Errors and hang-ups are reported as readiness, so that the next operation reports them
+        const auto readiness = completion.res < 0 ? static_cast<unsigned>(POLLERR)
+                                                  : static_cast<unsigned>(completion.res);
+        events.push_back({handle,
+                          (readiness & (POLLIN | POLLERR | POLLHUP)) != 0,
+                          (readiness & (POLLOUT | POLLERR | POLLHUP)) != 0});
+    }
+    __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/SocketHandle.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <linux/io_uring.h>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Readiness poller based on io_uring
+///
+/// Sockets are watched with one-shot polls, which are armed
+/// again after they fire, so that readiness is reported as
+/// long as it lasts, like with epoll. The changes of the
+/// watched sockets are queued and submitted along with the
+/// next wait, all in a single system call.
+///
+/// io_uring keeps the sockets that it polls open: they must
+/// stop being watched before they are closed.
+///
+////////////////////////////////////////////////////////////
+class IoUringPoller
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Readiness of a socket
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Event
+    {
+        SocketHandle handle{};  //!< Handle of the socket
+        bool         receive{}; //!< Is the socket ready to receive?
+        bool         send{};    //!< Is the socket ready to send?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a poller
+    ///
+    /// \return Poller, or a null pointer if the kernel doesn't support io_uring polling
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::unique_ptr<IoUringPoller> create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IoUringPoller();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IoUringPoller(const IoUringPoller&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IoUringPoller& operator=(const IoUringPoller&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the readiness that a socket is watched for
+    ///
+    /// The change is submitted with the next wait.
+    ///
+    /// \param handle  Handle of the socket
+    /// \param receive True to watch the socket for data to receive
+    /// \param send    True to watch the socket for room to send data
+    ///
+    ////////////////////////////////////////////////////////////
+    void watch(SocketHandle handle, bool receive, bool send);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for sockets to become ready
+    ///
+    /// \param timeout Maximum time to wait, `std::nullopt` to wait indefinitely
+    /// \param events  Filled with the readiness of the sockets that are ready
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait(std::optional<Time> timeout, std::vector<Event>& events);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Poll of a watched socket
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Poll
+    {
+        std::uint64_t id{};    //!< Identifier of the armed poll, found in its completion
+        unsigned      mask{};  //!< Events that the socket is watched for
+        bool          armed{}; //!< Is the poll waiting in the kernel?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IoUringPoller() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the ring and map its queues
+    ///
+    /// \return True if the ring is ready to be used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setup();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a free submission entry, submitting the queued ones if there is none left
+    ///
+    /// \return Submission entry, cleared
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] io_uring_sqe& getEntry();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the poll of a socket
+    ///
+    /// \param handle Handle of the socket
+    /// \param poll   Poll to arm
+    ///
+    ////////////////////////////////////////////////////////////
+    void arm(SocketHandle handle, Poll& poll);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the cancellation of an armed poll
+    ///
+    /// \param poll Poll to cancel
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancel(Poll& poll);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    int                                             m_ring{-1};     //!< File descriptor of the ring
+    std::size_t                                     m_sqRingSize{}; //!< Size of the mapping of the submission ring
+    std::size_t                                     m_cqRingSize{}; //!< Size of the mapping of the completion ring
+    std::size_t                                     m_sqesSize{};   //!< Size of the mapping of the submission entries
+    void*                                           m_sqRing{};     //!< Mapping of the submission ring
+    void*                                           m_cqRing{};     //!< Mapping of the completion ring
+    io_uring_sqe*                                   m_sqes{};       //!< Submission entries
+    unsigned*                                       m_sqHead{};     //!< First entry not yet consumed by the kernel
+    unsigned*                                       m_sqTail{};     //!< Next entry to fill
+    unsigned                                        m_sqMask{};     //!< Mask of the indices of the submission ring
+    unsigned                                        m_sqEntries{};  //!< Number of entries of the submission ring
+    unsigned*                                       m_sqArray{};    //!< Indices of the submitted entries
+    unsigned*                                       m_cqHead{};     //!< First completion not yet reaped
+    unsigned*                                       m_cqTail{};     //!< Next completion written by the kernel
+    unsigned                                        m_cqMask{};     //!< Mask of the indices of the completion ring
+    io_uring_cqe*                                   m_cqes{};       //!< Completions
+    unsigned                                        m_queued{};     //!< Number of entries not submitted yet
+    std::uint64_t                                   m_nextId{1};    //!< Identifier of the next armed poll
+    std::unordered_map<SocketHandle, Poll>          m_polls;        //!< Watched sockets
+    std::unordered_map<std::uint64_t, SocketHandle> m_armed;        //!< Sockets of the polls armed in the kernel
+    std::vector<SocketHandle>                       m_rearm;        //!< Sockets whose poll must be armed again
+};
+
+} // namespace sf::priv
@@ -27,7 +27,11 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+#include <array>
+
 #include <cstdint>
+#include <cstring>
 
 
 namespace sf::priv
@@ -44,6 +48,72 @@ sockaddr_in SocketImpl::createAddress(std::uint32_t address, unsigned short port
 }
 
 
+////////////////////////////////////////////////////////////
+SocketImpl::AddrLength SocketImpl::createAddress(const IpAddress&  address,
+                                                 unsigned short    port,
+                                                 IpAddress::Type   socketType,
+                                                 sockaddr_storage& result)
+{
+    result = sockaddr_storage();
+
+    if (socketType == IpAddress::Type::V4)
+    {
+        // IPv4 sockets can't reach IPv6 addresses
+        if (address.getType() != IpAddress::Type::V4)
+            return 0;
+
+        auto& addr = reinterpret_cast<sockaddr_in&>(result);
+        addr       = createAddress(address.toInteger(), port);
+        return sizeof(addr);
+    }
+
+    auto&                              addr  = reinterpret_cast<sockaddr_in6&>(result);
+    const std::array<std::uint8_t, 16> bytes = address.toBytes();
+    std::memcpy(&addr.sin6_addr, bytes.data(), bytes.size());
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port   = htons(port);
+
+    return sizeof(addr);
+}
+
+
+////////////////////////////////////////////////////////////
+IpAddress SocketImpl::getAddress(const sockaddr_storage& address)
+{
+    if (address.ss_family == AF_INET6)
+    {
+        const auto&                  addr = reinterpret_cast<const sockaddr_in6&>(address);
+        std::array<std::uint8_t, 16> bytes{};
+        std::memcpy(bytes.data(), &addr.sin6_addr, bytes.size());
+
+        // Dual-stack sockets see IPv4 peers as IPv4-mapped addresses (::ffff:a.b.c.d)
+        static constexpr std::array<std::uint8_t, 12> mappedPrefix{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+        if (std::equal(mappedPrefix.begin(), mappedPrefix.end(), bytes.begin()))
+            return {bytes[12], bytes[13], bytes[14], bytes[15]};
+
+        return IpAddress(bytes);
+    }
+
+    if (address.ss_family == AF_INET)
+        return IpAddress(ntohl(reinterpret_cast<const sockaddr_in&>(address).sin_addr.s_addr));
+
+    return IpAddress::Any;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short SocketImpl::getPort(const sockaddr_storage& address)
+{
+    if (address.ss_family == AF_INET6)
+        return ntohs(reinterpret_cast<const sockaddr_in6&>(address).sin6_port);
+
+    if (address.ss_family == AF_INET)
+        return ntohs(reinterpret_cast<const sockaddr_in&>(address).sin_port);
+
+    return 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::invalidSocket()
 {
@@ -66,6 +136,46 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<SocketImpl::OptionName> SocketImpl::getOptionName(Socket::Option option, IpAddress::Type addressType)
+{
+    switch (option)
+    {
+        case Socket::Option::SendBufferSize:
+            return OptionName{SOL_SOCKET, SO_SNDBUF};
+        case Socket::Option::ReceiveBufferSize:
+            return OptionName{SOL_SOCKET, SO_RCVBUF};
+        case Socket::Option::NoDelay:
+            return OptionName{IPPROTO_TCP, TCP_NODELAY};
+        case Socket::Option::TypeOfService:
+            if (addressType == IpAddress::Type::V6)
+            {
+#if defined(IPV6_TCLASS)
+                return OptionName{IPPROTO_IPV6, IPV6_TCLASS};
+#else
+                return std::nullopt;
+#endif
+            }
+            return OptionName{IPPROTO_IP, IP_TOS};
+        case Socket::Option::MulticastTtl:
+            if (addressType == IpAddress::Type::V6)
+                return OptionName{IPPROTO_IPV6, IPV6_MULTICAST_HOPS};
+            return OptionName{IPPROTO_IP, IP_MULTICAST_TTL};
+        case Socket::Option::MulticastLoopback:
+            if (addressType == IpAddress::Type::V6)
+                return OptionName{IPPROTO_IPV6, IPV6_MULTICAST_LOOP};
+            return OptionName{IPPROTO_IP, IP_MULTICAST_LOOP};
+        case Socket::Option::QuickAck:
+        case Socket::Option::NotSentLowWatermark:
+        case Socket::Option::BusyPoll:
+        case Socket::Option::Timestamp:
+            return std::nullopt;
+    }
+
+    return std::nullopt;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Allocator.hpp>
+#include <SFML/System/EnumArray.hpp>
+
+#include <atomic>
+#include <new>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace AllocatorImpl
+{
+// Counters of the allocations made by a module
+struct Counters
+{
+    std::atomic<std::uint64_t> allocationCount{};
+    std::atomic<std::uint64_t> deallocationCount{};
+    std::atomic<std::size_t>   bytesInUse{};
+    std::atomic<std::size_t>   peakBytesInUse{};
+};
+
+// Both are constant-initialized, so that containers of other static objects can use them safely
+std::atomic<sf::MemoryResource*>                   currentResource{};
+sf::priv::EnumArray<sf::MemoryModule, Counters, 5> counters{};
+} // namespace AllocatorImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void setAllocator(MemoryResource* resource)
+{
+    AllocatorImpl::currentResource.store(resource, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+MemoryResource* getAllocator()
+{
+    return AllocatorImpl::currentResource.load(std::memory_order_acquire);
+}
+
+
+////////////////////////////////////////////////////////////
+AllocationStats getAllocationStats(MemoryModule module)
+{
+    const AllocatorImpl::Counters& moduleCounters = AllocatorImpl::counters[module];
+    return {moduleCounters.allocationCount.load(std::memory_order_relaxed),
+            moduleCounters.deallocationCount.load(std::memory_order_relaxed),
+            moduleCounters.bytesInUse.load(std::memory_order_relaxed),
+            moduleCounters.peakBytesInUse.load(std::memory_order_relaxed)};
+}
+
+
+////////////////////////////////////////////////////////////
+void* priv::allocate(MemoryResource* resource, std::size_t size, std::size_t alignment, MemoryModule module)
+{
+    void* const pointer = resource ? resource->allocate(size, alignment)
+                                   : ::operator new(size, static_cast<std::align_val_t>(alignment));
+
+    AllocatorImpl::Counters& moduleCounters = AllocatorImpl::counters[module];
+    moduleCounters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t bytesInUse = moduleCounters.bytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+
+    std::size_t peak = moduleCounters.peakBytesInUse.load(std::memory_order_relaxed);
+    while ((bytesInUse > peak) &&
+           !moduleCounters.peakBytesInUse.compare_exchange_weak(peak, bytesInUse, std::memory_order_relaxed))
+    {
+    }
+
+    return pointer;
+}
+
+
+////////////////////////////////////////////////////////////
+void priv::deallocate(MemoryResource* resource,
+                      void*           pointer,
+                      std::size_t     size,
+                      std::size_t     alignment,
+                      MemoryModule    module) noexcept
+{
+    if (resource)
+        resource->deallocate(pointer, size, alignment);
+    else
+        ::operator delete(pointer, static_cast<std::align_val_t>(alignment));
+
+    AllocatorImpl::Counters& moduleCounters = AllocatorImpl::counters[module];
+    moduleCounters.deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    moduleCounters.bytesInUse.fetch_sub(size, std::memory_order_relaxed);
+}
+
+} // namespace sf
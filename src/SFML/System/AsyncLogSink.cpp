@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/AsyncLogSink.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <chrono>
+
+#include <cstdio>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+AsyncLogSink::AsyncLogSink(LogSink* target, std::size_t capacity) :
+m_target(target),
+m_queue(capacity),
+m_thread(&AsyncLogSink::run, this)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncLogSink::~AsyncLogSink()
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_wakeUp.notify_one();
+    m_thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::setRateLimit(std::size_t maxRepeats, Time interval)
+{
+    m_maxRepeats.store(maxRepeats, std::memory_order_relaxed);
+    m_interval.store(interval.asMicroseconds(), std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::write(LogSeverity severity, std::string_view message)
+{
+    // The message is copied to the queue from a buffer of the thread, reused so that
+    // queuing messages doesn't allocate memory once the buffers are large enough
+    thread_local Message pending;
+    pending.severity = severity;
+    pending.text.assign(message);
+
+    // Count the message before pushing it, so that the thread never sees more messages than counted
+    m_queuedCount.fetch_add(1, std::memory_order_relaxed);
+    if (!m_queue.push(pending))
+    {
+        m_queuedCount.fetch_sub(1, std::memory_order_relaxed);
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    m_wakeUp.notify_one();
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::flush()
+{
+    const std::uint64_t queuedCount = m_queuedCount.load(std::memory_order_relaxed);
+    m_wakeUp.notify_one();
+
+    while (m_processedCount.load(std::memory_order_acquire) < queuedCount)
+        sleep(milliseconds(1));
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t AsyncLogSink::getDroppedCount() const
+{
+    return m_droppedCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::run()
+{
+    const Clock clock;
+    Message     message;
+
+    while (true)
+    {
+        bool stopping = false;
+        {
+            // Producers don't lock the mutex when they notify, so a wake-up can be missed: the timeout
+            // bounds the delay of such messages, and regularly reports the suppressed repeats
+            std::unique_lock lock(m_mutex);
+            m_wakeUp.wait_for(lock,
+                              std::chrono::milliseconds(10),
+                              [this]
+                              {
+                                  return m_stopping || (m_processedCount.load(std::memory_order_relaxed) !=
+                                                        m_queuedCount.load(std::memory_order_relaxed));
+                              });
+            stopping = m_stopping;
+        }
+
+        while (m_queue.pop(message))
+        {
+            process(message, clock.getElapsedTime());
+            m_processedCount.fetch_add(1, std::memory_order_release);
+        }
+
+        if (const std::uint64_t droppedCount = m_droppedCount.load(std::memory_order_relaxed);
+            droppedCount != m_reportedDrops)
+        {
+            forward(LogSeverity::Warning,
+                    std::to_string(droppedCount - m_reportedDrops) + " messages were dropped (the log queue is full)");
+            m_reportedDrops = droppedCount;
+        }
+
+        expireRepeats(clock.getElapsedTime(), stopping);
+
+        // Once stopping, go on until the messages claimed by producers but not written yet are processed
+        if (stopping &&
+            (m_processedCount.load(std::memory_order_relaxed) == m_queuedCount.load(std::memory_order_relaxed)))
+            return;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::process(const Message& message, Time now)
+{
+    const std::size_t maxRepeats = m_maxRepeats.load(std::memory_order_relaxed);
+    if (maxRepeats == 0)
+    {
+        forward(message.severity, message.text);
+        return;
+    }
+
+    const auto [it, inserted] = m_repeats.try_emplace(message.text);
+    Repeats&   repeats        = it->second;
+    if (inserted)
+        repeats.windowStart = now;
+
+    repeats.severity = message.severity;
+    if (++repeats.count <= maxRepeats)
+        forward(message.severity, message.text);
+    else
+        ++repeats.suppressed;
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::expireRepeats(Time now, bool all)
+{
+    const Time interval = microseconds(m_interval.load(std::memory_order_relaxed));
+
+    for (auto it = m_repeats.begin(); it != m_repeats.end();)
+    {
+        const Repeats& repeats = it->second;
+        if (!all && (now - repeats.windowStart < interval))
+        {
+            ++it;
+            continue;
+        }
+
+        if (repeats.suppressed > 0)
+            forward(repeats.severity, it->first + " (repeated " + std::to_string(repeats.suppressed) + " more times)");
+
+        it = m_repeats.erase(it);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncLogSink::forward(LogSeverity severity, std::string_view message)
+{
+    if (m_target)
+    {
+        m_target->write(severity, message);
+    }
+    else
+    {
+        std::fwrite(message.data(), 1, message.size(), stderr);
+        std::fputc('\n', stderr);
+    }
+}
+
+} // namespace sf
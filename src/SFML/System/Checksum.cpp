@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Checksum.hpp>
+
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SFML_CHECKSUM_SSE42
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SFML_CHECKSUM_TARGET_SSE42
+#else
+#include <cpuid.h>
+#define SFML_CHECKSUM_TARGET_SSE42 __attribute__((target("sse4.2")))
+#endif
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#define SFML_CHECKSUM_ARM_CRC32
+#include <arm_acle.h>
+#endif
+
+
+namespace
+{
+namespace ChecksumImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint32_t readLittleEndian32(const std::uint8_t* bytes)
+{
+    // Compilers turn this into a single load on little endian processors
+    return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8) |
+           (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t readLittleEndian64(const std::uint8_t* bytes)
+{
+    return static_cast<std::uint64_t>(readLittleEndian32(bytes)) |
+           (static_cast<std::uint64_t>(readLittleEndian32(bytes + 4)) << 32);
+}
+
+
+////////////////////////////////////////////////////////////
+// CRC-32C
+////////////////////////////////////////////////////////////
+// Reversed Castagnoli polynomial
+constexpr std::uint32_t crcPolynomial = 0x82F63B78;
+
+// Tables of the "slicing-by-8" algorithm: table[k][byte] is the CRC of byte followed by k zero bytes
+using CrcTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+constexpr CrcTables makeCrcTables()
+{
+    CrcTables tables{};
+    for (std::uint32_t i = 0; i < 256; ++i)
+    {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ ((crc & 1) != 0 ? crcPolynomial : 0);
+        tables[0][i] = crc;
+    }
+
+    for (std::size_t k = 1; k < tables.size(); ++k)
+    {
+        for (std::size_t i = 0; i < 256; ++i)
+            tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+    }
+
+    return tables;
+}
+
+constexpr CrcTables crcTables = makeCrcTables();
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint32_t crc32cSoftware(std::uint32_t crc, const std::uint8_t* bytes, std::size_t size)
+{
+    for (; size >= 8; size -= 8, bytes += 8)
+    {
+        const std::uint32_t low  = readLittleEndian32(bytes) ^ crc;
+        const std::uint32_t high = readLittleEndian32(bytes + 4);
+        crc = crcTables[7][low & 0xFF] ^ crcTables[6][(low >> 8) & 0xFF] ^ crcTables[5][(low >> 16) & 0xFF] ^
+              crcTables[4][low >> 24] ^ crcTables[3][high & 0xFF] ^ crcTables[2][(high >> 8) & 0xFF] ^
+              crcTables[1][(high >> 16) & 0xFF] ^ crcTables[0][high >> 24];
+    }
+
+    for (; size > 0; --size, ++bytes)
+        crc = (crc >> 8) ^ crcTables[0][(crc ^ *bytes) & 0xFF];
+
+    return crc;
+}
+
+
+#if defined(SFML_CHECKSUM_SSE42)
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCrcInstructionSupported()
+{
+    unsigned int registers[4]{};
+#if defined(_MSC_VER)
+    __cpuid(reinterpret_cast<int*>(registers), 1);
+#else
+    if (!__get_cpuid(1, &registers[0], &registers[1], &registers[2], &registers[3]))
+        return false;
+#endif
+    return (registers[2] & (1u << 20)) != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_CHECKSUM_TARGET_SSE42 std::uint32_t crc32cHardware(std::uint32_t crc, const std::uint8_t* bytes, std::size_t size)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    std::uint64_t crc64 = crc;
+    for (; size >= 8; size -= 8, bytes += 8)
+        crc64 = _mm_crc32_u64(crc64, readLittleEndian64(bytes));
+    crc = static_cast<std::uint32_t>(crc64);
+#else
+    for (; size >= 4; size -= 4, bytes += 4)
+        crc = _mm_crc32_u32(crc, readLittleEndian32(bytes));
+#endif
+
+    for (; size > 0; --size, ++bytes)
+        crc = _mm_crc32_u8(crc, *bytes);
+
+    return crc;
+}
+
+#elif defined(SFML_CHECKSUM_ARM_CRC32)
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCrcInstructionSupported()
+{
+    // The compiler was told that the CRC extension is available on every target processor
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint32_t crc32cHardware(std::uint32_t crc, const std::uint8_t* bytes, std::size_t size)
+{
+    for (; size >= 8; size -= 8, bytes += 8)
+        crc = __crc32cd(crc, readLittleEndian64(bytes));
+
+    for (; size > 0; --size, ++bytes)
+        crc = __crc32cb(crc, *bytes);
+
+    return crc;
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
+// XXH64
+////////////////////////////////////////////////////////////
+constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87u;
+constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Fu;
+constexpr std::uint64_t prime3 = 0x165667B19E3779F9u;
+constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63u;
+constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5u;
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr std::uint64_t rotateLeft(std::uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr std::uint64_t accumulate(std::uint64_t accumulator, std::uint64_t input)
+{
+    return rotateLeft(accumulator + input * prime2, 31) * prime1;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr std::uint64_t mergeRound(std::uint64_t hash, std::uint64_t accumulator)
+{
+    return (hash ^ accumulate(0, accumulator)) * prime1 + prime4;
+}
+} // namespace ChecksumImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::uint32_t crc32c(const void* data, std::size_t size, std::uint32_t crc)
+{
+    const auto* const bytes = static_cast<const std::uint8_t*>(data);
+    crc                     = ~crc;
+
+#if defined(SFML_CHECKSUM_SSE42) || defined(SFML_CHECKSUM_ARM_CRC32)
+    static const bool useCrcInstruction = ChecksumImpl::isCrcInstructionSupported();
+    if (useCrcInstruction)
+        return ~ChecksumImpl::crc32cHardware(crc, bytes, size);
+#endif
+
+    return ~ChecksumImpl::crc32cSoftware(crc, bytes, size);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t hash64(const void* data, std::size_t size, std::uint64_t seed)
+{
+    using namespace ChecksumImpl;
+
+    const auto*       bytes = static_cast<const std::uint8_t*>(data);
+    const auto* const end   = bytes + size;
+    std::uint64_t     hash  = 0;
+
+    if (size >= 32)
+    {
+        // Four independent accumulators, so that the processor can work on them in parallel
+        std::uint64_t accumulators[4] = {seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+        for (; end - bytes >= 32; bytes += 32)
+        {
+            for (int i = 0; i < 4; ++i)
+                accumulators[i] = accumulate(accumulators[i], readLittleEndian64(bytes + 8 * i));
+        }
+
+        hash = rotateLeft(accumulators[0], 1) + rotateLeft(accumulators[1], 7) + rotateLeft(accumulators[2], 12) +
+               rotateLeft(accumulators[3], 18);
+        for (const std::uint64_t accumulator : accumulators)
+            hash = mergeRound(hash, accumulator);
+    }
+    else
+    {
+        hash = seed + prime5;
+    }
+
+    hash += size;
+
+    for (; end - bytes >= 8; bytes += 8)
+        hash = rotateLeft(hash ^ accumulate(0, readLittleEndian64(bytes)), 27) * prime1 + prime4;
+
+    if (end - bytes >= 4)
+    {
+        hash = rotateLeft(hash ^ (readLittleEndian32(bytes) * prime1), 23) * prime2 + prime3;
+        bytes += 4;
+    }
+
+    for (; bytes != end; ++bytes)
+        hash = rotateLeft(hash ^ (*bytes * prime5), 11) * prime1;
+
+    // Final mix, so that every bit of the input affects every bit of the hash
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace sf
@@ -27,72 +27,119 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Err.hpp>
 
-#include <iostream>
+#include <array>
+#include <atomic>
+#include <ostream>
 #include <streambuf>
+#include <string>
 
 #include <cstdio>
 
 
 namespace
 {
-// This class will be used as the default streambuf of sf::Err,
-// it outputs to stderr by default (to keep the default behavior)
-class DefaultErrStreamBuf : public std::streambuf
+// The sink is read by every message, from any thread
+std::atomic<sf::LogSink*> currentSink{};
+
+
+////////////////////////////////////////////////////////////
+// Hand a complete message over to the sink, or print it to stderr (to keep the default behavior)
+void dispatch(sf::LogSeverity severity, std::string_view message)
+{
+    if (message.empty())
+        return;
+
+    if (sf::LogSink* sink = currentSink.load(std::memory_order_acquire))
+    {
+        if (message.back() == '\n')
+            message.remove_suffix(1);
+
+        sink->write(severity, message);
+    }
+    else
+    {
+        std::fwrite(message.data(), 1, message.size(), stderr);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Messages being written by a thread, one per severity
+struct PendingMessages
+{
+    ~PendingMessages();
+
+    std::array<std::string, 3> messages;
+};
+
+// The flag is trivially destructible, so it can still be read once the messages of the thread are destroyed,
+// which happens before static objects are destroyed (and may still write to sf::err)
+thread_local PendingMessages pendingMessages;
+thread_local bool            pendingMessagesDestroyed{};
+
+
+////////////////////////////////////////////////////////////
+PendingMessages::~PendingMessages()
+{
+    for (std::size_t i = 0; i < messages.size(); ++i)
+        dispatch(static_cast<sf::LogSeverity>(i), messages[i]);
+
+    pendingMessagesDestroyed = true;
+}
+
+
+////////////////////////////////////////////////////////////
+// This class will be used as the streambuf of sf::err, it gathers
+// each message in a buffer of the calling thread until it is flushed
+class ErrStreamBuf : public std::streambuf
 {
 public:
-    DefaultErrStreamBuf()
+    explicit ErrStreamBuf(sf::LogSeverity severity) : m_severity(severity)
     {
-        // Allocate the write buffer
-        constexpr int size   = 64;
-        char*         buffer = new char[size];
-        setp(buffer, buffer + size);
     }
 
-    ~DefaultErrStreamBuf() override
+private:
+    std::string* getMessage() const
     {
-        // Synchronize
-        sync();
+        if (pendingMessagesDestroyed)
+            return nullptr;
 
-        // Delete the write buffer
-        delete[] pbase();
+        return &pendingMessages.messages[static_cast<std::size_t>(m_severity)];
     }
 
-private:
     int overflow(int character) override
     {
-        if ((character != EOF) && (pptr() != epptr()))
-        {
-            // Valid character
-            return sputc(static_cast<char>(character));
-        }
-        else if (character != EOF)
-        {
-            // Not enough space in the buffer: synchronize output and try again
-            sync();
-            return overflow(character);
-        }
-        else
-        {
-            // Invalid character: synchronize output
+        if (character == EOF)
             return sync();
-        }
+
+        const char value = static_cast<char>(character);
+        xsputn(&value, 1);
+        return character;
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize count) override
+    {
+        // Without a buffer (at thread exit), every piece is written right away
+        if (std::string* message = getMessage())
+            message->append(data, static_cast<std::size_t>(count));
+        else
+            dispatch(m_severity, std::string_view(data, static_cast<std::size_t>(count)));
+
+        return count;
     }
 
     int sync() override
     {
-        // Check if there is something into the write buffer
-        if (pbase() != pptr())
+        if (std::string* message = getMessage())
         {
-            // Print the contents of the write buffer into the standard error output
-            const auto size = static_cast<std::size_t>(pptr() - pbase());
-            std::fwrite(pbase(), 1, size, stderr);
-
-            // Reset the pointer position to the beginning of the write buffer
-            setp(pbase(), epptr());
+            dispatch(m_severity, *message);
+            message->clear();
         }
 
         return 0;
     }
+
+    sf::LogSeverity m_severity;
 };
 } // namespace
 
@@ -101,11 +148,35 @@ namespace sf
 ////////////////////////////////////////////////////////////
 std::ostream& err()
 {
-    static DefaultErrStreamBuf buffer;
-    static std::ostream        stream(&buffer);
+    return err(LogSeverity::Error);
+}
+
+
+////////////////////////////////////////////////////////////
+std::ostream& err(LogSeverity severity)
+{
+    static std::array<ErrStreamBuf, 3> buffers{ErrStreamBuf(LogSeverity::Info),
+                                               ErrStreamBuf(LogSeverity::Warning),
+                                               ErrStreamBuf(LogSeverity::Error)};
+    static std::array<std::ostream, 3> streams{std::ostream(&buffers[0]),
+                                               std::ostream(&buffers[1]),
+                                               std::ostream(&buffers[2])};
+
+    return streams[static_cast<std::size_t>(severity)];
+}
 
-    return stream;
+
+////////////////////////////////////////////////////////////
+void setLogSink(LogSink* sink)
+{
+    currentSink.store(sink, std::memory_order_release);
 }
 
 
+////////////////////////////////////////////////////////////
+LogSink* getLogSink()
+{
+    return currentSink.load(std::memory_order_acquire);
+}
+
 } // namespace sf
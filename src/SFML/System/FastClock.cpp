@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/FastClock.hpp>
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SFML_FAST_CLOCK_TSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define SFML_FAST_CLOCK_CNTVCT
+#endif
+
+
+namespace
+{
+namespace FastClockImpl
+{
+// Time spent measuring the frequency of the time stamp counter
+constexpr std::chrono::milliseconds calibrationTime(2);
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::int64_t systemNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(sf::priv::ClockImpl::now().time_since_epoch()).count();
+}
+
+
+#if defined(SFML_FAST_CLOCK_TSC)
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCycleCounterSupported()
+{
+    // Without an invariant TSC, the counter rate follows frequency scaling and may stop in sleep states
+    unsigned int registers[4]{};
+#if defined(_MSC_VER)
+    __cpuid(reinterpret_cast<int*>(registers), static_cast<int>(0x80000000));
+    if (registers[0] < 0x80000007)
+        return false;
+    __cpuid(reinterpret_cast<int*>(registers), static_cast<int>(0x80000007));
+#else
+    if (!__get_cpuid(0x80000007, &registers[0], &registers[1], &registers[2], &registers[3]))
+        return false;
+#endif
+    return (registers[3] & (1u << 8)) != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t readCycleCounter()
+{
+    return __rdtsc();
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] double getCycleCounterFrequency(std::uint64_t& ticks, std::int64_t& nanoseconds)
+{
+    // The TSC frequency isn't exposed portably, measure it against the system clock
+    const std::int64_t  startTime  = systemNow();
+    const std::uint64_t startTicks = readCycleCounter();
+    do
+    {
+        nanoseconds = systemNow();
+        ticks       = readCycleCounter();
+    } while (nanoseconds - startTime < std::chrono::nanoseconds(calibrationTime).count());
+
+    return static_cast<double>(ticks - startTicks) * 1e9 / static_cast<double>(nanoseconds - startTime);
+}
+
+#elif defined(SFML_FAST_CLOCK_CNTVCT)
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCycleCounterSupported()
+{
+    // The generic timer of ARMv8 always runs at a constant rate
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t readCycleCounter()
+{
+    std::uint64_t ticks = 0;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] double getCycleCounterFrequency(std::uint64_t& ticks, std::int64_t& nanoseconds)
+{
+    std::uint64_t frequency = 0;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+    nanoseconds = systemNow();
+    ticks       = readCycleCounter();
+    return static_cast<double>(frequency);
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
+struct Calibration
+{
+    Calibration()
+    {
+#if defined(SFML_FAST_CLOCK_TSC) || defined(SFML_FAST_CLOCK_CNTVCT)
+        if (!isCycleCounterSupported())
+            return;
+
+        const double frequency = getCycleCounterFrequency(originTicks, originNanoseconds);
+        if (frequency < 1e6)
+            return;
+
+        // Nanoseconds per tick, as an integer part and a 32-bit fraction so that the conversion can't overflow
+        const double nanosecondsPerTick = 1e9 / frequency;
+        wholeMultiplier                 = static_cast<std::uint64_t>(nanosecondsPerTick);
+        fractionMultiplier              = static_cast<std::uint64_t>(
+            (nanosecondsPerTick - static_cast<double>(wholeMultiplier)) * 4294967296.0);
+        useCycleCounter = true;
+#endif
+    }
+
+    [[nodiscard]] std::int64_t now() const
+    {
+#if defined(SFML_FAST_CLOCK_TSC) || defined(SFML_FAST_CLOCK_CNTVCT)
+        if (useCycleCounter)
+        {
+            const std::uint64_t ticks = readCycleCounter() - originTicks;
+            const std::uint64_t high  = ticks >> 32;
+            const std::uint64_t low   = ticks & 0xFFFFFFFFu;
+            return originNanoseconds + static_cast<std::int64_t>(ticks * wholeMultiplier + high * fractionMultiplier +
+                                                                 ((low * fractionMultiplier) >> 32));
+        }
+#endif
+        return systemNow();
+    }
+
+    bool          useCycleCounter{};    //!< Is the cycle counter usable?
+    std::uint64_t originTicks{};        //!< Counter value at calibration time
+    std::int64_t  originNanoseconds{};  //!< System time at calibration time, in nanoseconds
+    std::uint64_t wholeMultiplier{};    //!< Integer part of the number of nanoseconds per tick
+    std::uint64_t fractionMultiplier{}; //!< Fractional part of the number of nanoseconds per tick, in 1/2^32
+};
+
+
+////////////////////////////////////////////////////////////
+const Calibration& getCalibration()
+{
+    static const Calibration calibration;
+    return calibration;
+}
+} // namespace FastClockImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FastClock::time_point FastClock::now() noexcept
+{
+    return time_point(duration(FastClockImpl::getCalibration().now()));
+}
+
+
+////////////////////////////////////////////////////////////
+bool FastClock::isCycleCounterUsed()
+{
+    return FastClockImpl::getCalibration().useCycleCounter;
+}
+
+} // namespace sf
@@ -26,6 +26,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/FileInputStream.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/AsyncFileImpl.hpp>
+#else
+#include <SFML/System/Unix/AsyncFileImpl.hpp>
+#endif
+
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/Activity.hpp>
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -69,6 +76,7 @@ bool FileInputStream::open(const std::filesystem::path& filename)
         return m_androidFile->tell() != -1;
     }
 #endif
+    m_asyncFile.reset();
 #ifdef SFML_SYSTEM_WINDOWS
     m_file.reset(_wfopen(filename.c_str(), L"rb"));
 #else
@@ -155,4 +163,30 @@ std::int64_t FileInputStream::getSize()
     return size;
 }
 
+
+////////////////////////////////////////////////////////////
+std::future<std::int64_t> FileInputStream::readAsync(std::int64_t position, void* data, std::int64_t size)
+{
+#ifdef SFML_SYSTEM_ANDROID
+    // Assets are read synchronously
+    if (priv::getActivityStatesPtr() != nullptr)
+        return InputStream::readAsync(position, data, size);
+#endif
+    if (!m_file || (position < 0) || (size < 0))
+    {
+        std::promise<std::int64_t> promise;
+        promise.set_value(-1);
+        return promise.get_future();
+    }
+
+    if (!m_asyncFile)
+        m_asyncFile = priv::AsyncFileImpl::open(m_file.get());
+
+    // Systems without support for background reads fall back to synchronous ones
+    if (!m_asyncFile)
+        return InputStream::readAsync(position, data, size);
+
+    return m_asyncFile->read(position, data, static_cast<std::size_t>(size));
+}
+
 } // namespace sf
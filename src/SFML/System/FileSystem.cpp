@@ -0,0 +1,571 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FileSystem.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/Lz4.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/Utils.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#else
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <tuple>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+////////////////////////////////////////////////////////////
+// Layout of an archive, all integers are little-endian:
+//
+// Header (16 bytes)
+//     char[4] magic, "SFPK"
+//     uint32  version, 1
+//     uint32  number of entries
+//     uint32  reserved, 0
+//
+// Directory (40 bytes per entry, sorted by hash)
+//     uint64  FNV-1a hash of the name
+//     uint64  offset of the contents, from the beginning of the archive
+//     uint64  size of the stored contents
+//     uint64  size of the contents once decompressed
+//     uint32  offset of the name, from the beginning of the archive
+//     uint16  size of the name
+//     uint16  flags (1: compressed with LZ4, 2: prefetched)
+//
+// Names, then contents, each aligned on 16 bytes
+////////////////////////////////////////////////////////////
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FileSystemImpl
+{
+constexpr char          magic[4]      = {'S', 'F', 'P', 'K'};
+constexpr std::uint32_t version       = 1;
+constexpr std::size_t   headerSize    = 16;
+constexpr std::size_t   entrySize     = 40;
+constexpr std::size_t   dataAlignment = 16;
+
+constexpr std::uint16_t compressedFlag = 1;
+constexpr std::uint16_t prefetchFlag   = 2;
+
+std::uint64_t hashName(std::string_view name)
+{
+    std::uint64_t hash = 14695981039346656037u;
+    for (const char c : name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211u;
+    }
+    return hash;
+}
+
+template <typename T>
+T readInteger(const std::byte* data)
+{
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<T>(static_cast<T>(data[i]) << (8 * i));
+    return value;
+}
+
+template <typename T>
+void writeInteger(std::vector<std::byte>& buffer, std::size_t position, T value)
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        buffer[position + i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+}
+
+std::size_t align(std::size_t size)
+{
+    return (size + dataAlignment - 1) / dataAlignment * dataAlignment;
+}
+
+// Remove the empty and "." components of a virtual path, reject ".." components
+std::optional<std::string> normalizePath(std::string_view path)
+{
+    std::string normalized;
+    while (!path.empty())
+    {
+        const std::size_t      separator = path.find('/');
+        const std::string_view component = path.substr(0, separator);
+        path.remove_prefix(separator == std::string_view::npos ? path.size() : separator + 1);
+
+        if (component.empty() || (component == "."))
+            continue;
+        if (component == "..")
+            return std::nullopt;
+
+        if (!normalized.empty())
+            normalized += '/';
+        normalized += component;
+    }
+    return normalized;
+}
+
+// Get the path of a file relative to a mount point, if the file is below it
+std::optional<std::string_view> getRelativePath(std::string_view path, std::string_view mountPoint)
+{
+    if (mountPoint.empty())
+        return path;
+
+    if ((path.size() <= mountPoint.size()) || (path.compare(0, mountPoint.size(), mountPoint) != 0) ||
+        (path[mountPoint.size()] != '/'))
+        return std::nullopt;
+
+    return path.substr(mountPoint.size() + 1);
+}
+} // namespace FileSystemImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Packed archive mapped into memory
+///
+////////////////////////////////////////////////////////////
+class Archive
+{
+public:
+    struct Entry
+    {
+        std::uint64_t    hash{};       //!< Hash of the name
+        std::string_view name;         //!< Name of the entry, pointing into the mapping
+        const std::byte* data{};       //!< Stored contents, pointing into the mapping
+        std::size_t      storedSize{}; //!< Size of the stored contents
+        std::size_t      size{};       //!< Size of the decompressed contents
+        std::uint16_t    flags{};      //!< Compressed, prefetched
+    };
+
+    [[nodiscard]] bool open(const std::filesystem::path& filename)
+    {
+        using namespace FileSystemImpl;
+
+        if (!m_file.open(filename))
+        {
+            err() << "Failed to mount archive\n"
+                  << formatDebugPathInfo(filename) << "\nReason: Unable to open file" << std::endl;
+            return false;
+        }
+
+        if (!readDirectory())
+        {
+            err() << "Failed to mount archive\n"
+                  << formatDebugPathInfo(filename) << "\nReason: Invalid or truncated archive" << std::endl;
+            return false;
+        }
+
+        // Ask the system to read the entries that will be needed soon
+        for (const Entry& entry : m_entries)
+        {
+            if (entry.flags & prefetchFlag)
+                prefetchFileImpl(entry.data, entry.storedSize);
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] const Entry* find(std::string_view name) const
+    {
+        using namespace FileSystemImpl;
+
+        const std::uint64_t hash    = hashName(name);
+        const auto          compare = [](const Entry& left, std::uint64_t right) { return left.hash < right; };
+
+        for (auto entry = std::lower_bound(m_entries.begin(), m_entries.end(), hash, compare);
+             (entry != m_entries.end()) && (entry->hash == hash);
+             ++entry)
+        {
+            if (entry->name == name)
+                return &*entry;
+        }
+
+        return nullptr;
+    }
+
+private:
+    [[nodiscard]] bool readDirectory()
+    {
+        using namespace FileSystemImpl;
+
+        const auto* const data = static_cast<const std::byte*>(m_file.getData());
+        const auto        size = static_cast<std::size_t>(m_file.getSize());
+
+        if ((size < headerSize) || (std::memcmp(data, magic, sizeof(magic)) != 0) ||
+            (readInteger<std::uint32_t>(data + 4) != version))
+            return false;
+
+        const std::size_t count = readInteger<std::uint32_t>(data + 8);
+        if (count > (size - headerSize) / entrySize)
+            return false;
+
+        m_entries.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::byte* const record     = data + headerSize + i * entrySize;
+            const auto             offset     = readInteger<std::uint64_t>(record + 8);
+            const auto             stored     = readInteger<std::uint64_t>(record + 16);
+            const auto             nameOffset = readInteger<std::uint32_t>(record + 32);
+            const auto             nameLength = readInteger<std::uint16_t>(record + 36);
+
+            // Everything must lie inside the archive
+            if ((offset > size) || (stored > size - offset) || (nameOffset > size) || (nameLength > size - nameOffset))
+                return false;
+
+            Entry& entry     = m_entries[i];
+            entry.hash       = readInteger<std::uint64_t>(record);
+            entry.name       = {reinterpret_cast<const char*>(data + nameOffset), nameLength};
+            entry.data       = data + offset;
+            entry.storedSize = static_cast<std::size_t>(stored);
+            entry.size       = static_cast<std::size_t>(readInteger<std::uint64_t>(record + 24));
+            entry.flags      = readInteger<std::uint16_t>(record + 38);
+
+            if ((entry.hash != hashName(entry.name)) || ((i > 0) && (entry.hash < m_entries[i - 1].hash)))
+                return false;
+
+            // LZ4 can't expand data more than 255 times
+            const bool compressed = (entry.flags & compressedFlag) != 0;
+            if (compressed ? (entry.size / 255 > entry.storedSize) : (entry.size != entry.storedSize))
+                return false;
+        }
+
+        return true;
+    }
+
+    MappedFileInputStream m_file;    //!< Mapping of the archive
+    std::vector<Entry>    m_entries; //!< Directory of the archive, sorted by hash
+};
+
+} // namespace sf::priv
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FileSystemImpl
+{
+// Stream over an entry of an archive, which keeps the archive mapped
+class ArchiveStream : public sf::MemoryInputStream
+{
+public:
+    ArchiveStream(std::shared_ptr<const sf::priv::Archive> archive, std::vector<std::byte> decompressed) :
+    m_archive(std::move(archive)),
+    m_decompressed(std::move(decompressed))
+    {
+    }
+
+private:
+    std::shared_ptr<const sf::priv::Archive> m_archive;
+    std::vector<std::byte>                   m_decompressed;
+};
+} // namespace FileSystemImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+bool FileSystem::createArchive(const std::filesystem::path& filename, const std::vector<ArchiveEntry>& entries)
+{
+    using namespace FileSystemImpl;
+
+    struct Contents
+    {
+        std::string            name;
+        std::uint64_t          hash{};
+        std::vector<std::byte> data;
+        std::size_t            size{};
+        std::uint16_t          flags{};
+    };
+
+    const auto fail = [&filename](const std::string& reason)
+    {
+        err() << "Failed to create archive\n" << formatDebugPathInfo(filename) << "\nReason: " << reason << std::endl;
+        return false;
+    };
+
+    // Read and compress the files
+    std::vector<Contents> contents;
+    contents.reserve(entries.size());
+    for (const ArchiveEntry& entry : entries)
+    {
+        const std::optional<std::string> name = normalizePath(entry.name);
+        if (!name || name->empty() || (name->size() > 0xFFFF))
+            return fail("Invalid entry name \"" + entry.name + '"');
+
+        MappedFileInputStream source;
+        if (!source.open(entry.source))
+            return fail("Unable to open " + entry.source.string());
+
+        Contents& file = contents.emplace_back();
+        file.name      = *name;
+        file.hash      = hashName(file.name);
+        file.size      = static_cast<std::size_t>(source.getSize());
+        file.flags     = entry.prefetch ? prefetchFlag : 0;
+
+        const auto* const data = static_cast<const std::byte*>(source.getData());
+        if (entry.compress && (file.size > 0))
+        {
+            file.data.resize(priv::lz4CompressBound(file.size));
+            file.data.resize(priv::lz4Compress(data, file.size, file.data.data()));
+            file.flags |= compressedFlag;
+        }
+
+        // Store the contents as they are if they don't compress
+        if (!(file.flags & compressedFlag) || (file.data.size() >= file.size))
+        {
+            file.data.assign(data, data + file.size);
+            file.flags &= static_cast<std::uint16_t>(~compressedFlag);
+        }
+    }
+
+    std::sort(contents.begin(),
+              contents.end(),
+              [](const Contents& left, const Contents& right)
+              { return std::tie(left.hash, left.name) < std::tie(right.hash, right.name); });
+
+    const auto duplicate = std::adjacent_find(contents.begin(),
+                                              contents.end(),
+                                              [](const Contents& left, const Contents& right)
+                                              { return left.name == right.name; });
+    if (duplicate != contents.end())
+        return fail("Duplicate entry name \"" + duplicate->name + '"');
+
+    // Lay out the archive
+    std::size_t namesSize = 0;
+    for (const Contents& file : contents)
+        namesSize += file.name.size();
+
+    const std::size_t namesOffset = headerSize + contents.size() * entrySize;
+    std::size_t       archiveSize = align(namesOffset + namesSize);
+    for (const Contents& file : contents)
+        archiveSize = align(archiveSize + file.data.size());
+    if (namesOffset + namesSize > 0xFFFFFFFF)
+        return fail("Too many entries");
+
+    std::vector<std::byte> archive(archiveSize);
+    std::transform(std::begin(magic),
+                   std::end(magic),
+                   archive.begin(),
+                   [](char c) { return static_cast<std::byte>(c); });
+    writeInteger(archive, 4, version);
+    writeInteger(archive, 8, static_cast<std::uint32_t>(contents.size()));
+
+    std::size_t nameOffset = namesOffset;
+    std::size_t dataOffset = align(namesOffset + namesSize);
+    for (std::size_t i = 0; i < contents.size(); ++i)
+    {
+        const Contents&   file   = contents[i];
+        const std::size_t record = headerSize + i * entrySize;
+        writeInteger(archive, record, file.hash);
+        writeInteger(archive, record + 8, static_cast<std::uint64_t>(dataOffset));
+        writeInteger(archive, record + 16, static_cast<std::uint64_t>(file.data.size()));
+        writeInteger(archive, record + 24, static_cast<std::uint64_t>(file.size));
+        writeInteger(archive, record + 32, static_cast<std::uint32_t>(nameOffset));
+        writeInteger(archive, record + 36, static_cast<std::uint16_t>(file.name.size()));
+        writeInteger(archive, record + 38, file.flags);
+
+        std::memcpy(archive.data() + nameOffset, file.name.data(), file.name.size());
+        std::copy(file.data.begin(), file.data.end(), archive.begin() + static_cast<std::ptrdiff_t>(dataOffset));
+        nameOffset += file.name.size();
+        dataOffset = align(dataOffset + file.data.size());
+    }
+
+    std::ofstream output(filename, std::ios::binary);
+    if (!output.write(reinterpret_cast<const char*>(archive.data()), static_cast<std::streamsize>(archive.size())))
+        return fail("Unable to write file");
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FileSystem::mountDirectory(const std::filesystem::path& directory, std::string_view mountPoint)
+{
+    using namespace FileSystemImpl;
+
+    const std::optional<std::string> normalizedMountPoint = normalizePath(mountPoint);
+    if (!normalizedMountPoint)
+    {
+        err() << "Failed to mount directory (invalid mount point \"" << mountPoint << "\")\n"
+              << formatDebugPathInfo(directory) << std::endl;
+        return false;
+    }
+
+#ifndef SFML_SYSTEM_ANDROID
+    // Assets of Android applications aren't seen by std::filesystem
+    if (!std::filesystem::is_directory(directory))
+    {
+        err() << "Failed to mount directory\n"
+              << formatDebugPathInfo(directory) << "\nReason: Not a directory" << std::endl;
+        return false;
+    }
+#endif
+
+    m_mounts.push_back({*normalizedMountPoint, directory, nullptr});
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FileSystem::mountArchive(const std::filesystem::path& filename, std::string_view mountPoint)
+{
+    using namespace FileSystemImpl;
+
+    const std::optional<std::string> normalizedMountPoint = normalizePath(mountPoint);
+    if (!normalizedMountPoint)
+    {
+        err() << "Failed to mount archive (invalid mount point \"" << mountPoint << "\")\n"
+              << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    auto archive = std::make_shared<priv::Archive>();
+    if (!archive->open(filename))
+        return false;
+
+    m_mounts.push_back({*normalizedMountPoint, {}, std::move(archive)});
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FileSystem::unmount(std::string_view mountPoint)
+{
+    using namespace FileSystemImpl;
+
+    const std::optional<std::string> normalizedMountPoint = normalizePath(mountPoint);
+    if (!normalizedMountPoint)
+        return;
+
+    m_mounts.erase(std::remove_if(m_mounts.begin(),
+                                  m_mounts.end(),
+                                  [&](const Mount& mount) { return mount.mountPoint == *normalizedMountPoint; }),
+                   m_mounts.end());
+}
+
+
+////////////////////////////////////////////////////////////
+bool FileSystem::exists(std::string_view path) const
+{
+    using namespace FileSystemImpl;
+
+    const std::optional<std::string> normalizedPath = normalizePath(path);
+    if (!normalizedPath)
+        return false;
+
+    for (auto mount = m_mounts.rbegin(); mount != m_mounts.rend(); ++mount)
+    {
+        const std::optional<std::string_view> relativePath = getRelativePath(*normalizedPath, mount->mountPoint);
+        if (!relativePath)
+            continue;
+
+        if (mount->archive ? (mount->archive->find(*relativePath) != nullptr)
+                           : std::filesystem::is_regular_file(mount->directory / *relativePath))
+            return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::unique_ptr<InputStream> FileSystem::open(std::string_view path) const
+{
+    using namespace FileSystemImpl;
+
+    const std::optional<std::string> normalizedPath = normalizePath(path);
+    if (!normalizedPath)
+    {
+        err() << "Failed to open file from file system (invalid path \"" << path << "\")" << std::endl;
+        return nullptr;
+    }
+
+    for (auto mount = m_mounts.rbegin(); mount != m_mounts.rend(); ++mount)
+    {
+        const std::optional<std::string_view> relativePath = getRelativePath(*normalizedPath, mount->mountPoint);
+        if (!relativePath)
+            continue;
+
+        if (!mount->archive)
+        {
+#ifdef SFML_SYSTEM_ANDROID
+            // Loose files may be assets of the application, which only FileInputStream can read
+            auto file = std::make_unique<FileInputStream>();
+#else
+            auto file = std::make_unique<MappedFileInputStream>();
+#endif
+            if (file->open(mount->directory / *relativePath))
+                return file;
+            continue;
+        }
+
+        const priv::Archive::Entry* entry = mount->archive->find(*relativePath);
+        if (!entry)
+            continue;
+
+        if (!(entry->flags & compressedFlag))
+        {
+            auto stream = std::make_unique<ArchiveStream>(mount->archive, std::vector<std::byte>());
+            stream->open(entry->data, entry->size);
+            return stream;
+        }
+
+        std::vector<std::byte> decompressed(entry->size);
+        if (!priv::lz4Decompress(entry->data, entry->storedSize, decompressed.data(), decompressed.size()))
+        {
+            err() << "Failed to open file from file system (corrupted archive entry \"" << path << "\")" << std::endl;
+            return nullptr;
+        }
+
+        // The buffer of a vector doesn't move with it
+        const std::byte* data   = decompressed.data();
+        auto             stream = std::make_unique<ArchiveStream>(mount->archive, std::move(decompressed));
+        stream->open(data, entry->size);
+        return stream;
+    }
+
+    err() << "Failed to open file from file system (no file named \"" << path << "\")" << std::endl;
+    return nullptr;
+}
+
+} // namespace sf
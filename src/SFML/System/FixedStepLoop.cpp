@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FixedStepLoop.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FixedStepLoop::FixedStepLoop(Time step, unsigned int maxStepsPerFrame) :
+m_lastTime(std::chrono::steady_clock::now())
+{
+    setStep(step);
+    setMaxStepsPerFrame(maxStepsPerFrame);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int FixedStepLoop::advance()
+{
+    // Only account for whole microseconds, and move the time point by exactly
+    // what was accounted so that the truncated remainder is counted next time
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                               m_lastTime);
+    m_lastTime += elapsed;
+
+    const unsigned int steps = advance(microseconds(elapsed.count()));
+    m_manual                 = false;
+    return steps;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int FixedStepLoop::advance(Time elapsed)
+{
+    m_manual = true;
+
+    if (elapsed > Time::Zero)
+        m_accumulator += elapsed;
+
+    const std::int64_t stepLength = m_step.asMicroseconds();
+    std::int64_t       steps      = m_accumulator.asMicroseconds() / stepLength;
+
+    // Drop what can't be caught up with this frame
+    if (steps > m_maxStepsPerFrame)
+    {
+        const Time dropped = microseconds((steps - m_maxStepsPerFrame) * stepLength);
+        m_droppedTime += dropped;
+        m_accumulator -= dropped;
+        steps = m_maxStepsPerFrame;
+    }
+
+    const Time simulated = microseconds(steps * stepLength);
+    m_accumulator -= simulated;
+    m_simulationTime += simulated;
+    m_stepCount += static_cast<std::uint64_t>(steps);
+
+    return static_cast<unsigned int>(steps);
+}
+
+
+////////////////////////////////////////////////////////////
+float FixedStepLoop::getAlpha() const
+{
+    return static_cast<float>(static_cast<double>(m_accumulator.asMicroseconds()) /
+                              static_cast<double>(m_step.asMicroseconds()));
+}
+
+
+////////////////////////////////////////////////////////////
+void FixedStepLoop::waitForNextStep() const
+{
+    if (m_manual)
+        return;
+
+    sleepUntil(m_lastTime + (m_step - m_accumulator).toDuration());
+}
+
+
+////////////////////////////////////////////////////////////
+void FixedStepLoop::reset()
+{
+    m_accumulator = Time::Zero;
+    m_lastTime    = std::chrono::steady_clock::now();
+    m_manual      = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void FixedStepLoop::setStep(Time step)
+{
+    m_step = std::max(step, microseconds(1));
+}
+
+
+////////////////////////////////////////////////////////////
+Time FixedStepLoop::getStep() const
+{
+    return m_step;
+}
+
+
+////////////////////////////////////////////////////////////
+void FixedStepLoop::setMaxStepsPerFrame(unsigned int maxStepsPerFrame)
+{
+    m_maxStepsPerFrame = std::max(maxStepsPerFrame, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int FixedStepLoop::getMaxStepsPerFrame() const
+{
+    return m_maxStepsPerFrame;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t FixedStepLoop::getStepCount() const
+{
+    return m_stepCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FixedStepLoop::getSimulationTime() const
+{
+    return m_simulationTime;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FixedStepLoop::getDroppedTime() const
+{
+    return m_droppedTime;
+}
+
+} // namespace sf
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/InputStream.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::future<std::int64_t> InputStream::readAsync(std::int64_t position, void* data, std::int64_t size)
+{
+    std::promise<std::int64_t> promise;
+
+    // Read synchronously, then go back to the previous position
+    std::int64_t       count    = -1;
+    const std::int64_t previous = tell();
+    if ((previous != -1) && (size >= 0) && (seek(position) != -1))
+    {
+        count = read(data, size);
+        if (seek(previous) != previous)
+            count = -1;
+    }
+
+    promise.set_value(count);
+    return promise.get_future();
+}
+
+
+////////////////////////////////////////////////////////////
+const void* InputStream::getData() const
+{
+    return nullptr;
+}
+
+} // namespace sf
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <functional>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Run jobs concurrently
+///
+/// The jobs are given to the job scheduler if one is set, and
+/// run on the global thread pool otherwise, with the calling
+/// thread taking part in the work. This function returns once
+/// all of them are done.
+///
+/// \param jobCount Number of jobs
+/// \param job      Function called with the index of each job, in [0, jobCount)
+///
+/// \see sf::setJobScheduler
+///
+////////////////////////////////////////////////////////////
+SFML_SYSTEM_API void runJobs(std::size_t jobCount, const std::function<void(std::size_t)>& job);
+
+} // namespace sf::priv
@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Lz4.hpp>
+
+#include <array>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace Lz4Impl
+{
+// Rules of the LZ4 block format
+constexpr std::size_t minMatch       = 4;     // Shortest match that can be encoded
+constexpr std::size_t lastLiterals   = 5;     // The last bytes of a block are always literals
+constexpr std::size_t matchFindLimit = 12;    // The last match must start this far from the end of the block
+constexpr std::size_t maxOffset      = 65535; // Matches refer to at most this many bytes back
+
+constexpr unsigned int hashLog = 12;
+
+std::uint32_t read32(const std::byte* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::uint32_t hash(std::uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - hashLog);
+}
+
+// Write a length that didn't fit in its 4 bits of the token
+std::byte* writeLength(std::size_t length, std::byte* output)
+{
+    for (; length >= 255; length -= 255)
+        *output++ = std::byte{255};
+    *output++ = static_cast<std::byte>(length);
+    return output;
+}
+
+// Read the extra bytes of a length whose 4 bits of the token are all set
+bool readLength(const std::byte*& input, const std::byte* end, std::size_t& length)
+{
+    std::uint8_t extra = 255;
+    while (extra == 255)
+    {
+        if (input == end)
+            return false;
+        extra = static_cast<std::uint8_t>(*input++);
+        length += extra;
+    }
+    return true;
+}
+
+std::byte* writeSequence(const std::byte* literals,
+                         std::size_t      literalCount,
+                         std::size_t      offset,
+                         std::size_t      matchLength,
+                         std::byte*       output)
+{
+    std::byte* token = output++;
+    *token           = static_cast<std::byte>((literalCount < 15 ? literalCount : 15) << 4);
+    if (literalCount >= 15)
+        output = writeLength(literalCount - 15, output);
+
+    // The literals of an empty input are a null pointer, which memcpy doesn't accept even for 0 bytes
+    if (literalCount > 0)
+        std::memcpy(output, literals, literalCount);
+    output += literalCount;
+
+    // The last sequence of a block has no match
+    if (matchLength == 0)
+        return output;
+
+    *output++ = static_cast<std::byte>(offset & 0xFF);
+    *output++ = static_cast<std::byte>(offset >> 8);
+
+    const std::size_t extraLength = matchLength - minMatch;
+    *token |= static_cast<std::byte>(extraLength < 15 ? extraLength : 15);
+    if (extraLength >= 15)
+        output = writeLength(extraLength - 15, output);
+
+    return output;
+}
+} // namespace Lz4Impl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::size_t lz4CompressBound(std::size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t lz4Compress(const std::byte* input, std::size_t size, std::byte* output)
+{
+    using namespace Lz4Impl;
+
+    std::byte* const begin = output;
+
+    // Greedy parsing: each position is looked up in a table of the last positions of its first 4 bytes
+    std::array<std::uint32_t, std::size_t{1} << hashLog> table{};
+
+    std::size_t anchor = 0;
+    std::size_t pos    = 0;
+    std::size_t misses = 0;
+    while (pos + matchFindLimit < size)
+    {
+        const std::uint32_t sequence  = read32(input + pos);
+        const std::uint32_t key       = hash(sequence);
+        std::size_t         candidate = table[key];
+        table[key]                    = static_cast<std::uint32_t>(pos);
+
+        if ((candidate >= pos) || (pos - candidate > maxOffset) || (read32(input + candidate) != sequence))
+        {
+            // Skip faster through data that doesn't compress
+            pos += 1 + (misses++ >> 6);
+            continue;
+        }
+        misses = 0;
+
+        // Extend the match in both directions
+        std::size_t matchLength = minMatch;
+        while ((pos > anchor) && (candidate > 0) && (input[pos - 1] == input[candidate - 1]))
+        {
+            --pos;
+            --candidate;
+            ++matchLength;
+        }
+        const std::size_t matchLimit = size - lastLiterals;
+        while ((pos + matchLength < matchLimit) && (input[pos + matchLength] == input[candidate + matchLength]))
+            ++matchLength;
+
+        output = writeSequence(input + anchor, pos - anchor, pos - candidate, matchLength, output);
+        pos += matchLength;
+        anchor = pos;
+    }
+
+    output = writeSequence(input + anchor, size - anchor, 0, 0, output);
+    return static_cast<std::size_t>(output - begin);
+}
+
+
+////////////////////////////////////////////////////////////
+bool lz4Decompress(const std::byte* input, std::size_t size, std::byte* output, std::size_t outputSize)
+{
+    using namespace Lz4Impl;
+
+    const std::byte* const inputEnd = input + size;
+    std::size_t            written  = 0;
+
+    while (input != inputEnd)
+    {
+        const auto token = static_cast<std::uint8_t>(*input++);
+
+        // Literals
+        std::size_t literalCount = token >> 4;
+        if ((literalCount == 15) && !readLength(input, inputEnd, literalCount))
+            return false;
+        if ((literalCount > static_cast<std::size_t>(inputEnd - input)) || (literalCount > outputSize - written))
+            return false;
+
+        if (literalCount > 0)
+            std::memcpy(output + written, input, literalCount);
+        input += literalCount;
+        written += literalCount;
+
+        // The last sequence of the block ends after its literals
+        if (input == inputEnd)
+            return written == outputSize;
+
+        // Match
+        if (inputEnd - input < 2)
+            return false;
+        const std::size_t offset = static_cast<std::size_t>(input[0]) | (static_cast<std::size_t>(input[1]) << 8);
+        input += 2;
+        if ((offset == 0) || (offset > written))
+            return false;
+
+        std::size_t matchLength = token & 0x0F;
+        if ((matchLength == 15) && !readLength(input, inputEnd, matchLength))
+            return false;
+        matchLength += minMatch;
+        if (matchLength > outputSize - written)
+            return false;
+
+        // Matches may overlap the bytes they produce, in which case they must be copied in order
+        const std::byte* match = output + written - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(output + written, match, matchLength);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < matchLength; ++i)
+                output[written + i] = match[i];
+        }
+        written += matchLength;
+    }
+
+    // A block always ends with literals
+    return false;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Get the largest size of a compressed LZ4 block
+///
+/// \param size Size of the data to compress, in bytes
+///
+/// \return Size of the buffer to give to lz4Compress
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API std::size_t lz4CompressBound(std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Compress data into an LZ4 block
+///
+/// The output is a raw block, without frame header, that can
+/// be decompressed by any implementation of the LZ4 block format.
+///
+/// \param input  Data to compress
+/// \param size   Size of the data, in bytes
+/// \param output Buffer receiving the block, of at least lz4CompressBound(size) bytes
+///
+/// \return Size of the compressed block, in bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API std::size_t lz4Compress(const std::byte* input, std::size_t size, std::byte* output);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress an LZ4 block
+///
+/// Malformed blocks are detected, nothing is ever read or
+/// written out of the given buffers.
+///
+/// \param input      Compressed block
+/// \param size       Size of the block, in bytes
+/// \param output     Buffer receiving the decompressed data
+/// \param outputSize Exact size of the decompressed data, in bytes
+///
+/// \return True if the block was valid and decompressed to exactly outputSize bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API bool lz4Decompress(const std::byte* input,
+                                                std::size_t      size,
+                                                std::byte*       output,
+                                                std::size_t      outputSize);
+
+} // namespace sf::priv
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#else
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+#endif
+
+#include <utility>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MappedFileInputStream::~MappedFileInputStream()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(MappedFileInputStream&& right) noexcept :
+m_data(std::exchange(right.m_data, nullptr)),
+m_size(std::exchange(right.m_size, 0)),
+m_offset(std::exchange(right.m_offset, 0)),
+m_isOpen(std::exchange(right.m_isOpen, false))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream& MappedFileInputStream::operator=(MappedFileInputStream&& right) noexcept
+{
+    // Catch self-moving.
+    if (&right == this)
+        return *this;
+
+    close();
+
+    m_data   = std::exchange(right.m_data, nullptr);
+    m_size   = std::exchange(right.m_size, 0);
+    m_offset = std::exchange(right.m_offset, 0);
+    m_isOpen = std::exchange(right.m_isOpen, false);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFileInputStream::open(const std::filesystem::path& filename)
+{
+    close();
+
+    std::size_t size = 0;
+    if (!priv::mapFileImpl(filename, m_data, size))
+        return false;
+
+    m_size   = static_cast<std::int64_t>(size);
+    m_isOpen = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::read(void* data, std::int64_t size)
+{
+    if (!m_isOpen)
+        return -1;
+
+    const std::int64_t endPosition = m_offset + size;
+    const std::int64_t count       = endPosition <= m_size ? size : m_size - m_offset;
+
+    if (count > 0)
+    {
+        std::memcpy(data, m_data + m_offset, static_cast<std::size_t>(count));
+        m_offset += count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::seek(std::int64_t position)
+{
+    if (!m_isOpen)
+        return -1;
+
+    m_offset = position < m_size ? position : m_size;
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::tell()
+{
+    if (!m_isOpen)
+        return -1;
+
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::getSize()
+{
+    if (!m_isOpen)
+        return -1;
+
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::int64_t> MappedFileInputStream::readAsync(std::int64_t position, void* data, std::int64_t size)
+{
+    std::promise<std::int64_t> promise;
+
+    if (!m_isOpen || (position < 0) || (size < 0))
+    {
+        promise.set_value(-1);
+        return promise.get_future();
+    }
+
+    const std::int64_t start = position < m_size ? position : m_size;
+    const std::int64_t count = size < m_size - start ? size : m_size - start;
+    if (count > 0)
+        std::memcpy(data, m_data + start, static_cast<std::size_t>(count));
+
+    promise.set_value(count);
+    return promise.get_future();
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MappedFileInputStream::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFileInputStream::close()
+{
+    if (m_isOpen)
+        priv::unmapFileImpl(m_data, static_cast<std::size_t>(m_size));
+
+    m_data   = nullptr;
+    m_size   = 0;
+    m_offset = 0;
+    m_isOpen = false;
+}
+
+} // namespace sf
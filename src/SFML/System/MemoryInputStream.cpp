@@ -90,4 +90,32 @@ std::int64_t MemoryInputStream::getSize()
     return m_size;
 }
 
+
+////////////////////////////////////////////////////////////
+std::future<std::int64_t> MemoryInputStream::readAsync(std::int64_t position, void* data, std::int64_t size)
+{
+    std::promise<std::int64_t> promise;
+
+    if (!m_data || (position < 0) || (size < 0))
+    {
+        promise.set_value(-1);
+        return promise.get_future();
+    }
+
+    const std::int64_t start = position < m_size ? position : m_size;
+    const std::int64_t count = size < m_size - start ? size : m_size - start;
+    if (count > 0)
+        std::memcpy(data, m_data + start, static_cast<std::size_t>(count));
+
+    promise.set_value(count);
+    return promise.get_future();
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MemoryInputStream::getData() const
+{
+    return m_data;
+}
+
 } // namespace sf
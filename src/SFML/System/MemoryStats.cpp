@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/EnumArray.hpp>
+#include <SFML/System/MemoryStats.hpp>
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace MemoryStatsImpl
+{
+// Counters of the objects of a category
+struct Counters
+{
+    std::atomic<std::size_t>   objectCount{};
+    std::atomic<std::size_t>   peakObjectCount{};
+    std::atomic<std::uint64_t> bytes{};
+    std::atomic<std::uint64_t> peakBytes{};
+};
+
+// Constant-initialized, so that static objects can be counted safely
+sf::priv::EnumArray<sf::MemoryStats::Category, Counters, sf::MemoryStats::CategoryCount> counters{};
+
+// Raise a high-water mark to a new value
+template <typename T>
+void updatePeak(std::atomic<T>& peak, T value)
+{
+    T current = peak.load(std::memory_order_relaxed);
+    while ((value > current) && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+} // namespace MemoryStatsImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MemoryStats::Statistics MemoryStats::getStatistics(Category category)
+{
+    const MemoryStatsImpl::Counters& categoryCounters = MemoryStatsImpl::counters[category];
+    return {categoryCounters.objectCount.load(std::memory_order_relaxed),
+            categoryCounters.peakObjectCount.load(std::memory_order_relaxed),
+            categoryCounters.bytes.load(std::memory_order_relaxed),
+            categoryCounters.peakBytes.load(std::memory_order_relaxed)};
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t MemoryStats::getTotalUsage()
+{
+    std::uint64_t total = 0;
+    for (const MemoryStatsImpl::Counters& categoryCounters : MemoryStatsImpl::counters)
+        total += categoryCounters.bytes.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+
+////////////////////////////////////////////////////////////
+void priv::updateMemoryStats(MemoryStats::Category category,
+                             int                   objectDelta,
+                             std::uint64_t         bytesRemoved,
+                             std::uint64_t         bytesAdded) noexcept
+{
+    MemoryStatsImpl::Counters& categoryCounters = MemoryStatsImpl::counters[category];
+
+    if (objectDelta > 0)
+    {
+        const auto        added = static_cast<std::size_t>(objectDelta);
+        const std::size_t count = categoryCounters.objectCount.fetch_add(added, std::memory_order_relaxed) + added;
+        MemoryStatsImpl::updatePeak(categoryCounters.peakObjectCount, count);
+    }
+    else if (objectDelta < 0)
+    {
+        categoryCounters.objectCount.fetch_sub(static_cast<std::size_t>(-objectDelta), std::memory_order_relaxed);
+    }
+
+    if (bytesAdded > bytesRemoved)
+    {
+        const std::uint64_t added = bytesAdded - bytesRemoved;
+        const std::uint64_t bytes = categoryCounters.bytes.fetch_add(added, std::memory_order_relaxed) + added;
+        MemoryStatsImpl::updatePeak(categoryCounters.peakBytes, bytes);
+    }
+    else if (bytesRemoved > bytesAdded)
+    {
+        categoryCounters.bytes.fetch_sub(bytesRemoved - bytesAdded, std::memory_order_relaxed);
+    }
+}
+
+} // namespace sf
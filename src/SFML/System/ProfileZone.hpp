@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#ifdef SFML_ENABLE_PROFILING
+
+#include <SFML/System/Profiler.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Profiling zone lasting until the end of its scope
+///
+////////////////////////////////////////////////////////////
+class ProfileZone
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Enter the zone, if a sink is set
+    ///
+    /// \param name Name of the zone, must be a string literal
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ProfileZone(const char* name) : m_sink(Profiler::getSink())
+    {
+        if (m_sink)
+            m_sink->beginZone(name);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Leave the zone
+    ///
+    /// The zone is reported to the sink that saw it begin,
+    /// even if the sink was changed in the meantime.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ProfileZone()
+    {
+        if (m_sink)
+            m_sink->endZone();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ProfileZone(const ProfileZone&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    ProfilerSink* m_sink; //!< Sink that saw the zone begin, null if there was none
+};
+
+} // namespace sf::priv
+
+#define SFML_PRIV_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SFML_PRIV_PROFILE_CONCAT(a, b)      SFML_PRIV_PROFILE_CONCAT_IMPL(a, b)
+
+////////////////////////////////////////////////////////////
+/// \brief Open a profiling zone lasting until the end of the current scope
+///
+/// Compiles to nothing unless SFML is built with SFML_ENABLE_PROFILING.
+///
+////////////////////////////////////////////////////////////
+#define SFML_PROFILE_ZONE(name) const sf::priv::ProfileZone SFML_PRIV_PROFILE_CONCAT(sfmlProfileZone, __LINE__)(name)
+
+#else
+
+#define SFML_PROFILE_ZONE(name) static_cast<void>(0)
+
+#endif
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Profiler.hpp>
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ProfilerImpl
+{
+// The sink is read by every zone, from any thread
+std::atomic<sf::ProfilerSink*> currentSink{};
+} // namespace ProfilerImpl
+} // namespace
+
+
+namespace sf::Profiler
+{
+////////////////////////////////////////////////////////////
+bool isAvailable()
+{
+#ifdef SFML_ENABLE_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void setSink(ProfilerSink* sink)
+{
+    ProfilerImpl::currentSink.store(sink, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+ProfilerSink* getSink()
+{
+    return ProfilerImpl::currentSink.load(std::memory_order_acquire);
+}
+
+} // namespace sf::Profiler
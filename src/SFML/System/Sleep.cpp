@@ -34,6 +34,25 @@
 #include <SFML/System/Unix/SleepImpl.hpp>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+namespace
+{
+namespace SleepImpl
+{
+// Time left to the spin at the end of precise sleeps, following the measured lateness of the system timer
+std::atomic<std::chrono::microseconds::rep> spinMargin{1000};
+
+// Bounds of the margin: sleeping closer to the deadline than this is never reliable, and beyond that the timer is
+// considered to have hiccupped rather than to be that imprecise
+constexpr std::chrono::microseconds minSpinMargin{50};
+constexpr std::chrono::microseconds maxSpinMargin{4000};
+} // namespace SleepImpl
+} // namespace
+
 
 namespace sf
 {
@@ -47,4 +66,42 @@ void sleep(Time duration)
         priv::sleepImpl(duration);
 }
 
+
+////////////////////////////////////////////////////////////
+void sleepPrecise(Time duration)
+{
+    if (duration > Time::Zero)
+        sleepUntil(std::chrono::steady_clock::now() + duration.toDuration());
+}
+
+
+////////////////////////////////////////////////////////////
+void sleepUntil(std::chrono::steady_clock::time_point deadline)
+{
+    using Clock = std::chrono::steady_clock;
+    using std::chrono::microseconds;
+
+    // Sleep for the coarse part of the delay, keeping a margin for the lateness of the system timer
+    const microseconds margin(SleepImpl::spinMargin.load(std::memory_order_relaxed));
+    const auto         remaining = deadline - Clock::now();
+
+    if (remaining > margin)
+    {
+        const auto requested = std::chrono::duration_cast<microseconds>(remaining - margin);
+        const auto start     = Clock::now();
+        priv::sleepImpl(requested);
+
+        // Adapt quickly when sleeping gets less precise, slowly when it gets more precise
+        const auto overshoot = std::clamp(std::chrono::duration_cast<microseconds>(Clock::now() - start - requested),
+                                          SleepImpl::minSpinMargin,
+                                          SleepImpl::maxSpinMargin);
+        const auto updated   = overshoot > margin ? overshoot : margin - (margin - overshoot) / 16;
+        SleepImpl::spinMargin.store(updated.count(), std::memory_order_relaxed);
+    }
+
+    // Spin for the final part, which sleeping can't reliably hit
+    while (Clock::now() < deadline)
+        std::this_thread::yield();
+}
+
 } // namespace sf
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utf.hpp>
+#include <SFML/System/UtfKernels.hpp>
 
 #include <iterator>
 #include <utility>
@@ -266,12 +267,12 @@ std::wstring String::toWideString() const
 ////////////////////////////////////////////////////////////
 U8String String::toUtf8() const
 {
-    // Prepare the output string
-    U8String output;
-    output.reserve(m_string.length());
+    const char32_t* begin = m_string.data();
+    const char32_t* end   = begin + m_string.size();
 
-    // Convert
-    Utf32::toUtf8(m_string.begin(), m_string.end(), std::back_inserter(output));
+    // Allocate the exact size of the output, then convert
+    U8String output(priv::utf32ToUtf8Length(begin, end), 0);
+    priv::utf32ToUtf8(begin, end, output.data());
 
     return output;
 }
@@ -280,12 +281,12 @@ U8String String::toUtf8() const
 ////////////////////////////////////////////////////////////
 std::u16string String::toUtf16() const
 {
-    // Prepare the output string
-    std::u16string output;
-    output.reserve(m_string.length());
+    const char32_t* begin = m_string.data();
+    const char32_t* end   = begin + m_string.size();
 
-    // Convert
-    Utf32::toUtf16(m_string.begin(), m_string.end(), std::back_inserter(output));
+    // Allocate the exact size of the output, then convert
+    std::u16string output(priv::utf32ToUtf16Length(begin, end), u'\0');
+    priv::utf32ToUtf16(begin, end, output.data());
 
     return output;
 }
@@ -429,6 +430,22 @@ String::ConstIterator String::end() const
 }
 
 
+////////////////////////////////////////////////////////////
+void String::assignUtf8(const std::uint8_t* begin, const std::uint8_t* end)
+{
+    m_string.resize(priv::utf8ToUtf32Length(begin, end));
+    priv::utf8ToUtf32(begin, end, m_string.data());
+}
+
+
+////////////////////////////////////////////////////////////
+void String::assignUtf16(const char16_t* begin, const char16_t* end)
+{
+    m_string.resize(priv::utf16ToUtf32Length(begin, end));
+    priv::utf16ToUtf32(begin, end, m_string.data());
+}
+
+
 ////////////////////////////////////////////////////////////
 bool operator==(const String& left, const String& right)
 {
@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Jobs.hpp>
+#include <SFML/System/ThreadPool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <exception>
+#include <utility>
+
+
+namespace
+{
+namespace ThreadPoolImpl
+{
+// Pool and index of the worker running on the current thread
+thread_local const sf::ThreadPool* currentPool  = nullptr;
+thread_local std::size_t           currentIndex = 0;
+
+// Chunks given to each thread by parallelFor, so that threads finishing early can take more work
+constexpr std::size_t chunksPerThread = 4;
+
+std::mutex& getSchedulerMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+sf::JobScheduler& getScheduler()
+{
+    static sf::JobScheduler scheduler;
+    return scheduler;
+}
+} // namespace ThreadPoolImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ThreadPool::Queue
+{
+    std::mutex                                       mutex; //!< Mutex protecting the tasks
+    std::array<std::deque<std::function<void()>>, 3> tasks; //!< Tasks of each priority
+};
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool() : ThreadPool(std::thread::hardware_concurrency())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+    threadCount = std::max(threadCount, 1u);
+
+    m_queues.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_queues.push_back(std::make_unique<Queue>());
+
+    m_threads.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        m_threads.emplace_back(&ThreadPool::run, this, i);
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t)>& function)
+{
+    if (begin >= end)
+        return;
+
+    const std::size_t count      = end - begin;
+    const std::size_t chunkCount = std::min(count, (m_threads.size() + 1) * ThreadPoolImpl::chunksPerThread);
+    const std::size_t chunkSize  = (count + chunkCount - 1) / chunkCount;
+
+    // Shared with the helper tasks, which may start after this function returned
+    struct State
+    {
+        std::atomic<std::size_t> nextChunk{};
+        std::atomic<std::size_t> remainingChunks{};
+        std::atomic<bool>        failed{};
+        std::exception_ptr       exception;
+        std::mutex               mutex;
+        std::condition_variable  done;
+    };
+
+    auto state             = std::make_shared<State>();
+    state->remainingChunks = (count + chunkSize - 1) / chunkSize;
+
+    const auto work = [state, begin, end, chunkSize, &function]
+    {
+        const std::size_t total = (end - begin + chunkSize - 1) / chunkSize;
+        for (std::size_t chunk = state->nextChunk++; chunk < total; chunk = state->nextChunk++)
+        {
+            if (!state->failed)
+            {
+                try
+                {
+                    const std::size_t first = begin + chunk * chunkSize;
+                    const std::size_t last  = std::min(first + chunkSize, end);
+                    for (std::size_t i = first; i < last; ++i)
+                        function(i);
+                }
+                catch (...)
+                {
+                    const std::lock_guard lock(state->mutex);
+                    if (!state->failed.exchange(true))
+                        state->exception = std::current_exception();
+                }
+            }
+
+            if (--state->remainingChunks == 0)
+            {
+                const std::lock_guard lock(state->mutex);
+                state->done.notify_all();
+            }
+        }
+    };
+
+    // Helpers only touch the function while a chunk is left, which keeps the caller waiting
+    const std::size_t helperCount = std::min(m_threads.size(), state->remainingChunks.load() - 1);
+    for (std::size_t i = 0; i < helperCount; ++i)
+        push(work, Priority::High);
+
+    work();
+
+    std::unique_lock lock(state->mutex);
+    state->done.wait(lock, [&state] { return state->remainingChunks == 0; });
+
+    if (state->exception)
+        std::rethrow_exception(state->exception);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ThreadPool::getThreadCount() const
+{
+    return m_threads.size();
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool& ThreadPool::getGlobal()
+{
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::push(std::function<void()> task, Priority priority)
+{
+    // Workers keep their own tasks, others spread theirs over all the workers
+    const std::size_t index = ThreadPoolImpl::currentPool == this ? ThreadPoolImpl::currentIndex
+                                                                  : m_nextQueue++ % m_queues.size();
+
+    // Counted before being queued, so that the counter never drops below the number of queued tasks
+    ++m_pendingTasks;
+
+    {
+        Queue&                queue = *m_queues[index];
+        const std::lock_guard lock(queue.mutex);
+        queue.tasks[static_cast<std::size_t>(priority)].push_back(std::move(task));
+    }
+
+    // Taking the mutex orders the notification after the check of a worker about to sleep
+    {
+        const std::lock_guard lock(m_sleepMutex);
+    }
+    m_wakeUp.notify_one();
+}
+
+
+////////////////////////////////////////////////////////////
+bool ThreadPool::pop(std::size_t index, std::function<void()>& task)
+{
+    for (std::size_t priority = 0; priority < 3; ++priority)
+    {
+        // The newest task of the worker is the most likely to find its data in cache
+        {
+            Queue&                queue = *m_queues[index];
+            const std::lock_guard lock(queue.mutex);
+            auto&                 tasks = queue.tasks[priority];
+            if (!tasks.empty())
+            {
+                task = std::move(tasks.back());
+                tasks.pop_back();
+                return true;
+            }
+        }
+
+        // Steal the oldest task of another worker, usually the largest piece of work it has left
+        for (std::size_t offset = 1; offset < m_queues.size(); ++offset)
+        {
+            Queue&                queue = *m_queues[(index + offset) % m_queues.size()];
+            const std::lock_guard lock(queue.mutex);
+            auto&                 tasks = queue.tasks[priority];
+            if (!tasks.empty())
+            {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::run(std::size_t index)
+{
+    ThreadPoolImpl::currentPool  = this;
+    ThreadPoolImpl::currentIndex = index;
+
+    std::function<void()> task;
+    while (true)
+    {
+        if (m_pendingTasks > 0 && pop(index, task))
+        {
+            --m_pendingTasks;
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock lock(m_sleepMutex);
+        m_wakeUp.wait(lock, [this] { return m_stopping || m_pendingTasks > 0; });
+        if (m_stopping && m_pendingTasks == 0)
+            return;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void setJobScheduler(JobScheduler scheduler)
+{
+    const std::lock_guard lock(ThreadPoolImpl::getSchedulerMutex());
+    ThreadPoolImpl::getScheduler() = std::move(scheduler);
+}
+
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void runJobs(std::size_t jobCount, const std::function<void(std::size_t)>& job)
+{
+    if (jobCount == 0)
+        return;
+
+    if (jobCount == 1)
+    {
+        job(0);
+        return;
+    }
+
+    JobScheduler scheduler;
+    {
+        const std::lock_guard lock(ThreadPoolImpl::getSchedulerMutex());
+        scheduler = ThreadPoolImpl::getScheduler();
+    }
+
+    if (scheduler)
+        scheduler(jobCount, job);
+    else
+        ThreadPool::getGlobal().parallelFor(0, jobCount, job);
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/TraceEventSink.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <fstream>
+#include <ostream>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TraceEventSinkImpl
+{
+// Write a zone name as a JSON string
+void writeString(std::ostream& stream, const char* text)
+{
+    stream << '"';
+    for (; *text; ++text)
+    {
+        if (*text == '"' || *text == '\\')
+            stream << '\\';
+        stream << *text;
+    }
+    stream << '"';
+}
+} // namespace TraceEventSinkImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void TraceEventSink::beginZone(const char* name)
+{
+    record(name);
+}
+
+
+////////////////////////////////////////////////////////////
+void TraceEventSink::endZone()
+{
+    record(nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TraceEventSink::saveToFile(const std::filesystem::path& filename) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        err() << "Failed to open trace file for writing\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    const std::lock_guard lock(m_mutex);
+
+    file << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < m_events.size(); ++i)
+    {
+        const Event& event = m_events[i];
+        file << (i > 0 ? ",\n" : "\n") << "{\"ph\":\"" << (event.name ? 'B' : 'E') << '"';
+        if (event.name)
+        {
+            file << ",\"cat\":\"sfml\",\"name\":";
+            TraceEventSinkImpl::writeString(file, event.name);
+        }
+        file << ",\"ts\":" << event.timestamp << ",\"pid\":1,\"tid\":" << event.thread << '}';
+    }
+    file << "\n]}\n";
+
+    if (!file)
+    {
+        err() << "Failed to write trace file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TraceEventSink::clear()
+{
+    const std::lock_guard lock(m_mutex);
+    m_events.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TraceEventSink::getEventCount() const
+{
+    const std::lock_guard lock(m_mutex);
+    return m_events.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TraceEventSink::record(const char* name)
+{
+    const std::int64_t timestamp = FastClock::toTime(FastClock::now().time_since_epoch()).asMicroseconds();
+
+    const std::lock_guard lock(m_mutex);
+    auto                  thread = m_threads.find(std::this_thread::get_id());
+    if (thread == m_threads.end())
+        thread = m_threads.emplace(std::this_thread::get_id(), static_cast<unsigned int>(m_threads.size()) + 1).first;
+    m_events.push_back({name, thread->second, timestamp});
+}
+
+} // namespace sf
@@ -0,0 +1,493 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/AsyncFileImpl.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(SFML_SYSTEM_LINUX)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace AsyncFileImplImpl
+{
+// Read waiting for its completion
+struct Request
+{
+    std::shared_ptr<const sf::priv::AsyncFileImpl> file;     // Keeps the descriptor open
+    std::int64_t                                   position; // Position of the data in the file
+    std::byte*                                     data;     // Destination of the data
+    std::size_t                                    size;     // Number of bytes to read
+    std::size_t                                    done{};   // Number of bytes already read
+    std::promise<std::int64_t>                     promise;  // Receives the result of the read
+#if defined(SFML_SYSTEM_LINUX)
+    iovec vector{}; // Remaining part of the buffer, for io_uring
+#endif
+};
+
+// Result of a read, from the bytes read and the last error
+std::int64_t getResult(const Request& request, bool failed)
+{
+    return (failed && (request.done == 0)) ? -1 : static_cast<std::int64_t>(request.done);
+}
+
+// Read synchronously, pread may return fewer bytes than requested
+void readNow(Request& request)
+{
+    bool failed = false;
+    while (request.done < request.size)
+    {
+        const ssize_t count = ::pread(request.file->getDescriptor(),
+                                      request.data + request.done,
+                                      request.size - request.done,
+                                      static_cast<off_t>(request.position + static_cast<std::int64_t>(request.done)));
+        if ((count == -1) && (errno == EINTR))
+            continue;
+
+        failed = (count == -1);
+        if (count <= 0)
+            break;
+        request.done += static_cast<std::size_t>(count);
+    }
+
+    request.promise.set_value(getResult(request, failed));
+}
+
+
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+////////////////////////////////////////////////////////////
+// Handle the data delivered by a channel, in order and in as many chunks as it wants
+void receiveChunk(Request* request, bool done, dispatch_data_t chunk, int error)
+{
+    if (chunk)
+    {
+        const void*           buffer     = nullptr;
+        std::size_t           length     = 0;
+        const dispatch_data_t contiguous = dispatch_data_create_map(chunk, &buffer, &length);
+
+        length = std::min(length, request->size - request->done);
+        std::memcpy(request->data + request->done, buffer, length);
+        request->done += length;
+        dispatch_release(contiguous);
+    }
+
+    if (done)
+    {
+        request->promise.set_value(getResult(*request, error != 0));
+        delete request;
+    }
+}
+#endif
+
+
+#if !defined(SFML_SYSTEM_MACOS) && !defined(SFML_SYSTEM_IOS)
+////////////////////////////////////////////////////////////
+// Thread performing the reads when the system has no better way
+class ReadThread
+{
+public:
+    static ReadThread& getInstance()
+    {
+        static ReadThread instance;
+        return instance;
+    }
+
+    void submit(std::unique_ptr<Request> request)
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_requests.push_back(std::move(request));
+        }
+        m_condition.notify_one();
+    }
+
+private:
+    ReadThread() : m_thread(&ReadThread::run, this)
+    {
+    }
+
+    ~ReadThread()
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_one();
+        m_thread.join();
+    }
+
+    void run()
+    {
+        std::unique_lock lock(m_mutex);
+        for (;;)
+        {
+            m_condition.wait(lock, [this] { return m_stop || !m_requests.empty(); });
+
+            // Pending reads are completed before stopping
+            if (m_requests.empty())
+                return;
+
+            const std::unique_ptr<Request> request = std::move(m_requests.front());
+            m_requests.pop_front();
+
+            lock.unlock();
+            readNow(*request);
+            lock.lock();
+        }
+    }
+
+    std::mutex                           m_mutex;
+    std::condition_variable              m_condition;
+    std::deque<std::unique_ptr<Request>> m_requests;
+    bool                                 m_stop{};
+    std::thread                          m_thread;
+};
+#endif
+
+
+#if defined(SFML_SYSTEM_LINUX)
+////////////////////////////////////////////////////////////
+// io_uring instance shared by all the files, with a thread reaping the completions
+class IoRing
+{
+public:
+    static IoRing* getInstance()
+    {
+        static IoRing instance;
+        return instance.m_ring != -1 ? &instance : nullptr;
+    }
+
+    void submit(std::unique_ptr<Request> request)
+    {
+        std::unique_lock lock(m_mutex);
+
+        // Don't let more reads be pending than the completion queue can hold
+        m_slotAvailable.wait(lock, [this] { return m_pending < m_capacity; });
+        ++m_pending;
+
+        push(request.release());
+    }
+
+private:
+    IoRing()
+    {
+        io_uring_params parameters{};
+        m_ring = static_cast<int>(::syscall(__NR_io_uring_setup, 64, &parameters));
+        if (m_ring == -1)
+            return;
+
+        // Old kernels map the submission and completion rings separately
+        m_sqRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+        m_cqRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        m_sqesSize   = parameters.sq_entries * sizeof(io_uring_sqe);
+
+        const bool singleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMapping)
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+
+        m_sqRing = map(m_sqRingSize, IORING_OFF_SQ_RING);
+        m_cqRing = singleMapping ? m_sqRing : map(m_cqRingSize, IORING_OFF_CQ_RING);
+        m_sqes   = static_cast<io_uring_sqe*>(map(m_sqesSize, IORING_OFF_SQES));
+        if (!m_sqRing || !m_cqRing || !m_sqes)
+        {
+            unmapAll();
+            ::close(m_ring);
+            m_ring = -1;
+            return;
+        }
+
+        auto* const sqRing = static_cast<std::byte*>(m_sqRing);
+        auto* const cqRing = static_cast<std::byte*>(m_cqRing);
+        m_sqHead           = reinterpret_cast<unsigned*>(sqRing + parameters.sq_off.head);
+        m_sqTail           = reinterpret_cast<unsigned*>(sqRing + parameters.sq_off.tail);
+        m_sqMask           = *reinterpret_cast<unsigned*>(sqRing + parameters.sq_off.ring_mask);
+        m_sqArray          = reinterpret_cast<unsigned*>(sqRing + parameters.sq_off.array);
+        m_cqHead           = reinterpret_cast<unsigned*>(cqRing + parameters.cq_off.head);
+        m_cqTail           = reinterpret_cast<unsigned*>(cqRing + parameters.cq_off.tail);
+        m_cqMask           = *reinterpret_cast<unsigned*>(cqRing + parameters.cq_off.ring_mask);
+        m_cqes             = reinterpret_cast<io_uring_cqe*>(cqRing + parameters.cq_off.cqes);
+        m_capacity         = parameters.cq_entries;
+
+        m_thread = std::thread(&IoRing::reap, this);
+    }
+
+    ~IoRing()
+    {
+        if (m_ring == -1)
+            return;
+
+        // Wait for the pending reads, then wake the reaping thread up with an empty operation
+        {
+            std::unique_lock lock(m_mutex);
+            m_slotAvailable.wait(lock, [this] { return m_pending == 0; });
+            push(nullptr);
+        }
+        m_thread.join();
+
+        unmapAll();
+        ::close(m_ring);
+    }
+
+    void* map(std::size_t size, off_t offset) const
+    {
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, offset);
+        return address == MAP_FAILED ? nullptr : address;
+    }
+
+    void unmapAll()
+    {
+        if (m_sqes)
+            ::munmap(m_sqes, m_sqesSize);
+        if (m_cqRing && (m_cqRing != m_sqRing))
+            ::munmap(m_cqRing, m_cqRingSize);
+        if (m_sqRing)
+            ::munmap(m_sqRing, m_sqRingSize);
+    }
+
+    // Queue the read of the remaining part of a request, or a wake-up without request; m_mutex must be locked
+    void push(Request* request)
+    {
+        const unsigned tail  = *m_sqTail;
+        const unsigned index = tail & m_sqMask;
+
+        io_uring_sqe& entry = m_sqes[index];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.user_data = reinterpret_cast<std::uintptr_t>(request);
+
+        if (request)
+        {
+            request->vector.iov_base = request->data + request->done;
+            request->vector.iov_len  = request->size - request->done;
+
+            // Vectored reads are supported by every kernel that has io_uring
+            entry.opcode = IORING_OP_READV;
+            entry.fd     = request->file->getDescriptor();
+            entry.off    = static_cast<std::uint64_t>(request->position) + request->done;
+            entry.addr   = reinterpret_cast<std::uintptr_t>(&request->vector);
+            entry.len    = 1;
+        }
+        else
+        {
+            entry.opcode = IORING_OP_NOP;
+        }
+
+        m_sqArray[index] = index;
+        __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+
+        // Entries left behind by a failed call are submitted along with the new one
+        const unsigned unsubmitted = tail + 1 - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        while ((::syscall(__NR_io_uring_enter, m_ring, unsubmitted, 0, 0, nullptr, 0) == -1) &&
+               ((errno == EINTR) || (errno == EAGAIN) || (errno == EBUSY)))
+            std::this_thread::yield();
+    }
+
+    void reap()
+    {
+        for (;;)
+        {
+            if ((::syscall(__NR_io_uring_enter, m_ring, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) == -1) &&
+                (errno != EINTR))
+                return;
+
+            unsigned       head = *m_cqHead;
+            const unsigned tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe& completion = m_cqes[head & m_cqMask];
+                const int           result     = completion.res;
+                auto*               request    = reinterpret_cast<Request*>(
+                    static_cast<std::uintptr_t>(completion.user_data));
+
+                if (!request)
+                {
+                    __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+                    return;
+                }
+
+                complete(request, result);
+            }
+            __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+
+    void complete(Request* request, int result)
+    {
+        if (result > 0)
+            request->done += static_cast<std::size_t>(result);
+
+        // Read the rest of short reads
+        if ((result > 0) && (request->done < request->size))
+        {
+            const std::lock_guard lock(m_mutex);
+            push(request);
+            return;
+        }
+
+        request->promise.set_value(getResult(*request, result < 0));
+        delete request;
+
+        {
+            const std::lock_guard lock(m_mutex);
+            --m_pending;
+        }
+        m_slotAvailable.notify_all();
+    }
+
+    int                     m_ring{-1};       // File descriptor of the ring
+    std::size_t             m_sqRingSize{};   // Size of the mapping of the submission ring
+    std::size_t             m_cqRingSize{};   // Size of the mapping of the completion ring
+    std::size_t             m_sqesSize{};     // Size of the mapping of the submission entries
+    void*                   m_sqRing{};       // Mapping of the submission ring
+    void*                   m_cqRing{};       // Mapping of the completion ring
+    io_uring_sqe*           m_sqes{};         // Submission entries
+    unsigned*               m_sqHead{};       // First entry not yet consumed by the kernel
+    unsigned*               m_sqTail{};       // Next entry to fill
+    unsigned                m_sqMask{};       // Mask of the indices of the submission ring
+    unsigned*               m_sqArray{};      // Indices of the submitted entries
+    unsigned*               m_cqHead{};       // First completion not yet reaped
+    unsigned*               m_cqTail{};       // Next completion written by the kernel
+    unsigned                m_cqMask{};       // Mask of the indices of the completion ring
+    io_uring_cqe*           m_cqes{};         // Completions
+    unsigned                m_capacity{};     // Maximum number of pending reads
+    unsigned                m_pending{};      // Number of pending reads
+    std::mutex              m_mutex;          // Protects the submission ring and m_pending
+    std::condition_variable m_slotAvailable;  // Signaled when a read completes
+    std::thread             m_thread;         // Reaps the completions
+};
+#endif
+} // namespace AsyncFileImplImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::shared_ptr<AsyncFileImpl> AsyncFileImpl::open(std::FILE* file)
+{
+    // Reads use their own descriptor, so that they may outlive the stdio stream
+    const int descriptor = ::fcntl(::fileno(file), F_DUPFD_CLOEXEC, 0);
+    if (descriptor == -1)
+        return nullptr;
+
+    return std::shared_ptr<AsyncFileImpl>(new AsyncFileImpl(descriptor));
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncFileImpl::AsyncFileImpl(int descriptor) : m_descriptor(descriptor)
+{
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+    // The channel closes the descriptor once it is closed itself and its reads are complete
+    m_channel = dispatch_io_create(DISPATCH_IO_RANDOM,
+                                   descriptor,
+                                   dispatch_get_global_queue(QOS_CLASS_UTILITY, 0),
+                                   ^(int) { ::close(descriptor); });
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncFileImpl::~AsyncFileImpl()
+{
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+    if (m_channel)
+    {
+        dispatch_io_close(m_channel, 0);
+        dispatch_release(m_channel);
+        return;
+    }
+#endif
+    ::close(m_descriptor);
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::int64_t> AsyncFileImpl::read(std::int64_t position, void* data, std::size_t size)
+{
+    using namespace AsyncFileImplImpl;
+
+    auto request      = std::make_unique<Request>();
+    request->file     = shared_from_this();
+    request->position = position;
+    request->data     = static_cast<std::byte*>(data);
+    request->size     = size;
+
+    std::future<std::int64_t> future = request->promise.get_future();
+
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+    if (m_channel)
+    {
+        Request* const pending = request.release();
+        dispatch_io_read(m_channel,
+                         position,
+                         size,
+                         dispatch_get_global_queue(QOS_CLASS_UTILITY, 0),
+                         ^(bool done, dispatch_data_t chunk, int error) { receiveChunk(pending, done, chunk, error); });
+        return future;
+    }
+    readNow(*request);
+#else
+#if defined(SFML_SYSTEM_LINUX)
+    if (IoRing* ring = IoRing::getInstance())
+    {
+        ring->submit(std::move(request));
+        return future;
+    }
+#endif
+    ReadThread::getInstance().submit(std::move(request));
+#endif
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+int AsyncFileImpl::getDescriptor() const
+{
+    return m_descriptor;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool mapFileImpl(const std::filesystem::path& filename, const std::byte*& data, std::size_t& size)
+{
+    const int file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return false;
+
+    struct stat status{};
+    if ((::fstat(file, &status) == -1) || !S_ISREG(status.st_mode))
+    {
+        ::close(file);
+        return false;
+    }
+
+    data = nullptr;
+    size = static_cast<std::size_t>(status.st_size);
+
+    // mmap rejects empty mappings
+    if (size > 0)
+    {
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(file);
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(address);
+    }
+
+    // The mapping keeps a reference to the file, the descriptor is no longer needed
+    ::close(file);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::size_t size)
+{
+    if (data)
+        ::munmap(const_cast<std::byte*>(data), size);
+}
+
+
+////////////////////////////////////////////////////////////
+void prefetchFileImpl(const std::byte* data, std::size_t size)
+{
+    if (!data || (size == 0))
+        return;
+
+    // madvise needs an address aligned on a page
+    const auto pageSize = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto address  = reinterpret_cast<std::uintptr_t>(data);
+    const auto begin    = address - address % pageSize;
+    ::madvise(reinterpret_cast<void*>(begin), size + (address - begin), MADV_WILLNEED);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <filesystem>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of file mapping for sf::MappedFileInputStream
+///
+/// Empty files are mapped successfully, with a null pointer.
+///
+/// \param filename Path of the file to map
+/// \param data     Receives the address of the mapped contents
+/// \param size     Receives the size of the file, in bytes
+///
+/// \return True if the file was mapped, false on error
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool mapFileImpl(const std::filesystem::path& filename, const std::byte*& data, std::size_t& size);
+
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of file unmapping for sf::MappedFileInputStream
+///
+/// \param data Address returned by mapFileImpl
+/// \param size Size returned by mapFileImpl
+///
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of the read-ahead of a mapped range
+///
+/// This is only a hint, the function returns immediately.
+///
+/// \param data Beginning of the range, inside a mapping returned by mapFileImpl
+/// \param size Size of the range, in bytes
+///
+////////////////////////////////////////////////////////////
+void prefetchFileImpl(const std::byte* data, std::size_t size);
+
+} // namespace sf::priv
@@ -29,6 +29,7 @@
 #include <SFML/System/Unix/SleepImpl.hpp>
 
 #include <cerrno>
+#include <cstdint>
 #include <ctime>
 
 
@@ -39,6 +40,8 @@ void sleepImpl(Time time)
 {
     const std::int64_t usecs = time.asMicroseconds();
 
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+
     // Construct the time to wait
     timespec ti{};
     ti.tv_sec  = static_cast<time_t>(usecs / 1000000);
@@ -52,6 +55,24 @@ void sleepImpl(Time time)
     while ((nanosleep(&ti, &ti) == -1) && (errno == EINTR))
     {
     }
+
+#else
+
+    // Sleep until an absolute deadline, so that being interrupted by a signal
+    // doesn't add the time spent handling it to the total duration
+    timespec deadline{};
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    const std::int64_t nsecs = static_cast<std::int64_t>(deadline.tv_nsec) + (usecs % 1000000) * 1000;
+    deadline.tv_sec += static_cast<time_t>(usecs / 1000000 + nsecs / 1000000000);
+    deadline.tv_nsec = static_cast<long>(nsecs % 1000000000);
+
+    // Unlike nanosleep, clock_nanosleep returns the error code instead of setting errno
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR)
+    {
+    }
+
+#endif
 }
 
 } // namespace sf::priv
@@ -0,0 +1,551 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Utf.hpp>
+#include <SFML/System/UtfKernels.hpp>
+
+#include <algorithm>
+#include <array>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_UTF_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SFML_UTF_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+namespace UtfKernelsImpl
+{
+// Number of ASCII characters checked and converted at once
+constexpr std::ptrdiff_t asciiBlockSize = 16;
+
+// Number of characters of the Basic Multilingual Plane (outside of the surrogate range) checked and converted at once
+constexpr std::ptrdiff_t bmpBlockSize = 8;
+
+#if defined(SFML_UTF_KERNELS_SSE2)
+////////////////////////////////////////////////////////////
+bool isAsciiBlock(const std::uint8_t* input)
+{
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input))) == 0;
+}
+
+void widenAsciiBlock(const std::uint8_t* input, char32_t* output)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    const __m128i low   = _mm_unpacklo_epi8(bytes, zero);
+    const __m128i high  = _mm_unpackhi_epi8(bytes, zero);
+
+    auto* const destination = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(destination, _mm_unpacklo_epi16(low, zero));
+    _mm_storeu_si128(destination + 1, _mm_unpackhi_epi16(low, zero));
+    _mm_storeu_si128(destination + 2, _mm_unpacklo_epi16(high, zero));
+    _mm_storeu_si128(destination + 3, _mm_unpackhi_epi16(high, zero));
+}
+
+bool isAsciiBlock(const char32_t* input)
+{
+    const auto*   source = reinterpret_cast<const __m128i*>(input);
+    const __m128i bits   = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(source), _mm_loadu_si128(source + 1)),
+                                      _mm_or_si128(_mm_loadu_si128(source + 2), _mm_loadu_si128(source + 3)));
+    const __m128i nonAscii = _mm_and_si128(bits, _mm_set1_epi32(~0x7F));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(nonAscii, _mm_setzero_si128())) == 0xFFFF;
+}
+
+void narrowAsciiBlock(const char32_t* input, std::uint8_t* output)
+{
+    // Saturation never kicks in since all the characters are lower than 0x80
+    const auto*   source = reinterpret_cast<const __m128i*>(input);
+    const __m128i low    = _mm_packs_epi32(_mm_loadu_si128(source), _mm_loadu_si128(source + 1));
+    const __m128i high   = _mm_packs_epi32(_mm_loadu_si128(source + 2), _mm_loadu_si128(source + 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(low, high));
+}
+
+bool isBmpBlock(const char16_t* input)
+{
+    const __m128i units      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800))),
+                                               _mm_set1_epi16(static_cast<short>(0xD800)));
+    return _mm_movemask_epi8(surrogates) == 0;
+}
+
+void widenBmpBlock(const char16_t* input, char32_t* output)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+
+    auto* const destination = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(destination, _mm_unpacklo_epi16(units, zero));
+    _mm_storeu_si128(destination + 1, _mm_unpackhi_epi16(units, zero));
+}
+
+bool isBmpBlock(const char32_t* input)
+{
+    const auto*   source = reinterpret_cast<const __m128i*>(input);
+    const __m128i low    = _mm_loadu_si128(source);
+    const __m128i high   = _mm_loadu_si128(source + 1);
+    const __m128i mask   = _mm_set1_epi32(0xF800);
+    const __m128i range  = _mm_set1_epi32(0xD800);
+
+    const __m128i outside    = _mm_srli_epi32(_mm_or_si128(low, high), 16);
+    const __m128i surrogates = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(low, mask), range),
+                                            _mm_cmpeq_epi32(_mm_and_si128(high, mask), range));
+    return (_mm_movemask_epi8(_mm_cmpeq_epi32(outside, _mm_setzero_si128())) == 0xFFFF) &&
+           (_mm_movemask_epi8(surrogates) == 0);
+}
+
+void narrowBmpBlock(const char32_t* input, char16_t* output)
+{
+    // SSE2 only packs with signed saturation: shift the characters to the signed range and back
+    const auto*   source = reinterpret_cast<const __m128i*>(input);
+    const __m128i bias   = _mm_set1_epi32(0x8000);
+    const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(_mm_loadu_si128(source), bias),
+                                           _mm_sub_epi32(_mm_loadu_si128(source + 1), bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                     _mm_add_epi16(packed, _mm_set1_epi16(static_cast<short>(0x8000))));
+}
+
+#elif defined(SFML_UTF_KERNELS_NEON)
+////////////////////////////////////////////////////////////
+// The blocks are loaded and stored as bytes, which may alias any type
+uint32x4_t loadCharacters(const char32_t* input)
+{
+    return vreinterpretq_u32_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(input)));
+}
+
+void storeCharacters(char32_t* output, uint32x4_t characters)
+{
+    vst1q_u8(reinterpret_cast<std::uint8_t*>(output), vreinterpretq_u8_u32(characters));
+}
+
+bool isAsciiBlock(const std::uint8_t* input)
+{
+    const uint8x16_t bytes = vld1q_u8(input);
+    const uint8x8_t  bits  = vorr_u8(vget_low_u8(bytes), vget_high_u8(bytes));
+    return (vget_lane_u64(vreinterpret_u64_u8(bits), 0) & 0x8080808080808080) == 0;
+}
+
+void widenAsciiBlock(const std::uint8_t* input, char32_t* output)
+{
+    const uint8x16_t bytes = vld1q_u8(input);
+    const uint16x8_t low   = vmovl_u8(vget_low_u8(bytes));
+    const uint16x8_t high  = vmovl_u8(vget_high_u8(bytes));
+    storeCharacters(output, vmovl_u16(vget_low_u16(low)));
+    storeCharacters(output + 4, vmovl_u16(vget_high_u16(low)));
+    storeCharacters(output + 8, vmovl_u16(vget_low_u16(high)));
+    storeCharacters(output + 12, vmovl_u16(vget_high_u16(high)));
+}
+
+bool isAsciiBlock(const char32_t* input)
+{
+    const uint32x4_t bits    = vorrq_u32(vorrq_u32(loadCharacters(input), loadCharacters(input + 4)),
+                                      vorrq_u32(loadCharacters(input + 8), loadCharacters(input + 12)));
+    const uint32x2_t reduced = vorr_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return ((vget_lane_u32(reduced, 0) | vget_lane_u32(reduced, 1)) & ~0x7Fu) == 0;
+}
+
+void narrowAsciiBlock(const char32_t* input, std::uint8_t* output)
+{
+    const uint16x8_t low  = vcombine_u16(vmovn_u32(loadCharacters(input)), vmovn_u32(loadCharacters(input + 4)));
+    const uint16x8_t high = vcombine_u16(vmovn_u32(loadCharacters(input + 8)), vmovn_u32(loadCharacters(input + 12)));
+    vst1q_u8(output, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+}
+
+bool isBmpBlock(const char16_t* input)
+{
+    const uint16x8_t units      = vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(input)));
+    const uint16x8_t surrogates = vceqq_u16(vandq_u16(units, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800));
+    return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(surrogates)), 0) == 0;
+}
+
+void widenBmpBlock(const char16_t* input, char32_t* output)
+{
+    const uint16x8_t units = vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(input)));
+    storeCharacters(output, vmovl_u16(vget_low_u16(units)));
+    storeCharacters(output + 4, vmovl_u16(vget_high_u16(units)));
+}
+
+bool isBmpBlock(const char32_t* input)
+{
+    const uint32x4_t low   = loadCharacters(input);
+    const uint32x4_t high  = loadCharacters(input + 4);
+    const uint32x4_t mask  = vdupq_n_u32(0xF800);
+    const uint32x4_t range = vdupq_n_u32(0xD800);
+
+    const uint32x4_t invalid = vorrq_u32(vshrq_n_u32(vorrq_u32(low, high), 16),
+                                         vorrq_u32(vceqq_u32(vandq_u32(low, mask), range),
+                                                   vceqq_u32(vandq_u32(high, mask), range)));
+    const uint32x2_t reduced = vorr_u32(vget_low_u32(invalid), vget_high_u32(invalid));
+    return (vget_lane_u32(reduced, 0) | vget_lane_u32(reduced, 1)) == 0;
+}
+
+void narrowBmpBlock(const char32_t* input, char16_t* output)
+{
+    const uint16x8_t units = vcombine_u16(vmovn_u32(loadCharacters(input)), vmovn_u32(loadCharacters(input + 4)));
+    vst1q_u8(reinterpret_cast<std::uint8_t*>(output), vreinterpretq_u8_u16(units));
+}
+
+#else
+////////////////////////////////////////////////////////////
+bool isAsciiBlock(const std::uint8_t* input)
+{
+    return std::all_of(input, input + asciiBlockSize, [](std::uint8_t byte) { return byte < 0x80; });
+}
+
+void widenAsciiBlock(const std::uint8_t* input, char32_t* output)
+{
+    std::copy(input, input + asciiBlockSize, output);
+}
+
+bool isAsciiBlock(const char32_t* input)
+{
+    return std::all_of(input, input + asciiBlockSize, [](char32_t character) { return character < 0x80; });
+}
+
+void narrowAsciiBlock(const char32_t* input, std::uint8_t* output)
+{
+    std::transform(input,
+                   input + asciiBlockSize,
+                   output,
+                   [](char32_t character) { return static_cast<std::uint8_t>(character); });
+}
+
+bool isBmpBlock(const char16_t* input)
+{
+    return std::all_of(input, input + bmpBlockSize, [](char16_t unit) { return (unit & 0xF800) != 0xD800; });
+}
+
+void widenBmpBlock(const char16_t* input, char32_t* output)
+{
+    std::copy(input, input + bmpBlockSize, output);
+}
+
+bool isBmpBlock(const char32_t* input)
+{
+    return std::all_of(input,
+                       input + bmpBlockSize,
+                       [](char32_t character) { return (character <= 0xFFFF) && ((character & 0xF800) != 0xD800); });
+}
+
+void narrowBmpBlock(const char32_t* input, char16_t* output)
+{
+    std::transform(input,
+                   input + bmpBlockSize,
+                   output,
+                   [](char32_t character) { return static_cast<char16_t>(character); });
+}
+#endif
+
+////////////////////////////////////////////////////////////
+// Number of bytes written by sf::Utf8::encode, 0 for the characters it skips
+std::size_t getUtf8Length(char32_t character)
+{
+    if ((character > 0x0010FFFF) || ((character >= 0xD800) && (character <= 0xDBFF)))
+        return 0;
+
+    // clang-format off
+    if      (character < 0x80)    return 1;
+    else if (character < 0x800)   return 2;
+    else if (character < 0x10000) return 3;
+    else                          return 4;
+    // clang-format on
+}
+
+// Same as sf::Utf8::encode, which only writes to back-insert iterators
+std::uint8_t* encodeUtf8(char32_t character, std::uint8_t* output)
+{
+    static constexpr std::array<std::uint8_t, 5> firstBytes = {0x00, 0x00, 0xC0, 0xE0, 0xF0};
+
+    const std::size_t length = getUtf8Length(character);
+    std::uint32_t     input  = character;
+
+    // clang-format off
+    switch (length)
+    {
+        case 4: output[3] = static_cast<std::uint8_t>((input | 0x80) & 0xBF); input >>= 6; [[fallthrough]];
+        case 3: output[2] = static_cast<std::uint8_t>((input | 0x80) & 0xBF); input >>= 6; [[fallthrough]];
+        case 2: output[1] = static_cast<std::uint8_t>((input | 0x80) & 0xBF); input >>= 6; [[fallthrough]];
+        case 1: output[0] = static_cast<std::uint8_t> (input | firstBytes[length]); break;
+        default: break;
+    }
+    // clang-format on
+
+    return output + length;
+}
+
+// Number of elements written by sf::Utf16::encode, 0 for the characters it skips
+std::size_t getUtf16Length(char32_t character)
+{
+    if (character <= 0xFFFF)
+        return ((character >= 0xD800) && (character <= 0xDFFF)) ? 0 : 1;
+
+    return character > 0x0010FFFF ? 0 : 2;
+}
+
+// Same as sf::Utf16::encode, which only writes to back-insert iterators
+char16_t* encodeUtf16(char32_t character, char16_t* output)
+{
+    switch (getUtf16Length(character))
+    {
+        case 1:
+            *output++ = static_cast<char16_t>(character);
+            break;
+        case 2:
+            character -= 0x0010000;
+            *output++ = static_cast<char16_t>((character >> 10) + 0xD800);
+            *output++ = static_cast<char16_t>((character & 0x3FFUL) + 0xDC00);
+            break;
+        default:
+            break;
+    }
+
+    return output;
+}
+
+// End of the characters to process one at a time before checking the next block
+template <typename T>
+const T* getBlockEnd(const T* begin, const T* end, std::ptrdiff_t blockSize)
+{
+    return begin + std::min(end - begin, blockSize);
+}
+} // namespace UtfKernelsImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::size_t utf8ToUtf32Length(const std::uint8_t* begin, const std::uint8_t* end)
+{
+    using namespace UtfKernelsImpl;
+
+    std::size_t length = 0;
+    while (begin < end)
+    {
+        if ((end - begin >= asciiBlockSize) && isAsciiBlock(begin))
+        {
+            begin += asciiBlockSize;
+            length += asciiBlockSize;
+        }
+        else
+        {
+            for (const std::uint8_t* blockEnd = getBlockEnd(begin, end, asciiBlockSize); begin < blockEnd; ++length)
+                begin = (*begin < 0x80) ? begin + 1 : Utf8::next(begin, end);
+        }
+    }
+
+    return length;
+}
+
+
+////////////////////////////////////////////////////////////
+char32_t* utf8ToUtf32(const std::uint8_t* begin, const std::uint8_t* end, char32_t* output)
+{
+    using namespace UtfKernelsImpl;
+
+    while (begin < end)
+    {
+        if ((end - begin >= asciiBlockSize) && isAsciiBlock(begin))
+        {
+            widenAsciiBlock(begin, output);
+            begin += asciiBlockSize;
+            output += asciiBlockSize;
+        }
+        else
+        {
+            for (const std::uint8_t* blockEnd = getBlockEnd(begin, end, asciiBlockSize); begin < blockEnd;)
+            {
+                if (*begin < 0x80)
+                {
+                    *output++ = *begin++;
+                    continue;
+                }
+
+                std::uint32_t codepoint = 0;
+                begin                   = Utf8::decode(begin, end, codepoint);
+                *output++               = codepoint;
+            }
+        }
+    }
+
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t utf32ToUtf8Length(const char32_t* begin, const char32_t* end)
+{
+    using namespace UtfKernelsImpl;
+
+    std::size_t length = 0;
+    while (begin < end)
+    {
+        if ((end - begin >= asciiBlockSize) && isAsciiBlock(begin))
+        {
+            begin += asciiBlockSize;
+            length += asciiBlockSize;
+        }
+        else
+        {
+            for (const char32_t* blockEnd = getBlockEnd(begin, end, asciiBlockSize); begin < blockEnd; ++begin)
+                length += getUtf8Length(*begin);
+        }
+    }
+
+    return length;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t* utf32ToUtf8(const char32_t* begin, const char32_t* end, std::uint8_t* output)
+{
+    using namespace UtfKernelsImpl;
+
+    while (begin < end)
+    {
+        if ((end - begin >= asciiBlockSize) && isAsciiBlock(begin))
+        {
+            narrowAsciiBlock(begin, output);
+            begin += asciiBlockSize;
+            output += asciiBlockSize;
+        }
+        else
+        {
+            for (const char32_t* blockEnd = getBlockEnd(begin, end, asciiBlockSize); begin < blockEnd; ++begin)
+                output = encodeUtf8(*begin, output);
+        }
+    }
+
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t utf16ToUtf32Length(const char16_t* begin, const char16_t* end)
+{
+    using namespace UtfKernelsImpl;
+
+    std::size_t length = 0;
+    while (begin < end)
+    {
+        if ((end - begin >= bmpBlockSize) && isBmpBlock(begin))
+        {
+            begin += bmpBlockSize;
+            length += bmpBlockSize;
+        }
+        else
+        {
+            for (const char16_t* blockEnd = getBlockEnd(begin, end, bmpBlockSize); begin < blockEnd; ++length)
+                begin = Utf16::next(begin, end);
+        }
+    }
+
+    return length;
+}
+
+
+////////////////////////////////////////////////////////////
+char32_t* utf16ToUtf32(const char16_t* begin, const char16_t* end, char32_t* output)
+{
+    using namespace UtfKernelsImpl;
+
+    while (begin < end)
+    {
+        if ((end - begin >= bmpBlockSize) && isBmpBlock(begin))
+        {
+            widenBmpBlock(begin, output);
+            begin += bmpBlockSize;
+            output += bmpBlockSize;
+        }
+        else
+        {
+            for (const char16_t* blockEnd = getBlockEnd(begin, end, bmpBlockSize); begin < blockEnd;)
+            {
+                std::uint32_t codepoint = 0;
+                begin                   = Utf16::decode(begin, end, codepoint);
+                *output++               = codepoint;
+            }
+        }
+    }
+
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t utf32ToUtf16Length(const char32_t* begin, const char32_t* end)
+{
+    using namespace UtfKernelsImpl;
+
+    std::size_t length = 0;
+    while (begin < end)
+    {
+        if ((end - begin >= bmpBlockSize) && isBmpBlock(begin))
+        {
+            begin += bmpBlockSize;
+            length += bmpBlockSize;
+        }
+        else
+        {
+            for (const char32_t* blockEnd = getBlockEnd(begin, end, bmpBlockSize); begin < blockEnd; ++begin)
+                length += getUtf16Length(*begin);
+        }
+    }
+
+    return length;
+}
+
+
+////////////////////////////////////////////////////////////
+char16_t* utf32ToUtf16(const char32_t* begin, const char32_t* end, char16_t* output)
+{
+    using namespace UtfKernelsImpl;
+
+    while (begin < end)
+    {
+        if ((end - begin >= bmpBlockSize) && isBmpBlock(begin))
+        {
+            narrowBmpBlock(begin, output);
+            begin += bmpBlockSize;
+            output += bmpBlockSize;
+        }
+        else
+        {
+            for (const char32_t* blockEnd = getBlockEnd(begin, end, bmpBlockSize); begin < blockEnd; ++begin)
+                output = encodeUtf16(*begin, output);
+        }
+    }
+
+    return output;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Count the UTF-32 characters of a UTF-8 buffer
+///
+/// The result is exactly the number of characters produced
+/// by sf::Utf8::toUtf32, including invalid sequences.
+///
+/// \param begin Beginning of the UTF-8 buffer
+/// \param end   End of the UTF-8 buffer
+///
+/// \return Number of UTF-32 characters
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t utf8ToUtf32Length(const std::uint8_t* begin, const std::uint8_t* end);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a UTF-8 buffer to UTF-32
+///
+/// Produces the same characters as sf::Utf8::toUtf32.
+///
+/// \param begin  Beginning of the UTF-8 buffer
+/// \param end    End of the UTF-8 buffer
+/// \param output Buffer receiving utf8ToUtf32Length characters
+///
+/// \return End of the written characters
+///
+////////////////////////////////////////////////////////////
+char32_t* utf8ToUtf32(const std::uint8_t* begin, const std::uint8_t* end, char32_t* output);
+
+////////////////////////////////////////////////////////////
+/// \brief Count the UTF-8 bytes needed to encode a UTF-32 buffer
+///
+/// Invalid characters are skipped, like sf::Utf32::toUtf8 does.
+///
+/// \param begin Beginning of the UTF-32 buffer
+/// \param end   End of the UTF-32 buffer
+///
+/// \return Number of UTF-8 bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t utf32ToUtf8Length(const char32_t* begin, const char32_t* end);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a UTF-32 buffer to UTF-8
+///
+/// Produces the same bytes as sf::Utf32::toUtf8.
+///
+/// \param begin  Beginning of the UTF-32 buffer
+/// \param end    End of the UTF-32 buffer
+/// \param output Buffer receiving utf32ToUtf8Length bytes
+///
+/// \return End of the written bytes
+///
+////////////////////////////////////////////////////////////
+std::uint8_t* utf32ToUtf8(const char32_t* begin, const char32_t* end, std::uint8_t* output);
+
+////////////////////////////////////////////////////////////
+/// \brief Count the UTF-32 characters of a UTF-16 buffer
+///
+/// The result is exactly the number of characters produced
+/// by sf::Utf16::toUtf32, including invalid sequences.
+///
+/// \param begin Beginning of the UTF-16 buffer
+/// \param end   End of the UTF-16 buffer
+///
+/// \return Number of UTF-32 characters
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t utf16ToUtf32Length(const char16_t* begin, const char16_t* end);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a UTF-16 buffer to UTF-32
+///
+/// Produces the same characters as sf::Utf16::toUtf32.
+///
+/// \param begin  Beginning of the UTF-16 buffer
+/// \param end    End of the UTF-16 buffer
+/// \param output Buffer receiving utf16ToUtf32Length characters
+///
+/// \return End of the written characters
+///
+////////////////////////////////////////////////////////////
+char32_t* utf16ToUtf32(const char16_t* begin, const char16_t* end, char32_t* output);
+
+////////////////////////////////////////////////////////////
+/// \brief Count the UTF-16 elements needed to encode a UTF-32 buffer
+///
+/// Invalid characters are skipped, like sf::Utf32::toUtf16 does.
+///
+/// \param begin Beginning of the UTF-32 buffer
+/// \param end   End of the UTF-32 buffer
+///
+/// \return Number of UTF-16 elements
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t utf32ToUtf16Length(const char32_t* begin, const char32_t* end);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a UTF-32 buffer to UTF-16
+///
+/// Produces the same elements as sf::Utf32::toUtf16.
+///
+/// \param begin  Beginning of the UTF-32 buffer
+/// \param end    End of the UTF-32 buffer
+/// \param output Buffer receiving utf32ToUtf16Length elements
+///
+/// \return End of the written elements
+///
+////////////////////////////////////////////////////////////
+char16_t* utf32ToUtf16(const char32_t* begin, const char32_t* end, char16_t* output);
+
+} // namespace sf::priv
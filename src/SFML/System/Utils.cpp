@@ -27,6 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Utils.hpp>
 
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
+
 #include <sstream>
 
 #include <cctype>
@@ -49,4 +52,15 @@ std::string formatDebugPathInfo(const std::filesystem::path& path)
     return oss.str();
 }
 
+const void* getStreamData(InputStream& stream)
+{
+    if (const auto* memoryStream = dynamic_cast<const MemoryInputStream*>(&stream))
+        return memoryStream->getData();
+
+    if (const auto* mappedStream = dynamic_cast<const MappedFileInputStream*>(&stream))
+        return mappedStream->getData();
+
+    return nullptr;
+}
+
 } // namespace sf
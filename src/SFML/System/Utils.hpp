@@ -37,9 +37,15 @@
 
 namespace sf
 {
+class InputStream;
+
 [[nodiscard]] SFML_SYSTEM_API std::string toLower(std::string str);
 [[nodiscard]] SFML_SYSTEM_API std::string formatDebugPathInfo(const std::filesystem::path& path);
 
+// Get the contents of a stream that reads from memory (sf::MemoryInputStream, sf::MappedFileInputStream),
+// so that loaders can decode it in place; returns a null pointer for other streams
+[[nodiscard]] SFML_SYSTEM_API const void* getStreamData(InputStream& stream);
+
 // Convert byte sequence into integer
 // toInteger<int>(0x12, 0x34, 0x56) == 0x563412
 template <typename IntegerType, typename... Bytes>
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Win32/AsyncFileImpl.hpp>
+
+#include <algorithm>
+
+#include <io.h>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace AsyncFileImplImpl
+{
+// Read waiting for its completion, handed to the system as its OVERLAPPED structure
+struct Request : OVERLAPPED
+{
+    std::shared_ptr<const sf::priv::AsyncFileImpl> file;     // Keeps the handle open
+    std::int64_t                                   position; // Position of the data in the file
+    std::byte*                                     data;     // Destination of the data
+    std::size_t                                    size;     // Number of bytes to read
+    std::size_t                                    done{};   // Number of bytes already read
+    std::promise<std::int64_t>                     promise;  // Receives the result of the read
+};
+
+void finish(Request* request, DWORD error)
+{
+    const bool failed = (error != ERROR_SUCCESS) && (error != ERROR_HANDLE_EOF);
+    request->promise.set_value((failed && (request->done == 0)) ? -1 : static_cast<std::int64_t>(request->done));
+    delete request;
+}
+
+// Start reading the remaining part of a request
+void issue(Request* request)
+{
+    const auto position = static_cast<std::uint64_t>(request->position) + request->done;
+    const auto chunk    = static_cast<DWORD>(std::min<std::size_t>(request->size - request->done, 0x40000000));
+
+    static_cast<OVERLAPPED&>(*request) = OVERLAPPED{};
+    request->Offset                    = static_cast<DWORD>(position & 0xFFFFFFFF);
+    request->OffsetHigh                = static_cast<DWORD>(position >> 32);
+
+    // Even reads completing immediately post their completion to the thread pool
+    if (!ReadFile(request->file->getHandle(), request->data + request->done, chunk, nullptr, request) &&
+        (GetLastError() != ERROR_IO_PENDING))
+        finish(request, GetLastError());
+}
+
+VOID CALLBACK onCompletion(DWORD error, DWORD transferred, LPOVERLAPPED overlapped)
+{
+    auto* const request = static_cast<Request*>(overlapped);
+    request->done += transferred;
+
+    // Read the rest of short reads
+    if ((error == ERROR_SUCCESS) && (transferred > 0) && (request->done < request->size))
+        issue(request);
+    else
+        finish(request, error);
+}
+} // namespace AsyncFileImplImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::shared_ptr<AsyncFileImpl> AsyncFileImpl::open(std::FILE* file)
+{
+    // ReOpenFile only exists since Windows Vista, it must be loaded dynamically
+    using ReOpenFileFunction = HANDLE(WINAPI*)(HANDLE, DWORD, DWORD, DWORD);
+    static const auto reOpenFile = reinterpret_cast<ReOpenFileFunction>(
+        reinterpret_cast<void*>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "ReOpenFile")));
+    if (!reOpenFile)
+        return nullptr;
+
+    // Overlapped reads need a handle of their own, opened for them
+    const auto   original = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+    const HANDLE handle   = reOpenFile(original,
+                                     GENERIC_READ,
+                                     FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                     FILE_FLAG_OVERLAPPED);
+    if (handle == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    if (!BindIoCompletionCallback(handle, &AsyncFileImplImpl::onCompletion, 0))
+    {
+        CloseHandle(handle);
+        return nullptr;
+    }
+
+    return std::shared_ptr<AsyncFileImpl>(new AsyncFileImpl(handle));
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncFileImpl::AsyncFileImpl(HANDLE handle) : m_handle(handle)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncFileImpl::~AsyncFileImpl()
+{
+    CloseHandle(m_handle);
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::int64_t> AsyncFileImpl::read(std::int64_t position, void* data, std::size_t size)
+{
+    using namespace AsyncFileImplImpl;
+
+    auto* const request = new Request{};
+    request->file       = shared_from_this();
+    request->position   = position;
+    request->data       = static_cast<std::byte*>(data);
+    request->size       = size;
+
+    std::future<std::int64_t> future = request->promise.get_future();
+    if (size == 0)
+        finish(request, ERROR_SUCCESS);
+    else
+        issue(request);
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+HANDLE AsyncFileImpl::getHandle() const
+{
+    return m_handle;
+}
+
+} // namespace sf::priv
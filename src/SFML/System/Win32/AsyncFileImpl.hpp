@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Win32/WindowsHeader.hpp>
+
+#include <future>
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Windows implementation of the background reads of sf::FileInputStream
+///
+/// Reads are overlapped, and completed by the thread pool
+/// of the system.
+///
+////////////////////////////////////////////////////////////
+class AsyncFileImpl : public std::enable_shared_from_this<AsyncFileImpl>
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare background reads of an open file
+    ///
+    /// \param file File to read, which may be closed while reads are pending
+    ///
+    /// \return Reader of the file, or a null pointer on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::shared_ptr<AsyncFileImpl> open(std::FILE* file);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AsyncFileImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncFileImpl(const AsyncFileImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncFileImpl& operator=(const AsyncFileImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start reading data from a given position of the file
+    ///
+    /// \param position Position of the data to read, from the beginning
+    /// \param data     Buffer where to copy the read data
+    /// \param size     Desired number of bytes to read
+    ///
+    /// \return Future receiving the number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::int64_t> read(std::int64_t position, void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the handle read by the reads
+    ///
+    /// \return Handle owned by the reader, opened for overlapped reads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] HANDLE getHandle() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the reader from a handle
+    ///
+    /// \param handle Handle opened for overlapped reads, owned by the reader
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit AsyncFileImpl(HANDLE handle);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    HANDLE m_handle; //!< Second handle of the file, opened for overlapped reads
+};
+
+} // namespace sf::priv
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#include <SFML/System/Win32/WindowsHeader.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool mapFileImpl(const std::filesystem::path& filename, const std::byte*& data, std::size_t& size)
+{
+    const HANDLE file = CreateFileW(filename.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL,
+                                    nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    data = nullptr;
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+
+    // CreateFileMapping rejects empty files
+    if (size > 0)
+    {
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // The view keeps a reference to the mapping, which keeps one to the file
+        const void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+
+        if (!address)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(address);
+    }
+
+    CloseHandle(file);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::size_t /* size */)
+{
+    if (data)
+        UnmapViewOfFile(data);
+}
+
+
+////////////////////////////////////////////////////////////
+void prefetchFileImpl(const std::byte* data, std::size_t size)
+{
+    if (!data || (size == 0))
+        return;
+
+    // PrefetchVirtualMemory only exists since Windows 8, it must be loaded dynamically
+    struct MemoryRange // Layout of WIN32_MEMORY_RANGE_ENTRY
+    {
+        PVOID  address;
+        SIZE_T size;
+    };
+    using PrefetchFunction = BOOL(WINAPI*)(HANDLE, ULONG_PTR, MemoryRange*, ULONG);
+
+    static const auto prefetch = reinterpret_cast<PrefetchFunction>(
+        reinterpret_cast<void*>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "PrefetchVirtualMemory")));
+
+    if (prefetch)
+    {
+        MemoryRange range{const_cast<std::byte*>(data), size};
+        prefetch(GetCurrentProcess(), 1, &range, 0);
+    }
+}
+
+} // namespace sf::priv
@@ -31,11 +31,62 @@
 
 #include <mmsystem.h>
 
+// Available since Windows 10 version 1803, missing from older SDKs
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+
+namespace
+{
+namespace SleepImpl
+{
+////////////////////////////////////////////////////////////
+/// \brief High-resolution waitable timer of the calling thread
+///
+////////////////////////////////////////////////////////////
+struct Timer
+{
+    Timer() :
+    handle(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS))
+    {
+    }
+
+    ~Timer()
+    {
+        if (handle)
+            CloseHandle(handle);
+    }
+
+    Timer(const Timer&)            = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    HANDLE handle; //!< Timer, null if high-resolution timers are not supported
+};
+} // namespace SleepImpl
+} // namespace
+
+
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
 void sleepImpl(Time time)
 {
+    // High-resolution timers wake the thread up within a fraction of a millisecond,
+    // without raising the resolution of the timers of the whole system
+    thread_local const SleepImpl::Timer timer;
+
+    if (timer.handle)
+    {
+        // A negative due time is relative, in units of 100 nanoseconds
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -time.asMicroseconds() * 10;
+
+        if (SetWaitableTimer(timer.handle, &dueTime, 0, nullptr, nullptr, FALSE) &&
+            (WaitForSingleObject(timer.handle, INFINITE) == WAIT_OBJECT_0))
+            return;
+    }
+
     // Get the minimum supported timer resolution on this system
     static const UINT periodMin = []
     {
@@ -47,8 +98,8 @@ void sleepImpl(Time time)
     // Set the timer resolution to the minimum for the Sleep call
     timeBeginPeriod(periodMin);
 
-    // Wait...
-    ::Sleep(static_cast<DWORD>(time.asMilliseconds()));
+    // Wait, rounding up so that the sleep never ends early
+    ::Sleep(static_cast<DWORD>((time.asMicroseconds() + 999) / 1000));
 
     // Reset the timer resolution back to the system default
     timeEndPeriod(periodMin);
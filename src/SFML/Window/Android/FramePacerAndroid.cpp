@@ -0,0 +1,431 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Android/FramePacerAndroid.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <string_view>
+
+#include <ctime>
+#include <dlfcn.h>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FramePacerAndroidImpl
+{
+// Tokens of EGL_ANDROID_get_frame_timestamps
+constexpr EGLint          timestampsAttribute = 0x3430;
+constexpr EGLint          displayPresentTime  = 0x343A;
+constexpr EGLnsecsANDROID timestampPending    = -2;
+
+// Maximum number of frames whose present time is tracked
+constexpr std::size_t maxPendingFrames = 8;
+
+// Choreographer entry points, loaded at runtime since they require recent API levels
+using FrameCallback       = void (*)(std::int64_t, void*);
+using GetInstance         = void* (*)();
+using PostFrameCallback   = void (*)(void*, FrameCallback, void*);
+using RefreshRateCallback = void (*)(std::int64_t, void*);
+using RegisterRefreshRate = void (*)(void*, RefreshRateCallback, void*);
+
+struct Choreographer
+{
+    void*               instance{};
+    PostFrameCallback   postFrameCallback{};
+    RegisterRefreshRate registerRefreshRateCallback{};
+    RegisterRefreshRate unregisterRefreshRateCallback{};
+};
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+T getAndroidFunction(const char* name)
+{
+    static void* const library = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+    return library ? reinterpret_cast<T>(dlsym(library, name)) : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+T getEglFunction(const char* name)
+{
+    return reinterpret_cast<T>(eglGetProcAddress(name));
+}
+
+
+////////////////////////////////////////////////////////////
+bool hasExtension(EGLDisplay display, std::string_view name)
+{
+    const char* extensionString = eglQueryString(display, EGL_EXTENSIONS);
+    if (!extensionString)
+        return false;
+
+    const std::string_view extensions(extensionString);
+    for (std::size_t begin = 0; begin < extensions.size();)
+    {
+        const std::size_t end = std::min(extensions.find(' ', begin), extensions.size());
+        if (extensions.substr(begin, end - begin) == name)
+            return true;
+        begin = end + 1;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t getMonotonicTime()
+{
+    // Choreographer and EGL timestamps are measured by CLOCK_MONOTONIC
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return std::int64_t{now.tv_sec} * 1'000'000'000 + now.tv_nsec;
+}
+} // namespace FramePacerAndroidImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Vertical blanks reported by the choreographer
+///
+/// Shared with the choreographer callbacks, which can't be
+/// cancelled: when the pacer is destroyed, the state is
+/// released by the next frame callback.
+///
+////////////////////////////////////////////////////////////
+struct FramePacerAndroid::VsyncState
+{
+    std::mutex                           mutex;          //!< Mutex protecting the state
+    FramePacerAndroidImpl::Choreographer choreographer;  //!< Choreographer of the thread of the window
+    std::int64_t                         firstVsync{};   //!< Time of the first vertical blank reported
+    std::int64_t                         lastVsync{};    //!< Time of the last vertical blank reported
+    std::int64_t                         period{};       //!< Duration of a refresh, 0 if unknown
+    bool                                 periodKnown{};  //!< Is the period reported by the refresh rate callback?
+    unsigned int                         longerFrames{}; //!< Consecutive frames longer than the estimated period
+    bool                                 stopped{};      //!< Was the pacer destroyed?
+};
+
+
+////////////////////////////////////////////////////////////
+FramePacerAndroid::FramePacerAndroid(EGLDisplay display) :
+m_display(display),
+m_vsync(std::make_unique<VsyncState>())
+{
+    using namespace FramePacerAndroidImpl;
+
+    if (hasExtension(m_display, "EGL_ANDROID_presentation_time"))
+        m_presentationTime = getEglFunction<PresentationTime>("eglPresentationTimeANDROID");
+
+    if (hasExtension(m_display, "EGL_ANDROID_get_frame_timestamps"))
+    {
+        m_getNextFrameId     = getEglFunction<GetNextFrameId>("eglGetNextFrameIdANDROID");
+        m_getFrameTimestamps = getEglFunction<GetFrameTimestamps>("eglGetFrameTimestampsANDROID");
+        m_timestampSupported = getEglFunction<TimestampSupported>("eglGetFrameTimestampSupportedANDROID");
+    }
+
+    m_setFrameRate = getAndroidFunction<SetFrameRate>("ANativeWindow_setFrameRate");
+
+    // AChoreographer_postFrameCallback64 requires API level 29, the refresh rate callback API level 30
+    Choreographer& choreographer = m_vsync->choreographer;
+    if (const auto getInstance = getAndroidFunction<GetInstance>("AChoreographer_getInstance"))
+        choreographer.instance = getInstance();
+
+    choreographer.postFrameCallback = getAndroidFunction<PostFrameCallback>("AChoreographer_postFrameCallback64");
+    choreographer.registerRefreshRateCallback = getAndroidFunction<RegisterRefreshRate>(
+        "AChoreographer_registerRefreshRateCallback");
+    choreographer.unregisterRefreshRateCallback = getAndroidFunction<RegisterRefreshRate>(
+        "AChoreographer_unregisterRefreshRateCallback");
+
+    // Without a looper on this thread there is no choreographer, and no vertical blank to pace the frames on
+    if (!choreographer.instance || !choreographer.postFrameCallback)
+    {
+        choreographer = {};
+        return;
+    }
+
+    if (choreographer.registerRefreshRateCallback && choreographer.unregisterRefreshRateCallback)
+        choreographer.registerRefreshRateCallback(choreographer.instance, &handleRefreshRate, m_vsync.get());
+
+    choreographer.postFrameCallback(choreographer.instance, &handleFrame, m_vsync.get());
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacerAndroid::~FramePacerAndroid()
+{
+    const FramePacerAndroidImpl::Choreographer& choreographer = m_vsync->choreographer;
+
+    if (!choreographer.instance)
+        return;
+
+    if (choreographer.registerRefreshRateCallback && choreographer.unregisterRefreshRateCallback)
+        choreographer.unregisterRefreshRateCallback(choreographer.instance, &handleRefreshRate, m_vsync.get());
+
+    // A frame callback is always pending, it releases the state
+    const std::lock_guard lock(m_vsync->mutex);
+    m_vsync.release()->stopped = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacerAndroid::setSurface(ANativeWindow* window, EGLSurface surface)
+{
+    m_window     = window;
+    m_surface    = surface;
+    m_timestamps = false;
+    m_lastTarget = 0;
+    m_pendingFrames.clear();
+
+    if (m_surface == EGL_NO_SURFACE)
+        return;
+
+    // Present times must be enabled for each surface
+    if (m_getNextFrameId && m_getFrameTimestamps && m_timestampSupported &&
+        m_timestampSupported(m_display, m_surface, FramePacerAndroidImpl::displayPresentTime))
+    {
+        m_timestamps = eglSurfaceAttrib(m_display,
+                                        m_surface,
+                                        FramePacerAndroidImpl::timestampsAttribute,
+                                        EGL_TRUE) == EGL_TRUE;
+    }
+
+    // The frame rate hint is attached to the native window, which is recreated with the surface
+    if (m_targetFrameRate > 0)
+        (void)setTargetFrameRate(m_targetFrameRate);
+}
+
+
+////////////////////////////////////////////////////////////
+bool FramePacerAndroid::setSwapInterval(int interval)
+{
+    m_interval        = std::max(interval, 0);
+    m_targetFrameRate = 0;
+
+    return m_presentationTime && m_vsync && m_vsync->choreographer.instance;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FramePacerAndroid::setTargetFrameRate(unsigned int frameRate)
+{
+    m_interval        = 1;
+    m_targetFrameRate = frameRate;
+
+    // Let the system pick a compatible refresh rate, e.g. 120 Hz rather than 90 Hz for 30 or 60 FPS
+    if (m_window && m_setFrameRate)
+        m_setFrameRate(m_window, static_cast<float>(frameRate), 0);
+
+    return m_presentationTime && m_vsync && m_vsync->choreographer.instance;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacerAndroid::beforeSwap()
+{
+    if (m_surface == EGL_NO_SURFACE)
+        return;
+
+    ++m_swapCount;
+
+    // Remember the frame, to retrieve its present time later
+    if (m_timestamps)
+    {
+        EGLuint64KHR frameId = 0;
+        if (m_getNextFrameId(m_display, m_surface, &frameId) == EGL_TRUE)
+        {
+            m_pendingFrames.push_back(frameId);
+
+            if (m_pendingFrames.size() > FramePacerAndroidImpl::maxPendingFrames)
+                m_pendingFrames.pop_front();
+        }
+    }
+
+    if (!m_presentationTime || !m_vsync)
+        return;
+
+    std::int64_t lastVsync = 0;
+    std::int64_t period    = 0;
+
+    {
+        const std::lock_guard lock(m_vsync->mutex);
+        lastVsync = m_vsync->lastVsync;
+        period    = m_vsync->period;
+    }
+
+    const int interval = getInterval(period);
+    if ((interval == 0) || (lastVsync == 0) || (period == 0))
+        return;
+
+    // Each frame is presented `interval` refreshes after the previous one, but never before the next
+    // vertical blank; a late frame thus delays the following ones instead of shortening them
+    const std::int64_t now       = FramePacerAndroidImpl::getMonotonicTime();
+    const std::int64_t nextVsync = lastVsync + (std::max<std::int64_t>(now - lastVsync, 0) / period + 1) * period;
+    const std::int64_t target    = std::max(m_lastTarget + interval * period, nextVsync);
+
+    m_lastTarget = target;
+
+    // Ask for half a refresh early, the frame is displayed at the first vertical blank after the requested time
+    m_presentationTime(m_display, m_surface, target - period / 2);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> FramePacerAndroid::getPresentTiming()
+{
+    // Collect the present times of the frames which reached the screen
+    while (!m_pendingFrames.empty())
+    {
+        const EGLint    name  = FramePacerAndroidImpl::displayPresentTime;
+        EGLnsecsANDROID value = 0;
+
+        if (m_getFrameTimestamps(m_display, m_surface, m_pendingFrames.front(), 1, &name, &value) == EGL_TRUE)
+        {
+            if (value == FramePacerAndroidImpl::timestampPending)
+                break;
+
+            // Frames which were dropped by the compositor have an invalid (negative) timestamp
+            if (value >= 0)
+            {
+                m_lastPresent = value;
+                ++m_presentCount;
+            }
+        }
+
+        m_pendingFrames.pop_front();
+    }
+
+    std::int64_t firstVsync = 0;
+    std::int64_t lastVsync  = 0;
+    std::int64_t period     = 0;
+
+    if (m_vsync)
+    {
+        const std::lock_guard lock(m_vsync->mutex);
+        firstVsync = m_vsync->firstVsync;
+        lastVsync  = m_vsync->lastVsync;
+        period     = m_vsync->period;
+    }
+
+    // Fall back to the last vertical blank when present times are not reported
+    const std::int64_t time = m_timestamps ? m_lastPresent : lastVsync;
+    if (time == 0)
+        return std::nullopt;
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank = microseconds(time / 1'000);
+    timing.swapCount         = m_timestamps ? m_presentCount : m_swapCount;
+
+    if (period > 0)
+    {
+        // Vertical blanks are counted from the first one reported by the choreographer
+        const std::int64_t elapsed = std::max<std::int64_t>(time - firstVsync, 0);
+        timing.verticalBlankCount  = static_cast<std::uint64_t>((elapsed + period / 2) / period);
+        timing.refreshRate         = 1'000'000'000.f / static_cast<float>(period);
+    }
+
+    return timing;
+}
+
+
+////////////////////////////////////////////////////////////
+int FramePacerAndroid::getInterval(std::int64_t period) const
+{
+    if ((m_targetFrameRate == 0) || (period == 0))
+        return m_interval;
+
+    // Number of refreshes closest to the target frame duration
+    const double refreshRate = 1'000'000'000.0 / static_cast<double>(period);
+    return std::max(static_cast<int>(std::lround(refreshRate / static_cast<double>(m_targetFrameRate))), 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacerAndroid::handleFrame(std::int64_t frameTimeNanos, void* data)
+{
+    auto* state = static_cast<VsyncState*>(data);
+
+    {
+        const std::lock_guard lock(state->mutex);
+
+        if (!state->stopped)
+        {
+            if (state->firstVsync == 0)
+                state->firstVsync = frameTimeNanos;
+
+            // Without the refresh rate callback, estimate the period from the shortest interval between
+            // callbacks; callbacks are only dispatched when the looper is polled, so some are missed
+            const std::int64_t delta = frameTimeNanos - state->lastVsync;
+            if (!state->periodKnown && (state->lastVsync != 0) && (delta > 0))
+            {
+                if ((state->period == 0) || (delta < state->period))
+                {
+                    state->period       = delta;
+                    state->longerFrames = 0;
+                }
+                else if (delta < state->period * 3 / 2)
+                {
+                    state->period       = (state->period * 7 + delta) / 8;
+                    state->longerFrames = 0;
+                }
+                else if (++state->longerFrames >= 8)
+                {
+                    // The refresh rate has decreased
+                    state->period       = delta;
+                    state->longerFrames = 0;
+                }
+            }
+
+            state->lastVsync = frameTimeNanos;
+
+            state->choreographer.postFrameCallback(state->choreographer.instance, &handleFrame, state);
+            return;
+        }
+    }
+
+    delete state;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacerAndroid::handleRefreshRate(std::int64_t vsyncPeriodNanos, void* data)
+{
+    auto*                 state = static_cast<VsyncState*>(data);
+    const std::lock_guard lock(state->mutex);
+
+    state->period      = vsyncPeriodNanos;
+    state->periodKnown = vsyncPeriodNanos > 0;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Window.hpp>
+
+#include <glad/egl.h>
+
+#include <android/native_window.h>
+
+#include <deque>
+#include <memory>
+#include <optional>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Schedule the presentation of the frames of an Android window
+///
+/// The vertical blanks are tracked with AChoreographer, and
+/// each frame is given a presentation time with
+/// EGL_ANDROID_presentation_time, so that frames stay on
+/// screen for the same number of refreshes even when the
+/// rendering occasionally misses a vertical blank. Actual
+/// present times are read back with
+/// EGL_ANDROID_get_frame_timestamps.
+///
+/// The entry points are loaded at runtime, the features which
+/// are not supported by the device are simply disabled.
+///
+////////////////////////////////////////////////////////////
+class FramePacerAndroid
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pacer
+    ///
+    /// Must be called from a thread which has a looper, for
+    /// the vertical blank callbacks to be dispatched.
+    ///
+    /// \param display EGL display of the window
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit FramePacerAndroid(EGLDisplay display);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FramePacerAndroid();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FramePacerAndroid(const FramePacerAndroid&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    FramePacerAndroid& operator=(const FramePacerAndroid&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the surface whose frames are paced
+    ///
+    /// \param window  Native window of the surface, can be null
+    /// \param surface EGL surface, or EGL_NO_SURFACE when it is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSurface(ANativeWindow* window, EGLSurface surface);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks each frame stays on screen
+    ///
+    /// \param interval Number of vertical blanks, 0 to disable pacing
+    ///
+    /// \return True if the frames are paced, false if the swap interval must be left to EGL
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the frame rate the swap interval is derived from
+    ///
+    /// The system is also told about the frame rate, so that it
+    /// can switch the display to a compatible refresh rate.
+    ///
+    /// \param frameRate Target number of frames per second
+    ///
+    /// \return True if the frames are paced, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTargetFrameRate(unsigned int frameRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule the frame about to be swapped
+    ///
+    /// Must be called right before eglSwapBuffers.
+    ///
+    ////////////////////////////////////////////////////////////
+    void beforeSwap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming();
+
+private:
+    struct VsyncState;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertical blanks the next frame should stay on screen
+    ///
+    /// \param period Duration of a refresh, in nanoseconds
+    ///
+    /// \return Swap interval
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getInterval(std::int64_t period) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Choreographer callback called at each vertical blank
+    ///
+    /// \param frameTimeNanos Time of the vertical blank, in nanoseconds
+    /// \param data           Vertical blank state of the pacer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleFrame(std::int64_t frameTimeNanos, void* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Choreographer callback called when the refresh rate changes
+    ///
+    /// \param vsyncPeriodNanos Duration of a refresh, in nanoseconds
+    /// \param data             Vertical blank state of the pacer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleRefreshRate(std::int64_t vsyncPeriodNanos, void* data);
+
+    ////////////////////////////////////////////////////////////
+    // Function types of the extensions
+    ////////////////////////////////////////////////////////////
+    using PresentationTime   = EGLBoolean (*)(EGLDisplay, EGLSurface, EGLnsecsANDROID);
+    using GetNextFrameId     = EGLBoolean (*)(EGLDisplay, EGLSurface, EGLuint64KHR*);
+    using GetFrameTimestamps =
+        EGLBoolean (*)(EGLDisplay, EGLSurface, EGLuint64KHR, EGLint, const EGLint*, EGLnsecsANDROID*);
+    using TimestampSupported = EGLBoolean (*)(EGLDisplay, EGLSurface, EGLint);
+    using SetFrameRate       = std::int32_t (*)(ANativeWindow*, float, std::int8_t);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    EGLDisplay                  m_display;                 //!< EGL display of the window
+    EGLSurface                  m_surface{EGL_NO_SURFACE}; //!< Surface whose frames are paced
+    ANativeWindow*              m_window{};                //!< Native window of the surface
+    std::unique_ptr<VsyncState> m_vsync;                   //!< Vertical blanks reported by the choreographer
+    PresentationTime            m_presentationTime{};      //!< eglPresentationTimeANDROID, if supported
+    GetNextFrameId              m_getNextFrameId{};        //!< eglGetNextFrameIdANDROID, if supported
+    GetFrameTimestamps          m_getFrameTimestamps{};    //!< eglGetFrameTimestampsANDROID, if supported
+    TimestampSupported          m_timestampSupported{};    //!< eglGetFrameTimestampSupportedANDROID, if supported
+    SetFrameRate                m_setFrameRate{};          //!< ANativeWindow_setFrameRate, if supported
+    bool                        m_timestamps{};            //!< Are present times reported for the surface?
+    int                         m_interval{1};             //!< Fixed swap interval
+    unsigned int                m_targetFrameRate{};       //!< Frame rate the swap interval is derived from, 0 if none
+    std::int64_t                m_lastTarget{};            //!< Presentation time requested for the last frame
+    std::deque<EGLuint64KHR>    m_pendingFrames;           //!< Frames whose present time is not known yet
+    std::int64_t                m_lastPresent{};           //!< Present time of the last presented frame
+    std::uint64_t               m_presentCount{};          //!< Number of frames known to be presented
+    std::uint64_t               m_swapCount{};             //!< Number of swaps scheduled
+};
+
+} // namespace sf::priv
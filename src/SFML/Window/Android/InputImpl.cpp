@@ -175,6 +175,30 @@ bool isMouseButtonPressed(Mouse::Button button)
 }
 
 
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    // Not applicable
+    keys.reset();
+    scancodes.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* /* relativeTo */)
+{
+    ALooper_pollAll(0, nullptr, nullptr, nullptr);
+
+    ActivityStates&       states = getActivity();
+    const std::lock_guard lock(states.mutex);
+
+    for (unsigned int i = 0; i < Mouse::ButtonCount; ++i)
+        buttons[i] = states.isButtonPressed[static_cast<Mouse::Button>(i)];
+
+    position = states.mousePosition;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i getMousePosition()
 {
@@ -32,7 +32,10 @@
 
 #include <android/looper.h>
 
+#include <algorithm>
+#include <array>
 #include <optional>
+#include <vector>
 
 #if defined(__clang__) || defined(__GNUC__)
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -49,6 +52,10 @@ ALooper*                                                               looper;
 ASensorManager*                                                        sensorManager;
 ASensorEventQueue*                                                     sensorEventQueue;
 sf::priv::EnumArray<sf::Sensor::Type, sf::Vector3f, sf::Sensor::Count> sensorData;
+
+// Samples of the batched sensors, kept until they are read
+sf::priv::EnumArray<sf::Sensor::Type, bool, sf::Sensor::Count>                        sensorBatched;
+sf::priv::EnumArray<sf::Sensor::Type, std::vector<sf::Sensor::Sample>, sf::Sensor::Count> sensorSamples;
 } // namespace
 
 
@@ -130,9 +137,72 @@ Vector3f SensorImpl::update() const
 void SensorImpl::setEnabled(bool enabled)
 {
     if (enabled)
-        ASensorEventQueue_enableSensor(sensorEventQueue, m_sensor);
+        start();
     else
         ASensorEventQueue_disableSensor(sensorEventQueue, m_sensor);
+
+    m_enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SensorImpl::setBatching(bool enabled, Time samplingPeriod, Time maxReportLatency)
+{
+    m_batched          = enabled;
+    m_samplingPeriod   = samplingPeriod;
+    m_maxReportLatency = maxReportLatency;
+
+    sensorBatched[m_type] = enabled;
+    sensorSamples[m_type].clear();
+
+    // The parameters of a running sensor can't be changed, it has to be started again
+    if (m_enabled)
+    {
+        ASensorEventQueue_disableSensor(sensorEventQueue, m_sensor);
+        start();
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SensorImpl::readSamples(std::vector<Sensor::Sample>& samples)
+{
+    // Read the events reported since the last update, without dispatching the other sources of the looper
+    processSensorEvents(0, 0, nullptr);
+
+    std::vector<Sensor::Sample>& pending = sensorSamples[m_type];
+    samples.insert(samples.end(), pending.begin(), pending.end());
+    pending.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void SensorImpl::start() const
+{
+    const int minDelay = ASensor_getMinDelay(m_sensor);
+
+    if (!m_batched)
+    {
+        ASensorEventQueue_enableSensor(sensorEventQueue, m_sensor);
+        ASensorEventQueue_setEventRate(sensorEventQueue, m_sensor, minDelay);
+        return;
+    }
+
+    const auto samplingPeriod = std::max(static_cast<int>(m_samplingPeriod.asMicroseconds()), minDelay);
+
+#if ANDROID_API >= 26 || __ANDROID_API__ >= 26
+    // Let the sensor store its samples in its hardware FIFO, so that the CPU
+    // is woken up once per batch instead of once per sample
+    const auto maxReportLatency = static_cast<std::int64_t>(m_maxReportLatency.asMicroseconds());
+    if (ASensorEventQueue_registerSensor(sensorEventQueue, m_sensor, samplingPeriod, maxReportLatency) >= 0)
+        return;
+#endif
+
+    // Without a FIFO, the samples are reported one by one
+    ASensorEventQueue_enableSensor(sensorEventQueue, m_sensor);
+    ASensorEventQueue_setEventRate(sensorEventQueue, m_sensor, samplingPeriod);
 }
 
 
@@ -158,66 +228,79 @@ const ASensor* SensorImpl::getDefaultSensor(Sensor::Type sensor)
 ////////////////////////////////////////////////////////////
 int SensorImpl::processSensorEvents(int /* fd */, int /* events */, void* /* sensorData */)
 {
-    ASensorEvent event;
+    // Batches may hold many events, so they are read several at once
+    std::array<ASensorEvent, 32> events{};
+    ssize_t                      count = 0;
 
-    while (ASensorEventQueue_getEvents(sensorEventQueue, &event, 1) > 0)
+    while ((count = ASensorEventQueue_getEvents(sensorEventQueue, events.data(), events.size())) > 0)
     {
-        std::optional<Sensor::Type> type;
-        Vector3f                    data;
-
-        switch (event.type)
-        {
-            case ASENSOR_TYPE_ACCELEROMETER:
-                type   = Sensor::Type::Accelerometer;
-                data.x = event.acceleration.x;
-                data.y = event.acceleration.y;
-                data.z = event.acceleration.z;
-                break;
-
-            case ASENSOR_TYPE_GYROSCOPE:
-                type   = Sensor::Type::Gyroscope;
-                data.x = event.vector.x;
-                data.y = event.vector.y;
-                data.z = event.vector.z;
-                break;
-
-            case ASENSOR_TYPE_MAGNETIC_FIELD:
-                type   = Sensor::Type::Magnetometer;
-                data.x = event.magnetic.x;
-                data.y = event.magnetic.y;
-                data.z = event.magnetic.z;
-                break;
-
-            case ASENSOR_TYPE_GRAVITY:
-                type   = Sensor::Type::Gravity;
-                data.x = event.vector.x;
-                data.y = event.vector.y;
-                data.z = event.vector.z;
-                break;
-
-            case ASENSOR_TYPE_LINEAR_ACCELERATION:
-                type   = Sensor::Type::UserAcceleration;
-                data.x = event.acceleration.x;
-                data.y = event.acceleration.y;
-                data.z = event.acceleration.z;
-                break;
-
-            case ASENSOR_TYPE_ORIENTATION:
-                type   = Sensor::Type::Orientation;
-                data.x = event.vector.x;
-                data.y = event.vector.y;
-                data.z = event.vector.z;
-                break;
-        }
-
-        // An unknown sensor event has been detected, we don't know how to process it
-        if (!type)
-            continue;
-
-        sensorData[*type] = data;
+        for (ssize_t i = 0; i < count; ++i)
+            processSensorEvent(events[static_cast<std::size_t>(i)]);
     }
 
     return 1;
 }
 
+
+////////////////////////////////////////////////////////////
+void SensorImpl::processSensorEvent(const ASensorEvent& event)
+{
+    std::optional<Sensor::Type> type;
+    Vector3f                    data;
+
+    switch (event.type)
+    {
+        case ASENSOR_TYPE_ACCELEROMETER:
+            type   = Sensor::Type::Accelerometer;
+            data.x = event.acceleration.x;
+            data.y = event.acceleration.y;
+            data.z = event.acceleration.z;
+            break;
+
+        case ASENSOR_TYPE_GYROSCOPE:
+            type   = Sensor::Type::Gyroscope;
+            data.x = event.vector.x;
+            data.y = event.vector.y;
+            data.z = event.vector.z;
+            break;
+
+        case ASENSOR_TYPE_MAGNETIC_FIELD:
+            type   = Sensor::Type::Magnetometer;
+            data.x = event.magnetic.x;
+            data.y = event.magnetic.y;
+            data.z = event.magnetic.z;
+            break;
+
+        case ASENSOR_TYPE_GRAVITY:
+            type   = Sensor::Type::Gravity;
+            data.x = event.vector.x;
+            data.y = event.vector.y;
+            data.z = event.vector.z;
+            break;
+
+        case ASENSOR_TYPE_LINEAR_ACCELERATION:
+            type   = Sensor::Type::UserAcceleration;
+            data.x = event.acceleration.x;
+            data.y = event.acceleration.y;
+            data.z = event.acceleration.z;
+            break;
+
+        case ASENSOR_TYPE_ORIENTATION:
+            type   = Sensor::Type::Orientation;
+            data.x = event.vector.x;
+            data.y = event.vector.y;
+            data.z = event.vector.z;
+            break;
+    }
+
+    // An unknown sensor event has been detected, we don't know how to process it
+    if (!type)
+        return;
+
+    sensorData[*type] = data;
+
+    if (sensorBatched[*type])
+        sensorSamples[*type].push_back({data, microseconds(event.timestamp / 1000)});
+}
+
 } // namespace sf::priv
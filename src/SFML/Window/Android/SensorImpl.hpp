@@ -27,10 +27,13 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector3.hpp>
 
 #include <android/sensor.h>
 
+#include <vector>
+
 
 namespace sf::priv
 {
@@ -95,7 +98,33 @@ public:
     ////////////////////////////////////////////////////////////
     void setEnabled(bool enabled);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the batching of the samples
+    ///
+    /// \param enabled          True to keep every sample
+    /// \param samplingPeriod   Time between two samples, zero to use the fastest rate
+    /// \param maxReportLatency Maximum time the samples can be held back in the hardware FIFO
+    ///
+    /// \return True on success, false if batching is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setBatching(bool enabled, Time samplingPeriod, Time maxReportLatency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the samples measured since the previous call
+    ///
+    /// \param samples Vector to append the samples to
+    ///
+    ////////////////////////////////////////////////////////////
+    void readSamples(std::vector<Sensor::Sample>& samples);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the sensor with the current batching parameters
+    ///
+    ////////////////////////////////////////////////////////////
+    void start() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the default Android sensor matching the sensor type
     ///
@@ -118,11 +147,23 @@ private:
     ////////////////////////////////////////////////////////////
     static int processSensorEvents(int fd, int events, void* data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the value of a sensor event, and its sample if the sensor is batched
+    ///
+    /// \param event Event to process
+    ///
+    ////////////////////////////////////////////////////////////
+    static void processSensorEvent(const ASensorEvent& event);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const ASensor* m_sensor; ///< Android sensor structure
-    Sensor::Type   m_type;   ///< Type of the sensor
+    const ASensor* m_sensor;           ///< Android sensor structure
+    Sensor::Type   m_type;             ///< Type of the sensor
+    bool           m_enabled{};        ///< Is the sensor running?
+    bool           m_batched{};        ///< Are all the samples kept?
+    Time           m_samplingPeriod;   ///< Time between two batched samples, zero for the fastest rate
+    Time           m_maxReportLatency; ///< Maximum time the batched samples can be held back
 };
 
 } // namespace sf::priv
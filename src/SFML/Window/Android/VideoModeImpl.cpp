@@ -55,4 +55,25 @@ VideoMode VideoModeImpl::getDesktopMode()
     return VideoMode(Vector2u(states.screenSize));
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    // Only the screen of the device is reported, its refresh rate is known by the frame pacer of the windows
+    Monitor monitor;
+    monitor.name    = "screen";
+    monitor.mode    = getDesktopMode();
+    monitor.primary = true;
+
+    return {monitor};
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // The screen size changes with the orientation of the device
+    return false;
+}
+
 } // namespace sf::priv
@@ -37,12 +37,28 @@
 #include <mutex>
 #include <ostream>
 
+#include <ctime>
+
 // Define missing constants for older API levels
 #if __ANDROID_API__ < 13
 #define AMOTION_EVENT_ACTION_HOVER_MOVE 0x00000007
 #define AMOTION_EVENT_ACTION_SCROLL     0x00000008
 #endif
 
+namespace
+{
+////////////////////////////////////////////////////////////
+sf::Time toEventTimestamp(std::int64_t eventTime)
+{
+    // Motion events are timed by the monotonic clock, in nanoseconds
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    const std::int64_t age = static_cast<std::int64_t>(now.tv_sec) * 1'000'000'000 + now.tv_nsec - eventTime;
+    return sf::priv::WindowImpl::getCurrentTimestamp() - sf::microseconds(age / 1000);
+}
+} // namespace
+
 ////////////////////////////////////////////////////////////
 // Private data
 ////////////////////////////////////////////////////////////
@@ -492,10 +508,25 @@ int WindowImplAndroid::processMotionEvent(AInputEvent* inputEvent, ActivityState
             if (states.touchEvents[id].x == x && states.touchEvents[id].y == y)
                 continue;
 
-            const Event::TouchMoved touchMoved{static_cast<unsigned int>(id), {x, y}};
-            event = touchMoved;
+            states.touchEvents[id] = {x, y};
+
+            if (singleInstance == nullptr)
+                continue;
+
+            // The event also holds the positions sampled since the previous one, oldest first
+            const auto        finger      = static_cast<unsigned int>(id);
+            const std::size_t historySize = AMotionEvent_getHistorySize(inputEvent);
+            for (std::size_t h = 0; h < historySize; ++h)
+            {
+                const Vector2i position(static_cast<int>(AMotionEvent_getHistoricalX(inputEvent, p, h)),
+                                        static_cast<int>(AMotionEvent_getHistoricalY(inputEvent, p, h)));
+                const Time timestamp = toEventTimestamp(AMotionEvent_getHistoricalEventTime(inputEvent, h));
+                singleInstance->pushTouchMovement({finger, position, timestamp}, true);
+            }
 
-            states.touchEvents[id] = touchMoved.position;
+            singleInstance->pushTouchMovement({finger, {x, y}, toEventTimestamp(AMotionEvent_getEventTime(inputEvent))},
+                                              false);
+            continue;
         }
 
         forwardEvent(event);
@@ -35,6 +35,8 @@
     defined(SFML_SYSTEM_NETBSD)
 #if defined(SFML_USE_DRM)
 #include <SFML/Window/DRM/ClipboardImpl.hpp>
+#elif defined(SFML_USE_WAYLAND)
+#include <SFML/Window/Wayland/ClipboardImpl.hpp>
 #else
 #include <SFML/Window/Unix/ClipboardImpl.hpp>
 #endif
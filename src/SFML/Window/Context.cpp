@@ -30,6 +30,7 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <future>
 #include <ostream>
 #include <utility>
 
@@ -125,6 +126,21 @@ std::uint64_t Context::getActiveContextId()
 }
 
 
+////////////////////////////////////////////////////////////
+Context::Statistics Context::getStatistics()
+{
+    return priv::GlContext::getStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<bool> Context::preloadAsync(const ContextSettings& settings, unsigned int bitsPerPixel)
+{
+    return std::async(std::launch::async,
+                      [settings, bitsPerPixel] { return priv::GlContext::preload(settings, bitsPerPixel); });
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Context::isExtensionAvailable(std::string_view name)
 {
@@ -35,6 +35,8 @@
     defined(SFML_SYSTEM_NETBSD)
 #if defined(SFML_USE_DRM)
 #include <SFML/Window/DRM/CursorImpl.hpp>
+#elif defined(SFML_USE_WAYLAND)
+#include <SFML/Window/Wayland/CursorImpl.hpp>
 #else
 #include <SFML/Window/Unix/CursorImpl.hpp>
 #endif
@@ -31,12 +31,16 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
 
 #include <fcntl.h>
 #include <poll.h>
 #include <unistd.h>
 #include <xf86drm.h>
 
+#include <optional>
+#include <string_view>
+
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
@@ -57,19 +61,56 @@ struct DrmFb
     std::uint32_t fbId{};
 };
 
-bool            initialized = false;
-sf::priv::Drm   drmNode;
-drmEventContext drmEventCtx{};
-pollfd          pollFD{};
-gbm_device*     gbmDevice      = nullptr;
-int             contextCount   = 0;
-EGLDisplay      display        = EGL_NO_DISPLAY;
-int             waitingForFlip = 0;
+// Identifiers of the KMS objects and properties used by atomic modesetting
+struct AtomicKms
+{
+    bool          enabled{};         // Does the driver support atomic modesetting?
+    std::uint32_t planeId{};         // Primary plane of the CRTC
+    std::uint32_t modeBlobId{};      // Blob holding the video mode
+    std::uint32_t connectorCrtcId{}; // Property "CRTC_ID" of the connector
+    std::uint32_t crtcModeId{};      // Property "MODE_ID" of the CRTC
+    std::uint32_t crtcActive{};      // Property "ACTIVE" of the CRTC
+    std::uint32_t planeFbId{};       // Property "FB_ID" of the plane
+    std::uint32_t planeCrtcId{};     // Property "CRTC_ID" of the plane
+    std::uint32_t planeSrcX{};       // Property "SRC_X" of the plane
+    std::uint32_t planeSrcY{};       // Property "SRC_Y" of the plane
+    std::uint32_t planeSrcW{};       // Property "SRC_W" of the plane
+    std::uint32_t planeSrcH{};       // Property "SRC_H" of the plane
+    std::uint32_t planeCrtcX{};      // Property "CRTC_X" of the plane
+    std::uint32_t planeCrtcY{};      // Property "CRTC_Y" of the plane
+    std::uint32_t planeCrtcW{};      // Property "CRTC_W" of the plane
+    std::uint32_t planeCrtcH{};      // Property "CRTC_H" of the plane
+};
 
-void pageFlipHandler(int /* fd */, unsigned int /* frame */, unsigned int /* sec */, unsigned int /* usec */, void* data)
+bool                                     initialized = false;
+sf::priv::Drm                            drmNode;
+AtomicKms                                atomicKms;
+drmEventContext                          drmEventCtx{};
+pollfd                                   pollFD{};
+gbm_device*                              gbmDevice      = nullptr;
+int                                      contextCount   = 0;
+EGLDisplay                               display        = EGL_NO_DISPLAY;
+int                                      waitingForFlip = 0;
+std::uint64_t                            flipCount      = 0;
+std::optional<sf::Window::PresentTiming> presentTiming;
+
+void pageFlipHandler(int /* fd */, unsigned int frame, unsigned int sec, unsigned int usec, void* data)
 {
     int* temp = static_cast<int*>(data);
     *temp     = 0;
+
+    // The timestamp of the vertical blank is measured by CLOCK_MONOTONIC
+    const drmModeModeInfo& mode = *drmNode.mode;
+
+    sf::Window::PresentTiming timing;
+    timing.lastVerticalBlank  = sf::microseconds(std::int64_t{sec} * 1'000'000 + usec);
+    timing.verticalBlankCount = frame;
+    timing.swapCount          = ++flipCount;
+    timing.refreshRate        = (mode.htotal && mode.vtotal)
+                                    ? static_cast<float>(mode.clock) * 1000.f /
+                                          (static_cast<float>(mode.htotal) * static_cast<float>(mode.vtotal))
+                                    : static_cast<float>(mode.vrefresh);
+    presentTiming = timing;
 }
 
 bool waitForFlip(int timeout)
@@ -110,6 +151,10 @@ void cleanup()
                    1,
                    &drmNode.originalCrtc->mode);
 
+    if (atomicKms.modeBlobId)
+        drmModeDestroyPropertyBlob(drmNode.fileDescriptor, atomicKms.modeBlobId);
+    atomicKms = {};
+
     drmModeFreeConnector(drmNode.savedConnector);
     drmModeFreeEncoder(drmNode.savedEncoder);
     drmModeFreeCrtc(drmNode.originalCrtc);
@@ -130,6 +175,8 @@ void cleanup()
     drmEventCtx = {};
 
     waitingForFlip = 0;
+    flipCount      = 0;
+    presentTiming.reset();
 
     initialized = false;
 }
@@ -434,6 +481,166 @@ int initDrm(sf::priv::Drm& drm, const char* device, const char* modeStr, unsigne
     return 0;
 }
 
+struct Property
+{
+    std::uint32_t id{};    // Identifier of the property, 0 if not found
+    std::uint64_t value{}; // Current value of the property
+};
+
+Property getProperty(int fd, std::uint32_t objectId, std::uint32_t objectType, std::string_view name)
+{
+    Property result;
+
+    drmModeObjectPropertiesPtr properties = drmModeObjectGetProperties(fd, objectId, objectType);
+    if (!properties)
+        return result;
+
+    for (std::uint32_t i = 0; (i < properties->count_props) && !result.id; ++i)
+    {
+        drmModePropertyPtr property = drmModeGetProperty(fd, properties->props[i]);
+        if (property && (std::string_view(property->name) == name))
+        {
+            result.id    = property->prop_id;
+            result.value = properties->prop_values[i];
+        }
+        drmModeFreeProperty(property);
+    }
+
+    drmModeFreeObjectProperties(properties);
+    return result;
+}
+
+std::uint32_t findPrimaryPlane(int fd, std::uint32_t crtcId)
+{
+    // Planes refer to the CRTCs by their index in the resources
+    drmModeResPtr resources = nullptr;
+    if (getResources(fd, resources) < 0)
+        return 0;
+
+    int crtcIndex = -1;
+    for (int i = 0; i < resources->count_crtcs; ++i)
+    {
+        if (resources->crtcs[i] == crtcId)
+            crtcIndex = i;
+    }
+    drmModeFreeResources(resources);
+
+    drmModePlaneResPtr planes = drmModeGetPlaneResources(fd);
+    if (!planes || (crtcIndex < 0))
+    {
+        drmModeFreePlaneResources(planes);
+        return 0;
+    }
+
+    std::uint32_t planeId = 0;
+    for (std::uint32_t i = 0; (i < planes->count_planes) && !planeId; ++i)
+    {
+        drmModePlanePtr plane = drmModeGetPlane(fd, planes->planes[i]);
+        if (plane && (plane->possible_crtcs & (1U << crtcIndex)) &&
+            (getProperty(fd, plane->plane_id, DRM_MODE_OBJECT_PLANE, "type").value == DRM_PLANE_TYPE_PRIMARY))
+            planeId = plane->plane_id;
+        drmModeFreePlane(plane);
+    }
+
+    drmModeFreePlaneResources(planes);
+    return planeId;
+}
+
+bool initAtomic(AtomicKms& kms, const sf::priv::Drm& drm)
+{
+    // Use environment variable "SFML_DRM_LEGACY" to use legacy modesetting even if atomic modesetting is supported
+    const char* legacyString = std::getenv("SFML_DRM_LEGACY");
+    if (legacyString && *legacyString && (std::string_view(legacyString) != "0"))
+        return false;
+
+    if (drmSetClientCap(drm.fileDescriptor, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) ||
+        drmSetClientCap(drm.fileDescriptor, DRM_CLIENT_CAP_ATOMIC, 1))
+        return false;
+
+    kms.planeId = findPrimaryPlane(drm.fileDescriptor, drm.crtcId);
+    if (!kms.planeId)
+        return false;
+
+    const auto connectorProperty = [&drm](std::string_view name)
+    { return getProperty(drm.fileDescriptor, drm.connectorId, DRM_MODE_OBJECT_CONNECTOR, name).id; };
+    const auto crtcProperty = [&drm](std::string_view name)
+    { return getProperty(drm.fileDescriptor, drm.crtcId, DRM_MODE_OBJECT_CRTC, name).id; };
+    const auto planeProperty = [&drm, &kms](std::string_view name)
+    { return getProperty(drm.fileDescriptor, kms.planeId, DRM_MODE_OBJECT_PLANE, name).id; };
+
+    kms.connectorCrtcId = connectorProperty("CRTC_ID");
+    kms.crtcModeId      = crtcProperty("MODE_ID");
+    kms.crtcActive      = crtcProperty("ACTIVE");
+    kms.planeFbId       = planeProperty("FB_ID");
+    kms.planeCrtcId     = planeProperty("CRTC_ID");
+    kms.planeSrcX       = planeProperty("SRC_X");
+    kms.planeSrcY       = planeProperty("SRC_Y");
+    kms.planeSrcW       = planeProperty("SRC_W");
+    kms.planeSrcH       = planeProperty("SRC_H");
+    kms.planeCrtcX      = planeProperty("CRTC_X");
+    kms.planeCrtcY      = planeProperty("CRTC_Y");
+    kms.planeCrtcW      = planeProperty("CRTC_W");
+    kms.planeCrtcH      = planeProperty("CRTC_H");
+
+    for (const std::uint32_t id : {kms.connectorCrtcId,
+                                   kms.crtcModeId,
+                                   kms.crtcActive,
+                                   kms.planeFbId,
+                                   kms.planeCrtcId,
+                                   kms.planeSrcX,
+                                   kms.planeSrcY,
+                                   kms.planeSrcW,
+                                   kms.planeSrcH,
+                                   kms.planeCrtcX,
+                                   kms.planeCrtcY,
+                                   kms.planeCrtcW,
+                                   kms.planeCrtcH})
+    {
+        if (!id)
+            return false;
+    }
+
+    return drmModeCreatePropertyBlob(drm.fileDescriptor, drm.mode, sizeof(*drm.mode), &kms.modeBlobId) == 0;
+}
+
+bool commitAtomic(gbm_bo& bo, std::uint32_t fbId, bool modeset)
+{
+    drmModeAtomicReqPtr request = drmModeAtomicAlloc();
+    if (!request)
+        return false;
+
+    const std::uint32_t crtcId  = drmNode.crtcId;
+    const std::uint32_t planeId = atomicKms.planeId;
+
+    // The first commit sets the mode and blocks, the next ones only flip the buffer at the next vertical blank
+    if (modeset)
+    {
+        drmModeAtomicAddProperty(request, drmNode.connectorId, atomicKms.connectorCrtcId, crtcId);
+        drmModeAtomicAddProperty(request, crtcId, atomicKms.crtcModeId, atomicKms.modeBlobId);
+        drmModeAtomicAddProperty(request, crtcId, atomicKms.crtcActive, 1);
+    }
+
+    // Source coordinates are in 16.16 fixed point
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeFbId, fbId);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeCrtcId, crtcId);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeSrcX, 0);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeSrcY, 0);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeSrcW, std::uint64_t{gbm_bo_get_width(&bo)} << 16);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeSrcH, std::uint64_t{gbm_bo_get_height(&bo)} << 16);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeCrtcX, 0);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeCrtcY, 0);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeCrtcW, drmNode.mode->hdisplay);
+    drmModeAtomicAddProperty(request, planeId, atomicKms.planeCrtcH, drmNode.mode->vdisplay);
+
+    const std::uint32_t flags = modeset ? DRM_MODE_ATOMIC_ALLOW_MODESET
+                                        : (DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT);
+
+    const int result = drmModeAtomicCommit(drmNode.fileDescriptor, request, flags, &waitingForFlip);
+    drmModeAtomicFree(request);
+
+    return result == 0;
+}
+
 void checkInit()
 {
     if (initialized)
@@ -465,6 +672,12 @@ void checkInit()
         return;
     }
 
+    atomicKms.enabled = initAtomic(atomicKms, drmNode);
+
+#ifdef SFML_DEBUG
+    sf::err() << "DRM using " << (atomicKms.enabled ? "atomic" : "legacy") << " modesetting" << std::endl;
+#endif
+
     gbmDevice = gbm_create_device(drmNode.fileDescriptor);
 
     std::atexit(cleanup);
@@ -598,11 +811,15 @@ DRMContext::~DRMContext()
         m_surface = EGL_NO_SURFACE;
     }
 
-    if (m_currentBO)
-        gbm_surface_release_buffer(m_gbmSurface, m_currentBO);
-
+    // Let the pending flip complete before releasing the buffers
     if (m_nextBO)
-        gbm_surface_release_buffer(m_gbmSurface, m_nextBO);
+        waitForFlip(100);
+
+    for (gbm_bo* bo : {m_currentBO, m_nextBO, m_queuedBO})
+    {
+        if (bo)
+            gbm_surface_release_buffer(m_gbmSurface, bo);
+    }
 
     if (m_gbmSurface)
         gbm_surface_destroy(m_gbmSurface);
@@ -634,56 +851,159 @@ void DRMContext::display()
         return;
     }
 
-    // Handle display of buffer to the screen
-    DrmFb* fb = nullptr;
+    // Make sure there is a buffer left to render the next frame to
+    if (!gbm_surface_has_free_buffers(m_gbmSurface) && !processFlips(-1))
+        return;
+
+    eglCheck(eglSwapBuffers(m_display, m_surface));
+
+    // This call must be preceded by a single call to eglSwapBuffers()
+    gbm_bo* bo = gbm_surface_lock_front_buffer(m_gbmSurface);
 
-    if (!waitForFlip(-1))
+    if (!bo)
         return;
 
-    if (m_currentBO)
+    if (!processFlips(0))
     {
-        gbm_surface_release_buffer(m_gbmSurface, m_currentBO);
-        m_currentBO = nullptr;
+        // A newer frame replaces the queued one
+        if (m_queuedBO)
+        {
+            gbm_surface_release_buffer(m_gbmSurface, m_queuedBO);
+            m_queuedBO = nullptr;
+        }
+
+        // Without vertical synchronization, queue the frame and return immediately (mailbox)
+        if (!m_verticalSync && gbm_surface_has_free_buffers(m_gbmSurface))
+        {
+            m_queuedBO = bo;
+            return;
+        }
+
+        if (!processFlips(-1))
+        {
+            gbm_surface_release_buffer(m_gbmSurface, bo);
+            return;
+        }
     }
 
-    eglCheck(eglSwapBuffers(m_display, m_surface));
+    present(*bo);
+}
 
-    m_currentBO = m_nextBO;
 
-    // This call must be preceded by a single call to eglSwapBuffers()
-    m_nextBO = gbm_surface_lock_front_buffer(m_gbmSurface);
+////////////////////////////////////////////////////////////
+void DRMContext::setVerticalSyncEnabled(bool enabled)
+{
+    m_verticalSync = enabled;
+
+    eglCheck(eglSwapInterval(m_display, enabled ? 1 : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool DRMContext::setSwapInterval(int interval)
+{
+    if ((interval < 0) || (interval > 1))
+        return false;
+
+    setVerticalSyncEnabled(interval == 1);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> DRMContext::getPresentTiming()
+{
+    if (!m_scanOut)
+        return std::nullopt;
+
+    // Handle the flip events that arrived since the last frame
+    processFlips(0);
+    return presentTiming;
+}
+
 
+////////////////////////////////////////////////////////////
+bool DRMContext::processFlips(int timeout)
+{
     if (!m_nextBO)
-        return;
+        return true;
+
+    waitForFlip(timeout);
+
+    if (waitingForFlip)
+        return false;
+
+    // The pending buffer is now on the screen, the previous one can be reused
+    if (m_currentBO)
+        gbm_surface_release_buffer(m_gbmSurface, m_currentBO);
+
+    m_currentBO = m_nextBO;
+    m_nextBO    = nullptr;
+
+    if (m_queuedBO)
+    {
+        gbm_bo* bo = m_queuedBO;
+        m_queuedBO = nullptr;
+        present(*bo);
+    }
+
+    return !m_nextBO;
+}
+
 
-    fb = drmFbGetFromBo(*m_nextBO);
+////////////////////////////////////////////////////////////
+void DRMContext::present(gbm_bo& bo)
+{
+    const DrmFb* fb = drmFbGetFromBo(bo);
     if (!fb)
     {
         err() << "Failed to get FB from buffer object" << std::endl;
+        gbm_surface_release_buffer(m_gbmSurface, &bo);
         return;
     }
 
-    // If first time, need to first call drmModeSetCrtc()
+    // If first time, need to first set the mode
     if (!m_shown)
     {
-        if (drmModeSetCrtc(drmNode.fileDescriptor, drmNode.crtcId, fb->fbId, 0, 0, &drmNode.connectorId, 1, drmNode.mode))
+        const bool modeSet = atomicKms.enabled ? commitAtomic(bo, fb->fbId, true)
+                                               : !drmModeSetCrtc(drmNode.fileDescriptor,
+                                                                 drmNode.crtcId,
+                                                                 fb->fbId,
+                                                                 0,
+                                                                 0,
+                                                                 &drmNode.connectorId,
+                                                                 1,
+                                                                 drmNode.mode);
+        if (!modeSet)
         {
             err() << "Failed to set mode: " << std::strerror(errno) << std::endl;
             std::abort();
         }
+
         m_shown = true;
+
+        if (m_currentBO)
+            gbm_surface_release_buffer(m_gbmSurface, m_currentBO);
+        m_currentBO = &bo;
+        return;
     }
 
     // Do page flip
-    if (!drmModePageFlip(drmNode.fileDescriptor, drmNode.crtcId, fb->fbId, DRM_MODE_PAGE_FLIP_EVENT, &waitingForFlip))
-        waitingForFlip = 1;
-}
-
+    const bool flipped = atomicKms.enabled ? commitAtomic(bo, fb->fbId, false)
+                                           : !drmModePageFlip(drmNode.fileDescriptor,
+                                                              drmNode.crtcId,
+                                                              fb->fbId,
+                                                              DRM_MODE_PAGE_FLIP_EVENT,
+                                                              &waitingForFlip);
+    if (!flipped)
+    {
+        err() << "Failed to flip page: " << std::strerror(errno) << std::endl;
+        gbm_surface_release_buffer(m_gbmSurface, &bo);
+        return;
+    }
 
-////////////////////////////////////////////////////////////
-void DRMContext::setVerticalSyncEnabled(bool enabled)
-{
-    eglCheck(eglSwapInterval(m_display, enabled ? 1 : 0));
+    waitingForFlip = 1;
+    m_nextBO       = &bo;
 }
 
 
@@ -125,6 +125,26 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks between two swaps
+    ///
+    /// Only 0 (mailbox) and 1 (vertical synchronization) are supported.
+    ///
+    /// \param interval Swap interval
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the last page flip
+    ///
+    /// \return Present timing, or an empty optional if the context doesn't scan out
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Create the EGL context
     ///
@@ -193,6 +213,30 @@ private:
     ////////////////////////////////////////////////////////////
     void updateSettings();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Retire the completed page flip, if any
+    ///
+    /// When a flip completes, the buffer it replaced is released
+    /// and the buffer queued in the meantime is submitted.
+    ///
+    /// \param timeout Maximum time to wait for the flip, in milliseconds (-1 to wait forever)
+    ///
+    /// \return True if no page flip is pending anymore
+    ///
+    ////////////////////////////////////////////////////////////
+    bool processFlips(int timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit a buffer to the screen
+    ///
+    /// The first buffer sets the mode, the next ones are flipped
+    /// at the next vertical blank without blocking.
+    ///
+    /// \param bo Locked front buffer to show
+    ///
+    ////////////////////////////////////////////////////////////
+    void present(gbm_bo& bo);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -201,12 +245,14 @@ private:
     EGLSurface m_surface{EGL_NO_SURFACE}; ///< The internal EGL surface
     EGLConfig  m_config{};                ///< The internal EGL config
 
-    gbm_bo*      m_currentBO{};
-    gbm_bo*      m_nextBO{};
-    gbm_surface* m_gbmSurface{};
-    Vector2u     m_size;
-    bool         m_shown{};
-    bool         m_scanOut{};
+    gbm_bo*      m_currentBO{};        ///< Buffer on the screen
+    gbm_bo*      m_nextBO{};           ///< Buffer of the pending page flip
+    gbm_bo*      m_queuedBO{};         ///< Latest buffer waiting for the pending flip to complete
+    gbm_surface* m_gbmSurface{};       ///< GBM surface the EGL surface renders to
+    Vector2u     m_size;               ///< Size of the surface
+    bool         m_shown{};            ///< Has the mode been set?
+    bool         m_scanOut{};          ///< Is the surface presented to the screen?
+    bool         m_verticalSync{true}; ///< Wait for the pending flip instead of replacing the queued buffer?
 };
 
 } // namespace sf::priv
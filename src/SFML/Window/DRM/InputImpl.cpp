@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/InputImpl.hpp>
+#include <SFML/Window/WindowImpl.hpp>
 
 #include <SFML/System/EnumArray.hpp>
 #include <SFML/System/Err.hpp>
@@ -44,9 +45,11 @@
 #include <vector>
 
 #include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
 
 
 namespace
@@ -69,6 +72,8 @@ int                    touchFd = -1;    // file descriptor we have seen MT event
 std::vector<TouchSlot> touchSlots;      // track the state of each touch "slot"
 int                    currentSlot = 0; // which slot are we currently updating?
 
+std::optional<sf::Time> lastEventTimestamp; // timestamp of the last input_event read
+
 std::queue<sf::Event> eventQueue;    // events received and waiting to be consumed
 const int             maxQueue = 64; // The maximum size we let eventQueue grow to
 
@@ -159,7 +164,13 @@ void initFileDescriptors()
         }
 
         if (keepFileDescriptor(tempFD))
+        {
+            // Timestamp the events with the monotonic clock rather than the wall clock
+            int clockId = CLOCK_MONOTONIC;
+            ioctl(tempFD, EVIOCSCLOCKID, &clockId);
+
             fileDescriptors.push_back(tempFD);
+        }
         else
             close(tempFD);
     }
@@ -306,12 +317,35 @@ sf::Keyboard::Key toKey(int code)
     }
 }
 
+std::optional<sf::Time> toTimestamp(const timeval& time)
+{
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    const std::int64_t nowMicroseconds   = std::int64_t{now.tv_sec} * 1000000 + now.tv_nsec / 1000;
+    const std::int64_t eventMicroseconds = std::int64_t{time.tv_sec} * 1000000 + time.tv_usec;
+    const sf::Time     age               = sf::microseconds(nowMicroseconds - eventMicroseconds);
+
+    // Reject the events of devices which kept timestamping with the wall clock
+    if ((age < sf::Time::Zero) || (age > sf::seconds(60)))
+        return std::nullopt;
+
+    return sf::priv::WindowImpl::getCurrentTimestamp() - age;
+}
+
+void stampEvent(sf::Event& event)
+{
+    if (lastEventTimestamp)
+        event.setTimestamp(*lastEventTimestamp);
+}
+
 void pushEvent(const sf::Event& event)
 {
     if (eventQueue.size() >= maxQueue)
         eventQueue.pop();
 
     eventQueue.push(event);
+    stampEvent(eventQueue.back());
 }
 
 TouchSlot& atSlot(int idx)
@@ -368,6 +402,8 @@ bool eventProcess(sf::Event& event)
 
         while (bytesRead > 0)
         {
+            lastEventTimestamp = toTimestamp(inputEvent.time);
+
             if (inputEvent.type == EV_KEY)
             {
                 if (const std::optional<sf::Mouse::Button> mb = toMouseButton(inputEvent.code))
@@ -492,6 +528,7 @@ bool eventProcess(sf::Event& event)
     // Finally check if there is a Text event on stdin
     //
     // We only clear the ICANON flag for the time of reading
+    lastEventTimestamp.reset();
 
     newTerminalConfig.c_lflag &= ~static_cast<tcflag_t>(ICANON);
     tcsetattr(STDIN_FILENO, TCSANOW, &newTerminalConfig);
@@ -622,6 +659,33 @@ bool isMouseButtonPressed(Mouse::Button button)
 }
 
 
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    const std::lock_guard lock(inputMutex);
+    update();
+
+    for (unsigned int i = 0; i < Keyboard::KeyCount; ++i)
+        keys[i] = keyMap[static_cast<Keyboard::Key>(i)];
+
+    // Scancodes are not implemented for DRM
+    scancodes.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* /* relativeTo */)
+{
+    const std::lock_guard lock(inputMutex);
+    update();
+
+    for (unsigned int i = 0; i < Mouse::ButtonCount; ++i)
+        buttons[i] = mouseMap[static_cast<Mouse::Button>(i)];
+
+    position = mousePos;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i getMousePosition()
 {
@@ -695,6 +759,7 @@ bool checkEvent(Event& event)
 
     if (eventProcess(event))
     {
+        stampEvent(event);
         return true;
     }
     else
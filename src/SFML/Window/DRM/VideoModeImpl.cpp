@@ -30,6 +30,8 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <string>
+
 
 namespace sf::priv
 {
@@ -64,4 +66,29 @@ VideoMode VideoModeImpl::getDesktopMode()
         return VideoMode({0, 0});
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    // Only the connector used by SFML is reported
+    const Drm& drm = DRMContext::getDRM();
+
+    Monitor monitor;
+    monitor.name    = "connector " + std::to_string(drm.connectorId);
+    monitor.mode    = getDesktopMode();
+    monitor.primary = true;
+    if (drm.mode)
+        monitor.refreshRate = static_cast<float>(drm.mode->vrefresh);
+
+    return {monitor};
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // The mode is only changed by SFML itself
+    return false;
+}
+
 } // namespace sf::priv
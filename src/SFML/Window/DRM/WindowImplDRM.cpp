@@ -84,6 +84,9 @@ m_size(mode.size)
 ////////////////////////////////////////////////////////////
 WindowImplDRM::~WindowImplDRM()
 {
+    // The event thread calls processEvents(), stop it while this object is still alive
+    (void)setEventThreadEnabled(false);
+
     InputImpl::restoreTerminalConfig();
 }
 
@@ -195,4 +198,12 @@ void WindowImplDRM::processEvents()
         pushEvent(event);
 }
 
+
+////////////////////////////////////////////////////////////
+bool WindowImplDRM::supportsEventThread() const
+{
+    // The input state is protected by a mutex in InputImpl
+    return true;
+}
+
 } // namespace sf::priv
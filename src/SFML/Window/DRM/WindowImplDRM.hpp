@@ -204,6 +204,14 @@ protected:
     ////////////////////////////////////////////////////////////
     void processEvents() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether processEvents() may be called from another thread
+    ///
+    /// \return Always true, the DRM input handling is thread-safe
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool supportsEventThread() const override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -29,13 +29,22 @@
 #include <SFML/Window/EglContext.hpp>
 #include <SFML/Window/WindowImpl.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Sleep.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string_view>
+#include <vector>
+
+#include <cstdlib>
+#include <cstring>
 #ifdef SFML_SYSTEM_ANDROID
+#include <SFML/Window/Android/FramePacerAndroid.hpp>
+
 #include <SFML/System/Android/Activity.hpp>
 #endif
 #if defined(SFML_SYSTEM_LINUX) && !defined(SFML_USE_DRM)
@@ -57,6 +66,132 @@ namespace
 // A nested named namespace is used here to allow unity builds of SFML.
 namespace EglContextImpl
 {
+// Platform tokens of EGL_EXT_platform_device and EGL_MESA_platform_surfaceless
+constexpr EGLenum platformDevice      = 0x313F;
+constexpr EGLenum platformSurfaceless = 0x31DD;
+
+// Attribute of EGL_EXT_buffer_age
+constexpr EGLint bufferAge = 0x313D;
+
+using SwapBuffersWithDamage = EGLBoolean (*)(EGLDisplay, EGLSurface, const EGLint*, EGLint);
+
+// Whether the display was created on a headless platform
+bool headless = false;
+
+
+////////////////////////////////////////////////////////////
+bool hasExtension(EGLDisplay display, std::string_view name)
+{
+    const char* extensionString = eglQueryString(display, EGL_EXTENSIONS);
+    if (!extensionString)
+        return false;
+
+    const std::string_view extensions(extensionString);
+    for (std::size_t begin = 0; begin < extensions.size();)
+    {
+        const std::size_t end = std::min(extensions.find(' ', begin), extensions.size());
+        if (extensions.substr(begin, end - begin) == name)
+            return true;
+        begin = end + 1;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+SwapBuffersWithDamage getSwapBuffersWithDamage(EGLDisplay display)
+{
+    // The KHR and EXT extensions define the same function
+    if (hasExtension(display, "EGL_KHR_swap_buffers_with_damage"))
+        return reinterpret_cast<SwapBuffersWithDamage>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+
+    if (hasExtension(display, "EGL_EXT_swap_buffers_with_damage"))
+        return reinterpret_cast<SwapBuffersWithDamage>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+EGLDisplay getHeadlessDisplay()
+{
+    // Use environment variable "SFML_EGL_PLATFORM" to render without a display server:
+    // "surfaceless" selects EGL_MESA_platform_surfaceless, "device" selects EGL_EXT_platform_device
+    // EglContext is only used by SFML_OPENGL_ES builds, GlxContext and DRMContext don't read this variable
+    const char* platformString = std::getenv("SFML_EGL_PLATFORM");
+    if (!platformString || !*platformString)
+        return EGL_NO_DISPLAY;
+
+    using GetPlatformDisplayEXT = EGLDisplay (*)(EGLenum, void*, const EGLint*);
+    using QueryDevicesEXT       = EGLBoolean (*)(EGLint, EGLDeviceEXT*, EGLint*);
+
+    // Client extensions are queried without a display
+    if (!hasExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_base"))
+    {
+        sf::err() << "Headless EGL platform requested, but EGL_EXT_platform_base is not supported" << std::endl;
+        return EGL_NO_DISPLAY;
+    }
+
+    const auto getPlatformDisplay = reinterpret_cast<GetPlatformDisplayEXT>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+    if (std::strcmp(platformString, "surfaceless") == 0)
+    {
+        if (!hasExtension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+        {
+            sf::err() << "EGL_MESA_platform_surfaceless is not supported" << std::endl;
+            return EGL_NO_DISPLAY;
+        }
+
+        return getPlatformDisplay(platformSurfaceless, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+
+    if (std::strcmp(platformString, "device") == 0)
+    {
+        if (!hasExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_device") ||
+            !(hasExtension(EGL_NO_DISPLAY, "EGL_EXT_device_enumeration") ||
+              hasExtension(EGL_NO_DISPLAY, "EGL_EXT_device_base")))
+        {
+            sf::err() << "EGL_EXT_platform_device is not supported" << std::endl;
+            return EGL_NO_DISPLAY;
+        }
+
+        const auto queryDevices = reinterpret_cast<QueryDevicesEXT>(eglGetProcAddress("eglQueryDevicesEXT"));
+
+        EGLint deviceCount = 0;
+        if (!queryDevices || !queryDevices(0, nullptr, &deviceCount) || deviceCount <= 0)
+        {
+            sf::err() << "No EGL device available" << std::endl;
+            return EGL_NO_DISPLAY;
+        }
+
+        std::vector<EGLDeviceEXT> devices(static_cast<std::size_t>(deviceCount));
+        queryDevices(deviceCount, devices.data(), &deviceCount);
+
+        // Use environment variable "SFML_EGL_DEVICE" to select the GPU (or the first one if not set)
+        std::size_t index        = 0;
+        const char* deviceString = std::getenv("SFML_EGL_DEVICE");
+
+        if (deviceString && *deviceString)
+            index = static_cast<std::size_t>(std::strtoul(deviceString, nullptr, 10));
+
+        if (index >= static_cast<std::size_t>(deviceCount))
+        {
+            sf::err() << "EGL device " << index << " requested, but only " << deviceCount << " are available"
+                      << std::endl;
+            return EGL_NO_DISPLAY;
+        }
+
+        return getPlatformDisplay(platformDevice, devices[index], nullptr);
+    }
+
+    sf::err() << "Unknown EGL platform \"" << platformString << "\" requested" << std::endl;
+    return EGL_NO_DISPLAY;
+}
+
+
+////////////////////////////////////////////////////////////
 EGLDisplay getInitializedDisplay()
 {
 #if defined(SFML_SYSTEM_ANDROID)
@@ -73,7 +208,12 @@ EGLDisplay getInitializedDisplay()
 
     if (display == EGL_NO_DISPLAY)
     {
-        eglCheck(display = eglGetDisplay(EGL_DEFAULT_DISPLAY));
+        display  = getHeadlessDisplay();
+        headless = (display != EGL_NO_DISPLAY);
+
+        if (!headless)
+            eglCheck(display = eglGetDisplay(EGL_DEFAULT_DISPLAY));
+
         eglCheck(eglInitialize(display, nullptr, nullptr));
     }
 
@@ -81,6 +221,14 @@ EGLDisplay getInitializedDisplay()
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int getDefaultBitsPerPixel()
+{
+    // There is no desktop to query without a display server
+    return headless ? 32 : sf::VideoMode::getDesktopMode().bitsPerPixel;
+}
+
+
 ////////////////////////////////////////////////////////////
 void ensureInit()
 {
@@ -121,14 +269,23 @@ EglContext::EglContext(EglContext* shared)
     m_display = EglContextImpl::getInitializedDisplay();
 
     // Get the best EGL config matching the default video settings
-    m_config = getBestConfig(m_display, VideoMode::getDesktopMode().bitsPerPixel, ContextSettings());
+    m_config = getBestConfig(m_display, EglContextImpl::getDefaultBitsPerPixel(), ContextSettings());
     updateSettings();
 
-    // Note: The EGL specs say that attribList can be a null pointer when passed to eglCreatePbufferSurface,
-    // but this is resulting in a segfault. Bug in Android?
-    EGLint attribList[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    // Headless contexts only render to framebuffer objects, so they don't need a surface if the
+    // display supports it; otherwise a dummy pbuffer is used
+    if (EglContextImpl::headless && EglContextImpl::hasExtension(m_display, "EGL_KHR_surfaceless_context"))
+    {
+        m_surfaceless = true;
+    }
+    else
+    {
+        // Note: The EGL specs say that attribList can be a null pointer when passed to eglCreatePbufferSurface,
+        // but this is resulting in a segfault. Bug in Android?
+        EGLint attribList[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
 
-    eglCheck(m_surface = eglCreatePbufferSurface(m_display, m_config, attribList));
+        eglCheck(m_surface = eglCreatePbufferSurface(m_display, m_config, attribList));
+    }
 
     // Create EGL context
     createContext(shared);
@@ -163,6 +320,11 @@ EglContext::EglContext(EglContext*                        shared,
     // Create EGL context
     createContext(shared);
 
+#ifdef SFML_SYSTEM_ANDROID
+    // Windows are created on the main thread, whose looper dispatches the vertical blanks
+    m_pacer = std::make_unique<FramePacerAndroid>(m_display);
+#endif
+
 #if !defined(SFML_SYSTEM_ANDROID)
     // Create EGL surface (except on Android because the window is created
     // asynchronously, its activity manager will call it for us)
@@ -173,13 +335,24 @@ EglContext::EglContext(EglContext*                        shared,
 
 
 ////////////////////////////////////////////////////////////
-EglContext::EglContext(EglContext* /*shared*/, const ContextSettings& /*settings*/, const Vector2u& /*size*/)
+EglContext::EglContext(EglContext* shared, const ContextSettings& settings, const Vector2u& size)
 {
     EglContextImpl::ensureInit();
 
-    sf::err() << "Warning: context has not been initialized. The constructor EglContext(shared, settings, size) is "
-                 "currently not implemented."
-              << std::endl;
+    // Get the initialized EGL display
+    m_display = EglContextImpl::getInitializedDisplay();
+
+    // Get the best EGL config matching the requested settings
+    m_config = getBestConfig(m_display, EglContextImpl::getDefaultBitsPerPixel(), settings);
+    updateSettings();
+
+    // Create a pbuffer of the requested size as the rendering target
+    EGLint attribList[] = {EGL_WIDTH, static_cast<EGLint>(size.x), EGL_HEIGHT, static_cast<EGLint>(size.y), EGL_NONE};
+
+    eglCheck(m_surface = eglCreatePbufferSurface(m_display, m_config, attribList));
+
+    // Create EGL context
+    createContext(shared);
 }
 
 
@@ -224,7 +397,7 @@ GlFunctionPointer EglContext::getFunction(const char* name)
 ////////////////////////////////////////////////////////////
 bool EglContext::makeCurrent(bool current)
 {
-    if (m_surface == EGL_NO_SURFACE)
+    if ((m_surface == EGL_NO_SURFACE) && !m_surfaceless)
         return false;
 
     EGLBoolean result = EGL_FALSE;
@@ -245,18 +418,90 @@ bool EglContext::makeCurrent(bool current)
 ////////////////////////////////////////////////////////////
 void EglContext::display()
 {
-    if (m_surface != EGL_NO_SURFACE)
+    displayDamage({});
+}
+
+
+////////////////////////////////////////////////////////////
+void EglContext::displayDamage(const std::vector<int>& damage)
+{
+    if (m_surface == EGL_NO_SURFACE)
+        return;
+
+    static const auto swapBuffersWithDamage = EglContextImpl::getSwapBuffersWithDamage(m_display);
+
+#ifdef SFML_SYSTEM_ANDROID
+    if (m_pacer)
+        m_pacer->beforeSwap();
+#endif
+
+    if (!damage.empty() && swapBuffersWithDamage)
+        eglCheck(swapBuffersWithDamage(m_display, m_surface, damage.data(), static_cast<EGLint>(damage.size() / 4)));
+    else
         eglCheck(eglSwapBuffers(m_display, m_surface));
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int EglContext::getBufferAge()
+{
+    if ((m_surface == EGL_NO_SURFACE) || !EglContextImpl::hasExtension(m_display, "EGL_EXT_buffer_age"))
+        return 0;
+
+    EGLint age = 0;
+    eglCheck(eglQuerySurface(m_display, m_surface, EglContextImpl::bufferAge, &age));
+    return static_cast<unsigned int>(std::max(age, 0));
+}
+
+
 ////////////////////////////////////////////////////////////
 void EglContext::setVerticalSyncEnabled(bool enabled)
 {
+#ifdef SFML_SYSTEM_ANDROID
+    if (m_pacer)
+        (void)m_pacer->setSwapInterval(enabled ? 1 : 0);
+#endif
+
     eglCheck(eglSwapInterval(m_display, enabled ? 1 : 0));
 }
 
 
+////////////////////////////////////////////////////////////
+bool EglContext::setSwapInterval(int interval)
+{
+    // EGL has no adaptive synchronization
+    if (interval < 0)
+        return false;
+
+#ifdef SFML_SYSTEM_ANDROID
+    // When the pacer schedules the frames, EGL only has to wait for the next vertical blank
+    if (m_pacer && m_pacer->setSwapInterval(interval))
+        return eglSwapInterval(m_display, std::min(interval, 1)) == EGL_TRUE;
+#endif
+
+    return eglSwapInterval(m_display, interval) == EGL_TRUE;
+}
+
+
+#ifdef SFML_SYSTEM_ANDROID
+////////////////////////////////////////////////////////////
+bool EglContext::setTargetFrameRate(unsigned int frameRate)
+{
+    if (m_pacer && m_pacer->setTargetFrameRate(frameRate))
+        return eglSwapInterval(m_display, 1) == EGL_TRUE;
+
+    return GlContext::setTargetFrameRate(frameRate);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> EglContext::getPresentTiming()
+{
+    return m_pacer ? m_pacer->getPresentTiming() : std::nullopt;
+}
+#endif
+
+
 ////////////////////////////////////////////////////////////
 void EglContext::createContext(EglContext* shared)
 {
@@ -281,6 +526,11 @@ void EglContext::createContext(EglContext* shared)
 void EglContext::createSurface(EGLNativeWindowType window)
 {
     eglCheck(m_surface = eglCreateWindowSurface(m_display, m_config, window, nullptr));
+
+#ifdef SFML_SYSTEM_ANDROID
+    if (m_pacer)
+        m_pacer->setSurface(window, m_surface);
+#endif
 }
 
 
@@ -290,6 +540,11 @@ void EglContext::destroySurface()
     // Ensure that this context is no longer active since our surface is going to be destroyed
     setActive(false);
 
+#ifdef SFML_SYSTEM_ANDROID
+    if (m_pacer)
+        m_pacer->setSurface(nullptr, EGL_NO_SURFACE);
+#endif
+
     eglCheck(eglDestroySurface(m_display, m_surface));
     m_surface = EGL_NO_SURFACE;
 }
@@ -300,6 +555,8 @@ EGLConfig EglContext::getBestConfig(EGLDisplay display, unsigned int bitsPerPixe
 {
     EglContextImpl::ensureInit();
 
+    const Clock clock;
+
     // Determine the number of available configs
     EGLint configCount = 0;
     eglCheck(eglGetConfigs(display, nullptr, 0, &configCount));
@@ -364,6 +621,8 @@ EGLConfig EglContext::getBestConfig(EGLDisplay display, unsigned int bitsPerPixe
 
     assert(bestScore < 0x7FFFFFFF && "Failed to calculate best config");
 
+    recordFormatSelection(clock.getElapsedTime(), false);
+
     return bestConfig;
 }
 
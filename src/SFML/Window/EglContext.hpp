@@ -39,8 +39,15 @@
 #include <X11/Xutil.h>
 #endif
 
+#include <memory>
+#include <vector>
+
 namespace sf::priv
 {
+#ifdef SFML_SYSTEM_ANDROID
+class FramePacerAndroid;
+#endif
+
 class EglContext : public GlContext
 {
 public:
@@ -65,7 +72,6 @@ public:
 
     ////////////////////////////////////////////////////////////
     /// \brief Create a new context that embeds its own rendering target
-    /// \warning This constructor is currently not implemented; use a different overload.
     ///
     /// \param shared   Context to share the new one with
     /// \param settings Creation parameters
@@ -107,6 +113,29 @@ public:
     ////////////////////////////////////////////////////////////
     void display() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Display the damaged regions of what has been rendered so far
+    ///
+    /// This requires EGL_KHR_swap_buffers_with_damage or
+    /// EGL_EXT_swap_buffers_with_damage, otherwise the whole
+    /// surface is displayed.
+    ///
+    /// \param damage Damaged rectangles as consecutive x, y, width and height,
+    ///               with the origin at the bottom-left corner of the surface
+    ///
+    ////////////////////////////////////////////////////////////
+    void displayDamage(const std::vector<int>& damage) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the age of the back buffer
+    ///
+    /// This requires EGL_EXT_buffer_age.
+    ///
+    /// \return Number of frames since the back buffer was displayed, 0 if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBufferAge() override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable vertical synchronization
     ///
@@ -120,6 +149,36 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when swapping buffers
+    ///
+    /// \param interval Number of vertical blanks, negative for adaptive synchronization
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+#ifdef SFML_SYSTEM_ANDROID
+    ////////////////////////////////////////////////////////////
+    /// \brief Pace the displayed frames to a target frame rate
+    ///
+    /// \param frameRate Target number of frames per second, 0 to display a frame at each vertical blank
+    ///
+    /// \return True if the frames are paced, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTargetFrameRate(unsigned int frameRate) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+#endif
+
     ////////////////////////////////////////////////////////////
     /// \brief Create the context
     ///
@@ -189,6 +248,10 @@ private:
     EGLContext m_context{EGL_NO_CONTEXT}; //!< The internal EGL context
     EGLSurface m_surface{EGL_NO_SURFACE}; //!< The internal EGL surface
     EGLConfig  m_config{};                //!< The internal EGL config
+    bool       m_surfaceless{};           //!< Whether the context is made current without a surface
+#ifdef SFML_SYSTEM_ANDROID
+    std::unique_ptr<FramePacerAndroid> m_pacer; //!< Schedules the frames of the window
+#endif
 };
 
 } // namespace sf::priv
@@ -29,18 +29,21 @@
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/GlContext.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 
 #include <glad/gl.h>
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <iomanip>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -73,6 +76,11 @@ using ContextType = sf::priv::WglContext;
 #include <SFML/Window/DRM/DRMContext.hpp>
 using ContextType = sf::priv::DRMContext;
 
+#elif defined(SFML_USE_WAYLAND)
+
+#include <SFML/Window/Wayland/WaylandContext.hpp>
+using ContextType = sf::priv::WaylandContext;
+
 #elif defined(SFML_OPENGL_ES)
 
 #include <SFML/Window/EglContext.hpp>
@@ -187,6 +195,70 @@ private:
     // Private constructor to prevent CurrentContext from being constructed outside of get()
     CurrentContext() = default;
 };
+
+// Counters of the context activity of all the threads
+std::atomic<std::uint64_t> contextSwitches{};
+std::atomic<std::uint64_t> redundantActivations{};
+std::atomic<std::int64_t>  creationTime{};  // Shared context creation, in microseconds
+std::atomic<std::int64_t>  selectionTime{}; // Pixel format selection, in microseconds
+std::atomic<std::uint64_t> formatCacheHits{};
+
+// Tell whether the context type can select the pixel format of a window before the window exists
+template <typename T, typename = void>
+struct HasPixelFormatProbe : std::false_type
+{
+};
+
+template <typename T>
+struct HasPixelFormatProbe<T, std::void_t<decltype(T::probePixelFormat(0u, sf::ContextSettings{}))>> : std::true_type
+{
+};
+
+// Tell whether the context type can render to a window with the native context of another window
+template <typename T, typename = void>
+struct HasWindowContextSharing : std::false_type
+{
+};
+
+template <typename T>
+struct HasWindowContextSharing<
+    T,
+    std::void_t<decltype(T::shareWindowContext(std::declval<T&>(), std::declval<const sf::priv::WindowImpl&>(), 0u))>>
+    : std::true_type
+{
+};
+
+// Create a context rendering to a window with the native context of another window, if the context type supports it
+template <typename T>
+std::unique_ptr<T> shareWindowContext(sf::priv::GlContext&        context,
+                                      const sf::priv::WindowImpl& owner,
+                                      unsigned int                bitsPerPixel)
+{
+    if constexpr (HasWindowContextSharing<T>::value)
+        return T::shareWindowContext(static_cast<T&>(context), owner, bitsPerPixel);
+    else
+        return nullptr;
+}
+
+// Window contexts created with ContextSettings::sharedWindowContext, whose native context new windows can reuse
+struct WindowContext
+{
+    sf::priv::GlContext* context{};
+    sf::ContextSettings  settings;
+    unsigned int         bitsPerPixel{};
+};
+
+std::mutex                 windowContextsMutex;
+std::vector<WindowContext> windowContexts;
+
+// Tell whether two windows were requested with the same context settings
+bool isSameRequest(const sf::ContextSettings& left, const sf::ContextSettings& right)
+{
+    return (left.depthBits == right.depthBits) && (left.stencilBits == right.stencilBits) &&
+           (left.antialiasingLevel == right.antialiasingLevel) && (left.majorVersion == right.majorVersion) &&
+           (left.minorVersion == right.minorVersion) && (left.attributeFlags == right.attributeFlags) &&
+           (left.sRgbCapable == right.sRgbCapable);
+}
 } // namespace GlContextImpl
 } // namespace
 
@@ -208,8 +280,7 @@ struct GlContext::SharedContext
         context.emplace(nullptr);
         context->initialize(ContextSettings{});
 
-        loadExtensions();
-
+        // The extensions list is only loaded once it is queried, to keep it off the startup path
         context->setActive(false);
     }
 
@@ -235,18 +306,73 @@ struct GlContext::SharedContext
     ////////////////////////////////////////////////////////////
     static std::shared_ptr<SharedContext> get()
     {
+        // A context may be preloaded on another thread while a window is created
+        static std::recursive_mutex creationMutex;
+        const std::lock_guard       lock(creationMutex);
+
         auto& weakSharedContext = getWeakPtr();
         auto  sharedContext     = weakSharedContext.lock();
 
         if (!sharedContext)
         {
+            const Clock clock;
+
             sharedContext     = std::make_shared<GlContext::SharedContext>();
             weakSharedContext = sharedContext;
+
+            GlContextImpl::creationTime.fetch_add(clock.getElapsedTime().asMicroseconds(), std::memory_order_relaxed);
         }
 
         return sharedContext;
     }
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shared context kept alive by a preload
+    ///
+    /// It is released by the next context creation, which then
+    /// holds the shared context by itself.
+    ///
+    /// \return shared_ptr to the preloaded shared context, may be null
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::shared_ptr<SharedContext>& getPreloaded()
+    {
+        // Construct the weak_ptr first so that it outlives the preloaded context
+        getWeakPtr();
+
+        static std::shared_ptr<SharedContext> preloadedSharedContext;
+        return preloadedSharedContext;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Re-create the shared context as a core context if requested
+    ///
+    /// Must be called with the mutex locked, while no other context shares it.
+    ///
+    /// \param settings Requested context settings
+    ///
+    ////////////////////////////////////////////////////////////
+    void convertToCore(const ContextSettings& settings)
+    {
+        if (!(settings.attributeFlags & ContextSettings::Core) ||
+            (context->m_settings.attributeFlags & ContextSettings::Core))
+            return;
+
+        // Re-create our shared context as a core context
+        const ContextSettings sharedSettings{/* depthBits */ 0,
+                                             /* stencilBits */ 0,
+                                             /* antialiasingLevel */ 0,
+                                             settings.majorVersion,
+                                             settings.minorVersion,
+                                             settings.attributeFlags};
+
+        context.emplace(nullptr, sharedSettings, Vector2u(1, 1));
+        context->initialize(sharedSettings);
+
+        // Reload our extensions vector the next time it is queried
+        extensionsLoaded = false;
+    }
+
     ////////////////////////////////////////////////////////////
     /// \brief Load our extensions vector with the supported extensions
     ///
@@ -316,6 +442,7 @@ struct GlContext::SharedContext
 
     // Supported OpenGL extensions
     std::vector<std::string> extensions;
+    bool                     extensionsLoaded{};
 
     // The hidden, inactive context that will be shared with all other contexts
     std::optional<ContextType> context;
@@ -459,13 +586,15 @@ struct GlContext::Impl
     ///////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::shared_ptr<UnsharedGlObjects> unsharedGlObjects; //!< The current object's handle to unshared objects
-    const std::uint64_t                id{
+    std::shared_ptr<UnsharedGlObjects>   unsharedGlObjects; //!< The current object's handle to unshared objects
+    std::shared_ptr<const std::uint64_t> group;             //!< ID of the group of contexts sharing a native context
+    bool                                 sharedWindow{};    //!< Can windows created later reuse the native context?
+    std::uint64_t                        id{
         []
         {
             static std::atomic<std::uint64_t> atomicId(1); // start at 1, zero is "no context"
             return atomicId.fetch_add(1);
-        }()}; //!< Unique identifier, used for identifying contexts when managing unshareable OpenGL resources
+        }()}; //!< Identifier, shared by the contexts of a group, used when managing unshareable OpenGL resources
 };
 
 
@@ -581,32 +710,46 @@ std::unique_ptr<GlContext> GlContext::create()
 ////////////////////////////////////////////////////////////
 std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, const WindowImpl& owner, unsigned int bitsPerPixel)
 {
+    const bool sharedWindow = GlContextImpl::HasWindowContextSharing<ContextType>::value &&
+                              settings.sharedWindowContext && !settings.lowLatencyPresentation;
+
+    // Render with the native context of a compatible window if there is one
+    if (sharedWindow)
+    {
+        const std::lock_guard lock(GlContextImpl::windowContextsMutex);
+
+        for (const GlContextImpl::WindowContext& windowContext : GlContextImpl::windowContexts)
+        {
+            if ((windowContext.bitsPerPixel != bitsPerPixel) ||
+                !GlContextImpl::isSameRequest(windowContext.settings, settings))
+                continue;
+
+            std::unique_ptr<GlContext> context = GlContextImpl::shareWindowContext<ContextType>(*windowContext.context,
+                                                                                                owner,
+                                                                                                bitsPerPixel);
+
+            if (context)
+            {
+                context->joinGroup(*windowContext.context);
+                context->m_impl->sharedWindow = true;
+                GlContextImpl::windowContexts.push_back({context.get(), settings, bitsPerPixel});
+                return context;
+            }
+        }
+    }
+
     // Make sure that there's an active context (context creation may need extensions, and thus a valid context)
     const auto sharedContext = SharedContext::get();
 
     const std::lock_guard lock(sharedContext->mutex);
 
+    // From now on, our GlResource keeps the shared context alive
+    SharedContext::getPreloaded().reset();
+
     // If use_count is 2 (GlResource + sharedContext) we know that we are inside sf::Context or sf::Window
     // Only in this situation we allow the user to indirectly re-create the shared context as a core context
-
-    // Check if we need to convert our shared context into a core context
-    if ((sharedContext.use_count() == 2) && (settings.attributeFlags & ContextSettings::Core) &&
-        !(sharedContext->context->m_settings.attributeFlags & ContextSettings::Core))
-    {
-        // Re-create our shared context as a core context
-        const ContextSettings sharedSettings{/* depthBits */ 0,
-                                             /* stencilBits */ 0,
-                                             /* antialiasingLevel */ 0,
-                                             settings.majorVersion,
-                                             settings.minorVersion,
-                                             settings.attributeFlags};
-
-        sharedContext->context.emplace(nullptr, sharedSettings, Vector2u(1, 1));
-        sharedContext->context->initialize(sharedSettings);
-
-        // Reload our extensions vector
-        sharedContext->loadExtensions();
-    }
+    if (sharedContext.use_count() == 2)
+        sharedContext->convertToCore(settings);
 
     std::unique_ptr<GlContext> context;
 
@@ -623,6 +766,14 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
     context->initialize(settings);
     context->checkSettings(settings);
 
+    // Let the next compatible windows reuse the native context
+    if (sharedWindow)
+    {
+        const std::lock_guard windowContextsLock(GlContextImpl::windowContextsMutex);
+        context->m_impl->sharedWindow = true;
+        GlContextImpl::windowContexts.push_back({context.get(), settings, bitsPerPixel});
+    }
+
     return context;
 }
 
@@ -635,27 +786,13 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
 
     const std::lock_guard lock(sharedContext->mutex);
 
+    // From now on, our GlResource keeps the shared context alive
+    SharedContext::getPreloaded().reset();
+
     // If use_count is 2 (GlResource + sharedContext) we know that we are inside sf::Context or sf::Window
     // Only in this situation we allow the user to indirectly re-create the shared context as a core context
-
-    // Check if we need to convert our shared context into a core context
-    if ((sharedContext.use_count() == 2) && (settings.attributeFlags & ContextSettings::Core) &&
-        !(sharedContext->context->m_settings.attributeFlags & ContextSettings::Core))
-    {
-        // Re-create our shared context as a core context
-        const ContextSettings sharedSettings{/* depthBits */ 0,
-                                             /* stencilBits */ 0,
-                                             /* antialiasingLevel */ 0,
-                                             settings.majorVersion,
-                                             settings.minorVersion,
-                                             settings.attributeFlags};
-
-        sharedContext->context.emplace(nullptr, sharedSettings, Vector2u(1, 1));
-        sharedContext->context->initialize(sharedSettings);
-
-        // Reload our extensions vector
-        sharedContext->loadExtensions();
-    }
+    if (sharedContext.use_count() == 2)
+        sharedContext->convertToCore(settings);
 
     // We don't use acquireTransientContext here since we have
     // to ensure we have exclusive access to the shared context
@@ -674,6 +811,49 @@ std::unique_ptr<GlContext> GlContext::create(const ContextSettings& settings, co
 }
 
 
+////////////////////////////////////////////////////////////
+bool GlContext::preload(const ContextSettings& settings, unsigned int bitsPerPixel)
+{
+    const auto sharedContext = SharedContext::get();
+    bool       loaded        = false;
+
+    {
+        const std::lock_guard lock(sharedContext->mutex);
+
+        // Convert the shared context now if no context shares it, a window wouldn't be able to later
+        SharedContext::getPreloaded().reset();
+        if (sharedContext.use_count() == 1)
+            sharedContext->convertToCore(settings);
+
+        if (!sharedContext->extensionsLoaded)
+        {
+            acquireTransientContext();
+            sharedContext->loadExtensions();
+            releaseTransientContext();
+
+            sharedContext->extensionsLoaded = true;
+        }
+
+        loaded = !sharedContext->extensions.empty();
+
+        // Keep the shared context until a context is created
+#if defined(SFML_SYSTEM_WINDOWS) && !defined(SFML_OPENGL_ES)
+        // A hidden window used as its surface would be destroyed along with this thread
+        if (!sharedContext->context->isBoundToThread())
+            SharedContext::getPreloaded() = sharedContext;
+#else
+        SharedContext::getPreloaded() = sharedContext;
+#endif
+    }
+
+    // Select the pixel format of the window in advance, the result is cached
+    if constexpr (GlContextImpl::HasPixelFormatProbe<ContextType>::value)
+        ContextType::probePixelFormat(bitsPerPixel, settings);
+
+    return loaded;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool GlContext::isExtensionAvailable(std::string_view name)
 {
@@ -681,6 +861,18 @@ bool GlContext::isExtensionAvailable(std::string_view name)
     // the shared context will be created for the duration of this call
     const auto sharedContext = SharedContext::get();
 
+    const std::lock_guard lock(sharedContext->mutex);
+
+    if (!sharedContext->extensionsLoaded)
+    {
+        // Querying the extensions requires an active context
+        acquireTransientContext();
+        sharedContext->loadExtensions();
+        releaseTransientContext();
+
+        sharedContext->extensionsLoaded = true;
+    }
+
     return std::find(sharedContext->extensions.begin(), sharedContext->extensions.end(), name) !=
            sharedContext->extensions.end();
 }
@@ -717,12 +909,34 @@ std::uint64_t GlContext::getActiveContextId()
 }
 
 
+////////////////////////////////////////////////////////////
+Context::Statistics GlContext::getStatistics()
+{
+    Context::Statistics statistics;
+    statistics.contextSwitches       = GlContextImpl::contextSwitches.load(std::memory_order_relaxed);
+    statistics.redundantActivations  = GlContextImpl::redundantActivations.load(std::memory_order_relaxed);
+    statistics.sharedContextCreation = microseconds(GlContextImpl::creationTime.load(std::memory_order_relaxed));
+    statistics.formatSelection       = microseconds(GlContextImpl::selectionTime.load(std::memory_order_relaxed));
+    statistics.formatCacheHits       = GlContextImpl::formatCacheHits.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 GlContext::~GlContext()
 {
+    if (m_impl->sharedWindow)
+    {
+        const std::lock_guard lock(GlContextImpl::windowContextsMutex);
+        GlContextImpl::windowContexts.erase(std::find_if(GlContextImpl::windowContexts.begin(),
+                                                         GlContextImpl::windowContexts.end(),
+                                                         [this](const GlContextImpl::WindowContext& windowContext)
+                                                         { return windowContext.context == this; }));
+    }
+
     auto& currentContext = GlContextImpl::CurrentContext::get();
 
-    if (m_impl->id == currentContext.id)
+    if (currentContext.ptr == this)
     {
         currentContext.id  = 0;
         currentContext.ptr = nullptr;
@@ -737,6 +951,57 @@ const ContextSettings& GlContext::getSettings() const
 }
 
 
+////////////////////////////////////////////////////////////
+void GlContext::displayDamage(const std::vector<int>& /* damage */)
+{
+    display();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GlContext::getBufferAge()
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlContext::setSwapInterval(int /* interval */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlContext::setTargetFrameRate(unsigned int frameRate)
+{
+    if (frameRate == 0)
+        return setSwapInterval(1);
+
+    const std::optional<Window::PresentTiming> timing = getPresentTiming();
+    if (!timing || (timing->refreshRate <= 0.f))
+        return false;
+
+    // Number of refreshes closest to the target frame duration
+    const long interval = std::lround(timing->refreshRate / static_cast<float>(frameRate));
+    return setSwapInterval(std::max(static_cast<int>(interval), 1));
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlContext::delayBeforeSwap(Time /* delay */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> GlContext::getPresentTiming()
+{
+    return std::nullopt;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool GlContext::setActive(bool active)
 {
@@ -746,9 +1011,10 @@ bool GlContext::setActive(bool active)
     // setActive can be called during construction and lead to infinite recursion
     auto* sharedContext = SharedContext::getWeakPtr().lock().get();
 
+    // Contexts of a group have the same ID, only a pointer tells which surface is current
     if (active)
     {
-        if (m_impl->id != currentContext.id)
+        if (currentContext.ptr != this)
         {
             // We can't and don't need to lock when we are currently creating the shared context
             std::unique_lock<std::recursive_mutex> lock;
@@ -757,6 +1023,7 @@ bool GlContext::setActive(bool active)
                 lock = std::unique_lock(sharedContext->mutex);
 
             // Activate the context
+            GlContextImpl::contextSwitches.fetch_add(1, std::memory_order_relaxed);
             if (makeCurrent(true))
             {
                 // Set it as the new current context for this thread
@@ -772,12 +1039,13 @@ bool GlContext::setActive(bool active)
         else
         {
             // This context is already the active one on this thread, don't do anything
+            GlContextImpl::redundantActivations.fetch_add(1, std::memory_order_relaxed);
             return true;
         }
     }
     else
     {
-        if (m_impl->id == currentContext.id)
+        if (currentContext.ptr == this)
         {
             // We can't and don't need to lock when we are currently creating the shared context
             std::unique_lock<std::recursive_mutex> lock;
@@ -786,6 +1054,7 @@ bool GlContext::setActive(bool active)
                 lock = std::unique_lock(sharedContext->mutex);
 
             // Deactivate the context
+            GlContextImpl::contextSwitches.fetch_add(1, std::memory_order_relaxed);
             if (makeCurrent(false))
             {
                 currentContext.id  = 0;
@@ -850,16 +1119,30 @@ int GlContext::evaluateFormat(
 }
 
 
+////////////////////////////////////////////////////////////
+void GlContext::recordFormatSelection(Time duration, bool cached)
+{
+    if (cached)
+        GlContextImpl::formatCacheHits.fetch_add(1, std::memory_order_relaxed);
+
+    GlContextImpl::selectionTime.fetch_add(duration.asMicroseconds(), std::memory_order_relaxed);
+}
+
+
 ////////////////////////////////////////////////////////////
 void GlContext::cleanupUnsharedResources()
 {
+    // The resources are still used by the other contexts of the group
+    if (isNativeContextShared())
+        return;
+
     const auto& currentContext = GlContextImpl::CurrentContext::get();
 
     // Save the current context so we can restore it later
     GlContext* contextToRestore = currentContext.ptr;
 
     // If this context is already active there is no need to save it
-    if (m_impl->id == currentContext.id)
+    if (currentContext.ptr == this)
         contextToRestore = nullptr;
 
     // Make this context active so resources can be freed
@@ -888,6 +1171,24 @@ void GlContext::cleanupUnsharedResources()
 }
 
 
+////////////////////////////////////////////////////////////
+void GlContext::joinGroup(const GlContext& context)
+{
+    if (!context.m_impl->group)
+        context.m_impl->group = std::make_shared<const std::uint64_t>(context.m_impl->id);
+
+    m_impl->group = context.m_impl->group;
+    m_impl->id    = *m_impl->group;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlContext::isNativeContextShared() const
+{
+    return m_impl->group.use_count() > 1;
+}
+
+
 ////////////////////////////////////////////////////////////
 void GlContext::initialize(const ContextSettings& requestedSettings)
 {
@@ -31,10 +31,14 @@
 
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/ContextSettings.hpp>
+#include <SFML/Window/Window.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <cstdint>
 
@@ -130,6 +134,20 @@ public:
     ////////////////////////////////////////////////////////////
     static std::unique_ptr<GlContext> create(const ContextSettings& settings, const Vector2u& size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the shared context and select the pixel format of a window in advance
+    ///
+    /// The shared context is kept alive until the next context
+    /// is created.
+    ///
+    /// \param settings     Creation parameters of the future window
+    /// \param bitsPerPixel Pixel depth of the future window (in bits per pixel)
+    ///
+    /// \return True if the shared context is usable
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool preload(const ContextSettings& settings, unsigned int bitsPerPixel);
+
     ////////////////////////////////////////////////////////////
     /// \brief Check whether a given OpenGL extension is available
     ///
@@ -169,6 +187,14 @@ public:
     ////////////////////////////////////////////////////////////
     static std::uint64_t getActiveContextId();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the context activity
+    ///
+    /// \return Statistics accumulated since the start of the application
+    ///
+    ////////////////////////////////////////////////////////////
+    static Context::Statistics getStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -221,6 +247,29 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void display() = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Display the damaged regions of what has been rendered so far
+    ///
+    /// The rest of the back buffer is assumed to be identical
+    /// to the frame on screen. The default implementation
+    /// displays the whole back buffer.
+    ///
+    /// \param damage Damaged rectangles as consecutive x, y, width and height,
+    ///               with the origin at the bottom-left corner of the surface
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void displayDamage(const std::vector<int>& damage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the age of the back buffer
+    ///
+    /// The default implementation doesn't know the age of the back buffer.
+    ///
+    /// \return Number of frames since the back buffer was displayed, 0 if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual unsigned int getBufferAge();
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable vertical synchronization
     ///
@@ -234,6 +283,54 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void setVerticalSyncEnabled(bool enabled) = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when swapping buffers
+    ///
+    /// The default implementation doesn't support any interval.
+    ///
+    /// \param interval Number of vertical blanks, negative for adaptive synchronization
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool setSwapInterval(int interval);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pace the displayed frames to a target frame rate
+    ///
+    /// The default implementation sets the swap interval closest
+    /// to the refresh rate divided by the frame rate, if the
+    /// refresh rate is reported by getPresentTiming.
+    ///
+    /// \param frameRate Target number of frames per second, 0 to display a frame at each vertical blank
+    ///
+    /// \return True if the frames are paced, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool setTargetFrameRate(unsigned int frameRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a given time before the next vertical blank
+    ///
+    /// The default implementation returns immediately.
+    ///
+    /// \param delay Time to leave before the vertical blank
+    ///
+    /// \return True if the function waited, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool delayBeforeSwap(Time delay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// The default implementation doesn't support present timing.
+    ///
+    /// \return Present timing, or an empty optional if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::optional<Window::PresentTiming> getPresentTiming();
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
@@ -257,9 +354,35 @@ protected:
     ////////////////////////////////////////////////////////////
     /// \brief Notify unshared GlResources of context destruction
     ///
+    /// Nothing is done if other contexts still use the same
+    /// native context, see joinGroup.
+    ///
     ////////////////////////////////////////////////////////////
     void cleanupUnsharedResources();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Join the group of a context whose native context this one renders with
+    ///
+    /// The contexts of a group have the same ID, so that the
+    /// objects and states tracked per context are shared by all
+    /// of them. They only differ by the surface they render to.
+    ///
+    /// \param context Context of the group to join
+    ///
+    ////////////////////////////////////////////////////////////
+    void joinGroup(const GlContext& context);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether other contexts render with the same native context
+    ///
+    /// Implementations only destroy their native context when
+    /// this returns false, i.e. for the last context of a group.
+    ///
+    /// \return True if this context is not the last one of its group
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isNativeContextShared() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Evaluate a pixel format configuration
     ///
@@ -289,6 +412,18 @@ protected:
                               bool                   accelerated,
                               bool                   sRgb);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the outcome of a pixel format selection
+    ///
+    /// Implementations call this from their format selection
+    /// so that the cost shows up in the context statistics.
+    ///
+    /// \param duration Time spent scoring the formats, zero if the result was cached
+    /// \param cached   Whether the format was taken from the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    static void recordFormatSelection(Time duration, bool cached);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 
+#include <bitset>
+
 
 namespace sf
 {
@@ -86,6 +88,31 @@ void setVirtualKeyboardVisible(bool visible);
 ////////////////////////////////////////////////////////////
 bool isMouseButtonPressed(Mouse::Button button);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the state of all the keys at once
+///
+/// This is equivalent to calling isKeyPressed for every key and
+/// scancode, but may query the system only once.
+///
+/// \param keys      Filled with the state of each key
+/// \param scancodes Filled with the state of each scancode
+///
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the state of all the mouse buttons and the position of the mouse at once
+///
+/// This is equivalent to calling isMouseButtonPressed for every
+/// button and getMousePosition, but may query the system only once.
+///
+/// \param buttons    Filled with the state of each button
+/// \param position   Filled with the position of the mouse
+/// \param relativeTo Window the position is relative to, or null for desktop coordinates
+///
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* relativeTo);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the current position of the mouse in desktop coordinates
 ///
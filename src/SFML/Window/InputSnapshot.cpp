@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/InputImpl.hpp>
+#include <SFML/Window/InputSnapshot.hpp>
+
+#include <cstddef>
+
+
+namespace
+{
+namespace InputSnapshotImpl
+{
+// Index of an enumerator in a state bitset, or Count for values out of range like Unknown
+template <typename T>
+std::size_t toIndex(T value, std::size_t count)
+{
+    const auto index = static_cast<int>(value);
+    return (index >= 0) && (static_cast<std::size_t>(index) < count) ? static_cast<std::size_t>(index) : count;
+}
+
+template <std::size_t Count, typename T>
+bool test(const std::bitset<Count>& bits, T value)
+{
+    const std::size_t index = toIndex(value, Count);
+    return (index < Count) && bits[index];
+}
+
+template <std::size_t Count, typename T>
+void set(std::bitset<Count>& bits, T value, bool state)
+{
+    const std::size_t index = toIndex(value, Count);
+    if (index < Count)
+        bits[index] = state;
+}
+} // namespace InputSnapshotImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void InputSnapshot::capture()
+{
+    priv::InputImpl::getKeyboardState(m_keys, m_scancodes);
+    priv::InputImpl::getMouseState(m_mouseButtons, m_mousePosition, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::capture(const WindowBase& relativeTo)
+{
+    priv::InputImpl::getKeyboardState(m_keys, m_scancodes);
+    priv::InputImpl::getMouseState(m_mouseButtons, m_mousePosition, &relativeTo);
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::update(const Event& event)
+{
+    using InputSnapshotImpl::set;
+
+    if (const auto* keyPressed = event.getIf<Event::KeyPressed>())
+    {
+        set(m_keys, keyPressed->code, true);
+        set(m_scancodes, keyPressed->scancode, true);
+    }
+    else if (const auto* keyReleased = event.getIf<Event::KeyReleased>())
+    {
+        set(m_keys, keyReleased->code, false);
+        set(m_scancodes, keyReleased->scancode, false);
+    }
+    else if (const auto* buttonPressed = event.getIf<Event::MouseButtonPressed>())
+    {
+        set(m_mouseButtons, buttonPressed->button, true);
+        m_mousePosition = buttonPressed->position;
+    }
+    else if (const auto* buttonReleased = event.getIf<Event::MouseButtonReleased>())
+    {
+        set(m_mouseButtons, buttonReleased->button, false);
+        m_mousePosition = buttonReleased->position;
+    }
+    else if (const auto* mouseMoved = event.getIf<Event::MouseMoved>())
+    {
+        m_mousePosition = mouseMoved->position;
+    }
+    else if (const auto* wheelScrolled = event.getIf<Event::MouseWheelScrolled>())
+    {
+        m_mousePosition = wheelScrolled->position;
+    }
+    else if (event.is<Event::FocusLost>())
+    {
+        // Keys and buttons released while the window doesn't have the focus are not reported
+        m_keys.reset();
+        m_scancodes.reset();
+        m_mouseButtons.reset();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isKeyPressed(Keyboard::Key key) const
+{
+    return InputSnapshotImpl::test(m_keys, key);
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isKeyPressed(Keyboard::Scancode code) const
+{
+    return InputSnapshotImpl::test(m_scancodes, code);
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isMouseButtonPressed(Mouse::Button button) const
+{
+    return InputSnapshotImpl::test(m_mouseButtons, button);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i InputSnapshot::getMousePosition() const
+{
+    return m_mousePosition;
+}
+
+} // namespace sf
@@ -33,6 +33,10 @@
 
 #include <SFML/System/EnumArray.hpp>
 
+#include <array>
+
+#include <cstdint>
+
 
 namespace sf::priv
 {
@@ -50,12 +54,18 @@ struct JoystickCaps
 ////////////////////////////////////////////////////////////
 /// \brief Structure holding a joystick's state
 ///
+/// Backends which receive the individual button changes from
+/// the system increment changes for each of them, so
+/// that a press and release happening between two updates
+/// is not lost. Others leave the counters untouched.
+///
 ////////////////////////////////////////////////////////////
 struct JoystickState
 {
     bool                                                  connected{}; //!< Is the joystick currently connected?
     EnumArray<Joystick::Axis, float, Joystick::AxisCount> axes{};      //!< Position of each axis, in range [-100, 100]
     std::array<bool, Joystick::ButtonCount>               buttons{};   //!< Status of each button (true = pressed)
+    std::array<std::uint32_t, Joystick::ButtonCount>      changes{};   //!< Number of state changes of each button
 };
 
 } // namespace sf::priv
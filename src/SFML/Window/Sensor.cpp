@@ -50,4 +50,16 @@ Vector3f Sensor::getValue(Type sensor)
     return priv::SensorManager::getInstance().getValue(sensor);
 }
 
+////////////////////////////////////////////////////////////
+bool Sensor::setBatchingEnabled(Type sensor, bool enabled, Time samplingPeriod, Time maxReportLatency)
+{
+    return priv::SensorManager::getInstance().setBatchingEnabled(sensor, enabled, samplingPeriod, maxReportLatency);
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<Sensor::Sample>& Sensor::getSamples(Type sensor)
+{
+    return priv::SensorManager::getInstance().getSamples(sensor);
+}
+
 } // namespace sf
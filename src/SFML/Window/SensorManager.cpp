@@ -79,6 +79,34 @@ Vector3f SensorManager::getValue(Sensor::Type sensor) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool SensorManager::setBatchingEnabled(Sensor::Type sensor, bool enabled, Time samplingPeriod, Time maxReportLatency)
+{
+    Item& item = m_sensors[sensor];
+
+    if (!item.available || !item.sensor.setBatching(enabled, samplingPeriod, maxReportLatency))
+        return false;
+
+    item.batched = enabled;
+    item.samples.clear();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Sensor::Sample>& SensorManager::getSamples(Sensor::Type sensor)
+{
+    Item& item = m_sensors[sensor];
+
+    // Keep the storage of the previous samples, to avoid reallocating it at each call
+    item.samples.clear();
+    if (item.batched)
+        item.sensor.readSamples(item.samples);
+
+    return item.samples;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SensorManager::update()
 {
@@ -32,6 +32,8 @@
 
 #include <SFML/System/EnumArray.hpp>
 
+#include <vector>
+
 
 namespace sf::priv
 {
@@ -101,6 +103,29 @@ public:
     ////////////////////////////////////////////////////////////
     Vector3f getValue(Sensor::Type sensor) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the batching of the samples of a sensor
+    ///
+    /// \param sensor           Sensor to modify
+    /// \param enabled          True to keep every sample, false to only keep the latest value
+    /// \param samplingPeriod   Time between two samples, zero to use the fastest rate
+    /// \param maxReportLatency Maximum time the samples can be held back before being reported
+    ///
+    /// \return True if batching was changed, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setBatchingEnabled(Sensor::Type sensor, bool enabled, Time samplingPeriod, Time maxReportLatency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the samples of a sensor measured since the previous call
+    ///
+    /// \param sensor Sensor to read
+    ///
+    /// \return Samples measured since the previous call
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<Sensor::Sample>& getSamples(Sensor::Type sensor);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the state of all the sensors
     ///
@@ -126,10 +151,12 @@ private:
     ////////////////////////////////////////////////////////////
     struct Item
     {
-        bool       available{}; //!< Is the sensor available on this device?
-        bool       enabled{};   //!< Current enable state of the sensor
-        SensorImpl sensor{};    //!< Sensor implementation
-        Vector3f   value;       //!< The current sensor value
+        bool                        available{}; //!< Is the sensor available on this device?
+        bool                        enabled{};   //!< Current enable state of the sensor
+        bool                        batched{};   //!< Are all the samples of the sensor kept?
+        SensorImpl                  sensor{};    //!< Sensor implementation
+        Vector3f                    value;       //!< The current sensor value
+        std::vector<Sensor::Sample> samples;     //!< Samples returned by the last call to getSamples
     };
 
     ////////////////////////////////////////////////////////////
@@ -31,13 +31,18 @@
 #include <SFML/Window/Unix/Utils.hpp>
 #include <SFML/Window/Unix/WindowImplX11.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <array>
 #include <mutex>
 #include <ostream>
+#include <string_view>
 #include <vector>
 
+#include <cstdint>
+
 // We check for this definition in order to avoid multiple definitions of GLAD
 // entities during unity builds of SFML.
 #ifndef SF_GLAD_GLX_IMPLEMENTATION_INCLUDED
@@ -74,6 +79,72 @@ void ensureExtensionsInit(::Display* display, int screen)
 }
 
 
+////////////////////////////////////////////////////////////
+bool hasGlxExtension(::Display* display, std::string_view name)
+{
+    const char* extensionString = glXQueryExtensionsString(display, DefaultScreen(display));
+    if (!extensionString)
+        return false;
+
+    const std::string_view extensions(extensionString);
+    for (std::size_t begin = 0; begin < extensions.size();)
+    {
+        const std::size_t end = std::min(extensions.find(' ', begin), extensions.size());
+        if (extensions.substr(begin, end - begin) == name)
+            return true;
+        begin = end + 1;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+// Presentation control entry points which are not part
+// of the generated GLX loader, resolved once per process
+////////////////////////////////////////////////////////////
+struct GlxPresentationFunctions
+{
+    using DelayBeforeSwapNV = Bool (*)(::Display*, GLXDrawable, GLfloat);
+    using GetSyncValuesOML  = Bool (*)(::Display*, GLXDrawable, std::int64_t*, std::int64_t*, std::int64_t*);
+    using GetMscRateOML     = Bool (*)(::Display*, GLXDrawable, std::int32_t*, std::int32_t*);
+
+    bool              swapControlTear{};
+    DelayBeforeSwapNV delayBeforeSwap{};
+    GetSyncValuesOML  getSyncValues{};
+    GetMscRateOML     getMscRate{};
+};
+
+
+////////////////////////////////////////////////////////////
+const GlxPresentationFunctions& getPresentationFunctions(::Display* display)
+{
+    static const GlxPresentationFunctions functions = [display]
+    {
+        GlxPresentationFunctions result;
+
+        result.swapControlTear = hasGlxExtension(display, "GLX_EXT_swap_control_tear");
+
+        if (hasGlxExtension(display, "GLX_NV_delay_before_swap"))
+            result.delayBeforeSwap = reinterpret_cast<GlxPresentationFunctions::DelayBeforeSwapNV>(
+                sf::priv::GlxContext::getFunction("glXDelayBeforeSwapNV"));
+
+        if (hasGlxExtension(display, "GLX_OML_sync_control"))
+        {
+            result.getSyncValues = reinterpret_cast<GlxPresentationFunctions::GetSyncValuesOML>(
+                sf::priv::GlxContext::getFunction("glXGetSyncValuesOML"));
+            result.getMscRate = reinterpret_cast<GlxPresentationFunctions::GetMscRateOML>(
+                sf::priv::GlxContext::getFunction("glXGetMscRateOML"));
+        }
+
+        return result;
+    }();
+
+    return functions;
+}
+
+
+////////////////////////////////////////////////////////////
 int handleXError(::Display*, XErrorEvent*)
 {
     glxErrorOccurred = true;
@@ -152,14 +223,30 @@ GlxContext::GlxContext(GlxContext* shared, const ContextSettings& settings, cons
 }
 
 
+////////////////////////////////////////////////////////////
+GlxContext::GlxContext(const GlxContext& context, ::Window window) :
+m_display(context.m_display),
+m_window(window),
+m_context(context.m_context)
+{
+    m_settings = context.m_settings;
+}
+
+
 ////////////////////////////////////////////////////////////
 GlxContext::~GlxContext()
 {
     // Notify unshared OpenGL resources of context destruction
     cleanupUnsharedResources();
 
+    // Other windows still render with the context, only release our window
+    if (m_context && isNativeContextShared())
+    {
+        if ((glXGetCurrentContext() == m_context) && (glXGetCurrentDrawable() == m_window))
+            glXMakeCurrent(m_display.get(), None, nullptr);
+    }
     // Destroy the context
-    if (m_context)
+    else if (m_context)
     {
 #if defined(GLX_DEBUGGING)
         GlxErrorHandler handler(m_display.get());
@@ -189,6 +276,27 @@ GlxContext::~GlxContext()
 }
 
 
+////////////////////////////////////////////////////////////
+std::unique_ptr<GlxContext> GlxContext::shareWindowContext(GlxContext&       context,
+                                                       const WindowImpl& owner,
+                                                       unsigned int /*bitsPerPixel*/)
+{
+    if (!context.m_context || !context.m_window)
+        return nullptr;
+
+    // A GLX context can be made current with any window that has the visual it was created for
+    const auto        window = owner.getNativeHandle();
+    XWindowAttributes windowAttributes;
+    XWindowAttributes contextAttributes;
+    if ((XGetWindowAttributes(context.m_display.get(), window, &windowAttributes) == 0) ||
+        (XGetWindowAttributes(context.m_display.get(), context.m_window, &contextAttributes) == 0) ||
+        (XVisualIDFromVisual(windowAttributes.visual) != XVisualIDFromVisual(contextAttributes.visual)))
+        return nullptr;
+
+    return std::unique_ptr<GlxContext>(new GlxContext(context, window));
+}
+
+
 ////////////////////////////////////////////////////////////
 GlFunctionPointer GlxContext::getFunction(const char* name)
 {
@@ -290,14 +398,133 @@ void GlxContext::setVerticalSyncEnabled(bool enabled)
 }
 
 
+////////////////////////////////////////////////////////////
+bool GlxContext::setSwapInterval(int interval)
+{
+    const GLXDrawable drawable = m_pbuffer ? m_pbuffer : m_window;
+
+    // Adaptive synchronization is expressed as a negative interval of the EXT variant
+    if (SF_GLAD_GLX_EXT_swap_control)
+    {
+        if ((interval < 0) && !getPresentationFunctions(m_display.get()).swapControlTear)
+            return false;
+
+        glXSwapIntervalEXT(m_display.get(), drawable, interval);
+        return true;
+    }
+
+    if (interval < 0)
+        return false;
+
+    if (SF_GLAD_GLX_MESA_swap_control)
+        return glXSwapIntervalMESA(static_cast<unsigned int>(interval)) == 0;
+
+    // The SGI variant can't disable synchronization
+    if (SF_GLAD_GLX_SGI_swap_control && (interval > 0))
+        return glXSwapIntervalSGI(interval) == 0;
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlxContext::delayBeforeSwap(Time delay)
+{
+    const GlxPresentationFunctions& functions = getPresentationFunctions(m_display.get());
+    if (!functions.delayBeforeSwap)
+        return false;
+
+    return functions.delayBeforeSwap(m_display.get(), m_pbuffer ? m_pbuffer : m_window, delay.asSeconds()) == True;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> GlxContext::getPresentTiming()
+{
+    const GlxPresentationFunctions& functions = getPresentationFunctions(m_display.get());
+    if (!functions.getSyncValues || !functions.getMscRate)
+        return std::nullopt;
+
+    // Present timing only makes sense for a visible window
+    if (m_pbuffer || !m_window)
+        return std::nullopt;
+
+    std::int64_t ust = 0;
+    std::int64_t msc = 0;
+    std::int64_t sbc = 0;
+    if (functions.getSyncValues(m_display.get(), m_window, &ust, &msc, &sbc) != True)
+        return std::nullopt;
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank  = microseconds(ust);
+    timing.verticalBlankCount = static_cast<std::uint64_t>(msc);
+    timing.swapCount          = static_cast<std::uint64_t>(sbc);
+
+    std::int32_t numerator   = 0;
+    std::int32_t denominator = 0;
+    if ((functions.getMscRate(m_display.get(), m_window, &numerator, &denominator) == True) && (denominator > 0))
+        timing.refreshRate = static_cast<float>(numerator) / static_cast<float>(denominator);
+
+    return timing;
+}
+
+
 ////////////////////////////////////////////////////////////
 XVisualInfo GlxContext::selectBestVisual(::Display* display, unsigned int bitsPerPixel, const ContextSettings& settings)
 {
+    // Selecting a visual queries every attribute of every visual, which is slow on some drivers
+    // Since the same visual should always be selected for a specific combination of inputs
+    // we can cache the result of the lookup instead of having to perform it multiple times for the same inputs
+    struct VisualCacheEntry
+    {
+        int          screen{};
+        unsigned int bitsPerPixel{};
+        unsigned int depthBits{};
+        unsigned int stencilBits{};
+        unsigned int antialiasingLevel{};
+        bool         sRgbCapable{};
+        VisualID     visualId{};
+    };
+
+    static std::mutex                    cacheMutex;
+    static std::vector<VisualCacheEntry> visualCache;
+
     // Make sure that extensions are initialized
     ensureExtensionsInit(display, DefaultScreen(display));
 
     const int screen = DefaultScreen(display);
 
+    // Check if we have already previously found a visual for
+    // the current inputs and return it if one has been previously found
+    {
+        const std::lock_guard lock(cacheMutex);
+
+        for (const auto& entry : visualCache)
+        {
+            if (screen == entry.screen && bitsPerPixel == entry.bitsPerPixel && settings.depthBits == entry.depthBits &&
+                settings.stencilBits == entry.stencilBits && settings.antialiasingLevel == entry.antialiasingLevel &&
+                settings.sRgbCapable == entry.sRgbCapable)
+            {
+                // The display connection may have been reopened since, so look the visual up again
+                XVisualInfo vTemplate;
+                vTemplate.visualid = entry.visualId;
+                vTemplate.screen   = screen;
+
+                int        count  = 0;
+                const auto cached = X11Ptr<XVisualInfo[]>(
+                    XGetVisualInfo(display, VisualIDMask | VisualScreenMask, &vTemplate, &count));
+
+                if (cached && (count > 0))
+                {
+                    recordFormatSelection(Time::Zero, true);
+                    return cached[0];
+                }
+            }
+        }
+    }
+
+    const Clock clock;
+
     // Retrieve all the visuals
     int        count   = 0;
     const auto visuals = X11Ptr<XVisualInfo[]>(XGetVisualInfo(display, 0, nullptr, &count));
@@ -377,6 +604,20 @@ XVisualInfo GlxContext::selectBestVisual(::Display* display, unsigned int bitsPe
             }
         }
 
+        recordFormatSelection(clock.getElapsedTime(), false);
+
+        if (bestVisual.visual)
+        {
+            const std::lock_guard lock(cacheMutex);
+            visualCache.push_back(VisualCacheEntry{screen,
+                                                   bitsPerPixel,
+                                                   settings.depthBits,
+                                                   settings.stencilBits,
+                                                   settings.antialiasingLevel,
+                                                   settings.sRgbCapable,
+                                                   bestVisual.visualid});
+        }
+
         return bestVisual;
     }
     else
@@ -389,6 +630,14 @@ XVisualInfo GlxContext::selectBestVisual(::Display* display, unsigned int bitsPe
 }
 
 
+////////////////////////////////////////////////////////////
+void GlxContext::probePixelFormat(unsigned int bitsPerPixel, const ContextSettings& settings)
+{
+    const auto display = openDisplay();
+    (void)selectBestVisual(display.get(), bitsPerPixel, settings);
+}
+
+
 ////////////////////////////////////////////////////////////
 void GlxContext::updateSettingsFromVisualInfo(XVisualInfo* visualInfo)
 {
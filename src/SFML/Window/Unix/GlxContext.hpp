@@ -119,6 +119,34 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when swapping buffers
+    ///
+    /// \param interval Number of vertical blanks, negative for adaptive synchronization
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a given time before the next vertical blank
+    ///
+    /// \param delay Time to leave before the vertical blank
+    ///
+    /// \return True if the function waited, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool delayBeforeSwap(Time delay) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Select the best GLX visual for a given set of settings
     ///
@@ -131,7 +159,39 @@ public:
     ////////////////////////////////////////////////////////////
     static XVisualInfo selectBestVisual(::Display* display, unsigned int bitsPerPixel, const ContextSettings& settings);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the visual of a future window, to cache the result
+    ///
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    /// \param settings     Requested context settings
+    ///
+    ////////////////////////////////////////////////////////////
+    static void probePixelFormat(unsigned int bitsPerPixel, const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a context rendering to a window with the OpenGL context of another window
+    ///
+    /// \param context      Context of the other window
+    /// \param owner        Window to render to
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    ///
+    /// \return The new context, or a null pointer if the visuals of the windows differ
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::unique_ptr<GlxContext> shareWindowContext(GlxContext&       context,
+                                                          const WindowImpl& owner,
+                                                          unsigned int      bitsPerPixel);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a context rendering to a window with the OpenGL context of another window
+    ///
+    /// \param context Context of the other window
+    /// \param window  Window ID of the owning window
+    ///
+    ////////////////////////////////////////////////////////////
+    GlxContext(const GlxContext& context, ::Window window);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the context visual settings from XVisualInfo
     ///
@@ -81,6 +81,13 @@ void setVirtualKeyboardVisible(bool /*visible*/)
 }
 
 
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    KeyboardImpl::getKeyboardState(keys, scancodes);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool isMouseButtonPressed(Mouse::Button button)
 {
@@ -115,6 +122,40 @@ bool isMouseButtonPressed(Mouse::Button button)
 }
 
 
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* relativeTo)
+{
+    buttons.reset();
+    position = {};
+
+    const WindowHandle handle = relativeTo ? relativeTo->getNativeHandle() : 0;
+    if (relativeTo && !handle)
+        return;
+
+    // Open a connection with the X server
+    const auto display = openDisplay();
+
+    // A single request gives the buttons and both positions
+    ::Window     root  = 0;
+    ::Window     child = 0;
+    int          gx    = 0;
+    int          gy    = 0;
+    int          x     = 0;
+    int          y     = 0;
+    unsigned int mask  = 0;
+
+    const ::Window reference = relativeTo ? handle : DefaultRootWindow(display.get());
+    XQueryPointer(display.get(), reference, &root, &child, &gx, &gy, &x, &y, &mask);
+
+    // Mouse::Button::Extra1 and Mouse::Button::Extra2 are not supported by X, see isMouseButtonPressed
+    buttons[static_cast<std::size_t>(Mouse::Button::Left)]   = (mask & Button1Mask) != 0;
+    buttons[static_cast<std::size_t>(Mouse::Button::Right)]  = (mask & Button3Mask) != 0;
+    buttons[static_cast<std::size_t>(Mouse::Button::Middle)] = (mask & Button2Mask) != 0;
+
+    position = relativeTo ? Vector2i(x, y) : Vector2i(gx, gy);
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i getMousePosition()
 {
@@ -510,17 +510,21 @@ bool JoystickImpl::isConnected(unsigned int index)
         // udev monitor is not available, perform a scan every query
         updatePluggedList();
     }
-    else if (hasMonitorEvent())
+    else
     {
-        // Check if new joysticks were added/removed since last update
-        udev_device* udevDevice = udev_monitor_receive_device(udevMonitor);
+        // Check if new joysticks were added/removed since last update,
+        // handling all the pending notifications at once
+        while (hasMonitorEvent())
+        {
+            udev_device* udevDevice = udev_monitor_receive_device(udevMonitor);
 
-        // If we can get the specific device, we check that,
-        // otherwise just do a full scan if udevDevice == nullptr
-        updatePluggedList(udevDevice);
+            // If we can get the specific device, we check that,
+            // otherwise just do a full scan if udevDevice == nullptr
+            updatePluggedList(udevDevice);
 
-        if (udevDevice)
-            udev_device_unref(udevDevice);
+            if (udevDevice)
+                udev_device_unref(udevDevice);
+        }
     }
 
     if (index >= joystickList.size())
@@ -690,7 +694,16 @@ JoystickState JoystickImpl::JoystickImpl::update()
             case JS_EVENT_BUTTON:
             {
                 if (joyState.number < Joystick::ButtonCount)
-                    m_state.buttons[joyState.number] = (joyState.value != 0);
+                {
+                    const bool pressed = (joyState.value != 0);
+
+                    // Count the changes so that short presses between two updates still produce events,
+                    // the initial state sent when opening the device is not a change
+                    if ((m_state.buttons[joyState.number] != pressed) && !(joyState.type & JS_EVENT_INIT))
+                        ++m_state.changes[joyState.number];
+
+                    m_state.buttons[joyState.number] = pressed;
+                }
                 break;
             }
         }
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Unix/KeyDescription.hpp>
+
+#include <SFML/System/String.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool isDescribedByCharacter(Keyboard::Scancode code)
+{
+    // These scancodes actually correspond to keys with input
+    // but we want to return their description, not their behaviour
+    // clang-format off
+    return !(code == Keyboard::Scan::Enter ||
+             code == Keyboard::Scan::Escape ||
+             code == Keyboard::Scan::Backspace ||
+             code == Keyboard::Scan::Tab ||
+             code == Keyboard::Scan::Space ||
+             code == Keyboard::Scan::ScrollLock ||
+             code == Keyboard::Scan::Pause ||
+             code == Keyboard::Scan::Delete ||
+             code == Keyboard::Scan::NumpadDivide ||
+             code == Keyboard::Scan::NumpadMultiply ||
+             code == Keyboard::Scan::NumpadMinus ||
+             code == Keyboard::Scan::NumpadPlus ||
+             code == Keyboard::Scan::NumpadEqual ||
+             code == Keyboard::Scan::NumpadEnter ||
+             code == Keyboard::Scan::NumpadDecimal);
+    // clang-format on
+}
+
+
+////////////////////////////////////////////////////////////
+String getKeyName(Keyboard::Scancode code)
+{
+    // clang-format off
+    switch (code)
+    {
+        case Keyboard::Scan::Enter:              return "Enter";
+        case Keyboard::Scan::Escape:             return "Escape";
+        case Keyboard::Scan::Backspace:          return "Backspace";
+        case Keyboard::Scan::Tab:                return "Tab";
+        case Keyboard::Scan::Space:              return "Space";
+
+        case Keyboard::Scan::F1:                 return "F1";
+        case Keyboard::Scan::F2:                 return "F2";
+        case Keyboard::Scan::F3:                 return "F3";
+        case Keyboard::Scan::F4:                 return "F4";
+        case Keyboard::Scan::F5:                 return "F5";
+        case Keyboard::Scan::F6:                 return "F6";
+        case Keyboard::Scan::F7:                 return "F7";
+        case Keyboard::Scan::F8:                 return "F8";
+        case Keyboard::Scan::F9:                 return "F9";
+        case Keyboard::Scan::F10:                return "F10";
+        case Keyboard::Scan::F11:                return "F11";
+        case Keyboard::Scan::F12:                return "F12";
+        case Keyboard::Scan::F13:                return "F13";
+        case Keyboard::Scan::F14:                return "F14";
+        case Keyboard::Scan::F15:                return "F15";
+        case Keyboard::Scan::F16:                return "F16";
+        case Keyboard::Scan::F17:                return "F17";
+        case Keyboard::Scan::F18:                return "F18";
+        case Keyboard::Scan::F19:                return "F19";
+        case Keyboard::Scan::F20:                return "F20";
+        case Keyboard::Scan::F21:                return "F21";
+        case Keyboard::Scan::F22:                return "F22";
+        case Keyboard::Scan::F23:                return "F23";
+        case Keyboard::Scan::F24:                return "F24";
+
+        case Keyboard::Scan::CapsLock:           return "Caps Lock";
+        case Keyboard::Scan::PrintScreen:        return "Print Screen";
+        case Keyboard::Scan::ScrollLock:         return "Scroll Lock";
+
+        case Keyboard::Scan::Pause:              return "Pause";
+        case Keyboard::Scan::Insert:             return "Insert";
+        case Keyboard::Scan::Home:               return "Home";
+        case Keyboard::Scan::PageUp:             return "Page Up";
+        case Keyboard::Scan::Delete:             return "Delete";
+        case Keyboard::Scan::End:                return "End";
+        case Keyboard::Scan::PageDown:           return "Page Down";
+
+        case Keyboard::Scan::Left:               return "Left Arrow";
+        case Keyboard::Scan::Right:              return "Right Arrow";
+        case Keyboard::Scan::Down:               return "Down Arrow";
+        case Keyboard::Scan::Up:                 return "Up Arrow";
+
+        case Keyboard::Scan::NumLock:            return "Num Lock";
+        case Keyboard::Scan::NumpadDivide:       return "Divide (Numpad)";
+        case Keyboard::Scan::NumpadMultiply:     return "Multiply (Numpad)";
+        case Keyboard::Scan::NumpadMinus:        return "Minus (Numpad)";
+        case Keyboard::Scan::NumpadPlus:         return "Plus (Numpad)";
+        case Keyboard::Scan::NumpadEqual:        return "Equal (Numpad)";
+        case Keyboard::Scan::NumpadEnter:        return "Enter (Numpad)";
+        case Keyboard::Scan::NumpadDecimal:      return "Decimal (Numpad)";
+
+        case Keyboard::Scan::Numpad0:            return "0 (Numpad)";
+        case Keyboard::Scan::Numpad1:            return "1 (Numpad)";
+        case Keyboard::Scan::Numpad2:            return "2 (Numpad)";
+        case Keyboard::Scan::Numpad3:            return "3 (Numpad)";
+        case Keyboard::Scan::Numpad4:            return "4 (Numpad)";
+        case Keyboard::Scan::Numpad5:            return "5 (Numpad)";
+        case Keyboard::Scan::Numpad6:            return "6 (Numpad)";
+        case Keyboard::Scan::Numpad7:            return "7 (Numpad)";
+        case Keyboard::Scan::Numpad8:            return "8 (Numpad)";
+        case Keyboard::Scan::Numpad9:            return "9 (Numpad)";
+
+        case Keyboard::Scan::Application:        return "Application";
+        case Keyboard::Scan::Execute:            return "Execute";
+        case Keyboard::Scan::Help:               return "Help";
+        case Keyboard::Scan::Menu:               return "Menu";
+        case Keyboard::Scan::Select:             return "Select";
+        case Keyboard::Scan::Stop:               return "Stop";
+        case Keyboard::Scan::Redo:               return "Redo";
+        case Keyboard::Scan::Undo:               return "Undo";
+        case Keyboard::Scan::Cut:                return "Cut";
+        case Keyboard::Scan::Copy:               return "Copy";
+        case Keyboard::Scan::Paste:              return "Paste";
+        case Keyboard::Scan::Search:             return "Search";
+
+        case Keyboard::Scan::VolumeMute:         return "Volume Mute";
+        case Keyboard::Scan::VolumeUp:           return "Volume Up";
+        case Keyboard::Scan::VolumeDown:         return "Volume Down";
+
+        case Keyboard::Scan::LControl:           return "Left Control";
+        case Keyboard::Scan::LShift:             return "Left Shift";
+        case Keyboard::Scan::LAlt:               return "Left Alt";
+        case Keyboard::Scan::LSystem:            return "Left System";
+        case Keyboard::Scan::RControl:           return "Right Control";
+        case Keyboard::Scan::RShift:             return "Right Shift";
+        case Keyboard::Scan::RAlt:               return "Right Alt";
+        case Keyboard::Scan::RSystem:            return "Right System";
+
+        case Keyboard::Scan::LaunchApplication1: return "Launch Application 1";
+        case Keyboard::Scan::LaunchApplication2: return "Launch Application 2";
+        case Keyboard::Scan::Favorites:          return "Favorites";
+        case Keyboard::Scan::Back:               return "Back";
+        case Keyboard::Scan::Forward:            return "Forward";
+        case Keyboard::Scan::MediaNextTrack:     return "Media Next Track";
+        case Keyboard::Scan::MediaPlayPause:     return "Media Play Pause";
+        case Keyboard::Scan::MediaPreviousTrack: return "Media Previous Track";
+        case Keyboard::Scan::MediaStop:          return "Media Stop";
+        case Keyboard::Scan::HomePage:           return "Home Page";
+        case Keyboard::Scan::Refresh:            return "Refresh";
+        case Keyboard::Scan::LaunchMail:         return "Launch Mail";
+        case Keyboard::Scan::LaunchMediaSelect:  return "Launch Media Select";
+
+        default:                                 return "Unknown Scancode";
+    }
+    // clang-format on
+}
+
+} // namespace sf::priv
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Keyboard.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Tell whether a key is described by the character it produces
+///
+/// Some keys produce a character but are better described
+/// by their name, like Enter, Space or the numpad operators.
+///
+/// \param code Scancode of the key
+///
+/// \return True to describe the key with its character, false to use getKeyName
+///
+////////////////////////////////////////////////////////////
+bool isDescribedByCharacter(Keyboard::Scancode code);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the name of a key that doesn't depend on the keyboard layout
+///
+/// \param code Scancode of the key
+///
+/// \return Name of the key, "Unknown Scancode" if it has no layout independent name
+///
+////////////////////////////////////////////////////////////
+String getKeyName(Keyboard::Scancode code);
+
+} // namespace sf::priv
@@ -44,6 +44,9 @@ namespace sf::priv
 /// non-combining characters instead of combining diacritical marks
 /// because is it more suitable to describe those keys in user interfaces.
 ///
+/// The table is binary searched, its order being checked at
+/// compile time. Latin-1 and Unicode keysyms are converted directly.
+///
 /// \param keysym keysym to be converted
 ///
 /// \return corresponding UTF-32
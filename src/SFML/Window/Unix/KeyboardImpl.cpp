@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Unix/Display.hpp>
+#include <SFML/Window/Unix/KeyDescription.hpp>
 #include <SFML/Window/Unix/KeySymToKeyMapping.hpp>
 #include <SFML/Window/Unix/KeySymToUnicodeMapping.hpp>
 #include <SFML/Window/Unix/KeyboardImpl.hpp>
@@ -38,9 +39,10 @@
 #include <X11/Xlib.h>
 #include <X11/keysym.h>
 
+#include <algorithm>
 #include <array>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <utility>
 
 #include <cstring>
@@ -52,6 +54,8 @@ const KeyCode
 const int                                                                         maxKeyCode  = 256;
 sf::priv::EnumArray<sf::Keyboard::Scancode, KeyCode, sf::Keyboard::ScancodeCount> scancodeToKeycode; ///< Mapping of SFML scancode to X11 KeyCode
 std::array<sf::Keyboard::Scancode, maxKeyCode> keycodeToScancode; ///< Mapping of X11 KeyCode to SFML scancode
+sf::priv::EnumArray<sf::Keyboard::Key, KeyCode, sf::Keyboard::KeyCount> keyToKeycode; ///< Mapping of SFML key to X11 KeyCode
+bool isMappingInitialized = false; ///< Whether the mappings match the current keyboard mapping of the server
 
 ////////////////////////////////////////////////////////////
 bool isValidKeycode(KeyCode keycode)
@@ -279,201 +283,231 @@ sf::Keyboard::Scancode translateKeyCode(Display* display, KeyCode keycode)
 }
 
 ////////////////////////////////////////////////////////////
-std::unordered_map<std::string, sf::Keyboard::Scancode> getNameScancodeMap()
+// XKB name of a key and the scancode of its location
+struct KeyNameScancode
 {
-    std::unordered_map<std::string, sf::Keyboard::Scancode> mapping;
-
-    mapping.emplace("LSGT", sf::Keyboard::Scan::NonUsBackslash);
-
-    mapping.emplace("TLDE", sf::Keyboard::Scan::Grave);
-    mapping.emplace("AE01", sf::Keyboard::Scan::Num1);
-    mapping.emplace("AE02", sf::Keyboard::Scan::Num2);
-    mapping.emplace("AE03", sf::Keyboard::Scan::Num3);
-    mapping.emplace("AE04", sf::Keyboard::Scan::Num4);
-    mapping.emplace("AE05", sf::Keyboard::Scan::Num5);
-    mapping.emplace("AE06", sf::Keyboard::Scan::Num6);
-    mapping.emplace("AE07", sf::Keyboard::Scan::Num7);
-    mapping.emplace("AE08", sf::Keyboard::Scan::Num8);
-    mapping.emplace("AE09", sf::Keyboard::Scan::Num9);
-    mapping.emplace("AE10", sf::Keyboard::Scan::Num0);
-    mapping.emplace("AE11", sf::Keyboard::Scan::Hyphen);
-    mapping.emplace("AE12", sf::Keyboard::Scan::Equal);
-    mapping.emplace("BKSP", sf::Keyboard::Scan::Backspace);
-    mapping.emplace("TAB", sf::Keyboard::Scan::Tab);
-    mapping.emplace("AD01", sf::Keyboard::Scan::Q);
-    mapping.emplace("AD02", sf::Keyboard::Scan::W);
-    mapping.emplace("AD03", sf::Keyboard::Scan::E);
-    mapping.emplace("AD04", sf::Keyboard::Scan::R);
-    mapping.emplace("AD05", sf::Keyboard::Scan::T);
-    mapping.emplace("AD06", sf::Keyboard::Scan::Y);
-    mapping.emplace("AD07", sf::Keyboard::Scan::U);
-    mapping.emplace("AD08", sf::Keyboard::Scan::I);
-    mapping.emplace("AD09", sf::Keyboard::Scan::O);
-    mapping.emplace("AD10", sf::Keyboard::Scan::P);
-    mapping.emplace("AD11", sf::Keyboard::Scan::LBracket);
-    mapping.emplace("AD12", sf::Keyboard::Scan::RBracket);
-    mapping.emplace("BKSL", sf::Keyboard::Scan::Backslash);
-    mapping.emplace("RTRN", sf::Keyboard::Scan::Enter);
-
-    mapping.emplace("CAPS", sf::Keyboard::Scan::CapsLock);
-    mapping.emplace("AC01", sf::Keyboard::Scan::A);
-    mapping.emplace("AC02", sf::Keyboard::Scan::S);
-    mapping.emplace("AC03", sf::Keyboard::Scan::D);
-    mapping.emplace("AC04", sf::Keyboard::Scan::F);
-    mapping.emplace("AC05", sf::Keyboard::Scan::G);
-    mapping.emplace("AC06", sf::Keyboard::Scan::H);
-    mapping.emplace("AC07", sf::Keyboard::Scan::J);
-    mapping.emplace("AC08", sf::Keyboard::Scan::K);
-    mapping.emplace("AC09", sf::Keyboard::Scan::L);
-    mapping.emplace("AC10", sf::Keyboard::Scan::Semicolon);
-    mapping.emplace("AC11", sf::Keyboard::Scan::Apostrophe);
-    mapping.emplace("AC12", sf::Keyboard::Scan::Backslash);
-
-    mapping.emplace("LFSH", sf::Keyboard::Scan::LShift);
-    mapping.emplace("AB01", sf::Keyboard::Scan::Z);
-    mapping.emplace("AB02", sf::Keyboard::Scan::X);
-    mapping.emplace("AB03", sf::Keyboard::Scan::C);
-    mapping.emplace("AB04", sf::Keyboard::Scan::V);
-    mapping.emplace("AB05", sf::Keyboard::Scan::B);
-    mapping.emplace("AB06", sf::Keyboard::Scan::N);
-    mapping.emplace("AB07", sf::Keyboard::Scan::M);
-    mapping.emplace("AB08", sf::Keyboard::Scan::Comma);
-    mapping.emplace("AB09", sf::Keyboard::Scan::Period);
-    mapping.emplace("AB10", sf::Keyboard::Scan::Slash);
-    mapping.emplace("RTSH", sf::Keyboard::Scan::RShift);
-
-    mapping.emplace("LCTL", sf::Keyboard::Scan::LControl);
-    mapping.emplace("LALT", sf::Keyboard::Scan::LAlt);
-    mapping.emplace("SPCE", sf::Keyboard::Scan::Space);
-    mapping.emplace("RCTL", sf::Keyboard::Scan::RControl);
-    mapping.emplace("RALT", sf::Keyboard::Scan::RAlt);
-    mapping.emplace("LVL3", sf::Keyboard::Scan::RAlt);
-    mapping.emplace("ALGR", sf::Keyboard::Scan::RAlt);
-    mapping.emplace("LWIN", sf::Keyboard::Scan::LSystem);
-    mapping.emplace("RWIN", sf::Keyboard::Scan::RSystem);
-
-    mapping.emplace("HYPR", sf::Keyboard::Scan::Application);
-    mapping.emplace("EXEC", sf::Keyboard::Scan::Execute);
-    mapping.emplace("MDSW", sf::Keyboard::Scan::ModeChange);
-    mapping.emplace("MENU", sf::Keyboard::Scan::Menu);
-    mapping.emplace("COMP", sf::Keyboard::Scan::Menu);
-    mapping.emplace("SELE", sf::Keyboard::Scan::Select);
-
-    mapping.emplace("ESC", sf::Keyboard::Scan::Escape);
-    mapping.emplace("FK01", sf::Keyboard::Scan::F1);
-    mapping.emplace("FK02", sf::Keyboard::Scan::F2);
-    mapping.emplace("FK03", sf::Keyboard::Scan::F3);
-    mapping.emplace("FK04", sf::Keyboard::Scan::F4);
-    mapping.emplace("FK05", sf::Keyboard::Scan::F5);
-    mapping.emplace("FK06", sf::Keyboard::Scan::F6);
-    mapping.emplace("FK07", sf::Keyboard::Scan::F7);
-    mapping.emplace("FK08", sf::Keyboard::Scan::F8);
-    mapping.emplace("FK09", sf::Keyboard::Scan::F9);
-    mapping.emplace("FK10", sf::Keyboard::Scan::F10);
-    mapping.emplace("FK11", sf::Keyboard::Scan::F11);
-    mapping.emplace("FK12", sf::Keyboard::Scan::F12);
-
-    mapping.emplace("PRSC", sf::Keyboard::Scan::PrintScreen);
-    mapping.emplace("SCLK", sf::Keyboard::Scan::ScrollLock);
-    mapping.emplace("PAUS", sf::Keyboard::Scan::Pause);
-
-    mapping.emplace("INS", sf::Keyboard::Scan::Insert);
-    mapping.emplace("HOME", sf::Keyboard::Scan::Home);
-    mapping.emplace("PGUP", sf::Keyboard::Scan::PageUp);
-    mapping.emplace("DELE", sf::Keyboard::Scan::Delete);
-    mapping.emplace("END", sf::Keyboard::Scan::End);
-    mapping.emplace("PGDN", sf::Keyboard::Scan::PageDown);
-
-    mapping.emplace("UP", sf::Keyboard::Scan::Up);
-    mapping.emplace("RGHT", sf::Keyboard::Scan::Right);
-    mapping.emplace("DOWN", sf::Keyboard::Scan::Down);
-    mapping.emplace("LEFT", sf::Keyboard::Scan::Left);
-
-    mapping.emplace("NMLK", sf::Keyboard::Scan::NumLock);
-    mapping.emplace("KPDV", sf::Keyboard::Scan::NumpadDivide);
-    mapping.emplace("KPMU", sf::Keyboard::Scan::NumpadMultiply);
-    mapping.emplace("KPSU", sf::Keyboard::Scan::NumpadMinus);
-
-    mapping.emplace("KP7", sf::Keyboard::Scan::Numpad7);
-    mapping.emplace("KP8", sf::Keyboard::Scan::Numpad8);
-    mapping.emplace("KP9", sf::Keyboard::Scan::Numpad9);
-    mapping.emplace("KPAD", sf::Keyboard::Scan::NumpadPlus);
-    mapping.emplace("KP4", sf::Keyboard::Scan::Numpad4);
-    mapping.emplace("KP5", sf::Keyboard::Scan::Numpad5);
-    mapping.emplace("KP6", sf::Keyboard::Scan::Numpad6);
-    mapping.emplace("KP1", sf::Keyboard::Scan::Numpad1);
-    mapping.emplace("KP2", sf::Keyboard::Scan::Numpad2);
-    mapping.emplace("KP3", sf::Keyboard::Scan::Numpad3);
-    mapping.emplace("KPEN", sf::Keyboard::Scan::NumpadEnter);
-    mapping.emplace("KP0", sf::Keyboard::Scan::Numpad0);
-    mapping.emplace("KPDL", sf::Keyboard::Scan::NumpadDecimal);
-    mapping.emplace("KPEQ", sf::Keyboard::Scan::NumpadEqual);
-
-    mapping.emplace("FK13", sf::Keyboard::Scan::F13);
-    mapping.emplace("FK14", sf::Keyboard::Scan::F14);
-    mapping.emplace("FK15", sf::Keyboard::Scan::F15);
-    mapping.emplace("FK16", sf::Keyboard::Scan::F16);
-    mapping.emplace("FK17", sf::Keyboard::Scan::F17);
-    mapping.emplace("FK18", sf::Keyboard::Scan::F18);
-    mapping.emplace("FK19", sf::Keyboard::Scan::F19);
-    mapping.emplace("FK20", sf::Keyboard::Scan::F20);
-    mapping.emplace("FK21", sf::Keyboard::Scan::F21);
-    mapping.emplace("FK22", sf::Keyboard::Scan::F22);
-    mapping.emplace("FK23", sf::Keyboard::Scan::F23);
-    mapping.emplace("FK24", sf::Keyboard::Scan::F24);
-    mapping.emplace("LMTA", sf::Keyboard::Scan::LSystem);
-    mapping.emplace("RMTA", sf::Keyboard::Scan::RSystem);
-    mapping.emplace("MUTE", sf::Keyboard::Scan::VolumeMute);
-    mapping.emplace("VOL-", sf::Keyboard::Scan::VolumeDown);
-    mapping.emplace("VOL+", sf::Keyboard::Scan::VolumeUp);
-    mapping.emplace("STOP", sf::Keyboard::Scan::Stop);
-    mapping.emplace("REDO", sf::Keyboard::Scan::Redo);
-    mapping.emplace("AGAI", sf::Keyboard::Scan::Redo);
-    mapping.emplace("UNDO", sf::Keyboard::Scan::Undo);
-    mapping.emplace("COPY", sf::Keyboard::Scan::Copy);
-    mapping.emplace("PAST", sf::Keyboard::Scan::Paste);
-    mapping.emplace("FIND", sf::Keyboard::Scan::Search);
-    mapping.emplace("CUT", sf::Keyboard::Scan::Cut);
-    mapping.emplace("HELP", sf::Keyboard::Scan::Help);
-
-    mapping.emplace("I156", sf::Keyboard::Scan::LaunchApplication1);
-    mapping.emplace("I157", sf::Keyboard::Scan::LaunchApplication2);
-    mapping.emplace("I164", sf::Keyboard::Scan::Favorites);
-    mapping.emplace("I166", sf::Keyboard::Scan::Back);
-    mapping.emplace("I167", sf::Keyboard::Scan::Forward);
-    mapping.emplace("I171", sf::Keyboard::Scan::MediaNextTrack);
-    mapping.emplace("I172", sf::Keyboard::Scan::MediaPlayPause);
-    mapping.emplace("I173", sf::Keyboard::Scan::MediaPreviousTrack);
-    mapping.emplace("I174", sf::Keyboard::Scan::MediaStop);
-    mapping.emplace("I180", sf::Keyboard::Scan::HomePage);
-    mapping.emplace("I181", sf::Keyboard::Scan::Refresh);
-    mapping.emplace("I223", sf::Keyboard::Scan::LaunchMail);
-    mapping.emplace("I234", sf::Keyboard::Scan::LaunchMediaSelect);
-
-    return mapping;
+    std::string_view       name;     //!< XKB name of the key
+    sf::Keyboard::Scancode scancode; //!< Scancode of the key
+};
+
+// Sort the entries by name at compile time, so that the table can be binary searched
+template <std::size_t Size>
+constexpr std::array<KeyNameScancode, Size> sortByName(std::array<KeyNameScancode, Size> entries)
+{
+    for (std::size_t i = 1; i < Size; ++i)
+    {
+        for (std::size_t j = i; (j > 0) && (entries[j].name < entries[j - 1].name); --j)
+        {
+            const KeyNameScancode entry = entries[j];
+            entries[j]                  = entries[j - 1];
+            entries[j - 1]              = entry;
+        }
+    }
+
+    return entries;
 }
 
+// clang-format off
+constexpr auto nameScancodes = sortByName(std::array<KeyNameScancode, 153>{{
+
+    {"LSGT", sf::Keyboard::Scan::NonUsBackslash},
+
+    {"TLDE", sf::Keyboard::Scan::Grave},
+    {"AE01", sf::Keyboard::Scan::Num1},
+    {"AE02", sf::Keyboard::Scan::Num2},
+    {"AE03", sf::Keyboard::Scan::Num3},
+    {"AE04", sf::Keyboard::Scan::Num4},
+    {"AE05", sf::Keyboard::Scan::Num5},
+    {"AE06", sf::Keyboard::Scan::Num6},
+    {"AE07", sf::Keyboard::Scan::Num7},
+    {"AE08", sf::Keyboard::Scan::Num8},
+    {"AE09", sf::Keyboard::Scan::Num9},
+    {"AE10", sf::Keyboard::Scan::Num0},
+    {"AE11", sf::Keyboard::Scan::Hyphen},
+    {"AE12", sf::Keyboard::Scan::Equal},
+    {"BKSP", sf::Keyboard::Scan::Backspace},
+    {"TAB", sf::Keyboard::Scan::Tab},
+    {"AD01", sf::Keyboard::Scan::Q},
+    {"AD02", sf::Keyboard::Scan::W},
+    {"AD03", sf::Keyboard::Scan::E},
+    {"AD04", sf::Keyboard::Scan::R},
+    {"AD05", sf::Keyboard::Scan::T},
+    {"AD06", sf::Keyboard::Scan::Y},
+    {"AD07", sf::Keyboard::Scan::U},
+    {"AD08", sf::Keyboard::Scan::I},
+    {"AD09", sf::Keyboard::Scan::O},
+    {"AD10", sf::Keyboard::Scan::P},
+    {"AD11", sf::Keyboard::Scan::LBracket},
+    {"AD12", sf::Keyboard::Scan::RBracket},
+    {"BKSL", sf::Keyboard::Scan::Backslash},
+    {"RTRN", sf::Keyboard::Scan::Enter},
+
+    {"CAPS", sf::Keyboard::Scan::CapsLock},
+    {"AC01", sf::Keyboard::Scan::A},
+    {"AC02", sf::Keyboard::Scan::S},
+    {"AC03", sf::Keyboard::Scan::D},
+    {"AC04", sf::Keyboard::Scan::F},
+    {"AC05", sf::Keyboard::Scan::G},
+    {"AC06", sf::Keyboard::Scan::H},
+    {"AC07", sf::Keyboard::Scan::J},
+    {"AC08", sf::Keyboard::Scan::K},
+    {"AC09", sf::Keyboard::Scan::L},
+    {"AC10", sf::Keyboard::Scan::Semicolon},
+    {"AC11", sf::Keyboard::Scan::Apostrophe},
+    {"AC12", sf::Keyboard::Scan::Backslash},
+
+    {"LFSH", sf::Keyboard::Scan::LShift},
+    {"AB01", sf::Keyboard::Scan::Z},
+    {"AB02", sf::Keyboard::Scan::X},
+    {"AB03", sf::Keyboard::Scan::C},
+    {"AB04", sf::Keyboard::Scan::V},
+    {"AB05", sf::Keyboard::Scan::B},
+    {"AB06", sf::Keyboard::Scan::N},
+    {"AB07", sf::Keyboard::Scan::M},
+    {"AB08", sf::Keyboard::Scan::Comma},
+    {"AB09", sf::Keyboard::Scan::Period},
+    {"AB10", sf::Keyboard::Scan::Slash},
+    {"RTSH", sf::Keyboard::Scan::RShift},
+
+    {"LCTL", sf::Keyboard::Scan::LControl},
+    {"LALT", sf::Keyboard::Scan::LAlt},
+    {"SPCE", sf::Keyboard::Scan::Space},
+    {"RCTL", sf::Keyboard::Scan::RControl},
+    {"RALT", sf::Keyboard::Scan::RAlt},
+    {"LVL3", sf::Keyboard::Scan::RAlt},
+    {"ALGR", sf::Keyboard::Scan::RAlt},
+    {"LWIN", sf::Keyboard::Scan::LSystem},
+    {"RWIN", sf::Keyboard::Scan::RSystem},
+
+    {"HYPR", sf::Keyboard::Scan::Application},
+    {"EXEC", sf::Keyboard::Scan::Execute},
+    {"MDSW", sf::Keyboard::Scan::ModeChange},
+    {"MENU", sf::Keyboard::Scan::Menu},
+    {"COMP", sf::Keyboard::Scan::Menu},
+    {"SELE", sf::Keyboard::Scan::Select},
+
+    {"ESC", sf::Keyboard::Scan::Escape},
+    {"FK01", sf::Keyboard::Scan::F1},
+    {"FK02", sf::Keyboard::Scan::F2},
+    {"FK03", sf::Keyboard::Scan::F3},
+    {"FK04", sf::Keyboard::Scan::F4},
+    {"FK05", sf::Keyboard::Scan::F5},
+    {"FK06", sf::Keyboard::Scan::F6},
+    {"FK07", sf::Keyboard::Scan::F7},
+    {"FK08", sf::Keyboard::Scan::F8},
+    {"FK09", sf::Keyboard::Scan::F9},
+    {"FK10", sf::Keyboard::Scan::F10},
+    {"FK11", sf::Keyboard::Scan::F11},
+    {"FK12", sf::Keyboard::Scan::F12},
+
+    {"PRSC", sf::Keyboard::Scan::PrintScreen},
+    {"SCLK", sf::Keyboard::Scan::ScrollLock},
+    {"PAUS", sf::Keyboard::Scan::Pause},
+
+    {"INS", sf::Keyboard::Scan::Insert},
+    {"HOME", sf::Keyboard::Scan::Home},
+    {"PGUP", sf::Keyboard::Scan::PageUp},
+    {"DELE", sf::Keyboard::Scan::Delete},
+    {"END", sf::Keyboard::Scan::End},
+    {"PGDN", sf::Keyboard::Scan::PageDown},
+
+    {"UP", sf::Keyboard::Scan::Up},
+    {"RGHT", sf::Keyboard::Scan::Right},
+    {"DOWN", sf::Keyboard::Scan::Down},
+    {"LEFT", sf::Keyboard::Scan::Left},
+
+    {"NMLK", sf::Keyboard::Scan::NumLock},
+    {"KPDV", sf::Keyboard::Scan::NumpadDivide},
+    {"KPMU", sf::Keyboard::Scan::NumpadMultiply},
+    {"KPSU", sf::Keyboard::Scan::NumpadMinus},
+
+    {"KP7", sf::Keyboard::Scan::Numpad7},
+    {"KP8", sf::Keyboard::Scan::Numpad8},
+    {"KP9", sf::Keyboard::Scan::Numpad9},
+    {"KPAD", sf::Keyboard::Scan::NumpadPlus},
+    {"KP4", sf::Keyboard::Scan::Numpad4},
+    {"KP5", sf::Keyboard::Scan::Numpad5},
+    {"KP6", sf::Keyboard::Scan::Numpad6},
+    {"KP1", sf::Keyboard::Scan::Numpad1},
+    {"KP2", sf::Keyboard::Scan::Numpad2},
+    {"KP3", sf::Keyboard::Scan::Numpad3},
+    {"KPEN", sf::Keyboard::Scan::NumpadEnter},
+    {"KP0", sf::Keyboard::Scan::Numpad0},
+    {"KPDL", sf::Keyboard::Scan::NumpadDecimal},
+    {"KPEQ", sf::Keyboard::Scan::NumpadEqual},
+
+    {"FK13", sf::Keyboard::Scan::F13},
+    {"FK14", sf::Keyboard::Scan::F14},
+    {"FK15", sf::Keyboard::Scan::F15},
+    {"FK16", sf::Keyboard::Scan::F16},
+    {"FK17", sf::Keyboard::Scan::F17},
+    {"FK18", sf::Keyboard::Scan::F18},
+    {"FK19", sf::Keyboard::Scan::F19},
+    {"FK20", sf::Keyboard::Scan::F20},
+    {"FK21", sf::Keyboard::Scan::F21},
+    {"FK22", sf::Keyboard::Scan::F22},
+    {"FK23", sf::Keyboard::Scan::F23},
+    {"FK24", sf::Keyboard::Scan::F24},
+    {"LMTA", sf::Keyboard::Scan::LSystem},
+    {"RMTA", sf::Keyboard::Scan::RSystem},
+    {"MUTE", sf::Keyboard::Scan::VolumeMute},
+    {"VOL-", sf::Keyboard::Scan::VolumeDown},
+    {"VOL+", sf::Keyboard::Scan::VolumeUp},
+    {"STOP", sf::Keyboard::Scan::Stop},
+    {"REDO", sf::Keyboard::Scan::Redo},
+    {"AGAI", sf::Keyboard::Scan::Redo},
+    {"UNDO", sf::Keyboard::Scan::Undo},
+    {"COPY", sf::Keyboard::Scan::Copy},
+    {"PAST", sf::Keyboard::Scan::Paste},
+    {"FIND", sf::Keyboard::Scan::Search},
+    {"CUT", sf::Keyboard::Scan::Cut},
+    {"HELP", sf::Keyboard::Scan::Help},
+
+    {"I156", sf::Keyboard::Scan::LaunchApplication1},
+    {"I157", sf::Keyboard::Scan::LaunchApplication2},
+    {"I164", sf::Keyboard::Scan::Favorites},
+    {"I166", sf::Keyboard::Scan::Back},
+    {"I167", sf::Keyboard::Scan::Forward},
+    {"I171", sf::Keyboard::Scan::MediaNextTrack},
+    {"I172", sf::Keyboard::Scan::MediaPlayPause},
+    {"I173", sf::Keyboard::Scan::MediaPreviousTrack},
+    {"I174", sf::Keyboard::Scan::MediaStop},
+    {"I180", sf::Keyboard::Scan::HomePage},
+    {"I181", sf::Keyboard::Scan::Refresh},
+    {"I223", sf::Keyboard::Scan::LaunchMail},
+    {"I234", sf::Keyboard::Scan::LaunchMediaSelect},
+}});
+// clang-format on
+
 ////////////////////////////////////////////////////////////
-void ensureMapping()
+sf::Keyboard::Scancode nameToScancode(std::string_view name)
 {
-    static bool isMappingInitialized = false;
+    const auto* const it = std::lower_bound(nameScancodes.begin(),
+                                           nameScancodes.end(),
+                                           name,
+                                           [](const KeyNameScancode& entry, std::string_view value)
+                                           { return entry.name < value; });
+
+    return ((it != nameScancodes.end()) && (it->name == name)) ? it->scancode : sf::Keyboard::Scan::Unknown;
+}
 
+////////////////////////////////////////////////////////////
+void ensureMapping()
+{
     if (isMappingInitialized)
         return;
 
     // Phase 1: Initialize mappings with default values
     scancodeToKeycode.fill(nullKeyCode);
     keycodeToScancode.fill(sf::Keyboard::Scan::Unknown);
+    keyToKeycode.fill(nullKeyCode);
 
     // Phase 2: Get XKB names with key code
     const auto display = sf::priv::openDisplay();
 
-    char       name[XkbKeyNameLength + 1];
     XkbDescPtr descriptor = XkbGetMap(display.get(), 0, XkbUseCoreKbd);
     XkbGetNames(display.get(), XkbKeyNamesMask, descriptor);
 
-    std::unordered_map<std::string, sf::Keyboard::Scancode> nameScancodeMap = getNameScancodeMap();
-
     for (int keycode = descriptor->min_key_code; keycode <= descriptor->max_key_code; ++keycode)
     {
         if (!isValidKeycode(static_cast<KeyCode>(keycode)))
@@ -481,14 +515,9 @@ void ensureMapping()
             continue;
         }
 
-        std::memcpy(name, descriptor->names->keys[keycode].name, XkbKeyNameLength);
-        name[XkbKeyNameLength] = '\0';
-
-        const auto mappedScancode = nameScancodeMap.find(std::string(name));
-        auto       scancode       = sf::Keyboard::Scan::Unknown;
-
-        if (mappedScancode != nameScancodeMap.end())
-            scancode = mappedScancode->second;
+        // Key names are padded with null characters, but aren't null terminated when they use all the characters
+        const char* const name     = descriptor->names->keys[keycode].name;
+        const auto        scancode = nameToScancode(std::string_view(name, strnlen(name, XkbKeyNameLength)));
 
         if (scancode != sf::Keyboard::Scan::Unknown)
             scancodeToKeycode[scancode] = static_cast<KeyCode>(keycode);
@@ -513,6 +542,20 @@ void ensureMapping()
         }
     }
 
+    // Phase 4: Find the key code producing each key, so that key lookups don't need the server
+    for (unsigned int i = 0; i < sf::Keyboard::KeyCount; ++i)
+    {
+        const auto   key    = static_cast<sf::Keyboard::Key>(i);
+        const KeySym keysym = sf::priv::keyToKeySym(key);
+
+        if (keysym != NoSymbol)
+            keyToKeycode[key] = XKeysymToKeycode(display.get(), keysym);
+    }
+
+    // Fallback for when XKeysymToKeycode cannot tell the KeyCode for XK_Alt_R
+    if (keyToKeycode[sf::Keyboard::Key::RAlt] == nullKeyCode)
+        keyToKeycode[sf::Keyboard::Key::RAlt] = scancodeToKeycode[sf::Keyboard::Scan::RAlt];
+
     isMappingInitialized = true;
 }
 
@@ -544,20 +587,10 @@ sf::Keyboard::Scancode keyCodeToScancode(KeyCode code)
 ////////////////////////////////////////////////////////////
 KeyCode keyToKeyCode(sf::Keyboard::Key key)
 {
-    const KeySym keysym = sf::priv::keyToKeySym(key);
-
-    if (keysym != NoSymbol)
-    {
-        const auto    display = sf::priv::openDisplay();
-        const KeyCode keycode = XKeysymToKeycode(display.get(), keysym);
-
-        if (keycode != nullKeyCode)
-            return keycode;
-    }
+    ensureMapping();
 
-    // Fallback for when XKeysymToKeycode cannot tell the KeyCode for XK_Alt_R
-    if (key == sf::Keyboard::Key::RAlt)
-        return scancodeToKeycode[sf::Keyboard::Scan::RAlt];
+    if (key != sf::Keyboard::Key::Unknown)
+        return keyToKeycode[key];
 
     return nullKeyCode;
 }
@@ -578,6 +611,13 @@ KeySym scancodeToKeySym(sf::Keyboard::Scancode code)
 }
 
 
+////////////////////////////////////////////////////////////
+bool isKeyCodeInKeymap(const char* keys, KeyCode keycode)
+{
+    return (keycode != nullKeyCode) && ((keys[keycode / 8] & (1 << (keycode % 8))) != 0);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool isKeyPressedImpl(KeyCode keycode)
 {
@@ -590,7 +630,7 @@ bool isKeyPressedImpl(KeyCode keycode)
         XQueryKeymap(display.get(), keys);
 
         // Check our keycode
-        return (keys[keycode / 8] & (1 << (keycode % 8))) != 0;
+        return isKeyCodeInKeymap(keys, keycode);
     }
 
     return false;
@@ -617,6 +657,25 @@ bool KeyboardImpl::isKeyPressed(Keyboard::Scancode code)
 }
 
 
+////////////////////////////////////////////////////////////
+void KeyboardImpl::getKeyboardState(std::bitset<Keyboard::KeyCount>&      keys,
+                                    std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    const auto display = sf::priv::openDisplay();
+
+    // Get the whole keyboard state with a single round trip to the server,
+    // the keycodes of the keys are known without asking the server again
+    char keymap[32];
+    XQueryKeymap(display.get(), keymap);
+
+    for (unsigned int i = 0; i < Keyboard::KeyCount; ++i)
+        keys[i] = isKeyCodeInKeymap(keymap, keyToKeyCode(static_cast<Keyboard::Key>(i)));
+
+    for (unsigned int i = 0; i < Keyboard::ScancodeCount; ++i)
+        scancodes[i] = isKeyCodeInKeymap(keymap, scancodeToKeyCode(static_cast<Keyboard::Scancode>(i)));
+}
+
+
 ////////////////////////////////////////////////////////////
 Keyboard::Scancode KeyboardImpl::delocalize(Keyboard::Key key)
 {
@@ -636,32 +695,7 @@ Keyboard::Key KeyboardImpl::localize(Keyboard::Scancode code)
 ////////////////////////////////////////////////////////////
 String KeyboardImpl::getDescription(Keyboard::Scancode code)
 {
-    bool checkInput = true;
-
-    // these scancodes actually correspond to keys with input
-    // but we want to return their description, not their behaviour
-    // clang-format off
-    if (code == Keyboard::Scan::Enter ||
-        code == Keyboard::Scan::Escape ||
-        code == Keyboard::Scan::Backspace ||
-        code == Keyboard::Scan::Tab ||
-        code == Keyboard::Scan::Space ||
-        code == Keyboard::Scan::ScrollLock ||
-        code == Keyboard::Scan::Pause ||
-        code == Keyboard::Scan::Delete ||
-        code == Keyboard::Scan::NumpadDivide ||
-        code == Keyboard::Scan::NumpadMultiply ||
-        code == Keyboard::Scan::NumpadMinus ||
-        code == Keyboard::Scan::NumpadPlus ||
-        code == Keyboard::Scan::NumpadEqual ||
-        code == Keyboard::Scan::NumpadEnter ||
-        code == Keyboard::Scan::NumpadDecimal)
-    // clang-format on
-    {
-        checkInput = false;
-    }
-
-    if (checkInput)
+    if (isDescribedByCharacter(code))
     {
         const KeySym   keysym  = scancodeToKeySym(code);
         const char32_t unicode = keysymToUnicode(keysym);
@@ -671,120 +705,7 @@ String KeyboardImpl::getDescription(Keyboard::Scancode code)
     }
 
     // Fallback to our best guess for the keys that are known to be independent of the layout.
-    // clang-format off
-    switch (code)
-    {
-        case Keyboard::Scan::Enter:              return "Enter";
-        case Keyboard::Scan::Escape:             return "Escape";
-        case Keyboard::Scan::Backspace:          return "Backspace";
-        case Keyboard::Scan::Tab:                return "Tab";
-        case Keyboard::Scan::Space:              return "Space";
-
-        case Keyboard::Scan::F1:                 return "F1";
-        case Keyboard::Scan::F2:                 return "F2";
-        case Keyboard::Scan::F3:                 return "F3";
-        case Keyboard::Scan::F4:                 return "F4";
-        case Keyboard::Scan::F5:                 return "F5";
-        case Keyboard::Scan::F6:                 return "F6";
-        case Keyboard::Scan::F7:                 return "F7";
-        case Keyboard::Scan::F8:                 return "F8";
-        case Keyboard::Scan::F9:                 return "F9";
-        case Keyboard::Scan::F10:                return "F10";
-        case Keyboard::Scan::F11:                return "F11";
-        case Keyboard::Scan::F12:                return "F12";
-        case Keyboard::Scan::F13:                return "F13";
-        case Keyboard::Scan::F14:                return "F14";
-        case Keyboard::Scan::F15:                return "F15";
-        case Keyboard::Scan::F16:                return "F16";
-        case Keyboard::Scan::F17:                return "F17";
-        case Keyboard::Scan::F18:                return "F18";
-        case Keyboard::Scan::F19:                return "F19";
-        case Keyboard::Scan::F20:                return "F20";
-        case Keyboard::Scan::F21:                return "F21";
-        case Keyboard::Scan::F22:                return "F22";
-        case Keyboard::Scan::F23:                return "F23";
-        case Keyboard::Scan::F24:                return "F24";
-
-        case Keyboard::Scan::CapsLock:           return "Caps Lock";
-        case Keyboard::Scan::PrintScreen:        return "Print Screen";
-        case Keyboard::Scan::ScrollLock:         return "Scroll Lock";
-
-        case Keyboard::Scan::Pause:              return "Pause";
-        case Keyboard::Scan::Insert:             return "Insert";
-        case Keyboard::Scan::Home:               return "Home";
-        case Keyboard::Scan::PageUp:             return "Page Up";
-        case Keyboard::Scan::Delete:             return "Delete";
-        case Keyboard::Scan::End:                return "End";
-        case Keyboard::Scan::PageDown:           return "Page Down";
-
-        case Keyboard::Scan::Left:               return "Left Arrow";
-        case Keyboard::Scan::Right:              return "Right Arrow";
-        case Keyboard::Scan::Down:               return "Down Arrow";
-        case Keyboard::Scan::Up:                 return "Up Arrow";
-
-        case Keyboard::Scan::NumLock:            return "Num Lock";
-        case Keyboard::Scan::NumpadDivide:       return "Divide (Numpad)";
-        case Keyboard::Scan::NumpadMultiply:     return "Multiply (Numpad)";
-        case Keyboard::Scan::NumpadMinus:        return "Minus (Numpad)";
-        case Keyboard::Scan::NumpadPlus:         return "Plus (Numpad)";
-        case Keyboard::Scan::NumpadEqual:        return "Equal (Numpad)";
-        case Keyboard::Scan::NumpadEnter:        return "Enter (Numpad)";
-        case Keyboard::Scan::NumpadDecimal:      return "Decimal (Numpad)";
-
-        case Keyboard::Scan::Numpad0:            return "0 (Numpad)";
-        case Keyboard::Scan::Numpad1:            return "1 (Numpad)";
-        case Keyboard::Scan::Numpad2:            return "2 (Numpad)";
-        case Keyboard::Scan::Numpad3:            return "3 (Numpad)";
-        case Keyboard::Scan::Numpad4:            return "4 (Numpad)";
-        case Keyboard::Scan::Numpad5:            return "5 (Numpad)";
-        case Keyboard::Scan::Numpad6:            return "6 (Numpad)";
-        case Keyboard::Scan::Numpad7:            return "7 (Numpad)";
-        case Keyboard::Scan::Numpad8:            return "8 (Numpad)";
-        case Keyboard::Scan::Numpad9:            return "9 (Numpad)";
-
-        case Keyboard::Scan::Application:        return "Application";
-        case Keyboard::Scan::Execute:            return "Execute";
-        case Keyboard::Scan::Help:               return "Help";
-        case Keyboard::Scan::Menu:               return "Menu";
-        case Keyboard::Scan::Select:             return "Select";
-        case Keyboard::Scan::Stop:               return "Stop";
-        case Keyboard::Scan::Redo:               return "Redo";
-        case Keyboard::Scan::Undo:               return "Undo";
-        case Keyboard::Scan::Cut:                return "Cut";
-        case Keyboard::Scan::Copy:               return "Copy";
-        case Keyboard::Scan::Paste:              return "Paste";
-        case Keyboard::Scan::Search:             return "Search";
-
-        case Keyboard::Scan::VolumeMute:         return "Volume Mute";
-        case Keyboard::Scan::VolumeUp:           return "Volume Up";
-        case Keyboard::Scan::VolumeDown:         return "Volume Down";
-
-        case Keyboard::Scan::LControl:           return "Left Control";
-        case Keyboard::Scan::LShift:             return "Left Shift";
-        case Keyboard::Scan::LAlt:               return "Left Alt";
-        case Keyboard::Scan::LSystem:            return "Left System";
-        case Keyboard::Scan::RControl:           return "Right Control";
-        case Keyboard::Scan::RShift:             return "Right Shift";
-        case Keyboard::Scan::RAlt:               return "Right Alt";
-        case Keyboard::Scan::RSystem:            return "Right System";
-
-        case Keyboard::Scan::LaunchApplication1: return "Launch Application 1";
-        case Keyboard::Scan::LaunchApplication2: return "Launch Application 2";
-        case Keyboard::Scan::Favorites:          return "Favorites";
-        case Keyboard::Scan::Back:               return "Back";
-        case Keyboard::Scan::Forward:            return "Forward";
-        case Keyboard::Scan::MediaNextTrack:     return "Media Next Track";
-        case Keyboard::Scan::MediaPlayPause:     return "Media Play Pause";
-        case Keyboard::Scan::MediaPreviousTrack: return "Media Previous Track";
-        case Keyboard::Scan::MediaStop:          return "Media Stop";
-        case Keyboard::Scan::HomePage:           return "Home Page";
-        case Keyboard::Scan::Refresh:            return "Refresh";
-        case Keyboard::Scan::LaunchMail:         return "Launch Mail";
-        case Keyboard::Scan::LaunchMediaSelect:  return "Launch Media Select";
-
-        default:                                 return "Unknown Scancode";
-    }
-    // clang-format on
+    return getKeyName(code);
 }
 
 
@@ -811,4 +732,11 @@ Keyboard::Scancode KeyboardImpl::getScancodeFromEvent(XKeyEvent& event)
     return keyCodeToScancode(static_cast<KeyCode>(event.keycode));
 }
 
+
+////////////////////////////////////////////////////////////
+void KeyboardImpl::invalidateMapping()
+{
+    isMappingInitialized = false;
+}
+
 } // namespace sf::priv
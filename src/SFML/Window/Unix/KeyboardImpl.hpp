@@ -31,6 +31,8 @@
 
 #include <X11/Xlib.h> // XKeyEvent
 
+#include <bitset>
+
 
 ////////////////////////////////////////////////////////////
 /// \brief sf::priv::KeyboardImpl helper
@@ -52,6 +54,15 @@ bool isKeyPressed(Keyboard::Key key);
 ////////////////////////////////////////////////////////////
 bool isKeyPressed(Keyboard::Scancode code);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the state of all the keys with a single request to the server
+///
+/// \param keys      Filled with the state of each key
+/// \param scancodes Filled with the state of each scancode
+///
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes);
+
 ////////////////////////////////////////////////////////////
 /// \copydoc sf::Keyboard::localize
 ///
@@ -90,4 +101,12 @@ Keyboard::Key getKeyFromEvent(XKeyEvent& event);
 ////////////////////////////////////////////////////////////
 Keyboard::Scancode getScancodeFromEvent(XKeyEvent& event);
 
+////////////////////////////////////////////////////////////
+/// \brief Rebuild the key code mappings on their next use
+///
+/// Called when the server notifies a change of the keyboard mapping.
+///
+////////////////////////////////////////////////////////////
+void invalidateMapping();
+
 } // namespace sf::priv::KeyboardImpl
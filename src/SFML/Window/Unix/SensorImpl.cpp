@@ -81,4 +81,19 @@ void SensorImpl::setEnabled(bool /*enabled*/)
     // TODO: not implemented
 }
 
+
+////////////////////////////////////////////////////////////
+bool SensorImpl::setBatching(bool /*enabled*/, Time /*samplingPeriod*/, Time /*maxReportLatency*/)
+{
+    // Batching is deliberately reported as unsupported, sensors of this platform are only read one value at a time
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void SensorImpl::readSamples(std::vector<Sensor::Sample>& /*samples*/)
+{
+    // Batching is never enabled on this platform, so there are no samples to read
+}
+
 } // namespace sf::priv
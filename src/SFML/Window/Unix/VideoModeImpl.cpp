@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <ostream>
+#include <string>
 
 
 namespace sf::priv
@@ -51,6 +52,39 @@ struct XDeleter<XRRScreenConfiguration>
 };
 
 
+////////////////////////////////////////////////////////////
+template <>
+struct XDeleter<XRRScreenResources>
+{
+    void operator()(XRRScreenResources* res) const
+    {
+        XRRFreeScreenResources(res);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+template <>
+struct XDeleter<XRROutputInfo>
+{
+    void operator()(XRROutputInfo* outputInfo) const
+    {
+        XRRFreeOutputInfo(outputInfo);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+template <>
+struct XDeleter<XRRCrtcInfo>
+{
+    void operator()(XRRCrtcInfo* crtcInfo) const
+    {
+        XRRFreeCrtcInfo(crtcInfo);
+    }
+};
+
+
 ////////////////////////////////////////////////////////////
 std::vector<VideoMode> VideoModeImpl::getFullscreenModes()
 {
@@ -190,4 +224,108 @@ VideoMode VideoModeImpl::getDesktopMode()
     return desktopMode;
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    std::vector<Monitor> monitors;
+
+    // Open a connection with the X server
+    const auto display = openDisplay();
+    if (!display)
+    {
+        err() << "Failed to connect to the X server while trying to get the monitors" << std::endl;
+        return monitors;
+    }
+
+    // Outputs and CRTCs require XRandR 1.2
+    int eventBase = 0;
+    int errorBase = 0;
+    int major     = 0;
+    int minor     = 0;
+    if (XRRQueryExtension(display.get(), &eventBase, &errorBase) && XRRQueryVersion(display.get(), &major, &minor) &&
+        ((major > 1) || (minor >= 2)))
+    {
+        const ::Window root = DefaultRootWindow(display.get());
+
+        // The current resources are those last queried by the server, unlike XRRGetScreenResources it doesn't poll
+        // the hardware, which can take several milliseconds
+        const auto res = X11Ptr<XRRScreenResources>(XRRGetScreenResourcesCurrent(display.get(), root));
+        if (res)
+        {
+            const RROutput primary = XRRGetOutputPrimary(display.get(), root);
+            const int      screen  = DefaultScreen(display.get());
+            const auto     depth   = static_cast<unsigned int>(DefaultDepth(display.get(), screen));
+
+            for (int i = 0; i < res->noutput; ++i)
+            {
+                // Only the outputs which are connected and displaying a part of the screen are monitors
+                const RROutput output     = res->outputs[i];
+                const auto     outputInfo = X11Ptr<XRROutputInfo>(XRRGetOutputInfo(display.get(), res.get(), output));
+                if (!outputInfo || (outputInfo->connection != RR_Connected) || (outputInfo->crtc == None))
+                    continue;
+
+                const auto crtcInfo = X11Ptr<XRRCrtcInfo>(XRRGetCrtcInfo(display.get(), res.get(), outputInfo->crtc));
+                if (!crtcInfo)
+                    continue;
+
+                // The size of the CRTC already accounts for its rotation
+                Monitor monitor;
+                monitor.name     = std::string(outputInfo->name, static_cast<std::size_t>(outputInfo->nameLen));
+                monitor.position = {crtcInfo->x, crtcInfo->y};
+                monitor.mode     = VideoMode({crtcInfo->width, crtcInfo->height}, depth);
+                monitor.primary  = output == primary;
+
+                for (int j = 0; j < res->nmode; ++j)
+                {
+                    const XRRModeInfo& modeInfo = res->modes[j];
+                    if ((modeInfo.id == crtcInfo->mode) && (modeInfo.hTotal != 0) && (modeInfo.vTotal != 0))
+                    {
+                        double lines = modeInfo.vTotal;
+                        if (modeInfo.modeFlags & RR_DoubleScan)
+                            lines *= 2;
+                        if (modeInfo.modeFlags & RR_Interlace)
+                            lines /= 2;
+
+                        monitor.refreshRate = static_cast<float>(static_cast<double>(modeInfo.dotClock) /
+                                                                 (modeInfo.hTotal * lines));
+                    }
+                }
+
+                monitors.push_back(monitor);
+            }
+        }
+        else
+        {
+            err() << "Failed to retrieve the screen resources while trying to get the monitors" << std::endl;
+        }
+    }
+
+    // Without XRandR 1.2, the whole screen is a single monitor
+    if (monitors.empty())
+    {
+        Monitor monitor;
+        monitor.mode    = getDesktopMode();
+        monitor.primary = true;
+        monitors.push_back(monitor);
+    }
+
+    // Put the primary monitor first
+    std::stable_partition(monitors.begin(), monitors.end(), [](const Monitor& monitor) { return monitor.primary; });
+
+    // XRandR may report no primary output, the first one is used then
+    if (!monitors.front().primary)
+        monitors.front().primary = true;
+
+    return monitors;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // Windows select the XRandR notifications on the root window
+    return true;
+}
+
 } // namespace sf::priv
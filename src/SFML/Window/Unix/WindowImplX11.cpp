@@ -32,6 +32,7 @@
 #include <SFML/Window/Unix/KeyboardImpl.hpp>
 #include <SFML/Window/Unix/Utils.hpp>
 #include <SFML/Window/Unix/WindowImplX11.hpp>
+#include <SFML/Window/VideoModeImpl.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Sleep.hpp>
@@ -64,7 +65,9 @@
 #include <vector>
 
 #include <cassert>
+#include <cstdint>
 #include <cstring>
+#include <ctime>
 
 #ifdef SFML_OPENGL_ES
 #include <SFML/Window/EglContext.hpp>
@@ -96,11 +99,22 @@ constexpr unsigned long eventMask = FocusChangeMask | ButtonPressMask | ButtonRe
 
 constexpr unsigned int maxTrialsCount = 5;
 
+// First event type of the XRandR extension, -1 until the notifications are selected
+int randrEventBase = -1;
+
+// Check if an event is one of the XRandR notifications selected on the root window
+bool isRandrEvent(int type)
+{
+    return (randrEventBase >= 0) &&
+           ((type == randrEventBase + RRScreenChangeNotify) || (type == randrEventBase + RRNotify));
+}
+
 // Filter the events received by windows (only allow those matching a specific window or those needed for the IM to work)
 // NOLINTNEXTLINE(readability-non-const-parameter)
 Bool checkEvent(::Display*, XEvent* event, XPointer userData)
 {
-    if (event->xany.window == reinterpret_cast<::Window>(userData) || event->type == GenericEvent)
+    if (event->xany.window == reinterpret_cast<::Window>(userData) || event->type == GenericEvent ||
+        isRandrEvent(event->type))
     {
         // The event matches the current window so pick it up
         return true;
@@ -399,6 +413,56 @@ bool initRawMouse(::Display* disp)
 
     return false;
 }
+
+
+////////////////////////////////////////////////////////////
+bool initRandrNotifications(::Display* disp)
+{
+    int event = 0;
+    int error = 0;
+
+    if (!XRRQueryExtension(disp, &event, &error))
+        return false;
+
+    // The notifications are sent to the root window, whichever window of the application picks them up
+    XRRSelectInput(disp,
+                   DefaultRootWindow(disp),
+                   RRScreenChangeNotifyMask | RRCrtcChangeNotifyMask | RROutputChangeNotifyMask);
+    randrEventBase = event;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<::Time> getServerTime(const XEvent& event)
+{
+    switch (event.type)
+    {
+        case KeyPress:
+        case KeyRelease:
+            return event.xkey.time;
+        case ButtonPress:
+        case ButtonRelease:
+            return event.xbutton.time;
+        case MotionNotify:
+            return event.xmotion.time;
+        case EnterNotify:
+        case LeaveNotify:
+            return event.xcrossing.time;
+        default:
+            return std::nullopt;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t getMonotonicMilliseconds()
+{
+    // X servers timestamp their events in milliseconds of the monotonic clock
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::uint32_t>(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
 } // namespace WindowImplX11Impl
 } // namespace
 
@@ -797,6 +861,8 @@ void WindowImplX11::processEvents()
         }
     }
 
+    setSystemEventTimestamp(std::nullopt);
+
     // Process clipboard window events
     priv::ClipboardImpl::processEvents();
 }
@@ -1598,6 +1664,10 @@ void WindowImplX11::initialize()
     {
         if (!initRawMouse(m_display.get()))
             sf::err() << "Failed to initialize raw mouse input" << std::endl;
+
+        // Without the notifications, the cached video modes are never refreshed
+        if (!initRandrNotifications(m_display.get()))
+            sf::err() << "Failed to select the XRandR notifications" << std::endl;
     }
 
     // Show the window
@@ -1678,6 +1748,20 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
 {
     using namespace WindowImplX11Impl;
 
+    // Timestamp the input events with the time at which the server generated them
+    if (const std::optional<::Time> serverTime = getServerTime(windowEvent))
+        setSystemEventTimestamp(convertSystemTime(static_cast<std::uint32_t>(*serverTime), getMonotonicMilliseconds()));
+    else
+        setSystemEventTimestamp(std::nullopt);
+
+    // The monitors changed: forget the cached video modes, all the windows will send MonitorsChanged
+    if (isRandrEvent(windowEvent.type))
+    {
+        XRRUpdateConfiguration(&windowEvent);
+        VideoModeImpl::invalidateCache();
+        return true;
+    }
+
     // Convert the X11 event to a sf::Event
     switch (windowEvent.type)
     {
@@ -2007,7 +2091,10 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
         case MappingNotify:
         {
             if (windowEvent.xmapping.request == MappingKeyboard)
+            {
                 XRefreshKeyboardMapping(&windowEvent.xmapping);
+                KeyboardImpl::invalidateMapping();
+            }
 
             break;
         }
@@ -2062,6 +2149,9 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                     int         relativeValueX = 0;
                     int         relativeValueY = 0;
 
+                    setSystemEventTimestamp(
+                        convertSystemTime(static_cast<std::uint32_t>(rawEvent->time), getMonotonicMilliseconds()));
+
                     // Get relative input values
                     if ((rawEvent->valuators.mask_len > 0) && XIMaskIsSet(rawEvent->valuators.mask, 0))
                         relativeValueX = static_cast<int>(rawEvent->raw_values[0]);
@@ -2069,7 +2159,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                     if ((rawEvent->valuators.mask_len > 1) && XIMaskIsSet(rawEvent->valuators.mask, 1))
                         relativeValueY = static_cast<int>(rawEvent->raw_values[1]);
 
-                    pushEvent(Event::MouseMovedRaw{{relativeValueX, relativeValueY}});
+                    pushRawMouseMovement({relativeValueX, relativeValueY});
                 }
 
                 XFreeEventData(m_display.get(), &windowEvent.xcookie);
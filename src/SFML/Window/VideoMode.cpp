@@ -29,7 +29,33 @@
 #include <SFML/Window/VideoModeImpl.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <mutex>
+
+
+namespace
+{
+// Results of the OS-specific implementation, kept until the monitors change
+struct VideoModeCache
+{
+    std::mutex                 mutex;
+    sf::VideoMode              desktopMode;
+    std::vector<sf::VideoMode> fullscreenModes;
+    std::vector<sf::Monitor>   monitors;
+    bool                       desktopModeValid{};
+    bool                       fullscreenModesValid{};
+    bool                       monitorsValid{};
+};
+
+VideoModeCache& getCache()
+{
+    static VideoModeCache cache;
+    return cache;
+}
+
+std::atomic<unsigned int> changeCount{};
+} // namespace
 
 
 namespace sf
@@ -45,22 +71,50 @@ bitsPerPixel(modeBitsPerPixel)
 ////////////////////////////////////////////////////////////
 VideoMode VideoMode::getDesktopMode()
 {
-    // Directly forward to the OS-specific implementation
-    return priv::VideoModeImpl::getDesktopMode();
+    VideoModeCache&       cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    // Without notifications, the desktop mode may change at any time
+    if (!cache.desktopModeValid)
+    {
+        cache.desktopMode      = priv::VideoModeImpl::getDesktopMode();
+        cache.desktopModeValid = priv::VideoModeImpl::notifiesChanges();
+    }
+
+    return cache.desktopMode;
 }
 
 
 ////////////////////////////////////////////////////////////
 const std::vector<VideoMode>& VideoMode::getFullscreenModes()
 {
-    static const auto modes = []
+    VideoModeCache&       cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    if (!cache.fullscreenModesValid)
     {
-        std::vector<VideoMode> result = priv::VideoModeImpl::getFullscreenModes();
-        std::sort(result.begin(), result.end(), std::greater<>());
-        return result;
-    }();
+        cache.fullscreenModes = priv::VideoModeImpl::getFullscreenModes();
+        std::sort(cache.fullscreenModes.begin(), cache.fullscreenModes.end(), std::greater<>());
+        cache.fullscreenModesValid = true;
+    }
 
-    return modes;
+    return cache.fullscreenModes;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Monitor>& VideoMode::getMonitors()
+{
+    VideoModeCache&       cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    if (!cache.monitorsValid)
+    {
+        cache.monitors      = priv::VideoModeImpl::getMonitors();
+        cache.monitorsValid = priv::VideoModeImpl::notifiesChanges();
+    }
+
+    return cache.monitors;
 }
 
 
@@ -128,4 +182,24 @@ bool operator>=(const VideoMode& left, const VideoMode& right)
     return !(left < right);
 }
 
+
+////////////////////////////////////////////////////////////
+void priv::VideoModeImpl::invalidateCache()
+{
+    VideoModeCache&       cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    cache.desktopModeValid     = false;
+    cache.fullscreenModesValid = false;
+    cache.monitorsValid        = false;
+    ++changeCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int priv::VideoModeImpl::getChangeCount()
+{
+    return changeCount;
+}
+
 } // namespace sf
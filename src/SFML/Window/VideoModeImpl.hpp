@@ -56,6 +56,46 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     static VideoMode getDesktopMode();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the monitors connected to the desktop
+    ///
+    /// \return Array filled with the monitors, the primary one first
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::vector<Monitor> getMonitors();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the system reports the changes of the monitors
+    ///
+    /// When it does, the implementation calls invalidateCache
+    /// whenever the monitors change, and the desktop mode and
+    /// the monitors can be cached.
+    ///
+    /// \return True if the changes of the monitors are reported
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool notifiesChanges();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Invalidate the cached video modes and monitors
+    ///
+    /// This function is common to all the implementations and
+    /// can be called from any thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void invalidateCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the cache was invalidated
+    ///
+    /// Windows compare it to the last value they saw to know
+    /// when to send a sf::Event::MonitorsChanged event.
+    ///
+    /// \return Number of changes of the monitors
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getChangeCount();
 };
 
 } // namespace sf::priv
@@ -0,0 +1,635 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/VulkanSwapchain.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#define VK_NO_PROTOTYPES
+#include <vulkan.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace VulkanSwapchainImpl
+{
+// VK_KHR_present_id and VK_KHR_present_wait are newer than the bundled Vulkan headers
+constexpr auto structureTypePresentId = static_cast<VkStructureType>(1000294000);
+
+struct PresentId
+{
+    VkStructureType      sType;
+    const void*          pNext;
+    std::uint32_t        swapchainCount;
+    const std::uint64_t* pPresentIds;
+};
+
+using WaitForPresentFunction = VkResult(VKAPI_PTR*)(VkDevice, VkSwapchainKHR, std::uint64_t, std::uint64_t);
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+[[nodiscard]] bool loadFunction(T& function, const char* name)
+{
+    function = reinterpret_cast<T>(sf::Vulkan::getFunction(name));
+    return function != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+[[nodiscard]] bool loadFunction(T& function, PFN_vkGetDeviceProcAddr getProcAddr, VkDevice device, const char* name)
+{
+    function = reinterpret_cast<T>(getProcAddr(device, name));
+    return function != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] VkPresentModeKHR toVulkan(sf::VulkanSwapchain::PresentMode presentMode)
+{
+    switch (presentMode)
+    {
+        case sf::VulkanSwapchain::PresentMode::FifoRelaxed:
+            return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+        case sf::VulkanSwapchain::PresentMode::Mailbox:
+            return VK_PRESENT_MODE_MAILBOX_KHR;
+        case sf::VulkanSwapchain::PresentMode::Immediate:
+            return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        default:
+            return VK_PRESENT_MODE_FIFO_KHR;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] VkSurfaceFormatKHR chooseFormat(const std::vector<VkSurfaceFormatKHR>& formats, bool sRgb)
+{
+    const std::array<VkFormat, 2> preferred = sRgb ? std::array{VK_FORMAT_B8G8R8A8_SRGB, VK_FORMAT_R8G8B8A8_SRGB}
+                                                   : std::array{VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_R8G8B8A8_UNORM};
+
+    // A single undefined format means that any format can be used
+    if ((formats.size() == 1) && (formats.front().format == VK_FORMAT_UNDEFINED))
+        return {preferred.front(), VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+
+    for (const VkFormat format : preferred)
+    {
+        for (const VkSurfaceFormatKHR& surfaceFormat : formats)
+        {
+            if ((surfaceFormat.format == format) && (surfaceFormat.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR))
+                return surfaceFormat;
+        }
+    }
+
+    return formats.front();
+}
+} // namespace VulkanSwapchainImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct VulkanSwapchain::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Swapchain replaced by a new one, destroyed once its images can't be in flight anymore
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Retired
+    {
+        VkSwapchainKHR           swapchain{};    //!< Retired swapchain
+        std::vector<VkImageView> imageViews;     //!< Views of its images
+        std::size_t              presentsLeft{}; //!< Presentations of the new swapchains before it is destroyed
+    };
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFunctions()
+    {
+        using VulkanSwapchainImpl::loadFunction;
+
+        if (!loadFunction(getSurfaceCapabilities, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR") ||
+            !loadFunction(getSurfaceFormats, "vkGetPhysicalDeviceSurfaceFormatsKHR") ||
+            !loadFunction(getSurfacePresentModes, "vkGetPhysicalDeviceSurfacePresentModesKHR") ||
+            !loadFunction(getDeviceProcAddr, "vkGetDeviceProcAddr"))
+            return false;
+
+        if (!loadFunction(createSwapchain, getDeviceProcAddr, device, "vkCreateSwapchainKHR") ||
+            !loadFunction(destroySwapchain, getDeviceProcAddr, device, "vkDestroySwapchainKHR") ||
+            !loadFunction(getSwapchainImages, getDeviceProcAddr, device, "vkGetSwapchainImagesKHR") ||
+            !loadFunction(acquireNextImage, getDeviceProcAddr, device, "vkAcquireNextImageKHR") ||
+            !loadFunction(queuePresent, getDeviceProcAddr, device, "vkQueuePresentKHR") ||
+            !loadFunction(createImageView, getDeviceProcAddr, device, "vkCreateImageView") ||
+            !loadFunction(destroyImageView, getDeviceProcAddr, device, "vkDestroyImageView"))
+            return false;
+
+        // Optional, only used with present wait
+        if (!settings.presentWait || !loadFunction(waitForPresent, getDeviceProcAddr, device, "vkWaitForPresentKHR"))
+            waitForPresent = nullptr;
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void destroyImageViews(std::vector<VkImageView>& views) const
+    {
+        for (const VkImageView view : views)
+            destroyImageView(device, view, nullptr);
+
+        views.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void retire()
+    {
+        if (swapchain == VK_NULL_HANDLE)
+            return;
+
+        retired.push_back({swapchain, std::move(imageViews), 0});
+        swapchain = VK_NULL_HANDLE;
+        images.clear();
+        imageViews.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool build(const Vector2u& requestedSize)
+    {
+        VkSurfaceCapabilitiesKHR capabilities{};
+        if (getSurfaceCapabilities(physicalDevice, surface, &capabilities) != VK_SUCCESS)
+        {
+            err() << "Failed to query the capabilities of the Vulkan surface" << std::endl;
+            return false;
+        }
+
+        // The surface either imposes its size, or accepts any size within its limits
+        VkExtent2D extent = capabilities.currentExtent;
+        if (extent.width == std::numeric_limits<std::uint32_t>::max())
+        {
+            extent.width  = std::clamp(requestedSize.x,
+                                       capabilities.minImageExtent.width,
+                                       capabilities.maxImageExtent.width);
+            extent.height = std::clamp(requestedSize.y,
+                                       capabilities.minImageExtent.height,
+                                       capabilities.maxImageExtent.height);
+        }
+
+        // Minimized windows have no surface to present to
+        if ((extent.width == 0) || (extent.height == 0))
+        {
+            outOfDate = true;
+            return false;
+        }
+
+        // Mailbox needs an image being displayed, one queued and one being rendered to
+        std::uint32_t imageCount = std::max(settings.minImageCount, capabilities.minImageCount + 1);
+        if (presentMode == VK_PRESENT_MODE_MAILBOX_KHR)
+            imageCount = std::max(imageCount, 3u);
+        if (capabilities.maxImageCount > 0)
+            imageCount = std::min(imageCount, capabilities.maxImageCount);
+
+        VkCompositeAlphaFlagBitsKHR compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+        for (const VkCompositeAlphaFlagBitsKHR candidate : {VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+                                                            VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR,
+                                                            VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR,
+                                                            VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR})
+        {
+            if ((capabilities.supportedCompositeAlpha & static_cast<VkCompositeAlphaFlagsKHR>(candidate)) != 0)
+            {
+                compositeAlpha = candidate;
+                break;
+            }
+        }
+
+        std::vector<std::uint32_t> queueFamilies = settings.queueFamilies;
+        std::sort(queueFamilies.begin(), queueFamilies.end());
+        queueFamilies.erase(std::unique(queueFamilies.begin(), queueFamilies.end()), queueFamilies.end());
+
+        VkSwapchainCreateInfoKHR createInfo{};
+        createInfo.sType            = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+        createInfo.surface          = surface;
+        createInfo.minImageCount    = imageCount;
+        createInfo.imageFormat      = format.format;
+        createInfo.imageColorSpace  = format.colorSpace;
+        createInfo.imageExtent      = extent;
+        createInfo.imageArrayLayers = 1;
+        createInfo.imageUsage       = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                                      (capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+        if (queueFamilies.size() > 1)
+        {
+            createInfo.imageSharingMode      = VK_SHARING_MODE_CONCURRENT;
+            createInfo.queueFamilyIndexCount = static_cast<std::uint32_t>(queueFamilies.size());
+            createInfo.pQueueFamilyIndices   = queueFamilies.data();
+        }
+        else
+        {
+            createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        }
+        createInfo.preTransform   = (capabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR)
+                                        ? VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR
+                                        : capabilities.currentTransform;
+        createInfo.compositeAlpha = compositeAlpha;
+        createInfo.presentMode    = presentMode;
+        createInfo.clipped        = VK_TRUE;
+        createInfo.oldSwapchain   = swapchain;
+
+        // The old swapchain is retired even if the creation fails
+        VkSwapchainKHR newSwapchain = VK_NULL_HANDLE;
+        const VkResult result       = createSwapchain(device, &createInfo, nullptr, &newSwapchain);
+        retire();
+        if (result != VK_SUCCESS)
+        {
+            err() << "Failed to create Vulkan swapchain" << std::endl;
+            outOfDate = true;
+            return false;
+        }
+
+        swapchain      = newSwapchain;
+        size           = {extent.width, extent.height};
+        outOfDate      = false;
+        firstPresentId = presentId + 1;
+
+        std::uint32_t count = 0;
+        getSwapchainImages(device, swapchain, &count, nullptr);
+        images.resize(count);
+        getSwapchainImages(device, swapchain, &count, images.data());
+
+        for (const VkImage image : images)
+        {
+            VkImageViewCreateInfo viewInfo{};
+            viewInfo.sType            = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            viewInfo.image            = image;
+            viewInfo.viewType         = VK_IMAGE_VIEW_TYPE_2D;
+            viewInfo.format           = format.format;
+            viewInfo.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+            VkImageView view = VK_NULL_HANDLE;
+            if (createImageView(device, &viewInfo, nullptr, &view) != VK_SUCCESS)
+            {
+                err() << "Failed to create Vulkan swapchain image view" << std::endl;
+                retire();
+                outOfDate = true;
+                return false;
+            }
+
+            imageViews.push_back(view);
+        }
+
+        // The previous swapchains are kept until the new one has cycled through all its images
+        for (Retired& entry : retired)
+            entry.presentsLeft = std::max(entry.presentsLeft, images.size());
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void destroyRetired(bool all)
+    {
+        for (auto it = retired.begin(); it != retired.end();)
+        {
+            if (all || (it->presentsLeft == 0))
+            {
+                destroyImageViews(it->imageViews);
+                destroySwapchain(device, it->swapchain, nullptr);
+                it = retired.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    VkPhysicalDevice         physicalDevice{};                      //!< Physical device the device was created from
+    VkDevice                 device{};                              //!< Device owning the swapchain
+    VkSurfaceKHR             surface{};                             //!< Surface presented to
+    Settings                 settings;                              //!< Parameters given to create
+    VkSurfaceFormatKHR       format{};                              //!< Format of the images
+    VkPresentModeKHR         presentMode{VK_PRESENT_MODE_FIFO_KHR}; //!< Present mode in use
+    VkSwapchainKHR           swapchain{};                           //!< Current swapchain
+    std::vector<VkImage>     images;                                //!< Images of the current swapchain
+    std::vector<VkImageView> imageViews;                            //!< Views of the images
+    std::vector<Retired>     retired;                               //!< Previous swapchains not destroyed yet
+    Vector2u                 size;                                  //!< Size of the images
+    bool                     outOfDate{};                           //!< Must the swapchain be recreated?
+    std::uint64_t            presentId{};                           //!< Identifier of the last presentation
+    std::uint64_t            firstPresentId{1};                     //!< First presentation to the current swapchain
+
+    PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR getSurfaceCapabilities{}; //!< Query the surface capabilities
+    PFN_vkGetPhysicalDeviceSurfaceFormatsKHR      getSurfaceFormats{};      //!< Query the surface formats
+    PFN_vkGetPhysicalDeviceSurfacePresentModesKHR getSurfacePresentModes{}; //!< Query the surface present modes
+    PFN_vkGetDeviceProcAddr                       getDeviceProcAddr{};      //!< vkGetDeviceProcAddr
+    PFN_vkCreateSwapchainKHR                      createSwapchain{};        //!< vkCreateSwapchainKHR
+    PFN_vkDestroySwapchainKHR                     destroySwapchain{};       //!< vkDestroySwapchainKHR
+    PFN_vkGetSwapchainImagesKHR                   getSwapchainImages{};     //!< vkGetSwapchainImagesKHR
+    PFN_vkAcquireNextImageKHR                     acquireNextImage{};       //!< vkAcquireNextImageKHR
+    PFN_vkQueuePresentKHR                         queuePresent{};           //!< vkQueuePresentKHR
+    PFN_vkCreateImageView                         createImageView{};        //!< vkCreateImageView
+    PFN_vkDestroyImageView                        destroyImageView{};       //!< vkDestroyImageView
+    VulkanSwapchainImpl::WaitForPresentFunction   waitForPresent{};         //!< vkWaitForPresentKHR, if enabled
+};
+
+
+////////////////////////////////////////////////////////////
+VulkanSwapchain::VulkanSwapchain() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VulkanSwapchain::~VulkanSwapchain()
+{
+    destroy();
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::create(VkPhysicalDevice physicalDevice,
+                             VkDevice         device,
+                             VkSurfaceKHR     surface,
+                             const Vector2u&  size,
+                             const Settings&  settings)
+{
+    destroy();
+
+    Impl& impl          = *m_impl;
+    impl.physicalDevice = physicalDevice;
+    impl.device         = device;
+    impl.surface        = surface;
+    impl.settings       = settings;
+    if (!impl.loadFunctions())
+    {
+        err() << "Failed to create Vulkan swapchain: VK_KHR_swapchain functions are not available" << std::endl;
+        impl.device = VK_NULL_HANDLE;
+        return false;
+    }
+
+    std::uint32_t count = 0;
+    impl.getSurfaceFormats(physicalDevice, surface, &count, nullptr);
+    std::vector<VkSurfaceFormatKHR> formats(count);
+    impl.getSurfaceFormats(physicalDevice, surface, &count, formats.data());
+    formats.resize(count);
+
+    impl.getSurfacePresentModes(physicalDevice, surface, &count, nullptr);
+    std::vector<VkPresentModeKHR> presentModes(count);
+    impl.getSurfacePresentModes(physicalDevice, surface, &count, presentModes.data());
+    presentModes.resize(count);
+
+    if (formats.empty())
+    {
+        err() << "Failed to create Vulkan swapchain: the surface has no supported format" << std::endl;
+        impl.device = VK_NULL_HANDLE;
+        return false;
+    }
+
+    // Fifo is the only mode every surface has to support
+    const VkPresentModeKHR requested = VulkanSwapchainImpl::toVulkan(settings.presentMode);
+    impl.presentMode = std::find(presentModes.begin(), presentModes.end(), requested) != presentModes.end()
+                           ? requested
+                           : VK_PRESENT_MODE_FIFO_KHR;
+    impl.format = VulkanSwapchainImpl::chooseFormat(formats, settings.sRgb);
+
+    if (!impl.build(size))
+    {
+        destroy();
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::create(VkPhysicalDevice physicalDevice,
+                             VkDevice         device,
+                             VkSurfaceKHR     surface,
+                             const Vector2u&  size)
+{
+    return create(physicalDevice, device, surface, size, Settings());
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::recreate(const Vector2u& size)
+{
+    if (m_impl->device == VK_NULL_HANDLE)
+        return false;
+
+    return m_impl->build(size);
+}
+
+
+////////////////////////////////////////////////////////////
+void VulkanSwapchain::destroy()
+{
+    Impl& impl = *m_impl;
+    if (impl.device == VK_NULL_HANDLE)
+        return;
+
+    impl.retire();
+    impl.destroyRetired(true);
+    impl.device    = VK_NULL_HANDLE;
+    impl.size      = {};
+    impl.outOfDate = false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::uint32_t> VulkanSwapchain::acquireNextImage(VkSemaphore semaphore)
+{
+    Impl& impl = *m_impl;
+    if ((impl.swapchain == VK_NULL_HANDLE) || impl.outOfDate)
+        return std::nullopt;
+
+    std::uint32_t  index  = 0;
+    const VkResult result = impl.acquireNextImage(impl.device,
+                                                  impl.swapchain,
+                                                  std::numeric_limits<std::uint64_t>::max(),
+                                                  semaphore,
+                                                  VK_NULL_HANDLE,
+                                                  &index);
+
+    // A suboptimal swapchain still gave an image, which must be presented
+    if (result == VK_SUBOPTIMAL_KHR)
+    {
+        impl.outOfDate = true;
+        return index;
+    }
+
+    if (result == VK_ERROR_OUT_OF_DATE_KHR)
+    {
+        impl.outOfDate = true;
+        return std::nullopt;
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        err() << "Failed to acquire Vulkan swapchain image" << std::endl;
+        return std::nullopt;
+    }
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::present(VkQueue queue, std::uint32_t imageIndex, VkSemaphore semaphore)
+{
+    Impl& impl = *m_impl;
+    if (impl.swapchain == VK_NULL_HANDLE)
+        return false;
+
+    const std::uint64_t                  id = impl.presentId + 1;
+    const VulkanSwapchainImpl::PresentId presentIdInfo{VulkanSwapchainImpl::structureTypePresentId, nullptr, 1, &id};
+
+    VkPresentInfoKHR presentInfo{};
+    presentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    presentInfo.pNext              = impl.waitForPresent ? &presentIdInfo : nullptr;
+    presentInfo.waitSemaphoreCount = semaphore != VK_NULL_HANDLE ? 1 : 0;
+    presentInfo.pWaitSemaphores    = &semaphore;
+    presentInfo.swapchainCount     = 1;
+    presentInfo.pSwapchains        = &impl.swapchain;
+    presentInfo.pImageIndices      = &imageIndex;
+
+    const VkResult result = impl.queuePresent(queue, &presentInfo);
+    if ((result == VK_SUBOPTIMAL_KHR) || (result == VK_ERROR_OUT_OF_DATE_KHR))
+        impl.outOfDate = true;
+
+    if ((result != VK_SUCCESS) && (result != VK_SUBOPTIMAL_KHR))
+    {
+        if (result != VK_ERROR_OUT_OF_DATE_KHR)
+            err() << "Failed to present Vulkan swapchain image" << std::endl;
+        return false;
+    }
+
+    impl.presentId = id;
+    for (Impl::Retired& entry : impl.retired)
+        entry.presentsLeft -= std::min<std::size_t>(entry.presentsLeft, 1);
+    impl.destroyRetired(false);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::waitForPresent(std::uint64_t presentId, Time timeout)
+{
+    Impl& impl = *m_impl;
+    if (!impl.waitForPresent || (impl.swapchain == VK_NULL_HANDLE) || (presentId > impl.presentId))
+        return false;
+
+    if (presentId < impl.firstPresentId)
+        return true;
+
+    const auto nanoseconds = static_cast<std::uint64_t>(std::max(timeout, Time::Zero).asMicroseconds()) * 1000;
+    return impl.waitForPresent(impl.device, impl.swapchain, presentId, nanoseconds) == VK_SUCCESS;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t VulkanSwapchain::getLastPresentId() const
+{
+    return m_impl->presentId;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::isPresentWaitEnabled() const
+{
+    return (m_impl->device != VK_NULL_HANDLE) && m_impl->waitForPresent;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VulkanSwapchain::isOutOfDate() const
+{
+    return m_impl->outOfDate;
+}
+
+
+////////////////////////////////////////////////////////////
+VkSwapchainKHR VulkanSwapchain::getHandle() const
+{
+    return m_impl->swapchain;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t VulkanSwapchain::getFormat() const
+{
+    return static_cast<std::uint32_t>(m_impl->format.format);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u VulkanSwapchain::getSize() const
+{
+    return m_impl->size;
+}
+
+
+////////////////////////////////////////////////////////////
+VulkanSwapchain::PresentMode VulkanSwapchain::getPresentMode() const
+{
+    switch (m_impl->presentMode)
+    {
+        case VK_PRESENT_MODE_FIFO_RELAXED_KHR:
+            return PresentMode::FifoRelaxed;
+        case VK_PRESENT_MODE_MAILBOX_KHR:
+            return PresentMode::Mailbox;
+        case VK_PRESENT_MODE_IMMEDIATE_KHR:
+            return PresentMode::Immediate;
+        default:
+            return PresentMode::Fifo;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<VkImage>& VulkanSwapchain::getImages() const
+{
+    return m_impl->images;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<VkImageView>& VulkanSwapchain::getImageViews() const
+{
+    return m_impl->imageViews;
+}
+
+} // namespace sf
@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Wayland/ClipboardImpl.hpp>
+#include <SFML/Window/Wayland/Display.hpp>
+#include <SFML/Window/Wayland/Seat.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/String.hpp>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <wayland-client.h>
+
+#include <ostream>
+#include <string>
+
+#include <cerrno>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ClipboardImplImpl
+{
+// Time to wait for the application owning the clipboard to send its content
+constexpr int receiveTimeout = 1000;
+
+struct Selection
+{
+    std::shared_ptr<sf::priv::WaylandDisplay> display; ///< Keeps the display alive while we own the clipboard
+    wl_data_source*                           source{}; ///< Source of the clipboard, if we own it
+    sf::U8String                              text;     ///< Content of the clipboard, if we own it
+};
+
+Selection selection;
+
+
+////////////////////////////////////////////////////////////
+void handleSend(void* /* data */, wl_data_source* /* source */, const char* /* mimeType */, std::int32_t fd)
+{
+    // All the MIME types we offer are encoded in UTF-8
+    const sf::U8String& text    = selection.text;
+    std::size_t         written = 0;
+    while (written < text.size())
+    {
+        const ssize_t result = write(fd, text.data() + written, text.size() - written);
+        if ((result < 0) && (errno == EINTR))
+            continue;
+
+        if (result <= 0)
+            break;
+
+        written += static_cast<std::size_t>(result);
+    }
+
+    close(fd);
+}
+
+
+////////////////////////////////////////////////////////////
+void handleCancelled(void* /* data */, wl_data_source* source)
+{
+    // Another application took the clipboard
+    wl_data_source_destroy(source);
+    selection.source = nullptr;
+    selection.text.clear();
+}
+
+
+const wl_data_source_listener sourceListener{[](void*, wl_data_source*, const char*) {},
+                                             handleSend,
+                                             handleCancelled,
+                                             [](void*, wl_data_source*) {},
+                                             [](void*, wl_data_source*) {},
+                                             [](void*, wl_data_source*, std::uint32_t) {}};
+} // namespace ClipboardImplImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+String ClipboardImpl::getString()
+{
+    using ClipboardImplImpl::selection;
+
+    const std::shared_ptr<WaylandDisplay> display = openDisplay();
+    Seat*                                 seat    = display->getSeat();
+    if (!seat || !seat->getDataDevice())
+        return {};
+
+    // Get the latest selection sent by the compositor
+    display->dispatch();
+
+    // Reading our own selection would deadlock, since we send it when dispatching events
+    if (selection.source)
+        return String::fromUtf8(selection.text.begin(), selection.text.end());
+
+    std::string    mimeType;
+    wl_data_offer* offer = seat->getTextSelection(mimeType);
+    if (!offer)
+        return {};
+
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0)
+    {
+        err() << "Failed to create a pipe to read the clipboard" << std::endl;
+        return {};
+    }
+
+    wl_data_offer_receive(offer, mimeType.c_str(), fds[1]);
+    close(fds[1]);
+    wl_display_flush(display->getDisplay());
+
+    // The owner of the clipboard writes its content and closes the pipe
+    std::string text;
+    pollfd      descriptor{fds[0], POLLIN, 0};
+    while (poll(&descriptor, 1, ClipboardImplImpl::receiveTimeout) > 0)
+    {
+        char          buffer[4096];
+        const ssize_t result = read(fds[0], buffer, sizeof(buffer));
+        if ((result < 0) && (errno == EINTR))
+            continue;
+
+        if (result <= 0)
+            break;
+
+        text.append(buffer, static_cast<std::size_t>(result));
+    }
+
+    close(fds[0]);
+
+    return String::fromUtf8(text.begin(), text.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void ClipboardImpl::setString(const String& text)
+{
+    using ClipboardImplImpl::selection;
+
+    const std::shared_ptr<WaylandDisplay> display = openDisplay();
+    Seat*                                 seat    = display->getSeat();
+    wl_data_device_manager*               manager = display->getGlobals().dataDeviceManager;
+    if (!seat || !seat->getDataDevice() || !manager)
+    {
+        err() << "The Wayland compositor doesn't provide a clipboard" << std::endl;
+        return;
+    }
+
+    if (selection.source)
+        wl_data_source_destroy(selection.source);
+
+    selection.display = display;
+    selection.text    = text.toUtf8();
+    selection.source  = wl_data_device_manager_create_data_source(manager);
+    wl_data_source_add_listener(selection.source, &ClipboardImplImpl::sourceListener, nullptr);
+
+    for (const char* mimeType : {"text/plain;charset=utf-8", "UTF8_STRING", "text/plain", "TEXT", "STRING"})
+        wl_data_source_offer(selection.source, mimeType);
+
+    // The compositor ignores the request if we don't have the focus
+    wl_data_device_set_selection(seat->getDataDevice(), selection.source, seat->getInputSerial());
+    wl_display_flush(display->getDisplay());
+}
+
+} // namespace sf::priv
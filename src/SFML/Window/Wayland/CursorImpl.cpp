@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Wayland/CursorImpl.hpp>
+#include <SFML/Window/Wayland/Display.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <wayland-client.h>
+
+#include <ostream>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+CursorImpl::CursorImpl() : m_display(openDisplay())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+CursorImpl::~CursorImpl()
+{
+    release();
+}
+
+
+////////////////////////////////////////////////////////////
+bool CursorImpl::loadFromPixels(const std::uint8_t* pixels, Vector2u size, Vector2u hotspot)
+{
+    release();
+
+    const std::size_t stride   = std::size_t{size.x} * 4;
+    const std::size_t byteSize = stride * size.y;
+
+    // Shared memory buffers are backed by an anonymous file
+    const int fd = memfd_create("sfml-cursor", MFD_CLOEXEC);
+    if ((fd < 0) || (ftruncate(fd, static_cast<off_t>(byteSize)) != 0))
+    {
+        err() << "Failed to allocate the shared memory of a cursor" << std::endl;
+        if (fd >= 0)
+            close(fd);
+        return false;
+    }
+
+    void* memory = mmap(nullptr, byteSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED)
+    {
+        err() << "Failed to map the shared memory of a cursor" << std::endl;
+        close(fd);
+        return false;
+    }
+
+    // Convert RGBA to premultiplied ARGB, stored in little endian order
+    auto* destination = static_cast<std::uint8_t*>(memory);
+    for (std::size_t i = 0; i < std::size_t{size.x} * size.y; ++i)
+    {
+        const std::uint8_t* source = pixels + i * 4;
+        const unsigned int  alpha  = source[3];
+
+        destination[i * 4 + 0] = static_cast<std::uint8_t>(source[2] * alpha / 255);
+        destination[i * 4 + 1] = static_cast<std::uint8_t>(source[1] * alpha / 255);
+        destination[i * 4 + 2] = static_cast<std::uint8_t>(source[0] * alpha / 255);
+        destination[i * 4 + 3] = source[3];
+    }
+
+    munmap(memory, byteSize);
+
+    const auto   width  = static_cast<std::int32_t>(size.x);
+    const auto   height = static_cast<std::int32_t>(size.y);
+    wl_shm_pool* pool   = wl_shm_create_pool(m_display->getGlobals().shm, fd, static_cast<std::int32_t>(byteSize));
+
+    m_buffer  = wl_shm_pool_create_buffer(pool, 0, width, height, width * 4, WL_SHM_FORMAT_ARGB8888);
+    m_hotspot = hotspot;
+
+    // The buffer keeps the memory alive
+    wl_shm_pool_destroy(pool);
+    close(fd);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CursorImpl::loadFromSystem(Cursor::Type type)
+{
+    release();
+
+    // Themes follow either the CSS names or the historical X11 names
+    // clang-format off
+    switch (type)
+    {
+        default: return false;
+
+        case Cursor::Type::Arrow:           m_names = {"default", "left_ptr"};                  break;
+        case Cursor::Type::Wait:            m_names = {"wait", "watch"};                        break;
+        case Cursor::Type::Text:            m_names = {"text", "xterm"};                        break;
+        case Cursor::Type::Hand:            m_names = {"pointer", "hand2"};                     break;
+        case Cursor::Type::SizeHorizontal:  m_names = {"ew-resize", "sb_h_double_arrow"};       break;
+        case Cursor::Type::SizeVertical:    m_names = {"ns-resize", "sb_v_double_arrow"};       break;
+        case Cursor::Type::SizeLeft:        m_names = {"w-resize", "left_side"};                break;
+        case Cursor::Type::SizeRight:       m_names = {"e-resize", "right_side"};               break;
+        case Cursor::Type::SizeTop:         m_names = {"n-resize", "top_side"};                 break;
+        case Cursor::Type::SizeBottom:      m_names = {"s-resize", "bottom_side"};              break;
+        case Cursor::Type::SizeTopLeft:     m_names = {"nw-resize", "top_left_corner"};         break;
+        case Cursor::Type::SizeBottomRight: m_names = {"se-resize", "bottom_right_corner"};     break;
+        case Cursor::Type::SizeBottomLeft:  m_names = {"sw-resize", "bottom_left_corner"};      break;
+        case Cursor::Type::SizeTopRight:    m_names = {"ne-resize", "top_right_corner"};        break;
+        case Cursor::Type::SizeAll:         m_names = {"all-scroll", "move", "fleur"};          break;
+        case Cursor::Type::Cross:           m_names = {"crosshair", "cross"};                   break;
+        case Cursor::Type::Help:            m_names = {"help", "question_arrow"};               break;
+        case Cursor::Type::NotAllowed:      m_names = {"not-allowed", "crossed_circle"};        break;
+    }
+    // clang-format on
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CursorImpl::release()
+{
+    if (m_buffer)
+    {
+        wl_buffer_destroy(m_buffer);
+        m_buffer = nullptr;
+    }
+
+    m_names.clear();
+}
+
+} // namespace sf::priv
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Cursor.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+
+struct wl_buffer;
+
+
+namespace sf::priv
+{
+class WaylandDisplay;
+
+////////////////////////////////////////////////////////////
+/// \brief Wayland implementation of Cursor
+///
+/// Wayland has no cursor objects: the application shows the
+/// cursor by attaching a buffer to a surface, which is done
+/// by the seat when the pointer enters a window.
+///
+////////////////////////////////////////////////////////////
+class CursorImpl
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Refer to sf::Cursor::Cursor().
+    ///
+    ////////////////////////////////////////////////////////////
+    CursorImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Refer to sf::Cursor::~Cursor().
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CursorImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CursorImpl(const CursorImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    CursorImpl& operator=(const CursorImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a cursor with the provided image
+    ///
+    /// Refer to sf::Cursor::createFromPixels().
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromPixels(const std::uint8_t* pixels, Vector2u size, Vector2u hotspot);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a native system cursor
+    ///
+    /// Refer to sf::Cursor::createFromSystem().
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromSystem(Cursor::Type type);
+
+private:
+    friend class Seat;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the cursor, if we have loaded one
+    ///
+    ////////////////////////////////////////////////////////////
+    void release();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<WaylandDisplay> m_display;  ///< Connection to the compositor
+    wl_buffer*                      m_buffer{}; ///< Image of the cursor, null for a system cursor
+    Vector2u                        m_hotspot;  ///< Hotspot of the image, in pixels
+    std::vector<const char*>        m_names;    ///< Names of the system cursor in the cursor themes, by preference
+};
+
+} // namespace sf::priv
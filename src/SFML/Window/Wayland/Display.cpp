@@ -0,0 +1,456 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/VideoModeImpl.hpp>
+#include <SFML/Window/Wayland/Display.hpp>
+#include <SFML/Window/Wayland/Seat.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <fractional-scale-v1-client-protocol.h>
+#include <pointer-constraints-unstable-v1-client-protocol.h>
+#include <poll.h>
+#include <presentation-time-client-protocol.h>
+#include <relative-pointer-unstable-v1-client-protocol.h>
+#include <viewporter-client-protocol.h>
+#include <wayland-client.h>
+#include <xdg-decoration-unstable-v1-client-protocol.h>
+#include <xdg-shell-client-protocol.h>
+
+#include <algorithm>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include <cstdlib>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace WaylandDisplayImpl
+{
+std::weak_ptr<sf::priv::WaylandDisplay> weakSharedDisplay;
+std::recursive_mutex                    mutex;
+
+////////////////////////////////////////////////////////////
+template <typename T>
+T* bindGlobal(wl_registry*        registry,
+              std::uint32_t       name,
+              const wl_interface& interface,
+              std::uint32_t       version,
+              std::uint32_t       maxVersion)
+{
+    return static_cast<T*>(wl_registry_bind(registry, name, &interface, std::min(version, maxVersion)));
+}
+
+
+////////////////////////////////////////////////////////////
+void handleOutputGeometry(void* data,
+                          wl_output* /* output */,
+                          std::int32_t x,
+                          std::int32_t y,
+                          std::int32_t /* physicalWidth */,
+                          std::int32_t /* physicalHeight */,
+                          std::int32_t /* subpixel */,
+                          const char*  make,
+                          const char*  model,
+                          std::int32_t transform)
+{
+    auto& output = *static_cast<sf::priv::WaylandOutput*>(data);
+
+    output.description = std::string(make) + ' ' + model;
+    output.position    = {x, y};
+
+    // The odd transforms rotate the output by 90 or 270 degrees
+    output.rotated = (transform % 2) != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void handleOutputMode(void*         data,
+                      wl_output*    /* output */,
+                      std::uint32_t flags,
+                      std::int32_t  width,
+                      std::int32_t  height,
+                      std::int32_t  refresh)
+{
+    auto& output = *static_cast<sf::priv::WaylandOutput*>(data);
+
+    // Modes are given in the orientation of the hardware
+    sf::Vector2u size(static_cast<unsigned int>(width), static_cast<unsigned int>(height));
+    if (output.rotated)
+        std::swap(size.x, size.y);
+
+    const sf::VideoMode mode(size);
+    if (std::find(output.modes.begin(), output.modes.end(), mode) == output.modes.end())
+        output.modes.push_back(mode);
+
+    if (flags & WL_OUTPUT_MODE_CURRENT)
+    {
+        output.currentMode = mode;
+        output.refreshRate = static_cast<float>(refresh) / 1000.f;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void handleOutputDone(void* data, wl_output* /* output */)
+{
+    // The changes of the output are complete; the initial state is not a change
+    if (static_cast<sf::priv::WaylandOutput*>(data)->reportChanges)
+        sf::priv::VideoModeImpl::invalidateCache();
+}
+
+
+////////////////////////////////////////////////////////////
+void handleOutputScale(void* data, wl_output* /* output */, std::int32_t factor)
+{
+    static_cast<sf::priv::WaylandOutput*>(data)->scale = std::max(factor, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void handlePing(void* /* data */, xdg_wm_base* wmBase, std::uint32_t serial)
+{
+    // The compositor considers applications which don't answer as frozen
+    xdg_wm_base_pong(wmBase, serial);
+}
+
+
+////////////////////////////////////////////////////////////
+void handleClockId(void* data, wp_presentation* /* presentation */, std::uint32_t clockId)
+{
+    static_cast<sf::priv::WaylandGlobals*>(data)->presentationClock = static_cast<clockid_t>(clockId);
+}
+
+
+////////////////////////////////////////////////////////////
+wl_output_listener makeOutputListener()
+{
+    // Events added by newer versions of the protocol are never sent to the version we bind
+    wl_output_listener listener{};
+    listener.geometry = handleOutputGeometry;
+    listener.mode     = handleOutputMode;
+    listener.done     = handleOutputDone;
+    listener.scale    = handleOutputScale;
+    return listener;
+}
+
+
+const wl_output_listener       outputListener = makeOutputListener();
+const xdg_wm_base_listener     wmBaseListener{handlePing};
+const wp_presentation_listener presentationListener{handleClockId};
+} // namespace WaylandDisplayImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+WaylandDisplay::WaylandDisplay() : m_display(wl_display_connect(nullptr))
+{
+    // Failing to connect is fatal, like failing to open the X11 display
+    if (!m_display)
+    {
+        err() << "Failed to connect to the Wayland compositor; make sure the WAYLAND_DISPLAY environment variable is "
+                 "set correctly"
+              << std::endl;
+        std::abort();
+    }
+
+    static const wl_registry_listener registryListener{handleGlobal, handleGlobalRemove};
+
+    m_globals.presentationClock = CLOCK_MONOTONIC;
+    m_registry                  = wl_display_get_registry(m_display);
+    wl_registry_add_listener(m_registry, &registryListener, this);
+
+    // The first round trip retrieves the globals, the second one the initial state of the outputs
+    wl_display_roundtrip(m_display);
+
+    if (!m_globals.compositor || !m_globals.shm || !m_globals.wmBase)
+    {
+        err() << "The Wayland compositor doesn't support the wl_compositor, wl_shm and xdg_wm_base interfaces"
+              << std::endl;
+        std::abort();
+    }
+
+    // The seat needs the other globals, it is created once they are all known
+    if (m_wlSeat)
+    {
+        m_seat   = std::make_unique<Seat>(*this, m_wlSeat, m_seatVersion);
+        m_wlSeat = nullptr;
+    }
+
+    wl_display_roundtrip(m_display);
+
+    // From now on, the outputs changing or appearing invalidate the video modes
+    for (const auto& output : m_outputs)
+        output->reportChanges = true;
+    m_connected = true;
+}
+
+
+////////////////////////////////////////////////////////////
+WaylandDisplay::~WaylandDisplay()
+{
+    m_seat.reset();
+
+    for (const auto& output : m_outputs)
+        wl_output_destroy(output->output);
+
+    if (m_globals.dataDeviceManager)
+        wl_data_device_manager_destroy(m_globals.dataDeviceManager);
+
+    if (m_globals.viewporter)
+        wp_viewporter_destroy(m_globals.viewporter);
+
+    if (m_globals.fractionalScaleManager)
+        wp_fractional_scale_manager_v1_destroy(m_globals.fractionalScaleManager);
+
+    if (m_globals.pointerConstraints)
+        zwp_pointer_constraints_v1_destroy(m_globals.pointerConstraints);
+
+    if (m_globals.relativePointerManager)
+        zwp_relative_pointer_manager_v1_destroy(m_globals.relativePointerManager);
+
+    if (m_globals.presentation)
+        wp_presentation_destroy(m_globals.presentation);
+
+    if (m_globals.decorationManager)
+        zxdg_decoration_manager_v1_destroy(m_globals.decorationManager);
+
+    if (m_globals.wmBase)
+        xdg_wm_base_destroy(m_globals.wmBase);
+
+    if (m_globals.shm)
+        wl_shm_destroy(m_globals.shm);
+
+    if (m_globals.compositor)
+        wl_compositor_destroy(m_globals.compositor);
+
+    wl_registry_destroy(m_registry);
+    wl_display_disconnect(m_display);
+}
+
+
+////////////////////////////////////////////////////////////
+wl_display* WaylandDisplay::getDisplay() const
+{
+    return m_display;
+}
+
+
+////////////////////////////////////////////////////////////
+const WaylandGlobals& WaylandDisplay::getGlobals() const
+{
+    return m_globals;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<std::unique_ptr<WaylandOutput>>& WaylandDisplay::getOutputs() const
+{
+    return m_outputs;
+}
+
+
+////////////////////////////////////////////////////////////
+const WaylandOutput* WaylandDisplay::findOutput(const wl_output* output) const
+{
+    for (const auto& candidate : m_outputs)
+    {
+        if (candidate->output == output)
+            return candidate.get();
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+Seat* WaylandDisplay::getSeat() const
+{
+    return m_seat.get();
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandDisplay::dispatch()
+{
+    // Another thread may be reading the socket, in which case we dispatch what it has queued
+    while (wl_display_prepare_read(m_display) != 0)
+        wl_display_dispatch_pending(m_display);
+
+    wl_display_flush(m_display);
+
+    pollfd descriptor{wl_display_get_fd(m_display), POLLIN, 0};
+    if (poll(&descriptor, 1, 0) > 0)
+        wl_display_read_events(m_display);
+    else
+        wl_display_cancel_read(m_display);
+
+    wl_display_dispatch_pending(m_display);
+    checkError();
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandDisplay::roundtrip()
+{
+    wl_display_roundtrip(m_display);
+    checkError();
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandDisplay::handleGlobal(void*         data,
+                                  wl_registry*  registry,
+                                  std::uint32_t name,
+                                  const char*   interface,
+                                  std::uint32_t version)
+{
+    using WaylandDisplayImpl::bindGlobal;
+
+    auto&                  self    = *static_cast<WaylandDisplay*>(data);
+    WaylandGlobals&        globals = self.m_globals;
+    const std::string_view iface   = interface;
+
+    if (iface == wl_compositor_interface.name)
+    {
+        globals.compositor = bindGlobal<wl_compositor>(registry, name, wl_compositor_interface, version, 4);
+    }
+    else if (iface == wl_shm_interface.name)
+    {
+        globals.shm = bindGlobal<wl_shm>(registry, name, wl_shm_interface, version, 1);
+    }
+    else if (iface == xdg_wm_base_interface.name)
+    {
+        globals.wmBase = bindGlobal<xdg_wm_base>(registry, name, xdg_wm_base_interface, version, 2);
+        xdg_wm_base_add_listener(globals.wmBase, &WaylandDisplayImpl::wmBaseListener, nullptr);
+    }
+    else if (iface == zxdg_decoration_manager_v1_interface.name)
+    {
+        globals.decorationManager = bindGlobal<zxdg_decoration_manager_v1>(
+            registry, name, zxdg_decoration_manager_v1_interface, version, 1);
+    }
+    else if (iface == wp_presentation_interface.name)
+    {
+        globals.presentation = bindGlobal<wp_presentation>(registry, name, wp_presentation_interface, version, 1);
+        wp_presentation_add_listener(globals.presentation, &WaylandDisplayImpl::presentationListener, &globals);
+    }
+    else if (iface == zwp_relative_pointer_manager_v1_interface.name)
+    {
+        globals.relativePointerManager = bindGlobal<zwp_relative_pointer_manager_v1>(
+            registry, name, zwp_relative_pointer_manager_v1_interface, version, 1);
+    }
+    else if (iface == zwp_pointer_constraints_v1_interface.name)
+    {
+        globals.pointerConstraints = bindGlobal<zwp_pointer_constraints_v1>(
+            registry, name, zwp_pointer_constraints_v1_interface, version, 1);
+    }
+    else if (iface == wp_fractional_scale_manager_v1_interface.name)
+    {
+        globals.fractionalScaleManager = bindGlobal<wp_fractional_scale_manager_v1>(
+            registry, name, wp_fractional_scale_manager_v1_interface, version, 1);
+    }
+    else if (iface == wp_viewporter_interface.name)
+    {
+        globals.viewporter = bindGlobal<wp_viewporter>(registry, name, wp_viewporter_interface, version, 1);
+    }
+    else if (iface == wl_data_device_manager_interface.name)
+    {
+        globals.dataDeviceManager = bindGlobal<wl_data_device_manager>(
+            registry, name, wl_data_device_manager_interface, version, 3);
+    }
+    else if (iface == wl_output_interface.name)
+    {
+        auto output           = std::make_unique<WaylandOutput>();
+        output->name          = name;
+        output->reportChanges = self.m_connected;
+        output->output        = bindGlobal<wl_output>(registry, name, wl_output_interface, version, 2);
+        wl_output_add_listener(output->output, &WaylandDisplayImpl::outputListener, output.get());
+        self.m_outputs.push_back(std::move(output));
+    }
+    else if ((iface == wl_seat_interface.name) && !self.m_wlSeat && !self.m_seat)
+    {
+        // Multiple seats are rare, only the first one is used
+        self.m_seatVersion = std::min(version, 5u);
+        self.m_wlSeat      = bindGlobal<wl_seat>(registry, name, wl_seat_interface, version, self.m_seatVersion);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandDisplay::handleGlobalRemove(void* data, wl_registry* /* registry */, std::uint32_t name)
+{
+    // Only the outputs are expected to disappear (when a monitor is unplugged)
+    auto&      self    = *static_cast<WaylandDisplay*>(data);
+    auto&      outputs = self.m_outputs;
+    const auto it      = std::find_if(outputs.begin(),
+                                 outputs.end(),
+                                 [name](const std::unique_ptr<WaylandOutput>& output) { return output->name == name; });
+
+    if (it != outputs.end())
+    {
+        wl_output_destroy((*it)->output);
+        outputs.erase(it);
+
+        if (self.m_connected)
+            VideoModeImpl::invalidateCache();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandDisplay::checkError()
+{
+    if (!m_error && (wl_display_get_error(m_display) != 0))
+    {
+        err() << "Lost the connection to the Wayland compositor" << std::endl;
+        m_error = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::shared_ptr<WaylandDisplay> openDisplay()
+{
+    const std::lock_guard lock(WaylandDisplayImpl::mutex);
+
+    auto sharedDisplay = WaylandDisplayImpl::weakSharedDisplay.lock();
+    if (!sharedDisplay)
+    {
+        sharedDisplay                         = std::make_shared<WaylandDisplay>();
+        WaylandDisplayImpl::weakSharedDisplay = sharedDisplay;
+    }
+
+    return sharedDisplay;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/VideoMode.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cstdint>
+#include <ctime>
+
+
+struct wl_compositor;
+struct wl_data_device_manager;
+struct wl_display;
+struct wl_output;
+struct wl_registry;
+struct wl_seat;
+struct wl_shm;
+struct wp_fractional_scale_manager_v1;
+struct wp_presentation;
+struct wp_viewporter;
+struct xdg_wm_base;
+struct zwp_pointer_constraints_v1;
+struct zwp_relative_pointer_manager_v1;
+struct zxdg_decoration_manager_v1;
+
+
+namespace sf::priv
+{
+class Seat;
+
+////////////////////////////////////////////////////////////
+/// \brief Globals advertised by the compositor
+///
+/// All the optional protocols are null when the compositor
+/// doesn't support them.
+///
+////////////////////////////////////////////////////////////
+struct WaylandGlobals
+{
+    wl_compositor*                   compositor{};             ///< Creates the surfaces
+    wl_shm*                          shm{};                    ///< Shares memory buffers, used for the cursors
+    xdg_wm_base*                     wmBase{};                 ///< Turns surfaces into desktop windows
+    zxdg_decoration_manager_v1*      decorationManager{};      ///< Asks for server-side decorations (optional)
+    wp_presentation*                 presentation{};           ///< Reports when the frames are presented (optional)
+    clockid_t                        presentationClock{};      ///< Clock used by the presentation timestamps
+    zwp_relative_pointer_manager_v1* relativePointerManager{}; ///< Reports raw mouse movements (optional)
+    zwp_pointer_constraints_v1*      pointerConstraints{};     ///< Locks or confines the pointer (optional)
+    wp_fractional_scale_manager_v1*  fractionalScaleManager{}; ///< Reports fractional scale factors (optional)
+    wp_viewporter*                   viewporter{};             ///< Scales the surfaces (optional)
+    wl_data_device_manager*          dataDeviceManager{};      ///< Gives access to the clipboard (optional)
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Output (monitor) advertised by the compositor
+///
+////////////////////////////////////////////////////////////
+struct WaylandOutput
+{
+    wl_output*             output{};        ///< Wayland output object
+    std::uint32_t          name{};          ///< Name of the global in the registry
+    std::string            description;     ///< Manufacturer and model of the monitor
+    Vector2i               position;        ///< Position of the output in the global compositor space
+    std::vector<VideoMode> modes;           ///< Video modes of the output
+    VideoMode              currentMode;     ///< Current video mode of the output
+    float                  refreshRate{};   ///< Refresh rate of the current mode, in Hz
+    std::int32_t           scale{1};        ///< Integer scale factor of the output
+    bool                   rotated{};       ///< Is the output rotated by 90 or 270 degrees?
+    bool                   reportChanges{}; ///< Do the changes invalidate the video modes? (not while connecting)
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Connection to the Wayland compositor
+///
+/// The connection is shared by all the windows, contexts
+/// and input functions of SFML.
+///
+////////////////////////////////////////////////////////////
+class WaylandDisplay
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect to the compositor and retrieve its globals
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~WaylandDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandDisplay(const WaylandDisplay&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandDisplay& operator=(const WaylandDisplay&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the Wayland display
+    ///
+    /// \return Pointer to the display
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] wl_display* getDisplay() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the globals advertised by the compositor
+    ///
+    /// \return Globals of the compositor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const WaylandGlobals& getGlobals() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outputs advertised by the compositor
+    ///
+    /// \return Outputs of the compositor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<std::unique_ptr<WaylandOutput>>& getOutputs() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the output corresponding to a Wayland output object
+    ///
+    /// \param output Wayland output object
+    ///
+    /// \return Pointer to the output, or null if it is unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const WaylandOutput* findOutput(const wl_output* output) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the seat (the input devices) of the display
+    ///
+    /// \return Pointer to the seat, or null if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Seat* getSeat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read and dispatch the pending events without blocking
+    ///
+    ////////////////////////////////////////////////////////////
+    void dispatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the compositor has processed all the requests sent so far
+    ///
+    /// The events sent in response are dispatched.
+    ///
+    ////////////////////////////////////////////////////////////
+    void roundtrip();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the creation of a global
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleGlobal(void*         data,
+                             wl_registry*  registry,
+                             std::uint32_t name,
+                             const char*   interface,
+                             std::uint32_t version);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the removal of a global
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleGlobalRemove(void* data, wl_registry* registry, std::uint32_t name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the connection was lost and report it once
+    ///
+    ////////////////////////////////////////////////////////////
+    void checkError();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    wl_display*                                 m_display{};     ///< Connection to the compositor
+    wl_registry*                                m_registry{};    ///< Registry of the globals
+    WaylandGlobals                              m_globals;       ///< Globals of the compositor
+    std::vector<std::unique_ptr<WaylandOutput>> m_outputs;       ///< Outputs of the compositor
+    wl_seat*                                    m_wlSeat{};      ///< First seat, until m_seat takes it
+    std::uint32_t                               m_seatVersion{}; ///< Version of the seat interface
+    std::unique_ptr<Seat>                       m_seat;          ///< Input devices of the first seat
+    bool                                        m_error{};       ///< Was the connection lost?
+    bool                                        m_connected{};   ///< Is the initial state of the globals known?
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the shared connection to the compositor
+///
+/// \return Pointer to the shared display
+///
+////////////////////////////////////////////////////////////
+std::shared_ptr<WaylandDisplay> openDisplay();
+
+} // namespace sf::priv
@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/InputImpl.hpp>
+#include <SFML/Window/Wayland/Display.hpp>
+#include <SFML/Window/Wayland/Seat.hpp>
+#include <SFML/Window/Wayland/WindowImplWayland.hpp>
+#include <SFML/Window/WindowBase.hpp>
+#include <SFML/Window/WindowHandle.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/String.hpp>
+
+#include <ostream>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace WaylandInputImpl
+{
+////////////////////////////////////////////////////////////
+const sf::priv::WindowImplWayland* getWindow(const sf::WindowBase& window)
+{
+    return sf::priv::WindowImplWayland::fromSurface(reinterpret_cast<wl_surface*>(window.getNativeHandle()));
+}
+} // namespace WaylandInputImpl
+} // namespace
+
+
+// Wayland has no global input state: it is sent by the compositor to the focused windows, so the queries are
+// answered from the events received so far (updated when the events of the windows are processed)
+namespace sf::priv::InputImpl
+{
+////////////////////////////////////////////////////////////
+bool isKeyPressed(Keyboard::Key key)
+{
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    return seat && seat->isKeyPressed(key);
+}
+
+
+////////////////////////////////////////////////////////////
+bool isKeyPressed(Keyboard::Scancode code)
+{
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    return seat && seat->isKeyPressed(code);
+}
+
+
+////////////////////////////////////////////////////////////
+Keyboard::Key localize(Keyboard::Scancode code)
+{
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    return seat ? seat->localize(code) : Keyboard::Key::Unknown;
+}
+
+
+////////////////////////////////////////////////////////////
+Keyboard::Scancode delocalize(Keyboard::Key key)
+{
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    return seat ? seat->delocalize(key) : Keyboard::Scan::Unknown;
+}
+
+
+////////////////////////////////////////////////////////////
+String getDescription(Keyboard::Scancode code)
+{
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    return seat ? seat->getDescription(code) : "";
+}
+
+
+////////////////////////////////////////////////////////////
+void setVirtualKeyboardVisible(bool /*visible*/)
+{
+    // Not applicable
+}
+
+
+////////////////////////////////////////////////////////////
+bool isMouseButtonPressed(Mouse::Button button)
+{
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    return seat && seat->getMouseButtons()[static_cast<std::size_t>(button)];
+}
+
+
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    keys.reset();
+    scancodes.reset();
+
+    const auto display = openDisplay();
+    if (const Seat* seat = display->getSeat())
+        seat->getKeyboardState(keys, scancodes);
+}
+
+
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* relativeTo)
+{
+    buttons.reset();
+
+    const auto display = openDisplay();
+    if (const Seat* seat = display->getSeat())
+        buttons = seat->getMouseButtons();
+
+    position = relativeTo ? getMousePosition(*relativeTo) : getMousePosition();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i getMousePosition()
+{
+    // Clients don't know where their windows are, the position in the window under the pointer is the best guess
+    const auto  display = openDisplay();
+    const Seat* seat    = display->getSeat();
+    if (const WindowImplWayland* window = seat ? seat->getPointerFocus() : nullptr)
+        return window->getMousePosition();
+
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i getMousePosition(const WindowBase& relativeTo)
+{
+    const WindowImplWayland* window = WaylandInputImpl::getWindow(relativeTo);
+    return window ? window->getMousePosition() : Vector2i();
+}
+
+
+////////////////////////////////////////////////////////////
+void setMousePosition(const Vector2i& /* position */)
+{
+    err() << "Wayland doesn't allow applications to move the mouse cursor" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void setMousePosition(const Vector2i& position, const WindowBase& /* relativeTo */)
+{
+    setMousePosition(position);
+}
+
+
+////////////////////////////////////////////////////////////
+bool isTouchDown(unsigned int /*finger*/)
+{
+    // Not applicable
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i getTouchPosition(unsigned int /*finger*/)
+{
+    // Not applicable
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i getTouchPosition(unsigned int /*finger*/, const WindowBase& /*relativeTo*/)
+{
+    // Not applicable
+    return {};
+}
+
+} // namespace sf::priv::InputImpl
@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Wayland/KeyboardImpl.hpp>
+
+#include <SFML/System/EnumArray.hpp>
+
+#include <linux/input-event-codes.h>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+Keyboard::Scancode KeyboardImpl::evdevToScancode(std::uint32_t key)
+{
+    // clang-format off
+    switch (key)
+    {
+        case KEY_A:            return Keyboard::Scan::A;
+        case KEY_B:            return Keyboard::Scan::B;
+        case KEY_C:            return Keyboard::Scan::C;
+        case KEY_D:            return Keyboard::Scan::D;
+        case KEY_E:            return Keyboard::Scan::E;
+        case KEY_F:            return Keyboard::Scan::F;
+        case KEY_G:            return Keyboard::Scan::G;
+        case KEY_H:            return Keyboard::Scan::H;
+        case KEY_I:            return Keyboard::Scan::I;
+        case KEY_J:            return Keyboard::Scan::J;
+        case KEY_K:            return Keyboard::Scan::K;
+        case KEY_L:            return Keyboard::Scan::L;
+        case KEY_M:            return Keyboard::Scan::M;
+        case KEY_N:            return Keyboard::Scan::N;
+        case KEY_O:            return Keyboard::Scan::O;
+        case KEY_P:            return Keyboard::Scan::P;
+        case KEY_Q:            return Keyboard::Scan::Q;
+        case KEY_R:            return Keyboard::Scan::R;
+        case KEY_S:            return Keyboard::Scan::S;
+        case KEY_T:            return Keyboard::Scan::T;
+        case KEY_U:            return Keyboard::Scan::U;
+        case KEY_V:            return Keyboard::Scan::V;
+        case KEY_W:            return Keyboard::Scan::W;
+        case KEY_X:            return Keyboard::Scan::X;
+        case KEY_Y:            return Keyboard::Scan::Y;
+        case KEY_Z:            return Keyboard::Scan::Z;
+
+        case KEY_1:            return Keyboard::Scan::Num1;
+        case KEY_2:            return Keyboard::Scan::Num2;
+        case KEY_3:            return Keyboard::Scan::Num3;
+        case KEY_4:            return Keyboard::Scan::Num4;
+        case KEY_5:            return Keyboard::Scan::Num5;
+        case KEY_6:            return Keyboard::Scan::Num6;
+        case KEY_7:            return Keyboard::Scan::Num7;
+        case KEY_8:            return Keyboard::Scan::Num8;
+        case KEY_9:            return Keyboard::Scan::Num9;
+        case KEY_0:            return Keyboard::Scan::Num0;
+
+        case KEY_ENTER:        return Keyboard::Scan::Enter;
+        case KEY_ESC:          return Keyboard::Scan::Escape;
+        case KEY_BACKSPACE:    return Keyboard::Scan::Backspace;
+        case KEY_TAB:          return Keyboard::Scan::Tab;
+        case KEY_SPACE:        return Keyboard::Scan::Space;
+        case KEY_MINUS:        return Keyboard::Scan::Hyphen;
+        case KEY_EQUAL:        return Keyboard::Scan::Equal;
+        case KEY_LEFTBRACE:    return Keyboard::Scan::LBracket;
+        case KEY_RIGHTBRACE:   return Keyboard::Scan::RBracket;
+        case KEY_BACKSLASH:    return Keyboard::Scan::Backslash;
+        case KEY_SEMICOLON:    return Keyboard::Scan::Semicolon;
+        case KEY_APOSTROPHE:   return Keyboard::Scan::Apostrophe;
+        case KEY_GRAVE:        return Keyboard::Scan::Grave;
+        case KEY_COMMA:        return Keyboard::Scan::Comma;
+        case KEY_DOT:          return Keyboard::Scan::Period;
+        case KEY_SLASH:        return Keyboard::Scan::Slash;
+        case KEY_102ND:        return Keyboard::Scan::NonUsBackslash;
+
+        case KEY_F1:           return Keyboard::Scan::F1;
+        case KEY_F2:           return Keyboard::Scan::F2;
+        case KEY_F3:           return Keyboard::Scan::F3;
+        case KEY_F4:           return Keyboard::Scan::F4;
+        case KEY_F5:           return Keyboard::Scan::F5;
+        case KEY_F6:           return Keyboard::Scan::F6;
+        case KEY_F7:           return Keyboard::Scan::F7;
+        case KEY_F8:           return Keyboard::Scan::F8;
+        case KEY_F9:           return Keyboard::Scan::F9;
+        case KEY_F10:          return Keyboard::Scan::F10;
+        case KEY_F11:          return Keyboard::Scan::F11;
+        case KEY_F12:          return Keyboard::Scan::F12;
+        case KEY_F13:          return Keyboard::Scan::F13;
+        case KEY_F14:          return Keyboard::Scan::F14;
+        case KEY_F15:          return Keyboard::Scan::F15;
+        case KEY_F16:          return Keyboard::Scan::F16;
+        case KEY_F17:          return Keyboard::Scan::F17;
+        case KEY_F18:          return Keyboard::Scan::F18;
+        case KEY_F19:          return Keyboard::Scan::F19;
+        case KEY_F20:          return Keyboard::Scan::F20;
+        case KEY_F21:          return Keyboard::Scan::F21;
+        case KEY_F22:          return Keyboard::Scan::F22;
+        case KEY_F23:          return Keyboard::Scan::F23;
+        case KEY_F24:          return Keyboard::Scan::F24;
+
+        case KEY_CAPSLOCK:     return Keyboard::Scan::CapsLock;
+        case KEY_SYSRQ:        return Keyboard::Scan::PrintScreen;
+        case KEY_SCROLLLOCK:   return Keyboard::Scan::ScrollLock;
+        case KEY_PAUSE:        return Keyboard::Scan::Pause;
+        case KEY_INSERT:       return Keyboard::Scan::Insert;
+        case KEY_HOME:         return Keyboard::Scan::Home;
+        case KEY_PAGEUP:       return Keyboard::Scan::PageUp;
+        case KEY_DELETE:       return Keyboard::Scan::Delete;
+        case KEY_END:          return Keyboard::Scan::End;
+        case KEY_PAGEDOWN:     return Keyboard::Scan::PageDown;
+        case KEY_RIGHT:        return Keyboard::Scan::Right;
+        case KEY_LEFT:         return Keyboard::Scan::Left;
+        case KEY_DOWN:         return Keyboard::Scan::Down;
+        case KEY_UP:           return Keyboard::Scan::Up;
+
+        case KEY_NUMLOCK:      return Keyboard::Scan::NumLock;
+        case KEY_KPSLASH:      return Keyboard::Scan::NumpadDivide;
+        case KEY_KPASTERISK:   return Keyboard::Scan::NumpadMultiply;
+        case KEY_KPMINUS:      return Keyboard::Scan::NumpadMinus;
+        case KEY_KPPLUS:       return Keyboard::Scan::NumpadPlus;
+        case KEY_KPEQUAL:      return Keyboard::Scan::NumpadEqual;
+        case KEY_KPENTER:      return Keyboard::Scan::NumpadEnter;
+        case KEY_KPDOT:        return Keyboard::Scan::NumpadDecimal;
+        case KEY_KP1:          return Keyboard::Scan::Numpad1;
+        case KEY_KP2:          return Keyboard::Scan::Numpad2;
+        case KEY_KP3:          return Keyboard::Scan::Numpad3;
+        case KEY_KP4:          return Keyboard::Scan::Numpad4;
+        case KEY_KP5:          return Keyboard::Scan::Numpad5;
+        case KEY_KP6:          return Keyboard::Scan::Numpad6;
+        case KEY_KP7:          return Keyboard::Scan::Numpad7;
+        case KEY_KP8:          return Keyboard::Scan::Numpad8;
+        case KEY_KP9:          return Keyboard::Scan::Numpad9;
+        case KEY_KP0:          return Keyboard::Scan::Numpad0;
+
+        case KEY_COMPOSE:      return Keyboard::Scan::Application;
+        case KEY_OPEN:         return Keyboard::Scan::Execute;
+        case KEY_HELP:         return Keyboard::Scan::Help;
+        case KEY_MENU:         return Keyboard::Scan::Menu;
+        case KEY_SELECT:       return Keyboard::Scan::Select;
+        case KEY_REDO:         return Keyboard::Scan::Redo;
+        case KEY_AGAIN:        return Keyboard::Scan::Redo;
+        case KEY_UNDO:         return Keyboard::Scan::Undo;
+        case KEY_CUT:          return Keyboard::Scan::Cut;
+        case KEY_COPY:         return Keyboard::Scan::Copy;
+        case KEY_PASTE:        return Keyboard::Scan::Paste;
+
+        case KEY_MUTE:         return Keyboard::Scan::VolumeMute;
+        case KEY_VOLUMEUP:     return Keyboard::Scan::VolumeUp;
+        case KEY_VOLUMEDOWN:   return Keyboard::Scan::VolumeDown;
+        case KEY_PLAYPAUSE:    return Keyboard::Scan::MediaPlayPause;
+        case KEY_STOPCD:       return Keyboard::Scan::MediaStop;
+        case KEY_NEXTSONG:     return Keyboard::Scan::MediaNextTrack;
+        case KEY_PREVIOUSSONG: return Keyboard::Scan::MediaPreviousTrack;
+
+        case KEY_LEFTCTRL:     return Keyboard::Scan::LControl;
+        case KEY_LEFTSHIFT:    return Keyboard::Scan::LShift;
+        case KEY_LEFTALT:      return Keyboard::Scan::LAlt;
+        case KEY_LEFTMETA:     return Keyboard::Scan::LSystem;
+        case KEY_RIGHTCTRL:    return Keyboard::Scan::RControl;
+        case KEY_RIGHTSHIFT:   return Keyboard::Scan::RShift;
+        case KEY_RIGHTALT:     return Keyboard::Scan::RAlt;
+        case KEY_RIGHTMETA:    return Keyboard::Scan::RSystem;
+
+        case KEY_BACK:         return Keyboard::Scan::Back;
+        case KEY_FORWARD:      return Keyboard::Scan::Forward;
+        case KEY_REFRESH:      return Keyboard::Scan::Refresh;
+        case KEY_STOP:         return Keyboard::Scan::Stop;
+        case KEY_SEARCH:       return Keyboard::Scan::Search;
+        case KEY_BOOKMARKS:    return Keyboard::Scan::Favorites;
+        case KEY_HOMEPAGE:     return Keyboard::Scan::HomePage;
+        case KEY_COMPUTER:     return Keyboard::Scan::LaunchApplication1;
+        case KEY_CALC:         return Keyboard::Scan::LaunchApplication2;
+        case KEY_MAIL:         return Keyboard::Scan::LaunchMail;
+        case KEY_MEDIA:        return Keyboard::Scan::LaunchMediaSelect;
+        default:               return Keyboard::Scan::Unknown;
+    }
+    // clang-format on
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t KeyboardImpl::scancodeToEvdev(Keyboard::Scancode code)
+{
+    static const auto mapping = []
+    {
+        EnumArray<Keyboard::Scancode, std::uint32_t, Keyboard::ScancodeCount> result{};
+
+        // Go backwards so that the lowest code wins when several keys have the same scancode
+        for (std::uint32_t key = KEY_MAX; key > KEY_RESERVED; --key)
+        {
+            const Keyboard::Scancode scancode = evdevToScancode(key);
+            if (scancode != Keyboard::Scan::Unknown)
+                result[scancode] = key;
+        }
+
+        return result;
+    }();
+
+    if (code == Keyboard::Scan::Unknown)
+        return KEY_RESERVED;
+
+    return mapping[code];
+}
+
+} // namespace sf::priv
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Keyboard.hpp>
+
+#include <cstdint>
+
+
+namespace sf::priv::KeyboardImpl
+{
+////////////////////////////////////////////////////////////
+/// \brief Convert a Linux evdev key code to a SFML scancode
+///
+/// Wayland compositors send the evdev code of the keys,
+/// which identifies their physical location.
+///
+/// \param key Evdev key code
+///
+/// \return The corresponding scancode, Unknown if there is none
+///
+////////////////////////////////////////////////////////////
+Keyboard::Scancode evdevToScancode(std::uint32_t key);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a SFML scancode to a Linux evdev key code
+///
+/// \param code Scancode
+///
+/// \return The corresponding evdev key code, 0 (KEY_RESERVED) if there is none
+///
+////////////////////////////////////////////////////////////
+std::uint32_t scancodeToEvdev(Keyboard::Scancode code);
+
+} // namespace sf::priv::KeyboardImpl
@@ -0,0 +1,1062 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/WindowEnums.hpp> // Prevent conflict with macro None from Xlib
+
+#include <SFML/Window/Unix/KeyDescription.hpp>
+#include <SFML/Window/Unix/KeySymToKeyMapping.hpp>
+#include <SFML/Window/Unix/KeySymToUnicodeMapping.hpp>
+#include <SFML/Window/Wayland/CursorImpl.hpp>
+#include <SFML/Window/Wayland/Display.hpp>
+#include <SFML/Window/Wayland/KeyboardImpl.hpp>
+#include <SFML/Window/Wayland/Seat.hpp>
+#include <SFML/Window/Wayland/WindowImplWayland.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <linux/input-event-codes.h>
+#include <relative-pointer-unstable-v1-client-protocol.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <wayland-client.h>
+#include <wayland-cursor.h>
+#include <xkbcommon/xkbcommon-compose.h>
+#include <xkbcommon/xkbcommon.h>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cmath>
+#include <cstdlib>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SeatImpl
+{
+// MIME types of text, from the most to the least preferred
+constexpr const char* textMimeTypes[] = {"text/plain;charset=utf-8", "UTF8_STRING", "text/plain"};
+
+// XKB key codes are the evdev codes shifted by 8, for compatibility with X11
+constexpr std::uint32_t keycodeOffset = 8;
+
+
+////////////////////////////////////////////////////////////
+const char* getLocale()
+{
+    for (const char* variable : {"LC_ALL", "LC_CTYPE", "LANG"})
+    {
+        const char* locale = std::getenv(variable);
+        if (locale && *locale)
+            return locale;
+    }
+
+    return "C";
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<sf::Mouse::Button> toButton(std::uint32_t button)
+{
+    // clang-format off
+    switch (button)
+    {
+        case BTN_LEFT:   return sf::Mouse::Button::Left;
+        case BTN_RIGHT:  return sf::Mouse::Button::Right;
+        case BTN_MIDDLE: return sf::Mouse::Button::Middle;
+        case BTN_SIDE:   return sf::Mouse::Button::Extra1;
+        case BTN_EXTRA:  return sf::Mouse::Button::Extra2;
+        default:         return std::nullopt;
+    }
+    // clang-format on
+}
+
+
+////////////////////////////////////////////////////////////
+void release(wl_keyboard* keyboard)
+{
+    // Release requests appeared in version 3, the objects could only be destroyed before
+    if (wl_keyboard_get_version(keyboard) >= WL_KEYBOARD_RELEASE_SINCE_VERSION)
+        wl_keyboard_release(keyboard);
+    else
+        wl_keyboard_destroy(keyboard);
+}
+
+
+////////////////////////////////////////////////////////////
+void release(wl_pointer* pointer)
+{
+    if (wl_pointer_get_version(pointer) >= WL_POINTER_RELEASE_SINCE_VERSION)
+        wl_pointer_release(pointer);
+    else
+        wl_pointer_destroy(pointer);
+}
+} // namespace SeatImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+Seat::Seat(WaylandDisplay& display, wl_seat* seat, std::uint32_t version) :
+m_display(display),
+m_seat(seat),
+m_version(version),
+m_xkbContext(xkb_context_new(XKB_CONTEXT_NO_FLAGS))
+{
+    static const wl_seat_listener seatListener{handleCapabilities, [](void*, wl_seat*, const char*) {}};
+    wl_seat_add_listener(m_seat, &seatListener, this);
+
+    // Dead keys and compose sequences depend on the locale, like with X11 input methods
+    if (m_xkbContext)
+    {
+        m_composeTable = xkb_compose_table_new_from_locale(m_xkbContext,
+                                                           SeatImpl::getLocale(),
+                                                           XKB_COMPOSE_COMPILE_NO_FLAGS);
+        if (m_composeTable)
+            m_composeState = xkb_compose_state_new(m_composeTable, XKB_COMPOSE_STATE_NO_FLAGS);
+    }
+    else
+    {
+        err() << "Failed to create the XKB context, keyboard input won't be available" << std::endl;
+    }
+
+    if (wl_data_device_manager* dataDeviceManager = m_display.getGlobals().dataDeviceManager)
+    {
+        static const wl_data_device_listener dataDeviceListener{
+            handleDataOffer,
+            handleDragEnter,
+            handleDragLeave,
+            [](void*, wl_data_device*, std::uint32_t, wl_fixed_t, wl_fixed_t) {},
+            [](void*, wl_data_device*) {},
+            handleSelection};
+        m_dataDevice = wl_data_device_manager_get_data_device(dataDeviceManager, m_seat);
+        wl_data_device_add_listener(m_dataDevice, &dataDeviceListener, this);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Seat::~Seat()
+{
+    destroyOffer(m_selection);
+    destroyOffer(m_dragOffer);
+
+    if (m_dataDevice)
+    {
+        if (wl_data_device_get_version(m_dataDevice) >= WL_DATA_DEVICE_RELEASE_SINCE_VERSION)
+            wl_data_device_release(m_dataDevice);
+        else
+            wl_data_device_destroy(m_dataDevice);
+    }
+
+    if (m_cursorTheme)
+        wl_cursor_theme_destroy(m_cursorTheme);
+
+    if (m_cursorSurface)
+        wl_surface_destroy(m_cursorSurface);
+
+    if (m_relativePointer)
+        zwp_relative_pointer_v1_destroy(m_relativePointer);
+
+    if (m_pointer)
+        SeatImpl::release(m_pointer);
+
+    if (m_keyboard)
+        SeatImpl::release(m_keyboard);
+
+    if (m_composeState)
+        xkb_compose_state_unref(m_composeState);
+
+    if (m_composeTable)
+        xkb_compose_table_unref(m_composeTable);
+
+    if (m_xkbState)
+        xkb_state_unref(m_xkbState);
+
+    if (m_keymap)
+        xkb_keymap_unref(m_keymap);
+
+    if (m_xkbContext)
+        xkb_context_unref(m_xkbContext);
+
+    if (wl_seat_get_version(m_seat) >= WL_SEAT_RELEASE_SINCE_VERSION)
+        wl_seat_release(m_seat);
+    else
+        wl_seat_destroy(m_seat);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::forgetWindow(const WindowImplWayland& window)
+{
+    if (m_keyboardFocus == &window)
+    {
+        m_keyboardFocus = nullptr;
+        m_repeatKey     = 0;
+    }
+
+    if (m_pointerFocus == &window)
+        m_pointerFocus = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::updateCursor(const WindowImplWayland& window)
+{
+    if (!m_pointer || (m_pointerFocus != &window))
+        return;
+
+    if (!window.isMouseCursorVisible())
+    {
+        wl_pointer_set_cursor(m_pointer, m_pointerSerial, nullptr, 0, 0);
+        return;
+    }
+
+    const CursorImpl* cursor      = window.getMouseCursor();
+    wl_buffer*        buffer      = nullptr;
+    Vector2i          hotspot;
+    std::int32_t      bufferScale = 1;
+
+    if (cursor && cursor->m_buffer)
+    {
+        // Cursors loaded from pixels are shown at their size in pixels
+        buffer  = cursor->m_buffer;
+        hotspot = Vector2i(cursor->m_hotspot);
+    }
+    else
+    {
+        // System cursors come from the cursor theme of the desktop, at the scale of the window
+        bufferScale = window.getCursorScale();
+        loadCursorTheme(bufferScale);
+
+        wl_cursor* themed = nullptr;
+        if (m_cursorTheme)
+        {
+            const std::vector<const char*> defaultNames = {"default", "left_ptr"};
+            for (const char* name : (cursor ? cursor->m_names : defaultNames))
+            {
+                if ((themed = wl_cursor_theme_get_cursor(m_cursorTheme, name)) != nullptr)
+                    break;
+            }
+        }
+
+        if (!themed || (themed->image_count == 0))
+            return;
+
+        // Animated cursors only show their first frame
+        const wl_cursor_image* image = themed->images[0];
+        buffer  = wl_cursor_image_get_buffer(themed->images[0]);
+        hotspot = Vector2i(Vector2(image->hotspot_x, image->hotspot_y));
+    }
+
+    if (!m_cursorSurface)
+        m_cursorSurface = wl_compositor_create_surface(m_display.getGlobals().compositor);
+
+    wl_surface_set_buffer_scale(m_cursorSurface, bufferScale);
+    wl_surface_attach(m_cursorSurface, buffer, 0, 0);
+    wl_surface_damage_buffer(m_cursorSurface, 0, 0, INT32_MAX, INT32_MAX);
+    wl_surface_commit(m_cursorSurface);
+    wl_pointer_set_cursor(m_pointer,
+                          m_pointerSerial,
+                          m_cursorSurface,
+                          hotspot.x / bufferScale,
+                          hotspot.y / bufferScale);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::processKeyRepeat()
+{
+    if (!m_repeatKey || (m_repeatRate <= 0) || !m_keyboardFocus)
+        return;
+
+    const Clock::time_point now = Clock::now();
+    if (now < m_nextRepeat)
+        return;
+
+    // Repetitions missed while the application wasn't processing events are dropped
+    if (m_keyboardFocus->isKeyRepeatEnabled())
+        sendKey(m_repeatKey, true, std::nullopt);
+
+    m_nextRepeat = std::max(m_nextRepeat + std::chrono::microseconds(1'000'000 / m_repeatRate), now);
+}
+
+
+////////////////////////////////////////////////////////////
+wl_pointer* Seat::getPointer() const
+{
+    return m_pointer;
+}
+
+
+////////////////////////////////////////////////////////////
+WindowImplWayland* Seat::getPointerFocus() const
+{
+    return m_pointerFocus;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t Seat::getInputSerial() const
+{
+    return m_inputSerial;
+}
+
+
+////////////////////////////////////////////////////////////
+wl_data_device* Seat::getDataDevice() const
+{
+    return m_dataDevice;
+}
+
+
+////////////////////////////////////////////////////////////
+wl_data_offer* Seat::getTextSelection(std::string& mimeType) const
+{
+    const auto it = m_offerTypes.find(m_selection);
+    if (!m_selection || (it == m_offerTypes.end()))
+        return nullptr;
+
+    for (const char* candidate : SeatImpl::textMimeTypes)
+    {
+        if (std::find(it->second.begin(), it->second.end(), candidate) != it->second.end())
+        {
+            mimeType = candidate;
+            return m_selection;
+        }
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Seat::isKeyPressed(Keyboard::Key key) const
+{
+    const std::lock_guard lock(m_mutex);
+
+    const std::uint32_t keycode = findKeycode(key);
+    return (keycode >= SeatImpl::keycodeOffset) && ((keycode - SeatImpl::keycodeOffset) < MaxKeyCode) &&
+           m_pressedKeys[keycode - SeatImpl::keycodeOffset];
+}
+
+
+////////////////////////////////////////////////////////////
+bool Seat::isKeyPressed(Keyboard::Scancode code) const
+{
+    const std::lock_guard lock(m_mutex);
+
+    const std::uint32_t key = KeyboardImpl::scancodeToEvdev(code);
+    return (key != KEY_RESERVED) && (key < MaxKeyCode) && m_pressedKeys[key];
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::getKeyboardState(std::bitset<Keyboard::KeyCount>&      keys,
+                            std::bitset<Keyboard::ScancodeCount>& scancodes) const
+{
+    for (unsigned int i = 0; i < Keyboard::KeyCount; ++i)
+        keys[i] = isKeyPressed(static_cast<Keyboard::Key>(i));
+
+    for (unsigned int i = 0; i < Keyboard::ScancodeCount; ++i)
+        scancodes[i] = isKeyPressed(static_cast<Keyboard::Scancode>(i));
+}
+
+
+////////////////////////////////////////////////////////////
+Keyboard::Key Seat::localize(Keyboard::Scancode code) const
+{
+    const std::lock_guard lock(m_mutex);
+
+    const std::uint32_t key = KeyboardImpl::scancodeToEvdev(code);
+    if (key == KEY_RESERVED)
+        return Keyboard::Key::Unknown;
+
+    return keySymToKey(getKeysym(key + SeatImpl::keycodeOffset, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+Keyboard::Scancode Seat::delocalize(Keyboard::Key key) const
+{
+    const std::lock_guard lock(m_mutex);
+
+    const std::uint32_t keycode = findKeycode(key);
+    if (keycode < SeatImpl::keycodeOffset)
+        return Keyboard::Scan::Unknown;
+
+    return KeyboardImpl::evdevToScancode(keycode - SeatImpl::keycodeOffset);
+}
+
+
+////////////////////////////////////////////////////////////
+String Seat::getDescription(Keyboard::Scancode code) const
+{
+    if (isDescribedByCharacter(code))
+    {
+        const std::lock_guard lock(m_mutex);
+
+        const std::uint32_t key = KeyboardImpl::scancodeToEvdev(code);
+        if (key != KEY_RESERVED)
+        {
+            const char32_t unicode = keysymToUnicode(getKeysym(key + SeatImpl::keycodeOffset, 0));
+            if (unicode != 0)
+                return {unicode};
+        }
+    }
+
+    return getKeyName(code);
+}
+
+
+////////////////////////////////////////////////////////////
+std::bitset<Mouse::ButtonCount> Seat::getMouseButtons() const
+{
+    const std::lock_guard lock(m_mutex);
+    return m_pressedButtons;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleCapabilities(void* data, wl_seat* seat, std::uint32_t capabilities)
+{
+    auto& self = *static_cast<Seat*>(data);
+
+    const bool hasKeyboard = (capabilities & WL_SEAT_CAPABILITY_KEYBOARD) != 0;
+    if (hasKeyboard && !self.m_keyboard)
+    {
+        static const wl_keyboard_listener keyboardListener{handleKeymap,
+                                                           handleKeyboardEnter,
+                                                           handleKeyboardLeave,
+                                                           handleKey,
+                                                           handleModifiers,
+                                                           handleRepeatInfo};
+        self.m_keyboard = wl_seat_get_keyboard(seat);
+        wl_keyboard_add_listener(self.m_keyboard, &keyboardListener, &self);
+    }
+    else if (!hasKeyboard && self.m_keyboard)
+    {
+        SeatImpl::release(self.m_keyboard);
+        self.m_keyboard = nullptr;
+    }
+
+    const bool hasPointer = (capabilities & WL_SEAT_CAPABILITY_POINTER) != 0;
+    if (hasPointer && !self.m_pointer)
+    {
+        static const wl_pointer_listener pointerListener = []
+        {
+            // Events added by newer versions of the protocol are never sent to the version we bind
+            wl_pointer_listener listener{};
+            listener.enter         = handlePointerEnter;
+            listener.leave         = handlePointerLeave;
+            listener.motion        = handlePointerMotion;
+            listener.button        = handlePointerButton;
+            listener.axis          = handlePointerAxis;
+            listener.frame         = handlePointerFrame;
+            listener.axis_source   = [](void*, wl_pointer*, std::uint32_t) {};
+            listener.axis_stop     = [](void*, wl_pointer*, std::uint32_t, std::uint32_t) {};
+            listener.axis_discrete = handlePointerAxisDiscrete;
+            return listener;
+        }();
+        self.m_pointer = wl_seat_get_pointer(seat);
+        wl_pointer_add_listener(self.m_pointer, &pointerListener, &self);
+
+        if (zwp_relative_pointer_manager_v1* manager = self.m_display.getGlobals().relativePointerManager)
+        {
+            static const zwp_relative_pointer_v1_listener relativePointerListener{handleRelativeMotion};
+            self.m_relativePointer = zwp_relative_pointer_manager_v1_get_relative_pointer(manager, self.m_pointer);
+            zwp_relative_pointer_v1_add_listener(self.m_relativePointer, &relativePointerListener, &self);
+        }
+    }
+    else if (!hasPointer && self.m_pointer)
+    {
+        if (self.m_relativePointer)
+            zwp_relative_pointer_v1_destroy(self.m_relativePointer);
+
+        SeatImpl::release(self.m_pointer);
+        self.m_relativePointer = nullptr;
+        self.m_pointer         = nullptr;
+        self.m_pointerFocus    = nullptr;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleKeymap(void*         data,
+                        wl_keyboard*  /* keyboard */,
+                        std::uint32_t format,
+                        std::int32_t  fd,
+                        std::uint32_t size)
+{
+    auto& self = *static_cast<Seat*>(data);
+
+    if ((format != WL_KEYBOARD_KEYMAP_FORMAT_XKB_V1) || !self.m_xkbContext)
+    {
+        close(fd);
+        return;
+    }
+
+    void* source = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (source == MAP_FAILED)
+    {
+        err() << "Failed to map the keyboard map of the compositor" << std::endl;
+        return;
+    }
+
+    xkb_keymap* keymap = xkb_keymap_new_from_string(self.m_xkbContext,
+                                                    static_cast<const char*>(source),
+                                                    XKB_KEYMAP_FORMAT_TEXT_V1,
+                                                    XKB_KEYMAP_COMPILE_NO_FLAGS);
+    munmap(source, size);
+
+    if (!keymap)
+    {
+        err() << "Failed to compile the keyboard map of the compositor" << std::endl;
+        return;
+    }
+
+    const std::lock_guard lock(self.m_mutex);
+
+    if (self.m_xkbState)
+        xkb_state_unref(self.m_xkbState);
+
+    if (self.m_keymap)
+        xkb_keymap_unref(self.m_keymap);
+
+    self.m_keymap   = keymap;
+    self.m_xkbState = xkb_state_new(keymap);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleKeyboardEnter(void*         data,
+                               wl_keyboard*  /* keyboard */,
+                               std::uint32_t serial,
+                               wl_surface*   surface,
+                               wl_array*     keys)
+{
+    auto&              self   = *static_cast<Seat*>(data);
+    WindowImplWayland* window = WindowImplWayland::fromSurface(surface);
+    if (!window)
+        return;
+
+    self.m_keyboardFocus = window;
+    self.m_inputSerial   = serial;
+
+    {
+        // The keys already held down when the window gets the focus don't generate events
+        const std::lock_guard lock(self.m_mutex);
+
+        const auto* pressed = static_cast<const std::uint32_t*>(keys->data);
+        for (std::size_t i = 0; i < keys->size / sizeof(std::uint32_t); ++i)
+        {
+            if (pressed[i] < MaxKeyCode)
+                self.m_pressedKeys.set(pressed[i]);
+        }
+    }
+
+    window->pushSeatEvent(Event::FocusGained{}, std::nullopt);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleKeyboardLeave(void* data, wl_keyboard* /* keyboard */, std::uint32_t serial, wl_surface* /* surface */)
+{
+    auto& self = *static_cast<Seat*>(data);
+
+    {
+        // The compositor doesn't send the releases of the keys once the focus is gone
+        const std::lock_guard lock(self.m_mutex);
+        self.m_pressedKeys.reset();
+    }
+
+    if (self.m_composeState)
+        xkb_compose_state_reset(self.m_composeState);
+
+    self.m_repeatKey   = 0;
+    self.m_inputSerial = serial;
+
+    if (self.m_keyboardFocus)
+    {
+        self.m_keyboardFocus->pushSeatEvent(Event::FocusLost{}, std::nullopt);
+        self.m_keyboardFocus = nullptr;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleKey(void*         data,
+                     wl_keyboard*  /* keyboard */,
+                     std::uint32_t serial,
+                     std::uint32_t time,
+                     std::uint32_t key,
+                     std::uint32_t state)
+{
+    auto&      self    = *static_cast<Seat*>(data);
+    const bool pressed = (state == WL_KEYBOARD_KEY_STATE_PRESSED);
+
+    if (key < MaxKeyCode)
+    {
+        const std::lock_guard lock(self.m_mutex);
+        self.m_pressedKeys.set(key, pressed);
+    }
+
+    if (pressed)
+    {
+        self.m_inputSerial = serial;
+
+        // Modifiers and a few other keys don't repeat
+        if (self.m_keymap && xkb_keymap_key_repeats(self.m_keymap, key + SeatImpl::keycodeOffset))
+        {
+            self.m_repeatKey  = key;
+            self.m_nextRepeat = Clock::now() + std::chrono::milliseconds(self.m_repeatDelay);
+        }
+    }
+    else if (key == self.m_repeatKey)
+    {
+        self.m_repeatKey = 0;
+    }
+
+    self.sendKey(key, pressed, time);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleModifiers(void* data,
+                           wl_keyboard* /* keyboard */,
+                           std::uint32_t /* serial */,
+                           std::uint32_t depressed,
+                           std::uint32_t latched,
+                           std::uint32_t locked,
+                           std::uint32_t group)
+{
+    auto& self = *static_cast<Seat*>(data);
+
+    const std::lock_guard lock(self.m_mutex);
+    if (self.m_xkbState)
+        xkb_state_update_mask(self.m_xkbState, depressed, latched, locked, 0, 0, group);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleRepeatInfo(void* data, wl_keyboard* /* keyboard */, std::int32_t rate, std::int32_t delay)
+{
+    auto& self         = *static_cast<Seat*>(data);
+    self.m_repeatRate  = rate;
+    self.m_repeatDelay = delay;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerEnter(void*         data,
+                              wl_pointer*   /* pointer */,
+                              std::uint32_t serial,
+                              wl_surface*   surface,
+                              wl_fixed_t    x,
+                              wl_fixed_t    y)
+{
+    auto&              self   = *static_cast<Seat*>(data);
+    WindowImplWayland* window = WindowImplWayland::fromSurface(surface);
+    if (!window)
+        return;
+
+    // The cursor must be set again each time the pointer enters a surface
+    self.m_pointerFocus  = window;
+    self.m_pointerSerial = serial;
+    self.updateCursor(*window);
+
+    const Vector2i position = window->toPixels(wl_fixed_to_double(x), wl_fixed_to_double(y));
+    window->pushSeatEvent(Event::MouseEntered{}, std::nullopt);
+    window->pushSeatEvent(Event::MouseMoved{position}, std::nullopt);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerLeave(void*         data,
+                              wl_pointer*   /* pointer */,
+                              std::uint32_t /* serial */,
+                              wl_surface*   /* surface */)
+{
+    auto& self = *static_cast<Seat*>(data);
+
+    if (self.m_pointerFocus)
+    {
+        self.m_pointerFocus->pushSeatEvent(Event::MouseLeft{}, std::nullopt);
+        self.m_pointerFocus = nullptr;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerMotion(void* data, wl_pointer* /* pointer */, std::uint32_t time, wl_fixed_t x, wl_fixed_t y)
+{
+    WindowImplWayland* window = static_cast<Seat*>(data)->m_pointerFocus;
+    if (window)
+        window->pushSeatEvent(Event::MouseMoved{window->toPixels(wl_fixed_to_double(x), wl_fixed_to_double(y))}, time);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerButton(void*         data,
+                               wl_pointer*   /* pointer */,
+                               std::uint32_t serial,
+                               std::uint32_t time,
+                               std::uint32_t button,
+                               std::uint32_t state)
+{
+    auto&                              self        = *static_cast<Seat*>(data);
+    const std::optional<Mouse::Button> mouseButton = SeatImpl::toButton(button);
+    const bool                         pressed     = (state == WL_POINTER_BUTTON_STATE_PRESSED);
+
+    if (pressed)
+        self.m_inputSerial = serial;
+
+    if (!mouseButton)
+        return;
+
+    {
+        const std::lock_guard lock(self.m_mutex);
+        self.m_pressedButtons.set(static_cast<std::size_t>(*mouseButton), pressed);
+    }
+
+    if (WindowImplWayland* window = self.m_pointerFocus)
+    {
+        if (pressed)
+            window->pushSeatEvent(Event::MouseButtonPressed{{*mouseButton, window->getMousePosition()}}, time);
+        else
+            window->pushSeatEvent(Event::MouseButtonReleased{{*mouseButton, window->getMousePosition()}}, time);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerAxis(void*         data,
+                             wl_pointer*   /* pointer */,
+                             std::uint32_t time,
+                             std::uint32_t axis,
+                             wl_fixed_t    value)
+{
+    auto& self = *static_cast<Seat*>(data);
+    if (axis >= self.m_scroll.size())
+        return;
+
+    self.m_scroll[axis] += static_cast<float>(wl_fixed_to_double(value));
+    self.m_scrollTime = time;
+
+    // Before version 5, there is no frame event to group the axes
+    if (self.m_version < WL_POINTER_FRAME_SINCE_VERSION)
+        self.sendScroll();
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerFrame(void* data, wl_pointer* /* pointer */)
+{
+    static_cast<Seat*>(data)->sendScroll();
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handlePointerAxisDiscrete(void* data, wl_pointer* /* pointer */, std::uint32_t axis, std::int32_t discrete)
+{
+    auto& self = *static_cast<Seat*>(data);
+    if (axis < self.m_scrollSteps.size())
+        self.m_scrollSteps[axis] += discrete;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleRelativeMotion(void* data,
+                                zwp_relative_pointer_v1* /* relativePointer */,
+                                std::uint32_t timeHigh,
+                                std::uint32_t timeLow,
+                                wl_fixed_t /* dx */,
+                                wl_fixed_t /* dy */,
+                                wl_fixed_t dxUnaccelerated,
+                                wl_fixed_t dyUnaccelerated)
+{
+    auto&              self   = *static_cast<Seat*>(data);
+    WindowImplWayland* window = self.m_pointerFocus;
+    if (!window)
+        return;
+
+    // Raw movements come in fractions of device units; the fractions are carried over to the next movements
+    self.m_rawRemainder += Vector2<double>(wl_fixed_to_double(dxUnaccelerated), wl_fixed_to_double(dyUnaccelerated));
+    const Vector2i delta(static_cast<int>(std::trunc(self.m_rawRemainder.x)),
+                         static_cast<int>(std::trunc(self.m_rawRemainder.y)));
+    self.m_rawRemainder -= Vector2<double>(delta);
+
+    if (delta == Vector2i())
+        return;
+
+    // The time is given in microseconds, with the same origin as the other events
+    const std::uint64_t microseconds = (std::uint64_t{timeHigh} << 32) | timeLow;
+    window->pushSeatRawMovement(delta, static_cast<std::uint32_t>(microseconds / 1000));
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleDataOffer(void* data, wl_data_device* /* dataDevice */, wl_data_offer* offer)
+{
+    static const wl_data_offer_listener offerListener{handleOfferType,
+                                                      [](void*, wl_data_offer*, std::uint32_t) {},
+                                                      [](void*, wl_data_offer*, std::uint32_t) {}};
+
+    // The MIME types are sent right after the offer, before it is used
+    auto& self = *static_cast<Seat*>(data);
+    self.m_offerTypes[offer];
+    wl_data_offer_add_listener(offer, &offerListener, &self);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleOfferType(void* data, wl_data_offer* offer, const char* mimeType)
+{
+    static_cast<Seat*>(data)->m_offerTypes[offer].emplace_back(mimeType);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleDragEnter(void* data,
+                           wl_data_device* /* dataDevice */,
+                           std::uint32_t /* serial */,
+                           wl_surface* /* surface */,
+                           wl_fixed_t /* x */,
+                           wl_fixed_t /* y */,
+                           wl_data_offer* offer)
+{
+    // Drag and drop is not supported, the offer is only kept until the drag leaves
+    auto& self = *static_cast<Seat*>(data);
+    self.destroyOffer(self.m_dragOffer);
+    self.m_dragOffer = offer;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleDragLeave(void* data, wl_data_device* /* dataDevice */)
+{
+    auto& self = *static_cast<Seat*>(data);
+    self.destroyOffer(self.m_dragOffer);
+    self.m_dragOffer = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::handleSelection(void* data, wl_data_device* /* dataDevice */, wl_data_offer* offer)
+{
+    auto& self = *static_cast<Seat*>(data);
+    if (self.m_selection != offer)
+        self.destroyOffer(self.m_selection);
+
+    self.m_selection = offer;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::destroyOffer(wl_data_offer* offer)
+{
+    if (!offer)
+        return;
+
+    m_offerTypes.erase(offer);
+    wl_data_offer_destroy(offer);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::sendKey(std::uint32_t key, bool pressed, std::optional<std::uint32_t> time)
+{
+    if (!m_keyboardFocus || !m_xkbState)
+        return;
+
+    const std::uint32_t keycode = key + SeatImpl::keycodeOffset;
+
+    Event::KeyChanged keyChanged;
+    keyChanged.code     = getKey(keycode);
+    keyChanged.scancode = KeyboardImpl::evdevToScancode(key);
+    keyChanged.alt      = isModifierActive(XKB_MOD_NAME_ALT);
+    keyChanged.control  = isModifierActive(XKB_MOD_NAME_CTRL);
+    keyChanged.shift    = isModifierActive(XKB_MOD_NAME_SHIFT);
+    keyChanged.system   = isModifierActive(XKB_MOD_NAME_LOGO);
+
+    if (!pressed)
+    {
+        m_keyboardFocus->pushSeatEvent(Event::KeyReleased{keyChanged}, time);
+        return;
+    }
+
+    m_keyboardFocus->pushSeatEvent(Event::KeyPressed{keyChanged}, time);
+
+    if (const char32_t unicode = getText(keycode))
+        m_keyboardFocus->pushSeatEvent(Event::TextEntered{unicode}, time);
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::sendScroll()
+{
+    WindowImplWayland* window = m_pointerFocus;
+
+    for (std::size_t axis = 0; axis < m_scroll.size(); ++axis)
+    {
+        if (window && ((m_scroll[axis] != 0.f) || (m_scrollSteps[axis] != 0)))
+        {
+            // Wayland scrolls down and right with positive values, which are negative for SFML.
+            // Wheels give whole steps; other devices give a distance, 10 units per step.
+            const float delta = (m_scrollSteps[axis] != 0) ? -static_cast<float>(m_scrollSteps[axis])
+                                                           : -m_scroll[axis] / 10.f;
+            const Mouse::Wheel wheel = (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) ? Mouse::Wheel::Vertical
+                                                                                  : Mouse::Wheel::Horizontal;
+
+            window->pushSeatEvent(Event::MouseWheelScrolled{wheel, delta, window->getMousePosition()}, m_scrollTime);
+        }
+
+        m_scroll[axis]      = 0.f;
+        m_scrollSteps[axis] = 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+char32_t Seat::getText(std::uint32_t keycode)
+{
+    if (m_composeState)
+    {
+        xkb_compose_state_feed(m_composeState, xkb_state_key_get_one_sym(m_xkbState, keycode));
+
+        switch (xkb_compose_state_get_status(m_composeState))
+        {
+            case XKB_COMPOSE_COMPOSING:
+                return 0;
+
+            case XKB_COMPOSE_COMPOSED:
+            {
+                const xkb_keysym_t composed = xkb_compose_state_get_one_sym(m_composeState);
+                xkb_compose_state_reset(m_composeState);
+                return xkb_keysym_to_utf32(composed);
+            }
+
+            case XKB_COMPOSE_CANCELLED:
+                xkb_compose_state_reset(m_composeState);
+                return 0;
+
+            case XKB_COMPOSE_NOTHING:
+                break;
+        }
+    }
+
+    // Like with X11, control characters are produced when Control is held down
+    return xkb_state_key_get_utf32(m_xkbState, keycode);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t Seat::getKeysym(std::uint32_t keycode, std::uint32_t level) const
+{
+    if (!m_xkbState)
+        return XKB_KEY_NoSymbol;
+
+    const xkb_layout_index_t layout  = xkb_state_key_get_layout(m_xkbState, keycode);
+    const xkb_keysym_t*      keysyms = nullptr;
+    if ((layout == XKB_LAYOUT_INVALID) ||
+        (xkb_keymap_key_get_syms_by_level(m_keymap, keycode, layout, level, &keysyms) <= 0))
+        return XKB_KEY_NoSymbol;
+
+    return keysyms[0];
+}
+
+
+////////////////////////////////////////////////////////////
+Keyboard::Key Seat::getKey(std::uint32_t keycode) const
+{
+    // Try each shift level until we get a match
+    for (std::uint32_t level = 0; level < 4; ++level)
+    {
+        const Keyboard::Key key = keySymToKey(getKeysym(keycode, level));
+        if (key != Keyboard::Key::Unknown)
+            return key;
+    }
+
+    return Keyboard::Key::Unknown;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t Seat::findKeycode(Keyboard::Key key) const
+{
+    const KeySym keysym = keyToKeySym(key);
+    if (!m_keymap || (keysym == XKB_KEY_NoSymbol))
+        return 0;
+
+    const xkb_keycode_t maxKeycode = xkb_keymap_max_keycode(m_keymap);
+    for (xkb_keycode_t keycode = xkb_keymap_min_keycode(m_keymap); keycode <= maxKeycode; ++keycode)
+    {
+        for (std::uint32_t level = 0; level < 2; ++level)
+        {
+            if (getKeysym(keycode, level) == keysym)
+                return keycode;
+        }
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Seat::isModifierActive(const char* name) const
+{
+    return xkb_state_mod_name_is_active(m_xkbState, name, XKB_STATE_MODS_EFFECTIVE) > 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Seat::loadCursorTheme(std::int32_t scale)
+{
+    if (m_cursorTheme && (m_cursorThemeScale == scale))
+        return;
+
+    if (m_cursorTheme)
+        wl_cursor_theme_destroy(m_cursorTheme);
+
+    // The desktop exports its cursor theme and size like for X11 applications
+    const char* sizeVariable = std::getenv("XCURSOR_SIZE");
+    int         size         = sizeVariable ? std::atoi(sizeVariable) : 0;
+    if (size <= 0)
+        size = 24;
+
+    m_cursorTheme      = wl_cursor_theme_load(std::getenv("XCURSOR_THEME"), size * scale, m_display.getGlobals().shm);
+    m_cursorThemeScale = scale;
+
+    if (!m_cursorTheme)
+        err() << "Failed to load the cursor theme" << std::endl;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,545 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include <SFML/System/String.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cstdint>
+
+
+struct wl_array;
+struct wl_cursor_theme;
+struct wl_data_device;
+struct wl_data_offer;
+struct wl_keyboard;
+struct wl_pointer;
+struct wl_seat;
+struct wl_surface;
+struct xkb_compose_state;
+struct xkb_compose_table;
+struct xkb_context;
+struct xkb_keymap;
+struct xkb_state;
+struct zwp_relative_pointer_v1;
+
+
+namespace sf::priv
+{
+class CursorImpl;
+class WaylandDisplay;
+class WindowImplWayland;
+
+////////////////////////////////////////////////////////////
+/// \brief Input devices of a Wayland seat
+///
+/// The seat receives the keyboard and pointer events of all
+/// the windows, translates them and forwards them to the
+/// window which has the focus. It also keeps the state of
+/// the devices, which answers the real-time input queries.
+///
+////////////////////////////////////////////////////////////
+class Seat
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param display Display which owns the seat
+    /// \param seat    Wayland seat object, the seat takes ownership of it
+    /// \param version Version of the seat interface
+    ///
+    ////////////////////////////////////////////////////////////
+    Seat(WaylandDisplay& display, wl_seat* seat, std::uint32_t version);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Seat();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Seat(const Seat&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Seat& operator=(const Seat&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop sending events to a window which is being destroyed
+    ///
+    /// \param window Window being destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    void forgetWindow(const WindowImplWayland& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Show the cursor of a window if the pointer is over it
+    ///
+    /// \param window Window whose cursor changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateCursor(const WindowImplWayland& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Repeat the key held down, if it is time to
+    ///
+    /// Wayland compositors leave key repeat to the clients.
+    ///
+    ////////////////////////////////////////////////////////////
+    void processKeyRepeat();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pointer of the seat
+    ///
+    /// \return Pointer, or null if the seat has none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] wl_pointer* getPointer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the window which is under the pointer
+    ///
+    /// \return Window under the pointer, or null if the pointer is outside of all the windows
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] WindowImplWayland* getPointerFocus() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the serial of the last input event
+    ///
+    /// Some requests, like setting the clipboard, are only
+    /// accepted in response to an input event.
+    ///
+    /// \return Serial of the last key press, button press or focus change
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getInputSerial() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the data device of the seat, which gives access to the clipboard
+    ///
+    /// \return Data device, or null if the compositor has no clipboard
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] wl_data_device* getDataDevice() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current content of the clipboard, if it is text
+    ///
+    /// \param mimeType Filled with the best text MIME type of the content
+    ///
+    /// \return Offer of the content, or null if the clipboard doesn't contain text
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] wl_data_offer* getTextSelection(std::string& mimeType) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key is pressed
+    ///
+    /// \param key Key to check
+    ///
+    /// \return True if the key is pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyPressed(Keyboard::Key key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key is pressed
+    ///
+    /// \param code Scancode to check
+    ///
+    /// \return True if the physical key is pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyPressed(Keyboard::Scancode code) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state of all the keys
+    ///
+    /// \param keys      Filled with the state of the keys
+    /// \param scancodes Filled with the state of the physical keys
+    ///
+    ////////////////////////////////////////////////////////////
+    void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Localize a physical key to a logical one
+    ///
+    /// \param code Scancode to localize
+    ///
+    /// \return The key corresponding to the scancode under the current keyboard layout
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Keyboard::Key localize(Keyboard::Scancode code) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Identify the physical key corresponding to a logical one
+    ///
+    /// \param key Key to delocalize
+    ///
+    /// \return The scancode corresponding to the key under the current keyboard layout
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Keyboard::Scancode delocalize(Keyboard::Key key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide a string representation for a given scancode
+    ///
+    /// \param code Scancode to check
+    ///
+    /// \return The localized description of the key
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] String getDescription(Keyboard::Scancode code) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state of the mouse buttons
+    ///
+    /// \return State of the buttons
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::bitset<Mouse::ButtonCount> getMouseButtons() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a change of the devices of the seat
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleCapabilities(void* data, wl_seat* seat, std::uint32_t capabilities);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a new keyboard map
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleKeymap(void*         data,
+                             wl_keyboard*  keyboard,
+                             std::uint32_t format,
+                             std::int32_t  fd,
+                             std::uint32_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the keyboard focus entering a surface
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleKeyboardEnter(void*         data,
+                                    wl_keyboard*  keyboard,
+                                    std::uint32_t serial,
+                                    wl_surface*   surface,
+                                    wl_array*     keys);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the keyboard focus leaving a surface
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleKeyboardLeave(void* data, wl_keyboard* keyboard, std::uint32_t serial, wl_surface* surface);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a key press or release
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleKey(void*         data,
+                          wl_keyboard*  keyboard,
+                          std::uint32_t serial,
+                          std::uint32_t time,
+                          std::uint32_t key,
+                          std::uint32_t state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a change of the modifiers
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleModifiers(void*         data,
+                                wl_keyboard*  keyboard,
+                                std::uint32_t serial,
+                                std::uint32_t depressed,
+                                std::uint32_t latched,
+                                std::uint32_t locked,
+                                std::uint32_t group);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a change of the key repeat settings
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleRepeatInfo(void* data, wl_keyboard* keyboard, std::int32_t rate, std::int32_t delay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the pointer entering a surface
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerEnter(void*         data,
+                                   wl_pointer*   pointer,
+                                   std::uint32_t serial,
+                                   wl_surface*   surface,
+                                   std::int32_t  x,
+                                   std::int32_t  y);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the pointer leaving a surface
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerLeave(void* data, wl_pointer* pointer, std::uint32_t serial, wl_surface* surface);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a movement of the pointer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerMotion(void*         data,
+                                    wl_pointer*   pointer,
+                                    std::uint32_t time,
+                                    std::int32_t  x,
+                                    std::int32_t  y);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a button press or release
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerButton(void*         data,
+                                    wl_pointer*   pointer,
+                                    std::uint32_t serial,
+                                    std::uint32_t time,
+                                    std::uint32_t button,
+                                    std::uint32_t state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a scroll
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerAxis(void*         data,
+                                  wl_pointer*   pointer,
+                                  std::uint32_t time,
+                                  std::uint32_t axis,
+                                  std::int32_t  value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the end of a group of pointer events
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerFrame(void* data, wl_pointer* pointer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a scroll by whole wheel steps
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePointerAxisDiscrete(void* data, wl_pointer* pointer, std::uint32_t axis, std::int32_t discrete);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a raw movement of the pointer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleRelativeMotion(void*                    data,
+                                     zwp_relative_pointer_v1* relativePointer,
+                                     std::uint32_t            timeHigh,
+                                     std::uint32_t            timeLow,
+                                     std::int32_t             dx,
+                                     std::int32_t             dy,
+                                     std::int32_t             dxUnaccelerated,
+                                     std::int32_t             dyUnaccelerated);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a new data offer (clipboard or drag and drop)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleDataOffer(void* data, wl_data_device* dataDevice, wl_data_offer* offer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a MIME type of a data offer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleOfferType(void* data, wl_data_offer* offer, const char* mimeType);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a drag and drop entering a surface
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleDragEnter(void*           data,
+                                wl_data_device* dataDevice,
+                                std::uint32_t   serial,
+                                wl_surface*     surface,
+                                std::int32_t    x,
+                                std::int32_t    y,
+                                wl_data_offer*  offer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a drag and drop leaving a surface
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleDragLeave(void* data, wl_data_device* dataDevice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a new content of the clipboard
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleSelection(void* data, wl_data_device* dataDevice, wl_data_offer* offer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy a data offer and forget its MIME types
+    ///
+    /// \param offer Offer to destroy (can be null)
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroyOffer(wl_data_offer* offer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Translate a key press or release and send it to the focused window
+    ///
+    /// \param key     Evdev code of the key
+    /// \param pressed True for a press, false for a release
+    /// \param time    Time of the event in milliseconds, empty for a repetition
+    ///
+    ////////////////////////////////////////////////////////////
+    void sendKey(std::uint32_t key, bool pressed, std::optional<std::uint32_t> time);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the scroll accumulated during the current pointer frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void sendScroll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Translate a key press into the text it produces
+    ///
+    /// Dead keys and compose sequences are handled here.
+    ///
+    /// \param keycode XKB code of the key
+    ///
+    /// \return Character produced, or 0 if the key produces no text
+    ///
+    ////////////////////////////////////////////////////////////
+    char32_t getText(std::uint32_t keycode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the keysym of a key at a given level of the current layout
+    ///
+    /// \param keycode XKB code of the key
+    /// \param level   Shift level
+    ///
+    /// \return Keysym of the key, 0 if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint32_t getKeysym(std::uint32_t keycode, std::uint32_t level) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the key corresponding to an XKB key code under the current layout
+    ///
+    /// \param keycode XKB code of the key
+    ///
+    /// \return The corresponding key, Unknown if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    Keyboard::Key getKey(std::uint32_t keycode) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the XKB key code which produces a key under the current layout
+    ///
+    /// \param key Key to find
+    ///
+    /// \return XKB code of the key, 0 if no key produces it
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint32_t findKeycode(Keyboard::Key key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether a modifier is active
+    ///
+    /// \param name XKB name of the modifier
+    ///
+    /// \return True if the modifier is active
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isModifierActive(const char* name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the cursor theme for a given scale factor
+    ///
+    /// \param scale Integer scale factor of the window under the pointer
+    ///
+    ////////////////////////////////////////////////////////////
+    void loadCursorTheme(std::int32_t scale);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t MaxKeyCode{768}; ///< Number of evdev key codes
+
+    using Clock      = std::chrono::steady_clock;
+    using OfferTypes = std::unordered_map<wl_data_offer*, std::vector<std::string>>;
+
+    WaylandDisplay&                 m_display;            ///< Display which owns the seat
+    wl_seat*                        m_seat{};             ///< Wayland seat object
+    std::uint32_t                   m_version{};          ///< Version of the seat interface
+    wl_keyboard*                    m_keyboard{};         ///< Keyboard of the seat
+    wl_pointer*                     m_pointer{};          ///< Pointer of the seat
+    zwp_relative_pointer_v1*        m_relativePointer{};  ///< Raw movements of the pointer
+    wl_data_device*                 m_dataDevice{};       ///< Clipboard and drag and drop of the seat
+    xkb_context*                    m_xkbContext{};       ///< XKB library context
+    xkb_keymap*                     m_keymap{};           ///< Current keyboard map
+    xkb_state*                      m_xkbState{};         ///< Current state of the modifiers and layouts
+    xkb_compose_table*              m_composeTable{};     ///< Compose sequences of the current locale
+    xkb_compose_state*              m_composeState{};     ///< State of the compose sequence being typed
+    std::bitset<MaxKeyCode>         m_pressedKeys;        ///< State of the keys, indexed by evdev code
+    std::bitset<Mouse::ButtonCount> m_pressedButtons;     ///< State of the mouse buttons
+    WindowImplWayland*              m_keyboardFocus{};    ///< Window which has the keyboard focus
+    WindowImplWayland*              m_pointerFocus{};     ///< Window under the pointer
+    std::uint32_t                   m_pointerSerial{};    ///< Serial of the last pointer enter event
+    std::uint32_t                   m_inputSerial{};      ///< Serial of the last input event
+    std::int32_t                    m_repeatRate{25};     ///< Repeated keys per second (0 disables key repeat)
+    std::int32_t                    m_repeatDelay{600};   ///< Delay before a held key repeats, in milliseconds
+    std::uint32_t                   m_repeatKey{};        ///< Evdev code of the key being repeated, 0 if none
+    Clock::time_point               m_nextRepeat;         ///< Time of the next repetition
+    std::array<float, 2>            m_scroll{};           ///< Continuous scroll of the current frame, per axis
+    std::array<std::int32_t, 2>     m_scrollSteps{};      ///< Wheel steps of the current frame, per axis
+    std::uint32_t                   m_scrollTime{};       ///< Time of the scroll of the current frame
+    Vector2<double>                 m_rawRemainder;       ///< Fraction of pixel of raw movement not sent yet
+    wl_surface*                     m_cursorSurface{};    ///< Surface showing the cursor
+    wl_cursor_theme*                m_cursorTheme{};      ///< Theme of the system cursors
+    std::int32_t                    m_cursorThemeScale{}; ///< Scale factor the cursor theme was loaded for
+    wl_data_offer*                  m_selection{};        ///< Content of the clipboard
+    wl_data_offer*                  m_dragOffer{};        ///< Content of the drag and drop in progress
+    OfferTypes                      m_offerTypes;         ///< MIME types of the data offers
+    mutable std::mutex              m_mutex;              ///< Protects the state read by the input queries
+};
+
+} // namespace sf::priv
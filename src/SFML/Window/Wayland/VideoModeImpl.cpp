@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/VideoModeImpl.hpp>
+#include <SFML/Window/Wayland/Display.hpp>
+
+#include <algorithm>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::vector<VideoMode> VideoModeImpl::getFullscreenModes()
+{
+    std::vector<VideoMode> modes;
+
+    // Wayland clients can't change the video mode, the compositor scales fullscreen
+    // windows instead; the modes of all the outputs are reported nevertheless
+    const std::shared_ptr<WaylandDisplay> display = openDisplay();
+    for (const auto& output : display->getOutputs())
+    {
+        for (const VideoMode& mode : output->modes)
+        {
+            if (std::find(modes.begin(), modes.end(), mode) == modes.end())
+                modes.push_back(mode);
+        }
+    }
+
+    if (modes.empty())
+        modes.push_back(getDesktopMode());
+
+    return modes;
+}
+
+
+////////////////////////////////////////////////////////////
+VideoMode VideoModeImpl::getDesktopMode()
+{
+    // Wayland has no primary output, the first one announced by the compositor is used
+    const std::shared_ptr<WaylandDisplay> display = openDisplay();
+    if (!display->getOutputs().empty())
+        return display->getOutputs().front()->currentMode;
+
+    return VideoMode({0, 0});
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    std::vector<Monitor> monitors;
+
+    const std::shared_ptr<WaylandDisplay> display = openDisplay();
+    for (const auto& output : display->getOutputs())
+    {
+        Monitor monitor;
+        monitor.name        = output->description;
+        monitor.position    = output->position;
+        monitor.mode        = output->currentMode;
+        monitor.refreshRate = output->refreshRate;
+        monitor.primary     = monitors.empty();
+        monitors.push_back(monitor);
+    }
+
+    return monitors;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // The outputs are updated by the events of the compositor
+    return true;
+}
+
+} // namespace sf::priv
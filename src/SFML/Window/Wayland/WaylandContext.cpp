@@ -0,0 +1,694 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Wayland/Display.hpp>
+#include <SFML/Window/Wayland/WaylandContext.hpp>
+#include <SFML/Window/Wayland/WindowImplWayland.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <presentation-time-client-protocol.h>
+#include <wayland-client.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include <cassert>
+
+// We check for this definition in order to avoid multiple definitions of GLAD
+// entities during unity builds of SFML.
+#ifndef SF_GLAD_EGL_IMPLEMENTATION_INCLUDED
+#define SF_GLAD_EGL_IMPLEMENTATION_INCLUDED
+#define SF_GLAD_EGL_IMPLEMENTATION
+#include <glad/egl.h>
+#endif
+
+
+namespace
+{
+// Note: the request wp_presentation_feedback hides the type of the same name, hence the "struct" in this file
+
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace WaylandContextImpl
+{
+// Tokens of EGL_KHR_platform_wayland, EGL_KHR_create_context and EGL_EXT_buffer_age, which glad doesn't define
+constexpr EGLenum platformWayland    = 0x31D8;
+constexpr EGLint  contextFlagsKHR    = 0x30FC;
+constexpr EGLint  contextDebugBitKHR = 0x0001;
+constexpr EGLint  bufferAge          = 0x313D;
+
+using SwapBuffersWithDamage = EGLBoolean (*)(EGLDisplay, EGLSurface, const EGLint*, EGLint);
+
+#if defined(SFML_OPENGL_ES)
+constexpr EGLint renderableType = EGL_OPENGL_ES_BIT;
+#else
+constexpr EGLint renderableType = EGL_OPENGL_BIT;
+#endif
+
+// Presentation feedbacks are only received while the events of the window are processed
+constexpr std::size_t maxPendingFeedbacks = 8;
+
+// The EGL display is shared by all the contexts, and terminated with the last one
+std::mutex   mutex;
+EGLDisplay   eglDisplay   = EGL_NO_DISPLAY;
+unsigned int contextCount = 0;
+
+
+////////////////////////////////////////////////////////////
+bool hasExtension(EGLDisplay display, std::string_view name)
+{
+    const char* extensionString = eglQueryString(display, EGL_EXTENSIONS);
+    if (!extensionString)
+        return false;
+
+    const std::string_view extensions(extensionString);
+    for (std::size_t begin = 0; begin < extensions.size();)
+    {
+        const std::size_t end = std::min(extensions.find(' ', begin), extensions.size());
+        if (extensions.substr(begin, end - begin) == name)
+            return true;
+        begin = end + 1;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+SwapBuffersWithDamage getSwapBuffersWithDamage(EGLDisplay display)
+{
+    // The KHR and EXT extensions define the same function
+    if (hasExtension(display, "EGL_KHR_swap_buffers_with_damage"))
+        return reinterpret_cast<SwapBuffersWithDamage>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+
+    if (hasExtension(display, "EGL_EXT_swap_buffers_with_damage"))
+        return reinterpret_cast<SwapBuffersWithDamage>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void ensureInit()
+{
+    static std::once_flag flag;
+
+    std::call_once(flag,
+                   []
+                   {
+                       if (!gladLoaderLoadEGL(EGL_NO_DISPLAY))
+                       {
+                           // At this point, the failure is unrecoverable
+                           // Dump a message to the console and let the application terminate
+                           sf::err() << "Failed to load EGL entry points" << std::endl;
+
+                           assert(false);
+                       }
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+EGLDisplay acquireDisplay(wl_display* display)
+{
+    ensureInit();
+
+    const std::lock_guard lock(mutex);
+
+    if (contextCount++ == 0)
+    {
+        using GetPlatformDisplayEXT = EGLDisplay (*)(EGLenum, void*, const EGLint*);
+
+        // Ask explicitly for the Wayland platform, EGL can't tell it apart from the others by the native display
+        if (SF_GLAD_EGL_VERSION_1_5 && hasExtension(EGL_NO_DISPLAY, "EGL_KHR_platform_wayland"))
+        {
+            eglCheck(eglDisplay = eglGetPlatformDisplay(platformWayland, display, nullptr));
+        }
+        else if (hasExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_base") &&
+                 hasExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_wayland"))
+        {
+            const auto getPlatformDisplay = reinterpret_cast<GetPlatformDisplayEXT>(
+                eglGetProcAddress("eglGetPlatformDisplayEXT"));
+            eglCheck(eglDisplay = getPlatformDisplay(platformWayland, display, nullptr));
+        }
+        else
+        {
+            eglCheck(eglDisplay = eglGetDisplay(reinterpret_cast<EGLNativeDisplayType>(display)));
+        }
+
+        eglCheck(eglInitialize(eglDisplay, nullptr, nullptr));
+
+        // Continue loading with a display
+        gladLoaderLoadEGL(eglDisplay);
+    }
+
+    return eglDisplay;
+}
+
+
+////////////////////////////////////////////////////////////
+void releaseDisplay()
+{
+    const std::lock_guard lock(mutex);
+
+    if (--contextCount == 0)
+    {
+        eglCheck(eglTerminate(eglDisplay));
+        eglDisplay = EGL_NO_DISPLAY;
+    }
+}
+} // namespace WaylandContextImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+WaylandContext::WaylandContext(WaylandContext* shared) : m_display(openDisplay())
+{
+    m_eglDisplay = WaylandContextImpl::acquireDisplay(m_display->getDisplay());
+
+    // Contexts without a window only render to framebuffer objects, so they don't need a surface if the
+    // display supports it; otherwise a dummy pbuffer is used
+    m_surfaceless = WaylandContextImpl::hasExtension(m_eglDisplay, "EGL_KHR_surfaceless_context");
+    m_config      = getBestConfig(32, m_settings);
+    updateSettings();
+
+    createContext(shared);
+
+    if (!m_surfaceless)
+    {
+        const EGLint attributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        eglCheck(m_surface = eglCreatePbufferSurface(m_eglDisplay, m_config, attributes));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+WaylandContext::WaylandContext(WaylandContext*        shared,
+                               const ContextSettings& settings,
+                               const WindowImpl&      owner,
+                               unsigned int           bitsPerPixel) :
+m_display(openDisplay()),
+m_owner(&static_cast<const WindowImplWayland&>(owner))
+{
+    m_eglDisplay = WaylandContextImpl::acquireDisplay(m_display->getDisplay());
+
+    m_settings = settings;
+    m_config   = getBestConfig(bitsPerPixel, settings);
+    updateSettings();
+
+    createContext(shared);
+    createWindowSurface();
+}
+
+
+////////////////////////////////////////////////////////////
+WaylandContext::WaylandContext(WaylandContext* shared, const ContextSettings& settings, const Vector2u& size) :
+m_display(openDisplay())
+{
+    m_eglDisplay = WaylandContextImpl::acquireDisplay(m_display->getDisplay());
+
+    // A pbuffer of the requested size is the rendering target; drivers without pbuffers on Wayland
+    // render to framebuffer objects instead
+    m_settings    = settings;
+    m_surfaceless = WaylandContextImpl::hasExtension(m_eglDisplay, "EGL_KHR_surfaceless_context");
+    m_config      = getBestConfig(32, settings);
+    updateSettings();
+
+    createContext(shared);
+
+    EGLint surfaceType = 0;
+    eglCheck(eglGetConfigAttrib(m_eglDisplay, m_config, EGL_SURFACE_TYPE, &surfaceType));
+
+    if (surfaceType & EGL_PBUFFER_BIT)
+    {
+        const EGLint attributes[] = {EGL_WIDTH,
+                                     static_cast<EGLint>(size.x),
+                                     EGL_HEIGHT,
+                                     static_cast<EGLint>(size.y),
+                                     EGL_NONE};
+        eglCheck(m_surface = eglCreatePbufferSurface(m_eglDisplay, m_config, attributes));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+WaylandContext::~WaylandContext()
+{
+    // Notify unshared OpenGL resources of context destruction
+    cleanupUnsharedResources();
+
+    // The frames of the window won't be reported anymore
+    {
+        const std::lock_guard lock(m_presentMutex);
+
+        for (struct wp_presentation_feedback* feedback : m_feedbacks)
+            wp_presentation_feedback_destroy(feedback);
+    }
+
+    // Deactivate the current context
+    EGLContext currentContext = EGL_NO_CONTEXT;
+    eglCheck(currentContext = eglGetCurrentContext());
+
+    if (currentContext == m_context)
+        eglCheck(eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+    if (m_context != EGL_NO_CONTEXT)
+        eglCheck(eglDestroyContext(m_eglDisplay, m_context));
+
+    if (m_surface != EGL_NO_SURFACE)
+        eglCheck(eglDestroySurface(m_eglDisplay, m_surface));
+
+    // The EGL display must be terminated before the connection to the compositor is closed
+    WaylandContextImpl::releaseDisplay();
+}
+
+
+////////////////////////////////////////////////////////////
+GlFunctionPointer WaylandContext::getFunction(const char* name)
+{
+    WaylandContextImpl::ensureInit();
+
+    return eglGetProcAddress(name);
+}
+
+
+////////////////////////////////////////////////////////////
+bool WaylandContext::makeCurrent(bool current)
+{
+    if ((m_surface == EGL_NO_SURFACE) && !m_surfaceless)
+        return false;
+
+    EGLBoolean result = EGL_FALSE;
+
+    if (current)
+    {
+        eglCheck(result = eglMakeCurrent(m_eglDisplay, m_surface, m_surface, m_context));
+    }
+    else
+    {
+        eglCheck(result = eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    }
+
+    return result != EGL_FALSE;
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::display()
+{
+    displayDamage({});
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::displayDamage(const std::vector<int>& damage)
+{
+    if (m_surface == EGL_NO_SURFACE)
+        return;
+
+    if (m_owner)
+    {
+        // The compositor doesn't send frame events to hidden windows, waiting for one would block forever
+        const int interval = m_owner->isMapped() ? m_swapInterval : 0;
+        if ((interval != m_appliedInterval) && (eglSwapInterval(m_eglDisplay, interval) == EGL_TRUE))
+            m_appliedInterval = interval;
+
+        requestPresentFeedback();
+    }
+
+    static const auto swapBuffersWithDamage = WaylandContextImpl::getSwapBuffersWithDamage(m_eglDisplay);
+
+    // The compositor only has to recomposite the damaged regions
+    if (!damage.empty() && swapBuffersWithDamage)
+        eglCheck(swapBuffersWithDamage(m_eglDisplay, m_surface, damage.data(), static_cast<EGLint>(damage.size() / 4)));
+    else
+        eglCheck(eglSwapBuffers(m_eglDisplay, m_surface));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int WaylandContext::getBufferAge()
+{
+    if ((m_surface == EGL_NO_SURFACE) || !WaylandContextImpl::hasExtension(m_eglDisplay, "EGL_EXT_buffer_age"))
+        return 0;
+
+    EGLint age = 0;
+    eglCheck(eglQuerySurface(m_eglDisplay, m_surface, WaylandContextImpl::bufferAge, &age));
+    return static_cast<unsigned int>(std::max(age, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::setVerticalSyncEnabled(bool enabled)
+{
+    if (!setSwapInterval(enabled ? 1 : 0))
+        err() << "Setting vertical sync failed" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WaylandContext::setSwapInterval(int interval)
+{
+    // EGL has no adaptive synchronization
+    if (interval < 0)
+        return false;
+
+    m_swapInterval = interval;
+
+    if (eglSwapInterval(m_eglDisplay, interval) != EGL_TRUE)
+        return false;
+
+    m_appliedInterval = interval;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> WaylandContext::getPresentTiming()
+{
+    const std::lock_guard lock(m_presentMutex);
+    return m_presentTiming;
+}
+
+
+////////////////////////////////////////////////////////////
+EGLConfig WaylandContext::getBestConfig(unsigned int bitsPerPixel, const ContextSettings& settings) const
+{
+    const Clock clock;
+
+    // Windows need a window surface, the others a pbuffer unless they can do without a surface
+    EGLint requiredSurface = 0;
+    if (m_owner)
+        requiredSurface = EGL_WINDOW_BIT;
+    else if (!m_surfaceless)
+        requiredSurface = EGL_PBUFFER_BIT;
+
+    // Retrieve the list of available configs
+    EGLint configCount = 0;
+    eglCheck(eglGetConfigs(m_eglDisplay, nullptr, 0, &configCount));
+
+    std::vector<EGLConfig> configs(static_cast<std::size_t>(configCount));
+    eglCheck(eglGetConfigs(m_eglDisplay, configs.data(), configCount, &configCount));
+
+    // Evaluate all the returned configs, and pick the best one
+    int       bestScore = 0x7FFFFFFF;
+    EGLConfig bestConfig{};
+
+    for (EGLConfig config : configs)
+    {
+        // Check mandatory attributes
+        EGLint surfaceType = 0;
+        EGLint renderable  = 0;
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_SURFACE_TYPE, &surfaceType));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_RENDERABLE_TYPE, &renderable));
+        if (((surfaceType & requiredSurface) != requiredSurface) || !(renderable & WaylandContextImpl::renderableType))
+            continue;
+
+        // Extract the components of the current config
+        EGLint red           = 0;
+        EGLint green         = 0;
+        EGLint blue          = 0;
+        EGLint alpha         = 0;
+        EGLint depth         = 0;
+        EGLint stencil       = 0;
+        EGLint multiSampling = 0;
+        EGLint samples       = 0;
+        EGLint caveat        = 0;
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_RED_SIZE, &red));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_GREEN_SIZE, &green));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_BLUE_SIZE, &blue));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_ALPHA_SIZE, &alpha));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_DEPTH_SIZE, &depth));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_STENCIL_SIZE, &stencil));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_SAMPLE_BUFFERS, &multiSampling));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_SAMPLES, &samples));
+        eglCheck(eglGetConfigAttrib(m_eglDisplay, config, EGL_CONFIG_CAVEAT, &caveat));
+
+        // Evaluate the config; sRGB is a property of the surface on EGL, not of the config
+        const int color = red + green + blue + alpha;
+        const int score = evaluateFormat(bitsPerPixel,
+                                         settings,
+                                         color,
+                                         depth,
+                                         stencil,
+                                         multiSampling ? samples : 0,
+                                         caveat == EGL_NONE,
+                                         settings.sRgbCapable);
+
+        // If it's better than the current best, make it the new best
+        if (score < bestScore)
+        {
+            bestScore  = score;
+            bestConfig = config;
+        }
+    }
+
+    assert(bestScore < 0x7FFFFFFF && "Failed to calculate best config");
+
+    recordFormatSelection(clock.getElapsedTime(), false);
+
+    return bestConfig;
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::createContext(WaylandContext* shared)
+{
+    // The API is bound per thread, so it is bound again before each creation
+#if defined(SFML_OPENGL_ES)
+    if (!eglBindAPI(EGL_OPENGL_ES_API))
+        err() << "Failed to bind the OpenGL ES API" << std::endl;
+#else
+    if (!eglBindAPI(EGL_OPENGL_API))
+        err() << "Failed to bind the OpenGL API" << std::endl;
+#endif
+
+    const EGLContext toShared = shared ? shared->m_context : EGL_NO_CONTEXT;
+
+    if (toShared != EGL_NO_CONTEXT)
+        eglCheck(eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+    std::vector<EGLint> attributes;
+
+#if defined(SFML_OPENGL_ES)
+    attributes.insert(attributes.end(), {EGL_CONTEXT_CLIENT_VERSION, 1});
+#else
+    const bool createContext15  = SF_GLAD_EGL_VERSION_1_5;
+    const bool createContextKHR = WaylandContextImpl::hasExtension(m_eglDisplay, "EGL_KHR_create_context");
+
+    if (createContext15 || createContextKHR)
+    {
+        if ((m_settings.majorVersion > 1) || ((m_settings.majorVersion == 1) && (m_settings.minorVersion > 1)))
+        {
+            attributes.insert(attributes.end(),
+                              {EGL_CONTEXT_MAJOR_VERSION,
+                               static_cast<EGLint>(m_settings.majorVersion),
+                               EGL_CONTEXT_MINOR_VERSION,
+                               static_cast<EGLint>(m_settings.minorVersion)});
+        }
+
+        // Profiles only exist since OpenGL 3.2
+        if ((m_settings.attributeFlags & ContextSettings::Core) &&
+            ((m_settings.majorVersion > 3) || ((m_settings.majorVersion == 3) && (m_settings.minorVersion >= 2))))
+        {
+            attributes.insert(attributes.end(), {EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT});
+        }
+
+        if (m_settings.attributeFlags & ContextSettings::Debug)
+        {
+            if (createContext15)
+                attributes.insert(attributes.end(), {EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE});
+            else
+                attributes.insert(attributes.end(),
+                                  {WaylandContextImpl::contextFlagsKHR, WaylandContextImpl::contextDebugBitKHR});
+        }
+    }
+    else if ((m_settings.attributeFlags & ContextSettings::Core) ||
+             (m_settings.attributeFlags & ContextSettings::Debug))
+    {
+        err() << "Selecting a profile during context creation is not supported, disabling compatibility and debug"
+              << std::endl;
+        m_settings.attributeFlags = ContextSettings::Default;
+    }
+#endif
+
+    attributes.push_back(EGL_NONE);
+
+    eglCheck(m_context = eglCreateContext(m_eglDisplay, m_config, toShared, attributes.data()));
+
+    // Fall back to the default version if the requested one isn't supported
+    if ((m_context == EGL_NO_CONTEXT) && (attributes.size() > 1))
+    {
+        err() << "Failed to create an OpenGL context with the requested version, using the default one" << std::endl;
+        m_settings.attributeFlags = ContextSettings::Default;
+
+        const EGLint defaultAttributes[] = {EGL_NONE};
+        eglCheck(m_context = eglCreateContext(m_eglDisplay, m_config, toShared, defaultAttributes));
+    }
+
+    if (m_context == EGL_NO_CONTEXT)
+        err() << "Failed to create an EGL context" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::createWindowSurface()
+{
+    const auto window = reinterpret_cast<EGLNativeWindowType>(m_owner->getEglWindow());
+    if (!window)
+    {
+        err() << "Failed to create the EGL surface, the window wasn't created by SFML" << std::endl;
+        return;
+    }
+
+    // sRGB framebuffers are requested on the surface
+    const bool colorSpaces = SF_GLAD_EGL_VERSION_1_5 ||
+                             WaylandContextImpl::hasExtension(m_eglDisplay, "EGL_KHR_gl_colorspace");
+
+    if (m_settings.sRgbCapable && colorSpaces)
+    {
+        const EGLint attributes[] = {EGL_GL_COLORSPACE, EGL_GL_COLORSPACE_SRGB, EGL_NONE};
+        eglCheck(m_surface = eglCreateWindowSurface(m_eglDisplay, m_config, window, attributes));
+    }
+
+    if (m_surface == EGL_NO_SURFACE)
+    {
+        m_settings.sRgbCapable = false;
+        eglCheck(m_surface = eglCreateWindowSurface(m_eglDisplay, m_config, window, nullptr));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::updateSettings()
+{
+    m_settings.depthBits         = 0;
+    m_settings.stencilBits       = 0;
+    m_settings.antialiasingLevel = 0;
+
+    EGLBoolean result = EGL_FALSE;
+    EGLint     tmp    = 0;
+
+    // Update the internal context settings with the current config
+    eglCheck(result = eglGetConfigAttrib(m_eglDisplay, m_config, EGL_DEPTH_SIZE, &tmp));
+
+    if (result != EGL_FALSE)
+        m_settings.depthBits = static_cast<unsigned int>(tmp);
+
+    eglCheck(result = eglGetConfigAttrib(m_eglDisplay, m_config, EGL_STENCIL_SIZE, &tmp));
+
+    if (result != EGL_FALSE)
+        m_settings.stencilBits = static_cast<unsigned int>(tmp);
+
+    eglCheck(result = eglGetConfigAttrib(m_eglDisplay, m_config, EGL_SAMPLE_BUFFERS, &tmp));
+
+    if ((result != EGL_FALSE) && tmp)
+    {
+        eglCheck(result = eglGetConfigAttrib(m_eglDisplay, m_config, EGL_SAMPLES, &tmp));
+
+        if (result != EGL_FALSE)
+            m_settings.antialiasingLevel = static_cast<unsigned int>(tmp);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::requestPresentFeedback()
+{
+    wp_presentation* presentation = m_display->getGlobals().presentation;
+    if (!presentation || !m_owner->getSurface())
+        return;
+
+    static const wp_presentation_feedback_listener listener{[](void*, struct wp_presentation_feedback*, wl_output*) {},
+                                                            &WaylandContext::handlePresented,
+                                                            &WaylandContext::handleDiscarded};
+
+    const std::lock_guard lock(m_presentMutex);
+
+    if (m_feedbacks.size() >= WaylandContextImpl::maxPendingFeedbacks)
+        return;
+
+    // The feedback applies to the next commit of the surface, done by eglSwapBuffers
+    struct wp_presentation_feedback* feedback = wp_presentation_feedback(presentation, m_owner->getSurface());
+    wp_presentation_feedback_add_listener(feedback, &listener, this);
+    m_feedbacks.push_back(feedback);
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::handlePresented(void*                            data,
+                                     struct wp_presentation_feedback* feedback,
+                                     std::uint32_t                    secondsHigh,
+                                     std::uint32_t                    secondsLow,
+                                     std::uint32_t                    nanoseconds,
+                                     std::uint32_t                    refresh,
+                                     std::uint32_t                    sequenceHigh,
+                                     std::uint32_t                    sequenceLow,
+                                     std::uint32_t /* flags */)
+{
+    auto&                 context = *static_cast<WaylandContext*>(data);
+    const std::lock_guard lock(context.m_presentMutex);
+
+    const std::uint64_t seconds = (std::uint64_t{secondsHigh} << 32) | secondsLow;
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank  = microseconds(static_cast<std::int64_t>(seconds * 1'000'000 + nanoseconds / 1'000));
+    timing.verticalBlankCount = (std::uint64_t{sequenceHigh} << 32) | sequenceLow;
+    timing.swapCount          = context.m_presentTiming ? context.m_presentTiming->swapCount + 1 : 1;
+    timing.refreshRate        = (refresh > 0) ? 1'000'000'000.f / static_cast<float>(refresh) : 0.f;
+
+    context.m_presentTiming = timing;
+    context.releaseFeedback(feedback);
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::handleDiscarded(void* data, struct wp_presentation_feedback* feedback)
+{
+    auto&                 context = *static_cast<WaylandContext*>(data);
+    const std::lock_guard lock(context.m_presentMutex);
+
+    context.releaseFeedback(feedback);
+}
+
+
+////////////////////////////////////////////////////////////
+void WaylandContext::releaseFeedback(struct wp_presentation_feedback* feedback)
+{
+    m_feedbacks.erase(std::remove(m_feedbacks.begin(), m_feedbacks.end(), feedback), m_feedbacks.end());
+    wp_presentation_feedback_destroy(feedback);
+}
+
+} // namespace sf::priv
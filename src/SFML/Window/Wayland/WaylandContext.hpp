@@ -0,0 +1,278 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/ContextSettings.hpp>
+#include <SFML/Window/EGLCheck.hpp>
+#include <SFML/Window/GlContext.hpp>
+#include <SFML/Window/Window.hpp>
+
+#include <glad/egl.h>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <cstdint>
+
+
+struct wp_presentation_feedback;
+
+
+namespace sf::priv
+{
+class WaylandDisplay;
+class WindowImplWayland;
+
+////////////////////////////////////////////////////////////
+/// \brief Linux (Wayland) implementation of OpenGL contexts
+///
+/// Contexts are created with EGL on the Wayland platform;
+/// window contexts render to the EGL window of their owner.
+///
+////////////////////////////////////////////////////////////
+class WaylandContext : public GlContext
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context, not associated to a window
+    ///
+    /// \param shared Context to share the new one with (can be a null pointer)
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandContext(WaylandContext* shared);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context attached to a window
+    ///
+    /// \param shared       Context to share the new one with
+    /// \param settings     Creation parameters
+    /// \param owner        Pointer to the owner window
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandContext(WaylandContext*        shared,
+                   const ContextSettings& settings,
+                   const WindowImpl&      owner,
+                   unsigned int           bitsPerPixel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context that embeds its own rendering target
+    ///
+    /// \param shared   Context to share the new one with
+    /// \param settings Creation parameters
+    /// \param size     Back buffer width and height, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandContext(WaylandContext* shared, const ContextSettings& settings, const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~WaylandContext() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandContext(const WaylandContext&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    WaylandContext& operator=(const WaylandContext&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of an OpenGL function
+    ///
+    /// \param name Name of the function to get the address of
+    ///
+    /// \return Address of the OpenGL function, 0 on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    static GlFunctionPointer getFunction(const char* name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the context as the current target
+    ///        for rendering
+    ///
+    /// \param current Whether to make the context current or no longer current
+    ///
+    /// \return True on success, false if any error happened
+    ///
+    ////////////////////////////////////////////////////////////
+    bool makeCurrent(bool current) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Display what has been rendered to the context so far
+    ///
+    ////////////////////////////////////////////////////////////
+    void display() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Display the damaged regions of what has been rendered so far
+    ///
+    /// This requires EGL_KHR_swap_buffers_with_damage or
+    /// EGL_EXT_swap_buffers_with_damage, otherwise the whole
+    /// surface is displayed.
+    ///
+    /// \param damage Damaged rectangles as consecutive x, y, width and height,
+    ///               with the origin at the bottom-left corner of the surface
+    ///
+    ////////////////////////////////////////////////////////////
+    void displayDamage(const std::vector<int>& damage) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the age of the back buffer
+    ///
+    /// This requires EGL_EXT_buffer_age.
+    ///
+    /// \return Number of frames since the back buffer was displayed, 0 if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBufferAge() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable vertical synchronization
+    ///
+    /// Activating vertical synchronization will limit the number
+    /// of frames displayed to the refresh rate of the monitor.
+    /// This can avoid some visual artifacts, and limit the framerate
+    /// to a good value (but not constant across different computers).
+    ///
+    /// \param enabled True to enable v-sync, false to deactivate
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVerticalSyncEnabled(bool enabled) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for before swapping buffers
+    ///
+    /// \param interval Number of vertical blanks (negative values are not supported by EGL)
+    ///
+    /// \return True if the interval was applied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the last frame presented by the compositor
+    ///
+    /// \return Present timing, or std::nullopt if the compositor doesn't report it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the best EGL config for a given set of settings
+    ///
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    /// \param settings     Requested context settings
+    ///
+    /// \return The best EGL config
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] EGLConfig getBestConfig(unsigned int bitsPerPixel, const ContextSettings& settings) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the context
+    ///
+    /// \param shared Context to share the new one with (can be a null pointer)
+    ///
+    ////////////////////////////////////////////////////////////
+    void createContext(WaylandContext* shared);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the window surface of the context
+    ///
+    ////////////////////////////////////////////////////////////
+    void createWindowSurface();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the attributes of the picked EGL config to the settings
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateSettings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ask the compositor when the next frame is presented
+    ///
+    ////////////////////////////////////////////////////////////
+    void requestPresentFeedback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the presentation of a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePresented(void*                     data,
+                                wp_presentation_feedback* feedback,
+                                std::uint32_t             secondsHigh,
+                                std::uint32_t             secondsLow,
+                                std::uint32_t             nanoseconds,
+                                std::uint32_t             refresh,
+                                std::uint32_t             sequenceHigh,
+                                std::uint32_t             sequenceLow,
+                                std::uint32_t             flags);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a frame which was never presented
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleDiscarded(void* data, wp_presentation_feedback* feedback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget a feedback which sent its last event
+    ///
+    /// \param feedback Feedback to destroy
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseFeedback(wp_presentation_feedback* feedback);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<WaylandDisplay>        m_display;                    ///< Display kept open by the context
+    const WindowImplWayland*               m_owner{};                    ///< Window rendered to (null if offscreen)
+    EGLDisplay                             m_eglDisplay{EGL_NO_DISPLAY}; ///< The internal EGL display
+    EGLContext                             m_context{EGL_NO_CONTEXT};    ///< The internal EGL context
+    EGLSurface                             m_surface{EGL_NO_SURFACE};    ///< The internal EGL surface
+    EGLConfig                              m_config{};                   ///< The internal EGL config
+    bool                                   m_surfaceless{};              ///< Made current without a surface?
+    int                                    m_swapInterval{1};            ///< Swap interval requested by the user
+    int                                    m_appliedInterval{1};         ///< Swap interval applied to the surface
+    std::mutex                             m_presentMutex;               ///< Protects the present timing
+    std::vector<wp_presentation_feedback*> m_feedbacks;                  ///< Frames not presented yet
+    std::optional<Window::PresentTiming>   m_presentTiming;              ///< Timing of the last presented frame
+};
+
+} // namespace sf::priv
@@ -0,0 +1,680 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Wayland/Display.hpp>
+#include <SFML/Window/Wayland/Seat.hpp>
+#include <SFML/Window/Wayland/WindowImplWayland.hpp>
+#include <SFML/Window/WindowEnums.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/String.hpp>
+
+#include <fractional-scale-v1-client-protocol.h>
+#include <pointer-constraints-unstable-v1-client-protocol.h>
+#include <viewporter-client-protocol.h>
+#include <wayland-client.h>
+#include <wayland-egl.h>
+#include <xdg-decoration-unstable-v1-client-protocol.h>
+#include <xdg-shell-client-protocol.h>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cmath>
+#include <ctime>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace WindowImplWaylandImpl
+{
+// Identifies the surfaces of the SFML windows among those created by other libraries
+const char* const surfaceTag = "sfml-window";
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t getMonotonicMilliseconds()
+{
+    // Compositors timestamp their events in milliseconds of the monotonic clock
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::uint32_t>(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int32_t toInt(unsigned int value)
+{
+    return static_cast<std::int32_t>(std::min(value, 0x7fffffffu));
+}
+} // namespace WindowImplWaylandImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+WindowImplWayland::WindowImplWayland(WindowHandle /* handle */) : m_display(openDisplay())
+{
+    err() << "Creating a window from an existing Wayland surface is not supported" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+WindowImplWayland::WindowImplWayland(VideoMode              mode,
+                                     const String&          title,
+                                     std::uint32_t          style,
+                                     State                  state,
+                                     const ContextSettings& /* settings */) :
+m_display(openDisplay()),
+m_size(mode.size),
+m_pixelSize(mode.size),
+m_resizable((style & Style::Resize) != 0),
+m_cursorGrabbed(state == State::Fullscreen)
+{
+    const WaylandGlobals& globals = m_display->getGlobals();
+
+    // Create the surface and give it the role of a desktop window
+    m_surface = wl_compositor_create_surface(globals.compositor);
+    wl_surface_set_user_data(m_surface, this);
+    wl_proxy_set_tag(reinterpret_cast<wl_proxy*>(m_surface), &WindowImplWaylandImpl::surfaceTag);
+
+    // wl_surface is bound at version 4, the later preferred scale events are never sent
+    static const wl_surface_listener surfaceListener = []
+    {
+        wl_surface_listener listener{};
+        listener.enter = handleSurfaceEnter;
+        listener.leave = handleSurfaceLeave;
+        return listener;
+    }();
+    wl_surface_add_listener(m_surface, &surfaceListener, this);
+
+    static const xdg_surface_listener xdgSurfaceListener{handleSurfaceConfigure};
+    m_xdgSurface = xdg_wm_base_get_xdg_surface(globals.wmBase, m_surface);
+    xdg_surface_add_listener(m_xdgSurface, &xdgSurfaceListener, this);
+
+    static const xdg_toplevel_listener toplevelListener = []
+    {
+        // Events added by newer versions of the protocol are never sent to the version we bind
+        xdg_toplevel_listener listener{};
+        listener.configure = handleToplevelConfigure;
+        listener.close     = handleToplevelClose;
+        return listener;
+    }();
+    m_toplevel = xdg_surface_get_toplevel(m_xdgSurface);
+    xdg_toplevel_add_listener(m_toplevel, &toplevelListener, this);
+
+    // Render at the resolution of the output when the compositor tells us its exact scale
+    if (globals.fractionalScaleManager && globals.viewporter)
+    {
+        static const wp_fractional_scale_v1_listener fractionalScaleListener{handlePreferredScale};
+        m_viewport        = wp_viewporter_get_viewport(globals.viewporter, m_surface);
+        m_fractionalScale = wp_fractional_scale_manager_v1_get_fractional_scale(globals.fractionalScaleManager,
+                                                                                m_surface);
+        wp_fractional_scale_v1_add_listener(m_fractionalScale, &fractionalScaleListener, this);
+    }
+
+    // Ask for decorations drawn by the compositor; since SFML draws none itself, windows without
+    // decorations are declared as decorated by the client. Without the decoration protocol
+    // (GNOME) windows are never decorated.
+    if (globals.decorationManager)
+    {
+        m_decoration = zxdg_decoration_manager_v1_get_toplevel_decoration(globals.decorationManager, m_toplevel);
+        zxdg_toplevel_decoration_v1_set_mode(m_decoration,
+                                             (style == Style::None) ? ZXDG_TOPLEVEL_DECORATION_V1_MODE_CLIENT_SIDE
+                                                                    : ZXDG_TOPLEVEL_DECORATION_V1_MODE_SERVER_SIDE);
+    }
+
+    setTitle(title);
+    updateSizeLimits();
+
+    if (state == State::Fullscreen)
+        xdg_toplevel_set_fullscreen(m_toplevel, nullptr);
+
+    using WindowImplWaylandImpl::toInt;
+    m_eglWindow = wl_egl_window_create(m_surface, toInt(m_size.x), toInt(m_size.y));
+
+    // The surface can't be drawn to before the compositor configures it
+    wl_surface_commit(m_surface);
+    waitForConfigure();
+
+    updatePointerConstraint();
+}
+
+
+////////////////////////////////////////////////////////////
+WindowImplWayland::~WindowImplWayland()
+{
+    if (Seat* seat = m_display->getSeat())
+        seat->forgetWindow(*this);
+
+    if (m_lockedPointer)
+        zwp_locked_pointer_v1_destroy(m_lockedPointer);
+
+    if (m_confinedPointer)
+        zwp_confined_pointer_v1_destroy(m_confinedPointer);
+
+    if (m_eglWindow)
+        wl_egl_window_destroy(m_eglWindow);
+
+    if (m_fractionalScale)
+        wp_fractional_scale_v1_destroy(m_fractionalScale);
+
+    if (m_viewport)
+        wp_viewport_destroy(m_viewport);
+
+    if (m_decoration)
+        zxdg_toplevel_decoration_v1_destroy(m_decoration);
+
+    if (m_toplevel)
+        xdg_toplevel_destroy(m_toplevel);
+
+    if (m_xdgSurface)
+        xdg_surface_destroy(m_xdgSurface);
+
+    if (m_surface)
+        wl_surface_destroy(m_surface);
+
+    wl_display_flush(m_display->getDisplay());
+}
+
+
+////////////////////////////////////////////////////////////
+WindowHandle WindowImplWayland::getNativeHandle() const
+{
+    return reinterpret_cast<WindowHandle>(m_surface);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::processEvents()
+{
+    m_display->dispatch();
+
+    if (Seat* seat = m_display->getSeat())
+        seat->processKeyRepeat();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i WindowImplWayland::getPosition() const
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setPosition(const Vector2i& /* position */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u WindowImplWayland::getSize() const
+{
+    return m_pixelSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setSize(const Vector2u& size)
+{
+    if (!m_surface)
+        return;
+
+    applySize(toLogical(size), m_scale);
+    updateSizeLimits();
+    wl_surface_commit(m_surface);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setMinimumSize(const std::optional<Vector2u>& minimumSize)
+{
+    m_minimumSize = minimumSize;
+
+    if (m_surface)
+    {
+        updateSizeLimits();
+        wl_surface_commit(m_surface);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setMaximumSize(const std::optional<Vector2u>& maximumSize)
+{
+    m_maximumSize = maximumSize;
+
+    if (m_surface)
+    {
+        updateSizeLimits();
+        wl_surface_commit(m_surface);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setTitle(const String& title)
+{
+    if (m_toplevel)
+        xdg_toplevel_set_title(m_toplevel, reinterpret_cast<const char*>(title.toUtf8().c_str()));
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setIcon(const Vector2u& /* size */, const std::uint8_t* /* pixels */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setVisible(bool visible)
+{
+    if (!m_surface || (visible == m_visible))
+        return;
+
+    m_visible = visible;
+
+    if (visible)
+    {
+        // Committing without buffer maps the surface again, after a new configure
+        wl_surface_commit(m_surface);
+        waitForConfigure();
+    }
+    else
+    {
+        // Attaching a null buffer unmaps the surface
+        wl_surface_attach(m_surface, nullptr, 0, 0);
+        wl_surface_commit(m_surface);
+        m_configured = false;
+        m_display->roundtrip();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setMouseCursorVisible(bool visible)
+{
+    m_cursorVisible = visible;
+    updatePointerConstraint();
+
+    if (Seat* seat = m_display->getSeat())
+        seat->updateCursor(*this);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setMouseCursorGrabbed(bool grabbed)
+{
+    m_cursorGrabbed = grabbed;
+    updatePointerConstraint();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setMouseCursor(const CursorImpl& cursor)
+{
+    m_cursor = &cursor;
+
+    if (Seat* seat = m_display->getSeat())
+        seat->updateCursor(*this);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::setKeyRepeatEnabled(bool enabled)
+{
+    m_keyRepeat = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::requestFocus()
+{
+    // Activating a window requires a token from the xdg-activation protocol, which only the
+    // application which currently has the focus can obtain
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImplWayland::hasFocus() const
+{
+    return m_hasFocus;
+}
+
+
+////////////////////////////////////////////////////////////
+WindowImplWayland* WindowImplWayland::fromSurface(wl_surface* surface)
+{
+    auto* proxy = reinterpret_cast<wl_proxy*>(surface);
+    if (!proxy || (wl_proxy_get_tag(proxy) != &WindowImplWaylandImpl::surfaceTag))
+        return nullptr;
+
+    return static_cast<WindowImplWayland*>(wl_surface_get_user_data(surface));
+}
+
+
+////////////////////////////////////////////////////////////
+const std::shared_ptr<WaylandDisplay>& WindowImplWayland::getDisplay() const
+{
+    return m_display;
+}
+
+
+////////////////////////////////////////////////////////////
+wl_surface* WindowImplWayland::getSurface() const
+{
+    return m_surface;
+}
+
+
+////////////////////////////////////////////////////////////
+wl_egl_window* WindowImplWayland::getEglWindow() const
+{
+    return m_eglWindow;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImplWayland::isMapped() const
+{
+    return m_visible && m_configured;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i WindowImplWayland::toPixels(double x, double y) const
+{
+    return {static_cast<int>(std::lround(x * static_cast<double>(m_scale))),
+            static_cast<int>(std::lround(y * static_cast<double>(m_scale)))};
+}
+
+
+////////////////////////////////////////////////////////////
+std::int32_t WindowImplWayland::getCursorScale() const
+{
+    return static_cast<std::int32_t>(std::ceil(m_scale));
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImplWayland::isKeyRepeatEnabled() const
+{
+    return m_keyRepeat;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImplWayland::isMouseCursorVisible() const
+{
+    return m_cursorVisible;
+}
+
+
+////////////////////////////////////////////////////////////
+const CursorImpl* WindowImplWayland::getMouseCursor() const
+{
+    return m_cursor;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i WindowImplWayland::getMousePosition() const
+{
+    return m_mousePosition;
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::pushSeatEvent(const Event& event, std::optional<std::uint32_t> time)
+{
+    if (event.is<Event::FocusGained>())
+        m_hasFocus = true;
+    else if (event.is<Event::FocusLost>())
+        m_hasFocus = false;
+    else if (const auto* mouseMoved = event.getIf<Event::MouseMoved>())
+        m_mousePosition = mouseMoved->position;
+
+    if (time)
+        setSystemEventTimestamp(convertSystemTime(*time, WindowImplWaylandImpl::getMonotonicMilliseconds()));
+
+    pushEvent(event);
+    setSystemEventTimestamp(std::nullopt);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::pushSeatRawMovement(Vector2i delta, std::uint32_t time)
+{
+    setSystemEventTimestamp(convertSystemTime(time, WindowImplWaylandImpl::getMonotonicMilliseconds()));
+    pushRawMouseMovement(delta);
+    setSystemEventTimestamp(std::nullopt);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::handleSurfaceConfigure(void* data, xdg_surface* surface, std::uint32_t serial)
+{
+    auto& window = *static_cast<WindowImplWayland*>(data);
+
+    xdg_surface_ack_configure(surface, serial);
+    window.m_configured = true;
+
+    // A null size lets us choose the size of the window
+    const Vector2u size(window.m_pendingSize.x ? window.m_pendingSize.x : window.m_size.x,
+                        window.m_pendingSize.y ? window.m_pendingSize.y : window.m_size.y);
+    window.applySize(size, window.m_scale);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::handleToplevelConfigure(void* data,
+                                                xdg_toplevel* /* toplevel */,
+                                                std::int32_t width,
+                                                std::int32_t height,
+                                                wl_array* /* states */)
+{
+    // The size is applied by the surface configure event which ends the sequence
+    static_cast<WindowImplWayland*>(data)->m_pendingSize = Vector2u(Vector2(std::max(width, 0), std::max(height, 0)));
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::handleToplevelClose(void* data, xdg_toplevel* /* toplevel */)
+{
+    static_cast<WindowImplWayland*>(data)->pushEvent(Event::Closed{});
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::handleSurfaceEnter(void* data, wl_surface* /* surface */, wl_output* output)
+{
+    auto& window = *static_cast<WindowImplWayland*>(data);
+    window.m_outputs.push_back(output);
+    window.updateOutputScale();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::handleSurfaceLeave(void* data, wl_surface* /* surface */, wl_output* output)
+{
+    auto& window  = *static_cast<WindowImplWayland*>(data);
+    auto& outputs = window.m_outputs;
+    outputs.erase(std::remove(outputs.begin(), outputs.end(), output), outputs.end());
+    window.updateOutputScale();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::handlePreferredScale(void*                   data,
+                                             wp_fractional_scale_v1* /* fractionalScale */,
+                                             std::uint32_t           scale)
+{
+    // The scale is sent as a fraction with a denominator of 120
+    auto& window = *static_cast<WindowImplWayland*>(data);
+    window.applySize(window.m_size, static_cast<float>(scale) / 120.f);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::updateOutputScale()
+{
+    if (m_fractionalScale)
+        return;
+
+    std::int32_t scale = 1;
+    for (const wl_output* output : m_outputs)
+    {
+        if (const WaylandOutput* description = m_display->findOutput(output))
+            scale = std::max(scale, description->scale);
+    }
+
+    if (static_cast<float>(scale) != m_scale)
+        applySize(m_size, static_cast<float>(scale));
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::applySize(Vector2u size, float scale)
+{
+    using WindowImplWaylandImpl::toInt;
+
+    m_size  = Vector2u(std::max(size.x, 1u), std::max(size.y, 1u));
+    m_scale = scale;
+
+    const Vector2u pixelSize(static_cast<unsigned int>(std::lround(static_cast<float>(m_size.x) * m_scale)),
+                             static_cast<unsigned int>(std::lround(static_cast<float>(m_size.y) * m_scale)));
+
+    // Both are double-buffered state, applied with the next frame at the new size
+    if (m_viewport)
+        wp_viewport_set_destination(m_viewport, toInt(m_size.x), toInt(m_size.y));
+    else
+        wl_surface_set_buffer_scale(m_surface, static_cast<std::int32_t>(m_scale));
+
+    wl_egl_window_resize(m_eglWindow, toInt(pixelSize.x), toInt(pixelSize.y), 0, 0);
+
+    if (pixelSize != m_pixelSize)
+    {
+        m_pixelSize = pixelSize;
+        pushEvent(Event::Resized{m_pixelSize});
+    }
+
+    if (!m_resizable)
+        updateSizeLimits();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::updateSizeLimits()
+{
+    using WindowImplWaylandImpl::toInt;
+
+    Vector2u minimumSize;
+    Vector2u maximumSize;
+
+    if (!m_resizable)
+    {
+        minimumSize = m_size;
+        maximumSize = m_size;
+    }
+    else
+    {
+        // A null size means no limit
+        if (m_minimumSize)
+            minimumSize = toLogical(*m_minimumSize);
+
+        if (m_maximumSize)
+            maximumSize = toLogical(*m_maximumSize);
+    }
+
+    xdg_toplevel_set_min_size(m_toplevel, toInt(minimumSize.x), toInt(minimumSize.y));
+    xdg_toplevel_set_max_size(m_toplevel, toInt(maximumSize.x), toInt(maximumSize.y));
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::updatePointerConstraint()
+{
+    if (m_lockedPointer)
+    {
+        zwp_locked_pointer_v1_destroy(m_lockedPointer);
+        m_lockedPointer = nullptr;
+    }
+
+    if (m_confinedPointer)
+    {
+        zwp_confined_pointer_v1_destroy(m_confinedPointer);
+        m_confinedPointer = nullptr;
+    }
+
+    const Seat*                 seat        = m_display->getSeat();
+    zwp_pointer_constraints_v1* constraints = m_display->getGlobals().pointerConstraints;
+    if (!m_cursorGrabbed || !m_surface || !seat || !seat->getPointer() || !constraints)
+        return;
+
+    // A hidden cursor is locked in place, so that the relative motion events can be used
+    // without limit; a visible one is only kept inside the window. The constraints are
+    // persistent: they are activated again each time the pointer enters the window.
+    if (!m_cursorVisible)
+    {
+        m_lockedPointer = zwp_pointer_constraints_v1_lock_pointer(constraints,
+                                                                  m_surface,
+                                                                  seat->getPointer(),
+                                                                  nullptr,
+                                                                  ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+    }
+    else
+    {
+        m_confinedPointer = zwp_pointer_constraints_v1_confine_pointer(constraints,
+                                                                       m_surface,
+                                                                       seat->getPointer(),
+                                                                       nullptr,
+                                                                       ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+    }
+
+    wl_surface_commit(m_surface);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplWayland::waitForConfigure()
+{
+    while (!m_configured)
+        m_display->roundtrip();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u WindowImplWayland::toLogical(Vector2u size) const
+{
+    return {static_cast<unsigned int>(std::lround(static_cast<float>(size.x) / m_scale)),
+            static_cast<unsigned int>(std::lround(static_cast<float>(size.y) / m_scale))};
+}
+
+} // namespace sf::priv
@@ -0,0 +1,489 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/WindowImpl.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstdint>
+
+
+struct wl_array;
+struct wl_egl_window;
+struct wl_output;
+struct wl_surface;
+struct wp_fractional_scale_v1;
+struct wp_viewport;
+struct xdg_surface;
+struct xdg_toplevel;
+struct zwp_confined_pointer_v1;
+struct zwp_locked_pointer_v1;
+struct zxdg_toplevel_decoration_v1;
+
+
+namespace sf::priv
+{
+class CursorImpl;
+class WaylandDisplay;
+
+////////////////////////////////////////////////////////////
+/// \brief Linux (Wayland) implementation of WindowImpl
+///
+/// The size of a Wayland surface is given in logical units,
+/// which the compositor scales to the resolution of the
+/// outputs. The window renders at the resolution of the
+/// output instead, so all the sizes and positions seen by
+/// SFML (video mode excepted) are in pixels of the buffer.
+///
+////////////////////////////////////////////////////////////
+class WindowImplWayland : public WindowImpl
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the window implementation from an existing control
+    ///
+    /// Wayland has no way to retrieve the role and state of a
+    /// surface created by another library, so this is not
+    /// supported; the resulting window is inert.
+    ///
+    /// \param handle Platform-specific handle of the control
+    ///
+    ////////////////////////////////////////////////////////////
+    WindowImplWayland(WindowHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the window implementation
+    ///
+    /// \param mode  Video mode to use, its size is in logical units
+    /// \param title Title of the window
+    /// \param style Window style
+    /// \param state Window state
+    /// \param settings Additional settings for the underlying OpenGL context
+    ///
+    ////////////////////////////////////////////////////////////
+    WindowImplWayland(VideoMode              mode,
+                      const String&          title,
+                      std::uint32_t          style,
+                      State                  state,
+                      const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~WindowImplWayland() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OS-specific handle of the window
+    ///
+    /// \return Handle of the window (its wl_surface)
+    ///
+    ////////////////////////////////////////////////////////////
+    WindowHandle getNativeHandle() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the window
+    ///
+    /// Wayland doesn't expose the position of the windows.
+    ///
+    /// \return Always (0, 0)
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2i getPosition() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the position of the window on screen
+    ///
+    /// Wayland doesn't let clients position their windows,
+    /// this function does nothing.
+    ///
+    /// \param position New position of the window, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(const Vector2i& position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the client size of the window
+    ///
+    /// \return Size of the window, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the size of the rendering region of the window
+    ///
+    /// \param size New size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSize(const Vector2u& size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the minimum window rendering region size
+    ///
+    /// Pass std::nullopt to unset the minimum size
+    ///
+    /// \param minimumSize New minimum size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMinimumSize(const std::optional<Vector2u>& minimumSize) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum window rendering region size
+    ///
+    /// Pass std::nullopt to unset the maximum size
+    ///
+    /// \param maximumSize New maximum size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaximumSize(const std::optional<Vector2u>& maximumSize) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the title of the window
+    ///
+    /// \param title New title
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTitle(const String& title) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the window's icon
+    ///
+    /// Wayland compositors take the icon from the desktop
+    /// entry of the application, this function does nothing.
+    ///
+    /// \param size   Icon's width and height, in pixels
+    /// \param pixels Pointer to the pixels in memory, format must be RGBA 32 bits
+    ///
+    ////////////////////////////////////////////////////////////
+    void setIcon(const Vector2u& size, const std::uint8_t* pixels) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Show or hide the window
+    ///
+    /// \param visible True to show, false to hide
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVisible(bool visible) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Show or hide the mouse cursor
+    ///
+    /// \param visible True to show, false to hide
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMouseCursorVisible(bool visible) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Grab or release the mouse cursor
+    ///
+    /// The pointer is confined to the window while the cursor
+    /// is visible, and locked in place while it is hidden.
+    ///
+    /// \param grabbed True to enable, false to disable
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMouseCursorGrabbed(bool grabbed) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the displayed cursor to a native system cursor
+    ///
+    /// \param cursor Native system cursor type to display
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMouseCursor(const CursorImpl& cursor) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic key-repeat
+    ///
+    /// \param enabled True to enable, false to disable
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeyRepeatEnabled(bool enabled) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Request the current window to be made the active
+    ///        foreground window
+    ///
+    /// Wayland compositors don't let clients steal the focus,
+    /// this function does nothing.
+    ///
+    ////////////////////////////////////////////////////////////
+    void requestFocus() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the window has the input focus
+    ///
+    /// \return True if window has focus, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool hasFocus() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the window which owns a surface
+    ///
+    /// \param surface Surface sent by the compositor (can be null)
+    ///
+    /// \return Window owning the surface, or null if the surface doesn't belong to a SFML window
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static WindowImplWayland* fromSurface(wl_surface* surface);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the display the window belongs to
+    ///
+    /// \return Shared display
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::shared_ptr<WaylandDisplay>& getDisplay() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the surface of the window
+    ///
+    /// \return Surface of the window, null if the window is inert
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] wl_surface* getSurface() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the EGL window which renders to the surface
+    ///
+    /// \return EGL window, null if the window is inert
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] wl_egl_window* getEglWindow() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the window is shown on screen
+    ///
+    /// Frames must not be waited for while the window is not
+    /// mapped, since the compositor doesn't draw it.
+    ///
+    /// \return True if the window is visible and configured
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMapped() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a position on the surface to pixels
+    ///
+    /// \param x Horizontal position, in logical units
+    /// \param y Vertical position, in logical units
+    ///
+    /// \return Position in pixels of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2i toPixels(double x, double y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the integer scale factor to apply to the cursor
+    ///
+    /// \return Scale factor of the window, rounded up
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int32_t getCursorScale() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic key-repeat is enabled
+    ///
+    /// \return True if key-repeat is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyRepeatEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the cursor is visible over the window
+    ///
+    /// \return True if the cursor is visible
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMouseCursorVisible() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cursor to show over the window
+    ///
+    /// \return Cursor of the window, null for the default cursor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const CursorImpl* getMouseCursor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the last known position of the pointer over the window
+    ///
+    /// \return Position of the pointer, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2i getMousePosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push an event received by the seat
+    ///
+    /// \param event Event to push
+    /// \param time  Time of the event in milliseconds, if the compositor provided it
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushSeatEvent(const Event& event, std::optional<std::uint32_t> time);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push a raw mouse movement received by the seat
+    ///
+    /// \param delta Raw movement of the mouse
+    /// \param time  Time of the movement, in milliseconds
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushSeatRawMovement(Vector2i delta, std::uint32_t time);
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Process incoming events from the operating system
+    ///
+    ////////////////////////////////////////////////////////////
+    void processEvents() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a surface configure event
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleSurfaceConfigure(void* data, xdg_surface* surface, std::uint32_t serial);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a toplevel configure event
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleToplevelConfigure(void*         data,
+                                        xdg_toplevel* toplevel,
+                                        std::int32_t  width,
+                                        std::int32_t  height,
+                                        wl_array*     states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a close request
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleToplevelClose(void* data, xdg_toplevel* toplevel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the surface entering an output
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleSurfaceEnter(void* data, wl_surface* surface, wl_output* output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle the surface leaving an output
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handleSurfaceLeave(void* data, wl_surface* surface, wl_output* output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle a change of the fractional scale preferred by the compositor
+    ///
+    ////////////////////////////////////////////////////////////
+    static void handlePreferredScale(void* data, wp_fractional_scale_v1* fractionalScale, std::uint32_t scale);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Use the largest scale of the outputs the surface is on
+    ///
+    /// Only used when the compositor doesn't support fractional scaling.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateOutputScale();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply a new logical size or scale to the buffer
+    ///
+    /// \param size  New size, in logical units
+    /// \param scale New scale factor
+    ///
+    ////////////////////////////////////////////////////////////
+    void applySize(Vector2u size, float scale);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the size limits to the compositor
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateSizeLimits();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create or destroy the pointer constraint matching the grab and cursor states
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePointerConstraint();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the compositor configures the surface
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForConfigure();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a size in pixels to logical units
+    ///
+    /// \param size Size in pixels of the buffer
+    ///
+    /// \return Size in logical units
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u toLogical(Vector2u size) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<WaylandDisplay> m_display;             ///< Connection to the compositor
+    wl_surface*                     m_surface{};           ///< Surface of the window
+    xdg_surface*                    m_xdgSurface{};        ///< Desktop role of the surface
+    xdg_toplevel*                   m_toplevel{};          ///< Toplevel window role of the surface
+    zxdg_toplevel_decoration_v1*    m_decoration{};        ///< Server-side decorations of the window
+    wp_viewport*                    m_viewport{};          ///< Scaling of the buffer to the logical size
+    wp_fractional_scale_v1*         m_fractionalScale{};   ///< Notifications of the preferred scale
+    wl_egl_window*                  m_eglWindow{};         ///< EGL window rendering to the surface
+    zwp_locked_pointer_v1*          m_lockedPointer{};     ///< Lock of the pointer, while grabbed and hidden
+    zwp_confined_pointer_v1*        m_confinedPointer{};   ///< Confinement of the pointer, while grabbed and visible
+    std::vector<const wl_output*>   m_outputs;             ///< Outputs the surface is on
+    Vector2u                        m_size;                ///< Current size, in logical units
+    Vector2u                        m_pendingSize;         ///< Size requested by the last toplevel configure event
+    Vector2u                        m_pixelSize;           ///< Current size of the buffer, in pixels
+    float                           m_scale{1.f};          ///< Current scale from logical units to pixels
+    std::optional<Vector2u>         m_minimumSize;         ///< Minimum size, in pixels
+    std::optional<Vector2u>         m_maximumSize;         ///< Maximum size, in pixels
+    bool                            m_resizable{};         ///< Can the user resize the window?
+    bool                            m_configured{};        ///< Has the compositor configured the surface?
+    bool                            m_visible{true};       ///< Is the window shown?
+    bool                            m_hasFocus{};          ///< Does the window have the keyboard focus?
+    bool                            m_keyRepeat{true};     ///< Is the KeyRepeat feature enabled?
+    bool                            m_cursorVisible{true}; ///< Is the mouse cursor visible?
+    bool                            m_cursorGrabbed{};     ///< Is the mouse cursor trapped?
+    const CursorImpl*               m_cursor{};            ///< Cursor shown over the window, null for the default one
+    Vector2i                        m_mousePosition;       ///< Last position of the pointer over the window
+};
+
+} // namespace sf::priv
@@ -0,0 +1,507 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/ContextSettings.hpp>
+#include <SFML/Window/Win32/DxgiPresenter.hpp>
+#include <SFML/Window/Win32/WglContext.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <d3d11.h>
+#include <dxgi1_5.h>
+#include <ostream>
+
+
+namespace
+{
+namespace DxgiPresenterImpl
+{
+////////////////////////////////////////////////////////////
+// OpenGL and WGL_NV_DX_interop entry points used by the presenter,
+// which are not part of the generated WGL loader
+////////////////////////////////////////////////////////////
+struct Functions
+{
+    using DXOpenDeviceNV       = HANDLE(WINAPI*)(void*);
+    using DXCloseDeviceNV      = BOOL(WINAPI*)(HANDLE);
+    using DXRegisterObjectNV   = HANDLE(WINAPI*)(HANDLE, void*, GLuint, GLenum, GLenum);
+    using DXUnregisterObjectNV = BOOL(WINAPI*)(HANDLE, HANDLE);
+    using DXLockObjectsNV      = BOOL(WINAPI*)(HANDLE, GLint, HANDLE*);
+
+    DXOpenDeviceNV                   dxOpenDevice{};
+    DXCloseDeviceNV                  dxCloseDevice{};
+    DXRegisterObjectNV               dxRegisterObject{};
+    DXUnregisterObjectNV             dxUnregisterObject{};
+    DXLockObjectsNV                  dxLockObjects{};
+    DXLockObjectsNV                  dxUnlockObjects{};
+    PFNGLGENFRAMEBUFFERSPROC         genFramebuffers{};
+    PFNGLDELETEFRAMEBUFFERSPROC      deleteFramebuffers{};
+    PFNGLBINDFRAMEBUFFERPROC         bindFramebuffer{};
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer{};
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC  checkFramebufferStatus{};
+    PFNGLGENRENDERBUFFERSPROC        genRenderbuffers{};
+    PFNGLDELETERENDERBUFFERSPROC     deleteRenderbuffers{};
+    PFNGLBINDRENDERBUFFERPROC        bindRenderbuffer{};
+    PFNGLRENDERBUFFERSTORAGEPROC     renderbufferStorage{};
+    PFNGLBLITFRAMEBUFFERPROC         blitFramebuffer{};
+    PFNGLGETINTEGERVPROC             getIntegerv{};
+    PFNGLISENABLEDPROC               isEnabled{};
+    PFNGLENABLEPROC                  enable{};
+    PFNGLDISABLEPROC                 disable{};
+
+    [[nodiscard]] bool isComplete() const
+    {
+        return dxOpenDevice && dxCloseDevice && dxRegisterObject && dxUnregisterObject && dxLockObjects &&
+               dxUnlockObjects && genFramebuffers && deleteFramebuffers && bindFramebuffer && framebufferRenderbuffer &&
+               checkFramebufferStatus && genRenderbuffers && deleteRenderbuffers && bindRenderbuffer &&
+               renderbufferStorage && blitFramebuffer && getIntegerv && isEnabled && enable && disable;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void load(T& function, const char* name)
+{
+    function = reinterpret_cast<T>(sf::priv::WglContext::getFunction(name));
+}
+
+
+////////////////////////////////////////////////////////////
+const Functions& getFunctions()
+{
+    static const Functions functions = []
+    {
+        Functions result;
+        load(result.dxOpenDevice, "wglDXOpenDeviceNV");
+        load(result.dxCloseDevice, "wglDXCloseDeviceNV");
+        load(result.dxRegisterObject, "wglDXRegisterObjectNV");
+        load(result.dxUnregisterObject, "wglDXUnregisterObjectNV");
+        load(result.dxLockObjects, "wglDXLockObjectsNV");
+        load(result.dxUnlockObjects, "wglDXUnlockObjectsNV");
+        load(result.genFramebuffers, "glGenFramebuffers");
+        load(result.deleteFramebuffers, "glDeleteFramebuffers");
+        load(result.bindFramebuffer, "glBindFramebuffer");
+        load(result.framebufferRenderbuffer, "glFramebufferRenderbuffer");
+        load(result.checkFramebufferStatus, "glCheckFramebufferStatus");
+        load(result.genRenderbuffers, "glGenRenderbuffers");
+        load(result.deleteRenderbuffers, "glDeleteRenderbuffers");
+        load(result.bindRenderbuffer, "glBindRenderbuffer");
+        load(result.renderbufferStorage, "glRenderbufferStorage");
+        load(result.blitFramebuffer, "glBlitFramebuffer");
+        load(result.getIntegerv, "glGetIntegerv");
+        load(result.isEnabled, "glIsEnabled");
+        load(result.enable, "glEnable");
+        load(result.disable, "glDisable");
+        return result;
+    }();
+
+    return functions;
+}
+
+
+////////////////////////////////////////////////////////////
+GLuint getBinding(GLenum binding)
+{
+    GLint name = 0;
+    getFunctions().getIntegerv(binding, &name);
+    return static_cast<GLuint>(name);
+}
+
+
+////////////////////////////////////////////////////////////
+// Release a COM interface and reset the pointer to it
+////////////////////////////////////////////////////////////
+template <typename T>
+void release(T*& object)
+{
+    if (object)
+        object->Release();
+    object = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Vector2u getClientSize(HWND window)
+{
+    RECT rect{};
+    GetClientRect(window, &rect);
+
+    // The swap chain can't have empty buffers, a minimized window keeps its last size
+    return {static_cast<unsigned int>(std::max(rect.right - rect.left, LONG{0})),
+            static_cast<unsigned int>(std::max(rect.bottom - rect.top, LONG{0}))};
+}
+} // namespace DxgiPresenterImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::unique_ptr<DxgiPresenter> DxgiPresenter::create(HWND window, const ContextSettings& settings)
+{
+    // The frames are copied with a flipping blit, which can't resolve multisampled frames
+    if (settings.antialiasingLevel > 0)
+    {
+        err() << "Low-latency presentation doesn't support anti-aliasing, using the default presentation" << std::endl;
+        return nullptr;
+    }
+
+    if (!DxgiPresenterImpl::getFunctions().isComplete())
+    {
+        err() << "Low-latency presentation requires WGL_NV_DX_interop2 and frame buffer objects, using the default "
+                 "presentation"
+              << std::endl;
+        return nullptr;
+    }
+
+    std::unique_ptr<DxgiPresenter> presenter(new DxgiPresenter);
+    if (!presenter->initialize(window, settings))
+        return nullptr;
+
+    return presenter;
+}
+
+
+////////////////////////////////////////////////////////////
+DxgiPresenter::~DxgiPresenter()
+{
+    const DxgiPresenterImpl::Functions& gl = DxgiPresenterImpl::getFunctions();
+
+    if (m_interopBackBuffer)
+        gl.dxUnlockObjects(m_interopDevice, 1, &m_interopBackBuffer);
+    destroyBuffers();
+
+    const GLuint frameBuffers[]  = {m_frameBuffer, m_backFrameBuffer};
+    const GLuint renderBuffers[] = {m_colorBuffer, m_depthBuffer, m_backColorBuffer};
+    gl.deleteFramebuffers(2, frameBuffers);
+    gl.deleteRenderbuffers(3, renderBuffers);
+
+    if (m_interopDevice)
+        gl.dxCloseDevice(m_interopDevice);
+
+    DxgiPresenterImpl::release(m_swapChain);
+    DxgiPresenterImpl::release(m_device);
+
+    if (m_d3d11Library)
+        FreeLibrary(m_d3d11Library);
+}
+
+
+////////////////////////////////////////////////////////////
+void DxgiPresenter::present()
+{
+    const DxgiPresenterImpl::Functions& gl = DxgiPresenterImpl::getFunctions();
+
+    // Copy the frame to the back buffer, upside down since OpenGL stores the rows bottom-up; the blit
+    // is affected by the scissor test and the sRGB conversion, which must not apply
+    const GLuint    readFrameBuffer = DxgiPresenterImpl::getBinding(GL_READ_FRAMEBUFFER_BINDING);
+    const GLuint    drawFrameBuffer = DxgiPresenterImpl::getBinding(GL_DRAW_FRAMEBUFFER_BINDING);
+    const GLboolean scissorTest     = gl.isEnabled(GL_SCISSOR_TEST);
+    const GLboolean sRgbConversion  = gl.isEnabled(GL_FRAMEBUFFER_SRGB);
+    gl.disable(GL_SCISSOR_TEST);
+    gl.disable(GL_FRAMEBUFFER_SRGB);
+
+    const auto width  = static_cast<GLint>(m_size.x);
+    const auto height = static_cast<GLint>(m_size.y);
+    gl.bindFramebuffer(GL_READ_FRAMEBUFFER, m_frameBuffer);
+    gl.bindFramebuffer(GL_DRAW_FRAMEBUFFER, m_backFrameBuffer);
+    gl.blitFramebuffer(0, 0, width, height, 0, height, width, 0, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+    gl.bindFramebuffer(GL_READ_FRAMEBUFFER, readFrameBuffer);
+    gl.bindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFrameBuffer);
+    if (scissorTest)
+        gl.enable(GL_SCISSOR_TEST);
+    if (sRgbConversion)
+        gl.enable(GL_FRAMEBUFFER_SRGB);
+
+    // Unlocking the back buffer hands it over to Direct3D, once the OpenGL commands writing to it are done;
+    // it is locked again by createBuffers or below
+    gl.dxUnlockObjects(m_interopDevice, 1, &m_interopBackBuffer);
+
+    const UINT flags = ((m_swapInterval == 0) && m_allowTearing) ? DXGI_PRESENT_ALLOW_TEARING : 0;
+    if (FAILED(m_swapChain->Present(static_cast<UINT>(m_swapInterval), flags)))
+        err() << "Failed to present the frame through the DXGI swap chain" << std::endl;
+
+    // Follow the size of the window; the buffers can only be resized once they are no longer shared
+    const Vector2u size = DxgiPresenterImpl::getClientSize(m_window);
+    if ((size != m_size) && (size.x > 0) && (size.y > 0))
+    {
+        destroyBuffers();
+        m_size = size;
+        if (FAILED(m_swapChain->ResizeBuffers(0, m_size.x, m_size.y, DXGI_FORMAT_UNKNOWN, m_swapChainFlags)) ||
+            !createBuffers())
+            err() << "Failed to resize the buffers of the DXGI swap chain" << std::endl;
+    }
+    else
+    {
+        gl.dxLockObjects(m_interopDevice, 1, &m_interopBackBuffer);
+    }
+
+    // Don't let the application render a frame before the swap chain can take it, which would add latency
+    WaitForSingleObjectEx(m_waitableObject, 1000, TRUE);
+}
+
+
+////////////////////////////////////////////////////////////
+bool DxgiPresenter::setSwapInterval(int interval)
+{
+    // DXGI doesn't support adaptive synchronization
+    if ((interval < 0) || (interval > 4))
+        return false;
+
+    m_swapInterval = interval;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> DxgiPresenter::getPresentTiming() const
+{
+    DXGI_FRAME_STATISTICS statistics{};
+    if (FAILED(m_swapChain->GetFrameStatistics(&statistics)))
+        return std::nullopt;
+
+    LARGE_INTEGER frequency{};
+    QueryPerformanceFrequency(&frequency);
+
+    // Split the conversion to avoid overflowing after a few days of uptime
+    const LONGLONG counter = statistics.SyncQPCTime.QuadPart;
+    const LONGLONG seconds = counter / frequency.QuadPart;
+    const LONGLONG rest    = counter % frequency.QuadPart;
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank  = microseconds(seconds * 1'000'000 + rest * 1'000'000 / frequency.QuadPart);
+    timing.verticalBlankCount = statistics.SyncRefreshCount;
+    timing.swapCount          = statistics.PresentCount;
+
+    // The refresh rate is the one of the monitor containing most of the window
+    MONITORINFOEX monitorInfo;
+    monitorInfo.cbSize = sizeof(monitorInfo);
+    DEVMODE mode;
+    mode.dmSize        = sizeof(mode);
+    mode.dmDriverExtra = 0;
+    if (GetMonitorInfo(MonitorFromWindow(m_window, MONITOR_DEFAULTTONEAREST), &monitorInfo) &&
+        EnumDisplaySettings(monitorInfo.szDevice, ENUM_CURRENT_SETTINGS, &mode) && (mode.dmDisplayFrequency > 1))
+        timing.refreshRate = static_cast<float>(mode.dmDisplayFrequency);
+
+    return timing;
+}
+
+
+////////////////////////////////////////////////////////////
+bool DxgiPresenter::initialize(HWND window, const ContextSettings& settings)
+{
+    const DxgiPresenterImpl::Functions& gl = DxgiPresenterImpl::getFunctions();
+
+    m_window       = window;
+    m_sRgb         = settings.sRgbCapable;
+    m_depthStencil = (settings.depthBits > 0) || (settings.stencilBits > 0);
+    m_size         = DxgiPresenterImpl::getClientSize(window);
+    m_size         = {std::max(m_size.x, 1u), std::max(m_size.y, 1u)};
+
+    // Load Direct3D 11 at runtime, like the other optional system libraries
+    m_d3d11Library = LoadLibraryA("d3d11.dll");
+    if (!m_d3d11Library)
+    {
+        err() << "Failed to load d3d11.dll, using the default presentation" << std::endl;
+        return false;
+    }
+
+    auto createDevice = reinterpret_cast<PFN_D3D11_CREATE_DEVICE>(
+        reinterpret_cast<void*>(GetProcAddress(m_d3d11Library, "D3D11CreateDevice")));
+    if (!createDevice ||
+        FAILED(createDevice(
+            nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, 0, nullptr, 0, D3D11_SDK_VERSION, &m_device, nullptr, nullptr)))
+    {
+        err() << "Failed to create a Direct3D 11 device, using the default presentation" << std::endl;
+        return false;
+    }
+
+    // Get the factory of the adapter used by the device
+    IDXGIDevice*   dxgiDevice = nullptr;
+    IDXGIAdapter*  adapter    = nullptr;
+    IDXGIFactory2* factory    = nullptr;
+    if (SUCCEEDED(m_device->QueryInterface(__uuidof(IDXGIDevice), reinterpret_cast<void**>(&dxgiDevice))) &&
+        SUCCEEDED(dxgiDevice->GetAdapter(&adapter)))
+        adapter->GetParent(__uuidof(IDXGIFactory2), reinterpret_cast<void**>(&factory));
+    DxgiPresenterImpl::release(adapter);
+    DxgiPresenterImpl::release(dxgiDevice);
+
+    if (!factory)
+    {
+        err() << "Failed to get the DXGI 1.2 factory, using the default presentation" << std::endl;
+        return false;
+    }
+
+    // Tearing, which variable refresh rate needs, requires Windows 10 and a compatible driver
+    IDXGIFactory5* factory5 = nullptr;
+    if (SUCCEEDED(factory->QueryInterface(__uuidof(IDXGIFactory5), reinterpret_cast<void**>(&factory5))))
+    {
+        BOOL          allowTearing = FALSE;
+        const HRESULT support      = factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING,
+                                                              &allowTearing,
+                                                              sizeof(allowTearing));
+        m_allowTearing = SUCCEEDED(support) && (allowTearing != FALSE);
+        DxgiPresenterImpl::release(factory5);
+    }
+
+    m_swapChainFlags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    if (m_allowTearing)
+        m_swapChainFlags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+
+    // The rows of the frame are flipped by the copy, sRGB colors are stored as is in the UNORM buffers
+    DXGI_SWAP_CHAIN_DESC1 description{};
+    description.Width            = m_size.x;
+    description.Height           = m_size.y;
+    description.Format           = DXGI_FORMAT_R8G8B8A8_UNORM;
+    description.SampleDesc.Count = 1;
+    description.BufferUsage      = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    description.BufferCount      = 2;
+    description.SwapEffect       = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+    description.AlphaMode        = DXGI_ALPHA_MODE_IGNORE;
+    description.Flags            = m_swapChainFlags;
+
+    IDXGISwapChain1* swapChain = nullptr;
+    HRESULT result = factory->CreateSwapChainForHwnd(m_device, window, &description, nullptr, nullptr, &swapChain);
+    if (FAILED(result))
+    {
+        // FLIP_DISCARD requires Windows 10, FLIP_SEQUENTIAL is available since Windows 8
+        description.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+        result = factory->CreateSwapChainForHwnd(m_device, window, &description, nullptr, nullptr, &swapChain);
+    }
+
+    // SFML handles the fullscreen mode itself
+    if (SUCCEEDED(result))
+        factory->MakeWindowAssociation(window, DXGI_MWA_NO_ALT_ENTER);
+    DxgiPresenterImpl::release(factory);
+
+    if (SUCCEEDED(result))
+        result = swapChain->QueryInterface(__uuidof(IDXGISwapChain2), reinterpret_cast<void**>(&m_swapChain));
+    DxgiPresenterImpl::release(swapChain);
+
+    if (FAILED(result))
+    {
+        err() << "Failed to create the DXGI flip model swap chain, using the default presentation" << std::endl;
+        return false;
+    }
+
+    // Queue at most one frame, and know when the swap chain can take the next one
+    m_swapChain->SetMaximumFrameLatency(1);
+    m_waitableObject = m_swapChain->GetFrameLatencyWaitableObject();
+
+    m_interopDevice = gl.dxOpenDevice(m_device);
+    if (!m_interopDevice || !createBuffers())
+    {
+        err() << "Failed to share the DXGI swap chain with OpenGL, using the default presentation" << std::endl;
+        return false;
+    }
+
+    // The frames are rendered to the frame buffer object, bound in place of the default frame buffer
+    gl.bindFramebuffer(GL_FRAMEBUFFER, m_frameBuffer);
+
+    WaitForSingleObjectEx(m_waitableObject, 1000, TRUE);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool DxgiPresenter::createBuffers()
+{
+    const DxgiPresenterImpl::Functions& gl = DxgiPresenterImpl::getFunctions();
+
+    if (FAILED(m_swapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), reinterpret_cast<void**>(&m_backBuffer))))
+        return false;
+
+    // The names are kept when the buffers are resized, so the frame buffer objects stay bound
+    if (!m_frameBuffer)
+    {
+        gl.genFramebuffers(1, &m_frameBuffer);
+        gl.genFramebuffers(1, &m_backFrameBuffer);
+        gl.genRenderbuffers(1, &m_colorBuffer);
+        gl.genRenderbuffers(1, &m_backColorBuffer);
+        if (m_depthStencil)
+            gl.genRenderbuffers(1, &m_depthBuffer);
+    }
+
+    const GLuint readFrameBuffer = DxgiPresenterImpl::getBinding(GL_READ_FRAMEBUFFER_BINDING);
+    const GLuint drawFrameBuffer = DxgiPresenterImpl::getBinding(GL_DRAW_FRAMEBUFFER_BINDING);
+    const GLuint renderBuffer    = DxgiPresenterImpl::getBinding(GL_RENDERBUFFER_BINDING);
+
+    // Share the back buffer, its content is entirely overwritten by each frame
+    m_interopBackBuffer = gl.dxRegisterObject(m_interopDevice,
+                                              m_backBuffer,
+                                              m_backColorBuffer,
+                                              GL_RENDERBUFFER,
+                                              0x0002 /* WGL_ACCESS_WRITE_DISCARD_NV */);
+    if (!m_interopBackBuffer)
+        return false;
+
+    gl.bindFramebuffer(GL_FRAMEBUFFER, m_backFrameBuffer);
+    gl.framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_backColorBuffer);
+    bool complete = gl.checkFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    const auto width  = static_cast<GLsizei>(m_size.x);
+    const auto height = static_cast<GLsizei>(m_size.y);
+    gl.bindRenderbuffer(GL_RENDERBUFFER, m_colorBuffer);
+    gl.renderbufferStorage(GL_RENDERBUFFER, m_sRgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, width, height);
+    gl.bindFramebuffer(GL_FRAMEBUFFER, m_frameBuffer);
+    gl.framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorBuffer);
+    if (m_depthStencil)
+    {
+        gl.bindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+        gl.renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        gl.framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+    }
+    complete = complete && (gl.checkFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+
+    gl.bindFramebuffer(GL_READ_FRAMEBUFFER, readFrameBuffer);
+    gl.bindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFrameBuffer);
+    gl.bindRenderbuffer(GL_RENDERBUFFER, renderBuffer);
+
+    // OpenGL can only write to the back buffer while it is locked
+    return complete && gl.dxLockObjects(m_interopDevice, 1, &m_interopBackBuffer);
+}
+
+
+////////////////////////////////////////////////////////////
+void DxgiPresenter::destroyBuffers()
+{
+    const DxgiPresenterImpl::Functions& gl = DxgiPresenterImpl::getFunctions();
+
+    if (m_interopBackBuffer)
+    {
+        gl.dxUnregisterObject(m_interopDevice, m_interopBackBuffer);
+        m_interopBackBuffer = nullptr;
+    }
+
+    DxgiPresenterImpl::release(m_backBuffer);
+}
+
+} // namespace sf::priv
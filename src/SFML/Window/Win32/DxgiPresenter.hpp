@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Window.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <glad/wgl.h>
+
+#include <memory>
+#include <optional>
+
+struct ID3D11Device;
+struct ID3D11Texture2D;
+struct IDXGISwapChain2;
+
+
+namespace sf
+{
+struct ContextSettings;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Presentation of OpenGL frames through a DXGI flip model swap chain
+///
+/// The frames are rendered to a frame buffer object, then
+/// copied to the back buffer of the swap chain, shared with
+/// OpenGL through WGL_NV_DX_interop2. Compared to SwapBuffers,
+/// the flip model lets the compositor display windowed frames
+/// without copying them (independent flip), the swap chain can
+/// tear for variable refresh rate monitors, and its waitable
+/// object keeps at most one frame queued.
+///
+/// All the functions must be called with the OpenGL context
+/// of the window current.
+///
+////////////////////////////////////////////////////////////
+class DxgiPresenter
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a presenter for a window
+    ///
+    /// On success, the frame buffer object which receives the
+    /// frames is bound to the current context.
+    ///
+    /// \param window   Window to present the frames to
+    /// \param settings Settings of the OpenGL context
+    ///
+    /// \return Presenter, or a null pointer if the system doesn't support it
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::unique_ptr<DxgiPresenter> create(HWND window, const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~DxgiPresenter();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DxgiPresenter(const DxgiPresenter&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    DxgiPresenter& operator=(const DxgiPresenter&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Present the rendered frame
+    ///
+    /// The function returns when the swap chain is ready to
+    /// receive the next frame; the buffers are resized if the
+    /// window was.
+    ///
+    ////////////////////////////////////////////////////////////
+    void present();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when presenting
+    ///
+    /// An interval of 0 lets the frames tear, which variable
+    /// refresh rate monitors need, if the system allows it.
+    ///
+    /// \param interval Number of vertical blanks, from 0 to 4
+    ///
+    /// \return True if the interval was set, false if it is out of range
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if the statistics are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DxgiPresenter() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the Direct3D device, the swap chain and the buffers
+    ///
+    /// \param window   Window to present the frames to
+    /// \param settings Settings of the OpenGL context
+    ///
+    /// \return True on success
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool initialize(HWND window, const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Share the back buffer with OpenGL and create the frame buffer objects
+    ///
+    /// \return True on success
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool createBuffers();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the back buffer and the renderbuffers
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroyBuffers();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    HWND             m_window{};            //!< Window to present the frames to
+    HMODULE          m_d3d11Library{};      //!< d3d11.dll, loaded at runtime
+    ID3D11Device*    m_device{};            //!< Direct3D device owning the swap chain
+    IDXGISwapChain2* m_swapChain{};         //!< Flip model swap chain of the window
+    ID3D11Texture2D* m_backBuffer{};        //!< Back buffer of the swap chain
+    HANDLE           m_waitableObject{};    //!< Signaled when the swap chain can receive a frame
+    HANDLE           m_interopDevice{};     //!< Direct3D device opened by WGL_NV_DX_interop2
+    HANDLE           m_interopBackBuffer{}; //!< Back buffer registered with WGL_NV_DX_interop2
+    unsigned int     m_swapChainFlags{};    //!< Flags the swap chain was created with
+    bool             m_allowTearing{};      //!< Can the frames tear?
+    bool             m_sRgb{};              //!< Do the frames contain sRGB colors?
+    bool             m_depthStencil{};      //!< Do the frames have a depth and stencil buffer?
+    int              m_swapInterval{};      //!< Number of vertical blanks to wait for
+    Vector2u         m_size;                //!< Size of the buffers
+    GLuint           m_frameBuffer{};       //!< Frame buffer object receiving the frames
+    GLuint           m_colorBuffer{};       //!< Color renderbuffer of m_frameBuffer
+    GLuint           m_depthBuffer{};       //!< Depth and stencil renderbuffer of m_frameBuffer
+    GLuint           m_backFrameBuffer{};   //!< Frame buffer object of the back buffer
+    GLuint           m_backColorBuffer{};   //!< Renderbuffer sharing the back buffer
+};
+
+} // namespace priv
+
+} // namespace sf
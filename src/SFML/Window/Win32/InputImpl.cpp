@@ -691,6 +691,28 @@ bool isMouseButtonPressed(Mouse::Button button)
 }
 
 
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    // Querying keys one by one is cheap on this platform
+    for (unsigned int i = 0; i < Keyboard::KeyCount; ++i)
+        keys[i] = isKeyPressed(static_cast<Keyboard::Key>(i));
+
+    for (unsigned int i = 0; i < Keyboard::ScancodeCount; ++i)
+        scancodes[i] = isKeyPressed(static_cast<Keyboard::Scancode>(i));
+}
+
+
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* relativeTo)
+{
+    for (unsigned int i = 0; i < Mouse::ButtonCount; ++i)
+        buttons[i] = isMouseButtonPressed(static_cast<Mouse::Button>(i));
+
+    position = relativeTo ? getMousePosition(*relativeTo) : getMousePosition();
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i getMousePosition()
 {
@@ -40,8 +40,10 @@
 #include <string>
 #include <tchar.h>
 #include <vector>
+#include <xinput.h>
 
 #include <cmath>
+#include <cstring>
 
 
 ////////////////////////////////////////////////////////////
@@ -82,6 +84,7 @@ struct JoystickRecord
     GUID         guid{};
     unsigned int index{};
     bool         plugged{};
+    int          xinputUser{-1};
 };
 
 using JoystickList = std::vector<JoystickRecord>;
@@ -100,6 +103,74 @@ const DWORD directInputEventBufferSize = 32;
 } // namespace
 
 
+////////////////////////////////////////////////////////////
+// XInput
+////////////////////////////////////////////////////////////
+namespace
+{
+// Undocumented extension of XINPUT_CAPABILITIES, returned by XInputGetCapabilitiesEx (xinput1_4.dll only)
+struct XInputCapabilitiesEx
+{
+    XINPUT_CAPABILITIES capabilities{};
+    WORD                vendorId{};
+    WORD                productId{};
+    WORD                productVersion{};
+    WORD                unknown1{};
+    DWORD               unknown2{};
+};
+
+using XInputGetStateFunc          = DWORD(WINAPI*)(DWORD, XINPUT_STATE*);
+using XInputGetCapabilitiesFunc   = DWORD(WINAPI*)(DWORD, DWORD, XINPUT_CAPABILITIES*);
+using XInputGetCapabilitiesExFunc = DWORD(WINAPI*)(DWORD, DWORD, DWORD, XInputCapabilitiesEx*);
+
+HMODULE                     xinputDll               = nullptr;
+XInputGetStateFunc          xinputGetState          = nullptr;
+XInputGetCapabilitiesFunc   xinputGetCapabilities   = nullptr;
+XInputGetCapabilitiesExFunc xinputGetCapabilitiesEx = nullptr;
+
+const unsigned int xinputButtonCount = 10;
+
+// Check whether a DirectInput device is also exposed through XInput
+//
+// XInput devices are the HID devices whose path contains "IG_", see
+// https://learn.microsoft.com/en-us/windows/win32/xinput/xinput-and-directinput
+bool isXInputDevice(const GUID& productGuid)
+{
+    UINT count = 0;
+    if ((GetRawInputDeviceList(nullptr, &count, sizeof(RAWINPUTDEVICELIST)) != 0) || (count == 0))
+        return false;
+
+    std::vector<RAWINPUTDEVICELIST> devices(count);
+    if (GetRawInputDeviceList(devices.data(), &count, sizeof(RAWINPUTDEVICELIST)) == static_cast<UINT>(-1))
+        return false;
+
+    for (const RAWINPUTDEVICELIST& device : devices)
+    {
+        if (device.dwType != RIM_TYPEHID)
+            continue;
+
+        // The first 4 bytes of the product GUID of a HID device are its vendor and product id
+        RID_DEVICE_INFO info{};
+        info.cbSize = sizeof(info);
+        UINT size   = sizeof(info);
+        if ((GetRawInputDeviceInfoA(device.hDevice, RIDI_DEVICEINFO, &info, &size) == static_cast<UINT>(-1)) ||
+            (static_cast<DWORD>(MAKELONG(info.hid.dwVendorId, info.hid.dwProductId)) != productGuid.Data1))
+            continue;
+
+        char name[256]{};
+        size = sizeof(name) - 1;
+        if (GetRawInputDeviceInfoA(device.hDevice, RIDI_DEVICENAME, name, &size) == static_cast<UINT>(-1))
+            continue;
+
+        if (std::strstr(name, "IG_"))
+            return true;
+    }
+
+    return false;
+}
+} // namespace
+
+
 ////////////////////////////////////////////////////////////
 // Legacy joystick API
 ////////////////////////////////////////////////////////////
@@ -230,6 +301,8 @@ void JoystickImpl::initialize()
 
     if (!directInput)
         err() << "DirectInput not available, falling back to Windows joystick API" << std::endl;
+    else
+        initializeXInput();
 
     // Perform the initial scan and populate the connection cache
     updateConnections();
@@ -239,7 +312,8 @@ void JoystickImpl::initialize()
 ////////////////////////////////////////////////////////////
 void JoystickImpl::cleanup()
 {
-    // Clean up DirectInput
+    // Clean up DirectInput and XInput
+    cleanupXInput();
     cleanupDInput();
 }
 
@@ -321,6 +395,9 @@ void JoystickImpl::close()
 ////////////////////////////////////////////////////////////
 JoystickCaps JoystickImpl::getCapabilities() const
 {
+    if (m_xinputUser != -1)
+        return getCapabilitiesXInput();
+
     if (directInput)
         return getCapabilitiesDInput();
 
@@ -353,6 +430,9 @@ Joystick::Identification JoystickImpl::getIdentification() const
 ////////////////////////////////////////////////////////////
 JoystickState JoystickImpl::update()
 {
+    if (m_xinputUser != -1)
+        return updateXInput();
+
     if (directInput)
     {
         if (m_buffered)
@@ -477,6 +557,49 @@ void JoystickImpl::cleanupDInput()
 }
 
 
+////////////////////////////////////////////////////////////
+void JoystickImpl::initializeXInput()
+{
+    // Try to load the most recent XInput library available
+    for (const char* name : {"xinput1_4.dll", "xinput1_3.dll", "xinput9_1_0.dll"})
+    {
+        xinputDll = LoadLibraryA(name);
+
+        if (xinputDll)
+            break;
+    }
+
+    if (!xinputDll)
+        return;
+
+    xinputGetState = reinterpret_cast<XInputGetStateFunc>(
+        reinterpret_cast<void*>(GetProcAddress(xinputDll, "XInputGetState")));
+    xinputGetCapabilities = reinterpret_cast<XInputGetCapabilitiesFunc>(
+        reinterpret_cast<void*>(GetProcAddress(xinputDll, "XInputGetCapabilities")));
+    xinputGetCapabilitiesEx = reinterpret_cast<XInputGetCapabilitiesExFunc>(
+        reinterpret_cast<void*>(GetProcAddress(xinputDll, MAKEINTRESOURCEA(108))));
+
+    if (!xinputGetState || !xinputGetCapabilities)
+        cleanupXInput();
+}
+
+
+////////////////////////////////////////////////////////////
+void JoystickImpl::cleanupXInput()
+{
+    xinputGetState          = nullptr;
+    xinputGetCapabilities   = nullptr;
+    xinputGetCapabilitiesEx = nullptr;
+
+    // Unload the XInput library
+    if (xinputDll)
+    {
+        FreeLibrary(xinputDll);
+        xinputDll = nullptr;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 bool JoystickImpl::isConnectedDInput(unsigned int index)
 {
@@ -500,6 +623,9 @@ void JoystickImpl::updateConnectionsDInput()
                                                     nullptr,
                                                     DIEDFL_ATTACHEDONLY);
 
+    // XInput controllers were skipped by the enumeration, look for them in the XInput slots
+    updateConnectionsXInput();
+
     // Remove devices that were not connected during the enumeration
     joystickList.erase(std::remove_if(joystickList.begin(),
                                       joystickList.end(),
@@ -547,12 +673,16 @@ bool JoystickImpl::openDInput(unsigned int index)
     m_deviceCaps.dwSize = sizeof(DIDEVCAPS);
     m_state             = JoystickState();
     m_buffered          = false;
+    m_xinputUser        = -1;
 
     // Search for a joystick with the given index in the connected list
     for (const JoystickRecord& record : joystickList)
     {
         if (record.index == index)
         {
+            if (record.xinputUser != -1)
+                return openXInput(record.xinputUser);
+
             // Create device
             HRESULT result = directInput->CreateDevice(record.guid, &m_device, nullptr);
 
@@ -857,6 +987,8 @@ void JoystickImpl::closeDInput()
         m_device->Release();
         m_device = nullptr;
     }
+
+    m_xinputUser = -1;
 }
 
 
@@ -969,7 +1101,15 @@ JoystickState JoystickImpl::updateDInputBuffered()
         for (unsigned int j = 0; j < Joystick::ButtonCount; ++j)
         {
             if (m_buttons[j] == static_cast<int>(events[i].dwOfs))
-                m_state.buttons[j] = (events[i].dwData != 0);
+            {
+                const bool pressed = (events[i].dwData != 0);
+
+                // Count the changes so that short presses between two updates still produce events
+                if (m_state.buttons[j] != pressed)
+                    ++m_state.changes[j];
+
+                m_state.buttons[j] = pressed;
+            }
         }
     }
 
@@ -1078,6 +1218,129 @@ JoystickState JoystickImpl::updateDInputPolled()
 }
 
 
+////////////////////////////////////////////////////////////
+void JoystickImpl::updateConnectionsXInput()
+{
+    if (!xinputGetCapabilities)
+        return;
+
+    for (DWORD user = 0; user < XUSER_MAX_COUNT; ++user)
+    {
+        XINPUT_CAPABILITIES capabilities{};
+        if (xinputGetCapabilities(user, XINPUT_FLAG_GAMEPAD, &capabilities) != ERROR_SUCCESS)
+            continue;
+
+        const auto it = std::find_if(joystickList.begin(),
+                                     joystickList.end(),
+                                     [user](const JoystickRecord& record)
+                                     { return record.xinputUser == static_cast<int>(user); });
+
+        if (it != joystickList.end())
+            it->plugged = true;
+        else
+            joystickList.push_back({GUID{}, sf::Joystick::Count, true, static_cast<int>(user)});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool JoystickImpl::openXInput(int user)
+{
+    m_xinputUser          = user;
+    m_xinputPacket        = 0;
+    m_identification      = Joystick::Identification();
+    m_identification.name = "XInput Controller";
+
+    XInputCapabilitiesEx capabilities;
+    if (xinputGetCapabilitiesEx &&
+        (xinputGetCapabilitiesEx(1, static_cast<DWORD>(user), XINPUT_FLAG_GAMEPAD, &capabilities) == ERROR_SUCCESS))
+    {
+        m_identification.vendorId  = capabilities.vendorId;
+        m_identification.productId = capabilities.productId;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+JoystickCaps JoystickImpl::getCapabilitiesXInput()
+{
+    JoystickCaps caps;
+
+    // XInput always reports the full layout of a gamepad
+    caps.buttonCount = xinputButtonCount;
+
+    for (bool& axis : caps.axes)
+        axis = true;
+
+    return caps;
+}
+
+
+////////////////////////////////////////////////////////////
+JoystickState JoystickImpl::updateXInput()
+{
+    XINPUT_STATE state{};
+    if (xinputGetState(static_cast<DWORD>(m_xinputUser), &state) != ERROR_SUCCESS)
+    {
+        m_state.connected = false;
+        return m_state;
+    }
+
+    // The packet number only changes when the state of the controller does
+    if (m_state.connected && (state.dwPacketNumber == m_xinputPacket))
+        return m_state;
+
+    m_state.connected = true;
+    m_xinputPacket    = state.dwPacketNumber;
+
+    const XINPUT_GAMEPAD& gamepad = state.Gamepad;
+
+    // Sticks are in range [-32768, 32767] with Y pointing up, triggers in range [0, 255] and mapped to [0, 100]
+    const auto stick   = [](SHORT value) { return (static_cast<float>(value) + 0.5f) * 100.f / 32767.5f; };
+    const auto trigger = [](BYTE value) { return static_cast<float>(value) * 100.f / 255.f; };
+
+    m_state.axes[Joystick::Axis::X] = stick(gamepad.sThumbLX);
+    m_state.axes[Joystick::Axis::Y] = -stick(gamepad.sThumbLY);
+    m_state.axes[Joystick::Axis::Z] = trigger(gamepad.bLeftTrigger);
+    m_state.axes[Joystick::Axis::R] = trigger(gamepad.bRightTrigger);
+    m_state.axes[Joystick::Axis::U] = stick(gamepad.sThumbRX);
+    m_state.axes[Joystick::Axis::V] = -stick(gamepad.sThumbRY);
+
+    // The D-pad is reported as a POV, like DirectInput does
+    const auto pov = [&gamepad](WORD positive, WORD negative)
+    { return (gamepad.wButtons & positive) ? 100.f : ((gamepad.wButtons & negative) ? -100.f : 0.f); };
+
+    m_state.axes[Joystick::Axis::PovX] = pov(XINPUT_GAMEPAD_DPAD_RIGHT, XINPUT_GAMEPAD_DPAD_LEFT);
+    m_state.axes[Joystick::Axis::PovY] = pov(XINPUT_GAMEPAD_DPAD_UP, XINPUT_GAMEPAD_DPAD_DOWN);
+
+    // Buttons are numbered in the same order as the DirectInput driver of Xbox controllers
+    static constexpr WORD buttonMasks[xinputButtonCount] = {XINPUT_GAMEPAD_A,
+                                                            XINPUT_GAMEPAD_B,
+                                                            XINPUT_GAMEPAD_X,
+                                                            XINPUT_GAMEPAD_Y,
+                                                            XINPUT_GAMEPAD_LEFT_SHOULDER,
+                                                            XINPUT_GAMEPAD_RIGHT_SHOULDER,
+                                                            XINPUT_GAMEPAD_BACK,
+                                                            XINPUT_GAMEPAD_START,
+                                                            XINPUT_GAMEPAD_LEFT_THUMB,
+                                                            XINPUT_GAMEPAD_RIGHT_THUMB};
+
+    for (unsigned int i = 0; i < xinputButtonCount; ++i)
+    {
+        const bool pressed = (gamepad.wButtons & buttonMasks[i]) != 0;
+
+        if (m_state.buttons[i] != pressed)
+            ++m_state.changes[i];
+
+        m_state.buttons[i] = pressed;
+    }
+
+    return m_state;
+}
+
+
 ////////////////////////////////////////////////////////////
 BOOL CALLBACK JoystickImpl::deviceEnumerationCallback(const DIDEVICEINSTANCE* deviceInstance, void*)
 {
@@ -1091,6 +1354,10 @@ BOOL CALLBACK JoystickImpl::deviceEnumerationCallback(const DIDEVICEINSTANCE* de
         }
     }
 
+    // Devices also exposed through XInput are handled by updateConnectionsXInput
+    if (xinputGetState && isXInputDevice(deviceInstance->guidProduct))
+        return DIENUM_CONTINUE;
+
     const JoystickRecord record = {deviceInstance->guidInstance, sf::Joystick::Count, true};
     joystickList.push_back(record);
 
@@ -187,6 +187,53 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] JoystickState updateDInputPolled();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Perform the global initialization of the joystick module (XInput)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void initializeXInput();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Perform the global cleanup of the joystick module (XInput)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void cleanupXInput();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the connection status of all XInput controllers
+    ///
+    /// This is only called along with updateConnectionsDInput,
+    /// since querying unconnected XInput slots is slow.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void updateConnectionsXInput();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the joystick (XInput)
+    ///
+    /// \param user XInput user index of the controller
+    ///
+    /// \return True on success, false on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openXInput(int user);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the joystick capabilities (XInput)
+    ///
+    /// \return Joystick capabilities
+    ///
+    ////////////////////////////////////////////////////////////
+    static JoystickCaps getCapabilitiesXInput();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the joystick and get its new state (XInput)
+    ///
+    /// \return Joystick state
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] JoystickState updateXInput();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Device enumeration callback function passed to EnumDevices in updateConnections
@@ -222,6 +269,8 @@ private:
     Joystick::Identification m_identification; //!< Joystick identification
     JoystickState            m_state;          //!< Buffered joystick state
     bool                     m_buffered{};     //!< true if the device uses buffering, false if the device uses polling
+    int                      m_xinputUser{-1}; //!< XInput user index of the controller, -1 if not an XInput device
+    DWORD                    m_xinputPacket{}; //!< XInput packet number of the last state read
 };
 
 } // namespace sf::priv
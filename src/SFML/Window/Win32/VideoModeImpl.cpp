@@ -27,11 +27,46 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/VideoModeImpl.hpp>
 
+#include <SFML/System/String.hpp>
 #include <SFML/System/Win32/WindowsHeader.hpp>
 
 #include <algorithm>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+BOOL CALLBACK addMonitor(HMONITOR handle, HDC /* hdc */, LPRECT /* rect */, LPARAM userData)
+{
+    auto& monitors = *reinterpret_cast<std::vector<sf::Monitor>*>(userData);
+
+    MONITORINFOEX info;
+    info.cbSize = sizeof(info);
+    if (!GetMonitorInfo(handle, &info))
+        return TRUE;
+
+    DEVMODE win32Mode;
+    win32Mode.dmSize        = sizeof(win32Mode);
+    win32Mode.dmDriverExtra = 0;
+    if (!EnumDisplaySettings(info.szDevice, ENUM_CURRENT_SETTINGS, &win32Mode))
+        return TRUE;
+
+    sf::Monitor monitor;
+    monitor.name     = sf::String(info.szDevice).toAnsiString();
+    monitor.position = {info.rcMonitor.left, info.rcMonitor.top};
+    monitor.mode     = sf::VideoMode({win32Mode.dmPelsWidth, win32Mode.dmPelsHeight}, win32Mode.dmBitsPerPel);
+    monitor.primary  = (info.dwFlags & MONITORINFOF_PRIMARY) != 0;
+
+    // 0 and 1 stand for the default refresh rate of the hardware
+    if (win32Mode.dmDisplayFrequency > 1)
+        monitor.refreshRate = static_cast<float>(win32Mode.dmDisplayFrequency);
+
+    monitors.push_back(monitor);
+    return TRUE;
+}
+} // namespace
+
+
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
@@ -68,4 +103,33 @@ VideoMode VideoModeImpl::getDesktopMode()
     return VideoMode({win32Mode.dmPelsWidth, win32Mode.dmPelsHeight}, win32Mode.dmBitsPerPel);
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    std::vector<Monitor> monitors;
+    EnumDisplayMonitors(nullptr, nullptr, addMonitor, reinterpret_cast<LPARAM>(&monitors));
+
+    if (monitors.empty())
+    {
+        Monitor monitor;
+        monitor.mode    = getDesktopMode();
+        monitor.primary = true;
+        monitors.push_back(monitor);
+    }
+
+    // Put the primary monitor first
+    std::stable_partition(monitors.begin(), monitors.end(), [](const Monitor& monitor) { return monitor.primary; });
+
+    return monitors;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // Windows receive WM_DISPLAYCHANGE
+    return true;
+}
+
 } // namespace sf::priv
@@ -27,17 +27,22 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/VideoMode.hpp>
+#include <SFML/Window/Win32/DxgiPresenter.hpp>
 #include <SFML/Window/Win32/WglContext.hpp>
 #include <SFML/Window/WindowImpl.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/String.hpp>
 
+#include <algorithm>
 #include <mutex>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 #include <cassert>
+#include <cstdint>
 
 // We check for this definition in order to avoid multiple definitions of GLAD
 // entities during unity builds of SFML.
@@ -94,6 +99,79 @@ void ensureExtensionsInit(HDC deviceContext)
         gladLoadWGL(deviceContext, sf::priv::WglContext::getFunction);
     }
 }
+
+
+////////////////////////////////////////////////////////////
+bool hasWglExtension(HDC deviceContext, std::string_view name)
+{
+    const char* extensionString = nullptr;
+
+    if (SF_GLAD_WGL_ARB_extensions_string)
+        extensionString = wglGetExtensionsStringARB(deviceContext);
+    else if (SF_GLAD_WGL_EXT_extensions_string)
+        extensionString = wglGetExtensionsStringEXT();
+
+    if (!extensionString)
+        return false;
+
+    const std::string_view extensions(extensionString);
+    for (std::size_t begin = 0; begin < extensions.size();)
+    {
+        const std::size_t end = std::min(extensions.find(' ', begin), extensions.size());
+        if (extensions.substr(begin, end - begin) == name)
+            return true;
+        begin = end + 1;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+// Presentation control entry points which are not part
+// of the generated WGL loader, resolved once per process
+////////////////////////////////////////////////////////////
+struct PresentationFunctions
+{
+    using DelayBeforeSwapNV = BOOL(WINAPI*)(HDC, FLOAT);
+    using GetSyncValuesOML  = BOOL(WINAPI*)(HDC, INT64*, INT64*, INT64*);
+    using GetMscRateOML     = BOOL(WINAPI*)(HDC, INT32*, INT32*);
+
+    bool              swapControlTear{};
+    DelayBeforeSwapNV delayBeforeSwap{};
+    GetSyncValuesOML  getSyncValues{};
+    GetMscRateOML     getMscRate{};
+};
+
+
+////////////////////////////////////////////////////////////
+const PresentationFunctions& getPresentationFunctions(HDC deviceContext)
+{
+    static const PresentationFunctions functions = [deviceContext]
+    {
+        ensureExtensionsInit(deviceContext);
+
+        PresentationFunctions result;
+
+        result.swapControlTear = hasWglExtension(deviceContext, "WGL_EXT_swap_control_tear");
+
+        if (hasWglExtension(deviceContext, "WGL_NV_delay_before_swap"))
+            result.delayBeforeSwap = reinterpret_cast<PresentationFunctions::DelayBeforeSwapNV>(
+                sf::priv::WglContext::getFunction("wglDelayBeforeSwapNV"));
+
+        if (hasWglExtension(deviceContext, "WGL_OML_sync_control"))
+        {
+            result.getSyncValues = reinterpret_cast<PresentationFunctions::GetSyncValuesOML>(
+                sf::priv::WglContext::getFunction("wglGetSyncValuesOML"));
+            result.getMscRate = reinterpret_cast<PresentationFunctions::GetMscRateOML>(
+                sf::priv::WglContext::getFunction("wglGetMscRateOML"));
+        }
+
+        return result;
+    }();
+
+    return functions;
+}
 } // namespace WglContextImpl
 } // namespace
 
@@ -143,6 +221,10 @@ WglContext::WglContext(WglContext* shared, const ContextSettings& settings, cons
 
     // Create the context
     createContext(shared);
+
+    // Replace SwapBuffers by a DXGI flip model swap chain if requested
+    if (m_settings.lowLatencyPresentation)
+        createPresenter();
 }
 
 
@@ -151,8 +233,9 @@ WglContext::WglContext(WglContext* shared, const ContextSettings& settings, cons
 {
     WglContextImpl::ensureInit();
 
-    // Save the creation settings
-    m_settings = settings;
+    // Save the creation settings, there is nothing to present
+    m_settings                        = settings;
+    m_settings.lowLatencyPresentation = false;
 
     // Create the rendering surface (window or pbuffer if supported)
     createSurface(shared, size, VideoMode::getDesktopMode().bitsPerPixel);
@@ -162,13 +245,35 @@ WglContext::WglContext(WglContext* shared, const ContextSettings& settings, cons
 }
 
 
+////////////////////////////////////////////////////////////
+WglContext::WglContext(const WglContext& context, HWND window, HDC deviceContext) :
+m_window(window),
+m_deviceContext(deviceContext),
+m_context(context.m_context),
+m_isGeneric(context.m_isGeneric)
+{
+    m_settings = context.m_settings;
+}
+
+
 ////////////////////////////////////////////////////////////
 WglContext::~WglContext()
 {
     // Notify unshared OpenGL resources of context destruction
     cleanupUnsharedResources();
 
-    // Destroy the OpenGL context
+    // The presenter deletes OpenGL objects, which requires the context to be current
+    if (m_presenter)
+    {
+        WglContext* previousContext = WglContextImpl::currentContext;
+        makeCurrent(true);
+        m_presenter.reset();
+
+        if (previousContext && (previousContext != this))
+            previousContext->makeCurrent(true);
+    }
+
+    // Destroy the OpenGL context, unless other windows still render with it
     if (m_context)
     {
         if (WglContextImpl::currentContext == this)
@@ -177,7 +282,8 @@ WglContext::~WglContext()
                 WglContextImpl::currentContext = nullptr;
         }
 
-        wglDeleteContext(m_context);
+        if (!isNativeContextShared())
+            wglDeleteContext(m_context);
     }
 
     // Destroy the device context
@@ -200,6 +306,46 @@ WglContext::~WglContext()
 }
 
 
+////////////////////////////////////////////////////////////
+std::unique_ptr<WglContext> WglContext::shareWindowContext(WglContext&       context,
+                                                       const WindowImpl& owner,
+                                                       unsigned int /* bitsPerPixel */)
+{
+    if (!context.m_context || !context.m_window || context.m_pbuffer)
+        return nullptr;
+
+    // An OpenGL context can be made current with any device context that has the pixel format it was created for
+    const int format = GetPixelFormat(context.m_deviceContext);
+    if (format == 0)
+        return nullptr;
+
+    HWND      window        = owner.getNativeHandle();
+    HDC       deviceContext = GetDC(window);
+    const int currentFormat = GetPixelFormat(deviceContext);
+
+    if (currentFormat == 0)
+    {
+        PIXELFORMATDESCRIPTOR descriptor;
+        descriptor.nSize    = sizeof(descriptor);
+        descriptor.nVersion = 1;
+        DescribePixelFormat(deviceContext, format, sizeof(descriptor), &descriptor);
+
+        if (SetPixelFormat(deviceContext, format, &descriptor) == FALSE)
+        {
+            ReleaseDC(window, deviceContext);
+            return nullptr;
+        }
+    }
+    else if (currentFormat != format)
+    {
+        ReleaseDC(window, deviceContext);
+        return nullptr;
+    }
+
+    return std::unique_ptr<WglContext>(new WglContext(context, window, deviceContext));
+}
+
+
 ////////////////////////////////////////////////////////////
 GlFunctionPointer WglContext::getFunction(const char* name)
 {
@@ -247,7 +393,9 @@ bool WglContext::makeCurrent(bool current)
 ////////////////////////////////////////////////////////////
 void WglContext::display()
 {
-    if (m_deviceContext && m_context)
+    if (m_presenter)
+        m_presenter->present();
+    else if (m_deviceContext && m_context)
         SwapBuffers(m_deviceContext);
 }
 
@@ -255,6 +403,12 @@ void WglContext::display()
 ////////////////////////////////////////////////////////////
 void WglContext::setVerticalSyncEnabled(bool enabled)
 {
+    if (m_presenter)
+    {
+        (void)m_presenter->setSwapInterval(enabled ? 1 : 0);
+        return;
+    }
+
     // Make sure that extensions are initialized
     WglContextImpl::ensureExtensionsInit(m_deviceContext);
 
@@ -278,6 +432,71 @@ void WglContext::setVerticalSyncEnabled(bool enabled)
 }
 
 
+////////////////////////////////////////////////////////////
+bool WglContext::setSwapInterval(int interval)
+{
+    if (m_presenter)
+        return m_presenter->setSwapInterval(interval);
+
+    // Make sure that extensions are initialized
+    WglContextImpl::ensureExtensionsInit(m_deviceContext);
+
+    if (!SF_GLAD_WGL_EXT_swap_control)
+        return false;
+
+    // Adaptive synchronization is expressed as a negative interval
+    if ((interval < 0) && !WglContextImpl::getPresentationFunctions(m_deviceContext).swapControlTear)
+        return false;
+
+    return wglSwapIntervalEXT(interval) != FALSE;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WglContext::delayBeforeSwap(Time delay)
+{
+    // The presenter already waits for the swap chain in display(), SwapBuffers isn't called anymore
+    if (m_presenter)
+        return false;
+
+    const WglContextImpl::PresentationFunctions& functions = WglContextImpl::getPresentationFunctions(m_deviceContext);
+    if (!functions.delayBeforeSwap)
+        return false;
+
+    return functions.delayBeforeSwap(m_deviceContext, delay.asSeconds()) != FALSE;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> WglContext::getPresentTiming()
+{
+    if (m_presenter)
+        return m_presenter->getPresentTiming();
+
+    const WglContextImpl::PresentationFunctions& functions = WglContextImpl::getPresentationFunctions(m_deviceContext);
+    if (!functions.getSyncValues || !functions.getMscRate)
+        return std::nullopt;
+
+    INT64 ust = 0;
+    INT64 msc = 0;
+    INT64 sbc = 0;
+    if (functions.getSyncValues(m_deviceContext, &ust, &msc, &sbc) == FALSE)
+        return std::nullopt;
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank  = microseconds(ust);
+    timing.verticalBlankCount = static_cast<std::uint64_t>(msc);
+    timing.swapCount          = static_cast<std::uint64_t>(sbc);
+
+    INT32 numerator   = 0;
+    INT32 denominator = 0;
+    if ((functions.getMscRate(m_deviceContext, &numerator, &denominator) != FALSE) && (denominator > 0))
+        timing.refreshRate = static_cast<float>(numerator) / static_cast<float>(denominator);
+
+    return timing;
+}
+
+
 ////////////////////////////////////////////////////////////
 int WglContext::selectBestPixelFormat(HDC deviceContext, unsigned int bitsPerPixel, const ContextSettings& settings, bool pbuffer)
 {
@@ -290,6 +509,7 @@ int WglContext::selectBestPixelFormat(HDC deviceContext, unsigned int bitsPerPix
         unsigned int depthBits{};
         unsigned int stencilBits{};
         unsigned int antialiasingLevel{};
+        bool         sRgbCapable{};
         bool         pbuffer{};
         int          bestFormat{};
     };
@@ -306,13 +526,18 @@ int WglContext::selectBestPixelFormat(HDC deviceContext, unsigned int bitsPerPix
         {
             if (bitsPerPixel == entry.bitsPerPixel && settings.depthBits == entry.depthBits &&
                 settings.stencilBits == entry.stencilBits && settings.antialiasingLevel == entry.antialiasingLevel &&
-                pbuffer == entry.pbuffer)
+                settings.sRgbCapable == entry.sRgbCapable && pbuffer == entry.pbuffer)
+            {
+                recordFormatSelection(Time::Zero, true);
                 return entry.bestFormat;
+            }
         }
     }
 
     WglContextImpl::ensureInit();
 
+    const Clock clock;
+
     // Let's find a suitable pixel format -- first try with wglChoosePixelFormatARB
     int bestFormat = 0;
     if (SF_GLAD_WGL_ARB_pixel_format)
@@ -448,18 +673,45 @@ int WglContext::selectBestPixelFormat(HDC deviceContext, unsigned int bitsPerPix
         bestFormat = ChoosePixelFormat(deviceContext, &descriptor);
     }
 
+    recordFormatSelection(clock.getElapsedTime(), false);
+
     // If we get this far, the format wasn't found in the cache so add it here
     {
         const std::lock_guard lock(cacheMutex);
 
-        pixelFormatCache.emplace_back(
-            PixelFormatCacheEntry{bitsPerPixel, settings.depthBits, settings.stencilBits, settings.antialiasingLevel, pbuffer, bestFormat});
+        pixelFormatCache.emplace_back(PixelFormatCacheEntry{bitsPerPixel,
+                                                            settings.depthBits,
+                                                            settings.stencilBits,
+                                                            settings.antialiasingLevel,
+                                                            settings.sRgbCapable,
+                                                            pbuffer,
+                                                            bestFormat});
     }
 
     return bestFormat;
 }
 
 
+////////////////////////////////////////////////////////////
+void WglContext::probePixelFormat(unsigned int bitsPerPixel, const ContextSettings& settings)
+{
+    // The formats of the screen are the ones of the windows
+    HDC screenDeviceContext = GetDC(nullptr);
+    if (!screenDeviceContext)
+        return;
+
+    (void)selectBestPixelFormat(screenDeviceContext, bitsPerPixel, settings);
+    ReleaseDC(nullptr, screenDeviceContext);
+}
+
+
+////////////////////////////////////////////////////////////
+bool WglContext::isBoundToThread() const
+{
+    return m_ownsWindow;
+}
+
+
 ////////////////////////////////////////////////////////////
 void WglContext::setDevicePixelFormat(unsigned int bitsPerPixel)
 {
@@ -842,4 +1094,31 @@ void WglContext::createContext(WglContext* shared)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void WglContext::createPresenter()
+{
+    m_settings.lowLatencyPresentation = false;
+
+    WglContextImpl::ensureExtensionsInit(m_deviceContext);
+    if (!WglContextImpl::hasWglExtension(m_deviceContext, "WGL_NV_DX_interop2"))
+    {
+        err() << "Low-latency presentation requires WGL_NV_DX_interop2, falling back to SwapBuffers" << std::endl;
+        return;
+    }
+
+    // The presenter creates OpenGL objects, the context must be current
+    WglContext* previousContext = WglContextImpl::currentContext;
+    if (!makeCurrent(true))
+        return;
+
+    m_presenter                       = DxgiPresenter::create(m_window, m_settings);
+    m_settings.lowLatencyPresentation = (m_presenter != nullptr);
+
+    if (previousContext)
+        previousContext->makeCurrent(true);
+    else
+        makeCurrent(false);
+}
+
 } // namespace sf::priv
@@ -34,6 +34,8 @@
 
 #include <glad/wgl.h>
 
+#include <memory>
+
 
 namespace sf
 {
@@ -41,6 +43,7 @@ struct ContextSettings;
 
 namespace priv
 {
+class DxgiPresenter;
 class WindowImpl;
 
 ////////////////////////////////////////////////////////////
@@ -124,6 +127,34 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when swapping buffers
+    ///
+    /// \param interval Number of vertical blanks, negative for adaptive synchronization
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a given time before the next vertical blank
+    ///
+    /// \param delay Time to leave before the vertical blank
+    ///
+    /// \return True if the function waited, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool delayBeforeSwap(Time delay) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Select the best pixel format for a given set of settings
     ///
@@ -140,7 +171,50 @@ public:
                                      const ContextSettings& settings,
                                      bool                   pbuffer = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the pixel format of a future window, to cache the result
+    ///
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    /// \param settings     Requested context settings
+    ///
+    ////////////////////////////////////////////////////////////
+    static void probePixelFormat(unsigned int bitsPerPixel, const ContextSettings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the context draws to a hidden window
+    ///
+    /// Such a context can't outlive the thread which created it.
+    ///
+    /// \return True if the surface is a window owned by the context
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBoundToThread() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a context rendering to a window with the OpenGL context of another window
+    ///
+    /// \param context      Context of the other window
+    /// \param owner        Window to render to
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    ///
+    /// \return The new context, or a null pointer if the window already has another pixel format
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::unique_ptr<WglContext> shareWindowContext(WglContext&       context,
+                                                          const WindowImpl& owner,
+                                                          unsigned int      bitsPerPixel);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a context rendering to a window with the OpenGL context of another window
+    ///
+    /// \param context       Context of the other window
+    /// \param window        Window to render to
+    /// \param deviceContext Device context of the window, with the pixel format of the other window
+    ///
+    ////////////////////////////////////////////////////////////
+    WglContext(const WglContext& context, HWND window, HDC deviceContext);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the pixel format of the device context
     ///
@@ -182,15 +256,25 @@ private:
     ////////////////////////////////////////////////////////////
     void createContext(WglContext* shared);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the DXGI presenter replacing SwapBuffers
+    ///
+    /// The lowLatencyPresentation setting is updated to tell
+    /// whether it succeeded.
+    ///
+    ////////////////////////////////////////////////////////////
+    void createPresenter();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    HWND        m_window{};        //!< Window to which the context is attached
-    HPBUFFERARB m_pbuffer{};       //!< Handle to a pbuffer if one was created
-    HDC         m_deviceContext{}; //!< Device context associated to the context
-    HGLRC       m_context{};       //!< OpenGL context
-    bool        m_ownsWindow{};    //!< Do we own the target window?
-    bool        m_isGeneric{};     //!< Is this context provided by the generic GDI implementation?
+    HWND                           m_window{};        //!< Window to which the context is attached
+    HPBUFFERARB                    m_pbuffer{};       //!< Handle to a pbuffer if one was created
+    HDC                            m_deviceContext{}; //!< Device context associated to the context
+    HGLRC                          m_context{};       //!< OpenGL context
+    bool                           m_ownsWindow{};    //!< Do we own the target window?
+    bool                           m_isGeneric{};     //!< Is this context provided by the generic GDI implementation?
+    std::unique_ptr<DxgiPresenter> m_presenter;       //!< DXGI swap chain replacing SwapBuffers, if enabled
 };
 
 } // namespace priv
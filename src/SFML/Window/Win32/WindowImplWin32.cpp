@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/JoystickImpl.hpp>
+#include <SFML/Window/VideoModeImpl.hpp>
 #include <SFML/Window/Win32/WindowImplWin32.hpp>
 #include <SFML/Window/WindowEnums.hpp>
 
@@ -41,6 +42,7 @@
 #include <vector>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 // MinGW lacks the definition of some Win32 constants
@@ -727,6 +729,10 @@ void WindowImplWin32::processEvent(UINT message, WPARAM wParam, LPARAM lParam)
     if (m_handle == nullptr)
         return;
 
+    // Timestamp the events with the time at which the system created the message
+    setSystemEventTimestamp(convertSystemTime(static_cast<std::uint32_t>(GetMessageTime()),
+                                              static_cast<std::uint32_t>(GetTickCount())));
+
     switch (message)
     {
         // Destroy event
@@ -1114,7 +1120,7 @@ void WindowImplWin32::processEvent(UINT message, WPARAM wParam, LPARAM lParam)
             if (input.header.dwType == RIM_TYPEMOUSE)
             {
                 if (const RAWMOUSE* rawMouse = &input.data.mouse; (rawMouse->usFlags & 0x01) == MOUSE_MOVE_RELATIVE)
-                    pushEvent(Event::MouseMovedRaw{{rawMouse->lLastX, rawMouse->lLastY}});
+                    pushRawMouseMovement({rawMouse->lLastX, rawMouse->lLastY});
             }
 
             break;
@@ -1136,6 +1142,14 @@ void WindowImplWin32::processEvent(UINT message, WPARAM wParam, LPARAM lParam)
             break;
         }
 
+        // A monitor was plugged, unplugged or changed its video mode
+        case WM_DISPLAYCHANGE:
+        {
+            // Forget the cached video modes, the windows are told by a MonitorsChanged event
+            VideoModeImpl::invalidateCache();
+            break;
+        }
+
         // Work around Windows 10 bug
         // When a maximum size is specified and the window is snapped to the edge of the display the window size is subtly too big
         case WM_WINDOWPOSCHANGED:
@@ -1166,6 +1180,8 @@ void WindowImplWin32::processEvent(UINT message, WPARAM wParam, LPARAM lParam)
             break;
         }
     }
+
+    setSystemEventTimestamp(std::nullopt);
 }
 
 
@@ -32,8 +32,18 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Sleep.hpp>
 
+#include <algorithm>
 #include <ostream>
 
+#include <cstddef>
+
+
+namespace
+{
+// Beyond this number of rectangles, the damage is merged into its bounding rectangle
+constexpr std::size_t maxDamageRectangles = 16;
+} // namespace
+
 
 namespace sf
 {
@@ -145,13 +155,81 @@ void Window::setVerticalSyncEnabled(bool enabled)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Window::setSwapInterval(int interval)
+{
+    return setActive() && m_context->setSwapInterval(interval);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Window::setTargetFrameRate(unsigned int frameRate)
+{
+    return setActive() && m_context->setTargetFrameRate(frameRate);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Window::delayBeforeSwap(Time delay)
+{
+    return setActive() && m_context->delayBeforeSwap(delay);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> Window::getPresentTiming() const
+{
+    if (!setActive())
+        return std::nullopt;
+
+    return m_context->getPresentTiming();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Window::setFramerateLimit(unsigned int limit)
 {
-    if (limit > 0)
-        m_frameTimeLimit = seconds(1.f / static_cast<float>(limit));
-    else
-        m_frameTimeLimit = Time::Zero;
+    setFrameTimeLimit(limit > 0 ? seconds(1.f / static_cast<float>(limit)) : Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::setFrameTimeLimit(Time limit)
+{
+    m_frameTimeLimit = std::max(limit, Time::Zero);
+
+    // Start a new schedule from the current frame
+    m_frameDeadline = FastClock::toTime(FastClock::now() - m_start);
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::setPreciseFramePacingEnabled(bool enabled)
+{
+    m_precisePacing = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Window::isPreciseFramePacingEnabled() const
+{
+    return m_precisePacing;
+}
+
+
+////////////////////////////////////////////////////////////
+const Window::FrameStatistics& Window::getFrameStatistics() const
+{
+    return m_frameStatistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::resetFrameStatistics()
+{
+    m_frameStatistics = FrameStatistics();
+    m_totalFrameTime  = Time::Zero;
+    m_lastFrameEnd    = FastClock::toTime(FastClock::now() - m_start);
 }
 
 
@@ -177,19 +255,89 @@ bool Window::setActive(bool active) const
 }
 
 
+////////////////////////////////////////////////////////////
+void Window::addDamage(Vector2i position, Vector2i size)
+{
+    // Clip the region to the window
+    const Vector2i windowSize(getSize());
+    const int      left   = std::max(position.x, 0);
+    const int      top    = std::max(position.y, 0);
+    const int      right  = std::min(position.x + size.x, windowSize.x);
+    const int      bottom = std::min(position.y + size.y, windowSize.y);
+
+    if ((left >= right) || (top >= bottom))
+        return;
+
+    // OpenGL coordinates start at the bottom-left corner of the window
+    const int x      = left;
+    const int y      = windowSize.y - bottom;
+    const int width  = right - left;
+    const int height = bottom - top;
+
+    // Skip the regions which are already damaged
+    for (std::size_t i = 0; i < m_damage.size(); i += 4)
+    {
+        if ((x >= m_damage[i]) && (y >= m_damage[i + 1]) && (x + width <= m_damage[i] + m_damage[i + 2]) &&
+            (y + height <= m_damage[i + 1] + m_damage[i + 3]))
+            return;
+    }
+
+    if (m_damage.size() < maxDamageRectangles * 4)
+    {
+        m_damage.insert(m_damage.end(), {x, y, width, height});
+        return;
+    }
+
+    // Too many rectangles: merge everything into a single one
+    int minX = x;
+    int minY = y;
+    int maxX = x + width;
+    int maxY = y + height;
+    for (std::size_t i = 0; i < m_damage.size(); i += 4)
+    {
+        minX = std::min(minX, m_damage[i]);
+        minY = std::min(minY, m_damage[i + 1]);
+        maxX = std::max(maxX, m_damage[i] + m_damage[i + 2]);
+        maxY = std::max(maxY, m_damage[i + 1] + m_damage[i + 3]);
+    }
+    m_damage = {minX, minY, maxX - minX, maxY - minY};
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Window::getBufferAge() const
+{
+    return setActive() ? m_context->getBufferAge() : 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Window::display()
 {
+    onDisplay();
+
     // Display the backbuffer on screen
     if (setActive())
-        m_context->display();
+    {
+        if (m_damage.empty())
+            m_context->display();
+        else
+            m_context->displayDamage(m_damage);
+    }
+    m_damage.clear();
 
     // Limit the framerate if needed
     if (m_frameTimeLimit != Time::Zero)
-    {
-        sleep(m_frameTimeLimit - m_clock.getElapsedTime());
-        m_clock.restart();
-    }
+        waitForFrameDeadline();
+
+    updateFrameStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::onDisplay()
+{
+    // Nothing by default
 }
 
 
@@ -201,7 +349,9 @@ void Window::initialize()
     setFramerateLimit(0);
 
     // Reset frame time
-    m_clock.restart();
+    m_start         = FastClock::now();
+    m_frameDeadline = Time::Zero;
+    resetFrameStatistics();
 
     // Activate the window
     if (!setActive())
@@ -212,4 +362,49 @@ void Window::initialize()
     WindowBase::initialize();
 }
 
+
+////////////////////////////////////////////////////////////
+void Window::waitForFrameDeadline()
+{
+    // Schedule from the previous deadline rather than from now, so that lateness doesn't accumulate
+    m_frameDeadline += m_frameTimeLimit;
+
+    const Time now = FastClock::toTime(FastClock::now() - m_start);
+
+    if (now >= m_frameDeadline)
+    {
+        ++m_frameStatistics.missedDeadlines;
+
+        // After a long frame, start over instead of catching up with a burst of short frames
+        if (now - m_frameDeadline > m_frameTimeLimit)
+            m_frameDeadline = now;
+
+        return;
+    }
+
+    // Precise pacing spins for the final part of the delay, which sleeping can't reliably hit
+    if (m_precisePacing)
+        sleepPrecise(m_frameDeadline - now);
+    else
+        sleep(m_frameDeadline - now);
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::updateFrameStatistics()
+{
+    const Time now       = FastClock::toTime(FastClock::now() - m_start);
+    const Time frameTime = now - m_lastFrameEnd;
+    m_lastFrameEnd       = now;
+
+    FrameStatistics& statistics = m_frameStatistics;
+    statistics.minFrameTime     = statistics.frameCount ? std::min(statistics.minFrameTime, frameTime) : frameTime;
+    statistics.maxFrameTime     = std::max(statistics.maxFrameTime, frameTime);
+    statistics.lastFrameTime    = frameTime;
+
+    ++statistics.frameCount;
+    m_totalFrameTime += frameTime;
+    statistics.averageFrameTime = m_totalFrameTime / static_cast<std::int64_t>(statistics.frameCount);
+}
+
 } // namespace sf
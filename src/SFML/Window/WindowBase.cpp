@@ -165,6 +165,79 @@ Event WindowBase::waitEvent()
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t WindowBase::pollEvents(Event* events, std::size_t maxCount)
+{
+    if (!m_impl)
+        return 0;
+
+    const std::size_t count = m_impl->popEvents(events, maxCount);
+    for (std::size_t i = 0; i < count; ++i)
+        filterEvent(events[i]);
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowBase::setEventThreadEnabled(bool enabled)
+{
+    return m_impl && m_impl->setEventThreadEnabled(enabled);
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowBase::isEventThreadEnabled() const
+{
+    return m_impl && m_impl->isEventThreadEnabled();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowBase::setRawMouseBatchingEnabled(bool enabled)
+{
+    if (m_impl)
+        m_impl->setRawMouseBatchingEnabled(enabled);
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowBase::isRawMouseBatchingEnabled() const
+{
+    return m_impl && m_impl->isRawMouseBatchingEnabled();
+}
+
+
+////////////////////////////////////////////////////////////
+const WindowBase::RawMouseInput& WindowBase::getRawMouseInput()
+{
+    static const RawMouseInput emptyInput;
+    return m_impl ? m_impl->swapRawMouseInput() : emptyInput;
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowBase::setTouchCoalescingEnabled(bool enabled)
+{
+    if (m_impl)
+        m_impl->setTouchCoalescingEnabled(enabled);
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowBase::isTouchCoalescingEnabled() const
+{
+    return m_impl && m_impl->isTouchCoalescingEnabled();
+}
+
+
+////////////////////////////////////////////////////////////
+const WindowBase::TouchInput& WindowBase::getTouchInput()
+{
+    static const TouchInput emptyInput;
+    return m_impl ? m_impl->swapTouchInput() : emptyInput;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i WindowBase::getPosition() const
 {
@@ -261,6 +334,14 @@ void WindowBase::setTitle(const String& title)
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowBase::setTitle(Utf8View title)
+{
+    if (m_impl)
+        m_impl->setTitle(title.toString());
+}
+
+
 ////////////////////////////////////////////////////////////
 void WindowBase::setIcon(const Vector2u& size, const std::uint8_t* pixels)
 {
@@ -29,14 +29,23 @@
 #include <SFML/Window/JoystickImpl.hpp>
 #include <SFML/Window/JoystickManager.hpp>
 #include <SFML/Window/SensorManager.hpp>
+#include <SFML/Window/VideoModeImpl.hpp>
 #include <SFML/Window/WindowImpl.hpp>
 
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/ProfileZone.hpp>
 #include <SFML/System/Sleep.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <memory>
+#include <ostream>
+#include <utility>
 
+#include <cassert>
 #include <cmath>
 
 #if defined(SFML_SYSTEM_WINDOWS)
@@ -56,6 +65,13 @@ using WindowImplType = sf::priv::WindowImplDRM;
 
 #define SFML_VULKAN_IMPLEMENTATION_NOT_AVAILABLE
 
+#elif defined(SFML_USE_WAYLAND)
+
+#include <SFML/Window/Wayland/WindowImplWayland.hpp>
+using WindowImplType = sf::priv::WindowImplWayland;
+
+#include <SFML/Window/VulkanImpl.hpp>
+
 #else
 
 #include <SFML/Window/Unix/WindowImplX11.hpp>
@@ -89,6 +105,23 @@ using WindowImplType = sf::priv::WindowImplAndroid;
 #endif
 
 
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace WindowImplImpl
+{
+// Set on the event threads, so that the events they push are handed over to the owner thread
+thread_local bool onEventThread = false;
+
+// Timestamp provided by the operating system for the event being processed by the current thread
+thread_local std::optional<sf::Time> systemEventTimestamp;
+
+// System events older than this are considered to come from a clock that doesn't match ours
+constexpr sf::Time maxSystemEventAge = sf::seconds(60);
+} // namespace WindowImplImpl
+} // namespace
+
+
 namespace sf::priv
 {
 
@@ -119,7 +152,9 @@ std::unique_ptr<WindowImpl> WindowImpl::create(WindowHandle handle)
 
 
 ////////////////////////////////////////////////////////////
-WindowImpl::WindowImpl() : m_joystickStatesImpl(std::make_unique<JoystickStatesImpl>())
+WindowImpl::WindowImpl() :
+m_events(EventQueueCapacity),
+m_joystickStatesImpl(std::make_unique<JoystickStatesImpl>())
 {
     // Get the initial joystick states
     JoystickManager::getInstance().update();
@@ -132,11 +167,17 @@ WindowImpl::WindowImpl() : m_joystickStatesImpl(std::make_unique<JoystickStatesI
     // Get the initial sensor states
     for (Vector3f& vec : m_sensorValue)
         vec = Vector3f(0, 0, 0);
+
+    // Only the changes of the monitors happening from now on are reported
+    m_monitorChanges = VideoModeImpl::getChangeCount();
 }
 
 
 ////////////////////////////////////////////////////////////
-WindowImpl::~WindowImpl() = default;
+WindowImpl::~WindowImpl()
+{
+    assert(!m_eventThread.joinable() && "The event thread must be stopped by the derived class destructor");
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -178,12 +219,10 @@ void WindowImpl::setMaximumSize(const std::optional<Vector2u>& maximumSize)
 Event WindowImpl::popEvent(bool block)
 {
     // If the event queue is empty, let's first check if new events are available from the OS
-    if (m_events.empty())
+    if (m_eventCount == 0)
     {
         // Get events from the system
-        processJoystickEvents();
-        processSensorEvents();
-        processEvents();
+        processAllEvents();
 
         // In blocking mode, we must process events until one is triggered
         if (block)
@@ -191,33 +230,321 @@ Event WindowImpl::popEvent(bool block)
             // Here we use a manual wait loop instead of the optimized
             // wait-event provided by the OS, so that we don't skip joystick
             // events (which require polling)
-            while (m_events.empty())
+            while (m_eventCount == 0)
             {
                 sleep(milliseconds(10));
-                processJoystickEvents();
-                processSensorEvents();
-                processEvents();
+                processAllEvents();
             }
         }
     }
 
     Event event;
+    popEvents(&event, 1);
+    return event;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t WindowImpl::popEvents(Event* events, std::size_t maxCount)
+{
+    if (m_eventCount == 0)
+        processAllEvents();
+
+    const std::size_t count = std::min(maxCount, m_eventCount);
+
+    // Copy the events out in at most two contiguous runs of the ring buffer
+    const std::size_t firstRun = std::min(count, m_events.size() - m_eventsBegin);
+    std::copy_n(m_events.begin() + static_cast<std::ptrdiff_t>(m_eventsBegin), firstRun, events);
+    std::copy_n(m_events.begin(), count - firstRun, events + firstRun);
+
+    m_eventsBegin = (m_eventsBegin + count) % m_events.size();
+    m_eventCount -= count;
 
-    // Pop the first event of the queue, if it is not empty
-    if (!m_events.empty())
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImpl::setEventThreadEnabled(bool enabled)
+{
+    if (enabled == m_eventThread.joinable())
+        return true;
+
+    if (enabled)
     {
-        event = m_events.front();
-        m_events.pop();
+        if (!supportsEventThread())
+            return false;
+
+        if (!m_threadedEvents)
+            m_threadedEvents = std::make_unique<ThreadedEventQueue>();
+
+        m_runEventThread = true;
+        m_eventThread    = std::thread(&WindowImpl::runEventThread, this);
     }
+    else
+    {
+        m_runEventThread = false;
+        m_eventThread.join();
 
-    return event;
+        // Don't lose the events handed over before the thread stopped
+        drainThreadedEvents();
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImpl::isEventThreadEnabled() const
+{
+    return m_eventThread.joinable();
+}
+
+
+////////////////////////////////////////////////////////////
+Time WindowImpl::getCurrentTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(ClockImpl::now().time_since_epoch());
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::setRawMouseBatchingEnabled(bool enabled)
+{
+    m_rawMouseBatching = enabled;
+
+    for (WindowBase::RawMouseInput& input : m_rawMouseInputs)
+    {
+        input.delta = {};
+        input.samples.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImpl::isRawMouseBatchingEnabled() const
+{
+    return m_rawMouseBatching;
+}
+
+
+////////////////////////////////////////////////////////////
+const WindowBase::RawMouseInput& WindowImpl::swapRawMouseInput()
+{
+    // The batch read last time becomes the one being gathered, keeping its storage
+    std::swap(m_rawMouseInputs[0], m_rawMouseInputs[1]);
+
+    WindowBase::RawMouseInput& gathered = m_rawMouseInputs[0];
+    gathered.delta                      = {};
+    gathered.samples.clear();
+
+    return m_rawMouseInputs[1];
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::pushRawMouseMovement(Vector2i delta)
+{
+    // The event thread can't touch the batches, which belong to the owner thread
+    if (!m_rawMouseBatching || WindowImplImpl::onEventThread)
+    {
+        pushEvent(Event::MouseMovedRaw{delta});
+        return;
+    }
+
+    WindowBase::RawMouseInput& gathered = m_rawMouseInputs[0];
+    gathered.delta += delta;
+    gathered.samples.push_back({delta, WindowImplImpl::systemEventTimestamp.value_or(getCurrentTimestamp())});
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::setTouchCoalescingEnabled(bool enabled)
+{
+    m_touchCoalescing = enabled;
+
+    for (WindowBase::TouchInput& input : m_touchInputs)
+    {
+        input.samples.clear();
+        input.predicted.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImpl::isTouchCoalescingEnabled() const
+{
+    return m_touchCoalescing;
+}
+
+
+////////////////////////////////////////////////////////////
+const WindowBase::TouchInput& WindowImpl::swapTouchInput()
+{
+    // The batch read last time becomes the one being gathered, keeping its storage
+    std::swap(m_touchInputs[0], m_touchInputs[1]);
+
+    WindowBase::TouchInput& gathered = m_touchInputs[0];
+    gathered.samples.clear();
+    gathered.predicted.clear();
+
+    return m_touchInputs[1];
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::pushTouchMovement(const WindowBase::TouchSample& sample, bool coalesced)
+{
+    // The event thread can't touch the batches, which belong to the owner thread
+    if (!m_touchCoalescing || WindowImplImpl::onEventThread)
+    {
+        if (!coalesced)
+            pushEvent(Event::TouchMoved{sample.finger, sample.position});
+        return;
+    }
+
+    // The predictions of the finger were made before this movement, they are outdated
+    WindowBase::TouchInput& gathered = m_touchInputs[0];
+    gathered.predicted.erase(std::remove_if(gathered.predicted.begin(),
+                                            gathered.predicted.end(),
+                                            [&sample](const WindowBase::TouchSample& predicted)
+                                            { return predicted.finger == sample.finger; }),
+                             gathered.predicted.end());
+    gathered.samples.push_back(sample);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::pushPredictedTouch(const WindowBase::TouchSample& sample)
+{
+    if (m_touchCoalescing && !WindowImplImpl::onEventThread)
+        m_touchInputs[0].predicted.push_back(sample);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::setSystemEventTimestamp(const std::optional<Time>& timestamp)
+{
+    WindowImplImpl::systemEventTimestamp = timestamp;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Time> WindowImpl::convertSystemTime(std::uint32_t eventTime, std::uint32_t currentTime)
+{
+    // Unsigned arithmetic handles the wrap-around of the system clock
+    const Time age = milliseconds(static_cast<std::int32_t>(currentTime - eventTime));
+
+    if ((age < Time::Zero) || (age > WindowImplImpl::maxSystemEventAge))
+        return std::nullopt;
+
+    return getCurrentTimestamp() - age;
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImpl::supportsEventThread() const
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::pushEvent(const Event& systemEvent)
+{
+    // Stamp the event when it is read, not when it is polled
+    Event event = systemEvent;
+    if (event.getTimestamp() == Time::Zero)
+        event.setTimestamp(WindowImplImpl::systemEventTimestamp.value_or(getCurrentTimestamp()));
+
+    if (WindowImplImpl::onEventThread)
+    {
+        // Wait for the owner thread to make room rather than dropping input
+        while (!m_threadedEvents->push(event))
+        {
+            if (!m_runEventThread)
+                return;
+
+            sleep(milliseconds(1));
+        }
+
+        return;
+    }
+
+    if (m_eventCount > 0)
+    {
+        // Only the latest position or size matters, merge consecutive updates
+        Event& last = m_events[(m_eventsBegin + m_eventCount - 1) % m_events.size()];
+        if ((event.is<Event::MouseMoved>() && last.is<Event::MouseMoved>()) ||
+            (event.is<Event::Resized>() && last.is<Event::Resized>()))
+        {
+            last = event;
+            return;
+        }
+    }
+
+    if (m_eventCount == m_events.size())
+    {
+        // The queue is full: drop the oldest event to make room
+        static bool warned = false;
+
+        if (!warned)
+        {
+            err() << "Event queue is full, dropping the oldest events (make sure to poll the events every frame)"
+                  << std::endl;
+
+            warned = true;
+        }
+
+        m_eventsBegin = (m_eventsBegin + 1) % m_events.size();
+        --m_eventCount;
+    }
+
+    m_events[(m_eventsBegin + m_eventCount) % m_events.size()] = event;
+    ++m_eventCount;
 }
 
 
 ////////////////////////////////////////////////////////////
-void WindowImpl::pushEvent(const Event& event)
+void WindowImpl::processAllEvents()
 {
-    m_events.push(event);
+    processJoystickEvents();
+    processSensorEvents();
+
+    if (m_eventThread.joinable())
+        drainThreadedEvents();
+    else
+    {
+        SFML_PROFILE_ZONE("sf::WindowImpl::processEvents");
+        processEvents();
+    }
+
+    processMonitorEvents();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::runEventThread()
+{
+    WindowImplImpl::onEventThread = true;
+
+    while (m_runEventThread)
+    {
+        {
+            SFML_PROFILE_ZONE("sf::WindowImpl::processEvents");
+            processEvents();
+        }
+        sleep(milliseconds(1));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::drainThreadedEvents()
+{
+    Event event;
+    while (m_threadedEvents->pop(event))
+        pushEvent(event);
 }
 
 
@@ -267,15 +594,25 @@ void WindowImpl::processJoystickEvents()
                 }
             }
 
-            // Buttons
+            // Buttons, including the presses and releases which happened between two updates
             for (unsigned int j = 0; j < caps.buttonCount; ++j)
             {
-                const bool prevPressed = previousState.buttons[j];
-                const bool currPressed = m_joystickStatesImpl->states[i].buttons[j];
-
-                if (prevPressed ^ currPressed)
+                const JoystickState& currentState = m_joystickStatesImpl->states[i];
+                const bool           prevPressed  = previousState.buttons[j];
+                const bool           currPressed  = currentState.buttons[j];
+
+                // Backends which don't count the transitions only report the
+                // current state: make the count consistent with the state change
+                std::uint32_t transitions = currentState.changes[j] - previousState.changes[j];
+                if ((transitions % 2) != (prevPressed != currPressed ? 1u : 0u))
+                    ++transitions;
+
+                bool pressed = prevPressed;
+                for (std::uint32_t k = 0; k < transitions; ++k)
                 {
-                    if (currPressed)
+                    pressed = !pressed;
+
+                    if (pressed)
                         pushEvent(Event::JoystickButtonPressed{i, j});
                     else
                         pushEvent(Event::JoystickButtonReleased{i, j});
@@ -311,6 +648,19 @@ void WindowImpl::processSensorEvents()
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImpl::processMonitorEvents()
+{
+    // The system events of any window may have invalidated the video modes, all the windows are told
+    const unsigned int changes = VideoModeImpl::getChangeCount();
+    if (changes != m_monitorChanges)
+    {
+        m_monitorChanges = changes;
+        pushEvent(Event::MonitorsChanged{});
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 bool WindowImpl::createVulkanSurface([[maybe_unused]] const VkInstance&            instance,
                                      [[maybe_unused]] VkSurfaceKHR&                surface,
@@ -37,18 +37,25 @@
 #include <SFML/Window/SensorImpl.hpp>
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/Vulkan.hpp>
+#include <SFML/Window/WindowBase.hpp>
 #include <SFML/Window/WindowEnums.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 
+#include <SFML/System/Allocator.hpp>
 #include <SFML/System/EnumArray.hpp>
+#include <SFML/System/SpscQueue.hpp>
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
-#include <queue>
+#include <thread>
+#include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -137,6 +144,100 @@ public:
     ////////////////////////////////////////////////////////////
     Event popEvent(bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop up to \a maxCount events from the event queue
+    ///
+    /// If there's no event available, this function calls the
+    /// window's internal event processing function once.
+    /// It never blocks.
+    ///
+    /// \param events   Array receiving the events, oldest first
+    /// \param maxCount Maximum number of events to pop
+    ///
+    /// \return Number of events written to \a events
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t popEvents(Event* events, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the processing of system events on a dedicated thread
+    ///
+    /// When enabled, processEvents() is called continuously by
+    /// an event thread which hands the events over to the owner
+    /// thread through a lock-free queue. Joystick and sensor
+    /// events are still polled by the owner thread.
+    ///
+    /// \param enabled True to start the event thread, false to stop it
+    ///
+    /// \return True if the event thread is in the requested state, false if not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setEventThreadEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether system events are processed on a dedicated thread
+    ///
+    /// \return True if the event thread is running
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEventThreadEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current time on the clock used to timestamp events
+    ///
+    /// \return Current time, with the same origin as sf::Event::getTimestamp
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Time getCurrentTimestamp();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the batching of raw mouse movements
+    ///
+    /// \param enabled True to accumulate the raw mouse movements instead of pushing events
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRawMouseBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether raw mouse movements are batched
+    ///
+    /// \return True if raw mouse batching is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isRawMouseBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a new raw mouse batch and return the previous one
+    ///
+    /// \return Raw movements accumulated since the previous call
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const WindowBase::RawMouseInput& swapRawMouseInput();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the coalescing of touch movements
+    ///
+    /// \param enabled True to accumulate the touch movements instead of pushing events
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTouchCoalescingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether touch movements are coalesced
+    ///
+    /// \return True if touch coalescing is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isTouchCoalescingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a new touch batch and return the previous one
+    ///
+    /// \return Touch movements accumulated since the previous call
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const WindowBase::TouchInput& swapTouchInput();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the OS-specific handle of the window
     ///
@@ -311,17 +412,103 @@ protected:
     /// notify the SFML window that a new event was triggered
     /// by the system.
     ///
+    /// A MouseMoved or Resized event directly following an event
+    /// of the same type replaces it, since only the latest value
+    /// matters. If the queue is full, the oldest event is dropped.
+    ///
     /// \param event Event to push
     ///
     ////////////////////////////////////////////////////////////
     void pushEvent(const Event& event);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the timestamp of the events pushed by the calling thread
+    ///
+    /// Derived classes call this function with the time provided
+    /// by the operating system for the event being processed,
+    /// and with an empty optional once it is processed. Events
+    /// pushed without a timestamp are stamped with the current time.
+    ///
+    /// \param timestamp Timestamp of the system event, as returned by getCurrentTimestamp()
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setSystemEventTimestamp(const std::optional<Time>& timestamp);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push a raw mouse movement
+    ///
+    /// Derived classes use this function instead of pushing
+    /// sf::Event::MouseMovedRaw events, so that the movements are
+    /// accumulated when raw mouse batching is enabled.
+    ///
+    /// \param delta Raw movement of the mouse
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushRawMouseMovement(Vector2i delta);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push a touch movement
+    ///
+    /// Derived classes use this function instead of pushing
+    /// sf::Event::TouchMoved events, so that the movements are
+    /// accumulated when touch coalescing is enabled. Coalesced
+    /// samples are the intermediate positions that the system
+    /// gathered since the previous movement of the finger; they
+    /// are dropped when touch coalescing is disabled.
+    ///
+    /// \param sample    Movement of the finger
+    /// \param coalesced True for an intermediate sample, false for the current position of the finger
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushTouchMovement(const WindowBase::TouchSample& sample, bool coalesced);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push a touch movement predicted by the system
+    ///
+    /// The predictions of a finger are replaced by its next
+    /// movement. They are dropped when touch coalescing is
+    /// disabled.
+    ///
+    /// \param sample Predicted movement of the finger
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushPredictedTouch(const WindowBase::TouchSample& sample);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a time of a 32-bit millisecond system clock to an event timestamp
+    ///
+    /// Many windowing systems timestamp their events with a
+    /// millisecond counter which wraps around every 49.7 days.
+    /// The conversion uses the age of the event on that clock,
+    /// so that the origin of the system clock doesn't matter.
+    ///
+    /// \param eventTime   Time of the event on the system clock, in milliseconds
+    /// \param currentTime Current time on the system clock, in milliseconds
+    ///
+    /// \return Timestamp of the event, or an empty optional if the event time is implausible
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<Time> convertSystemTime(std::uint32_t eventTime, std::uint32_t currentTime);
+
     ////////////////////////////////////////////////////////////
     /// \brief Process incoming events from the operating system
     ///
     ////////////////////////////////////////////////////////////
     virtual void processEvents() = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether processEvents() may be called from another thread
+    ///
+    /// Most windowing systems require events to be processed by
+    /// the thread that owns the window, so the default
+    /// implementation returns false. Backends returning true must
+    /// stop the event thread in their destructor.
+    ///
+    /// \return True if the event thread is supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool supportsEventThread() const;
+
 private:
     struct JoystickStatesImpl;
 
@@ -337,12 +524,50 @@ private:
     ////////////////////////////////////////////////////////////
     void processSensorEvents();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Generate an event if the monitors changed since the last call
+    ///
+    ////////////////////////////////////////////////////////////
+    void processMonitorEvents();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process the joystick, sensor and system events
+    ///
+    ////////////////////////////////////////////////////////////
+    void processAllEvents();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function run by the event thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void runEventThread();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the events pushed by the event thread to the event queue
+    ///
+    ////////////////////////////////////////////////////////////
+    void drainThreadedEvents();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::queue<Event>                                m_events;             //!< Queue of available events
+    static constexpr std::size_t EventQueueCapacity{1024}; //!< Maximum number of events queued between two polls
+    using ThreadedEventQueue = SpscQueue<Event, EventQueueCapacity>;
+    using EventBuffer        = Vector<Event, MemoryModule::Window>;
+
+    EventBuffer                                      m_events;             //!< Ring buffer of available events
+    std::size_t                                      m_eventsBegin{};      //!< Index of the oldest queued event
+    std::size_t                                      m_eventCount{};       //!< Number of events in the ring buffer
+    std::unique_ptr<ThreadedEventQueue>              m_threadedEvents;     //!< Events handed over by the event thread
+    std::thread                                      m_eventThread;        //!< Thread processing the system events
+    std::atomic<bool>                                m_runEventThread{};   //!< Whether the event thread should go on
+    std::array<WindowBase::RawMouseInput, 2>         m_rawMouseInputs;     //!< Raw mouse batch being gathered, last read
+    bool                                             m_rawMouseBatching{}; //!< Whether raw mouse movements are batched
+    std::array<WindowBase::TouchInput, 2>            m_touchInputs;        //!< Touch batch being gathered, last read
+    bool                                             m_touchCoalescing{};  //!< Whether touch movements are coalesced
     std::unique_ptr<JoystickStatesImpl>              m_joystickStatesImpl; //!< Previous state of the joysticks (PImpl)
     EnumArray<Sensor::Type, Vector3f, Sensor::Count> m_sensorValue;        //!< Previous value of the sensors
+    unsigned int                                     m_monitorChanges{};   //!< Changes of the monitors already reported
     float m_joystickThreshold{0.1f}; //!< Joystick threshold (minimum motion for "move" event to be generated)
     std::array<EnumArray<Joystick::Axis, float, Joystick::AxisCount>, Joystick::Count>
         m_previousAxes{}; //!< Position of each axis last time a move event triggered, in range [-100, 100]
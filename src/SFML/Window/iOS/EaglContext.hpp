@@ -35,10 +35,13 @@
 
 #include <glad/gl.h>
 
+#include <cstdint>
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
 SFML_DECLARE_OBJC_CLASS(EAGLContext);
+SFML_DECLARE_OBJC_CLASS(SFDisplayLink);
 SFML_DECLARE_OBJC_CLASS(SFView);
 
 namespace sf::priv
@@ -127,6 +130,47 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when displaying a frame
+    ///
+    /// \param interval Number of vertical blanks, negative intervals are not supported
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pace the displayed frames to a target frame rate
+    ///
+    /// The rate is requested from the display link, which lets
+    /// ProMotion screens refresh at that rate.
+    ///
+    /// \param frameRate Target number of frames per second, 0 to use the rate of the screen
+    ///
+    /// \return True if the frames are paced, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTargetFrameRate(unsigned int frameRate) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a given time before the next vertical blank
+    ///
+    /// \param delay Time to leave before the vertical blank
+    ///
+    /// \return True if the function waited, false if no vertical blank was reported yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool delayBeforeSwap(Time delay) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if no vertical blank was reported yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Activate the context as the current target
@@ -154,15 +198,29 @@ private:
                        unsigned int           bitsPerPixel,
                        const ContextSettings& settings);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next vertical blank reported by the display link
+    ///
+    /// \param nextVsync Filled with the time of the next vertical blank
+    /// \param period    Filled with the time between two vertical blanks
+    ///
+    /// \return True if the display link reported a vertical blank, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool getNextVsync(double& nextVsync, double& period) const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    EAGLContext* m_context;        ///< The internal context
-    GLuint       m_framebuffer{};  ///< Frame buffer associated to the context
-    GLuint       m_colorbuffer{};  ///< Color render buffer
-    GLuint       m_depthbuffer{};  ///< Depth render buffer
-    bool         m_vsyncEnabled{}; ///< Vertical sync activation flag
-    Clock        m_clock;          ///< Measures the elapsed time for the fake v-sync implementation
+    EAGLContext*   m_context;        ///< The internal context
+    GLuint         m_framebuffer{};  ///< Frame buffer associated to the context
+    GLuint         m_colorbuffer{};  ///< Color render buffer
+    GLuint         m_depthbuffer{};  ///< Depth render buffer
+    SFDisplayLink* m_displayLink{};  ///< Reports the vertical blanks of the screen
+    int            m_swapInterval{}; ///< Number of vertical blanks each frame stays on screen
+    double         m_nextFrame{};    ///< Time the next frame is scheduled for, measured by CACurrentMediaTime
+    std::uint64_t  m_swapCount{};    ///< Number of frames displayed
+    Clock          m_clock;          ///< Measures the elapsed time when no vertical blank is reported
 };
 
 } // namespace sf::priv
@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/iOS/EaglContext.hpp>
+#include <SFML/Window/iOS/SFDisplayLink.hpp>
 #include <SFML/Window/iOS/SFView.hpp>
 #include <SFML/Window/iOS/WindowImplUIKit.hpp>
 
@@ -36,6 +37,8 @@
 #include <OpenGLES/EAGL.h>
 #include <OpenGLES/EAGLDrawable.h>
 #include <QuartzCore/CAEAGLLayer.h>
+#include <algorithm>
+#include <cmath>
 #include <dlfcn.h>
 #include <ostream>
 
@@ -134,6 +137,9 @@ EaglContext::~EaglContext()
     // Notify unshared OpenGL resources of context destruction
     cleanupUnsharedResources();
 
+    // The display link keeps a reference to its target until it is invalidated
+    [m_displayLink invalidate];
+
     if (m_context)
     {
         // Activate the context, so that we can destroy the buffers
@@ -251,23 +257,113 @@ void EaglContext::display()
 {
     glBindRenderbufferOESFunc(GL_RENDERBUFFER_OES, m_colorbuffer);
     [m_context presentRenderbuffer:GL_RENDERBUFFER_OES];
-
-    // The proper way of doing v-sync on iOS would be to use CADisplayLink
-    // notifications, but it is not compatible with the way SFML is designed;
-    // therefore we fake it with a manual framerate limit
-    if (m_vsyncEnabled)
+    ++m_swapCount;
+
+    if (m_swapInterval <= 0)
+        return;
+
+    // Presenting doesn't wait for the vertical blank, so the frames are paced on the vertical
+    // blanks reported by the display link: each frame starts one interval after the previous
+    // one, but never before the next vertical blank, so that a late frame shifts the schedule
+    // instead of shortening the next frame
+    double nextVsync = 0;
+    double period    = 0;
+    if (getNextVsync(nextVsync, period))
     {
-        constexpr Time frameDuration = seconds(1.f / 60.f);
-        sleep(frameDuration - m_clock.getElapsedTime());
-        m_clock.restart();
+        const double now = CACurrentMediaTime();
+        m_nextFrame      = std::max(m_nextFrame + static_cast<double>(m_swapInterval) * period, nextVsync);
+        sleep(seconds(static_cast<float>(m_nextFrame - now)));
+        return;
     }
+
+    // No vertical blank was reported yet, fall back to a framerate limit at the rate of the screen
+    const auto refreshRate   = static_cast<float>(std::max<NSInteger>([UIScreen mainScreen].maximumFramesPerSecond, 1));
+    const Time frameDuration = seconds(static_cast<float>(m_swapInterval) / refreshRate);
+    sleep(frameDuration - m_clock.getElapsedTime());
+    m_clock.restart();
 }
 
 
 ////////////////////////////////////////////////////////////
 void EaglContext::setVerticalSyncEnabled(bool enabled)
 {
-    m_vsyncEnabled = enabled;
+    m_swapInterval = enabled ? 1 : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool EaglContext::setSwapInterval(int interval)
+{
+    // There is no tearing to trade for latency, frames are always displayed on vertical blanks
+    if (interval < 0)
+        return false;
+
+    m_swapInterval = interval;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool EaglContext::setTargetFrameRate(unsigned int frameRate)
+{
+    if (!m_displayLink)
+        return false;
+
+    // The display link reports vertical blanks at the requested rate, one frame is displayed for each
+    [m_displayLink setFrameRate:static_cast<float>(frameRate)];
+    m_swapInterval = 1;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool EaglContext::delayBeforeSwap(Time delay)
+{
+    double nextVsync = 0;
+    double period    = 0;
+    if (!getNextVsync(nextVsync, period))
+        return false;
+
+    double wait = nextVsync - delay.asSeconds() - CACurrentMediaTime();
+    if (wait < 0)
+        wait += period;
+
+    sleep(seconds(static_cast<float>(wait)));
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> EaglContext::getPresentTiming()
+{
+    CFTimeInterval lastVsync = 0;
+    CFTimeInterval period    = 0;
+    if (!m_displayLink || ![m_displayLink getLastVsync:&lastVsync period:&period])
+        return std::nullopt;
+
+    const auto refreshRate = static_cast<double>([UIScreen mainScreen].maximumFramesPerSecond);
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank  = microseconds(static_cast<std::int64_t>(lastVsync * 1'000'000));
+    timing.verticalBlankCount = static_cast<std::uint64_t>(
+        std::llround((lastVsync - m_displayLink.firstTimestamp) * refreshRate));
+    timing.swapCount   = m_swapCount;
+    timing.refreshRate = static_cast<float>(refreshRate);
+    return timing;
+}
+
+
+////////////////////////////////////////////////////////////
+bool EaglContext::getNextVsync(double& nextVsync, double& period) const
+{
+    CFTimeInterval lastVsync = 0;
+    if (!m_displayLink || ![m_displayLink getLastVsync:&lastVsync period:&period] || (period <= 0))
+        return false;
+
+    // The display link only reports vertical blanks when the main run loop runs, extrapolate the missed ones
+    const double elapsed = std::max(CACurrentMediaTime() - lastVsync, 0.0);
+    nextVsync            = lastVsync + (std::floor(elapsed / period) + 1) * period;
+    return true;
 }
 
 
@@ -311,6 +407,9 @@ void EaglContext::createContext(EaglContext*           shared,
     // Attach the context to the GL view for future updates
     window.getGlView().context = this;
 
+    // Track the vertical blanks of the screen, to pace the frames
+    m_displayLink = [[SFDisplayLink alloc] init];
+
     // Deactivate it
     makeCurrent(false);
 }
@@ -90,6 +90,24 @@ bool isMouseButtonPressed(Mouse::Button /* button */)
 }
 
 
+////////////////////////////////////////////////////////////
+void getKeyboardState(std::bitset<Keyboard::KeyCount>& keys, std::bitset<Keyboard::ScancodeCount>& scancodes)
+{
+    // Not applicable
+    keys.reset();
+    scancodes.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void getMouseState(std::bitset<Mouse::ButtonCount>& buttons, Vector2i& position, const WindowBase* /* relativeTo */)
+{
+    // Not applicable
+    buttons.reset();
+    position = {};
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i getMousePosition()
 {
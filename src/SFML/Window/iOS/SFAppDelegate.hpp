@@ -78,11 +78,26 @@
 ////////////////////////////////////////////////////////////
 /// \brief Receive an external touch move notification
 ///
-/// \param index    Finger index
-/// \param position Position of the touch
+/// \param index     Finger index
+/// \param position  Position of the touch
+/// \param timestamp Time of the touch, since the system was started
+/// \param coalesced YES for a sample coalesced into the current touch, NO for the current touch
+///
+////////////////////////////////////////////////////////////
+- (void)notifyTouchMove:(unsigned int)index
+             atPosition:(sf::Vector2i)position
+              timestamp:(NSTimeInterval)timestamp
+              coalesced:(BOOL)coalesced;
+
+////////////////////////////////////////////////////////////
+/// \brief Receive an external predicted touch notification
+///
+/// \param index     Finger index
+/// \param position  Predicted position of the touch
+/// \param timestamp Predicted time of the touch, since the system was started
 ///
 ////////////////////////////////////////////////////////////
-- (void)notifyTouchMove:(unsigned int)index atPosition:(sf::Vector2i)position;
+- (void)notifyPredictedTouch:(unsigned int)index atPosition:(sf::Vector2i)position timestamp:(NSTimeInterval)timestamp;
 
 ////////////////////////////////////////////////////////////
 /// \brief Receive an external touch end notification
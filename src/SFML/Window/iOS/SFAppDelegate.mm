@@ -30,6 +30,8 @@
 
 #include <vector>
 
+#include <cstdint>
+
 
 namespace
 {
@@ -38,6 +40,13 @@ SFAppDelegate* delegateInstance = nullptr;
 
 // Current touches positions
 std::vector<sf::Vector2i> touchPositions;
+
+// Convert the time of a touch, measured since the system was started, to an event timestamp
+sf::Time toEventTimestamp(NSTimeInterval timestamp)
+{
+    const NSTimeInterval age = [NSProcessInfo processInfo].systemUptime - timestamp;
+    return sf::priv::WindowImpl::getCurrentTimestamp() - sf::microseconds(static_cast<std::int64_t>(age * 1'000'000));
+}
 }
 
 
@@ -258,19 +267,36 @@ std::vector<sf::Vector2i> touchPositions;
 
 
 ////////////////////////////////////////////////////////////
-- (void)notifyTouchMove:(unsigned int)index atPosition:(sf::Vector2i)position
+- (void)notifyTouchMove:(unsigned int)index
+             atPosition:(sf::Vector2i)position
+              timestamp:(NSTimeInterval)timestamp
+              coalesced:(BOOL)coalesced
 {
     position.x *= static_cast<int>(backingScaleFactor);
     position.y *= static_cast<int>(backingScaleFactor);
 
     // save the touch position
-    if (index >= touchPositions.size())
-        touchPositions.resize(index + 1, sf::Vector2i(-1, -1));
-    touchPositions[index] = position;
+    if (!coalesced)
+    {
+        if (index >= touchPositions.size())
+            touchPositions.resize(index + 1, sf::Vector2i(-1, -1));
+        touchPositions[index] = position;
+    }
+
+    // notify the movement to the application window, which turns it into an event unless touches are coalesced
+    if (self.sfWindow)
+        sfWindow->forwardTouchMovement({index, position, toEventTimestamp(timestamp)}, coalesced);
+}
+
+
+////////////////////////////////////////////////////////////
+- (void)notifyPredictedTouch:(unsigned int)index atPosition:(sf::Vector2i)position timestamp:(NSTimeInterval)timestamp
+{
+    position.x *= static_cast<int>(backingScaleFactor);
+    position.y *= static_cast<int>(backingScaleFactor);
 
-    // notify the event to the application window
     if (self.sfWindow)
-        sfWindow->forwardEvent(sf::Event::TouchMoved{index, position});
+        sfWindow->forwardPredictedTouch({index, position, toEventTimestamp(timestamp)});
 }
 
 
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <QuartzCore/CADisplayLink.h>
+#include <UIKit/UIKit.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Tracks the vertical blanks of the main screen
+///
+/// The display link is scheduled on the main run loop, which
+/// is run when the events of the window are processed; the
+/// vertical blanks which are missed in between are
+/// extrapolated from the last one.
+///
+////////////////////////////////////////////////////////////
+@interface SFDisplayLink : NSObject
+
+////////////////////////////////////////////////////////////
+/// \brief Create the display link and start tracking vertical blanks
+///
+/// \return Id of the display link
+///
+////////////////////////////////////////////////////////////
+- (id)init;
+
+////////////////////////////////////////////////////////////
+/// \brief Stop tracking vertical blanks
+///
+/// Must be called before the object is released, since the
+/// display link keeps a reference to it.
+///
+////////////////////////////////////////////////////////////
+- (void)invalidate;
+
+////////////////////////////////////////////////////////////
+/// \brief Set the rate at which the vertical blanks are reported
+///
+/// On ProMotion screens (iOS 15), this also lets the system
+/// drive the screen at the requested rate.
+///
+/// \param frameRate Number of vertical blanks per second, 0 to use the rate of the screen
+///
+////////////////////////////////////////////////////////////
+- (void)setFrameRate:(float)frameRate;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the time of the last vertical blank and the duration of a frame
+///
+/// Times are measured by CACurrentMediaTime.
+///
+/// \param timestamp Filled with the time of the last vertical blank
+/// \param period    Filled with the time between two reported vertical blanks
+///
+/// \return True if a vertical blank was reported, false otherwise
+///
+////////////////////////////////////////////////////////////
+- (BOOL)getLastVsync:(CFTimeInterval*)timestamp period:(CFTimeInterval*)period;
+
+////////////////////////////////////////////////////////////
+// Member data
+////////////////////////////////////////////////////////////
+@property(nonatomic, readonly) CFTimeInterval firstTimestamp; ///< Time of the first vertical blank reported
+
+@end
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/iOS/SFDisplayLink.hpp>
+
+
+@interface SFDisplayLink ()
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+@property (nonatomic) CADisplayLink* link;
+// NOLINTNEXTLINE(readability-identifier-naming)
+@property (nonatomic) CFTimeInterval lastTimestamp;
+// NOLINTNEXTLINE(readability-identifier-naming)
+@property (nonatomic) CFTimeInterval period;
+
+@end
+
+
+@implementation SFDisplayLink
+
+@synthesize firstTimestamp;
+
+
+////////////////////////////////////////////////////////////
+- (id)init
+{
+    self = [super init];
+
+    if (self)
+    {
+        self.link = [CADisplayLink displayLinkWithTarget:self selector:@selector(handleVsync:)];
+        [self.link addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSDefaultRunLoopMode];
+    }
+
+    return self;
+}
+
+
+////////////////////////////////////////////////////////////
+- (void)invalidate
+{
+    [self.link invalidate];
+    self.link = nil;
+}
+
+
+////////////////////////////////////////////////////////////
+- (void)setFrameRate:(float)frameRate
+{
+#if defined(__IPHONE_15_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_15_0)
+    if (@available(iOS 15.0, *))
+    {
+        // Ask for the exact rate, ProMotion screens then refresh at that rate instead of the link skipping refreshes
+        self.link.preferredFrameRateRange = (frameRate > 0) ? CAFrameRateRangeMake(frameRate, frameRate, frameRate)
+                                                            : CAFrameRateRangeDefault;
+        return;
+    }
+#endif
+
+    self.link.preferredFramesPerSecond = static_cast<NSInteger>(frameRate);
+}
+
+
+////////////////////////////////////////////////////////////
+- (BOOL)getLastVsync:(CFTimeInterval*)timestamp period:(CFTimeInterval*)period
+{
+    *timestamp = self.lastTimestamp;
+    *period    = self.period;
+
+    return self.lastTimestamp > 0;
+}
+
+
+////////////////////////////////////////////////////////////
+- (void)handleVsync:(CADisplayLink*)sender
+{
+    if (firstTimestamp == 0)
+        firstTimestamp = sender.timestamp;
+
+    // The duration of the frame follows the rate chosen by the system, which varies on ProMotion screens
+    self.lastTimestamp = sender.timestamp;
+    self.period        = sender.targetTimestamp - sender.timestamp;
+}
+
+@end
@@ -123,12 +123,43 @@
         NSUInteger index = [self.touches indexOfObject:touch];
         if (index != NSNotFound)
         {
-            // get the touch position
-            CGPoint      point = [touch locationInView:self];
-            sf::Vector2i position(static_cast<int>(point.x), static_cast<int>(point.y));
-
-            // notify the application delegate
-            [[SFAppDelegate getInstance] notifyTouchMove:(static_cast<unsigned int>(index)) atPosition:position];
+            const auto finger = static_cast<unsigned int>(index);
+
+            // notify the application delegate of the touches coalesced into this one,
+            // the last of them being the touch itself, then of the predicted touches
+            NSArray<UITouch*>* const coalescedTouches = [event coalescedTouchesForTouch:touch];
+            const NSUInteger         coalescedCount   = coalescedTouches.count;
+            for (NSUInteger i = 0; i < coalescedCount; ++i)
+            {
+                UITouch* const sample = coalescedTouches[i];
+                const CGPoint  point  = [sample locationInView:self];
+                [[SFAppDelegate getInstance] notifyTouchMove:finger
+                                                  atPosition:sf::Vector2i(static_cast<int>(point.x),
+                                                                          static_cast<int>(point.y))
+                                                   timestamp:sample.timestamp
+                                                   coalesced:(i + 1 < coalescedCount)];
+            }
+
+            // coalesced touches are not available for touches which were not delivered by an event
+            if (coalescedCount == 0)
+            {
+                const CGPoint point = [touch locationInView:self];
+                [[SFAppDelegate getInstance] notifyTouchMove:finger
+                                                  atPosition:sf::Vector2i(static_cast<int>(point.x),
+                                                                          static_cast<int>(point.y))
+                                                   timestamp:touch.timestamp
+                                                   coalesced:NO];
+            }
+
+            NSArray<UITouch*>* const predictedTouches = [event predictedTouchesForTouch:touch];
+            for (UITouch* predicted in predictedTouches) // NOLINT(cppcoreguidelines-init-variables)
+            {
+                const CGPoint point = [predicted locationInView:self];
+                [[SFAppDelegate getInstance] notifyPredictedTouch:finger
+                                                       atPosition:sf::Vector2i(static_cast<int>(point.x),
+                                                                               static_cast<int>(point.y))
+                                                        timestamp:predicted.timestamp];
+            }
         }
     }
 }
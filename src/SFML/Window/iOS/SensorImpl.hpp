@@ -93,12 +93,45 @@ public:
     ////////////////////////////////////////////////////////////
     void setEnabled(bool enabled);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the batching of the samples
+    ///
+    /// \param enabled          True to keep every sample
+    /// \param samplingPeriod   Time between two samples, zero to use the fastest rate
+    /// \param maxReportLatency Ignored, the samples are delivered to a background queue
+    ///
+    /// \return True on success, false if batching is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setBatching(bool enabled, Time samplingPeriod, Time maxReportLatency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the samples measured since the previous call
+    ///
+    /// \param samples Vector to append the samples to
+    ///
+    ////////////////////////////////////////////////////////////
+    void readSamples(std::vector<Sensor::Sample>& samples);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the updates of the sensor
+    ///
+    ////////////////////////////////////////////////////////////
+    void start();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the updates of the sensor
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Sensor::Type m_sensor;  ///< Type of the sensor
-    bool         m_enabled; ///< Enable state of the sensor
+    Sensor::Type m_sensor;    ///< Type of the sensor
+    bool         m_enabled;   ///< Enable state of the sensor
+    bool         m_batched{}; ///< Are the samples delivered to the sample queue?
 };
 
 } // namespace sf::priv
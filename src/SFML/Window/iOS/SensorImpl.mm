@@ -22,6 +22,7 @@
 //
 ////////////////////////////////////////////////////////////
 
+
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
@@ -29,12 +30,132 @@
 #include <SFML/Window/iOS/SFAppDelegate.hpp>
 
 #include <SFML/System/Angle.hpp>
+#include <SFML/System/EnumArray.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
 
 
 namespace
 {
-unsigned int deviceMotionEnabledCount = 0;
+// Sampling state, only accessed by the thread which updates the sensors
+sf::priv::EnumArray<sf::Sensor::Type, bool, sf::Sensor::Count>           sensorRunning;
+sf::priv::EnumArray<sf::Sensor::Type, NSTimeInterval, sf::Sensor::Count> sensorIntervals;
+bool                                                                     deviceMotionQueued = false;
+NSOperationQueue*                                                        sampleQueue        = nil;
+
+// Values delivered by Core Motion to the sample queue
+std::mutex                                                                                sampleMutex;
+sf::priv::EnumArray<sf::Sensor::Type, bool, sf::Sensor::Count>                            sensorBatched;
+sf::priv::EnumArray<sf::Sensor::Type, sf::Vector3f, sf::Sensor::Count>                    latestValues;
+sf::priv::EnumArray<sf::Sensor::Type, std::vector<sf::Sensor::Sample>, sf::Sensor::Count> pendingSamples;
+
+// Default refresh rate of the sensors which are not batched
+constexpr NSTimeInterval defaultInterval = 1. / 60.;
+
+
+////////////////////////////////////////////////////////////
+bool isDeviceMotion(sf::Sensor::Type sensor)
+{
+    return (sensor == sf::Sensor::Type::Gravity) || (sensor == sf::Sensor::Type::UserAcceleration) ||
+           (sensor == sf::Sensor::Type::Orientation);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Vector3f toVector(double x, double y, double z, double scale = 1.)
+{
+    return {static_cast<float>(x * scale), static_cast<float>(y * scale), static_cast<float>(z * scale)};
+}
+
+
+////////////////////////////////////////////////////////////
+void pushSample(sf::Sensor::Type sensor, const sf::Vector3f& value, NSTimeInterval timestamp)
+{
+    const std::lock_guard lock(sampleMutex);
+
+    latestValues[sensor] = value;
+
+    // Core Motion timestamps are measured since the device was booted
+    if (sensorBatched[sensor])
+        pendingSamples[sensor].push_back({value, sf::microseconds(static_cast<std::int64_t>(timestamp * 1'000'000))});
+}
+
+
+////////////////////////////////////////////////////////////
+NSOperationQueue* getSampleQueue()
+{
+    // A serial background queue, so that the samples are delivered in order without waking the main thread
+    if (sampleQueue == nil)
+    {
+        sampleQueue                             = [[NSOperationQueue alloc] init];
+        sampleQueue.maxConcurrentOperationCount = 1;
+    }
+
+    return sampleQueue;
+}
+
+
+////////////////////////////////////////////////////////////
+void updateDeviceMotion()
+{
+    // Gravity, user acceleration and orientation share the device motion updates,
+    // which are delivered to the sample queue as soon as one of them is batched
+    CMMotionManager* const manager = [SFAppDelegate getInstance].motionManager;
+
+    bool           running  = false;
+    bool           queued   = false;
+    NSTimeInterval interval = defaultInterval;
+    for (unsigned int i = 0; i < sf::Sensor::Count; ++i)
+    {
+        const auto sensor = static_cast<sf::Sensor::Type>(i);
+        if (!isDeviceMotion(sensor) || !sensorRunning[sensor])
+            continue;
+
+        running  = true;
+        queued   = queued || sensorBatched[sensor];
+        interval = std::min(interval, sensorIntervals[sensor]);
+    }
+
+    if (manager.deviceMotionActive)
+        [manager stopDeviceMotionUpdates];
+
+    deviceMotionQueued = running && queued;
+    if (!running)
+        return;
+
+    manager.deviceMotionUpdateInterval = interval;
+
+    if (!deviceMotionQueued)
+    {
+        [manager startDeviceMotionUpdates];
+        return;
+    }
+
+    [manager startDeviceMotionUpdatesToQueue:getSampleQueue()
+                                 withHandler:^(CMDeviceMotion* motion, NSError* /* error */) {
+                                   if (!motion)
+                                       return;
+
+                                   // Accelerations are given in G, convert to m/s^2
+                                   const CMAcceleration gravity = motion.gravity;
+                                   const CMAcceleration user    = motion.userAcceleration;
+                                   const CMAttitude*    attitude = motion.attitude;
+                                   pushSample(sf::Sensor::Type::Gravity,
+                                              toVector(gravity.x, gravity.y, gravity.z, 9.81),
+                                              motion.timestamp);
+                                   pushSample(sf::Sensor::Type::UserAcceleration,
+                                              toVector(user.x, user.y, user.z, 9.81),
+                                              motion.timestamp);
+                                   pushSample(sf::Sensor::Type::Orientation,
+                                              toVector(attitude.yaw, attitude.pitch, attitude.roll),
+                                              motion.timestamp);
+                                 }];
 }
+} // namespace
 
 
 namespace sf::priv
@@ -87,31 +208,8 @@ bool SensorImpl::open(Sensor::Type sensor)
     // The sensor is disabled by default
     m_enabled = false;
 
-    // Set the refresh rate (use the maximum allowed)
-    constexpr NSTimeInterval updateInterval = 1. / 60.;
-    switch (sensor)
-    {
-        case Sensor::Type::Accelerometer:
-            [SFAppDelegate getInstance].motionManager.accelerometerUpdateInterval = updateInterval;
-            break;
-
-        case Sensor::Type::Gyroscope:
-            [SFAppDelegate getInstance].motionManager.gyroUpdateInterval = updateInterval;
-            break;
-
-        case Sensor::Type::Magnetometer:
-            [SFAppDelegate getInstance].motionManager.magnetometerUpdateInterval = updateInterval;
-            break;
-
-        case Sensor::Type::Gravity:
-        case Sensor::Type::UserAcceleration:
-        case Sensor::Type::Orientation:
-            [SFAppDelegate getInstance].motionManager.deviceMotionUpdateInterval = updateInterval;
-            break;
-
-        default:
-            break;
-    }
+    // Use the default refresh rate until batching is enabled
+    sensorIntervals[sensor] = defaultInterval;
 
     return true;
 }
@@ -127,6 +225,13 @@ void SensorImpl::close()
 ////////////////////////////////////////////////////////////
 Vector3f SensorImpl::update()
 {
+    // Sensors delivered to the sample queue don't update the data of the motion manager
+    if (m_batched || (isDeviceMotion(m_sensor) && deviceMotionQueued))
+    {
+        const std::lock_guard lock(sampleMutex);
+        return latestValues[m_sensor];
+    }
+
     Vector3f               value;
     CMMotionManager* const manager = [SFAppDelegate getInstance].motionManager;
 
@@ -182,54 +287,165 @@ void SensorImpl::setEnabled(bool enabled)
     if (enabled == m_enabled)
         return;
 
+    if (enabled)
+        start();
+    else
+        stop();
+
+    // Update the enable state
+    m_enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SensorImpl::setBatching(bool enabled, Time samplingPeriod, Time /* maxReportLatency */)
+{
+    // The samples are delivered one by one to the sample queue,
+    // which runs in the background instead of the main thread
+    if (m_enabled)
+        stop();
+
+    {
+        const std::lock_guard lock(sampleMutex);
+        sensorBatched[m_sensor] = enabled;
+        pendingSamples[m_sensor].clear();
+    }
+
+    // Intervals shorter than the fastest rate of the sensor are clamped by Core Motion
+    m_batched                 = enabled;
+    sensorIntervals[m_sensor] = enabled ? static_cast<NSTimeInterval>(samplingPeriod.asSeconds()) : defaultInterval;
+
+    if (m_enabled)
+        start();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SensorImpl::readSamples(std::vector<Sensor::Sample>& samples)
+{
+    const std::lock_guard lock(sampleMutex);
+
+    std::vector<Sensor::Sample>& pending = pendingSamples[m_sensor];
+    samples.insert(samples.end(), pending.begin(), pending.end());
+    pending.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void SensorImpl::start()
+{
+    CMMotionManager* const manager  = [SFAppDelegate getInstance].motionManager;
+    const NSTimeInterval   interval = sensorIntervals[m_sensor];
+
+    sensorRunning[m_sensor] = true;
+
     switch (m_sensor)
     {
         case Sensor::Type::Accelerometer:
-            if (enabled)
-                [[SFAppDelegate getInstance].motionManager startAccelerometerUpdates];
-            else
-                [[SFAppDelegate getInstance].motionManager stopAccelerometerUpdates];
+            manager.accelerometerUpdateInterval = interval;
+            if (!m_batched)
+            {
+                [manager startAccelerometerUpdates];
+                break;
+            }
+
+            [manager startAccelerometerUpdatesToQueue:getSampleQueue()
+                                          withHandler:^(CMAccelerometerData* data, NSError* /* error */) {
+                                            // Acceleration is given in G, convert to m/s^2
+                                            if (data)
+                                                pushSample(Sensor::Type::Accelerometer,
+                                                           toVector(data.acceleration.x,
+                                                                    data.acceleration.y,
+                                                                    data.acceleration.z,
+                                                                    9.81),
+                                                           data.timestamp);
+                                          }];
             break;
 
         case Sensor::Type::Gyroscope:
-            if (enabled)
-                [[SFAppDelegate getInstance].motionManager startGyroUpdates];
-            else
-                [[SFAppDelegate getInstance].motionManager stopGyroUpdates];
+            manager.gyroUpdateInterval = interval;
+            if (!m_batched)
+            {
+                [manager startGyroUpdates];
+                break;
+            }
+
+            [manager startGyroUpdatesToQueue:getSampleQueue()
+                                 withHandler:^(CMGyroData* data, NSError* /* error */) {
+                                   if (data)
+                                       pushSample(Sensor::Type::Gyroscope,
+                                                  toVector(data.rotationRate.x,
+                                                           data.rotationRate.y,
+                                                           data.rotationRate.z),
+                                                  data.timestamp);
+                                 }];
             break;
 
         case Sensor::Type::Magnetometer:
-            if (enabled)
-                [[SFAppDelegate getInstance].motionManager startMagnetometerUpdates];
-            else
-                [[SFAppDelegate getInstance].motionManager stopMagnetometerUpdates];
+            manager.magnetometerUpdateInterval = interval;
+            if (!m_batched)
+            {
+                [manager startMagnetometerUpdates];
+                break;
+            }
+
+            [manager startMagnetometerUpdatesToQueue:getSampleQueue()
+                                         withHandler:^(CMMagnetometerData* data, NSError* /* error */) {
+                                           if (data)
+                                               pushSample(Sensor::Type::Magnetometer,
+                                                          toVector(data.magneticField.x,
+                                                                   data.magneticField.y,
+                                                                   data.magneticField.z),
+                                                          data.timestamp);
+                                         }];
             break;
 
         case Sensor::Type::Gravity:
         case Sensor::Type::UserAcceleration:
         case Sensor::Type::Orientation:
-            // these 3 sensors all share the same implementation, so we must disable
-            // it only if the three sensors are disabled
-            if (enabled)
-            {
-                if (deviceMotionEnabledCount == 0)
-                    [[SFAppDelegate getInstance].motionManager startDeviceMotionUpdates];
-                ++deviceMotionEnabledCount;
-            }
-            else
-            {
-                --deviceMotionEnabledCount;
-                if (deviceMotionEnabledCount == 0)
-                    [[SFAppDelegate getInstance].motionManager stopDeviceMotionUpdates];
-            }
+            updateDeviceMotion();
             break;
 
         default:
             break;
     }
+}
 
-    // Update the enable state
-    m_enabled = enabled;
+
+////////////////////////////////////////////////////////////
+void SensorImpl::stop()
+{
+    CMMotionManager* const manager = [SFAppDelegate getInstance].motionManager;
+
+    sensorRunning[m_sensor] = false;
+
+    switch (m_sensor)
+    {
+        case Sensor::Type::Accelerometer:
+            [manager stopAccelerometerUpdates];
+            break;
+
+        case Sensor::Type::Gyroscope:
+            [manager stopGyroUpdates];
+            break;
+
+        case Sensor::Type::Magnetometer:
+            [manager stopMagnetometerUpdates];
+            break;
+
+        case Sensor::Type::Gravity:
+        case Sensor::Type::UserAcceleration:
+        case Sensor::Type::Orientation:
+            // These 3 sensors all share the same implementation, so it is
+            // only stopped when the three sensors are disabled
+            updateDeviceMotion();
+            break;
+
+        default:
+            break;
+    }
 }
 
 } // namespace sf::priv
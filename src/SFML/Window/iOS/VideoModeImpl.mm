@@ -51,4 +51,26 @@ VideoMode VideoModeImpl::getDesktopMode()
                       static_cast<unsigned int>(bounds.size.height * backingScale)});
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    // Only the screen of the device is reported
+    Monitor monitor;
+    monitor.name        = "screen";
+    monitor.mode        = getDesktopMode();
+    monitor.refreshRate = static_cast<float>([[UIScreen mainScreen] maximumFramesPerSecond]);
+    monitor.primary     = true;
+
+    return {monitor};
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // The screen size changes with the orientation of the device
+    return false;
+}
+
 } // namespace sf::priv
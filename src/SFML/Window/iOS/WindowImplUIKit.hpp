@@ -206,6 +206,23 @@ public:
     ////////////////////////////////////////////////////////////
     void forwardEvent(Event event);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify a touch movement
+    ///
+    /// \param sample    Movement of the finger
+    /// \param coalesced True for an intermediate sample, false for the current position of the finger
+    ///
+    ////////////////////////////////////////////////////////////
+    void forwardTouchMovement(const WindowBase::TouchSample& sample, bool coalesced);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify a touch movement predicted by the system
+    ///
+    /// \param sample Predicted movement of the finger
+    ///
+    ////////////////////////////////////////////////////////////
+    void forwardPredictedTouch(const WindowBase::TouchSample& sample);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the window's view
     ///
@@ -239,6 +239,20 @@ void WindowImplUIKit::forwardEvent(Event event)
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImplUIKit::forwardTouchMovement(const WindowBase::TouchSample& sample, bool coalesced)
+{
+    pushTouchMovement(sample, coalesced);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImplUIKit::forwardPredictedTouch(const WindowBase::TouchSample& sample)
+{
+    pushPredictedTouch(sample);
+}
+
+
 ////////////////////////////////////////////////////////////
 SFView* WindowImplUIKit::getGlView() const
 {
@@ -30,6 +30,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/GlContext.hpp>
 
+#include <cstdint>
+
 ////////////////////////////////////////////////////////////
 /// Predefine OBJC classes
 ////////////////////////////////////////////////////////////
@@ -44,11 +46,15 @@ using NSOpenGLViewRef = NSOpenGLView*;
 @class NSWindow;
 using NSWindowRef = NSWindow*;
 
+@class SFDisplayLink;
+using SFDisplayLinkRef = SFDisplayLink*;
+
 #else // If C++
 
 using NSOpenGLContextRef = void*;
 using NSOpenGLViewRef    = void*;
 using NSWindowRef        = void*;
+using SFDisplayLinkRef   = void*;
 
 #endif
 
@@ -126,6 +132,48 @@ public:
     ////////////////////////////////////////////////////////////
     void setVerticalSyncEnabled(bool enabled) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of vertical blanks to wait for when displaying a frame
+    ///
+    /// \param interval Number of vertical blanks, negative intervals are not supported
+    ///
+    /// \return True if the interval was set, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSwapInterval(int interval) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pace the displayed frames to a target frame rate
+    ///
+    /// On macOS 14 and later, the rate is requested from the
+    /// display link, which lets ProMotion screens refresh at
+    /// that rate.
+    ///
+    /// \param frameRate Target number of frames per second, 0 to use the rate of the screen
+    ///
+    /// \return True if the frames are paced, false if it is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTargetFrameRate(unsigned int frameRate) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a given time before the next vertical blank
+    ///
+    /// \param delay Time to leave before the vertical blank
+    ///
+    /// \return True if the function waited, false if no vertical blank was reported yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool delayBeforeSwap(Time delay) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timing of the presentation of the frames
+    ///
+    /// \return Present timing, or an empty optional if no vertical blank was reported yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Window::PresentTiming> getPresentTiming() override;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Activate the context as the current target
@@ -153,9 +201,13 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    NSOpenGLContextRef m_context{}; ///< OpenGL context.
-    NSOpenGLViewRef    m_view{};    ///< Only for offscreen context.
-    NSWindowRef        m_window{};  ///< Only for offscreen context.
+    NSOpenGLContextRef m_context{};      ///< OpenGL context.
+    NSOpenGLViewRef    m_view{};         ///< Only for offscreen context.
+    NSWindowRef        m_window{};       ///< Only for offscreen context.
+    SFDisplayLinkRef   m_displayLink{};  ///< Reports the vertical blanks, only for window context.
+    int                m_swapInterval{}; ///< Number of vertical blanks each frame stays on screen.
+    double             m_lastSwap{};     ///< Time of the last swap, measured by CACurrentMediaTime.
+    std::uint64_t      m_swapCount{};    ///< Number of frames displayed.
 };
 
 } // namespace sf::priv
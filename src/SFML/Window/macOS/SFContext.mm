@@ -28,10 +28,15 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/macOS/AutoreleasePoolWrapper.hpp>
 #include <SFML/Window/macOS/SFContext.hpp>
+#include <SFML/Window/macOS/SFDisplayLink.h>
 #include <SFML/Window/macOS/WindowImplCocoa.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Sleep.hpp>
 
+#import <QuartzCore/QuartzCore.h>
+#include <algorithm>
+#include <cmath>
 #include <dlfcn.h>
 #include <ostream>
 
@@ -61,6 +66,9 @@ SFContext::SFContext(SFContext* shared, const ContextSettings& settings, const W
     // Apply context.
     const auto& ownerCocoa = static_cast<const WindowImplCocoa&>(owner);
     ownerCocoa.applyContext(m_context);
+
+    // Track the vertical blanks of the screen of the view, to pace the frames
+    m_displayLink = [[SFDisplayLink alloc] initWithView:[m_context view]];
 }
 
 
@@ -103,6 +111,10 @@ SFContext::~SFContext()
 
     [m_view release];   // Might be nil but we don't care.
     [m_window release]; // Idem.
+
+    // The display link keeps a reference to its target until it is invalidated
+    [m_displayLink invalidate];
+    [m_displayLink release];
 }
 
 
@@ -140,17 +152,99 @@ bool SFContext::makeCurrent(bool current)
 void SFContext::display()
 {
     const AutoreleasePool pool;
+
+    // NSOpenGLCPSwapInterval only supports 0 and 1, the frames of longer
+    // intervals are held back until half a frame before the vertical blank
+    CFTimeInterval lastVsync = 0;
+    CFTimeInterval period    = 0;
+    if ((m_swapInterval > 1) && [m_displayLink getLastVsync:&lastVsync period:&period] && (period > 0))
+    {
+        const double target = m_lastSwap + (static_cast<double>(m_swapInterval) - 1.5) * period;
+        sleep(seconds(static_cast<float>(target - CACurrentMediaTime())));
+    }
+
     [m_context flushBuffer];
+    m_lastSwap = CACurrentMediaTime();
+    ++m_swapCount;
 }
 
 
 ////////////////////////////////////////////////////////////
 void SFContext::setVerticalSyncEnabled(bool enabled)
 {
+    [[maybe_unused]] const bool result = setSwapInterval(enabled ? 1 : 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SFContext::setSwapInterval(int interval)
+{
+    // Adaptive v-sync is not supported
+    if (interval < 0)
+        return false;
+
     const AutoreleasePool pool;
-    const GLint           swapInterval = enabled ? 1 : 0;
+    const GLint           swapInterval = std::min(interval, 1);
 
     [m_context setValues:&swapInterval forParameter:NSOpenGLCPSwapInterval];
+    m_swapInterval = interval;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SFContext::setTargetFrameRate(unsigned int frameRate)
+{
+    const AutoreleasePool pool;
+
+    // On ProMotion screens, the display link drives the screen at the requested rate;
+    // the swap interval then matches the frame rate to the refresh rate of the screen
+    [m_displayLink setFrameRate:static_cast<float>(frameRate)];
+    return GlContext::setTargetFrameRate(frameRate);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SFContext::delayBeforeSwap(Time delay)
+{
+    CFTimeInterval lastVsync = 0;
+    CFTimeInterval period    = 0;
+    if (![m_displayLink getLastVsync:&lastVsync period:&period] || (period <= 0))
+        return false;
+
+    // Vertical blanks reported late are extrapolated from the last one
+    const double now       = CACurrentMediaTime();
+    const double elapsed   = std::max(now - lastVsync, 0.0);
+    const double nextVsync = lastVsync + (std::floor(elapsed / period) + 1) * period;
+
+    double wait = nextVsync - delay.asSeconds() - now;
+    if (wait < 0)
+        wait += period;
+
+    sleep(seconds(static_cast<float>(wait)));
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Window::PresentTiming> SFContext::getPresentTiming()
+{
+    const AutoreleasePool pool;
+
+    CFTimeInterval lastVsync = 0;
+    CFTimeInterval period    = 0;
+    if (![m_displayLink getLastVsync:&lastVsync period:&period])
+        return std::nullopt;
+
+    const auto refreshRate = static_cast<double>([m_displayLink refreshRate]);
+
+    Window::PresentTiming timing;
+    timing.lastVerticalBlank  = microseconds(static_cast<std::int64_t>(lastVsync * 1'000'000));
+    timing.verticalBlankCount = static_cast<std::uint64_t>(
+        std::llround((lastVsync - [m_displayLink firstTimestamp]) * refreshRate));
+    timing.swapCount   = m_swapCount;
+    timing.refreshRate = static_cast<float>(refreshRate);
+    return timing;
 }
 
 
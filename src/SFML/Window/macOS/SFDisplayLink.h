@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#import <AppKit/AppKit.h>
+#import <CoreVideo/CoreVideo.h>
+#import <QuartzCore/QuartzCore.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Tracks the vertical blanks of the screen of a view
+///
+/// Since macOS 14, a CADisplayLink created by the view is
+/// scheduled on the main run loop; it follows the view from
+/// one screen to another and supports ProMotion screens. On
+/// older systems, a CVDisplayLink reports the vertical blanks
+/// of the main display from its own thread.
+///
+/// Vertical blanks which are not reported on time are
+/// extrapolated from the last one.
+///
+////////////////////////////////////////////////////////////
+// NOLINTBEGIN(readability-identifier-naming)
+@interface SFDisplayLink : NSObject
+{
+    id                m_link;           ///< CADisplayLink, on macOS 14 and later
+    CVDisplayLinkRef  m_cvLink;         ///< CVDisplayLink, on older systems
+    NSView*           m_view;           ///< View whose screen is tracked, not retained
+    CFTimeInterval    m_lastTimestamp;  ///< Time of the last vertical blank reported
+    CFTimeInterval    m_period;         ///< Time between two reported vertical blanks
+    CFTimeInterval    m_firstTimestamp; ///< Time of the first vertical blank reported
+}
+// NOLINTEND(readability-identifier-naming)
+
+////////////////////////////////////////////////////////////
+/// \brief Create the display link and start tracking vertical blanks
+///
+/// \param view View whose screen is tracked
+///
+/// \return an initialized display link
+///
+////////////////////////////////////////////////////////////
+- (id)initWithView:(NSView*)view;
+
+////////////////////////////////////////////////////////////
+/// \brief Stop tracking vertical blanks
+///
+/// Must be called before the object is released, since the
+/// display link keeps a reference to it.
+///
+////////////////////////////////////////////////////////////
+- (void)invalidate;
+
+////////////////////////////////////////////////////////////
+/// \brief Set the rate at which the screen should refresh
+///
+/// Only supported by the CADisplayLink of macOS 14, which lets
+/// the system drive ProMotion screens at the requested rate.
+///
+/// \param frameRate Number of frames per second, 0 to use the rate of the screen
+///
+/// \return True if the rate was requested, false if it is not supported
+///
+////////////////////////////////////////////////////////////
+- (BOOL)setFrameRate:(float)frameRate;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the time of the last vertical blank and the duration of a frame
+///
+/// Times are measured by CACurrentMediaTime.
+///
+/// \param timestamp Filled with the time of the last vertical blank
+/// \param period    Filled with the time between two reported vertical blanks
+///
+/// \return True if a vertical blank was reported, false otherwise
+///
+////////////////////////////////////////////////////////////
+- (BOOL)getLastVsync:(CFTimeInterval*)timestamp period:(CFTimeInterval*)period;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the time of the first vertical blank reported
+///
+/// \return Time measured by CACurrentMediaTime, 0 if no vertical blank was reported
+///
+////////////////////////////////////////////////////////////
+- (CFTimeInterval)firstTimestamp;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the maximum refresh rate of the tracked screen
+///
+/// \return Number of vertical blanks per second
+///
+////////////////////////////////////////////////////////////
+- (float)refreshRate;
+
+@end
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#import <SFML/Window/macOS/SFDisplayLink.h>
+
+#include <mach/mach_time.h>
+
+
+////////////////////////////////////////////////////////////
+/// Record a vertical blank, possibly from another thread
+///
+////////////////////////////////////////////////////////////
+@interface SFDisplayLink ()
+
+- (void)recordVsync:(CFTimeInterval)timestamp period:(CFTimeInterval)period;
+
+@end
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+CVReturn displayLinkCallback(CVDisplayLinkRef /* displayLink */,
+                             const CVTimeStamp* now,
+                             const CVTimeStamp* /* outputTime */,
+                             CVOptionFlags /* flagsIn */,
+                             CVOptionFlags* /* flagsOut */,
+                             void* context)
+{
+    static mach_timebase_info_data_t timebase = []
+    {
+        mach_timebase_info_data_t info{};
+        mach_timebase_info(&info);
+        return info;
+    }();
+
+    // Host times are measured by mach_absolute_time, like CACurrentMediaTime
+    const double timestamp = static_cast<double>(now->hostTime) * timebase.numer / timebase.denom / 1'000'000'000.0;
+    const double period    = (now->videoTimeScale > 0)
+                                 ? static_cast<double>(now->videoRefreshPeriod) / now->videoTimeScale
+                                 : 0.0;
+
+    [static_cast<SFDisplayLink*>(context) recordVsync:timestamp period:period];
+    return kCVReturnSuccess;
+}
+} // namespace
+
+
+@implementation SFDisplayLink
+
+////////////////////////////////////////////////////////
+- (id)initWithView:(NSView*)view
+{
+    self = [super init];
+
+    if (self)
+    {
+        m_view = view;
+
+#if defined(__MAC_14_0) && (__MAC_OS_X_VERSION_MAX_ALLOWED >= __MAC_14_0)
+        if (@available(macOS 14.0, *))
+        {
+            CADisplayLink* const link = [view displayLinkWithTarget:self selector:@selector(handleVsync:)];
+            [link addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+            m_link = [link retain];
+            return self;
+        }
+#endif
+
+        if (CVDisplayLinkCreateWithActiveCGDisplays(&m_cvLink) == kCVReturnSuccess)
+        {
+            CVDisplayLinkSetOutputCallback(m_cvLink, &displayLinkCallback, self);
+            CVDisplayLinkStart(m_cvLink);
+        }
+        else
+        {
+            m_cvLink = nullptr;
+        }
+    }
+
+    return self;
+}
+
+
+////////////////////////////////////////////////////////
+- (void)dealloc
+{
+    [self invalidate];
+    [super dealloc];
+}
+
+
+////////////////////////////////////////////////////////
+- (void)invalidate
+{
+    if (m_cvLink)
+    {
+        // Stopping waits for the callback to return, so it can't use the object afterwards
+        CVDisplayLinkStop(m_cvLink);
+        CVDisplayLinkRelease(m_cvLink);
+        m_cvLink = nullptr;
+    }
+
+    [m_link invalidate];
+    [m_link release];
+    m_link = nil;
+}
+
+
+////////////////////////////////////////////////////////
+- (BOOL)setFrameRate:(float)frameRate
+{
+#if defined(__MAC_14_0) && (__MAC_OS_X_VERSION_MAX_ALLOWED >= __MAC_14_0)
+    if (@available(macOS 14.0, *))
+    {
+        if (!m_link)
+            return NO;
+
+        // Ask for the exact rate, ProMotion screens then refresh at that rate instead of the link skipping refreshes
+        CADisplayLink* const link    = m_link;
+        link.preferredFrameRateRange = (frameRate > 0) ? CAFrameRateRangeMake(frameRate, frameRate, frameRate)
+                                                       : CAFrameRateRangeDefault;
+        return YES;
+    }
+#endif
+
+    (void)frameRate;
+    return NO;
+}
+
+
+////////////////////////////////////////////////////////
+- (BOOL)getLastVsync:(CFTimeInterval*)timestamp period:(CFTimeInterval*)period
+{
+    @synchronized(self)
+    {
+        *timestamp = m_lastTimestamp;
+        *period    = m_period;
+
+        return m_lastTimestamp > 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////
+- (CFTimeInterval)firstTimestamp
+{
+    @synchronized(self)
+    {
+        return m_firstTimestamp;
+    }
+}
+
+
+////////////////////////////////////////////////////////
+- (float)refreshRate
+{
+    if (m_cvLink)
+    {
+        const CVTime period = CVDisplayLinkGetNominalOutputVideoRefreshPeriod(m_cvLink);
+        if ((period.timeValue > 0) && !(period.flags & kCVTimeIsIndefinite))
+            return static_cast<float>(static_cast<double>(period.timeScale) / period.timeValue);
+    }
+
+    if (@available(macOS 12.0, *))
+    {
+        NSScreen* const screen = [[m_view window] screen] ?: [NSScreen mainScreen];
+        return static_cast<float>(screen.maximumFramesPerSecond);
+    }
+
+    return 60.f;
+}
+
+
+////////////////////////////////////////////////////////
+- (void)recordVsync:(CFTimeInterval)timestamp period:(CFTimeInterval)period
+{
+    @synchronized(self)
+    {
+        if (m_firstTimestamp == 0)
+            m_firstTimestamp = timestamp;
+
+        m_lastTimestamp = timestamp;
+        m_period        = period;
+    }
+}
+
+
+////////////////////////////////////////////////////////
+- (void)handleVsync:(id)sender
+{
+#if defined(__MAC_14_0) && (__MAC_OS_X_VERSION_MAX_ALLOWED >= __MAC_14_0)
+    if (@available(macOS 14.0, *))
+    {
+        // The duration of the frame follows the rate chosen by the system, which varies on ProMotion screens
+        CADisplayLink* const link = sender;
+        [self recordVsync:link.timestamp period:link.targetTimestamp - link.timestamp];
+    }
+#else
+    (void)sender;
+#endif
+}
+
+@end
@@ -87,6 +87,26 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     void setEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the batching of the samples
+    ///
+    /// \param enabled          True to keep every sample
+    /// \param samplingPeriod   Time between two samples, zero to use the fastest rate
+    /// \param maxReportLatency Maximum time the samples can be held back before being reported
+    ///
+    /// \return True on success, false if batching is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setBatching(bool enabled, Time samplingPeriod, Time maxReportLatency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the samples measured since the previous call
+    ///
+    /// \param samples Vector to append the samples to
+    ///
+    ////////////////////////////////////////////////////////////
+    void readSamples(std::vector<Sensor::Sample>& samples);
 };
 
 } // namespace sf::priv
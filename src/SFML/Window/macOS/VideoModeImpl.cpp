@@ -33,6 +33,21 @@
 
 #include <algorithm>
 #include <ostream>
+#include <string>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+////////////////////////////////////////////////////////////
+void displayReconfigured(CGDirectDisplayID /* display */, CGDisplayChangeSummaryFlags flags, void* /* userInfo */)
+{
+    // The callback is called before and after the change, only the latter matters
+    if (!(flags & kCGDisplayBeginConfigurationFlag))
+        sf::priv::VideoModeImpl::invalidateCache();
+}
+} // namespace
 
 namespace sf::priv
 {
@@ -95,4 +110,60 @@ VideoMode VideoModeImpl::getDesktopMode()
     return mode;
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Monitor> VideoModeImpl::getMonitors()
+{
+    std::vector<Monitor> monitors;
+
+    std::uint32_t count = 0;
+    if (CGGetActiveDisplayList(0, nullptr, &count) != kCGErrorSuccess)
+    {
+        sf::err() << "Couldn't get the list of active displays." << std::endl;
+        return monitors;
+    }
+
+    std::vector<CGDirectDisplayID> displays(count);
+    if (CGGetActiveDisplayList(count, displays.data(), &count) != kCGErrorSuccess)
+    {
+        sf::err() << "Couldn't get the list of active displays." << std::endl;
+        return monitors;
+    }
+
+    for (const CGDirectDisplayID display : displays)
+    {
+        CGDisplayModeRef cgmode = CGDisplayCopyDisplayMode(display);
+        if (cgmode == nullptr)
+            continue;
+
+        // The bounds are given in points, relative to the main display
+        const CGRect bounds = CGDisplayBounds(display);
+
+        Monitor monitor;
+        monitor.name        = std::to_string(display);
+        monitor.position    = {static_cast<int>(bounds.origin.x), static_cast<int>(bounds.origin.y)};
+        monitor.mode        = convertCGModeToSFMode(cgmode);
+        monitor.refreshRate = static_cast<float>(CGDisplayModeGetRefreshRate(cgmode));
+        monitor.primary     = CGDisplayIsMain(display);
+        monitors.push_back(monitor);
+
+        CGDisplayModeRelease(cgmode);
+    }
+
+    // Put the primary monitor first
+    std::stable_partition(monitors.begin(), monitors.end(), [](const Monitor& monitor) { return monitor.primary; });
+
+    return monitors;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VideoModeImpl::notifiesChanges()
+{
+    // The callback is called by the run loop, which runs while the windows process their events
+    static const bool registered = CGDisplayRegisterReconfigurationCallback(&displayReconfigured, nullptr) ==
+                                   kCGErrorSuccess;
+    return registered;
+}
+
 } // namespace sf::priv
@@ -0,0 +1,77 @@
+#include <SFML/Audio/AudioBus.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <optional>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::AudioBus", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AudioBus>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AudioBus>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::AudioBus>);
+        STATIC_CHECK(!std::is_move_assignable_v<sf::AudioBus>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::AudioBus bus;
+        CHECK(bus.getVolume() == 100.f);
+        CHECK(bus.getParent() == nullptr);
+    }
+
+    SECTION("Set/get volume")
+    {
+        sf::AudioBus bus;
+        bus.setVolume(50.f);
+        CHECK(bus.getVolume() == 50.f);
+    }
+
+    SECTION("Set/get parent")
+    {
+        sf::AudioBus master;
+        sf::AudioBus sfx;
+        sfx.setParent(&master);
+        CHECK(sfx.getParent() == &master);
+
+        sfx.setParent(nullptr);
+        CHECK(sfx.getParent() == nullptr);
+    }
+
+    SECTION("Destruction of a parent")
+    {
+        sf::AudioBus sfx;
+        {
+            sf::AudioBus master;
+            sfx.setParent(&master);
+        }
+        CHECK(sfx.getParent() == nullptr);
+    }
+
+    SECTION("Sounds")
+    {
+        const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+        sf::Sound  sound(soundBuffer);
+        CHECK(sound.getBus() == nullptr);
+
+        std::optional<sf::AudioBus> bus(std::in_place);
+        sound.setBus(&*bus);
+        CHECK(sound.getBus() == &*bus);
+
+        // Copies output to the same bus
+        const sf::Sound copy(sound); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(copy.getBus() == &*bus);
+
+        // Destroying the bus routes its sounds to the audio device
+        bus.reset();
+        CHECK(sound.getBus() == nullptr);
+        CHECK(copy.getBus() == nullptr);
+    }
+}
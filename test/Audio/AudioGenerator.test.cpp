@@ -0,0 +1,102 @@
+#include <SFML/Audio/AudioGenerator.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <SystemUtil.hpp>
+#include <atomic>
+#include <type_traits>
+
+#include <cstdint>
+
+namespace
+{
+class AudioGenerator : public sf::AudioGenerator
+{
+public:
+    AudioGenerator()
+    {
+        initialize(2, 44100, {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight});
+    }
+
+    using sf::AudioGenerator::allocate;
+
+    std::atomic<std::size_t> framesGenerated{};
+    std::atomic<bool>        realTimeContext{};
+    std::atomic<bool>        allocated{};
+
+private:
+    [[nodiscard]] bool onGenerate(float* frames, std::size_t frameCount) override
+    {
+        for (std::size_t i = 0; i < frameCount * getChannelCount(); ++i)
+            frames[i] = 0.f;
+
+        realTimeContext = isRealTimeContext();
+        allocated       = allocate(256, alignof(float)) != nullptr;
+        framesGenerated += frameCount;
+        return true;
+    }
+};
+} // namespace
+
+TEST_CASE("[Audio] sf::AudioGenerator", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::AudioGenerator>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AudioGenerator>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AudioGenerator>);
+        STATIC_CHECK(std::has_virtual_destructor_v<sf::AudioGenerator>);
+    }
+
+    SECTION("Construction")
+    {
+        const AudioGenerator generator;
+        CHECK(generator.getChannelCount() == 2);
+        CHECK(generator.getSampleRate() == 44100);
+        CHECK(generator.getChannelMap().size() == 2);
+        CHECK(generator.getStatus() == sf::AudioGenerator::Status::Stopped);
+        CHECK(generator.getPlayingOffset() == sf::Time::Zero);
+        CHECK(generator.getArenaSize() == 0);
+        CHECK(generator.getRealTimeViolationCount() == 0);
+        CHECK(!sf::AudioGenerator::isRealTimeContext());
+    }
+
+    SECTION("Arena")
+    {
+        AudioGenerator generator;
+        generator.setArenaSize(64);
+        CHECK(generator.getArenaSize() == 64);
+
+        const void* first = generator.allocate(16, 16);
+        REQUIRE(first != nullptr);
+        CHECK(reinterpret_cast<std::uintptr_t>(first) % 16 == 0);
+        CHECK(generator.allocate(16, 16) != first);
+        CHECK(generator.getRealTimeViolationCount() == 0);
+
+        CHECK(generator.allocate(64) == nullptr);
+        CHECK(generator.getRealTimeViolationCount() == 1);
+    }
+
+    SECTION("Generation")
+    {
+        AudioGenerator generator;
+        generator.setArenaSize(1024);
+        generator.play();
+        CHECK(generator.getStatus() == sf::AudioGenerator::Status::Playing);
+
+        for (int i = 0; (i < 100) && (generator.framesGenerated == 0); ++i)
+            sf::sleep(sf::milliseconds(10));
+
+        generator.stop();
+        CHECK(generator.getStatus() == sf::AudioGenerator::Status::Stopped);
+        CHECK(generator.framesGenerated > 0);
+        CHECK(generator.realTimeContext);
+        CHECK(generator.allocated);
+        CHECK(generator.getRealTimeViolationCount() == 0);
+        CHECK(!sf::AudioGenerator::isRealTimeContext());
+    }
+}
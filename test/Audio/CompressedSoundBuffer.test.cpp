@@ -0,0 +1,150 @@
+#include <SFML/Audio/CompressedSoundBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <SFML/System/FileInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <SystemUtil.hpp>
+#include <array>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Audio] sf::CompressedSoundBuffer", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::CompressedSoundBuffer>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::CompressedSoundBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::CompressedSoundBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::CompressedSoundBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::CompressedSoundBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::CompressedSoundBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::CompressedSoundBuffer>);
+    }
+
+    SECTION("loadFromFile()")
+    {
+        SECTION("Invalid filename")
+        {
+            CHECK(!sf::CompressedSoundBuffer::loadFromFile("does/not/exist.ogg"));
+        }
+
+        SECTION("Valid file")
+        {
+            const auto buffer = sf::CompressedSoundBuffer::loadFromFile("Audio/ding.flac").value();
+            CHECK(buffer.getData() != nullptr);
+            CHECK(buffer.getDataSize() > 0);
+            CHECK(buffer.getDataSize() < 87798 * sizeof(std::int16_t));
+            CHECK(buffer.getSampleCount() == 87798);
+            CHECK(buffer.getSampleRate() == 44100);
+            CHECK(buffer.getChannelCount() == 1);
+            CHECK(buffer.getChannelMap() == std::vector{sf::SoundChannel::Mono});
+            CHECK(buffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
+    SECTION("loadFromMemory()")
+    {
+        SECTION("Invalid memory")
+        {
+            constexpr std::array<std::byte, 5> memory{};
+            CHECK(!sf::CompressedSoundBuffer::loadFromMemory(memory.data(), memory.size()));
+        }
+
+        SECTION("Valid memory")
+        {
+            const auto memory = loadIntoMemory("Audio/ding.flac");
+            const auto buffer = sf::CompressedSoundBuffer::loadFromMemory(memory.data(), memory.size()).value();
+            CHECK(buffer.getDataSize() == memory.size());
+            CHECK(buffer.getSampleCount() == 87798);
+            CHECK(buffer.getSampleRate() == 44100);
+            CHECK(buffer.getChannelCount() == 1);
+        }
+    }
+
+    SECTION("loadFromStream()")
+    {
+        sf::FileInputStream stream;
+        REQUIRE(stream.open("Audio/ding.flac"));
+        const auto buffer = sf::CompressedSoundBuffer::loadFromStream(stream).value();
+        CHECK(buffer.getDataSize() == static_cast<std::size_t>(stream.getSize()));
+        CHECK(buffer.getSampleCount() == 87798);
+        CHECK(buffer.getDuration() == sf::microseconds(1990884));
+    }
+
+    SECTION("Copy semantics")
+    {
+        const auto buffer = sf::CompressedSoundBuffer::loadFromFile("Audio/ding.flac").value();
+
+        SECTION("Construction")
+        {
+            const sf::CompressedSoundBuffer bufferCopy(buffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(bufferCopy.getDataSize() == buffer.getDataSize());
+            CHECK(bufferCopy.getSampleCount() == 87798);
+            CHECK(bufferCopy.getDuration() == sf::microseconds(1990884));
+        }
+
+        SECTION("Assignment")
+        {
+            auto bufferCopy = sf::CompressedSoundBuffer::loadFromFile("Audio/killdeer.wav").value();
+            bufferCopy      = buffer;
+            CHECK(bufferCopy.getDataSize() == buffer.getDataSize());
+            CHECK(bufferCopy.getSampleCount() == 87798);
+        }
+    }
+
+    SECTION("Playback")
+    {
+        const auto buffer = sf::CompressedSoundBuffer::loadFromFile("Audio/ding.flac").value();
+
+        SECTION("Construction")
+        {
+            const sf::Sound sound(buffer);
+            CHECK(sound.getCompressedBuffer() == &buffer);
+            CHECK(sound.getStatus() == sf::Sound::Status::Stopped);
+            CHECK(sound.getPlayingOffset() == sf::Time::Zero);
+        }
+
+        SECTION("Set buffer")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+            sf::Sound  sound(soundBuffer);
+            CHECK(sound.getCompressedBuffer() == nullptr);
+
+            sound.setBuffer(buffer);
+            CHECK(sound.getCompressedBuffer() == &buffer);
+
+            sound.setBuffer(soundBuffer);
+            CHECK(sound.getCompressedBuffer() == nullptr);
+            CHECK(&sound.getBuffer() == &soundBuffer);
+        }
+
+        SECTION("Copy")
+        {
+            const sf::Sound sound(buffer);
+            const sf::Sound soundCopy(sound); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(soundCopy.getCompressedBuffer() == &buffer);
+        }
+
+        SECTION("Playing offset")
+        {
+            sf::Sound sound(buffer);
+            sound.setPlayingOffset(sf::milliseconds(500));
+            CHECK(sound.getPlayingOffset() == sf::milliseconds(500));
+        }
+
+        SECTION("Buffer destroyed first")
+        {
+            std::optional<sf::CompressedSoundBuffer> temporary = buffer;
+            const sf::Sound                          sound(*temporary);
+            temporary.reset();
+            CHECK(sound.getCompressedBuffer() == nullptr);
+        }
+    }
+}
@@ -0,0 +1,182 @@
+#include <SFML/Audio/EffectChain.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+
+namespace
+{
+// Run a processor over interleaved frames and return the output
+std::vector<float> process(const sf::SoundSource::EffectProcessor& processor,
+                           const std::vector<float>&           input,
+                           unsigned int                        channelCount)
+{
+    std::vector<float> output(input.size());
+    auto               inputFrameCount  = static_cast<unsigned int>(input.size() / channelCount);
+    auto               outputFrameCount = inputFrameCount;
+    processor(input.data(), inputFrameCount, output.data(), outputFrameCount, channelCount);
+    CHECK(inputFrameCount == input.size() / channelCount);
+    CHECK(outputFrameCount == input.size() / channelCount);
+    return output;
+}
+
+float getPeak(const std::vector<float>& samples, std::size_t begin = 0)
+{
+    float peak = 0.f;
+    for (std::size_t i = begin; i < samples.size(); ++i)
+        peak = std::max(peak, std::abs(samples[i]));
+    return peak;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::EffectChain")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::EffectChain>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::EffectChain>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::EffectChain>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::EffectChain>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::EffectChain chain(2, 44100);
+        CHECK(chain.getNodeCount() == 0);
+
+        // An empty chain passes the signal through
+        const std::vector<float> input = {0.1f, -0.2f, 0.3f, -0.4f, 0.5f, -0.6f};
+        CHECK(process(chain.getProcessor(), input, 2) == input);
+    }
+
+    SECTION("Nodes")
+    {
+        sf::EffectChain chain(2, 44100);
+        CHECK(chain.addFilter(sf::EffectChain::FilterType::LowPass, 1000.f) == 0);
+        CHECK(chain.addReverbSend() == 1);
+        CHECK(chain.addCompressor() == 2);
+        CHECK(chain.addLimiter() == 3);
+        CHECK(chain.getNodeCount() == 4);
+
+        CHECK(!chain.isBypassed(1));
+        chain.setBypassed(1, true);
+        CHECK(chain.isBypassed(1));
+    }
+
+    SECTION("Filters")
+    {
+        // Constant signal followed by a signal alternating at the Nyquist frequency
+        std::vector<float> dc(4096, 0.5f);
+        std::vector<float> nyquist(4096);
+        for (std::size_t i = 0; i < nyquist.size(); ++i)
+            nyquist[i] = (i % 2) ? 0.5f : -0.5f;
+
+        SECTION("Low-pass")
+        {
+            sf::EffectChain chain(1, 44100);
+            chain.addFilter(sf::EffectChain::FilterType::LowPass, 1000.f);
+            const auto processor = chain.getProcessor();
+            CHECK_THAT(process(processor, dc, 1).back(), Catch::Matchers::WithinAbs(0.5f, 1e-3f));
+            CHECK(getPeak(process(processor, nyquist, 1), 1024) < 1e-3f);
+        }
+
+        SECTION("High-pass")
+        {
+            sf::EffectChain chain(1, 44100);
+            chain.addFilter(sf::EffectChain::FilterType::HighPass, 1000.f);
+            const auto processor = chain.getProcessor();
+            CHECK(getPeak(process(processor, dc, 1), 1024) < 1e-3f);
+            CHECK_THAT(getPeak(process(processor, nyquist, 1), 1024), Catch::Matchers::WithinAbs(0.5f, 1e-3f));
+        }
+
+        SECTION("Parameter update")
+        {
+            std::vector<float> sine(4096);
+            for (std::size_t i = 0; i < sine.size(); ++i)
+                sine[i] = 0.5f * std::sin(2.f * 3.14159265f * 5000.f * static_cast<float>(i) / 44100.f);
+
+            sf::EffectChain   chain(1, 44100);
+            const std::size_t filter    = chain.addFilter(sf::EffectChain::FilterType::LowPass, 20000.f);
+            const auto        processor = chain.getProcessor();
+            CHECK(getPeak(process(processor, sine, 1), 1024) > 0.4f);
+
+            chain.setFilter(filter, 100.f);
+            CHECK(getPeak(process(processor, sine, 1), 1024) < 1e-2f);
+        }
+
+        SECTION("Channels")
+        {
+            // Every channel of a frame is filtered independently, even above 4 channels
+            std::vector<float> input(6 * 4096);
+            for (std::size_t i = 0; i < input.size(); ++i)
+                input[i] = ((i / 6) % 2) ? 0.5f : -0.5f;
+
+            sf::EffectChain chain(6, 44100);
+            chain.addFilter(sf::EffectChain::FilterType::LowPass, 1000.f);
+            CHECK(getPeak(process(chain.getProcessor(), input, 6), 6 * 1024) < 1e-3f);
+        }
+    }
+
+    SECTION("Reverb send")
+    {
+        // The reverb tail keeps sounding after an impulse stops
+        std::vector<float> impulse(2 * 44100);
+        impulse[0] = impulse[1] = 1.f;
+
+        sf::EffectChain chain(2, 44100);
+        chain.addReverbSend(0.5f);
+        const auto output = process(chain.getProcessor(), impulse, 2);
+        CHECK(output[0] == 1.f);
+        CHECK(getPeak(output, 2 * 4410) > 0.f);
+        CHECK(getPeak(output, 2) < 1.f);
+    }
+
+    SECTION("Dynamics")
+    {
+        const std::vector<float> loud(2 * 4410, 1.f);
+
+        SECTION("Compressor")
+        {
+            sf::EffectChain chain(2, 44100);
+            chain.addCompressor(-20.f, 4.f, sf::milliseconds(1), sf::milliseconds(100));
+            const auto output = process(chain.getProcessor(), loud, 2);
+
+            // 20 dB above the threshold become 5 dB: -15 dB is about 0.178
+            CHECK_THAT(output.back(), Catch::Matchers::WithinAbs(0.178f, 0.01f));
+        }
+
+        SECTION("Limiter")
+        {
+            sf::EffectChain chain(2, 44100);
+            chain.addLimiter(-6.f);
+            CHECK(getPeak(process(chain.getProcessor(), loud, 2)) <= std::pow(10.f, -6.f / 20.f) + 1e-6f);
+        }
+
+        SECTION("Bypass")
+        {
+            sf::EffectChain   chain(2, 44100);
+            const std::size_t limiter = chain.addLimiter(-6.f);
+            chain.setBypassed(limiter, true);
+            CHECK(process(chain.getProcessor(), loud, 2) == loud);
+        }
+    }
+
+    SECTION("Silent input")
+    {
+        sf::EffectChain chain(1, 44100);
+        chain.addFilter(sf::EffectChain::FilterType::Peak, 1000.f, 1.f, 6.f);
+
+        std::vector<float> output(256, 1.f);
+        unsigned int       inputFrameCount  = 128;
+        unsigned int       outputFrameCount = 256;
+        chain.getProcessor()(nullptr, inputFrameCount, output.data(), outputFrameCount, 1);
+        CHECK(inputFrameCount == 0);
+        CHECK(outputFrameCount == 256);
+        CHECK(getPeak(output) == 0.f);
+    }
+}
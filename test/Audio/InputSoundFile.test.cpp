@@ -8,8 +8,10 @@
 
 #include <SystemUtil.hpp>
 #include <array>
+#include <filesystem>
 #include <fstream>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Audio] sf::InputSoundFile")
 {
@@ -74,6 +76,21 @@ TEST_CASE("[Audio] sf::InputSoundFile")
                 CHECK(inputSoundFile.getTimeOffset() == sf::Time::Zero);
                 CHECK(inputSoundFile.getSampleOffset() == 0);
             }
+
+            SECTION("Extension not matching the contents")
+            {
+                const std::filesystem::path path = std::filesystem::temp_directory_path() / "sfmlmisnamed.wav";
+                std::filesystem::copy_file("Audio/doodle_pop.ogg",
+                                           path,
+                                           std::filesystem::copy_options::overwrite_existing);
+                {
+                    const auto inputSoundFile = sf::InputSoundFile::openFromFile(path).value();
+                    CHECK(inputSoundFile.getSampleCount() == 2'116'992);
+                    CHECK(inputSoundFile.getChannelCount() == 2);
+                    CHECK(inputSoundFile.getSampleRate() == 44'100);
+                }
+                std::filesystem::remove(path);
+            }
         }
     }
 
@@ -204,6 +221,7 @@ TEST_CASE("[Audio] sf::InputSoundFile")
         SECTION("Null address")
         {
             CHECK(inputSoundFile.read(nullptr, 10) == 0);
+            CHECK(inputSoundFile.readFloat(nullptr, 10) == 0);
         }
 
         std::array<std::int16_t, 4> samples{};
@@ -247,6 +265,150 @@ TEST_CASE("[Audio] sf::InputSoundFile")
                 // Cannot be tested since reading from a .wav file triggers UB
             }
         }
+
+        SECTION("Successful float read")
+        {
+            std::array<float, 4> floatSamples{};
+
+            SECTION("flac")
+            {
+                inputSoundFile = sf::InputSoundFile::openFromFile("Audio/ding.flac").value();
+                CHECK(inputSoundFile.readFloat(floatSamples.data(), floatSamples.size()) == 4);
+                CHECK(floatSamples[0] == Approx(0.f));
+                CHECK(floatSamples[1] == Approx(1.f / 32768));
+                CHECK(floatSamples[2] == Approx(-1.f / 32768));
+                CHECK(floatSamples[3] == Approx(4.f / 32768));
+                CHECK(inputSoundFile.getSampleOffset() == 4);
+            }
+
+            SECTION("mp3")
+            {
+                inputSoundFile = sf::InputSoundFile::openFromFile("Audio/ding.mp3").value();
+                CHECK(inputSoundFile.readFloat(floatSamples.data(), floatSamples.size()) == 4);
+                CHECK(floatSamples[0] == Approx(0.f));
+                CHECK(floatSamples[1] == Approx(-2.f / 32768));
+                CHECK(floatSamples[2] == Approx(0.f));
+                CHECK(floatSamples[3] == Approx(2.f / 32768));
+                CHECK(inputSoundFile.getSampleOffset() == 4);
+            }
+        }
+    }
+
+    SECTION("readInPlace()")
+    {
+        const float* samples = nullptr;
+
+        SECTION("Integer samples")
+        {
+            auto inputSoundFile = sf::InputSoundFile::openFromFile("Audio/killdeer.wav").value();
+            CHECK(inputSoundFile.readInPlace(samples, 4) == 0);
+            CHECK(samples == nullptr);
+            CHECK(inputSoundFile.getSampleOffset() == 0);
+        }
+
+        SECTION("Floating point samples")
+        {
+            // Mono WAVE_FORMAT_IEEE_FLOAT file
+            const std::array<float, 8> values{0.f, 0.125f, 0.25f, 0.5f, -0.5f, -0.25f, -0.125f, 1.f};
+            std::vector<unsigned char> file;
+            const auto                 write = [&file](std::uint32_t value, std::size_t size)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                    file.push_back(static_cast<unsigned char>(value >> (8 * i)));
+            };
+            const auto dataSize = static_cast<std::uint32_t>(sizeof(values));
+            file.insert(file.end(), {'R', 'I', 'F', 'F'});
+            write(36 + dataSize, 4);
+            file.insert(file.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+            write(16, 4);
+            write(3, 2);
+            write(1, 2);
+            write(44100, 4);
+            write(44100 * 4, 4);
+            write(4, 2);
+            write(32, 2);
+            file.insert(file.end(), {'d', 'a', 't', 'a'});
+            write(dataSize, 4);
+            const auto* bytes = reinterpret_cast<const unsigned char*>(values.data());
+            file.insert(file.end(), bytes, bytes + dataSize);
+
+            auto inputSoundFile = sf::InputSoundFile::openFromMemory(file.data(), file.size()).value();
+            REQUIRE(inputSoundFile.getSampleCount() == values.size());
+
+            // The samples point into the file
+            CHECK(inputSoundFile.readInPlace(samples, 4) == 4);
+            REQUIRE(samples != nullptr);
+            CHECK(reinterpret_cast<const unsigned char*>(samples) == file.data() + 44);
+            CHECK(samples[3] == 0.5f);
+            CHECK(inputSoundFile.getSampleOffset() == 4);
+
+            // Regular reads continue where the samples read in place stopped
+            std::array<float, 2> floatSamples{};
+            CHECK(inputSoundFile.readFloat(floatSamples.data(), floatSamples.size()) == 2);
+            CHECK(floatSamples[0] == -0.5f);
+
+            CHECK(inputSoundFile.readInPlace(samples, 10) == 2);
+            CHECK(samples[1] == 1.f);
+            CHECK(inputSoundFile.readInPlace(samples, 10) == 0);
+
+            inputSoundFile.seek(0);
+            CHECK(inputSoundFile.readInPlace(samples, 10) == values.size());
+            CHECK(samples[0] == 0.f);
+        }
+    }
+
+    SECTION("readParallel()")
+    {
+        const auto checkReadParallel = [](const std::filesystem::path& filename)
+        {
+            auto                      inputSoundFile = sf::InputSoundFile::openFromFile(filename).value();
+            std::vector<std::int16_t> samples(static_cast<std::size_t>(inputSoundFile.getSampleCount()));
+            CHECK(inputSoundFile.read(samples.data(), samples.size()) == samples.size());
+
+            inputSoundFile.seek(0);
+            std::vector<std::int16_t> parallelSamples(samples.size());
+            CHECK(inputSoundFile.readParallel(parallelSamples.data(), parallelSamples.size(), 4) == samples.size());
+            CHECK(inputSoundFile.getSampleOffset() == samples.size());
+            CHECK(parallelSamples == samples);
+        };
+
+        SECTION("flac")
+        {
+            checkReadParallel("Audio/ding.flac");
+        }
+
+        SECTION("mp3")
+        {
+            checkReadParallel("Audio/ding.mp3");
+        }
+
+        SECTION("ogg")
+        {
+            checkReadParallel("Audio/doodle_pop.ogg");
+        }
+
+        SECTION("Float")
+        {
+            auto               inputSoundFile = sf::InputSoundFile::openFromFile("Audio/ding.flac").value();
+            std::vector<float> samples(static_cast<std::size_t>(inputSoundFile.getSampleCount()));
+            CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == samples.size());
+
+            inputSoundFile.seek(0);
+            std::vector<float> parallelSamples(samples.size());
+            CHECK(inputSoundFile.readParallelFloat(parallelSamples.data(), parallelSamples.size(), 4) ==
+                  samples.size());
+            CHECK(parallelSamples == samples);
+        }
+
+        SECTION("Stream")
+        {
+            sf::FileInputStream stream;
+            REQUIRE(stream.open("Audio/ding.flac"));
+            auto                      inputSoundFile = sf::InputSoundFile::openFromStream(stream).value();
+            std::vector<std::int16_t> samples(1'000);
+            CHECK(inputSoundFile.readParallel(samples.data(), samples.size(), 4) == samples.size());
+            CHECK(inputSoundFile.getSampleOffset() == samples.size());
+        }
     }
 
     SECTION("close()")
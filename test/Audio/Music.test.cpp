@@ -185,4 +185,40 @@ TEST_CASE("[Audio] sf::Music", runAudioDeviceTests())
         CHECK(music.getPlayingOffset() == sf::Time::Zero);
         CHECK(!music.getLoop());
     }
+
+    SECTION("queueFromFile()")
+    {
+        sf::Music music;
+        REQUIRE(music.openFromFile("Audio/ding.mp3"));
+
+        SECTION("clearQueue()")
+        {
+            music.queueFromFile("Audio/ding.flac");
+            music.queueFromFile("does/not/exist.wav");
+            CHECK(music.getQueueSize() == 2);
+            music.clearQueue();
+            CHECK(music.getQueueSize() == 0);
+        }
+
+        SECTION("Track change")
+        {
+            // The first track has a different sample rate and is skipped
+            music.queueFromFile("Audio/killdeer.wav");
+            music.queueFromFile("Audio/ding.mp3");
+            CHECK(music.getQueueSize() == 2);
+
+            music.play();
+            music.setPlayingOffset(sf::milliseconds(1900));
+            for (int i = 0; i < 300 && music.getQueueSize() > 0; ++i)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+            // The next track continues the stream from its beginning, once the samples decoded ahead are played
+            CHECK(music.getQueueSize() == 0);
+            for (int i = 0; i < 300 && music.getPlayingOffset() > sf::seconds(1); ++i)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            CHECK(music.getStatus() == sf::Music::Status::Playing);
+            CHECK(music.getPlayingOffset() < sf::seconds(1));
+            CHECK(music.getDuration() == sf::microseconds(1990884));
+        }
+    }
 }
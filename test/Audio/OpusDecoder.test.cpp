@@ -0,0 +1,59 @@
+#include <SFML/Audio/OpusDecoder.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/OpusEncoder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Audio] sf::OpusDecoder")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::OpusDecoder>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::OpusDecoder>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::OpusDecoder>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::OpusDecoder>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::OpusDecoder>);
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::OpusDecoder::create(22050, 1));
+        CHECK(!sf::OpusDecoder::create(48000, 8));
+        CHECK(sf::OpusDecoder::create(24000, 1).has_value() == sf::OpusDecoder::isAvailable());
+    }
+
+    SECTION("decode()")
+    {
+        auto encoder = sf::OpusEncoder::create(48000, 2);
+        auto decoder = sf::OpusDecoder::create(48000, 2);
+        if (!encoder || !decoder)
+            return;
+
+        std::vector<std::int16_t> input(encoder->getPacketSampleCount());
+        for (std::size_t i = 0; i < input.size(); ++i)
+            input[i] = static_cast<std::int16_t>((i % 100) * 300);
+
+        std::vector<std::byte> packet;
+        encoder->pushSamples(input.data(), input.size());
+        REQUIRE(encoder->popPacket(packet));
+
+        // A packet decodes to as many samples as were encoded
+        std::vector<std::int16_t> output;
+        CHECK(decoder->decode(packet.data(), packet.size(), output));
+        CHECK(output.size() == input.size());
+
+        // A lost packet is concealed with the same amount of samples
+        decoder->decodeLost(output);
+        CHECK(output.size() == 2 * input.size());
+
+        // Garbage is rejected and leaves the samples untouched
+        const std::array<std::byte, 3> garbage{std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}};
+        CHECK(!decoder->decode(garbage.data(), garbage.size(), output));
+        CHECK(output.size() == 2 * input.size());
+    }
+}
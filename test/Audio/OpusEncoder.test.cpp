@@ -0,0 +1,62 @@
+#include <SFML/Audio/OpusEncoder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Audio] sf::OpusEncoder")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::OpusEncoder>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::OpusEncoder>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::OpusEncoder>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::OpusEncoder>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::OpusEncoder>);
+    }
+
+    SECTION("create()")
+    {
+        SECTION("Unsupported format")
+        {
+            CHECK(!sf::OpusEncoder::create(44100, 1));
+            CHECK(!sf::OpusEncoder::create(48000, 0));
+            CHECK(!sf::OpusEncoder::create(48000, 3));
+        }
+
+        SECTION("Supported format")
+        {
+            const auto encoder = sf::OpusEncoder::create(16000, 2, sf::OpusEncoder::Application::Audio);
+            CHECK(encoder.has_value() == sf::OpusEncoder::isAvailable());
+            if (encoder)
+            {
+                CHECK(encoder->getSampleRate() == 16000);
+                CHECK(encoder->getChannelCount() == 2);
+                CHECK(encoder->getPacketSampleCount() == 640);
+            }
+        }
+    }
+
+    SECTION("popPacket()")
+    {
+        auto encoder = sf::OpusEncoder::create(48000, 1);
+        if (!encoder)
+            return;
+
+        // Packets are only produced once 20 ms of samples are buffered
+        const std::vector<std::int16_t> samples(700, 1000);
+        std::vector<std::byte>          packet;
+        encoder->pushSamples(samples.data(), samples.size());
+        CHECK(!encoder->popPacket(packet));
+        encoder->pushSamples(samples.data(), samples.size());
+        CHECK(encoder->popPacket(packet));
+        CHECK(!packet.empty());
+        CHECK(!encoder->popPacket(packet));
+
+        // Flushing pads the remaining samples
+        encoder->flush();
+        CHECK(encoder->popPacket(packet));
+        CHECK(!encoder->popPacket(packet));
+    }
+}
@@ -1,9 +1,83 @@
 #include <SFML/Audio/OutputSoundFile.hpp>
 
+// Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
 #include <type_traits>
+#include <vector>
 
 static_assert(!std::is_default_constructible_v<sf::OutputSoundFile>);
 static_assert(!std::is_copy_constructible_v<sf::OutputSoundFile>);
 static_assert(!std::is_copy_assignable_v<sf::OutputSoundFile>);
 static_assert(std::is_nothrow_move_constructible_v<sf::OutputSoundFile>);
 static_assert(std::is_nothrow_move_assignable_v<sf::OutputSoundFile>);
+
+TEST_CASE("[Audio] sf::OutputSoundFile")
+{
+    const auto filename = std::filesystem::temp_directory_path() / "sfml-output-sound-file-test.wav";
+
+    std::vector<std::int16_t> samples(10'000);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+        samples[i] = static_cast<std::int16_t>(i);
+
+    SECTION("Synchronous writing")
+    {
+        auto file = sf::OutputSoundFile::openFromFile(filename, 44100, 1, {sf::SoundChannel::Mono}).value();
+        CHECK(!file.isAsync());
+        file.write(samples.data(), samples.size());
+        file.flush().get();
+
+        const sf::OutputSoundFile::AsyncStatistics statistics = file.getAsyncStatistics();
+        CHECK(statistics.encodedSampleCount == 0);
+        CHECK(statistics.peakQueuedSampleCount == 0);
+    }
+
+    SECTION("Asynchronous writing")
+    {
+        auto file = sf::OutputSoundFile::openFromFile(filename, 44100, 1, {sf::SoundChannel::Mono}).value();
+        file.startAsyncWriting(4096);
+        CHECK(file.isAsync());
+
+        // The queue is smaller than the samples, write waits for the encoder thread
+        for (std::size_t i = 0; i < samples.size(); i += 1000)
+            file.write(samples.data() + i, 1000);
+        file.flush().get();
+
+        const sf::OutputSoundFile::AsyncStatistics statistics = file.getAsyncStatistics();
+        CHECK(statistics.queuedSampleCount == 0);
+        CHECK(statistics.peakQueuedSampleCount <= 4096);
+        CHECK(statistics.encodedSampleCount == samples.size());
+        CHECK(statistics.droppedSampleCount == 0);
+
+        // Moving the file keeps the encoder thread running
+        sf::OutputSoundFile moved = std::move(file);
+        moved.write(samples.data(), 100);
+        moved.close();
+
+        auto input = sf::InputSoundFile::openFromFile(filename).value();
+        REQUIRE(input.getSampleCount() == samples.size() + 100);
+        std::vector<std::int16_t> read(samples.size());
+        CHECK(input.read(read.data(), read.size()) == samples.size());
+        CHECK(read == samples);
+    }
+
+    SECTION("Dropped samples")
+    {
+        auto file = sf::OutputSoundFile::openFromFile(filename, 44100, 1, {sf::SoundChannel::Mono}).value();
+        file.startAsyncWriting(1000, sf::OutputSoundFile::OverflowPolicy::Drop);
+
+        // The queue is rounded up to 1024 samples, a single write can't fit more
+        file.write(samples.data(), samples.size());
+        file.flush().get();
+
+        const sf::OutputSoundFile::AsyncStatistics statistics = file.getAsyncStatistics();
+        CHECK(statistics.encodedSampleCount == 1024);
+        CHECK(statistics.droppedSampleCount == samples.size() - 1024);
+        CHECK(statistics.stallCount == 0);
+    }
+
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,117 @@
+#include <SFML/Audio/PlaybackDevice.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <numeric>
+
+TEST_CASE("[Audio] sf::PlaybackDevice", runAudioDeviceTests())
+{
+    SECTION("Settings")
+    {
+        SECTION("Default")
+        {
+            const sf::PlaybackDevice::Settings settings;
+            CHECK(settings.periodSizeInFrames == 0);
+            CHECK(settings.periodCount == 0);
+            CHECK(settings.sampleRate == 0);
+            CHECK(!settings.exclusiveMode);
+            CHECK(!settings.lowLatency);
+            CHECK(!settings.binaural);
+        }
+
+        // The device is created by the first audio resource
+        const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+        sf::Sound  sound(soundBuffer);
+
+        SECTION("getActiveSettings()")
+        {
+            const auto activeSettings = sf::PlaybackDevice::getActiveSettings();
+            REQUIRE(activeSettings);
+            CHECK(activeSettings->periodSizeInFrames > 0);
+            CHECK(activeSettings->periodCount > 0);
+            CHECK(activeSettings->sampleRate > 0);
+            CHECK(sf::PlaybackDevice::getLatency() > sf::Time::Zero);
+        }
+
+        SECTION("setSettings()")
+        {
+            sf::PlaybackDevice::Settings settings;
+            settings.periodSizeInFrames = 128;
+            settings.periodCount        = 2;
+            settings.sampleRate         = 48000;
+            settings.lowLatency         = true;
+            CHECK(sf::PlaybackDevice::setSettings(settings));
+
+            const auto requestedSettings = sf::PlaybackDevice::getSettings();
+            CHECK(requestedSettings.periodSizeInFrames == 128);
+            CHECK(requestedSettings.periodCount == 2);
+            CHECK(requestedSettings.sampleRate == 48000);
+            CHECK(!requestedSettings.exclusiveMode);
+            CHECK(requestedSettings.lowLatency);
+
+            const auto activeSettings = sf::PlaybackDevice::getActiveSettings();
+            REQUIRE(activeSettings);
+            CHECK(activeSettings->sampleRate > 0);
+            CHECK(activeSettings->lowLatency);
+            CHECK(sf::PlaybackDevice::getLatency() > sf::Time::Zero);
+
+            // Restore the default configuration for the other tests
+            CHECK(sf::PlaybackDevice::setSettings({}));
+            CHECK(!sf::PlaybackDevice::getSettings().lowLatency);
+        }
+
+        SECTION("Binaural mode")
+        {
+            sf::PlaybackDevice::Settings settings;
+            settings.binaural = true;
+            CHECK(sf::PlaybackDevice::setSettings(settings));
+
+            const auto activeSettings = sf::PlaybackDevice::getActiveSettings();
+            REQUIRE(activeSettings);
+            CHECK(activeSettings->binaural);
+
+            CHECK(sf::PlaybackDevice::setSettings({}));
+            CHECK(!sf::PlaybackDevice::getActiveSettings().value().binaural);
+        }
+
+        SECTION("getClock()")
+        {
+            const std::uint64_t start = sf::PlaybackDevice::getClock();
+            sf::sleep(sf::milliseconds(100));
+            CHECK(sf::PlaybackDevice::getClock() > start);
+        }
+
+        SECTION("getStatistics()")
+        {
+            sound.play();
+            sf::sleep(sf::milliseconds(100));
+
+            const sf::PlaybackDevice::Statistics statistics = sf::PlaybackDevice::getStatistics();
+            CHECK(statistics.callbackCount > 0);
+            const auto& histogram = statistics.loadHistogram;
+            CHECK(std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{0}) > 0);
+            CHECK(statistics.lateCallbackCount <= statistics.callbackCount);
+            CHECK(statistics.maxCallbackDuration >= statistics.lastCallbackDuration);
+            CHECK(statistics.periodSizeInFrames > 0);
+            CHECK(statistics.periodDuration > sf::Time::Zero);
+            CHECK(statistics.activeVoiceCount == 1);
+            CHECK(statistics.streamingVoiceCount == 0);
+            CHECK(statistics.minDecodeAheadFill == 1.f);
+
+            sound.stop();
+            sf::PlaybackDevice::resetStatistics();
+
+            const sf::PlaybackDevice::Statistics reset = sf::PlaybackDevice::getStatistics();
+            CHECK(reset.callbackCount < statistics.callbackCount);
+            CHECK(reset.underrunCount == 0);
+            CHECK(reset.periodSizeInFrames > 0);
+        }
+    }
+}
@@ -1,14 +1,17 @@
 #include <SFML/Audio/Sound.hpp>
 
 // Other 1st party headers
+#include <SFML/Audio/PlaybackDevice.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 
+#include <SFML/System/Sleep.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <array>
 #include <type_traits>
 
 TEST_CASE("[Audio] sf::Sound", runAudioDeviceTests())
@@ -82,4 +85,50 @@ TEST_CASE("[Audio] sf::Sound", runAudioDeviceTests())
         sound.setPlayingOffset(sf::seconds(10));
         CHECK(sound.getPlayingOffset() == sf::seconds(10));
     }
+
+    SECTION("Scheduled playback")
+    {
+        sf::Sound sound(soundBuffer);
+
+        // The sound waits for the audio clock to reach its start time
+        const std::uint64_t start = sf::PlaybackDevice::getClock() + 10 * soundBuffer.getSampleRate();
+        sound.playAt(start);
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        CHECK(sound.getPlayingOffset() == sf::Time::Zero);
+
+        // A stop time that has already passed stops it
+        sound.stopAt(sf::PlaybackDevice::getClock());
+        CHECK(sound.getStatus() == sf::Sound::Status::Stopped);
+
+        // Playing again cancels the scheduled stop
+        sound.play();
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        sound.stopAt(start);
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        sound.stop();
+        CHECK(sound.getStatus() == sf::Sound::Status::Stopped);
+    }
+
+    SECTION("updateSpatial()")
+    {
+        sf::Sound first(soundBuffer);
+        sf::Sound second(soundBuffer);
+        second.setVelocity({1, 1, 1});
+
+        const std::array<sf::SoundSource::SpatialUpdate, 3> updates{
+            {{&first, sf::Vector3f(1, 2, 3), sf::Vector3f(4, 5, 6), sf::Vector3f(0, 0, 1)},
+             {&second, sf::Vector3f(-1, -2, -3), std::nullopt, std::nullopt},
+             {nullptr, sf::Vector3f(), std::nullopt, std::nullopt}}};
+        sf::SoundSource::updateSpatial(updates.data(), updates.size());
+
+        // The updates are applied by the audio thread at the start of the next period
+        for (int i = 0; (i < 100) && (first.getPosition() != sf::Vector3f(1, 2, 3)); ++i)
+            sf::sleep(sf::milliseconds(10));
+
+        CHECK(first.getPosition() == sf::Vector3f(1, 2, 3));
+        CHECK(first.getVelocity() == sf::Vector3f(4, 5, 6));
+        CHECK(first.getDirection() == sf::Vector3f(0, 0, 1));
+        CHECK(second.getPosition() == sf::Vector3f(-1, -2, -3));
+        CHECK(second.getVelocity() == sf::Vector3f(1, 1, 1));
+    }
 }
@@ -7,8 +7,13 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <filesystem>
 #include <type_traits>
+#include <vector>
+
+#include <cmath>
 
 TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
 {
@@ -64,6 +69,57 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
             CHECK(soundBuffer.getSampleRate() == 44100);
             CHECK(soundBuffer.getChannelCount() == 1);
             CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
+            CHECK(soundBuffer.getFloatSamples() == nullptr);
+        }
+
+        SECTION("Floating point samples")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac", sf::SampleFormat::Float32).value();
+            CHECK(soundBuffer.getSamples() == nullptr);
+            CHECK(soundBuffer.getFloatSamples() != nullptr);
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
+    SECTION("loadFromFile() with conversion")
+    {
+        const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/killdeer.wav", {48'000, {}}).value();
+        CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
+        CHECK(soundBuffer.getSampleCount() == 245'858);
+        CHECK(soundBuffer.getSampleRate() == 48'000);
+        CHECK(soundBuffer.getChannelCount() == 1);
+        CHECK(soundBuffer.getDuration() == sf::microseconds(5'122'041));
+    }
+
+    SECTION("loadFromSamples()")
+    {
+        constexpr std::array<float, 4> samples{0.f, 0.5f, -0.5f, 1.f};
+
+        SECTION("Invalid samples")
+        {
+            CHECK(!sf::SoundBuffer::loadFromSamples(samples.data(), 0, 1, 44100, {sf::SoundChannel::Mono}));
+        }
+
+        SECTION("Floating point samples")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadFromSamples(samples.data(),
+                                                                      samples.size(),
+                                                                      2,
+                                                                      44100,
+                                                                      {sf::SoundChannel::FrontLeft,
+                                                                       sf::SoundChannel::FrontRight})
+                                         .value();
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getSamples() == nullptr);
+            CHECK(soundBuffer.getFloatSamples()[1] == 0.5f);
+            CHECK(soundBuffer.getSampleCount() == 4);
+            CHECK(soundBuffer.getChannelCount() == 2);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(45));
         }
     }
 
@@ -109,6 +165,147 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         }
     }
 
+    SECTION("loadFromMappedFile()")
+    {
+        SECTION("Invalid filename")
+        {
+            CHECK(!sf::SoundBuffer::loadFromMappedFile("does/not/exist.wav"));
+        }
+
+        SECTION("16-bit PCM wav")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "ding.wav";
+            const auto original = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+            REQUIRE(original.saveToFile(filename));
+
+            {
+                const auto soundBuffer = sf::SoundBuffer::loadFromMappedFile(filename).value();
+                CHECK(soundBuffer.getSampleCount() == 87798);
+                CHECK(soundBuffer.getSampleRate() == 44100);
+                CHECK(soundBuffer.getChannelCount() == 1);
+                CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+                CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
+                CHECK(std::equal(soundBuffer.getSamples(),
+                                 soundBuffer.getSamples() + soundBuffer.getSampleCount(),
+                                 original.getSamples()));
+
+                // Copies share the mapped samples
+                const sf::SoundBuffer copy(soundBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+                CHECK(copy.getSamples() == soundBuffer.getSamples());
+                CHECK(copy.getSampleCount() == 87798);
+            }
+
+            CHECK(std::filesystem::remove(filename));
+        }
+
+        SECTION("Decoded file")
+        {
+            const auto soundBuffer = sf::SoundBuffer::loadFromMappedFile("Audio/ding.flac").value();
+            CHECK(soundBuffer.getSamples() != nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
+    SECTION("convert()")
+    {
+        // One second of a 1 kHz sine
+        const auto sineAt = [](std::size_t index, unsigned int rate)
+        { return 0.5f * std::sin(2.f * 3.14159265f * 1000.f * static_cast<float>(index) / static_cast<float>(rate)); };
+
+        std::vector<float> sine(44100);
+        for (std::size_t i = 0; i < sine.size(); ++i)
+            sine[i] = sineAt(i, 44100);
+        const auto soundBuffer = sf::SoundBuffer::loadFromSamples(sine.data(),
+                                                                  sine.size(),
+                                                                  1,
+                                                                  44100,
+                                                                  {sf::SoundChannel::Mono})
+                                     .value();
+
+        // Compare the samples away from the edges to the sine at the new rate
+        const auto checkSine = [&](const sf::SoundBuffer& converted)
+        {
+            const unsigned int rate = converted.getSampleRate();
+            for (std::size_t i = rate / 4; i < rate * 3 / 4; i += 97)
+                CHECK(std::abs(converted.getFloatSamples()[i * converted.getChannelCount()] - sineAt(i, rate)) < 1e-3f);
+        };
+
+        SECTION("Upsampling")
+        {
+            const auto converted = soundBuffer.convert({48000, {}}).value();
+            CHECK(converted.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(converted.getSampleCount() == 48000);
+            CHECK(converted.getSampleRate() == 48000);
+            CHECK(converted.getChannelCount() == 1);
+            CHECK(converted.getDuration() == sf::seconds(1));
+            checkSine(converted);
+        }
+
+        SECTION("Downsampling")
+        {
+            const auto converted = soundBuffer.convert({22050, {}}).value();
+            CHECK(converted.getSampleCount() == 22050);
+            CHECK(converted.getSampleRate() == 22050);
+            checkSine(converted);
+        }
+
+        SECTION("Channels")
+        {
+            const std::vector<sf::SoundChannel> stereo{sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight};
+            const auto                          converted = soundBuffer.convert({48000, stereo}).value();
+            CHECK(converted.getSampleCount() == 96000);
+            CHECK(converted.getChannelCount() == 2);
+            CHECK(converted.getChannelMap() == stereo);
+            CHECK(converted.getDuration() == sf::seconds(1));
+            for (std::size_t i = 0; i < 48000; i += 101)
+                CHECK(converted.getFloatSamples()[2 * i] == converted.getFloatSamples()[2 * i + 1]);
+            checkSine(converted);
+        }
+
+        SECTION("Same format")
+        {
+            const auto converted = soundBuffer.convert({44100, {}}).value();
+            CHECK(std::equal(sine.begin(), sine.end(), converted.getFloatSamples()));
+        }
+    }
+
+    SECTION("loadFromFiles()")
+    {
+        const std::vector<std::filesystem::path> filenames = {"Audio/ding.flac",
+                                                              "does/not/exist.wav",
+                                                              "Audio/killdeer.wav",
+                                                              "Audio/ding.flac"};
+
+        SECTION("Default thread count")
+        {
+            const auto soundBuffers = sf::SoundBuffer::loadFromFiles(filenames);
+            REQUIRE(soundBuffers.size() == 4);
+            CHECK(soundBuffers[0].has_value());
+            CHECK(!soundBuffers[1].has_value());
+            CHECK(soundBuffers[2].has_value());
+            CHECK(soundBuffers[3].has_value());
+            CHECK(soundBuffers[0]->getSampleCount() == 87798);
+            CHECK(soundBuffers[3]->getSampleCount() == 87798);
+        }
+
+        SECTION("Single thread")
+        {
+            const auto soundBuffers = sf::SoundBuffer::loadFromFiles(filenames, sf::SampleFormat::Float32, 1);
+            REQUIRE(soundBuffers.size() == 4);
+            CHECK(soundBuffers[0]->getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(!soundBuffers[1].has_value());
+            CHECK(soundBuffers[2]->getSampleFormat() == sf::SampleFormat::Float32);
+        }
+
+        SECTION("No files")
+        {
+            CHECK(sf::SoundBuffer::loadFromFiles({}).empty());
+        }
+    }
+
     SECTION("saveToFile()")
     {
         const auto filename = std::filesystem::temp_directory_path() / "ding.flac";
@@ -126,5 +323,21 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
 
         CHECK(std::filesystem::remove(filename));
+
+        SECTION("Floating point samples")
+        {
+            {
+                const auto floatBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac", sf::SampleFormat::Float32).value();
+                REQUIRE(floatBuffer.saveToFile(filename));
+            }
+
+            const auto savedBuffer = sf::SoundBuffer::loadFromFile(filename).value();
+            CHECK(savedBuffer.getSampleCount() == 87798);
+            CHECK(std::equal(savedBuffer.getSamples(),
+                             savedBuffer.getSamples() + savedBuffer.getSampleCount(),
+                             soundBuffer.getSamples()));
+
+            CHECK(std::filesystem::remove(filename));
+        }
     }
 }
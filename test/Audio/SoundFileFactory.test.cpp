@@ -141,6 +141,14 @@ TEST_CASE("[Audio] sf::SoundFileFactory")
 
             CHECK(sf::SoundFileFactory::createReaderFromStream(stream));
         }
+
+        SECTION("Format hint")
+        {
+            REQUIRE(stream.open("Audio/killdeer.wav"));
+            CHECK(sf::SoundFileFactory::createReaderFromStream(stream, "killdeer.WAV"));
+            CHECK(sf::SoundFileFactory::createReaderFromStream(stream, "killdeer.bin"));
+            CHECK(sf::SoundFileFactory::createReaderFromStream(stream, ""));
+        }
     }
 
     SECTION("createWriterFromFilename()")
@@ -0,0 +1,105 @@
+#include <SFML/Audio/SoundPool.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::SoundPool", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::SoundPool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::SoundPool>);
+    }
+
+    const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+    sf::Listener::setPosition({});
+
+    SECTION("Construction")
+    {
+        const sf::SoundPool soundPool(4, 16);
+        CHECK(soundPool.getVoiceCount() == 4);
+        CHECK(soundPool.getCapacity() == 16);
+        CHECK(soundPool.getPlayingCount() == 0);
+        CHECK(soundPool.getVirtualCount() == 0);
+    }
+
+    SECTION("play()")
+    {
+        sf::SoundPool soundPool(2, 4);
+
+        SECTION("Real voices")
+        {
+            CHECK(soundPool.play(soundBuffer));
+            CHECK(soundPool.play(soundBuffer));
+            CHECK(soundPool.getPlayingCount() == 2);
+            CHECK(soundPool.getVirtualCount() == 0);
+        }
+
+        SECTION("Virtual voices")
+        {
+            CHECK(soundPool.play(soundBuffer));
+            CHECK(soundPool.play(soundBuffer));
+            CHECK(soundPool.play(soundBuffer, {}, 50.f));
+            CHECK(soundPool.getPlayingCount() == 3);
+            CHECK(soundPool.getVirtualCount() == 1);
+
+            // A more important sound steals a voice
+            CHECK(soundPool.play(soundBuffer, {}, 100.f, 1));
+            CHECK(soundPool.getPlayingCount() == 4);
+            CHECK(soundPool.getVirtualCount() == 2);
+            CHECK(sf::PlaybackDevice::getStatistics().virtualVoiceCount == 2);
+        }
+
+        SECTION("Full pool")
+        {
+            for (int i = 0; i < 4; ++i)
+                CHECK(soundPool.play(soundBuffer));
+
+            CHECK(!soundPool.play(soundBuffer, {}, 50.f));
+            CHECK(soundPool.play(soundBuffer, {}, 100.f, 1));
+            CHECK(soundPool.getPlayingCount() == 4);
+        }
+
+        SECTION("Inaudible sounds")
+        {
+            CHECK(soundPool.play(soundBuffer, {}, 0.f, 10));
+            CHECK(soundPool.play(soundBuffer, {1'000'000.f, 0.f, 0.f}));
+            CHECK(soundPool.getPlayingCount() == 2);
+            CHECK(soundPool.getVirtualCount() == 2);
+        }
+    }
+
+    SECTION("update()")
+    {
+        sf::SoundPool soundPool(1, 2);
+        CHECK(soundPool.play(soundBuffer, {1'000'000.f, 0.f, 0.f}));
+        CHECK(soundPool.getVirtualCount() == 1);
+
+        // The sound gets a voice once the listener comes close enough
+        sf::Listener::setPosition({1'000'000.f, 0.f, 0.f});
+        soundPool.update();
+        CHECK(soundPool.getPlayingCount() == 1);
+        CHECK(soundPool.getVirtualCount() == 0);
+        sf::Listener::setPosition({});
+    }
+
+    SECTION("stop()")
+    {
+        sf::SoundPool soundPool(2, 4);
+        CHECK(soundPool.play(soundBuffer));
+        CHECK(soundPool.play(soundBuffer));
+        CHECK(soundPool.play(soundBuffer));
+        CHECK(sf::PlaybackDevice::getStatistics().virtualVoiceCount == 1);
+        soundPool.stop();
+        CHECK(soundPool.getPlayingCount() == 0);
+        CHECK(soundPool.getVirtualCount() == 0);
+        CHECK(sf::PlaybackDevice::getStatistics().virtualVoiceCount == 0);
+    }
+}
@@ -37,6 +37,7 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
     {
         const sf::SoundStream::Chunk chunk;
         CHECK(chunk.samples == nullptr);
+        CHECK(chunk.floatSamples == nullptr);
         CHECK(chunk.sampleCount == 0);
     }
 
@@ -48,6 +49,8 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         CHECK(soundStream.getStatus() == sf::SoundStream::Status::Stopped);
         CHECK(soundStream.getPlayingOffset() == sf::Time::Zero);
         CHECK(!soundStream.getLoop());
+        CHECK(soundStream.getDecodeAheadDuration() == sf::Time::Zero);
+        CHECK(soundStream.getUnderrunCount() == 0);
     }
 
     SECTION("Set/get playing offset")
@@ -63,4 +66,14 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         soundStream.setLoop(true);
         CHECK(soundStream.getLoop());
     }
+
+    SECTION("Set/get decode ahead duration")
+    {
+        SoundStream soundStream;
+        soundStream.setDecodeAheadDuration(sf::milliseconds(500));
+        CHECK(soundStream.getDecodeAheadDuration() == sf::milliseconds(500));
+
+        soundStream.setDecodeAheadDuration(sf::milliseconds(-100));
+        CHECK(soundStream.getDecodeAheadDuration() == sf::Time::Zero);
+    }
 }
@@ -0,0 +1,147 @@
+#include <SFML/Graphics/AnimatedImage.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/TextureArray.hpp>
+
+#include <SFML/System/FileInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::AnimatedImage", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AnimatedImage>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AnimatedImage>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::AnimatedImage animatedImage;
+        CHECK(animatedImage.getSize() == sf::Vector2u());
+        CHECK(animatedImage.getFrameCount() == 0);
+        CHECK(animatedImage.getDuration() == sf::Time::Zero);
+        CHECK(animatedImage.getFrameAt(sf::seconds(1)) == 0);
+        CHECK(animatedImage.getCacheCapacity() == 8);
+        CHECK(animatedImage.getPrefetchCount() == 2);
+        CHECK(!animatedImage.isSmooth());
+        CHECK(animatedImage.getFrame() == 0);
+        CHECK(animatedImage.getTextureArray() == nullptr);
+        CHECK(animatedImage.getCachedFrameCount() == 0);
+    }
+
+    if (!sf::TextureArray::isAvailable())
+        return;
+
+    sf::AnimatedImage animatedImage;
+
+    SECTION("openFromFile()")
+    {
+        SECTION("Invalid file")
+        {
+            CHECK(!animatedImage.openFromFile("does/not/exist.gif"));
+            CHECK(!animatedImage.openFromFile("Graphics/sfml-logo-big.png"));
+            CHECK(animatedImage.getFrameCount() == 0);
+            CHECK(animatedImage.getTextureArray() == nullptr);
+        }
+
+        SECTION("Still image")
+        {
+            REQUIRE(animatedImage.openFromFile("Graphics/sfml-logo-big.gif"));
+            CHECK(animatedImage.getSize() == sf::Vector2u(1001, 304));
+            CHECK(animatedImage.getFrameCount() == 1);
+            CHECK(animatedImage.getCacheCapacity() == 1);
+            CHECK(animatedImage.getCachedFrameCount() == 1);
+        }
+
+        SECTION("Animation")
+        {
+            REQUIRE(animatedImage.openFromFile("Graphics/sfml-animated.gif"));
+            CHECK(animatedImage.getSize() == sf::Vector2u(4, 4));
+            CHECK(animatedImage.getFrameCount() == 3);
+            CHECK(animatedImage.getFrameDelay(0) == sf::milliseconds(100));
+            CHECK(animatedImage.getFrameDelay(1) == sf::milliseconds(200));
+            CHECK(animatedImage.getFrameDelay(2) == sf::milliseconds(100));
+            CHECK(animatedImage.getDuration() == sf::milliseconds(400));
+            CHECK(animatedImage.getFrame() == 0);
+            REQUIRE(animatedImage.getTextureArray() != nullptr);
+            CHECK(animatedImage.getTextureArray()->getSize() == sf::Vector2u(4, 4));
+            CHECK(animatedImage.getTextureArray()->getLayerCount() == 3);
+        }
+    }
+
+    SECTION("openFromMemory()")
+    {
+        std::ifstream           file("Graphics/sfml-animated.gif", std::ios::binary);
+        const std::vector<char>   memory((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        CHECK(!animatedImage.openFromMemory(nullptr, 1));
+        CHECK(!animatedImage.openFromMemory(memory.data(), 10));
+        REQUIRE(animatedImage.openFromMemory(memory.data(), memory.size()));
+        CHECK(animatedImage.getFrameCount() == 3);
+    }
+
+    SECTION("openFromStream()")
+    {
+        sf::FileInputStream stream;
+        CHECK(!animatedImage.openFromStream(stream));
+        REQUIRE(stream.open("Graphics/sfml-animated.gif"));
+        REQUIRE(animatedImage.openFromStream(stream));
+        CHECK(animatedImage.getFrameCount() == 3);
+    }
+
+    SECTION("getFrameAt()")
+    {
+        REQUIRE(animatedImage.openFromFile("Graphics/sfml-animated.gif"));
+        CHECK(animatedImage.getFrameAt(sf::Time::Zero) == 0);
+        CHECK(animatedImage.getFrameAt(sf::milliseconds(99)) == 0);
+        CHECK(animatedImage.getFrameAt(sf::milliseconds(100)) == 1);
+        CHECK(animatedImage.getFrameAt(sf::milliseconds(350)) == 2);
+        CHECK(animatedImage.getFrameAt(sf::milliseconds(450)) == 0);
+    }
+
+    SECTION("setFrame()")
+    {
+        animatedImage.setPrefetchCount(0);
+        REQUIRE(animatedImage.openFromFile("Graphics/sfml-animated.gif"));
+        CHECK(!animatedImage.setFrame(3));
+
+        animatedImage.setCacheCapacity(2);
+        CHECK(animatedImage.getCacheCapacity() == 2);
+        CHECK(animatedImage.getCachedFrameCount() == 0);
+
+        CHECK(animatedImage.setFrame(2));
+        CHECK(animatedImage.getFrame() == 2);
+        CHECK(animatedImage.getCachedFrameCount() == 1);
+        const unsigned int layer = animatedImage.getLayer();
+
+        CHECK(animatedImage.setFrame(0));
+        CHECK(animatedImage.getCachedFrameCount() == 2);
+        CHECK(animatedImage.getLayer() != layer);
+
+        // Frame 2 is the least recently used one
+        CHECK(animatedImage.setFrame(1));
+        CHECK(animatedImage.getLayer() == layer);
+        CHECK(animatedImage.getCachedFrameCount() == 2);
+    }
+
+    SECTION("Prefetch")
+    {
+        REQUIRE(animatedImage.openFromFile("Graphics/sfml-animated.gif"));
+        for (int i = 0; (i < 100) && (animatedImage.getCachedFrameCount() < 3); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            CHECK(animatedImage.setFrame(0));
+        }
+
+        CHECK(animatedImage.getCachedFrameCount() == 3);
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <SystemUtil.hpp>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::CircleShape")
 {
@@ -107,6 +108,24 @@ TEST_CASE("[Graphics] sf::CircleShape")
         CHECK(circle.getGeometricCenter() == sf::Vector2f(4.f, 4.f));
     }
 
+    SECTION("Get points")
+    {
+        const sf::CircleShape circle(3.f, 12);
+        const sf::CircleShape otherCircle(7.f, 12);
+
+        std::vector<sf::Vector2f> points(circle.getPointCount());
+        std::vector<sf::Vector2f> otherPoints(otherCircle.getPointCount());
+        circle.getPoints(points.data());
+        otherCircle.getPoints(otherPoints.data());
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            CHECK(points[i] == circle.getPoint(i));
+            CHECK(otherPoints[i] == otherCircle.getPoint(i));
+            CHECK(otherPoints[i] == Approx((points[i] - sf::Vector2f(3, 3)) * 7.f / 3.f + sf::Vector2f(7, 7)));
+        }
+    }
+
     SECTION("Equilateral triangle")
     {
         const sf::CircleShape triangle(2.f, 3);
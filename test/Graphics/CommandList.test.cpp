@@ -0,0 +1,259 @@
+#include <SFML/Graphics/CommandList.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::CommandList")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::CommandList>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::CommandList>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::CommandList>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::CommandList>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::CommandList>);
+        STATIC_CHECK(std::has_virtual_destructor_v<sf::CommandList>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::CommandList commandList({640, 480});
+        CHECK(commandList.getSize() == sf::Vector2u(640, 480));
+        CHECK(commandList.getCommandCount() == 0);
+        CHECK(commandList.getView().getCenter() == sf::Vector2f(320, 240));
+        CHECK(commandList.getView().getSize() == sf::Vector2f(640, 480));
+        CHECK(commandList.getDefaultView().getSize() == sf::Vector2f(640, 480));
+        CHECK(!commandList.isBatchingEnabled());
+        CHECK(!commandList.isSortingEnabled());
+        CHECK(commandList.getLayer() == 0);
+    }
+
+    SECTION("setActive()")
+    {
+        sf::CommandList commandList({640, 480});
+        CHECK(!commandList.setActive());
+        CHECK(commandList.setActive(false));
+    }
+
+    SECTION("Record")
+    {
+        sf::CommandList commandList({640, 480});
+        commandList.clear(sf::Color::Red);
+        commandList.clearStencil(0);
+        commandList.setView(sf::View({1, 2}, {3, 4}));
+        commandList.draw(sf::RectangleShape({10, 10}));
+        CHECK(commandList.getCommandCount() == 4);
+        CHECK(commandList.getView().getCenter() == sf::Vector2f(1, 2));
+        CHECK(commandList.getStatistics().drawCalls == 0);
+
+        commandList.pushGLStates();
+        commandList.resetGLStates();
+        commandList.popGLStates();
+        CHECK(commandList.getCommandCount() == 4);
+
+        commandList.reset();
+        CHECK(commandList.getCommandCount() == 0);
+    }
+
+    SECTION("Record instances")
+    {
+        const std::array vertices   = {sf::Vertex{{0, 0}}, sf::Vertex{{1, 0}}, sf::Vertex{{0, 1}}};
+        const std::array transforms = {sf::Transform::Identity, sf::Transform::Identity};
+
+        sf::CommandList commandList({640, 480});
+        commandList.draw(vertices.data(),
+                         vertices.size(),
+                         sf::PrimitiveType::Triangles,
+                         transforms.data(),
+                         nullptr,
+                         transforms.size());
+        CHECK(commandList.getCommandCount() == 1);
+    }
+
+    SECTION("Replay")
+    {
+        sf::CommandList commandList({640, 480});
+        commandList.clear(sf::Color::Blue, 1);
+        commandList.setView(sf::View({1, 2}, {3, 4}));
+        commandList.draw(sf::RectangleShape({10, 10}));
+
+        sf::CommandList target({800, 600});
+        commandList.replay(target);
+        CHECK(target.getView().getCenter() == sf::Vector2f(400, 300));
+
+        // Restoring the view of the target is part of the replay
+        CHECK(target.getCommandCount() == 4);
+
+        // The recorded commands are kept
+        commandList.replay(target);
+        CHECK(commandList.getCommandCount() == 3);
+        CHECK(target.getCommandCount() == 8);
+    }
+
+    SECTION("Batching")
+    {
+        sf::CommandList commandList({640, 480});
+        commandList.setBatchingEnabled(true);
+        commandList.draw(sf::RectangleShape({10, 10}));
+        commandList.draw(sf::RectangleShape({20, 20}));
+        CHECK(commandList.getCommandCount() == 0);
+
+        sf::CommandList target({640, 480});
+        commandList.replay(target);
+        CHECK(commandList.getCommandCount() == 1);
+        CHECK(target.getCommandCount() == 1);
+
+        commandList.draw(sf::RectangleShape({10, 10}));
+        commandList.reset();
+        commandList.replay(target);
+        CHECK(commandList.getCommandCount() == 0);
+    }
+
+    SECTION("Sorting")
+    {
+        sf::RectangleShape alphaShape({10, 10});
+        sf::RectangleShape addShape({10, 10});
+        alphaShape.setPosition({20, 20});
+
+        sf::CommandList commandList({640, 480});
+        commandList.draw(alphaShape, sf::BlendAlpha);
+        commandList.draw(addShape, sf::BlendAdd);
+        commandList.draw(alphaShape, sf::BlendAlpha);
+        commandList.draw(addShape, sf::BlendAdd);
+        CHECK(commandList.getCommandCount() == 4);
+
+        sf::CommandList target({640, 480});
+        target.setBatchingEnabled(true);
+
+        SECTION("Disabled")
+        {
+            commandList.replay(target);
+            target.flush();
+            CHECK(target.getCommandCount() == 4);
+        }
+
+        SECTION("Enabled")
+        {
+            commandList.setSortingEnabled(true);
+            CHECK(commandList.isSortingEnabled());
+            commandList.replay(target);
+            target.flush();
+            CHECK(target.getCommandCount() == 2);
+        }
+
+        SECTION("Layers")
+        {
+            commandList.setSortingEnabled(true);
+            commandList.setLayer(-1);
+            CHECK(commandList.getLayer() == -1);
+            commandList.draw(alphaShape, sf::BlendAlpha);
+            commandList.replay(target);
+            target.flush();
+            CHECK(target.getCommandCount() == 3);
+        }
+
+        SECTION("Barriers")
+        {
+            commandList.setSortingEnabled(true);
+            commandList.clear();
+            commandList.draw(alphaShape, sf::BlendAlpha);
+            commandList.replay(target);
+            target.flush();
+            CHECK(target.getCommandCount() == 4);
+        }
+
+        SECTION("Depth")
+        {
+            commandList.setSortingEnabled(true);
+            commandList.draw(alphaShape, sf::DepthMode{sf::DepthComparison::Less, true, 0.5f});
+            commandList.replay(target);
+            target.flush();
+            CHECK(target.getCommandCount() == 3);
+        }
+    }
+
+    SECTION("Culling")
+    {
+        sf::CommandList commandList({640, 480});
+        CHECK(!commandList.isCullingEnabled());
+        CHECK(!commandList.cull({{-100, -100}, {10, 10}}));
+
+        commandList.setCullingEnabled(true);
+        CHECK(commandList.isCullingEnabled());
+        CHECK(!commandList.cull({{10, 10}, {10, 10}}));
+        CHECK(commandList.cull({{-100, -100}, {10, 10}}));
+        CHECK(!commandList.cull({{-100, -100}, {10, 10}}, sf::Transform().translate({100, 100})));
+
+        sf::RectangleShape shape({10, 10});
+        shape.setPosition({700, 0});
+        commandList.draw(shape);
+        CHECK(commandList.getCommandCount() == 0);
+        CHECK(commandList.getStatistics().culledDraws == 2);
+
+        // Culling follows the current view
+        commandList.setView(sf::View({700, 0}, {100, 100}));
+        commandList.draw(shape);
+        CHECK(commandList.getCommandCount() == 2);
+        CHECK(commandList.getStatistics().culledDraws == 2);
+    }
+
+    SECTION("saveToFile() and loadFromFile()")
+    {
+        const std::filesystem::path filename = std::filesystem::temp_directory_path() / "sfmlcommandlist.bin";
+
+        sf::RectangleShape shape({10, 10});
+        shape.setPosition({20, 20});
+
+        sf::CommandList commandList({640, 480});
+        commandList.clear(sf::Color::Red, 1);
+        commandList.clearDepth(0.5f);
+        commandList.setView(sf::View({1, 2}, {3, 4}));
+        commandList.setLayer(-2);
+        commandList.draw(shape, sf::BlendAdd);
+        commandList.draw(shape, sf::DepthMode{sf::DepthComparison::LessEqual, true, -0.25f});
+        REQUIRE(commandList.saveToFile(filename));
+
+        auto loaded = sf::CommandList::loadFromFile(filename);
+        REQUIRE(loaded);
+        CHECK(loaded->getSize() == sf::Vector2u(640, 480));
+        CHECK(loaded->getCommandCount() == 5);
+
+        sf::CommandList target({800, 600});
+        loaded->replay(target);
+        CHECK(target.getCommandCount() == 6);
+        CHECK(target.getView().getCenter() == sf::Vector2f(400, 300));
+
+        // Saving the loaded list gives back the same capture
+        const std::string contents = readFile(filename);
+        REQUIRE(loaded->saveToFile(filename));
+        CHECK(readFile(filename) == contents);
+
+        // Corrupted captures are rejected
+        std::ofstream(filename, std::ios::binary | std::ios::trunc) << contents.substr(0, contents.size() - 1);
+        CHECK(!sf::CommandList::loadFromFile(filename));
+        std::ofstream(filename, std::ios::binary | std::ios::trunc) << contents << 'x';
+        CHECK(!sf::CommandList::loadFromFile(filename));
+
+        std::filesystem::remove(filename);
+        CHECK(!sf::CommandList::loadFromFile(filename));
+    }
+}
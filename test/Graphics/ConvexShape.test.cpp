@@ -7,6 +7,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <SystemUtil.hpp>
+#include <array>
 #include <type_traits>
 
 TEST_CASE("[Graphics] sf::ConvexShape")
@@ -50,6 +51,20 @@ TEST_CASE("[Graphics] sf::ConvexShape")
         CHECK(convex.getPoint(0) == sf::Vector2f(3, 4));
     }
 
+    SECTION("Get points")
+    {
+        sf::ConvexShape convex(3);
+        convex.setPoint(0, {1, 2});
+        convex.setPoint(1, {3, 4});
+        convex.setPoint(2, {5, 6});
+
+        std::array<sf::Vector2f, 3> points;
+        convex.getPoints(points.data());
+        CHECK(points[0] == sf::Vector2f(1, 2));
+        CHECK(points[1] == sf::Vector2f(3, 4));
+        CHECK(points[2] == sf::Vector2f(5, 6));
+    }
+
     SECTION(
         "Construct clockwise ConvexShapes from CircleShapes to verify that they get approx. the same geometric center")
     {
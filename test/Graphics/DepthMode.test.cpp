@@ -0,0 +1,45 @@
+#include <SFML/Graphics/DepthMode.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::DepthMode")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::DepthMode>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::DepthMode>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::DepthMode>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::DepthMode>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::DepthMode depthMode;
+        CHECK(depthMode.depthComparison == sf::DepthComparison::Always);
+        CHECK(depthMode.depthWrite == false);
+        CHECK(depthMode.depth == 0.f);
+    }
+
+    SECTION("Operators")
+    {
+        SECTION("operator==")
+        {
+            CHECK(sf::DepthMode{} == sf::DepthMode{});
+            CHECK(sf::DepthMode{sf::DepthComparison::Less, true, 0.5f} ==
+                  sf::DepthMode{sf::DepthComparison::Less, true, 0.5f});
+
+            CHECK_FALSE(sf::DepthMode{} == sf::DepthMode{sf::DepthComparison::Less, true, 0.5f});
+            CHECK_FALSE(sf::DepthMode{sf::DepthComparison::Less, true, 0.5f} ==
+                        sf::DepthMode{sf::DepthComparison::Less, true, -0.5f});
+        }
+
+        SECTION("operator!=")
+        {
+            CHECK_FALSE(sf::DepthMode{} != sf::DepthMode{});
+            CHECK(sf::DepthMode{} != sf::DepthMode{sf::DepthComparison::Greater, false, 0.f});
+            CHECK(sf::DepthMode{} != sf::DepthMode{sf::DepthComparison::Always, true, 0.f});
+        }
+    }
+}
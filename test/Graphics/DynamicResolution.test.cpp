@@ -0,0 +1,72 @@
+#include <SFML/Graphics/DynamicResolution.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/GpuProfiler.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::DynamicResolution", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::DynamicResolution>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::DynamicResolution>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::DynamicResolution>);
+    }
+
+    sf::RenderWindow window(sf::VideoMode({256, 256}), "Window Title", sf::Style::Default, sf::State::Windowed);
+
+    SECTION("Construction")
+    {
+        const sf::DynamicResolution resolution(window);
+        CHECK(resolution.getScale() == 1.f);
+        CHECK(resolution.isAdaptiveScalingEnabled() == sf::GpuProfiler::isAvailable());
+        CHECK(resolution.getLastGpuTime() == sf::Time::Zero);
+    }
+
+    SECTION("Scale")
+    {
+        sf::DynamicResolution resolution(window);
+        resolution.setScale(0.25f);
+        CHECK(resolution.getScale() == 0.5f);
+        resolution.setScaleRange(0.2f, 2.f);
+        resolution.setScale(0.25f);
+        CHECK(resolution.getScale() == 0.25f);
+        resolution.setScale(2.f);
+        CHECK(resolution.getScale() == 1.f);
+        resolution.setScaleRange(0.5f, 0.75f);
+        CHECK(resolution.getScale() == 0.75f);
+    }
+
+    SECTION("Rendering")
+    {
+        sf::DynamicResolution resolution(window);
+        resolution.setAdaptiveScalingEnabled(false);
+        CHECK(!resolution.isAdaptiveScalingEnabled());
+
+        // Unscaled scenes are rendered directly to the window
+        CHECK(&resolution.beginFrame() == &window);
+        resolution.endFrame();
+
+        // Scaled scenes are upscaled to the whole window
+        resolution.setScale(0.5f);
+        sf::RenderTarget& scene = resolution.beginFrame();
+        CHECK(&scene != &window);
+        CHECK(scene.getSize() == sf::Vector2u(128, 128));
+        CHECK(scene.getView().getSize() == window.getView().getSize());
+        scene.clear(sf::Color::Green);
+        resolution.endFrame();
+
+        auto texture = sf::Texture::create(window.getSize()).value();
+        texture.update(window);
+        const sf::Image image = texture.copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Green);
+        CHECK(image.getPixel({255, 255}) == sf::Color::Green);
+    }
+}
@@ -10,6 +10,9 @@
 #include <WindowUtil.hpp>
 #include <fstream>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
@@ -38,7 +41,7 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
             CHECK(glyph.lsbDelta == 9);
             CHECK(glyph.rsbDelta == 16);
             CHECK(glyph.bounds == sf::FloatRect({0, -12}, {8, 12}));
-            CHECK(glyph.textureRect == sf::IntRect({2, 5}, {8, 12}));
+            CHECK(glyph.textureRect == sf::IntRect({4, 2}, {8, 12}));
             CHECK(font.hasGlyph(0x41));
             CHECK(font.hasGlyph(0xC0));
             CHECK(font.getKerning(0x41, 0x42, 12) == -1);
@@ -75,7 +78,7 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
             CHECK(glyph.lsbDelta == 9);
             CHECK(glyph.rsbDelta == 16);
             CHECK(glyph.bounds == sf::FloatRect({0, -12}, {8, 12}));
-            CHECK(glyph.textureRect == sf::IntRect({2, 5}, {8, 12}));
+            CHECK(glyph.textureRect == sf::IntRect({4, 2}, {8, 12}));
             CHECK(font.hasGlyph(0x41));
             CHECK(font.hasGlyph(0xC0));
             CHECK(font.getKerning(0x41, 0x42, 12) == -1);
@@ -112,7 +115,7 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
             CHECK(glyph.lsbDelta == 9);
             CHECK(glyph.rsbDelta == 16);
             CHECK(glyph.bounds == sf::FloatRect({0, -12}, {8, 12}));
-            CHECK(glyph.textureRect == sf::IntRect({2, 5}, {8, 12}));
+            CHECK(glyph.textureRect == sf::IntRect({4, 2}, {8, 12}));
             CHECK(font.hasGlyph(0x41));
             CHECK(font.hasGlyph(0xC0));
             CHECK(font.getKerning(0x41, 0x42, 12) == -1);
@@ -130,10 +133,79 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         }
     }
 
+    SECTION("preloadGlyphs()")
+    {
+        const auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        font.preloadGlyphs(U"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 ABC", 24);
+
+        // Preloaded glyphs are identical to the ones loaded on demand
+        const auto  otherFont      = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        const auto& preloaded      = font.getGlyph(0x45, 24, false);
+        const auto& loadedOnDemand = otherFont.getGlyph(0x45, 24, false);
+        CHECK(preloaded.advance == loadedOnDemand.advance);
+        CHECK(preloaded.bounds == loadedOnDemand.bounds);
+        CHECK(preloaded.textureRect.getSize() == loadedOnDemand.textureRect.getSize());
+        CHECK(font.getGlyph(0x20, 24, false).textureRect.getSize() == sf::Vector2i());
+
+        // The clones of the face opened by the first preloading are reused at another size
+        font.preloadGlyphs(U"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 32);
+        CHECK(font.getGlyph(0x45, 32, false).bounds == otherFont.getGlyph(0x45, 32, false).bounds);
+        CHECK(font.getGlyph(0x67, 32, true).bounds == otherFont.getGlyph(0x67, 32, true).bounds);
+    }
+
+    SECTION("Cached glyph indices and kerning")
+    {
+        const auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+
+        // Enough code points beyond Latin-1 to grow the table of glyph indices several times
+        std::vector<bool> hasGlyphs;
+        for (std::uint32_t codePoint = 0x100; codePoint < 0x600; ++codePoint)
+            hasGlyphs.push_back(font.hasGlyph(codePoint));
+        for (std::uint32_t codePoint = 0x100; codePoint < 0x600; ++codePoint)
+            CHECK(font.hasGlyph(codePoint) == hasGlyphs[codePoint - 0x100]);
+        CHECK(font.hasGlyph(0x41));
+        CHECK(!font.hasGlyph(0x4E2D));
+
+        // Cached kerning values don't leak between sizes and styles
+        CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+        CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+        CHECK(font.getKerning(0x43, 0x44, 24, true) == 0);
+        CHECK(font.getKerning(0x41, 0x42, 12, true) == font.getKerning(0x41, 0x42, 12, true));
+    }
+
     SECTION("Set/get smooth")
     {
         auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Set/get maximum texture size")
+    {
+        auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        CHECK(font.getMaximumTextureSize() == 0);
+        font.setMaximumTextureSize(128);
+        CHECK(font.getMaximumTextureSize() == 128);
+
+        // Request more glyphs than fit in a single texture, the oldest ones get evicted
+        for (std::uint32_t codePoint = 0x41; codePoint <= 0x5A; ++codePoint)
+            CHECK(font.getGlyph(codePoint, 48, false).textureRect.width > 0);
+        CHECK(font.getTexture(48).getSize() == sf::Vector2u(128, 128));
+    }
+
+    SECTION("Set/get distance field enabled")
+    {
+        auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        CHECK(!font.isDistanceFieldEnabled());
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+
+        // All the character sizes share the same texture, only the metrics are scaled
+        const sf::Glyph& small = font.getGlyph(0x45, 16, false);
+        const sf::Glyph& large = font.getGlyph(0x45, 32, false);
+        CHECK(&font.getTexture(16) == &font.getTexture(32));
+        CHECK(small.textureRect == large.textureRect);
+        CHECK(large.advance == Approx(small.advance * 2));
+        CHECK(large.bounds.width == Approx(small.bounds.width * 2));
+    }
 }
@@ -0,0 +1,90 @@
+#include <SFML/Graphics/FrameCapture.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::FrameCapture", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_default_constructible_v<sf::FrameCapture>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::FrameCapture>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::FrameCapture>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::FrameCapture>);
+    }
+
+    auto renderTexture = sf::RenderTexture::create({4, 4}).value();
+    renderTexture.clear(sf::Color::Red);
+    sf::RectangleShape shape({4, 2});
+    shape.setFillColor(sf::Color::Green);
+    renderTexture.draw(shape);
+
+    sf::FrameCapture capture;
+
+    SECTION("Construction")
+    {
+        CHECK(capture.getCapturedFrameCount() == 0);
+        CHECK(capture.getDroppedFrameCount() == 0);
+        CHECK(!capture.retrieveFrame());
+    }
+
+    SECTION("retrieveFrame()")
+    {
+        CHECK(capture.capture(renderTexture));
+        capture.finish();
+        CHECK(capture.getCapturedFrameCount() == 1);
+
+        const std::optional<sf::Image> frame = capture.retrieveFrame();
+        REQUIRE(frame);
+        REQUIRE(frame->getSize() == sf::Vector2u(4, 4));
+        CHECK(frame->getPixel({0, 0}) == sf::Color::Green);
+        CHECK(frame->getPixel({3, 1}) == sf::Color::Green);
+        CHECK(frame->getPixel({0, 2}) == sf::Color::Red);
+        CHECK(frame->getPixel({3, 3}) == sf::Color::Red);
+        CHECK(!capture.retrieveFrame());
+    }
+
+    SECTION("setEncoder()")
+    {
+        std::vector<std::uint64_t> indices;
+        capture.setEncoder([&indices](const sf::Image& frame, std::uint64_t index)
+                           {
+                               CHECK(frame.getSize() == sf::Vector2u(4, 4));
+                               indices.push_back(index);
+                           });
+
+        for (int i = 0; i < 5; ++i)
+            (void)capture.capture(renderTexture);
+        capture.finish();
+
+        CHECK(indices.size() == capture.getCapturedFrameCount());
+        CHECK(capture.getCapturedFrameCount() + capture.getDroppedFrameCount() == 5);
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            CHECK(indices[i] == i);
+        CHECK(!capture.retrieveFrame());
+    }
+
+    SECTION("createRawEncoder()")
+    {
+        std::ostringstream stream;
+        capture.setEncoder(sf::FrameCapture::createRawEncoder(stream));
+        CHECK(capture.capture(renderTexture));
+        capture.finish();
+
+        const std::string pixels = stream.str();
+        REQUIRE(pixels.size() == 4 * 4 * 4);
+        CHECK(static_cast<std::uint8_t>(pixels[0]) == 0);
+        CHECK(static_cast<std::uint8_t>(pixels[1]) == 255);
+        CHECK(static_cast<std::uint8_t>(pixels[4 * 4 * 3]) == 255);
+    }
+}
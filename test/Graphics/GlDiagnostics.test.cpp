@@ -0,0 +1,60 @@
+#include <SFML/Graphics/GlDiagnostics.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::GlDiagnostics")
+{
+    const sf::GlDiagnostics::Mode defaultMode = sf::GlDiagnostics::getMode();
+
+    SECTION("Default mode")
+    {
+#ifdef SFML_DEBUG
+        CHECK(defaultMode == sf::GlDiagnostics::Mode::CheckErrors);
+#else
+        CHECK(defaultMode == sf::GlDiagnostics::Mode::None);
+#endif
+    }
+
+    SECTION("setMode()")
+    {
+        sf::GlDiagnostics::setMode(sf::GlDiagnostics::Mode::None);
+        CHECK(sf::GlDiagnostics::getMode() == sf::GlDiagnostics::Mode::None);
+
+        sf::GlDiagnostics::setMode(sf::GlDiagnostics::Mode::CheckErrors);
+        CHECK(sf::GlDiagnostics::getMode() == sf::GlDiagnostics::Mode::CheckErrors);
+    }
+
+    sf::GlDiagnostics::setMode(defaultMode);
+}
+
+TEST_CASE("[Graphics] sf::GlDiagnostics (Debug output)", runDisplayTests())
+{
+    const sf::GlDiagnostics::Mode defaultMode = sf::GlDiagnostics::getMode();
+    const std::uint64_t           errorCount  = sf::GlDiagnostics::getErrorCount();
+
+    {
+        auto renderTexture = sf::RenderTexture::create({32, 32}).value();
+
+        sf::GlDiagnostics::setMode(sf::GlDiagnostics::Mode::DebugOutput);
+        CHECK(sf::GlDiagnostics::getMode() == sf::GlDiagnostics::Mode::DebugOutput);
+
+        // Valid drawing doesn't report any error
+        renderTexture.clear();
+        renderTexture.draw(sf::RectangleShape({16, 16}));
+        renderTexture.display();
+
+        sf::GlDiagnostics::setMode(defaultMode);
+        renderTexture.clear();
+        renderTexture.display();
+    }
+
+    CHECK(sf::GlDiagnostics::getErrorCount() == errorCount);
+}
@@ -0,0 +1,86 @@
+#include <SFML/Graphics/GlyphAtlas.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <memory>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::GlyphAtlas", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::GlyphAtlas>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::GlyphAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::GlyphAtlas>);
+    }
+
+    SECTION("create()")
+    {
+        const auto atlas = sf::GlyphAtlas::create(512).value();
+        CHECK(atlas.getMaximumSize() == 512);
+        CHECK(atlas.isSmooth());
+        CHECK(atlas.getTexture().getSize() == sf::Vector2u(128, 128));
+    }
+
+    SECTION("Set/get smooth")
+    {
+        auto atlas = sf::GlyphAtlas::create().value();
+        atlas.setSmooth(false);
+        CHECK(!atlas.isSmooth());
+        CHECK(!atlas.getTexture().isSmooth());
+    }
+
+    SECTION("Set/get maximum size")
+    {
+        auto atlas = sf::GlyphAtlas::create().value();
+        atlas.setMaximumSize(1024);
+        CHECK(atlas.getMaximumSize() == 1024);
+    }
+
+    SECTION("Shared by fonts")
+    {
+        const auto atlas  = std::make_shared<sf::GlyphAtlas>(sf::GlyphAtlas::create().value());
+        auto       first  = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        auto       second = first;
+        first.setGlyphAtlas(atlas);
+        second.setGlyphAtlas(atlas);
+        CHECK(first.getGlyphAtlas() == atlas);
+
+        // All the fonts and sizes use the texture of the atlas
+        const sf::Glyph glyph20 = first.getGlyph(U'A', 20, false);
+        const sf::Glyph glyph40 = second.getGlyph(U'A', 40, false);
+        CHECK(&first.getTexture(20) == &atlas->getTexture());
+        CHECK(&second.getTexture(40) == &atlas->getTexture());
+        CHECK(glyph20.textureRect != glyph40.textureRect);
+
+        // Clearing the atlas makes the fonts load their glyphs again
+        atlas->clear();
+        CHECK(first.getGlyph(U'A', 20, false).bounds == glyph20.bounds);
+
+        // Texts keep working with the glyphs loaded again
+        const sf::Text text(second, "Shared atlas", 40);
+        CHECK(text.getLocalBounds().getSize().x > 0);
+
+        first.setGlyphAtlas(nullptr);
+        CHECK(first.getGlyphAtlas() == nullptr);
+        CHECK(&first.getTexture(20) != &atlas->getTexture());
+    }
+
+    SECTION("Maximum size")
+    {
+        const auto atlas = std::make_shared<sf::GlyphAtlas>(sf::GlyphAtlas::create(128).value());
+        auto       font  = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        font.setGlyphAtlas(atlas);
+
+        // Glyphs keep being loaded once the atlas is full, it is cleared instead of growing
+        for (char32_t character = U'A'; character <= U'Z'; ++character)
+            CHECK(font.getGlyph(character, 60, false).textureRect.width > 0);
+        CHECK(atlas->getTexture().getSize() == sf::Vector2u(128, 128));
+    }
+}
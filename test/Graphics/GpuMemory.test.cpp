@@ -0,0 +1,95 @@
+#include <SFML/Graphics/GpuMemory.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <optional>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::GpuMemory", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_aggregate_v<sf::GpuMemory::Statistics>);
+    }
+
+    SECTION("Texture")
+    {
+        const sf::GpuMemory::Statistics before = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture);
+        const std::uint64_t             total  = sf::GpuMemory::getTotalUsage();
+
+        std::optional<sf::Texture> texture = sf::Texture::create({64, 32});
+        REQUIRE(texture);
+
+        sf::GpuMemory::Statistics statistics = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture);
+        CHECK(statistics.bytes == before.bytes + 64 * 32 * 4);
+        CHECK(statistics.resourceCount == before.resourceCount + 1);
+        CHECK(statistics.peakBytes >= statistics.bytes);
+        CHECK(sf::GpuMemory::getTotalUsage() == total + 64 * 32 * 4);
+
+        // The mipmap adds a third of the size
+        if (texture->generateMipmap())
+        {
+            statistics = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture);
+            CHECK(statistics.bytes == before.bytes + 4 * (64 * 32 + 32 * 16 + 16 * 8 + 8 * 4 + 4 * 2 + 2 * 1 + 1 * 1));
+        }
+
+        // Moving the texture doesn't change anything
+        const sf::Texture moved = std::move(*texture);
+        texture.reset();
+        CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture).resourceCount == before.resourceCount + 1);
+    }
+
+    SECTION("Texture released")
+    {
+        const sf::GpuMemory::Statistics before = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture);
+        {
+            const auto texture = sf::Texture::create({16, 16}).value();
+        }
+
+        const sf::GpuMemory::Statistics after = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture);
+        CHECK(after.bytes == before.bytes);
+        CHECK(after.resourceCount == before.resourceCount);
+        CHECK(after.peakBytes >= before.bytes + 16 * 16 * 4);
+    }
+
+    SECTION("RenderTexture")
+    {
+        const std::uint64_t textures = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture).bytes;
+        const std::uint64_t before   = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::RenderTexture).bytes;
+        {
+            const auto renderTexture = sf::RenderTexture::create({32, 32}).value();
+            CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::RenderTexture).bytes >= before + 32 * 32 * 4);
+            CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::Texture).bytes == textures);
+        }
+
+        CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::RenderTexture).bytes == before);
+    }
+
+    SECTION("VertexBuffer")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        const std::uint64_t before = sf::GpuMemory::getStatistics(sf::GpuMemory::Category::VertexBuffer).bytes;
+        {
+            sf::VertexBuffer vertexBuffer;
+            REQUIRE(vertexBuffer.create(10));
+            CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::VertexBuffer).bytes ==
+                  before + 10 * sizeof(sf::Vertex));
+
+            const sf::Vertex vertices[20]{};
+            REQUIRE(vertexBuffer.update(vertices, 20, 0));
+            CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::VertexBuffer).bytes ==
+                  before + 20 * sizeof(sf::Vertex));
+        }
+
+        CHECK(sf::GpuMemory::getStatistics(sf::GpuMemory::Category::VertexBuffer).bytes == before);
+    }
+}
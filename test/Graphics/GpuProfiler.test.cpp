@@ -0,0 +1,69 @@
+#include <SFML/Graphics/GpuProfiler.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::GpuProfiler", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::GpuProfiler>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::GpuProfiler>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::GpuProfiler>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::GpuProfiler::Scope>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::GpuProfiler::Scope>);
+    }
+
+    auto renderTexture = sf::RenderTexture::create({64, 64}).value();
+
+    SECTION("Construction")
+    {
+        const sf::GpuProfiler profiler(renderTexture);
+        CHECK(profiler.getResults().empty());
+    }
+
+    SECTION("Profiling")
+    {
+        sf::GpuProfiler                       profiler(renderTexture);
+        const sf::RectangleShape              shape({16, 16});
+        std::vector<sf::GpuProfiler::Timings> results;
+
+        // Results arrive once the GPU has executed the frame, without ever blocking
+        for (int frame = 0; frame < 1000 && results.empty(); ++frame)
+        {
+            {
+                const sf::GpuProfiler::Scope scene(profiler, "Scene");
+                renderTexture.clear();
+
+                const sf::GpuProfiler::Scope shapes(profiler, "Shapes");
+                renderTexture.draw(shape);
+                renderTexture.draw(shape);
+            }
+
+            renderTexture.display();
+            profiler.endFrame();
+            results = profiler.getResults();
+        }
+
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].name == "Scene");
+        CHECK(results[0].depth == 0);
+        CHECK(results[0].drawCalls == 2);
+        CHECK(results[0].vertices > 0);
+        CHECK(results[1].name == "Shapes");
+        CHECK(results[1].depth == 1);
+        CHECK(results[1].drawCalls == 2);
+        CHECK(results[1].vertices == results[0].vertices);
+        CHECK(results[1].cpuTime <= results[0].cpuTime);
+
+        if (sf::GpuProfiler::isAvailable())
+            CHECK(results[1].gpuTime <= results[0].gpuTime);
+    }
+}
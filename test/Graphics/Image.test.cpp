@@ -2,12 +2,42 @@
 
 // Other 1st party headers
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <array>
+#include <string>
 #include <type_traits>
+#include <vector>
+
+#include <cstring>
+
+namespace
+{
+sf::Image makePatternImage(const sf::Vector2u& size, unsigned int seed)
+{
+    // Cheap deterministic noise with some repeated colors
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size.x) * size.y * 4);
+    std::uint32_t             state = 0x9E3779B9u + seed;
+
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        pixels[i + 0] = static_cast<std::uint8_t>(state & 0x3);
+        pixels[i + 1] = static_cast<std::uint8_t>((state >> 8) & 0x3);
+        pixels[i + 2] = static_cast<std::uint8_t>((state >> 16) & 0xF);
+        pixels[i + 3] = static_cast<std::uint8_t>(state >> 24);
+    }
+
+    return sf::Image(size, pixels.data());
+}
+} // namespace
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -194,6 +224,47 @@ TEST_CASE("[Graphics] sf::Image")
             CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
             CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
         }
+
+        SECTION("Successful load from mapped file")
+        {
+            sf::MappedFileInputStream mappedStream;
+            REQUIRE(mappedStream.open("Graphics/sfml-logo-big.png"));
+            CHECK(mappedStream.seek(100) == 100);
+            const auto image = sf::Image::loadFromStream(mappedStream).value();
+            CHECK(image.getSize() == sf::Vector2u(1001, 304));
+            CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        }
+    }
+
+    SECTION("getSizeFromMemory()")
+    {
+        const std::uint8_t junk[] = {1, 2, 3, 4};
+        CHECK(!sf::Image::getSizeFromMemory(nullptr, 1));
+        CHECK(!sf::Image::getSizeFromMemory(junk, sizeof(junk)));
+
+        const auto memory = sf::Image({24, 12}, sf::Color::Green).saveToMemory("png").value();
+        CHECK(sf::Image::getSizeFromMemory(memory.data(), memory.size()) == sf::Vector2u(24, 12));
+    }
+
+    SECTION("decodeFromMemory()")
+    {
+        const auto memory = sf::Image({24, 12}, sf::Color::Green).saveToMemory("png").value();
+
+        SECTION("Buffer too small")
+        {
+            std::vector<std::uint8_t> pixels(24 * 12 * 4 - 1);
+            CHECK(!sf::Image::decodeFromMemory(memory.data(), memory.size(), pixels.data(), pixels.size()));
+        }
+
+        SECTION("Successful decode")
+        {
+            std::vector<std::uint8_t> pixels(24 * 12 * 4 + 4, 0xAB);
+            CHECK(sf::Image::decodeFromMemory(memory.data(), memory.size(), pixels.data(), pixels.size()) ==
+                  sf::Vector2u(24, 12));
+            CHECK(sf::Color(pixels[0], pixels[1], pixels[2], pixels[3]) == sf::Color::Green);
+            CHECK(sf::Color(pixels[1148], pixels[1149], pixels[1150], pixels[1151]) == sf::Color::Green);
+            CHECK(pixels[1152] == 0xAB);
+        }
     }
 
     SECTION("saveToFile()")
@@ -240,6 +311,12 @@ TEST_CASE("[Graphics] sf::Image")
                 CHECK(image.saveToFile(filename));
             }
 
+            SECTION("To .qoi")
+            {
+                filename /= "test.qoi";
+                CHECK(image.saveToFile(filename));
+            }
+
             // Cannot test JPEG encoding due to it triggering UB in stbiw__jpg_writeBits
 
             const auto loadedImage = sf::Image::loadFromFile(filename).value();
@@ -316,8 +393,110 @@ TEST_CASE("[Graphics] sf::Image")
                 CHECK(output[3] == 71);
             }
 
+            SECTION("To qoi")
+            {
+                maybeOutput = image.saveToMemory("qoi");
+                REQUIRE(maybeOutput.has_value());
+                const auto& output = *maybeOutput;
+                REQUIRE(output.size() == 28);
+                CHECK(output[0] == 'q');
+                CHECK(output[1] == 'o');
+                CHECK(output[2] == 'i');
+                CHECK(output[3] == 'f');
+                CHECK(output[7] == 16);
+                CHECK(output[11] == 16);
+                CHECK(output[12] == 4);
+                CHECK(output[27] == 1);
+            }
+
             // Cannot test JPEG encoding due to it triggering UB in stbiw__jpg_writeBits
         }
+
+        SECTION("With options")
+        {
+            const sf::Image pattern = makePatternImage({64, 64}, 2);
+
+            sf::ImageSaveOptions options;
+            options.pngCompressionLevel = 5;
+            options.pngFilter           = sf::ImageSaveOptions::PngFilter::None;
+
+            const auto output = pattern.saveToMemory("png", options);
+            REQUIRE(output.has_value());
+            CHECK(*output != pattern.saveToMemory("png").value());
+
+            const auto loadedImage = sf::Image::loadFromMemory(output->data(), output->size()).value();
+            CHECK(std::memcmp(loadedImage.getPixelsPtr(), pattern.getPixelsPtr(), 64 * 64 * 4) == 0);
+        }
+    }
+
+    SECTION("saveToFileAsync()")
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "test-async.qoi";
+
+        auto future = sf::Image({32, 16}, sf::Color::Cyan).saveToFileAsync(filename);
+        CHECK(future.get());
+
+        const auto loadedImage = sf::Image::loadFromFile(filename).value();
+        CHECK(loadedImage.getSize() == sf::Vector2u(32, 16));
+        CHECK(loadedImage.getPixel({31, 15}) == sf::Color::Cyan);
+
+        CHECK(std::filesystem::remove(filename));
+    }
+
+    SECTION("saveToMemoryAsync()")
+    {
+        auto image  = makePatternImage({40, 40}, 3);
+        auto future = image.saveToMemoryAsync("png");
+
+        // The pixels were copied, changing the image doesn't affect the pending encoding
+        const auto expected = image.saveToMemory("png");
+        image.flipVertically();
+
+        CHECK(future.get() == expected);
+        CHECK(!sf::Image({16, 16}).saveToMemoryAsync("gif").get());
+    }
+
+    SECTION("Qoi files")
+    {
+        const sf::Image pattern = makePatternImage({37, 23}, 4);
+        const auto      memory  = pattern.saveToMemory("qoi").value();
+
+        SECTION("loadFromMemory()")
+        {
+            const auto image = sf::Image::loadFromMemory(memory.data(), memory.size()).value();
+            CHECK(image.getSize() == sf::Vector2u(37, 23));
+            CHECK(std::memcmp(image.getPixelsPtr(), pattern.getPixelsPtr(), 37 * 23 * 4) == 0);
+        }
+
+        SECTION("loadFromStream()")
+        {
+            sf::MemoryInputStream stream;
+            stream.open(memory.data(), memory.size());
+            const auto image = sf::Image::loadFromStream(stream).value();
+            CHECK(image.getSize() == sf::Vector2u(37, 23));
+            CHECK(std::memcmp(image.getPixelsPtr(), pattern.getPixelsPtr(), 37 * 23 * 4) == 0);
+        }
+
+        SECTION("getSizeFromMemory()")
+        {
+            CHECK(sf::Image::getSizeFromMemory(memory.data(), memory.size()) == sf::Vector2u(37, 23));
+        }
+
+        SECTION("decodeFromMemory()")
+        {
+            std::vector<std::uint8_t> pixels(37 * 23 * 4);
+            CHECK(sf::Image::decodeFromMemory(memory.data(), memory.size(), pixels.data(), pixels.size()) ==
+                  sf::Vector2u(37, 23));
+            CHECK(std::memcmp(pixels.data(), pattern.getPixelsPtr(), pixels.size()) == 0);
+        }
+
+        SECTION("Truncated file")
+        {
+            std::vector<std::uint8_t> pixels(37 * 23 * 4, 0xAB);
+            CHECK(!sf::Image::loadFromMemory(memory.data(), memory.size() / 2));
+            CHECK(!sf::Image::decodeFromMemory(memory.data(), memory.size() / 2, pixels.data(), pixels.size()));
+            CHECK(pixels[0] == 0xAB);
+        }
     }
 
     SECTION("Set/get pixel")
@@ -456,4 +635,222 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u(0, 9)) == sf::Color::Green);
     }
+
+    SECTION("Premultiply alpha")
+    {
+        sf::Image image(sf::Vector2u(5, 3), sf::Color(200, 100, 255, 128));
+        image.setPixel({4, 2}, sf::Color(255, 255, 255, 0));
+        image.premultiplyAlpha();
+        CHECK(image.getPixel({0, 0}) == sf::Color(100, 50, 128, 128));
+        CHECK(image.getPixel({4, 2}) == sf::Color::Transparent);
+    }
+
+    SECTION("Resize")
+    {
+        using Filter = sf::Image::ResamplingFilter;
+
+        SECTION("Uniform color")
+        {
+            for (const auto filter : {Filter::Box, Filter::Bilinear, Filter::Lanczos3})
+            {
+                for (const sf::Vector2u size : {sf::Vector2u(3, 7), sf::Vector2u(25, 40)})
+                {
+                    sf::Image image(sf::Vector2u(10, 10), sf::Color(10, 20, 30, 40));
+                    image.resize(size, filter);
+                    CHECK(image.getSize() == size);
+                    CHECK(image.getPixel({0, 0}) == sf::Color(10, 20, 30, 40));
+                    CHECK(image.getPixel(size - sf::Vector2u(1, 1)) == sf::Color(10, 20, 30, 40));
+                }
+            }
+        }
+
+        SECTION("Box filter averages")
+        {
+            sf::Image image(sf::Vector2u(4, 2), sf::Color::Black);
+            image.setPixel({0, 0}, sf::Color::White);
+            image.setPixel({0, 1}, sf::Color::White);
+            image.setPixel({1, 1}, sf::Color::White);
+            image.resize({2, 1}, Filter::Box);
+            CHECK(image.getPixel({0, 0}) == sf::Color(191, 191, 191));
+            CHECK(image.getPixel({1, 0}) == sf::Color::Black);
+        }
+
+        SECTION("Transparent pixels don't bleed")
+        {
+            sf::Image image(sf::Vector2u(4, 1), sf::Color::Transparent);
+            image.setPixel({0, 0}, sf::Color::Red);
+            image.resize({1, 1}, Filter::Box);
+            CHECK(image.getPixel({0, 0}) == sf::Color(255, 0, 0, 64));
+        }
+
+        SECTION("Empty image")
+        {
+            sf::Image image(sf::Vector2u(0, 0));
+            image.resize({2, 2});
+            CHECK(image.getSize() == sf::Vector2u(2, 2));
+            CHECK(image.getPixel({1, 1}) == sf::Color::Transparent);
+
+            image.resize({0, 5});
+            CHECK(image.getSize() == sf::Vector2u());
+            CHECK(image.getPixelsPtr() == nullptr);
+        }
+
+        SECTION("Execution policies")
+        {
+            const sf::Image pattern    = makePatternImage({517, 389}, 0);
+            sf::Image       sequential = pattern;
+            sf::Image       parallel   = pattern;
+            sequential.resize({203, 611}, Filter::Lanczos3, sf::ExecutionPolicy::Sequential);
+            parallel.resize({203, 611}, Filter::Lanczos3, sf::ExecutionPolicy::Parallel);
+            CHECK(std::memcmp(sequential.getPixelsPtr(), parallel.getPixelsPtr(), std::size_t{203} * 611 * 4) == 0);
+        }
+    }
+
+    SECTION("Generate mip chain")
+    {
+        const sf::Image              image(sf::Vector2u(10, 3), sf::Color::Cyan);
+        const std::vector<sf::Image> levels = image.generateMipChain();
+        REQUIRE(levels.size() == 3);
+        CHECK(levels[0].getSize() == sf::Vector2u(5, 1));
+        CHECK(levels[1].getSize() == sf::Vector2u(2, 1));
+        CHECK(levels[2].getSize() == sf::Vector2u(1, 1));
+        CHECK(levels[2].getPixel({0, 0}) == sf::Color::Cyan);
+
+        CHECK(sf::Image(sf::Vector2u(1, 1)).generateMipChain().empty());
+        CHECK(sf::Image(sf::Vector2u(0, 0)).generateMipChain().empty());
+    }
+
+    SECTION("Execution policies")
+    {
+        // Large enough to be split among threads, with odd sizes to exercise the leftover pixels and rows
+        const sf::Vector2u size(1029, 1031);
+        const sf::Image    source    = makePatternImage(size, 0);
+        const sf::Image    pattern   = makePatternImage(size, 1);
+        sf::Image          expected  = pattern;
+        const std::size_t  byteCount = std::size_t{size.x} * size.y * 4;
+
+        const auto checkPolicies = [&](const auto& operation)
+        {
+            sf::Image sequential = pattern;
+            sf::Image parallel   = pattern;
+            operation(sequential, sf::ExecutionPolicy::Sequential);
+            operation(parallel, sf::ExecutionPolicy::Parallel);
+            CHECK(std::memcmp(sequential.getPixelsPtr(), expected.getPixelsPtr(), byteCount) == 0);
+            CHECK(std::memcmp(parallel.getPixelsPtr(), expected.getPixelsPtr(), byteCount) == 0);
+        };
+
+        SECTION("createMaskFromColor()")
+        {
+            const sf::Color key     = pattern.getPixel({3, 5});
+            std::size_t     matches = 0;
+
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                for (unsigned int x = 0; x < size.x; ++x)
+                {
+                    if (pattern.getPixel({x, y}) == key)
+                    {
+                        expected.setPixel({x, y}, sf::Color(key.r, key.g, key.b, 7));
+                        ++matches;
+                    }
+                }
+            }
+
+            CHECK(matches > 1);
+            checkPolicies([&](sf::Image& image, sf::ExecutionPolicy policy)
+                          { image.createMaskFromColor(key, 7, policy); });
+        }
+
+        SECTION("copy()")
+        {
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                for (unsigned int x = 0; x < size.x; ++x)
+                {
+                    // Per-component integer over operator
+                    const sf::Color src      = source.getPixel({x, y});
+                    const sf::Color dst      = pattern.getPixel({x, y});
+                    const auto      outAlpha = static_cast<std::uint8_t>(src.a + dst.a - src.a * dst.a / 255);
+                    const auto      blend    = [&](std::uint8_t s, std::uint8_t d)
+                    {
+                        return outAlpha ? static_cast<std::uint8_t>((s * src.a + d * (outAlpha - src.a)) / outAlpha)
+                                        : s;
+                    };
+
+                    const sf::Color color(blend(src.r, dst.r), blend(src.g, dst.g), blend(src.b, dst.b), outAlpha);
+                    expected.setPixel({x, y}, color);
+                }
+            }
+
+            checkPolicies([&](sf::Image& image, sf::ExecutionPolicy policy)
+                          { CHECK(image.copy(source, {0, 0}, {}, true, policy)); });
+        }
+
+        SECTION("flipHorizontally()")
+        {
+            for (unsigned int y = 0; y < size.y; ++y)
+                for (unsigned int x = 0; x < size.x; ++x)
+                    expected.setPixel({x, y}, pattern.getPixel({size.x - 1 - x, y}));
+
+            checkPolicies([](sf::Image& image, sf::ExecutionPolicy policy) { image.flipHorizontally(policy); });
+        }
+
+        SECTION("premultiplyAlpha()")
+        {
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                for (unsigned int x = 0; x < size.x; ++x)
+                {
+                    const sf::Color color   = pattern.getPixel({x, y});
+                    const auto      premult = [&](std::uint8_t c)
+                    { return static_cast<std::uint8_t>((c * color.a + 127) / 255); };
+                    expected.setPixel({x, y}, sf::Color(premult(color.r), premult(color.g), premult(color.b), color.a));
+                }
+            }
+
+            checkPolicies([](sf::Image& image, sf::ExecutionPolicy policy) { image.premultiplyAlpha(policy); });
+        }
+
+        SECTION("flipVertically()")
+        {
+            for (unsigned int y = 0; y < size.y; ++y)
+                for (unsigned int x = 0; x < size.x; ++x)
+                    expected.setPixel({x, y}, pattern.getPixel({x, size.y - 1 - y}));
+
+            checkPolicies([](sf::Image& image, sf::ExecutionPolicy policy) { image.flipVertically(policy); });
+        }
+    }
+}
+
+TEST_CASE("[Graphics] sf::Image benchmark", "[.benchmark]")
+{
+    // 4096x4096 pixels, run with the [benchmark] tag to compare the execution policies
+    const sf::Vector2u size(4096, 4096);
+    const sf::Image    source = makePatternImage(size, 0);
+    sf::Image          image  = makePatternImage(size, 1);
+
+    for (const auto policy : {sf::ExecutionPolicy::Sequential, sf::ExecutionPolicy::Parallel})
+    {
+        const std::string name = policy == sf::ExecutionPolicy::Sequential ? " (sequential)" : " (parallel)";
+
+        BENCHMARK("createMaskFromColor()" + name)
+        {
+            image.createMaskFromColor(sf::Color::Red, 0, policy);
+        };
+
+        BENCHMARK("copy() with alpha" + name)
+        {
+            return image.copy(source, {0, 0}, {}, true, policy);
+        };
+
+        BENCHMARK("flipHorizontally()" + name)
+        {
+            image.flipHorizontally(policy);
+        };
+
+        BENCHMARK("flipVertically()" + name)
+        {
+            image.flipVertically(policy);
+        };
+    }
 }
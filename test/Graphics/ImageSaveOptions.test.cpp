@@ -0,0 +1,25 @@
+#include <SFML/Graphics/ImageSaveOptions.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ImageSaveOptions")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ImageSaveOptions>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ImageSaveOptions>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ImageSaveOptions>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ImageSaveOptions>);
+        STATIC_CHECK(std::is_aggregate_v<sf::ImageSaveOptions>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ImageSaveOptions options;
+        CHECK(options.pngCompressionLevel == 8);
+        CHECK(options.pngFilter == sf::ImageSaveOptions::PngFilter::Adaptive);
+        CHECK(options.jpgQuality == 90);
+    }
+}
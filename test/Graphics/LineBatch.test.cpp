@@ -0,0 +1,101 @@
+#include <SFML/Graphics/LineBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::LineBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::LineBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::LineBatch>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::LineBatch>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::LineBatch>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::LineBatch batch;
+        CHECK(batch.getSegmentCount() == 0);
+        CHECK(batch.getThickness() == 1.f);
+        CHECK(batch.isSmooth());
+        CHECK(batch.isGpuExpansionEnabled());
+    }
+
+    SECTION("Set/get properties")
+    {
+        sf::LineBatch batch;
+        batch.setThickness(3.f);
+        batch.setSmooth(false);
+        batch.setGpuExpansionEnabled(false);
+        CHECK(batch.getThickness() == 3.f);
+        CHECK(!batch.isSmooth());
+        CHECK(!batch.isGpuExpansionEnabled());
+    }
+
+    SECTION("Add lines")
+    {
+        sf::LineBatch                     batch;
+        const std::array<sf::Vector2f, 4> points = {{{0, 0}, {10, 0}, {10, 10}, {0, 10}}};
+
+        batch.addLine({0, 0}, {5, 5});
+        CHECK(batch.getSegmentCount() == 1);
+
+        batch.addPolyline(points.data(), points.size());
+        CHECK(batch.getSegmentCount() == 4);
+
+        batch.addPolyline(points.data(), points.size(), sf::Color::Red, true);
+        CHECK(batch.getSegmentCount() == 8);
+
+        batch.addPolyline(points.data(), 1);
+        CHECK(batch.getSegmentCount() == 8);
+
+        batch.clear();
+        CHECK(batch.getSegmentCount() == 0);
+    }
+
+    SECTION("Drawing")
+    {
+        sf::LineBatch batch;
+        batch.setThickness(4.f);
+        batch.setSmooth(false);
+        batch.addLine({8, 16}, {56, 16}, sf::Color::Red);
+
+        const std::array<sf::Vector2f, 3> points = {{{8, 32}, {32, 48}, {56, 32}}};
+        batch.addPolyline(points.data(), points.size(), sf::Color::Green);
+
+        const auto render = [&batch](bool gpuExpansion)
+        {
+            batch.setGpuExpansionEnabled(gpuExpansion);
+
+            auto target = sf::RenderTexture::create({64, 64}).value();
+            target.clear();
+            target.draw(batch);
+            target.display();
+            return target.getTexture().copyToImage();
+        };
+
+        const sf::Image image = render(false);
+        CHECK(image.getPixel({32, 16}) == sf::Color::Red);
+        CHECK(image.getPixel({32, 14}) == sf::Color::Red);
+        CHECK(image.getPixel({32, 19}) == sf::Color::Black);
+        CHECK(image.getPixel({32, 47}) == sf::Color::Green);
+        CHECK(image.getPixel({32, 40}) == sf::Color::Black);
+
+        // Both expansions cover the same pixels
+        if (sf::LineBatch::isGpuExpansionAvailable())
+        {
+            const sf::Image gpuImage = render(true);
+            CHECK(gpuImage.getPixel({32, 16}) == sf::Color::Red);
+            CHECK(gpuImage.getPixel({32, 19}) == sf::Color::Black);
+            CHECK(gpuImage.getPixel({32, 47}) == sf::Color::Green);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#include <SFML/Graphics/ParticleSystem.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ParticleSystem", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::ParticleSystem>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ParticleSystem>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ParticleSystem>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ParticleSystem>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ParticleSystem>);
+        STATIC_CHECK(std::has_virtual_destructor_v<sf::ParticleSystem>);
+    }
+
+    SECTION("Emitter")
+    {
+        const sf::ParticleSystem::Emitter emitter;
+        CHECK(emitter.position == sf::Vector2f());
+        CHECK(emitter.spread == sf::degrees(360));
+        CHECK(emitter.maxSpeed == 100);
+        CHECK(emitter.minLifetime == sf::seconds(1));
+        CHECK(emitter.maxLifetime == sf::seconds(1));
+        CHECK(emitter.startColor == sf::Color::White);
+        CHECK(emitter.endColor == sf::Color(255, 255, 255, 0));
+    }
+
+    if (!sf::ParticleSystem::isAvailable())
+        return;
+
+    SECTION("create()")
+    {
+        CHECK(!sf::ParticleSystem::create(0).has_value());
+
+        const auto particleSystem = sf::ParticleSystem::create(1000).value();
+        CHECK(particleSystem.getParticleCount() == 1000);
+        CHECK(particleSystem.isEmitting());
+        CHECK(particleSystem.getEmitterCount() == 1);
+        CHECK(particleSystem.getAttractorCount() == 0);
+        CHECK(particleSystem.getGravity() == sf::Vector2f());
+        CHECK(particleSystem.getDrag() == 0);
+        CHECK(particleSystem.getTexture() == nullptr);
+        CHECK(particleSystem.getTextureRect() == sf::IntRect());
+    }
+
+    auto particleSystem = sf::ParticleSystem::create(100).value();
+
+    SECTION("Emitters")
+    {
+        sf::ParticleSystem::Emitter emitter;
+        emitter.position = {10, 20};
+        particleSystem.setEmitterCount(2);
+        particleSystem.setEmitter(1, emitter);
+        CHECK(particleSystem.getEmitterCount() == 2);
+        CHECK(particleSystem.getEmitter(0).position == sf::Vector2f());
+        CHECK(particleSystem.getEmitter(1).position == sf::Vector2f(10, 20));
+    }
+
+    SECTION("Attractors")
+    {
+        particleSystem.setAttractorCount(1);
+        particleSystem.setAttractor(0, {{5, 5}, 50});
+        CHECK(particleSystem.getAttractorCount() == 1);
+        CHECK(particleSystem.getAttractor(0).position == sf::Vector2f(5, 5));
+        CHECK(particleSystem.getAttractor(0).strength == 50);
+    }
+
+    SECTION("Forces")
+    {
+        particleSystem.setGravity({0, 9.8f});
+        particleSystem.setDrag(0.5f);
+        CHECK(particleSystem.getGravity() == sf::Vector2f(0, 9.8f));
+        CHECK(particleSystem.getDrag() == 0.5f);
+    }
+
+    SECTION("Set/get texture")
+    {
+        const auto texture = sf::Texture::create({64, 64}).value();
+        particleSystem.setTexture(&texture);
+        CHECK(particleSystem.getTexture() == &texture);
+        CHECK(particleSystem.getTextureRect() == sf::IntRect({0, 0}, {64, 64}));
+
+        particleSystem.setTextureRect({{0, 0}, {16, 16}});
+        CHECK(particleSystem.getTextureRect() == sf::IntRect({0, 0}, {16, 16}));
+
+        particleSystem.setTexture(nullptr);
+        CHECK(particleSystem.getTexture() == nullptr);
+    }
+
+    SECTION("Update and draw")
+    {
+        particleSystem.setEmitting(false);
+        CHECK(!particleSystem.isEmitting());
+
+        auto renderTexture = sf::RenderTexture::create({32, 32}).value();
+        for (int i = 0; i < 10; ++i)
+        {
+            particleSystem.update(sf::milliseconds(16));
+            renderTexture.draw(particleSystem);
+        }
+        particleSystem.reset();
+        renderTexture.display();
+        CHECK(particleSystem.getParticleCount() == 100);
+    }
+}
@@ -0,0 +1,145 @@
+#include <SFML/Graphics/PolygonShape.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+// Sum of the areas of the triangles
+float computeArea(const sf::PolygonShape& polygon)
+{
+    std::vector<sf::Vector2f> points;
+    for (std::size_t i = 0; i < polygon.getPointCount(); ++i)
+        points.push_back(polygon.getPoint(i));
+    for (std::size_t i = 0; i < polygon.getHoleCount(); ++i)
+        points.insert(points.end(), polygon.getHole(i).begin(), polygon.getHole(i).end());
+
+    const std::vector<std::uint32_t>& indices = polygon.getTriangleIndices();
+    float                             area    = 0.f;
+    for (std::size_t i = 0; i < indices.size(); i += 3)
+    {
+        const sf::Vector2f a = points[indices[i]];
+        area += std::abs((points[indices[i + 1]] - a).cross(points[indices[i + 2]] - a)) / 2.f;
+    }
+
+    return area;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::PolygonShape", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::PolygonShape>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::PolygonShape>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::PolygonShape>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::PolygonShape>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::PolygonShape polygon;
+        CHECK(polygon.getPointCount() == 0);
+        CHECK(polygon.getHoleCount() == 0);
+        CHECK(polygon.getTexture() == nullptr);
+        CHECK(polygon.getTextureRect() == sf::IntRect());
+        CHECK(polygon.getFillColor() == sf::Color::White);
+        CHECK(polygon.getTriangleIndices().empty());
+        CHECK(polygon.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Point count constructor")
+    {
+        const sf::PolygonShape polygon(15);
+        CHECK(polygon.getPointCount() == 15);
+        for (std::size_t i = 0; i < polygon.getPointCount(); ++i)
+            CHECK(polygon.getPoint(i) == sf::Vector2f());
+    }
+
+    SECTION("Set point")
+    {
+        sf::PolygonShape polygon(3);
+        polygon.setPoint(0, {10, 10});
+        polygon.setPoint(1, {30, 10});
+        polygon.setPoint(2, {20, 40});
+        CHECK(polygon.getPoint(1) == sf::Vector2f(30, 10));
+        CHECK(polygon.getTriangleIndices().size() == 3);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({10, 10}, {20, 30}));
+
+        polygon.setPosition({5, 5});
+        CHECK(polygon.getGlobalBounds() == sf::FloatRect({15, 15}, {20, 30}));
+    }
+
+    SECTION("Concave polygon")
+    {
+        // Arrow pointing to the right, in both orientations
+        const sf::Vector2f arrow[] = {{0, 0}, {100, 50}, {0, 100}, {30, 50}};
+        for (const bool reversed : {false, true})
+        {
+            sf::PolygonShape polygon(4);
+            for (std::size_t i = 0; i < 4; ++i)
+                polygon.setPoint(reversed ? 3 - i : i, arrow[i]);
+
+            CHECK(polygon.getTriangleIndices().size() == 6);
+            CHECK(computeArea(polygon) == Approx(3500.f));
+        }
+    }
+
+    SECTION("Holes")
+    {
+        sf::PolygonShape polygon(4);
+        polygon.setPoint(0, {0, 0});
+        polygon.setPoint(1, {100, 0});
+        polygon.setPoint(2, {100, 100});
+        polygon.setPoint(3, {0, 100});
+
+        CHECK(polygon.addHole({{20, 20}, {40, 20}, {40, 80}, {20, 80}}) == 0);
+        CHECK(polygon.getHoleCount() == 1);
+        CHECK(polygon.getHole(0).size() == 4);
+
+        // Each hole adds its points and the two edges connecting it to the outline
+        CHECK(polygon.getTriangleIndices().size() == 8 * 3);
+        CHECK(computeArea(polygon) == Approx(8800.f));
+
+        CHECK(polygon.addHole({{60, 20}, {80, 60}, {60, 80}}) == 1);
+        CHECK(polygon.getTriangleIndices().size() == 13 * 3);
+        CHECK(computeArea(polygon) == Approx(8200.f));
+
+        polygon.clearHoles();
+        CHECK(polygon.getHoleCount() == 0);
+        CHECK(polygon.getTriangleIndices().size() == 2 * 3);
+        CHECK(computeArea(polygon) == Approx(10000.f));
+    }
+
+    SECTION("Drawing")
+    {
+        sf::PolygonShape polygon(4);
+        polygon.setPoint(0, {0, 0});
+        polygon.setPoint(1, {64, 0});
+        polygon.setPoint(2, {64, 64});
+        polygon.setPoint(3, {0, 64});
+        polygon.addHole({{16, 16}, {48, 16}, {48, 48}, {16, 48}});
+        polygon.setFillColor(sf::Color::Red);
+
+        auto target = sf::RenderTexture::create({64, 64}).value();
+        target.clear();
+        target.draw(polygon);
+        target.display();
+
+        const sf::Image image = target.getTexture().copyToImage();
+        CHECK(image.getPixel({8, 8}) == sf::Color::Red);
+        CHECK(image.getPixel({56, 32}) == sf::Color::Red);
+        CHECK(image.getPixel({32, 32}) == sf::Color::Black);
+    }
+}
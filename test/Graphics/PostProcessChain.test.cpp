@@ -0,0 +1,128 @@
+#include <SFML/Graphics/PostProcessChain.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::PostProcessChain", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::PostProcessChain>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::PostProcessChain>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::PostProcessChain chain;
+        CHECK(!chain.getBlur().enabled);
+        CHECK(!chain.getBloom().enabled);
+        CHECK(!chain.getTonemapping().enabled);
+        CHECK(!chain.getColorGrading().enabled);
+        CHECK(!chain.getVignette().enabled);
+        CHECK(chain.getPassCount() == 0);
+    }
+
+    SECTION("Set/get stages")
+    {
+        sf::PostProcessChain chain;
+        chain.setBlur({true, 4.f, 1});
+        chain.setBloom({true, 0.5f, 2.f});
+        chain.setTonemapping({true, 1.5f});
+        chain.setColorGrading({true, 0.1f});
+        chain.setVignette({true, 0.25f});
+        CHECK(chain.getBlur().radius == 4.f);
+        CHECK(chain.getBlur().downsample == 1);
+        CHECK(chain.getBloom().threshold == 0.5f);
+        CHECK(chain.getBloom().intensity == 2.f);
+        CHECK(chain.getTonemapping().exposure == 1.5f);
+        CHECK(chain.getColorGrading().brightness == 0.1f);
+        CHECK(chain.getColorGrading().contrast == 1.f);
+        CHECK(chain.getVignette().intensity == 0.25f);
+    }
+
+    sf::PostProcessChain chain;
+    auto                 target = sf::RenderTexture::create({64, 64}).value();
+
+    const auto render = [&]
+    {
+        sf::RenderTexture* scene = chain.beginFrame(target.getSize());
+        REQUIRE(scene);
+        scene->clear(sf::Color(128, 128, 128));
+
+        sf::RectangleShape square({16, 16});
+        square.setPosition({24, 24});
+        scene->draw(square);
+
+        target.clear();
+        chain.endFrame(target);
+        target.display();
+        return target.getTexture().copyToImage();
+    };
+
+    SECTION("No stages")
+    {
+        const sf::Image image = render();
+        CHECK(chain.getPassCount() == 1);
+        CHECK(image.getPixel({0, 0}) == sf::Color(128, 128, 128));
+        CHECK(image.getPixel({32, 32}) == sf::Color::White);
+    }
+
+    SECTION("Inactive stages are skipped")
+    {
+        chain.setBloom({true, 0.8f, 0.f});
+        chain.setColorGrading({true});
+        chain.setVignette({true, 0.f});
+        const sf::Image image = render();
+        CHECK(chain.getPassCount() == 1);
+        CHECK(image.getPixel({0, 0}) == sf::Color(128, 128, 128));
+    }
+
+    if (!sf::Shader::isAvailable())
+        return;
+
+    SECTION("Per-pixel stages are fused")
+    {
+        chain.setColorGrading({true, 0.f, 1.f, 0.f});
+        chain.setVignette({true, 1.f, 0.5f, 0.1f});
+        const sf::Image image = render();
+        CHECK(chain.getPassCount() == 1);
+
+        // Grayscale in the center, black in the corners
+        const sf::Color center = image.getPixel({32, 32});
+        CHECK(center.r == center.g);
+        CHECK(center.g == center.b);
+        CHECK(center.r > 200);
+        CHECK(image.getPixel({0, 0}) == sf::Color::Black);
+    }
+
+    SECTION("Blur and bloom")
+    {
+        chain.setBlur({true, 4.f, 2});
+        const sf::Image blurred = render();
+        CHECK(chain.getPassCount() == 3);
+        CHECK(blurred.getPixel({25, 32}).r < 255);
+        CHECK(blurred.getPixel({20, 32}).r > 128);
+
+        chain.setBlur({});
+        chain.setBloom({true, 0.8f, 1.f, 8.f, 2});
+        const sf::Image bloomed = render();
+        CHECK(chain.getPassCount() == 3);
+        CHECK(bloomed.getPixel({32, 32}) == sf::Color::White);
+        CHECK(bloomed.getPixel({20, 32}).r > 128);
+        CHECK(bloomed.getPixel({0, 0}) == sf::Color(128, 128, 128));
+
+        chain.setBlur({true});
+        chain.setTonemapping({true});
+        chain.setVignette({true});
+        (void)render();
+        CHECK(chain.getPassCount() == 5);
+    }
+}
@@ -1,13 +1,22 @@
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
 
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
 TEST_CASE("[Graphics] Render Tests", runDisplayTests())
 {
     SECTION("Stencil Tests")
@@ -239,4 +248,348 @@ TEST_CASE("[Graphics] Render Tests", runDisplayTests())
             }
         }
     }
+
+    SECTION("Batching")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape1({50, 100});
+        shape1.setFillColor(sf::Color::Green);
+        sf::RectangleShape shape2({50, 100});
+        shape2.setFillColor(sf::Color::Blue);
+        shape2.setPosition({50, 0});
+
+        renderTexture.draw(shape1);
+        renderTexture.draw(shape2);
+
+        SECTION("display()")
+        {
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+        }
+
+        SECTION("State change")
+        {
+            sf::RectangleShape shape3({100, 100});
+            shape3.setFillColor(sf::Color(255, 255, 255, 0));
+            renderTexture.draw(shape3, sf::BlendNone);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({25, 50}) == sf::Color(255, 255, 255, 0));
+        }
+
+        SECTION("Full batches")
+        {
+            // Many more vertices than a single batch holds, each full batch must fit in the stream buffer
+            sf::RectangleShape shape3({100, 50});
+            shape3.setFillColor(sf::Color::Yellow);
+            shape3.setPosition({0, 50});
+
+            const std::size_t drawCalls = renderTexture.getStatistics().drawCalls;
+            for (int i = 0; i < 20000; ++i)
+                renderTexture.draw(shape3);
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+            CHECK(image.getPixel({25, 75}) == sf::Color::Yellow);
+            CHECK(image.getPixel({75, 75}) == sf::Color::Yellow);
+            CHECK(renderTexture.getStatistics().drawCalls > drawCalls + 1);
+        }
+    }
+
+    SECTION("Large vertex array")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        // More than 1 MiB of vertices, which doesn't fit in a region of a persistently mapped stream buffer
+        sf::VertexArray vertices(sf::PrimitiveType::Triangles, 60000);
+        const std::array<sf::Vector2f, 6> corners = {sf::Vector2f{0, 0},
+                                                     sf::Vector2f{0, 100},
+                                                     sf::Vector2f{100, 0},
+                                                     sf::Vector2f{100, 0},
+                                                     sf::Vector2f{0, 100},
+                                                     sf::Vector2f{100, 100}};
+        for (std::size_t i = 0; i < vertices.getVertexCount(); ++i)
+            vertices[i] = {corners[i % corners.size()], sf::Color::Green};
+
+        renderTexture.draw(vertices);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+        CHECK(image.getPixel({90, 90}) == sf::Color::Green);
+    }
+
+    SECTION("Shader parameters")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        constexpr auto vertexSource = R"(
+            attribute vec4 sf_parameters;
+            varying vec4 parameters;
+
+            void main()
+            {
+                gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+                parameters  = sf_parameters;
+            }
+        )";
+
+        constexpr auto fragmentSource = R"(
+            varying vec4 parameters;
+
+            void main()
+            {
+                gl_FragColor = parameters;
+            }
+        )";
+
+        const auto shader = sf::Shader::loadFromMemory(vertexSource, fragmentSource).value();
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        SECTION("Without batching")
+        {
+            renderTexture.setBatchingEnabled(false);
+        }
+
+        SECTION("With batching")
+        {
+            renderTexture.setBatchingEnabled(true);
+        }
+
+        sf::RectangleShape shape({50, 100});
+        sf::RenderStates   states(&shader);
+        states.shaderParameters = sf::Glsl::Vec4(sf::Color::Green);
+        renderTexture.draw(shape, states);
+
+        shape.setPosition({50, 0});
+        states.shaderParameters = sf::Glsl::Vec4(sf::Color::Blue);
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+        CHECK(renderTexture.getStatistics().drawCalls == (renderTexture.isBatchingEnabled() ? 1 : 2));
+    }
+
+    SECTION("Clipping")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}, sf::ContextSettings{0 /* depthBits */, 8 /* stencilBits */})
+                                 .value();
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red, 0);
+
+        sf::RectangleShape shape({100, 100});
+        shape.setFillColor(sf::Color::Green);
+
+        SECTION("Scissor")
+        {
+            renderTexture.pushClipRect(sf::FloatRect({0, 0}, {50, 100}));
+            renderTexture.pushClipRect(sf::FloatRect({25, 0}, {75, 100}));
+            renderTexture.draw(shape);
+            renderTexture.popClipRect();
+            renderTexture.popClipRect();
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({10, 50}) == sf::Color::Red);
+            CHECK(image.getPixel({40, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({60, 50}) == sf::Color::Red);
+        }
+
+        SECTION("Stencil")
+        {
+            // A square rotated by 45 degrees around the center of the target
+            sf::Transform transform;
+            transform.rotate(sf::degrees(45), {50, 50});
+            renderTexture.pushClipRect(sf::FloatRect({25, 25}, {50, 50}), transform);
+            renderTexture.draw(shape);
+            renderTexture.popClipRect();
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({50, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({50, 20}) == sf::Color::Green);
+            CHECK(image.getPixel({27, 27}) == sf::Color::Red);
+
+            // The stencil buffer is restored once the clip is popped
+            shape.setFillColor(sf::Color::Blue);
+            renderTexture.draw(shape,
+                               sf::StencilMode{sf::StencilComparison::Equal, sf::StencilUpdateOperation::Keep, 0, 0xFF, false});
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::Blue);
+        }
+
+        SECTION("Redundant clip")
+        {
+            // A clip covering the whole target doesn't interrupt the batch
+            renderTexture.draw(shape);
+            renderTexture.pushClipRect(sf::FloatRect({-10, -10}, {200, 200}));
+            renderTexture.draw(shape);
+            renderTexture.popClipRect();
+            renderTexture.display();
+            CHECK(renderTexture.getStatistics().drawCalls == 1);
+        }
+    }
+
+    SECTION("Instancing")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        const std::array quad = {sf::Vertex{{0, 0}}, sf::Vertex{{0, 50}}, sf::Vertex{{50, 0}}, sf::Vertex{{50, 50}}};
+        const std::array transforms = {sf::Transform::Identity, sf::Transform().translate({50, 50})};
+        const std::array colors     = {sf::Color::Green, sf::Color::Blue};
+
+        SECTION("Without batching")
+        {
+            renderTexture.setBatchingEnabled(false);
+        }
+
+        SECTION("With batching")
+        {
+            renderTexture.setBatchingEnabled(true);
+        }
+
+        renderTexture.draw(quad.data(),
+                           quad.size(),
+                           sf::PrimitiveType::TriangleStrip,
+                           transforms.data(),
+                           colors.data(),
+                           transforms.size());
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Blue);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Red);
+    }
+
+    SECTION("Instanced vertex buffer")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        const std::array quad = {sf::Vertex{{0, 0}}, sf::Vertex{{0, 25}}, sf::Vertex{{25, 0}}, sf::Vertex{{25, 25}}};
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+        REQUIRE(vertexBuffer.create(quad.size()));
+        REQUIRE(vertexBuffer.update(quad.data()));
+
+        // The second instance is scaled to cover the bottom-right quarter
+        const std::array transforms = {sf::Transform::Identity, sf::Transform().translate({50, 50}).scale({2, 2})};
+        const std::array colors     = {sf::Color::Green, sf::Color::Blue};
+
+        const std::size_t drawCalls = renderTexture.getStatistics().drawCalls;
+        renderTexture.draw(vertexBuffer, transforms.data(), colors.data(), transforms.size());
+        renderTexture.display();
+
+        // All the instances are drawn at once when the hardware supports it
+        if (sf::RenderTarget::isInstancingAvailable())
+            CHECK(renderTexture.getStatistics().drawCalls == drawCalls + 1);
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({12, 12}) == sf::Color::Green);
+        CHECK(image.getPixel({37, 37}) == sf::Color::Red);
+        CHECK(image.getPixel({60, 60}) == sf::Color::Blue);
+        CHECK(image.getPixel({90, 90}) == sf::Color::Blue);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Red);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        const std::array quad = {sf::Vertex{{0, 0}, sf::Color::Green},
+                                 sf::Vertex{{0, 50}, sf::Color::Green},
+                                 sf::Vertex{{50, 0}, sf::Color::Green},
+                                 sf::Vertex{{50, 50}, sf::Color::Green}};
+        const std::array<std::uint16_t, 6> indices = {0, 1, 2, 2, 1, 3};
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+        REQUIRE(vertexBuffer.create(quad.size()));
+        REQUIRE(vertexBuffer.update(quad.data()));
+
+        sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::UInt16, sf::IndexBuffer::Usage::Static);
+        REQUIRE(indexBuffer.create(indices.size()));
+        REQUIRE(indexBuffer.update(indices.data(), indices.size()));
+
+        SECTION("All indices")
+        {
+            renderTexture.draw(vertexBuffer, indexBuffer);
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+            CHECK(image.getPixel({40, 40}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 75}) == sf::Color::Red);
+        }
+
+        SECTION("Index range")
+        {
+            renderTexture.draw(vertexBuffer, indexBuffer, 3, 3);
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({10, 10}) == sf::Color::Red);
+            CHECK(image.getPixel({40, 40}) == sf::Color::Green);
+        }
+    }
+
+    SECTION("Multi-draw")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        // Three strips of a single quad, in the top-left, top-right and bottom-right corners
+        std::array<sf::Vertex, 12> vertices{};
+        const std::array<sf::Vector2f, 3> corners = {sf::Vector2f{0, 0}, sf::Vector2f{50, 0}, sf::Vector2f{50, 50}};
+        for (std::size_t i = 0; i < corners.size(); ++i)
+        {
+            vertices[i * 4 + 0] = {corners[i], sf::Color::Green};
+            vertices[i * 4 + 1] = {corners[i] + sf::Vector2f{0, 50}, sf::Color::Green};
+            vertices[i * 4 + 2] = {corners[i] + sf::Vector2f{50, 0}, sf::Color::Green};
+            vertices[i * 4 + 3] = {corners[i] + sf::Vector2f{50, 50}, sf::Color::Green};
+        }
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+        REQUIRE(vertexBuffer.create(vertices.size()));
+        REQUIRE(vertexBuffer.update(vertices.data()));
+
+        // The last range is out of the buffer and skipped
+        const std::array<sf::RenderTarget::VertexRange, 3> ranges = {sf::RenderTarget::VertexRange{0, 4},
+                                                                     sf::RenderTarget::VertexRange{8, 10},
+                                                                     sf::RenderTarget::VertexRange{20, 4}};
+        const std::size_t vertexCount = renderTexture.getStatistics().vertices;
+        renderTexture.drawMulti(vertexBuffer, ranges.data(), ranges.size());
+        renderTexture.display();
+        CHECK(renderTexture.getStatistics().vertices == vertexCount + 8);
+
+        // The strips are not connected to each other
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Red);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Green);
+        CHECK(image.getPixel({25, 75}) == sf::Color::Red);
+    }
 }
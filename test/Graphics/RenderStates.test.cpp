@@ -22,10 +22,15 @@ TEST_CASE("[Graphics] sf::RenderStates")
             const sf::RenderStates renderStates;
             CHECK(renderStates.blendMode == sf::BlendMode());
             CHECK(renderStates.stencilMode == sf::StencilMode{});
+            CHECK(renderStates.depthMode == sf::DepthMode{});
             CHECK(renderStates.transform == sf::Transform());
             CHECK(renderStates.coordinateType == sf::CoordinateType::Pixels);
             CHECK(renderStates.texture == nullptr);
             CHECK(renderStates.shader == nullptr);
+            CHECK(renderStates.shaderParameters.x == 0);
+            CHECK(renderStates.shaderParameters.y == 0);
+            CHECK(renderStates.shaderParameters.z == 0);
+            CHECK(renderStates.shaderParameters.w == 0);
         }
 
         SECTION("BlendMode constructor")
@@ -56,6 +61,18 @@ TEST_CASE("[Graphics] sf::RenderStates")
             CHECK(renderStates.shader == nullptr);
         }
 
+        SECTION("DepthMode constructor")
+        {
+            const sf::DepthMode    depthMode{sf::DepthComparison::Less, true, 0.5f};
+            const sf::RenderStates renderStates(depthMode);
+            CHECK(renderStates.blendMode == sf::BlendMode());
+            CHECK(renderStates.stencilMode == sf::StencilMode{});
+            CHECK(renderStates.depthMode == depthMode);
+            CHECK(renderStates.transform == sf::Transform());
+            CHECK(renderStates.texture == nullptr);
+            CHECK(renderStates.shader == nullptr);
+        }
+
         SECTION("Transform constructor")
         {
             const sf::Transform    transform(10, 9, 8, 7, 6, 5, 4, 3, 2);
@@ -116,6 +133,7 @@ TEST_CASE("[Graphics] sf::RenderStates")
     {
         CHECK(sf::RenderStates::Default.blendMode == sf::BlendMode());
         CHECK(sf::RenderStates::Default.stencilMode == sf::StencilMode{});
+        CHECK(sf::RenderStates::Default.depthMode == sf::DepthMode{});
         CHECK(sf::RenderStates::Default.transform == sf::Transform());
         CHECK(sf::RenderStates::Default.coordinateType == sf::CoordinateType::Pixels);
         CHECK(sf::RenderStates::Default.texture == nullptr);
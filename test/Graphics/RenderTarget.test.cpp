@@ -53,6 +53,36 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getView().getSize() == sf::Vector2f(3, 4));
     }
 
+    SECTION("Set/get batching enabled")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.flush();
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("Set/get culling enabled")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isCullingEnabled());
+        renderTarget.setCullingEnabled(true);
+        CHECK(renderTarget.isCullingEnabled());
+    }
+
+    SECTION("getStatistics()")
+    {
+        const RenderTarget renderTarget;
+        CHECK(renderTarget.getStatistics().drawCalls == 0);
+        CHECK(renderTarget.getStatistics().vertices == 0);
+        CHECK(renderTarget.getStatistics().stateChanges == 0);
+        CHECK(renderTarget.getStatistics().redundantStateChanges == 0);
+        CHECK(renderTarget.getStatistics().culledDraws == 0);
+        CHECK(renderTarget.getStatistics().targetSwitches == 0);
+    }
+
     SECTION("setActive()")
     {
         RenderTarget renderTarget;
@@ -1,9 +1,22 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <WindowUtil.hpp>
+#include <algorithm>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 
 TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
 {
@@ -56,6 +69,45 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         CHECK(renderTexture.isRepeated());
     }
 
+    SECTION("Set/get premultiplied alpha")
+    {
+        auto renderTexture = sf::RenderTexture::create({64, 64}).value();
+        CHECK(!renderTexture.isPremultipliedAlpha());
+        renderTexture.setPremultipliedAlpha(true);
+        CHECK(renderTexture.isPremultipliedAlpha());
+        CHECK(renderTexture.getTexture().isPremultipliedAlpha());
+    }
+
+    SECTION("Layer compositing")
+    {
+        sf::RectangleShape shape({64, 64});
+        shape.setFillColor(sf::Color(255, 0, 0, 128));
+
+        // Drawing the shape into a transparent layer composited afterwards...
+        auto layer = sf::RenderTexture::create({64, 64}).value();
+        layer.clear(sf::Color::Transparent);
+        layer.draw(shape);
+        layer.display();
+        layer.setPremultipliedAlpha(true);
+
+        auto layered = sf::RenderTexture::create({64, 64}).value();
+        layered.clear(sf::Color::Blue);
+        layered.draw(sf::Sprite(layer.getTexture()));
+        layered.display();
+
+        // ... is the same as drawing it directly
+        auto direct = sf::RenderTexture::create({64, 64}).value();
+        direct.clear(sf::Color::Blue);
+        direct.draw(shape);
+        direct.display();
+
+        const sf::Color expected = direct.getTexture().copyToImage().getPixel({32, 32});
+        const sf::Color actual   = layered.getTexture().copyToImage().getPixel({32, 32});
+        CHECK(std::abs(int{expected.r} - int{actual.r}) <= 1);
+        CHECK(std::abs(int{expected.b} - int{actual.b}) <= 1);
+        CHECK(actual.a == 255);
+    }
+
     SECTION("generateMipmap()")
     {
         auto renderTexture = sf::RenderTexture::create({64, 64}).value();
@@ -70,6 +122,75 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         CHECK(renderTexture.setActive(true));
     }
 
+    SECTION("display()")
+    {
+        const auto antialiasingLevel = std::min(4u, sf::RenderTexture::getMaximumAntialiasingLevel());
+        const auto settings          = sf::ContextSettings{0 /* depthBits */, 0 /* stencilBits */, antialiasingLevel};
+        auto       renderTexture     = sf::RenderTexture::create({64, 64}, settings).value();
+
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({48, 32}) == sf::Color::Red);
+
+        // Only the scissored area is updated
+        sf::View view = renderTexture.getDefaultView();
+        view.setScissor(sf::FloatRect({0, 0}, {0.5f, 1}));
+        renderTexture.setView(view);
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.display();
+
+        auto image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({16, 32}) == sf::Color::Green);
+        CHECK(image.getPixel({48, 32}) == sf::Color::Red);
+
+        // Displaying again without drawing leaves the texture unchanged
+        renderTexture.display();
+        image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({16, 32}) == sf::Color::Green);
+        CHECK(image.getPixel({48, 32}) == sf::Color::Red);
+    }
+
+    SECTION("Concurrent rendering")
+    {
+        // Each thread renders to its own render texture, with a context of its own
+        std::vector<sf::Color>   colors(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < colors.size(); ++i)
+        {
+            threads.emplace_back(
+                [&colors, i]
+                {
+                    auto               renderTexture = sf::RenderTexture::create({64, 64}).value();
+                    sf::RectangleShape shape({32, 32});
+                    shape.setFillColor(sf::Color(static_cast<std::uint8_t>(i), 0, 0));
+
+                    for (int frame = 0; frame < 10; ++frame)
+                    {
+                        renderTexture.clear();
+                        renderTexture.draw(shape);
+                        renderTexture.display();
+                    }
+
+                    colors[i] = renderTexture.getTexture().copyToImage().getPixel({16, 16});
+                });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        for (std::size_t i = 0; i < colors.size(); ++i)
+            CHECK(colors[i] == sf::Color(static_cast<std::uint8_t>(i), 0, 0));
+    }
+
+    SECTION("discardDepthStencil()")
+    {
+        auto renderTexture = sf::RenderTexture::create({64, 64}, sf::ContextSettings{24 /* depthBits */, 8 /* stencilBits */}).value();
+        renderTexture.clear(sf::Color::Blue, 0);
+        renderTexture.discardDepthStencil();
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({32, 32}) == sf::Color::Blue);
+    }
+
     SECTION("getTexture()")
     {
         const auto renderTexture = sf::RenderTexture::create({64, 64}).value();
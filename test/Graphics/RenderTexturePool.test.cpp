@@ -0,0 +1,114 @@
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::RenderTexturePool", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::RenderTexturePool>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::RenderTexturePool pool;
+        CHECK(pool.getTextureCount() == 0);
+        CHECK(pool.getAcquiredCount() == 0);
+        CHECK(pool.getMaxUnusedFrames() == 2);
+    }
+
+    sf::RenderTexturePool pool;
+
+    SECTION("acquire()")
+    {
+        CHECK(!pool.acquire({1'000'000, 1'000'000}));
+        CHECK(pool.getTextureCount() == 0);
+
+        sf::RenderTexture* first = pool.acquire({64, 32});
+        REQUIRE(first);
+        CHECK(first->getSize() == sf::Vector2u(64, 32));
+
+        // Acquired textures are never handed out twice
+        sf::RenderTexture* second = pool.acquire({64, 32});
+        REQUIRE(second);
+        CHECK(second != first);
+
+        // The settings are part of the key
+        sf::RenderTexture* withDepth = pool.acquire({64, 32}, sf::ContextSettings{24 /* depthBits */});
+        REQUIRE(withDepth);
+        CHECK(withDepth != first);
+        CHECK(withDepth != second);
+
+        CHECK(pool.getTextureCount() == 3);
+        CHECK(pool.getAcquiredCount() == 3);
+    }
+
+    SECTION("release()")
+    {
+        sf::RenderTexture* first = pool.acquire({64, 32});
+        REQUIRE(first);
+        first->setSmooth(true);
+        first->setRepeated(true);
+        first->setView(sf::View(sf::FloatRect({0, 0}, {10, 10})));
+        pool.release(*first);
+        CHECK(pool.getAcquiredCount() == 0);
+
+        // The released texture is reused, with its default state restored
+        sf::RenderTexture* second = pool.acquire({64, 32});
+        CHECK(second == first);
+        CHECK(!second->isSmooth());
+        CHECK(!second->isRepeated());
+        CHECK(second->getView().getSize() == sf::Vector2f(64, 32));
+        CHECK(pool.getTextureCount() == 1);
+
+        // Different sizes don't match
+        CHECK(pool.acquire({32, 64}) != first);
+        CHECK(pool.getTextureCount() == 2);
+    }
+
+    SECTION("endFrame()")
+    {
+        sf::RenderTexture* first = pool.acquire({16, 16});
+        REQUIRE(first);
+        pool.endFrame();
+        CHECK(pool.getAcquiredCount() == 0);
+
+        // Textures are recycled across frames
+        CHECK(pool.acquire({16, 16}) == first);
+        pool.endFrame();
+
+        // Then destroyed once unused for more than the configured number of frames
+        pool.endFrame();
+        pool.endFrame();
+        CHECK(pool.getTextureCount() == 1);
+        pool.endFrame();
+        CHECK(pool.getTextureCount() == 0);
+
+        pool.setMaxUnusedFrames(0);
+        CHECK(pool.getMaxUnusedFrames() == 0);
+        CHECK(pool.acquire({16, 16}));
+        pool.endFrame();
+        CHECK(pool.getTextureCount() == 1);
+        pool.endFrame();
+        CHECK(pool.getTextureCount() == 0);
+    }
+
+    SECTION("clear()")
+    {
+        sf::RenderTexture* kept = pool.acquire({16, 16});
+        REQUIRE(kept);
+        sf::RenderTexture* freed = pool.acquire({16, 16});
+        REQUIRE(freed);
+        pool.release(*freed);
+
+        pool.clear();
+        CHECK(pool.getTextureCount() == 1);
+        CHECK(pool.getAcquiredCount() == 1);
+    }
+}
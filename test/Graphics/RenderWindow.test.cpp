@@ -2,7 +2,9 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 #include <SFML/Window/VideoMode.hpp>
 
@@ -14,6 +16,8 @@
 #include <WindowUtil.hpp>
 #include <type_traits>
 
+#include <cstddef>
+
 TEST_CASE("[Graphics] sf::RenderWindow", runDisplayTests())
 {
     SECTION("Type traits")
@@ -89,4 +93,85 @@ TEST_CASE("[Graphics] sf::RenderWindow", runDisplayTests())
         texture.update(window);
         CHECK(texture.copyToImage().getPixel(sf::Vector2u(196, 196)) == sf::Color::Blue);
     }
+
+    SECTION("Display through sf::Window")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24),
+                                "Window Title",
+                                sf::Style::Default,
+                                sf::State::Windowed,
+                                sf::ContextSettings{});
+        window.setBatchingEnabled(true);
+
+        sf::RectangleShape rectangle({128, 256});
+        window.clear(sf::Color::Red);
+        window.draw(rectangle);
+
+        // The pending batch is submitted even though sf::Window::display doesn't know about it
+        const std::size_t drawCalls = window.getStatistics().drawCalls;
+        static_cast<sf::Window&>(window).display();
+        CHECK(window.getStatistics().drawCalls == drawCalls + 1);
+    }
+
+    SECTION("Damage")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24),
+                                "Window Title",
+                                sf::Style::Default,
+                                sf::State::Windowed,
+                                sf::ContextSettings{});
+        CHECK(!window.isDamageTrackingEnabled());
+        window.setDamageTrackingEnabled(true);
+        CHECK(window.isDamageTrackingEnabled());
+
+        window.clear(sf::Color::Red);
+        window.display();
+
+        // Regions outside of the window are ignored
+        window.addDamage({-10, -10}, {5, 5});
+        window.display({sf::IntRect({0, 0}, {64, 64}), sf::IntRect({300, 300}, {10, 10})});
+
+        // The buffer age is only known on some platforms
+        CHECK(window.getBufferAge() <= 8);
+    }
+
+    SECTION("Core profile")
+    {
+        sf::ContextSettings settings;
+        settings.majorVersion   = 3;
+        settings.minorVersion   = 3;
+        settings.attributeFlags = sf::ContextSettings::Core;
+
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24),
+                                "Window Title",
+                                sf::Style::Default,
+                                sf::State::Windowed,
+                                settings);
+        REQUIRE(window.getSize() == sf::Vector2u(256, 256));
+
+        // Not every platform can create core profile contexts
+        if (window.getSettings().attributeFlags & sf::ContextSettings::Core)
+        {
+            sf::RectangleShape rectangle({128, 256});
+            rectangle.setFillColor(sf::Color::Green);
+
+            // More than 1 MiB of vertices covering the bottom right quarter, which must not be dropped
+            sf::VertexArray vertices(sf::PrimitiveType::Triangles, 60000);
+            const sf::Vector2f corners[] = {{128, 128}, {128, 256}, {256, 128}, {256, 128}, {128, 256}, {256, 256}};
+            for (std::size_t i = 0; i < vertices.getVertexCount(); ++i)
+                vertices[i] = {corners[i % 6], sf::Color::Blue};
+
+            window.clear(sf::Color::Red);
+            window.draw(rectangle);
+            window.draw(vertices);
+
+            auto texture = sf::Texture::create(window.getSize()).value();
+            texture.update(window);
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(64, 128)) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u(192, 64)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(192, 192)) == sf::Color::Blue);
+        }
+    }
 }
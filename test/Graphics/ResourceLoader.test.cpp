@@ -0,0 +1,86 @@
+#include <SFML/Graphics/ResourceLoader.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <atomic>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ResourceLoader", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ResourceLoader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ResourceLoader>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::ResourceLoader>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::ResourceLoader>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::ResourceLoader loader;
+            CHECK(loader.getThreadCount() >= 1);
+        }
+
+        SECTION("Thread count constructor")
+        {
+            CHECK(sf::ResourceLoader(3).getThreadCount() == 3);
+            CHECK(sf::ResourceLoader(0).getThreadCount() == 1);
+        }
+    }
+
+    sf::ResourceLoader loader(2);
+
+    SECTION("loadImage()")
+    {
+        CHECK(!loader.loadImage("does/not/exist.png").get());
+
+        const auto image = loader.loadImage("Graphics/sfml-logo-big.png").get();
+        REQUIRE(image);
+        CHECK(image->getSize() == sf::Vector2u(1001, 304));
+    }
+
+    SECTION("loadTexture()")
+    {
+        CHECK(!loader.loadTexture("does/not/exist.png").get());
+
+        const auto texture = loader.loadTexture("Graphics/sfml-logo-big.png", true).get();
+        REQUIRE(texture);
+        CHECK(texture->getSize() == sf::Vector2u(1001, 304));
+        CHECK(texture->isSrgb());
+        CHECK(texture->copyToImage().getSize() == sf::Vector2u(1001, 304));
+    }
+
+    SECTION("loadFont()")
+    {
+        CHECK(!loader.loadFont("does/not/exist.ttf").get());
+
+        const auto font = loader.loadFont("Graphics/tuffy.ttf").get();
+        REQUIRE(font);
+        CHECK(font->getInfo().family == "Tuffy");
+    }
+
+    SECTION("loadShader()")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        CHECK(!loader.loadShader("does/not/exist.vert", "does/not/exist.frag").get());
+        CHECK(loader.loadShader("Graphics/shader.vert", "Graphics/shader.frag").get());
+    }
+
+    SECTION("enqueue()")
+    {
+        std::atomic<int> counter{};
+        auto             first  = loader.enqueue([&counter] { ++counter; });
+        auto             second = loader.enqueue([&counter] { ++counter; });
+        first.get();
+        second.get();
+        CHECK(counter == 2);
+
+        CHECK_THROWS(loader.enqueue([] { throw 1; }).get());
+    }
+}
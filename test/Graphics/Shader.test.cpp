@@ -1,10 +1,16 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/UniformBuffer.hpp>
+
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <filesystem>
 #include <type_traits>
 
 namespace
@@ -102,6 +108,23 @@ void main()
 }
 )";
 
+constexpr auto uniformBlockSource = R"(
+#version 140
+
+layout(std140) uniform Frame
+{
+    vec4 tint;
+    float time;
+};
+
+out vec4 color;
+
+void main()
+{
+    color = tint * time;
+}
+)";
+
 #ifdef SFML_RUN_DISPLAY_TESTS
 #ifdef SFML_OPENGL_ES
 constexpr bool skipShaderDummyTest = false;
@@ -153,6 +176,24 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
         CHECK_FALSE(sf::Shader::loadFromMemory(vertexSource, fragmentSource).has_value());
         CHECK_FALSE(sf::Shader::loadFromMemory(vertexSource, geometrySource, fragmentSource).has_value());
     }
+
+    SECTION("loadFromMemoryAsync()")
+    {
+        CHECK_FALSE(sf::Shader::isParallelCompilationAvailable());
+        CHECK_FALSE(sf::Shader::loadFromMemoryAsync(vertexSource, sf::Shader::Type::Vertex).has_value());
+        CHECK_FALSE(sf::Shader::loadFromMemoryAsync(vertexSource, fragmentSource).has_value());
+        CHECK_FALSE(sf::Shader::loadFromMemoryAsync(vertexSource, geometrySource, fragmentSource).has_value());
+    }
+
+    SECTION("setBinaryCacheDirectory()")
+    {
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+        sf::Shader::setBinaryCacheDirectory("shader-cache");
+        CHECK(sf::Shader::getBinaryCacheDirectory() == "shader-cache");
+        CHECK_FALSE(sf::Shader::loadFromMemory(vertexSource, fragmentSource).has_value());
+        sf::Shader::setBinaryCacheDirectory({});
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+    }
 }
 
 TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
@@ -283,4 +324,112 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
                 CHECK(static_cast<bool>(shader->getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("getUniformHandle()")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        auto shader = sf::Shader::loadFromMemory(vertexSource, sf::Shader::Type::Vertex);
+        REQUIRE(shader.has_value());
+
+        const sf::Shader::UniformHandle invalidHandle;
+        CHECK(!invalidHandle.isValid());
+        CHECK(!shader->getUniformHandle("missing").isValid());
+
+        const sf::Shader::UniformHandle position = shader->getUniformHandle("storm_position");
+        const sf::Shader::UniformHandle radius   = shader->getUniformHandle("storm_total_radius");
+        CHECK(position.isValid());
+        CHECK(radius.isValid());
+
+        shader->setUniform(position, sf::Glsl::Vec2(1.f, 2.f));
+        shader->setUniform(radius, 3.f);
+        shader->setUniform(invalidHandle, 4.f);
+        sf::Shader::bind(&*shader);
+        sf::Shader::bind(nullptr);
+    }
+
+    SECTION("loadFromMemoryAsync()")
+    {
+        const auto waitUntilReady = [](const sf::Shader& shader)
+        {
+            while (!shader.isReady())
+                sf::sleep(sf::milliseconds(1));
+        };
+
+        auto shaders = std::array{sf::Shader::loadFromMemoryAsync(vertexSource, sf::Shader::Type::Vertex),
+                                  sf::Shader::loadFromMemoryAsync(fragmentSource, sf::Shader::Type::Fragment),
+                                  sf::Shader::loadFromMemoryAsync(vertexSource, fragmentSource)};
+        for (const auto& shader : shaders)
+        {
+            REQUIRE(shader.has_value() == sf::Shader::isAvailable());
+            if (shader)
+            {
+                waitUntilReady(*shader);
+                CHECK(shader->getNativeHandle() != 0);
+            }
+        }
+
+        // Errors are reported once the shader is ready
+        const auto invalid = sf::Shader::loadFromMemoryAsync("invalid", sf::Shader::Type::Fragment);
+        CHECK(invalid.has_value() == sf::Shader::isAvailable());
+        if (invalid)
+        {
+            waitUntilReady(*invalid);
+            CHECK(invalid->getNativeHandle() == 0);
+        }
+
+        // Using the shader waits for the end of the compilation
+        auto shader = sf::Shader::loadFromMemoryAsync(vertexSource, fragmentSource);
+        if (shader)
+        {
+            shader->setUniform("storm_inner_radius", 1.f);
+            CHECK(shader->isReady());
+            CHECK(shader->getNativeHandle() != 0);
+        }
+    }
+
+    SECTION("setBinaryCacheDirectory()")
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "sfml-shader-cache-test";
+        std::filesystem::remove_all(directory);
+        sf::Shader::setBinaryCacheDirectory(directory);
+        CHECK(sf::Shader::getBinaryCacheDirectory() == directory);
+
+        // The second shader is created from the binary saved by the first one, if the driver supports it
+        const auto first  = sf::Shader::loadFromMemory(vertexSource, fragmentSource);
+        const auto second = sf::Shader::loadFromMemory(vertexSource, fragmentSource);
+        CHECK(first.has_value() == sf::Shader::isAvailable());
+        CHECK(second.has_value() == sf::Shader::isAvailable());
+        if (second)
+            CHECK(second->getNativeHandle() != 0);
+
+        // A corrupted binary is ignored
+        if (std::filesystem::exists(directory))
+            for (const auto& entry : std::filesystem::directory_iterator(directory))
+                std::filesystem::resize_file(entry.path(), 16);
+        CHECK(sf::Shader::loadFromMemory(vertexSource, fragmentSource).has_value() == sf::Shader::isAvailable());
+
+        sf::Shader::setBinaryCacheDirectory({});
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION("setUniformBlock()")
+    {
+        if (!sf::UniformBuffer::isAvailable())
+            return;
+
+        auto shader = sf::Shader::loadFromMemory(uniformBlockSource, sf::Shader::Type::Fragment);
+        REQUIRE(shader.has_value());
+
+        sf::UniformBuffer buffer;
+        REQUIRE(buffer.create(32));
+
+        CHECK(!shader->setUniformBlock("Missing", buffer));
+        CHECK(shader->setUniformBlock("Frame", buffer));
+        CHECK(shader->setUniformBlock("Frame", buffer));
+        sf::Shader::bind(&*shader);
+        sf::Shader::bind(nullptr);
+    }
 }
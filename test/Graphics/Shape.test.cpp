@@ -7,6 +7,7 @@
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <array>
 #include <type_traits>
 
 class TriangleShape : public sf::Shape
@@ -108,6 +109,12 @@ TEST_CASE("[Graphics] sf::Shape", runDisplayTests())
         CHECK(triangleShape.getPoint(1) == sf::Vector2f(0, 2));
         CHECK(triangleShape.getPoint(2) == sf::Vector2f(2, 2));
         CHECK(triangleShape.getGeometricCenter() == sf::Vector2f(1.f, 4.f / 3.f));
+
+        std::array<sf::Vector2f, 3> points;
+        triangleShape.getPoints(points.data());
+        CHECK(points[0] == sf::Vector2f(1, 0));
+        CHECK(points[1] == sf::Vector2f(0, 2));
+        CHECK(points[2] == sf::Vector2f(2, 2));
     }
 
     SECTION("Get bounds")
@@ -130,5 +137,13 @@ TEST_CASE("[Graphics] sf::Shape", runDisplayTests())
             CHECK(triangleShape.getLocalBounds() == Approx(sf::FloatRect({-7.2150f, -14.2400f}, {44.4300f, 59.2400f})));
             CHECK(triangleShape.getGlobalBounds() == Approx(sf::FloatRect({-7.2150f, -14.2400f}, {44.4300f, 59.2400f})));
         }
+
+        SECTION("Remove outline")
+        {
+            triangleShape.setOutlineThickness(5);
+            CHECK(triangleShape.getLocalBounds() != sf::FloatRect({0, 0}, {30, 40}));
+            triangleShape.setOutlineThickness(0);
+            CHECK(triangleShape.getLocalBounds() == sf::FloatRect({0, 0}, {30, 40}));
+        }
     }
 }
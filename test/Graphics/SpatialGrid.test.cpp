@@ -0,0 +1,128 @@
+#include <SFML/Graphics/SpatialGrid.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/View.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+std::vector<sf::SpatialGrid::Handle> query(const sf::SpatialGrid& grid, const sf::FloatRect& area)
+{
+    std::vector<sf::SpatialGrid::Handle> result;
+    grid.query(area, result);
+    std::sort(result.begin(), result.end());
+    return result;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::SpatialGrid")
+{
+    using Handles = std::vector<sf::SpatialGrid::Handle>;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpatialGrid>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpatialGrid>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SpatialGrid>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SpatialGrid>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::SpatialGrid grid(64);
+        CHECK(grid.getCellSize() == 64);
+        CHECK(grid.getItemCount() == 0);
+        CHECK(query(grid, {{-1000, -1000}, {2000, 2000}}).empty());
+    }
+
+    SECTION("insert()")
+    {
+        sf::SpatialGrid grid(10);
+        CHECK(grid.insert({{0, 0}, {5, 5}}) == 0);
+        CHECK(grid.insert({{-25, 5}, {40, 2}}) == 1);
+        CHECK(grid.insert({{100, 100}, {1, 1}}) == 2);
+        CHECK(grid.getItemCount() == 3);
+        CHECK(grid.getBounds(1) == sf::FloatRect({-25, 5}, {40, 2}));
+
+        CHECK(query(grid, {{1, 1}, {1, 1}}) == Handles{0});
+        CHECK(query(grid, {{-30, 0}, {10, 10}}) == Handles{1});
+        CHECK(query(grid, {{0, 0}, {10, 10}}) == Handles{0, 1});
+        CHECK(query(grid, {{50, 50}, {-100, -100}}) == Handles{0, 1});
+        CHECK(query(grid, {{-1000, -1000}, {2000, 2000}}) == Handles{0, 1, 2});
+        CHECK(query(grid, {{20, 20}, {10, 10}}).empty());
+    }
+
+    SECTION("update()")
+    {
+        sf::SpatialGrid grid(10);
+        const auto handle = grid.insert({{0, 0}, {5, 5}});
+
+        grid.update(handle, {{1, 1}, {5, 5}});
+        CHECK(query(grid, {{0, 0}, {10, 10}}) == Handles{handle});
+
+        grid.update(handle, {{15, 25}, {20, 5}});
+        CHECK(grid.getBounds(handle) == sf::FloatRect({15, 25}, {20, 5}));
+        CHECK(query(grid, {{0, 0}, {10, 10}}).empty());
+        CHECK(query(grid, {{30, 20}, {10, 10}}) == Handles{handle});
+    }
+
+    SECTION("remove()")
+    {
+        sf::SpatialGrid grid(10);
+        const auto first  = grid.insert({{0, 0}, {30, 30}});
+        const auto second = grid.insert({{5, 5}, {1, 1}});
+
+        grid.remove(first);
+        CHECK(grid.getItemCount() == 1);
+        CHECK(query(grid, {{0, 0}, {30, 30}}) == Handles{second});
+
+        // The handle of the removed item is reused
+        CHECK(grid.insert({{20, 20}, {1, 1}}) == first);
+        CHECK(query(grid, {{0, 0}, {30, 30}}) == Handles{first, second});
+
+        grid.clear();
+        CHECK(grid.getItemCount() == 0);
+        CHECK(query(grid, {{0, 0}, {30, 30}}).empty());
+    }
+
+    SECTION("Large and far away items")
+    {
+        sf::SpatialGrid grid(10);
+        grid.insert({{1e20f, 0}, {1, 1}});
+        const auto large = grid.insert({{-1e30f, 0}, {2e30f, 1}});
+        CHECK(query(grid, {{1e20f, 0}, {1, 1}}) == Handles{0, large});
+        CHECK(query(grid, {{-5, 0}, {1, 1}}) == Handles{large});
+        CHECK(query(grid, {{-5, 10}, {1, 1}}).empty());
+
+        grid.update(large, {{-5, 0}, {1, 1}});
+        CHECK(query(grid, {{-5, 0}, {1, 1}}) == Handles{large});
+        CHECK(query(grid, {{1e20f, 0}, {1, 1}}) == Handles{0});
+
+        grid.update(large, {{0, -1e30f}, {1, 2e30f}});
+        CHECK(query(grid, {{0, 50}, {1, 1}}) == Handles{large});
+
+        grid.remove(large);
+        CHECK(query(grid, {{0, 50}, {1, 1}}).empty());
+    }
+
+    SECTION("query() with a view")
+    {
+        sf::SpatialGrid grid(32);
+        grid.insert({{0, 0}, {10, 10}});
+        grid.insert({{500, 500}, {10, 10}});
+
+        std::vector<sf::SpatialGrid::Handle> result;
+        grid.query(sf::View({50, 50}, {100, 100}), result);
+        CHECK(result == Handles{0});
+
+        // Results are appended
+        grid.query(sf::View({500, 500}, {100, 100}), result);
+        CHECK(result == Handles{0, 1});
+    }
+}
@@ -0,0 +1,213 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureArray.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <algorithm>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::SpriteBatch>);
+    }
+
+    const auto texture = sf::Texture::create({64, 64}).value();
+
+    SECTION("Construction")
+    {
+        const sf::SpriteBatch batch;
+        CHECK(batch.getSpriteCount() == 0);
+        CHECK(batch.getExecutionPolicy() == sf::ExecutionPolicy::Sequential);
+    }
+
+    SECTION("add()")
+    {
+        sf::SpriteBatch batch;
+
+        SECTION("Texture")
+        {
+            CHECK(batch.add(texture) == 0);
+            CHECK(batch.getSpriteCount() == 1);
+            CHECK(&batch.getTexture(0) == &texture);
+            CHECK(batch.getTextureRect(0) == sf::IntRect({0, 0}, {64, 64}));
+            CHECK(batch.getPosition(0) == sf::Vector2f(0, 0));
+            CHECK(batch.getOrigin(0) == sf::Vector2f(0, 0));
+            CHECK(batch.getScale(0) == sf::Vector2f(1, 1));
+            CHECK(batch.getRotation(0) == sf::Angle::Zero);
+            CHECK(batch.getColor(0) == sf::Color::White);
+        }
+
+        SECTION("Texture and rectangle")
+        {
+            CHECK(batch.add(texture, {{8, 8}, {16, 32}}) == 0);
+            CHECK(batch.add(texture, {{0, 0}, {4, 4}}) == 1);
+            CHECK(batch.getSpriteCount() == 2);
+            CHECK(batch.getTextureRect(0) == sf::IntRect({8, 8}, {16, 32}));
+            CHECK(batch.getTextureRect(1) == sf::IntRect({0, 0}, {4, 4}));
+        }
+
+        SECTION("Sprite")
+        {
+            sf::Sprite sprite(texture, {{1, 2}, {3, 4}});
+            sprite.setPosition({10, 20});
+            sprite.setOrigin({1, 1});
+            sprite.setScale({2, 3});
+            sprite.setRotation(sf::degrees(45));
+            sprite.setColor(sf::Color::Red);
+
+            CHECK(batch.add(sprite) == 0);
+            CHECK(&batch.getTexture(0) == &texture);
+            CHECK(batch.getTextureRect(0) == sf::IntRect({1, 2}, {3, 4}));
+            CHECK(batch.getPosition(0) == sf::Vector2f(10, 20));
+            CHECK(batch.getOrigin(0) == sf::Vector2f(1, 1));
+            CHECK(batch.getScale(0) == sf::Vector2f(2, 3));
+            CHECK(batch.getRotation(0) == sf::degrees(45));
+            CHECK(batch.getColor(0) == sf::Color::Red);
+        }
+    }
+
+    SECTION("Texture arrays")
+    {
+        if (!sf::TextureArray::isAvailable())
+            return;
+
+        const auto textureArray = sf::TextureArray::create({16, 16}, 3).value();
+
+        sf::SpriteBatch batch;
+        CHECK(batch.add(textureArray, 2) == 0);
+        CHECK(batch.add(textureArray, 1, {{4, 4}, {8, 8}}) == 1);
+        CHECK(batch.add(texture) == 2);
+        CHECK(batch.getTextureArray(0) == &textureArray);
+        CHECK(batch.getLayer(0) == 2);
+        CHECK(batch.getTextureRect(0) == sf::IntRect({0, 0}, {16, 16}));
+        CHECK(batch.getLayer(1) == 1);
+        CHECK(batch.getTextureRect(1) == sf::IntRect({4, 4}, {8, 8}));
+        CHECK(batch.getTextureArray(2) == nullptr);
+        CHECK(batch.getLayer(2) == 0);
+
+        batch.setTexture(0, texture);
+        CHECK(batch.getTextureArray(0) == nullptr);
+        CHECK(&batch.getTexture(0) == &texture);
+
+        batch.setTextureArray(2, textureArray, 0);
+        CHECK(batch.getTextureArray(2) == &textureArray);
+        CHECK(batch.getLayer(2) == 0);
+
+        batch.remove(0);
+        CHECK(batch.getSpriteCount() == 2);
+        CHECK(batch.getTextureArray(0) == &textureArray);
+        CHECK(batch.getLayer(0) == 0);
+    }
+
+    SECTION("remove()")
+    {
+        sf::SpriteBatch batch;
+        batch.add(texture);
+        batch.add(texture);
+        batch.add(texture);
+        batch.setPosition(2, {3, 3});
+
+        batch.remove(0);
+        CHECK(batch.getSpriteCount() == 2);
+        CHECK(batch.getPosition(0) == sf::Vector2f(3, 3));
+
+        batch.remove(1);
+        CHECK(batch.getSpriteCount() == 1);
+
+        batch.clear();
+        CHECK(batch.getSpriteCount() == 0);
+    }
+
+    SECTION("Set/get properties")
+    {
+        sf::SpriteBatch batch;
+        batch.add(texture);
+
+        const auto otherTexture = sf::Texture::create({16, 16}).value();
+        batch.setTexture(0, otherTexture);
+        CHECK(&batch.getTexture(0) == &otherTexture);
+        CHECK(batch.getTextureRect(0) == sf::IntRect({0, 0}, {64, 64}));
+
+        batch.setTextureRect(0, {{1, 2}, {3, 4}});
+        CHECK(batch.getTextureRect(0) == sf::IntRect({1, 2}, {3, 4}));
+
+        batch.setPosition(0, {5, 6});
+        CHECK(batch.getPosition(0) == sf::Vector2f(5, 6));
+
+        batch.setOrigin(0, {7, 8});
+        CHECK(batch.getOrigin(0) == sf::Vector2f(7, 8));
+
+        batch.setScale(0, {2, 4});
+        CHECK(batch.getScale(0) == sf::Vector2f(2, 4));
+
+        batch.setRotation(0, sf::degrees(-90));
+        CHECK(batch.getRotation(0) == sf::degrees(270));
+
+        batch.setColor(0, sf::Color::Cyan);
+        CHECK(batch.getColor(0) == sf::Color::Cyan);
+
+        CHECK(batch.getParentTransform(0) == sf::Transform::Identity);
+        batch.setParentTransform(0, sf::Transform().translate({10, 20}));
+        CHECK(batch.getParentTransform(0) == sf::Transform().translate({10, 20}));
+
+        batch.setExecutionPolicy(sf::ExecutionPolicy::Parallel);
+        CHECK(batch.getExecutionPolicy() == sf::ExecutionPolicy::Parallel);
+    }
+
+    SECTION("Drawing")
+    {
+        // Texture with a different color in each quadrant
+        sf::Image image({4, 4});
+        for (unsigned int y = 0; y < 4; ++y)
+        {
+            for (unsigned int x = 0; x < 4; ++x)
+            {
+                const sf::Color left  = y < 2 ? sf::Color::Red : sf::Color::Green;
+                const sf::Color right = y < 2 ? sf::Color::Blue : sf::Color::Yellow;
+                image.setPixel({x, y}, x < 2 ? left : right);
+            }
+        }
+        const auto quadrants = sf::Texture::loadFromImage(image).value();
+
+        auto expected = sf::RenderTexture::create({64, 64}).value();
+        auto actual   = sf::RenderTexture::create({64, 64}).value();
+        expected.clear();
+        actual.clear();
+
+        sf::SpriteBatch batch;
+        for (int i = 0; i < 4; ++i)
+        {
+            sf::Sprite sprite(i % 2 ? texture : quadrants);
+            sprite.setTextureRect({{0, 0}, {4, 4}});
+            sprite.setPosition({16.f + 8.f * static_cast<float>(i), 32});
+            sprite.setOrigin({2, 2});
+            sprite.setScale({2, 1});
+            sprite.setRotation(sf::degrees(90.f * static_cast<float>(i)));
+            expected.draw(sprite);
+            batch.add(sprite);
+        }
+
+        actual.draw(batch);
+        expected.display();
+        actual.display();
+
+        const auto expectedImage = expected.getTexture().copyToImage();
+        const auto actualImage   = actual.getTexture().copyToImage();
+        CHECK(actualImage.getSize() == expectedImage.getSize());
+        CHECK(std::equal(actualImage.getPixelsPtr(),
+                         actualImage.getPixelsPtr() + 64 * 64 * 4,
+                         expectedImage.getPixelsPtr()));
+    }
+}
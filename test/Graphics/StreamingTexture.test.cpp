@@ -0,0 +1,103 @@
+#include <SFML/Graphics/StreamingTexture.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::StreamingTexture", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::StreamingTexture>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::StreamingTexture>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::StreamingTexture>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::StreamingTexture>);
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::StreamingTexture::create({0, 0}, sf::StreamingTexture::Format::NV12));
+
+        if (!sf::Shader::isAvailable())
+        {
+            CHECK(!sf::StreamingTexture::create({16, 16}, sf::StreamingTexture::Format::NV12));
+            return;
+        }
+
+        const auto streamingTexture = sf::StreamingTexture::create({16, 8}, sf::StreamingTexture::Format::I420);
+        REQUIRE(streamingTexture);
+        CHECK(streamingTexture->getSize() == sf::Vector2u(16, 8));
+        CHECK(streamingTexture->getFormat() == sf::StreamingTexture::Format::I420);
+        CHECK(streamingTexture->getColorSpace() == sf::StreamingTexture::ColorSpace::Bt601);
+        CHECK(!streamingTexture->isFullRange());
+        CHECK(streamingTexture->getTexture().getSize() == sf::Vector2u(16, 8));
+        CHECK(streamingTexture->getTexture().copyToImage().getPixel({0, 0}) == sf::Color::Black);
+    }
+
+    SECTION("setColorSpace()")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        auto streamingTexture = sf::StreamingTexture::create({2, 2}, sf::StreamingTexture::Format::NV12).value();
+        streamingTexture.setColorSpace(sf::StreamingTexture::ColorSpace::Bt709, true);
+        CHECK(streamingTexture.getColorSpace() == sf::StreamingTexture::ColorSpace::Bt709);
+        CHECK(streamingTexture.isFullRange());
+    }
+
+    SECTION("update()")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        // 6x2 frame in limited range: white on the left half, black on the right half, neutral chroma
+        constexpr std::size_t pitch = 8;
+        std::vector<std::uint8_t> luma(pitch * 2, 0);
+        for (std::size_t row = 0; row < 2; ++row)
+        {
+            for (std::size_t column = 0; column < 6; ++column)
+                luma[row * pitch + column] = column < 3 ? 235 : 16;
+        }
+
+        SECTION("NV12")
+        {
+            const std::vector<std::uint8_t> chroma(6, 128);
+            auto streamingTexture = sf::StreamingTexture::create({6, 2}, sf::StreamingTexture::Format::NV12).value();
+            const sf::StreamingTexture::Plane planes[] = {{luma.data(), pitch}, {chroma.data(), 6}};
+            streamingTexture.update(planes);
+
+            const sf::Image image = streamingTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::White);
+            CHECK(image.getPixel({2, 1}) == sf::Color::White);
+            CHECK(image.getPixel({3, 0}) == sf::Color::Black);
+            CHECK(image.getPixel({5, 1}) == sf::Color::Black);
+        }
+
+        SECTION("I420")
+        {
+            // Strongly red chroma in the first block
+            std::vector<std::uint8_t> chromaU(3, 128);
+            std::vector<std::uint8_t> chromaV(3, 128);
+            chromaU[0] = 90;
+            chromaV[0] = 240;
+
+            auto streamingTexture = sf::StreamingTexture::create({6, 2}, sf::StreamingTexture::Format::I420).value();
+            const sf::StreamingTexture::Plane planes[] = {{luma.data(), pitch},
+                                                          {chromaU.data(), 3},
+                                                          {chromaV.data(), 3}};
+            streamingTexture.update(planes);
+
+            const sf::Image image = streamingTexture.getTexture().copyToImage();
+            const sf::Color red   = image.getPixel({0, 0});
+            CHECK(red.r == 255);
+            CHECK(red.g < 255);
+            CHECK(image.getPixel({2, 0}) == sf::Color::White);
+            CHECK(image.getPixel({4, 1}) == sf::Color::Black);
+        }
+    }
+}
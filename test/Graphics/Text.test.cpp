@@ -2,13 +2,20 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/TextLayoutCache.hpp>
+
+#include <SFML/System/MemoryStats.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <string_view>
 #include <type_traits>
 
+#include <cmath>
+#include <cstdint>
+
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
 {
     SECTION("Type traits")
@@ -83,6 +90,17 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getString() == "abcdefghijklmnopqrstuvwxyz");
     }
 
+    SECTION("Set/get UTF-8 string")
+    {
+        sf::Text text(font);
+        text.setString(sf::Utf8View(std::string_view("Caf\xc3\xa9")));
+        CHECK(text.getString() == sf::String(U"Caf\u00e9"));
+        CHECK(text.getLocalBounds().width > 0);
+
+        text.setString("abc");
+        CHECK(text.getString() == "abc");
+    }
+
     SECTION("Set/get font")
     {
         sf::Text   text(font);
@@ -140,6 +158,32 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getOutlineThickness() == 3.14f);
     }
 
+    SECTION("Set/get layout cache")
+    {
+        sf::TextLayoutCache cache;
+        sf::Text            text(font, "Test\tshaped  text\nSecond line", 18);
+        const sf::FloatRect bounds = text.getLocalBounds();
+        CHECK(text.getLayoutCache() == nullptr);
+
+        text.setLayoutCache(&cache);
+        CHECK(text.getLayoutCache() == &cache);
+        CHECK(text.getLocalBounds().getSize().x > 0);
+        CHECK(cache.getRunCount() == 3);
+
+        // Without a shaper, runs are laid out exactly like characters
+        if (!sf::TextLayoutCache::isShapingAvailable())
+            CHECK(text.getLocalBounds() == bounds);
+
+        // Texts with the same strings reuse the runs
+        sf::Text other(font, "Second line", 18);
+        other.setLayoutCache(&cache);
+        CHECK(other.getLocalBounds().getSize().x > 0);
+        CHECK(cache.getRunCount() == 3);
+
+        text.setLayoutCache(nullptr);
+        CHECK(text.getLocalBounds() == bounds);
+    }
+
     SECTION("findCharacterPos()")
     {
         sf::Text text(font, "\tabcdefghijklmnopqrstuvwxyz \n");
@@ -181,5 +225,39 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK(text.getLocalBounds() == sf::FloatRect({1, 5}, {33, 13}));
             CHECK(text.getGlobalBounds() == Approx(sf::FloatRect({66, 182}, {33, 13})));
         }
+
+        SECTION("Change string")
+        {
+            // Only the changed lines are rebuilt, the bounds must match a text built from scratch
+            text.setString("Test\nLine\n");
+            CHECK(text.getLocalBounds() == sf::Text(font, "Test\nLine\n", 18).getLocalBounds());
+            text.setString("Test\nLine\nAppended line");
+            CHECK(text.getLocalBounds() == sf::Text(font, "Test\nLine\nAppended line", 18).getLocalBounds());
+            text.setString("Test\nLonger line\nAppended line");
+            CHECK(text.getLocalBounds() == sf::Text(font, "Test\nLonger line\nAppended line", 18).getLocalBounds());
+            text.setString("Test\nAppended line");
+            CHECK(text.getLocalBounds() == sf::Text(font, "Test\nAppended line", 18).getLocalBounds());
+        }
+    }
+
+    SECTION("Distance field outline")
+    {
+        auto distanceFieldFont = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        distanceFieldFont.setDistanceFieldEnabled(true);
+        sf::Text            text(distanceFieldFont, "Outline", 24);
+        const sf::FloatRect bounds = text.getLocalBounds();
+        const std::uint64_t bytes  = sf::MemoryStats::getStatistics(sf::MemoryStats::Category::Font).bytes;
+
+        // The outline reuses the fill glyphs, whatever its thickness
+        for (const float thickness : {0.5f, 1.5f, 2.f, 3.25f})
+        {
+            text.setOutlineThickness(thickness);
+            const float outline = std::ceil(thickness);
+            CHECK(text.getLocalBounds() ==
+                  sf::FloatRect({bounds.left - outline, bounds.top - outline},
+                                {bounds.width + 2 * outline, bounds.height + 2 * outline}));
+        }
+
+        CHECK(sf::MemoryStats::getStatistics(sf::MemoryStats::Category::Font).bytes == bytes);
     }
 }
@@ -0,0 +1,85 @@
+#include <SFML/Graphics/TextLayoutCache.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Font.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::TextLayoutCache", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_default_constructible_v<sf::TextLayoutCache>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TextLayoutCache>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextLayoutCache>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextLayoutCache cache;
+        CHECK(cache.getMemoryBudget() == sf::TextLayoutCache::DefaultMemoryBudget);
+        CHECK(cache.getMemoryUsage() == 0);
+        CHECK(cache.getRunCount() == 0);
+    }
+
+    const auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+
+    SECTION("shape()")
+    {
+        sf::TextLayoutCache cache;
+
+        const std::vector<sf::TextLayoutCache::ShapedGlyph> glyphs = cache.shape(font, U"AVA", 30, false);
+        REQUIRE(glyphs.size() == 3);
+        CHECK(glyphs[0].cluster == 0);
+        CHECK(glyphs[2].cluster == 2);
+        CHECK(glyphs[0].glyphIndex == glyphs[2].glyphIndex);
+        CHECK(cache.getRunCount() == 1);
+        CHECK(cache.getMemoryUsage() > 0);
+
+        if (!sf::TextLayoutCache::isShapingAvailable())
+        {
+            // The kerning is folded into the advances
+            CHECK(glyphs[0].advance == font.getGlyph(U'A', 30, false).advance + font.getKerning(U'A', U'V', 30, false));
+            CHECK(glyphs[2].advance == font.getGlyph(U'A', 30, false).advance);
+        }
+
+        // The same run is only shaped once
+        CHECK(&cache.shape(font, U"AVA", 30, false) == &cache.shape(font, U"AVA", 30, false));
+        CHECK(cache.getRunCount() == 1);
+
+        // The size and the weight are part of the key
+        CHECK(cache.shape(font, U"AVA", 20, false).size() == 3);
+        CHECK(cache.shape(font, U"AVA", 30, true).size() == 3);
+        CHECK(cache.getRunCount() == 3);
+
+        cache.clear();
+        CHECK(cache.getRunCount() == 0);
+        CHECK(cache.getMemoryUsage() == 0);
+    }
+
+    SECTION("Memory budget")
+    {
+        sf::TextLayoutCache cache(0);
+        CHECK(cache.getMemoryBudget() == 0);
+
+        // The run that was just shaped is always kept
+        CHECK(cache.shape(font, U"alpha", 30, false).size() == 5);
+        CHECK(cache.shape(font, U"second", 30, false).size() == 6);
+        CHECK(cache.getRunCount() == 1);
+
+        cache.setMemoryBudget(sf::TextLayoutCache::DefaultMemoryBudget);
+        CHECK(cache.shape(font, U"alpha", 30, false).size() == 5);
+        CHECK(cache.getRunCount() == 2);
+
+        // Reducing the budget removes the least recently used runs
+        cache.setMemoryBudget(cache.getMemoryUsage() - 1);
+        CHECK(cache.getRunCount() == 1);
+        CHECK(cache.shape(font, U"alpha", 30, false).size() == 5);
+        CHECK(cache.getRunCount() == 1);
+    }
+}
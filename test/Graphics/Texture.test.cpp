@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
 
 #include <SFML/System/FileInputStream.hpp>
 
@@ -9,7 +10,61 @@
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <array>
 #include <type_traits>
+#include <vector>
+
+namespace
+{
+// BC1 block whose 16 pixels are all opaque red
+constexpr std::array<std::uint8_t, 8> redBc1Block = {0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00};
+
+void writeUint32(std::vector<std::uint8_t>& file, std::size_t offset, std::uint32_t value)
+{
+    for (std::size_t i = 0; i < 4; ++i)
+        file[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+// DDS file of a red 4x4 BC1 image with its full mipmap chain
+std::vector<std::uint8_t> makeRedBc1Dds()
+{
+    std::vector<std::uint8_t> file(128);
+    writeUint32(file, 0, 0x20534444);   // "DDS "
+    writeUint32(file, 4, 124);          // Header size
+    writeUint32(file, 8, 0x21007);      // Flags: caps, height, width, pixel format, mipmap count
+    writeUint32(file, 12, 4);           // Height
+    writeUint32(file, 16, 4);           // Width
+    writeUint32(file, 28, 3);           // Mipmap count
+    writeUint32(file, 76, 32);          // Pixel format size
+    writeUint32(file, 80, 0x4);         // Pixel format flags: FourCC
+    writeUint32(file, 84, 0x31545844);  // "DXT1"
+
+    for (int level = 0; level < 3; ++level)
+        file.insert(file.end(), redBc1Block.begin(), redBc1Block.end());
+
+    return file;
+}
+
+// KTX2 file of a red 4x4 BC1 image without mipmaps
+std::vector<std::uint8_t> makeRedBc1Ktx2()
+{
+    std::vector<std::uint8_t> file = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    file.resize(104);
+    writeUint32(file, 12, 133); // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    writeUint32(file, 16, 1);   // Type size
+    writeUint32(file, 20, 4);   // Width
+    writeUint32(file, 24, 4);   // Height
+    writeUint32(file, 36, 1);   // Face count
+    writeUint32(file, 40, 1);   // Level count
+    writeUint32(file, 80, 104); // Offset of level 0
+    writeUint32(file, 88, 8);   // Size of level 0
+    writeUint32(file, 96, 8);   // Uncompressed size of level 0
+
+    file.insert(file.end(), redBc1Block.begin(), redBc1Block.end());
+
+    return file;
+}
+} // namespace
 
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
@@ -134,6 +189,46 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("loadCompressedFromMemory()")
+    {
+        SECTION("Invalid data")
+        {
+            constexpr std::uint8_t garbage[] = {'n', 'o', 't', ' ', 'a', ' ', 't', 'e', 'x', 't', 'u', 'r', 'e'};
+            CHECK(!sf::Texture::loadCompressedFromMemory(garbage, sizeof(garbage)));
+
+            auto truncated = makeRedBc1Dds();
+            truncated.resize(truncated.size() - 1);
+            CHECK(!sf::Texture::loadCompressedFromMemory(truncated.data(), truncated.size()));
+        }
+
+        if (!sf::Texture::isCompressedFormatAvailable(sf::Texture::CompressedFormat::Bc1))
+            return;
+
+        SECTION("DDS")
+        {
+            const auto file    = makeRedBc1Dds();
+            auto       texture = sf::Texture::loadCompressedFromMemory(file.data(), file.size()).value();
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+            CHECK(texture.getCompressedFormat() == sf::Texture::CompressedFormat::Bc1);
+            CHECK(!texture.isSrgb());
+            CHECK(!texture.generateMipmap());
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(3, 3)) == sf::Color::Red);
+
+            const sf::Texture copy = texture;
+            CHECK(!copy.getCompressedFormat());
+            CHECK(copy.copyToImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+        }
+
+        SECTION("KTX2")
+        {
+            const auto file    = makeRedBc1Ktx2();
+            const auto texture = sf::Texture::loadCompressedFromMemory(file.data(), file.size()).value();
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+            CHECK(texture.getCompressedFormat() == sf::Texture::CompressedFormat::Bc1);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 2)) == sf::Color::Red);
+        }
+    }
+
     SECTION("Copy semantics")
     {
         constexpr std::uint8_t red[] = {0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF};
@@ -178,6 +273,21 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
             CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
         }
 
+        SECTION("Strided pixels, size and destination")
+        {
+            // 2x2 region of a 3 pixels wide buffer, the last pixel of each row must be skipped
+            constexpr std::uint8_t pixels[] = {0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+                                               0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00};
+
+            auto texture = sf::Texture::create(sf::Vector2u(3, 2)).value();
+            texture.update(pixels, 12, sf::Vector2u(2, 2), sf::Vector2u(1, 0));
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(1, 0)) == sf::Color::Yellow);
+            CHECK(image.getPixel(sf::Vector2u(2, 0)) == sf::Color::Cyan);
+            CHECK(image.getPixel(sf::Vector2u(1, 1)) == sf::Color::Cyan);
+            CHECK(image.getPixel(sf::Vector2u(2, 1)) == sf::Color::Yellow);
+        }
+
         SECTION("Another texture")
         {
             auto otherTexture = sf::Texture::create(sf::Vector2u(1, 1)).value();
@@ -221,6 +331,33 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("updateAsync()")
+    {
+        constexpr std::uint8_t magenta[] = {0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF};
+
+        auto texture = sf::Texture::create(sf::Vector2u(2, 2)).value();
+        texture.updateAsync(magenta, sf::Vector2u(2, 1), sf::Vector2u(0, 1));
+        texture.updateAsync(magenta, sf::Vector2u(1, 2), sf::Vector2u(0, 0));
+        const sf::Image image = texture.copyToImage();
+        CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Magenta);
+        CHECK(image.getPixel(sf::Vector2u(1, 1)) == sf::Color::Magenta);
+    }
+
+    SECTION("copyToImageAsync()")
+    {
+        const sf::Image image(sf::Vector2u(3, 5), sf::Color::Cyan);
+        auto            texture = sf::Texture::loadFromImage(image).value();
+
+        sf::TextureReadback readback = texture.copyToImageAsync();
+        texture.update(sf::Image(sf::Vector2u(3, 5), sf::Color::Red));
+
+        const sf::Image& copy = readback.getImage();
+        CHECK(readback.isReady());
+        REQUIRE(copy.getSize() == sf::Vector2u(3, 5));
+        CHECK(copy.getPixel(sf::Vector2u(0, 0)) == sf::Color::Cyan);
+        CHECK(copy.getPixel(sf::Vector2u(2, 4)) == sf::Color::Cyan);
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture = sf::Texture::create({64, 64}).value();
@@ -241,12 +378,32 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         CHECK(!texture.isRepeated());
     }
 
+    SECTION("Set/get premultiplied alpha")
+    {
+        sf::Texture texture = sf::Texture::create({64, 64}).value();
+        CHECK(!texture.isPremultipliedAlpha());
+        texture.setPremultipliedAlpha(true);
+        CHECK(texture.isPremultipliedAlpha());
+
+        const sf::Texture copy = texture;
+        CHECK(copy.isPremultipliedAlpha());
+    }
+
     SECTION("generateMipmap()")
     {
         sf::Texture texture = sf::Texture::create({100, 100}).value();
         CHECK(texture.generateMipmap());
     }
 
+    SECTION("setMipmap()")
+    {
+        const sf::Image image(sf::Vector2u(8, 2), sf::Color::Red);
+        sf::Texture     texture = sf::Texture::create(image.getSize()).value();
+        CHECK(texture.setMipmap(image.generateMipChain()));
+        CHECK(!texture.setMipmap({}));
+        CHECK(!texture.setMipmap({sf::Image(sf::Vector2u(4, 1))}));
+    }
+
     SECTION("swap()")
     {
         constexpr std::uint8_t blue[]  = {0x00, 0x00, 0xFF, 0xFF};
@@ -282,4 +439,9 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
     {
         CHECK(sf::Texture::getMaximumSize() > 0);
     }
+
+    SECTION("getCompressedFormat()")
+    {
+        CHECK(!sf::Texture::create({4, 4}).value().getCompressedFormat());
+    }
 }
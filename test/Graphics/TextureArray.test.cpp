@@ -0,0 +1,74 @@
+#include <SFML/Graphics/TextureArray.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureArray", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureArray>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureArray>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureArray>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureArray>);
+    }
+
+    if (!sf::TextureArray::isAvailable())
+        return;
+
+    SECTION("getMaximumLayerCount()")
+    {
+        CHECK(sf::TextureArray::getMaximumLayerCount() >= 64);
+    }
+
+    SECTION("create()")
+    {
+        SECTION("At least one dimension is zero")
+        {
+            CHECK(!sf::TextureArray::create({0, 16}, 4).has_value());
+            CHECK(!sf::TextureArray::create({16, 0}, 4).has_value());
+        }
+
+        SECTION("No layer")
+        {
+            CHECK(!sf::TextureArray::create({16, 16}, 0).has_value());
+        }
+
+        SECTION("Too many layers")
+        {
+            CHECK(!sf::TextureArray::create({16, 16}, sf::TextureArray::getMaximumLayerCount() + 1).has_value());
+        }
+
+        SECTION("Valid size")
+        {
+            const auto textureArray = sf::TextureArray::create({32, 16}, 4).value();
+            CHECK(textureArray.getSize() == sf::Vector2u(32, 16));
+            CHECK(textureArray.getLayerCount() == 4);
+            CHECK(!textureArray.isSmooth());
+            CHECK(!textureArray.isSrgb());
+            CHECK(textureArray.getNativeHandle() != 0);
+        }
+    }
+
+    SECTION("Set/get smooth")
+    {
+        auto textureArray = sf::TextureArray::create({16, 16}, 2).value();
+        textureArray.setSmooth(true);
+        CHECK(textureArray.isSmooth());
+        textureArray.setSmooth(false);
+        CHECK(!textureArray.isSmooth());
+    }
+
+    SECTION("update()")
+    {
+        auto textureArray = sf::TextureArray::create({16, 16}, 2).value();
+        textureArray.update(sf::Image({16, 16}, sf::Color::Red), 1);
+        textureArray.update(sf::Image({8, 8}, sf::Color::Blue), {8, 8}, 0);
+        CHECK(textureArray.getSize() == sf::Vector2u(16, 16));
+    }
+}
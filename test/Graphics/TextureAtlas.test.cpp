@@ -0,0 +1,97 @@
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureAtlas", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureAtlas>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextureAtlas atlas({256, 128});
+        CHECK(atlas.getPageCount() == 0);
+        CHECK(atlas.getPageSize() == sf::Vector2u(256, 128));
+        CHECK(atlas.getEfficiency() == 0.f);
+        CHECK(!atlas.isSmooth());
+    }
+
+    SECTION("add()")
+    {
+        sf::TextureAtlas atlas({64, 64}, 0);
+
+        SECTION("Image larger than a page")
+        {
+            CHECK(!atlas.add(sf::Image({65, 10})));
+            CHECK(atlas.getPageCount() == 0);
+        }
+
+        SECTION("Single page")
+        {
+            const auto first  = atlas.add(sf::Image({32, 32}, sf::Color::Red)).value();
+            const auto second = atlas.add(sf::Image({32, 32}, sf::Color::Green)).value();
+            CHECK(atlas.getPageCount() == 1);
+            CHECK(first.page == 0);
+            CHECK(second.page == 0);
+            CHECK(first.rect.getSize() == sf::Vector2i(32, 32));
+            CHECK(second.rect.getSize() == sf::Vector2i(32, 32));
+            CHECK(!first.rect.findIntersection(second.rect));
+            CHECK(atlas.getEfficiency() == 0.5f);
+
+            const sf::Image image = atlas.getTexture(0).copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(first.rect.getPosition())) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(second.rect.getPosition())) == sf::Color::Green);
+        }
+
+        SECTION("Multiple pages")
+        {
+            CHECK(atlas.add(sf::Image({64, 48})));
+            const auto region = atlas.add(sf::Image({32, 32})).value();
+            CHECK(atlas.getPageCount() == 2);
+            CHECK(region.page == 1);
+
+            // Images fill the gaps left in previous pages
+            CHECK(atlas.add(sf::Image({64, 16})).value().page == 0);
+            CHECK(atlas.getPageCount() == 2);
+        }
+
+        SECTION("Padding")
+        {
+            sf::TextureAtlas paddedAtlas({64, 64}, 2);
+            const auto       region = paddedAtlas.add(sf::Image({60, 60})).value();
+            CHECK(region.rect == sf::IntRect({2, 2}, {60, 60}));
+            CHECK(!paddedAtlas.add(sf::Image({61, 61})));
+        }
+    }
+
+    SECTION("clear()")
+    {
+        sf::TextureAtlas atlas({64, 64});
+        CHECK(atlas.add(sf::Image({16, 16})));
+        atlas.clear();
+        CHECK(atlas.getPageCount() == 0);
+        CHECK(atlas.getEfficiency() == 0.f);
+    }
+
+    SECTION("Set/get smooth")
+    {
+        sf::TextureAtlas atlas({64, 64});
+        CHECK(atlas.add(sf::Image({16, 16})));
+        atlas.setSmooth(true);
+        CHECK(atlas.isSmooth());
+        CHECK(atlas.getTexture(0).isSmooth());
+    }
+}
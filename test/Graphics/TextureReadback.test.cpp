@@ -0,0 +1,44 @@
+#include <SFML/Graphics/TextureReadback.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <utility>
+
+TEST_CASE("[Graphics] sf::TextureReadback", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureReadback>);
+    }
+
+    const auto texture = sf::Texture::loadFromImage(sf::Image(sf::Vector2u(4, 2), sf::Color::Green)).value();
+
+    SECTION("getImage()")
+    {
+        sf::TextureReadback readback = texture.copyToImageAsync();
+        const sf::Image&    image    = readback.getImage();
+        REQUIRE(image.getSize() == sf::Vector2u(4, 2));
+        CHECK(image.getPixel(sf::Vector2u(3, 1)) == sf::Color::Green);
+        CHECK(&readback.getImage() == &image);
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::TextureReadback readback      = texture.copyToImageAsync();
+        sf::TextureReadback movedReadback = std::move(readback);
+        CHECK(movedReadback.getImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Green);
+
+        readback = texture.copyToImageAsync();
+        CHECK(readback.getImage().getSize() == sf::Vector2u(4, 2));
+    }
+}
@@ -0,0 +1,184 @@
+#include <SFML/Graphics/TextureStreamer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+void writeUint32(std::vector<std::uint8_t>& file, std::size_t offset, std::uint32_t value)
+{
+    for (std::size_t i = 0; i < 4; ++i)
+        file[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+// Size of a BC1 level, in bytes
+std::size_t getBc1LevelSize(unsigned int size)
+{
+    const std::size_t blocks = (size + 3) / 4;
+    return blocks * blocks * 8;
+}
+
+// DDS file of a square BC1 image with its full mipmap chain
+std::vector<std::uint8_t> makeBc1Dds(unsigned int size)
+{
+    unsigned int levelCount = 1;
+    while ((size >> (levelCount - 1)) > 1)
+        ++levelCount;
+
+    std::vector<std::uint8_t> file(128);
+    writeUint32(file, 0, 0x20534444);  // "DDS "
+    writeUint32(file, 4, 124);         // Header size
+    writeUint32(file, 8, 0x21007);     // Flags: caps, height, width, pixel format, mipmap count
+    writeUint32(file, 12, size);       // Height
+    writeUint32(file, 16, size);       // Width
+    writeUint32(file, 28, levelCount); // Mipmap count
+    writeUint32(file, 76, 32);         // Pixel format size
+    writeUint32(file, 80, 0x4);        // Pixel format flags: FourCC
+    writeUint32(file, 84, 0x31545844); // "DXT1"
+
+    for (unsigned int level = 0; level < levelCount; ++level)
+        file.resize(file.size() + getBc1LevelSize(size >> level));
+
+    return file;
+}
+
+// Memory used by the levels of a BC1 image from a level down to 1x1
+std::uint64_t getBc1Memory(unsigned int size, unsigned int level)
+{
+    std::uint64_t memory = 0;
+    for (unsigned int levelSize = size >> level; levelSize > 0; levelSize /= 2)
+        memory += getBc1LevelSize(levelSize);
+    return memory;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::TextureStreamer", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureStreamer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureStreamer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureStreamer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureStreamer>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextureStreamer streamer;
+        CHECK(streamer.getMemoryBudget() == sf::TextureStreamer::DefaultMemoryBudget);
+        CHECK(streamer.getUploadLimit() == sf::TextureStreamer::DefaultUploadLimit);
+        CHECK(streamer.getBaseSize() == sf::TextureStreamer::DefaultBaseSize);
+        CHECK(streamer.getMemoryUsage() == 0);
+        CHECK(!streamer.isSmooth());
+        CHECK(!streamer.contains(0));
+    }
+
+    SECTION("Setters and getters")
+    {
+        sf::TextureStreamer streamer(1000);
+        CHECK(streamer.getMemoryBudget() == 1000);
+        streamer.setMemoryBudget(2000);
+        CHECK(streamer.getMemoryBudget() == 2000);
+        streamer.setUploadLimit(500);
+        CHECK(streamer.getUploadLimit() == 500);
+        streamer.setBaseSize(16);
+        CHECK(streamer.getBaseSize() == 16);
+        streamer.setSmooth(true);
+        CHECK(streamer.isSmooth());
+    }
+
+    SECTION("Invalid data")
+    {
+        sf::TextureStreamer    streamer;
+        constexpr std::uint8_t garbage[] = {'n', 'o', 't', ' ', 'a', ' ', 't', 'e', 'x', 't', 'u', 'r', 'e'};
+        CHECK(!streamer.loadFromMemory(garbage, sizeof(garbage)));
+        CHECK(!streamer.loadFromFile("does/not/exist.dds"));
+    }
+
+    if (!sf::Texture::isCompressedFormatAvailable(sf::Texture::CompressedFormat::Bc1))
+        return;
+
+    const std::vector<std::uint8_t> file = makeBc1Dds(64);
+
+    sf::TextureStreamer streamer;
+    streamer.setBaseSize(8);
+
+    SECTION("Streaming")
+    {
+        const sf::TextureStreamer::Handle handle = streamer.loadFromMemory(file.data(), file.size()).value();
+        CHECK(streamer.contains(handle));
+
+        // Only the base levels are loaded, but the texture has the full size
+        const sf::Texture& texture = streamer.getTexture(handle);
+        CHECK(texture.getSize() == sf::Vector2u(64, 64));
+        CHECK(streamer.getResidentLevel(handle) == 3);
+        CHECK(streamer.getMemoryUsage() == getBc1Memory(64, 3));
+
+        streamer.request(handle, {20, 20});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(handle) == 1);
+        CHECK(streamer.getMemoryUsage() == getBc1Memory(64, 1));
+        CHECK(&streamer.getTexture(handle) == &texture);
+
+        streamer.request(handle, {100, 100});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(handle) == 0);
+        CHECK(streamer.getMemoryUsage() == getBc1Memory(64, 0));
+
+        streamer.request(handle, {1, 1});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(handle) == 3);
+
+        streamer.remove(handle);
+        CHECK(!streamer.contains(handle));
+        CHECK(streamer.getMemoryUsage() == 0);
+    }
+
+    SECTION("Budget")
+    {
+        const sf::TextureStreamer::Handle first  = streamer.loadFromMemory(file.data(), file.size()).value();
+        const sf::TextureStreamer::Handle second = streamer.loadFromMemory(file.data(), file.size()).value();
+        streamer.setMemoryBudget(getBc1Memory(64, 0) + getBc1Memory(64, 3));
+
+        // Both textures fit
+        streamer.request(first, {64, 64});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(first) == 0);
+        CHECK(streamer.getResidentLevel(second) == 3);
+
+        // The least recently requested texture loses its larger levels
+        streamer.request(second, {64, 64});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(first) == 3);
+        CHECK(streamer.getResidentLevel(second) == 0);
+
+        // The remaining memory is used for the largest level that fits
+        streamer.request(second, {64, 64});
+        streamer.request(first, {64, 64});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(first) == 0);
+        CHECK(streamer.getResidentLevel(second) == 3);
+        CHECK(streamer.getMemoryUsage() <= streamer.getMemoryBudget());
+    }
+
+    SECTION("Upload limit")
+    {
+        const sf::TextureStreamer::Handle first  = streamer.loadFromMemory(file.data(), file.size()).value();
+        const sf::TextureStreamer::Handle second = streamer.loadFromMemory(file.data(), file.size()).value();
+        streamer.setUploadLimit(1);
+
+        streamer.request(first, {64, 64});
+        streamer.request(second, {64, 64});
+        streamer.update();
+        CHECK(streamer.getResidentLevel(first) + streamer.getResidentLevel(second) == 3);
+        streamer.update();
+        CHECK(streamer.getResidentLevel(first) == 0);
+        CHECK(streamer.getResidentLevel(second) == 0);
+    }
+}
@@ -0,0 +1,118 @@
+#include <SFML/Graphics/TileMap.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TileMap", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TileMap>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TileMap>);
+    }
+
+    // Tileset of four 2x2 tiles of different colors
+    sf::Image image({4, 4});
+    for (unsigned int y = 0; y < 4; ++y)
+    {
+        for (unsigned int x = 0; x < 4; ++x)
+        {
+            const sf::Color left  = y < 2 ? sf::Color::Red : sf::Color::Green;
+            const sf::Color right = y < 2 ? sf::Color::Blue : sf::Color::Yellow;
+            image.setPixel({x, y}, x < 2 ? left : right);
+        }
+    }
+    const auto tileset = sf::Texture::loadFromImage(image).value();
+
+    SECTION("Construction")
+    {
+        const sf::TileMap map(tileset, {2, 2}, {5, 3}, 2);
+        CHECK(&map.getTileset() == &tileset);
+        CHECK(map.getTileSize() == sf::Vector2u(2, 2));
+        CHECK(map.getMapSize() == sf::Vector2u(5, 3));
+        CHECK(map.getChunkSize() == 2);
+        CHECK(map.getChunkCount() == 6);
+        CHECK(map.getTile({4, 2}) == sf::TileMap::EmptyTile);
+        CHECK(map.getLocalBounds() == sf::FloatRect({0, 0}, {10, 6}));
+        CHECK(map.getGlobalBounds() == sf::FloatRect({0, 0}, {10, 6}));
+    }
+
+    SECTION("Set/get tiles")
+    {
+        sf::TileMap map(tileset, {2, 2}, {3, 2});
+        map.setTile({1, 1}, 3);
+        CHECK(map.getTile({1, 1}) == 3);
+        CHECK(map.getTile({0, 0}) == sf::TileMap::EmptyTile);
+
+        constexpr std::array<std::uint32_t, 6> tiles = {0, 1, 2, 3, sf::TileMap::EmptyTile, 1};
+        map.setTiles(tiles.data());
+        CHECK(map.getTile({0, 0}) == 0);
+        CHECK(map.getTile({2, 0}) == 2);
+        CHECK(map.getTile({1, 1}) == sf::TileMap::EmptyTile);
+        CHECK(map.getTile({2, 1}) == 1);
+    }
+
+    SECTION("Drawing")
+    {
+        auto renderTexture = sf::RenderTexture::create({6, 6}).value();
+
+        sf::TileMap map(tileset, {2, 2}, {3, 3}, 2);
+        constexpr std::array<std::uint32_t, 9> tiles = {0, 1, 2, 3, sf::TileMap::EmptyTile, 0, 1, 2, 3};
+        map.setTiles(tiles.data());
+
+        const auto drawCalls = [&] { return renderTexture.getStatistics().drawCalls; };
+
+        SECTION("Whole map")
+        {
+            renderTexture.clear(sf::Color::Black);
+            const std::size_t before = drawCalls();
+            renderTexture.draw(map);
+            CHECK(drawCalls() - before == 4);
+
+            // Changing a tile after a first draw only patches its chunk
+            map.setTile({1, 1}, 1);
+            renderTexture.draw(map);
+            renderTexture.display();
+
+            const sf::Image result = renderTexture.getTexture().copyToImage();
+            CHECK(result.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(result.getPixel({2, 0}) == sf::Color::Blue);
+            CHECK(result.getPixel({4, 0}) == sf::Color::Green);
+            CHECK(result.getPixel({2, 2}) == sf::Color::Blue);
+            CHECK(result.getPixel({4, 2}) == sf::Color::Red);
+            CHECK(result.getPixel({5, 5}) == sf::Color::Yellow);
+        }
+
+        SECTION("Chunks outside the view are not drawn")
+        {
+            renderTexture.setView(sf::View({5, 5}, {2, 2}));
+            const std::size_t before = drawCalls();
+            renderTexture.draw(map);
+            CHECK(drawCalls() - before == 1);
+
+            renderTexture.setView(sf::View({50, 50}, {2, 2}));
+            renderTexture.draw(map);
+            CHECK(drawCalls() - before == 1);
+        }
+
+        SECTION("Empty chunks are not drawn")
+        {
+            const sf::TileMap emptyMap(tileset, {2, 2}, {3, 3}, 2);
+            const std::size_t before = drawCalls();
+            renderTexture.draw(emptyMap);
+            CHECK(drawCalls() == before);
+        }
+    }
+}
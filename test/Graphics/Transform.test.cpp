@@ -69,6 +69,29 @@ TEST_CASE("[Graphics] sf::Transform")
         STATIC_CHECK(transform.transformPoint({1.0f, 1.0f}) == sf::Vector2f(6.0f, 13.0f));
     }
 
+    SECTION("transformPoints()")
+    {
+        sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        transform.rotate(sf::degrees(30));
+
+        // An odd count exercises both the vectorized and the scalar code
+        std::vector<sf::Vector2f> points;
+        for (int i = 0; i < 7; ++i)
+            points.emplace_back(static_cast<float>(i) * 10.5f - 20.f, static_cast<float>(i * i) * -3.25f);
+
+        std::vector<sf::Vector2f> output(points.size());
+        transform.transformPoints(points.data(), output.data(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(output[i] == Approx(transform.transformPoint(points[i])));
+
+        // In place
+        transform.transformPoints(points.data(), points.data(), points.size());
+        CHECK(points == output);
+
+        // Nothing to do
+        transform.transformPoints(nullptr, nullptr, 0);
+    }
+
     SECTION("transformRect()")
     {
         STATIC_CHECK(sf::Transform::Identity.transformRect({{-200.0f, -200.0f}, {-100.0f, -100.0f}}) ==
@@ -0,0 +1,179 @@
+#include <SFML/Graphics/TransformHierarchy.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <algorithm>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TransformHierarchy")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TransformHierarchy>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TransformHierarchy>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TransformHierarchy>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TransformHierarchy>);
+    }
+
+    sf::TransformHierarchy hierarchy;
+
+    SECTION("Construction")
+    {
+        CHECK(hierarchy.getNodeCount() == 0);
+        CHECK(!hierarchy.contains(0));
+        CHECK(hierarchy.getChangedNodes().empty());
+    }
+
+    SECTION("add()")
+    {
+        const sf::TransformHierarchy::Node root  = hierarchy.add();
+        const sf::TransformHierarchy::Node child = hierarchy.add(root);
+        CHECK(hierarchy.getNodeCount() == 2);
+        CHECK(hierarchy.contains(root));
+        CHECK(hierarchy.contains(child));
+        CHECK(hierarchy.getParent(root) == sf::TransformHierarchy::NoParent);
+        CHECK(hierarchy.getParent(child) == root);
+        CHECK(hierarchy.getPosition(child) == sf::Vector2f(0, 0));
+        CHECK(hierarchy.getRotation(child) == sf::Angle::Zero);
+        CHECK(hierarchy.getScale(child) == sf::Vector2f(1, 1));
+        CHECK(hierarchy.getOrigin(child) == sf::Vector2f(0, 0));
+        CHECK(hierarchy.getLocalBounds(child) == sf::FloatRect());
+        CHECK(hierarchy.getWorldTransform(child) == sf::Transform::Identity);
+    }
+
+    SECTION("Setters and getters")
+    {
+        const sf::TransformHierarchy::Node node = hierarchy.add();
+        hierarchy.setPosition(node, {1, 2});
+        hierarchy.setRotation(node, sf::degrees(-90));
+        hierarchy.setScale(node, {3, 4});
+        hierarchy.setOrigin(node, {5, 6});
+        hierarchy.setLocalBounds(node, {{0, 0}, {10, 10}});
+        CHECK(hierarchy.getPosition(node) == sf::Vector2f(1, 2));
+        CHECK(hierarchy.getRotation(node) == sf::degrees(270));
+        CHECK(hierarchy.getScale(node) == sf::Vector2f(3, 4));
+        CHECK(hierarchy.getOrigin(node) == sf::Vector2f(5, 6));
+        CHECK(hierarchy.getLocalBounds(node) == sf::FloatRect({0, 0}, {10, 10}));
+    }
+
+    SECTION("World transforms")
+    {
+        const sf::TransformHierarchy::Node root  = hierarchy.add();
+        const sf::TransformHierarchy::Node child = hierarchy.add(root);
+        hierarchy.setPosition(root, {100, 0});
+        hierarchy.setRotation(root, sf::degrees(90));
+        hierarchy.setPosition(child, {10, 0});
+        hierarchy.setScale(child, {2, 2});
+
+        sf::Transformable expected;
+        expected.setPosition({100, 0});
+        expected.setRotation(sf::degrees(90));
+        CHECK(hierarchy.getLocalTransform(root) == Approx(expected.getTransform()));
+        CHECK(hierarchy.getWorldTransform(root) == Approx(expected.getTransform()));
+        CHECK(hierarchy.getWorldTransform(child).transformPoint({0, 0}) == Approx(sf::Vector2f(100, 10)));
+        CHECK(hierarchy.getWorldTransform(child).transformPoint({1, 0}) == Approx(sf::Vector2f(100, 12)));
+
+        hierarchy.setLocalBounds(child, {{0, 0}, {5, 5}});
+        CHECK(hierarchy.getWorldBounds(child) == Approx(sf::FloatRect({90, 10}, {10, 10})));
+    }
+
+    SECTION("Dirty propagation")
+    {
+        const sf::TransformHierarchy::Node first  = hierarchy.add();
+        const sf::TransformHierarchy::Node second = hierarchy.add();
+        const sf::TransformHierarchy::Node child  = hierarchy.add(first);
+        hierarchy.update();
+        CHECK(hierarchy.getChangedNodes() == std::vector{first, second, child});
+
+        // Only the modified node and its descendants are recomputed
+        hierarchy.setPosition(first, {1, 1});
+        hierarchy.update();
+        CHECK(hierarchy.getChangedNodes() == std::vector{first, child});
+        CHECK(hierarchy.getWorldTransform(child).transformPoint({0, 0}) == sf::Vector2f(1, 1));
+
+        hierarchy.setPosition(child, {1, 1});
+        hierarchy.update();
+        CHECK(hierarchy.getChangedNodes() == std::vector{child});
+
+        // Nothing to recompute: the last changes are kept
+        hierarchy.update();
+        CHECK(hierarchy.getChangedNodes() == std::vector{child});
+    }
+
+    SECTION("setParent()")
+    {
+        const sf::TransformHierarchy::Node first  = hierarchy.add();
+        const sf::TransformHierarchy::Node child  = hierarchy.add(first);
+        const sf::TransformHierarchy::Node second = hierarchy.add();
+        hierarchy.setPosition(first, {10, 0});
+        hierarchy.setPosition(second, {0, 20});
+        hierarchy.setPosition(child, {1, 1});
+
+        // The new parent was added after the node
+        hierarchy.setParent(first, second);
+        CHECK(hierarchy.getParent(first) == second);
+        CHECK(hierarchy.getParent(child) == first);
+        CHECK(hierarchy.getPosition(first) == sf::Vector2f(10, 0));
+        CHECK(hierarchy.getWorldTransform(child).transformPoint({0, 0}) == sf::Vector2f(11, 21));
+
+        hierarchy.setParent(first, sf::TransformHierarchy::NoParent);
+        CHECK(hierarchy.getParent(first) == sf::TransformHierarchy::NoParent);
+        CHECK(hierarchy.getWorldTransform(child).transformPoint({0, 0}) == sf::Vector2f(11, 1));
+    }
+
+    SECTION("remove()")
+    {
+        const sf::TransformHierarchy::Node root       = hierarchy.add();
+        const sf::TransformHierarchy::Node child      = hierarchy.add(root);
+        const sf::TransformHierarchy::Node other      = hierarchy.add();
+        const sf::TransformHierarchy::Node grandChild = hierarchy.add(child);
+        hierarchy.setPosition(other, {5, 5});
+
+        hierarchy.remove(child);
+        CHECK(hierarchy.getNodeCount() == 2);
+        CHECK(hierarchy.contains(root));
+        CHECK(!hierarchy.contains(child));
+        CHECK(hierarchy.contains(other));
+        CHECK(!hierarchy.contains(grandChild));
+        CHECK(hierarchy.getWorldTransform(other).transformPoint({0, 0}) == sf::Vector2f(5, 5));
+
+        // Removed nodes are reused
+        const sf::TransformHierarchy::Node reused = hierarchy.add(other);
+        CHECK((reused == child || reused == grandChild));
+        CHECK(hierarchy.getWorldTransform(reused).transformPoint({0, 0}) == sf::Vector2f(5, 5));
+
+        hierarchy.clear();
+        CHECK(hierarchy.getNodeCount() == 0);
+        CHECK(!hierarchy.contains(root));
+    }
+
+    SECTION("query()")
+    {
+        const sf::TransformHierarchy::Node root   = hierarchy.add();
+        const sf::TransformHierarchy::Node child  = hierarchy.add(root);
+        const sf::TransformHierarchy::Node hidden = hierarchy.add();
+        hierarchy.setLocalBounds(root, {{0, 0}, {10, 10}});
+        hierarchy.setLocalBounds(child, {{0, 0}, {10, 10}});
+        hierarchy.setPosition(child, {1000, 0});
+
+        std::vector<sf::TransformHierarchy::Node> result;
+        hierarchy.query(sf::FloatRect({-50, -50}, {100, 100}), result);
+        CHECK(result == std::vector{root});
+
+        // Moving the parent moves the bounds of the child in the grid
+        hierarchy.setPosition(root, {-1000, 0});
+        result.clear();
+        hierarchy.query(sf::FloatRect({-50, -50}, {100, 100}), result);
+        CHECK(result == std::vector{child});
+
+        result.clear();
+        hierarchy.query(sf::View({-1000, 0}, {100, 100}), result);
+        CHECK(result == std::vector{root});
+        CHECK(std::find(result.begin(), result.end(), hidden) == result.end());
+    }
+}
@@ -0,0 +1,149 @@
+#include <SFML/Graphics/TransformPool.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Transformable.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::TransformPool")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TransformPool>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TransformPool>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TransformPool>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TransformPool>);
+    }
+
+    sf::TransformPool pool;
+
+    SECTION("Construction")
+    {
+        CHECK(pool.getSize() == 0);
+        CHECK(!pool.contains(0));
+    }
+
+    SECTION("add()")
+    {
+        const sf::TransformPool::Handle handle = pool.add();
+        CHECK(pool.getSize() == 1);
+        CHECK(pool.contains(handle));
+        CHECK(pool.getIndex(handle) == 0);
+        CHECK(pool.getHandle(0) == handle);
+        CHECK(pool.getPosition(handle) == sf::Vector2f(0, 0));
+        CHECK(pool.getRotation(handle) == sf::Angle::Zero);
+        CHECK(pool.getScale(handle) == sf::Vector2f(1, 1));
+        CHECK(pool.getOrigin(handle) == sf::Vector2f(0, 0));
+        CHECK(pool.getTransform(handle) == sf::Transform::Identity);
+    }
+
+    SECTION("Setters and getters")
+    {
+        const sf::TransformPool::Handle handle = pool.add();
+        pool.setPosition(handle, {1, 2});
+        pool.setRotation(handle, sf::degrees(-90));
+        pool.setScale(handle, {3, 4});
+        pool.setOrigin(handle, {5, 6});
+        CHECK(pool.getPosition(handle) == sf::Vector2f(1, 2));
+        CHECK(pool.getRotation(handle) == sf::degrees(270));
+        CHECK(pool.getScale(handle) == sf::Vector2f(3, 4));
+        CHECK(pool.getOrigin(handle) == sf::Vector2f(5, 6));
+    }
+
+    SECTION("remove()")
+    {
+        const sf::TransformPool::Handle first  = pool.add();
+        const sf::TransformPool::Handle second = pool.add();
+        const sf::TransformPool::Handle third  = pool.add();
+        pool.setPosition(third, {3, 3});
+
+        pool.remove(first);
+        CHECK(pool.getSize() == 2);
+        CHECK(!pool.contains(first));
+        CHECK(pool.getIndex(third) == 0);
+        CHECK(pool.getIndex(second) == 1);
+        CHECK(pool.getHandle(0) == third);
+        CHECK(pool.getPosition(third) == sf::Vector2f(3, 3));
+
+        CHECK(pool.add() == first);
+        CHECK(pool.getIndex(first) == 2);
+
+        pool.clear();
+        CHECK(pool.getSize() == 0);
+        CHECK(!pool.contains(second));
+    }
+
+    // Enough transforms to go through the vectorized loop and its remainder
+    std::vector<sf::Transformable> expected(11);
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        const auto                      value  = static_cast<float>(i);
+        const sf::TransformPool::Handle handle = pool.add();
+        expected[i].setPosition({value, 2 * value});
+        expected[i].setRotation(sf::degrees(30 * value));
+        expected[i].setScale({1 + value, 2 - value});
+        expected[i].setOrigin({value / 2, -value});
+        pool.setPosition(handle, expected[i].getPosition());
+        pool.setRotation(handle, expected[i].getRotation());
+        pool.setScale(handle, expected[i].getScale());
+        pool.setOrigin(handle, expected[i].getOrigin());
+    }
+
+    SECTION("getTransform()")
+    {
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            CHECK(pool.getTransform(pool.getHandle(i)) == Approx(expected[i].getTransform()));
+    }
+
+    SECTION("computeAll()")
+    {
+        SECTION("Packed matrices")
+        {
+            std::vector<float> matrices(expected.size() * sf::TransformPool::MatrixSize);
+            pool.computeAll(reinterpret_cast<std::byte*>(matrices.data()));
+            for (std::size_t i = 0; i < expected.size(); ++i)
+            {
+                const float* matrix = matrices.data() + i * sf::TransformPool::MatrixSize;
+                const float* other  = expected[i].getTransform().getMatrix();
+                CHECK(matrix[0] == Approx(other[0]));
+                CHECK(matrix[1] == Approx(other[1]));
+                CHECK(matrix[2] == Approx(other[4]));
+                CHECK(matrix[3] == Approx(other[5]));
+                CHECK(matrix[4] == Approx(other[12]));
+                CHECK(matrix[5] == Approx(other[13]));
+            }
+        }
+
+        SECTION("Interleaved matrices")
+        {
+            struct Instance
+            {
+                std::array<float, sf::TransformPool::MatrixSize> matrix;
+                float                                            depth;
+            };
+
+            std::vector<Instance> instances(expected.size(), {{}, 42.f});
+            pool.computeAll(reinterpret_cast<std::byte*>(instances.data()), sizeof(Instance));
+            for (std::size_t i = 0; i < expected.size(); ++i)
+            {
+                CHECK(instances[i].matrix[4] == Approx(expected[i].getTransform().getMatrix()[12]));
+                CHECK(instances[i].matrix[5] == Approx(expected[i].getTransform().getMatrix()[13]));
+                CHECK(instances[i].depth == 42.f);
+            }
+        }
+
+        SECTION("Transforms")
+        {
+            std::vector<sf::Transform> transforms;
+            pool.computeAll(transforms, sf::ExecutionPolicy::Parallel);
+            REQUIRE(transforms.size() == expected.size());
+            for (std::size_t i = 0; i < expected.size(); ++i)
+                CHECK(transforms[i] == Approx(expected[i].getTransform()));
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::UniformBuffer>);
+    }
+
+    // Skip tests if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::UniformBuffer uniformBuffer;
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Stream);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::UniformBuffer uniformBuffer(sf::UniformBuffer::Usage::Dynamic);
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+        }
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        const unsigned int handle = uniformBuffer.getNativeHandle();
+
+        const sf::UniformBuffer movedUniformBuffer(std::move(uniformBuffer));
+        CHECK(movedUniformBuffer.getSize() == 64);
+        CHECK(movedUniformBuffer.getNativeHandle() == handle);
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        const std::array<float, 8> values{1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f};
+
+        SECTION("Uninitialized buffer")
+        {
+            sf::UniformBuffer uniformBuffer;
+            CHECK(!uniformBuffer.update(values.data(), sizeof(values)));
+        }
+
+        SECTION("Initialized buffer")
+        {
+            sf::UniformBuffer uniformBuffer;
+            CHECK(uniformBuffer.create(sizeof(values)));
+            CHECK(!uniformBuffer.update(nullptr, sizeof(values)));
+            CHECK(!uniformBuffer.update(values.data(), sizeof(values), 4));
+            CHECK(uniformBuffer.update(values.data(), sizeof(values)));
+            CHECK(uniformBuffer.update(values.data(), sizeof(float) * 4, sizeof(float) * 4));
+            CHECK(uniformBuffer.getSize() == sizeof(values));
+        }
+    }
+
+    SECTION("swap()")
+    {
+        sf::UniformBuffer uniformBuffer1(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer1.create(16));
+
+        sf::UniformBuffer uniformBuffer2(sf::UniformBuffer::Usage::Static);
+        CHECK(uniformBuffer2.create(32));
+
+        sf::swap(uniformBuffer1, uniformBuffer2);
+
+        CHECK(uniformBuffer1.getSize() == 32);
+        CHECK(uniformBuffer1.getUsage() == sf::UniformBuffer::Usage::Static);
+
+        CHECK(uniformBuffer2.getSize() == 16);
+        CHECK(uniformBuffer2.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::UniformBuffer uniformBuffer;
+        uniformBuffer.setUsage(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+    }
+}
@@ -1,8 +1,11 @@
+#include <SFML/Graphics/CommandList.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <functional>
+#include <thread>
 #include <type_traits>
 
 TEST_CASE("[Graphics] sf::VertexArray")
@@ -91,6 +94,62 @@ TEST_CASE("[Graphics] sf::VertexArray")
         CHECK(vertexArray[9].texCoords == otherVertex.texCoords);
     }
 
+    SECTION("Generate instances")
+    {
+        const auto generator = [](std::size_t instance, sf::Vertex* vertices)
+        {
+            const auto offset = static_cast<float>(instance);
+            vertices[0]       = {{offset, 0}};
+            vertices[1]       = {{offset, 1}};
+            vertices[2]       = {{offset + 1, 0}};
+        };
+
+        sf::VertexArray vertexArray(sf::PrimitiveType::Triangles, 5);
+        vertexArray.generate(4, 3, generator);
+        CHECK(vertexArray.getVertexCount() == 12);
+        CHECK(vertexArray[0].position == sf::Vector2f(0, 0));
+        CHECK(vertexArray[10].position == sf::Vector2f(3, 1));
+        CHECK(vertexArray[11].position == sf::Vector2f(4, 0));
+        CHECK(vertexArray.getPrimitiveType() == sf::PrimitiveType::Triangles);
+
+        SECTION("Parallel")
+        {
+            // Enough vertices to be split in several ranges when the hardware allows it
+            constexpr std::size_t instanceCount = 100'000;
+
+            sf::VertexArray sequential;
+            sequential.generate(instanceCount, 3, generator);
+
+            sf::VertexArray parallel;
+            parallel.generate(instanceCount, 3, generator, sf::ExecutionPolicy::Parallel);
+
+            REQUIRE(parallel.getVertexCount() == sequential.getVertexCount());
+            bool identical = true;
+            for (std::size_t i = 0; i < sequential.getVertexCount(); ++i)
+                identical = identical && parallel[i].position == sequential[i].position;
+            CHECK(identical);
+
+            // A job scheduler receives the work instead of threads
+            std::size_t jobCount = 0;
+            sf::setJobScheduler(
+                [&jobCount](std::size_t count, const std::function<void(std::size_t)>& job)
+                {
+                    jobCount = count;
+                    for (std::size_t i = 0; i < count; ++i)
+                        job(i);
+                });
+
+            sf::VertexArray scheduled;
+            scheduled.generate(instanceCount, 3, generator, sf::ExecutionPolicy::Parallel);
+            sf::setJobScheduler({});
+
+            CHECK(scheduled.getVertexCount() == sequential.getVertexCount());
+            CHECK(scheduled[scheduled.getVertexCount() - 1].position ==
+                  sequential[sequential.getVertexCount() - 1].position);
+            CHECK((std::thread::hardware_concurrency() <= 1 || jobCount > 1));
+        }
+    }
+
     SECTION("Set primitive type")
     {
         sf::VertexArray vertexArray;
@@ -111,4 +170,96 @@ TEST_CASE("[Graphics] sf::VertexArray")
         vertexArray.append({{10, 10}});
         CHECK(vertexArray.getBounds() == sf::FloatRect({2, 2}, {8, 8}));
     }
+
+    SECTION("Cached bounds")
+    {
+        sf::VertexArray vertexArray;
+        vertexArray.append({{1, 1}});
+        CHECK(vertexArray.getBounds() == sf::FloatRect({1, 1}, {0, 0}));
+        vertexArray.append({{-1, 3}});
+        CHECK(vertexArray.getBounds() == sf::FloatRect({-1, 1}, {2, 2}));
+
+        // New vertices are at the origin
+        vertexArray.resize(3);
+        CHECK(vertexArray.getBounds() == sf::FloatRect({-1, 0}, {2, 3}));
+
+        // Removed vertices don't count anymore
+        vertexArray.resize(1);
+        CHECK(vertexArray.getBounds() == sf::FloatRect({1, 1}, {0, 0}));
+
+        // Reading the vertices through a const array keeps the bounds
+        const sf::VertexArray& constArray = vertexArray;
+        CHECK(constArray[0].position == sf::Vector2f(1, 1));
+        CHECK(vertexArray.getBounds() == sf::FloatRect({1, 1}, {0, 0}));
+
+        const auto generator = [](std::size_t instance, sf::Vertex* vertex)
+        { vertex->position = {4, static_cast<float>(instance)}; };
+        vertexArray.generate(2, 1, generator);
+        CHECK(vertexArray.getBounds() == sf::FloatRect({4, 0}, {0, 1}));
+
+        vertexArray.clear();
+        CHECK(vertexArray.getBounds() == sf::FloatRect());
+        vertexArray.append({{5, 6}});
+        CHECK(vertexArray.getBounds() == sf::FloatRect({5, 6}, {0, 0}));
+    }
+
+    SECTION("Chunks")
+    {
+        sf::VertexArray vertexArray(sf::PrimitiveType::Points);
+        CHECK(vertexArray.getChunkSize() == 0);
+        CHECK(vertexArray.getChunkCount() == 0);
+
+        for (int i = 0; i < 5; ++i)
+            vertexArray.append({{static_cast<float>(i * 100), 0}});
+        vertexArray.setChunkSize(2);
+        CHECK(vertexArray.getChunkSize() == 2);
+        REQUIRE(vertexArray.getChunkCount() == 3);
+        CHECK(vertexArray.getChunkBounds(0) == sf::FloatRect({0, 0}, {100, 0}));
+        CHECK(vertexArray.getChunkBounds(1) == sf::FloatRect({200, 0}, {100, 0}));
+        CHECK(vertexArray.getChunkBounds(2) == sf::FloatRect({400, 0}, {0, 0}));
+
+        vertexArray.append({{400, 50}});
+        CHECK(vertexArray.getChunkBounds(2) == sf::FloatRect({400, 0}, {0, 50}));
+        vertexArray.append({{600, 0}});
+        REQUIRE(vertexArray.getChunkCount() == 4);
+        CHECK(vertexArray.getChunkBounds(3) == sf::FloatRect({600, 0}, {0, 0}));
+
+        vertexArray[2].position = {250, 10};
+        CHECK(vertexArray.getChunkBounds(1) == sf::FloatRect({250, 0}, {50, 10}));
+        CHECK(vertexArray.getChunkBounds(0) == sf::FloatRect({0, 0}, {100, 0}));
+
+        vertexArray.resize(3);
+        REQUIRE(vertexArray.getChunkCount() == 2);
+        CHECK(vertexArray.getChunkBounds(1) == sf::FloatRect({250, 10}, {0, 0}));
+
+        vertexArray.setChunkSize(0);
+        CHECK(vertexArray.getChunkCount() == 0);
+    }
+
+    SECTION("Chunk culling")
+    {
+        sf::VertexArray vertexArray(sf::PrimitiveType::Points);
+        for (const float x : {10.f, 20.f, 1000.f, 1010.f, 30.f, 40.f})
+            vertexArray.append({{x, 10}});
+        vertexArray.setChunkSize(2);
+
+        sf::CommandList commandList({640, 480});
+
+        // Culling disabled, the array is drawn entirely
+        commandList.draw(vertexArray);
+        CHECK(commandList.getCommandCount() == 1);
+        CHECK(commandList.getStatistics().culledDraws == 0);
+
+        // The chunk outside of the view is skipped
+        commandList.setCullingEnabled(true);
+        commandList.draw(vertexArray);
+        CHECK(commandList.getCommandCount() == 3);
+        CHECK(commandList.getStatistics().culledDraws == 1);
+
+        // Strips are never split
+        vertexArray.setPrimitiveType(sf::PrimitiveType::LineStrip);
+        commandList.draw(vertexArray);
+        CHECK(commandList.getCommandCount() == 4);
+        CHECK(commandList.getStatistics().culledDraws == 1);
+    }
 }
@@ -9,6 +9,8 @@
 #include <array>
 #include <type_traits>
 
+#include <cstdint>
+
 // Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
 TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
 {
@@ -144,6 +146,54 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         }
     }
 
+    SECTION("map()")
+    {
+        sf::VertexBuffer vertexBuffer;
+        CHECK(!vertexBuffer.isMapped());
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(vertexBuffer.map(0, 1) == nullptr);
+            CHECK(!vertexBuffer.unmap());
+        }
+
+        CHECK(vertexBuffer.create(128));
+
+        SECTION("Invalid range")
+        {
+            CHECK(vertexBuffer.map(0, 0) == nullptr);
+            CHECK(vertexBuffer.map(100, 100) == nullptr);
+            CHECK(!vertexBuffer.isMapped());
+        }
+
+        SECTION("Whole buffer")
+        {
+            sf::Vertex* vertices = vertexBuffer.map(0, 128);
+            REQUIRE(vertices != nullptr);
+            CHECK(vertexBuffer.isMapped());
+            CHECK(vertexBuffer.map(0, 128) == nullptr);
+
+            for (std::size_t i = 0; i < 128; ++i)
+                vertices[i] = sf::Vertex{{static_cast<float>(i), 0}};
+
+            CHECK(vertexBuffer.unmap());
+            CHECK(!vertexBuffer.isMapped());
+            CHECK(!vertexBuffer.unmap());
+        }
+
+        SECTION("Range")
+        {
+            using MapMode = sf::VertexBuffer::MapMode;
+            for (const auto mode : {MapMode::Write, MapMode::Discard, MapMode::Unsynchronized})
+            {
+                sf::Vertex* vertices = vertexBuffer.map(64, 32, mode);
+                REQUIRE(vertices != nullptr);
+                vertices[31] = sf::Vertex{{1, 2}};
+                CHECK(vertexBuffer.unmap());
+            }
+        }
+    }
+
     SECTION("swap()")
     {
         sf::VertexBuffer vertexBuffer1(sf::PrimitiveType::LineStrip, sf::VertexBuffer::Usage::Dynamic);
@@ -178,4 +228,26 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         vertexBuffer.setUsage(sf::VertexBuffer::Usage::Dynamic);
         CHECK(vertexBuffer.getUsage() == sf::VertexBuffer::Usage::Dynamic);
     }
+
+    SECTION("Set/get layout")
+    {
+        using Type = sf::VertexLayout::Type;
+        const sf::VertexLayout layout(12, {Type::Int16, 2, 0}, {Type::UInt8, 4, 4, true}, {Type::Int16, 2, 8});
+
+        sf::VertexBuffer vertexBuffer;
+        CHECK(vertexBuffer.getLayout().isDefault());
+        CHECK(vertexBuffer.create(30));
+        vertexBuffer.setLayout(layout);
+        CHECK(vertexBuffer.getLayout().getStride() == 12);
+        CHECK(vertexBuffer.getVertexCount() == 50);
+
+        const std::array<std::int16_t, 6 * 4> vertices{};
+        CHECK(vertexBuffer.update(vertices.data(), 4, 0));
+        CHECK(!vertexBuffer.update(vertices.data(), 4, 48));
+        CHECK(vertexBuffer.getVertexCount() == 50);
+
+        const sf::VertexBuffer vertexBufferCopy(vertexBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(vertexBufferCopy.getLayout().getStride() == 12);
+        CHECK(vertexBufferCopy.getVertexCount() == 50);
+    }
 }
@@ -0,0 +1,76 @@
+#include <SFML/Graphics/VertexLayout.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+#include <cstddef>
+
+TEST_CASE("[Graphics] sf::VertexLayout")
+{
+    using Type = sf::VertexLayout::Type;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::VertexLayout>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::VertexLayout layout;
+            CHECK(layout.isDefault());
+            CHECK(layout.getStride() == sizeof(sf::Vertex));
+            CHECK(layout.getPosition().type == Type::Float);
+            CHECK(layout.getPosition().componentCount == 2);
+            CHECK(layout.getPosition().offset == offsetof(sf::Vertex, position));
+            CHECK(layout.getColor().type == Type::UInt8);
+            CHECK(layout.getColor().componentCount == 4);
+            CHECK(layout.getColor().offset == offsetof(sf::Vertex, color));
+            CHECK(layout.getColor().normalized);
+            CHECK(layout.getTexCoords().type == Type::Float);
+            CHECK(layout.getTexCoords().offset == offsetof(sf::Vertex, texCoords));
+            CHECK(layout.getCustomAttributes().empty());
+        }
+
+        SECTION("Attributes constructor")
+        {
+            const sf::VertexLayout layout(12, {Type::Int16, 2, 0}, {Type::UInt8, 4, 4, true}, {Type::Int16, 2, 8});
+            CHECK(!layout.isDefault());
+            CHECK(layout.getStride() == 12);
+            CHECK(layout.getPosition().type == Type::Int16);
+            CHECK(layout.getColor().offset == 4);
+            CHECK(layout.getTexCoords().type == Type::Int16);
+            CHECK(layout.getTexCoords().offset == 8);
+        }
+    }
+
+    SECTION("addAttribute()")
+    {
+        sf::VertexLayout layout(24, {Type::Float, 2, 0}, {Type::UInt8, 4, 8, true}, {Type::Float, 2, 12});
+        layout.addAttribute("light", {Type::UInt8, 4, 20, true});
+        CHECK(!layout.isDefault());
+        REQUIRE(layout.getCustomAttributes().size() == 1);
+        CHECK(layout.getCustomAttributes()[0].name == "light");
+        CHECK(layout.getCustomAttributes()[0].attribute.type == Type::UInt8);
+        CHECK(layout.getCustomAttributes()[0].attribute.componentCount == 4);
+        CHECK(layout.getCustomAttributes()[0].attribute.offset == 20);
+        CHECK(layout.getCustomAttributes()[0].attribute.normalized);
+    }
+
+    SECTION("getTypeSize()")
+    {
+        CHECK(sf::VertexLayout::getTypeSize(Type::Int8) == 1);
+        CHECK(sf::VertexLayout::getTypeSize(Type::UInt8) == 1);
+        CHECK(sf::VertexLayout::getTypeSize(Type::Int16) == 2);
+        CHECK(sf::VertexLayout::getTypeSize(Type::UInt16) == 2);
+        CHECK(sf::VertexLayout::getTypeSize(Type::Float) == 4);
+    }
+}
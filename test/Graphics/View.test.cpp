@@ -137,4 +137,13 @@ TEST_CASE("[Graphics] sf::View")
         CHECK(view.getTransform() == Approx(sf::Transform(0.02f, 0, -10, 0, -0.02f, 10, 0, 0, 1)));
         CHECK(view.getInverseTransform() == Approx(sf::Transform(50, 0, 500, 0, -50, 500, 0, 0, 1)));
     }
+
+    SECTION("getVisibleArea()")
+    {
+        sf::View view({10, 20}, {100, 50});
+        CHECK(view.getVisibleArea() == Approx(sf::FloatRect({-40, -5}, {100, 50})));
+
+        view.setRotation(sf::degrees(90));
+        CHECK(view.getVisibleArea() == Approx(sf::FloatRect({-15, -30}, {50, 100})));
+    }
 }
@@ -0,0 +1,135 @@
+#include <SFML/Graphics/VirtualTexture.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <filesystem>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::VirtualTexture", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::VirtualTexture>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::VirtualTexture>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::VirtualTexture virtualTexture;
+        CHECK(virtualTexture.getSize() == sf::Vector2u());
+        CHECK(virtualTexture.getLevelCount() == 0);
+        CHECK(virtualTexture.getCacheCapacity() == 144);
+        CHECK(virtualTexture.getUploadLimit() == 4);
+        CHECK(virtualTexture.isSmooth());
+        CHECK(virtualTexture.getResidentTileCount() == 0);
+        CHECK(virtualTexture.getPendingTileCount() == 0);
+        CHECK(virtualTexture.getLocalBounds() == sf::FloatRect());
+    }
+
+    // 300x200 image whose pixels all differ from their neighbors
+    sf::Image image({300, 200});
+    for (unsigned int y = 0; y < 200; ++y)
+        for (unsigned int x = 0; x < 300; ++x)
+            image.setPixel({x, y}, sf::Color(static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y), 0));
+
+    const std::filesystem::path imagePath = std::filesystem::temp_directory_path() / "sfmlvirtualtexture.qoi";
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfmlvirtualtexture";
+    REQUIRE(image.saveToFile(imagePath));
+    std::filesystem::remove_all(directory);
+
+    SECTION("buildPyramid()")
+    {
+        CHECK(!sf::VirtualTexture::buildPyramid("does/not/exist.qoi", directory));
+        CHECK(!sf::VirtualTexture::buildPyramid(imagePath, directory, 0));
+        REQUIRE(sf::VirtualTexture::buildPyramid(imagePath, directory, 64));
+
+        // 5x4 tiles, then 3x2 (150x100), 2x1 (75x50) and a single one (38x25)
+        CHECK(std::filesystem::exists(directory / "pyramid.txt"));
+        CHECK(std::filesystem::exists(directory / "0" / "4_3.qoi"));
+        CHECK(std::filesystem::exists(directory / "1" / "2_1.qoi"));
+        CHECK(std::filesystem::exists(directory / "2" / "1_0.qoi"));
+        CHECK(!std::filesystem::exists(directory / "4"));
+
+        const auto corner = sf::Image::loadFromFile(directory / "0" / "4_3.qoi").value();
+        CHECK(corner.getSize() == sf::Vector2u(44, 8));
+        CHECK(corner.getPixel({0, 0}) == image.getPixel({256, 192}));
+
+        const auto root = sf::Image::loadFromFile(directory / "3" / "0_0.qoi").value();
+        CHECK(root.getSize() == sf::Vector2u(38, 25));
+        CHECK(root.getPixel({0, 0}) == sf::Color(4, 4, 0));
+    }
+
+    SECTION("open()")
+    {
+        sf::VirtualTexture virtualTexture;
+        CHECK(!virtualTexture.open(directory));
+
+        REQUIRE(sf::VirtualTexture::buildPyramid(imagePath, directory, 64));
+        REQUIRE(virtualTexture.open(directory));
+        CHECK(virtualTexture.getSize() == sf::Vector2u(300, 200));
+        CHECK(virtualTexture.getTileSize() == 64);
+        CHECK(virtualTexture.getLevelCount() == 4);
+        CHECK(virtualTexture.getResidentTileCount() == 1);
+        CHECK(virtualTexture.getLocalBounds() == sf::FloatRect({0, 0}, {300, 200}));
+
+        virtualTexture.setPosition({10, 20});
+        CHECK(virtualTexture.getGlobalBounds() == sf::FloatRect({10, 20}, {300, 200}));
+    }
+
+    SECTION("draw()")
+    {
+        REQUIRE(sf::VirtualTexture::buildPyramid(imagePath, directory, 64));
+
+        sf::VirtualTexture virtualTexture;
+        REQUIRE(virtualTexture.open(directory));
+        virtualTexture.setSmooth(false);
+        virtualTexture.setUploadLimit(8);
+
+        // Draw until all the visible tiles are loaded
+        auto       target = sf::RenderTexture::create({300, 200}).value();
+        const auto render = [&]
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                target.clear();
+                target.draw(virtualTexture);
+                if (virtualTexture.getPendingTileCount() == 0)
+                    break;
+
+                sf::sleep(sf::milliseconds(1));
+            }
+        };
+
+        render();
+
+        CHECK(virtualTexture.getPendingTileCount() == 0);
+        CHECK(virtualTexture.getResidentTileCount() == 21);
+
+        target.display();
+        const sf::Image result = target.getTexture().copyToImage();
+        CHECK(result.getPixel({0, 0}) == image.getPixel({0, 0}));
+        CHECK(result.getPixel({63, 63}) == image.getPixel({63, 63}));
+        CHECK(result.getPixel({64, 64}) == image.getPixel({64, 64}));
+        CHECK(result.getPixel({150, 100}) == image.getPixel({150, 100}));
+        CHECK(result.getPixel({299, 199}) == image.getPixel({299, 199}));
+
+        // Zooming out displays the coarser levels, which are only 3 tiles here
+        target.setView(sf::View({150, 100}, {1200, 800}));
+        render();
+
+        CHECK(virtualTexture.getPendingTileCount() == 0);
+        CHECK(virtualTexture.getResidentTileCount() == 23);
+    }
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::remove(imagePath);
+}
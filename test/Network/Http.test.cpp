@@ -1,7 +1,13 @@
 #include <SFML/Network/Http.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <string>
+#include <thread>
 #include <type_traits>
 
 TEST_CASE("[Network] sf::Http")
@@ -45,4 +51,88 @@ TEST_CASE("[Network] sf::Http")
             CHECK(response.getBody().empty());
         }
     }
+
+    SECTION("sendRequest()")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // Minimal server answering 4 requests, closing the connection when asked to
+        int         connections = 0;
+        std::thread server(
+            [&]
+            {
+                int requests = 0;
+                while (requests < 4)
+                {
+                    sf::TcpSocket connection;
+                    if (listener.accept(connection) != sf::Socket::Status::Done)
+                        return;
+
+                    ++connections;
+                    std::string received;
+                    while (requests < 4)
+                    {
+                        char        buffer[256];
+                        std::size_t size = 0;
+                        if (connection.receive(buffer, sizeof(buffer), size) != sf::Socket::Status::Done)
+                            break;
+
+                        received.append(buffer, size);
+                        const std::size_t end = received.find("\r\n\r\n");
+                        if (end == std::string::npos)
+                            continue;
+
+                        const std::string request = received.substr(0, end);
+                        received.erase(0, end + 4);
+                        ++requests;
+
+                        std::string response;
+                        if (request.find("GET /chunked") == 0)
+                            response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                                       "5\r\nhello\r\n6;name=value\r\n world\r\n0\r\nX-Trailer: yes\r\n\r\n";
+                        else if (request.find("GET /close") == 0)
+                            response = "HTTP/1.1 200 OK\r\nConnection: close\r\n\r\nbye";
+                        else
+                            response = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+
+                        if (connection.send(response.data(), response.size()) != sf::Socket::Status::Done ||
+                            request.find("GET /close") == 0)
+                            break;
+                    }
+                }
+            });
+
+        sf::Http          http("127.0.0.1", listener.getLocalPort());
+        sf::Http::Request request("/length");
+        request.setHttpVersion(1, 1);
+
+        sf::Http::Response response = http.sendRequest(request);
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody() == "hello");
+
+        std::string body;
+        request.setUri("/chunked");
+        response = http.sendRequest(request,
+                                    [&body](const char* data, std::size_t size)
+                                    {
+                                        body.append(data, size);
+                                        return true;
+                                    });
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody().empty());
+        CHECK(response.getField("x-trailer") == "yes");
+        CHECK(body == "hello world");
+
+        request.setUri("/close");
+        response = http.sendRequest(request);
+        CHECK(response.getBody() == "bye");
+
+        request.setUri("/length");
+        response = http.sendRequest(request);
+        CHECK(response.getBody() == "hello");
+
+        server.join();
+        CHECK(connections == 2);
+    }
 }
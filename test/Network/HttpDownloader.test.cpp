@@ -0,0 +1,237 @@
+#include <SFML/Network/HttpDownloader.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Minimal server answering HEAD and ranged GET requests for a single file, on any number of connections
+class FileServer
+{
+public:
+    explicit FileServer(std::string file) : m_file(std::move(file))
+    {
+        [[maybe_unused]] const auto status = m_listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost);
+        m_listener.setBlocking(false);
+        m_thread = std::thread(
+            [this]
+            {
+                std::list<std::thread> connections;
+                while (!m_stopped)
+                {
+                    auto connection = std::make_unique<sf::TcpSocket>();
+                    if (m_listener.accept(*connection) == sf::Socket::Status::Done)
+                        connections.emplace_back([this, socket = std::move(connection)] { serve(*socket); });
+                    else
+                        sf::sleep(sf::milliseconds(1));
+                }
+
+                for (std::thread& thread : connections)
+                    thread.join();
+            });
+    }
+
+    ~FileServer()
+    {
+        m_stopped = true;
+        m_thread.join();
+    }
+
+    unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    void setETag(std::string etag)
+    {
+        const std::lock_guard lock(m_mutex);
+        m_etag = std::move(etag);
+    }
+
+    std::atomic<int> rangeRequests{};
+
+private:
+    void serve(sf::TcpSocket& connection)
+    {
+        connection.setBlocking(false);
+        std::string received;
+        while (!m_stopped)
+        {
+            char        buffer[256];
+            std::size_t size   = 0;
+            const auto  status = connection.receive(buffer, sizeof(buffer), size);
+            if (status == sf::Socket::Status::NotReady)
+            {
+                sf::sleep(sf::milliseconds(1));
+                continue;
+            }
+
+            if (status != sf::Socket::Status::Done)
+                return;
+
+            received.append(buffer, size);
+            const std::size_t end = received.find("\r\n\r\n");
+            if (end == std::string::npos)
+                continue;
+
+            // Field names are sent in lower case by sf::Http
+            const std::string request = received.substr(0, end);
+            received.erase(0, end + 4);
+
+            const std::lock_guard lock(m_mutex);
+            std::string           response;
+            const std::size_t     range = request.find("\nrange: bytes=");
+            if (request.find("HEAD") == 0)
+            {
+                response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(m_file.size()) +
+                           "\r\nAccept-Ranges: bytes\r\nETag: " + m_etag + "\r\n\r\n";
+            }
+            else if ((range != std::string::npos) && (request.find("if-range: " + m_etag + "\r") != std::string::npos))
+            {
+                ++rangeRequests;
+                std::size_t       length = 0;
+                const std::size_t first  = std::stoul(request.substr(range + 14), &length);
+                const std::size_t last   = std::stoul(request.substr(range + 15 + length));
+                response = "HTTP/1.1 206 Partial Content\r\nContent-Length: " + std::to_string(last - first + 1) +
+                           "\r\n\r\n" + m_file.substr(first, last - first + 1);
+            }
+            else
+            {
+                response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(m_file.size()) + "\r\n\r\n" + m_file;
+            }
+
+            connection.setBlocking(true);
+            if (connection.send(response.data(), response.size()) != sf::Socket::Status::Done)
+                return;
+            connection.setBlocking(false);
+        }
+    }
+
+    const std::string m_file;
+    std::string       m_etag{"\"1\""};
+    std::mutex        m_mutex;
+    sf::TcpListener   m_listener;
+    std::atomic<bool> m_stopped{};
+    std::thread       m_thread;
+};
+
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("[Network] sf::HttpDownloader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::HttpDownloader>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::HttpDownloader>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::HttpDownloader>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::HttpDownloader>);
+    }
+
+    SECTION("computeHash()")
+    {
+        CHECK(sf::HttpDownloader::computeHash(nullptr, 0) == 14695981039346656037u);
+        CHECK(sf::HttpDownloader::computeHash("a", 1) == 0xAF63DC4C8601EC8Cu);
+    }
+
+    std::string contents;
+    for (int i = 0; i < 1000; ++i)
+        contents += std::to_string(i) + ',';
+
+    const std::filesystem::path path       = std::filesystem::temp_directory_path() / "sfmldownloadtest.txt";
+    std::filesystem::path       resumePath = path;
+    resumePath += ".resume";
+    std::filesystem::remove(resumePath);
+
+    FileServer         server(contents);
+    sf::HttpDownloader downloader("127.0.0.1", server.getPort());
+    downloader.setChunkSize(1000);
+    downloader.setTimeout(sf::seconds(10));
+
+    SECTION("download()")
+    {
+        std::uint64_t lastDownloaded = 0;
+        CHECK(downloader.download("/file",
+                                  path,
+                                  [&](std::uint64_t downloaded, std::uint64_t total)
+                                  {
+                                      lastDownloaded = downloaded;
+                                      return total == contents.size();
+                                  }));
+        CHECK(readFile(path) == contents);
+        CHECK(lastDownloaded == contents.size());
+        CHECK(server.rangeRequests == 4);
+        CHECK(!std::filesystem::exists(resumePath));
+    }
+
+    SECTION("Chunk hashes")
+    {
+        std::vector<std::uint64_t> hashes;
+        for (std::size_t i = 0; i < contents.size(); i += 1000)
+        {
+            const std::size_t size = std::min<std::size_t>(1000, contents.size() - i);
+            hashes.push_back(sf::HttpDownloader::computeHash(contents.data() + i, size));
+        }
+
+        downloader.setChunkHashes(hashes);
+        CHECK(downloader.download("/file", path));
+        CHECK(readFile(path) == contents);
+
+        hashes[1] ^= 1;
+        downloader.setChunkHashes(hashes);
+        CHECK(!downloader.download("/file", path));
+
+        hashes.pop_back();
+        downloader.setChunkHashes(hashes);
+        CHECK(!downloader.download("/file", path));
+    }
+
+    SECTION("Resume")
+    {
+        // Cancel after the first chunk
+        downloader.setConnectionCount(1);
+        CHECK(!downloader.download("/file", path, [](std::uint64_t, std::uint64_t) { return false; }));
+        CHECK(server.rangeRequests == 1);
+        CHECK(std::filesystem::exists(resumePath));
+
+        downloader.setConnectionCount(4);
+        CHECK(downloader.download("/file", path));
+        CHECK(readFile(path) == contents);
+        CHECK(server.rangeRequests == 4);
+        CHECK(!std::filesystem::exists(resumePath));
+
+        // A new version of the file on the server is downloaded from scratch
+        downloader.setConnectionCount(1);
+        CHECK(!downloader.download("/file", path, [](std::uint64_t, std::uint64_t) { return false; }));
+        server.setETag("\"2\"");
+        downloader.setConnectionCount(4);
+        CHECK(downloader.download("/file", path));
+        CHECK(readFile(path) == contents);
+        CHECK(server.rangeRequests == 9);
+    }
+
+    std::filesystem::remove(path);
+}
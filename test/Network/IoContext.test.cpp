@@ -0,0 +1,151 @@
+#include <SFML/Network/IoContext.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <optional>
+#include <string>
+#include <type_traits>
+
+TEST_CASE("[Network] sf::IoContext")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::IoContext>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::IoContext>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::IoContext>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::IoContext>);
+    }
+
+    sf::IoContext context;
+
+    SECTION("Construction")
+    {
+        CHECK(!context.isStopped());
+        CHECK(context.run() == 0);
+        CHECK(context.poll() == 0);
+    }
+
+    SECTION("post()")
+    {
+        int calls = 0;
+        context.post([&] { context.post([&] { ++calls; }); });
+        CHECK(context.run() == 2);
+        CHECK(calls == 1);
+    }
+
+    SECTION("asyncWait()")
+    {
+        const sf::Clock clock;
+        bool            expired   = false;
+        bool            cancelled = false;
+        context.asyncWait(sf::milliseconds(20), [&] { expired = true; });
+        const sf::TimerWheel::Id timer = context.asyncWait(sf::milliseconds(10), [&] { cancelled = true; });
+        CHECK(context.cancelWait(timer));
+        CHECK(!context.cancelWait(timer));
+
+        CHECK(context.run() == 1);
+        CHECK(expired);
+        CHECK(!cancelled);
+        CHECK(clock.getElapsedTime() >= sf::milliseconds(20));
+    }
+
+    SECTION("stop()")
+    {
+        int calls = 0;
+        context.post([&] { ++calls; });
+        context.stop();
+        CHECK(context.isStopped());
+        CHECK(context.run() == 0);
+        CHECK(calls == 0);
+
+        context.restart();
+        CHECK(!context.isStopped());
+        CHECK(context.poll() == 1);
+        CHECK(calls == 1);
+    }
+
+    SECTION("UDP")
+    {
+        sf::UdpSocket receiver;
+        sf::UdpSocket sender;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        char                         buffer[16]{};
+        std::size_t                  received = 0;
+        std::optional<sf::IpAddress> remoteAddress;
+        std::size_t                  sent = 0;
+        context.asyncReceive(receiver,
+                             buffer,
+                             sizeof(buffer),
+                             [&](sf::Socket::Status           status,
+                                 std::size_t                  size,
+                                 std::optional<sf::IpAddress> address,
+                                 unsigned short)
+                             {
+                                 CHECK(status == sf::Socket::Status::Done);
+                                 received      = size;
+                                 remoteAddress = address;
+                             });
+
+        const char data[] = "data";
+        context.asyncSend(sender,
+                          data,
+                          sizeof(data),
+                          sf::IpAddress::LocalHost,
+                          receiver.getLocalPort(),
+                          [&](sf::Socket::Status status, std::size_t size)
+                          {
+                              CHECK(status == sf::Socket::Status::Done);
+                              sent = size;
+                          });
+
+        CHECK(context.run() == 2);
+        CHECK(sent == sizeof(data));
+        CHECK(received == sizeof(data));
+        CHECK(remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(std::string(buffer) == "data");
+        CHECK(!receiver.isBlocking());
+    }
+
+    SECTION("TCP")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket server;
+        sf::TcpSocket client;
+        sf::Packet    received;
+        std::string   message;
+        context.asyncAccept(listener,
+                            server,
+                            [&](sf::Socket::Status status)
+                            {
+                                REQUIRE(status == sf::Socket::Status::Done);
+                                context.asyncReceive(server,
+                                                     received,
+                                                     [&](sf::Socket::Status receiveStatus)
+                                                     {
+                                                         CHECK(receiveStatus == sf::Socket::Status::Done);
+                                                         CHECK(received >> message);
+                                                     });
+                            });
+
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+
+        sf::Packet packet;
+        packet << std::string(100'000, 'x');
+        context.asyncSend(client, packet, [](sf::Socket::Status status) { CHECK(status == sf::Socket::Status::Done); });
+
+        CHECK(context.run() == 3);
+        CHECK(message == std::string(100'000, 'x'));
+    }
+}
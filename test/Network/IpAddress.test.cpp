@@ -2,6 +2,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <chrono>
+#include <future>
 #include <sstream>
 #include <string_view>
 #include <type_traits>
@@ -53,11 +56,60 @@ TEST_CASE("[Network] sf::IpAddress")
             CHECK(!sf::IpAddress::resolve("").has_value());
         }
 
+        SECTION("static 'resolveAsync' function")
+        {
+            auto decimal = sf::IpAddress::resolveAsync("203.0.113.2");
+            REQUIRE(decimal.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            CHECK(decimal.get() == sf::IpAddress(203, 0, 113, 2));
+
+            sf::IpAddress::setResolveCacheDuration(sf::Time::Zero);
+            CHECK(sf::IpAddress::resolveAsync("localhost").get() == sf::IpAddress::LocalHost);
+            CHECK(!sf::IpAddress::resolveAsync("255.255.255.256").get().has_value());
+            CHECK(!sf::IpAddress::resolveAsync("").get().has_value());
+
+            sf::IpAddress::setResolveCacheDuration(sf::seconds(30));
+            CHECK(sf::IpAddress::resolve("localhost").has_value());
+            auto cached = sf::IpAddress::resolveAsync("localhost");
+            REQUIRE(cached.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            CHECK(cached.get() == sf::IpAddress::LocalHost);
+        }
+
+        SECTION("IPv6 addresses")
+        {
+            const auto ipAddress = sf::IpAddress::resolve("2001:DB8:0:0:1:0:0:1"sv);
+            REQUIRE(ipAddress.has_value());
+            CHECK(ipAddress->getType() == sf::IpAddress::Type::V6);
+            CHECK(ipAddress->toString() == "2001:db8::1:0:0:1"s);
+            CHECK(ipAddress->toBytes()[0] == 0x20);
+            CHECK(ipAddress->toBytes()[15] == 0x01);
+
+            CHECK(sf::IpAddress::resolve("::"sv) == sf::IpAddress::AnyV6);
+            CHECK(sf::IpAddress::resolve("::1"sv) == sf::IpAddress::LocalHostV6);
+            CHECK(sf::IpAddress::resolve("fe80:0:0:0:abcd:0:0:0"sv)->toString() == "fe80::abcd:0:0:0"s);
+            CHECK(sf::IpAddress::resolve("1:0:2:0:3:0:4:0"sv)->toString() == "1:0:2:0:3:0:4:0"s);
+            CHECK(sf::IpAddress::resolve("::ffff:192.0.2.1"sv) == sf::IpAddress(192, 0, 2, 1));
+
+            CHECK(!sf::IpAddress::resolve("2001:db8:::1"sv).has_value());
+            CHECK(!sf::IpAddress::resolve("2001:db8::g"sv).has_value());
+        }
+
         SECTION("Byte constructor")
         {
             const sf::IpAddress ipAddress(198, 51, 100, 234);
             CHECK(ipAddress.toString() == "198.51.100.234"s);
             CHECK(ipAddress.toInteger() == 0xC63364EA);
+            CHECK(ipAddress.getType() == sf::IpAddress::Type::V4);
+            CHECK(ipAddress.toBytes() ==
+                  std::array<std::uint8_t, 16>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 198, 51, 100, 234});
+        }
+
+        SECTION("16 bytes constructor")
+        {
+            const std::array<std::uint8_t, 16> bytes{0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x12, 0x34};
+            const sf::IpAddress                ipAddress(bytes);
+            CHECK(ipAddress.getType() == sf::IpAddress::Type::V6);
+            CHECK(ipAddress.toString() == "2001:db8::1234"s);
+            CHECK(ipAddress.toBytes() == bytes);
         }
 
         SECTION("std::uint32_t constructor")
@@ -99,6 +151,12 @@ TEST_CASE("[Network] sf::IpAddress")
 
         CHECK(sf::IpAddress::Broadcast.toString() == "255.255.255.255"s);
         CHECK(sf::IpAddress::Broadcast.toInteger() == 0xFFFFFFFF);
+
+        CHECK(sf::IpAddress::AnyV6.toString() == "::"s);
+        CHECK(sf::IpAddress::AnyV6.getType() == sf::IpAddress::Type::V6);
+
+        CHECK(sf::IpAddress::LocalHostV6.toString() == "::1"s);
+        CHECK(sf::IpAddress::LocalHostV6.getType() == sf::IpAddress::Type::V6);
     }
 
     SECTION("Operators")
@@ -123,6 +181,8 @@ TEST_CASE("[Network] sf::IpAddress")
             CHECK(sf::IpAddress(0, 1, 0, 0) < sf::IpAddress(0, 0, 1, 0));
             CHECK(sf::IpAddress(0, 0, 1, 0) < sf::IpAddress(0, 0, 0, 1));
             CHECK(sf::IpAddress(0, 0, 0, 1) < sf::IpAddress(1, 0, 0, 1));
+            CHECK(sf::IpAddress::Broadcast < sf::IpAddress::AnyV6);
+            CHECK(sf::IpAddress::AnyV6 < sf::IpAddress::LocalHostV6);
         }
 
         SECTION("operator>")
@@ -0,0 +1,148 @@
+#include <SFML/Network/NetworkStats.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Network] sf::NetworkStats")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::NetworkStats>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::NetworkStats>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::NetworkStats>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::NetworkStats>);
+        STATIC_CHECK(std::is_aggregate_v<sf::NetworkStats>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::NetworkStats stats;
+        CHECK(stats.bytesSent == 0);
+        CHECK(stats.bytesReceived == 0);
+        CHECK(stats.packetsSent == 0);
+        CHECK(stats.packetsReceived == 0);
+        CHECK(stats.systemCalls == 0);
+        CHECK(stats.partialSends == 0);
+        CHECK(stats.selectorWaitTime == sf::Time::Zero);
+        for (const std::uint64_t bucket : stats.receiveLatency)
+            CHECK(bucket == 0);
+    }
+
+    SECTION("getLatencyBucket()")
+    {
+        CHECK(sf::NetworkStats::getLatencyBucket(sf::Time::Zero) == 0);
+        CHECK(sf::NetworkStats::getLatencyBucket(sf::microseconds(1)) == 0);
+        CHECK(sf::NetworkStats::getLatencyBucket(sf::microseconds(2)) == 1);
+        CHECK(sf::NetworkStats::getLatencyBucket(sf::microseconds(3)) == 1);
+        CHECK(sf::NetworkStats::getLatencyBucket(sf::microseconds(1024)) == 10);
+        CHECK(sf::NetworkStats::getLatencyBucket(sf::seconds(3600)) == sf::NetworkStats::LatencyBucketCount - 1);
+    }
+
+    SECTION("Disabled by default")
+    {
+        CHECK(!sf::NetworkStats::isEnabled());
+
+        sf::UdpSocket socket;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const char data[] = "data";
+        REQUIRE(socket.send(data, sizeof(data), sf::IpAddress::LocalHost, socket.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        CHECK(socket.getStats().bytesSent == 0);
+        CHECK(socket.getStats().systemCalls == 0);
+    }
+
+    SECTION("Collection")
+    {
+        sf::NetworkStats::setEnabled(true);
+        sf::NetworkStats::resetGlobal();
+        CHECK(sf::NetworkStats::isEnabled());
+
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        SECTION("TCP packets")
+        {
+            sf::Packet packet;
+            packet << std::string(1000, 'x');
+            REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+            const std::size_t size = sizeof(std::uint32_t) + packet.getDataSize();
+
+            sf::SocketSelector selector;
+            selector.add(server);
+            CHECK(selector.wait(sf::seconds(1)));
+
+            sf::Packet received;
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+
+            const sf::NetworkStats clientStats = client.getStats();
+            CHECK(clientStats.bytesSent == size);
+            CHECK(clientStats.packetsSent == 1);
+            CHECK(clientStats.systemCalls >= 1);
+            CHECK(clientStats.bytesReceived == 0);
+
+            const sf::NetworkStats serverStats = server.getStats();
+            CHECK(serverStats.bytesReceived == size);
+            CHECK(serverStats.packetsReceived == 1);
+            std::uint64_t latencies = 0;
+            for (const std::uint64_t bucket : serverStats.receiveLatency)
+                latencies += bucket;
+            CHECK(latencies == 1);
+
+            const sf::NetworkStats global = sf::NetworkStats::getGlobal();
+            CHECK(global.bytesSent == size);
+            CHECK(global.bytesReceived == size);
+            CHECK(global.packetsSent == 1);
+            CHECK(global.packetsReceived == 1);
+            CHECK(global.systemCalls == clientStats.systemCalls + serverStats.systemCalls);
+
+            server.resetStats();
+            CHECK(server.getStats().bytesReceived == 0);
+            CHECK(sf::NetworkStats::getGlobal().bytesReceived == size);
+        }
+
+        SECTION("Partial sends")
+        {
+            REQUIRE(client.setOption(sf::Socket::Option::SendBufferSize, 4096));
+            client.setBlocking(false);
+
+            std::size_t partialSent = 0;
+            std::size_t partialSize = 0;
+            client.setPartialSendCallback(
+                [&](std::size_t sent, std::size_t size)
+                {
+                    partialSent = sent;
+                    partialSize = size;
+                });
+
+            // The server doesn't read anything, so the buffers end up full
+            const std::vector<char> data(16 * 1024 * 1024, 'x');
+            std::size_t             sent = 0;
+            REQUIRE(client.send(data.data(), data.size(), sent) == sf::Socket::Status::Partial);
+            CHECK(partialSent == sent);
+            CHECK(partialSize == data.size());
+            CHECK(client.getStats().partialSends == 1);
+            CHECK(client.getStats().bytesSent == sent);
+            CHECK(sf::NetworkStats::getGlobal().partialSends == 1);
+        }
+
+        sf::NetworkStats::setEnabled(false);
+    }
+}
@@ -1,16 +1,21 @@
 #include <SFML/Network/Packet.hpp>
 
 // Other 1st party headers
+#include <SFML/System/MemoryStats.hpp>
 #include <SFML/System/String.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <initializer_list>
 #include <limits>
+#include <string>
 #include <type_traits>
 #include <vector>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <cwchar>
 
 #define CHECK_PACKET_STREAM_OPERATORS(expected)              \
@@ -97,10 +102,36 @@ TEST_CASE("[Network] sf::Packet")
         CHECK(packet.getReadPosition() == 0);
         CHECK(packet.getData() == nullptr);
         CHECK(packet.getDataSize() == 0);
+        CHECK(packet.getCapacity() >= data.size());
         CHECK(packet.endOfPacket());
         CHECK(bool{packet});
     }
 
+    SECTION("reserve()")
+    {
+        sf::Packet packet;
+        packet.reserve(100);
+        CHECK(packet.getCapacity() >= 100);
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.getData() == nullptr);
+    }
+
+    SECTION("Memory statistics")
+    {
+        constexpr auto                    category = sf::MemoryStats::Category::Packet;
+        const sf::MemoryStats::Statistics before   = sf::MemoryStats::getStatistics(category);
+        {
+            sf::Packet packet;
+            CHECK(sf::MemoryStats::getStatistics(category).objectCount == before.objectCount + 1);
+
+            packet << std::uint32_t{1} << std::string(100, 'a');
+            CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes + packet.getCapacity());
+        }
+
+        CHECK(sf::MemoryStats::getStatistics(category).objectCount == before.objectCount);
+        CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes);
+    }
+
     SECTION("Network ordering")
     {
         sf::Packet packet;
@@ -268,6 +299,181 @@ TEST_CASE("[Network] sf::Packet")
         }
     }
 
+    SECTION("appendArray()/extractArray()")
+    {
+        const std::array<std::int32_t, 3> integers = {-1, 0, std::numeric_limits<std::int32_t>::max()};
+        const std::array<double, 2>       doubles  = {0.5, -1e300};
+
+        sf::Packet packet;
+        packet.appendArray(integers.data(), integers.size());
+        packet.appendArray(doubles.data(), doubles.size());
+        CHECK(packet.getDataSize() == sizeof(integers) + sizeof(doubles));
+
+        // Arrays use the same format as the individual values
+        std::int32_t first = 0;
+        CHECK(packet >> first);
+        CHECK(first == -1);
+
+        std::array<std::int32_t, 2> otherIntegers{};
+        std::array<double, 2>       otherDoubles{};
+        CHECK(packet.extractArray(otherIntegers.data(), otherIntegers.size()));
+        CHECK(packet.extractArray(otherDoubles.data(), otherDoubles.size()));
+        CHECK(otherIntegers[1] == std::numeric_limits<std::int32_t>::max());
+        CHECK(otherDoubles == doubles);
+        CHECK(packet.endOfPacket());
+
+        CHECK(!packet.extractArray(otherIntegers.data(), 1));
+    }
+
+    SECTION("Variable-length integers")
+    {
+        sf::Packet packet;
+        packet.appendVarUInt(0);
+        packet.appendVarUInt(127);
+        packet.appendVarUInt(128);
+        packet.appendVarUInt(std::numeric_limits<std::uint64_t>::max());
+        packet.appendVarInt(-1);
+        packet.appendVarInt(std::numeric_limits<std::int64_t>::min());
+        CHECK(packet.getDataSize() == 1 + 1 + 2 + 10 + 1 + 10);
+
+        std::uint64_t unsignedValue = 0;
+        std::int64_t  signedValue   = 0;
+        CHECK(packet.extractVarUInt(unsignedValue));
+        CHECK(unsignedValue == 0);
+        CHECK(packet.extractVarUInt(unsignedValue));
+        CHECK(unsignedValue == 127);
+        CHECK(packet.extractVarUInt(unsignedValue));
+        CHECK(unsignedValue == 128);
+        CHECK(packet.extractVarUInt(unsignedValue));
+        CHECK(unsignedValue == std::numeric_limits<std::uint64_t>::max());
+        CHECK(packet.extractVarInt(signedValue));
+        CHECK(signedValue == -1);
+        CHECK(packet.extractVarInt(signedValue));
+        CHECK(signedValue == std::numeric_limits<std::int64_t>::min());
+        CHECK(!packet.extractVarUInt(unsignedValue));
+
+        SECTION("Overflow")
+        {
+            // The 10th byte may only hold the 64th bit
+            const std::array<std::uint8_t, 10> bytes{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+            sf::Packet                         overflow;
+            overflow.append(bytes.data(), bytes.size());
+            CHECK(!overflow.extractVarUInt(unsignedValue));
+        }
+    }
+
+    SECTION("UTF-8 strings")
+    {
+        const sf::String string = U"Hello \u00e9\U0001F600";
+
+        sf::Packet packet;
+        packet.appendUtf8(string);
+        CHECK(packet.getDataSize() == 1 + 6 + 2 + 4);
+
+        sf::String extracted;
+        CHECK(packet.extractUtf8(extracted));
+        CHECK(extracted == string);
+        CHECK(!packet.extractUtf8(extracted));
+
+        SECTION("Malformed data")
+        {
+            const auto isRejected = [](std::initializer_list<std::uint8_t> bytes)
+            {
+                sf::Packet malformed;
+                malformed.appendVarUInt(bytes.size());
+                malformed.append(bytes.begin(), bytes.size());
+
+                sf::String result;
+                return !malformed.extractUtf8(result);
+            };
+
+            CHECK(isRejected({0xFF, 0xFE, 0xC0}));        // Invalid bytes
+            CHECK(isRejected({0xC0, 0xAF}));              // Overlong '/'
+            CHECK(isRejected({0xE0, 0x80, 0xAF}));        // Overlong '/' on 3 bytes
+            CHECK(isRejected({0xED, 0xA0, 0x80}));        // Surrogate U+D800
+            CHECK(isRejected({0xF4, 0x90, 0x80, 0x80}));  // U+110000
+            CHECK(isRejected({0xE2, 0x82}));              // Truncated sequence
+            CHECK(isRejected({0x41, 0x80}));              // Unexpected continuation byte
+            CHECK(!isRejected({0xF4, 0x8F, 0xBF, 0xBF})); // U+10FFFF
+        }
+    }
+
+    SECTION("Compression")
+    {
+        Packet packet;
+        CHECK(packet.getCompression() == sf::Packet::Compression::None);
+        packet.setCompression(sf::Packet::Compression::Lz4);
+        CHECK(packet.getCompression() == sf::Packet::Compression::Lz4);
+
+        const std::vector<std::int32_t> values(1000, 42);
+        packet.appendArray(values.data(), values.size());
+
+        std::size_t size       = 0;
+        const void* compressed = packet.onSend(size);
+        REQUIRE(compressed != nullptr);
+        CHECK(size < packet.getDataSize() / 10);
+
+        Packet received;
+        received.setCompression(sf::Packet::Compression::Lz4);
+        received.onReceive(compressed, size);
+        REQUIRE(received.getDataSize() == packet.getDataSize());
+        CHECK(std::memcmp(received.getData(), packet.getData(), packet.getDataSize()) == 0);
+
+        SECTION("Incompressible data")
+        {
+            packet.clear();
+            packet << std::uint8_t{1} << std::uint8_t{2};
+            CHECK(packet.onSend(size) != nullptr);
+            CHECK(size == 3);
+        }
+
+        SECTION("Empty packet")
+        {
+            packet.clear();
+            compressed = packet.onSend(size);
+            REQUIRE(compressed != nullptr);
+
+            Packet empty;
+            empty.setCompression(sf::Packet::Compression::Lz4);
+            empty.onReceive(compressed, size);
+            CHECK(empty);
+            CHECK(empty.getDataSize() == 0);
+            CHECK(empty.endOfPacket());
+        }
+
+        SECTION("Invalid data")
+        {
+            Packet invalid;
+            invalid.setCompression(sf::Packet::Compression::Lz4);
+            const std::array<std::byte, 3> bytes{std::byte{1}, std::byte{100}, std::byte{0}};
+            invalid.onReceive(bytes.data(), bytes.size());
+            CHECK(!invalid);
+        }
+    }
+
+    SECTION("encodeDelta()/decodeDelta()")
+    {
+        sf::Packet reference;
+        reference << std::int32_t{1} << std::int32_t{2};
+
+        sf::Packet packet;
+        packet << std::int32_t{1} << std::int32_t{3} << std::int32_t{4};
+        packet.encodeDelta(reference);
+
+        std::int32_t value = 0;
+        CHECK(packet >> value);
+        CHECK(value == 0);
+
+        packet.decodeDelta(reference);
+        CHECK(packet.getReadPosition() == 0);
+        CHECK(packet >> value);
+        CHECK(value == 1);
+        CHECK(packet >> value);
+        CHECK(value == 3);
+        CHECK(packet >> value);
+        CHECK(value == 4);
+    }
+
     SECTION("onSend")
     {
         Packet      packet;
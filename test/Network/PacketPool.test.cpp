@@ -0,0 +1,62 @@
+#include <SFML/Network/PacketPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+#include <cstdint>
+
+TEST_CASE("[Network] sf::PacketPool")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::PacketPool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::PacketPool>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::PacketPool>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::PacketPool>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::PacketPool pool;
+        CHECK(pool.getFreeCount() == 0);
+    }
+
+    SECTION("preallocate()")
+    {
+        sf::PacketPool pool(256);
+        pool.preallocate(4);
+        CHECK(pool.getFreeCount() == 4);
+
+        const sf::PacketPool::Handle packet = pool.acquire();
+        CHECK(pool.getFreeCount() == 3);
+        CHECK(packet->getCapacity() >= 256);
+    }
+
+    SECTION("acquire()")
+    {
+        sf::PacketPool    pool(0, 1);
+        const sf::Packet* address = nullptr;
+
+        {
+            const sf::PacketPool::Handle packet = pool.acquire();
+            REQUIRE(packet);
+            CHECK(packet->getDataSize() == 0);
+            *packet << std::uint32_t{42};
+            address = packet.get();
+        }
+
+        CHECK(pool.getFreeCount() == 1);
+
+        sf::PacketPool::Handle recycled = pool.acquire();
+        CHECK(recycled.get() == address);
+        CHECK(recycled->getDataSize() == 0);
+        CHECK(recycled->getCapacity() >= sizeof(std::uint32_t));
+        CHECK(pool.getFreeCount() == 0);
+
+        sf::PacketPool::Handle extra = pool.acquire();
+        recycled.reset();
+        extra.reset();
+        CHECK(pool.getFreeCount() == 1);
+    }
+}
@@ -0,0 +1,142 @@
+#include <SFML/Network/PacketView.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
+#include <SFML/System/String.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[Network] sf::PacketView")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_trivially_copyable_v<sf::PacketView>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::PacketView>);
+        STATIC_CHECK(!std::is_convertible_v<sf::Packet, sf::PacketView>);
+    }
+
+    SECTION("Default constructor")
+    {
+        sf::PacketView view;
+        CHECK(view.getData() == nullptr);
+        CHECK(view.getDataSize() == 0);
+        CHECK(view.getReadPosition() == 0);
+        CHECK(view.endOfPacket());
+        CHECK(static_cast<bool>(view));
+
+        std::uint8_t value = 0;
+        CHECK(!(view >> value));
+    }
+
+    SECTION("Construction from bytes")
+    {
+        constexpr std::array bytes = {std::byte{0x12}, std::byte{0x34}, std::byte{0x56}};
+        sf::PacketView       view(bytes.data(), bytes.size());
+        CHECK(view.getData() == bytes.data());
+        CHECK(view.getDataSize() == 3);
+        CHECK(!view.endOfPacket());
+
+        std::uint16_t value = 0;
+        CHECK(view >> value);
+        CHECK(value == 0x1234);
+        CHECK(view.getReadPosition() == 2);
+
+        CHECK(!(view >> value));
+        CHECK(value == 0x1234);
+        CHECK(view.getReadPosition() == 2);
+
+        // Once invalid, the view stays invalid
+        std::uint8_t last = 0;
+        CHECK(!(view >> last));
+    }
+
+    SECTION("Same data as sf::Packet")
+    {
+        sf::Packet packet;
+        packet << true << std::int8_t{-7} << std::uint16_t{0xBEEF} << std::int32_t{-123456}
+               << std::uint64_t{0x0123456789ABCDEF} << std::int64_t{-42} << 1.5f << 2.25;
+        packet << "chars" << std::string("string") << L"wide" << std::wstring(L"wstring") << sf::String(U"été");
+        const std::array<std::int32_t, 3> numbers = {1, -2, 3};
+        packet.appendArray(numbers.data(), numbers.size());
+        packet.appendVarUInt(300);
+        packet.appendVarInt(-5);
+        packet.appendUtf8(sf::String(U"日本"));
+
+        sf::PacketView view(packet);
+        CHECK(view.getData() == packet.getData());
+        CHECK(view.getDataSize() == packet.getDataSize());
+
+        bool          boolean = false;
+        std::int8_t   int8    = 0;
+        std::uint16_t uint16  = 0;
+        std::int32_t  int32   = 0;
+        std::uint64_t uint64  = 0;
+        std::int64_t  int64   = 0;
+        float         real    = 0;
+        double        precise = 0;
+        CHECK(view >> boolean >> int8 >> uint16 >> int32 >> uint64 >> int64 >> real >> precise);
+        CHECK(boolean);
+        CHECK(int8 == -7);
+        CHECK(uint16 == 0xBEEF);
+        CHECK(int32 == -123456);
+        CHECK(uint64 == 0x0123456789ABCDEF);
+        CHECK(int64 == -42);
+        CHECK(real == 1.5f);
+        CHECK(precise == 2.25);
+
+        std::array<char, 16>    chars{};
+        std::string             string;
+        std::array<wchar_t, 16> wide{};
+        std::wstring            wstring;
+        sf::String              sfString;
+        CHECK(view >> chars.data() >> string >> wide.data() >> wstring >> sfString);
+        CHECK(std::string(chars.data()) == "chars");
+        CHECK(string == "string");
+        CHECK(std::wstring(wide.data()) == L"wide");
+        CHECK(wstring == L"wstring");
+        CHECK(sfString == sf::String(U"été"));
+
+        std::array<std::int32_t, 3> extracted{};
+        std::uint64_t               varUInt = 0;
+        std::int64_t                varInt  = 0;
+        sf::String                  utf8;
+        CHECK(view.extractArray(extracted.data(), extracted.size()).extractVarUInt(varUInt).extractVarInt(varInt));
+        CHECK(view.extractUtf8(utf8));
+        CHECK(extracted == numbers);
+        CHECK(varUInt == 300);
+        CHECK(varInt == -5);
+        CHECK(utf8 == sf::String(U"日本"));
+        CHECK(view.endOfPacket());
+        CHECK(view.getReadPosition() == packet.getDataSize());
+    }
+
+    SECTION("Truncated data")
+    {
+        sf::Packet packet;
+        packet << std::string("truncated");
+
+        sf::PacketView view(packet.getData(), packet.getDataSize() - 1);
+        std::string    string = "unchanged";
+        CHECK(!(view >> string));
+        CHECK(string.empty());
+
+        // Size of 0x3FFFFF bytes, followed by nothing
+        constexpr std::array bogus = {std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0x01}};
+        sf::PacketView       utf8View(bogus.data(), bogus.size());
+        sf::String           utf8;
+        CHECK(!utf8View.extractUtf8(utf8));
+
+        // Surrogate U+D800, which is not valid UTF-8
+        constexpr std::array surrogate = {std::byte{0x03}, std::byte{0xED}, std::byte{0xA0}, std::byte{0x80}};
+        sf::PacketView       surrogateView(surrogate.data(), surrogate.size());
+        CHECK(!surrogateView.extractUtf8(utf8));
+    }
+}
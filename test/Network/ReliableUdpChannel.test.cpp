@@ -0,0 +1,216 @@
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/ReliableUdpChannel.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+// Read all the datagrams waiting on a socket
+std::vector<std::vector<char>> receiveAll(sf::UdpSocket& socket)
+{
+    std::vector<std::vector<char>> datagrams;
+    for (int attempt = 0; attempt < 100; ++attempt)
+    {
+        std::array<char, sf::UdpSocket::MaxDatagramSize> buffer{};
+        std::size_t                                       received = 0;
+        std::optional<sf::IpAddress>                      sender;
+        unsigned short                                    port = 0;
+        while (socket.receive(buffer.data(), buffer.size(), received, sender, port) == sf::Socket::Status::Done)
+            datagrams.emplace_back(buffer.data(), buffer.data() + received);
+
+        if (!datagrams.empty())
+            break;
+        sf::sleep(sf::milliseconds(1));
+    }
+    return datagrams;
+}
+
+// Give all the datagrams waiting on a socket to a channel
+void deliverAll(sf::UdpSocket& socket, sf::ReliableUdpChannel& channel)
+{
+    for (const std::vector<char>& datagram : receiveAll(socket))
+        CHECK(channel.processDatagram(datagram.data(), datagram.size()));
+}
+
+std::vector<std::string> receiveMessages(sf::ReliableUdpChannel& channel)
+{
+    std::vector<std::string> messages;
+    sf::Packet               packet;
+    while (channel.receive(packet))
+    {
+        std::string message;
+        packet >> message;
+        messages.push_back(message);
+    }
+    return messages;
+}
+} // namespace
+
+TEST_CASE("[Network] sf::ReliableUdpChannel")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::ReliableUdpChannel>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::ReliableUdpChannel>);
+    }
+
+    sf::UdpSocket first;
+    sf::UdpSocket second;
+    REQUIRE(first.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    REQUIRE(second.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    first.setBlocking(false);
+    second.setBlocking(false);
+
+    sf::ReliableUdpChannel sender(first, sf::IpAddress::LocalHost, second.getLocalPort());
+    sf::ReliableUdpChannel receiver(second, sf::IpAddress::LocalHost, first.getLocalPort());
+
+    SECTION("Construction")
+    {
+        CHECK(sender.getRemoteAddress() == sf::IpAddress::LocalHost);
+        CHECK(sender.getRemotePort() == second.getLocalPort());
+        CHECK(sender.getMaxDatagramSize() == sf::ReliableUdpChannel::DefaultMaxDatagramSize);
+
+        const sf::ReliableUdpChannel::Statistics statistics = sender.getStatistics();
+        CHECK(statistics.bytesInFlight == 0);
+        CHECK(statistics.congestionWindow > sf::ReliableUdpChannel::DefaultMaxDatagramSize);
+        CHECK(statistics.datagramsSent == 0);
+
+        sf::Packet packet;
+        CHECK(!sender.receive(packet));
+    }
+
+    SECTION("setMaxDatagramSize()")
+    {
+        sender.setMaxDatagramSize(10);
+        CHECK(sender.getMaxDatagramSize() == 64);
+        sender.setMaxDatagramSize(100'000);
+        CHECK(sender.getMaxDatagramSize() == sf::UdpSocket::MaxDatagramSize);
+        sender.setMaxDatagramSize(500);
+        CHECK(sender.getMaxDatagramSize() == 500);
+    }
+
+    SECTION("Reliable ordered messages")
+    {
+        sf::Packet large;
+        large << std::string(10'000, 'x');
+        REQUIRE(sender.send(sf::ReliableUdpChannel::Lane::ReliableOrdered, large));
+        for (const char* text : {"one", "two", "three"})
+        {
+            sf::Packet packet;
+            packet << text;
+            REQUIRE(sender.send(sf::ReliableUdpChannel::Lane::ReliableOrdered, packet));
+        }
+        REQUIRE(sender.flush() == sf::Socket::Status::Done);
+
+        // The large message is fragmented, the small ones are packed together
+        const std::vector<std::vector<char>> datagrams = receiveAll(second);
+        CHECK(datagrams.size() == 9);
+        for (const std::vector<char>& datagram : datagrams)
+            CHECK(datagram.size() <= sf::ReliableUdpChannel::DefaultMaxDatagramSize);
+
+        // Deliver them in reverse order: the messages must come out in order anyway
+        for (auto it = datagrams.rbegin(); it != datagrams.rend(); ++it)
+            CHECK(receiver.processDatagram(it->data(), it->size()));
+
+        const std::vector<std::string> messages = receiveMessages(receiver);
+        REQUIRE(messages.size() == 4);
+        CHECK(messages[0] == std::string(10'000, 'x'));
+        CHECK(messages[1] == "one");
+        CHECK(messages[3] == "three");
+
+        // The acknowledgment empties the window of the sender
+        REQUIRE(receiver.flush() == sf::Socket::Status::Done);
+        deliverAll(first, sender);
+        CHECK(sender.getStatistics().bytesInFlight == 0);
+        CHECK(sender.getStatistics().datagramsLost == 0);
+    }
+
+    SECTION("Retransmission of lost messages")
+    {
+        sf::Packet packet;
+        packet << "reliable";
+        REQUIRE(sender.send(sf::ReliableUdpChannel::Lane::ReliableOrdered, packet));
+        packet.clear();
+        packet << "unreliable";
+        REQUIRE(sender.send(sf::ReliableUdpChannel::Lane::Unreliable, packet));
+        REQUIRE(sender.flush() == sf::Socket::Status::Done);
+
+        // Lose the datagram
+        CHECK(receiveAll(second).size() == 1);
+        CHECK(sender.getStatistics().bytesInFlight > 0);
+
+        // Only the reliable message is sent again once the timeout expires
+        sf::sleep(sender.getStatistics().retransmissionTimeout + sf::milliseconds(20));
+        REQUIRE(sender.flush() == sf::Socket::Status::Done);
+        CHECK(sender.getStatistics().datagramsLost == 1);
+        deliverAll(second, receiver);
+
+        const std::vector<std::string> messages = receiveMessages(receiver);
+        REQUIRE(messages.size() == 1);
+        CHECK(messages[0] == "reliable");
+
+        // Duplicates are not delivered twice
+        REQUIRE(receiver.flush() == sf::Socket::Status::Done);
+        deliverAll(first, sender);
+        CHECK(sender.getStatistics().bytesInFlight == 0);
+    }
+
+    SECTION("Unreliable sequenced messages")
+    {
+        for (const char* text : {"old", "new"})
+        {
+            sf::Packet packet;
+            packet << text;
+            REQUIRE(sender.send(sf::ReliableUdpChannel::Lane::UnreliableSequenced, packet));
+            REQUIRE(sender.flush() == sf::Socket::Status::Done);
+        }
+
+        // The older message arrives last and is discarded
+        const std::vector<std::vector<char>> datagrams = receiveAll(second);
+        REQUIRE(datagrams.size() == 2);
+        CHECK(receiver.processDatagram(datagrams[1].data(), datagrams[1].size()));
+        CHECK(receiver.processDatagram(datagrams[0].data(), datagrams[0].size()));
+
+        const std::vector<std::string> messages = receiveMessages(receiver);
+        REQUIRE(messages.size() == 1);
+        CHECK(messages[0] == "new");
+    }
+
+    SECTION("Statistics")
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            sf::Packet packet;
+            packet << std::to_string(i);
+            REQUIRE(sender.send(sf::ReliableUdpChannel::Lane::ReliableOrdered, packet));
+            REQUIRE(sender.flush() == sf::Socket::Status::Done);
+            deliverAll(second, receiver);
+            REQUIRE(receiver.flush() == sf::Socket::Status::Done);
+            deliverAll(first, sender);
+        }
+
+        const sf::ReliableUdpChannel::Statistics statistics = sender.getStatistics();
+        CHECK(statistics.datagramsSent == 5);
+        CHECK(statistics.datagramsReceived == 5);
+        CHECK(statistics.bytesInFlight == 0);
+        CHECK(statistics.retransmissionTimeout >= sf::milliseconds(50));
+        CHECK(statistics.congestionWindow > 10 * sf::ReliableUdpChannel::DefaultMaxDatagramSize);
+        CHECK(receiveMessages(receiver).size() == 5);
+    }
+
+    SECTION("Invalid datagrams")
+    {
+        const std::array<char, 4> garbage{'a', 'b', 'c', 'd'};
+        CHECK(!receiver.processDatagram(garbage.data(), garbage.size()));
+        CHECK(receiver.getStatistics().datagramsReceived == 0);
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <optional>
 #include <type_traits>
 
 class TestSocket : public sf::Socket
@@ -85,6 +86,28 @@ TEST_CASE("[Network] sf::Socket")
         CHECK(testSocket.getNativeHandle() != invalidHandle);
     }
 
+    SECTION("setOption()/getOption()")
+    {
+        TestSocket testSocket;
+        CHECK(!testSocket.getOption(sf::Socket::Option::ReceiveBufferSize).has_value());
+
+        // Options set before the socket exists are kept and applied when it is created
+        CHECK(testSocket.setOption(sf::Socket::Option::ReceiveBufferSize, 32768));
+        CHECK(testSocket.getOption(sf::Socket::Option::ReceiveBufferSize) == 32768);
+        testSocket.create();
+        const auto receiveBufferSize = testSocket.getOption(sf::Socket::Option::ReceiveBufferSize);
+        REQUIRE(receiveBufferSize.has_value());
+        CHECK(*receiveBufferSize >= 32768);
+
+        CHECK(testSocket.setOption(sf::Socket::Option::TypeOfService, 0xb8));
+        CHECK(testSocket.getOption(sf::Socket::Option::TypeOfService) == 0xb8);
+
+        // Options survive the socket being closed and created again
+        testSocket.close();
+        testSocket.create();
+        CHECK(testSocket.getOption(sf::Socket::Option::TypeOfService) == 0xb8);
+    }
+
     SECTION("close()")
     {
         TestSocket testSocket;
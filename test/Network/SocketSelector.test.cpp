@@ -1,11 +1,13 @@
 #include <SFML/Network/SocketSelector.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::SocketSelector")
 {
@@ -23,5 +25,47 @@ TEST_CASE("[Network] sf::SocketSelector")
     {
         const sf::SocketSelector socketSelector;
         CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets().empty());
+    }
+
+    SECTION("wait()")
+    {
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::SocketSelector socketSelector;
+        socketSelector.add(socket);
+        CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        CHECK(socketSelector.getReadySockets().empty());
+
+        sf::UdpSocket sender;
+        const char    data[] = "data";
+        REQUIRE(sender.send(data, sizeof(data), sf::IpAddress::LocalHost, socket.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        CHECK(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&socket});
+
+        SECTION("Copy")
+        {
+            const sf::SocketSelector copy(socketSelector); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(copy.isReady(socket));
+            CHECK(copy.getReadySockets() == std::vector<sf::Socket*>{&socket});
+        }
+
+        SECTION("remove()")
+        {
+            socketSelector.remove(socket);
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(socketSelector.getReadySockets().empty());
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        }
+
+        SECTION("clear()")
+        {
+            socketSelector.clear();
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(socketSelector.getReadySockets().empty());
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        }
     }
 }
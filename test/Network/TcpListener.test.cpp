@@ -5,6 +5,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <type_traits>
 
 TEST_CASE("[Network] sf::TcpListener")
@@ -33,6 +34,12 @@ TEST_CASE("[Network] sf::TcpListener")
             CHECK(tcpListener.getLocalPort() != 0);
         }
 
+        SECTION("IPv6")
+        {
+            CHECK(tcpListener.listen(0, sf::IpAddress::AnyV6) == sf::Socket::Status::Done);
+            CHECK(tcpListener.getLocalPort() != 0);
+        }
+
         SECTION("Invalid")
         {
             CHECK(tcpListener.listen(0, sf::IpAddress::Broadcast) == sf::Socket::Status::Error);
@@ -55,4 +62,41 @@ TEST_CASE("[Network] sf::TcpListener")
         sf::TcpSocket   tcpSocket;
         CHECK(tcpListener.accept(tcpSocket) == sf::Socket::Status::Error);
     }
+
+    SECTION("acceptBatch()")
+    {
+        sf::TcpListener tcpListener;
+        REQUIRE(tcpListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        std::array<sf::TcpSocket, 3> clients;
+        for (sf::TcpSocket& client : clients)
+            REQUIRE(client.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort()) == sf::Socket::Status::Done);
+
+        std::array<sf::TcpSocket, 4> accepted;
+        std::size_t                  count = 0;
+        CHECK(tcpListener.acceptBatch(accepted.data(), accepted.size(), count) == sf::Socket::Status::Done);
+        CHECK(count == clients.size());
+        CHECK(accepted[0].getRemotePort() == clients[0].getLocalPort());
+        CHECK(accepted[2].getRemotePort() == clients[2].getLocalPort());
+
+        tcpListener.setBlocking(false);
+        CHECK(tcpListener.acceptBatch(accepted.data(), accepted.size(), count) == sf::Socket::Status::NotReady);
+        CHECK(count == 0);
+    }
+
+    SECTION("setReusePort()")
+    {
+        sf::TcpListener first;
+        sf::TcpListener second;
+        CHECK(!first.getReusePort());
+        first.setReusePort(true);
+        second.setReusePort(true);
+        CHECK(first.getReusePort());
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+        REQUIRE(first.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        CHECK(second.listen(first.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        CHECK(second.getLocalPort() == first.getLocalPort());
+#endif
+    }
 }
@@ -2,11 +2,16 @@
 
 // Other 1st party headers
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <string>
 #include <type_traits>
 
+#include <cstdint>
+
 TEST_CASE("[Network] sf::TcpSocket")
 {
     SECTION("Type traits")
@@ -24,4 +29,99 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(!tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
     }
+
+    SECTION("Packet exchange")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        const std::string message(50'000, 'x');
+        sf::Packet        packet;
+        packet << message << 42;
+        REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+        packet.clear();
+        REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+
+        sf::Packet   received;
+        std::string  string;
+        std::int32_t integer = 0;
+        REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+        CHECK(received.getDataSize() == sizeof(std::uint32_t) + message.size() + sizeof(integer));
+        CHECK(received >> string >> integer);
+        CHECK(string == message);
+        CHECK(integer == 42);
+
+        REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+        CHECK(received.getDataSize() == 0);
+    }
+
+    SECTION("Stalled packet send")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+        client.setBlocking(false);
+
+        // The server doesn't read anything, so the buffers end up full and a retry can't make progress
+        sf::Packet packet;
+        packet << std::string(16 * 1024 * 1024, 'x');
+        REQUIRE(client.send(packet) == sf::Socket::Status::Partial);
+        CHECK(client.send(packet) == sf::Socket::Status::NotReady);
+    }
+
+    SECTION("Send queue")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        CHECK(client.getQueuedSize() == 0);
+        CHECK(client.flush() == sf::Socket::Status::Done);
+
+        sf::Packet packet;
+        for (std::int32_t i = 0; i < 50; ++i)
+        {
+            packet.clear();
+            packet << i;
+            CHECK(client.queue(packet) == sf::Socket::Status::Done);
+        }
+
+        CHECK(client.getQueuedSize() == 50 * 2 * sizeof(std::uint32_t));
+        CHECK(client.flush() == sf::Socket::Status::Done);
+        CHECK(client.getQueuedSize() == 0);
+
+        // Reaching the flush size sends the queue right away
+        client.setSendQueueFlushSize(2 * sizeof(std::uint32_t));
+        packet.clear();
+        packet << std::int32_t{50};
+        CHECK(client.queue(packet) == sf::Socket::Status::Done);
+        CHECK(client.getQueuedSize() == 0);
+
+        sf::Packet received;
+        for (std::int32_t i = 0; i <= 50; ++i)
+        {
+            std::int32_t value = -1;
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            CHECK(received >> value);
+            CHECK(value == i);
+        }
+
+        client.setSendQueueFlushSize(0);
+        CHECK(client.queue(packet) == sf::Socket::Status::Done);
+        client.disconnect();
+        CHECK(client.getQueuedSize() == 0);
+    }
 }
@@ -0,0 +1,123 @@
+#include <SFML/Network/TimerWheel.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Network] sf::TimerWheel")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TimerWheel>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TimerWheel>);
+    }
+
+    SECTION("Construction")
+    {
+        sf::TimerWheel wheel;
+        CHECK(wheel.getTimerCount() == 0);
+        CHECK(!wheel.getTimeUntilNextExpiry().has_value());
+        CHECK(wheel.expire() == 0);
+    }
+
+    SECTION("schedule() and cancel()")
+    {
+        sf::TimerWheel wheel;
+        int            calls = 0;
+
+        const sf::TimerWheel::Id first  = wheel.schedule(sf::seconds(60), [&] { ++calls; });
+        const sf::TimerWheel::Id second = wheel.schedule(sf::Time::Zero, [&] { ++calls; });
+        CHECK(first != 0);
+        CHECK(second != first);
+        CHECK(wheel.getTimerCount() == 2);
+        CHECK(wheel.getTimeUntilNextExpiry() <= sf::milliseconds(1));
+
+        sf::sleep(sf::milliseconds(2));
+        CHECK(wheel.expire() == 1);
+        CHECK(calls == 1);
+        CHECK(wheel.getTimerCount() == 1);
+        CHECK(!wheel.cancel(second));
+
+        CHECK(wheel.getTimeUntilNextExpiry() > sf::Time::Zero);
+        CHECK(wheel.getTimeUntilNextExpiry() <= sf::seconds(60));
+        CHECK(wheel.cancel(first));
+        CHECK(!wheel.cancel(first));
+        CHECK(!wheel.cancel(0));
+        CHECK(wheel.getTimerCount() == 0);
+        CHECK(!wheel.getTimeUntilNextExpiry().has_value());
+
+        // The storage of a cancelled timer is reused with another identifier
+        const sf::TimerWheel::Id third = wheel.schedule(sf::seconds(1), [&] { ++calls; });
+        CHECK(third != first);
+        CHECK(!wheel.cancel(first));
+        CHECK(wheel.getTimerCount() == 1);
+        CHECK(calls == 1);
+    }
+
+    SECTION("Delay beyond the range of the wheel")
+    {
+        sf::TimerWheel           wheel(sf::microseconds(1));
+        const sf::TimerWheel::Id timer = wheel.schedule(sf::seconds(7200), [] {});
+        CHECK(wheel.getTimeUntilNextExpiry() <= sf::seconds(7200));
+        CHECK(wheel.expire() == 0);
+        CHECK(wheel.cancel(timer));
+    }
+
+    SECTION("expire()")
+    {
+        // A fine resolution makes the timers go through several levels of the wheel
+        sf::TimerWheel    wheel(sf::microseconds(10));
+        const sf::Clock   clock;
+        std::vector<int>  order;
+        std::vector<bool> early;
+
+        const auto add = [&](int name, sf::Time delay)
+        {
+            wheel.schedule(delay,
+                           [&, name, delay]
+                           {
+                               order.push_back(name);
+                               early.push_back(clock.getElapsedTime() < delay);
+                           });
+        };
+
+        add(3, sf::milliseconds(700));
+        add(1, sf::milliseconds(2));
+        add(2, sf::milliseconds(30));
+
+        // A handler scheduling a timer
+        wheel.schedule(sf::milliseconds(10), [&] { add(4, sf::milliseconds(750)); });
+
+        while (const auto timeout = wheel.getTimeUntilNextExpiry())
+        {
+            sf::sleep(*timeout);
+            wheel.expire();
+        }
+
+        CHECK(order == std::vector<int>{1, 2, 3, 4});
+        CHECK(early == std::vector<bool>(4, false));
+    }
+
+    SECTION("Many timers")
+    {
+        sf::TimerWheel                  wheel;
+        std::vector<sf::TimerWheel::Id> timers;
+        for (int i = 0; i < 50'000; ++i)
+            timers.push_back(wheel.schedule(sf::milliseconds(1000 + i), [] {}));
+
+        CHECK(wheel.getTimerCount() == 50'000);
+
+        std::size_t cancelled = 0;
+        for (std::size_t i = 0; i < timers.size(); i += 2)
+            cancelled += wheel.cancel(timers[i]) ? 1 : 0;
+
+        CHECK(cancelled == 25'000);
+        CHECK(wheel.getTimerCount() == 25'000);
+        CHECK(wheel.getTimeUntilNextExpiry() <= sf::milliseconds(1001));
+    }
+}
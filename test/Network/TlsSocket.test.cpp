@@ -0,0 +1,58 @@
+#include <SFML/Network/TlsSocket.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpListener.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+TEST_CASE("[Network] sf::TlsSocket")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TlsSocket>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TlsSocket>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TlsSocket>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TlsSocket>);
+        STATIC_CHECK(std::is_base_of_v<sf::TcpSocket, sf::TlsSocket>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TlsSocket tlsSocket;
+        CHECK(tlsSocket.getLocalPort() == 0);
+        CHECK(!tlsSocket.getRemoteAddress().has_value());
+        CHECK(tlsSocket.getRemotePort() == 0);
+        CHECK(!tlsSocket.isSessionReused());
+        CHECK(!tlsSocket.isEarlyDataAccepted());
+    }
+
+    SECTION("Failed handshake")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // The server does not speak TLS: it closes the connection without answering
+        sf::TlsSocket client;
+        {
+            sf::TcpSocket server;
+            listener.setBlocking(false);
+            CHECK(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort(), "localhost", sf::milliseconds(1)) !=
+                  sf::Socket::Status::Done);
+            (void)listener.accept(server);
+        }
+        CHECK(!client.getRemoteAddress().has_value());
+    }
+
+    SECTION("Type-erased use")
+    {
+        sf::TlsSocket  tlsSocket;
+        sf::TcpSocket& tcpSocket = tlsSocket;
+        char           buffer[16]{};
+        std::size_t    received = 0;
+        CHECK(tcpSocket.receive(buffer, sizeof(buffer), received) != sf::Socket::Status::Done);
+        CHECK(received == 0);
+    }
+}
@@ -2,6 +2,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <optional>
+#include <string>
 #include <type_traits>
 
 TEST_CASE("[Network] sf::UdpSocket")
@@ -35,4 +38,165 @@ TEST_CASE("[Network] sf::UdpSocket")
         udpSocket.unbind();
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+    SECTION("sendBatch()/receiveBatch()")
+    {
+        sf::UdpSocket receiver;
+        sf::UdpSocket sender;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        std::array<char, 3>                    first{'a', 'b', 'c'};
+        std::array<char, 5>                    second{'d', 'e', 'f', 'g', 'h'};
+        std::array<sf::UdpSocket::Datagram, 2> outgoing{};
+        outgoing[0] = {first.data(), first.size(), 0, sf::IpAddress::LocalHost, receiver.getLocalPort()};
+        outgoing[1] = {second.data(), second.size(), 0, sf::IpAddress::LocalHost, receiver.getLocalPort()};
+
+        std::size_t sent = 0;
+        CHECK(sender.sendBatch(outgoing.data(), outgoing.size(), sent) == sf::Socket::Status::Done);
+        CHECK(sent == 2);
+
+        std::array<std::array<char, 16>, 4>    buffers{};
+        std::array<sf::UdpSocket::Datagram, 4> incoming{};
+        for (std::size_t i = 0; i < incoming.size(); ++i)
+        {
+            incoming[i].data = buffers[i].data();
+            incoming[i].size = buffers[i].size();
+        }
+
+        std::size_t total = 0;
+        while (total < 2)
+        {
+            std::size_t received = 0;
+            REQUIRE(receiver.receiveBatch(incoming.data() + total, incoming.size() - total, received) ==
+                    sf::Socket::Status::Done);
+            total += received;
+        }
+
+        CHECK(total == 2);
+        CHECK(incoming[0].received == first.size());
+        CHECK(incoming[1].received == second.size());
+        CHECK(buffers[0][0] == 'a');
+        CHECK(buffers[1][4] == 'h');
+        CHECK(incoming[1].remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(incoming[1].remotePort == sender.getLocalPort());
+    }
+
+#if defined(SFML_SYSTEM_LINUX)
+    SECTION("Reception timestamps")
+    {
+        sf::UdpSocket receiver;
+        sf::UdpSocket sender;
+        REQUIRE(receiver.setOption(sf::Socket::Option::Timestamp, 1));
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        CHECK(receiver.getOption(sf::Socket::Option::Timestamp) == 1);
+
+        constexpr char data = 'x';
+        REQUIRE(sender.send(&data, 1, sf::IpAddress::LocalHost, receiver.getLocalPort()) == sf::Socket::Status::Done);
+
+        char                    buffer = 0;
+        sf::UdpSocket::Datagram datagram{&buffer, 1};
+        std::size_t             received = 0;
+        REQUIRE(receiver.receiveBatch(&datagram, 1, received) == sf::Socket::Status::Done);
+        CHECK(received == 1);
+        CHECK(buffer == data);
+        CHECK(datagram.timestamp > sf::Time::Zero);
+    }
+#endif
+
+    SECTION("Dual-stack sockets")
+    {
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::AnyV6) == sf::Socket::Status::Done);
+        CHECK(receiver.getLocalPort() != 0);
+
+        sf::UdpSocket  ipV4Sender;
+        sf::UdpSocket  ipV6Sender;
+        constexpr char data = 'x';
+        REQUIRE(ipV4Sender.send(&data, 1, sf::IpAddress::LocalHost, receiver.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        REQUIRE(ipV6Sender.send(&data, 1, sf::IpAddress::LocalHostV6, receiver.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        CHECK(ipV4Sender.send(&data, 1, sf::IpAddress::LocalHostV6, receiver.getLocalPort()) ==
+              sf::Socket::Status::Error);
+
+        std::array<sf::IpAddress, 2>  senders{sf::IpAddress::Any, sf::IpAddress::Any};
+        std::array<unsigned short, 2> ports{};
+        for (std::size_t i = 0; i < senders.size(); ++i)
+        {
+            char                         buffer   = 0;
+            std::size_t                  received = 0;
+            std::optional<sf::IpAddress> remoteAddress;
+            REQUIRE(receiver.receive(&buffer, 1, received, remoteAddress, ports[i]) == sf::Socket::Status::Done);
+            REQUIRE(remoteAddress.has_value());
+            CHECK(buffer == data);
+            senders[i] = *remoteAddress;
+        }
+
+        // IPv4 peers are reported as regular IPv4 addresses
+        CHECK(senders[0] == sf::IpAddress::LocalHost);
+        CHECK(ports[0] == ipV4Sender.getLocalPort());
+        CHECK(senders[1] == sf::IpAddress::LocalHostV6);
+        CHECK(ports[1] == ipV6Sender.getLocalPort());
+    }
+
+    SECTION("sendToAll()")
+    {
+        std::array<sf::UdpSocket, 3>              receivers;
+        std::array<sf::UdpSocket::Destination, 3> destinations;
+        for (std::size_t i = 0; i < receivers.size(); ++i)
+        {
+            REQUIRE(receivers[i].bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            destinations[i] = {sf::IpAddress::LocalHost, receivers[i].getLocalPort()};
+        }
+
+        sf::UdpSocket  sender;
+        constexpr char data[] = "snapshot";
+        std::size_t    sent   = 0;
+        CHECK(sender.sendToAll(data, sizeof(data), destinations.data(), destinations.size(), sent) ==
+              sf::Socket::Status::Done);
+        CHECK(sent == destinations.size());
+
+        for (sf::UdpSocket& receiver : receivers)
+        {
+            std::array<char, sizeof(data)> buffer{};
+            std::size_t                    received = 0;
+            std::optional<sf::IpAddress>   remoteAddress;
+            unsigned short                 remotePort = 0;
+            REQUIRE(receiver.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                    sf::Socket::Status::Done);
+            CHECK(received == sizeof(data));
+            CHECK(std::string(buffer.data()) == data);
+            CHECK(remotePort == sender.getLocalPort());
+        }
+    }
+
+    SECTION("Multicast")
+    {
+        const sf::IpAddress group(239, 255, 0, 1);
+
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+        REQUIRE(receiver.joinMulticastGroup(group, sf::IpAddress::LocalHost));
+
+        sf::UdpSocket sender;
+        REQUIRE(sender.setOption(sf::Socket::Option::MulticastTtl, 4));
+        CHECK(sender.getOption(sf::Socket::Option::MulticastTtl) == 4);
+        REQUIRE(sender.setOption(sf::Socket::Option::MulticastLoopback, 1));
+        CHECK(!sender.setMulticastInterface(sf::IpAddress::LocalHostV6));
+        REQUIRE(sender.setMulticastInterface(sf::IpAddress::LocalHost));
+
+        constexpr char data = 'x';
+        REQUIRE(sender.send(&data, 1, group, receiver.getLocalPort()) == sf::Socket::Status::Done);
+
+        char                         buffer   = 0;
+        std::size_t                  received = 0;
+        std::optional<sf::IpAddress> remoteAddress;
+        unsigned short               remotePort = 0;
+        REQUIRE(receiver.receive(&buffer, 1, received, remoteAddress, remotePort) == sf::Socket::Status::Done);
+        CHECK(buffer == data);
+        CHECK(remotePort == sender.getLocalPort());
+
+        CHECK(receiver.leaveMulticastGroup(group, sf::IpAddress::LocalHost));
+        CHECK(!receiver.leaveMulticastGroup(group, sf::IpAddress::LocalHost));
+    }
 }
@@ -0,0 +1,169 @@
+#include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <PerformanceUtil.hpp>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <cmath>
+
+// Hidden from the other test runs: timings are only meaningful on a quiet machine, see runperformancetests
+TEST_CASE("[Performance] Frame times", "[.performance]")
+{
+    const std::size_t         frames = getPerformanceFrameCount();
+    std::vector<SceneResults> results;
+
+    auto target = sf::RenderTexture::create({512, 512}).value();
+
+    // Scenes are animated from the frame index so that they are identical from one run to the next
+    const auto wave = [](std::size_t frame, std::size_t i)
+    { return std::sin(static_cast<float>(frame + i) * 0.05f) * 50.f + 50.f; };
+
+    {
+        const auto              texture = sf::Texture::loadFromFile("Graphics/sfml-logo-big.png").value();
+        std::vector<sf::Sprite> sprites(2000, sf::Sprite(texture, {{0, 0}, {32, 32}}));
+        results.push_back(measureScene("Sprites",
+                                       target,
+                                       frames,
+                                       [&](sf::RenderTexture& renderTexture, std::size_t frame)
+                                       {
+                                           for (std::size_t i = 0; i < sprites.size(); ++i)
+                                           {
+                                               const float y = wave(frame, i) + static_cast<float>(i / 50) * 10.f;
+                                               sprites[i].setPosition({static_cast<float>(i % 50) * 10.f, y});
+                                               renderTexture.draw(sprites[i]);
+                                           }
+                                       }));
+    }
+
+    {
+        const auto font = sf::Font::loadFromFile("Graphics/tuffy.ttf").value();
+        sf::Text   text(font, "", 16);
+        results.push_back(measureScene("Text",
+                                       target,
+                                       frames,
+                                       [&](sf::RenderTexture& renderTexture, std::size_t frame)
+                                       {
+                                           for (std::size_t line = 0; line < 25; ++line)
+                                           {
+                                               text.setString("Line " + std::to_string(line) + ", frame " +
+                                                              std::to_string(frame) +
+                                                              ": the quick brown fox jumps over the lazy dog");
+                                               text.setPosition({0.f, static_cast<float>(line) * 20.f});
+                                               renderTexture.draw(text);
+                                           }
+                                       }));
+    }
+
+    {
+        sf::CircleShape circle(10.f, 30);
+        circle.setOutlineThickness(2.f);
+        circle.setOutlineColor(sf::Color::Red);
+        results.push_back(measureScene("Shapes",
+                                       target,
+                                       frames,
+                                       [&](sf::RenderTexture& renderTexture, std::size_t frame)
+                                       {
+                                           for (std::size_t i = 0; i < 500; ++i)
+                                           {
+                                               circle.setPosition({static_cast<float>(i % 25) * 20.f,
+                                                                   wave(frame, i) + static_cast<float>(i / 25) * 20.f});
+                                               renderTexture.draw(circle);
+                                           }
+                                       }));
+    }
+
+    if (sf::Shader::isAvailable())
+    {
+        auto shader = sf::Shader::loadFromFile("Graphics/shader.vert", "Graphics/shader.frag").value();
+        sf::RectangleShape rectangle({16.f, 16.f});
+        shader.setUniform("storm_total_radius", 100.f);
+        shader.setUniform("storm_inner_radius", 50.f);
+        results.push_back(measureScene("Shaders",
+                                       target,
+                                       frames,
+                                       [&](sf::RenderTexture& renderTexture, std::size_t frame)
+                                       {
+                                           const sf::Glsl::Vec2 storm(wave(frame, 0) * 5.f, 256.f);
+                                           shader.setUniform("storm_position", storm);
+                                           for (std::size_t i = 0; i < 500; ++i)
+                                           {
+                                               shader.setUniform("blink_alpha", wave(frame, i) / 100.f);
+                                               rectangle.setPosition({static_cast<float>(i % 25) * 20.f,
+                                                                      static_cast<float>(i / 25) * 20.f});
+                                               renderTexture.draw(rectangle, &shader);
+                                           }
+                                       }));
+    }
+
+    if (sf::VertexBuffer::isAvailable())
+    {
+        // A static grid of triangles, with one row streamed every frame
+        constexpr std::size_t   columns = 100;
+        constexpr std::size_t   rows    = 100;
+        std::vector<sf::Vertex> vertices;
+        for (std::size_t y = 0; y < rows; ++y)
+        {
+            for (std::size_t x = 0; x < columns; ++x)
+            {
+                const sf::Vector2f position(static_cast<float>(x) * 5.f, static_cast<float>(y) * 5.f);
+                vertices.push_back({position, sf::Color::Green});
+                vertices.push_back({position + sf::Vector2f(5.f, 0.f), sf::Color::Blue});
+                vertices.push_back({position + sf::Vector2f(0.f, 5.f), sf::Color::Red});
+            }
+        }
+
+        sf::VertexBuffer buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Dynamic);
+        REQUIRE(buffer.create(vertices.size()));
+        REQUIRE(buffer.update(vertices.data()));
+        results.push_back(measureScene("VertexBuffers",
+                                       target,
+                                       frames,
+                                       [&](sf::RenderTexture& renderTexture, std::size_t frame)
+                                       {
+                                           const std::size_t row = frame % rows;
+                                           (void)buffer.update(vertices.data() + row * columns * 3,
+                                                               columns * 3,
+                                                               static_cast<unsigned int>(row * columns * 3));
+                                           for (int i = 0; i < 10; ++i)
+                                               renderTexture.draw(buffer);
+                                       }));
+    }
+
+    Tolerances tolerances;
+
+    if (const auto output = getPerformancePath("SFML_PERFORMANCE_OUTPUT"))
+    {
+        std::ofstream file(*output);
+        file << writeResults(results, tolerances);
+        CHECK(file.good());
+    }
+
+    const auto    baselinePath = getPerformancePath("SFML_PERFORMANCE_BASELINE");
+    std::ifstream baselineFile;
+    if (baselinePath)
+        baselineFile.open(*baselinePath);
+
+    if (!baselineFile)
+    {
+        WARN("No baseline to compare to, set SFML_PERFORMANCE_BASELINE to the output of a previous run");
+        return;
+    }
+
+    const std::string json{std::istreambuf_iterator<char>(baselineFile), std::istreambuf_iterator<char>()};
+    const auto        baseline = readResults(json, tolerances);
+    REQUIRE(baseline.has_value());
+
+    for (const std::string& regression : findRegressions(results, *baseline, tolerances))
+        FAIL_CHECK(regression);
+}
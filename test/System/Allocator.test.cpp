@@ -0,0 +1,91 @@
+#include <SFML/System/Allocator.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+class CountingResource : public sf::MemoryResource
+{
+public:
+    void* allocate(std::size_t size, std::size_t alignment) override
+    {
+        ++allocations;
+        return ::operator new(size, static_cast<std::align_val_t>(alignment));
+    }
+
+    void deallocate(void* pointer, std::size_t, std::size_t alignment) override
+    {
+        ++deallocations;
+        ::operator delete(pointer, static_cast<std::align_val_t>(alignment));
+    }
+
+    int allocations{};
+    int deallocations{};
+};
+
+template <typename T>
+using SystemVector = std::vector<T, sf::ModuleAllocator<T, sf::MemoryModule::System>>;
+} // namespace
+
+TEST_CASE("[System] sf::ModuleAllocator")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_abstract_v<sf::MemoryResource>);
+        STATIC_CHECK(std::has_virtual_destructor_v<sf::MemoryResource>);
+        STATIC_CHECK(std::is_nothrow_default_constructible_v<SystemVector<int>>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<SystemVector<int>>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<SystemVector<int>>);
+    }
+
+    SECTION("Default resource")
+    {
+        CHECK(sf::getAllocator() == nullptr);
+
+        const sf::AllocationStats before = sf::getAllocationStats(sf::MemoryModule::System);
+        {
+            SystemVector<std::uint64_t> vector(16);
+            CHECK(vector.get_allocator().getResource() == nullptr);
+
+            const sf::AllocationStats during = sf::getAllocationStats(sf::MemoryModule::System);
+            CHECK(during.allocationCount == before.allocationCount + 1);
+            CHECK(during.bytesInUse == before.bytesInUse + 16 * sizeof(std::uint64_t));
+            CHECK(during.peakBytesInUse >= during.bytesInUse);
+        }
+
+        const sf::AllocationStats after = sf::getAllocationStats(sf::MemoryModule::System);
+        CHECK(after.deallocationCount == before.deallocationCount + 1);
+        CHECK(after.bytesInUse == before.bytesInUse);
+    }
+
+    SECTION("setAllocator()")
+    {
+        CountingResource resource;
+        sf::setAllocator(&resource);
+        CHECK(sf::getAllocator() == &resource);
+
+        SystemVector<int> vector(4);
+        sf::setAllocator(nullptr);
+        CHECK(sf::getAllocator() == nullptr);
+
+        // The resource captured at construction keeps being used
+        CHECK(vector.get_allocator().getResource() == &resource);
+        vector.resize(1000);
+        CHECK(resource.allocations == 2);
+        CHECK(resource.deallocations == 1);
+
+        SystemVector<int> other;
+        CHECK(other.get_allocator() != vector.get_allocator());
+        other = std::move(vector);
+        CHECK(other.get_allocator().getResource() == &resource);
+        other = SystemVector<int>();
+        CHECK(resource.deallocations == 2);
+    }
+}
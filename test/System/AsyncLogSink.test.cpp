@@ -0,0 +1,101 @@
+#include <SFML/System/AsyncLogSink.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+class RecordingSink : public sf::LogSink
+{
+public:
+    void write(sf::LogSeverity severity, std::string_view message) override
+    {
+        const std::lock_guard lock(mutex);
+        messages.emplace_back(severity, message);
+    }
+
+    std::mutex                                           mutex;
+    std::vector<std::pair<sf::LogSeverity, std::string>> messages;
+};
+} // namespace
+
+TEST_CASE("[System] sf::AsyncLogSink")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::LogSink, sf::AsyncLogSink>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AsyncLogSink>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AsyncLogSink>);
+    }
+
+    RecordingSink target;
+
+    SECTION("write()")
+    {
+        sf::AsyncLogSink sink(&target);
+        sink.write(sf::LogSeverity::Warning, "first");
+        sink.write(sf::LogSeverity::Error, "second");
+        sink.flush();
+
+        REQUIRE(target.messages.size() == 2);
+        CHECK(target.messages[0] == std::pair(sf::LogSeverity::Warning, std::string("first")));
+        CHECK(target.messages[1] == std::pair(sf::LogSeverity::Error, std::string("second")));
+        CHECK(sink.getDroppedCount() == 0);
+    }
+
+    SECTION("Several threads")
+    {
+        {
+            sf::AsyncLogSink         sink(&target, 4096);
+            std::vector<std::thread> threads;
+            for (int i = 0; i < 4; ++i)
+                threads.emplace_back(
+                    [&sink, i]
+                    {
+                        for (int j = 0; j < 100; ++j)
+                            sink.write(sf::LogSeverity::Info, std::to_string(i * 100 + j));
+                    });
+
+            for (std::thread& thread : threads)
+                thread.join();
+        }
+
+        CHECK(target.messages.size() == 400);
+    }
+
+    SECTION("setRateLimit()")
+    {
+        {
+            sf::AsyncLogSink sink(&target);
+            sink.setRateLimit(2, sf::seconds(60));
+            for (int i = 0; i < 10; ++i)
+                sink.write(sf::LogSeverity::Error, "repeated");
+            sink.write(sf::LogSeverity::Error, "other");
+            sink.flush();
+
+            REQUIRE(target.messages.size() == 3);
+            CHECK(target.messages[2].second == "other");
+        }
+
+        // The suppressed messages are reported when the sink is destroyed, at the latest
+        REQUIRE(target.messages.size() == 4);
+        CHECK(target.messages[3].second == "repeated (repeated 8 more times)");
+    }
+
+    SECTION("No rate limit")
+    {
+        sf::AsyncLogSink sink(&target);
+        sink.setRateLimit(0, sf::seconds(1));
+        for (int i = 0; i < 10; ++i)
+            sink.write(sf::LogSeverity::Error, "repeated");
+        sink.flush();
+
+        CHECK(target.messages.size() == 10);
+    }
+}
@@ -0,0 +1,58 @@
+#include <SFML/System/Checksum.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[System] sf::crc32c")
+{
+    SECTION("Known values")
+    {
+        CHECK(sf::crc32c(nullptr, 0) == 0);
+        CHECK(sf::crc32c("a", 1) == 0xC1D04330);
+        CHECK(sf::crc32c("123456789", 9) == 0xE3069283);
+    }
+
+    SECTION("Split data")
+    {
+        std::array<std::uint8_t, 100> data{};
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 7 + 3);
+
+        const std::uint32_t crc = sf::crc32c(data.data(), data.size());
+        for (const std::size_t split : {0, 1, 7, 8, 33, 99, 100})
+            CHECK(sf::crc32c(data.data() + split, data.size() - split, sf::crc32c(data.data(), split)) == crc);
+    }
+}
+
+TEST_CASE("[System] sf::hash64")
+{
+    SECTION("Known values")
+    {
+        CHECK(sf::hash64(nullptr, 0) == 0xEF46DB3751D8E999);
+        CHECK(sf::hash64("abc", 3) == 0x44BC2CF5AD770999);
+        CHECK(sf::hash64("The quick brown fox jumps over the lazy dog", 43) == 0x0B242D361FDA71BC);
+    }
+
+    SECTION("Every length")
+    {
+        // Exercise the stripes of 32 bytes as well as all the tails
+        constexpr std::string_view text = "The quick brown fox jumps over the lazy dog, then naps in the sun";
+        for (std::size_t size = 1; size <= text.size(); ++size)
+        {
+            CHECK(sf::hash64(text.data(), size) != sf::hash64(text.data(), size - 1));
+            CHECK(sf::hash64(text.data(), size) == sf::hash64(std::string(text.substr(0, size)).data(), size));
+        }
+    }
+
+    SECTION("Seed")
+    {
+        CHECK(sf::hash64("abc", 3, 1) != sf::hash64("abc", 3));
+        CHECK(sf::hash64("abc", 3, 1) == sf::hash64("abc", 3, 1));
+    }
+}
@@ -3,13 +3,32 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class RecordingSink : public sf::LogSink
+{
+public:
+    void write(sf::LogSeverity severity, std::string_view message) override
+    {
+        severities.push_back(severity);
+        messages.emplace_back(message);
+    }
+
+    std::vector<sf::LogSeverity> severities;
+    std::vector<std::string>     messages;
+};
+} // namespace
 
 TEST_CASE("[System] sf::err")
 {
-    SECTION("Overflow default buffer")
+    SECTION("Long message")
     {
         // No assertion macros in this section since nothing about this can be directly observed.
-        // Intention is to ensure DefaultErrStreamBuf::overflow gets called.
+        // Intention is to ensure messages longer than any fixed-size buffer are gathered.
         sf::err() << "SFML is a simple, fast, cross-platform and object-oriented multimedia API."
                      "It provides access to windowing, graphics, audio and network."
                      "It is written in C++, and has bindings for various languages such as C, .Net, Ruby, Python.";
@@ -38,4 +57,34 @@ TEST_CASE("[System] sf::err")
         sf::err().rdbuf(defaultStreamBuffer);
         CHECK(sf::err().rdbuf() == defaultStreamBuffer);
     }
+
+    SECTION("setLogSink()")
+    {
+        CHECK(sf::getLogSink() == nullptr);
+
+        RecordingSink sink;
+        sf::setLogSink(&sink);
+        CHECK(sf::getLogSink() == &sink);
+
+        sf::err() << "Multi-line\nmessage" << std::endl;
+        sf::err(sf::LogSeverity::Warning) << "Warning " << 42 << std::endl;
+        sf::err() << "Not flushed yet";
+        CHECK(sink.messages.size() == 2);
+
+        // Messages of different threads don't mix
+        std::thread([] { sf::err() << "From another thread" << std::endl; }).join();
+        sf::err() << std::flush;
+
+        sf::setLogSink(nullptr);
+        CHECK(sf::getLogSink() == nullptr);
+
+        const std::vector<std::string>
+            messages{"Multi-line\nmessage", "Warning 42", "From another thread", "Not flushed yet"};
+        const std::vector<sf::LogSeverity> severities{sf::LogSeverity::Error,
+                                                      sf::LogSeverity::Warning,
+                                                      sf::LogSeverity::Error,
+                                                      sf::LogSeverity::Error};
+        CHECK(sink.messages == messages);
+        CHECK(sink.severities == severities);
+    }
 }
@@ -0,0 +1,41 @@
+#include <SFML/System/FastClock.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Clock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <thread>
+#include <type_traits>
+
+TEST_CASE("[System] sf::FastClock")
+{
+    using namespace std::chrono_literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(sf::FastClock::is_steady);
+        STATIC_CHECK(std::is_same_v<sf::FastClock::duration, std::chrono::nanoseconds>);
+        STATIC_CHECK(std::is_same_v<sf::FastClock::time_point::clock, sf::FastClock>);
+    }
+
+    SECTION("now()")
+    {
+        const auto first  = sf::FastClock::now();
+        const auto second = sf::FastClock::now();
+        CHECK(second >= first);
+
+        const sf::Clock clock;
+        std::this_thread::sleep_for(10ms);
+        const sf::Time elapsed = sf::FastClock::toTime(sf::FastClock::now() - second);
+        CHECK(elapsed >= 10ms);
+        CHECK(elapsed <= clock.getElapsedTime() + 1ms);
+    }
+
+    SECTION("toTime()")
+    {
+        STATIC_CHECK(sf::FastClock::toTime(std::chrono::nanoseconds(1999)) == sf::microseconds(1));
+        STATIC_CHECK(sf::FastClock::toTime(2s) == sf::seconds(2));
+    }
+}
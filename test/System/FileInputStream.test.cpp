@@ -79,6 +79,7 @@ TEST_CASE("[System] sf::FileInputStream")
         CHECK(fileInputStream.seek(0) == -1);
         CHECK(fileInputStream.tell() == -1);
         CHECK(fileInputStream.getSize() == -1);
+        CHECK(fileInputStream.readAsync(0, nullptr, 0).get() == -1);
     }
 
     const TemporaryFile temporaryFile("Hello world");
@@ -123,4 +124,30 @@ TEST_CASE("[System] sf::FileInputStream")
         CHECK(fileInputStream.seek(6) == 6);
         CHECK(fileInputStream.tell() == 6);
     }
+
+    SECTION("readAsync()")
+    {
+        sf::FileInputStream fileInputStream;
+        REQUIRE(fileInputStream.open(temporaryFile.getPath()));
+        CHECK(fileInputStream.seek(2) == 2);
+
+        char otherBuffer[32];
+        auto first  = fileInputStream.readAsync(6, buffer, 32);
+        auto second = fileInputStream.readAsync(0, otherBuffer, 5);
+        CHECK(first.get() == 5);
+        CHECK(second.get() == 5);
+        CHECK(std::string_view(buffer, 5) == "world"sv);
+        CHECK(std::string_view(otherBuffer, 5) == "Hello"sv);
+
+        // The reading position is left unchanged
+        CHECK(fileInputStream.tell() == 2);
+        CHECK(fileInputStream.readAsync(20, buffer, 5).get() == 0);
+        CHECK(fileInputStream.readAsync(-1, buffer, 5).get() == -1);
+
+        // Pending reads don't need the stream
+        auto pending = fileInputStream.readAsync(0, buffer, 11);
+        CHECK(fileInputStream.open(temporaryFile.getPath()));
+        CHECK(pending.get() == 11);
+        CHECK(std::string_view(buffer, 11) == "Hello world"sv);
+    }
 }
@@ -0,0 +1,178 @@
+#include <SFML/System/FileSystem.hpp>
+
+// Other 1st party headers
+#include <SFML/System/InputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include <cassert>
+
+namespace
+{
+// Directory of temporary files, deleted with its contents
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory() : m_path(std::filesystem::temp_directory_path() / "sfmlfilesystemtemp")
+    {
+        std::filesystem::remove_all(m_path);
+        [[maybe_unused]] const bool created = std::filesystem::create_directories(m_path);
+        assert(created && "m_path failed to be created");
+    }
+
+    ~TemporaryDirectory()
+    {
+        std::filesystem::remove_all(m_path);
+    }
+
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+
+    std::filesystem::path write(const std::string& name, const std::string& contents) const
+    {
+        const std::filesystem::path path = m_path / name;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+    const std::filesystem::path& getPath() const
+    {
+        return m_path;
+    }
+
+private:
+    std::filesystem::path m_path;
+};
+
+std::string readAll(sf::InputStream& stream)
+{
+    std::string contents(static_cast<std::size_t>(stream.getSize()), '\0');
+    if (stream.read(contents.data(), stream.getSize()) != stream.getSize())
+        return {};
+    return contents;
+}
+} // namespace
+
+TEST_CASE("[System] sf::FileSystem")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::FileSystem>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::FileSystem>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::FileSystem>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::FileSystem>);
+    }
+
+    const TemporaryDirectory directory;
+    const std::string        large(100'000, 'x');
+    const auto               text    = directory.write("source/text.txt", "Hello world");
+    const auto               repeats = directory.write("source/large.txt", large);
+    const auto               empty   = directory.write("source/empty.txt", "");
+    const auto               archive = directory.getPath() / "archive.pak";
+
+    sf::FileSystem fileSystem;
+
+    SECTION("Empty file system")
+    {
+        CHECK(!fileSystem.exists("text.txt"));
+        CHECK(fileSystem.open("text.txt") == nullptr);
+    }
+
+    SECTION("Archive")
+    {
+        REQUIRE(sf::FileSystem::createArchive(archive,
+                                              {{"text.txt", text},
+                                               {"data/large.txt", repeats, true},
+                                               {"./data//empty.txt", empty, true, true},
+                                               {"compressed.txt", text, true}}));
+
+        // Most of the archive is the compressed large file
+        CHECK(std::filesystem::file_size(archive) < 1000);
+
+        REQUIRE(fileSystem.mountArchive(archive));
+        CHECK(fileSystem.exists("text.txt"));
+        CHECK(fileSystem.exists("data/large.txt"));
+        CHECK(fileSystem.exists("data/empty.txt"));
+        CHECK(!fileSystem.exists("large.txt"));
+        CHECK(!fileSystem.exists("data"));
+
+        const auto textStream = fileSystem.open("text.txt");
+        REQUIRE(textStream != nullptr);
+        CHECK(readAll(*textStream) == "Hello world");
+
+        const auto largeStream = fileSystem.open("/data/large.txt");
+        REQUIRE(largeStream != nullptr);
+        CHECK(readAll(*largeStream) == large);
+
+        const auto emptyStream = fileSystem.open("data/empty.txt");
+        REQUIRE(emptyStream != nullptr);
+        CHECK(emptyStream->getSize() == 0);
+
+        const auto compressedStream = fileSystem.open("compressed.txt");
+        REQUIRE(compressedStream != nullptr);
+        CHECK(readAll(*compressedStream) == "Hello world");
+
+        // Streams keep the archive alive
+        fileSystem.unmount("");
+        CHECK(!fileSystem.exists("text.txt"));
+        CHECK(textStream->seek(6) == 6);
+        CHECK(readAll(*largeStream).empty());
+        CHECK(largeStream->seek(0) == 0);
+        CHECK(readAll(*largeStream) == large);
+    }
+
+    SECTION("Directory")
+    {
+        REQUIRE(fileSystem.mountDirectory(directory.getPath() / "source", "assets"));
+        CHECK(fileSystem.exists("assets/text.txt"));
+        CHECK(!fileSystem.exists("text.txt"));
+        CHECK(!fileSystem.exists("assets/../source/text.txt"));
+
+        const auto stream = fileSystem.open("assets/text.txt");
+        REQUIRE(stream != nullptr);
+        CHECK(readAll(*stream) == "Hello world");
+
+        CHECK(!fileSystem.mountDirectory(directory.getPath() / "missing"));
+        CHECK(!fileSystem.mountDirectory(text));
+    }
+
+    SECTION("Mount points")
+    {
+        const auto patch = directory.write("patch/text.txt", "Patched");
+        REQUIRE(sf::FileSystem::createArchive(archive, {{"text.txt", text}}));
+        REQUIRE(fileSystem.mountArchive(archive, "assets/"));
+        REQUIRE(fileSystem.mountDirectory(patch.parent_path(), "assets"));
+
+        // The directory mounted last overrides the archive
+        const auto patched = fileSystem.open("assets/text.txt");
+        REQUIRE(patched != nullptr);
+        CHECK(readAll(*patched) == "Patched");
+
+        fileSystem.unmount("/assets");
+        CHECK(!fileSystem.exists("assets/text.txt"));
+
+        CHECK(!fileSystem.mountArchive(archive, "../assets"));
+    }
+
+    SECTION("Invalid archives")
+    {
+        CHECK(!sf::FileSystem::createArchive(archive, {{"text.txt", text}, {"./text.txt", empty}}));
+        CHECK(!sf::FileSystem::createArchive(archive, {{"../text.txt", text}}));
+        CHECK(!sf::FileSystem::createArchive(archive, {{"missing.txt", directory.getPath() / "missing.txt"}}));
+
+        CHECK(!fileSystem.mountArchive(directory.getPath() / "missing.pak"));
+        CHECK(!fileSystem.mountArchive(text));
+
+        // Truncated archive
+        REQUIRE(sf::FileSystem::createArchive(archive, {{"text.txt", text}}));
+        std::filesystem::resize_file(archive, 40);
+        CHECK(!fileSystem.mountArchive(archive));
+    }
+}
@@ -0,0 +1,110 @@
+#include <SFML/System/FixedStepLoop.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <chrono>
+#include <type_traits>
+
+TEST_CASE("[System] sf::FixedStepLoop")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::FixedStepLoop>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::FixedStepLoop>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::FixedStepLoop>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::FixedStepLoop loop(sf::milliseconds(10));
+        CHECK(loop.getStep() == sf::milliseconds(10));
+        CHECK(loop.getMaxStepsPerFrame() == 8);
+        CHECK(loop.getStepCount() == 0);
+        CHECK(loop.getSimulationTime() == sf::Time::Zero);
+        CHECK(loop.getDroppedTime() == sf::Time::Zero);
+        CHECK(loop.getAlpha() == 0.f);
+
+        const sf::FixedStepLoop clamped(sf::Time::Zero, 0);
+        CHECK(clamped.getStep() == sf::microseconds(1));
+        CHECK(clamped.getMaxStepsPerFrame() == 1);
+    }
+
+    SECTION("advance(Time)")
+    {
+        sf::FixedStepLoop loop(sf::milliseconds(10));
+        CHECK(loop.advance(sf::milliseconds(4)) == 0);
+        CHECK(loop.getAlpha() == Approx(0.4f));
+        CHECK(loop.advance(sf::milliseconds(7)) == 1);
+        CHECK(loop.getAlpha() == Approx(0.1f));
+        CHECK(loop.advance(sf::milliseconds(29)) == 3);
+        CHECK(loop.getAlpha() == 0.f);
+        CHECK(loop.advance(sf::milliseconds(-5)) == 0);
+        CHECK(loop.getStepCount() == 4);
+        CHECK(loop.getSimulationTime() == sf::milliseconds(40));
+    }
+
+    SECTION("No drift")
+    {
+        // A step of 1/60 s rounded to the microsecond needs a remainder carried over almost every frame
+        sf::FixedStepLoop loop(sf::microseconds(16'667));
+        unsigned int      steps = 0;
+        for (int i = 0; i < 50'001; ++i)
+            steps += loop.advance(sf::milliseconds(1));
+        CHECK(steps == 3000);
+        CHECK(loop.getSimulationTime() == sf::microseconds(50'001'000));
+        CHECK(loop.getAlpha() == 0.f);
+    }
+
+    SECTION("Catch-up limit")
+    {
+        sf::FixedStepLoop loop(sf::milliseconds(10), 3);
+        CHECK(loop.advance(sf::milliseconds(105)) == 3);
+        CHECK(loop.getDroppedTime() == sf::milliseconds(70));
+        CHECK(loop.getAlpha() == Approx(0.5f));
+        CHECK(loop.advance(sf::milliseconds(5)) == 1);
+        CHECK(loop.getStepCount() == 4);
+
+        loop.setMaxStepsPerFrame(0);
+        CHECK(loop.getMaxStepsPerFrame() == 1);
+    }
+
+    SECTION("setStep()")
+    {
+        sf::FixedStepLoop loop(sf::milliseconds(10));
+        CHECK(loop.advance(sf::milliseconds(8)) == 0);
+        loop.setStep(sf::milliseconds(4));
+        CHECK(loop.getStep() == sf::milliseconds(4));
+        CHECK(loop.advance(sf::Time::Zero) == 2);
+        CHECK(loop.getStepCount() == 2);
+    }
+
+    SECTION("reset()")
+    {
+        sf::FixedStepLoop loop(sf::milliseconds(10));
+        CHECK(loop.advance(sf::milliseconds(25)) == 2);
+        loop.reset();
+        CHECK(loop.getAlpha() == 0.f);
+        CHECK(loop.getStepCount() == 2);
+    }
+
+    SECTION("waitForNextStep()")
+    {
+        sf::FixedStepLoop loop(sf::milliseconds(5));
+
+        const auto   begin = std::chrono::steady_clock::now();
+        unsigned int steps = 0;
+        for (int i = 0; i < 10; ++i)
+        {
+            loop.waitForNextStep();
+            const unsigned int frameSteps = loop.advance();
+            CHECK(frameSteps >= 1);
+            steps += frameSteps;
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+        CHECK(steps >= 10);
+        CHECK(elapsed >= std::chrono::milliseconds(50));
+        CHECK(elapsed < std::chrono::milliseconds(200));
+    }
+}
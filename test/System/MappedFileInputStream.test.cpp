@@ -0,0 +1,143 @@
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+
+namespace
+{
+std::filesystem::path getTemporaryFilePath()
+{
+    static int counter = 0;
+
+    std::ostringstream oss;
+    oss << "sfmlmappedtemp" << counter++ << ".tmp";
+
+    return std::filesystem::temp_directory_path() / oss.str();
+}
+
+class TemporaryFile
+{
+public:
+    // Create a temporary file with a randomly generated path, containing 'contents'.
+    TemporaryFile(const std::string& contents) : m_path(getTemporaryFilePath())
+    {
+        std::ofstream ofs(m_path);
+        assert(ofs && "Stream encountered an error");
+
+        ofs << contents;
+        assert(ofs && "Stream encountered an error");
+    }
+
+    // Close and delete the generated file.
+    ~TemporaryFile()
+    {
+        [[maybe_unused]] const bool removed = std::filesystem::remove(m_path);
+        assert(removed && "m_path failed to be removed from filesystem");
+    }
+
+    // Prevent copies.
+    TemporaryFile(const TemporaryFile&) = delete;
+
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    // Return the randomly generated path.
+    const std::filesystem::path& getPath() const
+    {
+        return m_path;
+    }
+
+private:
+    std::filesystem::path m_path;
+};
+} // namespace
+
+TEST_CASE("[System] sf::MappedFileInputStream")
+{
+    using namespace std::string_view_literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::MappedFileInputStream>);
+    }
+
+    SECTION("Default constructor")
+    {
+        sf::MappedFileInputStream mappedFileInputStream;
+        CHECK(mappedFileInputStream.read(nullptr, 0) == -1);
+        CHECK(mappedFileInputStream.seek(0) == -1);
+        CHECK(mappedFileInputStream.tell() == -1);
+        CHECK(mappedFileInputStream.getSize() == -1);
+        CHECK(mappedFileInputStream.getData() == nullptr);
+    }
+
+    const TemporaryFile temporaryFile("Hello world");
+    char                buffer[32];
+
+    SECTION("Move semantics")
+    {
+        SECTION("Move constructor")
+        {
+            sf::MappedFileInputStream movedMappedFileInputStream;
+            REQUIRE(movedMappedFileInputStream.open(temporaryFile.getPath()));
+
+            sf::MappedFileInputStream mappedFileInputStream = std::move(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer, 6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+            CHECK(mappedFileInputStream.getSize() == 11);
+            CHECK(std::string_view(buffer, 6) == "Hello "sv);
+        }
+
+        SECTION("Move assignment")
+        {
+            sf::MappedFileInputStream movedMappedFileInputStream;
+            REQUIRE(movedMappedFileInputStream.open(temporaryFile.getPath()));
+
+            sf::MappedFileInputStream mappedFileInputStream;
+            mappedFileInputStream = std::move(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer, 6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+            CHECK(mappedFileInputStream.getSize() == 11);
+            CHECK(std::string_view(buffer, 6) == "Hello "sv);
+        }
+    }
+
+    SECTION("open()")
+    {
+        sf::MappedFileInputStream mappedFileInputStream;
+        CHECK(!mappedFileInputStream.open("does/not/exist.txt"));
+        CHECK(mappedFileInputStream.getSize() == -1);
+
+        const TemporaryFile emptyFile("");
+        REQUIRE(mappedFileInputStream.open(emptyFile.getPath()));
+        CHECK(mappedFileInputStream.getSize() == 0);
+        CHECK(mappedFileInputStream.getData() == nullptr);
+        CHECK(mappedFileInputStream.read(buffer, 5) == 0);
+    }
+
+    SECTION("Temporary file stream")
+    {
+        sf::MappedFileInputStream mappedFileInputStream;
+        REQUIRE(mappedFileInputStream.open(temporaryFile.getPath()));
+        CHECK(std::string_view(static_cast<const char*>(mappedFileInputStream.getData()), 11) == "Hello world"sv);
+        CHECK(mappedFileInputStream.read(buffer, 5) == 5);
+        CHECK(mappedFileInputStream.tell() == 5);
+        CHECK(mappedFileInputStream.getSize() == 11);
+        CHECK(std::string_view(buffer, 5) == "Hello"sv);
+        CHECK(mappedFileInputStream.seek(6) == 6);
+        CHECK(mappedFileInputStream.tell() == 6);
+        CHECK(mappedFileInputStream.read(buffer, 32) == 5);
+        CHECK(std::string_view(buffer, 5) == "world"sv);
+    }
+}
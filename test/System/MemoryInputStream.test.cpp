@@ -24,6 +24,7 @@ TEST_CASE("[System] sf::MemoryInputStream")
         CHECK(mis.seek(0) == -1);
         CHECK(mis.tell() == -1);
         CHECK(mis.getSize() == -1);
+        CHECK(mis.getData() == nullptr);
     }
 
     SECTION("Open memory stream")
@@ -39,5 +40,21 @@ TEST_CASE("[System] sf::MemoryInputStream")
         CHECK(mis.seek(10) == 10);
         CHECK(mis.tell() == 10);
         CHECK(mis.getSize() == 11);
+        CHECK(mis.getData() == memoryContents.data());
+    }
+
+    SECTION("readAsync()")
+    {
+        using namespace std::literals::string_view_literals;
+        constexpr auto        memoryContents = "hello world"sv;
+        sf::MemoryInputStream mis;
+        CHECK(mis.readAsync(0, nullptr, 0).get() == -1);
+
+        mis.open(memoryContents.data(), sizeof(char) * memoryContents.size());
+        std::array<char, 32> buffer{};
+        CHECK(mis.readAsync(6, buffer.data(), 32).get() == 5);
+        CHECK(std::string_view(buffer.data(), 5) == "world"sv);
+        CHECK(mis.tell() == 0);
+        CHECK(mis.readAsync(20, buffer.data(), 5).get() == 0);
     }
 }
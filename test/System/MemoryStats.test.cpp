@@ -0,0 +1,83 @@
+#include <SFML/System/MemoryStats.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+// No object of this category is created by the System module itself
+constexpr auto category = sf::MemoryStats::Category::Socket;
+using Counter           = sf::priv::MemoryCounter<category>;
+} // namespace
+
+TEST_CASE("[System] sf::MemoryStats")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_aggregate_v<sf::MemoryStats::Statistics>);
+        STATIC_CHECK(std::is_nothrow_copy_constructible_v<Counter>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<Counter>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<Counter>);
+    }
+
+    const sf::MemoryStats::Statistics before = sf::MemoryStats::getStatistics(category);
+    const std::uint64_t               total  = sf::MemoryStats::getTotalUsage();
+
+    SECTION("Objects and bytes")
+    {
+        {
+            Counter counter;
+            sf::MemoryStats::Statistics statistics = sf::MemoryStats::getStatistics(category);
+            CHECK(statistics.objectCount == before.objectCount + 1);
+            CHECK(statistics.bytes == before.bytes);
+
+            counter.setBytes(100);
+            CHECK(counter.getBytes() == 100);
+            statistics = sf::MemoryStats::getStatistics(category);
+            CHECK(statistics.bytes == before.bytes + 100);
+            CHECK(statistics.peakBytes >= before.bytes + 100);
+            CHECK(sf::MemoryStats::getTotalUsage() == total + 100);
+
+            counter.setBytes(40);
+            statistics = sf::MemoryStats::getStatistics(category);
+            CHECK(statistics.bytes == before.bytes + 40);
+            CHECK(statistics.peakBytes >= before.bytes + 100);
+        }
+
+        const sf::MemoryStats::Statistics after = sf::MemoryStats::getStatistics(category);
+        CHECK(after.objectCount == before.objectCount);
+        CHECK(after.peakObjectCount >= before.objectCount + 1);
+        CHECK(after.bytes == before.bytes);
+    }
+
+    SECTION("Copy and move")
+    {
+        {
+            Counter original;
+            original.setBytes(10);
+
+            const Counter copy = original;
+            CHECK(copy.getBytes() == 10);
+            CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes + 20);
+
+            Counter moved = std::move(original);
+            CHECK(moved.getBytes() == 10);
+            CHECK(sf::MemoryStats::getStatistics(category).objectCount == before.objectCount + 3);
+            CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes + 20);
+
+            Counter assigned;
+            assigned.setBytes(5);
+            assigned = std::move(moved);
+            CHECK(assigned.getBytes() == 10);
+            CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes + 20);
+
+            assigned = copy;
+            CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes + 20);
+        }
+
+        CHECK(sf::MemoryStats::getStatistics(category).objectCount == before.objectCount);
+        CHECK(sf::MemoryStats::getStatistics(category).bytes == before.bytes);
+    }
+}
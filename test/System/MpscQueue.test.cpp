@@ -0,0 +1,109 @@
+#include <SFML/System/MpscQueue.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[System] sf::MpscQueue")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::MpscQueue<int>>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::MpscQueue<int>>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::MpscQueue<int>>);
+    }
+
+    SECTION("Construction")
+    {
+        CHECK(sf::MpscQueue<int>(0).getCapacity() == 2);
+        CHECK(sf::MpscQueue<int>(8).getCapacity() == 8);
+        CHECK(sf::MpscQueue<int>(100).getCapacity() == 128);
+    }
+
+    SECTION("push() and pop()")
+    {
+        sf::MpscQueue<int> queue(4);
+        int                value = 0;
+        CHECK(!queue.pop(value));
+
+        for (int i = 1; i <= 4; ++i)
+            CHECK(queue.push(i));
+        CHECK(!queue.push(5));
+
+        for (int i = 1; i <= 4; ++i)
+        {
+            CHECK(queue.pop(value));
+            CHECK(value == i);
+        }
+        CHECK(!queue.pop(value));
+
+        // Wrap around the end of the buffer
+        for (int i = 0; i < 10; ++i)
+        {
+            CHECK(queue.push(i));
+            CHECK(queue.pop(value));
+            CHECK(value == i);
+        }
+    }
+
+    SECTION("Move-only elements")
+    {
+        sf::MpscQueue<std::unique_ptr<int>> queue(2);
+        CHECK(queue.push(std::make_unique<int>(42)));
+        CHECK(queue.push(std::make_unique<int>(0)));
+
+        auto rejected = std::make_unique<int>(1);
+        CHECK(!queue.push(std::move(rejected)));
+        CHECK(rejected != nullptr);
+
+        std::unique_ptr<int> popped;
+        CHECK(queue.pop(popped));
+        CHECK(*popped == 42);
+    }
+
+    SECTION("Concurrent producers")
+    {
+        constexpr unsigned int      producerCount = 4;
+        constexpr unsigned int      count         = 50'000;
+        sf::MpscQueue<unsigned int> queue(64);
+
+        std::vector<std::thread> producers;
+        for (unsigned int producer = 0; producer < producerCount; ++producer)
+        {
+            producers.emplace_back(
+                [&queue, producer]
+                {
+                    for (unsigned int i = 0; i < count;)
+                    {
+                        if (queue.push(producer * count + i))
+                            ++i;
+                    }
+                });
+        }
+
+        // Elements of each producer come out in the order they were pushed
+        std::array<unsigned int, producerCount> next{};
+        bool                                    ordered  = true;
+        unsigned int                            received = 0;
+        while (received < producerCount * count)
+        {
+            unsigned int value = 0;
+            if (queue.pop(value))
+            {
+                const unsigned int producer = value / count;
+                ordered                     = ordered && (value % count == next[producer]++);
+                ++received;
+            }
+        }
+
+        for (std::thread& producer : producers)
+            producer.join();
+
+        CHECK(ordered);
+        CHECK(!queue.pop(received));
+    }
+}
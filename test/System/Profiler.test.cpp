@@ -0,0 +1,45 @@
+#include <SFML/System/Profiler.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+namespace
+{
+class NullSink : public sf::ProfilerSink
+{
+public:
+    void beginZone(const char*) override
+    {
+    }
+
+    void endZone() override
+    {
+    }
+};
+} // namespace
+
+TEST_CASE("[System] sf::Profiler")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_abstract_v<sf::ProfilerSink>);
+        STATIC_CHECK(std::has_virtual_destructor_v<sf::ProfilerSink>);
+    }
+
+    SECTION("isAvailable()")
+    {
+        CHECK(sf::Profiler::isAvailable() == EXPECTED_SFML_PROFILING_AVAILABLE);
+    }
+
+    SECTION("setSink()")
+    {
+        CHECK(sf::Profiler::getSink() == nullptr);
+
+        NullSink sink;
+        sf::Profiler::setSink(&sink);
+        CHECK(sf::Profiler::getSink() == &sink);
+        sf::Profiler::setSink(nullptr);
+        CHECK(sf::Profiler::getSink() == nullptr);
+    }
+}
@@ -0,0 +1,205 @@
+#include <SFML/System/ResourceCache.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <future>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+// Resource counting how many times it is loaded
+struct Resource
+{
+    static std::optional<Resource> loadFromFile(const std::filesystem::path& filename, int value = 0)
+    {
+        ++loadCount;
+        if (filename.filename() == "missing.txt")
+            return std::nullopt;
+        return Resource{filename.filename().string(), value};
+    }
+
+    static std::optional<Resource> loadFromMemory(const void* data, std::size_t size)
+    {
+        ++loadCount;
+        return Resource{std::string(static_cast<const char*>(data), size), 0};
+    }
+
+    std::string name;
+    int         value{};
+
+    static inline int loadCount{};
+};
+} // namespace
+
+TEST_CASE("[System] sf::ResourceCache")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ResourceCache<Resource>>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ResourceCache<Resource>>);
+    }
+
+    Resource::loadCount = 0;
+    sf::ResourceCache<Resource> cache([](const Resource& resource) { return resource.name.size(); });
+
+    SECTION("Construction")
+    {
+        const sf::ResourceCache<Resource>::Statistics statistics = cache.getStatistics();
+        CHECK(statistics.hits == 0);
+        CHECK(statistics.misses == 0);
+        CHECK(statistics.resourceCount == 0);
+        CHECK(statistics.memory == 0);
+        CHECK(cache.getKeepAlive());
+        CHECK(!cache.contains("key"));
+        CHECK(cache.get("key") == nullptr);
+    }
+
+    SECTION("load()")
+    {
+        const auto first = cache.load("key", [] { return std::optional<Resource>(Resource{"first", 1}); });
+        const auto second = cache.load("key", [] { return std::optional<Resource>(Resource{"second", 2}); });
+        REQUIRE(first);
+        CHECK(first == second);
+        CHECK(first->name == "first");
+        CHECK(cache.contains("key"));
+        CHECK(cache.get("key") == first);
+
+        const sf::ResourceCache<Resource>::Statistics statistics = cache.getStatistics();
+        CHECK(statistics.hits == 1);
+        CHECK(statistics.misses == 1);
+        CHECK(statistics.resourceCount == 1);
+        CHECK(statistics.memory == 5);
+    }
+
+    SECTION("loadFromFile()")
+    {
+        const auto first  = cache.loadFromFile("resource.txt", 3);
+        const auto second = cache.loadFromFile("./directory/../resource.txt");
+        REQUIRE(first);
+        CHECK(first == second);
+        CHECK(first->value == 3);
+        CHECK(Resource::loadCount == 1);
+        CHECK(cache.contains(cache.getFileKey("resource.txt")));
+        CHECK(cache.getFileKey("resource.txt") != cache.getFileKey("other.txt"));
+
+        // Failed loads are not cached
+        CHECK(cache.loadFromFile("missing.txt") == nullptr);
+        CHECK(cache.loadFromFile("missing.txt") == nullptr);
+        CHECK(Resource::loadCount == 3);
+        CHECK(cache.getStatistics().resourceCount == 1);
+    }
+
+    SECTION("loadFromMemory()")
+    {
+        const std::string data  = "content";
+        const std::string copy  = data;
+        const std::string other = "contenu";
+
+        const auto first = cache.loadFromMemory(data.data(), data.size());
+        REQUIRE(first);
+        CHECK(cache.loadFromMemory(copy.data(), copy.size()) == first);
+        CHECK(cache.loadFromMemory(other.data(), other.size()) != first);
+        CHECK(Resource::loadCount == 2);
+        CHECK(cache.getMemoryKey(data.data(), data.size()) == cache.getMemoryKey(copy.data(), copy.size()));
+        CHECK(cache.getMemoryKey(data.data(), 3) != cache.getMemoryKey(data.data(), 4));
+    }
+
+    SECTION("loadAsync()")
+    {
+        std::promise<std::optional<Resource>> promise;
+        int                                   startCount = 0;
+        const auto                            start      = [&]
+        {
+            ++startCount;
+            return promise.get_future();
+        };
+
+        cache.loadAsync("key", start);
+        cache.loadAsync("key", start);
+        CHECK(startCount == 1);
+        CHECK(cache.isLoading("key"));
+        CHECK(cache.get("key") == nullptr);
+        CHECK(!cache.contains("key"));
+
+        promise.set_value(Resource{"async", 0});
+        const auto resource = cache.get("key");
+        REQUIRE(resource);
+        CHECK(resource->name == "async");
+        CHECK(!cache.isLoading("key"));
+        CHECK(cache.load("key", [] { return std::optional<Resource>(); }) == resource);
+
+        const sf::ResourceCache<Resource>::Statistics statistics = cache.getStatistics();
+        CHECK(statistics.hits == 2);
+        CHECK(statistics.misses == 1);
+    }
+
+    SECTION("load() waits for the background load")
+    {
+        const auto start = []
+        { return std::async(std::launch::async, [] { return std::optional(Resource{"async", 0}); }); };
+        cache.loadAsync("key", start);
+        const auto resource = cache.load("key", [] { return std::optional(Resource{"sync", 0}); });
+        REQUIRE(resource);
+        CHECK(resource->name == "async");
+        CHECK(cache.wait("key") == resource);
+    }
+
+    SECTION("evictUnused()")
+    {
+        auto used = cache.loadFromFile("used.txt");
+        (void)cache.loadFromFile("unused.txt");
+        CHECK(cache.getStatistics().resourceCount == 2);
+
+        CHECK(cache.evictUnused() == 1);
+        CHECK(cache.contains(cache.getFileKey("used.txt")));
+        CHECK(!cache.contains(cache.getFileKey("unused.txt")));
+
+        used.reset();
+        CHECK(cache.evictUnused() == 1);
+        CHECK(cache.getStatistics().resourceCount == 0);
+    }
+
+    SECTION("setKeepAlive()")
+    {
+        cache.setKeepAlive(false);
+        CHECK(!cache.getKeepAlive());
+
+        auto resource = cache.loadFromFile("weak.txt");
+        CHECK(cache.loadFromFile("weak.txt") == resource);
+        CHECK(Resource::loadCount == 1);
+
+        // The resource dies with its last handle
+        resource.reset();
+        CHECK(!cache.contains(cache.getFileKey("weak.txt")));
+        CHECK(cache.getStatistics().resourceCount == 0);
+        resource = cache.loadFromFile("weak.txt");
+        CHECK(Resource::loadCount == 2);
+
+        // Enabling it again takes ownership of the resources alive
+        cache.setKeepAlive(true);
+        resource.reset();
+        CHECK(cache.contains(cache.getFileKey("weak.txt")));
+    }
+
+    SECTION("remove() and clear()")
+    {
+        const auto resource = cache.loadFromFile("resource.txt");
+        CHECK(cache.remove(cache.getFileKey("resource.txt")));
+        CHECK(!cache.remove(cache.getFileKey("resource.txt")));
+        CHECK(resource->name == "resource.txt");
+        CHECK(cache.loadFromFile("resource.txt") != resource);
+
+        const auto start = [] { return std::async(std::launch::deferred, [] { return std::optional<Resource>(); }); };
+        cache.loadAsync("pending", start);
+        cache.clear();
+        CHECK(!cache.isLoading("pending"));
+        CHECK(cache.getStatistics().resourceCount == 0);
+        CHECK(cache.getStatistics().misses == 3);
+
+        cache.resetStatistics();
+        CHECK(cache.getStatistics().misses == 0);
+    }
+}
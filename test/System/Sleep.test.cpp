@@ -24,3 +24,53 @@ TEST_CASE("[System] sf::sleep")
     CHECK_SLEEP_DURATION(10ms);
     CHECK_SLEEP_DURATION(100ms);
 }
+
+TEST_CASE("[System] sf::sleepPrecise")
+{
+    for (const sf::Time duration : {sf::microseconds(100), sf::milliseconds(1), sf::milliseconds(10)})
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+        sf::sleepPrecise(duration);
+        const auto elapsed = std::chrono::steady_clock::now() - startTime;
+        CHECK(elapsed >= duration.toDuration());
+    }
+
+    // Non-positive durations return immediately
+    const auto startTime = std::chrono::steady_clock::now();
+    sf::sleepPrecise(sf::Time::Zero);
+    sf::sleepPrecise(sf::milliseconds(-100));
+    CHECK(std::chrono::steady_clock::now() - startTime < 50ms);
+}
+
+TEST_CASE("[System] sf::sleepUntil")
+{
+    SECTION("Future deadline")
+    {
+        const auto deadline = std::chrono::steady_clock::now() + 5ms;
+        sf::sleepUntil(deadline);
+        CHECK(std::chrono::steady_clock::now() >= deadline);
+    }
+
+    SECTION("Deadlines of a loop")
+    {
+        // Sleeping until absolute deadlines keeps the lateness of each iteration from piling up
+        const auto start    = std::chrono::steady_clock::now();
+        auto       deadline = start;
+        for (int i = 0; i < 20; ++i)
+        {
+            deadline += 2ms;
+            sf::sleepUntil(deadline);
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        CHECK(elapsed >= 40ms);
+        CHECK(elapsed < 100ms);
+    }
+
+    SECTION("Past deadline")
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+        sf::sleepUntil(startTime - 1s);
+        CHECK(std::chrono::steady_clock::now() - startTime < 50ms);
+    }
+}
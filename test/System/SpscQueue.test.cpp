@@ -0,0 +1,93 @@
+#include <SFML/System/SpscQueue.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <thread>
+
+TEST_CASE("[System] sf::SpscQueue")
+{
+    SECTION("Construction")
+    {
+        const sf::SpscQueue<int, 4> queue;
+        CHECK(queue.isEmpty());
+        STATIC_CHECK(sf::SpscQueue<int, 4>::getCapacity() == 4);
+    }
+
+    SECTION("push() and pop()")
+    {
+        sf::SpscQueue<int, 4> queue;
+        int                   value = 0;
+        CHECK(!queue.pop(value));
+
+        for (int i = 1; i <= 4; ++i)
+            CHECK(queue.push(i));
+        CHECK(!queue.push(5));
+        CHECK(!queue.isEmpty());
+
+        for (int i = 1; i <= 4; ++i)
+        {
+            CHECK(queue.pop(value));
+            CHECK(value == i);
+        }
+        CHECK(!queue.pop(value));
+        CHECK(queue.isEmpty());
+
+        // Wrap around the end of the buffer
+        for (int i = 0; i < 10; ++i)
+        {
+            CHECK(queue.push(i));
+            CHECK(queue.push(i + 100));
+            CHECK(queue.pop(value));
+            CHECK(value == i);
+            CHECK(queue.pop(value));
+            CHECK(value == i + 100);
+        }
+    }
+
+    SECTION("Move-only elements")
+    {
+        sf::SpscQueue<std::unique_ptr<int>, 2> queue;
+        auto                                   pointer = std::make_unique<int>(42);
+        CHECK(queue.push(std::move(pointer)));
+        CHECK(pointer == nullptr);
+
+        CHECK(queue.push(std::make_unique<int>(0)));
+        auto rejected = std::make_unique<int>(1);
+        CHECK(!queue.push(std::move(rejected)));
+        CHECK(rejected != nullptr);
+
+        std::unique_ptr<int> popped;
+        CHECK(queue.pop(popped));
+        CHECK(*popped == 42);
+    }
+
+    SECTION("Concurrent producer and consumer")
+    {
+        constexpr unsigned int          count = 200'000;
+        sf::SpscQueue<unsigned int, 64> queue;
+
+        std::thread producer(
+            [&queue]
+            {
+                for (unsigned int i = 0; i < count;)
+                {
+                    if (queue.push(i))
+                        ++i;
+                }
+            });
+
+        bool         ordered = true;
+        unsigned int next    = 0;
+        while (next < count)
+        {
+            unsigned int value = 0;
+            if (queue.pop(value))
+                ordered = ordered && (value == next++);
+        }
+
+        producer.join();
+        CHECK(ordered);
+        CHECK(queue.isEmpty());
+    }
+}
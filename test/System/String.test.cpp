@@ -5,7 +5,9 @@
 #include <GraphicsUtil.hpp>
 #include <array>
 #include <iomanip>
+#include <iterator>
 #include <sstream>
+#include <string>
 #include <type_traits>
 
 #include <cassert>
@@ -403,6 +405,68 @@ TEST_CASE("[System] sf::String")
         CHECK(string.getData() != nullptr);
     }
 
+    SECTION("Contiguous conversions")
+    {
+        // Mix ASCII runs longer than the vectorized blocks with other characters at every offset
+        std::u32string utf32;
+        for (std::size_t i = 0; i < 40; ++i)
+        {
+            utf32 += std::u32string(i, U'a');
+            utf32 += {U'\xF1', U'\x20AC', U'\x1F600'};
+            utf32 += {static_cast<char32_t>(0xD800 + i), static_cast<char32_t>(0x110000 + i)};
+        }
+
+        SECTION("toUtf8()")
+        {
+            sf::U8String expected;
+            sf::Utf32::toUtf8(utf32.begin(), utf32.end(), std::back_inserter(expected));
+            CHECK(sf::String(utf32).toUtf8() == expected);
+        }
+
+        SECTION("toUtf16()")
+        {
+            std::u16string expected;
+            sf::Utf32::toUtf16(utf32.begin(), utf32.end(), std::back_inserter(expected));
+            CHECK(sf::String(utf32).toUtf16() == expected);
+        }
+
+        SECTION("fromUtf8()")
+        {
+            sf::U8String utf8;
+            sf::Utf32::toUtf8(utf32.begin(), utf32.end(), std::back_inserter(utf8));
+
+            // Also include invalid and truncated sequences
+            for (std::size_t size = 0; size <= utf8.size(); size += 7)
+            {
+                sf::U8String input = utf8.substr(0, size);
+                input += {0xFF, 0x80, 'z', 0xF0, 0x9F};
+
+                std::u32string expected;
+                sf::Utf8::toUtf32(input.begin(), input.end(), std::back_inserter(expected));
+                CHECK(sf::String::fromUtf8(input.data(), input.data() + input.size()).toUtf32() == expected);
+            }
+            const sf::String fromIterators = sf::String::fromUtf8(utf8.begin(), utf8.end());
+            CHECK(fromIterators == sf::String::fromUtf8(utf8.data(), utf8.data() + utf8.size()));
+        }
+
+        SECTION("fromUtf16()")
+        {
+            std::u16string utf16;
+            sf::Utf32::toUtf16(utf32.begin(), utf32.end(), std::back_inserter(utf16));
+
+            // Also include lone and truncated surrogates
+            for (std::size_t size = 0; size <= utf16.size(); size += 5)
+            {
+                std::u16string input = utf16.substr(0, size);
+                input += {0xDC00, u'z', 0xD83D, u'z', 0xD83D};
+
+                std::u32string expected;
+                sf::Utf16::toUtf32(input.begin(), input.end(), std::back_inserter(expected));
+                CHECK(sf::String::fromUtf16(input.data(), input.data() + input.size()).toUtf32() == expected);
+            }
+        }
+    }
+
     SECTION("fromUtf32()")
     {
         constexpr std::array<std::uint32_t, 4> characters{'w', 0x104321, 'y', 'z'};
@@ -0,0 +1,152 @@
+#include <SFML/System/ThreadPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[System] sf::ThreadPool")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ThreadPool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ThreadPool>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::ThreadPool>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ThreadPool pool(3);
+        CHECK(pool.getThreadCount() == 3);
+
+        const sf::ThreadPool minimal(0);
+        CHECK(minimal.getThreadCount() == 1);
+
+        const sf::ThreadPool hardware;
+        CHECK(hardware.getThreadCount() >= 1);
+    }
+
+    SECTION("submit()")
+    {
+        sf::ThreadPool pool(2);
+
+        std::future<int>         answer = pool.submit([] { return 42; });
+        std::future<std::string> text   = pool.submit([] { return std::string("text"); },
+                                                  sf::ThreadPool::Priority::Low);
+        std::future<void>        error  = pool.submit([] { throw std::runtime_error("error"); });
+
+        CHECK(answer.get() == 42);
+        CHECK(text.get() == "text");
+        CHECK_THROWS_AS(error.get(), std::runtime_error);
+    }
+
+    SECTION("Tasks submitted from tasks")
+    {
+        std::atomic<int> count{0};
+        {
+            sf::ThreadPool pool(4);
+            for (int i = 0; i < 100; ++i)
+                (void)pool.submit([&] { (void)pool.submit([&] { ++count; }); });
+
+            // The destructor completes the pending tasks
+        }
+        CHECK(count == 100);
+    }
+
+    SECTION("Priorities")
+    {
+        sf::ThreadPool pool(1);
+
+        // Keep the only worker busy while the other tasks are queued
+        std::promise<void> started;
+        std::promise<void> release;
+        std::future<void>  blocker = pool.submit(
+            [&started, released = release.get_future().share()]
+            {
+                started.set_value();
+                released.wait();
+            });
+        started.get_future().wait();
+
+        std::mutex       mutex;
+        std::vector<int> order;
+        const auto       record = [&](int value)
+        {
+            const std::lock_guard lock(mutex);
+            order.push_back(value);
+        };
+
+        std::future<void> low    = pool.submit([&] { record(3); }, sf::ThreadPool::Priority::Low);
+        std::future<void> normal = pool.submit([&] { record(2); });
+        std::future<void> high   = pool.submit([&] { record(1); }, sf::ThreadPool::Priority::High);
+
+        release.set_value();
+        low.get();
+        normal.get();
+        high.get();
+        blocker.get();
+        CHECK(order == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("parallelFor()")
+    {
+        sf::ThreadPool pool(3);
+
+        std::vector<std::atomic<int>> visits(1000);
+        pool.parallelFor(0, visits.size(), [&](std::size_t i) { ++visits[i]; });
+        for (const std::atomic<int>& visit : visits)
+            CHECK(visit == 1);
+
+        std::atomic<int> calls{0};
+        pool.parallelFor(10, 10, [&](std::size_t) { ++calls; });
+        pool.parallelFor(10, 5, [&](std::size_t) { ++calls; });
+        CHECK(calls == 0);
+
+        pool.parallelFor(7, 8, [&](std::size_t i) { calls += static_cast<int>(i); });
+        CHECK(calls == 7);
+    }
+
+    SECTION("Nested parallelFor()")
+    {
+        sf::ThreadPool   pool(2);
+        std::atomic<int> count{0};
+
+        pool.parallelFor(0, 16, [&](std::size_t) { pool.parallelFor(0, 16, [&](std::size_t) { ++count; }); });
+        CHECK(count == 256);
+
+        std::future<void> task = pool.submit([&] { pool.parallelFor(0, 100, [&](std::size_t) { ++count; }); });
+        task.get();
+        CHECK(count == 356);
+    }
+
+    SECTION("parallelFor() exception")
+    {
+        sf::ThreadPool pool(2);
+        CHECK_THROWS_AS(pool.parallelFor(0,
+                                         100,
+                                         [](std::size_t i)
+                                         {
+                                             if (i == 50)
+                                                 throw std::runtime_error("error");
+                                         }),
+                        std::runtime_error);
+
+        // The pool is still usable
+        std::atomic<int> count{0};
+        pool.parallelFor(0, 10, [&](std::size_t) { ++count; });
+        CHECK(count == 10);
+    }
+
+    SECTION("getGlobal()")
+    {
+        sf::ThreadPool& pool = sf::ThreadPool::getGlobal();
+        CHECK(&pool == &sf::ThreadPool::getGlobal());
+        CHECK(pool.getThreadCount() >= 1);
+        CHECK(pool.submit([] { return 1; }).get() == 1);
+    }
+}
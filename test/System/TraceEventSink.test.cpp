@@ -0,0 +1,73 @@
+#include <SFML/System/TraceEventSink.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+TEST_CASE("[System] sf::TraceEventSink")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::ProfilerSink, sf::TraceEventSink>);
+        STATIC_CHECK(std::is_default_constructible_v<sf::TraceEventSink>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TraceEventSink>);
+    }
+
+    sf::TraceEventSink sink;
+
+    SECTION("Construction")
+    {
+        CHECK(sink.getEventCount() == 0);
+    }
+
+    SECTION("Record zones")
+    {
+        sink.beginZone("outer");
+        sink.beginZone("inner");
+        sink.endZone();
+        sink.endZone();
+        std::thread([&sink] {
+            sink.beginZone("thread");
+            sink.endZone();
+        }).join();
+        CHECK(sink.getEventCount() == 6);
+
+        sink.clear();
+        CHECK(sink.getEventCount() == 0);
+    }
+
+    SECTION("saveToFile()")
+    {
+        sink.beginZone("sf::\"quoted\"");
+        sink.endZone();
+        std::thread([&sink] {
+            sink.beginZone("thread");
+            sink.endZone();
+        }).join();
+
+        const auto filename = std::filesystem::temp_directory_path() / "sfml-trace.json";
+        REQUIRE(sink.saveToFile(filename));
+
+        std::ifstream     file(filename);
+        const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+        std::filesystem::remove(filename);
+
+        CHECK(contents.find(R"({"ph":"B","cat":"sfml","name":"sf::\"quoted\"","ts":)") != std::string::npos);
+        CHECK(contents.find(R"("name":"thread","ts":)") != std::string::npos);
+        CHECK(contents.find(R"("pid":1,"tid":1})") != std::string::npos);
+        CHECK(contents.find(R"("pid":1,"tid":2})") != std::string::npos);
+        CHECK(contents.rfind("{\"traceEvents\":[", 0) == 0);
+        CHECK(contents.find("\n]}\n") != std::string::npos);
+    }
+
+    SECTION("saveToFile() failure")
+    {
+        CHECK(!sink.saveToFile(std::filesystem::temp_directory_path() / "missing-directory" / "trace.json"));
+    }
+}
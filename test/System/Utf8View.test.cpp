@@ -0,0 +1,79 @@
+#include <SFML/System/Utf8View.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+using namespace std::string_view_literals;
+
+TEST_CASE("[System] sf::Utf8View")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::Utf8View>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::Utf8View>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Utf8View>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Utf8View>);
+        STATIC_CHECK(std::is_trivially_copyable_v<sf::Utf8View>);
+        STATIC_CHECK(!std::is_convertible_v<std::string_view, sf::Utf8View>);
+        STATIC_CHECK(std::is_convertible_v<const sf::U8String&, sf::Utf8View>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            constexpr sf::Utf8View view;
+            STATIC_CHECK(view.isEmpty());
+            STATIC_CHECK(view.getSize() == 0);
+            STATIC_CHECK(view.getBytes().empty());
+        }
+
+        SECTION("std::string_view constructor")
+        {
+            constexpr sf::Utf8View view("Caf\xc3\xa9"sv);
+            STATIC_CHECK(!view.isEmpty());
+            STATIC_CHECK(view.getSize() == 5);
+            STATIC_CHECK(view.getBytes() == "Caf\xc3\xa9"sv);
+        }
+
+        SECTION("sf::U8String constructor")
+        {
+            const sf::U8String string = {0x43, 0x61, 0x66, 0xc3, 0xa9};
+            const sf::Utf8View view   = string;
+            CHECK(view.getSize() == 5);
+            CHECK(view.getBytes() == "Caf\xc3\xa9"sv);
+        }
+    }
+
+    SECTION("toString()")
+    {
+        CHECK(sf::Utf8View().toString().isEmpty());
+        CHECK(sf::Utf8View("abc"sv).toString() == "abc");
+
+        const sf::String string = sf::Utf8View("Caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x8c\x8d"sv).toString();
+        CHECK(string.getSize() == 8);
+        CHECK(string[3] == U'\u00e9');
+        CHECK(string[4] == U' ');
+        CHECK(string[5] == U'\u20ac');
+        CHECK(string[7] == U'\U0001f30d');
+    }
+
+    SECTION("Operators")
+    {
+        SECTION("operator==")
+        {
+            STATIC_CHECK(sf::Utf8View() == sf::Utf8View());
+            STATIC_CHECK(sf::Utf8View("abc"sv) == sf::Utf8View("abc"sv));
+            STATIC_CHECK(sf::Utf8View("abc"sv) == sf::Utf8View("abcd"sv.substr(0, 3)));
+        }
+
+        SECTION("operator!=")
+        {
+            STATIC_CHECK(sf::Utf8View("abc"sv) != sf::Utf8View());
+            STATIC_CHECK(sf::Utf8View("abc"sv) != sf::Utf8View("abd"sv));
+        }
+    }
+}
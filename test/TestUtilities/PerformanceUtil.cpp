@@ -0,0 +1,357 @@
+#include <SFML/Graphics/GpuProfiler.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <SFML/System/FastClock.hpp>
+
+#include <PerformanceUtil.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+namespace
+{
+// Frames rendered before the measurements start, to let the driver settle
+constexpr std::size_t warmUpFrames = 10;
+
+// Just enough JSON to read back the results written by writeResults, or edited by hand
+struct JsonValue
+{
+    double                   number{};
+    std::string              string;
+    std::vector<std::string> keys;     // Keys of the members of an object
+    std::vector<JsonValue>   elements; // Values of the members of an object, or elements of an array
+
+    [[nodiscard]] const JsonValue* find(const std::string& key) const
+    {
+        const auto it = std::find(keys.begin(), keys.end(), key);
+        return it != keys.end() ? &elements[static_cast<std::size_t>(it - keys.begin())] : nullptr;
+    }
+};
+
+class JsonParser
+{
+public:
+    explicit JsonParser(const std::string& text) : m_text(text)
+    {
+    }
+
+    [[nodiscard]] bool parse(JsonValue& value)
+    {
+        return parseValue(value) && (skipSpaces() == m_text.size());
+    }
+
+private:
+    std::size_t skipSpaces()
+    {
+        while ((m_position < m_text.size()) && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+            ++m_position;
+        return m_position;
+    }
+
+    bool consume(char character)
+    {
+        if ((skipSpaces() < m_text.size()) && (m_text[m_position] == character))
+        {
+            ++m_position;
+            return true;
+        }
+        return false;
+    }
+
+    bool parseString(std::string& string)
+    {
+        if (!consume('"'))
+            return false;
+
+        while (m_position < m_text.size())
+        {
+            const char character = m_text[m_position++];
+            if (character == '"')
+                return true;
+
+            if ((character == '\\') && (m_position < m_text.size()))
+                string += m_text[m_position++];
+            else
+                string += character;
+        }
+        return false;
+    }
+
+    bool parseValue(JsonValue& value)
+    {
+        if (skipSpaces() == m_text.size())
+            return false;
+
+        switch (m_text[m_position])
+        {
+            case '"':
+                return parseString(value.string);
+            case '{':
+                ++m_position;
+                if (consume('}'))
+                    return true;
+                do
+                {
+                    value.keys.emplace_back();
+                    value.elements.emplace_back();
+                    if (!parseString(value.keys.back()) || !consume(':') || !parseValue(value.elements.back()))
+                        return false;
+                } while (consume(','));
+                return consume('}');
+            case '[':
+                ++m_position;
+                if (consume(']'))
+                    return true;
+                do
+                {
+                    value.elements.emplace_back();
+                    if (!parseValue(value.elements.back()))
+                        return false;
+                } while (consume(','));
+                return consume(']');
+            default:
+            {
+                const char* begin = m_text.c_str() + m_position;
+                char*       end   = nullptr;
+                value.number      = std::strtod(begin, &end);
+                m_position += static_cast<std::size_t>(end - begin);
+                return end != begin;
+            }
+        }
+    }
+
+    const std::string& m_text;
+    std::size_t        m_position{};
+};
+
+// Fields of SceneResults, in the order they are written
+struct TimeField
+{
+    const char* key;
+    sf::Time SceneResults::*member;
+};
+
+struct CountField
+{
+    const char* key;
+    std::size_t SceneResults::*member;
+};
+
+const TimeField timeFields[] = {{"cpuMedianUs", &SceneResults::cpuMedian},
+                                {"cpu95Us", &SceneResults::cpu95},
+                                {"cpu99Us", &SceneResults::cpu99},
+                                {"gpuMedianUs", &SceneResults::gpuMedian},
+                                {"gpu95Us", &SceneResults::gpu95},
+                                {"gpu99Us", &SceneResults::gpu99}};
+
+const CountField countFields[] = {{"drawCalls", &SceneResults::drawCalls},
+                                  {"vertices", &SceneResults::vertices},
+                                  {"stateChanges", &SceneResults::stateChanges}};
+} // namespace
+
+std::size_t getPerformanceFrameCount()
+{
+    const char* frames = std::getenv("SFML_PERFORMANCE_FRAMES");
+    if (frames == nullptr)
+        return 300;
+
+    return std::max<std::size_t>(1, std::strtoul(frames, nullptr, 10));
+}
+
+std::optional<std::filesystem::path> getPerformancePath(const char* variable)
+{
+    const char* path = std::getenv(variable);
+    if ((path == nullptr) || (*path == '\0'))
+        return std::nullopt;
+
+    return path;
+}
+
+SceneResults measureScene(const std::string&                                           name,
+                          sf::RenderTexture&                                           target,
+                          std::size_t                                                  frames,
+                          const std::function<void(sf::RenderTexture&, std::size_t)>& draw)
+{
+    SceneResults results;
+    results.name   = name;
+    results.frames = frames;
+
+    // Scopes are named after their frame, to know which frame the lagging GPU results belong to
+    sf::GpuProfiler       profiler(target);
+    std::vector<sf::Time> cpuTimes;
+    std::vector<sf::Time> gpuTimes;
+    std::string           lastCollected;
+    const auto            collectGpuTime = [&]
+    {
+        const std::vector<sf::GpuProfiler::Timings>& timings = profiler.getResults();
+        if (timings.empty() || (timings.front().name == lastCollected))
+            return;
+
+        lastCollected = timings.front().name;
+        if (std::stoul(lastCollected) >= warmUpFrames)
+            gpuTimes.push_back(timings.front().gpuTime);
+    };
+
+    sf::RenderTarget::Statistics before;
+    for (std::size_t frame = 0; frame < warmUpFrames + frames; ++frame)
+    {
+        if (frame == warmUpFrames)
+            before = target.getStatistics();
+
+        const auto start = sf::FastClock::now();
+        profiler.beginScope(std::to_string(frame));
+        target.clear();
+        draw(target, frame);
+        profiler.endScope();
+        target.display();
+        const auto end = sf::FastClock::now();
+
+        profiler.endFrame();
+        if (frame >= warmUpFrames)
+            cpuTimes.push_back(sf::FastClock::toTime(end - start));
+        collectGpuTime();
+    }
+
+    const sf::RenderTarget::Statistics& after = target.getStatistics();
+    results.drawCalls                         = (after.drawCalls - before.drawCalls) / frames;
+    results.vertices                          = (after.vertices - before.vertices) / frames;
+    results.stateChanges                      = (after.stateChanges - before.stateChanges) / frames;
+
+    // Empty frames let the results of the last measured frames come back
+    for (std::size_t i = 0; i < sf::GpuProfiler::getMaxPendingFrames(); ++i)
+    {
+        target.clear();
+        target.display();
+        profiler.endFrame();
+        collectGpuTime();
+    }
+
+    results.cpuMedian = computePercentile(cpuTimes, 0.5);
+    results.cpu95     = computePercentile(cpuTimes, 0.95);
+    results.cpu99     = computePercentile(cpuTimes, 0.99);
+    if (sf::GpuProfiler::isAvailable())
+    {
+        results.gpuMedian = computePercentile(gpuTimes, 0.5);
+        results.gpu95     = computePercentile(gpuTimes, 0.95);
+        results.gpu99     = computePercentile(gpuTimes, 0.99);
+    }
+
+    return results;
+}
+
+sf::Time computePercentile(std::vector<sf::Time> times, double percentile)
+{
+    if (times.empty())
+        return sf::Time::Zero;
+
+    // Nearest-rank percentile
+    const auto rank = static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(times.size())));
+    const auto nth  = times.begin() + static_cast<std::ptrdiff_t>(std::clamp<std::size_t>(rank, 1, times.size()) - 1);
+    std::nth_element(times.begin(), nth, times.end());
+    return *nth;
+}
+
+std::string writeResults(const std::vector<SceneResults>& results, const Tolerances& tolerances)
+{
+    std::ostringstream stream;
+    stream << "{\n    \"timeTolerance\": " << tolerances.time << ",\n    \"countTolerance\": " << tolerances.count
+           << ",\n    \"scenes\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const SceneResults& scene = results[i];
+        stream << (i > 0 ? "," : "") << "\n        {\n            \"name\": " << std::quoted(scene.name)
+               << ",\n            \"frames\": " << scene.frames;
+        for (const TimeField& field : timeFields)
+            stream << ",\n            \"" << field.key << "\": " << (scene.*field.member).asMicroseconds();
+        for (const CountField& field : countFields)
+            stream << ",\n            \"" << field.key << "\": " << scene.*field.member;
+        stream << "\n        }";
+    }
+
+    stream << "\n    ]\n}\n";
+    return stream.str();
+}
+
+std::optional<std::vector<SceneResults>> readResults(const std::string& json, Tolerances& tolerances)
+{
+    JsonValue  root;
+    JsonParser parser(json);
+    if (!parser.parse(root))
+        return std::nullopt;
+
+    if (const JsonValue* time = root.find("timeTolerance"))
+        tolerances.time = time->number;
+    if (const JsonValue* count = root.find("countTolerance"))
+        tolerances.count = count->number;
+
+    const JsonValue* scenes = root.find("scenes");
+    if (scenes == nullptr)
+        return std::nullopt;
+
+    std::vector<SceneResults> results;
+    for (const JsonValue& scene : scenes->elements)
+    {
+        SceneResults& entry = results.emplace_back();
+        if (const JsonValue* name = scene.find("name"))
+            entry.name = name->string;
+        if (const JsonValue* frames = scene.find("frames"))
+            entry.frames = static_cast<std::size_t>(frames->number);
+
+        // Missing values are treated as zero, which disables their comparison
+        for (const TimeField& field : timeFields)
+            if (const JsonValue* value = scene.find(field.key))
+                entry.*field.member = sf::microseconds(static_cast<std::int64_t>(value->number));
+        for (const CountField& field : countFields)
+            if (const JsonValue* value = scene.find(field.key))
+                entry.*field.member = static_cast<std::size_t>(value->number);
+    }
+
+    return results;
+}
+
+std::vector<std::string> findRegressions(const std::vector<SceneResults>& results,
+                                         const std::vector<SceneResults>& baseline,
+                                         const Tolerances&                tolerances)
+{
+    std::vector<std::string> regressions;
+    const auto check = [&](const std::string& scene, const char* key, double value, double reference, double tolerance)
+    {
+        if ((reference > 0) && (value > reference * (1 + tolerance)))
+        {
+            std::ostringstream stream;
+            stream << scene << ": " << key << " is " << value << ", baseline is " << reference << " (+"
+                   << std::lround((value / reference - 1) * 100) << "%)";
+            regressions.push_back(stream.str());
+        }
+    };
+
+    for (const SceneResults& scene : results)
+    {
+        const auto reference = std::find_if(baseline.begin(),
+                                            baseline.end(),
+                                            [&](const SceneResults& entry) { return entry.name == scene.name; });
+        if (reference == baseline.end())
+            continue;
+
+        for (const TimeField& field : timeFields)
+            check(scene.name,
+                  field.key,
+                  static_cast<double>((scene.*field.member).asMicroseconds()),
+                  static_cast<double>(((*reference).*field.member).asMicroseconds()),
+                  tolerances.time);
+        for (const CountField& field : countFields)
+            check(scene.name,
+                  field.key,
+                  static_cast<double>(scene.*field.member),
+                  static_cast<double>((*reference).*field.member),
+                  tolerances.count);
+    }
+
+    return regressions;
+}
@@ -0,0 +1,75 @@
+// Header for SFML performance tests.
+//
+// Frame time measurements of offscreen scenes, saved as JSON and compared against a baseline.
+// The tests are only built by the test-sfml-performance target, see runperformancetests.
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace sf
+{
+class RenderTexture;
+}
+
+// Measurements of a scene rendered for a number of frames
+struct SceneResults
+{
+    std::string name;
+    std::size_t frames{};
+
+    // Percentiles of the time spent submitting each frame
+    sf::Time cpuMedian;
+    sf::Time cpu95;
+    sf::Time cpu99;
+
+    // Percentiles of the time taken by the GPU to execute each frame, zero without timer queries
+    sf::Time gpuMedian;
+    sf::Time gpu95;
+    sf::Time gpu99;
+
+    // OpenGL work per frame
+    std::size_t drawCalls{};
+    std::size_t vertices{};
+    std::size_t stateChanges{};
+};
+
+// How much worse than the baseline a result may be, as a fraction of the baseline value
+struct Tolerances
+{
+    double time{0.25};
+    double count{0};
+};
+
+// Number of measured frames per scene, SFML_PERFORMANCE_FRAMES or 300
+[[nodiscard]] std::size_t getPerformanceFrameCount();
+
+// Path given by an environment variable, if set
+[[nodiscard]] std::optional<std::filesystem::path> getPerformancePath(const char* variable);
+
+// Render a scene to a texture, after a few warm-up frames, and measure every frame
+// The draw function is called once per frame, between clear() and display(), with the index of the frame
+[[nodiscard]] SceneResults measureScene(const std::string&                                           name,
+                                        sf::RenderTexture&                                           target,
+                                        std::size_t                                                  frames,
+                                        const std::function<void(sf::RenderTexture&, std::size_t)>& draw);
+
+// Compute a percentile of a list of times, percentile being in [0, 1]
+[[nodiscard]] sf::Time computePercentile(std::vector<sf::Time> times, double percentile);
+
+[[nodiscard]] std::string writeResults(const std::vector<SceneResults>& results, const Tolerances& tolerances);
+[[nodiscard]] std::optional<std::vector<SceneResults>> readResults(const std::string& json, Tolerances& tolerances);
+
+// Describe every value of the results that is worse than the baseline beyond the tolerances
+// Values that are zero in the baseline, like GPU times measured without timer queries, aren't compared
+[[nodiscard]] std::vector<std::string> findRegressions(const std::vector<SceneResults>& results,
+                                                       const std::vector<SceneResults>& baseline,
+                                                       const Tolerances&                tolerances);
@@ -6,6 +6,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <WindowUtil.hpp>
+#include <future>
 #include <string>
 #include <type_traits>
 
@@ -140,6 +141,36 @@ TEST_CASE("[Window] sf::Context", runDisplayTests())
         CHECK(sf::Context::getActiveContextId() == 0);
     }
 
+    SECTION("getStatistics()")
+    {
+        sf::Context context;
+
+        const sf::Context::Statistics before = sf::Context::getStatistics();
+        CHECK(context.setActive(true));
+        CHECK(sf::Context::getStatistics().redundantActivations == before.redundantActivations + 1);
+        CHECK(sf::Context::getStatistics().contextSwitches == before.contextSwitches);
+
+        CHECK(context.setActive(false));
+        CHECK(context.setActive(true));
+        CHECK(sf::Context::getStatistics().contextSwitches == before.contextSwitches + 2);
+
+        CHECK(before.sharedContextCreation > sf::Time::Zero);
+        CHECK(before.formatSelection >= sf::Time::Zero);
+    }
+
+    SECTION("preloadAsync()")
+    {
+        std::future<bool> preload = sf::Context::preloadAsync();
+        REQUIRE(preload.valid());
+        CHECK(preload.get());
+
+        // The preloaded shared context is reused
+        const sf::Context::Statistics before = sf::Context::getStatistics();
+        const sf::Context             context;
+        CHECK(sf::Context::getStatistics().sharedContextCreation == before.sharedContextCreation);
+        CHECK(context.getSettings().majorVersion > 0);
+    }
+
     SECTION("Version String")
     {
         sf::Context context;
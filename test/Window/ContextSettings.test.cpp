@@ -26,11 +26,13 @@ TEST_CASE("[Window] sf::ContextSettings")
             STATIC_CHECK(contextSettings.minorVersion == 1);
             STATIC_CHECK(contextSettings.attributeFlags == sf::ContextSettings::Default);
             STATIC_CHECK(contextSettings.sRgbCapable == false);
+            STATIC_CHECK(contextSettings.lowLatencyPresentation == false);
+            STATIC_CHECK(contextSettings.sharedWindowContext == false);
         }
 
         SECTION("Aggregate initialization -- Everything")
         {
-            constexpr sf::ContextSettings contextSettings{1, 1, 2, 3, 5, sf::ContextSettings::Core, true};
+            constexpr sf::ContextSettings contextSettings{1, 1, 2, 3, 5, sf::ContextSettings::Core, true, true, true};
             STATIC_CHECK(contextSettings.depthBits == 1);
             STATIC_CHECK(contextSettings.stencilBits == 1);
             STATIC_CHECK(contextSettings.antialiasingLevel == 2);
@@ -38,6 +40,8 @@ TEST_CASE("[Window] sf::ContextSettings")
             STATIC_CHECK(contextSettings.minorVersion == 5);
             STATIC_CHECK(contextSettings.attributeFlags == sf::ContextSettings::Core);
             STATIC_CHECK(contextSettings.sRgbCapable == true);
+            STATIC_CHECK(contextSettings.lowLatencyPresentation == true);
+            STATIC_CHECK(contextSettings.sharedWindowContext == true);
         }
     }
 }
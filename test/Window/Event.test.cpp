@@ -35,6 +35,19 @@ TEST_CASE("[Window] sf::Event")
         }
     }
 
+    SECTION("Set/get timestamp")
+    {
+        sf::Event event = sf::Event::Closed{};
+        CHECK(event.getTimestamp() == sf::Time::Zero);
+
+        event.setTimestamp(sf::milliseconds(42));
+        CHECK(event.getTimestamp() == sf::milliseconds(42));
+        CHECK(event.is<sf::Event::Closed>());
+
+        const sf::Event copy = event;
+        CHECK(copy.getTimestamp() == sf::milliseconds(42));
+    }
+
     SECTION("Assign all possible values")
     {
         sf::Event event;
@@ -210,6 +223,11 @@ TEST_CASE("[Window] sf::Event")
         const auto& sensorChanged = *event.getIf<sf::Event::SensorChanged>();
         CHECK(sensorChanged.type == sf::Sensor::Type::Gravity);
         CHECK(sensorChanged.value == sf::Vector3f(1.2f, 3.4f, 5.6f));
+
+        event = sf::Event::MonitorsChanged{};
+        CHECK(event);
+        CHECK(event.is<sf::Event::MonitorsChanged>());
+        CHECK(event.getIf<sf::Event::MonitorsChanged>());
     }
 
     SECTION("Subtypes")
@@ -221,6 +239,7 @@ TEST_CASE("[Window] sf::Event")
         STATIC_CHECK(std::is_empty_v<sf::Event::FocusGained>);
         STATIC_CHECK(std::is_empty_v<sf::Event::MouseEntered>);
         STATIC_CHECK(std::is_empty_v<sf::Event::MouseLeft>);
+        STATIC_CHECK(std::is_empty_v<sf::Event::MonitorsChanged>);
 
         // Non-empty structs
         const sf::Event::Resized resized;
@@ -0,0 +1,85 @@
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/InputSnapshot.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Window] sf::InputSnapshot")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::InputSnapshot>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::InputSnapshot>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::InputSnapshot>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::InputSnapshot>);
+    }
+
+    sf::InputSnapshot snapshot;
+
+    SECTION("Construction")
+    {
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::A));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::A));
+        CHECK(!snapshot.isMouseButtonPressed(sf::Mouse::Button::Left));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i());
+    }
+
+    SECTION("Keyboard events")
+    {
+        snapshot.update(sf::Event::KeyPressed{sf::Keyboard::Key::A, sf::Keyboard::Scan::Q});
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Key::A));
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Scan::Q));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::Q));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::A));
+
+        snapshot.update(sf::Event::KeyReleased{sf::Keyboard::Key::A, sf::Keyboard::Scan::Q});
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::A));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::Q));
+
+        // Unknown keys are ignored
+        snapshot.update(sf::Event::KeyPressed{sf::Keyboard::Key::Unknown, sf::Keyboard::Scan::Unknown});
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::Unknown));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::Unknown));
+    }
+
+    SECTION("Mouse events")
+    {
+        snapshot.update(sf::Event::MouseButtonPressed{sf::Mouse::Button::Right, {10, 20}});
+        CHECK(snapshot.isMouseButtonPressed(sf::Mouse::Button::Right));
+        CHECK(!snapshot.isMouseButtonPressed(sf::Mouse::Button::Left));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(10, 20));
+
+        snapshot.update(sf::Event::MouseMoved{{30, 40}});
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(30, 40));
+
+        snapshot.update(sf::Event::MouseButtonReleased{sf::Mouse::Button::Right, {50, 60}});
+        CHECK(!snapshot.isMouseButtonPressed(sf::Mouse::Button::Right));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(50, 60));
+    }
+
+    SECTION("Focus lost")
+    {
+        snapshot.update(sf::Event::KeyPressed{sf::Keyboard::Key::Space, sf::Keyboard::Scan::Space});
+        snapshot.update(sf::Event::MouseButtonPressed{sf::Mouse::Button::Left, {1, 2}});
+        snapshot.update(sf::Event::FocusLost{});
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::Space));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::Space));
+        CHECK(!snapshot.isMouseButtonPressed(sf::Mouse::Button::Left));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(1, 2));
+    }
+}
+
+TEST_CASE("[Window] sf::InputSnapshot capture", runDisplayTests())
+{
+    sf::InputSnapshot snapshot;
+    snapshot.capture();
+
+    // Like the tests of sf::Keyboard, assume that nobody is touching the keyboard
+    CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::W));
+    CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::W));
+    CHECK(snapshot.isKeyPressed(sf::Keyboard::Key::A) == sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A));
+}
@@ -44,6 +44,22 @@ TEST_CASE("[Window] sf::VideoMode", runDisplayTests())
     {
         const auto& modes = sf::VideoMode::getFullscreenModes();
         CHECK(std::is_sorted(modes.begin(), modes.end(), std::greater<>()));
+
+        // The modes are cached
+        CHECK(&sf::VideoMode::getFullscreenModes() == &modes);
+    }
+
+    SECTION("getMonitors()")
+    {
+        const auto& monitors = sf::VideoMode::getMonitors();
+        if (!monitors.empty())
+        {
+            CHECK(monitors.front().primary);
+            const auto isPrimary = [](const sf::Monitor& monitor) { return monitor.primary; };
+            CHECK(std::count_if(monitors.begin(), monitors.end(), isPrimary) == 1);
+            for (const sf::Monitor& monitor : monitors)
+                CHECK(monitor.refreshRate >= 0);
+        }
     }
 
     SECTION("isValid()")
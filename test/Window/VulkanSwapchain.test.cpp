@@ -0,0 +1,46 @@
+#include <SFML/Window/VulkanSwapchain.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+TEST_CASE("[Window] sf::VulkanSwapchain")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::VulkanSwapchain>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::VulkanSwapchain>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::VulkanSwapchain>);
+        STATIC_CHECK(!std::is_move_assignable_v<sf::VulkanSwapchain>);
+    }
+
+    SECTION("Settings")
+    {
+        const sf::VulkanSwapchain::Settings settings;
+        CHECK(settings.presentMode == sf::VulkanSwapchain::PresentMode::Fifo);
+        CHECK(!settings.sRgb);
+        CHECK(settings.minImageCount == 0);
+        CHECK(settings.queueFamilies.empty());
+        CHECK(!settings.presentWait);
+    }
+
+    SECTION("Construction")
+    {
+        sf::VulkanSwapchain swapchain;
+        CHECK(swapchain.getHandle() == VkSwapchainKHR{});
+        CHECK(swapchain.getSize() == sf::Vector2u());
+        CHECK(swapchain.getPresentMode() == sf::VulkanSwapchain::PresentMode::Fifo);
+        CHECK(swapchain.getImages().empty());
+        CHECK(swapchain.getImageViews().empty());
+        CHECK(swapchain.getLastPresentId() == 0);
+        CHECK(!swapchain.isPresentWaitEnabled());
+        CHECK(!swapchain.isOutOfDate());
+        CHECK(!swapchain.acquireNextImage(VkSemaphore{}));
+        CHECK(!swapchain.present(VkQueue{}, 0, VkSemaphore{}));
+        CHECK(!swapchain.waitForPresent(0, sf::Time::Zero));
+        CHECK(!swapchain.recreate({800, 600}));
+
+        swapchain.destroy();
+        CHECK(swapchain.getHandle() == VkSwapchainKHR{});
+    }
+}
@@ -1,6 +1,7 @@
 #include <SFML/Window/Window.hpp>
 
 // Other 1st party headers
+#include <SFML/Window/Context.hpp>
 #include <SFML/Window/VideoMode.hpp>
 
 #include <SFML/System/String.hpp>
@@ -142,4 +143,78 @@ TEST_CASE("[Window] sf::Window", runDisplayTests())
             CHECK(window.getSettings().antialiasingLevel >= 1);
         }
     }
+
+    SECTION("Frame pacing")
+    {
+        sf::Window window(sf::VideoMode({360, 240}), "Window Tests");
+        CHECK(!window.isPreciseFramePacingEnabled());
+        CHECK(window.getFrameStatistics().frameCount == 0);
+
+        window.setPreciseFramePacingEnabled(true);
+        CHECK(window.isPreciseFramePacingEnabled());
+
+        window.setFramerateLimit(100);
+        for (int i = 0; i < 5; ++i)
+            window.display();
+
+        const sf::Window::FrameStatistics& statistics = window.getFrameStatistics();
+        CHECK(statistics.frameCount == 5);
+        CHECK(statistics.averageFrameTime >= sf::milliseconds(9));
+        CHECK(statistics.minFrameTime <= statistics.averageFrameTime);
+        CHECK(statistics.maxFrameTime >= statistics.averageFrameTime);
+        CHECK(statistics.lastFrameTime >= statistics.minFrameTime);
+
+        window.resetFrameStatistics();
+        CHECK(window.getFrameStatistics().frameCount == 0);
+        CHECK(window.getFrameStatistics().missedDeadlines == 0);
+
+        window.setFrameTimeLimit(sf::milliseconds(20));
+        for (int i = 0; i < 3; ++i)
+            window.display();
+        CHECK(window.getFrameStatistics().averageFrameTime >= sf::milliseconds(19));
+    }
+
+    SECTION("Presentation control")
+    {
+        sf::Window window(sf::VideoMode({360, 240}), "Window Tests");
+
+        // Support depends on the driver, only the consistency of the results can be checked
+        if (window.setSwapInterval(1))
+            CHECK(window.setSwapInterval(0));
+
+        (void)window.setSwapInterval(-1);
+        (void)window.delayBeforeSwap(sf::milliseconds(1));
+        window.display();
+
+        if (const auto timing = window.getPresentTiming())
+        {
+            CHECK(timing->refreshRate >= 0);
+
+            // A target frame rate is matched to the refresh rate whenever it is known
+            if (timing->refreshRate > 0)
+                CHECK(window.setTargetFrameRate(30) == window.setSwapInterval(1));
+        }
+
+        (void)window.setTargetFrameRate(0);
+    }
+
+    SECTION("Shared window context")
+    {
+        sf::ContextSettings settings;
+        settings.sharedWindowContext = true;
+
+        const sf::Window first(sf::VideoMode({360, 240}), "Window Tests", sf::State::Windowed, settings);
+        const sf::Window second(sf::VideoMode({360, 240}), "Window Tests", sf::State::Windowed, settings);
+
+        REQUIRE(first.setActive());
+        const auto firstId = sf::Context::getActiveContextId();
+        REQUIRE(second.setActive());
+        const auto secondId = sf::Context::getActiveContextId();
+        CHECK(firstId != 0);
+        CHECK(secondId != 0);
+
+        // Windows only share their context where it is supported
+        CHECK(second.getSettings().majorVersion == first.getSettings().majorVersion);
+        CHECK(second.setActive(false));
+    }
 }
@@ -9,6 +9,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <WindowUtil.hpp>
+#include <array>
 #include <type_traits>
 
 TEST_CASE("[Window] sf::WindowBase", runDisplayTests())
@@ -114,6 +115,84 @@ TEST_CASE("[Window] sf::WindowBase", runDisplayTests())
         CHECK(!windowBase.waitEvent());
     }
 
+    SECTION("pollEvents()")
+    {
+        sf::WindowBase           windowBase;
+        std::array<sf::Event, 4> events;
+        CHECK(windowBase.pollEvents(events.data(), events.size()) == 0);
+    }
+
+    SECTION("handleEvents()")
+    {
+        sf::WindowBase windowBase;
+        int            count = 0;
+        windowBase.handleEvents([&count](const sf::Event&) { ++count; });
+        CHECK(count == 0);
+    }
+
+    SECTION("Event thread")
+    {
+        sf::WindowBase windowBase;
+        CHECK(!windowBase.isEventThreadEnabled());
+        CHECK(!windowBase.setEventThreadEnabled(true));
+        CHECK(!windowBase.isEventThreadEnabled());
+
+        windowBase.create(sf::VideoMode({360, 240}), "WindowBase Tests");
+        if (windowBase.setEventThreadEnabled(true))
+        {
+            CHECK(windowBase.isEventThreadEnabled());
+            (void)windowBase.pollEvent();
+            CHECK(windowBase.setEventThreadEnabled(false));
+        }
+        CHECK(!windowBase.isEventThreadEnabled());
+    }
+
+    SECTION("Raw mouse batching")
+    {
+        sf::WindowBase windowBase;
+        windowBase.setRawMouseBatchingEnabled(true);
+        CHECK(!windowBase.isRawMouseBatchingEnabled());
+        CHECK(windowBase.getRawMouseInput().samples.empty());
+
+        windowBase.create(sf::VideoMode({360, 240}), "WindowBase Tests");
+        CHECK(!windowBase.isRawMouseBatchingEnabled());
+        windowBase.setRawMouseBatchingEnabled(true);
+        CHECK(windowBase.isRawMouseBatchingEnabled());
+
+        (void)windowBase.pollEvent();
+        const sf::WindowBase::RawMouseInput& rawInput = windowBase.getRawMouseInput();
+        sf::Vector2i                         sum;
+        for (const sf::WindowBase::RawMouseSample& sample : rawInput.samples)
+            sum += sample.delta;
+        CHECK(sum == rawInput.delta);
+
+        windowBase.setRawMouseBatchingEnabled(false);
+        CHECK(!windowBase.isRawMouseBatchingEnabled());
+    }
+
+    SECTION("Touch coalescing")
+    {
+        sf::WindowBase windowBase;
+        windowBase.setTouchCoalescingEnabled(true);
+        CHECK(!windowBase.isTouchCoalescingEnabled());
+        CHECK(windowBase.getTouchInput().samples.empty());
+        CHECK(windowBase.getTouchInput().predicted.empty());
+
+        windowBase.create(sf::VideoMode({360, 240}), "WindowBase Tests");
+        CHECK(!windowBase.isTouchCoalescingEnabled());
+        windowBase.setTouchCoalescingEnabled(true);
+        CHECK(windowBase.isTouchCoalescingEnabled());
+
+        (void)windowBase.pollEvent();
+        const sf::WindowBase::TouchInput& touchInput = windowBase.getTouchInput();
+        for (std::size_t i = 1; i < touchInput.samples.size(); ++i)
+            CHECK(touchInput.samples[i - 1].timestamp <= touchInput.samples[i].timestamp);
+
+        windowBase.setTouchCoalescingEnabled(false);
+        CHECK(!windowBase.isTouchCoalescingEnabled());
+        CHECK(windowBase.getTouchInput().samples.empty());
+    }
+
     SECTION("Set/get position")
     {
         sf::WindowBase windowBase;